@@ -32,7 +32,7 @@ else()
     foreach(impl ${DNNL_ENABLE_PRIMITIVE})
         string(TOUPPER ${impl} uimpl)
         if(NOT "${uimpl}" MATCHES
-                "^(BATCH_NORMALIZATION|BINARY|CONCAT|CONVOLUTION|DECONVOLUTION|ELTWISE|GATED_MLP|GROUP_NORMALIZATION|INNER_PRODUCT|LAYER_NORMALIZATION|LRN|MATMUL|POOLING|PRELU|REDUCTION|REORDER|RESAMPLING|RNN|SDPA|SHUFFLE|SOFTMAX|SUM)$")
+                "^(BATCH_NORMALIZATION|BINARY|CONCAT|CONVOLUTION|DECONVOLUTION|ELTWISE|EMBEDDING_BAG|GATED_MLP|GROUP_NORMALIZATION|INNER_PRODUCT|LAYER_NORMALIZATION|LRN|MATMUL|OPTIMIZER|POOLING|PRELU|REDUCTION|REORDER|RESAMPLING|RNN|SDPA|SHUFFLE|SOFTMAX|SUM|TOPK)$")
             message(FATAL_ERROR "Unsupported primitive: ${uimpl}")
         endif()
         set(BUILD_${uimpl} TRUE)
@@ -81,6 +81,60 @@ else()
 endif()
 message(STATUS "Enabled GeMM kernels ISA: ${ONEDNN_ENABLE_GEMM_KERNELS_ISA}")
 
+if(ONEDNN_ENABLE_IMPL_MANIFEST STREQUAL "RECORD")
+    set(BUILD_IMPL_MANIFEST_RECORD TRUE)
+elseif(NOT ONEDNN_ENABLE_IMPL_MANIFEST STREQUAL "NONE")
+    set(manifest "${ONEDNN_ENABLE_IMPL_MANIFEST}")
+    if(NOT EXISTS "${manifest}")
+        message(FATAL_ERROR "Implementation manifest not found: ${manifest}")
+    endif()
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${manifest}")
+
+    # Verbose lines of a RECORD build end with the implementation class, other
+    # verbose lines are skipped.
+    file(STRINGS "${manifest}" manifest_lines)
+    set(manifest_impls)
+    foreach(line ${manifest_lines})
+        string(STRIP "${line}" line)
+        string(FIND "${line}" ",manifest," pos)
+        if(NOT pos EQUAL -1)
+            math(EXPR pos "${pos} + 10")
+            string(SUBSTRING "${line}" ${pos} -1 line)
+        elseif(line MATCHES "^(#|onednn_verbose)" OR line STREQUAL "")
+            continue()
+        endif()
+        list(APPEND manifest_impls "${line}")
+    endforeach()
+    list(REMOVE_DUPLICATES manifest_impls)
+    list(LENGTH manifest_impls manifest_impls_num)
+    if(manifest_impls_num EQUAL 0)
+        message(FATAL_ERROR "Implementation manifest is empty: ${manifest}")
+    endif()
+
+    set(manifest_inc "// Generated from ${manifest}\n")
+    foreach(impl ${manifest_impls})
+        string(APPEND manifest_inc "\"${impl}\",\n")
+    endforeach()
+    set(manifest_inc_file
+        "${PROJECT_BINARY_DIR}/src/common/impl_manifest_list.inc")
+    # Rewrite the list only when it changes to avoid full rebuilds.
+    file(WRITE "${manifest_inc_file}.tmp" "${manifest_inc}")
+    configure_file("${manifest_inc_file}.tmp" "${manifest_inc_file}" COPYONLY)
+
+    set(BUILD_IMPL_MANIFEST TRUE)
+    message(STATUS "Enabled implementations: ${manifest_impls_num} from ${manifest}")
+
+    # Pruned implementations are still compiled, the linker drops them.
+    if(CMAKE_CXX_COMPILER_ID MATCHES "(GNU|Clang)")
+        append(CMAKE_CCXX_FLAGS "-ffunction-sections -fdata-sections")
+        if(APPLE)
+            append(CMAKE_SHARED_LINKER_FLAGS "-Wl,-dead_strip")
+        else()
+            append(CMAKE_SHARED_LINKER_FLAGS "-Wl,--gc-sections")
+        endif()
+    endif()
+endif()
+
 # When certain primitives or primitive ISA are switched off, some functions may
 # become unused which is expected. Switch off warning for unused functions in
 # such cases.
@@ -164,9 +164,10 @@ onednn_option(ENABLE_PRIMITIVE "ALL"
     - ALL (the default). Includes all primitives to be enabled.
     - <PRIMITIVE_NAME>. Includes only the selected primitive to be enabled.
       Possible values are: BATCH_NORMALIZATION, BINARY, CONCAT, CONVOLUTION,
-      DECONVOLUTION, ELTWISE, GATED_MLP, GROUP_NORMALIZATION, INNER_PRODUCT,
-      LAYER_NORMALIZATION, LRN, MATMUL, POOLING, PRELU, REDUCTION, REORDER,
-      RESAMPLING, RNN, SDPA, SHUFFLE, SOFTMAX, SUM.
+      DECONVOLUTION, ELTWISE, EMBEDDING_BAG, GATED_MLP, GROUP_NORMALIZATION,
+      INNER_PRODUCT, LAYER_NORMALIZATION, LRN, MATMUL, OPTIMIZER, POOLING,
+      PRELU, REDUCTION, REORDER, RESAMPLING, RNN, SDPA, SHUFFLE, SOFTMAX, SUM,
+      TOPK.
     - <PRIMITIVE_NAME>;<PRIMITIVE_NAME>;... Includes only selected primitives to
       be enabled at build time. This is treated as CMake string, thus, semicolon
       is a mandatory delimiter between names. This is the way to specify several
@@ -353,6 +354,19 @@ onednn_option(ENABLE_GEMM_KERNELS_ISA "ALL"
       SSE41 < AVX2 < AVX512 < AMX (or ALL). It means that if user selects, e.g.
       AVX2 ISA, SSE41 kernels will also present at build time.")
 
+onednn_option(ENABLE_IMPL_MANIFEST "NONE"
+    "Specifies a set of CPU implementations to be available at build time.
+    Valid values:
+    - NONE (the default). Includes all implementations.
+    - RECORD. Reports the implementation class of every created primitive
+      descriptor when ONEDNN_VERBOSE=dispatch is set. The verbose log of a
+      workload can be used as a manifest for another build.
+    - <PATH>. Path to a manifest. Each line is either an implementation class
+      as written in the CPU implementation lists, e.g. jit_uni_shuffle_t<sve>,
+      or a line of a verbose log produced by a RECORD build. Implementations
+      missing from the manifest are replaced with stubs, and the library is
+      linked with garbage collection of unused sections.")
+
 onednn_option(SAFE_RBP OFF
     "Prohibits RBP register clobbering in JIT kernels. Use this option to enable
     runtime profiling with tools like Flame Graph.")
@@ -202,6 +202,24 @@ dnnl_status_t DNNL_API dnnl_primitive_create_from_cache_blob(
 dnnl_status_t DNNL_API dnnl_primitive_execute(const_dnnl_primitive_t primitive,
         dnnl_stream_t stream, int nargs, const dnnl_exec_arg_t *args);
 
+/// Executes a primitive on a batch of argument sets, as many calls to
+/// dnnl_primitive_execute() would. On CPU, the items of the batch may run
+/// concurrently in a single parallel region, each on one thread, which suits
+/// primitives too small to be split across the threads. The items must not
+/// write to the same memory.
+///
+/// @param primitive Primitive to execute.
+/// @param stream Stream to use.
+/// @param nbatch Number of items of the batch.
+/// @param nargs Array of @p nbatch numbers of arguments.
+/// @param args Array of @p nbatch arrays of arguments. Each argument is an
+///     <index, #dnnl_memory_t> pair, as for dnnl_primitive_execute().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_execute_batch(
+        const_dnnl_primitive_t primitive, dnnl_stream_t stream, int nbatch,
+        const int *nargs, const dnnl_exec_arg_t *const *args);
+
 /// Retrieves a constant reference to the primitive descriptor of a given
 /// primitive.
 ///
@@ -240,6 +258,98 @@ dnnl_status_t DNNL_API dnnl_primitive_get_cache_blob(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_primitive_destroy(dnnl_primitive_t primitive);
 
+/// Creates a prepared execution of a primitive. The arguments are validated
+/// and bound once, so that repeated executions of the primitive with the
+/// same arguments avoid the per-call argument processing of
+/// dnnl_primitive_execute().
+///
+/// @note
+///     The prepared execution keeps the primitive alive. The stream and the
+///     memory objects in @p args are not retained and must outlive the
+///     prepared execution.
+///
+/// @param prepared_exec Output prepared execution.
+/// @param primitive Primitive to execute.
+/// @param stream Stream to execute the primitive on. The stream must belong
+///     to the same engine as the primitive.
+/// @param nargs Number of arguments.
+/// @param args Array of arguments. Each argument is an
+///     <index, #dnnl_memory_t> pair. The position of an argument in the array
+///     is its slot in dnnl_prepared_exec_execute().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_prepared_exec_create(
+        dnnl_prepared_exec_t *prepared_exec, const_dnnl_primitive_t primitive,
+        dnnl_stream_t stream, int nargs, const dnnl_exec_arg_t *args);
+
+/// Executes a prepared execution.
+///
+/// @param prepared_exec Prepared execution.
+/// @param nhandles Number of data handles, at most the number of arguments
+///     the prepared execution was created with.
+/// @param handles Array of data handles. A non-NULL handle at position `i`
+///     replaces the data handle of the memory object bound to the slot `i`
+///     before the execution, as dnnl_memory_set_data_handle() does. Can be
+///     NULL if @p nhandles is 0.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_prepared_exec_execute(
+        dnnl_prepared_exec_t prepared_exec, int nhandles, void *const *handles);
+
+/// Destroys a prepared execution.
+///
+/// @param prepared_exec The prepared execution to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_prepared_exec_destroy(
+        dnnl_prepared_exec_t prepared_exec);
+
+/// Creates an empty command list. A command list records a sequence of
+/// primitive executions on a stream once and replays it with a single call.
+///
+/// @note
+///     The stream and the memory objects passed to the recorded executions
+///     are not retained and must outlive the command list.
+///
+/// @param command_list Output command list.
+/// @param stream Stream to execute the recorded primitives on.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_command_list_create(
+        dnnl_command_list_t *command_list, dnnl_stream_t stream);
+
+/// Appends a primitive execution to a command list. The arguments are
+/// validated and bound as with dnnl_prepared_exec_create().
+///
+/// @param command_list Command list.
+/// @param primitive Primitive to execute. The primitive must belong to the
+///     same engine as the stream of the command list.
+/// @param nargs Number of arguments.
+/// @param args Array of arguments. Each argument is an
+///     <index, #dnnl_memory_t> pair.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_command_list_append(
+        dnnl_command_list_t command_list, const_dnnl_primitive_t primitive,
+        int nargs, const dnnl_exec_arg_t *args);
+
+/// Executes the recorded primitives in the order they were appended. The
+/// execution stops at the first primitive that fails.
+///
+/// @param command_list Command list.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_command_list_execute(
+        dnnl_command_list_t command_list);
+
+/// Destroys a command list.
+///
+/// @param command_list The command list to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_command_list_destroy(
+        dnnl_command_list_t command_list);
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_attributes
@@ -418,6 +528,36 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_accumulation_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_accumulation_mode(
         dnnl_primitive_attr_t attr, dnnl_accumulation_mode_t mode);
 
+/// Returns the dispatch hint primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param goal Output dispatch goal.
+/// @param max_threads Output maximum number of threads, 0 if unbounded.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_dispatch_hint(
+        const_dnnl_primitive_attr_t attr, dnnl_dispatch_goal_t *goal,
+        int *max_threads);
+
+/// Sets the dispatch hint primitive attribute.
+///
+/// The hint tells the implementations what the primitive is optimized for
+/// and how many threads it will get at execution. It affects only the
+/// blocking and threading heuristics and never the results.
+///
+/// @param attr Primitive attributes.
+/// @param goal Dispatch goal. The possible values are:
+///     #dnnl_dispatch_goal_any (default),
+///     #dnnl_dispatch_goal_latency,
+///     #dnnl_dispatch_goal_throughput.
+/// @param max_threads Maximum number of threads the primitive uses, or 0
+///     (default) to use all the threads available at execution.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_dispatch_hint(
+        dnnl_primitive_attr_t attr, dnnl_dispatch_goal_t goal,
+        int max_threads);
+
 /// Returns the primitive attributes scratchpad mode.
 ///
 /// @param attr Primitive attributes.
@@ -923,6 +1063,26 @@ dnnl_status_t DNNL_API dnnl_post_ops_append_binary_v2(dnnl_post_ops_t post_ops,
         dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src1_desc,
         const_dnnl_memory_desc_t src2_desc);
 
+/// Appends a per-channel scale and shift post-op, for example a batch
+/// normalization in inference mode folded into the preceding operation.
+///
+/// The computations would be:
+///
+///     dst[:] <- dst[:] * scale[:] + shift[:]
+///
+/// The post-op is appended as a #dnnl_binary_mul post-op followed by a
+/// #dnnl_binary_add post-op, both with @p scale_shift_desc as the descriptor
+/// of the second operand. The scale and the shift are passed at execution as
+/// the `DNNL_ARG_SRC_1` arguments of the first and of the second of them
+/// respectively.
+///
+/// @param post_ops Post-ops.
+/// @param scale_shift_desc Memory descriptor of the scale and of the shift.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_post_ops_append_scale_shift(
+        dnnl_post_ops_t post_ops, const_dnnl_memory_desc_t scale_shift_desc);
+
 /// Returns the parameters of a binary post-op.
 ///
 /// @param post_ops Post-ops.
@@ -1498,6 +1658,30 @@ dnnl_status_t DNNL_API dnnl_memory_create_v2(dnnl_memory_t *memory,
         const_dnnl_memory_desc_t memory_desc, dnnl_engine_t engine,
         int nhandles, void **handles);
 
+/// Creates a read-only memory object over a user buffer.
+///
+/// The library doesn't own the buffer and never writes to it, so it can be a
+/// part of a read-only file mapping, for example weights mapped from a model
+/// file with `mmap()`. The buffer must stay valid as long as the memory
+/// object is used. Such memory can only be passed as an input argument to
+/// primitives, and its data handle can't be changed.
+///
+/// @note
+///     The weights that were stored in the layout a primitive expects, for
+///     example the layout queried with #dnnl_query_weights_md, are used in
+///     place without any reorder or copy.
+///
+/// @param memory Output memory object.
+/// @param memory_desc Memory descriptor.
+/// @param engine Engine to use. Only CPU engines are supported.
+/// @param handle Pointer to the buffer. It must be aligned to 64 bytes and
+///     hold at least dnnl_memory_desc_get_size() bytes.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_create_read_only(dnnl_memory_t *memory,
+        const_dnnl_memory_desc_t memory_desc, dnnl_engine_t engine,
+        const void *handle);
+
 /// Creates a memory object for a scalar value located on the host.
 ///
 /// @note The scalar value is copied from the provided pointer into the newly
@@ -3888,6 +4072,43 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Returns the total footprint in bytes that the primitives held in the
+/// primitive cache may have at the same time.
+///
+/// @param capacity Primitive cache capacity in bytes to query. The value 0
+/// means that the footprint is not limited. Concurrently accessing
+/// @p capacity is safe.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity_in_bytes(
+        size_t *capacity);
+
+/// Sets the total footprint in bytes that the primitives held in the
+/// primitive cache may have at the same time.
+///
+/// The footprint of a primitive is approximate and accounts for the
+/// primitive object and the code generated for it. The least recently used
+/// primitives are evicted once the total footprint exceeds the capacity. This
+/// limit applies in addition to the number of primitives set with
+/// #dnnl_set_primitive_cache_capacity().
+///
+/// @param capacity Primitive cache capacity in bytes to set. Setting the
+/// @p capacity to 0 removes the limit. Concurrently modifying @p capacity is
+/// safe.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity_in_bytes(
+        size_t capacity);
+
+/// Returns the total footprint in bytes of the primitives held in the
+/// primitive cache.
+///
+/// @param footprint Primitive cache footprint to query.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p footprint value is invalid, and #dnnl_success/#dnnl::status::success
+///     on success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_footprint(size_t *footprint);
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_service
@@ -4040,6 +4261,31 @@ dnnl_status_t DNNL_API dnnl_set_cpu_isa_hints(dnnl_cpu_isa_hints_t isa_hints);
 /// library can follow.
 dnnl_cpu_isa_hints_t DNNL_API dnnl_get_cpu_isa_hints(void);
 
+/// Sets the huge pages mode for the buffers allocated by the library on CPU:
+/// memory objects created without a user handle, scratchpads and, unless a
+/// user allocator is given, the buffers of the graph API. Only the buffers of
+/// at least one huge page are affected, and the allocations fall back to
+/// regular pages when huge pages are not available. See
+/// #dnnl_huge_pages_mode_t and #dnnl::huge_pages_mode for the list of the
+/// values accepted by the C and C++ API functions respectively.
+///
+/// @note
+///     This setting overrides the ONEDNN_HUGE_PAGES environment variable and
+///     only affects the buffers allocated after the call.
+///
+/// @param mode Huge pages mode.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p mode value is invalid, #dnnl_unimplemented/
+///     #dnnl::status::unimplemented if huge pages are not supported on the
+///     platform and @p mode is not #dnnl_huge_pages_none, and
+///     #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_huge_pages_mode(dnnl_huge_pages_mode_t mode);
+
+/// Gets the huge pages mode for the buffers allocated by the library on CPU.
+///
+/// @returns #dnnl_huge_pages_mode_t value reflecting the current mode.
+dnnl_huge_pages_mode_t DNNL_API dnnl_get_huge_pages_mode(void);
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -4264,6 +4510,88 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
 
+/// Performs a batch of single-precision matrix-matrix multiplications with
+/// shapes that can differ between groups of the batch.
+///
+/// The operation is defined as:
+///
+/// `C_i := alpha_g * op( A_i ) * op( B_i ) + beta_g * C_i`
+///
+/// where the matrix multiplication i belongs to the group g, and the groups
+/// are laid out one after another in the arrays of matrix pointers: the
+/// first @p group_size[0] pointers belong to the group 0, the next
+/// @p group_size[1] pointers belong to the group 1, and so on. The
+/// transposition flags, dimensions, leading dimensions, alpha and beta are
+/// given per group, with the same meaning as for dnnl_sgemm().
+///
+/// The whole batch is computed within a single parallel region: the threads
+/// take the matrix multiplications one by one, and each of them is computed
+/// by a single thread. When the batch has fewer matrix multiplications than
+/// threads, they are computed one after another using all the threads. No
+/// code is generated per shape.
+///
+/// @param transa An array of group_count transposition flags for the
+///     matrices A.
+/// @param transb An array of group_count transposition flags for the
+///     matrices B.
+/// @param M An array of group_count M dimensions.
+/// @param N An array of group_count N dimensions.
+/// @param K An array of group_count K dimensions.
+/// @param alpha An array of group_count alpha parameters.
+/// @param A An array of pointers to the A matrices data.
+/// @param lda An array of group_count leading dimensions for the matrices A.
+/// @param B An array of pointers to the B matrices data.
+/// @param ldb An array of group_count leading dimensions for the matrices B.
+/// @param beta An array of group_count beta parameters.
+/// @param C An array of pointers to the C matrices data.
+/// @param ldc An array of group_count leading dimensions for the matrices C.
+/// @param group_count The number of groups.
+/// @param group_size An array of group_count numbers of matrix
+///     multiplications in each group.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch(const char *transa, const char *transb,
+        const dnnl_dim_t *M, const dnnl_dim_t *N, const dnnl_dim_t *K,
+        const float *alpha, const float *const *A, const dnnl_dim_t *lda,
+        const float *const *B, const dnnl_dim_t *ldb, const float *beta,
+        float *const *C, const dnnl_dim_t *ldc, dnnl_dim_t group_count,
+        const dnnl_dim_t *group_size);
+
+/// Performs a batch of single-precision matrix-matrix multiplications of
+/// the same shape with the matrices placed at constant strides.
+///
+/// The operation is defined as:
+///
+/// `C_i := alpha * op( A + i * stride_a ) * op( B + i * stride_b )
+///         + beta * C_i`, where `C_i = C + i * stride_c`.
+///
+/// The batch is computed as for dnnl_sgemm_batch().
+///
+/// @param transa Transposition flag for the matrices A.
+/// @param transb Transposition flag for the matrices B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between two A matrices.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between two B matrices.
+/// @param beta The beta parameter.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between two C matrices.
+/// @param batch_size The number of matrix multiplications.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch_strided(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch_size);
+
 /// @} dnnl_api_blas
 
 /// @} dnnl_api
@@ -28,6 +28,8 @@
 /// @cond DO_NOT_DOCUMENT_THIS
 #include <algorithm>
 #include <cstdlib>
+#include <functional>
+#include <future>
 #include <iterator>
 #include <memory>
 #include <string>
@@ -88,6 +90,20 @@ struct handle_traits<dnnl_primitive_t> {
     }
 };
 
+template <>
+struct handle_traits<dnnl_prepared_exec_t> {
+    static dnnl_status_t destructor(dnnl_prepared_exec_t p) {
+        return dnnl_prepared_exec_destroy(p);
+    }
+};
+
+template <>
+struct handle_traits<dnnl_command_list_t> {
+    static dnnl_status_t destructor(dnnl_command_list_t p) {
+        return dnnl_command_list_destroy(p);
+    }
+};
+
 /// @endcond
 
 /// @} dnnl_api_utils
@@ -215,6 +231,18 @@ struct primitive : public handle<dnnl_primitive_t> {
     /// @param args Arguments map.
     void execute(const stream &astream,
             const std::unordered_map<int, memory> &args) const;
+
+    /// Executes the primitive on a batch of argument maps, as many calls to
+    /// execute() would. On CPU, the items of the batch may run concurrently
+    /// in a single parallel region, each on one thread, which suits
+    /// primitives too small to be split across the threads.
+    ///
+    /// @param astream Stream object. The stream must belong to the same engine
+    ///     as the primitive.
+    /// @param args Arguments maps, one per item. The items must not write to
+    ///     the same memory.
+    void execute_batch(const stream &astream,
+            const std::vector<std::unordered_map<int, memory>> &args) const;
 };
 
 /// Converts primitive kind enum value from C++ API to C API type.
@@ -320,6 +348,27 @@ inline dnnl_rounding_mode_t convert_to_c(rounding_mode mode) {
     return static_cast<dnnl_rounding_mode_t>(mode);
 }
 
+/// Dispatch goal, a hint for the implementation selection and blocking
+/// heuristics of a primitive.
+enum class dispatch_goal {
+    /// No preference (default).
+    any = dnnl_dispatch_goal_any,
+    /// Minimize the time of a single execution, for example for
+    /// small-batch latency-critical inference.
+    latency = dnnl_dispatch_goal_latency,
+    /// Maximize the work done per thread, for example when the primitive
+    /// runs concurrently with other work on the same cores.
+    throughput = dnnl_dispatch_goal_throughput,
+};
+
+/// Converts a dispatch goal enum value from C++ API to C API type.
+///
+/// @param goal C++ API dispatch goal enum value.
+/// @returns Corresponding C API dispatch goal enum value.
+inline dnnl_dispatch_goal_t convert_to_c(dispatch_goal goal) {
+    return static_cast<dnnl_dispatch_goal_t>(goal);
+}
+
 /// Quantization kind
 enum class quantization_mode {
     /// used for unspecified quantization kind
@@ -624,6 +673,9 @@ enum class rnn_flags : unsigned {
     undef = dnnl_rnn_flags_undef,
     /// Do not add weights gradient to existing diff_weights memory
     diff_weights_overwrite = dnnl_rnn_flags_diff_weights_overwrite,
+    /// Carry the hidden and cell states over the executions of the
+    /// primitive. Supported only for forward inference.
+    stateful = dnnl_rnn_flags_stateful,
 };
 
 /// Converts RNN cell flags enum value from C++ API to C API type.
@@ -751,6 +803,16 @@ enum class query {
     kernel = dnnl_query_kernel,
     /// Shuffle parameter group size
     group_size_s64 = dnnl_query_group_size_s64,
+    /// fingerprint of the weights layout
+    weights_fingerprint_s64 = dnnl_query_weights_fingerprint_s64,
+    /// number of implementations skipped before the dispatched one
+    skipped_impls_s32 = dnnl_query_skipped_impls_s32,
+    /// name of a skipped implementation
+    skipped_impl_info_str = dnnl_query_skipped_impl_info_str,
+    /// status returned by a skipped implementation
+    skipped_impl_status = dnnl_query_skipped_impl_status,
+    /// reason a skipped implementation reported
+    skipped_impl_reason_str = dnnl_query_skipped_impl_reason_str,
 
     /// source memory desc
     src_md = dnnl_query_src_md,
@@ -3720,6 +3782,24 @@ inline bool operator!=(memory::format_tag a, dnnl_format_tag_t b) {
     return !(a == b);
 }
 
+/// Constructs a read-only memory object over a user buffer, for example a
+/// part of a read-only file mapping. The library doesn't own the buffer.
+///
+/// @sa dnnl_memory_create_read_only
+///
+/// @param md Memory descriptor.
+/// @param aengine CPU engine.
+/// @param handle Pointer to the buffer aligned to 64 bytes.
+/// @returns The created memory object.
+inline memory make_read_only_memory(
+        const memory::desc &md, const engine &aengine, const void *handle) {
+    dnnl_memory_t result;
+    error::wrap_c_api(dnnl_memory_create_read_only(
+                              &result, md.get(), aengine.get(), handle),
+            "could not create a read-only memory object");
+    return memory(result);
+}
+
 /// @} dnnl_api_memory
 
 /// @addtogroup dnnl_api_primitives
@@ -4000,6 +4080,27 @@ struct post_ops : public handle<dnnl_post_ops_t> {
                 "could not append a binary post-op with ternary operators");
     }
 
+    /// Appends a per-channel scale and shift post-op, for example a batch
+    /// normalization in inference mode folded into the preceding operation.
+    ///
+    /// The computations will be:
+    ///
+    ///     dst[:] <- dst[:] * scale[:] + shift[:]
+    ///
+    /// The post-op is appended as a #dnnl::algorithm::binary_mul post-op
+    /// followed by a #dnnl::algorithm::binary_add post-op, both with
+    /// @p scale_shift_desc as the descriptor of the second operand. The scale
+    /// and the shift are passed at execution as the #DNNL_ARG_SRC_1
+    /// arguments of the first and of the second of them respectively.
+    ///
+    /// @param scale_shift_desc Memory descriptor of the scale and of the
+    ///     shift.
+    void append_scale_shift(const memory::desc &scale_shift_desc) {
+        error::wrap_c_api(dnnl_post_ops_append_scale_shift(
+                                  get(), scale_shift_desc.get()),
+                "could not append a scale and shift post-op");
+    }
+
     /// Returns the parameters of a binary post-op.
     ///
     /// @param index Index of the binary post-op.
@@ -4286,6 +4387,30 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set deterministic primitive attribute");
     }
 
+    /// Returns the dispatch hint.
+    ///
+    /// @param goal Output dispatch goal.
+    /// @param max_threads Output maximum number of threads, 0 if unbounded.
+    void get_dispatch_hint(dispatch_goal &goal, int &max_threads) const {
+        dnnl_dispatch_goal_t c_goal;
+        error::wrap_c_api(dnnl_primitive_attr_get_dispatch_hint(
+                                  get(), &c_goal, &max_threads),
+                "could not get dispatch hint primitive attribute");
+        goal = dispatch_goal(c_goal);
+    }
+
+    /// Sets the dispatch hint. It affects only the blocking and threading
+    /// heuristics of the implementations and never the results.
+    ///
+    /// @param goal Dispatch goal.
+    /// @param max_threads Maximum number of threads the primitive uses, or 0
+    ///     to use all the threads available at execution.
+    void set_dispatch_hint(dispatch_goal goal, int max_threads = 0) {
+        error::wrap_c_api(dnnl_primitive_attr_set_dispatch_hint(
+                                  get(), convert_to_c(goal), max_threads),
+                "could not set dispatch hint primitive attribute");
+    }
+
     /// Returns the rounding mode attribute value
     ///
     /// @param arg Argument for which rounding mode query applies.
@@ -5120,6 +5245,84 @@ struct primitive_desc_base : public handle<dnnl_primitive_desc_t> {
         return id;
     }
 
+    /// Returns the fingerprint of a weights memory descriptor of the
+    /// primitive descriptor.
+    ///
+    /// The fingerprint identifies the layout of the weights together with the
+    /// implementation, the library version, and the CPU ISA or the GPU device.
+    /// Weights reordered ahead of time to #weights_desc() can be used without
+    /// a reorder by a primitive descriptor with the same fingerprint.
+    ///
+    /// @param idx Index of the weights memory descriptor.
+    /// @returns The fingerprint of the weights layout.
+    memory::dim get_weights_fingerprint(int idx = 0) const {
+        dnnl_dim_t fingerprint;
+        error::wrap_c_api(
+                dnnl_primitive_desc_query(get(),
+                        dnnl::convert_to_c(query::weights_fingerprint_s64),
+                        idx, (void *)&fingerprint),
+                "could not get weights fingerprint from a primitive "
+                "descriptor");
+        return fingerprint;
+    }
+
+    /// An implementation skipped before the one of a primitive descriptor.
+    struct skipped_impl_t {
+        /// Implementation name.
+        std::string impl_info;
+        /// Status the implementation returned, usually
+        /// #dnnl_unimplemented.
+        dnnl_status_t status;
+        /// Dispatch message the implementation reported, in the format of
+        /// `ONEDNN_VERBOSE=dispatch`. Empty unless the
+        /// `ONEDNN_DISPATCH_REPORT` environment variable is set to 1.
+        std::string reason;
+    };
+
+    /// Returns the implementations that were tried and skipped before the
+    /// implementation of the primitive descriptor, in dispatch order.
+    ///
+    /// For the first implementation these are all the implementations with
+    /// a higher priority. After next_impl() these are the implementations
+    /// between the previous one and the current one.
+    ///
+    /// @returns The skipped implementations.
+    std::vector<skipped_impl_t> get_skipped_impls() const {
+        int n = 0;
+        error::wrap_c_api(
+                dnnl_primitive_desc_query(get(),
+                        dnnl::convert_to_c(query::skipped_impls_s32), 0, &n),
+                "could not get number of skipped implementations from a "
+                "primitive descriptor");
+        std::vector<skipped_impl_t> impls;
+        impls.reserve(n);
+        for (int i = 0; i < n; i++) {
+            const char *c_info = nullptr;
+            dnnl_status_t c_status = dnnl_success;
+            const char *c_reason = nullptr;
+            error::wrap_c_api(
+                    dnnl_primitive_desc_query(get(),
+                            dnnl::convert_to_c(query::skipped_impl_info_str), i,
+                            &c_info),
+                    "could not get skipped implementation name from a "
+                    "primitive descriptor");
+            error::wrap_c_api(
+                    dnnl_primitive_desc_query(get(),
+                            dnnl::convert_to_c(query::skipped_impl_status), i,
+                            &c_status),
+                    "could not get skipped implementation status from a "
+                    "primitive descriptor");
+            error::wrap_c_api(
+                    dnnl_primitive_desc_query(get(),
+                            dnnl::convert_to_c(query::skipped_impl_reason_str),
+                            i, &c_reason),
+                    "could not get skipped implementation reason from a "
+                    "primitive descriptor");
+            impls.push_back({c_info, c_status, c_reason});
+        }
+        return impls;
+    }
+
 protected:
     /// Returns a float value.
     /// @param what The value to query.
@@ -10828,6 +11031,61 @@ struct lstm_forward : public primitive {
                       &dst_iter_c_desc, rnn_flags::undef, 0.0f, 0.0f, attr,
                       allow_empty) {}
 
+        /// Constructs a primitive descriptor for an LSTM forward propagation
+        /// primitive with RNN flags.
+        ///
+        /// The arguments are the same as for the constructor above, with the
+        /// additional @p flags.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param direction RNN direction. See @ref dnnl::rnn_direction for
+        ///     more info.
+        /// @param src_layer_desc Memory descriptor for the input vector.
+        /// @param src_iter_desc Memory descriptor for the input recurrent
+        ///     hidden state vector.
+        /// @param src_iter_c_desc Memory descriptor for the input recurrent
+        ///     cell state vector.
+        /// @param weights_layer_desc Memory descriptor for the weights
+        ///     applied to the layer input.
+        /// @param weights_iter_desc Memory descriptor for the weights applied
+        ///     to the recurrent input.
+        /// @param bias_desc Bias memory descriptor.
+        /// @param dst_layer_desc Memory descriptor for the output vector.
+        /// @param dst_iter_desc Memory descriptor for the output recurrent
+        ///     hidden state vector.
+        /// @param dst_iter_c_desc Memory descriptor for the output recurrent
+        ///     cell state vector.
+        /// @param flags Unused for forward propagation except for
+        ///     #dnnl::rnn_flags::stateful.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                rnn_direction direction, const memory::desc &src_layer_desc,
+                const memory::desc &src_iter_desc,
+                const memory::desc &src_iter_c_desc,
+                const memory::desc &weights_layer_desc,
+                const memory::desc &weights_iter_desc,
+                const memory::desc &bias_desc,
+                const memory::desc &dst_layer_desc,
+                const memory::desc &dst_iter_desc,
+                const memory::desc &dst_iter_c_desc, rnn_flags flags,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : rnn_primitive_desc_base(aengine, algorithm::vanilla_lstm,
+                      aprop_kind, algorithm::undef, direction, src_layer_desc,
+                      src_iter_desc, &src_iter_c_desc, nullptr,
+                      weights_layer_desc, weights_iter_desc, nullptr, nullptr,
+                      bias_desc, dst_layer_desc, dst_iter_desc,
+                      &dst_iter_c_desc, flags, 0.0f, 0.0f, attr, allow_empty) {
+        }
+
         /// Constructs a primitive descriptor for an LSTM forward propagation
         /// primitive from a C API primitive descriptor that must have a
         /// matching kind.
@@ -11469,6 +11727,54 @@ struct gru_forward : public primitive {
                       dst_layer_desc, dst_iter_desc, nullptr, rnn_flags::undef,
                       0.0f, 0.0f, attr, allow_empty) {}
 
+        /// Constructs a primitive descriptor for a GRU forward propagation
+        /// primitive with RNN flags.
+        ///
+        /// The arguments are the same as for the constructor above, with the
+        /// additional @p flags.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param direction RNN direction. See @ref dnnl::rnn_direction for
+        ///     more info.
+        /// @param src_layer_desc Memory descriptor for the input vector.
+        /// @param src_iter_desc Memory descriptor for the input recurrent
+        ///     hidden state vector.
+        /// @param weights_layer_desc Memory descriptor for the weights
+        ///     applied to the layer input.
+        /// @param weights_iter_desc Memory descriptor for the weights applied
+        ///     to the recurrent input.
+        /// @param bias_desc Bias memory descriptor.
+        /// @param dst_layer_desc Memory descriptor for the output vector.
+        /// @param dst_iter_desc Memory descriptor for the output recurrent
+        ///     hidden state vector.
+        /// @param flags Unused for forward propagation except for
+        ///     #dnnl::rnn_flags::stateful.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                rnn_direction direction, const memory::desc &src_layer_desc,
+                const memory::desc &src_iter_desc,
+                const memory::desc &weights_layer_desc,
+                const memory::desc &weights_iter_desc,
+                const memory::desc &bias_desc,
+                const memory::desc &dst_layer_desc,
+                const memory::desc &dst_iter_desc, rnn_flags flags,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : rnn_primitive_desc_base(aengine, algorithm::vanilla_gru,
+                      aprop_kind, algorithm::undef, direction, src_layer_desc,
+                      src_iter_desc, nullptr, nullptr, weights_layer_desc,
+                      weights_iter_desc, nullptr, nullptr, bias_desc,
+                      dst_layer_desc, dst_iter_desc, nullptr, flags, 0.0f,
+                      0.0f, attr, allow_empty) {}
+
         /// Constructs a primitive descriptor for a GRU forward propagation
         /// primitive from a C API primitive descriptor that must have a
         /// matching kind.
@@ -14203,6 +14509,27 @@ inline cpu_isa_hints get_cpu_isa_hints() {
     return static_cast<cpu_isa_hints>(dnnl_get_cpu_isa_hints());
 }
 
+/// @copydoc dnnl_huge_pages_mode_t
+enum class huge_pages_mode {
+    /// @copydoc dnnl_huge_pages_none
+    none = dnnl_huge_pages_none,
+    /// @copydoc dnnl_huge_pages_transparent
+    transparent = dnnl_huge_pages_transparent,
+    /// @copydoc dnnl_huge_pages_hugetlb
+    hugetlb = dnnl_huge_pages_hugetlb,
+};
+
+/// @copydoc dnnl_set_huge_pages_mode()
+inline status set_huge_pages_mode(huge_pages_mode mode) {
+    return static_cast<status>(dnnl_set_huge_pages_mode(
+            static_cast<dnnl_huge_pages_mode_t>(mode)));
+}
+
+/// @copydoc dnnl_get_huge_pages_mode()
+inline huge_pages_mode get_huge_pages_mode() {
+    return static_cast<huge_pages_mode>(dnnl_get_huge_pages_mode());
+}
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -14215,6 +14542,15 @@ enum class profiling_data_kind {
     undef = dnnl_profiling_data_kind_undef,
     /// Data kind to query an execution time in nanoseconds.
     time = dnnl_profiling_data_kind_time,
+    /// Data kind to query an execution start timestamp of a monotonic clock
+    /// in nanoseconds. Supported on CPU engines only.
+    start_time = dnnl_profiling_data_kind_start_time,
+    /// Data kind to query an execution end timestamp of a monotonic clock
+    /// in nanoseconds. Supported on CPU engines only.
+    end_time = dnnl_profiling_data_kind_end_time,
+    /// Data kind to query an identifier of the thread that executed a
+    /// primitive. Supported on CPU engines only.
+    thread_id = dnnl_profiling_data_kind_thread_id,
 };
 
 /// Resets a profiler's state.
@@ -14284,8 +14620,253 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// Returns the total footprint in bytes that the primitives held in the
+/// primitive cache may have at the same time. The value 0 means that the
+/// footprint is not limited.
+inline size_t get_primitive_cache_capacity_in_bytes() {
+    size_t result = 0;
+    error::wrap_c_api(dnnl_get_primitive_cache_capacity_in_bytes(&result),
+            "could not get primitive cache capacity in bytes");
+    return result;
+}
+
+/// @copydoc dnnl_set_primitive_cache_capacity_in_bytes(size_t capacity)
+inline void set_primitive_cache_capacity_in_bytes(size_t capacity) {
+    error::wrap_c_api(dnnl_set_primitive_cache_capacity_in_bytes(capacity),
+            "could not set primitive cache capacity in bytes");
+}
+
+/// Returns the total footprint in bytes of the primitives held in the
+/// primitive cache.
+inline size_t get_primitive_cache_footprint() {
+    size_t result = 0;
+    error::wrap_c_api(dnnl_get_primitive_cache_footprint(&result),
+            "could not get primitive cache footprint");
+    return result;
+}
+
+/// Creates a primitive on a background thread.
+///
+/// The primitive is added to the primitive cache in the same way as a
+/// primitive created synchronously, so the function can also be used to warm
+/// the cache up while the application keeps running: once the future is
+/// ready, creating the same primitive is a cache hit.
+///
+/// @note
+///     The primitive is created in a thread with default threading settings.
+///     If the number of threads used by the primitive depends on settings
+///     local to the calling thread, the created primitive may differ from the
+///     one created synchronously by this thread.
+///
+/// @tparam primitive_type Primitive type, e.g. #dnnl::convolution_forward.
+/// @param pd Primitive descriptor of the primitive to create.
+/// @returns A future holding the primitive. Errors are reported by
+///     std::future::get() rethrowing a #dnnl::error exception.
+template <typename primitive_type>
+inline std::future<primitive_type> make_primitive_async(
+        const typename primitive_type::primitive_desc &pd) {
+    return std::async(
+            std::launch::async, [pd]() { return primitive_type(pd); });
+}
+
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_layout_selection Layout Selection
+///
+/// Selection of memory formats across a chain of primitives.
+///
+/// @sa @ref dev_guide_understanding_memory_formats in developer guide
+///
+/// @{
+
+/// Creates the primitive descriptor of a step of a chain for the given
+/// source and destination memory descriptors. The memory descriptors have
+/// the dimensions and data types of the tensors passed to
+/// select_chain_layouts() and either a concrete format or
+/// #dnnl::memory::format_tag::any. The function is expected to create the
+/// primitive descriptor with `allow_empty` set to true and to return an
+/// empty primitive descriptor for formats the step does not support.
+using chain_step = std::function<primitive_desc(
+        const memory::desc &src_md, const memory::desc &dst_md)>;
+
+/// Layouts selected for a chain of primitives.
+struct chain_layouts {
+    /// Primitive descriptors of the steps created with the selected layouts.
+    std::vector<primitive_desc> pds;
+    /// Number of reorders the chain needs: wherever the destination of a
+    /// step differs from the source of the next one, and wherever a tensor
+    /// with a fixed format differs from the memory descriptor of the step
+    /// producing or consuming it.
+    int n_reorders = 0;
+    /// Total size in bytes of the sources of the reorders.
+    size_t reorder_bytes = 0;
+};
+
+/// Selects the memory formats of a chain of primitives where the
+/// destination of each step is the source of the next one.
+///
+/// Unlike #dnnl::memory::format_tag::any, which lets each primitive choose
+/// its formats independently, the function weighs the formats preferred by
+/// the producer and by the consumer of every tensor and returns the
+/// assignment that minimizes the total size of the reorders, then their
+/// number. A step is not forced into a format if that makes it fall back to
+/// a reference implementation while it did not with its preferred formats.
+///
+/// @param tensors Memory descriptors of the `steps.size() + 1` tensors of
+///     the chain: the source of the chain, the tensors between the steps,
+///     and the destination of the chain. Tensors with a format other than
+///     #dnnl::memory::format_tag::any keep it.
+/// @param steps Functions creating the primitive descriptors of the steps.
+/// @returns The selected layouts.
+inline chain_layouts select_chain_layouts(
+        const std::vector<memory::desc> &tensors,
+        const std::vector<chain_step> &steps) {
+    if (steps.empty() || tensors.size() != steps.size() + 1)
+        DNNL_THROW_ERROR(dnnl_invalid_arguments,
+                "number of tensors must exceed number of steps by one");
+
+    const size_t n = steps.size();
+    auto is_any = [](const memory::desc &md) {
+        return md.get_format_kind() == memory::format_kind::any;
+    };
+    auto as_any = [](const memory::desc &md) {
+        return memory::desc(md.get_dims(), md.get_data_type(),
+                memory::format_tag::any);
+    };
+    auto is_ref = [](const primitive_desc &pd) {
+        return std::string(pd.impl_info_str()).find("ref")
+                != std::string::npos;
+    };
+
+    // The formats each step prefers when it is free to choose.
+    std::vector<primitive_desc> preferred;
+    for (size_t k = 0; k < n; k++) {
+        preferred.push_back(
+                steps[k](as_any(tensors[k]), as_any(tensors[k + 1])));
+        if (!preferred.back())
+            DNNL_THROW_ERROR(dnnl_unimplemented,
+                    "could not create a primitive descriptor for a chain "
+                    "step");
+    }
+
+    // Formats to try for each tensor: its own format if it is fixed,
+    // otherwise the ones preferred by its producer and its consumer.
+    std::vector<std::vector<memory::desc>> formats(n + 1);
+    for (size_t t = 0; t <= n; t++) {
+        auto add = [&](const memory::desc &md) {
+            if (std::find(formats[t].begin(), formats[t].end(), md)
+                    == formats[t].end())
+                formats[t].push_back(md);
+        };
+        if (!is_any(tensors[t])) {
+            add(tensors[t]);
+            continue;
+        }
+        if (t > 0) add(preferred[t - 1].dst_desc());
+        if (t < n) add(preferred[t].src_desc());
+    }
+
+    // Candidate primitive descriptors of each step: the preferred one and
+    // the ones forced into the formats of its neighbours, unless forcing
+    // makes the step fall back to a reference implementation.
+    std::vector<std::vector<primitive_desc>> cand(n);
+    for (size_t k = 0; k < n; k++) {
+        cand[k].push_back(preferred[k]);
+        std::vector<memory::desc> srcs = formats[k], dsts = formats[k + 1];
+        if (is_any(tensors[k])) srcs.push_back(as_any(tensors[k]));
+        if (is_any(tensors[k + 1])) dsts.push_back(as_any(tensors[k + 1]));
+        for (const auto &src : srcs)
+            for (const auto &dst : dsts) {
+                const primitive_desc pd = steps[k](src, dst);
+                if (!pd || (is_ref(pd) && !is_ref(preferred[k]))) continue;
+                bool is_new = true;
+                for (const auto &c : cand[k])
+                    is_new = is_new
+                            && (c.src_desc() != pd.src_desc()
+                                    || c.dst_desc() != pd.dst_desc());
+                if (is_new) cand[k].push_back(pd);
+            }
+    }
+
+    // Reorders are compared by total size, then by number.
+    struct cost_t {
+        size_t bytes = 0;
+        int count = 0;
+        bool operator<(const cost_t &other) const {
+            return bytes != other.bytes ? bytes < other.bytes
+                                        : count < other.count;
+        }
+        void add_reorder(const memory::desc &from, const memory::desc &to) {
+            if (from == to) return;
+            bytes += from.get_size();
+            count++;
+        }
+    };
+
+    // Reorders needed for tensor `t` between the destination of its
+    // producer `prev` and the source of its consumer `next`.
+    auto tensor_cost = [&](size_t t, const primitive_desc *prev,
+                               const primitive_desc *next) {
+        cost_t c;
+        const memory::desc &md = tensors[t];
+        if (prev && next && is_any(md)) {
+            c.add_reorder(prev->dst_desc(), next->src_desc());
+        } else if (!is_any(md)) {
+            if (prev) c.add_reorder(prev->dst_desc(), md);
+            if (next) c.add_reorder(md, next->src_desc());
+        }
+        return c;
+    };
+
+    // Dynamic programming over the chain: best[k][i] is the cost of the
+    // tensors up to the source of step `k` when it uses candidate `i`.
+    std::vector<std::vector<cost_t>> best(n);
+    std::vector<std::vector<size_t>> from(n);
+    for (size_t k = 0; k < n; k++) {
+        best[k].resize(cand[k].size());
+        from[k].resize(cand[k].size());
+        for (size_t j = 0; j < cand[k].size(); j++) {
+            if (k == 0) {
+                best[k][j] = tensor_cost(0, nullptr, &cand[k][j]);
+                continue;
+            }
+            for (size_t i = 0; i < cand[k - 1].size(); i++) {
+                cost_t c = tensor_cost(k, &cand[k - 1][i], &cand[k][j]);
+                c.bytes += best[k - 1][i].bytes;
+                c.count += best[k - 1][i].count;
+                if (i == 0 || c < best[k][j]) {
+                    best[k][j] = c;
+                    from[k][j] = i;
+                }
+            }
+        }
+    }
+
+    size_t j = 0;
+    cost_t total;
+    for (size_t i = 0; i < cand[n - 1].size(); i++) {
+        cost_t c = tensor_cost(n, &cand[n - 1][i], nullptr);
+        c.bytes += best[n - 1][i].bytes;
+        c.count += best[n - 1][i].count;
+        if (i == 0 || c < total) {
+            total = c;
+            j = i;
+        }
+    }
+
+    chain_layouts res;
+    res.n_reorders = total.count;
+    res.reorder_bytes = total.bytes;
+    res.pds.resize(n);
+    for (size_t k = n; k > 0; k--) {
+        res.pds[k - 1] = cand[k - 1][j];
+        j = from[k - 1][j];
+    }
+    return res;
+}
+
+/// @} dnnl_api_layout_selection
+
 /// @addtogroup dnnl_api_blas BLAS functions
 ///
 /// A subset of Basic Linear Algebra (BLAS) functions that perform
@@ -14319,8 +14900,130 @@ inline status gemm_s8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
             K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
 }
 
+/// @copydoc dnnl_sgemm_batch()
+inline status sgemm_batch(const char *transa, const char *transb,
+        const dnnl_dim_t *M, const dnnl_dim_t *N, const dnnl_dim_t *K,
+        const float *alpha, const float *const *A, const dnnl_dim_t *lda,
+        const float *const *B, const dnnl_dim_t *ldb, const float *beta,
+        float *const *C, const dnnl_dim_t *ldc, dnnl_dim_t group_count,
+        const dnnl_dim_t *group_size) {
+    return static_cast<status>(dnnl_sgemm_batch(transa, transb, M, N, K, alpha,
+            A, lda, B, ldb, beta, C, ldc, group_count, group_size));
+}
+
+/// @copydoc dnnl_sgemm_batch_strided()
+inline status sgemm_batch_strided(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_sgemm_batch_strided(transa, transb, M, N,
+            K, alpha, A, lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+            stride_c, batch_size));
+}
+
 /// @} dnnl_api_blas
 
+/// @addtogroup dnnl_api_primitives
+/// @{
+
+/// @addtogroup dnnl_api_primitives_common
+/// @{
+
+/// A primitive execution with the arguments bound in advance. Executing it
+/// avoids the per-call argument processing of primitive::execute(), which
+/// matters for small primitives executed many times.
+///
+/// The prepared execution keeps the primitive alive. The stream and the
+/// memory objects must outlive the prepared execution.
+struct prepared_exec : public handle<dnnl_prepared_exec_t> {
+    using handle::handle;
+
+    /// Default constructor. Produces an empty object.
+    prepared_exec() = default;
+
+    /// Constructs a prepared execution.
+    ///
+    /// @param aprimitive Primitive to execute.
+    /// @param astream Stream object. The stream must belong to the same engine
+    ///     as the primitive.
+    /// @param args Arguments. The position of an argument is its slot in
+    ///     execute().
+    prepared_exec(const primitive &aprimitive, const stream &astream,
+            const std::vector<std::pair<int, memory>> &args) {
+        std::vector<dnnl_exec_arg_t> c_args;
+        c_args.reserve(args.size());
+        for (const auto &a : args)
+            c_args.push_back({a.first, a.second.get(true)});
+
+        dnnl_prepared_exec_t result;
+        error::wrap_c_api(dnnl_prepared_exec_create(&result, aprimitive.get(),
+                                  astream.get(), (int)c_args.size(),
+                                  c_args.data()),
+                "could not create a prepared execution");
+        reset(result);
+    }
+
+    /// Executes the primitive.
+    ///
+    /// @param handles Data handles. A non-null handle at position `i`
+    ///     replaces the data handle of the memory object in the slot `i`
+    ///     before the execution.
+    void execute(const std::vector<void *> &handles = {}) const {
+        error::wrap_c_api(dnnl_prepared_exec_execute(get(),
+                                  (int)handles.size(), handles.data()),
+                "could not execute a prepared execution");
+    }
+};
+
+/// A sequence of primitive executions recorded once and replayed with a
+/// single call. On CPU, the stream threadpool is activated once per replay
+/// rather than once per primitive.
+///
+/// The stream and the memory objects must outlive the command list.
+struct command_list : public handle<dnnl_command_list_t> {
+    using handle::handle;
+
+    /// Default constructor. Produces an empty object.
+    command_list() = default;
+
+    /// Constructs an empty command list.
+    ///
+    /// @param astream Stream to execute the recorded primitives on.
+    command_list(const stream &astream) {
+        dnnl_command_list_t result;
+        error::wrap_c_api(dnnl_command_list_create(&result, astream.get()),
+                "could not create a command list");
+        reset(result);
+    }
+
+    /// Appends a primitive execution.
+    ///
+    /// @param aprimitive Primitive to execute.
+    /// @param args Arguments map.
+    void append(const primitive &aprimitive,
+            const std::unordered_map<int, memory> &args) {
+        std::vector<dnnl_exec_arg_t> c_args;
+        c_args.reserve(args.size());
+        for (const auto &a : args)
+            c_args.push_back({a.first, a.second.get(true)});
+
+        error::wrap_c_api(dnnl_command_list_append(get(), aprimitive.get(),
+                                  (int)c_args.size(), c_args.data()),
+                "could not append a primitive to a command list");
+    }
+
+    /// Executes the recorded primitives in the order they were appended.
+    void execute() const {
+        error::wrap_c_api(dnnl_command_list_execute(get()),
+                "could not execute a command list");
+    }
+};
+
+/// @} dnnl_api_primitives_common
+
+/// @} dnnl_api_primitives
+
 // implementation section
 
 /// @cond DO_NOT_DOCUMENT_THIS
@@ -14359,6 +15062,25 @@ inline void primitive::execute(const stream &astream,
             "could not execute a primitive");
 }
 
+inline void primitive::execute_batch(const stream &astream,
+        const std::vector<std::unordered_map<int, memory>> &args) const {
+    std::vector<std::vector<dnnl_exec_arg_t>> c_args(args.size());
+    std::vector<int> c_nargs(args.size());
+    std::vector<const dnnl_exec_arg_t *> c_args_ptrs(args.size());
+    for (size_t i = 0; i < args.size(); i++) {
+        c_args[i].reserve(args[i].size());
+        for (const auto &a : args[i])
+            c_args[i].push_back({a.first, a.second.get(true)});
+        c_nargs[i] = (int)c_args[i].size();
+        c_args_ptrs[i] = c_args[i].data();
+    }
+
+    error::wrap_c_api(dnnl_primitive_execute_batch(get(), astream.get(),
+                              (int)args.size(), c_nargs.data(),
+                              c_args_ptrs.data()),
+            "could not execute a primitive on a batch");
+}
+
 /// @endcond
 
 } // namespace dnnl
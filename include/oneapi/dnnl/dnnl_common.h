@@ -54,6 +54,26 @@ size_t DNNL_API dnnl_engine_get_count(dnnl_engine_kind_t kind);
 dnnl_status_t DNNL_API dnnl_engine_create(
         dnnl_engine_t *engine, dnnl_engine_kind_t kind, size_t index);
 
+/// Creates a CPU engine that allocates the buffers of the memory objects and
+/// of the library-managed scratchpads with user-provided functions.
+///
+/// The primitives created with such an engine use a scratchpad per primitive
+/// instead of the global scratchpad shared between the primitives of a
+/// thread, and are not shared with the primitives of other engines through
+/// the primitive cache. The allocation functions may be called concurrently
+/// and must stay valid, together with @p user_data, until all the objects
+/// created with the engine are destroyed.
+///
+/// @param engine Output engine.
+/// @param allocate Allocation function.
+/// @param deallocate Deallocation function.
+/// @param user_data User data passed to the allocation functions.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_cpu_engine_create_with_allocator(
+        dnnl_engine_t *engine, dnnl_cpu_allocate_f allocate,
+        dnnl_cpu_deallocate_f deallocate, void *user_data);
+
 /// Returns the kind of an engine.
 ///
 /// @param engine Engine to query.
@@ -101,6 +121,21 @@ dnnl_status_t DNNL_API dnnl_stream_get_engine(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_stream_wait(dnnl_stream_t stream);
 
+/// Makes the primitives submitted next to an out-of-order execution stream
+/// start after the ones submitted so far. Does nothing for an in-order
+/// stream.
+///
+/// @note
+///     An out-of-order CPU stream also orders on its own the primitives
+///     accessing the same memory when one of them writes it. The barrier
+///     orders the primitives which depend on each other through other
+///     means, e.g. memory objects sharing a buffer under different handles.
+///
+/// @param stream Execution stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_enqueue_barrier(dnnl_stream_t stream);
+
 /// Destroys an execution stream.
 ///
 /// @param stream Execution stream to destroy.
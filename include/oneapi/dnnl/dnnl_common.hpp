@@ -297,6 +297,24 @@ inline dnnl_engine_kind_t convert_to_c(engine::kind akind) {
     return static_cast<dnnl_engine_kind_t>(akind);
 }
 
+/// Constructs a CPU engine that allocates the buffers of the memory objects
+/// and of the library-managed scratchpads with user-provided functions.
+///
+/// @sa dnnl_cpu_engine_create_with_allocator
+///
+/// @param allocate Allocation function.
+/// @param deallocate Deallocation function.
+/// @param user_data User data passed to the allocation functions.
+/// @returns The created CPU engine.
+inline engine make_cpu_engine_with_allocator(dnnl_cpu_allocate_f allocate,
+        dnnl_cpu_deallocate_f deallocate, void *user_data = nullptr) {
+    dnnl_engine_t c_engine;
+    error::wrap_c_api(dnnl_cpu_engine_create_with_allocator(
+                              &c_engine, allocate, deallocate, user_data),
+            "could not create a CPU engine with an allocator");
+    return engine(c_engine);
+}
+
 /// @} dnnl_api_engine
 
 /// @addtogroup dnnl_api_stream Stream
@@ -367,6 +385,15 @@ struct stream : public handle<dnnl_stream_t> {
                 dnnl_stream_wait(get()), "could not wait on a stream");
         return *this;
     }
+
+    /// Makes the primitives submitted next to an out-of-order stream start
+    /// after the ones submitted so far. Does nothing for an in-order stream.
+    /// @returns The stream itself.
+    stream &enqueue_barrier() {
+        error::wrap_c_api(dnnl_stream_enqueue_barrier(get()),
+                "could not enqueue a barrier to a stream");
+        return *this;
+    }
 };
 
 //NOLINTBEGIN(bugprone-macro-parentheses)
@@ -197,6 +197,36 @@ typedef struct dnnl_engine *dnnl_engine_t;
 typedef const struct dnnl_engine *const_dnnl_engine_t;
 #endif
 
+/// @brief Kinds of the buffers a CPU engine allocates with a user allocator.
+typedef enum {
+    /// Temporary buffers used by primitives during their execution, such as
+    /// scratchpads.
+    dnnl_cpu_alloc_scratch = 0,
+    /// Buffers that live as long as their owner, such as the buffers of the
+    /// memory objects created without a user handle.
+    dnnl_cpu_alloc_persistent = 1,
+} dnnl_cpu_alloc_kind_t;
+
+/// @brief A function that allocates a buffer for a CPU engine. Returns NULL
+/// on failure.
+///
+/// @param size Size of the buffer in bytes.
+/// @param alignment Required alignment of the buffer in bytes.
+/// @param kind Kind of the buffer.
+/// @param user_data User data passed at the engine creation.
+typedef void *(*dnnl_cpu_allocate_f)(size_t size, size_t alignment,
+        dnnl_cpu_alloc_kind_t kind, void *user_data);
+
+/// @brief A function that deallocates a buffer of a CPU engine.
+///
+/// @param ptr Buffer returned by the allocation function.
+/// @param size Size of the buffer in bytes, as passed to the allocation
+///     function.
+/// @param kind Kind of the buffer, as passed to the allocation function.
+/// @param user_data User data passed at the engine creation.
+typedef void (*dnnl_cpu_deallocate_f)(void *ptr, size_t size,
+        dnnl_cpu_alloc_kind_t kind, void *user_data);
+
 /// @} dnnl_api_engine
 
 /// @addtogroup dnnl_api_stream Stream
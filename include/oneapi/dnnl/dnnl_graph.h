@@ -429,6 +429,48 @@ dnnl_status_t DNNL_API dnnl_graph_partition_compile(
         const dnnl_graph_logical_tensor_t **inputs, size_t out_num,
         const dnnl_graph_logical_tensor_t **outputs, dnnl_engine_t engine);
 
+/// Compiles a partition whose inputs have symbolic dimensions. The partition
+/// is compiled once per bucket of the symbolic dimension sizes, where the
+/// buckets are the powers of two between the smallest and the largest size of
+/// each symbol, plus the largest size. On execution, the input tensors have
+/// the actual sizes of the symbolic dimensions and the compiled partition
+/// runs the kernels of the smallest bucket that fits them. Inputs smaller than
+/// the bucket are copied into zero-padded buffers and outputs are computed
+/// into buffers of the bucket shape, from which the leading part is copied to
+/// the output tensors.
+///
+/// Padding is only correct if the elements of the outputs that are kept don't
+/// depend on the padded elements of the inputs, for example for the batch
+/// dimension or the rows of a matrix multiplication. It's the user
+/// responsibility to only declare such dimensions as symbolic. The dimensions
+/// of the internal logical tensors of the partition that depend on the
+/// symbols must be #DNNL_GRAPH_UNKNOWN_DIM so that they are inferred for
+/// each bucket.
+///
+/// The input logical tensors must have a strided layout and the output logical
+/// tensors a strided layout or unknown dimensions. The queried logical tensors
+/// of the compiled partition describe the largest bucket, and its scratchpad
+/// size fits all the buckets. Only CPU engines are supported.
+///
+/// @param partition The target partition.
+/// @param compiled_partition Output compiled partition.
+/// @param in_num The number of input logical tensors.
+/// @param inputs A list of input logical tensors. The sizes of the symbolic
+///     dimensions are ignored.
+/// @param out_num The number of output logical tensors.
+/// @param outputs A list of output logical tensors.
+/// @param num_symbolic_dims The number of symbolic dimensions.
+/// @param symbolic_dims A list of symbolic dimensions.
+/// @param engine The target engine of the compilation.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_partition_compile_with_symbolic_dims(
+        dnnl_graph_partition_t partition,
+        dnnl_graph_compiled_partition_t compiled_partition, size_t in_num,
+        const dnnl_graph_logical_tensor_t **inputs, size_t out_num,
+        const dnnl_graph_logical_tensor_t **outputs, size_t num_symbolic_dims,
+        const dnnl_graph_symbolic_dim_t *symbolic_dims, dnnl_engine_t engine);
+
 /// Returns the number of input logical tensors of a partition.
 ///
 /// @param partition The target partition.
@@ -605,6 +647,111 @@ dnnl_graph_compiled_partition_get_scratchpad_logical_tensor(
         const_dnnl_graph_compiled_partition_t compiled_partition,
         dnnl_graph_logical_tensor_t *lt);
 
+/// Plans the memory of a sequence of compiled partitions executed in order
+/// on the same stream, so that they can run against a single user-allocated
+/// arena.
+///
+/// An intermediate tensor is an output of a compiled partition that is an
+/// input of a later compiled partition of the sequence. The intermediate
+/// tensors and the scratchpads of all the compiled partitions are placed into
+/// the arena according to their lifetimes: buffers that are not used at the
+/// same time share memory. The inputs of the sequence and the outputs that are
+/// not consumed within the sequence are not planned.
+///
+/// The function should be called twice. The first call with @p tensor_ids,
+/// @p tensor_offsets, and @p scratchpad_offsets set to NULL returns the size
+/// of the arena and the number of intermediate tensors. The second call fills
+/// the IDs and the arena offsets of the intermediate tensors, and the arena
+/// offsets of the scratchpads of the compiled partitions.
+///
+/// @note
+///     The offsets are aligned to 64 bytes, so the arena should be allocated
+///     with at least this alignment. Scratchpads of size zero have offset 0.
+///
+/// @param num_compiled_partitions The number of compiled partitions.
+/// @param compiled_partitions The compiled partitions in execution order.
+/// @param arena_size Output size of the arena in bytes.
+/// @param num_tensors Output number of intermediate tensors.
+/// @param tensor_ids Output IDs of the intermediate tensors, an array of
+///     @p num_tensors elements.
+/// @param tensor_offsets Output arena offsets of the intermediate tensors in
+///     bytes, an array of @p num_tensors elements.
+/// @param scratchpad_offsets Output arena offsets of the scratchpads in bytes,
+///     an array of @p num_compiled_partitions elements.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_plan_memory(
+        size_t num_compiled_partitions,
+        const const_dnnl_graph_compiled_partition_t *compiled_partitions,
+        size_t *arena_size, size_t *num_tensors, size_t *tensor_ids,
+        size_t *tensor_offsets, size_t *scratchpad_offsets);
+
+/// Computes the constant intermediate tensors of a compiled partition, e.g.
+/// weights reordered to the layout of the kernels, and stores them in the
+/// constant tensor cache, so that the first execution with the same constant
+/// tensors is as fast as the following ones. The function returns once they
+/// are computed. It may be called from another thread than the one executing
+/// the compiled partition: an execution started meanwhile waits for the
+/// constant tensors instead of computing them again.
+///
+/// Nothing is computed when the constant tensor cache is disabled.
+///
+/// @param compiled_partition The compiled partition.
+/// @param stream The stream used to compute the constant tensors.
+/// @param num_inputs The number of input tensors.
+/// @param inputs The input tensors of the compiled partition with the
+///     #dnnl_graph_tensor_property_constant property. Other inputs may be
+///     omitted.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise. #dnnl_invalid_arguments is returned if a constant input is
+///     missing.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_prepare_constants(
+        const_dnnl_graph_compiled_partition_t compiled_partition,
+        dnnl_stream_t stream, size_t num_inputs,
+        const_dnnl_graph_tensor_t *inputs);
+
+/// Returns the size of the cache blob of a compiled partition.
+///
+/// @param compiled_partition The compiled partition.
+/// @param size Output size of the cache blob in bytes.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise. #dnnl_unimplemented is returned if the compiled partition
+///     has no cache blob, e.g. when it was compiled with opaque layouts.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_cache_blob_size(
+        const_dnnl_graph_compiled_partition_t compiled_partition,
+        size_t *size);
+
+/// Returns the cache blob of a compiled partition.
+///
+/// The cache blob holds the source partition and the logical tensors the
+/// partition was compiled with. It can be saved and used to create the
+/// compiled partition again, without building a graph and getting its
+/// partitions, by the same version of the library.
+///
+/// @param compiled_partition The compiled partition.
+/// @param size Size of the cache blob in bytes, as returned by
+///     dnnl_graph_compiled_partition_get_cache_blob_size().
+/// @param cache_blob Output cache blob, an array of @p size bytes.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_cache_blob(
+        const_dnnl_graph_compiled_partition_t compiled_partition, size_t size,
+        uint8_t *cache_blob);
+
+/// Creates a compiled partition from a cache blob.
+///
+/// @param compiled_partition Output compiled partition.
+/// @param engine The engine to compile the partition for. Its kind must be
+///     the one of the engine the cache blob was created with.
+/// @param size Size of the cache blob in bytes.
+/// @param cache_blob The cache blob.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise. #dnnl_invalid_arguments is returned if the cache blob was
+///     created by another version of the library.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_create_from_cache_blob(
+        dnnl_graph_compiled_partition_t *compiled_partition,
+        dnnl_engine_t engine, size_t size, const uint8_t *cache_blob);
+
 /// @} dnnl_graph_api_compiled_partition
 
 /// @addtogroup dnnl_graph_api_graph
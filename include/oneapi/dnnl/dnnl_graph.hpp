@@ -690,6 +690,22 @@ public:
         reset(compiled_partition, false);
     }
 
+    /// Constructs a compiled partition object from a cache blob returned by
+    /// #get_cache_blob(). The blob must have been created by the same version
+    /// of the library, for an engine of the same kind.
+    ///
+    /// @param aengine The engine to compile the partition for.
+    /// @param cache_blob The cache blob.
+    compiled_partition(
+            const engine &aengine, const std::vector<uint8_t> &cache_blob) {
+        dnnl_graph_compiled_partition_t cp = nullptr;
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_create_from_cache_blob(&cp,
+                        aengine.get(), cache_blob.size(), cache_blob.data()),
+                "could not create a compiled partition from a cache blob");
+        reset(cp, false);
+    }
+
     /// Queries an input or output logical tensor according to tensor ID. If the
     /// tensor ID doesn't belong to any input or output of the compiled
     /// partition, an exception will be raised by the API.
@@ -749,6 +765,46 @@ public:
         return logical_tensor {lt};
     }
 
+    /// Computes the constant intermediate tensors of the compiled partition,
+    /// e.g. reordered weights, and stores them in the constant tensor cache,
+    /// so that the first execution with the same constant tensors is as fast
+    /// as the following ones. It may run on a background thread while the
+    /// application goes on; an execution started meanwhile waits for the
+    /// constant tensors.
+    ///
+    /// @param astream Stream object to run over.
+    /// @param inputs The input tensors with the constant property. Other
+    ///     inputs may be omitted.
+    void prepare_constants(
+            stream &astream, const std::vector<tensor> &inputs) const {
+        std::vector<const_dnnl_graph_tensor_t> c_inputs;
+        c_inputs.reserve(inputs.size());
+        for (auto &in : inputs) {
+            c_inputs.push_back(in.get());
+        }
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_prepare_constants(get(),
+                        astream.get(), c_inputs.size(), c_inputs.data()),
+                "could not prepare the constants of a compiled partition");
+    }
+
+    /// Returns the cache blob of the compiled partition. It can be saved, e.g.
+    /// to disk, and used to create the compiled partition again without
+    /// building a graph and getting its partitions.
+    ///
+    /// @returns The cache blob.
+    std::vector<uint8_t> get_cache_blob() const {
+        size_t size = 0;
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_get_cache_blob_size(get(), &size),
+                "could not get the cache blob size of a compiled partition");
+        std::vector<uint8_t> cache_blob(size);
+        error::wrap_c_api(dnnl_graph_compiled_partition_get_cache_blob(
+                                  get(), size, cache_blob.data()),
+                "could not get the cache blob of a compiled partition");
+        return cache_blob;
+    }
+
     /// Execute a compiled partition.
     ///
     /// @note The user can provide a scratchpad tensor for execution. If not
@@ -785,6 +841,61 @@ public:
     }
 };
 
+/// Memory plan of a sequence of compiled partitions returned by
+/// #dnnl::graph::plan_memory().
+struct memory_plan {
+    /// Size of the arena in bytes.
+    size_t arena_size = 0;
+    /// Pairs of an intermediate tensor ID and its arena offset in bytes.
+    std::vector<std::pair<size_t, size_t>> tensor_offsets;
+    /// Arena offsets in bytes of the scratchpads of the compiled partitions.
+    std::vector<size_t> scratchpad_offsets;
+};
+
+/// Plans the memory of a sequence of compiled partitions executed in order
+/// on the same stream. The intermediate tensors, which are produced by a
+/// compiled partition and consumed by a later one, and the scratchpads of the
+/// compiled partitions are placed into a single arena, where buffers that are
+/// not used at the same time share memory. The inputs of the sequence and the
+/// outputs not consumed within the sequence are not planned.
+///
+/// The arena should be allocated with at least 64-byte alignment. The user
+/// then creates the intermediate tensors and the scratchpad tensors at the
+/// planned offsets of the arena and passes them to
+/// #dnnl::graph::compiled_partition::execute().
+///
+/// @param compiled_partitions The compiled partitions in execution order.
+/// @returns The memory plan.
+inline memory_plan plan_memory(
+        const std::vector<compiled_partition> &compiled_partitions) {
+    std::vector<const_dnnl_graph_compiled_partition_t> c_cps;
+    c_cps.reserve(compiled_partitions.size());
+    for (auto &cp : compiled_partitions) {
+        c_cps.push_back(cp.get());
+    }
+
+    memory_plan plan;
+    size_t num_tensors = 0;
+    error::wrap_c_api(dnnl_graph_compiled_partition_plan_memory(c_cps.size(),
+                              c_cps.data(), &plan.arena_size, &num_tensors,
+                              nullptr, nullptr, nullptr),
+            "could not plan the memory of compiled partitions");
+
+    std::vector<size_t> ids(num_tensors), offsets(num_tensors);
+    plan.scratchpad_offsets.resize(c_cps.size());
+    error::wrap_c_api(dnnl_graph_compiled_partition_plan_memory(c_cps.size(),
+                              c_cps.data(), &plan.arena_size, &num_tensors,
+                              ids.data(), offsets.data(),
+                              plan.scratchpad_offsets.data()),
+            "could not plan the memory of compiled partitions");
+
+    plan.tensor_offsets.reserve(num_tensors);
+    for (size_t i = 0; i < num_tensors; ++i) {
+        plan.tensor_offsets.emplace_back(ids[i], offsets[i]);
+    }
+    return plan;
+}
+
 /// @} dnnl_graph_api_compiled_partition
 
 /// @addtogroup dnnl_graph_api_op Op
@@ -891,6 +1002,7 @@ public:
         GenIndex = dnnl_graph_op_gen_index,
         GreaterEqual = dnnl_graph_op_greater_equal,
         Dropout = dnnl_graph_op_dropout,
+        RoPE = dnnl_graph_op_rope,
         // Sentinel
         LastSymbol = dnnl_graph_op_last_symbol,
     };
@@ -1220,6 +1332,22 @@ private:
 ///
 /// @{
 
+/// A symbolic dimension of a partition input, which is only known at
+/// execution. See #dnnl::graph::partition::compile_with_symbolic_dims().
+struct symbolic_dim {
+    /// The index of the input logical tensor given on compilation.
+    size_t input_index;
+    /// The axis of the dimension in the input logical tensor.
+    int32_t axis;
+    /// The symbol of the dimension. Dimensions with the same symbol must have
+    /// the same size on execution.
+    size_t symbol;
+    /// The smallest size of the dimension on execution.
+    logical_tensor::dim min_size;
+    /// The largest size of the dimension on execution.
+    logical_tensor::dim max_size;
+};
+
 /// A partition object.
 class partition : public partition_handle {
 public:
@@ -1312,6 +1440,66 @@ public:
         return compile_(inputs, outputs, e);
     }
 
+    /// Compiles a partition whose inputs have symbolic dimensions. The
+    /// partition is compiled once per bucket of the symbolic dimension sizes,
+    /// which are the powers of two between the smallest and the largest size
+    /// of each symbol, plus the largest size. On execution, the compiled
+    /// partition runs the kernels of the smallest bucket that fits the sizes
+    /// of the input tensors, padding the inputs with zeros and copying the
+    /// leading part of the outputs when needed.
+    ///
+    /// Padding is only correct if the elements of the outputs that are kept
+    /// don't depend on the padded elements of the inputs, for example for the
+    /// batch dimension. See #dnnl_graph_partition_compile_with_symbolic_dims()
+    /// for the details.
+    ///
+    /// @param inputs A list of input logical tensors.
+    /// @param outputs A list of output logical tensors.
+    /// @param symbolic_dims A list of symbolic dimensions of the inputs.
+    /// @param e The engine used to compile the partition.
+    /// @returns A compiled partition.
+    compiled_partition compile_with_symbolic_dims(
+            const std::vector<logical_tensor> &inputs,
+            const std::vector<logical_tensor> &outputs,
+            const std::vector<symbolic_dim> &symbolic_dims,
+            const engine &e) const {
+        if (!is_supported()) {
+            error::wrap_c_api(dnnl_invalid_arguments,
+                    "could not compile an unsupported partition");
+        }
+
+        std::vector<const dnnl_graph_logical_tensor_t *> c_inputs;
+        std::vector<const dnnl_graph_logical_tensor_t *> c_outputs;
+        c_inputs.reserve(inputs.size());
+        for (const auto &in : inputs) {
+            c_inputs.push_back(&(in.data));
+        }
+        c_outputs.reserve(outputs.size());
+        for (const auto &out : outputs) {
+            c_outputs.push_back(&(out.data));
+        }
+
+        std::vector<dnnl_graph_symbolic_dim_t> c_dims;
+        c_dims.reserve(symbolic_dims.size());
+        for (const auto &d : symbolic_dims) {
+            c_dims.push_back({d.input_index, d.axis, d.symbol, d.min_size,
+                    d.max_size});
+        }
+
+        dnnl_graph_compiled_partition_t cpartitions = nullptr;
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_create(&cpartitions, get()),
+                "could not create compiled_partition");
+        compiled_partition cp(cpartitions);
+        error::wrap_c_api(dnnl_graph_partition_compile_with_symbolic_dims(
+                                  get(), cpartitions, c_inputs.size(),
+                                  c_inputs.data(), c_outputs.size(),
+                                  c_outputs.data(), c_dims.size(),
+                                  c_dims.data(), e.get()),
+                "partition compile with symbolic dimensions failed");
+        return cp;
+    }
+
     /// Returns the supporting status of a partition. Some operations may not be
     /// supported by the library under certain circumstances. During
     /// partitioning stage, unsupported partitions will be returned to users
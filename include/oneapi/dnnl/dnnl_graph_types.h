@@ -278,6 +278,7 @@ typedef enum {
     dnnl_graph_op_greater_equal,
     dnnl_graph_op_rms_norm,
     dnnl_graph_op_dropout,
+    dnnl_graph_op_rope,
     dnnl_graph_op_last_symbol,
 } dnnl_graph_op_kind_t;
 
@@ -463,6 +464,28 @@ typedef struct {
     size_t output_id;
 } dnnl_graph_inplace_pair_t;
 
+/// Symbolic dimension definition. It describes a dimension of a partition input
+/// which is only known at execution, such as the sequence length in NLP
+/// models, for the compilation with
+/// #dnnl_graph_partition_compile_with_symbolic_dims().
+typedef struct {
+    /// The index of the input logical tensor given on compilation
+    size_t input_index;
+
+    /// The axis of the dimension in the input logical tensor
+    int32_t axis;
+
+    /// The symbol of the dimension. Dimensions with the same symbol must have
+    /// the same size on execution
+    size_t symbol;
+
+    /// The smallest size of the dimension on execution
+    dnnl_dim_t min_size;
+
+    /// The largest size of the dimension on execution
+    dnnl_dim_t max_size;
+} dnnl_graph_symbolic_dim_t;
+
 /// An opaque structure to describe a compiled partition.
 struct dnnl_graph_compiled_partition;
 
@@ -163,6 +163,48 @@ dnnl_status_t DNNL_API dnnl_sycl_interop_stream_create(
 dnnl_status_t DNNL_API dnnl_sycl_interop_stream_get_queue(
         dnnl_stream_t stream, void **queue);
 
+/// Starts recording the primitive executions submitted to a stream into a
+/// graph. Until dnnl_sycl_interop_stream_end_capture() is called, the
+/// executions are recorded instead of being run. The call blocks until the
+/// work already submitted to the stream completes.
+///
+/// The stream must be in-order. Primitives that synchronize with the host
+/// during execution cannot be recorded.
+///
+/// @note
+///     Only the NVIDIA GPU backend supports graph capture, where it maps to
+///     CUDA stream capture.
+///
+/// @param stream Execution stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise. #dnnl_unimplemented is returned when the stream does not
+///     support graph capture.
+dnnl_status_t DNNL_API dnnl_sycl_interop_stream_begin_capture(
+        dnnl_stream_t stream);
+
+/// Stops recording and makes the recorded graph ready for
+/// dnnl_sycl_interop_stream_replay(). The call blocks until the recording
+/// is finalized.
+///
+/// If a graph was already captured on the stream, and the new recording has
+/// the same structure, only the previous graph's memory pointers and
+/// parameters are updated in place, which is much cheaper than building a
+/// new graph. This lets the same sequence be re-recorded with different
+/// memory objects at low cost.
+///
+/// @param stream Execution stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_sycl_interop_stream_end_capture(
+        dnnl_stream_t stream);
+
+/// Submits the last graph captured on a stream for execution.
+///
+/// @param stream Execution stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_sycl_interop_stream_replay(dnnl_stream_t stream);
+
 /// Executes computations specified by the primitive in a specified stream and
 /// returns a SYCL event.
 ///
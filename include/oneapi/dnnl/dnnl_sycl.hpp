@@ -143,6 +143,32 @@ inline sycl::queue get_queue(const stream &astream) {
     return queue;
 }
 
+/// Starts recording primitive executions submitted to a stream into a graph.
+/// See dnnl_sycl_interop_stream_begin_capture() for details.
+///
+/// @param astream Execution stream.
+inline void begin_capture(stream &astream) {
+    error::wrap_c_api(dnnl_sycl_interop_stream_begin_capture(astream.get()),
+            "could not begin graph capture");
+}
+
+/// Stops recording and makes the captured graph ready for replay. See
+/// dnnl_sycl_interop_stream_end_capture() for details.
+///
+/// @param astream Execution stream.
+inline void end_capture(stream &astream) {
+    error::wrap_c_api(dnnl_sycl_interop_stream_end_capture(astream.get()),
+            "could not end graph capture");
+}
+
+/// Submits the last graph captured on a stream for execution.
+///
+/// @param astream Execution stream.
+inline void replay(stream &astream) {
+    error::wrap_c_api(dnnl_sycl_interop_stream_replay(astream.get()),
+            "could not replay a captured graph");
+}
+
 /// Returns the SYCL buffer associated with a memory object.
 ///
 /// Throws an exception if the memory allocation kind associated with the
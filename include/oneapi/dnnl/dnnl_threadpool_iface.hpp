@@ -64,6 +64,12 @@ struct threadpool_iface {
     /// waiting for the submitted closures to finish execution on its own.
     static constexpr uint64_t ASYNCHRONOUS = 1;
 
+    /// If set, the n closures submitted by a parallel_for() call with n not
+    /// greater than get_num_threads() run concurrently on n distinct
+    /// threads, so they may wait for each other. oneDNN then uses
+    /// implementations that synchronize the threads with barriers.
+    static constexpr uint64_t CONCURRENT_TEAM = 2;
+
     virtual ~threadpool_iface() = default;
 };
 
@@ -94,6 +94,15 @@ typedef enum {
     dnnl_profiling_data_kind_undef = 0,
     /// Data kind to query an execution time in nanoseconds.
     dnnl_profiling_data_kind_time,
+    /// Data kind to query an execution start timestamp of a monotonic clock
+    /// in nanoseconds. Supported on CPU engines only.
+    dnnl_profiling_data_kind_start_time,
+    /// Data kind to query an execution end timestamp of a monotonic clock
+    /// in nanoseconds. Supported on CPU engines only.
+    dnnl_profiling_data_kind_end_time,
+    /// Data kind to query an identifier of the thread that executed a
+    /// primitive. Supported on CPU engines only.
+    dnnl_profiling_data_kind_thread_id,
 
     // Max value to prevent UB for internal-use-only values.
     dnnl_profiling_data_max = 0x7fff,
@@ -2389,6 +2398,9 @@ typedef enum {
     dnnl_rnn_flags_undef = 0x0,
     /// Do not add weights gradient to existing diff_weights memory
     dnnl_rnn_flags_diff_weights_overwrite = 0x1,
+    /// Carry the hidden and cell states over the executions of the
+    /// primitive. Supported only for forward inference.
+    dnnl_rnn_flags_stateful = 0x2,
 } dnnl_rnn_flags_t;
 
 /// A direction of RNN primitive execution.
@@ -2466,6 +2478,19 @@ typedef enum {
     dnnl_rounding_mode_stochastic,
 } dnnl_rounding_mode_t;
 
+/// Dispatch goal, a hint for the implementation selection and blocking
+/// heuristics of a primitive.
+typedef enum {
+    /// No preference (default).
+    dnnl_dispatch_goal_any,
+    /// Minimize the time of a single execution, for example for
+    /// small-batch latency-critical inference.
+    dnnl_dispatch_goal_latency,
+    /// Maximize the work done per thread, for example when the primitive
+    /// runs concurrently with other work on the same cores.
+    dnnl_dispatch_goal_throughput,
+} dnnl_dispatch_goal_t;
+
 /// Quantization kind
 typedef enum {
     /// used for unspecified quantization kind
@@ -2538,6 +2563,20 @@ typedef struct dnnl_primitive *dnnl_primitive_t;
 /// A constant primitive handle.
 typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 
+/// @struct dnnl_prepared_exec
+/// An opaque structure to describe a primitive execution with the arguments
+/// bound in advance.
+struct dnnl_prepared_exec;
+/// A prepared execution handle.
+typedef struct dnnl_prepared_exec *dnnl_prepared_exec_t;
+
+/// @struct dnnl_command_list
+/// An opaque structure to describe a recorded sequence of primitive
+/// executions.
+struct dnnl_command_list;
+/// A command list handle.
+typedef struct dnnl_command_list *dnnl_command_list_t;
+
 /// Undefined argument.
 #define DNNL_ARG_UNDEF 0
 /// Source argument #0.
@@ -2834,6 +2873,7 @@ typedef struct {
 /// dnnl_query_inner_blks           | `const #dnnl_dims_t **`
 /// dnnl_query_inner_idxs           | `const #dnnl_dims_t **`
 /// dnnl_query_sparse_encoding      | `#dnnl_sparse_encoding_t *`
+/// dnnl_query_skipped_impl_status  | `#dnnl_status_t *`
 ///
 /// @note
 ///     Rule of thumb: all opaque types and structures are returned by
@@ -2892,6 +2932,11 @@ typedef enum {
     dnnl_query_activation_kind, ///< RNN parameter activation kind
     dnnl_query_kernel, ///< Pooling parameter kernel
     dnnl_query_group_size_s64, ///< Shuffle parameter group size
+    dnnl_query_weights_fingerprint_s64, ///< fingerprint of the weights layout
+    dnnl_query_skipped_impls_s32, ///< number of skipped implementations
+    dnnl_query_skipped_impl_info_str, ///< name of a skipped implementation
+    dnnl_query_skipped_impl_status, ///< status of a skipped implementation
+    dnnl_query_skipped_impl_reason_str, ///< why an implementation was skipped
 
     // memory descriptor section
     dnnl_query_some_md = 128, ///< stub
@@ -3030,6 +3075,17 @@ typedef enum {
     dnnl_cpu_isa_prefer_ymm = 0x1,
 } dnnl_cpu_isa_hints_t;
 
+/// Huge pages usage for the large buffers allocated by the library on CPU
+typedef enum {
+    /// Regular pages only (default)
+    dnnl_huge_pages_none = 0x0,
+    /// Transparent huge pages requested with madvise()
+    dnnl_huge_pages_transparent = 0x1,
+    /// Pages reserved in the huge pages pool (hugetlbfs), with a fallback to
+    /// transparent huge pages when the pool is exhausted
+    dnnl_huge_pages_hugetlb = 0x2,
+} dnnl_huge_pages_mode_t;
+
 /// @} dnnl_api_service
 
 /// @} dnnl_api
@@ -323,6 +323,21 @@ dnnl_status_t DNNL_API dnnl_transform_generate(dnnl_transform_t transform);
 dnnl_status_t DNNL_API dnnl_transform_execute(
         const_dnnl_transform_t transform, const void *in_ptr, void *out_ptr);
 
+/// Executes a transform object using the library threads.
+///
+/// The output is the same as the one of `dnnl_transform_execute`, but the
+/// blocks of the packed buffer are distributed between the threads. The
+/// function must not be called from a parallel region of the library
+/// threading runtime to be effective.
+///
+/// @param transform Transform object.
+/// @param in_ptr Pointer to an input buffer.
+/// @param out_ptr Pointer to an output buffer.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_transform_execute_parallel(
+        const_dnnl_transform_t transform, const void *in_ptr, void *out_ptr);
+
 /// Destroys a transform object.
 ///
 /// @param transform Transform object.
@@ -455,6 +455,17 @@ struct transform : public handle<dnnl_transform_t> {
             error::wrap_c_api(status,
                     "could not execute a BRGeMM ukernel packing B object");
     }
+
+    /// Executes a transform object using the library threads.
+    ///
+    /// @param in Pointer to an input buffer.
+    /// @param out Pointer to an output buffer.
+    void execute_parallel(const void *in, void *out) const {
+        dnnl_status_t status = dnnl_transform_execute_parallel(get(), in, out);
+        if (status != dnnl_success)
+            error::wrap_c_api(status,
+                    "could not execute a BRGeMM ukernel packing B object");
+    }
 };
 
 /// @} dnnl_api_ukernel_transform
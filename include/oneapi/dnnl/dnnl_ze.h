@@ -205,6 +205,41 @@ dnnl_status_t DNNL_API dnnl_ze_interop_primitive_execute(
         const dnnl_exec_arg_t *args, int ndeps, const ze_event_handle_t *deps,
         ze_event_handle_t *return_event);
 
+/// Executes a matmul primitive in a specified stream, splitting the N
+/// dimension of the destination into chunks and signaling a Level Zero event
+/// as soon as each chunk has been computed.
+///
+/// The chunk events let a collective operation, such as an all-reduce, start
+/// on finished parts of the destination while the rest is being computed.
+/// The events are signaled on the device in chunk order. Implementations
+/// that cannot compute the destination chunk by chunk signal all the events
+/// once the whole destination is computed.
+///
+/// @param primitive Matmul primitive to execute.
+/// @param stream Stream to use.
+/// @param nargs Number of arguments.
+/// @param args Array of arguments, see dnnl_ze_interop_primitive_execute().
+/// @param ndeps Number of dependencies.
+/// @param deps A pointer to a vector of size @p ndeps that contains
+///     dependencies.
+/// @param chunk_size Number of destination columns in a chunk. Must be
+///     positive.
+/// @param nchunks Number of chunk events. Must be equal to the N dimension
+///     of the destination divided by @p chunk_size and rounded up.
+/// @param chunk_events A pointer to a vector of size @p nchunks that contains
+///     the events to signal. The event at index `i` is signaled once the
+///     destination columns `[i * chunk_size, (i + 1) * chunk_size)` have been
+///     computed.
+/// @param return_event Output event.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ze_interop_matmul_execute_chunked(
+        const_dnnl_primitive_t primitive, dnnl_stream_t stream, int nargs,
+        const dnnl_exec_arg_t *args, int ndeps, const ze_event_handle_t *deps,
+        dnnl_dim_t chunk_size, int nchunks,
+        const ze_event_handle_t *chunk_events,
+        ze_event_handle_t *return_event);
+
 /// @} dnnl_api_ze_interop
 
 /// @} dnnl_api_interop
@@ -295,6 +295,47 @@ inline ze_event_handle_t execute(const dnnl::primitive &aprimitive,
     return return_event;
 }
 
+/// Executes a matmul primitive in a specified stream, splitting the N
+/// dimension of the destination into chunks and signaling a Level Zero event
+/// as soon as each chunk has been computed.
+///
+/// The event at index `i` of @p chunk_events is signaled once the destination
+/// columns `[i * chunk_size, (i + 1) * chunk_size)` have been computed.
+/// Implementations that cannot compute the destination chunk by chunk signal
+/// all the events once the whole destination is computed.
+///
+/// @param aprimitive Matmul primitive to execute.
+/// @param astream Stream object. The stream must belong to the same engine
+///     as the primitive.
+/// @param args Arguments map.
+/// @param chunk_size Number of destination columns in a chunk.
+/// @param chunk_events Events to signal, one per chunk.
+/// @param deps Optional vector with `ze_event_handle_t` dependencies.
+///
+/// @returns Output event.
+inline ze_event_handle_t execute_chunked(const dnnl::primitive &aprimitive,
+        const stream &astream, const std::unordered_map<int, memory> &args,
+        memory::dim chunk_size,
+        const std::vector<ze_event_handle_t> &chunk_events,
+        const std::vector<ze_event_handle_t> &deps = {}) {
+    std::vector<dnnl_exec_arg_t> c_args;
+    c_args.reserve(args.size());
+    for (const auto &a : args)
+        c_args.push_back({a.first, a.second.get()});
+
+    const ze_event_handle_t *c_deps = deps.empty() ? nullptr : deps.data();
+
+    ze_event_handle_t return_event;
+    error::wrap_c_api(dnnl_ze_interop_matmul_execute_chunked(aprimitive.get(),
+                              astream.get(), static_cast<int>(c_args.size()),
+                              c_args.data(), static_cast<int>(deps.size()),
+                              c_deps, chunk_size,
+                              static_cast<int>(chunk_events.size()),
+                              chunk_events.data(), &return_event),
+            "could not execute a matmul primitive in chunks");
+    return return_event;
+}
+
 } // namespace ze_interop
 
 /// @} dnnl_api_ze_interop
@@ -214,6 +214,13 @@ const rounding_mode_t environment = dnnl_rounding_mode_environment;
 const rounding_mode_t stochastic = dnnl_rounding_mode_stochastic;
 } // namespace rounding_mode
 
+using dispatch_goal_t = dnnl_dispatch_goal_t;
+namespace dispatch_goal {
+const dispatch_goal_t any = dnnl_dispatch_goal_any;
+const dispatch_goal_t latency = dnnl_dispatch_goal_latency;
+const dispatch_goal_t throughput = dnnl_dispatch_goal_throughput;
+} // namespace dispatch_goal
+
 using quantization_mode_t = dnnl_quantization_mode_t;
 namespace quantization_mode {
 const quantization_mode_t undef = dnnl_quantization_mode_undef;
@@ -254,11 +261,17 @@ using profiling_data_kind_t = dnnl_profiling_data_kind_t;
 namespace profiling_data_kind {
 const profiling_data_kind_t undef = dnnl_profiling_data_kind_undef;
 const profiling_data_kind_t time = dnnl_profiling_data_kind_time;
+const profiling_data_kind_t start_time = dnnl_profiling_data_kind_start_time;
+const profiling_data_kind_t end_time = dnnl_profiling_data_kind_end_time;
+const profiling_data_kind_t thread_id = dnnl_profiling_data_kind_thread_id;
 #else
 using profiling_data_kind_t = int;
 namespace profiling_data_kind {
 const profiling_data_kind_t undef = 0;
 const profiling_data_kind_t time = 1;
+const profiling_data_kind_t start_time = 2;
+const profiling_data_kind_t end_time = 3;
+const profiling_data_kind_t thread_id = 4;
 #endif
 // Internal only data kinds.
 const profiling_data_kind_t internal_only_start
@@ -1977,6 +1990,7 @@ namespace rnn_flags {
 const rnn_flags_t undef = dnnl_rnn_flags_undef;
 const rnn_flags_t diff_weights_overwrite
         = dnnl_rnn_flags_diff_weights_overwrite;
+const rnn_flags_t stateful = dnnl_rnn_flags_stateful;
 } // namespace rnn_flags
 
 using engine_kind_t = dnnl_engine_kind_t;
@@ -2038,6 +2052,10 @@ const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
 const primitive_kind_t zero_pad = internal_only_start;
 const primitive_kind_t sdpa = (primitive_kind_t)(internal_only_start + 1);
 const primitive_kind_t gated_mlp = (primitive_kind_t)(internal_only_start + 2);
+const primitive_kind_t embedding_bag
+        = (primitive_kind_t)(internal_only_start + 3);
+const primitive_kind_t topk = (primitive_kind_t)(internal_only_start + 4);
+const primitive_kind_t optimizer = (primitive_kind_t)(internal_only_start + 5);
 } // namespace primitive_kind
 
 using query_t = dnnl_query_t;
@@ -2084,6 +2102,11 @@ const query_t direction = dnnl_query_direction;
 const query_t activation_kind = dnnl_query_activation_kind;
 const query_t kernel = dnnl_query_kernel;
 const query_t group_size_s64 = dnnl_query_group_size_s64;
+const query_t weights_fingerprint_s64 = dnnl_query_weights_fingerprint_s64;
+const query_t skipped_impls_s32 = dnnl_query_skipped_impls_s32;
+const query_t skipped_impl_info_str = dnnl_query_skipped_impl_info_str;
+const query_t skipped_impl_status = dnnl_query_skipped_impl_status;
+const query_t skipped_impl_reason_str = dnnl_query_skipped_impl_reason_str;
 
 const query_t some_md = dnnl_query_some_md;
 const query_t src_md = dnnl_query_src_md;
@@ -2148,6 +2171,7 @@ const stream_flags_t profiling = static_cast<stream_flags_t>(1 << 2);
 using stream_t = dnnl_stream;
 
 struct memory_storage_t;
+struct scratchpad_pool_t;
 
 /* forward declaration of the internal primitive_desc types */
 struct batch_normalization_bwd_pd_t;
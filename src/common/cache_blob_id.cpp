@@ -32,7 +32,7 @@ const std::vector<uint8_t> &cache_blob_id_t::get(
     auto engine_kind = engine->kind();
     auto runtime_kind = engine->runtime_kind();
 
-    if (!engine->is_cache_blob_supported()) { return sstream_.get_data(); }
+    if (!engine->is_cache_blob_id_supported()) { return sstream_.get_data(); }
 
     if (pd->kind() == primitive_kind::zero_pad) { return sstream_.get_data(); }
 
@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2023 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -18,6 +19,8 @@
 #define COMMON_CACHE_UTILS_HPP
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <future>
 #include <memory>
 #include <thread>
@@ -47,6 +50,11 @@ namespace utils {
 template <typename K, typename O>
 using key_merge_t = void (*)(const K &, const O &);
 
+// Returns the memory footprint of object o in bytes. It is used to limit the
+// total size of the cached objects.
+template <typename O>
+using footprint_t = size_t (*)(const O &);
+
 template <typename K, typename O, typename C,
         key_merge_t<K, O> key_merge = nullptr>
 struct cache_t {
@@ -121,29 +129,42 @@ protected:
     }
 };
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy. Besides the number of entries, the
+// cache size may be limited by the total footprint of the cached objects if
+// the footprint function is provided.
+//
+// The entries are partitioned by the key hash into shards with a lock each,
+// so that the lookups of different keys don't contend on a single lock. A
+// lookup only takes the read lock of its shard and records the access with
+// an atomic timestamp. The operations that add or remove entries are
+// serialized by the cache lock, which is taken before the shard locks. The key
+// hash is computed once per operation and used for both the shard and the
+// bucket in the shard.
 template <typename K, typename O, typename C,
-        key_merge_t<K, O> key_merge = nullptr>
+        key_merge_t<K, O> key_merge = nullptr,
+        footprint_t<O> footprint = nullptr>
 struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     using lru_base_t = cache_t<K, O, C, key_merge>;
     using key_t = typename lru_base_t::key_t;
     using object_t = typename lru_base_t::object_t;
     using cache_object_t = typename lru_base_t::cache_object_t;
     using value_t = typename lru_base_t::value_t;
-    lru_cache_t(int capacity) : capacity_(capacity) {}
+    lru_cache_t(int capacity) : capacity_(capacity), size_(0) {}
 
     ~lru_cache_t() override {
-        if (cache_mapper().empty()) return;
+        if (get_size_no_lock() == 0) return;
 
         if (!is_destroying_cache_safe()) {
             // It is safe to remove those entries that are not affected by the
             // unloading order issue e.g. native CPU.
-            for (auto it = cache_mapper().begin();
-                    it != cache_mapper().end();) {
-                if (!it->first.has_runtime_dependencies()) {
-                    it = cache_mapper().erase(it);
-                } else {
-                    ++it;
+            for (auto &shard : shards_) {
+                auto &mapper = shard.mapper_;
+                for (auto it = mapper.begin(); it != mapper.end();) {
+                    if (!it->first.key().has_runtime_dependencies()) {
+                        it = mapper.erase(it);
+                    } else {
+                        ++it;
+                    }
                 }
             }
             release_cache();
@@ -152,73 +173,79 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     }
 
     cache_object_t get(const key_t &key) override {
-        value_t e;
-        {
-            utils::lock_read_t lock_r(this->rw_mutex());
-            if (capacity_ == 0) { return cache_object_t(); }
-            e = get_future(key);
-        }
+        if (capacity_.load(std::memory_order_relaxed) == 0)
+            return cache_object_t();
 
+        value_t e = get_future(hashed_key_t(key));
         if (e.valid()) return e.get();
         return cache_object_t();
     }
 
-    int get_capacity() const override {
-        utils::lock_read_t lock_r(this->rw_mutex());
-        return capacity_;
-    }
+    int get_capacity() const override { return capacity_.load(); }
 
     status_t set_capacity(int capacity) override {
         utils::lock_write_t lock_w(this->rw_mutex());
-        capacity_ = capacity;
+        capacity_.store(capacity);
         // Check if number of entries exceeds the new capacity
-        if (get_size_no_lock() > capacity_) {
+        if (get_size_no_lock() > capacity) {
             // Evict excess entries
-            int n_excess_entries = get_size_no_lock() - capacity_;
+            int n_excess_entries = get_size_no_lock() - capacity;
             evict(n_excess_entries);
         }
         return status::success;
     }
     void set_capacity_without_clearing(int capacity) {
         utils::lock_write_t lock_w(this->rw_mutex());
-        capacity_ = capacity;
+        capacity_.store(capacity);
     }
 
-    int get_size() const override {
+    int get_size() const override { return get_size_no_lock(); }
+
+    // A capacity of 0 bytes means the footprint is not limited.
+    size_t get_capacity_in_bytes() const {
         utils::lock_read_t lock_r(this->rw_mutex());
-        return get_size_no_lock();
+        return capacity_in_bytes_;
+    }
+
+    status_t set_capacity_in_bytes(size_t capacity_in_bytes) {
+        utils::lock_write_t lock_w(this->rw_mutex());
+        capacity_in_bytes_ = capacity_in_bytes;
+        evict_excess_bytes();
+        return status::success;
+    }
+
+    size_t get_size_in_bytes() const {
+        utils::lock_read_t lock_r(this->rw_mutex());
+        return size_in_bytes_;
     }
 
 protected:
-    int get_size_no_lock() const { return (int)cache_mapper().size(); }
+    int get_size_no_lock() const { return size_.load(); }
 
     value_t get_or_add(const key_t &key, const value_t &value) override {
-        {
-            // 1. Section with shared access (read lock)
-            utils::lock_read_t lock_r(this->rw_mutex());
-            // Check if the cache is enabled.
-            if (capacity_ == 0) { return value_t(); }
-            // Check if the requested entry is present in the cache (likely
-            // cache_hit)
-            auto e = get_future(key);
-            if (e.valid()) { return e; }
-        }
+        // 1. Shared access to the shard of the key only. Check if the cache
+        // is enabled and if the requested entry is present in the cache
+        // (likely cache_hit).
+        if (capacity_.load(std::memory_order_relaxed) == 0) return value_t();
+        const hashed_key_t hkey(key);
+        auto e = get_future(hkey);
+        if (e.valid()) { return e; }
 
         utils::lock_write_t lock_w(this->rw_mutex());
-        // 2. Section with exclusive access (write lock).
+        // 2. Section with exclusive access to the cache structure.
         // In a multithreaded scenario, in the context of one thread the cache
-        // may have changed by another thread between releasing the read lock
-        // and acquiring the write lock (a.k.a. ABA problem), therefore
-        // additional checks have to be performed for correctness. Double check
-        // the capacity due to possible race condition
-        if (capacity_ == 0) { return value_t(); }
+        // may have changed by another thread between the lookup and acquiring
+        // the write lock (a.k.a. ABA problem), therefore additional checks
+        // have to be performed for correctness. Double check the capacity due
+        // to possible race condition
+        if (capacity_.load() == 0) { return value_t(); }
 
         // Double check if the requested entry is present in the cache (unlikely
         // cache_hit).
-        auto e = get_future(key);
+        e = get_future(hkey);
         if (!e.valid()) {
             // If the entry is missing in the cache then add it (cache_miss)
-            add(key, value);
+            add(hkey, value);
         }
         return e;
     }
@@ -226,21 +253,54 @@ protected:
     void remove_if_invalidated(const key_t &key) override {
         utils::lock_write_t lock_w(this->rw_mutex());
 
-        if (capacity_ == 0) { return; }
+        if (capacity_.load() == 0) { return; }
 
-        auto it = cache_mapper().find(key);
+        const hashed_key_t hkey(key);
+        auto &shard = get_shard(hkey);
+        utils::lock_write_t lock_shard(shard.mutex_);
+        auto it = shard.mapper_.find(hkey);
         // The entry has been already evicted at this point
-        if (it == cache_mapper().end()) { return; }
+        if (it == shard.mapper_.end()) { return; }
 
         const auto &value = it->second.value_;
         // If the entry is not invalidated
         if (!value.get().is_empty()) { return; }
 
         // Remove the invalidated entry
-        cache_mapper().erase(it);
+        size_in_bytes_ -= it->second.footprint_;
+        shard.mapper_.erase(it);
+        size_--;
     }
 
 private:
+    // A key with its hash. It refers to the key of the caller, while its
+    // copies own a copy of the key, which is how the entries store the keys.
+    struct hashed_key_t {
+        explicit hashed_key_t(const key_t &key)
+            : key_(&key), hash_(std::hash<key_t>()(key)) {}
+        hashed_key_t(const hashed_key_t &other)
+            : owned_key_(utils::make_unique<key_t>(other.key()))
+            , key_(owned_key_.get())
+            , hash_(other.hash_) {}
+        hashed_key_t &operator=(const hashed_key_t &) = delete;
+
+        const key_t &key() const { return *key_; }
+        size_t hash() const { return hash_; }
+
+        bool operator==(const hashed_key_t &other) const {
+            return hash_ == other.hash_ && *key_ == *other.key_;
+        }
+
+    private:
+        std::unique_ptr<key_t> owned_key_;
+        const key_t *key_;
+        size_t hash_;
+    };
+
+    struct hashed_key_hash_t {
+        size_t operator()(const hashed_key_t &key) const { return key.hash(); }
+    };
+
     static size_t get_timestamp() {
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
         return cpu::platform::get_timestamp();
@@ -253,114 +313,190 @@ private:
         // Cast to void as compilers may warn about comparing compile time
         // constant function pointers with nullptr, as that is often not an
         // intended behavior
-        if ((void *)key_merge == nullptr) return;
+        if ((void *)key_merge == nullptr && (void *)footprint == nullptr)
+            return;
 
         utils::lock_write_t lock_w(this->rw_mutex());
 
-        if (capacity_ == 0) { return; }
+        if (capacity_.load() == 0) { return; }
 
-        // There is nothing to do in two cases:
-        // 1. The requested entry is not in the cache because it has been evicted
-        //    by another thread
-        // 2. After the requested entry had been evicted it was inserted again
-        //    by another thread
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()
-                || it->first.thread_id() != key.thread_id()) {
-            return;
+        {
+            const hashed_key_t hkey(key);
+            auto &shard = get_shard(hkey);
+            utils::lock_write_t lock_shard(shard.mutex_);
+
+            // There is nothing to do in two cases:
+            // 1. The requested entry is not in the cache because it has been
+            //    evicted by another thread
+            // 2. After the requested entry had been evicted it was inserted
+            //    again by another thread
+            auto it = shard.mapper_.find(hkey);
+            if (it == shard.mapper_.end()
+                    || it->first.key().thread_id() != key.thread_id()) {
+                return;
+            }
+
+            if ((void *)key_merge != nullptr) key_merge(it->first.key(), p);
+
+            if ((void *)footprint == nullptr) return;
+
+            size_in_bytes_ -= it->second.footprint_;
+            it->second.footprint_ = footprint(p);
+            size_in_bytes_ += it->second.footprint_;
+            // The entry has just been created, so it is the most recently
+            // used one and is the last to be evicted.
+            it->second.timestamp_.store(get_timestamp());
         }
+        evict_excess_bytes();
+    }
 
-        key_merge(it->first, p);
+    // Evicts the least recently used entries until the footprint fits the
+    // capacity in bytes. The last entry is kept even if it alone exceeds the
+    // capacity.
+    void evict_excess_bytes() {
+        if (capacity_in_bytes_ == 0) return;
+        while (size_in_bytes_ > capacity_in_bytes_ && get_size_no_lock() > 1)
+            evict(1);
     }
 
+    // Must be called with the cache write lock held.
     void evict(int n) {
-        using v_t =
-                typename std::unordered_map<key_t, timed_entry_t>::value_type;
+        using v_t = typename mapper_t::value_type;
 
-        if (n == capacity_) {
-            cache_mapper().clear();
+        if (n == get_size_no_lock()) {
+            for (auto &shard : shards_) {
+                utils::lock_write_t lock_shard(shard.mutex_);
+                shard.mapper_.clear();
+            }
+            size_ = 0;
+            size_in_bytes_ = 0;
             return;
         }
 
         for (int e = 0; e < n; e++) {
-            // Find the smallest timestamp
+            // Find the smallest timestamp across the shards. The entries
+            // can't be added or removed by the other threads while the cache
+            // lock is held, so only the timestamps may change meanwhile and
+            // the oldest entry found is approximately the least recently used.
             // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
             // maybe evict multiple entries at once.
-            auto it = std::min_element(cache_mapper().begin(),
-                    cache_mapper().end(),
-                    [&](const v_t &left, const v_t &right) {
-                // By default, load() and operator T use sequentially
-                // consistent memory ordering, which enforces writing
-                // the timestamps into registers in the same exact order
-                // they are read from the CPU cache line. Since eviction
-                // is performed under a write lock, this order is not
-                // important, therefore we can safely use the weakest
-                // memory ordering (relaxed). This brings about a few
-                // microseconds performance improvement for default
-                // cache capacity.
-                return left.second.timestamp_.load(std::memory_order_relaxed)
-                        < right.second.timestamp_.load(
-                                std::memory_order_relaxed);
-            });
-            auto res = cache_mapper().erase(it->first);
-            MAYBE_UNUSED(res);
-            assert(res);
+            shard_t *oldest_shard = nullptr;
+            const hashed_key_t *oldest_key = nullptr;
+            size_t oldest_timestamp = 0;
+            for (auto &shard : shards_) {
+                utils::lock_read_t lock_shard(shard.mutex_);
+                if (shard.mapper_.empty()) continue;
+                auto it = std::min_element(shard.mapper_.begin(),
+                        shard.mapper_.end(),
+                        [&](const v_t &left, const v_t &right) {
+                    // Relaxed memory ordering is enough here, as the
+                    // timestamps only need to be approximately ordered.
+                    // This brings about a few microseconds performance
+                    // improvement for default cache capacity.
+                    return left.second.timestamp_.load(
+                                   std::memory_order_relaxed)
+                            < right.second.timestamp_.load(
+                                    std::memory_order_relaxed);
+                });
+                const size_t timestamp
+                        = it->second.timestamp_.load(std::memory_order_relaxed);
+                if (!oldest_shard || timestamp < oldest_timestamp) {
+                    oldest_shard = &shard;
+                    oldest_key = &it->first;
+                    oldest_timestamp = timestamp;
+                }
+            }
+            if (!oldest_shard) return;
+
+            utils::lock_write_t lock_shard(oldest_shard->mutex_);
+            auto it = oldest_shard->mapper_.find(*oldest_key);
+            assert(it != oldest_shard->mapper_.end());
+            size_in_bytes_ -= it->second.footprint_;
+            oldest_shard->mapper_.erase(it);
+            size_--;
         }
     }
-    void add(const key_t &key, const value_t &value) {
-        // std::list::size() method has linear complexity. Check the cache size
-        // using std::unordered_map::size();
-        if (get_size_no_lock() == capacity_) {
+
+    // Must be called with the cache write lock held.
+    void add(const hashed_key_t &key, const value_t &value) {
+        if (get_size_no_lock() >= capacity_.load()) {
             // Evict the least recently used entry
             evict(1);
         }
 
         size_t timestamp = get_timestamp();
 
-        auto res = cache_mapper().emplace(std::piecewise_construct,
+        auto &shard = get_shard(key);
+        utils::lock_write_t lock_shard(shard.mutex_);
+        auto res = shard.mapper_.emplace(std::piecewise_construct,
                 std::forward_as_tuple(key),
                 std::forward_as_tuple(value, timestamp));
         MAYBE_UNUSED(res);
         assert(res.second);
+        size_++;
     }
-    value_t get_future(const key_t &key) {
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()) return value_t();
 
+    value_t get_future(const hashed_key_t &key) {
+        auto &shard = get_shard(key);
+        utils::lock_read_t lock_shard(shard.mutex_);
+        auto it = shard.mapper_.find(key);
+        if (it == shard.mapper_.end()) return value_t();
+
+        // Concurrent lookups of the same entry may store their timestamps in
+        // any order, which is enough for an approximate LRU.
         size_t timestamp = get_timestamp();
-        it->second.timestamp_.store(timestamp);
+        it->second.timestamp_.store(timestamp, std::memory_order_relaxed);
         // Return the entry
         return it->second.value_;
     }
 
-    int capacity_;
     struct timed_entry_t {
         value_t value_;
         std::atomic<size_t> timestamp_;
+        // Unknown until the object is created
+        size_t footprint_ = 0;
         timed_entry_t(const value_t &value, size_t timestamp)
             : value_(value), timestamp_(timestamp) {}
     };
 
-    std::unordered_map<key_t, timed_entry_t> &cache_mapper() {
-        return cache_mapper_;
-    }
+    // Each entry in the cache has a corresponding key and timestamp. NOTE:
+    // pairs that contain atomics cannot be stored in an unordered_map *as an
+    // element*, since it invokes the copy constructor of std::atomic, which is
+    // deleted.
+    using mapper_t = std::unordered_map<hashed_key_t, timed_entry_t,
+            hashed_key_hash_t>;
+
+    struct shard_t {
+        utils::rw_mutex_t mutex_;
+        mapper_t mapper_;
+    };
+
+    static constexpr int n_shards = 16;
 
-    const std::unordered_map<key_t, timed_entry_t> &cache_mapper() const {
-        return cache_mapper_;
+    shard_t &get_shard(const hashed_key_t &key) {
+        const size_t hash = key.hash();
+        // The low bits of the hash select the bucket in the shard, so use the
+        // high ones as well to spread the keys across the shards.
+        return shards_[(hash ^ (hash >> 16)) % n_shards];
     }
 
     // Leaks cached resources. Used to avoid issues with calling destructors
     // allocated by an already unloaded dynamic library.
     void release_cache() {
-        auto t = utils::make_unique<std::unordered_map<key_t, timed_entry_t>>();
-        std::swap(*t, cache_mapper_);
-        t.release();
+        for (auto &shard : shards_) {
+            auto t = utils::make_unique<mapper_t>();
+            std::swap(*t, shard.mapper_);
+            t.release();
+        }
     }
-    // Each entry in the cache has a corresponding key and timestamp. NOTE:
-    // pairs that contain atomics cannot be stored in an unordered_map *as an
-    // element*, since it invokes the copy constructor of std::atomic, which is
-    // deleted.
-    std::unordered_map<key_t, timed_entry_t> cache_mapper_;
+
+    std::atomic<int> capacity_;
+    // The number of entries, only changed with the cache write lock held
+    std::atomic<int> size_;
+    size_t capacity_in_bytes_ = 0;
+    // Total footprint of the cached objects
+    size_t size_in_bytes_ = 0;
+    shard_t shards_[n_shards];
 };
 
 } // namespace utils
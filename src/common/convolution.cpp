@@ -206,6 +206,15 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
         if (enable_quantization)
             fwd_attr_mask |= smask_t::zero_points_data_type
                     | smask_t::scales_data_type;
+        // Integer weights with floating-point activations are decompressed
+        // with their scales, optionally grouped along input channels.
+        const bool is_wei_decompression
+                = utils::one_of(src_dt, data_type::f32, data_type::bf16,
+                          data_type::f16)
+                && utils::one_of(desc.weights_desc.data_type, data_type::s8,
+                        data_type::u8, data_type::s4, data_type::u4);
+        if (is_wei_decompression)
+            fwd_attr_mask |= smask_t::scales_groups | smask_t::scales_data_type;
 
         VCHECK_CONV_UNIMPL(attr->has_default_values(fwd_attr_mask, dst_dt),
                 VERBOSE_UNSUPPORTED_ATTR);
@@ -218,10 +227,14 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
             VCHECK_CONV_UNIMPL(IMPLICATION(!sc.has_default_values(DNNL_ARG_SRC),
                                        sc.get_mask(DNNL_ARG_SRC) == 0),
                     VERBOSE_UNSUPPORTED_SCALES_CFG);
+            const int wei_ic_mask = with_groups ? 7 : 3;
             VCHECK_CONV_UNIMPL(
                     IMPLICATION(!sc.has_default_values(DNNL_ARG_WEIGHTS),
                             utils::one_of(sc.get_mask(DNNL_ARG_WEIGHTS), 0,
-                                    with_groups ? 3 : 1)),
+                                    with_groups ? 3 : 1)
+                                    || (is_wei_decompression
+                                            && sc.get_mask(DNNL_ARG_WEIGHTS)
+                                                    == wei_ic_mask)),
                     VERBOSE_UNSUPPORTED_SCALES_CFG);
             VCHECK_CONV_UNIMPL(
                     IMPLICATION(!sc.has_default_values(DNNL_ARG_DST),
@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdarg>
+#include <cstdio>
+
+#include "common/dispatch_report.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+thread_local dispatch_report_t *current_report = nullptr;
+
+bool is_reason_recording_enabled() {
+    static const bool enabled = getenv_int_user("DISPATCH_REPORT", 0) != 0;
+    return enabled;
+}
+} // namespace
+
+dispatch_report_scope_t::dispatch_report_scope_t(dispatch_report_t *report)
+    : prev_(current_report) {
+    current_report = report;
+}
+
+dispatch_report_scope_t::~dispatch_report_scope_t() {
+    current_report = prev_;
+}
+
+void dispatch_report_add(const char *impl_name, status_t status) {
+    if (current_report) current_report->add(impl_name, status);
+}
+
+bool dispatch_report_records_reasons() {
+    return current_report && is_reason_recording_enabled();
+}
+
+void dispatch_report_note(const char *fmt, ...) {
+    dispatch_report_t *report = current_report;
+    if (!report) return;
+
+    va_list args;
+    va_start(args, fmt);
+    va_list args_copy;
+    va_copy(args_copy, args);
+    const int len = vsnprintf(nullptr, 0, fmt, args_copy);
+    va_end(args_copy);
+    if (len > 0) {
+        std::string &reason = report->pending_reason_;
+        reason.resize(len + 1);
+        vsnprintf(&reason[0], reason.size(), fmt, args);
+        reason.resize(len);
+    }
+    va_end(args);
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
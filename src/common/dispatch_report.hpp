@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_DISPATCH_REPORT_HPP
+#define COMMON_DISPATCH_REPORT_HPP
+
+#include <string>
+#include <vector>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Implementations a primitive descriptor iterator skipped before it reached
+// the one it returned, in the order they were tried.
+struct dispatch_report_t {
+    struct entry_t {
+        std::string impl_name;
+        status_t status;
+        // The dispatch message the implementation reported last, as printed
+        // by ONEDNN_VERBOSE=dispatch. Only recorded when
+        // ONEDNN_DISPATCH_REPORT=1 since formatting it is not free.
+        std::string reason;
+    };
+
+    const std::vector<entry_t> &entries() const { return entries_; }
+
+    // Starts a new implementation attempt, dropping the messages left by the
+    // previous one.
+    void begin_impl() { pending_reason_.clear(); }
+
+    void add(const char *impl_name, status_t status) {
+        entries_.push_back({impl_name ? impl_name : "", status,
+                std::move(pending_reason_)});
+        pending_reason_.clear();
+    }
+
+private:
+    std::vector<entry_t> entries_;
+    std::string pending_reason_;
+
+    friend void dispatch_report_note(const char *fmt, ...);
+};
+
+// Makes `report` the report of the calling thread for the lifetime of the
+// object. The previous report is restored on destruction, so primitives
+// created while initializing an implementation do not record into the
+// report of the outer iterator.
+struct dispatch_report_scope_t {
+    dispatch_report_scope_t(dispatch_report_t *report);
+    ~dispatch_report_scope_t();
+
+    dispatch_report_scope_t(const dispatch_report_scope_t &) = delete;
+    dispatch_report_scope_t &operator=(const dispatch_report_scope_t &)
+            = delete;
+
+private:
+    dispatch_report_t *prev_;
+};
+
+// Records that the implementation being tried by the calling thread was
+// skipped. No-op when the thread has no report.
+void dispatch_report_add(const char *impl_name, status_t status);
+
+// Returns whether dispatch messages should be passed to
+// dispatch_report_note(). Used by the verbose macros.
+bool dispatch_report_records_reasons();
+
+#if defined(__GNUC__) || defined(__clang__)
+void dispatch_report_note(const char *fmt, ...)
+        __attribute__((format(printf, 1, 2)));
+#endif
+// Sets the reason of the implementation being tried by the calling thread.
+void dispatch_report_note(const char *fmt, ...);
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -1825,6 +1825,9 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     if (v == dnnl::impl::primitive_kind::sdpa) return "sdpa";
     if (v == dnnl::impl::primitive_kind::gated_mlp) return "gated_mlp";
+    if (v == dnnl::impl::primitive_kind::embedding_bag) return "embedding_bag";
+    if (v == dnnl::impl::primitive_kind::topk) return "topk";
+    if (v == dnnl::impl::primitive_kind::optimizer) return "optimizer";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
 }
@@ -1910,6 +1913,7 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
 const char *dnnl_rnn_flags2str(dnnl_rnn_flags_t v) {
     if (v == dnnl_rnn_flags_undef) return "undef";
     if (v == dnnl_rnn_flags_diff_weights_overwrite) return "rnn_flags_diff_weights_overwrite";
+    if (v == dnnl_rnn_flags_stateful) return "rnn_flags_stateful";
     assert(!"unknown rnn_flags");
     return "unknown rnn_flags";
 }
@@ -1938,6 +1942,14 @@ const char *dnnl_rounding_mode2str(dnnl_rounding_mode_t v) {
     return "unknown rounding_mode";
 }
 
+const char *dnnl_dispatch_goal2str(dnnl_dispatch_goal_t v) {
+    if (v == dnnl_dispatch_goal_any) return "any";
+    if (v == dnnl_dispatch_goal_latency) return "latency";
+    if (v == dnnl_dispatch_goal_throughput) return "throughput";
+    assert(!"unknown dispatch_goal");
+    return "unknown dispatch_goal";
+}
+
 const char *dnnl_quantization_mode2str(dnnl_quantization_mode_t v) {
     if (v == dnnl_quantization_mode_undef) return "undef";
     if (v == dnnl_quantization_mode_static_sazp) return "static_sazp";
@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2017 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -18,6 +19,7 @@
 #define COMMON_DNNL_THREAD_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <mutex>
 
@@ -194,6 +196,25 @@ inline bool dnnl_thr_syncable() {
     return DNNL_THR_SYNC == 1;
 }
 
+// Returns true if the threads of a parallel section with `nthr` threads
+// started from the calling thread may wait for each other, e.g. in a barrier
+// of a JIT kernel. Unlike dnnl_thr_syncable(), which is a property of the
+// threading runtime, this also covers a threadpool that reports
+// CONCURRENT_TEAM, so it is meant to be checked at execution time.
+inline bool dnnl_thr_team_syncable(int nthr) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    using namespace dnnl::impl::threadpool_utils;
+    using dnnl::threadpool_interop::threadpool_iface;
+    threadpool_iface *tp = get_active_threadpool();
+    // Without a threadpool the threads of parallel() are run one by one
+    if (!tp || dnnl_in_parallel()) return nthr <= 1;
+    return (tp->get_flags() & threadpool_iface::CONCURRENT_TEAM)
+            && nthr <= tp->get_num_threads();
+#else
+    return dnnl_thr_syncable();
+#endif
+}
+
 template <typename T, typename U>
 inline void balance211(T n, U team, U tid, T &n_start, T &n_end) {
     T n_min = 1;
@@ -214,6 +235,28 @@ inline void balance211(T n, U team, U tid, T &n_start, T &n_end) {
     n_end += n_start;
 }
 
+// Same as balance211, but the share of a thread is proportional to its
+// weight, e.g. the relative performance of the core it runs on. `weights`
+// holds `team` non-negative values with a positive sum.
+template <typename T, typename U, typename W>
+inline void balance211_weighted(
+        T n, U team, U tid, const W *weights, T &n_start, T &n_end) {
+    double total = 0, before = 0;
+    for (U i = 0; i < team; i++) {
+        if (i < tid) before += weights[i];
+        total += weights[i];
+    }
+    if (team <= 1 || n == 0 || total <= 0) {
+        balance211(n, team, tid, n_start, n_end);
+        return;
+    }
+    const auto share_end = [&](double w) {
+        return static_cast<T>(static_cast<double>(n) * w / total + 0.5);
+    };
+    n_start = share_end(before);
+    n_end = tid == team - 1 ? n : share_end(before + weights[tid]);
+}
+
 template <typename T, typename U>
 void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
         T &nx_end, T nx_divider) {
@@ -253,6 +296,10 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
  *                                         calls for_nd
  *  - parallel_nd_ext(nthr, dims..., f)  - creates a parallel section and then
  *                                         calls for_nd_ext
+ *  - parallel_nd_dynamic(dims..., f)    - same as parallel_nd, but threads
+ *                                         take chunks of the iteration space
+ *                                         from a shared counter instead of
+ *                                         a static equal share
  */
 
 /* general parallelization */
@@ -631,6 +678,136 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3, dim_t D4,
         });
 }
 
+/* dynamic scheduling section */
+// Hands out chunks of [0, work_amount) to the threads of a parallel section.
+// Threads that are done with their chunk take the next one, so a thread that
+// is slower, e.g. a little core or a preempted vCPU, or that got the more
+// expensive iterations, no longer sets the latency of the whole section.
+// The counter is shared through memory, so it works the same way with every
+// threading runtime, including the threadpool one.
+struct dynamic_work_counter_t {
+    dynamic_work_counter_t(dim_t work_amount, dim_t chunk)
+        : counter_(0), work_amount_(work_amount), chunk_(chunk) {}
+
+    // Returns false when all the work has been handed out
+    bool next(dim_t &start, dim_t &end) {
+        start = counter_.fetch_add(chunk_, std::memory_order_relaxed);
+        if (start >= work_amount_) return false;
+        end = std::min(start + chunk_, work_amount_);
+        return true;
+    }
+
+private:
+    std::atomic<dim_t> counter_;
+    const dim_t work_amount_;
+    const dim_t chunk_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dynamic_work_counter_t);
+};
+
+// Each thread gets several chunks on average to balance the load while
+// keeping the number of updates of the shared counter low
+inline dim_t get_dynamic_chunk_size(dim_t work_amount, int nthr) {
+    constexpr int chunks_per_thread = 4;
+    return nstl::max(dim_t(1), work_amount / (nthr * chunks_per_thread));
+}
+
+static inline void for_nd_dynamic(dynamic_work_counter_t &counter,
+        const std::function<void(dim_t, dim_t)> &f) {
+    dim_t start {0}, end {0};
+    while (counter.next(start, end))
+        f(start, end);
+}
+
+/* parallel_nd_dynamic section */
+static inline void parallel_nd_dynamic(
+        dim_t D0, const std::function<void(dim_t)> &f) {
+    int nthr = adjust_num_threads(dnnl_get_current_num_threads(), D0);
+    if (nthr == 0) return;
+    dynamic_work_counter_t counter(D0, get_dynamic_chunk_size(D0, nthr));
+    parallel(nthr, [&](int, int) {
+        for_nd_dynamic(counter, [&](dim_t start, dim_t end) {
+            for (dim_t d0 = start; d0 < end; ++d0)
+                f(d0);
+        });
+    });
+}
+static inline void parallel_nd_dynamic(
+        dim_t D0, dim_t D1, const std::function<void(dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1;
+    int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
+    if (nthr == 0) return;
+    dynamic_work_counter_t counter(
+            work_amount, get_dynamic_chunk_size(work_amount, nthr));
+    parallel(nthr, [&](int, int) {
+        for_nd_dynamic(counter, [&](dim_t start, dim_t end) {
+            dim_t d0 {0}, d1 {0};
+            utils::nd_iterator_init(start, d0, D0, d1, D1);
+            for (dim_t iwork = start; iwork < end; ++iwork) {
+                f(d0, d1);
+                utils::nd_iterator_step(d0, D0, d1, D1);
+            }
+        });
+    });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2,
+        const std::function<void(dim_t, dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1 * D2;
+    int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
+    if (nthr == 0) return;
+    dynamic_work_counter_t counter(
+            work_amount, get_dynamic_chunk_size(work_amount, nthr));
+    parallel(nthr, [&](int, int) {
+        for_nd_dynamic(counter, [&](dim_t start, dim_t end) {
+            dim_t d0 {0}, d1 {0}, d2 {0};
+            utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2);
+            for (dim_t iwork = start; iwork < end; ++iwork) {
+                f(d0, d1, d2);
+                utils::nd_iterator_step(d0, D0, d1, D1, d2, D2);
+            }
+        });
+    });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2, dim_t D3,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1 * D2 * D3;
+    int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
+    if (nthr == 0) return;
+    dynamic_work_counter_t counter(
+            work_amount, get_dynamic_chunk_size(work_amount, nthr));
+    parallel(nthr, [&](int, int) {
+        for_nd_dynamic(counter, [&](dim_t start, dim_t end) {
+            dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0};
+            utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2, d3, D3);
+            for (dim_t iwork = start; iwork < end; ++iwork) {
+                f(d0, d1, d2, d3);
+                utils::nd_iterator_step(d0, D0, d1, D1, d2, D2, d3, D3);
+            }
+        });
+    });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2, dim_t D3,
+        dim_t D4,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1 * D2 * D3 * D4;
+    int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
+    if (nthr == 0) return;
+    dynamic_work_counter_t counter(
+            work_amount, get_dynamic_chunk_size(work_amount, nthr));
+    parallel(nthr, [&](int, int) {
+        for_nd_dynamic(counter, [&](dim_t start, dim_t end) {
+            dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0}, d4 {0};
+            utils::nd_iterator_init(
+                    start, d0, D0, d1, D1, d2, D2, d3, D3, d4, D4);
+            for (dim_t iwork = start; iwork < end; ++iwork) {
+                f(d0, d1, d2, d3, d4);
+                utils::nd_iterator_step(
+                        d0, D0, d1, D1, d2, D2, d3, D3, d4, D4);
+            }
+        });
+    });
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/embedding_bag_iface.hpp"
+#include "common/embedding_bag_pd.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::alg_kind;
+
+status_t dnnl_embedding_bag_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *dst_desc, const primitive_attr_t *attr) {
+    VCHECK_EMBEDDING_BAG(
+            !utils::any_null(src_desc, indices_desc, offsets_desc, dst_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_EMBEDDING_BAG(
+            utils::one_of(alg_kind, reduction_sum, reduction_mean),
+            VERBOSE_BAD_ALGORITHM);
+    VCHECK_EMBEDDING_BAG(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src",
+            src_desc->ndims);
+    VCHECK_EMBEDDING_BAG(dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst",
+            dst_desc->ndims);
+    VCHECK_EMBEDDING_BAG(indices_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+            "indices", indices_desc->ndims);
+    VCHECK_EMBEDDING_BAG(offsets_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+            "offsets", offsets_desc->ndims);
+    VCHECK_EMBEDDING_BAG(
+            utils::everyone_is(data_type::s32, indices_desc->data_type,
+                    offsets_desc->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VCHECK_EMBEDDING_BAG(src_desc->dims[1] == dst_desc->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "src", 1, "dst", 1);
+    VCHECK_EMBEDDING_BAG(offsets_desc->dims[0] == dst_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "offsets", 0, "dst", 0);
+    for (const auto *md : {src_desc, indices_desc, offsets_desc, dst_desc}) {
+        VCHECK_EMBEDDING_BAG(
+                !memory_desc_wrapper(md).has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    }
+
+    auto desc = create_embedding_bag_desc(
+            alg_kind, src_desc, indices_desc, offsets_desc, dst_desc);
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&desc, nullptr, attr);
+}
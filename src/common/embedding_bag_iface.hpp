@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EMBEDDING_BAG_IFACE_HPP
+#define COMMON_EMBEDDING_BAG_IFACE_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+/// Creates a primitive descriptor for an embedding bag primitive.
+///
+/// Row b of the destination is the sum or the mean of the rows of the table
+/// selected by indices[offsets[b]] to indices[offsets[b + 1] - 1], where the
+/// last bag ends with the indices. Empty bags produce zeros. The table may
+/// be quantized with per-row (mask 1) or common scales and zero points set
+/// for #DNNL_ARG_SRC in the attributes.
+///
+/// Arguments: #DNNL_ARG_SRC (table), #DNNL_ARG_SRC_1 (indices),
+/// #DNNL_ARG_SRC_2 (offsets), #DNNL_ARG_DST.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Pooling of the rows of a bag. Possible values are
+///     #dnnl_reduction_sum and #dnnl_reduction_mean.
+/// @param src_desc Embedding table memory descriptor, 2D
+///     [rows, embedding size].
+/// @param indices_desc Row indices memory descriptor, 1D s32 [indices].
+/// @param offsets_desc Bag offsets memory descriptor, 1D s32 [bags].
+/// @param dst_desc Destination memory descriptor, 2D [bags, embedding size].
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_embedding_bag_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
+#endif
@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EMBEDDING_BAG_PD_HPP
+#define COMMON_EMBEDDING_BAG_PD_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define DNNL_ARG_EMBEDDING_INDICES DNNL_ARG_SRC_1
+#define DNNL_ARG_EMBEDDING_OFFSETS DNNL_ARG_SRC_2
+
+#define VCHECK_EMBEDDING_BAG(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, embedding_bag, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__)
+
+#define VDISPATCH_EMBEDDING_BAG(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, embedding_bag, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+static inline embedding_bag_desc_t create_embedding_bag_desc(
+        alg_kind_t alg_kind, const memory_desc_t *src_md,
+        const memory_desc_t *indices_md, const memory_desc_t *offsets_md,
+        const memory_desc_t *dst_md) {
+    auto desc = embedding_bag_desc_t();
+    desc.primitive_kind = primitive_kind::embedding_bag;
+    desc.alg_kind = alg_kind;
+    desc.src_desc = *src_md;
+    desc.indices_desc = *indices_md;
+    desc.offsets_desc = *offsets_md;
+    desc.dst_desc = *dst_md;
+    return desc;
+}
+
+// Pools rows of an embedding table: row b of the destination is the sum or
+// the mean of the table rows indices[offsets[b]] to indices[offsets[b + 1]
+// - 1], the last bag ending with the indices. The table may be quantized with
+// per-row scales and zero points set on DNNL_ARG_SRC, which are applied when
+// the rows are read.
+// NOLINTBEGIN(google-default-arguments)
+struct embedding_bag_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::embedding_bag;
+    using base_class = embedding_bag_pd_t;
+    using hint_class = embedding_bag_pd_t;
+
+    const embedding_bag_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    alg_kind_t alg_kind() const { return desc_.alg_kind; }
+    dim_t n_rows() const { return desc_.src_desc.dims[0]; }
+    dim_t emb_dim() const { return desc_.src_desc.dims[1]; }
+    dim_t n_indices() const { return desc_.indices_desc.dims[0]; }
+    dim_t n_bags() const { return desc_.offsets_desc.dims[0]; }
+
+    int n_inputs() const override { return 3; }
+    int n_outputs() const override { return 1; }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_EMBEDDING_INDICES,
+                    DNNL_ARG_EMBEDDING_OFFSETS))
+            return arg_usage_t::input;
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_EMBEDDING_INDICES: return src_md(1);
+            case DNNL_ARG_EMBEDDING_OFFSETS: return src_md(2);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &src_md_;
+            case 1: return &indices_md_;
+            case 2: return &offsets_md_;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &dst_md_ : &glob_zero_md;
+    }
+
+protected:
+    embedding_bag_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t indices_md_;
+    memory_desc_t offsets_md_;
+    memory_desc_t dst_md_;
+
+    embedding_bag_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<embedding_bag_desc_t>(adesc))
+        , src_md_(desc_.src_desc)
+        , indices_md_(desc_.indices_desc)
+        , offsets_md_(desc_.offsets_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    // Sets plain formats for the memory descriptors with format `any`.
+    bool set_default_formats() {
+        using namespace format_tag;
+        auto set = [](memory_desc_t &md, format_tag_t tag) {
+            return md.format_kind != format_kind::any
+                    || memory_desc_init_by_tag(md, tag) == status::success;
+        };
+        return set(src_md_, ab) && set(indices_md_, a) && set(offsets_md_, a)
+                && set(dst_md_, ab);
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -129,6 +129,28 @@ status_t dnnl_engine_create(
     }
 }
 
+status_t dnnl_cpu_engine_create_with_allocator(engine_t **engine,
+        dnnl_cpu_allocate_f allocate, dnnl_cpu_deallocate_f deallocate,
+        void *user_data) {
+    using namespace dnnl::impl;
+    VERROR_ENGINE(engine != nullptr, invalid_arguments, VERBOSE_NULL_ARG);
+    VERROR_ENGINE(allocate != nullptr && deallocate != nullptr,
+            invalid_arguments, VERBOSE_NULL_ARG);
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+    cpu::cpu_user_allocator_t user_allocator;
+    user_allocator.allocate = allocate;
+    user_allocator.deallocate = deallocate;
+    user_allocator.user_data = user_data;
+    return cpu::cpu_engine_factory_t().engine_create_with_allocator(
+            engine, user_allocator);
+#else
+    UNUSED(user_data);
+    VERROR_ENGINE(false, unimplemented, VERBOSE_INVALID_ENGINE_KIND, "",
+            dnnl_engine_kind2str(engine_kind::cpu));
+#endif
+}
+
 status_t dnnl_engine_get_kind(engine_t *engine, engine_kind_t *kind) {
     using namespace dnnl::impl;
     if (engine == nullptr) return invalid_arguments;
@@ -161,6 +161,19 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
         return true;
     }
 
+    // The cache blob ID only depends on the primitive descriptor and the
+    // device, so it is also available on CPU where primitives do not provide
+    // cache blobs. Applications may use it to key their own caches.
+    bool is_cache_blob_id_supported() const {
+        return is_cache_blob_supported()
+                || kind() == dnnl::impl::engine_kind::cpu;
+    }
+
+    // Returns the pool the scratchpads of the primitives created on the
+    // engine are taken from, nullptr if the scratchpads are allocated per
+    // primitive.
+    virtual dnnl::impl::scratchpad_pool_t *scratchpad_pool() { return nullptr; }
+
     virtual bool mayiuse_system_memory_allocators() const { return false; }
     virtual bool mayiuse_f16_accumulator_with_f16() const { return false; }
 
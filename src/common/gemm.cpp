@@ -14,7 +14,11 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <sstream>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -57,6 +61,26 @@ std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
     return s_;
 }
 
+// Computes the batch_size matrix multiplications of a batch with f(i). The
+// threads take the multiplications one by one, unless there are too few of
+// them to occupy all the threads.
+status_t execute_gemm_batch(
+        dim_t batch_size, const std::function<status_t(dim_t)> &f) {
+    if (batch_size < dnnl_get_current_num_threads()) {
+        for (dim_t i = 0; i < batch_size; ++i)
+            CHECK(f(i));
+        return status::success;
+    }
+
+    std::atomic<status_t> st(status::success);
+    parallel_nd_dynamic(batch_size, [&](dim_t i) {
+        if (st != status::success) return;
+        const status_t st_i = f(i);
+        if (st_i != status::success) st = st_i;
+    });
+    return st;
+}
+
 } // namespace
 #endif
 
@@ -157,6 +181,56 @@ extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa,
 #endif
 }
 
+dnnl_status_t dnnl_sgemm_batch(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *const *A, const dim_t *lda, const float *const *B,
+        const dim_t *ldb, const float *beta, float *const *C, const dim_t *ldc,
+        dim_t group_count, const dim_t *group_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (group_count < 0) return status::invalid_arguments;
+    if (group_count == 0) return status::success;
+    if (utils::any_null(transa, transb, M, N, K, alpha, lda, ldb, beta, ldc,
+                group_size))
+        return status::invalid_arguments;
+
+    // Entries of the group g are [group_off[g], group_off[g + 1]).
+    std::vector<dim_t> group_off(group_count + 1, 0);
+    for (dim_t g = 0; g < group_count; ++g) {
+        if (group_size[g] < 0) return status::invalid_arguments;
+        group_off[g + 1] = group_off[g] + group_size[g];
+    }
+    const dim_t batch_size = group_off[group_count];
+    if (batch_size == 0) return status::success;
+    if (utils::any_null(A, B, C)) return status::invalid_arguments;
+
+    return execute_gemm_batch(batch_size, [&](dim_t i) {
+        const dim_t g = std::upper_bound(group_off.begin(), group_off.end(), i)
+                - group_off.begin() - 1;
+        return cpu::extended_sgemm(&transb[g], &transa[g], &N[g], &M[g], &K[g],
+                &alpha[g], B[i], &ldb[g], A[i], &lda[g], &beta[g], C[i],
+                &ldc[g], nullptr, false);
+    });
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_batch_strided(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
+        dim_t stride_a, const float *B, dim_t ldb, dim_t stride_b, float beta,
+        float *C, dim_t ldc, dim_t stride_c, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size < 0) return status::invalid_arguments;
+    return execute_gemm_batch(batch_size, [&](dim_t i) {
+        return cpu::extended_sgemm(&transb, &transa, &N, &M, &K, &alpha,
+                B + i * stride_b, &ldb, A + i * stride_a, &lda, &beta,
+                C + i * stride_c, &ldc, nullptr, false);
+    });
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
 dnnl_status_t dnnl_threadpool_interop_sgemm(char transa, char transb, dim_t M,
         dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "common/impl_list_item.hpp"
+#include "common/verbose.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -92,5 +93,14 @@ pk_dt_impl_key_t::pk_dt_impl_key_t(prop_kind_t kind, data_type_t src_dt,
     }
 }
 
+#if BUILD_IMPL_MANIFEST_RECORD
+void impl_list_item_t::report_manifest_entry() const {
+    if (!name_ || !get_verbose(verbose_t::create_dispatch)) return;
+    // The class name goes last since it may contain commas.
+    VFORMAT(get_msec(), verbose_t::create_dispatch, primitive, create,
+            VERBOSE_dispatch, "manifest,%s", name_);
+}
+#endif
+
 } // namespace impl
 } // namespace dnnl
@@ -18,6 +18,7 @@
 #define COMMON_IMPL_LIST_ITEM_HPP
 
 #include "c_types_map.hpp"
+#include "impl_manifest.hpp"
 #include "primitive_desc.hpp"
 #include "utils.hpp"
 
@@ -63,6 +64,15 @@ private:
     size_t value() const { return (size_t)kind; }
 };
 
+// Creates an implementation list item using the deduction `helper` of
+// impl_list_item_t. Implementation classes missing from the build manifest are
+// replaced with a stub, see ONEDNN_ENABLE_IMPL_MANIFEST.
+#define DNNL_IMPL_LIST_ITEM(helper, ...) \
+    impl_list_item_t(impl_list_item_t(impl_list_item_t::manifest_helper_t< \
+                             impl_list_item_t::helper<__VA_ARGS__::pd_t>, \
+                             impl_manifest::is_enabled(#__VA_ARGS__)>()), \
+            #__VA_ARGS__)
+
 struct impl_list_item_t {
     constexpr impl_list_item_t() = default;
     constexpr impl_list_item_t(const impl_list_item_t &other) = default;
@@ -96,11 +106,45 @@ struct impl_list_item_t {
     struct reorder_type_deduction_helper_t
         : public type_deduction_helper_t<pd_t> {};
 
+    // Stands for an implementation missing from the build manifest. Its
+    // create function is never referenced, so the linker can drop its code.
+    template <typename helper_t>
+    struct pruned_type_deduction_helper_t {
+        constexpr pruned_type_deduction_helper_t() = default;
+    };
+
+    template <typename helper_t, bool enabled>
+    using manifest_helper_t = typename utils::conditional<enabled, helper_t,
+            pruned_type_deduction_helper_t<helper_t>>::type;
+
     template <typename pd_t>
     constexpr impl_list_item_t(type_deduction_helper_t<pd_t>)
         : create_pd_func_(&primitive_desc_t::create<
                           typename type_deduction_helper_t<pd_t>::type>) {}
 
+    template <typename pd_t>
+    constexpr impl_list_item_t(
+            pruned_type_deduction_helper_t<type_deduction_helper_t<pd_t>>)
+        : create_pd_func_(&create_pruned_pd) {}
+
+    template <typename pd_t>
+    constexpr impl_list_item_t(pruned_type_deduction_helper_t<
+            reorder_type_deduction_helper_t<pd_t>>)
+        : create_reorder_pd_func_(&create_pruned_reorder_pd) {}
+
+    // Attaches the implementation class name, which is reported on successful
+    // creation in builds recording a manifest.
+    constexpr impl_list_item_t(const impl_list_item_t &other, const char *name)
+        : create_pd_func_(other.create_pd_func_)
+        , create_concat_pd_func_(other.create_concat_pd_func_)
+        , create_sum_pd_func_(other.create_sum_pd_func_)
+        , create_reorder_pd_func_(other.create_reorder_pd_func_)
+#if BUILD_IMPL_MANIFEST_RECORD
+        , name_(name)
+#endif
+    {
+    }
+
     template <typename pd_t>
     constexpr impl_list_item_t(concat_type_deduction_helper_t<pd_t>)
         : create_concat_pd_func_(
@@ -146,6 +190,9 @@ private:
         if (status == status::success) {
             (*pd)->init_pd_iterator_offset(pd_iterator_offset);
             (*pd)->init_skip_idx(skip_idx);
+#if BUILD_IMPL_MANIFEST_RECORD
+            report_manifest_entry();
+#endif
         }
         return status;
     }
@@ -173,10 +220,18 @@ private:
             const memory_desc_t *src_md, engine_t *dst_engine,
             const memory_desc_t *dst_md) const {
         if (!create_reorder_pd_func_) return status::runtime_error;
-        return create_reorder_pd_func_(reorder_pd, engine, attr, src_engine,
-                src_md, dst_engine, dst_md);
+        auto status = create_reorder_pd_func_(reorder_pd, engine, attr,
+                src_engine, src_md, dst_engine, dst_md);
+#if BUILD_IMPL_MANIFEST_RECORD
+        if (status == status::success) report_manifest_entry();
+#endif
+        return status;
     }
 
+#if BUILD_IMPL_MANIFEST_RECORD
+    void report_manifest_entry() const;
+#endif
+
     using create_pd_func_t = status_t (*)(primitive_desc_t **,
             const op_desc_t *, const primitive_attr_t *, engine_t *,
             const primitive_desc_t *);
@@ -197,6 +252,20 @@ private:
     create_concat_pd_func_t create_concat_pd_func_ = nullptr;
     create_sum_pd_func_t create_sum_pd_func_ = nullptr;
     create_reorder_pd_func_t create_reorder_pd_func_ = nullptr;
+#if BUILD_IMPL_MANIFEST_RECORD
+    const char *name_ = nullptr;
+#endif
+
+    static status_t create_pruned_pd(primitive_desc_t **, const op_desc_t *,
+            const primitive_attr_t *, engine_t *, const primitive_desc_t *) {
+        return status::unimplemented;
+    }
+
+    static status_t create_pruned_reorder_pd(reorder_pd_t **, engine_t *,
+            const primitive_attr_t *, engine_t *, const memory_desc_t *,
+            engine_t *, const memory_desc_t *) {
+        return status::unimplemented;
+    }
 
     // List of functions/classes that have permissions to create primitive
     // descriptors.
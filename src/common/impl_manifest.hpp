@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_IMPL_MANIFEST_HPP
+#define COMMON_IMPL_MANIFEST_HPP
+
+#include <cstddef>
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+namespace dnnl {
+namespace impl {
+namespace impl_manifest {
+
+// Compares implementation class names ignoring whitespace, so that
+// `foo_t<a, b>` in a manifest matches `foo_t<a,b>` in an implementation list.
+constexpr bool names_match(const char *a, const char *b) {
+    return *a == ' ' ? names_match(a + 1, b)
+            : *b == ' '
+            ? names_match(a, b + 1)
+            : *a == *b && (*a == '\0' || names_match(a + 1, b + 1));
+}
+
+// Bisects the list to keep the constexpr recursion depth logarithmic.
+constexpr bool is_listed(const char *name, const char *const *list,
+        size_t begin, size_t end) {
+    return end - begin == 1
+            ? names_match(name, list[begin])
+            : is_listed(name, list, begin, begin + (end - begin) / 2)
+                    || is_listed(name, list, begin + (end - begin) / 2, end);
+}
+
+#if BUILD_IMPL_MANIFEST
+constexpr const char *enabled_impls[] = {
+#include "common/impl_manifest_list.inc"
+};
+
+constexpr size_t n_enabled_impls
+        = sizeof(enabled_impls) / sizeof(enabled_impls[0]);
+#endif
+
+// Returns whether the implementation class `name` is kept in the
+// implementation lists. Always true unless the library is built with
+// ONEDNN_ENABLE_IMPL_MANIFEST set to a manifest.
+constexpr bool is_enabled(const char *name) {
+#if BUILD_IMPL_MANIFEST
+    return is_listed(name, enabled_impls, 0, n_enabled_impls);
+#else
+    return (void)name, true;
+#endif
+}
+
+} // namespace impl_manifest
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -96,6 +96,13 @@
     {}
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_EMBEDDING_BAG
+#define REG_EMBEDDING_BAG_P(...) __VA_ARGS__
+#else
+#define REG_EMBEDDING_BAG_P(...) \
+    { nullptr }
+#endif
+
 #if BUILD_PRIMITIVE_ALL || BUILD_GATED_MLP
 #define REG_GATED_MLP_P(...) __VA_ARGS__
 #else
@@ -138,6 +145,13 @@
     { nullptr }
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_OPTIMIZER
+#define REG_OPTIMIZER_P(...) __VA_ARGS__
+#else
+#define REG_OPTIMIZER_P(...) \
+    { nullptr }
+#endif
+
 #if BUILD_PRIMITIVE_ALL || BUILD_POOLING
 #define REG_POOLING_P(...) __VA_ARGS__
 #else
@@ -208,6 +222,13 @@
     { nullptr }
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_TOPK
+#define REG_TOPK_P(...) __VA_ARGS__
+#else
+#define REG_TOPK_P(...) \
+    { nullptr }
+#endif
+
 // Primitive CPU ISA section is in src/cpu/platform.hpp
 
 #if BUILD_PRIMITIVE_GPU_ISA_ALL || BUILD_XELP
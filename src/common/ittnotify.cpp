@@ -97,6 +97,9 @@ void primitive_task_start(primitive_kind_t kind, const char *log_kind) {
             CASE(group_normalization),
             CASE(sdpa),
             CASE(gated_mlp),
+            CASE(embedding_bag),
+            CASE(topk),
+            CASE(optimizer),
     };
 #undef CASE
     int kind_idx = (int)kind;
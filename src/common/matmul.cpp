@@ -332,6 +332,21 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
                     src_scale_group_k = sc.get_group(DNNL_ARG_SRC, 1);
             }
 
+            // Dynamic source scales quantize a floating-point source per row
+            // to the integer weights data type.
+            if (sc.get(DNNL_ARG_SRC).is_dynamic()) {
+                VCHECK_MATMUL_UNIMPL(sc.get(DNNL_ARG_SRC).is_dynamic_fp()
+                                && mask_src == src_qmask_M
+                                && sc.get(DNNL_ARG_SRC).has_default_groups()
+                                && sc.get_data_type(DNNL_ARG_SRC)
+                                        == data_type::f32
+                                && !types::is_integral_dt(
+                                        desc.src_desc.data_type)
+                                && types::is_integral_dt(
+                                        desc.weights_desc.data_type),
+                        VERBOSE_UNSUPPORTED_SCALES_CFG);
+            }
+
             // Due to hardware specifics, groups, when more than 1, should be
             // multiple of 16.
             VCHECK_MATMUL_UNIMPL(
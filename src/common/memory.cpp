@@ -171,6 +171,43 @@ status_t dnnl_memory_create(memory_t **memory, const memory_desc_t *md,
     return success;
 }
 
+status_t dnnl_memory_create_read_only(memory_t **memory,
+        const memory_desc_t *md, engine_t *engine, const void *handle) {
+    if (any_null(memory, md, engine, handle)) return invalid_arguments;
+
+    // The buffer is usually a part of a file mapping, so it is only required
+    // to be aligned to a cache line as the buffers allocated by the library.
+    constexpr size_t read_only_alignment = 64;
+    VCHECK_MEMORY(
+            reinterpret_cast<uintptr_t>(handle) % read_only_alignment == 0,
+            invalid_arguments, "read-only buffer is not aligned to %zu bytes",
+            read_only_alignment);
+    VCHECK_MEMORY(engine->kind() == engine_kind::cpu
+                    && engine->runtime_kind() != runtime_kind::sycl,
+            unimplemented, "read-only memory is only supported on CPU");
+
+    const auto mdw = memory_desc_wrapper(md);
+    VCHECK_MEMORY(
+            !mdw.format_any(), invalid_arguments, VERBOSE_UNSUPPORTED_TAG);
+    VCHECK_MEMORY(!mdw.has_runtime_dims_or_strides(), invalid_arguments,
+            VERBOSE_UNSUPPORTED_MEM_STRIDE);
+    VCHECK_MEMORY(!mdw.is_host_scalar_desc() && !mdw.is_sparse_desc(),
+            invalid_arguments, VERBOSE_UNSUPPORTED_FORMAT_KIND);
+
+    // The library never writes to the buffer, so the constness is only
+    // dropped to share the storage implementation.
+    auto _memory = new memory_t(engine, md, memory_flags_t::use_runtime_ptr,
+            const_cast<void *>(handle));
+    if (_memory == nullptr) return out_of_memory;
+    if (_memory->memory_storage() == nullptr) {
+        _memory->release();
+        return out_of_memory;
+    }
+    _memory->set_read_only();
+    *memory = _memory;
+    return success;
+}
+
 status_t dnnl_memory_create_v2(memory_t **memory, const memory_desc_t *md,
         engine_t *engine, int nhandles, void **handles) {
     const bool args_ok = !any_null(memory, engine, handles) && nhandles > 0;
@@ -269,6 +306,8 @@ status_t dnnl_memory_get_data_handle(const memory_t *memory, void **handle) {
 
 status_t dnnl_memory_set_data_handle(memory_t *memory, void *handle) {
     if (any_null(memory)) return invalid_arguments;
+    VCHECK_MEMORY(!memory->is_read_only(), invalid_arguments,
+            "data handle of a read-only memory can't be changed");
     const auto mdw = memory_desc_wrapper(memory->md());
     VCHECK_MEMORY(!mdw.is_host_scalar_desc(), invalid_arguments,
             VERBOSE_UNSUPPORTED_FORMAT_KIND);
@@ -293,6 +332,8 @@ status_t dnnl_memory_get_data_handle_v2(
 status_t dnnl_memory_set_data_handle_v2(
         memory_t *memory, void *handle, int index) {
     if (any_null(memory)) return invalid_arguments;
+    VCHECK_MEMORY(!memory->is_read_only(), invalid_arguments,
+            "data handle of a read-only memory can't be changed");
     const auto mdw = memory_desc_wrapper(memory->md());
     VCHECK_MEMORY(!mdw.is_host_scalar_desc(), invalid_arguments,
             VERBOSE_UNSUPPORTED_FORMAT_KIND);
@@ -36,7 +36,9 @@ struct exec_ctx_t;
 enum memory_flags_t {
     alloc = 0x1,
     use_runtime_ptr = 0x2,
-    prefer_device_usm = 0x4
+    prefer_device_usm = 0x4,
+    // The allocated buffer is a scratchpad
+    scratchpad = 0x8
 };
 } // namespace impl
 } // namespace dnnl
@@ -96,6 +98,10 @@ struct dnnl_memory : public dnnl::impl::c_compatible {
 
     size_t get_num_handles() const { return memory_storages_.size(); }
 
+    /** returns true if the buffer must not be written by the library */
+    bool is_read_only() const { return read_only_; }
+    void set_read_only() { read_only_ = true; }
+
     void retain() { counter_++; }
 
     void release() {
@@ -115,6 +121,7 @@ private:
     // Number of storages is larger than 1 only for sparse memory.
     std::vector<std::unique_ptr<dnnl::impl::memory_storage_t>> memory_storages_;
     std::atomic<int> counter_;
+    bool read_only_ = false;
 };
 
 namespace dnnl {
@@ -197,6 +197,7 @@ enum {
     key_conv_brgemm_out_buffer,
     key_conv_bwd_w_1st_bia_reorder,
     key_conv_bwd_w_1st_wei_reorder,
+    key_conv_decompressed_wei,
     key_conv_dst_scales,
     key_conv_gemm_acc,
     key_conv_gemm_col,
@@ -234,6 +235,9 @@ enum {
     key_eltwise_src,
     key_fusion_forward_scratchpad,
     key_fusion_inout_buffer,
+    key_gated_mlp_acc,
+    key_gated_mlp_gate,
+    key_gated_mlp_up,
     key_gemm_asm_tmp_buffer,
     key_gemm_tmp_buffer,
     key_gemm_blocked_a,
@@ -267,6 +271,7 @@ enum {
     key_lnorm_tmp_var,
     key_lnorm_tmp_diff_ss,
     key_lnorm_reduction,
+    key_lrn_wsp,
     key_matmul_pack_space,
     key_matmul_dst_in_acc_dt,
     key_matmul_lt_algo_scratch,
@@ -278,6 +283,7 @@ enum {
     key_matmul_dst_scales,
     key_matmul_sparse_tmp_ptr,
     key_matmul_dyn_scale_space,
+    key_matmul_grouped_work_offsets,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
     key_pool_ind_plain2blocked_cvt,
@@ -330,11 +336,25 @@ enum {
     key_sdpa_dK_reduction,
     key_sdpa_dV_reduction,
     key_sdpa_bwd_strides,
+    key_sdpa_acc,
+    key_sdpa_diff_scores,
+    key_sdpa_key_trans,
+    key_sdpa_qry_pad,
+    key_sdpa_row_stats,
+    key_sdpa_scores,
+    key_sdpa_scores_trans,
+    key_sdpa_seq_blk_offsets,
+    key_sdpa_split_acc,
+    key_sdpa_split_stats,
+    key_sdpa_val_pad,
+    key_sdpa_val_trans,
     key_softmax_dst_scales,
     key_softmax_reduction,
     key_softmax_interim_store,
     key_sum_reduction,
     key_sum_srcs_cvt,
+    key_topk_candidates,
+    key_topk_stats,
     key_wino_U,
     key_wino_V,
     key_wino_M,
@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_NTHR_TUNER_HPP
+#define COMMON_NTHR_TUNER_HPP
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+
+namespace dnnl {
+namespace impl {
+
+// Selects the number of threads of the executions of a primitive by timing
+// its first executions with a few team sizes. Small primitives often run
+// faster on fewer threads than available, as the synchronization of the
+// threads and the traffic between their caches outweigh the work.
+//
+// After a warm-up execution, every candidate, from all the threads down to an
+// eighth of them, is timed over a couple of executions and the fastest one is
+// kept. A primitive taking more than max_tuned_ms on all the threads is not
+// tuned, as running it on fewer threads would cost more than it could save.
+struct nthr_tuner_t {
+    static constexpr double max_tuned_ms = 1.0;
+
+    nthr_tuner_t() = default;
+
+    // Returns the number of threads of the next execution out of the
+    // `max_nthr` available. The tuning restarts when `max_nthr` changes.
+    int get_nthr(int max_nthr) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (max_nthr != max_nthr_) reset(max_nthr);
+        if (nthr_ > 0) return nthr_;
+        const int i = n_records_ - n_warmup_;
+        return i < 0 ? max_nthr : candidates_[i / n_reps_];
+    }
+
+    // Records that an execution with `nthr` threads took `ms` milliseconds.
+    // Returns true if the record completes the tuning.
+    bool record(int nthr, double ms) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (nthr_ > 0 || ++n_records_ <= n_warmup_) return false;
+
+        for (int k = 0; k < n_candidates_; k++)
+            if (candidates_[k] == nthr) best_ms_[k] = std::min(best_ms_[k], ms);
+
+        if (nthr == max_nthr_ && ms > max_tuned_ms) {
+            nthr_ = max_nthr_;
+            return true;
+        }
+        if (n_records_ < n_warmup_ + n_candidates_ * n_reps_) return false;
+
+        int best = 0;
+        for (int k = 1; k < n_candidates_; k++)
+            if (best_ms_[k] < best_ms_[best]) best = k;
+        nthr_ = candidates_[best];
+        return true;
+    }
+
+    // Sets the number of threads for `max_nthr` threads available, as found
+    // by an earlier tuning.
+    void set_nthr(int max_nthr, int nthr) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        reset(max_nthr);
+        nthr_ = std::max(1, std::min(nthr, max_nthr));
+    }
+
+    // Returns true if nothing is known yet for `max_nthr` threads available.
+    bool is_new(int max_nthr) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return max_nthr != max_nthr_ || (nthr_ == 0 && n_records_ == 0);
+    }
+
+private:
+    static constexpr int n_warmup_ = 1;
+    // Timed executions per candidate
+    static constexpr int n_reps_ = 2;
+    static constexpr int max_candidates_ = 4;
+
+    void reset(int max_nthr) {
+        max_nthr_ = max_nthr;
+        n_candidates_ = 0;
+        for (int nthr = max_nthr; nthr >= 1 && n_candidates_ < max_candidates_;
+                nthr /= 2) {
+            candidates_[n_candidates_] = nthr;
+            best_ms_[n_candidates_] = std::numeric_limits<double>::max();
+            n_candidates_++;
+        }
+        n_records_ = 0;
+        nthr_ = max_nthr <= 1 ? 1 : 0;
+    }
+
+    std::mutex mutex_;
+    int max_nthr_ = 0;
+    int n_candidates_ = 0;
+    int candidates_[max_candidates_] = {};
+    double best_ms_[max_candidates_] = {};
+    int n_records_ = 0;
+    // The selected number of threads, 0 while tuning
+    int nthr_ = 0;
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
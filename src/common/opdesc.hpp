@@ -391,6 +391,66 @@ struct gated_mlp_desc_t : public op_desc_t {
     alg_kind_t activation {};
 };
 
+// A descriptor of an embedding bag operation.
+struct embedding_bag_desc_t : public op_desc_t {
+    embedding_bag_desc_t() : op_desc_t(primitive_kind::embedding_bag) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(embedding_bag_desc_t);
+
+    // The kind of pooling of the rows of a bag. Possible values:
+    // dnnl_reduction_sum and dnnl_reduction_mean.
+    alg_kind_t alg_kind {};
+    // Embedding table memory descriptor, 2D [rows, embedding size].
+    memory_desc_t src_desc;
+    // Row indices memory descriptor, 1D [indices].
+    memory_desc_t indices_desc;
+    // Memory descriptor of the offsets of the first index of each bag,
+    // 1D [bags].
+    memory_desc_t offsets_desc;
+    // Destination memory descriptor, 2D [bags, embedding size].
+    memory_desc_t dst_desc;
+};
+
+// A descriptor of a top-k operation.
+struct topk_desc_t : public op_desc_t {
+    topk_desc_t() : op_desc_t(primitive_kind::topk) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(topk_desc_t);
+
+    // Source memory descriptor, 2D [rows, n].
+    memory_desc_t src_desc;
+    // Memory descriptor of the k largest values of each row, 2D [rows, k].
+    memory_desc_t dst_desc;
+    // Memory descriptor of the indices of the values, 2D [rows, k].
+    memory_desc_t indices_desc;
+    // Whether the values are the probabilities of a softmax of the source
+    // scaled by `1 / temperature` instead of the source values.
+    bool with_softmax {};
+    float temperature {};
+};
+
+// A descriptor of an optimizer step operation.
+struct optimizer_desc_t : public op_desc_t {
+    optimizer_desc_t() : op_desc_t(primitive_kind::optimizer) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(optimizer_desc_t);
+
+    // The update rule, a dnnl_optimizer_alg_t value.
+    int alg {};
+    // Memory descriptors of the f32 parameters updated in one launch. The
+    // gradients, the moments and the parameter copies have the same layout.
+    std::vector<memory_desc_t> param_descs;
+    data_type_t grad_data_type {};
+    // Data type of a lower precision copy of the updated parameters, or
+    // undef when no copy is written.
+    data_type_t param_copy_data_type {};
+    // Exponential decay rates of the moments; beta1 is the momentum of SGD.
+    float beta1 {};
+    float beta2 {};
+    float epsilon {};
+    float weight_decay {};
+};
+
 // A descriptor of a Group Normalization operation.
 struct group_normalization_desc_t : public op_desc_t {
     group_normalization_desc_t()
@@ -543,6 +603,19 @@ struct softmax_desc_t : public op_desc_t {
     memory_desc_t dst_desc;
     // Destination gradient memory descriptor.
     memory_desc_t diff_dst_desc;
+    // Internal attention inputs applied to the source before the softmax
+    // along the last dimension (forward propagation on CPU only).
+    // Memory descriptor of a single value multiplying the source, or zero.
+    memory_desc_t scale_desc;
+    // Whether the source is divided by the scale instead.
+    bool invert_scale {};
+    // Memory descriptor of an additive mask broadcast to the source, or zero.
+    memory_desc_t attn_mask_desc;
+    // Mask kind, one of dnnl::impl::attn_mask_type values. The
+    // dnnl_attn_mask_top_left and dnnl_attn_mask_bottom_right kinds mask out
+    // the keys (last dimension) past the diagonal of every queries
+    // (second-to-last dimension) row without a mask buffer.
+    int attn_mask_type {};
 };
 
 // A descriptor of a binary operation.
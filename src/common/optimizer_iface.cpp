@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/optimizer_iface.hpp"
+#include "common/optimizer_pd.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+status_t dnnl_optimizer_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        dnnl_optimizer_alg_t alg, int n,
+        const memory_desc_t *const *param_descs,
+        data_type_t grad_data_type, data_type_t param_copy_data_type,
+        float beta1, float beta2, float epsilon, float weight_decay,
+        const primitive_attr_t *attr) {
+    using namespace data_type;
+    VCHECK_OPTIMIZER(param_descs != nullptr, VERBOSE_NULL_ARG);
+    VCHECK_OPTIMIZER(utils::one_of(alg, dnnl_optimizer_sgd_momentum,
+                             dnnl_optimizer_adam, dnnl_optimizer_adamw),
+            VERBOSE_BAD_ALGORITHM);
+    VCHECK_OPTIMIZER(n > 0 && n <= DNNL_OPTIMIZER_MAX_TENSORS,
+            VERBOSE_BAD_PARAM, "n");
+    VCHECK_OPTIMIZER(utils::one_of(grad_data_type, f32, bf16, f16)
+                    && utils::one_of(param_copy_data_type, undef, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VCHECK_OPTIMIZER(beta1 >= 0.f && beta1 < 1.f, VERBOSE_BAD_PARAM, "beta1");
+    VCHECK_OPTIMIZER(
+            IMPLICATION(alg != dnnl_optimizer_sgd_momentum,
+                    beta2 >= 0.f && beta2 < 1.f && epsilon > 0.f),
+            VERBOSE_BAD_PARAM, "beta2");
+
+    auto desc = optimizer_desc_t();
+    desc.alg = alg;
+    for (int i = 0; i < n; i++) {
+        const memory_desc_t *md = param_descs[i];
+        VCHECK_OPTIMIZER(md != nullptr, VERBOSE_NULL_ARG);
+        VCHECK_OPTIMIZER(md->data_type == f32, VERBOSE_UNSUPPORTED_DT);
+        VCHECK_OPTIMIZER(md->format_kind == format_kind::blocked,
+                VERBOSE_UNSUPPORTED_FORMAT_KIND);
+        VCHECK_OPTIMIZER(!memory_desc_wrapper(md).has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        desc.param_descs.push_back(*md);
+    }
+    desc.grad_data_type = grad_data_type;
+    desc.param_copy_data_type = param_copy_data_type;
+    desc.beta1 = beta1;
+    desc.beta2 = alg == dnnl_optimizer_sgd_momentum ? 0.f : beta2;
+    desc.epsilon = alg == dnnl_optimizer_sgd_momentum ? 0.f : epsilon;
+    desc.weight_decay = weight_decay;
+
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&desc, nullptr, attr);
+}
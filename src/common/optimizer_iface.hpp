@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_OPTIMIZER_IFACE_HPP
+#define COMMON_OPTIMIZER_IFACE_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+/// Optimizer update rules. With g the gradient, p the parameter, lr the
+/// learning rate, wd the weight decay and t the step number:
+typedef enum {
+    /// m = beta1 * m + (g + wd * p); p -= lr * m.
+    dnnl_optimizer_sgd_momentum,
+    /// Adam with L2 regularization: g += wd * p, then
+    /// m = beta1 * m + (1 - beta1) * g; v = beta2 * v + (1 - beta2) * g^2;
+    /// p -= lr * (m / (1 - beta1^t)) / (sqrt(v / (1 - beta2^t)) + epsilon).
+    dnnl_optimizer_adam,
+    /// Adam with decoupled weight decay: p -= lr * wd * p before the Adam
+    /// update without L2 regularization.
+    dnnl_optimizer_adamw,
+} dnnl_optimizer_alg_t;
+
+/// Maximum number of parameter tensors updated by one optimizer primitive.
+#define DNNL_OPTIMIZER_MAX_TENSORS 256
+
+/// Creates a primitive descriptor for an optimizer step primitive that
+/// updates several parameter tensors, their first moments (m) and, for
+/// Adam, their second moments (v) in one pass over the data.
+///
+/// Arguments, for the i-th tensor:
+/// - #DNNL_ARG_MULTIPLE_SRC + i: the gradient (input).
+/// - #DNNL_ARG_MULTIPLE_DST + 4 * i: the f32 parameter (input/output).
+/// - #DNNL_ARG_MULTIPLE_DST + 4 * i + 1: the f32 first moment
+///   (input/output).
+/// - #DNNL_ARG_MULTIPLE_DST + 4 * i + 2: the f32 second moment
+///   (input/output), Adam only.
+/// - #DNNL_ARG_MULTIPLE_DST + 4 * i + 3: the copy of the updated parameter
+///   (output), when @p param_copy_data_type is not #dnnl_data_type_undef.
+/// - #DNNL_ARG_SRC: a 1D f32 tensor of two elements holding the learning
+///   rate and the step number counted from 1, so that they can change
+///   between steps without creating a new primitive.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg Update rule.
+/// @param n Number of parameter tensors, at most
+///     #DNNL_OPTIMIZER_MAX_TENSORS.
+/// @param param_descs Memory descriptors of the f32 parameters.
+/// @param grad_data_type Data type of the gradients.
+/// @param param_copy_data_type Data type of the copies of the updated
+///     parameters, such as #dnnl_bf16 for mixed precision training, or
+///     #dnnl_data_type_undef.
+/// @param beta1 Decay rate of the first moment, or the momentum of SGD.
+/// @param beta2 Decay rate of the second moment. Ignored by SGD.
+/// @param epsilon Term added to the denominator. Ignored by SGD.
+/// @param weight_decay Weight decay.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_optimizer_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_optimizer_alg_t alg, int n,
+        const_dnnl_memory_desc_t const *param_descs,
+        dnnl_data_type_t grad_data_type, dnnl_data_type_t param_copy_data_type,
+        float beta1, float beta2, float epsilon, float weight_decay,
+        const_dnnl_primitive_attr_t attr);
+
+#endif
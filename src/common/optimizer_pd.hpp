@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_OPTIMIZER_PD_HPP
+#define COMMON_OPTIMIZER_PD_HPP
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/optimizer_iface.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define DNNL_ARG_OPTIMIZER_HYPERPARAMS DNNL_ARG_SRC
+#define DNNL_ARG_OPTIMIZER_GRAD(i) (DNNL_ARG_MULTIPLE_SRC + (i))
+#define DNNL_ARG_OPTIMIZER_PARAM(i) (DNNL_ARG_MULTIPLE_DST + 4 * (i))
+#define DNNL_ARG_OPTIMIZER_M(i) (DNNL_ARG_MULTIPLE_DST + 4 * (i) + 1)
+#define DNNL_ARG_OPTIMIZER_V(i) (DNNL_ARG_MULTIPLE_DST + 4 * (i) + 2)
+#define DNNL_ARG_OPTIMIZER_PARAM_COPY(i) (DNNL_ARG_MULTIPLE_DST + 4 * (i) + 3)
+
+#define VCHECK_OPTIMIZER(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, optimizer, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__)
+
+#define VDISPATCH_OPTIMIZER(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, optimizer, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+// Applies one step of an optimizer to a batch of parameter tensors. The
+// destination arguments of the i-th tensor are the parameter, the first and
+// the second moments and the parameter copy, at DNNL_ARG_MULTIPLE_DST + 4 * i
+// and the next three arguments.
+// NOLINTBEGIN(google-default-arguments)
+struct optimizer_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::optimizer;
+    using base_class = optimizer_pd_t;
+    using hint_class = optimizer_pd_t;
+
+    const optimizer_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    int alg() const { return desc_.alg; }
+    int n_tensors() const { return (int)desc_.param_descs.size(); }
+    bool with_v() const { return desc_.alg != dnnl_optimizer_sgd_momentum; }
+    bool with_param_copy() const {
+        return desc_.param_copy_data_type != data_type::undef;
+    }
+
+    int n_inputs() const override { return 1 + n_tensors(); }
+    int n_outputs() const override {
+        return n_tensors() * (2 + with_v() + with_param_copy());
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_OPTIMIZER_HYPERPARAMS) return arg_usage_t::input;
+        const int src_index = arg - DNNL_ARG_MULTIPLE_SRC;
+        if (src_index >= 0 && src_index < n_tensors())
+            return arg_usage_t::input;
+        const int dst_index = arg - DNNL_ARG_MULTIPLE_DST;
+        if (dst_index >= 0 && dst_index < 4 * n_tensors())
+            return dst_md(dst_index)->ndims > 0 ? arg_usage_t::output
+                                                : arg_usage_t::unused;
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        if (arg == DNNL_ARG_OPTIMIZER_HYPERPARAMS) return src_md(0);
+        const int src_index = arg - DNNL_ARG_MULTIPLE_SRC;
+        if (src_index >= 0 && src_index < n_tensors())
+            return src_md(1 + src_index);
+        const int dst_index = arg - DNNL_ARG_MULTIPLE_DST;
+        if (dst_index >= 0 && dst_index < 4 * n_tensors())
+            return dst_md(dst_index, user_input);
+        return primitive_desc_t::arg_md(arg);
+    }
+
+    // Index 0 is the hyperparameters, index 1 + i the i-th gradient.
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return &hyperparams_md_;
+        if (index > 0 && index <= n_tensors()) return &grad_mds_[index - 1];
+        return &glob_zero_md;
+    }
+
+    // Index 4 * i + j is the j-th destination of the i-th tensor.
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index < 0 || index >= 4 * n_tensors()) return &glob_zero_md;
+        const int i = index / 4;
+        switch (index % 4) {
+            case 0: return &desc_.param_descs[i];
+            case 1: return &state_mds_[i];
+            case 2: return with_v() ? &state_mds_[i] : &glob_zero_md;
+            default:
+                return with_param_copy() ? &param_copy_mds_[i] : &glob_zero_md;
+        }
+    }
+
+protected:
+    optimizer_desc_t desc_;
+
+    memory_desc_t hyperparams_md_;
+    std::vector<memory_desc_t> grad_mds_;
+    std::vector<memory_desc_t> state_mds_;
+    std::vector<memory_desc_t> param_copy_mds_;
+
+    optimizer_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<optimizer_desc_t>(adesc)) {
+        const dims_t hyperparams_dims = {2};
+        memory_desc_init_by_tag(hyperparams_md_, 1, hyperparams_dims,
+                data_type::f32, format_tag::a);
+        // The gradients, the moments and the copies share the layout of the
+        // parameters; the strides are in elements, so only the data type
+        // changes.
+        auto with_dt = [](memory_desc_t md, data_type_t dt) {
+            md.data_type = dt;
+            return md;
+        };
+        for (const auto &md : desc_.param_descs) {
+            grad_mds_.push_back(with_dt(md, desc_.grad_data_type));
+            state_mds_.push_back(md);
+            if (with_param_copy())
+                param_copy_mds_.push_back(
+                        with_dt(md, desc_.param_copy_data_type));
+        }
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <mutex>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "common/dnnl_thread.hpp"
+#include "common/pmu_counters.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace pmu {
+
+namespace {
+
+const char *event_name(int event) {
+    static const char *names[n_events]
+            = {"cycles", "instructions", "l1d_misses", "llc_misses"};
+    return names[event];
+}
+
+#if defined(__linux__)
+struct thread_fds_t {
+    int fds[n_events];
+};
+
+// The counters of threads that exit stay readable and keep their final
+// values, so the registry only grows with the number of threads ever used.
+std::mutex &registry_mutex() {
+    static std::mutex m;
+    return m;
+}
+
+std::vector<thread_fds_t> &registry() {
+    static std::vector<thread_fds_t> r;
+    return r;
+}
+
+int open_counter(uint32_t type, uint64_t config) {
+    perf_event_attr attr {};
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    // Kernel and hypervisor events are excluded so the counters are
+    // available with the default perf_event_paranoid setting
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    const long fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    return static_cast<int>(fd);
+}
+
+uint64_t hw_cache_config(uint64_t cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+void register_thread() {
+    static thread_local bool registered = false;
+    if (registered) return;
+    registered = true;
+
+    thread_fds_t t;
+    t.fds[cycles]
+            = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    t.fds[instructions]
+            = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    t.fds[l1d_misses] = open_counter(
+            PERF_TYPE_HW_CACHE, hw_cache_config(PERF_COUNT_HW_CACHE_L1D));
+    t.fds[llc_misses] = open_counter(
+            PERF_TYPE_HW_CACHE, hw_cache_config(PERF_COUNT_HW_CACHE_LL));
+
+    std::lock_guard<std::mutex> guard(registry_mutex());
+    registry().push_back(t);
+}
+#endif
+
+} // namespace
+
+void register_threads() {
+#if defined(__linux__)
+    register_thread();
+    parallel(0, [](int, int) { register_thread(); });
+#endif
+}
+
+void read_counters(counters_t &counters) {
+    counters = counters_t();
+#if defined(__linux__)
+    std::lock_guard<std::mutex> guard(registry_mutex());
+    for (const auto &t : registry()) {
+        for (int e = 0; e < n_events; e++) {
+            if (t.fds[e] < 0) continue;
+            uint64_t value = 0;
+            if (::read(t.fds[e], &value, sizeof(value))
+                    != static_cast<ssize_t>(sizeof(value)))
+                continue;
+            counters.values[e] += value;
+            counters.valid[e] = true;
+        }
+    }
+#endif
+}
+
+std::string to_string(const counters_t &begin, const counters_t &end) {
+    std::string s;
+    for (int e = 0; e < n_events; e++) {
+        if (!begin.valid[e] || !end.valid[e]) continue;
+        if (!s.empty()) s += " ";
+        s += std::string(event_name(e)) + ":"
+                + std::to_string(end.values[e] - begin.values[e]);
+    }
+    return s.empty() ? std::string("unavailable") : s;
+}
+
+} // namespace pmu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
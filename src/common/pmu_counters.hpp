@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PMU_COUNTERS_HPP
+#define COMMON_PMU_COUNTERS_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace dnnl {
+namespace impl {
+namespace pmu {
+
+// Hardware events counted for ONEDNN_VERBOSE=profile_pmu
+enum event_t {
+    cycles = 0,
+    instructions,
+    l1d_misses,
+    llc_misses,
+    n_events,
+};
+
+// Snapshot of the events summed over all the registered threads. An event
+// is not valid when the kernel or the PMU does not provide it.
+struct counters_t {
+    uint64_t values[n_events] = {};
+    bool valid[n_events] = {};
+};
+
+// Opens the perf_event counters of every thread of the threading runtime and
+// of the calling thread. Threads are registered once, so calling it before
+// every execution only costs an empty parallel section.
+void register_threads();
+
+// Reads the current values of the counters of all the registered threads
+void read_counters(counters_t &counters);
+
+// Formats the difference between two snapshots as "event:value" pairs
+// separated by spaces, e.g. "cycles:1234 instructions:5678"
+std::string to_string(const counters_t &begin, const counters_t &end);
+
+} // namespace pmu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -20,6 +20,7 @@
 #include "common/c_types_map.hpp"
 #include "common/cache_blob.hpp"
 #include "common/cache_hit_types.hpp"
+#include "common/nthr_tuner.hpp"
 #include "common/primitive_desc.hpp"
 #include "common/primitive_exec_types.hpp"
 
@@ -53,6 +54,18 @@ struct primitive_t : public c_compatible {
     primitive_kind_t kind() const { return pd_->kind(); }
     virtual status_t execute(const exec_ctx_t &ctx) const = 0;
 
+    // Returns true if the primitive implements execute_in_team().
+    virtual bool has_team_execute() const { return false; }
+
+    // Executes the share of the thread `ithr` of a team of `nthr` threads.
+    // All the threads of a parallel region call it with the same context,
+    // which lets a caller run several primitives in one parallel region
+    // separated by barriers. The result must be the same as of execute().
+    virtual status_t execute_in_team(
+            const exec_ctx_t &ctx, int ithr, int nthr) const {
+        return status::unimplemented;
+    }
+
     virtual status_t get_cache_blob(
             engine_t *engine, cache_blob_t &cache_blob) const {
         assert(!"unexpected");
@@ -74,6 +87,11 @@ struct primitive_t : public c_compatible {
     cache_state_t creation_cache_state() const {
         return creation_cached_state_;
     }
+    // Approximate memory held by the primitive, including generated code
+    size_t get_footprint() const { return footprint_; }
+    // Selects the number of threads of the executions, see
+    // cpu_nthr_tuning::execute(...)
+    nthr_tuner_t &nthr_tuner() const { return nthr_tuner_; }
 
 protected:
     template <typename impl_type, typename pd_t>
@@ -102,8 +120,10 @@ protected:
         primitive_cache_iface_t::create_func_ptr_t create = [](void *context) {
             auto &c = *static_cast<create_context_t *>(context);
             std::shared_ptr<primitive_t> p = std::make_shared<impl_type>(c.pd);
+            generated_code_scope_t code_scope;
             status_t status
                     = p->init(c.engine, c.use_global_scratchpad, c.cache_blob);
+            p->footprint_ = sizeof(impl_type) + code_scope.size();
             c.cache_status = p->creation_cache_state();
             return primitive_cache_iface_t::result_t {std::move(p), status};
         };
@@ -117,6 +137,8 @@ protected:
     bool use_global_scratchpad_ = false;
     cache_blob_t cache_blob_;
     cache_state_t creation_cached_state_ = cache_state_t::miss;
+    size_t footprint_ = 0;
+    mutable nthr_tuner_t nthr_tuner_;
 
 private:
     primitive_t() = delete;
@@ -277,6 +277,14 @@ status_t post_ops_t::append_binary(alg_kind_t alg,
     return success;
 }
 
+status_t post_ops_t::append_scale_shift(
+        const memory_desc_t *user_scale_shift_desc) {
+    // Both entries are appended or none of them
+    if (len() + 2 > post_ops_limit) return out_of_memory;
+    CHECK(append_binary(alg_kind::binary_mul, user_scale_shift_desc));
+    return append_binary(alg_kind::binary_add, user_scale_shift_desc);
+}
+
 status_t post_ops_t::prepend_binary(alg_kind_t alg,
         const memory_desc_t *user_src1_desc,
         const memory_desc_t *user_src2_desc) {
@@ -596,6 +604,20 @@ status_t dnnl_primitive_attr_set_deterministic(primitive_attr_t *attr, int d) {
     return success;
 }
 
+status_t dnnl_primitive_attr_get_dispatch_hint(
+        const primitive_attr_t *attr, dispatch_goal_t *goal, int *max_threads) {
+    if (any_null(attr)) return invalid_arguments;
+    if (goal) *goal = attr->dispatch_hint_.goal_;
+    if (max_threads) *max_threads = attr->dispatch_hint_.max_threads_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_dispatch_hint(
+        primitive_attr_t *attr, dispatch_goal_t goal, int max_threads) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->dispatch_hint_.set(goal, max_threads);
+}
+
 status_t dnnl_primitive_attr_get_scratchpad_mode(
         const primitive_attr_t *attr, scratchpad_mode_t *scratchpad_mode) {
     if (any_null(attr, scratchpad_mode)) return invalid_arguments;
@@ -893,6 +915,13 @@ status_t dnnl_post_ops_append_binary_v2(post_ops_t *post_ops,
     return post_ops->append_binary(alg_kind, user_src1_desc, user_src2_desc);
 }
 
+status_t dnnl_post_ops_append_scale_shift(
+        post_ops_t *post_ops, const memory_desc_t *user_scale_shift_desc) {
+    if (any_null(post_ops, user_scale_shift_desc)) return invalid_arguments;
+
+    return post_ops->append_scale_shift(user_scale_shift_desc);
+}
+
 status_t dnnl_post_ops_get_params_binary(const post_ops_t *post_ops, int index,
         alg_kind_t *alg_kind, const memory_desc_t **user_src1_desc) {
     CHECK(simple_get_params_check(post_ops, index, primitive_kind::binary));
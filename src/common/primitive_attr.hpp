@@ -263,6 +263,41 @@ private:
     }
 };
 
+// Hint on what a primitive is optimized for and how many threads it gets at
+// execution. It only steers the heuristics of the implementations.
+struct dispatch_hint_t : public c_compatible {
+    dispatch_hint_t() = default;
+
+    bool has_default_values() const {
+        return goal_ == dispatch_goal::any && max_threads_ == 0;
+    }
+
+    bool operator==(const dispatch_hint_t &rhs) const {
+        return goal_ == rhs.goal_ && max_threads_ == rhs.max_threads_;
+    }
+
+    status_t set(dispatch_goal_t goal, int max_threads) {
+        if (!utils::one_of(goal, dispatch_goal::any, dispatch_goal::latency,
+                    dispatch_goal::throughput)
+                || max_threads < 0)
+            return status::invalid_arguments;
+        goal_ = goal;
+        max_threads_ = max_threads;
+        return status::success;
+    }
+
+    // Returns the number of threads to plan for out of `nthr` available.
+    int get_nthr(int nthr) const {
+        return max_threads_ > 0 ? nstl::min(nthr, max_threads_) : nthr;
+    }
+
+    bool is_latency() const { return goal_ == dispatch_goal::latency; }
+    bool is_throughput() const { return goal_ == dispatch_goal::throughput; }
+
+    dispatch_goal_t goal_ = dispatch_goal::any;
+    int max_threads_ = 0;
+};
+
 struct serialization_stream_t;
 
 struct primitive_attr_item_t {
@@ -459,6 +494,8 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             const dnnl::impl::memory_desc_t *user_src1_desc,
             const dnnl::impl::memory_desc_t *user_src2_desc = nullptr);
     dnnl::impl::status_t append_prelu(int mask);
+    dnnl::impl::status_t append_scale_shift(
+            const dnnl::impl::memory_desc_t *user_scale_shift_desc);
 
     dnnl::impl::status_t prepend_binary(dnnl::impl::alg_kind_t alg,
             const dnnl::impl::memory_desc_t *user_src1_desc,
@@ -579,6 +616,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         fpmath_ = other.fpmath_;
         acc_mode_ = other.acc_mode_;
         deterministic_ = other.deterministic_;
+        dispatch_hint_ = other.dispatch_hint_;
         post_ops_ = other.post_ops_;
         rnn_data_qparams_ = other.rnn_data_qparams_;
         CHECK(rnn_weights_qparams_.copy_from(other.rnn_weights_qparams_));
@@ -651,7 +689,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
 
     /** Returns true if the attributes have default values.
      *
-     * @note The scratchpad_mode_ is not take into account */
+     * @note The scratchpad_mode_ and dispatch_hint_ are not taken into
+     * account */
     bool has_default_values(skip_mask_t mask = skip_mask_t::none,
             dnnl::impl::data_type_t dst_dt = dnnl_data_type_undef) const;
 
@@ -662,6 +701,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
                 && fpmath_ == rhs.fpmath_ && acc_mode_ == rhs.acc_mode_
                 && deterministic_ == rhs.deterministic_
+                && dispatch_hint_ == rhs.dispatch_hint_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
                 && precomputed_reductions_ == rhs.precomputed_reductions_
                 && post_ops_ == rhs.post_ops_
@@ -746,6 +786,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::fpmath_t fpmath_;
     dnnl::impl::accumulation_mode_t acc_mode_;
     bool deterministic_;
+    dnnl::impl::dispatch_hint_t dispatch_hint_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
     dnnl::impl::rnn_create_time_scales_t rnn_weights_qparams_;
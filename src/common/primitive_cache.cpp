@@ -59,6 +59,9 @@ private:
         key.op_desc_ = pd->op_desc();
         key.attr_ = pd->attr();
     }
+    static size_t get_footprint(const primitive_t &p) {
+        return p.get_footprint();
+    }
     // Used for testing.
     friend size_t set_primitive_cache_capacity_without_clearing(
             size_t capacity);
@@ -66,7 +69,13 @@ private:
         cache_.set_capacity_without_clearing(capacity);
     }
 
-    utils::lru_cache_t<key_t, primitive_t, result_t, update_key> cache_;
+    utils::lru_cache_t<key_t, primitive_t, result_t, update_key,
+            get_footprint>
+            cache_;
+
+    friend size_t get_primitive_cache_capacity_in_bytes();
+    friend status_t set_primitive_cache_capacity_in_bytes(size_t capacity);
+    friend size_t get_primitive_cache_footprint();
 };
 
 primitive_cache_t &global_primitive_cache() {
@@ -84,6 +93,39 @@ primitive_cache_iface_t primitive_cache() {
     return global_primitive_cache();
 }
 
+namespace {
+thread_local size_t generated_code_size = 0;
+} // namespace
+
+void add_generated_code_size(size_t size) {
+    generated_code_size += size;
+}
+
+generated_code_scope_t::generated_code_scope_t()
+    : outer_size_(generated_code_size) {
+    generated_code_size = 0;
+}
+
+generated_code_scope_t::~generated_code_scope_t() {
+    generated_code_size = outer_size_;
+}
+
+size_t generated_code_scope_t::size() const {
+    return generated_code_size;
+}
+
+size_t get_primitive_cache_capacity_in_bytes() {
+    return global_primitive_cache().cache_.get_capacity_in_bytes();
+}
+
+status_t set_primitive_cache_capacity_in_bytes(size_t capacity) {
+    return global_primitive_cache().cache_.set_capacity_in_bytes(capacity);
+}
+
+size_t get_primitive_cache_footprint() {
+    return global_primitive_cache().cache_.get_size_in_bytes();
+}
+
 size_t set_primitive_cache_capacity_without_clearing(size_t capacity) {
     size_t old_capacity = global_primitive_cache().get_capacity();
     global_primitive_cache().set_capacity_without_clearing((int)capacity);
@@ -146,6 +188,34 @@ dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
     return dnnl::impl::set_primitive_cache_capacity(capacity, capacity);
 }
 
+dnnl::impl::status_t dnnl_get_primitive_cache_capacity_in_bytes(
+        size_t *capacity) {
+    if (capacity == nullptr) return dnnl::impl::status::invalid_arguments;
+    *capacity = 0;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    *capacity = dnnl::impl::get_primitive_cache_capacity_in_bytes();
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_set_primitive_cache_capacity_in_bytes(
+        size_t capacity) {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    return dnnl::impl::set_primitive_cache_capacity_in_bytes(capacity);
+#else
+    return dnnl::impl::status::success;
+#endif
+}
+
+dnnl::impl::status_t dnnl_get_primitive_cache_footprint(size_t *footprint) {
+    if (footprint == nullptr) return dnnl::impl::status::invalid_arguments;
+    *footprint = 0;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    *footprint = dnnl::impl::get_primitive_cache_footprint();
+#endif
+    return dnnl::impl::status::success;
+}
+
 // Undocumented API declared in primitive_cache_test_api.hpp
 using namespace dnnl;
 using namespace dnnl::impl;
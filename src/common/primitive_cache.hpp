@@ -62,6 +62,24 @@ primitive_cache_iface_t primitive_cache();
 status_t set_primitive_cache_capacity(
         int primitive_capacity, int kernel_capacity);
 
+// Accounts code generated by the calling thread.
+void add_generated_code_size(size_t size);
+
+// Measures the code generated by the calling thread while the scope is alive,
+// which is the code owned by the primitive being created. The creation of a
+// nested primitive opens its own scope, so the code of the nested primitive
+// is only accounted in its own cache entry.
+struct generated_code_scope_t {
+    generated_code_scope_t();
+    ~generated_code_scope_t();
+    size_t size() const;
+
+private:
+    size_t outer_size_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(generated_code_scope_t);
+};
+
 } // namespace impl
 } // namespace dnnl
 #endif
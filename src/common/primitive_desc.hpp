@@ -17,6 +17,7 @@
 #ifndef COMMON_PRIMITIVE_DESC_HPP
 #define COMMON_PRIMITIVE_DESC_HPP
 
+#include <memory>
 #include <typeindex>
 
 #include "oneapi/dnnl/dnnl.h"
@@ -25,6 +26,7 @@
 #include "cache_blob.hpp"
 #include "cache_blob_id.hpp"
 #include "cache_hit_types.hpp"
+#include "dispatch_report.hpp"
 #include "memory_tracking.hpp"
 #include "nstl.hpp"
 #include "opdesc.hpp"
@@ -50,6 +52,7 @@ static int po_inputs(const post_ops_t &post_ops, const primitive_kind_t kind) {
 }
 
 struct impl_list_item_t;
+struct primitive_desc_iterator_t;
 struct primitive_t;
 // Primitive descriptor implementation
 // NOLINTBEGIN(google-default-arguments)
@@ -491,6 +494,13 @@ struct primitive_desc_t : public c_compatible {
     int pd_iterator_offset() const { return pd_iterator_offset_; }
     int skip_idx() const { return skip_idx_; }
 
+    // Returns the implementations skipped by the iterator that created this
+    // primitive descriptor before reaching it, or nullptr if the descriptor
+    // was not created by an iterator.
+    const dispatch_report_t *dispatch_report() const {
+        return dispatch_report_.get();
+    }
+
     bool has_large_buffers() const {
         auto is_large = [](const memory_desc_t *md) {
             return memory_desc_wrapper(md).size() > UINT32_MAX;
@@ -526,8 +536,14 @@ protected:
 
     memory_tracking::registry_t scratchpad_registry_;
 
+    std::shared_ptr<const dispatch_report_t> dispatch_report_;
+
     void init_pd_iterator_offset(int offset) { pd_iterator_offset_ = offset; }
     void init_skip_idx(int skip_idx) { skip_idx_ = skip_idx; }
+    void init_dispatch_report(
+            const std::shared_ptr<const dispatch_report_t> &report) {
+        dispatch_report_ = report;
+    }
 
     /** compares ws between fwd_pd and this (make sense to use for bwd_pd)
      * Expectation: this already set workspace, and this workspace should
@@ -566,12 +582,17 @@ protected:
         auto _pd = make_unique_pd<pd_t>(adesc, attr, hint);
         if (_pd == nullptr) return out_of_memory;
         if (!_pd->is_initialized()) return out_of_memory;
-        CHECK(_pd->init(engine));
-        CHECK(_pd->init_scratchpad_md());
+        status_t status = _pd->init(engine);
+        if (status == success) status = _pd->init_scratchpad_md();
+        if (status != success) {
+            dispatch_report_add(_pd->name(), status);
+            return status;
+        }
         return safe_ptr_assign(*pd, _pd.release());
     }
 
     friend struct dnnl::impl::impl_list_item_t;
+    friend struct dnnl::impl::primitive_desc_iterator_t;
 };
 // NOLINTEND(google-default-arguments)
 
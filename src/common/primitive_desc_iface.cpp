@@ -14,15 +14,23 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <string>
+
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
 
+#include "dispatch_report.hpp"
 #include "engine.hpp"
+#include "primitive_hashing.hpp"
 #include "primitive_desc_iface.hpp"
 #include "primitive_desc_iterator.hpp"
 #include "primitive_iface.hpp"
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/platform.hpp"
+#endif
+
 using namespace dnnl::impl;
 using namespace dnnl::impl::status;
 
@@ -39,9 +47,10 @@ status_t primitive_desc_create(primitive_desc_iface_t **primitive_desc_iface,
 
     const bool known_primitive_kind = utils::one_of(op_desc->primitive_kind,
             batch_normalization, binary, convolution, deconvolution, eltwise,
-            gated_mlp, gemm, group_normalization, inner_product,
-            layer_normalization, lrn, matmul, pooling, prelu, reduction,
-            resampling, rnn, sdpa, shuffle, softmax);
+            embedding_bag, gated_mlp, gemm, group_normalization,
+            inner_product, layer_normalization, lrn, matmul, optimizer,
+            pooling, prelu, reduction, resampling, rnn, sdpa, shuffle, softmax,
+            topk);
     if (!known_primitive_kind) return invalid_arguments;
 
     auto pd_iface = utils::make_unique<primitive_desc_iface_t>(engine, op_desc,
@@ -146,10 +155,83 @@ dnnl::impl::engine_t *dnnl_primitive_desc::scratchpad_engine() const {
     return engine();
 }
 
+// The fingerprint of the weights layout of a primitive descriptor. Besides the
+// memory descriptor, it covers what the layout semantics may depend on: the
+// implementation, the library version and the device.
+static status_t get_weights_fingerprint(const primitive_desc_t *pd,
+        engine_t *engine, int idx, dim_t *fingerprint) {
+    const memory_desc_t *md = pd->weights_md(idx);
+    if (!md || types::is_zero_md(md)) return invalid_arguments;
+
+    size_t seed = primitive_hashing::get_md_hash(*md);
+    seed = hash_combine(seed, std::hash<std::string> {}(pd->name()));
+
+    const auto *version = dnnl_version();
+    seed = hash_combine(seed, version->major);
+    seed = hash_combine(seed, version->minor);
+    seed = hash_combine(seed, version->patch);
+    seed = hash_combine(seed, std::hash<std::string> {}(version->hash));
+
+    seed = hash_combine(seed, static_cast<size_t>(engine->kind()));
+    seed = hash_combine(seed, static_cast<size_t>(engine->runtime_kind()));
+    if (engine->kind() == engine_kind::cpu) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        seed = hash_combine(seed,
+                std::hash<std::string> {}(cpu::platform::get_isa_info()));
+#endif
+    } else {
+        serialization_stream_t sstream;
+        CHECK(engine->serialize_device(sstream));
+        for (uint8_t byte : sstream.get_data())
+            seed = hash_combine(seed, byte);
+    }
+
+    *fingerprint = static_cast<dim_t>(seed);
+    return success;
+}
+
+// Answers the queries about the implementations skipped before the one of a
+// primitive descriptor.
+static status_t query_skipped_impls(
+        const primitive_desc_t *pd, query_t what, int idx, void *result) {
+    const dispatch_report_t *report = pd->dispatch_report();
+    const int n = report ? static_cast<int>(report->entries().size()) : 0;
+    if (what == query::skipped_impls_s32) {
+        *(int *)result = n;
+        return success;
+    }
+    if (idx < 0 || idx >= n) return invalid_arguments;
+
+    const auto &entry = report->entries()[idx];
+    switch (what) {
+        case query::skipped_impl_info_str:
+            *(const char **)result = entry.impl_name.c_str();
+            break;
+        case query::skipped_impl_status:
+            *(status_t *)result = entry.status;
+            break;
+        case query::skipped_impl_reason_str:
+            *(const char **)result = entry.reason.c_str();
+            break;
+        default: return unimplemented;
+    }
+    return success;
+}
+
 status_t dnnl_primitive_desc::query(query_t what, int idx, void *result) const {
     auto status = status::success;
     switch (what) {
         case query::engine: *(engine_t **)result = engine(); break;
+        case query::weights_fingerprint_s64:
+            status = get_weights_fingerprint(
+                    impl().get(), engine(), idx, (dim_t *)result);
+            break;
+        case query::skipped_impls_s32:
+        case query::skipped_impl_info_str:
+        case query::skipped_impl_status:
+        case query::skipped_impl_reason_str:
+            status = query_skipped_impls(impl().get(), what, idx, result);
+            break;
         case query::cache_blob_id_size_s64:
             *(dim_t *)result
                     = (dim_t)impl()->get_cache_blob_id(engine()).size();
@@ -20,6 +20,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dispatch_report.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
 #include "primitive_attr.hpp"
@@ -80,12 +81,19 @@ struct primitive_desc_iterator_t : public c_compatible {
         pd_ = primitive_cache().get_pd(key);
         if (pd_) { return *this; }
 
+        // Implementations skipped on the way are recorded into a report
+        // that is attached to the returned primitive descriptor, so the
+        // report survives primitive cache hits.
+        auto report = std::make_shared<dispatch_report_t>();
+        dispatch_report_scope_t report_scope(report.get());
         while (++idx_ != last_idx_) {
             if (idx_ == skip_idx_) continue;
+            report->begin_impl();
             primitive_desc_t *candidate_pd = nullptr;
             auto s = impl_list_[idx_](&candidate_pd, op_desc_.get(), &attr_,
                     engine_, hint_fwd_pd_, offset_, skip_idx_);
             if (s == status::success) {
+                candidate_pd->init_dispatch_report(report);
                 pd_.reset(candidate_pd);
                 break;
             }
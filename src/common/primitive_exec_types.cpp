@@ -126,6 +126,10 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
                         ;
                 break;
             case primitive_desc_t::arg_usage_t::output:
+                VCONDCHECK(primitive, exec, check, primitive,
+                        !mem->is_read_only(), invalid_arguments,
+                        "read-only memory is passed as output argument %d",
+                        arg);
                 args[arg] = {mem, false};
                 n_outputs++;
                 extra_outputs += (arg == DNNL_ARG_SCRATCHPAD)
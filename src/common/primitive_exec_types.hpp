@@ -154,6 +154,10 @@ struct exec_ctx_t {
     stream_t *stream() const;
     const exec_args_t &args() const;
 
+    // Returns true if the context is referenced by other copies, e.g. by the
+    // tasks of an asynchronous execution that is still in progress.
+    bool is_shared() const { return impl_.use_count() > 1; }
+
     const std::unordered_map<void *, void *> &get_memory_mapping() const;
     const resource_mapper_t *get_resource_mapper() const;
     // Tip: when a pointer to `grantor` is needed, take an address of the
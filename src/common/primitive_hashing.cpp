@@ -83,6 +83,7 @@ bool key_t::operator==(const key_t &rhs) const {
             break;
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gated_mlp)
             CASE(gemm)
             CASE(group_normalization)
@@ -90,6 +91,7 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(layer_normalization)
             CASE(lrn)
             CASE(matmul)
+            CASE(optimizer)
             CASE(pooling)
             CASE(prelu)
             CASE(reduction)
@@ -100,6 +102,7 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
+            CASE(topk)
             CASE(zero_pad)
             default: assert(!"unknown primitive kind");
         }
@@ -237,6 +240,9 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     seed = hash_combine(seed, static_cast<size_t>(attr.deterministic_));
     // acc_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.acc_mode_));
+    // dispatch_hint
+    seed = hash_combine(seed, static_cast<size_t>(attr.dispatch_hint_.goal_));
+    seed = hash_combine(seed, attr.dispatch_hint_.max_threads_);
     // rounding_mode
     if (!attr.rounding_mode_.has_default_values()) {
         for (const auto &e : attr.rounding_mode_.rounding_modes_map_) {
@@ -710,6 +716,11 @@ size_t get_desc_hash(const softmax_desc_t &desc) {
     seed = hash_combine(seed, get_md_hash(desc.diff_dst_desc));
     // Axis
     seed = hash_combine(seed, desc.softmax_axis);
+    // Attention inputs
+    seed = hash_combine(seed, get_md_hash(desc.scale_desc));
+    seed = hash_combine(seed, desc.invert_scale);
+    seed = hash_combine(seed, get_md_hash(desc.attn_mask_desc));
+    seed = hash_combine(seed, desc.attn_mask_type);
     // Combined hash for softmax desc
     return seed;
 }
@@ -758,6 +769,9 @@ size_t get_desc_hash(const sdpa_desc_t &desc) {
     seed = hash_combine(seed, get_md_hash(desc.diff_v_desc));
     seed = hash_combine(seed, get_md_hash(desc.attn_mask_desc));
     seed = hash_combine(seed, get_md_hash(desc.scale_desc));
+    seed = hash_combine(seed, get_md_hash(desc.kv_page_table_desc));
+    seed = hash_combine(seed, get_md_hash(desc.q_seq_offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.kv_seq_offsets_desc));
     // Scale type
     seed = hash_combine(seed, static_cast<size_t>(desc.kq_acc_dt));
     seed = hash_combine(seed, static_cast<size_t>(desc.vs_acc_dt));
@@ -785,6 +799,55 @@ size_t get_desc_hash(const gated_mlp_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const embedding_bag_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for embedding_bag desc
+    return seed;
+}
+
+size_t get_desc_hash(const topk_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    // Softmax
+    seed = hash_combine(seed, desc.with_softmax);
+    seed = hash_combine(seed, desc.temperature);
+    // Combined hash for topk desc
+    return seed;
+}
+
+size_t get_desc_hash(const optimizer_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, desc.alg);
+    // Array of mds
+    seed = get_array_hash(
+            seed, desc.param_descs.data(), (dim_t)desc.param_descs.size());
+    // Data types
+    seed = hash_combine(seed, static_cast<size_t>(desc.grad_data_type));
+    seed = hash_combine(seed, static_cast<size_t>(desc.param_copy_data_type));
+    // Hyperparameters
+    seed = hash_combine(seed, desc.beta1);
+    seed = hash_combine(seed, desc.beta2);
+    seed = hash_combine(seed, desc.epsilon);
+    seed = hash_combine(seed, desc.weight_decay);
+    // Combined hash for optimizer desc
+    return seed;
+}
+
 } // namespace primitive_hashing
 } // namespace impl
 } // namespace dnnl
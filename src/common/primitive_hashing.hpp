@@ -74,12 +74,14 @@ size_t get_desc_hash(const binary_desc_t &desc);
 size_t get_desc_hash(const convolution_desc_t &desc);
 size_t get_desc_hash(const eltwise_desc_t &desc);
 size_t get_desc_hash(const gated_mlp_desc_t &desc);
+size_t get_desc_hash(const embedding_bag_desc_t &desc);
 size_t get_desc_hash(const gemm_desc_t &desc);
 size_t get_desc_hash(const group_normalization_desc_t &desc);
 size_t get_desc_hash(const inner_product_desc_t &desc);
 size_t get_desc_hash(const layer_normalization_desc_t &desc);
 size_t get_desc_hash(const lrn_desc_t &desc);
 size_t get_desc_hash(const matmul_desc_t &desc);
+size_t get_desc_hash(const optimizer_desc_t &desc);
 size_t get_desc_hash(const pooling_desc_t &desc);
 size_t get_desc_hash(const prelu_desc_t &desc);
 size_t get_desc_hash(const reduction_desc_t &desc);
@@ -90,6 +92,7 @@ size_t get_desc_hash(const sdpa_desc_t &desc);
 size_t get_desc_hash(const shuffle_desc_t &desc);
 size_t get_desc_hash(const softmax_desc_t &desc);
 size_t get_desc_hash(const sum_desc_t &desc);
+size_t get_desc_hash(const topk_desc_t &desc);
 size_t get_desc_hash(const zero_pad_desc_t &desc);
 
 template <typename T>
@@ -171,6 +174,7 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(convolution)
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gated_mlp)
             CASE(gemm)
             CASE(group_normalization)
@@ -178,6 +182,7 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(layer_normalization)
             CASE(lrn)
             CASE(matmul)
+            CASE(optimizer)
             CASE(pooling)
             CASE(prelu)
             CASE(reduction)
@@ -188,6 +193,7 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
+            CASE(topk)
             CASE(zero_pad)
             default: assert(!"unknown primitive_kind");
         }
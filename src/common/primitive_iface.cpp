@@ -14,12 +14,15 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <string>
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 
 #include "ittnotify.hpp"
+#include "pmu_counters.hpp"
 
 #include "cache_hit_types.hpp"
 #include "primitive.hpp"
@@ -155,11 +158,22 @@ status_t primitive_execute(
         block_on_wait = !is_async_cpu;
 #endif
         if (block_on_wait) stream->wait();
+        // Hardware counters are meaningful only for synchronous CPU
+        // executions that run on the threads of the calling process
+        const bool with_pmu = block_on_wait
+                && stream->engine()->kind() == engine_kind::cpu
+                && get_verbose(verbose_t::profile_pmu);
+        pmu::counters_t pmu_begin, pmu_end;
+        if (with_pmu) {
+            pmu::register_threads();
+            pmu::read_counters(pmu_begin);
+        }
         double start_ms = get_msec();
         status = stream->enqueue_primitive(primitive_iface, ctx);
         if (block_on_wait) stream->wait();
 
         double duration_ms = get_msec() - start_ms;
+        if (with_pmu) pmu::read_counters(pmu_end);
         if (pd->impl()->has_runtime_dims_or_strides()) {
             // Take out mds from `ctx` here to avoid primitive_desc dependency
             // on `exec_ctx_t` type.
@@ -177,9 +191,17 @@ status_t primitive_execute(
                     src_md, wei_md, bia_md, dst_md);
             VPROF(start_ms, primitive, exec, VERBOSE_profile, info.c_str(),
                     duration_ms);
+            if (with_pmu)
+                VFORMAT(start_ms, verbose_t::profile_pmu, primitive, exec,
+                        VERBOSE_pmu, "%s,%s", info.c_str(),
+                        pmu::to_string(pmu_begin, pmu_end).c_str());
         } else {
             VPROF(start_ms, primitive, exec, VERBOSE_profile, pd->info(),
                     duration_ms);
+            if (with_pmu)
+                VFORMAT(start_ms, verbose_t::profile_pmu, primitive, exec,
+                        VERBOSE_pmu, "%s,%s", pd->info(),
+                        pmu::to_string(pmu_begin, pmu_end).c_str());
         }
     } else {
         status = stream->enqueue_primitive(primitive_iface, ctx);
@@ -264,6 +286,293 @@ status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
     return status;
 }
 
+namespace {
+
+// Returns whether the items of a batch can run concurrently in one parallel
+// region, each on a single thread. Nested parallel regions are only
+// guaranteed to run on a single thread with OpenMP. The items bypass the
+// verbose and ITT instrumentation, so this is disabled when those are on.
+bool can_run_batch_in_parallel(
+        const primitive_iface_t *primitive_iface, stream_t *stream) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    if (stream->engine()->kind() != engine_kind::cpu) return false;
+    if (get_verbose(verbose_t::exec_profile)
+            || itt::get_itt(itt::__itt_task_level_low))
+        return false;
+    return !primitive_iface->has_shared_scratchpad();
+#else
+    UNUSED(primitive_iface);
+    UNUSED(stream);
+    return false;
+#endif
+}
+
+} // namespace
+
+status_t dnnl_primitive_execute_batch(const primitive_iface_t *primitive_iface,
+        stream_t *stream, int nbatch, const int *nargs,
+        const dnnl_exec_arg_t *const *c_args) {
+    bool ok = true && !utils::any_null(primitive_iface, stream)
+            && primitive_iface->engine() == stream->engine() && nbatch >= 0
+            && IMPLICATION(nbatch > 0, !utils::any_null(nargs, c_args));
+    if (!ok) return invalid_arguments;
+
+    std::vector<exec_args_t> batch_args(nbatch);
+    for (int i = 0; i < nbatch; i++) {
+        if (nargs[i] < 0 || (nargs[i] > 0 && c_args[i] == nullptr))
+            return invalid_arguments;
+        CHECK(cvt_primitive_args(primitive_iface->pd()->impl().get(),
+                nargs[i], c_args[i], batch_args[i]));
+    }
+
+    status_t status = success;
+    stream->before_exec_hook();
+    if (nbatch > 1 && can_run_batch_in_parallel(primitive_iface, stream)) {
+        // Each item is too small to be worth splitting, so the items are
+        // distributed across the threads instead.
+        std::atomic<int> batch_status(success);
+        parallel(nstl::min(nbatch, dnnl_get_current_num_threads()),
+                [&](int ithr, int nthr) {
+                    int start {0}, end {0};
+                    balance211(nbatch, nthr, ithr, start, end);
+                    for (int i = start; i < end; i++) {
+                        if (batch_status.load() != success) break;
+                        exec_ctx_t ctx(stream, exec_args_t(batch_args[i]));
+                        status_t st = primitive_iface->execute(ctx);
+                        if (st != success) batch_status.store(st);
+                    }
+                });
+        status = static_cast<status_t>(batch_status.load());
+        if (msan_enabled)
+            for (const auto &args : batch_args)
+                unpoison_outputs(args);
+    } else {
+        for (int i = 0; i < nbatch && status == success; i++) {
+            exec_ctx_t ctx(stream, std::move(batch_args[i]));
+            status = dnnl::impl::primitive_execute(primitive_iface, ctx);
+        }
+    }
+    stream->after_exec_hook();
+
+    return status;
+}
+
+// A primitive execution with the arguments converted once. The execution
+// context is reused across the executions unless a previous asynchronous
+// execution still holds it.
+struct dnnl_prepared_exec : public c_compatible {
+    dnnl_prepared_exec(const primitive_iface_t *primitive_iface,
+            stream_t *stream, const exec_args_t &args,
+            std::vector<memory_t *> &&slots)
+        : primitive_iface_(const_cast<primitive_iface_t *>(primitive_iface))
+        , stream_(stream)
+        , args_(args)
+        , slots_(std::move(slots))
+        , ctx_(stream, exec_args_t(args)) {
+        primitive_iface_->retain();
+    }
+
+    ~dnnl_prepared_exec() { primitive_iface_->release(); }
+
+    status_t execute(int nhandles, void *const *handles) {
+        CHECK(set_data_handles(nhandles, handles));
+
+        stream_->before_exec_hook();
+        status_t status = run();
+        stream_->after_exec_hook();
+        return status;
+    }
+
+    // Executes the primitive without the stream hooks, which the caller is
+    // responsible for.
+    status_t run() {
+        if (ctx_.is_shared()) ctx_ = exec_ctx_t(stream_, exec_args_t(args_));
+        return dnnl::impl::primitive_execute(primitive_iface_, ctx_);
+    }
+
+    bool has_team_execute() const {
+        return primitive_iface_->has_team_execute();
+    }
+
+    // Sets up the context for run_in_team(). See
+    // dnnl_primitive::prepare_exec_ctx().
+    status_t prepare_team(std::unique_ptr<scratchpad_t> &pooled_scratchpad) {
+        if (ctx_.is_shared()) ctx_ = exec_ctx_t(stream_, exec_args_t(args_));
+        return primitive_iface_->prepare_exec_ctx(ctx_, pooled_scratchpad);
+    }
+
+    status_t run_in_team(int ithr, int nthr) const {
+        return primitive_iface_->execute_in_team(ctx_, ithr, nthr);
+    }
+
+    const exec_args_t &args() const { return args_; }
+
+private:
+    primitive_iface_t *primitive_iface_;
+    stream_t *stream_;
+    exec_args_t args_;
+    // The memory objects in the order the arguments were passed
+    std::vector<memory_t *> slots_;
+    exec_ctx_t ctx_;
+
+    status_t set_data_handles(int nhandles, void *const *handles) {
+        if (nhandles > (int)slots_.size()) return invalid_arguments;
+        for (int i = 0; i < nhandles; i++) {
+            if (!handles[i]) continue;
+            memory_t *mem = slots_[i];
+            const bool can_set_handle = mem && !mem->is_read_only()
+                    && !memory_desc_wrapper(mem->md()).is_host_scalar_desc();
+            if (!can_set_handle) return invalid_arguments;
+            CHECK(mem->set_data_handle(handles[i]));
+        }
+        return success;
+    }
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_prepared_exec);
+};
+
+status_t dnnl_prepared_exec_create(dnnl_prepared_exec_t *prepared_exec,
+        const primitive_iface_t *primitive_iface, stream_t *stream, int nargs,
+        const dnnl_exec_arg_t *c_args) {
+    bool ok = true && !utils::any_null(prepared_exec, primitive_iface, stream)
+            && primitive_iface->engine() == stream->engine()
+            && nargs >= 0 && IMPLICATION(nargs > 0, c_args != nullptr);
+    if (!ok) return invalid_arguments;
+
+    exec_args_t args;
+    CHECK(cvt_primitive_args(
+            primitive_iface->pd()->impl().get(), nargs, c_args, args));
+
+    std::vector<memory_t *> slots(nargs);
+    for (int i = 0; i < nargs; i++)
+        slots[i] = c_args[i].memory;
+
+    return safe_ptr_assign(*prepared_exec,
+            new dnnl_prepared_exec(
+                    primitive_iface, stream, args, std::move(slots)));
+}
+
+status_t dnnl_prepared_exec_execute(dnnl_prepared_exec_t prepared_exec,
+        int nhandles, void *const *handles) {
+    bool ok = prepared_exec != nullptr && nhandles >= 0
+            && IMPLICATION(nhandles > 0, handles != nullptr);
+    if (!ok) return invalid_arguments;
+    return prepared_exec->execute(nhandles, handles);
+}
+
+status_t dnnl_prepared_exec_destroy(dnnl_prepared_exec_t prepared_exec) {
+    delete prepared_exec;
+    return success;
+}
+
+// A sequence of prepared executions on one stream. The stream hooks, which
+// activate the threadpool of a CPU stream, run once per replay instead of
+// once per primitive.
+struct dnnl_command_list : public c_compatible {
+    dnnl_command_list(stream_t *stream) : stream_(stream) {}
+
+    status_t append(const primitive_iface_t *primitive_iface, int nargs,
+            const dnnl_exec_arg_t *c_args) {
+        dnnl_prepared_exec_t prepared_exec = nullptr;
+        CHECK(dnnl_prepared_exec_create(
+                &prepared_exec, primitive_iface, stream_, nargs, c_args));
+        cmds_.emplace_back(prepared_exec);
+        return success;
+    }
+
+    status_t execute() {
+        status_t status = success;
+        stream_->before_exec_hook();
+        for (size_t i = 0; i < cmds_.size() && status == success;) {
+            const size_t n_team = team_length(i);
+            if (n_team > 1) {
+                status = execute_in_team(i, i + n_team);
+                i += n_team;
+            } else {
+                status = cmds_[i++]->run();
+            }
+        }
+        stream_->after_exec_hook();
+        return status;
+    }
+
+private:
+    stream_t *stream_;
+    std::vector<std::unique_ptr<dnnl_prepared_exec>> cmds_;
+
+    // Returns the number of consecutive commands starting from `start` that
+    // can run in one parallel region. The team execution requires a barrier
+    // between the threads, so it is only used with OpenMP. It bypasses the
+    // verbose and ITT instrumentation of the executions, so it is also
+    // disabled when those are on.
+    size_t team_length(size_t start) const {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+        if (stream_->engine()->kind() != engine_kind::cpu) return 0;
+        if (get_verbose(verbose_t::exec_profile)
+                || itt::get_itt(itt::__itt_task_level_low))
+            return 0;
+        size_t n = 0;
+        while (start + n < cmds_.size() && cmds_[start + n]->has_team_execute())
+            n++;
+        return n;
+#else
+        UNUSED(start);
+        return 0;
+#endif
+    }
+
+    // Executes the commands [start, end) in one parallel region with a
+    // barrier after each of them.
+    status_t execute_in_team(size_t start, size_t end) {
+        std::vector<std::unique_ptr<scratchpad_t>> pooled_scratchpads(
+                end - start);
+        for (size_t i = start; i < end; i++)
+            CHECK(cmds_[i]->prepare_team(pooled_scratchpads[i - start]));
+
+        std::atomic<int> status(success);
+        parallel(0, [&](int ithr, int nthr) {
+            for (size_t i = start; i < end; i++) {
+                // All the threads take the same branch, as the status is only
+                // changed before a barrier.
+                if (status.load() != success) break;
+                status_t st = cmds_[i]->run_in_team(ithr, nthr);
+                if (st != success) status.store(st);
+                dnnl_thr_barrier();
+            }
+        });
+
+        if (msan_enabled)
+            for (size_t i = start; i < end; i++)
+                unpoison_outputs(cmds_[i]->args());
+        return static_cast<status_t>(status.load());
+    }
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_command_list);
+};
+
+status_t dnnl_command_list_create(
+        dnnl_command_list_t *command_list, stream_t *stream) {
+    if (utils::any_null(command_list, stream)) return invalid_arguments;
+    return safe_ptr_assign(*command_list, new dnnl_command_list(stream));
+}
+
+status_t dnnl_command_list_append(dnnl_command_list_t command_list,
+        const primitive_iface_t *primitive_iface, int nargs,
+        const dnnl_exec_arg_t *args) {
+    if (command_list == nullptr) return invalid_arguments;
+    return command_list->append(primitive_iface, nargs, args);
+}
+
+status_t dnnl_command_list_execute(dnnl_command_list_t command_list) {
+    if (command_list == nullptr) return invalid_arguments;
+    return command_list->execute();
+}
+
+status_t dnnl_command_list_destroy(dnnl_command_list_t command_list) {
+    delete command_list;
+    return success;
+}
+
 status_t dnnl_primitive_get_primitive_desc(
         const primitive_iface_t *primitive_iface,
         const primitive_desc_iface_t **primitive_desc_iface) {
@@ -334,6 +643,12 @@ status_t dnnl_primitive::init() {
         bool use_global_scratchpad = scratchpad_debug::is_protect_scratchpad()
                 ? false
                 : primitive_->use_global_scratchpad();
+        // the scratchpad is leased from the pool for each execution
+        if (use_global_scratchpad && use_scratchpad_pool(pd_->engine())) {
+            pooled_scratchpad_size_ = scratchpad_size;
+            return primitive_->create_resource(
+                    pd()->engine(), resource_mapper_);
+        }
         auto *scratchpad_ptr = create_scratchpad(
                 pd_->engine(), scratchpad_size, use_global_scratchpad);
         if (scratchpad_ptr == nullptr) return out_of_memory;
@@ -361,6 +676,15 @@ const primitive_desc_iface_t *dnnl_primitive::pd() const {
 }
 
 status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
+    std::unique_ptr<scratchpad_t> pooled_scratchpad;
+    CHECK(prepare_exec_ctx(ctx, pooled_scratchpad));
+
+    auto status = primitive_->execute(ctx);
+    return status;
+}
+
+status_t dnnl_primitive::prepare_exec_ctx(exec_ctx_t &ctx,
+        std::unique_ptr<scratchpad_t> &pooled_scratchpad) const {
     const memory_storage_t *mem_storage = nullptr;
     if (primitive_->pd()->attr()->scratchpad_mode_ == scratchpad_mode::user) {
         memory_t *scratchpad_memory = ctx.output(DNNL_ARG_SCRATCHPAD);
@@ -368,6 +692,11 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
                                         : nullptr;
     } else if (scratchpad_) {
         mem_storage = scratchpad_->get_memory_storage();
+    } else if (pooled_scratchpad_size_) {
+        pooled_scratchpad.reset(
+                lease_pooled_scratchpad(pooled_scratchpad_size_));
+        mem_storage = pooled_scratchpad->get_memory_storage();
+        if (mem_storage == nullptr) return out_of_memory;
     }
 
     // Obtain a scratchpad memory storage host ptr from the context.
@@ -383,9 +712,20 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
                     mem_storage, mapped_mem_storage_ptr);
     ctx.set_scratchpad_grantor(scratchpad_grantor);
     ctx.set_resource_mapper(&resource_mapper_);
+    return success;
+}
 
-    auto status = primitive_->execute(ctx);
-    return status;
+bool dnnl_primitive::has_team_execute() const {
+    return primitive_->has_team_execute();
+}
+
+status_t dnnl_primitive::execute_in_team(
+        const exec_ctx_t &ctx, int ithr, int nthr) const {
+    return primitive_->execute_in_team(ctx, ithr, nthr);
+}
+
+nthr_tuner_t &dnnl_primitive::nthr_tuner() const {
+    return primitive_->nthr_tuner();
 }
 
 status_t dnnl_primitive::get_cache_blob_size(size_t *size) const {
@@ -23,6 +23,7 @@
 
 #include "c_types_map.hpp"
 #include "cache_blob.hpp"
+#include "nthr_tuner.hpp"
 #include "primitive_exec_types.hpp"
 #include "resource.hpp"
 #include "scratchpad.hpp"
@@ -66,6 +67,24 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
             dnnl::impl::cache_blob_t cache_blob) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
 
+    // Sets up the scratchpad and the resources of `ctx` for an execution. A
+    // scratchpad leased from the pool is returned in `pooled_scratchpad` and
+    // must be kept until the execution completes.
+    dnnl::impl::status_t prepare_exec_ctx(dnnl::impl::exec_ctx_t &ctx,
+            std::unique_ptr<dnnl::impl::scratchpad_t> &pooled_scratchpad) const;
+
+    bool has_team_execute() const;
+    // Executes the share of the thread `ithr` of a team of `nthr` threads
+    // with a context set up by prepare_exec_ctx().
+    dnnl::impl::status_t execute_in_team(
+            const dnnl::impl::exec_ctx_t &ctx, int ithr, int nthr) const;
+
+    // Returns whether the executions of the primitive share one scratchpad
+    // buffer, so that they may not run concurrently.
+    bool has_shared_scratchpad() const { return scratchpad_ != nullptr; }
+
+    dnnl::impl::nthr_tuner_t &nthr_tuner() const;
+
     void retain() { counter_++; }
 
     void release() {
@@ -79,6 +98,9 @@ private:
     std::atomic<int> counter_;
     std::shared_ptr<dnnl::impl::primitive_t> primitive_;
     std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
+    // The size of the scratchpad leased from the scratchpad pool for each
+    // execution, 0 if the primitive doesn't use the pool
+    size_t pooled_scratchpad_size_ = 0;
     std::unique_ptr<primitive_desc_iface_t> pd_;
     dnnl::impl::resource_mapper_t resource_mapper_;
 
@@ -35,6 +35,7 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(embedding_bag)
         CASE(gated_mlp)
         CASE(gemm)
         CASE(group_normalization)
@@ -42,6 +43,7 @@ status_t serialize_desc(
         CASE(layer_normalization)
         CASE(lrn)
         CASE(matmul)
+        CASE(optimizer)
         CASE(pooling)
         CASE(prelu)
         CASE(reduction)
@@ -52,6 +54,7 @@ status_t serialize_desc(
         CASE(shuffle)
         CASE(softmax)
         CASE(sum)
+        CASE(topk)
         default: return status::invalid_arguments;
     }
 #undef CASE
@@ -207,6 +210,9 @@ void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr) {
     sstream.append(attr.deterministic_);
     // acc_mode
     sstream.append(attr.acc_mode_);
+    // dispatch_hint
+    sstream.append(attr.dispatch_hint_.goal_);
+    sstream.append(attr.dispatch_hint_.max_threads_);
 
     // scales
     if (!attr.scales_.has_default_values()) {
@@ -583,6 +589,11 @@ void serialize(serialization_stream_t &sstream, const softmax_desc_t &desc) {
     serialize(sstream, desc.diff_dst_desc);
     // Axis
     sstream.append(desc.softmax_axis);
+    // Attention inputs
+    serialize(sstream, desc.scale_desc);
+    sstream.append(desc.invert_scale);
+    serialize(sstream, desc.attn_mask_desc);
+    sstream.append(desc.attn_mask_type);
 }
 
 void serialize(serialization_stream_t &sstream, const sum_desc_t &desc) {
@@ -618,6 +629,9 @@ void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
     serialize(sstream, desc.diff_v_desc);
     serialize(sstream, desc.attn_mask_desc);
     serialize(sstream, desc.scale_desc);
+    serialize(sstream, desc.kv_page_table_desc);
+    serialize(sstream, desc.q_seq_offsets_desc);
+    serialize(sstream, desc.kv_seq_offsets_desc);
     sstream.append(desc.kq_acc_dt);
     sstream.append(desc.vs_acc_dt);
     sstream.append(desc.invert_scale);
@@ -637,5 +651,47 @@ void serialize(serialization_stream_t &sstream, const gated_mlp_desc_t &desc) {
     sstream.append(desc.activation);
 }
 
+void serialize(
+        serialization_stream_t &sstream, const embedding_bag_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.indices_desc);
+    serialize(sstream, desc.offsets_desc);
+    serialize(sstream, desc.dst_desc);
+}
+
+void serialize(serialization_stream_t &sstream, const topk_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.dst_desc);
+    serialize(sstream, desc.indices_desc);
+    // Softmax
+    sstream.append(desc.with_softmax);
+    sstream.append(desc.temperature);
+}
+
+void serialize(serialization_stream_t &sstream, const optimizer_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg);
+    // Array of mds
+    sstream.append(desc.param_descs.size());
+    for (const auto &md : desc.param_descs)
+        serialize(sstream, md);
+    // Data types
+    sstream.append(desc.grad_data_type);
+    sstream.append(desc.param_copy_data_type);
+    // Hyperparameters
+    sstream.append(desc.beta1);
+    sstream.append(desc.beta2);
+    sstream.append(desc.epsilon);
+    sstream.append(desc.weight_decay);
+}
+
 } // namespace impl
 } // namespace dnnl
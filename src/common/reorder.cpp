@@ -140,8 +140,32 @@ status_t reorder_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
                     "mask is not consistent with groups");
         }
 
-        VCHECK_REORDER(sc.get(DNNL_ARG_DST).has_default_groups(),
+        // Destination groups are only supported by the dynamic quantization
+        // modes, where the reorder computes a scale per group.
+        const auto &sc_dst = sc.get(DNNL_ARG_DST);
+        VCHECK_REORDER(
+                IMPLICATION(!sc_dst.is_dynamic(), sc_dst.has_default_groups()),
                 VERBOSE_UNSUPPORTED_SCALES_CFG);
+        if (!sc_dst.has_default_groups()) {
+            const int dst_ndims = d_mdw.ndims();
+            const int mask_dst = sc.get_mask(DNNL_ARG_DST);
+            VCHECK_REORDER(dst_ndims >= 2, VERBOSE_UNSUPPORTED_SCALES_CFG);
+            const bool group_dims_are_consistent
+                    = IMPLICATION(sc_dst.get_group(0) > 1,
+                              dst_md->dims[dst_ndims - 2] % sc_dst.get_group(0)
+                                      == 0)
+                    && IMPLICATION(sc_dst.get_group(1) > 1,
+                            dst_md->dims[dst_ndims - 1] % sc_dst.get_group(1)
+                                    == 0);
+            VCHECK_REORDER(group_dims_are_consistent,
+                    "groups dimensions are not consistent with reorder "
+                    "dimensions");
+            const bool mask_applies_to_last_two_dims
+                    = (mask_dst & (1 << (dst_ndims - 1)))
+                    && (mask_dst & (1 << (dst_ndims - 2)));
+            VCHECK_REORDER(mask_applies_to_last_two_dims,
+                    "mask is not consistent with groups");
+        }
     }
 
     bool is_cross_engine = src_engine != dst_engine
@@ -161,6 +185,13 @@ status_t reorder_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
         if ((*r)(&reorder_pd, engine, attr, src_engine, src_md, dst_engine,
                     dst_md)
                 == success) {
+            // the implementations that don't compute dynamic scales would
+            // read them as an input
+            if (attr->scales_.get(DNNL_ARG_DST).is_dynamic()
+                    && !reorder_pd->supports_dynamic_dst_scales()) {
+                delete reorder_pd;
+                continue;
+            }
             pd.reset(reorder_pd);
             return success;
         }
@@ -149,6 +149,10 @@ struct reorder_pd_t : public primitive_desc_t {
         return sum_idx == -1 ? 0 : attr()->post_ops_.entry_[sum_idx].sum.scale;
     }
 
+    // Returns true if the implementation computes the destination scales of
+    // a dynamic quantization mode, which are then an output of the reorder.
+    virtual bool supports_dynamic_dst_scales() const { return false; }
+
 protected:
     reorder_desc_t desc_;
     memory_desc_t src_md_;
@@ -332,6 +332,14 @@ status_t rnn_common_fwd_desc_init(rnn_desc_t *rnn_desc, prop_kind_t prop_kind,
                 VERBOSE_NULL_ARG);
     }
 
+    // the carried states are described by the *_iter tensors
+    if (flags & rnn_flags::stateful) {
+        VCONDCHECK_RNN(prop_kind == prop_kind::forward_inference,
+                VERBOSE_BAD_PROPKIND);
+        VCONDCHECK_RNN(!is_zero_md(src_iter_desc) && !is_zero_md(dst_iter_desc),
+                VERBOSE_NULL_ARG);
+    }
+
     // check augru-specific restrictions
     const bool is_augru = one_of(cell_kind, dnnl_vanilla_augru, dnnl_lbr_augru);
     if (is_augru) {
@@ -410,6 +418,7 @@ status_t rnn_common_bwd_desc_init(rnn_desc_t *rnn_desc, prop_kind_t prop_kind,
     using namespace alg_kind;
 
     VCONDCHECK_RNN(prop_kind == prop_kind::backward, VERBOSE_BAD_PROPKIND);
+    VCONDCHECK_RNN(!(flags & rnn_flags::stateful), VERBOSE_BAD_FLAGS);
 
     // check that a supported cell kind has been passed
     VCONDCHECK_RNN(one_of(cell_kind, vanilla_rnn, vanilla_lstm, vanilla_gru,
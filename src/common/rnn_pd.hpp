@@ -211,6 +211,8 @@ struct rnn_pd_t : public primitive_desc_t {
         return desc_.flags & rnn_flags::diff_weights_overwrite;
     }
 
+    bool is_stateful() const { return desc_.flags & rnn_flags::stateful; }
+
     dnnl_rnn_direction_t direction() const { return desc_.direction; }
 
 protected:
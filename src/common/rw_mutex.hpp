@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2020 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -25,7 +26,7 @@ namespace dnnl {
 namespace impl {
 namespace utils {
 
-struct rw_mutex_t {
+struct DNNL_API rw_mutex_t {
     rw_mutex_t();
     void lock_read();
     void lock_write();
@@ -39,7 +40,7 @@ private:
     std::unique_ptr<rw_mutex_impl_t> rw_mutex_impl_;
 };
 
-struct lock_read_t {
+struct DNNL_API lock_read_t {
     explicit lock_read_t(rw_mutex_t &rw_mutex);
     ~lock_read_t();
     DNNL_DISALLOW_COPY_AND_ASSIGN(lock_read_t);
@@ -48,7 +49,7 @@ private:
     rw_mutex_t &rw_mutex_;
 };
 
-struct lock_write_t {
+struct DNNL_API lock_write_t {
     explicit lock_write_t(rw_mutex_t &rw_mutex_t);
     ~lock_write_t();
     DNNL_DISALLOW_COPY_AND_ASSIGN(lock_write_t);
@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2017 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,7 +15,11 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "engine.hpp"
 #include "utils.hpp"
@@ -53,11 +58,21 @@ memory_storage_t *create_scratchpad_memory_storage(
 #endif
 
     memory_storage_t *mem_storage = nullptr;
-    auto status = mem_engine->create_memory_storage(&mem_storage, size);
+    auto status = mem_engine->create_memory_storage(&mem_storage,
+            memory_flags_t::alloc | memory_flags_t::scratchpad, size, nullptr);
     MAYBE_UNUSED(status);
     return mem_storage;
 }
 
+inline bool has_user_allocator(const engine_t *engine) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::has_user_allocator(engine);
+#else
+    UNUSED(engine);
+    return false;
+#endif
+}
+
 } // namespace
 
 /*
@@ -138,18 +153,169 @@ thread_local memory_storage_t *global_scratchpad_t::mem_storage_ = nullptr;
 thread_local size_t global_scratchpad_t::size_ = 0;
 thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
 
+namespace {
+
+/*
+  The pool of scratchpad buffers shared by all the threads that execute CPU
+  primitives. The buffers are leased for the duration of one execution.
+*/
+scratchpad_pool_t &cpu_scratchpad_pool() {
+    // never destroyed, as buffers can be returned at the program exit
+    static auto *pool = new scratchpad_pool_t(
+            nullptr, scratchpad_pool_t::default_budget());
+    return *pool;
+}
+
+} // namespace
+
+constexpr size_t scratchpad_pool_t::min_class_size;
+constexpr std::chrono::seconds scratchpad_pool_t::idle_timeout;
+
+scratchpad_pool_t::~scratchpad_pool_t() {
+    for (auto &c : idle_)
+        for (auto &b : c.second)
+            delete b.storage;
+}
+
+size_t scratchpad_pool_t::default_budget() {
+    static const size_t budget = []() {
+        const int budget_mb = getenv_int_user("SCRATCHPAD_POOL_LIMIT", 0);
+        return budget_mb > 0 ? static_cast<size_t>(budget_mb) << 20 : 0;
+    }();
+    return budget;
+}
+
+size_t scratchpad_pool_t::idle_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return idle_bytes_;
+}
+
+memory_storage_t *scratchpad_pool_t::acquire(size_t size, size_t &class_size) {
+    class_size = min_class_size;
+    while (class_size < size)
+        class_size *= 2;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto now = clock_t::now();
+        trim(now);
+        auto &buffers = idle_[class_size];
+        if (!buffers.empty()) {
+            memory_storage_t *buf = buffers.back().storage;
+            buffers.pop_back();
+            idle_bytes_ -= class_size;
+            return buf;
+        }
+    }
+    if (engine_) return create_scratchpad_memory_storage(engine_, class_size);
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    // the buffers may outlive the engine of the primitive
+    memory_storage_t *buf = nullptr;
+    status_t status = cpu::get_service_engine()->create_memory_storage(
+            &buf, class_size);
+    return status == status::success ? buf : nullptr;
+#else
+    return nullptr;
+#endif
+}
+
+void scratchpad_pool_t::release(memory_storage_t *buf, size_t class_size) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto now = clock_t::now();
+        trim(now);
+        if (idle_bytes_ + class_size <= budget_) {
+            idle_[class_size].push_back({buf, now});
+            idle_bytes_ += class_size;
+            return;
+        }
+    }
+    delete buf;
+}
+
+// The buffers of a class are ordered by the time they were returned.
+void scratchpad_pool_t::trim(clock_t::time_point now) {
+    for (auto &c : idle_) {
+        auto &buffers = c.second;
+        size_t n_expired = 0;
+        while (n_expired < buffers.size()
+                && now - buffers[n_expired].last_used > idle_timeout) {
+            delete buffers[n_expired].storage;
+            n_expired++;
+        }
+        buffers.erase(buffers.begin(), buffers.begin() + n_expired);
+        idle_bytes_ -= n_expired * c.first;
+    }
+}
+
+/*
+  Implementation of the scratchpad_t interface that holds a buffer of the
+  scratchpad pool
+*/
+struct pooled_scratchpad_t : public scratchpad_t {
+    pooled_scratchpad_t(scratchpad_pool_t &pool, size_t size)
+        : pool_(pool), size_(size) {
+        mem_storage_ = pool_.acquire(size, class_size_);
+        if (mem_storage_ == nullptr) size_ = 0;
+    }
+
+    ~pooled_scratchpad_t() override {
+        if (mem_storage_) pool_.release(mem_storage_, class_size_);
+    }
+
+    const memory_storage_t *get_memory_storage() const override {
+        return mem_storage_;
+    }
+
+    size_t size() const override { return size_; }
+
+private:
+    scratchpad_pool_t &pool_;
+    memory_storage_t *mem_storage_ = nullptr;
+    size_t size_;
+    size_t class_size_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(pooled_scratchpad_t);
+};
+
+bool use_scratchpad_pool(const engine_t *engine) {
+#if !defined(DNNL_ENABLE_CONCURRENT_EXEC) \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL
+    // the lease ends when the execution returns, which requires the
+    // execution to be synchronous
+    return engine->kind() == engine_kind::cpu
+            && is_native_runtime(engine->runtime_kind())
+            && !has_user_allocator(engine)
+            && cpu_scratchpad_pool().budget() > 0;
+#else
+    UNUSED(engine);
+    return false;
+#endif
+}
+
+scratchpad_t *lease_pooled_scratchpad(size_t size) {
+    return new pooled_scratchpad_t(cpu_scratchpad_pool(), size);
+}
+
 /*
    Scratchpad creation routine
 */
 scratchpad_t *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad) {
+    // the engine pool keeps the buffers of the destroyed primitives for the
+    // primitives created next
+    scratchpad_pool_t *pool = engine->scratchpad_pool();
+    if (pool) return new pooled_scratchpad_t(*pool, size);
 #ifndef DNNL_ENABLE_CONCURRENT_EXEC
     /*
      * TODO: global scratchpad should be able to handle memory
      * from different engines.
      * lock global scratchpad to work with CPU engine only.
      */
-    if (use_global_scratchpad && engine->kind() == engine_kind_t::dnnl_cpu)
+    // the global scratchpad is shared by the engines, so the engines with
+    // a user allocator have a scratchpad per primitive
+    if (use_global_scratchpad && engine->kind() == engine_kind_t::dnnl_cpu
+            && !has_user_allocator(engine))
         return new global_scratchpad_t(engine, size);
     else
         return new concurrent_scratchpad_t(engine, size);
@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2017 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -17,6 +18,11 @@
 #ifndef COMMON_SCRATCHPAD_HPP
 #define COMMON_SCRATCHPAD_HPP
 
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "c_types_map.hpp"
 #include "memory_storage.hpp"
 #include "utils.hpp"
@@ -30,9 +36,73 @@ struct scratchpad_t {
     virtual size_t size() const = 0;
 };
 
+/*
+  A pool of scratchpad buffers. The buffers are grouped by size classes of
+  powers of two and are returned to the pool when their scratchpad is
+  destroyed, so the memory held by the pool doesn't grow with the number of
+  users. At most `budget` bytes of idle buffers are kept, and the buffers
+  that have not been used for a while are released on the next lease or
+  return.
+*/
+struct DNNL_API scratchpad_pool_t {
+    // Creates a pool of buffers allocated on `engine`, or on the CPU service
+    // engine if `engine` is nullptr. The engine must outlive the pool.
+    scratchpad_pool_t(engine_t *engine, size_t budget)
+        : engine_(engine), budget_(budget) {}
+    ~scratchpad_pool_t();
+
+    // Returns the budget in bytes set with the ONEDNN_SCRATCHPAD_POOL_LIMIT
+    // environment variable, 0 if the pools are disabled.
+    static size_t default_budget();
+
+    // The budget in bytes, 0 if the pool is disabled
+    size_t budget() const { return budget_; }
+    // The bytes held by the idle buffers, at most the budget
+    size_t idle_bytes() const;
+
+    memory_storage_t *acquire(size_t size, size_t &class_size);
+    void release(memory_storage_t *buf, size_t class_size);
+
+private:
+    using clock_t = std::chrono::steady_clock;
+
+    static constexpr size_t min_class_size = 64 * 1024;
+    // The time after which an idle buffer is released
+    static constexpr std::chrono::seconds idle_timeout {2};
+
+    struct idle_buffer_t {
+        memory_storage_t *storage;
+        clock_t::time_point last_used;
+    };
+
+    // Releases the buffers that have been idle for too long.
+    void trim(clock_t::time_point now);
+
+    engine_t *engine_;
+    size_t budget_;
+    mutable std::mutex mutex_;
+    std::unordered_map<size_t, std::vector<idle_buffer_t>> idle_;
+    size_t idle_bytes_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scratchpad_pool_t);
+};
+
+// Creates a scratchpad of the primitive. If the engine has a scratchpad pool
+// (see engine_t::scratchpad_pool()), the per-primitive scratchpads are taken
+// from it.
 scratchpad_t *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad);
 
+// Returns true if the primitives that would use the global scratchpad on the
+// engine lease a scratchpad from the shared scratchpad pool for each
+// execution instead.
+bool DNNL_API use_scratchpad_pool(const engine_t *engine);
+
+// Creates a scratchpad holding a buffer of at least `size` bytes from the
+// shared scratchpad pool. The buffer returns to the pool when the scratchpad
+// is destroyed.
+scratchpad_t *lease_pooled_scratchpad(size_t size);
+
 } // namespace impl
 } // namespace dnnl
 #endif
@@ -69,6 +69,12 @@ struct sdpa_pd_t : public primitive_desc_t {
         return (desc()->attn_mask_md()->data_type != data_type::undef);
     }
 
+    /// If true, keys and values are pages of a paged KV cache
+    bool with_kv_paging() const { return desc()->with_kv_paging(); }
+
+    /// If true, the batch is made of variable-length packed sequences
+    bool with_varlen() const { return desc()->with_varlen(); }
+
     /// Returns the accumulation data type of the KQ matmul
     data_type_t kq_acc_dt() const { return desc()->kq_acc_dt; }
 
@@ -203,6 +209,8 @@ struct sdpa_fwd_pd_t : public sdpa_pd_t {
         // quantization.
         if (utils::one_of(arg, DNNL_ARG_QUERIES, DNNL_ARG_KEYS, DNNL_ARG_VALUES,
                     DNNL_ARG_ATTN_MASK, DNNL_ARG_SCALE,
+                    DNNL_ARG_KV_PAGE_TABLE, DNNL_ARG_Q_SEQ_OFFSETS,
+                    DNNL_ARG_KV_SEQ_OFFSETS,
                     DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS,
                     DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES,
                     DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS,
@@ -225,6 +233,9 @@ struct sdpa_fwd_pd_t : public sdpa_pd_t {
             case DNNL_ARG_KEYS: return src_md(1);
             case DNNL_ARG_VALUES: return src_md(2);
             case DNNL_ARG_ATTN_MASK: return src_md(3);
+            case DNNL_ARG_KV_PAGE_TABLE: return src_md(4);
+            case DNNL_ARG_Q_SEQ_OFFSETS: return src_md(5);
+            case DNNL_ARG_KV_SEQ_OFFSETS: return src_md(6);
             case DNNL_ARG_DST: return dst_md(0, user_input);
             default: return primitive_desc_t::arg_md(arg);
         }
@@ -237,6 +248,9 @@ struct sdpa_fwd_pd_t : public sdpa_pd_t {
             case 1: return &desc_.k_desc;
             case 2: return &desc_.v_desc;
             case 3: return &desc_.attn_mask_desc;
+            case 4: return &desc_.kv_page_table_desc;
+            case 5: return &desc_.q_seq_offsets_desc;
+            case 6: return &desc_.kv_seq_offsets_desc;
             default: return &glob_zero_md;
         }
     }
@@ -250,7 +264,8 @@ struct sdpa_fwd_pd_t : public sdpa_pd_t {
     }
 
     int n_inputs() const override {
-        return 3 + int(with_attn_mask()) + int(with_attn_scale());
+        return 3 + int(with_attn_mask()) + int(with_attn_scale())
+                + int(with_kv_paging()) + 2 * int(with_varlen());
     }
     int n_outputs() const override {
         return 1 + (!types::is_zero_md(workspace_md()));
@@ -46,6 +46,58 @@ status_t sdpa_primitive_desc_create(
             (const op_desc_t *)&sdpa_desc, nullptr, attr);
 }
 
+status_t sdpa_paged_kv_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        const memory_desc_t *query_desc, const memory_desc_t *key_desc,
+        const memory_desc_t *value_desc,
+        const memory_desc_t *kv_page_table_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *mask_desc, const memory_desc_t *scale_desc,
+        bool invert_scale, dim_t kv_head_number, int attn_mask_type,
+        alg_kind_t softmax_alg, prop_kind_t prop, const primitive_attr_t *attr,
+        const primitive_attr_t *kq_attr, const primitive_attr_t *vs_attr) {
+    if (kv_page_table_desc == nullptr) return status::invalid_arguments;
+    CHECK(sdpa_desc_check(query_desc, key_desc, value_desc, dst_desc, mask_desc,
+            engine, attr, kq_attr, vs_attr));
+    CHECK(sdpa_kv_paging_desc_check(
+            key_desc, value_desc, dst_desc, kv_page_table_desc));
+    CHECK(sdpa_attr_check(query_desc, key_desc, value_desc, dst_desc, engine,
+            attr, kq_attr, vs_attr));
+
+    sdpa_desc_t sdpa_desc = create_sdpa_desc(query_desc, key_desc, value_desc,
+            dst_desc, mask_desc, scale_desc, invert_scale, kv_head_number,
+            static_cast<attn_mask_type_t>(attn_mask_type), softmax_alg, prop,
+            kq_attr, vs_attr, kv_page_table_desc);
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&sdpa_desc, nullptr, attr);
+}
+
+status_t sdpa_varlen_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        const memory_desc_t *query_desc, const memory_desc_t *key_desc,
+        const memory_desc_t *value_desc,
+        const memory_desc_t *q_seq_offsets_desc,
+        const memory_desc_t *kv_seq_offsets_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *mask_desc, const memory_desc_t *scale_desc,
+        bool invert_scale, dim_t kv_head_number, int attn_mask_type,
+        alg_kind_t softmax_alg, prop_kind_t prop, const primitive_attr_t *attr,
+        const primitive_attr_t *kq_attr, const primitive_attr_t *vs_attr) {
+    if (utils::any_null(q_seq_offsets_desc, kv_seq_offsets_desc))
+        return status::invalid_arguments;
+    CHECK(sdpa_desc_check(query_desc, key_desc, value_desc, dst_desc, mask_desc,
+            engine, attr, kq_attr, vs_attr));
+    CHECK(sdpa_varlen_desc_check(query_desc, key_desc, value_desc, dst_desc,
+            q_seq_offsets_desc, kv_seq_offsets_desc));
+    CHECK(sdpa_attr_check(query_desc, key_desc, value_desc, dst_desc, engine,
+            attr, kq_attr, vs_attr));
+
+    sdpa_desc_t sdpa_desc = create_sdpa_desc(query_desc, key_desc, value_desc,
+            dst_desc, mask_desc, scale_desc, invert_scale, kv_head_number,
+            static_cast<attn_mask_type_t>(attn_mask_type), softmax_alg, prop,
+            kq_attr, vs_attr, nullptr, q_seq_offsets_desc, kv_seq_offsets_desc);
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&sdpa_desc, nullptr, attr);
+}
+
 status_t sdpa_primitive_desc_create(
         primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
         const memory_desc_t *query_desc, const memory_desc_t *key_desc,
@@ -29,6 +29,37 @@ dnnl_status_t DNNL_API sdpa_primitive_desc_create(
         const_dnnl_primitive_attr_t attr, const_dnnl_primitive_attr_t kq_attr,
         const_dnnl_primitive_attr_t vs_attr);
 
+// Forward SDPA over a paged KV cache: key_desc and value_desc describe the
+// pools of pages, and the page table maps the pages of every sequence of the
+// batch to pages of the pools.
+dnnl_status_t DNNL_API sdpa_paged_kv_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t query_desc, const_dnnl_memory_desc_t key_desc,
+        const_dnnl_memory_desc_t value_desc,
+        const_dnnl_memory_desc_t kv_page_table_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_memory_desc_t mask_desc,
+        const_dnnl_memory_desc_t scale_desc, bool invert_scale,
+        dnnl_dim_t kv_head_number, int attn_mask_type,
+        dnnl_alg_kind_t softmax_alg, dnnl_prop_kind_t prop,
+        const_dnnl_primitive_attr_t attr, const_dnnl_primitive_attr_t kq_attr,
+        const_dnnl_primitive_attr_t vs_attr);
+
+// Forward SDPA over a variable-length batch: the sequences are packed along
+// the queries and keys dimensions, and the offsets hold the cumulative number
+// of queries and keys of every sequence.
+dnnl_status_t DNNL_API sdpa_varlen_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t query_desc, const_dnnl_memory_desc_t key_desc,
+        const_dnnl_memory_desc_t value_desc,
+        const_dnnl_memory_desc_t q_seq_offsets_desc,
+        const_dnnl_memory_desc_t kv_seq_offsets_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_memory_desc_t mask_desc,
+        const_dnnl_memory_desc_t scale_desc, bool invert_scale,
+        dnnl_dim_t kv_head_number, int attn_mask_type,
+        dnnl_alg_kind_t softmax_alg, dnnl_prop_kind_t prop,
+        const_dnnl_primitive_attr_t attr, const_dnnl_primitive_attr_t kq_attr,
+        const_dnnl_primitive_attr_t vs_attr);
+
 dnnl_status_t DNNL_API sdpa_primitive_desc_create(
         dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
         const_dnnl_memory_desc_t query_desc, const_dnnl_memory_desc_t key_desc,
@@ -42,4 +73,15 @@ dnnl_status_t DNNL_API sdpa_primitive_desc_create(
         dnnl_dim_t kv_head_number, int attn_mask_type,
         dnnl_alg_kind_t softmax_alg, const_dnnl_primitive_attr_t attr,
         const dnnl_primitive_desc *hint_fwd_pd);
+
+// Forward softmax along the last dimension of the attention scores with the
+// scale and the mask of the attention applied to the source beforehand, for
+// an SDPA decomposed into separate primitives on CPU. The scale and the mask
+// are passed as DNNL_ARG_SCALE and DNNL_ARG_ATTN_MASK.
+dnnl_status_t DNNL_API softmax_attn_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_memory_desc_t scale_desc,
+        bool invert_scale, const_dnnl_memory_desc_t mask_desc,
+        int attn_mask_type, const_dnnl_primitive_attr_t attr);
 #endif
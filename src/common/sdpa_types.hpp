@@ -32,6 +32,9 @@ namespace impl {
 #define DNNL_ARG_KEYS DNNL_ARG_SRC_1
 #define DNNL_ARG_VALUES DNNL_ARG_SRC_2
 #define DNNL_ARG_ATTN_MASK DNNL_ARG_SHIFT
+#define DNNL_ARG_KV_PAGE_TABLE DNNL_ARG_SRC_3
+#define DNNL_ARG_Q_SEQ_OFFSETS (DNNL_ARG_SRC_3 + 1)
+#define DNNL_ARG_KV_SEQ_OFFSETS (DNNL_ARG_SRC_3 + 2)
 
 #define DNNL_ARG_DIFF_QUERIES DNNL_ARG_DIFF_SRC_0
 #define DNNL_ARG_DIFF_KEYS DNNL_ARG_DIFF_SRC_1
@@ -93,6 +96,19 @@ struct sdpa_desc_t : public op_desc_t {
     memory_desc_t diff_v_desc;
     memory_desc_t attn_mask_desc;
     memory_desc_t scale_desc;
+    // Paged KV cache. When set, k_desc and v_desc describe pools of pages of
+    // shapes [pages][kv_heads][head_size][page_size] and
+    // [pages][kv_heads][page_size][values], and the s32 page table of shape
+    // [batch][pages_per_sequence] maps the logical pages of every sequence to
+    // pages of the pools.
+    memory_desc_t kv_page_table_desc;
+    // Variable-length (ragged) batch. When set, the sequences of the batch are
+    // packed along the queries and keys dimensions of tensors with a batch of
+    // one, and the s32 offsets of shape [sequences] hold the cumulative
+    // number of queries and keys of every sequence, like the offsets buffer
+    // of the grouped memory encoding.
+    memory_desc_t q_seq_offsets_desc;
+    memory_desc_t kv_seq_offsets_desc;
     data_type_t kq_acc_dt {};
     data_type_t vs_acc_dt {};
     // invert_scale = false: multiply by scale
@@ -108,7 +124,23 @@ struct sdpa_desc_t : public op_desc_t {
     // Head size.
     dnnl_dim_t head_size() const { return q_desc.dims[q_desc.ndims - 1]; }
     // Number of keys.
-    dnnl_dim_t keys() const { return k_desc.dims[k_desc.ndims - 1]; }
+    dnnl_dim_t keys() const {
+        if (with_kv_paging())
+            return kv_page_table_desc.dims[1] * kv_page_size();
+        return k_desc.dims[k_desc.ndims - 1];
+    }
+    // Whether keys and values are given as pages of a paged KV cache.
+    bool with_kv_paging() const {
+        return kv_page_table_desc.data_type != data_type::undef;
+    }
+    // Whether the batch is made of variable-length packed sequences.
+    bool with_varlen() const {
+        return q_seq_offsets_desc.data_type != data_type::undef;
+    }
+    // Number of packed sequences of a variable-length batch.
+    dnnl_dim_t seq_count() const { return q_seq_offsets_desc.dims[0]; }
+    // Number of keys in a page of the paged KV cache.
+    dnnl_dim_t kv_page_size() const { return k_desc.dims[k_desc.ndims - 1]; }
     // Number of values.
     dnnl_dim_t values() const { return v_desc.dims[v_desc.ndims - 1]; }
     dim_t num_q_heads() const { return q_desc.dims[1]; }
@@ -122,6 +154,15 @@ struct sdpa_desc_t : public op_desc_t {
     const memory_desc_t *val_md() const { return &v_desc; }
     const memory_desc_t *attn_mask_md() const { return &attn_mask_desc; }
     const memory_desc_t *scale_md() const { return &scale_desc; }
+    const memory_desc_t *kv_page_table_md() const {
+        return &kv_page_table_desc;
+    }
+    const memory_desc_t *q_seq_offsets_md() const {
+        return &q_seq_offsets_desc;
+    }
+    const memory_desc_t *kv_seq_offsets_md() const {
+        return &kv_seq_offsets_desc;
+    }
     const memory_desc_t *diff_qry_md() const { return &diff_q_desc; }
     const memory_desc_t *diff_key_md() const { return &diff_k_desc; }
     const memory_desc_t *diff_val_md() const { return &diff_v_desc; }
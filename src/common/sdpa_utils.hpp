@@ -136,6 +136,43 @@ static inline status_t sdpa_desc_check(const memory_desc_t *q_desc,
     return status::success;
 }
 
+static inline status_t sdpa_kv_paging_desc_check(const memory_desc_t *k_desc,
+        const memory_desc_t *v_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *kv_page_table_desc) {
+    VCHECK_SDPA_COND(kv_page_table_desc->ndims == 2, VERBOSE_BAD_NDIMS,
+            "kv_page_table", kv_page_table_desc->ndims);
+    VCHECK_SDPA_COND(kv_page_table_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "kv_page_table");
+    VCHECK_SDPA_COND(kv_page_table_desc->dims[0] == dst_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "kv_page_table", 0, "dst", 0);
+    // The pools of key and value pages are indexed with the same page table.
+    for (int i = 0; i < 2; i++) {
+        VCHECK_SDPA_COND(k_desc->dims[i] == v_desc->dims[i],
+                VERBOSE_INCONSISTENT_DIM, "k", i, "v", i);
+    }
+    return status::success;
+}
+
+static inline status_t sdpa_varlen_desc_check(const memory_desc_t *q_desc,
+        const memory_desc_t *k_desc, const memory_desc_t *v_desc,
+        const memory_desc_t *dst_desc, const memory_desc_t *q_seq_offsets_desc,
+        const memory_desc_t *kv_seq_offsets_desc) {
+    for (const auto *md : {q_seq_offsets_desc, kv_seq_offsets_desc}) {
+        VCHECK_SDPA_COND(
+                md->ndims == 1, VERBOSE_BAD_NDIMS, "seq_offsets", md->ndims);
+        VCHECK_SDPA_COND(md->data_type == data_type::s32,
+                VERBOSE_INVALID_DATATYPE, "seq_offsets");
+    }
+    VCHECK_SDPA_COND(
+            q_seq_offsets_desc->dims[0] == kv_seq_offsets_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "q_seq_offsets", 0, "kv_seq_offsets", 0);
+    // Sequences are packed into tensors with a batch of one.
+    for (const auto *md : {q_desc, k_desc, v_desc, dst_desc}) {
+        VCHECK_SDPA_COND(md->dims[0] == 1, VERBOSE_BAD_DIM, "varlen batch", 0);
+    }
+    return status::success;
+}
+
 static inline status_t sdpa_dropout_desc_check(const memory_desc_t *dst_desc,
         const memory_desc_t *k_desc, const primitive_attr_t *attr) {
 
@@ -266,7 +303,10 @@ static inline sdpa_desc_t create_sdpa_desc(const memory_desc_t *q_md,
         const memory_desc_t *scale_md, bool invert_scale, dim_t kv_head_number,
         attn_mask_type_t attn_mask_type, alg_kind_t softmax_alg,
         prop_kind_t prop, const primitive_attr_t *kq_attr,
-        const primitive_attr_t *vs_attr) {
+        const primitive_attr_t *vs_attr,
+        const memory_desc_t *kv_page_table_md = nullptr,
+        const memory_desc_t *q_seq_offsets_md = nullptr,
+        const memory_desc_t *kv_seq_offsets_md = nullptr) {
     auto sdpa_desc = sdpa_desc_t();
     sdpa_desc.primitive_kind = primitive_kind::sdpa;
     sdpa_desc.q_desc = *q_md;
@@ -291,6 +331,9 @@ static inline sdpa_desc_t create_sdpa_desc(const memory_desc_t *q_md,
     sdpa_desc.dst_desc = *dst_md;
     if (attn_mask_md) sdpa_desc.attn_mask_desc = *attn_mask_md;
     sdpa_desc.scale_desc = *scale_md;
+    if (kv_page_table_md) sdpa_desc.kv_page_table_desc = *kv_page_table_md;
+    if (q_seq_offsets_md) sdpa_desc.q_seq_offsets_desc = *q_seq_offsets_md;
+    if (kv_seq_offsets_md) sdpa_desc.kv_seq_offsets_desc = *kv_seq_offsets_md;
     sdpa_desc.invert_scale = invert_scale;
     sdpa_desc.kv_head_number = kv_head_number;
     sdpa_desc.mask_type = attn_mask_type;
@@ -21,6 +21,8 @@
 
 #include "c_types_map.hpp"
 #include "memory_desc_wrapper.hpp"
+#include "sdpa_test_iface.hpp"
+#include "sdpa_types.hpp"
 #include "utils.hpp"
 
 using namespace dnnl::impl;
@@ -94,6 +96,60 @@ status_t softmax_desc_init(softmax_desc_t *softmax_desc, prop_kind_t prop_kind,
     return success;
 }
 
+status_t softmax_attn_desc_init(softmax_desc_t *softmax_desc,
+        const engine_t *engine, const memory_desc_t *scale_desc,
+        bool invert_scale, const memory_desc_t *attn_mask_desc,
+        int attn_mask_type) {
+    using namespace data_type;
+    const memory_desc_t &src_desc = softmax_desc->src_desc;
+    const int ndims = src_desc.ndims;
+
+    VCHECK_SOFTMAX_UNIMPL(
+            engine->kind() == engine_kind::cpu, VERBOSE_BAD_ENGINE_KIND);
+    VCHECK_SOFTMAX(softmax_desc->softmax_axis == ndims - 1, VERBOSE_BAD_AXIS);
+    VCHECK_SOFTMAX(one_of(attn_mask_type, attn_mask_type::undef,
+                           attn_mask_type::buffer, attn_mask_type::top_left,
+                           attn_mask_type::bottom_right),
+            VERBOSE_BAD_PARAM, "attn_mask_type");
+
+    const bool with_scale = scale_desc && !types::is_zero_md(scale_desc);
+    if (with_scale) {
+        const memory_desc_wrapper scale_d(scale_desc);
+        VCHECK_SOFTMAX(scale_d.nelems() == 1, VERBOSE_BAD_PARAM, "scale");
+        VCHECK_SOFTMAX_UNIMPL(one_of(scale_d.data_type(), f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+        VCHECK_SOFTMAX_UNIMPL(
+                !scale_d.is_host_scalar_desc() && !scale_d.format_any(),
+                VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    }
+
+    const bool with_mask = attn_mask_desc && !types::is_zero_md(attn_mask_desc);
+    VCHECK_SOFTMAX(with_mask == (attn_mask_type == attn_mask_type::buffer),
+            VERBOSE_BAD_PARAM, "attn_mask_desc");
+    VCHECK_SOFTMAX(IMPLICATION(one_of(attn_mask_type, attn_mask_type::top_left,
+                                       attn_mask_type::bottom_right),
+                           ndims >= 2),
+            VERBOSE_BAD_NDIMS, "src", ndims);
+    if (with_mask) {
+        const memory_desc_wrapper mask_d(attn_mask_desc);
+        VCHECK_SOFTMAX(mask_d.ndims() == ndims, VERBOSE_INCONSISTENT_NDIMS,
+                "attn_mask", "src");
+        for (int d = 0; d < ndims; d++)
+            VCHECK_SOFTMAX(one_of(mask_d.dims()[d], dim_t(1), src_desc.dims[d]),
+                    VERBOSE_INVALID_BROADCAST, "attn_mask", d);
+        VCHECK_SOFTMAX_UNIMPL(one_of(mask_d.data_type(), f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+        VCHECK_SOFTMAX_UNIMPL(mask_d.is_blocking_desc(),
+                VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    }
+
+    if (with_scale) softmax_desc->scale_desc = *scale_desc;
+    softmax_desc->invert_scale = with_scale && invert_scale;
+    if (with_mask) softmax_desc->attn_mask_desc = *attn_mask_desc;
+    softmax_desc->attn_mask_type = attn_mask_type;
+    return success;
+}
+
 status_t softmax_attr_check(const softmax_desc_t &desc, const engine_t *engine,
         const primitive_attr_t *attr) {
     using namespace data_type;
@@ -192,4 +248,22 @@ status_t dnnl_softmax_backward_primitive_desc_create(
             (const op_desc_t *)&softmax_desc, hint_fwd_pd, attr);
 }
 
+status_t softmax_attn_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, const memory_desc_t *scale_desc,
+        bool invert_scale, const memory_desc_t *attn_mask_desc,
+        int attn_mask_type, const primitive_attr_t *attr) {
+    VCHECK_SOFTMAX(!any_null(src_desc, dst_desc), VERBOSE_NULL_ARG);
+
+    auto softmax_desc = softmax_desc_t();
+    CHECK(softmax_desc_init(&softmax_desc, forward_inference, alg_kind,
+            src_desc, dst_desc, nullptr, nullptr, src_desc->ndims - 1));
+    CHECK(softmax_attn_desc_init(&softmax_desc, engine, scale_desc,
+            invert_scale, attn_mask_desc, attn_mask_type));
+    CHECK(softmax_attr_check(softmax_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&softmax_desc, nullptr, attr);
+}
+
 // vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -21,6 +21,7 @@
 
 #include "c_types_map.hpp"
 #include "primitive_desc.hpp"
+#include "sdpa_types.hpp"
 
 #define VDISPATCH_SOFTMAX(cond, msg, ...) \
     VCONDCHECK(primitive, create, dispatch, softmax, (cond), \
@@ -109,6 +110,22 @@ struct softmax_pd_t : public primitive_desc_t {
     }
     bool is_logsoftmax() const { return alg_kind() == alg_kind::softmax_log; }
 
+    /* attention inputs applied to the source, see softmax_desc_t */
+
+    bool with_attn_scale() const {
+        return !types::is_zero_md(&desc_.scale_desc);
+    }
+    bool with_attn_mask() const {
+        return desc_.attn_mask_type == attn_mask_type::buffer;
+    }
+    bool with_causal_mask() const {
+        return utils::one_of(desc_.attn_mask_type, attn_mask_type::top_left,
+                attn_mask_type::bottom_right);
+    }
+    bool with_attn_inputs() const {
+        return with_attn_scale() || with_attn_mask() || with_causal_mask();
+    }
+
 protected:
     softmax_desc_t desc_;
     const softmax_fwd_pd_t *hint_fwd_pd_;
@@ -134,6 +151,12 @@ struct softmax_fwd_pd_t : public softmax_pd_t {
     arg_usage_t arg_usage(int arg) const override {
         if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_SCALE && with_attn_scale())
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_ATTN_MASK && with_attn_mask())
+            return arg_usage_t::input;
+
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
         if (arg == DNNL_ARG_WORKSPACE)
@@ -147,6 +170,8 @@ struct softmax_fwd_pd_t : public softmax_pd_t {
             int arg, bool user_input = false) const override {
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_SCALE: return &desc()->scale_desc;
+            case DNNL_ARG_ATTN_MASK: return &desc()->attn_mask_desc;
             case DNNL_ARG_DST: return dst_md(0, user_input);
             default: return softmax_pd_t::arg_md(arg);
         }
@@ -163,7 +188,9 @@ struct softmax_fwd_pd_t : public softmax_pd_t {
         return &glob_zero_md;
     }
 
-    int n_inputs() const override { return 1 + n_binary_po_inputs(); }
+    int n_inputs() const override {
+        return 1 + with_attn_scale() + with_attn_mask() + n_binary_po_inputs();
+    }
     int n_outputs() const override {
         return 1 + (!types::is_zero_md(workspace_md()));
     }
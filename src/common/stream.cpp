@@ -44,7 +44,7 @@ status_t dnnl_stream_create(
     bool args_ok = !utils::any_null(stream, engine);
     if (!args_ok) return invalid_arguments;
 
-    if (engine->kind() != engine_kind::gpu
+    if (!stream_t::is_profiling_supported(engine->kind())
             && (flags & stream_flags::profiling)) {
         return status::unimplemented;
     }
@@ -65,6 +65,13 @@ status_t dnnl_stream_wait(stream_t *stream) {
     return stream->wait();
 }
 
+status_t dnnl_stream_enqueue_barrier(stream_t *stream) {
+    bool args_ok = !any_null(stream);
+    if (!args_ok) return invalid_arguments;
+
+    return stream->enqueue_barrier();
+}
+
 status_t dnnl_stream_destroy(stream_t *stream) {
     delete stream;
     return success;
@@ -48,6 +48,14 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
     /** blocks until all submitted primitives to the stream are completed */
     virtual dnnl::impl::status_t wait() = 0;
 
+    /** makes the primitives submitted next start after the ones submitted so
+     * far. Out-of-order streams without a cheaper way wait for the latter. */
+    virtual dnnl::impl::status_t enqueue_barrier() {
+        using namespace dnnl::impl;
+        if (flags() & stream_flags::out_of_order) return wait();
+        return status::success;
+    }
+
     virtual void before_exec_hook() {}
     virtual void after_exec_hook() {}
 
@@ -71,8 +79,32 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
         return dnnl::impl::status::unimplemented;
     }
 
+    // Records the executions submitted between begin_graph_capture() and
+    // end_graph_capture() into a graph instead of running them; the graph is
+    // launched by replay_graph(). Only some backends support it.
+    virtual dnnl::impl::status_t begin_graph_capture() {
+        return dnnl::impl::status::unimplemented;
+    }
+
+    virtual dnnl::impl::status_t end_graph_capture() {
+        return dnnl::impl::status::unimplemented;
+    }
+
+    virtual dnnl::impl::status_t replay_graph() {
+        return dnnl::impl::status::unimplemented;
+    }
+
     bool is_profiling_enabled() const { return impl_->is_profiling_enabled(); }
 
+    // CPU streams record the executions in cpu_stream_t::enqueue_primitive(),
+    // which the SYCL CPU stream overrides
+    static bool is_profiling_supported(dnnl::impl::engine_kind_t kind) {
+        using namespace dnnl::impl;
+        if (kind == engine_kind::gpu) return true;
+        return kind == engine_kind::cpu
+                && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL;
+    }
+
     virtual dnnl::impl::status_t zero_pad(const dnnl::impl::memory_t *memory,
             const dnnl::impl::exec_ctx_t &ctx);
 
@@ -18,6 +18,7 @@
 
 #include "common/c_types_map.hpp"
 #include "common/stream.hpp"
+#include "common/utils.hpp"
 
 using namespace dnnl::impl;
 using namespace dnnl::impl::status;
@@ -34,8 +35,8 @@ using namespace dnnl::impl::status;
 
 INTERNAL_API_ATTRIBUTE(status_t) dnnl_reset_profiling(stream_t *stream) {
     const auto eng_kind = stream->engine()->kind();
-    if (eng_kind != engine_kind::gpu) {
-        VERROR(common, common, "CPU engine does not support profiling");
+    if (!stream_t::is_profiling_supported(eng_kind)) {
+        VERROR(common, common, "engine does not support profiling");
         return status::unimplemented;
     }
     return stream->reset_profiling();
@@ -45,8 +46,17 @@ INTERNAL_API_ATTRIBUTE(status_t)
 dnnl_query_profiling_data(stream_t *stream, profiling_data_kind_t data_kind,
         int *num_entries, uint64_t *data) {
     const auto eng_kind = stream->engine()->kind();
-    if (eng_kind != engine_kind::gpu) {
-        VERROR(common, common, "CPU engine does not support profiling");
+    if (!stream_t::is_profiling_supported(eng_kind)) {
+        VERROR(common, common, "engine does not support profiling");
+        return status::unimplemented;
+    }
+    // Timestamps and thread ids are recorded by CPU streams only
+    if (eng_kind == engine_kind::gpu && data
+            && utils::one_of(data_kind, profiling_data_kind::start_time,
+                    profiling_data_kind::end_time,
+                    profiling_data_kind::thread_id)) {
+        VERROR(common, common,
+                "GPU engine does not support the profiling data kind");
         return status::unimplemented;
     }
     return stream->get_profiling_data(data_kind, num_entries, data);
@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/topk_iface.hpp"
+#include "common/topk_pd.hpp"
+#include "common/utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+status_t dnnl_topk_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *indices_desc, int with_softmax, float temperature,
+        const primitive_attr_t *attr) {
+    VCHECK_TOPK(!utils::any_null(src_desc, dst_desc, indices_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_TOPK(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src",
+            src_desc->ndims);
+    VCHECK_TOPK(dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst",
+            dst_desc->ndims);
+    VCHECK_TOPK(indices_desc->ndims == 2, VERBOSE_BAD_NDIMS, "indices",
+            indices_desc->ndims);
+    for (const auto *md : {src_desc, dst_desc, indices_desc}) {
+        VCHECK_TOPK(!memory_desc_wrapper(md).has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    }
+    VCHECK_TOPK(indices_desc->data_type == data_type::s32,
+            VERBOSE_UNSUPPORTED_DT);
+    VCHECK_TOPK(utils::everyone_is(src_desc->dims[0], dst_desc->dims[0],
+                        indices_desc->dims[0]),
+            VERBOSE_INCONSISTENT_DIM, "src", 0, "dst", 0);
+    VCHECK_TOPK(dst_desc->dims[1] == indices_desc->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "dst", 1, "indices", 1);
+    VCHECK_TOPK(dst_desc->dims[1] > 0 && dst_desc->dims[1] <= src_desc->dims[1],
+            VERBOSE_BAD_DIM, "dst", 1);
+    VCHECK_TOPK(IMPLICATION(with_softmax, temperature > 0.f),
+            VERBOSE_BAD_PARAM, "temperature");
+
+    auto desc = create_topk_desc(
+            src_desc, dst_desc, indices_desc, with_softmax != 0, temperature);
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&desc, nullptr, attr);
+}
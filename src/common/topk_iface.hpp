@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOPK_IFACE_HPP
+#define COMMON_TOPK_IFACE_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+/// Creates a primitive descriptor for a top-k primitive.
+///
+/// Row r of the destination holds the k largest values of row r of the
+/// source in descending order, equal values being ordered by index, and the
+/// indices tensor holds their positions in the row. With softmax, the
+/// destination holds softmax(src / temperature) of the selected elements
+/// instead, normalized over the whole row, so that sampling does not need
+/// the probabilities of the other elements.
+///
+/// Arguments: #DNNL_ARG_SRC, #DNNL_ARG_DST (values), #DNNL_ARG_DST_1
+/// (indices).
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source memory descriptor, 2D [rows, n].
+/// @param dst_desc Values memory descriptor, 2D [rows, k].
+/// @param indices_desc Indices memory descriptor, 2D s32 [rows, k].
+/// @param with_softmax Whether to output softmax probabilities.
+/// @param temperature Softmax temperature, must be positive. Ignored
+///     without softmax.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_topk_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t indices_desc, int with_softmax,
+        float temperature, const_dnnl_primitive_attr_t attr);
+
+#endif
@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOPK_PD_HPP
+#define COMMON_TOPK_PD_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define DNNL_ARG_TOPK_INDICES DNNL_ARG_DST_1
+
+#define VCHECK_TOPK(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, topk, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__)
+
+#define VDISPATCH_TOPK(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, topk, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+static inline topk_desc_t create_topk_desc(const memory_desc_t *src_md,
+        const memory_desc_t *dst_md, const memory_desc_t *indices_md,
+        bool with_softmax, float temperature) {
+    auto desc = topk_desc_t();
+    desc.primitive_kind = primitive_kind::topk;
+    desc.src_desc = *src_md;
+    desc.dst_desc = *dst_md;
+    desc.indices_desc = *indices_md;
+    desc.with_softmax = with_softmax;
+    desc.temperature = with_softmax ? temperature : 0.f;
+    return desc;
+}
+
+// Selects the k largest values of each row of the source, in descending
+// order, along with their indices. Equal values are ordered by index. With
+// softmax, the values are the probabilities softmax(src / temperature) of
+// the selected elements, normalized over the whole row.
+// NOLINTBEGIN(google-default-arguments)
+struct topk_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::topk;
+    using base_class = topk_pd_t;
+    using hint_class = topk_pd_t;
+
+    const topk_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    dim_t rows() const { return desc_.src_desc.dims[0]; }
+    dim_t n() const { return desc_.src_desc.dims[1]; }
+    dim_t k() const { return desc_.dst_desc.dims[1]; }
+    bool with_softmax() const { return desc_.with_softmax; }
+    float temperature() const { return desc_.temperature; }
+
+    int n_inputs() const override { return 1; }
+    int n_outputs() const override { return 2; }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
+        if (utils::one_of(arg, DNNL_ARG_DST, DNNL_ARG_TOPK_INDICES))
+            return arg_usage_t::output;
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_TOPK_INDICES: return dst_md(1, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &src_md_ : &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &dst_md_;
+            case 1: return &indices_md_;
+            default: return &glob_zero_md;
+        }
+    }
+
+protected:
+    topk_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t dst_md_;
+    memory_desc_t indices_md_;
+
+    topk_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<topk_desc_t>(adesc))
+        , src_md_(desc_.src_desc)
+        , dst_md_(desc_.dst_desc)
+        , indices_md_(desc_.indices_desc) {}
+
+    // Sets plain formats for the memory descriptors with format `any`.
+    bool set_default_formats() {
+        using namespace format_tag;
+        auto set = [](memory_desc_t &md) {
+            return md.format_kind != format_kind::any
+                    || memory_desc_init_by_tag(md, ab) == status::success;
+        };
+        return set(src_md_) && set(dst_md_) && set(indices_md_);
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
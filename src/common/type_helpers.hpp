@@ -992,7 +992,11 @@ inline bool operator==(
             && COMPARE_DESC_MEMBERS(diff_src_desc)
             && COMPARE_DESC_MEMBERS(dst_desc)
             && COMPARE_DESC_MEMBERS(diff_dst_desc)
-            && COMPARE_DESC_MEMBERS(softmax_axis);
+            && COMPARE_DESC_MEMBERS(softmax_axis)
+            && COMPARE_DESC_MEMBERS(scale_desc)
+            && COMPARE_DESC_MEMBERS(invert_scale)
+            && COMPARE_DESC_MEMBERS(attn_mask_desc)
+            && COMPARE_DESC_MEMBERS(attn_mask_type);
      return ret;
 }
 
@@ -1039,6 +1043,9 @@ inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(diff_v_desc)
             && COMPARE_DESC_MEMBERS(attn_mask_desc)
             && COMPARE_DESC_MEMBERS(scale_desc)
+            && COMPARE_DESC_MEMBERS(kv_page_table_desc)
+            && COMPARE_DESC_MEMBERS(q_seq_offsets_desc)
+            && COMPARE_DESC_MEMBERS(kv_seq_offsets_desc)
             && COMPARE_DESC_MEMBERS(kq_acc_dt)
             && COMPARE_DESC_MEMBERS(vs_acc_dt)
             && COMPARE_DESC_MEMBERS(invert_scale)
@@ -1059,6 +1066,41 @@ inline bool operator==(const gated_mlp_desc_t &lhs, const gated_mlp_desc_t &rhs)
     return ret;
 }
 
+inline bool operator==(
+        const embedding_bag_desc_t &lhs, const embedding_bag_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(offsets_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc);
+    return ret;
+}
+
+inline bool operator==(const topk_desc_t &lhs, const topk_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(with_softmax)
+            && COMPARE_FLOAT_DESC_MEMBERS(temperature);
+    return ret;
+}
+
+inline bool operator==(
+        const optimizer_desc_t &lhs, const optimizer_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg)
+            && COMPARE_DESC_MEMBERS(param_descs)
+            && COMPARE_DESC_MEMBERS(grad_data_type)
+            && COMPARE_DESC_MEMBERS(param_copy_data_type)
+            && COMPARE_FLOAT_DESC_MEMBERS(beta1)
+            && COMPARE_FLOAT_DESC_MEMBERS(beta2)
+            && COMPARE_FLOAT_DESC_MEMBERS(epsilon)
+            && COMPARE_FLOAT_DESC_MEMBERS(weight_decay);
+    return ret;
+}
+
 // clang-format on
 
 #undef COMPARE_DESC_MEMBERS
@@ -29,13 +29,19 @@
 #include <sys/types.h>
 #endif
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -212,6 +218,116 @@ void free(void *p) {
 #endif
 }
 
+static setting_t<dnnl_huge_pages_mode_t> huge_pages_mode {
+        dnnl_huge_pages_none};
+dnnl_huge_pages_mode_t get_huge_pages_mode() {
+    if (!huge_pages_mode.initialized()) {
+        static const int val
+                = getenv_int_user("HUGE_PAGES", dnnl_huge_pages_none);
+        const bool is_valid = val == dnnl_huge_pages_transparent
+                || val == dnnl_huge_pages_hugetlb;
+        huge_pages_mode.set(is_valid ? static_cast<dnnl_huge_pages_mode_t>(val)
+                                     : dnnl_huge_pages_none);
+    }
+    return huge_pages_mode.get();
+}
+
+#ifdef __linux__
+namespace {
+// Reads the first number following the prefix in a line of the file, or
+// returns 0.
+size_t read_size_from_file(const char *filename, const char *prefix) {
+    FILE *fp = ::fopen(filename, "r");
+    if (!fp) return 0;
+    const size_t prefix_len = strlen(prefix);
+    unsigned long long val = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), fp)) {
+        if (strncmp(line, prefix, prefix_len) != 0) continue;
+        if (sscanf(line + prefix_len, "%llu", &val) != 1) val = 0;
+        break;
+    }
+    fclose(fp);
+    return static_cast<size_t>(val);
+}
+
+// The size of a transparent huge page, 0 if they are not supported
+size_t get_transparent_huge_page_size() {
+    static const size_t size = read_size_from_file(
+            "/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "");
+    return size;
+}
+
+// The default size of the pages of the huge pages pool, 0 if not supported
+size_t get_hugetlb_page_size() {
+    static const size_t size
+            = read_size_from_file("/proc/meminfo", "Hugepagesize:") * 1024;
+    return size;
+}
+
+// The buffers mapped from the huge pages pool and their sizes. The map is
+// never destroyed, as buffers can be released at the program exit.
+std::mutex &hugetlb_buffers_mutex() {
+    static std::mutex m;
+    return m;
+}
+std::unordered_map<void *, size_t> &hugetlb_buffers() {
+    static auto *buffers = new std::unordered_map<void *, size_t>();
+    return *buffers;
+}
+std::atomic<bool> has_hugetlb_buffers {false};
+} // namespace
+#endif
+
+void *malloc_large(size_t size, int alignment) {
+#ifdef __linux__
+    const auto mode = get_huge_pages_mode();
+    if (mode != dnnl_huge_pages_none && !memory_debug::is_mem_debug()) {
+        const size_t hugetlb_page = get_hugetlb_page_size();
+        if (mode == dnnl_huge_pages_hugetlb && hugetlb_page > 0
+                && size >= hugetlb_page) {
+            const size_t len = utils::rnd_up(size, hugetlb_page);
+            void *ptr = ::mmap(nullptr, len, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (ptr != MAP_FAILED) {
+                std::lock_guard<std::mutex> lock(hugetlb_buffers_mutex());
+                hugetlb_buffers()[ptr] = len;
+                has_hugetlb_buffers = true;
+                return ptr;
+            }
+        }
+
+        const size_t thp_page = get_transparent_huge_page_size();
+        if (thp_page > 0 && size >= thp_page) {
+            const size_t len = utils::rnd_up(size, thp_page);
+            void *ptr = nullptr;
+            if (::posix_memalign(&ptr, thp_page, len) == 0) {
+                // the advice is best effort, the buffer is valid anyway
+                ::madvise(ptr, len, MADV_HUGEPAGE);
+                return ptr;
+            }
+        }
+    }
+#endif
+    return malloc(size, alignment);
+}
+
+void free_large(void *p) {
+#ifdef __linux__
+    if (p && has_hugetlb_buffers) {
+        std::lock_guard<std::mutex> lock(hugetlb_buffers_mutex());
+        auto &buffers = hugetlb_buffers();
+        const auto it = buffers.find(p);
+        if (it != buffers.end()) {
+            ::munmap(p, it->second);
+            buffers.erase(it);
+            return;
+        }
+    }
+#endif
+    free(p);
+}
+
 // Atomic operations
 int32_t fetch_and_add(int32_t *dst, int32_t val) {
 #ifdef _WIN32
@@ -354,6 +470,22 @@ dnnl_status_t dnnl_set_jit_dump(int enabled) {
     return status::success;
 }
 
+dnnl_status_t dnnl_set_huge_pages_mode(dnnl_huge_pages_mode_t mode) {
+    using namespace dnnl::impl;
+    if (!utils::one_of(mode, dnnl_huge_pages_none, dnnl_huge_pages_transparent,
+                dnnl_huge_pages_hugetlb))
+        return status::invalid_arguments;
+#ifndef __linux__
+    if (mode != dnnl_huge_pages_none) return status::unimplemented;
+#endif
+    huge_pages_mode.set(mode);
+    return status::success;
+}
+
+dnnl_huge_pages_mode_t dnnl_get_huge_pages_mode() {
+    return dnnl::impl::get_huge_pages_mode();
+}
+
 dnnl_status_t dnnl_set_jit_profiling_flags(unsigned flags) {
     using namespace dnnl::impl;
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2016 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -671,7 +672,7 @@ inline bool validate_dims(int ndims, const dims_t dims) {
 
 int32_t fetch_and_add(int32_t *dst, int32_t val);
 inline void yield_thread() {}
-bool is_destroying_cache_safe();
+bool DNNL_API is_destroying_cache_safe();
 
 // Reads an environment variable 'name' and stores its string value in the
 // 'buffer' of 'buffer_size' bytes (including the terminating zero) on
@@ -763,6 +764,13 @@ private:
     using std::ostringstream::imbue;
 };
 
+// Allocates a buffer backed by huge pages according to the huge pages mode
+// if it spans at least one huge page, and falls back to malloc() otherwise.
+// The buffer must be released with free_large().
+void *malloc_large(size_t size, int alignment);
+void free_large(void *p);
+dnnl_huge_pages_mode_t get_huge_pages_mode();
+
 // Various getter for profiling info
 bool get_jit_dump();
 unsigned get_jit_profiling_flags();
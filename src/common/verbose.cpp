@@ -41,6 +41,7 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "embedding_bag_pd.hpp"
 #include "gated_mlp_pd.hpp"
 #include "gemm_pd.hpp"
 #include "group_normalization_pd.hpp"
@@ -48,6 +49,7 @@
 #include "layer_normalization_pd.hpp"
 #include "lrn_pd.hpp"
 #include "matmul_pd.hpp"
+#include "optimizer_pd.hpp"
 #include "pooling_pd.hpp"
 #include "prelu_pd.hpp"
 #include "reduction_pd.hpp"
@@ -58,6 +60,7 @@
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
+#include "topk_pd.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "common/dnnl_thread.hpp"
@@ -192,7 +195,12 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
             if (s == "0" || s == "none") k = verbose_t::none;
             if (s == "1") k |= verbose_t::level1;
             if (s == "2") k |= verbose_t::level2;
-            if (s == "all" || s == "-1") k |= verbose_t::all;
+            // Hardware counters add overhead to every execution and tracing
+            // writes a file, so they are enabled only when requested
+            // explicitly
+            if (s == "all" || s == "-1")
+                k |= verbose_t::all & ~verbose_t::profile_pmu
+                        & ~verbose_t::exec_trace;
             if (s == "error") k |= verbose_t::error;
             if (s == "check")
                 k |= verbose_t::create_check | verbose_t::exec_check;
@@ -204,6 +212,9 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
             // Enable profiling to external libraries
             if (s == "profile_externals") k |= verbose_t::profile_externals;
             if (s == "warn") k |= verbose_t::warn;
+            if (s == "profile_pmu")
+                k |= verbose_t::exec_profile | verbose_t::profile_pmu;
+            if (s == "trace") k |= verbose_t::exec_trace;
             // we extract debug info debuginfo=XX. ignore if debuginfo is invalid.
             if (s.rfind("debuginfo=", 0) == 0)
                 k |= verbose_t::make_debuginfo(
@@ -291,12 +302,25 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
     }
 
     int result = verbose.get() & verbosity_kind;
+    // Tracing collects the execution profile without printing it
+    if ((verbosity_kind & verbose_t::exec_profile)
+            && (verbose.get() & verbose_t::exec_trace))
+        result |= verbose_t::exec_profile;
     if (verbosity_kind == verbose_t::debuginfo)
         result = verbose_t::get_debuginfo(verbose.get());
     bool filter_result = flags & filter_kind;
     return filter_result ? result : 0;
 }
 
+bool get_verbose_printed(verbose_t::flag_kind kind) noexcept {
+#if defined(DISABLE_VERBOSE)
+    return false;
+#endif
+    // The flags are initialized by the get_verbose() call that guards the
+    // message
+    return verbose.get() & kind;
+}
+
 static setting_t<bool> verbose_timestamp {false};
 bool get_verbose_timestamp() {
 #if defined(DISABLE_VERBOSE)
@@ -376,6 +400,7 @@ std::string normalization_flags2str(unsigned flags) {
 std::string rnn_flags2str(unsigned flags) {
     std::string s;
     if (flags & rnn_flags::diff_weights_overwrite) s += "O";
+    if (flags & rnn_flags::stateful) s += "S";
     return s;
 }
 
@@ -739,6 +764,13 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
         ss << field_delim() << "attr-deterministic:" << deterministic;
     }
 
+    const dispatch_hint_t &dh = attr->dispatch_hint_;
+    if (!dh.has_default_values()) {
+        ss << field_delim()
+           << "attr-dispatch:" << dnnl_dispatch_goal2str(dh.goal_);
+        if (dh.max_threads_ > 0) ss << ":" << dh.max_threads_;
+    }
+
     // Fast exit if rest attributes were not specified.
     if (attr->has_default_values()) return ss;
 
@@ -1052,6 +1084,30 @@ std::string init_info_eltwise(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_embedding_bag(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << md2fmt_str("src", pd->arg_md(DNNL_ARG_SRC), format_kind::undef)
+       << " ";
+    ss << md2fmt_str("indices", pd->arg_md(DNNL_ARG_EMBEDDING_INDICES),
+            format_kind::undef)
+       << " ";
+    ss << md2fmt_str("offsets", pd->arg_md(DNNL_ARG_EMBEDDING_OFFSETS),
+            format_kind::undef)
+       << " ";
+    ss << md2fmt_str("dst", pd->arg_md(DNNL_ARG_DST), format_kind::undef);
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->alg_kind() << ",";
+    ss << "rows" << pd->n_rows() << "d" << pd->emb_dim() << "bags"
+       << pd->n_bags() << "indices" << pd->n_indices();
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_gated_mlp(const engine_t *e, const pd_t *pd) {
     stringstream_t ss;
@@ -1305,6 +1361,35 @@ std::string init_info_matmul(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_optimizer(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    // The tensors of a launch usually share their layout: only the first
+    // one is printed.
+    ss << md2fmt_str("param", pd->dst_md(0), format_kind::undef) << " ";
+    ss << md2fmt_str("grad", pd->src_md(1), format_kind::undef);
+    if (pd->with_param_copy())
+        ss << " " << md2fmt_str("copy", pd->dst_md(3), format_kind::undef);
+
+    const char *alg = pd->alg() == dnnl_optimizer_sgd_momentum ? "sgd_momentum"
+            : pd->alg() == dnnl_optimizer_adam                 ? "adam"
+                                                               : "adamw";
+    const auto *desc = pd->desc();
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << alg << " beta1:" << desc->beta1
+       << " beta2:" << desc->beta2 << " eps:" << desc->epsilon
+       << " wd:" << desc->weight_decay << ",";
+    dim_t nelems = 0;
+    for (int i = 0; i < pd->n_tensors(); i++)
+        nelems += memory_desc_wrapper(pd->dst_md(4 * i)).nelems();
+    ss << "tensors" << pd->n_tensors() << "elems" << nelems;
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_pooling(const engine_t *e, const pd_t *pd) {
     stringstream_t ss;
@@ -1617,6 +1702,27 @@ std::string init_info_sum(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_topk(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << md2fmt_str("src", pd->arg_md(DNNL_ARG_SRC), format_kind::undef)
+       << " ";
+    ss << md2fmt_str("dst", pd->arg_md(DNNL_ARG_DST), format_kind::undef)
+       << " ";
+    ss << md2fmt_str(
+            "indices", pd->arg_md(DNNL_ARG_TOPK_INDICES), format_kind::undef);
+
+    ss << "," << pd->attr() << ",";
+    if (pd->with_softmax()) ss << "softmax:" << pd->temperature();
+    ss << ",";
+    ss << md2dim_str(pd->src_md()) << ":k" << pd->k();
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
     stringstream_t ss;
@@ -1637,6 +1743,17 @@ std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
         ss << md2fmt_str("msk", desc->attn_mask_md(),
                 pd->invariant_src_user_format_kind(3))
            << " ";
+    if (pd->with_kv_paging())
+        ss << md2fmt_str("kv_page_table", desc->kv_page_table_md(),
+                pd->invariant_src_user_format_kind(4))
+           << " ";
+    if (pd->with_varlen())
+        ss << md2fmt_str("q_seq_offsets", desc->q_seq_offsets_md(),
+                pd->invariant_src_user_format_kind(5))
+           << " "
+           << md2fmt_str("kv_seq_offsets", desc->kv_seq_offsets_md(),
+                      pd->invariant_src_user_format_kind(6))
+           << " ";
     ss << md2fmt_str("dst", pd->dst_md(), pd->invariant_dst_user_format_kind())
        << ",";
 
@@ -1832,6 +1949,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
             CASE(gated_mlp);
             CASE(gemm);
             CASE(group_normalization);
@@ -1839,6 +1957,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(layer_normalization);
             CASE(lrn);
             CASE(matmul);
+            CASE(optimizer);
             CASE(pooling);
             CASE(prelu);
             CASE(reduction);
@@ -1848,6 +1967,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(shuffle);
             CASE(softmax);
             CASE(sum);
+            CASE(topk);
             CASE(sdpa);
             case primitive_kind::zero_pad:
               str_ = "zero_pad, unknown info";
@@ -24,12 +24,14 @@
 #include <stdio.h>
 
 #include "c_types_map.hpp"
+#include "dispatch_report.hpp"
 #include "oneapi/dnnl/dnnl_debug.h"
 #include "utils.hpp"
 #include "z_magic.hpp"
 
 #include "profiler.hpp"
 #include "verbose_msg.hpp"
+#include "verbose_trace.hpp"
 
 #ifdef DNNL_EXPERIMENTAL_LOGGING
 #include "common/logging.hpp"
@@ -101,7 +103,8 @@ static inline int format_type_checker(const char *, ...) {
                 stamp_.c_str(), logsubtype, ##__VA_ARGS__); \
     } while (0)
 
-// Logging info
+// Logging info. Dispatch messages are also passed to the dispatch report of
+// the calling thread (see dispatch_report.hpp).
 #define VINFO(apitype, logtype, logsubtype, component, msg, ...) \
     do { \
         if (dnnl::impl::get_verbose( \
@@ -111,6 +114,11 @@ static inline int format_type_checker(const char *, ...) {
                     logtype, VERBOSE_##logsubtype, \
                     #component "," msg ",%s:%d", ##__VA_ARGS__, __FILENAME__, \
                     __LINE__); \
+        if (dnnl::impl::verbose_t::logtype##_##logsubtype \
+                        == dnnl::impl::verbose_t::create_dispatch \
+                && dnnl::impl::dispatch_report_records_reasons()) \
+            dnnl::impl::dispatch_report_note(#component "," msg ",%s:%d", \
+                    ##__VA_ARGS__, __FILENAME__, __LINE__); \
     } while (0)
 
 // Per-primitive VDISPATCH_<PRIM>{,_SC,_IC} wrappers (in <primitive>_pd.hpp) are
@@ -177,15 +185,21 @@ static inline int format_type_checker(const char *, ...) {
 // Special syntactic sugar for logging performance
 // NOTE: the VPROF macro does not check for verbose flags, it is the
 // responsibility of the caller to check those (it should happen
-// anyway to condition collecting stamp/duration)
+// anyway to condition collecting stamp/duration). Execution spans are also
+// recorded in the trace when ONEDNN_VERBOSE=trace is set.
 #define VPROF(stamp, apitype, logtype, logsubtype, info, duration) \
     { \
         auto flag = dnnl::impl::verbose_t::exec_profile; \
         if (strcmp(#logtype, "create") == 0 \
                 || strcmp(#logtype, "create_nested") == 0) \
             flag = dnnl::impl::verbose_t::create_profile; \
-        VFORMAT(stamp, flag, apitype, logtype, logsubtype, "%s,%g", info, \
-                duration); \
+        if (flag == dnnl::impl::verbose_t::exec_profile \
+                && dnnl::impl::get_verbose(dnnl::impl::verbose_t::exec_trace)) \
+            dnnl::impl::verbose_trace::record( \
+                    CONCAT2(VERBOSE_, apitype), info, stamp, duration); \
+        if (dnnl::impl::get_verbose_printed(flag)) \
+            VFORMAT(stamp, flag, apitype, logtype, logsubtype, "%s,%g", info, \
+                    duration); \
     }
 
 struct verbose_t {
@@ -202,6 +216,8 @@ struct verbose_t {
         exec_profile = 1 << 7,
         profile_externals = 1 << 8,
         warn = 1 << 9,
+        profile_pmu = 1 << 10,
+        exec_trace = 1 << 11,
         // the upper 8 bits are reserved for devinfo levels
         debuginfo = 1 << 24,
         //
@@ -271,6 +287,11 @@ inline component_t::flag_kind prim_kind2_comp_kind(
 uint32_t get_verbose(verbose_t::flag_kind kind = verbose_t::none,
         component_t::flag_kind filter_kind = component_t::all) noexcept;
 
+// Returns whether messages of a kind are printed. Execution profiling is
+// reported as enabled by get_verbose() when only tracing is requested, so
+// VPROF uses it to record the spans without printing them.
+bool get_verbose_printed(verbose_t::flag_kind kind) noexcept;
+
 // Helper to avoid #ifdefs for DNNL_DEV_MODE related logging
 static inline uint32_t get_verbose_dev_mode(
         verbose_t::flag_kind kind = verbose_t::none) {
@@ -296,6 +317,7 @@ get_verbose_to_log_level_map() {
                     {verbose_t::create_profile, log_manager_t::info},
                     {verbose_t::profile_externals, log_manager_t::info},
                     {verbose_t::exec_profile, log_manager_t::info},
+                    {verbose_t::profile_pmu, log_manager_t::info},
                     {verbose_t::exec_check, log_manager_t::error},
                     {verbose_t::error, log_manager_t::critical},
                     {verbose_t::warn, log_manager_t::warn},
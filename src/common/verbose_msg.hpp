@@ -39,6 +39,7 @@
 #define VERBOSE_debug ":debug"
 #define VERBOSE_profile ""
 #define VERBOSE_external ":external"
+#define VERBOSE_pmu ":pmu"
 
 // verbose messages
 #define VERBOSE_PROFILING_UNSUPPORTED "profiling capabilities are not supported"
@@ -0,0 +1,150 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/utils.hpp"
+#include "common/verbose_trace.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace verbose_trace {
+
+namespace {
+
+// Spans kept per thread, older spans are overwritten
+constexpr size_t max_thread_events = 1 << 14;
+
+struct event_t {
+    const char *category;
+    std::string name;
+    double start_ms;
+    double duration_ms;
+};
+
+// Only the owning thread writes to a buffer. Buffers are read when the
+// library is unloaded, after the threads are done with the library.
+struct thread_buffer_t {
+    thread_buffer_t(int tid) : tid(tid) {}
+
+    void record(const char *category, const char *name, double start_ms,
+            double duration_ms) {
+        if (events.size() < max_thread_events) {
+            events.push_back({category, name, start_ms, duration_ms});
+        } else {
+            // The strings of overwritten events are reused, so a full
+            // buffer does not allocate anymore for names of similar length
+            event_t &e = events[n_recorded % max_thread_events];
+            e.category = category;
+            e.name.assign(name);
+            e.start_ms = start_ms;
+            e.duration_ms = duration_ms;
+        }
+        n_recorded++;
+    }
+
+    int tid;
+    size_t n_recorded = 0;
+    std::vector<event_t> events;
+};
+
+void write_json_string(FILE *f, const std::string &s) {
+    fputc('"', f);
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            fprintf(f, "\\%c", c);
+        else if (static_cast<unsigned char>(c) < 0x20)
+            fprintf(f, "\\u%04x", c);
+        else
+            fputc(c, f);
+    }
+    fputc('"', f);
+}
+
+// Owns the buffers of all the threads, including the ones that exited, and
+// writes them out when it is destroyed at exit
+class registry_t {
+public:
+    registry_t() : file_name_(getenv_string_user("TRACE_FILE")) {
+        if (file_name_.empty()) file_name_ = "onednn_trace.json";
+    }
+
+    ~registry_t() { write(); }
+
+    thread_buffer_t *add_thread() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        const int tid = static_cast<int>(buffers_.size());
+        buffers_.emplace_back(new thread_buffer_t(tid));
+        return buffers_.back().get();
+    }
+
+private:
+    void write() const {
+        FILE *f = fopen(file_name_.c_str(), "w");
+        if (!f) return;
+
+        fprintf(f, "{\"traceEvents\":[");
+        bool first = true;
+        for (const auto &b : buffers_) {
+            fprintf(f,
+                    "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                    "\"tid\":%d,\"args\":{\"name\":\"onednn thread %d\"}}",
+                    first ? "" : ",", b->tid, b->tid);
+            first = false;
+            for (const auto &e : b->events) {
+                fprintf(f, ",\n{\"name\":");
+                write_json_string(f, e.name);
+                fprintf(f,
+                        ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+                        "\"dur\":%.3f,\"pid\":0,\"tid\":%d}",
+                        e.category, 1e3 * e.start_ms, 1e3 * e.duration_ms,
+                        b->tid);
+            }
+        }
+        fprintf(f, "\n]}\n");
+        fclose(f);
+    }
+
+    std::string file_name_;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<thread_buffer_t>> buffers_;
+};
+
+registry_t &registry() {
+    static registry_t r;
+    return r;
+}
+
+} // namespace
+
+void record(const char *category, const char *name, double start_ms,
+        double duration_ms) {
+    // A raw pointer keeps the thread_local trivially constructible, the
+    // buffer itself is owned by the registry
+    static thread_local thread_buffer_t *buffer = nullptr;
+    if (!buffer) buffer = registry().add_thread();
+    buffer->record(category, name, start_ms, duration_ms);
+}
+
+} // namespace verbose_trace
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
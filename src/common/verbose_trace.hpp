@@ -0,0 +1,45 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_VERBOSE_TRACE_HPP
+#define COMMON_VERBOSE_TRACE_HPP
+
+namespace dnnl {
+namespace impl {
+namespace verbose_trace {
+
+// Records a span of the calling thread for ONEDNN_VERBOSE=trace.
+//
+// Spans are kept in a per-thread ring buffer, so recording does not take any
+// lock and does not print anything. When a buffer is full the oldest spans
+// of the thread are overwritten. All the buffers are written at exit in the
+// Chrome trace event format to the file set by ONEDNN_TRACE_FILE, which can
+// be opened with Perfetto or chrome://tracing.
+//
+// @param category Kind of span ("primitive", "graph", "ukernel")
+// @param name Span name, copied by the call
+// @param start_ms Start timestamp in milliseconds as returned by get_msec()
+// @param duration_ms Duration in milliseconds
+void record(const char *category, const char *name, double start_ms,
+        double duration_ms);
+
+} // namespace verbose_trace
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -192,7 +192,7 @@ status_t acl_binary_t::init(engine_t *engine) {
 status_t acl_binary_t::execute_forward(const exec_ctx_t &ctx, const void *src0,
         const void *src1, void *dst) const {
 
-    auto asp = pd()->asp_;
+    const auto &asp = pd()->asp_;
 
     arm_compute::Tensor src0_tensor;
     arm_compute::Tensor src1_tensor;
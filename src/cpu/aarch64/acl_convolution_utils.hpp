@@ -127,7 +127,7 @@ status_t execute_forward_conv_acl(const exec_ctx_t &ctx,
     arm_compute::Tensor bia_tensor = nullptr;
     arm_compute::Tensor dst_tensor;
 
-    auto const acp = pd->acp_;
+    const auto &acp = pd->acp_;
     src_tensor.allocator()->init(acp.src_tensor_info);
     wei_tensor.allocator()->init(acp.wei_tensor_info);
     dst_tensor.allocator()->init(acp.dst_tensor_info);
@@ -162,7 +162,7 @@ status_t execute_forward_conv_acl(const exec_ctx_t &ctx,
     pack.add_tensor(arm_compute::TensorType::ACL_DST, &dst_tensor);
 
     // Get temp workspaces.
-    const auto aux_mem = acl_conv_obj->aux_mem_req;
+    const auto &aux_mem = acl_conv_obj->aux_mem_req;
 
     // Hold onto tmp tensors while we need pack.
     std::vector<arm_compute::Tensor> tmp_tensors(aux_mem.size());
@@ -81,7 +81,6 @@ status_t acl_gemm_convolution_fwd_t<src_t, wei_t, dst_t, bia_t>::pd_t::init(
             acp_.dilation_info, acp_.act_info, acp_.fast_math);
 
     auto scratchpad = scratchpad_registry().registrar();
-    const auto mem_req = conv.workspace();
     return init_scratchpad(conv, scratchpad, gemm_conv_keys, engine, post_ops,
             attr_.post_ops_, acp_.act_info, acp_.use_dst_acc_for_sum, dst_md_);
 }
@@ -90,7 +89,7 @@ template <data_type_t src_t, data_type_t wei_t, data_type_t dst_t,
         data_type_t bia_t>
 status_t acl_gemm_convolution_fwd_t<src_t, wei_t, dst_t, bia_t>::init(
         engine_t *engine) {
-    auto acp_ = pd()->acp_;
+    const auto &acp_ = pd()->acp_;
     acl_obj_->conv.configure(&acp_.src_tensor_info, &acp_.wei_tensor_info,
             acp_.with_bias ? &acp_.bia_tensor_info : nullptr,
             &acp_.dst_tensor_info, acp_.padstride_info, acp_.weights_info,
@@ -16,13 +16,52 @@
 
 #include "cpu/aarch64/acl_inner_product.hpp"
 
+#include <map>
+#include <vector>
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
 namespace aarch64 {
 
+namespace {
+// Keys are anonymous. So deduce the type automagically.
+using ip_key_t = decltype(memory_tracking::names::key_gemm_tmp_buffer);
+
+// Map: [slot , key]
+// These correspond to the information provided by
+// CpuFullyConnected::workspace(), which specifies a unique numbered slot for
+// each key.
+const std::map<int, ip_key_t> ip_keys
+        = {{0, ip_key_t::key_gemm_asm_tmp_buffer},
+                {1, ip_key_t::key_gemm_pretranspose_b},
+                {2, ip_key_t::key_gemm_pretranspose},
+                {3, ip_key_t::key_gemm_interleaved_lhs},
+                {4, ip_key_t::key_gemm_pretransposed_rhs},
+                {5, ip_key_t::key_gemm_transposed_1xwrhs},
+                {6, ip_key_t::key_gemm_tmp_buffer},
+                {7, ip_key_t::key_gemm_mm_result_s32},
+                {8, ip_key_t::key_gemm_mm_signed_a},
+                {9, ip_key_t::key_gemm_mm_signed_output},
+                {10, ip_key_t::key_conv_gemm_col},
+                {11, ip_key_t::key_conv_permuted_weights},
+                {12, ip_key_t::key_gemm_output}};
+
+// Persistent workspaces, e.g. the weights reshaped once when the operator is
+// prepared, must outlive an execution, so ACL keeps them. The others are
+// taken from the scratchpad instead of being allocated on every execution.
+bool is_scratchpad_mem(
+        const arm_compute::experimental::MemoryRequirements &aux_mem_req,
+        int id) {
+    return id < static_cast<int>(aux_mem_req.size())
+            && aux_mem_req[id].size > 0
+            && aux_mem_req[id].lifetime
+            != arm_compute::experimental::MemoryLifetime::Persistent;
+}
+} // namespace
+
 status_t acl_inner_product_fwd_t::init(engine_t *engine) {
-    auto aip = pd()->aip_;
+    const auto &aip = pd()->aip_;
     inner_product_op_ = std::make_unique<
             arm_compute::experimental::op::CpuFullyConnected>();
 
@@ -30,6 +69,7 @@ status_t acl_inner_product_fwd_t::init(engine_t *engine) {
     inner_product_op_->configure(&aip.src_tensor_info, &aip.wei_tensor_info,
             aip.with_bias ? &aip.bia_tensor_info : nullptr,
             &aip.dst_tensor_info, aip.fc_info, aip.weights_info);
+    aux_mem_req_ = inner_product_op_->workspace();
 
     return status::success;
 }
@@ -58,7 +98,7 @@ status_t acl_inner_product_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
             ? scratchpad.get<void>(memory_tracking::names::key_generic_acc)
             : CTX_OUT_MEM(void *, DNNL_ARG_DST);
 
-    auto aip = pd()->aip_;
+    const auto &aip = pd()->aip_;
     arm_compute::Tensor src_tensor;
     arm_compute::Tensor wei_tensor;
     arm_compute::Tensor bia_tensor = nullptr;
@@ -83,6 +123,21 @@ status_t acl_inner_product_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
             {arm_compute::TensorType::ACL_BIAS, &bia_tensor},
             {arm_compute::TensorType::ACL_DST, &dst_tensor}};
 
+    // Hold onto tmp tensors while we need the pack. import_memory() only
+    // acquires the scratchpad pointers.
+    std::vector<arm_compute::Tensor> tmp_tensors(aux_mem_req_.size());
+    for (const auto &key : ip_keys) {
+        const auto id = key.first;
+        if (!is_scratchpad_mem(aux_mem_req_, id)) continue;
+        const auto info = arm_compute::TensorInfo(
+                arm_compute::TensorShape(aux_mem_req_[id].size), 1,
+                arm_compute::DataType::U8);
+        tmp_tensors[id].allocator()->init(info, aux_mem_req_[id].alignment);
+        tmp_tensors[id].allocator()->import_memory(
+                scratchpad.get<void>(key.second));
+        run_pack.add_tensor(aux_mem_req_[id].slot, &tmp_tensors[id]);
+    }
+
     inner_product_op_->run(run_pack);
 
     void *dst = dst_tensor.buffer();
@@ -114,9 +169,23 @@ status_t acl_inner_product_fwd_t::pd_t::init(engine_t *engine) {
 
     CHECK(init_conf_ip(engine, weights_format_kind_received));
 
+    auto scratchpad = scratchpad_registry().registrar();
+
+    // The workspace is only known once the operator is configured
+    arm_compute::experimental::op::CpuFullyConnected ip_op;
+    ip_op.configure(&aip_.src_tensor_info, &aip_.wei_tensor_info,
+            aip_.with_bias ? &aip_.bia_tensor_info : nullptr,
+            &aip_.dst_tensor_info, aip_.fc_info, aip_.weights_info);
+    const auto aux_mem_req = ip_op.workspace();
+    for (const auto &key : ip_keys) {
+        const auto id = key.first;
+        if (!is_scratchpad_mem(aux_mem_req, id)) continue;
+        scratchpad.book(key.second, aux_mem_req[id].size, 1,
+                aux_mem_req[id].alignment, aux_mem_req[id].alignment);
+    }
+
     if (aip_.use_dst_acc_for_sum) {
         const memory_desc_wrapper dst_d(&dst_md_);
-        auto scratchpad = scratchpad_registry().registrar();
         scratchpad.book(memory_tracking::names::key_generic_acc, dst_d.nelems(),
                 dst_d.data_type_size());
     }
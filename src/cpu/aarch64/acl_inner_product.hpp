@@ -73,6 +73,7 @@ private:
     }
     std::unique_ptr<arm_compute::experimental::op::CpuFullyConnected>
             inner_product_op_;
+    arm_compute::experimental::MemoryRequirements aux_mem_req_;
 }; // acl_inner_product_fwd_t
 
 } // namespace aarch64
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/aarch64/acl_omp_scheduler.hpp"
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+
+#include <algorithm>
+
+#include "common/dnnl_thread.hpp"
+#include "cpu/aarch64/acl_thread.hpp"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace arm_compute;
+
+namespace {
+// Bound on the number of threads, per calling thread so that a stream
+// limiting its threads doesn't limit the ones running concurrently
+thread_local unsigned int max_threads = 0;
+} // namespace
+
+void omp_scheduler_t::set_num_threads(unsigned int num_threads) {
+    max_threads = num_threads;
+}
+
+unsigned int omp_scheduler_t::num_threads() const {
+    // Returns 1 inside of a parallel region, so nested calls run inline
+    const unsigned int cur_threads = dnnl_get_current_num_threads();
+    return max_threads == 0 ? cur_threads : std::min(max_threads, cur_threads);
+}
+
+void omp_scheduler_t::schedule(ICPPKernel *kernel, const Hints &hints) {
+    ITensorPack tensors;
+    schedule_common(kernel, hints, kernel->window(), tensors);
+}
+
+void omp_scheduler_t::schedule_op(ICPPKernel *kernel, const Hints &hints,
+        const Window &window, ITensorPack &tensors) {
+    schedule_common(kernel, hints, window, tensors);
+}
+
+void omp_scheduler_t::run_workloads(std::vector<Workload> &workloads) {
+    const unsigned int nthr_req = std::min(
+            num_threads(), static_cast<unsigned int>(workloads.size()));
+    if (nthr_req < 1) return;
+
+    acl_thread_utils::ThreadFeeder feeder(nthr_req, workloads.size());
+    if (nthr_req == 1) {
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        info.num_threads = 1;
+        info.thread_id = 0;
+        acl_thread_utils::process_workloads(workloads, feeder, info);
+        return;
+    }
+
+    parallel(static_cast<int>(nthr_req), [&](int ithr, int nthr) {
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        info.num_threads = nthr;
+        info.thread_id = ithr;
+        // The OpenMP runtime may give a smaller team than requested, so the
+        // first workloads of the missing threads are taken by the others
+        for (int i = ithr + nthr; i < static_cast<int>(nthr_req); i += nthr)
+            workloads[i](info);
+        acl_thread_utils::process_workloads(workloads, feeder, info);
+    });
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
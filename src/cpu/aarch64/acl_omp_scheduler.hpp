@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_ACL_OMP_SCHEDULER_HPP
+#define CPU_AARCH64_ACL_OMP_SCHEDULER_HPP
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+
+#include "arm_compute/runtime/IScheduler.h"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// OpenMP scheduler for Compute Library that takes the number of threads from
+// the calling context on every execution instead of fixing it once when the
+// scheduler is created. This way primitives executed from different OpenMP
+// teams, e.g. after omp_set_num_threads() or from nested parallel regions,
+// use as many threads as the native implementations would. The scheduler has
+// no state shared between calling threads, so the single instance installed
+// in Compute Library serves concurrent streams, each one with its own team.
+class omp_scheduler_t final : public arm_compute::IScheduler {
+public:
+    omp_scheduler_t() = default;
+    ~omp_scheduler_t() override = default;
+
+    /// Sets an upper bound on the number of threads of the calling thread, 0
+    /// removes the bound.
+    void set_num_threads(unsigned int num_threads) override;
+    /// Returns the number of threads available to the calling thread,
+    /// limited by the bound set with set_num_threads().
+    unsigned int num_threads() const override;
+
+    void schedule(arm_compute::ICPPKernel *kernel,
+            const arm_compute::IScheduler::Hints &hints) override;
+    void schedule_op(arm_compute::ICPPKernel *kernel,
+            const arm_compute::IScheduler::Hints &hints,
+            const arm_compute::Window &window,
+            arm_compute::ITensorPack &tensors) override;
+
+protected:
+    void run_workloads(std::vector<Workload> &workloads) override;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+
+#endif // CPU_AARCH64_ACL_OMP_SCHEDULER_HPP
@@ -258,7 +258,7 @@ status_t acl_pooling_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
 
     void *ws_base;
 
-    auto asp = pd()->asp_;
+    const auto &asp = pd()->asp_;
 
     arm_compute::Tensor src_tensor;
     arm_compute::Tensor dst_tensor;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2022-2024 Arm Ltd. and affiliates
+* Copyright 2022-2024,2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,7 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "common/dnnl_thread.hpp"
 #include "common/float16.hpp"
+#include "cpu/binary_injector_utils.hpp"
+
 #include "cpu/aarch64/acl_gemm_convolution.hpp"
 
 namespace dnnl {
@@ -34,6 +37,24 @@ status_t acl_post_ops_t::execute(
     // Sum post-op requires distinct src and dst buffers.
     if (has_sum() && dst == src) { return status::runtime_error; }
 
+    if (fused_kernel_) {
+        const auto rhs_arg_vec = binary_injector_utils::prepare_binary_args(
+                fused_post_ops_, ctx, post_op_start_index_);
+        const dim_t nelems = memory_desc_wrapper(dst_md_).nelems(true);
+        // Each block goes through the whole chain while it is in cache. The
+        // blocks are made of whole vectors, except for the last one.
+        const dim_t block = 16384;
+        parallel_nd(utils::div_up(nelems, block), [&](dim_t i) {
+            jit_uni_post_ops_args_t args;
+            args.dst = static_cast<float *>(src) + i * block;
+            args.nelems = nstl::min(block, nelems - i * block);
+            args.post_ops_binary_rhs_arg_vec = rhs_arg_vec.data();
+            args.dst_orig = src;
+            (*fused_kernel_)(&args);
+        });
+        return status::success;
+    }
+
     for (auto &post_op : post_op_primitives) {
         if (post_op->kind() == primitive_kind::binary) {
             auto binary_post_op = dynamic_cast<acl_binary_t *>(post_op.get());
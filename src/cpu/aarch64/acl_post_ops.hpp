@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2022-2024 Arm Ltd. and affiliates
+* Copyright 2022-2024,2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -17,8 +17,11 @@
 #ifndef CPU_AARCH64_ACL_POST_OPS_HPP
 #define CPU_AARCH64_ACL_POST_OPS_HPP
 
+#include <memory>
+
 #include "cpu/aarch64/acl_binary.hpp"
 #include "cpu/aarch64/acl_eltwise.hpp"
+#include "cpu/aarch64/jit_uni_post_ops_kernel.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -42,6 +45,24 @@ struct acl_post_ops_t {
         // Reset properties derived from post_ops
         sum_index = -1;
         post_op_primitives = {};
+        fused_post_ops_ = post_ops_t();
+        fused_kernel_.reset();
+
+        // Without a sum, the whole chain is applied by a single pass over
+        // dst, instead of a separate primitive reading and writing dst for
+        // each post op
+        post_ops_t chain;
+        for (int i = post_op_start_index; i < post_ops.len(); i++)
+            chain.entry_.push_back(post_ops.entry_[i]);
+        if (jit_uni_post_ops_kernel_base_t::post_ops_ok(chain, dst_md)) {
+            std::unique_ptr<jit_uni_post_ops_kernel_base_t> kernel;
+            CHECK(jit_uni_post_ops_kernel_base_t::create(
+                    kernel, chain, dst_md));
+            fused_kernel_ = std::move(kernel);
+            fused_post_ops_ = chain;
+            dst_md_ = dst_md;
+            return status::success;
+        }
 
         for (int i = post_op_start_index; i < post_ops.len(); i++) {
             auto &po = post_ops.entry_[i];
@@ -176,6 +197,11 @@ private:
     // in init to be either acl_binary_t (for sum, add, sub, div, mul, min and
     // max) or acl_eltwise_fwd_t (for relu, elu, tanh, square, abs etc)
     std::vector<std::shared_ptr<primitive_t>> post_op_primitives;
+    // The post ops applied by fused_kernel_ instead of post_op_primitives,
+    // starting from post_op_start_index_
+    post_ops_t fused_post_ops_;
+    std::shared_ptr<jit_uni_post_ops_kernel_base_t> fused_kernel_;
+    memory_desc_t dst_md_;
 };
 
 } // namespace aarch64
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2021-2024 Arm Ltd. and affiliates
+* Copyright 2021-2024, 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -27,7 +27,7 @@ const acl_softmax_fwd_t::pd_t *acl_softmax_fwd_t::pd() const {
 
 status_t acl_softmax_fwd_t::pd_t::init(engine_t *engine) {
 
-    bool ok = is_fwd()
+    bool ok = is_fwd() && !with_attn_inputs()
             && set_default_formats() == status::success
             // ACL only supports matching src/dst (this must come after
             // set_default_formats() to handle format_kind::any)
@@ -149,7 +149,7 @@ status_t acl_softmax_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
 
-    auto asp = pd()->asp_;
+    const auto &asp = pd()->asp_;
 
     arm_compute::Tensor src_tensor;
     arm_compute::Tensor dst_tensor;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2022-2025 Arm Ltd. and affiliates
+* Copyright 2022-2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -15,11 +15,16 @@
 *******************************************************************************/
 
 #include "cpu/aarch64/acl_thread.hpp"
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+#include "cpu/aarch64/acl_omp_scheduler.hpp"
+#endif
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include "cpu/aarch64/acl_threadpool_scheduler.hpp"
 #endif
 #include "cpu/aarch64/acl_benchmark_scheduler.hpp"
 
+#include "arm_compute/core/Error.h"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -27,29 +32,39 @@ namespace aarch64 {
 
 namespace acl_thread_utils {
 
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+void process_workloads(
+        std::vector<arm_compute::IScheduler::Workload> &workloads,
+        ThreadFeeder &feeder, const arm_compute::ThreadInfo &info) {
+    unsigned int workload_index = info.thread_id;
+    do {
+        ARM_COMPUTE_ERROR_ON(workload_index >= workloads.size());
+        workloads[workload_index](info);
+    } while (feeder.get_next(workload_index));
+}
+#endif
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
-void acl_thread_bind() {
+void acl_set_omp_scheduler() {
+    // Only the installation of the scheduler is done once, the number of
+    // threads is taken from the calling context on every execution
     static std::once_flag flag_once;
-    // The threads in Compute Library are bound for the cores 0..max_threads-1
-    // dnnl_get_max_threads() returns OMP_NUM_THREADS
-    const int max_threads = dnnl_get_max_threads();
-    // arm_compute::Scheduler does not support concurrent access thus a
-    // workaround here restricts it to only one call
     std::call_once(flag_once, [&]() {
-        arm_compute::Scheduler::get().set_num_threads(max_threads);
+        std::shared_ptr<arm_compute::IScheduler> omp_scheduler
+                = std::make_unique<omp_scheduler_t>();
+        arm_compute::Scheduler::set(omp_scheduler);
     });
 }
-// Swap BenchmarkScheduler for default ACL scheduler builds (i.e. CPPScheduler, OMPScheduler)
-void acl_set_benchmark_scheduler_default() {
+// Swap BenchmarkScheduler for omp_scheduler_t
+void acl_set_omp_benchmark_scheduler() {
     static std::once_flag flag_once;
-    arm_compute::IScheduler *_real_scheduler = &arm_compute::Scheduler::get();
-    std::shared_ptr<arm_compute::IScheduler> benchmark_scheduler
-            = std::make_unique<benchmark_scheduler_t>(*_real_scheduler);
-    // set Benchmark scheduler in ACL
     std::call_once(flag_once, [&]() {
-        arm_compute::Scheduler::set(
-                std::static_pointer_cast<arm_compute::IScheduler>(
-                        benchmark_scheduler));
+        arm_compute::IScheduler *_real_scheduler
+                = std::make_unique<omp_scheduler_t>().release();
+        std::shared_ptr<arm_compute::IScheduler> benchmark_scheduler
+                = std::make_unique<benchmark_scheduler_t>(*_real_scheduler);
+        arm_compute::Scheduler::set(benchmark_scheduler);
     });
 }
 #endif
@@ -57,8 +72,10 @@ void acl_set_benchmark_scheduler_default() {
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 
 void acl_set_tp_scheduler() {
-    static thread_local std::once_flag flag_once;
-    // Create threadpool scheduler
+    // The scheduler runs on the threadpool of the calling thread, so it is
+    // installed once for all the threads. Installing one per thread would
+    // destroy the scheduler another stream may be running on.
+    static std::once_flag flag_once;
     std::call_once(flag_once, [&]() {
         // Create threadpool scheduler
         std::shared_ptr<arm_compute::IScheduler> threadpool_scheduler
@@ -67,23 +84,9 @@ void acl_set_tp_scheduler() {
     });
 }
 
-void acl_set_threadpool_num_threads() {
-    using namespace dnnl::impl::threadpool_utils;
-    static thread_local std::once_flag flag_once;
-    threadpool_interop::threadpool_iface *tp = get_active_threadpool();
-    // Check active threadpool
-    bool is_main = get_active_threadpool() == tp;
-    if (is_main) {
-        // Set num threads based on threadpool size
-        const int num_threads = (tp) ? dnnl_get_max_threads() : 1;
-        std::call_once(flag_once, [&]() {
-            arm_compute::Scheduler::get().set_num_threads(num_threads);
-        });
-    }
-}
 // Swap BenchmarkScheduler for custom scheduler builds (i.e. ThreadPoolScheduler)
 void acl_set_tp_benchmark_scheduler() {
-    static thread_local std::once_flag flag_once;
+    static std::once_flag flag_once;
     std::call_once(flag_once, [&]() {
         // Create threadpool scheduler
         std::unique_ptr<arm_compute::IScheduler> threadpool_scheduler
@@ -93,7 +96,7 @@ void acl_set_tp_benchmark_scheduler() {
 
         // Create benchmark scheduler and set TP as real scheduler
         std::shared_ptr<arm_compute::IScheduler> benchmark_scheduler
-                = std::make_unique<BenchmarkScheduler>(*_real_scheduler);
+                = std::make_unique<benchmark_scheduler_t>(*_real_scheduler);
 
         arm_compute::Scheduler::set(benchmark_scheduler);
     });
@@ -102,9 +105,10 @@ void acl_set_tp_benchmark_scheduler() {
 
 void set_acl_threading() {
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
-    acl_thread_bind();
     if (get_verbose(verbose_t::profile_externals)) {
-        acl_set_benchmark_scheduler_default();
+        acl_set_omp_benchmark_scheduler();
+    } else {
+        acl_set_omp_scheduler();
     }
 #endif
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
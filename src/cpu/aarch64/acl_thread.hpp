@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2022-2023 Arm Ltd. and affiliates
+* Copyright 2022-2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -20,6 +20,10 @@
 #include "common/dnnl_thread.hpp"
 #include "common/verbose.hpp"
 
+#include <atomic>
+#include <vector>
+
+#include "arm_compute/runtime/IScheduler.h"
 #include "arm_compute/runtime/Scheduler.h"
 
 namespace dnnl {
@@ -30,21 +34,48 @@ namespace aarch64 {
 namespace acl_thread_utils {
 
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
-// Number of threads in Compute Library is set by OMP_NUM_THREADS
-// dnnl_get_max_threads() == OMP_NUM_THREADS
-void acl_thread_bind();
-// Swap BenchmarkScheduler for default ACL scheduler builds (i.e. CPPScheduler, OMPScheduler)
-// for DNNL_VERBOSE=profile,profile_externals
-void acl_set_benchmark_scheduler_default();
+// Set omp_scheduler_t as the scheduler of Compute Library, so the number of
+// threads follows the OpenMP team of the calling thread on every execution
+void acl_set_omp_scheduler();
+// Swap BenchmarkScheduler for omp_scheduler_t for
+// DNNL_VERBOSE=profile,profile_externals
+void acl_set_omp_benchmark_scheduler();
 #endif
 
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
-// Retrieve threadpool size during primitive execution and set ThreadpoolScheduler num_threads
+// Set ThreadpoolScheduler as the scheduler of Compute Library
 void acl_set_tp_scheduler();
-void acl_set_threadpool_num_threads();
 // Swap BenchmarkScheduler for custom scheduler builds (i.e. ThreadPoolScheduler) for DNNL_VERBOSE=profile,profile_externals
 void acl_set_tp_benchmark_scheduler();
 #endif
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+// Hands out the indices of the workloads left after the first one of every
+// thread
+class ThreadFeeder {
+public:
+    explicit ThreadFeeder(unsigned int start = 0, unsigned int end = 0)
+        : _atomic_counter(start), _end(end) {}
+
+    /// Function to check the next element in the range if there is one.
+    bool get_next(unsigned int &next) {
+        next = std::atomic_fetch_add_explicit(
+                &_atomic_counter, 1u, std::memory_order_relaxed);
+        return next < _end;
+    }
+
+private:
+    std::atomic_uint _atomic_counter;
+    const unsigned int _end;
+};
+
+// Runs the workload of the thread and then the ones left by the feeder
+void process_workloads(
+        std::vector<arm_compute::IScheduler::Workload> &workloads,
+        ThreadFeeder &feeder, const arm_compute::ThreadInfo &info);
+#endif
+
 // Set threading for ACL
 void set_acl_threading();
 } // namespace acl_thread_utils
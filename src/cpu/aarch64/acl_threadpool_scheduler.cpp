@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2022-2025 Arm Ltd. and affiliates
+* Copyright 2022-2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -26,9 +26,8 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/IScheduler.h"
 
-#include <atomic>
+#include <algorithm>
 #include <cassert>
-#include <mutex>
 
 namespace dnnl {
 namespace impl {
@@ -37,70 +36,45 @@ namespace aarch64 {
 
 using namespace arm_compute;
 
-class ThreadFeeder {
-public:
-    explicit ThreadFeeder(unsigned int start = 0, unsigned int end = 0)
-        : _atomic_counter(start), _end(end) {}
+namespace {
+// Bound on the number of threads, per calling thread so that a stream
+// limiting its threads doesn't limit the ones running concurrently
+thread_local unsigned int max_threads = 0;
+} // namespace
 
-    /// Function to check the next element in the range if there is one.
-    bool get_next(unsigned int &next) {
-        next = std::atomic_fetch_add_explicit(
-                &_atomic_counter, 1u, std::memory_order_relaxed);
-        return next < _end;
-    }
-
-private:
-    std::atomic_uint _atomic_counter;
-    const unsigned int _end;
-};
-
-void process_workloads(std::vector<IScheduler::Workload> &workloads,
-        ThreadFeeder &feeder, const ThreadInfo &info) {
-    unsigned int workload_index = info.thread_id;
-    do {
-        ARM_COMPUTE_ERROR_ON(workload_index >= workloads.size());
-        workloads[workload_index](info);
-    } while (feeder.get_next(workload_index));
-}
-
-ThreadpoolScheduler::ThreadpoolScheduler()
-    : _num_threads(dnnl_get_max_threads()) {}
+ThreadpoolScheduler::ThreadpoolScheduler() = default;
 
 ThreadpoolScheduler::~ThreadpoolScheduler() = default;
 
 unsigned int ThreadpoolScheduler::num_threads() const {
-    return _num_threads;
+    // The size of the threadpool active on the calling thread is queried on
+    // every call, so streams with different threadpools share the scheduler
+    const unsigned int tp_threads = dnnl_get_current_num_threads();
+    return max_threads == 0 ? tp_threads : std::min(max_threads, tp_threads);
 }
 
 void ThreadpoolScheduler::set_num_threads(unsigned int num_threads) {
-    std::lock_guard<std::mutex> lock(this->_mtx);
-    _num_threads = num_threads == 0 ? dnnl_get_max_threads() : num_threads;
+    max_threads = num_threads;
 }
 
 void ThreadpoolScheduler::schedule(ICPPKernel *kernel, const Hints &hints) {
     ITensorPack tensors;
-    // Retrieve threadpool size during primitive execution and set ThreadpoolScheduler num_threads
-    acl_thread_utils::acl_set_threadpool_num_threads();
     schedule_common(kernel, hints, kernel->window(), tensors);
 }
 
 void ThreadpoolScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints,
         const Window &window, ITensorPack &tensors) {
-    // Retrieve threadpool size during primitive execution and set ThreadpoolScheduler num_threads
-    acl_thread_utils::acl_set_threadpool_num_threads();
     schedule_common(kernel, hints, window, tensors);
 }
 
 void ThreadpoolScheduler::run_workloads(
         std::vector<arm_compute::IScheduler::Workload> &workloads) {
-
-    std::lock_guard<std::mutex> lock(this->_mtx);
-
-    const unsigned int num_threads
-            = std::min(static_cast<unsigned int>(_num_threads),
-                    static_cast<unsigned int>(workloads.size()));
+    // No lock is taken here: the workloads and the feeder are local to the
+    // call, so concurrent executions from different streams do not serialize
+    const unsigned int num_threads = std::min(
+            this->num_threads(), static_cast<unsigned int>(workloads.size()));
     if (num_threads < 1) { return; }
-    ThreadFeeder feeder(num_threads, workloads.size());
+    acl_thread_utils::ThreadFeeder feeder(num_threads, workloads.size());
     using namespace dnnl::impl::threadpool_utils;
     dnnl::threadpool_interop::threadpool_iface *tp = get_active_threadpool();
     // Non-initialized threadpool can cause a segmentation fault.
@@ -112,7 +86,7 @@ void ThreadpoolScheduler::run_workloads(
         info.cpu_info = &cpu_info();
         info.num_threads = 1;
         info.thread_id = 0;
-        process_workloads(workloads, feeder, info);
+        acl_thread_utils::process_workloads(workloads, feeder, info);
         threadpool_utils::activate_threadpool(tp);
         return;
     }
@@ -128,7 +102,7 @@ void ThreadpoolScheduler::run_workloads(
         info.cpu_info = &cpu_info();
         info.num_threads = nthr;
         info.thread_id = ithr;
-        process_workloads(workloads, feeder, info);
+        acl_thread_utils::process_workloads(workloads, feeder, info);
         if (!is_main) deactivate_threadpool();
         if (is_async) b.notify();
     });
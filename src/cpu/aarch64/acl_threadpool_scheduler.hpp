@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2022, 2025 Arm Ltd. and affiliates
+* Copyright 2022, 2025-2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -23,21 +23,26 @@
 
 #include "arm_compute/runtime/IScheduler.h"
 
-#include <mutex>
-
 namespace dnnl {
 namespace impl {
 namespace cpu {
 namespace aarch64 {
 
+// Threadpool scheduler for Compute Library that runs the workloads on the
+// threadpool active on the calling thread, i.e. the one of the stream the
+// primitive executes on. The scheduler has no state shared between calling
+// threads, so the single instance installed in Compute Library serves
+// concurrent streams, each one with its own threadpool.
 class ThreadpoolScheduler final : public arm_compute::IScheduler {
 public:
     ThreadpoolScheduler();
     ~ThreadpoolScheduler() override;
 
-    /// Sets the number of threads the scheduler will use to run the kernels.
+    /// Sets an upper bound on the number of threads of the calling thread, 0
+    /// removes the bound.
     void set_num_threads(unsigned int num_threads) override;
-    /// Returns the number of threads that the ThreadpoolScheduler has in its pool.
+    /// Returns the number of threads of the threadpool active on the calling
+    /// thread, limited by the bound set with set_num_threads().
     unsigned int num_threads() const override;
 
     /// Multithread the execution of the passed kernel if possible.
@@ -53,10 +58,6 @@ public:
 protected:
     /// Execute workloads in parallel using num_threads
     void run_workloads(std::vector<Workload> &workloads) override;
-
-private:
-    unsigned int _num_threads {};
-    std::mutex _mtx;
 };
 
 } // namespace aarch64
@@ -170,14 +170,23 @@ status_t brgemm_desc_init(brgemm_desc_t *brg, cpu_isa_t isa,
         C: ldc * n, LDC - ldc must be at least max(1, m)
     */
     if (brg == nullptr) return status::invalid_arguments;
-    if (transA || transB) return status::unimplemented;
+    if (transB) return status::unimplemented;
 
     CHECK(brgemm_utils::init_brgemm_conf(brg, isa, type, dt_a, dt_b, layout,
             alpha, beta, LDA, LDB, LDC, M, N, K, strides));
 
+    // Transposed A is read by broadcasting its elements one at a time, so
+    // the K steps must not pack several elements
+    if (transA) {
+        if (!brg->is_f32 || !brg->is_row_major() || brg->is_gemv
+                || brg->isa_impl == sme)
+            return status::unimplemented;
+        brg->is_trans_A = true;
+    }
+
     if (M <= 0 || N <= 0 || K <= 0) return status::invalid_arguments;
     bool ldx_check = (brg->is_gemv || brg->is_row_major())
-            ? (LDA < K)
+            ? (LDA < (brg->is_trans_A ? M : K))
             : (LDA < M || LDB < K || LDC < M);
     if (ldx_check) return status::invalid_arguments;
 
@@ -223,8 +232,12 @@ status_t brgemm_desc_set_postops(brgemm_desc_t *brg,
     brg->attr = attr;
     brg->dst_md = dst_md;
 
+    // SME kernel stores accumulators as is: f32 or s32 for int8
+    const auto sme_dt_d = brg->is_int8 ? data_type::s32 : data_type::f32;
     if ((sme == brg->isa_impl)
             && ((data_type::undef != dt_bias) || attr->post_ops_.len()
+                    || dst_md->data_type != sme_dt_d
+                    || !attr->zero_points_.has_default_values()
                     || !attr->scales_.get(DNNL_ARG_SRC).has_default_values()
                     || !attr->scales_.get(DNNL_ARG_WEIGHTS).has_default_values()
                     || !attr->scales_.get(DNNL_ARG_DST).has_default_values()))
@@ -252,6 +265,11 @@ status_t brgemm_desc_set_postops(brgemm_desc_t *brg,
                     || (!one_of(dt_bias, data_type::undef, data_type::bf16,
                             data_type::f32, data_type::s32))))
         return status::unimplemented;
+    if (brg->is_f16
+            && ((!one_of(dt_d, data_type::f16, data_type::f32))
+                    || (!one_of(dt_bias, data_type::undef, data_type::f16,
+                            data_type::f32))))
+        return status::unimplemented;
     if ((brg->dt_a == data_type::f32 && brg->dt_b == data_type::f32)
             && (!one_of(dt_d, data_type::f32))
             && (!one_of(dt_bias, data_type::undef, data_type::s8, data_type::u8,
@@ -303,7 +321,8 @@ status_t brgemm_desc_set_postops(brgemm_desc_t *brg,
     const auto &src_scales = attr->scales_.get(DNNL_ARG_SRC);
     const auto &wei_scales = attr->scales_.get(DNNL_ARG_WEIGHTS);
     const bool has_src_scales = !src_scales.has_default_values();
-    const bool has_wei_scales = !wei_scales.has_default_values();
+    const bool has_wei_scales
+            = !brg->skip_wei_scales && !wei_scales.has_default_values();
     brg->with_scales = has_src_scales || has_wei_scales
             || brg->with_weights_scale_adjust;
     if (brg->with_scales) {
@@ -318,7 +337,7 @@ status_t brgemm_desc_set_postops(brgemm_desc_t *brg,
         // So if wei_scales.get_mask() > 0 (not common) it's assumed here that
         // scale type is per_n_dim_scale and driver which calls brgemm kernel
         // checked that mask has correct value for this case
-        brg->is_oc_scale = wei_scales.get_mask() > 0;
+        brg->is_oc_scale = has_wei_scales && wei_scales.get_mask() > 0;
     }
 
     const auto &dst_scales = attr->scales_.get(DNNL_ARG_DST);
@@ -337,6 +356,10 @@ status_t brgemm_desc_set_postops(brgemm_desc_t *brg,
         // Always init a default value;
         zp_type = brgemm_broadcast_t::none;
 
+        const bool skip_zero_point
+                = mem_arg == DNNL_ARG_WEIGHTS && brg->skip_zp_b_compensation;
+        if (skip_zero_point) return status::success;
+
         if (!zp.has_default_values(mem_arg)) {
             int mask = zp.get_mask(mem_arg);
             if (mask == 0) {
@@ -509,6 +532,7 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
     CMP_BRGEMM_FIELD(stride_a);
     CMP_BRGEMM_FIELD(stride_b);
     CMP_BRGEMM_FIELD(layout);
+    CMP_BRGEMM_FIELD(is_trans_A);
     CMP_BRGEMM_FIELD(type);
     CMP_BRGEMM_FIELD(is_dgmm);
     CMP_BRGEMM_FIELD(with_sum);
@@ -520,6 +544,8 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
     CMP_BRGEMM_FIELD(with_eltwise);
     CMP_BRGEMM_FIELD(with_binary);
     CMP_BRGEMM_FIELD(with_scales);
+    CMP_BRGEMM_FIELD(skip_zp_b_compensation);
+    CMP_BRGEMM_FIELD(skip_wei_scales);
 
     CMP_BRGEMM_FIELD(zp_type_a);
     CMP_BRGEMM_FIELD(zp_type_b);
@@ -28,15 +28,6 @@ using namespace dnnl::impl::utils;
 
 namespace brgemm_containers {
 
-#ifdef BRGEMM_KERNEL_GLOBAL_STORAGE
-std::set<std::shared_ptr<brgemm_kernel_t>,
-        decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>
-        brgemm_kernel_container_t::set_
-        = std::set<std::shared_ptr<brgemm_kernel_t>,
-                decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>(
-                brgemm_kernel_container_t::brgemm_kernel_cmp);
-#endif
-
 bool brgemm_desc_container_t::insert(int idx, brgemm_desc_t &brg,
         const std::vector<char> &bd_mask,
         const std::vector<brgemm_batch_element_t> &static_offsets) {
@@ -56,42 +47,156 @@ bool brgemm_desc_container_t::insert(int idx, brgemm_desc_t &brg,
     return ret.second;
 }
 
-bool brgemm_kernel_container_t::brgemm_kernel_cmp(
-        const std::shared_ptr<brgemm_kernel_t> &lhs,
-        const std::shared_ptr<brgemm_kernel_t> &rhs) {
-    const auto lsz = lhs->get_jit_generator()->getSize();
-    const auto rsz = rhs->get_jit_generator()->getSize();
-    if (lsz != rsz) return (lsz < rsz);
-    const auto lcode = lhs->get_jit_generator()->CodeGenerator::getCode();
-    const auto rcode = rhs->get_jit_generator()->CodeGenerator::getCode();
-    return (std::memcmp(lcode, rcode, lsz) < 0);
+// Owning copy of a descriptor: the data it points to is copied as well, so
+// that entries stay comparable after the primitive that created them is gone.
+// The kernel is generated from this copy, which outlives it.
+struct brgemm_kernel_cache_t::entry_t {
+    entry_t(const brgemm_desc_t &brg) : desc(brg) {
+        if (brg.brgattr.bd_mask_level > 0)
+            bd_mask.assign(brg.brgattr.bd_mask,
+                    brg.brgattr.bd_mask + brg.bcast_dim);
+        desc.brgattr.bd_mask = bd_mask.data();
+        if (brg.type == brgemm_static_offs)
+            static_offsets.assign(brg.brgattr.static_offsets,
+                    brg.brgattr.static_offsets + brg.brgattr.max_bs);
+        desc.brgattr.static_offsets = static_offsets.data();
+        if (brg.attr) {
+            attr.reset(new primitive_attr_t(*brg.attr));
+            desc.attr = attr.get();
+        }
+        if (brg.dst_md) {
+            dst_md.reset(new memory_desc_t(*brg.dst_md));
+            desc.dst_md = dst_md.get();
+        }
+    }
+
+    // Checks the fields the descriptor ordering does not cover.
+    bool matches(const brgemm_desc_t &brg) const {
+        const bool attr_ok = attr ? brg.attr && *brg.attr == *attr : !brg.attr;
+        const bool dst_md_ok
+                = dst_md ? brg.dst_md && *brg.dst_md == *dst_md : !brg.dst_md;
+        return attr_ok && dst_md_ok;
+    }
+
+    brgemm_desc_t desc;
+    std::vector<char> bd_mask;
+    std::vector<brgemm_batch_element_t> static_offsets;
+    std::unique_ptr<primitive_attr_t> attr;
+    std::unique_ptr<memory_desc_t> dst_md;
+    std::weak_ptr<const brgemm_kernel_t> kernel;
+};
+
+brgemm_kernel_cache_t::brgemm_kernel_cache_t() = default;
+brgemm_kernel_cache_t::~brgemm_kernel_cache_t() = default;
+
+brgemm_kernel_cache_t &brgemm_kernel_cache_t::instance() {
+    // Never destroyed so that primitives released at exit may still drop
+    // their kernels safely.
+    static brgemm_kernel_cache_t *cache = new brgemm_kernel_cache_t();
+    return *cache;
+}
+
+std::shared_ptr<const brgemm_kernel_t> brgemm_kernel_cache_t::find(
+        const brgemm_desc_t &brg) {
+    const auto range = map_.equal_range(&brg);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (!it->second->matches(brg)) continue;
+        auto kernel = it->second->kernel.lock();
+        if (kernel) return kernel;
+    }
+    return nullptr;
+}
+
+void brgemm_kernel_cache_t::evict_expired() {
+    for (auto it = map_.begin(); it != map_.end();) {
+        if (it->second->kernel.expired())
+            it = map_.erase(it);
+        else
+            ++it;
+    }
+    n_inserted_since_evict_ = 0;
+}
+
+status_t brgemm_kernel_cache_t::get_or_create(
+        std::shared_ptr<const brgemm_kernel_t> &kernel,
+        const brgemm_desc_t &brg) {
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        kernel = find(brg);
+        if (kernel) return status::success;
+    }
+
+    // Generate outside of the lock so that distinct kernels may be created
+    // concurrently.
+    std::unique_ptr<entry_t> entry(new entry_t(brg));
+    brgemm_kernel_t *brg_kernel = nullptr;
+    status_t s = brgemm_kernel_create(&brg_kernel, entry->desc);
+    if (s != status::success) {
+        delete brg_kernel;
+        return s;
+    }
+    std::shared_ptr<const brgemm_kernel_t> sptr(brg_kernel);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    // Another thread may have generated the same kernel in the meantime.
+    kernel = find(brg);
+    if (kernel) return status::success;
+
+    if (++n_inserted_since_evict_ > map_.size() / 2) evict_expired();
+    entry->kernel = sptr;
+    const brgemm_desc_t *key = &entry->desc;
+    map_.emplace(key, std::move(entry));
+    kernel = std::move(sptr);
+    return status::success;
+}
+
+void brgemm_kernel_container_t::resize(size_t ns) {
+    std::unique_ptr<std::atomic<const brgemm_kernel_t *>[]> refs(
+            new std::atomic<const brgemm_kernel_t *>[ns]);
+    for (size_t i = 0; i < ns; i++)
+        refs[i].store(i < size_ ? refs_[i].load() : nullptr);
+    refs_ = std::move(refs);
+    descs_.resize(ns, nullptr);
+    size_ = ns;
+}
+
+bool brgemm_kernel_container_t::is_lazy_default() {
+    static const bool lazy = getenv_int_user("BRGEMM_LAZY_KERNELS", 1) != 0;
+    return lazy;
 }
 
 status_t brgemm_kernel_container_t::insert(int idx, const brgemm_desc_t *brg) {
+    descs_[idx] = brg;
+    if (lazy_) return status::success;
+    return generate(idx) != nullptr ? status::success : status();
+}
+
+const brgemm_kernel_t *brgemm_kernel_container_t::generate(int idx) const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    // Another thread may have generated the kernel while this one waited.
+    const brgemm_kernel_t *ker = refs_[idx].load(std::memory_order_relaxed);
+    if (ker != nullptr) return ker;
+
     // Use two level hashing of brgemm kernels:
     // 1. Try to find entry in local brgemm_map_ using brgemm descriptor as a
     // key (we can check if brgemm descriptor is unique inside brgemm primitive)
-    // 2. Only if we do not find entry in local brgemm_map_  then try to find
-    // entry in kernel storage using kernel code as key
-    const auto brgemm_it = brgemm_map_.find(brg);
+    // 2. Only if we do not find entry in local brgemm_map_  then look it up in
+    // the global kernel cache using the descriptor contents as key
+    const brgemm_desc_t *brg = descs_[idx];
+    auto brgemm_it = brgemm_map_.find(brg);
     if (brgemm_it == brgemm_map_.end()) {
-        brgemm_kernel_t *brg_kernel = nullptr;
-        status_t s = brgemm_kernel_create(&brg_kernel, *brg);
+        std::shared_ptr<const brgemm_kernel_t> kernel;
+        status_t s
+                = brgemm_kernel_cache_t::instance().get_or_create(kernel, *brg);
         if (s != status::success) {
-            delete brg_kernel;
-            return s;
+            status_.store(s);
+            return nullptr;
         }
-        std::shared_ptr<brgemm_kernel_t> sptr(brg_kernel);
-        lock_write();
-        const auto kernel_ret = set_.insert(sptr);
-        refs_[idx] = kernel_ret.first->get();
-        unlock_write();
-        const auto brgemm_ret = brgemm_map_.insert({brg, refs_[idx]});
-        if (!brgemm_ret.second) return status::runtime_error;
-    } else {
-        refs_[idx] = brgemm_it->second;
+        brgemm_it = brgemm_map_.insert({brg, std::move(kernel)}).first;
     }
-    return status::success;
+    ker = brgemm_it->second.get();
+    refs_[idx].store(ker, std::memory_order_release);
+    return ker;
 }
 
 } // namespace brgemm_containers
@@ -19,8 +19,12 @@
 #ifndef CPU_AARCH64_BRGEMM_BRGEMM_CONTAINERS_HPP
 #define CPU_AARCH64_BRGEMM_BRGEMM_CONTAINERS_HPP
 
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <set>
-#include "common/rw_mutex.hpp"
+
 #include "cpu/aarch64/brgemm/brgemm.hpp"
 
 namespace dnnl {
@@ -57,43 +61,77 @@ private:
     std::vector<std::vector<brgemm_batch_element_t>> static_offsets_list_;
 };
 
-#define BRGEMM_KERNEL_GLOBAL_STORAGE
+// Process-wide cache of generated brgemm kernels shared by all primitives.
+// Kernels are keyed by the full descriptor, including the attributes and the
+// destination memory descriptor it refers to, so identical kernels requested
+// by different primitives are generated and stored once. The cache holds weak
+// references only: a kernel is released with the last primitive using it.
+struct brgemm_kernel_cache_t {
+    static brgemm_kernel_cache_t &instance();
+
+    // Returns in `kernel` the cached kernel for `brg`, generating it on a miss.
+    status_t get_or_create(std::shared_ptr<const brgemm_kernel_t> &kernel,
+            const brgemm_desc_t &brg);
+
+private:
+    struct entry_t;
+    struct desc_ptr_less_t {
+        bool operator()(
+                const brgemm_desc_t *lhs, const brgemm_desc_t *rhs) const {
+            return *lhs < *rhs;
+        }
+    };
+
+    brgemm_kernel_cache_t();
+    ~brgemm_kernel_cache_t();
+
+    std::shared_ptr<const brgemm_kernel_t> find(const brgemm_desc_t &brg);
+    void evict_expired();
+
+    std::mutex mutex_;
+    std::multimap<const brgemm_desc_t *, std::unique_ptr<entry_t>,
+            desc_ptr_less_t>
+            map_;
+    size_t n_inserted_since_evict_ = 0;
+};
 
+// In lazy mode (default) `insert` only records the descriptor and the kernel
+// is generated on the first `operator[]` access for its index; concurrent
+// first accesses are serialized and the kernel is published atomically.
+// Generation failures are sticky and reported by `status()`, in which case
+// `operator[]` returns nullptr. Setting ONEDNN_BRGEMM_LAZY_KERNELS=0 restores
+// eager generation at primitive creation.
 struct brgemm_kernel_container_t {
     brgemm_kernel_container_t() = default;
     brgemm_kernel_container_t(size_t ns) { resize(ns); }
-    void resize(size_t ns) { refs_.resize(ns); }
+    void resize(size_t ns);
     inline const brgemm_kernel_t *operator[](int idx) const {
-        return refs_[idx];
+        const brgemm_kernel_t *ker = refs_[idx].load(std::memory_order_acquire);
+        return ker != nullptr || descs_[idx] == nullptr ? ker : generate(idx);
     }
 
+    // Returns true if a kernel descriptor was recorded for `idx`, regardless
+    // of whether the kernel is generated yet.
+    bool is_inserted(int idx) const { return descs_[idx] != nullptr; }
+
     status_t insert(int idx, const brgemm_desc_t *brg);
-    static bool brgemm_kernel_cmp(const std::shared_ptr<brgemm_kernel_t> &lhs,
-            const std::shared_ptr<brgemm_kernel_t> &rhs);
+    status_t status() const { return status_.load(); }
 
 private:
-    std::vector<const brgemm_kernel_t *> refs_;
-#ifdef BRGEMM_KERNEL_GLOBAL_STORAGE
-    static std::set<std::shared_ptr<brgemm_kernel_t>,
-            decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>
-            set_;
-
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
-
-    void lock_write() { rw_mutex().lock_write(); }
-    void unlock_write() { rw_mutex().unlock_write(); }
-
-#else
-    std::set<std::shared_ptr<brgemm_kernel_t>,
-            decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>
-            set_;
-    void lock_write() {}
-    void unlock_write() {}
-#endif
-    std::map<const brgemm_desc_t *, const brgemm_kernel_t *> brgemm_map_;
+    const brgemm_kernel_t *generate(int idx) const;
+    static bool is_lazy_default();
+
+    size_t size_ = 0;
+    std::unique_ptr<std::atomic<const brgemm_kernel_t *>[]> refs_;
+    std::vector<const brgemm_desc_t *> descs_;
+    bool lazy_ = is_lazy_default();
+    mutable std::atomic<status_t> status_ {status::success};
+    mutable std::mutex mutex_;
+    // Owns the kernels used by the container. Descriptors are unique inside a
+    // primitive, so several indices may share an entry.
+    mutable std::map<const brgemm_desc_t *,
+            std::shared_ptr<const brgemm_kernel_t>>
+            brgemm_map_;
 };
 
 } // namespace brgemm_containers
@@ -227,11 +227,17 @@ struct brgemm_desc_t {
     bool with_binary = false;
     bool with_scales = false;
     bool is_gemv = false; // (M == 1 && is_col_major()) || (N == 1 && LDB == 1)
+    // A is stored K x M with LDA between the rows of K (row major layout only)
+    bool is_trans_A = false;
+    bool skip_zp_b_compensation = false;
 
     brgemm_broadcast_t zp_type_a = brgemm_broadcast_t::none;
     brgemm_broadcast_t zp_type_b = brgemm_broadcast_t::none;
     brgemm_broadcast_t zp_type_c = brgemm_broadcast_t::none;
 
+    // `skip_wei_scales` is controlled by the implementation and not by kernel
+    // API.
+    bool skip_wei_scales = false;
     int is_oc_scale = 0;
     bool with_dst_scales = false;
 
@@ -260,6 +266,9 @@ struct brgemm_desc_t {
     bool is_int8 = false;
     bool is_bf16 = false, is_bf16_emu = false;
     bool is_f16 = false;
+    // f16 A and B are multiplied and accumulated in f16, the f16 sums being
+    // added to the f32 accumulators after each rd_block
+    bool is_f16_acc = false;
 
     bool is_f32 = false;
     bool is_bf32 = false;
@@ -101,14 +101,23 @@ status_t set_isa_impl(brgemm_desc_t *brg) {
                 one_of(brg->isa_user, isa_undef, isa);
     };
 
-    if (brg->is_bf32 || brg->is_f16) {
+    if (brg->is_bf32) {
         return status::unimplemented;
     } else if (brg->is_bf16 && !mayiuse_bf16()) {
         return status::unimplemented;
-    } else if (brg->is_f32 || brg->is_bf16 || brg->is_int8) {
+    } else if (brg->is_f16 && !brg->is_f16_acc
+            && brg->dt_b != data_type::f32) {
+        // f16 is either accumulated in f16 or computed in f32 with B
+        // up-converted to f32
+        return status::unimplemented;
+    } else if (brg->is_f32 || brg->is_bf16 || brg->is_int8 || brg->is_f16) {
+        // Vectors longer than 512 bits have no specialization, the vector
+        // length agnostic f32 kernel uses the whole of them.
+        const bool use_vla_sve
+                = brg->is_f32 && is_wide_sve() && is_isa_ok(sve);
         brg->isa_impl = utils::map(true, isa_undef, is_isa_ok(sme), sme,
-                is_isa_ok(sve_512), sve_512, is_isa_ok(sve_256), sve_256,
-                is_isa_ok(sve_128), sve_128);
+                use_vla_sve, sve, is_isa_ok(sve_512), sve_512,
+                is_isa_ok(sve_256), sve_256, is_isa_ok(sve_128), sve_128);
         return status::success;
     }
     return status::success;
@@ -151,7 +160,12 @@ int calculate_max_bcast_block(brgemm_desc_t *brg, const int adj_ld_block2) {
         max_reg_count
                 = nstl::min(max_reg_count, max_isa_regs - max_bcst_regs - 5);
 
-    int max_bcast_block = max_reg_count - adj_ld_block2;
+    // With f16 accumulation B is loaded two f32 vectors at a time, and every
+    // row adds f16 accumulators covering two f32 ones each
+    const int f16_acc_regs = brg->is_f16_acc ? div_up(adj_ld_block2, 2) : 0;
+    const int load_regs = brg->is_f16_acc ? f16_acc_regs : adj_ld_block2;
+
+    int max_bcast_block = max_reg_count - load_regs;
 
     if (brg->is_bf16_emu) {
         // in theory, vmm bf16_emu register indices overlap with other vmm
@@ -163,7 +177,7 @@ int calculate_max_bcast_block(brgemm_desc_t *brg, const int adj_ld_block2) {
 
     if (brg->is_int8 && !brg->has_int8_vnni) max_bcast_block -= 2;
 
-    max_bcast_block /= adj_ld_block2;
+    max_bcast_block /= adj_ld_block2 + f16_acc_regs;
 
     return max_bcast_block;
 }
@@ -229,7 +243,11 @@ status_t brgemm_blocking(brgemm_desc_t *brg) {
 
     const int rd_unroll = 4;
     const int vnni_granularity = data_type_vnni_granularity(brg->dt_a);
-    brg->rd_block = rd_unroll * vnni_granularity;
+    // The f16 accumulators are flushed to the f32 ones after each rd_block,
+    // which bounds the number of additions rounded to f16
+    const int f16_acc_rd_block = 32;
+    brg->rd_block = brg->is_f16_acc ? f16_acc_rd_block
+                                    : rd_unroll * vnni_granularity;
     brg->rdb = brg->reduce_dim / brg->rd_block;
     brg->rdb_tail = brg->reduce_dim % brg->rd_block;
 
@@ -306,6 +324,8 @@ status_t init_brgemm_conf(brgemm_desc_t *brg, cpu_isa_t isa,
     CHECK(init_kernel_datatype(brg, brg->dt_a, brg->dt_b));
 
     if (brg->is_f32 && (dt_b == data_type::bf16)) return status::unimplemented;
+    // f16 B is only passed by users opting in f16 accumulation
+    brg->is_f16_acc = everyone_is(data_type::f16, dt_a, dt_b);
 
     brg->dt_c = get_accum_datatype(brg);
     brg->dt_d = brg->dt_c;
@@ -342,6 +362,13 @@ status_t init_brgemm_conf(brgemm_desc_t *brg, cpu_isa_t isa,
                                          : static_cast<int>(LDA);
     }
 
+    // The halves of an f16 accumulator are added to two f32 accumulators,
+    // which needs the kernel to use the whole hardware vector
+    if (brg->is_f16_acc
+            && (brg->is_gemv || !brg->is_row_major() || brg->isa_impl == sme
+                    || simd_bytes(brg->isa_impl) != get_sve_length()))
+        return status::unimplemented;
+
     brg->LDC = static_cast<int>(LDC);
     brg->LDD = static_cast<int>(LDC);
 
@@ -355,16 +382,26 @@ status_t init_brgemm_conf(brgemm_desc_t *brg, cpu_isa_t isa,
     brg->bdb2 = 0;
     brg->bdb2_tail = 0;
 
-    brg->ld_step = data_type_vnni_granularity(brg->dt_b);
+    // f16 accumulation multiplies B rows one at a time with FMLA
+    brg->ld_step
+            = brg->is_f16_acc ? 1 : data_type_vnni_granularity(brg->dt_b);
 
-    const bool has_no_vnni_compute_instruction = false;
+    const bool has_no_vnni_compute_instruction = brg->is_f16_acc;
     brg->rd_step = has_no_vnni_compute_instruction
             ? 1
             : data_type_vnni_granularity(brg->dt_b);
 
+    // SME kernel computes f32 with fmopa, bf16 with bfmopa and int8 with
+    // smopa/usmopa, the latter two expect a reduce dim made of whole vnni
+    // groups since A is read in 32-bit words
+    const bool sme_dt_ok
+            = (brg->is_f32 && everyone_is(data_type::f32, dt_a, dt_b))
+            || (brg->is_bf16 && everyone_is(data_type::bf16, dt_a, dt_b))
+            || (brg->is_int8 && one_of(dt_a, data_type::s8, data_type::u8)
+                    && data_type::s8 == dt_b);
     if ((sme == brg->isa_impl)
-            && (!brg->is_f32 || (data_type::f32 != dt_b)
-                    || (data_type::f32 != dt_a)
+            && (!sme_dt_ok
+                    || brg->reduce_dim % data_type_vnni_granularity(dt_b) != 0
                     || ((0.f != brg->beta) && (1.f != brg->beta))
                     || (1.f != brg->alpha) || (brgemm_addr != brg->type)
                     || (brgemm_row_major != layout)))
@@ -400,7 +437,7 @@ status_t init_brdgmm_conf(brgemm_desc_t *brg, cpu_isa_t isa,
         return mayiuse(isa) && one_of(brg->isa_user, isa_undef, isa);
     };
 
-    if (brg->is_f32 || brg->is_bf16 || brg->is_int8) {
+    if (brg->is_f32 || brg->is_bf16 || brg->is_int8 || brg->is_f16) {
         brg->isa_impl = utils::map(true, isa_undef, is_isa_ok(sve_512), sve_512,
                 is_isa_ok(sve_256), sve_256, is_isa_ok(sve_128), sve_128);
     }
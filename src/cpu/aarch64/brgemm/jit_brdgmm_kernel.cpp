@@ -225,6 +225,16 @@ void jit_brdgmm_kernel_base_t::cvt2ps(data_type_t type_in, const ZReg vmm_in,
                 lsl(vmm_in.s, vmm_in.s, 16);
             }
             break;
+        case data_type::f16:
+            if (mask_flag && store) {
+                ld1h(vmm_tmp(0).s, mask / T_z, op);
+                fcvt(vmm_tmp(0).s, P_ALL_ONE / T_m, vmm_tmp(0).h);
+                mov(vmm_in.s, mask / T_m, vmm_tmp(0).s);
+            } else {
+                ld1h(vmm_in.s, mask / T_z, op);
+                fcvt(vmm_in.s, P_ALL_ONE / T_m, vmm_in.h);
+            }
+            break;
         case data_type::s8:
             if (mask_flag && store) {
                 ld1sb(vmm_tmp(0).s, mask / T_z, op);
@@ -482,6 +492,10 @@ void jit_brdgmm_kernel_base_t::store_accumulators_apply_post_ops(
                     bfcvt(vmm.h, mask, vmm.s);
                     st1h(vmm.s, mask, addr);
                     break;
+                case data_type::f16:
+                    fcvt(vmm.h, mask, vmm.s);
+                    st1h(vmm.s, mask, addr);
+                    break;
                 case data_type::s8:
                     smin(vmm.s, std::numeric_limits<int8_t>::max());
                     smax(vmm.s, std::numeric_limits<int8_t>::min());
@@ -569,6 +583,9 @@ void jit_brdgmm_kernel_base_t::load_a(
     } else if (brg.dt_a == data_type::bf16) {
         ld1h(vmma.s, mask, addr);
         lsl(vmma.s, vmma.s, 16);
+    } else if (brg.dt_a == data_type::f16) {
+        ld1h(vmma.s, mask, addr);
+        fcvt(vmma.s, P_ALL_ONE / T_m, vmma.h);
     } else if (brg.is_int8) {
         ld1b(vmma.s, mask, addr);
     } else {
@@ -592,6 +609,9 @@ void jit_brdgmm_kernel_base_t::load_b(
     } else if (brg.dt_b == data_type::bf16) {
         ld1h(vmmb.s, P_ALL_ONE / T_z, addr);
         lsl(vmmb.s, vmmb.s, 16);
+    } else if (brg.dt_b == data_type::f16) {
+        ld1h(vmmb.s, P_ALL_ONE / T_z, addr);
+        fcvt(vmmb.s, P_ALL_ONE / T_m, vmmb.h);
     } else if (brg.dt_b == data_type::s8) {
         ld1sb(vmmb.s, P_ALL_ONE / T_z, addr);
     } else {
@@ -624,6 +644,9 @@ void jit_brdgmm_kernel_base_t::brdgmm_microkernel(int m_blocks, int n_blocks,
             pop_z_tmp(z_tmp);
         } else if (brg.is_bf16) {
             bfdot(vmm_acc.s, vmmb.h, vmma.h);
+        } else if (brg.is_f16) {
+            // f16 inputs are up-converted to f32 when loaded
+            fmla(vmm_acc.s, P_ALL_ONE / T_m, vmma.s, vmmb.s);
         } else if (brg.is_int8 && isa_has_s8s8(brg.isa_impl)) {
             if (brg.dt_a == data_type::u8 && brg.dt_b == data_type::u8)
                 udot(vmm_acc.s, vmmb.b, vmma.b);
@@ -115,7 +115,8 @@ private:
     bool is_fma_embd() const { return brg.is_f32; }
     bool is_fast_vnni_int8() const { return is_fast_vnni_int8(brg); }
     int vnni_substep() const {
-        return brg.isa_impl == sve_256 && brg.is_f16 ? 2 : 1;
+        // f16 is up-converted to f32 on load, so there is no interleaving
+        return 1;
     }
     int get_substep_simd(int n_i, int v_i, bool has_n_tail) {
         const int last_n_block_sz
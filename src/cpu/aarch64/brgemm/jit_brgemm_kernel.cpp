@@ -16,6 +16,9 @@
 * limitations under the License.
 *******************************************************************************/
 #include <memory>
+#include <string>
+
+#include "oneapi/dnnl/dnnl_debug.h"
 
 #include "common/c_types_map.hpp"
 #include "common/nstl.hpp"
@@ -113,6 +116,18 @@ struct jit_brgemm_kernel_t : public jit_generator_t {
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_kernel_t)
 
+    // e.g. sve_256_f32f32_bd4_ld4x8_rd1
+    std::string code_name_suffix() const override {
+        std::string s = JIT_IMPL_NAME_HELPER("", brg.isa_impl, "");
+        s += std::string("_") + dnnl_dt2str(brg.dt_a) + dnnl_dt2str(brg.dt_b);
+        s += "_bd" + std::to_string(brg.bd_block);
+        s += "_ld" + std::to_string(brg.ld_block2) + "x"
+                + std::to_string(brg.ld_block);
+        s += "_rd" + std::to_string(brg.rd_block);
+        if (brg.is_f16_acc) s += "_f16acc";
+        return s;
+    }
+
     brgemm_desc_t brg;
 
 private:
@@ -224,6 +239,10 @@ private:
 
     PReg rd_tail_mask = PReg(2);
     PReg ld_tail_mask = PReg(3);
+    // f16 lanes of a B load for f16 accumulation: the ld tail, and a single
+    // f32 vector when ld_block2 is odd
+    PReg ld_tail_mask_h = PReg(8);
+    PReg ld_half_mask_h = PReg(9);
 
     ZReg accm(int ld_block, int bd, int ld) const {
         // Starts at the highest (e.g. 31), descending and using ld_block * bd_block registers as accumulators
@@ -252,6 +271,16 @@ private:
             return ZReg(idx);
         }
     }
+    // With f16 accumulation, the load registers hold pairs of f32 vectors of
+    // B and are followed by as many f16 accumulators per bd
+    int f16_acc_pairs(int ld_block2) const { return div_up(ld_block2, 2); }
+    ZReg f16_accm(int bd, int pair) const {
+        const int max_pairs = f16_acc_pairs(brg.ld_block2);
+        int idx = max_effective_vregs - 1 - (brg.ld_block2 * brg.bd_block)
+                - max_pairs - (bd * max_pairs + pair);
+        assert(idx > 0);
+        return ZReg(idx);
+    }
     const ZReg &z_tmp_1() const noexcept { return this->z0; }
     const ZReg &z_tmp_2() const noexcept { return this->z1; }
     const ZReg &z_tmp_3() const noexcept { return this->z2; }
@@ -335,6 +364,9 @@ private:
 
     void gemm_microkernel(int bd_block2, bool is_bdb_tail, int ld_block,
             bool is_rd_tail, bool is_ld_tail, int vpad, int rows_for_rd_tail);
+    // Adds the f16 accumulators to the f32 ones and clears them
+    void flush_f16_accumulators(int bd_b, int bd_e, int ld_block2);
+    void prefetch_B(int ld_block2, int rd);
     // GEMV microkernel is distinct from GEMM in that it loads vectors from A and B
     // and assumes that we will sum all the elements after the microkernel
     void gemv_microkernel(
@@ -387,6 +419,7 @@ private:
 };
 
 int jit_brgemm_kernel_t::A_offset(int bd, int rd) const noexcept {
+    if (brg.is_trans_A) return brg.typesize_A * (rd * brg.LDA + bd);
     return brg.typesize_A * (bd * brg.LDA + rd);
 }
 int jit_brgemm_kernel_t::B_offset(int ld, int rd) const noexcept {
@@ -419,6 +452,7 @@ int jit_brgemm_kernel_t::po_offset(int bd, int ld) const noexcept {
 }
 
 int jit_brgemm_kernel_t::rdb_A_offset() const noexcept {
+    if (brg.is_trans_A) return brg.typesize_A * brg.rd_block * brg.LDA;
     return brg.typesize_A * brg.rd_block;
 }
 int jit_brgemm_kernel_t::rdb_B_offset() const noexcept {
@@ -446,6 +480,7 @@ int jit_brgemm_kernel_t::ldb_po_offset(
 }
 
 int jit_brgemm_kernel_t::bdb_A_offset(int bd_block2) const noexcept {
+    if (brg.is_trans_A) return brg.typesize_A * bd_block2 * brg.bd_block;
     return brg.typesize_A * bd_block2 * brg.bd_block * brg.LDA;
 }
 int jit_brgemm_kernel_t::bdb_C_offset(int bd_block2) const noexcept {
@@ -552,6 +587,13 @@ void jit_brgemm_kernel_t::cvt2ps(data_type_t type_in, const ZReg zmm_in,
                 mov(zmm_in.s, ktail_mask / T_m, z_tmp_1().s);
             break;
         }
+        case data_type::f16: {
+            LD_MUL_VL(ld1h, z_tmp_1().s, mask, addr, offset - base_offset, 2);
+            fcvt(z_tmp_1().s, P_ALL_ONE / T_m, z_tmp_1().h);
+            if (store) //Merging
+                mov(zmm_in.s, ktail_mask / T_m, z_tmp_1().s);
+            break;
+        }
         case data_type::s8:
             LD_MUL_VL(ld1sb, z_tmp_1().s, mask, addr, offset - base_offset, 1);
             if (store) // Merging
@@ -780,6 +822,11 @@ void jit_brgemm_kernel_t::zero_accumulators(int bd_block2, bool is_bdb_tail,
             uni_clear(zmm);
         }
     }
+    if (brg.is_f16_acc) {
+        for_(int bd = 0; bd < bd_block; bd++)
+        for (int pair = 0; pair < f16_acc_pairs(ld_block2); pair++)
+            uni_clear(f16_accm(bd, pair));
+    }
 }
 
 void jit_brgemm_kernel_t::apply_alpha_beta(
@@ -887,7 +934,7 @@ void jit_brgemm_kernel_t::apply_post_ops(
 }
 
 static inline bool isa_has_masks(cpu_isa_t isa) {
-    return is_superset(isa, sve_128);
+    return is_superset(isa, sve_128) || isa == sve;
 }
 
 void jit_brgemm_kernel_t::store_accumulators_apply_post_ops(
@@ -1112,6 +1159,12 @@ void jit_brgemm_kernel_t::store_accumulators_apply_post_ops(
                             2);
                     break;
                 }
+                case data_type::f16: {
+                    fcvt(zmm.h, k_mask / T_m, zmm.s);
+                    ST_MUL_VL(st1h, zmm.s, k_mask, x_addr, offset - base_offset,
+                            2);
+                    break;
+                }
                 case data_type::s8:
                     smin(zmm.s, std::numeric_limits<int8_t>::max());
                     smax(zmm.s, std::numeric_limits<int8_t>::min());
@@ -1184,7 +1237,9 @@ void jit_brgemm_kernel_t::apply_compensation(
             auto vmm_comp = z_tmp_1();
             int comp_offset = compensations_offset(ld);
             const bool is_tail = is_ld_tail && ld + 1 == ld_block2;
-            if (IMPLICATION(is_tail, is_superset(brg.isa_impl, sve_512))) {
+            if (IMPLICATION(is_tail,
+                        is_superset(brg.isa_impl, sve_512)
+                                || brg.isa_impl == sve)) {
                 const auto mask = is_tail ? k_mask : P_ALL_ONE;
                 add_imm(X_DEFAULT_ADDR, reg_aux_compensation, comp_offset,
                         X_TMP_1);
@@ -1408,7 +1463,11 @@ void jit_brgemm_kernel_t::set_A_B_matrices() {
 }
 
 void jit_brgemm_kernel_t::dot_product(ZReg v_acc, ZReg v_a, ZReg v_b) {
-    if (brg.is_f32) {
+    // Unless f16 is accumulated in f16, f16 A is up-converted on broadcast
+    // and B is up-converted by copy_B, so f16 is computed in f32.
+    if (brg.is_f16_acc) {
+        fmla(v_acc.h, P_ALL_ONE / T_m, v_a.h, v_b.h);
+    } else if (brg.is_f32 || brg.is_f16) {
         fmla(v_acc.s, P_ALL_ONE / T_m, v_a.s, v_b.s);
     } else if (brg.is_bf16) {
         bfdot(v_acc.s, v_b.h, v_a.h);
@@ -1532,30 +1591,44 @@ void jit_brgemm_kernel_t::load_A_word_for_bcast(int32_t &base_offset,
     auto dt_bytes = dnnl_data_type_size(brg.dt_a);
 
     int64_t offset_bytes = A_offset(bd, rd) - base_offset;
-    // Stride between bd
+    // Stride between bd, or between rd for transposed A
     const auto A_stride_bytes = brg.typesize_A * brg.LDA;
 
+    // f16 is broadcast one element at a time and up-converted to f32, for
+    // the other types a word is broadcast.
+    const int64_t bcast_bytes = brg.is_f16 ? 2 : 4;
+    const int64_t max_offset_bytes = 63 * bcast_bytes;
+
     // Tail here means fewer elements than needed to make up a word
-    if (!is_tail || brg.typesize_A == 4) {
-        // If the offset is out of range of LD1RW, add strides so it isn't
+    if (!is_tail || brg.typesize_A == 4 || brg.is_f16) {
+        // If the offset is out of range of LD1RW/LD1RH, add strides so it isn't
         // https://developer.arm.com/documentation/ddi0596/2021-03/SVE-Instructions/LD1RW--Load-and-broadcast-unsigned-word-to-vector-
-        if (offset_bytes > 252 || offset_bytes < 0 || (offset_bytes % 4) != 0) {
+        if (offset_bytes > max_offset_bytes || offset_bytes < 0
+                || (offset_bytes % bcast_bytes) != 0) {
             auto num_strides_to_increment = offset_bytes / A_stride_bytes;
             base_offset += num_strides_to_increment * A_stride_bytes;
             offset_bytes -= num_strides_to_increment * A_stride_bytes;
             strided_addr(reg_A_ptr, reg_A_ptr, reg_stride_bytes_A,
                     A_stride_bytes, num_strides_to_increment, tmp);
         }
-        // This would require rd > 63 (=252/4), which _should_ be impossible, or we messed up the above logic
-        assert(!(offset_bytes > 252 || offset_bytes < 0
-                || (offset_bytes % 4) != 0));
+        // This would require rd > 63, which _should_ be impossible, or we messed up the above logic
+        assert(!(offset_bytes > max_offset_bytes || offset_bytes < 0
+                || (offset_bytes % bcast_bytes) != 0));
 
         auto addr = ptr(reg_A_ptr, static_cast<int32_t>(offset_bytes));
-        ld1rw(dst.s, P_ALL_ONE / T_z, addr);
+        if (brg.is_f16_acc) {
+            ld1rh(dst.h, P_ALL_ONE / T_z, addr);
+        } else if (brg.is_f16) {
+            ld1rh(dst.s, P_ALL_ONE / T_z, addr);
+            fcvt(dst.s, P_ALL_ONE / T_m, dst.h);
+        } else
+            ld1rw(dst.s, P_ALL_ONE / T_z, addr);
     } else {
-        const int64_t mul_vl = offset_bytes / simd_bytes(brg.isa_impl);
-        if (offset_bytes % simd_bytes(brg.isa_impl) == 0 && mul_vl >= -8
-                && mul_vl <= 7) {
+        // MUL VL scales by the hardware vector length, which is longer than
+        // the one of the kernel when a fixed length one runs on wider SVE.
+        const int64_t vl_bytes = static_cast<int64_t>(get_sve_length());
+        const int64_t mul_vl = offset_bytes / vl_bytes;
+        if (offset_bytes % vl_bytes == 0 && mul_vl >= -8 && mul_vl <= 7) {
             auto addr = ptr(reg_A_ptr, mul_vl, MUL_VL);
             if (dt_bytes == 1) ld1b(dst.b, rd_tail_mask / T_z, addr);
             if (dt_bytes == 2) ld1h(dst.h, rd_tail_mask / T_z, addr);
@@ -1600,6 +1673,21 @@ void jit_brgemm_kernel_t::load_quadword_for_bcast(const ZReg &dst,
     // slower on V1. Perf uplift (~0.5%) on V2 did not justify complexity
 }
 
+// Prefetches the cache lines of the B row read `prfB.dist1` bytes later
+void jit_brgemm_kernel_t::prefetch_B(int ld_block2, int rd) {
+    if (brg.prfB.dist1 <= 0) return;
+    constexpr int cache_line_size = 64;
+    for (int ld = 0; ld < ld_block2; ld++) {
+        const int offset = B_offset(ld, rd);
+        if (ld > 0
+                && offset / cache_line_size
+                        == B_offset(ld - 1, rd) / cache_line_size)
+            continue;
+        add_imm(X_DEFAULT_ADDR, reg_aux_B, offset + brg.prfB.dist1, X_TMP_0);
+        prfm(PLDL1KEEP, ptr(X_DEFAULT_ADDR));
+    }
+}
+
 void jit_brgemm_kernel_t::gemm_microkernel(int bd_block2, bool is_bdb_tail,
         int ld_block2, bool is_rd_tail, bool is_ld_tail, int vpad,
         int rows_for_rd_tail) {
@@ -1650,6 +1738,7 @@ void jit_brgemm_kernel_t::gemm_microkernel(int bd_block2, bool is_bdb_tail,
             // Load a quadword and broadcast the words using an indexed FMLA/DOT instead of
             // broadcasting one element at a time. We can only do this if there is no
             // per-DOT overhead, and our elements are contiguous
+            prefetch_B(ld_block2, rd);
             auto quadword_index = rd / data_type_vnni_granularity(brg.dt_a) % 4;
             if (quadword_index == 0 && rd != 0) {
                 // Bump by quadword
@@ -1696,13 +1785,16 @@ void jit_brgemm_kernel_t::gemm_microkernel(int bd_block2, bool is_bdb_tail,
                 && is_rd_tail && rd_tail_size != 0
                 && (brg.is_bf16 || brg.is_int8);
 
+        // With f16 accumulation a load takes the f16 values of B matching
+        // two f32 vectors
+        const int ld_step = brg.is_f16_acc ? 2 : 1;
         for (int rd = 0; rd < rd_loop; rd += brg.rd_step) {
+            prefetch_B(ld_block2, rd);
             // Pointer to A we will increment within this microkernel
             int a_base_offset = 0;
             const XReg reg_A_ptr = X_TMP_4;
             mov(reg_A_ptr, reg_aux_A);
-            for (int ld = 0; ld < ld_block2; ld++) {
-                auto mask = is_ld_tail ? ld_tail_mask : P_ALL_ONE;
+            for (int ld = 0; ld < ld_block2; ld += ld_step) {
                 const int offset = B_offset(ld, rd);
                 if (!use_mul_vl(offset - b_base_offset, 4, cpu_sveLen)) {
                     add_vl_or_imm(
@@ -1711,7 +1803,16 @@ void jit_brgemm_kernel_t::gemm_microkernel(int bd_block2, bool is_bdb_tail,
                     x_addr = reg_tmp_;
                 }
                 auto b_off_mul_vl = (offset - b_base_offset) / cpu_sveLen;
-                ld1w(load(ld).s, mask / T_z, ptr(x_addr, b_off_mul_vl, MUL_VL));
+                auto addr = ptr(x_addr, b_off_mul_vl, MUL_VL);
+                if (brg.is_f16_acc) {
+                    auto mask = is_ld_tail ? ld_tail_mask_h
+                            : ld + 1 == ld_block2 ? ld_half_mask_h
+                                                  : P_ALL_ONE;
+                    ld1h(load(ld / 2).h, mask / T_z, addr);
+                } else {
+                    auto mask = is_ld_tail ? ld_tail_mask : P_ALL_ONE;
+                    ld1w(load(ld).s, mask / T_z, addr);
+                }
             }
             bool have_to_load_bytes
                     = maybe_load_bytes && (rd == rd_loop - brg.rd_step);
@@ -1726,14 +1827,42 @@ void jit_brgemm_kernel_t::gemm_microkernel(int bd_block2, bool is_bdb_tail,
                 load_A_word_for_bcast(a_base_offset, bcst(bd), need_rd_mask,
                         reg_A_ptr, bd, rd, X_TMP_3);
 
-                for (int ld = 0; ld < ld_block2; ld++) {
-                    dot_product(accm(ld_block2, bd, ld), load(ld), bcst(bd));
+                if (brg.is_f16_acc) {
+                    for (int pair = 0; pair < f16_acc_pairs(ld_block2); pair++)
+                        dot_product(f16_accm(bd, pair), load(pair), bcst(bd));
+                } else {
+                    for (int ld = 0; ld < ld_block2; ld++) {
+                        dot_product(
+                                accm(ld_block2, bd, ld), load(ld), bcst(bd));
+                    }
                 }
             }
         }
+        if (brg.is_f16_acc) flush_f16_accumulators(bd_b, bd_e, ld_block2);
     }
 }
 
+void jit_brgemm_kernel_t::flush_f16_accumulators(
+        int bd_b, int bd_e, int ld_block2) {
+    // The f16 values of the first vector of a pair are in the lower half of
+    // the accumulator, ZIP1/ZIP2 spread a half over the 32-bit lanes.
+    const auto z_tmp = z_tmp_1();
+    for_(int bd = bd_b; bd < bd_e; bd++)
+    for (int ld = 0; ld < ld_block2; ld++) {
+        const auto acc = f16_accm(bd, ld / 2);
+        if (ld % 2 == 0)
+            zip1(z_tmp.h, acc.h, acc.h);
+        else
+            zip2(z_tmp.h, acc.h, acc.h);
+        fcvt(z_tmp.s, P_ALL_ONE / T_m, z_tmp.h);
+        const auto zmm = accm(ld_block2, bd, ld);
+        fadd(zmm.s, zmm.s, z_tmp.s);
+    }
+    for_(int bd = bd_b; bd < bd_e; bd++)
+    for (int pair = 0; pair < f16_acc_pairs(ld_block2); pair++)
+        uni_clear(f16_accm(bd, pair));
+}
+
 void jit_brgemm_kernel_t::gemv_microkernel(
         bool is_bdb_tail, int ld_block2, bool is_rd_tail, int vpad) {
 
@@ -2087,6 +2216,11 @@ void jit_brgemm_kernel_t::bdb_loop() {
                 ? true
                 : false;
 
+    // Indexed FMLA would consume f16 A without up-conversion
+    if (brg.is_f16) n_bcast_1_load = false;
+    // The quadwords of transposed A are along M
+    if (brg.is_trans_A) n_bcast_1_load = false;
+
     auto bdb_loop_sve512 = [=](bool skip_accumulation) {
         Label bdb_loop_end_label, no_vpad_label;
         if (vpad_exist) {
@@ -2207,10 +2341,10 @@ void jit_brgemm_kernel_t::bdb_loop() {
 
 void jit_brgemm_kernel_t::generate() {
 
-    if (!one_of(brg.isa_impl, sve_512, sve_256, sve_128)) {
+    if (!one_of(brg.isa_impl, sve_512, sve_256, sve_128, sve)) {
         assert(!"unsupported isa: jit_brgemm_kernel_t only supports SVE 512, "
-                "256 and 128, this should have been checked earlier in the "
-                "implementation");
+                "256, 128 and vector length agnostic SVE, this should have "
+                "been checked earlier in the implementation");
     }
 
     size_t simd_w_ = simd_elems(data_type::f32, brg.isa_impl);
@@ -2239,6 +2373,10 @@ void jit_brgemm_kernel_t::generate() {
             && IMPLICATION(!vpad_exist, brg.req_cal_comp_pads);
 
     set_preg(ld_tail_mask.s, brg.ldb_tail, X_TMP_0, X_TMP_1);
+    if (brg.is_f16_acc) {
+        set_preg(ld_tail_mask_h.h, brg.ldb_tail, X_TMP_0, X_TMP_1);
+        set_preg(ld_half_mask_h.h, brg.ld_block, X_TMP_0, X_TMP_1);
+    }
     if (brg.is_int8 && !brg.has_int8_vnni) { assert(!"unsupported\n"); }
 
     read_params();
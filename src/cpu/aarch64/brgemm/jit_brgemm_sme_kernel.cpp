@@ -48,6 +48,34 @@ void jit_brgemm_sme_kernel_base_t::generate() {
     const int sme_capacity
             = get_sme_length() >> 2u; // float == 4 bytes per sample
 
+    // bf16 and int8 are computed with widening outer products (bfmopa,
+    // smopa/usmopa) accumulating into f32/s32 tiles. A rows and vnni-packed B
+    // rows are then handled as 32-bit words, each holding 'vnni' values along
+    // the reduce dim, so the load/store code below is shared with f32.
+    const int vnni = static_cast<int>(data_type_vnni_granularity(brg.dt_b));
+    const bool is_bf16 = brg.is_bf16;
+    const bool is_int8 = brg.is_int8;
+    const bool is_A_unsigned = brg.dt_a == data_type::u8;
+
+    // Widening outer products are predicated per source element: predicates
+    // p4-p6 mirror p0-p2 with every word split into 'vnni' active elements
+    auto mopa_pred = [=](const _PReg &p) -> _PReg {
+        return vnni == 1 ? p : PReg(p.getIdx() + 4) / T_m;
+    };
+
+    auto mopa = [=](const ZARegS &za, const _PReg &pn /*div T_m*/,
+                        const _PReg &pm /*div T_m*/, const ZReg &zn,
+                        const ZReg &zm) {
+        if (is_bf16)
+            bfmopa(za, mopa_pred(pn), mopa_pred(pm), zn.h, zm.h);
+        else if (is_int8 && is_A_unsigned)
+            usmopa(za, mopa_pred(pn), mopa_pred(pm), zn.b, zm.b);
+        else if (is_int8)
+            smopa(za, mopa_pred(pn), mopa_pred(pm), zn.b, zm.b);
+        else
+            fmopa(za, pn, pm, zn.s, zm.s);
+    };
+
     /** Fill A into ZA tile 0
      * @param zaRegOffset Base offset of ZA tile
      * @param pg Predicate of ZA tile which controls how much samples to load from A along K (reduced) dim
@@ -73,7 +101,7 @@ void jit_brgemm_sme_kernel_base_t::generate() {
         return loads;
     };
 
-    /** FMOPA operation applied:
+    /** FMOPA (or widening MOPA) operation applied:
      *     1) ld1w (cont load of 32-bit words) of B lines (number of lines is based on reduce dim but limited by size of SME tile)
      *     2) mova vertical lines from tile 0 which contains A (extracting A.T)
      *     3) as soon as Z registers are full => FMOPA operations are applied for up to 3 tiles (Tile 0 is used to contain A)
@@ -123,9 +151,9 @@ void jit_brgemm_sme_kernel_base_t::generate() {
                     A_itr = A_zregs.begin();
                     B_itr = B_zregs.begin();
                     do {
-                        fmopa(za1.s, pA_T, pB, A_itr->s, (B_itr++)->s);
-                        fmopa(za2.s, pA_T, pB, A_itr->s, (B_itr++)->s);
-                        fmopa(za3.s, pA_T, pB_last, A_itr->s, (B_itr++)->s);
+                        mopa(za1.s, pA_T, pB, *A_itr, *(B_itr++));
+                        mopa(za2.s, pA_T, pB, *A_itr, *(B_itr++));
+                        mopa(za3.s, pA_T, pB_last, *A_itr, *(B_itr++));
                         ++A_itr;
                     } while (A_itr != A_zregs.end());
                     A_itr = A_zregs.begin();
@@ -137,9 +165,9 @@ void jit_brgemm_sme_kernel_base_t::generate() {
             if (A_itr != A_zregs.begin()) {
                 B_itr = B_zregs.begin();
                 for (auto itr = A_zregs.begin(); itr != A_itr; ++itr) {
-                    fmopa(za1.s, pA_T, pB, itr->s, (B_itr++)->s);
-                    fmopa(za2.s, pA_T, pB, itr->s, (B_itr++)->s);
-                    fmopa(za3.s, pA_T, pB_last, itr->s, (B_itr++)->s);
+                    mopa(za1.s, pA_T, pB, *itr, *(B_itr++));
+                    mopa(za2.s, pA_T, pB, *itr, *(B_itr++));
+                    mopa(za3.s, pA_T, pB_last, *itr, *(B_itr++));
                 }
             }
         } else if (2 == used_tiles) {
@@ -158,8 +186,8 @@ void jit_brgemm_sme_kernel_base_t::generate() {
                     A_itr = A_zregs.begin();
                     B_itr = B_zregs.begin();
                     do {
-                        fmopa(za1.s, pA_T, pB, A_itr->s, (B_itr++)->s);
-                        fmopa(za2.s, pA_T, pB, A_itr->s, (B_itr++)->s);
+                        mopa(za1.s, pA_T, pB, *A_itr, *(B_itr++));
+                        mopa(za2.s, pA_T, pB, *A_itr, *(B_itr++));
                         ++A_itr;
                     } while (A_itr != A_zregs.end());
                     A_itr = A_zregs.begin();
@@ -171,8 +199,8 @@ void jit_brgemm_sme_kernel_base_t::generate() {
             if (A_itr != A_zregs.begin()) {
                 B_itr = B_zregs.begin();
                 for (auto itr = A_zregs.begin(); itr != A_itr; ++itr) {
-                    fmopa(za1.s, pA_T, pB, itr->s, (B_itr++)->s);
-                    fmopa(za2.s, pA_T, pB, itr->s, (B_itr++)->s);
+                    mopa(za1.s, pA_T, pB, *itr, *(B_itr++));
+                    mopa(za2.s, pA_T, pB, *itr, *(B_itr++));
                 }
             }
         } else {
@@ -189,7 +217,7 @@ void jit_brgemm_sme_kernel_base_t::generate() {
                     A_itr = A_zregs.begin();
                     B_itr = B_zregs.begin();
                     do {
-                        fmopa(za1.s, pA_T, pB_last, A_itr->s, (B_itr++)->s);
+                        mopa(za1.s, pA_T, pB_last, *A_itr, *(B_itr++));
                         ++A_itr;
                     } while (A_itr != A_zregs.end());
                     A_itr = A_zregs.begin();
@@ -200,7 +228,7 @@ void jit_brgemm_sme_kernel_base_t::generate() {
             if (A_itr != A_zregs.begin()) {
                 B_itr = B_zregs.begin();
                 for (auto itr = A_zregs.begin(); itr != A_itr; ++itr) {
-                    fmopa(za1.s, pA_T, pB, itr->s, (B_itr++)->s);
+                    mopa(za1.s, pA_T, pB, *itr, *(B_itr++));
                 }
             }
         }
@@ -347,12 +375,13 @@ void jit_brgemm_sme_kernel_base_t::generate() {
     int ldb = brg.load_dim / ld_block;
     int ld_tail = brg.load_dim % ld_block;
 
+    // Reduce dim is processed in 32-bit words of 'vnni' elements
     int rd_block = sme_capacity;
-    int rdb = brg.reduce_dim / rd_block;
-    int rd_tail = brg.reduce_dim % rd_block;
+    int rdb = brg.reduce_dim / vnni / rd_block;
+    int rd_tail = brg.reduce_dim / vnni % rd_block;
 
     int A_stride = brg.LDA * brg.typesize_A;
-    int B_stride = brg.LDB * brg.typesize_B;
+    int B_stride = brg.LDB * brg.typesize_B * vnni;
     int D_stride = brg.LDD * brg.typesize_D;
     std::vector<ZReg> A_zregs = {z24, z25, z26, z27, z28, z29, z30, z31};
     std::vector<ZReg> B_zregs = {z0, z1, z2, z3, z4, z5, z6, z7, z8, z9, z10,
@@ -420,7 +449,7 @@ void jit_brgemm_sme_kernel_base_t::generate() {
         mov(x23, x10);
         st1w_tiles_to_D(D_zregs, p0, p2, w13, x23, bd.size, ld.size);
         add(x10, x10, ld.size * brg.typesize_D);
-        add(x8, x8, ld.size * brg.typesize_B);
+        add(x8, x8, ld.size * brg.typesize_B * vnni);
     };
 
     preamble();
@@ -449,6 +478,19 @@ void jit_brgemm_sme_kernel_base_t::generate() {
     whilelo(p1.s, xzr, x20); // Broadcast dim tail predicate (M tail)
     whilelo(p2.s, xzr, x21); // Load dim tail predicate (N tail)
     whilelo(p3.s, xzr, x22); // Reduce dim tail predicate (K tail)
+    if (vnni == 2) {
+        ptrue(p4.h);
+        mov(x20, bd_tail * vnni);
+        mov(x21, (ld_tail % sme_capacity) * vnni);
+        whilelo(p5.h, xzr, x20);
+        whilelo(p6.h, xzr, x21);
+    } else if (vnni == 4) {
+        ptrue(p4.b);
+        mov(x20, bd_tail * vnni);
+        mov(x21, (ld_tail % sme_capacity) * vnni);
+        whilelo(p5.b, xzr, x20);
+        whilelo(p6.b, xzr, x21);
+    }
 
     if (bdb > 0) { // Full SME tile is used for loading along broadcast (M) dim
         Label bdb_loop, ldb_loop;
@@ -0,0 +1,219 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/aarch64/cpu_calibration.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace cpu_calibration {
+
+namespace {
+
+using namespace Xbyak_aarch64;
+
+// Runs `iters` times a batch of independent f32 FMAs.
+// void kernel(size_t iters)
+struct jit_fma_loop_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_fma_loop_t)
+
+    // Independent FMAs of an iteration, enough to hide the FMA latency of
+    // all the pipelines
+    static constexpr int n_acc = 24;
+
+    static double flops_per_iter() {
+        const size_t vlen = mayiuse(sve_128) ? get_sve_length() : 16;
+        return 2. * n_acc * vlen / sizeof(float);
+    }
+
+private:
+    void generate() override {
+        const bool is_sve = mayiuse(sve_128);
+        preamble();
+        for (int i = 0; i < n_acc; i++)
+            movi(VReg2D(i), 0);
+        movi(VReg2D(30), 0);
+        movi(VReg2D(31), 0);
+
+        Label loop;
+        L(loop);
+        for (int i = 0; i < n_acc; i++) {
+            if (is_sve)
+                fmla(ZRegS(i), P_ALL_ONE / T_m, ZRegS(30), ZRegS(31));
+            else
+                fmla(VReg4S(i), VReg4S(30), VReg4S(31));
+        }
+        subs(abi_param1, abi_param1, 1);
+        b(NE, loop);
+        postamble();
+    }
+};
+
+// Reads `bytes` bytes, a multiple of `step`, from `ptr`.
+// void kernel(const void *ptr, size_t bytes)
+struct jit_read_loop_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_read_loop_t)
+
+    static constexpr size_t step = 128;
+
+private:
+    void generate() override {
+        preamble();
+        Label loop;
+        L(loop);
+        for (int i = 0; i < 4; i++)
+            ldp(QReg(2 * i), QReg(2 * i + 1), post_ptr(abi_param1, 32));
+        subs(abi_param2, abi_param2, step);
+        b(NE, loop);
+        postamble();
+    }
+};
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+size_t get_llc_size() {
+    size_t per_core = platform::get_per_core_cache_size(3);
+    if (per_core == 0) per_core = platform::get_per_core_cache_size(2);
+    return per_core * platform::get_num_cores();
+}
+
+machine_perf_t calibrate() {
+    machine_perf_t perf;
+    if (getenv_int_user("CPU_CALIBRATION", 1) == 0) return perf;
+
+    jit_fma_loop_t fma_loop;
+    jit_read_loop_t read_loop;
+    if (fma_loop.create_kernel() != status::success
+            || read_loop.create_kernel() != status::success)
+        return perf;
+
+    const int nthr = dnnl_get_max_threads();
+
+    // The FMAs run on all the threads at once, the first run bringing the
+    // cores to the frequency they sustain under a full load.
+    const size_t fma_iters = 1 << 17;
+    std::vector<double> thr_gflops(nthr, 0);
+    std::atomic<bool> team_mismatch(false);
+    parallel(nthr, [&](int ithr, int nthr_) {
+        if (nthr_ != nthr) {
+            team_mismatch = true;
+            return;
+        }
+        fma_loop(fma_iters);
+        const auto start = std::chrono::steady_clock::now();
+        fma_loop(fma_iters);
+        thr_gflops[ithr] = 1e-9 * fma_iters * jit_fma_loop_t::flops_per_iter()
+                / seconds_since(start);
+    });
+    if (team_mismatch) return perf;
+
+    // The buffer is well beyond the last level cache, so that it streams from
+    // memory, each thread reading the part it first touched.
+    const size_t max_buf_size = size_t(512) << 20;
+    const size_t buf_size = nstl::min(max_buf_size,
+            nstl::max(size_t(64) << 20, 4 * get_llc_size()));
+    const size_t chunk
+            = utils::rnd_dn(buf_size / nthr, jit_read_loop_t::step);
+    if (chunk == 0) return perf;
+    char *buf = static_cast<char *>(
+            impl::malloc(chunk * nthr, platform::get_cache_line_size()));
+    if (buf == nullptr) return perf;
+
+    std::vector<double> thr_bw(nthr, 0);
+    parallel(nthr, [&](int ithr, int nthr_) {
+        if (nthr_ != nthr) {
+            team_mismatch = true;
+            return;
+        }
+        char *thr_buf = buf + ithr * chunk;
+        std::memset(thr_buf, 0, chunk);
+        read_loop(thr_buf, chunk);
+        const auto start = std::chrono::steady_clock::now();
+        read_loop(thr_buf, chunk);
+        thr_bw[ithr] = 1e-9 * chunk / seconds_since(start);
+    });
+
+    const size_t core_bytes = chunk * nthr;
+    read_loop(buf, core_bytes);
+    const auto start = std::chrono::steady_clock::now();
+    read_loop(buf, core_bytes);
+    const double core_bw = 1e-9 * core_bytes / seconds_since(start);
+    impl::free(buf);
+    if (team_mismatch) return perf;
+
+    // The threads don't start at the same time, so adding their bandwidths
+    // may overestimate the total one. This errs on the side of keeping
+    // threads.
+    double gflops = 0, total_bw = 0;
+    for (int ithr = 0; ithr < nthr; ithr++) {
+        gflops += thr_gflops[ithr];
+        total_bw += thr_bw[ithr];
+    }
+    perf.core_gflops = gflops / nthr;
+    perf.core_bw = core_bw;
+    perf.total_bw = nstl::max(total_bw, core_bw);
+    return perf;
+}
+
+} // namespace
+
+const machine_perf_t &get_machine_perf() {
+    static const machine_perf_t perf = calibrate();
+    return perf;
+}
+
+int get_nthr_for_work(int nthr, double flops, double bytes) {
+    if (nthr <= 1 || bytes <= get_llc_size()) return nthr;
+    const machine_perf_t &perf = get_machine_perf();
+    if (!perf.is_valid()) return nthr;
+
+    // Roofline estimate of the time, in ns, with `n` threads
+    auto get_time = [&](int n) {
+        const double bw = nstl::min(n * perf.core_bw, perf.total_bw);
+        return nstl::max(flops / (n * perf.core_gflops), bytes / bw);
+    };
+    // Threads which gain less than 5% of the time only add synchronization
+    const double min_time = get_time(nthr);
+    for (int n = 1; n < nthr; n++)
+        if (get_time(n) <= 1.05 * min_time) return n;
+    return nthr;
+}
+
+} // namespace cpu_calibration
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
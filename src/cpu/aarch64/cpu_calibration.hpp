@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_CPU_CALIBRATION_HPP
+#define CPU_AARCH64_CPU_CALIBRATION_HPP
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace cpu_calibration {
+
+// Throughput of the machine, measured once per process when first queried.
+// The FMA throughput is measured with all the threads busy, so it reflects
+// the frequency the cores sustain under a full load (all-core turbo, SVE
+// power throttling) rather than the nominal one.
+struct machine_perf_t {
+    // f32 FMA throughput of one core, in GFLOPS
+    double core_gflops = 0;
+    // Memory read bandwidth of one core, in GB/s
+    double core_bw = 0;
+    // Memory read bandwidth of all the threads together, in GB/s
+    double total_bw = 0;
+
+    bool is_valid() const {
+        return core_gflops > 0 && core_bw > 0 && total_bw > 0;
+    }
+};
+
+// Returns the measured throughput. The values are invalid when the
+// calibration is disabled with ONEDNN_CPU_CALIBRATION=0 or the threading
+// runtime didn't give it the expected threads.
+const machine_perf_t &get_machine_perf();
+
+// Returns the number of threads, at most `nthr`, past which a problem of
+// `flops` floating point operations streaming `bytes` bytes from memory
+// doesn't run noticeably faster: the bandwidth of a memory bound problem is
+// saturated by fewer threads than the machine has. Returns `nthr` for
+// problems fitting in the last level cache or when the machine isn't
+// calibrated.
+int get_nthr_for_work(int nthr, double flops, double bytes);
+
+} // namespace cpu_calibration
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <fstream>
+#include <string>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/cpu_capacity.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace cpu_capacity {
+
+namespace {
+
+struct capacity_table_t {
+    capacity_table_t() {
+#if defined(__linux__)
+        const long ncpus = sysconf(_SC_NPROCESSORS_CONF);
+        for (long cpu = 0; cpu < ncpus; cpu++) {
+            const std::string path = "/sys/devices/system/cpu/cpu"
+                    + std::to_string(cpu) + "/cpu_capacity";
+            std::ifstream file(path);
+            int capacity = 0;
+            if (!(file >> capacity) || capacity <= 0)
+                capacity = max_capacity;
+            capacities.push_back(capacity);
+        }
+
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        if (sched_getaffinity(0, sizeof(cpu_set_t), &cpu_set) == 0) {
+            int min_cap = max_capacity, max_cap = 0;
+            for (size_t cpu = 0; cpu < capacities.size(); cpu++) {
+                if (cpu >= CPU_SETSIZE || !CPU_ISSET(cpu, &cpu_set)) continue;
+                min_cap = nstl::min(min_cap, capacities[cpu]);
+                max_cap = nstl::max(max_cap, capacities[cpu]);
+            }
+            heterogeneous = max_cap > min_cap;
+        }
+#endif
+    }
+
+    std::vector<int> capacities;
+    bool heterogeneous = false;
+};
+
+const capacity_table_t &capacity_table() {
+    static const capacity_table_t table;
+    return table;
+}
+
+} // namespace
+
+int get_capacity(int cpu) {
+    const auto &caps = capacity_table().capacities;
+    if (cpu < 0 || static_cast<size_t>(cpu) >= caps.size())
+        return max_capacity;
+    return caps[cpu];
+}
+
+bool is_heterogeneous() {
+    return capacity_table().heterogeneous;
+}
+
+void get_thread_capacities(int nthr, std::vector<int> &capacities) {
+    capacities.assign(nthr, max_capacity);
+#if defined(__linux__)
+    std::atomic<bool> team_mismatch(false);
+    parallel(nthr, [&](int ithr, int nthr_) {
+        if (nthr_ != nthr) {
+            team_mismatch = true;
+            return;
+        }
+        capacities[ithr] = get_capacity(sched_getcpu());
+    });
+    if (team_mismatch) capacities.clear();
+#endif
+}
+
+} // namespace cpu_capacity
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
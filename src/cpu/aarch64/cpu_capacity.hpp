@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_CPU_CAPACITY_HPP
+#define CPU_AARCH64_CPU_CAPACITY_HPP
+
+#include <vector>
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace cpu_capacity {
+
+// Capacity of the biggest cores of the system. The capacities reported by the
+// OS are normalized to this value.
+constexpr int max_capacity = 1024;
+
+// Returns the relative performance of a logical CPU as reported by Linux in
+// /sys/devices/system/cpu/cpu<N>/cpu_capacity, which comes from the ACPI CPPC
+// or the devicetree capacity-dmips-mhz values. Returns max_capacity when the
+// value is not available.
+int get_capacity(int cpu);
+
+// Returns true if the CPUs the process may run on have different capacities,
+// e.g. on SoCs with big and little cores.
+bool is_heterogeneous();
+
+// Fills `capacities` with the capacity of the CPU the thread `ithr` of a
+// parallel section with `nthr` threads runs on. The result is meaningful only
+// when the threads are bound to CPUs, e.g. with OMP_PROC_BIND. `capacities`
+// is left empty when the threading runtime does not create `nthr` threads.
+void get_thread_capacities(int nthr, std::vector<int> &capacities);
+
+} // namespace cpu_capacity
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -234,6 +234,14 @@ inline uint64_t get_sme_length(data_type_t data_type) {
     return get_sme_length() / dt_size;
 }
 
+// Whether the SVE vectors are longer than the widest vector length specific
+// ISA, whose kernels would only use a part of them
+inline bool is_wide_sve() {
+    return mayiuse(sve)
+            && get_sve_length()
+            > static_cast<uint64_t>(cpu_isa_traits<sve_512>::vlen);
+}
+
 inline int isa_max_vlen(cpu_isa_t isa) {
     if (isa == sve_512)
         return cpu_isa_traits<sve_512>::vlen;
@@ -257,7 +265,7 @@ inline bool mayiuse_atomic() {
 }
 
 inline bool isa_has_s8s8(cpu_isa_t isa) {
-    return is_superset(isa, sve_128);
+    return is_superset(isa, sve_128) || isa == sme;
 }
 
 inline bool mayiuse_bf16() {
@@ -265,6 +273,11 @@ inline bool mayiuse_bf16() {
     return cpu().isBf16Supported();
 }
 
+inline bool mayiuse_i8mm() {
+    using namespace Xbyak_aarch64::util;
+    return cpu().isI8mmSupported();
+}
+
 inline int isa_num_vregs(cpu_isa_t isa) {
     if (isa == sve_512)
         return cpu_isa_traits<sve_512>::n_vregs;
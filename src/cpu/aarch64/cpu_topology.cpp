@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/cpu_topology.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace cpu_topology {
+
+namespace {
+
+// Returns the first line of a sysfs file, or an empty string
+std::string read_line(const std::string &path) {
+    std::ifstream file(path);
+    std::string line;
+    if (!std::getline(file, line)) return std::string();
+    return line;
+}
+
+// Returns the number of CPUs of a list such as "0-3,8,10-11"
+int count_cpus(const std::string &list) {
+    int count = 0;
+    size_t pos = 0;
+    while (pos < list.size()) {
+        size_t end = list.find(',', pos);
+        if (end == std::string::npos) end = list.size();
+        const std::string range = list.substr(pos, end - pos);
+        const size_t dash = range.find('-');
+        const int first = std::atoi(range.c_str());
+        const int last = dash == std::string::npos
+                ? first
+                : std::atoi(range.c_str() + dash + 1);
+        if (last >= first) count += last - first + 1;
+        pos = end + 1;
+    }
+    return count;
+}
+
+// Returns the bytes of a size such as "64K" or "32M"
+size_t parse_size(const std::string &str) {
+    char *suffix = nullptr;
+    size_t size = std::strtoul(str.c_str(), &suffix, 10);
+    if (suffix && *suffix == 'K') size <<= 10;
+    if (suffix && *suffix == 'M') size <<= 20;
+    if (suffix && *suffix == 'G') size <<= 30;
+    return size;
+}
+
+struct topology_t {
+    topology_t() {
+#if defined(__linux__)
+        int cpu = 0;
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        if (sched_getaffinity(0, sizeof(cpu_set_t), &cpu_set) == 0) {
+            while (cpu < CPU_SETSIZE - 1 && !CPU_ISSET(cpu, &cpu_set))
+                cpu++;
+        }
+        const std::string cpu_path
+                = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+
+        for (int index = 0;; index++) {
+            const std::string path
+                    = cpu_path + "/cache/index" + std::to_string(index);
+            const std::string level_str = read_line(path + "/level");
+            if (level_str.empty()) break;
+            const std::string type = read_line(path + "/type");
+            const int level = std::atoi(level_str.c_str());
+            if (type == "Instruction" || level < 1 || level > max_cache_level)
+                continue;
+            cache_info_t &cache = caches[level - 1];
+            cache.size = parse_size(read_line(path + "/size"));
+            cache.sharing_cpus = nstl::max(
+                    1, count_cpus(read_line(path + "/shared_cpu_list")));
+            cache.sets = std::atoi(read_line(path + "/number_of_sets").c_str());
+            cache.ways = std::atoi(
+                    read_line(path + "/ways_of_associativity").c_str());
+        }
+
+        const int siblings = count_cpus(
+                read_line(cpu_path + "/topology/thread_siblings_list"));
+        if (siblings > 0) threads_per_core = siblings;
+        cluster_size
+                = count_cpus(read_line(cpu_path + "/topology/cluster_cpus_list"));
+#endif
+    }
+
+    cache_info_t caches[max_cache_level];
+    int threads_per_core = 1;
+    int cluster_size = 0;
+};
+
+const topology_t &topology() {
+    static const topology_t t;
+    return t;
+}
+
+} // namespace
+
+const cache_info_t &get_cache_info(int level) {
+    static const cache_info_t no_cache;
+    if (level < 1 || level > max_cache_level) return no_cache;
+    return topology().caches[level - 1];
+}
+
+int get_threads_per_core() {
+    return topology().threads_per_core;
+}
+
+int get_cluster_size() {
+    return topology().cluster_size;
+}
+
+} // namespace cpu_topology
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_CPU_TOPOLOGY_HPP
+#define CPU_AARCH64_CPU_TOPOLOGY_HPP
+
+#include <cstddef>
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace cpu_topology {
+
+// Data or unified cache of one level
+struct cache_info_t {
+    size_t size = 0; // bytes of the whole cache, 0 if the level is unknown
+    int sharing_cpus = 0; // logical CPUs sharing the cache
+    int sets = 0;
+    int ways = 0;
+};
+
+// Maximum cache level reported
+constexpr int max_cache_level = 4;
+
+// Returns the data or unified cache of `level` (from 1) of the first CPU the
+// process may run on, as described by Linux in
+// /sys/devices/system/cpu/cpu<N>/cache/index<M>. Linux fills these from the
+// ACPI PPTT table or the devicetree, which also describe system level caches
+// shared by all the cores, unlike the ID registers. The size is 0 when the
+// level is not reported.
+const cache_info_t &get_cache_info(int level);
+
+// Returns the number of logical CPUs per core, 1 unless the cores have SMT.
+int get_threads_per_core();
+
+// Returns the number of logical CPUs in the cluster of the first CPU the
+// process may run on, e.g. the cores sharing an L2 or L3 slice on some SoCs,
+// or 0 if the cluster is not reported.
+int get_cluster_size();
+
+} // namespace cpu_topology
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
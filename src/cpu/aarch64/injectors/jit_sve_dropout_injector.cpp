@@ -0,0 +1,153 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstddef>
+
+#include "cpu/aarch64/injectors/jit_sve_dropout_injector.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+void jit_sve_dropout_injector_t::load_arg(const ZReg &z, size_t offset) {
+    h->ld1rw(z.s, h->P_ALL_ONE / T_z,
+            ptr(x_args_, static_cast<int32_t>(offset)));
+}
+
+void jit_sve_dropout_injector_t::load_const(const ZReg &z, uint32_t value) {
+    h->mov_imm(WReg(x_tmp_.getIdx()), value);
+    h->dup(z.s, WReg(x_tmp_.getIdx()));
+}
+
+void jit_sve_dropout_injector_t::mulhilo(
+        const ZReg &hi, const ZReg &lo, const ZReg &a, const ZReg &m) {
+    h->movprfx(hi, a);
+    h->umulh(hi.s, h->P_ALL_ONE / T_m, m.s);
+    h->movprfx(lo, a);
+    h->mul(lo.s, h->P_ALL_ONE / T_m, m.s);
+}
+
+void jit_sve_dropout_injector_t::compute_vector(
+        const ZReg &z_data, const XReg &x_idx, const XReg &x_mask, bool tail) {
+    // Registers are renamed across the rounds instead of being moved.
+    ZReg ctr[4] = {aux(0), aux(1), aux(2), aux(3)};
+    ZReg tmp[4] = {aux(4), aux(5), aux(6), aux(7)};
+    const ZReg key0 = aux(8), key1 = aux(9);
+    const ZReg mul0 = aux(10), mul1 = aux(11);
+    const ZReg key_inc0 = aux(12), key_inc1 = aux(13);
+    const WReg w_idx(x_idx.getIdx()), w_tmp(x_tmp_.getIdx());
+    const int32_t use_offset_off = offsetof(dropout_args_t, use_offset);
+    const size_t seed_off = offsetof(dropout_args_t, seed);
+    const size_t offset_off = offsetof(dropout_args_t, offset);
+
+    Label l_legacy, l_rounds, l_selected;
+
+    // Philox 4x32 multipliers and key increments
+    load_const(mul0, 0xd2511f53);
+    load_const(mul1, 0xcd9e8d57);
+    load_const(key_inc0, 0x9e3779b9);
+    load_const(key_inc1, 0xbb67ae85);
+
+    // Low halves of the indices of the lanes, and the counter word holding
+    // them rounded down to a multiple of 4
+    h->index(tmp[1].s, w_idx, 1);
+    h->mov(ctr[2].d, tmp[1].d);
+    h->and_(ctr[2].s, 0xfffffffc);
+
+    h->ldr(w_tmp, ptr(x_args_, use_offset_off));
+    h->cbz(w_tmp, l_legacy);
+    // The counter is (offset, index) with 64-bit halves: the high half of the
+    // index is carried into where the low halves of the lanes wrap around.
+    h->lsr(x_tmp_, x_idx, 32);
+    h->dup(ctr[3].s, w_tmp);
+    h->dup(tmp[0].s, w_idx);
+    h->cmphi(p_aux_.s, h->P_ALL_ONE / T_z, tmp[0].s, tmp[1].s);
+    h->mov(tmp[0].s, p_aux_ / T_z, 1);
+    h->add(ctr[3].s, ctr[3].s, tmp[0].s);
+    load_arg(ctr[0], offset_off);
+    load_arg(ctr[1], offset_off + 4);
+    load_arg(key0, seed_off);
+    load_arg(key1, seed_off + 4);
+    h->b(l_rounds);
+
+    // The legacy counter is (x, x + 1, x, x + 3) for the 32-bit index x
+    // rounded down to a multiple of 4, with the low half of the seed as both
+    // keys.
+    h->L(l_legacy);
+    h->mov(ctr[0].d, ctr[2].d);
+    h->mov(ctr[1].d, ctr[2].d);
+    h->add(ctr[1].s, 1);
+    h->mov(ctr[3].d, ctr[2].d);
+    h->add(ctr[3].s, 3);
+    load_arg(key0, seed_off);
+    h->mov(key1.d, key0.d);
+
+    h->L(l_rounds);
+    constexpr int n_rounds = 10;
+    for (int r = 0; r < n_rounds; r++) {
+        mulhilo(tmp[1], tmp[0], ctr[0], mul0);
+        mulhilo(tmp[3], tmp[2], ctr[2], mul1);
+        // (hi_1 ^ c_1 ^ k_0, lo_1, hi_0 ^ c_3 ^ k_1, lo_0)
+        h->eor(ctr[1].d, ctr[1].d, tmp[3].d);
+        h->eor(ctr[1].d, ctr[1].d, key0.d);
+        h->eor(ctr[3].d, ctr[3].d, tmp[1].d);
+        h->eor(ctr[3].d, ctr[3].d, key1.d);
+        const ZReg new_ctr[4] = {ctr[1], tmp[2], ctr[3], tmp[0]};
+        const ZReg new_tmp[4] = {ctr[0], ctr[2], tmp[1], tmp[3]};
+        for (int i = 0; i < 4; i++) {
+            ctr[i] = new_ctr[i];
+            tmp[i] = new_tmp[i];
+        }
+        if (r == n_rounds - 1) break;
+        h->add(key0.s, key0.s, key_inc0.s);
+        h->add(key1.s, key1.s, key_inc1.s);
+    }
+
+    // The legacy generator returns the third word to all the lanes, the other
+    // one the word of the lane index modulo 4.
+    const ZReg rnd = tmp[0];
+    h->mov(rnd.d, ctr[2].d);
+    h->ldr(w_tmp, ptr(x_args_, use_offset_off));
+    h->cbz(w_tmp, l_selected);
+    h->index(tmp[1].s, w_idx, 1);
+    h->and_(tmp[1].s, 3);
+    h->mov(rnd.d, ctr[0].d);
+    for (int w = 1; w < 4; w++) {
+        h->cmpeq(p_aux_.s, h->P_ALL_ONE / T_z, tmp[1].s, w);
+        h->mov(rnd.s, p_aux_ / T_m, ctr[w].s);
+    }
+    h->L(l_selected);
+
+    load_arg(tmp[1], offsetof(dropout_args_t, threshold));
+    h->cmphi(p_keep_.s, h->P_ALL_ONE / T_z, rnd.s, tmp[1].s);
+    load_arg(tmp[1], offsetof(dropout_args_t, inv_q));
+    h->movprfx(z_data.s, p_keep_ / T_z, z_data.s);
+    h->fmul(z_data.s, p_keep_ / T_m, tmp[1].s);
+    if (with_mask_) {
+        h->mov(tmp[1].s, p_keep_ / T_z, 1);
+        h->st1b(tmp[1].s, tail ? p_tail_ : h->P_ALL_ONE, ptr(x_mask));
+    }
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_INJECTORS_JIT_SVE_DROPOUT_INJECTOR_HPP
+#define CPU_AARCH64_INJECTORS_JIT_SVE_DROPOUT_INJECTOR_HPP
+
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Applies dropout to f32 vectors, generating the random values in registers
+// with the Philox 4x32-10 generator of `ref_dropout(...)`. The random value of
+// an element depends only on its logical index, the seed and the offset, so
+// it is computed where the element is produced and no mask tensor is read or
+// written unless the user requested it. Works for any SVE vector length.
+struct jit_sve_dropout_injector_t {
+    // Arguments description:
+    // host - jit generator which is filled with instructions
+    // z_aux_start - first of the `n_vregs` consecutive Z registers the
+    //   injector uses
+    // p_aux, p_keep - predicate registers the injector uses
+    // p_tail - predicate of the valid lanes of a tail vector
+    // x_args - register holding the address of a `dropout_args_t`
+    // x_tmp - scratch register
+    // with_mask - when true, the mask of the kept elements is stored as u8
+    jit_sve_dropout_injector_t(jit_generator_t *host, int z_aux_start,
+            const Xbyak_aarch64::PReg &p_aux,
+            const Xbyak_aarch64::PReg &p_keep,
+            const Xbyak_aarch64::PReg &p_tail,
+            const Xbyak_aarch64::XReg &x_args,
+            const Xbyak_aarch64::XReg &x_tmp, bool with_mask)
+        : h(host)
+        , z_aux_start_(z_aux_start)
+        , p_aux_(p_aux)
+        , p_keep_(p_keep)
+        , p_tail_(p_tail)
+        , x_args_(x_args)
+        , x_tmp_(x_tmp)
+        , with_mask_(with_mask) {}
+
+    static constexpr int n_vregs = 14;
+
+    // Applies dropout to the elements of `z_data` of logical indices from
+    // `x_idx`. The mask, if any, is stored to the address in `x_mask`; only
+    // the lanes of `p_tail` are stored when `tail` is set.
+    void compute_vector(const Xbyak_aarch64::ZReg &z_data,
+            const Xbyak_aarch64::XReg &x_idx,
+            const Xbyak_aarch64::XReg &x_mask, bool tail = false);
+
+private:
+    jit_generator_t *const h;
+    const int z_aux_start_;
+    const Xbyak_aarch64::PReg p_aux_;
+    const Xbyak_aarch64::PReg p_keep_;
+    const Xbyak_aarch64::PReg p_tail_;
+    const Xbyak_aarch64::XReg x_args_;
+    const Xbyak_aarch64::XReg x_tmp_;
+    const bool with_mask_;
+
+    Xbyak_aarch64::ZReg aux(int i) const {
+        return Xbyak_aarch64::ZReg(z_aux_start_ + i);
+    }
+
+    // Broadcasts the 32-bit value of `dropout_args_t` at `offset`
+    void load_arg(const Xbyak_aarch64::ZReg &z, size_t offset);
+    void load_const(const Xbyak_aarch64::ZReg &z, uint32_t value);
+
+    // hi:lo = m * a
+    void mulhilo(const Xbyak_aarch64::ZReg &hi, const Xbyak_aarch64::ZReg &lo,
+            const Xbyak_aarch64::ZReg &a, const Xbyak_aarch64::ZReg &m);
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -40,6 +40,7 @@ static bcast_set_t get_all_strategies_supported_by_injector() {
             broadcasting_strategy_t::per_oc_spatial,
             broadcasting_strategy_t::per_mb_spatial,
             broadcasting_strategy_t::per_mb_w, broadcasting_strategy_t::per_w,
+            broadcasting_strategy_t::batch,
             broadcasting_strategy_t::no_broadcast};
 }
 
@@ -83,6 +84,30 @@ static bool src1_desc_layout_same_as_dst_d(
             && lhs.offset0 == rhs.offset0;
 }
 
+// The batch offset of src1 is derived from the dst offset, which requires
+// both tensors to share the strides of all the non-batch dimensions.
+static bool src1_desc_batch_layout_same_as_dst_d(
+        const dnnl::impl::memory_desc_t &src1_desc,
+        const memory_desc_wrapper &dst_d) {
+    if (dst_d.md_ == nullptr) return false;
+    const memory_desc_wrapper src1_d(src1_desc);
+    if (!src1_d.is_blocking_desc() || !dst_d.is_blocking_desc()) return false;
+    if (injector_utils::get_layout_type(dst_d)
+            == injector_utils::layout_t::cspn)
+        return false;
+
+    const auto &src1_blk = src1_d.blocking_desc();
+    const auto &dst_blk = dst_d.blocking_desc();
+    if (src1_blk.inner_nblks != dst_blk.inner_nblks) return false;
+    for (int i = 0; i < dst_blk.inner_nblks; i++)
+        if (src1_blk.inner_blks[i] != dst_blk.inner_blks[i]
+                || src1_blk.inner_idxs[i] != dst_blk.inner_idxs[i])
+            return false;
+    for (int d = 1; d < dst_d.ndims(); d++)
+        if (src1_blk.strides[d] != dst_blk.strides[d]) return false;
+    return true;
+}
+
 bool is_bcast_supported(const dnnl::impl::memory_desc_t &src1_desc,
         const memory_desc_wrapper &dst_d,
         const bcast_set_t &supported_strategy_set) {
@@ -93,6 +118,10 @@ bool is_bcast_supported(const dnnl::impl::memory_desc_t &src1_desc,
             IMPLICATION(bcast_type == broadcasting_strategy_t::no_broadcast,
                     src1_desc_layout_same_as_dst_d(src1_desc, dst_d)),
             "src1 and dst must have the same layout if not broadcasting");
+    VCHECK_BIN_INJ_BOOL(
+            IMPLICATION(bcast_type == broadcasting_strategy_t::batch,
+                    src1_desc_batch_layout_same_as_dst_d(src1_desc, dst_d)),
+            "src1 and dst must have the same layout for batch broadcast");
 
     return bcast_type != broadcasting_strategy_t::unsupported;
 }
@@ -677,6 +706,14 @@ rhs_address_t jit_uni_binary_injector_t<isa>::prepare_rhs_arg_addr(
 
             return rhs_address_t(rhs_addr_reg);
         }
+        case broadcasting_strategy_t::batch: {
+            append_oc_spatial_offset(rhs_arg_params.vmm_idx_to_out_addr,
+                    rhs_arg_params.vmm_idx_to_out_reg,
+                    rhs_arg_params.vmm_idx_to_out_elem_off_val, vmm_idx,
+                    rhs_addr_reg, rhs_helper_reg, rhs_arg_elem_size);
+
+            return rhs_address_t(rhs_addr_reg);
+        }
         default: assert(false && "Broadcasting type not supported");
     }
 
@@ -1063,7 +1100,7 @@ void jit_uni_binary_injector_t<isa>::calculate_mb_sp_nspc(
     const auto C = rhs_arg_static_params_.dst_d.padded_dims()[1];
 
     host_->mov_imm(X_TMP_1, C);
-    host_->umod(X_TMP_0, tmp_reg, X_TMP_1);
+    host_->udiv(X_TMP_0, tmp_reg, X_TMP_1);
 }
 
 template <cpu_isa_t isa>
@@ -1379,6 +1416,55 @@ void jit_uni_binary_injector_t<isa>::calculate_w_cspn(
     calculate_w_nspc(strides, tmp_reg);
 }
 
+template <cpu_isa_t isa>
+void jit_uni_binary_injector_t<isa>::append_oc_spatial_offset(
+        const std::map<int, rhs_address_t> &vmm_idx_to_out_addr,
+        const std::map<int, Xbyak_aarch64::XReg> &vmm_idx_to_out_reg,
+        const std::map<int, size_t> &vmm_idx_to_out_elem_off_val, int vmm_idx,
+        const Xbyak_aarch64::XReg &addr_reg, const Xbyak_aarch64::XReg &tmp_reg,
+        std::size_t elem_size_bytes) const {
+
+    const auto it_out_addr = vmm_idx_to_out_addr.find(vmm_idx);
+    const auto it_out_reg = vmm_idx_to_out_reg.find(vmm_idx);
+
+    const bool is_out_addr = it_out_addr != vmm_idx_to_out_addr.end();
+    const bool is_out_reg = it_out_reg != vmm_idx_to_out_reg.end();
+
+    if (is_out_addr || is_out_reg) {
+        assert(rhs_arg_static_params_.is_dst_orig_set()
+                && "dst base addr offset not set");
+        rhs_address_t out_addr = is_out_addr
+                ? it_out_addr->second
+                : rhs_address_t(it_out_reg->second);
+
+        const auto it_off_val = vmm_idx_to_out_elem_off_val.find(vmm_idx);
+        calculate_no_broadcast(out_addr,
+                it_off_val != vmm_idx_to_out_elem_off_val.end()
+                        ? it_off_val->second
+                        : 0,
+                tmp_reg);
+
+        // batch is the outermost dimension of the supported layouts
+        // oc_sp_off = offset % stride_n
+        const auto X_TMP_0 = host_->X_TMP_0;
+        const auto X_TMP_1 = host_->X_TMP_1;
+        const auto strides
+                = rhs_arg_static_params_.dst_d.blocking_desc().strides;
+
+        host_->mov_imm(X_TMP_1, strides[0]);
+        host_->umod(X_TMP_0, tmp_reg, X_TMP_1);
+
+        if (elem_size_bytes == 1) {
+            host_->add(addr_reg, addr_reg, X_TMP_0);
+        } else {
+            const int shift_val = std::log2(elem_size_bytes);
+            host_->mov(tmp_reg, X_TMP_0);
+            host_->lsl(tmp_reg, tmp_reg, shift_val);
+            host_->add(addr_reg, addr_reg, tmp_reg);
+        }
+    }
+}
+
 template <cpu_isa_t isa>
 void jit_uni_binary_injector_t<isa>::inject_binary(
         const dnnl_post_ops::entry_t &post_op, Vmm dst,
@@ -540,6 +540,14 @@ private:
     void calculate_w_cspn(
             const dim_t *strides, const Xbyak_aarch64::XReg &tmp_reg) const;
 
+    void append_oc_spatial_offset(
+            const std::map<int, rhs_address_t> &vmm_idx_to_out_addr,
+            const std::map<int, Xbyak_aarch64::XReg> &vmm_idx_to_out_reg,
+            const std::map<int, size_t> &vmm_idx_to_out_elem_off_val,
+            int vmm_idx, const Xbyak_aarch64::XReg &addr_reg,
+            const Xbyak_aarch64::XReg &tmp_reg,
+            std::size_t elem_size_bytes) const;
+
     void compute_cmp_mask(const Xbyak_aarch64::PReg &cmp_dst,
             const Xbyak_aarch64::PReg &mask, const Xbyak_aarch64::ZReg &cmp_src,
             const Xbyak_aarch64::ZReg &cmp_src2, const unsigned int uimm) const;
@@ -21,6 +21,7 @@
 #include "common/nstl.hpp"
 #include "common/utils.hpp"
 
+#include <cmath>
 #include <cstdint>
 #include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
 
@@ -44,7 +45,7 @@ bool is_alg_supported(alg_kind_t alg) {
             eltwise_soft_relu, eltwise_logistic, eltwise_mish, eltwise_exp,
             eltwise_gelu_tanh, eltwise_hardsigmoid, eltwise_hardswish,
             eltwise_swish, eltwise_log, eltwise_clip, eltwise_clip_v2,
-            /*eltwise_pow, */ eltwise_gelu_erf, eltwise_round,
+            eltwise_pow, eltwise_gelu_erf, eltwise_round,
             eltwise_relu_use_dst_for_bwd, eltwise_tanh_use_dst_for_bwd,
             eltwise_elu_use_dst_for_bwd, eltwise_sqrt_use_dst_for_bwd,
             eltwise_logistic_use_dst_for_bwd, eltwise_exp_use_dst_for_bwd,
@@ -53,8 +54,6 @@ bool is_alg_supported(alg_kind_t alg) {
 
 bool is_supported(cpu_isa_t isa, alg_kind_t alg) {
     using namespace alg_kind;
-    // ASIMD does not currently support eltwise_log.
-    if (isa == asimd && alg == eltwise_log) return false;
     return is_isa_supported(isa) && is_alg_supported(alg);
 }
 
@@ -249,6 +248,7 @@ void jit_uni_eltwise_injector_t<isa>::set_coef_to_regs() {
             case eltwise_gelu_tanh:
             case eltwise_swish:
             case eltwise_log:
+            case eltwise_pow:
             case eltwise_gelu_erf:
             case eltwise_round: break;
             default: assert(!"unsupported eltwise algorithm");
@@ -275,6 +275,7 @@ void jit_uni_eltwise_injector_t<isa>::set_coef_to_regs() {
             case eltwise_gelu_tanh:
             case eltwise_swish:
             case eltwise_log:
+            case eltwise_pow:
             case eltwise_gelu_erf: break;
             case eltwise_hardsigmoid:
             case eltwise_hardswish: h->fmov(vmm_aux1, 1.);
@@ -1526,6 +1527,95 @@ void jit_uni_eltwise_injector_t<isa>::hardsigmoid_compute_vector_bwd(
     h->fmul(vmm_src, vmm_src, z_tmp);
 }
 
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_t<isa>::pow_compute_vector(
+        const TRegS &vmm_src, float exponent) {
+    // Computes x ^ exponent. Exponents with a short exact sequence are
+    // special-cased, the rest is computed as exp(exponent * log(|x|)).
+    if (exponent == 0.f) {
+        table_val(one, vmm_src);
+        return;
+    } else if (exponent == 1.f) {
+        return;
+    } else if (exponent == 0.5f) {
+        h->fsqrt(vmm_src, p_all / T_m, vmm_src);
+        return;
+    } else if (exponent == 2.f) {
+        h->fmul(vmm_src, vmm_src, vmm_src);
+        return;
+    } else if (exponent == 3.f) {
+        h->mov(ZRegD(IDX(vmm_aux0)), ZRegD(IDX(vmm_src)));
+        h->fmul(vmm_src, vmm_src, vmm_src);
+        h->fmul(vmm_src, vmm_src, vmm_aux0);
+        return;
+    } else if (exponent == -1.f) {
+        h->fmov(z_tmp, 1.);
+        h->fdiv(z_tmp, p_all, vmm_src);
+        h->mov(ZRegD(IDX(vmm_src)), ZRegD(IDX(z_tmp)));
+        return;
+    }
+
+    // IMPORTANT: we use vmm_aux5 to save src as neither log nor exp use it.
+    h->mov(ZRegD(IDX(vmm_aux5)), ZRegD(IDX(vmm_src)));
+    h->fabs(vmm_src, p_all / T_m, vmm_src);
+    log_compute_vector_fwd(vmm_src);
+    h->fmul(vmm_src, vmm_src, table_val(pow_exponent, z_tmp));
+    exp_compute_vector_fwd(vmm_src, -INFINITY, INFINITY);
+
+    // log and exp saturate for |x| = 0 and |x| = inf, set these exactly
+    const auto &wt0 = h->W_TMP_0;
+    const uint32_t inf_bits = 0x7f800000;
+    h->fabs(vmm_aux1, p_all / T_m, vmm_aux5);
+    h->fcmeq(p_mask.s, p_all / T_z, vmm_aux1, 0.0);
+    h->mov(wt0, exponent > 0.f ? 0 : inf_bits);
+    h->cpy(vmm_src, p_mask / T_m, wt0);
+    h->mov(wt0, inf_bits);
+    h->dup(z_tmp, wt0);
+    h->fcmeq(p_mask.s, p_all / T_z, vmm_aux1, z_tmp);
+    h->mov(wt0, exponent > 0.f ? inf_bits : 0);
+    h->cpy(vmm_src, p_mask / T_m, wt0);
+
+    const bool is_int_exponent = exponent == std::trunc(exponent);
+    if (is_int_exponent && std::fmod(exponent, 2.f) != 0.f) {
+        // an odd power keeps the sign of x
+        h->and_(ZRegD(IDX(vmm_aux1)), ZRegD(IDX(vmm_aux5)),
+                ZRegD(IDX(table_val(sign_mask, z_tmp))));
+        h->eor(ZRegD(IDX(vmm_src)), ZRegD(IDX(vmm_src)),
+                ZRegD(IDX(vmm_aux1)));
+    } else if (!is_int_exponent) {
+        // a negative x to a non-integer power is NaN
+        h->fcmlt(p_mask.s, p_all / T_z, vmm_aux5, 0.0);
+        h->mov(wt0, 0x7fc00000); // qnan
+        h->cpy(vmm_src, p_mask / T_m, wt0);
+    }
+
+    // NaN x stays NaN
+    h->fcmuo(p_mask.s, p_all / T_z, vmm_aux5, vmm_aux5);
+    h->sel(vmm_src, p_mask, vmm_aux5, vmm_src);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_t<isa>::pow_compute_vector_fwd(
+        const TRegS &vmm_src) {
+    // dst = alpha * x ^ beta
+    pow_compute_vector(vmm_src, beta_);
+    if (alpha_ != 1.f)
+        h->fmul(vmm_src, vmm_src, table_val(pow_coeff, z_tmp));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_t<isa>::pow_compute_vector_bwd(
+        const TRegS &vmm_src) {
+    // res = alpha * beta * x ^ (beta - 1)
+    if (beta_ == 0.f) {
+        table_val(zero, vmm_src);
+        return;
+    }
+    pow_compute_vector(vmm_src, beta_ - 1.f);
+    if (alpha_ * beta_ != 1.f)
+        h->fmul(vmm_src, vmm_src, table_val(pow_coeff, z_tmp));
+}
+
 template <cpu_isa_t isa>
 size_t jit_uni_eltwise_injector_t<isa>::aux_gprs_count() {
     using namespace alg_kind;
@@ -1575,6 +1665,7 @@ size_t jit_uni_eltwise_injector_t<isa>::aux_vecs_count() {
             case eltwise_swish:
                 return (isa == asimd) ? 7 : 4; /* = logistic + 1 */
             case eltwise_log: return 6;
+            case eltwise_pow: return 7; /* = log + 1 */
             case eltwise_clip:
             case eltwise_clip_v2_use_dst_for_bwd:
             case eltwise_clip_v2: return 2;
@@ -1606,6 +1697,7 @@ size_t jit_uni_eltwise_injector_t<isa>::aux_vecs_count() {
             case eltwise_gelu_tanh: return 9; /* = tanh */
             case eltwise_swish: return 6; /* = logistic */
             case eltwise_log: return 1;
+            case eltwise_pow: return 7; /* = log + 1 */
             case eltwise_clip:
             case eltwise_clip_v2_use_dst_for_bwd:
             case eltwise_clip_v2: return 2;
@@ -1662,6 +1754,7 @@ void jit_uni_eltwise_injector_t<isa>::compute_body(
                     gelu_tanh_compute_vector_fwd(TRegS(idx));
                     break;
                 case eltwise_log: log_compute_vector_fwd(TRegS(idx)); break;
+                case eltwise_pow: pow_compute_vector_fwd(TRegS(idx)); break;
                 case eltwise_clip:
                 case eltwise_clip_v2_use_dst_for_bwd:
                 case eltwise_clip_v2: clip_compute_vector_fwd(TReg(idx)); break;
@@ -1709,6 +1802,7 @@ void jit_uni_eltwise_injector_t<isa>::compute_body(
                     break;
                 case eltwise_swish: swish_compute_vector_bwd(TRegS(idx)); break;
                 case eltwise_log: log_compute_vector_bwd(TRegS(idx)); break;
+                case eltwise_pow: pow_compute_vector_bwd(TRegS(idx)); break;
                 case eltwise_clip:
                 case eltwise_clip_v2_use_dst_for_bwd:
                 case eltwise_clip_v2:
@@ -2364,6 +2458,26 @@ void jit_uni_eltwise_injector_t<isa>::register_table_entries() {
             {gelu_erf_minimax_pol, {0x00000000, false}}, // 0 padd
     };
 
+    // log(x) constants
+    static const table_t log_consts {
+            {log_minus_inf, {0xff800000, true}},
+            {log_qnan, {0x7fc00000, true}},
+            {log_inf, {0x7f800000, true}},
+            {log_mantissa_mask, {0x007fffff, true}},
+            {log_off_asimd, {0x3f2aaaab, true}},
+    };
+
+    // log(x) polynomial approximation
+    static const table_t log_polynomial_asimd {
+            {log_pol_asimd, {0xbeffffe4, true}}, // p1 = -0x1.ffffc8p-2f
+            {log_pol_asimd, {0x3eaaaebe, true}}, // p2 =  0x1.555d7cp-2f
+            {log_pol_asimd, {0xbe800c3e, true}}, // p3 = -0x1.00187cp-2f
+            {log_pol_asimd, {0x3e4b09a4, true}}, // p4 =  0x1.961348p-3f
+            {log_pol_asimd, {0xbe27cc9a, true}}, // p5 = -0x1.4f9934p-3f
+            {log_pol_asimd, {0x3e2d4d51, true}}, // p6 =  0x1.5a9aa2p-3f
+            {log_pol_asimd, {0xbe1f39be, true}}, // p7 = -0x1.3e737cp-3f
+    };
+
     // This object takes care about which constants and polynomials to include.
     struct need_t {
         need_t(alg_kind_t alg) {
@@ -2382,6 +2496,11 @@ void jit_uni_eltwise_injector_t<isa>::register_table_entries() {
                     gelu_tanh_ = true;
                     break;
                 case eltwise_log: log_ = true; break;
+                case eltwise_pow:
+                    exp_ = true;
+                    log_ = true;
+                    pow_ = true;
+                    break;
                 case eltwise_soft_relu: soft_relu_ = true; break;
                 case eltwise_mish: mish_ = true; break;
                 case eltwise_tanh_use_dst_for_bwd:
@@ -2400,6 +2519,7 @@ void jit_uni_eltwise_injector_t<isa>::register_table_entries() {
         bool gelu_tanh_ = false;
         bool gelu_erf_ = false;
         bool log_ = false;
+        bool pow_ = false;
 
         bool exp() const { return exp_ || soft_relu_ || gelu_erf_ || mish_; }
         bool mish() const { return mish_; }
@@ -2408,6 +2528,7 @@ void jit_uni_eltwise_injector_t<isa>::register_table_entries() {
         bool gelu_tanh() const { return gelu_tanh_; }
         bool gelu_erf() const { return gelu_erf_; }
         bool log() const { return log_; }
+        bool pow() const { return pow_; }
     };
 
     need_t need(alg_);
@@ -2452,6 +2573,14 @@ void jit_uni_eltwise_injector_t<isa>::register_table_entries() {
     if (need.gelu_erf()) push_entries_of(gelu_erf_polynomial);
     if (need.gelu_erf()) push_entries_of(gelu_erf_minimax_consts);
     if (need.gelu_erf()) push_entries_of(gelu_erf_minimax_polynomial);
+    if (need.log()) push_entries_of(log_consts);
+    if (need.log() && isa == asimd) push_entries_of(log_polynomial_asimd);
+    if (need.pow()) {
+        push_arg_entry_of(pow_coeff,
+                float2int(is_fwd_ ? alpha_ : alpha_ * beta_), true);
+        push_arg_entry_of(
+                pow_exponent, float2int(is_fwd_ ? beta_ : beta_ - 1.f), true);
+    }
     if (need.gelu_erf()) {
         push_entries_of(gelu_erf_lut_consts);
         const int erf_lut_size = 513;
@@ -3105,6 +3234,141 @@ void jit_uni_eltwise_injector_t<asimd>::round_compute_vector_fwd(
     h->frintn(vmm_src, vmm_src);
 }
 
+template <>
+void jit_uni_eltwise_injector_t<asimd>::log_compute_vector_fwd(
+        const TRegS &vmm_src) {
+    /*
+    * Based on the logf implementation from Arm Optimized Routines (AOR)
+    *
+    * log(x) = n * ln2 + log(1 + r), with x = 2^n * (1 + r) and
+    *   2/3 < 1 + r < 4/3
+    *   log(1 + r) ≈ r + r^2 * poly(r)
+    *
+    * Special cases:
+    *   log(x) = NaN for x < 0, -inf for x = 0 and x for x = inf or NaN.
+    */
+    const auto &v_x = vmm_aux4;
+    h->mov(VReg16B(IDX(v_x)), VReg16B(IDX(vmm_src)));
+
+    // u = asuint(x) - asuint(2/3), n = (float)(u >> 23)
+    const auto &v_u = vmm_src;
+    const auto &v_off = table_val(log_off_asimd, z_tmp);
+    h->sub(v_u, v_u, v_off);
+    const auto &v_n = vmm_aux0;
+    h->sshr(v_n, v_u, n_mantissa_bits);
+    h->scvtf(v_n, v_n);
+
+    // r = asfloat((u & 0x7fffff) + asuint(2/3)) - 1
+    h->and_(VReg16B(IDX(v_u)), VReg16B(IDX(v_u)),
+            VReg16B(IDX(table_val(log_mantissa_mask, vmm_aux1))));
+    h->add(v_u, v_u, v_off);
+    const auto &v_r = vmm_src;
+    h->fsub(v_r, v_u, table_val(one, z_tmp));
+
+    // r2 = r * r
+    const auto &v_r2 = vmm_aux1;
+    h->fmul(v_r2, v_r, v_r);
+
+    // p = p5 + p6 * r + p7 * r2
+    const auto &v_p = vmm_aux2;
+    table_val(log_pol_asimd, v_p, 4);
+    h->fmla(v_p, v_r, table_val(log_pol_asimd, z_tmp, 5));
+    h->fmla(v_p, v_r2, table_val(log_pol_asimd, z_tmp, 6));
+
+    // q = p3 + p4 * r + p * r2
+    const auto &v_q = vmm_aux3;
+    table_val(log_pol_asimd, v_q, 2);
+    h->fmla(v_q, v_r, table_val(log_pol_asimd, z_tmp, 3));
+    h->fmla(v_q, v_p, v_r2);
+
+    // y = p1 + p2 * r + q * r2
+    const auto &v_y = v_p;
+    table_val(log_pol_asimd, v_y, 0);
+    h->fmla(v_y, v_r, table_val(log_pol_asimd, z_tmp, 1));
+    h->fmla(v_y, v_q, v_r2);
+
+    // log(x) = n * ln2 + r + y * r2
+    h->fmla(v_r, v_n, table_val(ln2f, z_tmp));
+    h->fmla(v_r, v_y, v_r2);
+
+    // Special cases
+    const auto &v_mask = vmm_aux0;
+    h->fcmlt(v_mask, v_x, 0.);
+    h->bit(VReg16B(IDX(vmm_src)), VReg16B(IDX(table_val(log_qnan, z_tmp))),
+            VReg16B(IDX(v_mask)));
+    h->fcmeq(v_mask, v_x, 0.);
+    h->bit(VReg16B(IDX(vmm_src)),
+            VReg16B(IDX(table_val(log_minus_inf, z_tmp))),
+            VReg16B(IDX(v_mask)));
+    // x < inf is false for inf and NaN
+    h->fcmgt(v_mask, table_val(log_inf, z_tmp), v_x);
+    h->bif(VReg16B(IDX(vmm_src)), VReg16B(IDX(v_x)), VReg16B(IDX(v_mask)));
+}
+
+template <>
+void jit_uni_eltwise_injector_t<asimd>::pow_compute_vector(
+        const TRegS &vmm_src, float exponent) {
+    // Computes x ^ exponent. Exponents with a short exact sequence are
+    // special-cased, the rest is computed as exp(exponent * log(|x|)).
+    if (exponent == 0.f) {
+        table_val(one, vmm_src);
+        return;
+    } else if (exponent == 1.f) {
+        return;
+    } else if (exponent == 0.5f) {
+        h->fsqrt(vmm_src, vmm_src);
+        return;
+    } else if (exponent == 2.f) {
+        h->fmul(vmm_src, vmm_src, vmm_src);
+        return;
+    } else if (exponent == 3.f) {
+        h->mov(VReg16B(IDX(vmm_aux0)), VReg16B(IDX(vmm_src)));
+        h->fmul(vmm_src, vmm_src, vmm_src);
+        h->fmul(vmm_src, vmm_src, vmm_aux0);
+        return;
+    } else if (exponent == -1.f) {
+        h->fdiv(vmm_src, table_val(one, z_tmp), vmm_src);
+        return;
+    }
+
+    // IMPORTANT: we use vmm_aux5 to save src as neither log nor exp use it.
+    h->mov(VReg16B(IDX(vmm_aux5)), VReg16B(IDX(vmm_src)));
+    h->fabs(vmm_src, vmm_src);
+    log_compute_vector_fwd(vmm_src);
+    h->fmul(vmm_src, vmm_src, table_val(pow_exponent, z_tmp));
+    exp_compute_vector_fwd(vmm_src, -INFINITY, INFINITY);
+
+    // log and exp saturate for |x| = 0 and |x| = inf, set these exactly
+    const auto &v_mask = vmm_aux0;
+    h->fabs(vmm_aux1, vmm_aux5);
+    h->fcmeq(v_mask, vmm_aux1, 0.);
+    h->bit(VReg16B(IDX(vmm_src)),
+            VReg16B(IDX(table_val(exponent > 0.f ? zero : log_inf, z_tmp))),
+            VReg16B(IDX(v_mask)));
+    h->fcmeq(v_mask, vmm_aux1, table_val(log_inf, z_tmp));
+    h->bit(VReg16B(IDX(vmm_src)),
+            VReg16B(IDX(table_val(exponent > 0.f ? log_inf : zero, z_tmp))),
+            VReg16B(IDX(v_mask)));
+
+    const bool is_int_exponent = exponent == std::trunc(exponent);
+    if (is_int_exponent && std::fmod(exponent, 2.f) != 0.f) {
+        // an odd power keeps the sign of x
+        h->and_(VReg16B(IDX(vmm_aux1)), VReg16B(IDX(vmm_aux5)),
+                VReg16B(IDX(table_val(sign_mask, z_tmp))));
+        h->eor(VReg16B(IDX(vmm_src)), VReg16B(IDX(vmm_src)),
+                VReg16B(IDX(vmm_aux1)));
+    } else if (!is_int_exponent) {
+        // a negative x to a non-integer power is NaN
+        h->fcmlt(v_mask, vmm_aux5, 0.);
+        h->bit(VReg16B(IDX(vmm_src)), VReg16B(IDX(table_val(log_qnan, z_tmp))),
+                VReg16B(IDX(v_mask)));
+    }
+
+    // NaN x stays NaN
+    h->fcmeq(v_mask, vmm_aux5, vmm_aux5);
+    h->bif(VReg16B(IDX(vmm_src)), VReg16B(IDX(vmm_aux5)), VReg16B(IDX(v_mask)));
+}
+
 template <>
 void jit_uni_eltwise_injector_t<asimd>::load_1word_replicate(
         const TRegS &vmm_src, Xbyak_aarch64::XReg x_addr) {
@@ -3130,7 +3394,6 @@ void jit_uni_eltwise_injector_t<sve>::load_vector(
 #define DEFINE_ASIMD_EMPTY_FUNC(func_name) \
     template <> \
     void jit_uni_eltwise_injector_t<asimd>::func_name(const TRegS &) {}
-DEFINE_ASIMD_EMPTY_FUNC(log_compute_vector_fwd);
 DEFINE_ASIMD_EMPTY_FUNC(tanh_polynomial_approx_compute_vector_fwd);
 DEFINE_ASIMD_EMPTY_FUNC(gelu_erf_minimax_approx_compute_vector_fwd);
 
@@ -3152,6 +3415,7 @@ DEFINE_ASIMD_EMPTY_FUNC(clip_compute_vector_bwd);
 DEFINE_ASIMD_EMPTY_FUNC(gelu_erf_compute_vector_bwd);
 DEFINE_ASIMD_EMPTY_FUNC(hardswish_compute_vector_bwd);
 DEFINE_ASIMD_EMPTY_FUNC(hardsigmoid_compute_vector_bwd);
+DEFINE_ASIMD_EMPTY_FUNC(pow_compute_vector_bwd);
 #undef DEFINE_ASIMD_EMPTY_FUNC
 
 template <>
@@ -248,6 +248,8 @@ private:
     void round_compute_vector_fwd(const TRegS &vmm_src);
     void hardswish_compute_vector_fwd(const TRegS &vmm_src);
     void hardsigmoid_compute_vector_fwd(const TRegS &vmm_src);
+    void pow_compute_vector_fwd(const TRegS &vmm_src);
+    void pow_compute_vector(const TRegS &vmm_src, float exponent);
 
     void exp_compute_vector_bwd(const TRegS &vmm_src);
     void relu_compute_vector_bwd(const TRegS &vmm_src);
@@ -267,6 +269,7 @@ private:
     void gelu_erf_compute_vector_bwd(const TRegS &vmm_src);
     void hardswish_compute_vector_bwd(const TRegS &vmm_src);
     void hardsigmoid_compute_vector_bwd(const TRegS &vmm_src);
+    void pow_compute_vector_bwd(const TRegS &vmm_src);
     void load_1word_replicate(const TRegS &vmm_src, Xbyak_aarch64::XReg x_addr);
     void load_vector(const TRegS &vmm_src, Xbyak_aarch64::XReg x_addr);
 
@@ -346,6 +349,11 @@ private:
         log_log1p5,
         log_f2div3,
         log_coeffTbl,
+        log_inf, // inf
+        log_off_asimd, // 0x3f2aaaab, splits the mantissa range at 2/3
+        log_pol_asimd, // see correspondent table for float values
+        pow_coeff, // alpha for forward, alpha * beta for backward
+        pow_exponent, // beta for forward, beta - 1 for backward
         undef_key,
     };
 
@@ -1,7 +1,7 @@
 /*******************************************************************************
 * Copyright 2021 Intel Corporation
 * Copyright 2024-2026 FUJITSU LIMITED
-* Copyright 2025 Arm Ltd. and affiliates
+* Copyright 2025-2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -104,6 +104,8 @@ status_t brdgmm_dw_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
             && one_of(dst_type, bf16, f32);
     const bool is_f32_bf16
             = everyone_is(f32, src_type, dst_type) && wei_type == bf16;
+    const bool is_f16 = everyone_is(f16, src_type, wei_type)
+            && one_of(dst_type, f16, f32);
     const bool is_int8 = one_of(src_type, s8, u8) && wei_type == s8
             && one_of(dst_type, s32, f32, u8, s8);
 
@@ -113,7 +115,8 @@ status_t brdgmm_dw_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
     VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
             VERBOSE_BAD_ALGORITHM);
-    VDISPATCH_CONV(one_of(true, is_f32, is_int8, is_bf16, is_f32_bf16),
+    VDISPATCH_CONV(
+            one_of(true, is_f32, is_int8, is_bf16, is_f32_bf16, is_f16),
             VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_CONV(
             IMPLICATION(is_int8,
@@ -131,6 +134,9 @@ status_t brdgmm_dw_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
     VDISPATCH_CONV(
             (isa != isa_undef) && mayiuse(isa), "undefined or unsupported isa");
+    // u8:s8 is computed with usdot from the I8MM extension
+    VDISPATCH_CONV(IMPLICATION(is_int8 && src_type == u8, mayiuse_i8mm()),
+            VERBOSE_UNSUPPORTED_ISA);
     VDISPATCH_CONV(
             impl::is_dense_format_kind({src_md(), weights_md(), dst_md()}),
             VERBOSE_UNSUPPORTED_SPARSE_CFG);
@@ -226,7 +232,10 @@ status_t brdgmm_dw_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     // strd is only feasible for 1D (i.e., height dim is one)
     // and if there are no tails (for calculating matrix_B strides).
     // Since, we cannot always predict the blocking is 8 or 16.
-    if (jcp.kd == 1 && jcp.kh == 1 && jcp.ngroups % 8 == 0) {
+    // With the spatial inversion the weights are walked backwards, which
+    // the strides cannot express.
+    if (jcp.kd == 1 && jcp.kh == 1 && jcp.ngroups % 8 == 0
+            && !cd.use_inversion) {
         jcp.batch_kind = brgemm_strd;
     } else {
         jcp.batch_kind = brgemm_offs;
@@ -250,10 +259,14 @@ template <cpu_isa_t isa>
 void brdgmm_dw_convolution_fwd_t<isa>::pd_t::init_batch_elements() {
 
     auto &jcp = jcp_;
-
-    auto gen_batch_elements
-            = [&jcp](int fpad, int backpad, int tpad, int bpad, int lpad,
-                      int rpad, int &bs, brgemm_batch_element_t *batches) {
+    // A backward by data convolution executed as the forward one uses the
+    // spatially inverted weights.
+    const bool use_inversion = desc()->use_inversion;
+
+    auto gen_batch_elements = [&jcp, use_inversion](int fpad, int backpad,
+                                      int tpad, int bpad, int lpad, int rpad,
+                                      int &bs,
+                                      brgemm_batch_element_t *batches) {
         const size_t src_w_stride = jcp.ngroups * jcp.src_dsz;
         const size_t src_h_stride = jcp.ngroups * jcp.iw * jcp.src_dsz;
         const size_t src_d_stride = jcp.ngroups * jcp.ih * jcp.iw * jcp.src_dsz;
@@ -279,8 +292,11 @@ void brdgmm_dw_convolution_fwd_t<isa>::pd_t::init_batch_elements() {
             //     batch.has_s8s8_comp_batch_pad = padded_bs;
             const dim_t offs_A
                     = kd * src_d_stride + kh * src_h_stride + kw * src_w_stride;
-            const dim_t offs_B
-                    = kd * wei_d_stride + kh * wei_h_stride + kw * wei_w_stride;
+            const int wei_kd = use_inversion ? jcp.kd - 1 - kd : kd;
+            const int wei_kh = use_inversion ? jcp.kh - 1 - kh : kh;
+            const int wei_kw = use_inversion ? jcp.kw - 1 - kw : kw;
+            const dim_t offs_B = wei_kd * wei_d_stride + wei_kh * wei_h_stride
+                    + wei_kw * wei_w_stride;
             if (jcp.batch_kind == brgemm_offs) {
                 batch.offset.A = offs_A;
                 batch.offset.B = offs_B;
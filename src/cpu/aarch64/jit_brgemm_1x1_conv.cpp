@@ -76,7 +76,8 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     CHECK(attr_scales_ok());
 
     CHECK(brgemm_convolution_utils::init_1x1_conf(jcp_, isa, *desc(), src_md_,
-            weights_md_, dst_md_, bias_md_, attr_, dnnl_get_max_threads()));
+            weights_md_, dst_md_, bias_md_, attr_,
+            attr_.dispatch_hint_.get_nthr(dnnl_get_max_threads())));
 
     // brgemm is slower than jit_sve when combined with reorders for shapes where strides < 2
     const convolution_desc_t &cd = *desc();
@@ -223,7 +224,8 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::init(engine_t *engine) {
         auto brg_idx = get_brg_idx(i_init, i_M, i_N, i_K);
         auto brg = brgs[brg_idx];
         if (brg != nullptr && brg->bcast_dim > 0 && brg->load_dim > 0
-                && brg->reduce_dim > 0 && !brg_kernels_[brg_idx]) {
+                && brg->reduce_dim > 0
+                && !brg_kernels_.is_inserted(brg_idx)) {
             CHECK(brg_kernels_.insert(brg_idx, brg));
         }
     }
@@ -389,6 +391,7 @@ void brgemm_1x1_convolution_fwd_t<isa>::exec_ker(
         }
 
         const auto brg_ker = brg_kernels_[brg_idx];
+        if (brg_ker == nullptr) return;
         if (do_postops) {
             const brgemm_post_ops_data_t post_ops_data {
                     static_cast<const void *>(bias_w),
@@ -585,7 +588,7 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::execute_forward_all(
 #undef BRGC_WO
     }
 
-    return status::success;
+    return brg_kernels_.status();
 }
 
 template struct brgemm_1x1_convolution_fwd_t<sve_512>;
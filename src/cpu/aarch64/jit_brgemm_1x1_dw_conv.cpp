@@ -0,0 +1,375 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/stream.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/dw_convolution_utils.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/aarch64/jit_brdgmm_dw_conv.hpp"
+#include "cpu/aarch64/jit_brgemm_1x1_conv.hpp"
+#include "cpu/aarch64/jit_brgemm_1x1_dw_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+
+namespace {
+template <typename implementation_pd>
+status_t create_nested_pd(engine_t *engine, const convolution_desc_t &cd,
+        const primitive_attr_t &attr, std::shared_ptr<primitive_desc_t> &pd) {
+    primitive_desc_iterator_t it(
+            engine, reinterpret_cast<const op_desc_t *>(&cd), &attr, nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+
+    while (++it != it.end()) {
+        if (dynamic_cast<implementation_pd *>((*it).get()) == nullptr)
+            continue;
+        pd = *it;
+        return status::success;
+    }
+    return status::unimplemented;
+}
+
+// Nested scratchpad index of each of the nested primitives.
+enum { nested_1x1 = 0, nested_dw, nested_dw_tail };
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_1x1_dw_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+    using namespace primitive_kind;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_type = src_md(0)->data_type;
+    const auto wei_type = weights_md(0)->data_type;
+
+    VDISPATCH_CONV(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(utils::one_of(src_type, f32, bf16) && wei_type == src_type,
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(attr()->has_default_values(smask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    const int dw_po_idx = attr()->post_ops_.find(convolution);
+    VDISPATCH_CONV(dw_po_idx != -1, VERBOSE_UNSUPPORTED_POSTOP);
+
+    VDISPATCH_CONV(ndims() == 4 && !with_groups(),
+            VERBOSE_UNSUPPORTED_FEATURE, "only 2D convolution without groups");
+    VDISPATCH_CONV(utils::everyone_is(1, KH(), KW(), KSH(), KSW())
+                    && utils::everyone_is(
+                            0, KDH(), KDW(), padT(), padB(), padL(), padR()),
+            VERBOSE_UNSUPPORTED_FEATURE,
+            "only unit-stride 1x1 convolution without padding");
+
+    for (auto *md : {&src_md_, &dst_md_}) {
+        if (md->format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(*md, nhwc));
+        VDISPATCH_CONV(
+                memory_desc_matches_tag(*md, nhwc), VERBOSE_UNSUPPORTED_TAG);
+    }
+
+    // The 1x1 convolution takes the post-ops before the depthwise one, the
+    // depthwise convolution the ones after it.
+    primitive_attr_t attr_1x1(*attr());
+    if (!attr_1x1.is_initialized()) return status::out_of_memory;
+    auto &e = attr_1x1.post_ops_.entry_;
+    e.erase(e.begin() + dw_po_idx, e.end());
+    VDISPATCH_CONV(attr_1x1.post_ops_.has_default_values({eltwise}),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    convolution_desc_t cd_dw;
+    primitive_attr_t attr_dw;
+    CHECK(get_depthwise_conv_desc(cd_dw, dst_md_, *attr(), attr_dw, dw_po_idx));
+    VDISPATCH_CONV(attr_dw.post_ops_.has_default_values({eltwise, sum}),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    // Same threshold as for the fusion in jit_sve_1x1_convolution: a smaller
+    // intermediate tensor stays in the caches anyway.
+    const size_t l2_cache
+            = platform::get_per_core_cache_size(2) * dnnl_get_max_threads();
+    VDISPATCH_CONV(2 * l2_cache < memory_desc_wrapper(dst_md_).size(),
+            VERBOSE_UNSUPPORTED_FEATURE,
+            "intermediate tensor fits in the caches");
+
+    CHECK(init_bands(engine, cd_dw, attr_1x1, attr_dw));
+
+    weights_md_ = *conv_1x1_pd_->weights_md(0);
+    bias_md_ = *conv_1x1_pd_->weights_md(1);
+    dw_dst_md_ = cd_dw.dst_desc;
+    VDISPATCH_CONV(memory_desc_matches_tag(dw_dst_md_, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    init_name();
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_1x1_dw_convolution_fwd_t<isa>::pd_t::init_bands(
+        engine_t *engine, const convolution_desc_t &cd_dw,
+        const primitive_attr_t &attr_1x1, const primitive_attr_t &attr_dw) {
+    using namespace format_tag;
+
+    const dim_t S = cd_dw.strides[0];
+    const dim_t K = cd_dw.weights_desc.dims[3];
+    const dim_t dw_oh = cd_dw.dst_desc.dims[2];
+    const dim_t dw_ow = cd_dw.dst_desc.dims[3];
+
+    // Take as many rows as fit in half of the L2 caches of all the threads.
+    const size_t row_size = (size_t)OW() * OC()
+            * types::data_type_size(dst_md_.data_type);
+    const size_t buf_size
+            = platform::get_per_core_cache_size(2) * dnnl_get_max_threads() / 2;
+    const dim_t max_rows = nstl::max<dim_t>(K, buf_size / row_size);
+    band_oh_ = nstl::min(dw_oh, (max_rows - K) / S + 1);
+    band_ih_1x1_ = nstl::min((band_oh_ - 1) * S + K, OH());
+
+    memory_desc_t src_md, dst_md;
+    const dims_t src_dims = {1, IC(), band_ih_1x1_, IW()};
+    const dims_t dst_dims = {1, OC(), band_ih_1x1_, OW()};
+    CHECK(memory_desc_init_by_tag(
+            src_md, 4, src_dims, src_md_.data_type, nhwc));
+    CHECK(memory_desc_init_by_tag(
+            dst_md, 4, dst_dims, dst_md_.data_type, nhwc));
+
+    convolution_desc_t cd_1x1;
+    CHECK(conv_desc_init(&cd_1x1, desc()->prop_kind,
+            alg_kind::convolution_direct, &src_md, &desc()->weights_desc,
+            with_bias() ? &desc()->bias_desc : nullptr, &dst_md,
+            desc()->strides, desc()->dilates, desc()->padding[0],
+            desc()->padding[1]));
+    VDISPATCH_CONV_IC(
+            create_nested_pd<typename brgemm_1x1_convolution_fwd_t<isa>::pd_t>(
+                    engine, cd_1x1, attr_1x1, conv_1x1_pd_)
+                    == status::success,
+            VERBOSE_PRIMITIVE_CREATION_FAIL, "brgemm 1x1 convolution");
+
+    // The vertical padding is zero-filled in the buffer.
+    const auto create_dw_pd = [&](dim_t oh,
+                                      std::shared_ptr<primitive_desc_t> &pd) {
+        memory_desc_t dw_src_md, dw_dst_md;
+        const dims_t dw_src_dims = {1, OC(), (oh - 1) * S + K, OW()};
+        const dims_t dw_dst_dims = {1, OC(), oh, dw_ow};
+        CHECK(memory_desc_init_by_tag(
+                dw_src_md, 4, dw_src_dims, dst_md_.data_type, nhwc));
+        CHECK(memory_desc_init_by_tag(
+                dw_dst_md, 4, dw_dst_dims, cd_dw.dst_desc.data_type, nhwc));
+        const dims_t pad_l = {0, cd_dw.padding[0][1]};
+        const dims_t pad_r = {0, cd_dw.padding[1][1]};
+
+        const bool with_dw_bias
+                = cd_dw.bias_desc.format_kind != format_kind::undef;
+        convolution_desc_t cd;
+        CHECK(conv_desc_init(&cd, cd_dw.prop_kind, alg_kind::convolution_direct,
+                &dw_src_md, &cd_dw.weights_desc,
+                with_dw_bias ? &cd_dw.bias_desc : nullptr, &dw_dst_md,
+                cd_dw.strides, cd_dw.dilates, pad_l, pad_r));
+        return create_nested_pd<
+                typename brdgmm_dw_convolution_fwd_t<isa>::pd_t>(
+                engine, cd, attr_dw, pd);
+    };
+
+    VDISPATCH_CONV_IC(create_dw_pd(band_oh_, dw_pd_) == status::success,
+            VERBOSE_PRIMITIVE_CREATION_FAIL, "brdgmm depthwise convolution");
+    const dim_t nb_bands = utils::div_up(dw_oh, band_oh_);
+    const dim_t tail_oh = dw_oh - (nb_bands - 1) * band_oh_;
+    if (tail_oh != band_oh_)
+        VDISPATCH_CONV_IC(create_dw_pd(tail_oh, dw_tail_pd_) == status::success,
+                VERBOSE_PRIMITIVE_CREATION_FAIL,
+                "brdgmm depthwise convolution");
+
+    // The 1x1 convolution computes a band of rows shifted into the image on
+    // the borders, so the buffer has room for the rows it writes on top of
+    // the ones the depthwise convolution reads.
+    dim_t off_min = 0, off_max = 0;
+    for (dim_t b = 0; b < nb_bands; b++) {
+        const dim_t oh = b == nb_bands - 1 ? tail_oh : band_oh_;
+        dim_t dw_row, row_1x1;
+        band_rows(b, dw_row, row_1x1);
+        const dim_t off = row_1x1 - dw_row;
+        off_min = nstl::min(off_min, off);
+        off_max = nstl::max(
+                off_max, nstl::max(off + band_ih_1x1_, (oh - 1) * S + K));
+    }
+    buf_row_base_ = -off_min;
+    init_scratchpad((off_max - off_min) * row_size);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_1x1_dw_convolution_fwd_t<isa>::pd_t::band_rows(
+        dim_t b, dim_t &dw_row, dim_t &row_1x1) const {
+    const auto &dw_po = attr()->post_ops_.entry_[attr()->post_ops_.find(
+            primitive_kind::convolution)];
+    const dim_t S = dw_po.depthwise_conv.stride;
+    const dim_t P = dw_po.depthwise_conv.padding;
+    dw_row = b * band_oh_ * S - P;
+    row_1x1 = nstl::max<dim_t>(
+            0, nstl::min(dw_row, OH() - band_ih_1x1_));
+}
+
+template <cpu_isa_t isa>
+void brgemm_1x1_dw_convolution_fwd_t<isa>::pd_t::init_scratchpad(
+        size_t buf_size) {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_fusion_inout_buffer, buf_size, 1, 16);
+    scratchpad.book(key_nested_multiple + nested_1x1,
+            conv_1x1_pd_->scratchpad_registry());
+    scratchpad.book(
+            key_nested_multiple + nested_dw, dw_pd_->scratchpad_registry());
+    if (dw_tail_pd_)
+        scratchpad.book(key_nested_multiple + nested_dw_tail,
+                dw_tail_pd_->scratchpad_registry());
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_1x1_dw_convolution_fwd_t<isa>::init(engine_t *engine) {
+    CHECK(pd()->conv_1x1_pd_->create_primitive(conv_1x1_p_, engine));
+    CHECK(pd()->dw_pd_->create_primitive(dw_p_, engine));
+    if (pd()->dw_tail_pd_)
+        CHECK(pd()->dw_tail_pd_->create_primitive(dw_tail_p_, engine));
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_1x1_dw_convolution_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    engine_t *engine = ctx.stream()->engine();
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    const auto &args = ctx.args();
+
+    const auto &src_storage = CTX_IN_STORAGE(DNNL_ARG_SRC);
+    const auto &dst_storage = CTX_OUT_STORAGE(DNNL_ARG_DST);
+    const auto buf_storage
+            = scratchpad.get_memory_storage(key_fusion_inout_buffer);
+    char *buf = scratchpad.get<char>(key_fusion_inout_buffer);
+
+    const auto &dw_po = pd()->attr()->post_ops_.entry_[pd()->attr()->post_ops_
+                    .find(primitive_kind::convolution)];
+    const dim_t S = dw_po.depthwise_conv.stride;
+    const dim_t K = dw_po.depthwise_conv.kernel;
+    const dim_t MB = pd()->MB();
+    const dim_t IH = pd()->OH();
+    const dim_t dw_oh = pd()->dst_md()->dims[2];
+    const dim_t band_oh = pd()->band_oh_;
+    const dim_t nb_bands = utils::div_up(dw_oh, band_oh);
+
+    const size_t src_row_size = (size_t)pd()->IW() * pd()->IC()
+            * types::data_type_size(pd()->src_md()->data_type);
+    const size_t buf_row_size = (size_t)pd()->OW() * pd()->OC()
+            * types::data_type_size(
+                    pd()->arg_md(DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_SRC)
+                            ->data_type);
+    const size_t dst_row_size = (size_t)pd()->dst_md()->dims[3] * pd()->OC()
+            * types::data_type_size(pd()->dst_md()->data_type);
+
+    const auto execute_nested = [&](const std::shared_ptr<primitive_t> &p,
+                                        exec_args_t &&nested_args,
+                                        int nested_idx) {
+        exec_ctx_t nested_ctx(ctx, std::move(nested_args));
+        auto *nested_grantor = create_nested_grantor(scratchpad,
+                key_nested_multiple + nested_idx,
+                p->pd()->scratchpad_registry());
+        nested_ctx.set_scratchpad_grantor(nested_grantor);
+        return p->execute(nested_ctx);
+    };
+
+    const auto sub_memory = [&](std::unique_ptr<memory_t, memory_deleter_t> &m,
+                                    const memory_storage_t &storage,
+                                    const memory_desc_t *md, size_t offset) {
+        return safe_ptr_assign(m,
+                new memory_t(engine, md,
+                        storage.get_sub_storage(
+                                offset, memory_desc_wrapper(md).size())));
+    };
+
+    for (dim_t n = 0; n < MB; n++)
+        for (dim_t b = 0; b < nb_bands; b++) {
+            const bool is_tail = b == nb_bands - 1 && pd()->dw_tail_pd_;
+            const auto &dw_p = is_tail ? dw_tail_p_ : dw_p_;
+            const dim_t oh = is_tail ? dw_oh - b * band_oh : band_oh;
+            const dim_t ih = (oh - 1) * S + K;
+            dim_t dw_row, row_1x1;
+            pd()->band_rows(b, dw_row, row_1x1);
+            const dim_t buf_row = pd()->buf_row_base_ + row_1x1 - dw_row;
+
+            std::unique_ptr<memory_t, memory_deleter_t> src_1x1, dst_1x1;
+            CHECK(sub_memory(src_1x1, src_storage,
+                    pd()->conv_1x1_pd_->src_md(),
+                    (n * IH + row_1x1) * src_row_size));
+            CHECK(sub_memory(dst_1x1, *buf_storage,
+                    pd()->conv_1x1_pd_->dst_md(), buf_row * buf_row_size));
+
+            exec_args_t args_1x1;
+            args_1x1[DNNL_ARG_SRC] = {src_1x1.get(), true};
+            args_1x1[DNNL_ARG_WEIGHTS] = args.at(DNNL_ARG_WEIGHTS);
+            if (pd()->with_bias())
+                args_1x1[DNNL_ARG_BIAS] = args.at(DNNL_ARG_BIAS);
+            args_1x1[DNNL_ARG_DST] = {dst_1x1.get(), false};
+            CHECK(execute_nested(conv_1x1_p_, std::move(args_1x1), nested_1x1));
+
+            // Rows of the vertical padding.
+            for (dim_t r = 0; r < ih; r++) {
+                if (dw_row + r >= 0 && dw_row + r < IH) continue;
+                std::memset(buf + (pd()->buf_row_base_ + r) * buf_row_size, 0,
+                        buf_row_size);
+            }
+
+            std::unique_ptr<memory_t, memory_deleter_t> src_dw, dst_dw;
+            CHECK(sub_memory(src_dw, *buf_storage, dw_p->pd()->src_md(),
+                    pd()->buf_row_base_ * buf_row_size));
+            CHECK(sub_memory(dst_dw, dst_storage, dw_p->pd()->dst_md(),
+                    (n * dw_oh + b * band_oh) * dst_row_size));
+
+            exec_args_t args_dw;
+            args_dw[DNNL_ARG_SRC] = {src_dw.get(), true};
+            args_dw[DNNL_ARG_WEIGHTS]
+                    = args.at(DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS);
+            if (dw_po.depthwise_conv.bias_dt != data_type::undef)
+                args_dw[DNNL_ARG_BIAS]
+                        = args.at(DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS);
+            args_dw[DNNL_ARG_DST] = {dst_dw.get(), false};
+            CHECK(execute_nested(dw_p, std::move(args_dw),
+                    is_tail ? nested_dw_tail : nested_dw));
+        }
+
+    return status::success;
+}
+
+template struct brgemm_1x1_dw_convolution_fwd_t<sve_512>;
+template struct brgemm_1x1_dw_convolution_fwd_t<sve_256>;
+template struct brgemm_1x1_dw_convolution_fwd_t<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
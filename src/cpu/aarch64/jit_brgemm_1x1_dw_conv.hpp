@@ -0,0 +1,154 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_BRGEMM_1X1_DW_CONV_HPP
+#define CPU_AARCH64_JIT_BRGEMM_1X1_DW_CONV_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+/// 1x1 convolution with a fused depthwise post-op.
+///
+/// The output rows of the depthwise convolution are processed in bands. For
+/// each band the brgemm 1x1 convolution computes the input rows the band
+/// needs into a buffer sized to stay in the caches, and
+/// brdgmm_dw_convolution_fwd_t consumes the buffer right away, so the
+/// intermediate tensor never goes to memory.
+template <cpu_isa_t isa>
+struct brgemm_1x1_dw_convolution_fwd_t : public primitive_t {
+
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        pd_t(const pd_t &other)
+            : cpu_convolution_fwd_pd_t(other)
+            , conv_1x1_pd_(other.conv_1x1_pd_->clone())
+            , dw_pd_(other.dw_pd_->clone())
+            , dw_tail_pd_(other.dw_tail_pd_ ? other.dw_tail_pd_->clone()
+                                            : nullptr)
+            , dw_dst_md_(other.dw_dst_md_)
+            , band_oh_(other.band_oh_)
+            , band_ih_1x1_(other.band_ih_1x1_)
+            , buf_row_base_(other.buf_row_base_)
+            , name_(other.name_) {}
+
+        DECLARE_COMMON_PD_T(name_.c_str(), brgemm_1x1_dw_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // NOLINTBEGIN(google-default-arguments)
+        const memory_desc_t *dst_md(
+                int index = 0, bool user_input = false) const override {
+            return index == 0 ? &dw_dst_md_ : &glob_zero_md;
+        }
+
+        const memory_desc_t *arg_md(
+                int arg, bool user_input = false) const override {
+            switch (arg) {
+                case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_SRC:
+                    return cpu_convolution_fwd_pd_t::dst_md(0, user_input);
+                case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS:
+                    return dw_pd_->weights_md(0);
+                case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS:
+                    return dw_pd_->weights_md(1);
+                default: break;
+            }
+            return convolution_fwd_pd_t::arg_md(arg, user_input);
+        }
+        // NOLINTEND(google-default-arguments)
+
+        arg_usage_t arg_usage(int arg) const override {
+            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS))
+                return arg_usage_t::input;
+
+            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS)
+                    && attr_post_op_dw_inputs() > 1)
+                return arg_usage_t::input;
+
+            return convolution_fwd_pd_t::arg_usage(arg);
+        }
+
+        // Position of the first row of depthwise band `b` in the 1x1
+        // convolution output and the first row the 1x1 convolution computes
+        // for it. The latter is clamped to the image, so the two differ on
+        // the borders.
+        void band_rows(dim_t b, dim_t &dw_row, dim_t &row_1x1) const;
+
+        // Convolution over `band_ih_1x1_` rows of an image.
+        std::shared_ptr<primitive_desc_t> conv_1x1_pd_;
+        // Depthwise convolution over `band_oh_` output rows without vertical
+        // padding, and the one for the last band when it is shorter.
+        std::shared_ptr<primitive_desc_t> dw_pd_;
+        std::shared_ptr<primitive_desc_t> dw_tail_pd_;
+        memory_desc_t dw_dst_md_;
+        dim_t band_oh_ = 0;
+        dim_t band_ih_1x1_ = 0;
+        // Row of the buffer holding the first input row of a band.
+        dim_t buf_row_base_ = 0;
+
+    private:
+        std::string name_;
+
+        status_t init_bands(engine_t *engine, const convolution_desc_t &cd_dw,
+                const primitive_attr_t &attr_1x1,
+                const primitive_attr_t &attr_dw);
+        void init_scratchpad(size_t buf_size);
+
+        void init_name() {
+            name_ = JIT_IMPL_NAME_HELPER("brg_1x1_dw:", isa, "");
+            name_.append("+");
+            name_.append(conv_1x1_pd_->name());
+            name_.append("+");
+            name_.append(dw_pd_->name());
+        }
+    };
+
+    brgemm_1x1_dw_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    ~brgemm_1x1_dw_convolution_fwd_t() override = default;
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const {
+        return static_cast<const pd_t *>(primitive_t::pd().get());
+    }
+
+    std::shared_ptr<primitive_t> conv_1x1_p_;
+    std::shared_ptr<primitive_t> dw_p_;
+    std::shared_ptr<primitive_t> dw_tail_p_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -22,6 +22,7 @@
 #include "common/dnnl_thread.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
+#include "cpu/aarch64/cpu_capacity.hpp"
 #include "cpu/aarch64/cpu_isa_traits.hpp"
 #include "cpu/aarch64/jit_brgemm_conv.hpp"
 #include "cpu/aarch64/jit_brgemm_conv_comp_pad_kernel.hpp"
@@ -337,7 +338,8 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     CHECK(attr_scales_ok());
 
     CHECK(brgemm_convolution_utils::init_conf(jcp_, isa, *desc(), src_md_,
-            weights_md_, dst_md_, bias_md_, attr_, dnnl_get_max_threads()));
+            weights_md_, dst_md_, bias_md_, attr_,
+            attr_.dispatch_hint_.get_nthr(dnnl_get_max_threads())));
 
     const auto adj_M = nstl::max(jcp_.M, jcp_.M_tail);
 
@@ -635,7 +637,7 @@ status_t brgemm_convolution_fwd_t<isa>::add_brg_kernel(int M, int i_N, int i_K,
     auto brg_idx
             = _pd->get_brg_idx(M - 1, i_init, i_N, i_K, kd_b, kd_e, kh_b, kh_e);
     auto brg = brgs[brg_idx];
-    if (!brgemm_kernels_[brg_idx] && brg && brg->bcast_dim > 0
+    if (!brgemm_kernels_.is_inserted(brg_idx) && brg && brg->bcast_dim > 0
             && brg->load_dim > 0 && brg->reduce_dim > 0) {
         CHECK(brgemm_kernels_.insert(brg_idx, brg));
     }
@@ -1163,6 +1165,12 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     // or made ic_chunks = 1 if use_buffer
     // or (looks more general) increase buffer size to store several rows
 
+    // With big and little cores the work is split proportionally to the
+    // capacity of the core every thread runs on
+    std::vector<int> thr_capacities;
+    if (cpu_capacity::is_heterogeneous())
+        cpu_capacity::get_thread_capacities(jcp.nthr, thr_capacities);
+
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
         if (ithr >= work_amount) return;
 
@@ -1179,7 +1187,11 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
                 : nullptr;
         char *const wsp_tile = nullptr;
         dim_t start {0}, end {0};
-        balance211(work_amount, nthr, ithr, start, end);
+        if (static_cast<int>(thr_capacities.size()) == nthr)
+            balance211_weighted(work_amount, nthr, ithr,
+                    thr_capacities.data(), start, end);
+        else
+            balance211(work_amount, nthr, ithr, start, end);
         int n {0}, g {0}, ocb {0}, odb {0}, ohb {0}, owb {0};
         if (jcp.loop_order == loop_ndhwgc)
             nd_iterator_init(start, n, jcp.mb, odb, jcp.nb_od, ohb, jcp.nb_oh,
@@ -1265,6 +1277,7 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
         }
     });
 
+    CHECK(brgemm_kernels_.status());
     if (_pd->wants_zero_pad_dst()) ctx.memory(DNNL_ARG_DST)->zero_pad(ctx);
 
     return status::success;
@@ -1678,6 +1691,7 @@ void brgemm_convolution_fwd_t<isa>::ker_base(brgemm_thread_ctx_t &btc) const {
                       int comp_ker_offs, bool do_postops, bool do_only_comp) {
         assert(k_l > 0 && "invalid batch range");
         const auto brg_ker = brgemm_kernels_[brg_idx];
+        if (brg_ker == nullptr) return;
 
         assert(jcp.brg_type != brgemm_static_offs);
         _pd->init_batch(btc.icc, src_base, wei_base, n_ic_blocks, ic_block_s,
@@ -1853,6 +1867,7 @@ void brgemm_convolution_fwd_t<isa>::ker_trans(
                                      bool do_postops) {
         assert(k_l > 0 && "invalid batch range");
         const auto brg_ker = brgemm_kernels_[brg_idx];
+        if (brg_ker == nullptr) return;
 
         const auto kh_ee = jcp.kh_sets > 1 ? kh_b + 1 : kh_e;
         const auto pbuf_base = inp_buffer
@@ -1965,6 +1980,7 @@ void brgemm_convolution_fwd_t<isa>::ker_vpad(brgemm_thread_ctx_t &btc) const {
                                      int comp_ker_offs, bool do_postops) {
         assert(k_l > 0 && "invalid batch range");
         const auto brg_ker = brgemm_kernels_[brg_idx];
+        if (brg_ker == nullptr) return;
 
         assert(jcp.brg_type != brgemm_static_offs);
         _pd->init_batch(btc.icc, src_base, wei_base, n_ic_blocks, ic_block_s,
@@ -1,6 +1,6 @@
 /*******************************************************************************
 * Copyright 2025 FUJITSU LIMITED
-* Copyright 2025 Arm Ltd. and affiliates
+* Copyright 2025-2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/aarch64/jit_brdgmm_dw_conv.hpp"
 #include "cpu/aarch64/jit_brgemm_1x1_conv.hpp"
 #include "cpu/aarch64/jit_brgemm_conv_bwd.hpp"
 #include "cpu/cpu_convolution_pd.hpp"
@@ -136,6 +137,13 @@ status_t brgemm_convolution_bwd_t<isa>::pd_t::init(engine_t *engine) {
         if (pd != nullptr) {
             break; // non-1x1 implementation found
         }
+
+        using fwd_dw_conv_pd_t =
+                typename brdgmm_dw_convolution_fwd_t<isa>::pd_t;
+        const auto pd_dw = dynamic_cast<fwd_dw_conv_pd_t *>((*it).get());
+        if (pd_dw != nullptr) {
+            break; // depthwise implementation found
+        }
     }
 
     VDISPATCH_CONV(it != it.end(), "Implementation wasn't found");
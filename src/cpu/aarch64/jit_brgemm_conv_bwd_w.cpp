@@ -0,0 +1,490 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/aarch64/jit_brgemm_conv_bwd_w.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::utils;
+using namespace memory_tracking::names;
+
+namespace {
+constexpr dim_t m_blk_default = 64;
+constexpr dim_t n_blk_default = 64;
+constexpr dim_t bs_max = 16;
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_bwd_weights_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+
+    const auto src_dt = invariant_src_md()->data_type;
+    const auto diff_dst_dt = invariant_dst_md()->data_type;
+    const auto wei_dt = invariant_wei_md()->data_type;
+    const auto bia_dt = with_bias() ? invariant_bia_md()->data_type : wei_dt;
+
+    VDISPATCH_CONV(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(is_bwd_w(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(src_dt == diff_dst_dt && one_of(src_dt, f32, bf16),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_CONV(IMPLICATION(src_dt == f32, everyone_is(f32, wei_dt, bia_dt)),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_CONV(IMPLICATION(src_dt == bf16,
+                           one_of(wei_dt, f32, bf16)
+                                   && one_of(bia_dt, f32, bf16)),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    // BFDOT is only available with FEAT_BF16
+    VDISPATCH_CONV(IMPLICATION(src_dt == bf16, mayiuse_bf16()),
+            VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(!with_groups(), VERBOSE_UNSUPPORTED_FEATURE, "groups");
+
+    const int nd = ndims();
+    VDISPATCH_CONV(one_of(nd, 3, 4, 5), VERBOSE_BAD_NDIMS, "src", nd);
+    const auto dat_tag = pick(nd - 3, nwc, nhwc, ndhwc);
+    const auto wei_tag = pick(nd - 3, wio, hwio, dhwio);
+    VDISPATCH_CONV(set_default_formats_common(dat_tag, wei_tag, dat_tag),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(memory_desc_matches_tag(src_md_, dat_tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VDISPATCH_CONV(memory_desc_matches_tag(diff_dst_md_, dat_tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "diff_dst");
+    VDISPATCH_CONV(memory_desc_matches_tag(diff_weights_md_, wei_tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "diff_weights");
+
+    CHECK(init_conf());
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_bwd_weights_t<isa>::pd_t::init_conf() {
+    using namespace data_type;
+    auto &c = conf_;
+    c.src_dt = invariant_src_md()->data_type;
+    c.diff_dst_dt = invariant_dst_md()->data_type;
+    c.wei_dt = invariant_wei_md()->data_type;
+    c.with_bias = with_bias();
+    c.bia_dt = c.with_bias ? invariant_bia_md()->data_type : c.wei_dt;
+
+    c.mb = MB();
+    c.ic = IC();
+    c.oc = OC();
+    c.id = ID();
+    c.ih = IH();
+    c.iw = IW();
+    c.od = OD();
+    c.oh = OH();
+    c.ow = OW();
+    c.kd = KD();
+    c.kh = KH();
+    c.kw = KW();
+    c.stride_d = KSD();
+    c.stride_h = KSH();
+    c.stride_w = KSW();
+    c.dilate_d = KDD() + 1;
+    c.dilate_h = KDH() + 1;
+    c.dilate_w = KDW() + 1;
+    c.f_pad = padFront();
+    c.t_pad = padT();
+    c.l_pad = padL();
+
+    // BFDOT reduces pairs of elements
+    c.ow_pad = c.src_dt == bf16 ? rnd_up(c.ow, 2) : c.ow;
+    c.nrows = c.mb * c.od * c.oh;
+
+    c.m_blk = nstl::min(c.ic, m_blk_default);
+    c.nb_ic = div_up(c.ic, c.m_blk);
+    c.ic_tail = c.ic % c.m_blk;
+    c.n_blk = nstl::min(c.oc, n_blk_default);
+    c.nb_oc = div_up(c.oc, c.n_blk);
+    c.oc_tail = c.oc % c.n_blk;
+
+    // The blocks of diff_weights are distributed first as they need no
+    // reduction, the remaining threads split the rows.
+    const int max_nthr
+            = attr()->dispatch_hint_.get_nthr(dnnl_get_max_threads());
+    const dim_t work_wei = c.kd * c.kh * c.kw * c.nb_ic * c.nb_oc;
+    c.nthr_wei = static_cast<int>(nstl::min<dim_t>(max_nthr, work_wei));
+    c.nthr_mb = static_cast<int>(nstl::min<dim_t>(
+            nstl::max(1, max_nthr / c.nthr_wei), c.nrows));
+    c.nthr = c.nthr_mb * c.nthr_wei;
+
+    // Keep the staged rows of a batch in L2
+    const dim_t src_dt_sz = types::data_type_size(c.src_dt);
+    dim_t row_bytes = c.ic * c.ow_pad * src_dt_sz;
+    if (c.src_dt == bf16) row_bytes += c.ow_pad * c.oc * src_dt_sz;
+    const dim_t l2_size = platform::get_per_core_cache_size(2);
+    c.bs = saturate<dim_t>(1, bs_max, l2_size / 2 / row_bytes);
+    c.bs = nstl::min(c.bs, div_up(c.nrows, c.nthr_mb));
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_bwd_weights_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &c = conf_;
+
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = static_cast<int>(c.bs);
+
+    // diff_wei[IC, OC] += tr_src[IC, OW] * diff_dst[OW, OC] over rows
+    for (bool m_tail : {false, true})
+        for (bool n_tail : {false, true}) {
+            const dim_t M = m_tail ? c.ic_tail : c.m_blk;
+            const dim_t N = n_tail ? c.oc_tail : c.n_blk;
+            if (M == 0 || N == 0) continue;
+
+            auto &brg = brg_descs_[get_brg_idx(m_tail, n_tail)];
+            CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, c.src_dt,
+                    c.diff_dst_dt, false, false, brgemm_row_major, 1.f, 1.f,
+                    c.ow_pad, c.oc, c.oc, M, N, c.ow_pad));
+            CHECK(brgemm_desc_set_attr(&brg, brgattr));
+            CHECK(brgemm_desc_finalize(&brg));
+        }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_convolution_bwd_weights_t<isa>::pd_t::init_scratchpad() {
+    using namespace data_type;
+    const auto &c = conf_;
+    const dim_t src_dt_sz = types::data_type_size(c.src_dt);
+    auto scratchpad = scratchpad_registry().registrar();
+
+    scratchpad.template book<char>(
+            key_conv_tr_src, c.nthr * c.bs * c.ic * c.ow_pad * src_dt_sz);
+    if (c.src_dt == bf16)
+        scratchpad.template book<char>(key_conv_tr_diff_dst,
+                c.nthr * c.bs * c.ow_pad * c.oc * src_dt_sz);
+    scratchpad.template book<brgemm_batch_element_t>(
+            key_conv_brgemm_batch, c.nthr * c.bs);
+
+    // f32 diff_weights are used as the buffer of the first group of threads
+    const dim_t wei_size = c.kd * c.kh * c.kw * c.ic * c.oc;
+    const dim_t nbufs = c.nthr_mb - (c.wei_dt == f32 ? 1 : 0);
+    if (nbufs > 0)
+        scratchpad.template book<float>(
+                key_conv_wei_reduction, nbufs * wei_size);
+    if (c.with_bias)
+        scratchpad.template book<float>(key_conv_bia_reduction, c.nthr * c.oc);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_bwd_weights_t<isa>::init(engine_t *engine) {
+    const auto &c = pd()->conf_;
+    for (bool m_tail : {false, true})
+        for (bool n_tail : {false, true}) {
+            const dim_t M = m_tail ? c.ic_tail : c.m_blk;
+            const dim_t N = n_tail ? c.oc_tail : c.n_blk;
+            if (M == 0 || N == 0) continue;
+
+            const int idx = pd_t::get_brg_idx(m_tail, n_tail);
+            brgemm_kernel_t *ker = nullptr;
+            CHECK(brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
+            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+template <typename data_t>
+void brgemm_convolution_bwd_weights_t<isa>::compute_diff_weights(
+        const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+
+    const auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC) + src_d.offset0();
+    const auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST)
+            + diff_dst_d.offset0();
+    auto diff_wei = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_WEIGHTS);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto tr_src_base = scratchpad.template get<data_t>(key_conv_tr_src);
+    auto tr_diff_dst_base
+            = scratchpad.template get<data_t>(key_conv_tr_diff_dst);
+    auto batch_base = scratchpad.template get<brgemm_batch_element_t>(
+            key_conv_brgemm_batch);
+    auto wei_bufs = scratchpad.template get<float>(key_conv_wei_reduction);
+
+    const bool is_bf16 = c.src_dt == data_type::bf16;
+    const bool wei_f32 = c.wei_dt == data_type::f32;
+    const dim_t wei_size = c.kd * c.kh * c.kw * c.ic * c.oc;
+    const dim_t work_wei = c.kd * c.kh * c.kw * c.nb_ic * c.nb_oc;
+    const dim_t tr_src_row = c.ic * c.ow_pad;
+    const dim_t tr_diff_dst_row = c.ow_pad * c.oc;
+
+    // Stages src[ic][ow] of an output row for a kernel point, returns false
+    // if the row only reads the padding
+    auto stage_src = [&](dim_t kpt, dim_t r, data_t *tr_src) {
+        const dim_t n = r / (c.od * c.oh);
+        const dim_t od = (r / c.oh) % c.od;
+        const dim_t oh = r % c.oh;
+        const dim_t kd = kpt / (c.kh * c.kw);
+        const dim_t kh = (kpt / c.kw) % c.kh;
+        const dim_t kw = kpt % c.kw;
+        const dim_t id = od * c.stride_d - c.f_pad + kd * c.dilate_d;
+        const dim_t ih = oh * c.stride_h - c.t_pad + kh * c.dilate_h;
+        if (id < 0 || id >= c.id || ih < 0 || ih >= c.ih) return false;
+
+        const data_t *src_row
+                = src + ((n * c.id + id) * c.ih + ih) * c.iw * c.ic;
+        for (dim_t ow = 0; ow < c.ow_pad; ++ow) {
+            const dim_t iw = ow * c.stride_w - c.l_pad + kw * c.dilate_w;
+            if (ow >= c.ow || iw < 0 || iw >= c.iw) {
+                for (dim_t ic = 0; ic < c.ic; ++ic)
+                    tr_src[ic * c.ow_pad + ow] = 0.f;
+                continue;
+            }
+            const data_t *s = src_row + iw * c.ic;
+            for (dim_t ic = 0; ic < c.ic; ++ic)
+                tr_src[ic * c.ow_pad + ow] = s[ic];
+        }
+        return true;
+    };
+
+    // Stages diff_dst[ow / 2][oc][ow % 2] of an output row
+    auto stage_diff_dst = [&](dim_t r, data_t *tr_diff_dst) {
+        const data_t *dd_row = diff_dst + r * c.ow * c.oc;
+        for (dim_t ow = 0; ow < c.ow_pad; ++ow) {
+            data_t *tr = tr_diff_dst + (ow / 2) * 2 * c.oc + ow % 2;
+            const data_t *dd = dd_row + ow * c.oc;
+            const bool is_pad = ow >= c.ow;
+            for (dim_t oc = 0; oc < c.oc; ++oc)
+                tr[2 * oc] = is_pad ? 0.f : static_cast<float>(dd[oc]);
+        }
+    };
+
+    parallel(c.nthr, [&](const int ithr, const int nthr) {
+        assert(nthr == c.nthr);
+        const int ithr_mb = ithr / c.nthr_wei;
+        const int ithr_wei = ithr % c.nthr_wei;
+
+        dim_t w_start {0}, w_end {0}, r_start {0}, r_end {0};
+        balance211(work_wei, c.nthr_wei, ithr_wei, w_start, w_end);
+        balance211(c.nrows, c.nthr_mb, ithr_mb, r_start, r_end);
+
+        float *acc = wei_f32 && ithr_mb == 0
+                ? diff_wei
+                : wei_bufs + (ithr_mb - (wei_f32 ? 1 : 0)) * wei_size;
+        data_t *tr_src = tr_src_base + ithr * c.bs * tr_src_row;
+        data_t *tr_diff_dst = tr_diff_dst_base + ithr * c.bs * tr_diff_dst_row;
+        brgemm_batch_element_t *batch = batch_base + ithr * c.bs;
+
+        struct blk_t {
+            dim_t kpt, ic_start, oc_start, M, N;
+        };
+        auto get_blk = [&](dim_t w) {
+            blk_t b;
+            const dim_t ocb = w % c.nb_oc;
+            const dim_t icb = (w / c.nb_oc) % c.nb_ic;
+            b.kpt = w / (c.nb_oc * c.nb_ic);
+            b.ic_start = icb * c.m_blk;
+            b.oc_start = ocb * c.n_blk;
+            b.M = nstl::min(c.m_blk, c.ic - b.ic_start);
+            b.N = nstl::min(c.n_blk, c.oc - b.oc_start);
+            return b;
+        };
+        auto acc_blk = [&](const blk_t &b) {
+            return acc + b.kpt * c.ic * c.oc + b.ic_start * c.oc + b.oc_start;
+        };
+
+        // Every group of threads writes its blocks of diff_weights even if
+        // it has no rows, so the reduction reads initialized buffers
+        for (dim_t w = w_start; w < w_end; ++w) {
+            const blk_t b = get_blk(w);
+            float *C = acc_blk(b);
+            for (dim_t ic = 0; ic < b.M; ++ic) {
+                PRAGMA_OMP_SIMD()
+                for (dim_t oc = 0; oc < b.N; ++oc)
+                    C[ic * c.oc + oc] = 0.f;
+            }
+        }
+
+        bool row_ok[bs_max];
+        for (dim_t r0 = r_start; r0 < r_end; r0 += c.bs) {
+            const dim_t nr = nstl::min(c.bs, r_end - r0);
+            if (is_bf16) {
+                for (dim_t j = 0; j < nr; ++j)
+                    stage_diff_dst(r0 + j, tr_diff_dst + j * tr_diff_dst_row);
+            }
+
+            // Blocks are ordered by kernel point, so the src rows of a
+            // kernel point are staged once for all its blocks
+            dim_t cur_kpt = -1;
+            for (dim_t w = w_start; w < w_end; ++w) {
+                const blk_t b = get_blk(w);
+                if (b.kpt != cur_kpt) {
+                    for (dim_t j = 0; j < nr; ++j)
+                        row_ok[j] = stage_src(
+                                b.kpt, r0 + j, tr_src + j * tr_src_row);
+                    cur_kpt = b.kpt;
+                }
+
+                int bs = 0;
+                for (dim_t j = 0; j < nr; ++j) {
+                    if (!row_ok[j]) continue;
+                    batch[bs].ptr.A = tr_src + j * tr_src_row
+                            + b.ic_start * c.ow_pad;
+                    batch[bs].ptr.B = is_bf16
+                            ? tr_diff_dst + j * tr_diff_dst_row
+                                    + 2 * b.oc_start
+                            : diff_dst + (r0 + j) * c.ow * c.oc + b.oc_start;
+                    bs++;
+                }
+                if (bs == 0) continue;
+
+                const int idx = pd_t::get_brg_idx(
+                        b.M < c.m_blk, b.N < c.n_blk);
+                brgemm_kernel_execute(
+                        brg_kernels_[idx].get(), bs, batch, acc_blk(b));
+            }
+        }
+    });
+}
+
+template <cpu_isa_t isa>
+void brgemm_convolution_bwd_weights_t<isa>::reduce_diff_weights(
+        const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+    const bool wei_f32 = c.wei_dt == data_type::f32;
+    const int nbufs = c.nthr_mb - (wei_f32 ? 1 : 0);
+    if (nbufs == 0) return;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    const auto wei_bufs
+            = scratchpad.template get<const float>(key_conv_wei_reduction);
+    auto diff_wei = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_WEIGHTS);
+    const dim_t wei_size = c.kd * c.kh * c.kw * c.ic * c.oc;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(wei_size, nthr, ithr, start, end);
+        if (wei_f32) {
+            float *out = static_cast<float *>(diff_wei);
+            for (int b = 0; b < nbufs; ++b) {
+                const float *buf = wei_bufs + b * wei_size;
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = start; i < end; ++i)
+                    out[i] += buf[i];
+            }
+        } else {
+            bfloat16_t *out = static_cast<bfloat16_t *>(diff_wei);
+            for (dim_t i = start; i < end; ++i) {
+                float v = 0.f;
+                for (int b = 0; b < nbufs; ++b)
+                    v += wei_bufs[b * wei_size + i];
+                out[i] = v;
+            }
+        }
+    });
+}
+
+template <cpu_isa_t isa>
+template <typename data_t>
+void brgemm_convolution_bwd_weights_t<isa>::compute_diff_bias(
+        const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST)
+            + diff_dst_d.offset0();
+    auto diff_bias = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_BIAS);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto bia_bufs = scratchpad.template get<float>(key_conv_bia_reduction);
+
+    // Every thread sums the rows of its points over the channels, as
+    // diff_dst is traversed in memory order
+    const dim_t npoints = c.nrows * c.ow;
+    parallel(c.nthr, [&](const int ithr, const int nthr) {
+        assert(nthr == c.nthr);
+        dim_t start {0}, end {0};
+        balance211(npoints, nthr, ithr, start, end);
+        float *acc = bia_bufs + ithr * c.oc;
+        PRAGMA_OMP_SIMD()
+        for (dim_t oc = 0; oc < c.oc; ++oc)
+            acc[oc] = 0.f;
+        for (dim_t p = start; p < end; ++p) {
+            const data_t *dd = diff_dst + p * c.oc;
+            PRAGMA_OMP_SIMD()
+            for (dim_t oc = 0; oc < c.oc; ++oc)
+                acc[oc] += static_cast<float>(dd[oc]);
+        }
+    });
+
+    parallel_nd(c.oc, [&](dim_t oc) {
+        float v = 0.f;
+        for (int ithr = 0; ithr < c.nthr; ++ithr)
+            v += bia_bufs[ithr * c.oc + oc];
+        if (c.bia_dt == data_type::f32)
+            static_cast<float *>(diff_bias)[oc] = v;
+        else
+            static_cast<bfloat16_t *>(diff_bias)[oc] = v;
+    });
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_bwd_weights_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+    const bool is_bf16 = c.src_dt == data_type::bf16;
+
+    if (is_bf16)
+        compute_diff_weights<bfloat16_t>(ctx);
+    else
+        compute_diff_weights<float>(ctx);
+    reduce_diff_weights(ctx);
+
+    if (c.with_bias) {
+        if (is_bf16)
+            compute_diff_bias<bfloat16_t>(ctx);
+        else
+            compute_diff_bias<float>(ctx);
+    }
+
+    return status::success;
+}
+
+template struct brgemm_convolution_bwd_weights_t<sve_512>;
+template struct brgemm_convolution_bwd_weights_t<sve_256>;
+template struct brgemm_convolution_bwd_weights_t<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_BRGEMM_CONV_BWD_W_HPP
+#define CPU_AARCH64_JIT_BRGEMM_CONV_BWD_W_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/aarch64/brgemm/brgemm.hpp"
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct brgemm_bwd_w_conf_t {
+    data_type_t src_dt, diff_dst_dt, wei_dt, bia_dt;
+
+    dim_t mb, ic, oc;
+    dim_t id, ih, iw, od, oh, ow;
+    dim_t kd, kh, kw;
+    dim_t stride_d, stride_h, stride_w;
+    dim_t dilate_d, dilate_h, dilate_w;
+    dim_t f_pad, t_pad, l_pad;
+
+    // Output width padded to the granularity of the reduction of brgemm,
+    // the padding of the staged buffers is zeroed
+    dim_t ow_pad;
+    // Rows of the output, i.e. mb * od * oh
+    dim_t nrows;
+    // Rows of the output reduced by a single brgemm call
+    dim_t bs;
+
+    // Blocking of the input and output channels of diff_weights
+    dim_t m_blk, nb_ic, ic_tail;
+    dim_t n_blk, nb_oc, oc_tail;
+
+    // Threads are split between the reduction over the output rows and the
+    // blocks of diff_weights
+    int nthr, nthr_mb, nthr_wei;
+
+    bool with_bias;
+};
+
+/// Backward by weights convolution for nwc, nhwc and ndhwc activations.
+///
+/// For every kernel point the diff_weights [IC][OC] are computed as the
+/// product of the transposed src [IC][OW] and diff_dst [OW][OC] summed over
+/// the output rows. The src rows of a kernel point are staged transposed,
+/// with zeros in place of the padding, and for bf16 the diff_dst rows are
+/// staged with pairs of rows interleaved as required by BFDOT. When there are
+/// not enough blocks of diff_weights to keep all the threads busy, the rows
+/// are split between groups of threads that accumulate into private buffers
+/// reduced at the end.
+template <cpu_isa_t isa>
+struct brgemm_convolution_bwd_weights_t : public primitive_t {
+    struct pd_t : public cpu_convolution_bwd_weights_pd_t {
+        using cpu_convolution_bwd_weights_pd_t::
+                cpu_convolution_bwd_weights_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgconv_bwd_w:", isa, ""),
+                brgemm_convolution_bwd_weights_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernel index for a (IC tail, OC tail) combination
+        static int get_brg_idx(bool m_tail, bool n_tail) {
+            return 2 * static_cast<int>(m_tail) + static_cast<int>(n_tail);
+        }
+
+        brgemm_bwd_w_conf_t conf_ {};
+        brgemm_desc_t brg_descs_[4];
+
+    private:
+        status_t init_conf();
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_convolution_bwd_weights_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    template <typename data_t>
+    void compute_diff_weights(const exec_ctx_t &ctx) const;
+    template <typename data_t>
+    void compute_diff_bias(const exec_ctx_t &ctx) const;
+    void reduce_diff_weights(const exec_ctx_t &ctx) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[4];
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -1202,7 +1202,9 @@ status_t brg_blocking_t::calc_blocks() {
         kh_blocks[1] = 1;
     }
 
-    const auto thr_eff_threshold = 0.9f;
+    // A throughput goal takes larger blocks at the cost of idle threads
+    const auto thr_eff_threshold
+            = dispatch_goal == dispatch_goal::throughput ? 0.5f : 0.9f;
     const auto max_ow_block_thr = utils::saturate(1, ow,
             static_cast<int>(ceil(
                     mb * ngroups * nb_oc * os / (thr_eff_threshold * nthr))));
@@ -1514,7 +1516,9 @@ void brg_blocking_t::calc_blocks_1x1() {
     kd_block_pad = kh_block_pad = kw_block_pad = 1;
     nb_ic_blocking = 1;
 
-    const auto thr_eff_threshold = 0.9f;
+    // A throughput goal takes larger blocks at the cost of idle threads
+    const auto thr_eff_threshold
+            = dispatch_goal == dispatch_goal::throughput ? 0.5f : 0.9f;
 
     const auto max_sp_block_L2 = os;
     // TODO: nb_os_blocking always is 1 for now. Update this code
@@ -1599,7 +1603,11 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
 
     brg_blocking_t::L1 = platform::get_per_core_cache_size(1);
     brg_blocking_t::L2 = platform::get_per_core_cache_size(2);
-    brg_blocking_t::L3 = platform::get_per_core_cache_size(2);
+    // SoCs without an L3, or with a system level cache Linux doesn't
+    // describe, have the L2 as last level cache
+    brg_blocking_t::L3 = platform::get_per_core_cache_size(3);
+    if (brg_blocking_t::L3 == 0)
+        brg_blocking_t::L3 = platform::get_per_core_cache_size(2);
 
     const memory_desc_wrapper src_d(&src_md);
     const memory_desc_wrapper weights_d(&weights_md);
@@ -1747,6 +1755,11 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
 
     if (!is_superset(jcp.isa, sve_128)) return status::unimplemented;
 
+    // u8 activations with s8 weights are computed with usdot which is only
+    // available with the I8MM extension.
+    if (jcp.src_dt == u8 && jcp.wei_dt == s8 && !mayiuse_i8mm())
+        return status::unimplemented;
+
     const bool is_bf16
             = jcp.src_dt == data_type::bf16 && jcp.wei_dt == data_type::bf16;
     if (!IMPLICATION(is_bf16, mayiuse_bf16())) return status::unimplemented;
@@ -1781,6 +1794,7 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
             VERBOSE_UNSUPPORTED_ZP_CFG);
 
     jcp.nthr = nthreads;
+    jcp.dispatch_goal = attr.dispatch_hint_.goal_;
     jcp.kh_sets = 1;
     jcp.kw_sets = 1;
     jcp.copy_block_only = false;
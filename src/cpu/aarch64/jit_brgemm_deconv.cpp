@@ -1,6 +1,6 @@
 /*******************************************************************************
 * Copyright 2022 Intel Corporation
-* Copyright 2025 Arm Ltd. and affiliates
+* Copyright 2025-2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -23,8 +23,11 @@
 
 #include "cpu/aarch64/jit_brgemm_deconv.hpp"
 
+#include "cpu/ref_io_helper.hpp"
+
 #include "cpu/aarch64/jit_brgemm_1x1_conv.hpp"
 #include "cpu/aarch64/jit_brgemm_conv.hpp"
+#include "cpu/aarch64/jit_brgemm_conv_bwd_w.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -81,6 +84,41 @@ status_t fwd_conv_desc_create(const deconvolution_desc_t *fwd_deconv_d,
     fwd_conv_d->use_inversion = true;
     return status::success;
 }
+
+status_t weights_axes_permutation(
+        memory_desc_t *o_md, const memory_desc_t *i_md, bool with_groups) {
+    int perm[DNNL_MAX_NDIMS] {}; // deconv to conv weight permutation
+    for (int d = 0; d < DNNL_MAX_NDIMS; ++d)
+        perm[d] = d;
+    nstl::swap(perm[0 + with_groups], perm[1 + with_groups]);
+
+    return memory_desc_permute_axes(*o_md, *i_md, perm);
+}
+
+// Creates the convolution descriptor computing a backward deconvolution:
+// - backward by data is a forward convolution of diff_dst producing diff_src
+// - backward by weights is a backward by weights convolution where diff_dst
+//   plays the role of src and src the role of diff_dst
+// In both cases the weights have OC and IC transposed. The bias is never
+// passed to the convolution.
+status_t bwd_conv_desc_create(
+        const deconvolution_desc_t *dd, convolution_desc_t *cd) {
+    const bool is_bwd_d = dd->prop_kind == prop_kind::backward_data;
+    const memory_desc_t &src_md = dd->diff_dst_desc;
+    const memory_desc_t &dst_md = is_bwd_d ? dd->diff_src_desc : dd->src_desc;
+    const memory_desc_t &d_weights_md
+            = is_bwd_d ? dd->weights_desc : dd->diff_weights_desc;
+
+    memory_desc_t c_weights_md;
+    const bool with_groups = d_weights_md.ndims == src_md.ndims + 1;
+    CHECK(weights_axes_permutation(&c_weights_md, &d_weights_md, with_groups));
+
+    return conv_desc_init(cd,
+            is_bwd_d ? prop_kind::forward_training
+                     : prop_kind::backward_weights,
+            alg_kind::convolution_direct, &src_md, &c_weights_md, nullptr,
+            &dst_md, dd->strides, dd->dilates, dd->padding[0], dd->padding[1]);
+}
 } // namespace
 
 template <typename implementation_pd>
@@ -196,8 +234,218 @@ status_t brgemm_deconvolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     return conv_p_->execute(conv_ctx);
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_bwd_data_t<isa>::pd_t::init(engine_t *engine) {
+    VDISPATCH_DECONVOLUTION(desc()->prop_kind == prop_kind::backward_data,
+            VERBOSE_BAD_PROPKIND);
+    VDISPATCH_DECONVOLUTION(
+            desc()->alg_kind == alg_kind::deconvolution_direct,
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_DECONVOLUTION(
+            attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_DECONVOLUTION(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_DECONVOLUTION(
+            impl::is_dense_format_kind({diff_src_md(0), weights_md(0),
+                    diff_dst_md(0)}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    convolution_desc_t conv_d = convolution_desc_t();
+    CHECK(bwd_conv_desc_create(desc(), &conv_d));
+
+    primitive_desc_iterator_t it(engine,
+            reinterpret_cast<const op_desc_t *>(&conv_d), attr(), nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+
+    while (++it != it.end()) {
+        conv_pd_ = *it;
+        if (conv_pd_->weights_md()->extra.flags != 0) continue;
+        if (check_embedded_impl_init<
+                    typename brgemm_1x1_convolution_fwd_t<isa>::pd_t>(it)
+                == status::success)
+            break;
+        if (check_embedded_impl_init<
+                    typename brgemm_convolution_fwd_t<isa>::pd_t>(it)
+                == status::success)
+            break;
+    }
+    if (it == it.end())
+        VDISPATCH_DECONVOLUTION_IC(
+                false, "brgemm implementation not found for convolution");
+
+    if (weights_md_.format_kind == format_kind::any)
+        CHECK(weights_axes_permutation(
+                &weights_md_, conv_pd_->weights_md(), with_groups()));
+    if (diff_src_md_.format_kind == format_kind::any)
+        diff_src_md_ = *conv_pd_->dst_md();
+    if (diff_dst_md_.format_kind == format_kind::any)
+        diff_dst_md_ = *conv_pd_->src_md();
+
+    init_name();
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(memory_tracking::names::key_nested,
+            conv_pd_->scratchpad_registry());
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_bwd_data_t<isa>::init(engine_t *engine) {
+    return pd()->conv_pd_->create_primitive(conv_p_, engine);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_bwd_data_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto &args = ctx.args();
+    exec_args_t conv_args;
+    conv_args[DNNL_ARG_SRC] = args.at(DNNL_ARG_DIFF_DST);
+    conv_args[DNNL_ARG_WEIGHTS] = args.at(DNNL_ARG_WEIGHTS);
+    conv_args[DNNL_ARG_DST] = args.at(DNNL_ARG_DIFF_SRC);
+    exec_ctx_t conv_ctx(ctx, std::move(conv_args));
+
+    auto *nested_grantor = create_nested_grantor(ctx.get_scratchpad_grantor(),
+            memory_tracking::names::key_nested,
+            conv_p_->pd()->scratchpad_registry());
+    conv_ctx.set_scratchpad_grantor(nested_grantor);
+    return conv_p_->execute(conv_ctx);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_bwd_weights_t<isa>::pd_t::init(
+        engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+
+    VDISPATCH_DECONVOLUTION(desc()->prop_kind == prop_kind::backward_weights,
+            VERBOSE_BAD_PROPKIND);
+    VDISPATCH_DECONVOLUTION(
+            desc()->alg_kind == alg_kind::deconvolution_direct,
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_DECONVOLUTION(
+            attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_DECONVOLUTION(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_DECONVOLUTION(
+            impl::is_dense_format_kind({src_md(0), diff_weights_md(0),
+                    diff_weights_md(1), diff_dst_md(0)}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    if (with_bias()) {
+        const auto bia_dt = diff_weights_md(1)->data_type;
+        VDISPATCH_DECONVOLUTION(utils::one_of(bia_dt, f32, bf16),
+                VERBOSE_UNSUPPORTED_DT);
+    }
+
+    convolution_desc_t conv_d = convolution_desc_t();
+    CHECK(bwd_conv_desc_create(desc(), &conv_d));
+
+    primitive_desc_iterator_t it(engine,
+            reinterpret_cast<const op_desc_t *>(&conv_d), attr(), nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+
+    while (++it != it.end()) {
+        conv_pd_ = *it;
+        if (conv_pd_->diff_weights_md()->extra.flags != 0) continue;
+        if (check_embedded_impl_init<
+                    typename brgemm_convolution_bwd_weights_t<isa>::pd_t>(it)
+                == status::success)
+            break;
+    }
+    if (it == it.end())
+        VDISPATCH_DECONVOLUTION_IC(
+                false, "brgemm implementation not found for convolution");
+
+    if (diff_weights_md_.format_kind == format_kind::any)
+        CHECK(weights_axes_permutation(
+                &diff_weights_md_, conv_pd_->diff_weights_md(), with_groups()));
+    if (src_md_.format_kind == format_kind::any)
+        src_md_ = *conv_pd_->diff_dst_md();
+    if (diff_dst_md_.format_kind == format_kind::any)
+        diff_dst_md_ = *conv_pd_->src_md();
+    if (diff_bias_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(diff_bias_md_, x));
+
+    // The bias reduction walks diff_dst as rows of channels
+    const auto dat_tag = utils::pick(ndims() - 3, nwc, nhwc, ndhwc);
+    VDISPATCH_DECONVOLUTION(
+            IMPLICATION(with_bias(),
+                    memory_desc_matches_tag(diff_dst_md_, dat_tag)
+                            && memory_desc_wrapper(diff_bias_md_)
+                                    .is_dense()),
+            VERBOSE_UNSUPPORTED_TAG_S, "diff_dst");
+
+    init_name();
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(memory_tracking::names::key_nested,
+            conv_pd_->scratchpad_registry());
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_bwd_weights_t<isa>::init(engine_t *engine) {
+    return pd()->conv_pd_->create_primitive(conv_p_, engine);
+}
+
+template <cpu_isa_t isa>
+void brgemm_deconvolution_bwd_weights_t<isa>::compute_diff_bias(
+        const exec_ctx_t &ctx) const {
+    const auto diff_dst = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST);
+    auto diff_bias = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_BIAS);
+
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const memory_desc_wrapper diff_bias_d(pd()->diff_weights_md(1));
+    const auto ddst_dt = diff_dst_d.data_type();
+    const auto bia_dt = diff_bias_d.data_type();
+    const dim_t C = diff_dst_d.dims()[1];
+    const dim_t nrows = diff_dst_d.nelems() / C;
+    const dim_t ddst_off = diff_dst_d.offset0();
+    const dim_t bia_off = diff_bias_d.offset0();
+
+    // Channels are split into blocks so that a thread accumulates a few
+    // neighbouring channels of every row
+    constexpr dim_t c_blk = 16;
+    parallel_nd(utils::div_up(C, c_blk), [&](dim_t cb) {
+        const dim_t c_s = cb * c_blk;
+        const dim_t c_len = nstl::min(c_blk, C - c_s);
+        float acc[c_blk] = {0.f};
+        for (dim_t r = 0; r < nrows; ++r) {
+            const dim_t off = ddst_off + r * C + c_s;
+            for (dim_t c = 0; c < c_len; ++c)
+                acc[c] += io::load_float_value(ddst_dt, diff_dst, off + c);
+        }
+        for (dim_t c = 0; c < c_len; ++c)
+            io::store_float_value(bia_dt, acc[c], diff_bias, bia_off + c_s + c);
+    });
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_bwd_weights_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto &args = ctx.args();
+    exec_args_t conv_args;
+    conv_args[DNNL_ARG_SRC] = args.at(DNNL_ARG_DIFF_DST);
+    conv_args[DNNL_ARG_DIFF_DST] = args.at(DNNL_ARG_SRC);
+    conv_args[DNNL_ARG_DIFF_WEIGHTS] = args.at(DNNL_ARG_DIFF_WEIGHTS);
+    exec_ctx_t conv_ctx(ctx, std::move(conv_args));
+
+    auto *nested_grantor = create_nested_grantor(ctx.get_scratchpad_grantor(),
+            memory_tracking::names::key_nested,
+            conv_p_->pd()->scratchpad_registry());
+    conv_ctx.set_scratchpad_grantor(nested_grantor);
+    CHECK(conv_p_->execute(conv_ctx));
+
+    if (pd()->with_bias()) compute_diff_bias(ctx);
+    return status::success;
+}
+
+template struct brgemm_deconvolution_fwd_t<sve_512>;
 template struct brgemm_deconvolution_fwd_t<sve_256>;
 template struct brgemm_deconvolution_fwd_t<sve_128>;
+template struct brgemm_deconvolution_bwd_data_t<sve_512>;
+template struct brgemm_deconvolution_bwd_data_t<sve_256>;
+template struct brgemm_deconvolution_bwd_data_t<sve_128>;
+template struct brgemm_deconvolution_bwd_weights_t<sve_512>;
+template struct brgemm_deconvolution_bwd_weights_t<sve_256>;
+template struct brgemm_deconvolution_bwd_weights_t<sve_128>;
 
 } // namespace aarch64
 } // namespace cpu
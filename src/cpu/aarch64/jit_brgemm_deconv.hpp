@@ -1,6 +1,6 @@
 /*******************************************************************************
 * Copyright 2022 Intel Corporation
-* Copyright 2025 Arm Ltd. and affiliates
+* Copyright 2025-2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -109,6 +109,101 @@ private:
     std::shared_ptr<primitive_t> conv_p_;
 };
 
+/// Backward by data deconvolution computed as a forward brgemm convolution
+/// of diff_dst with the transposed weights.
+template <cpu_isa_t isa>
+struct brgemm_deconvolution_bwd_data_t : public primitive_t {
+
+    struct pd_t : public cpu_deconvolution_bwd_data_pd_t {
+        using cpu_deconvolution_bwd_data_pd_t::cpu_deconvolution_bwd_data_pd_t;
+
+        pd_t(const pd_t &other)
+            : cpu_deconvolution_bwd_data_pd_t(other)
+            , conv_pd_(other.conv_pd_->clone())
+            , name_(other.name_) {}
+
+        DECLARE_COMMON_PD_T(name_.c_str(), brgemm_deconvolution_bwd_data_t);
+
+        status_t init(engine_t *engine);
+
+        std::shared_ptr<primitive_desc_t> conv_pd_;
+
+    private:
+        std::string name_;
+
+        void init_name() {
+            name_ = JIT_IMPL_NAME_HELPER("brg_deconv:", isa, "");
+            name_.append("+");
+            name_.append(conv_pd_->name());
+        }
+    };
+
+    brgemm_deconvolution_bwd_data_t(const pd_t *apd) : primitive_t(apd) {};
+
+    ~brgemm_deconvolution_bwd_data_t() override = default;
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const {
+        return static_cast<const pd_t *>(primitive_t::pd().get());
+    }
+
+    std::shared_ptr<primitive_t> conv_p_;
+};
+
+/// Backward by weights deconvolution computed as a backward by weights brgemm
+/// convolution with the roles of src and diff_dst swapped. The convolution
+/// would reduce the bias over the deconvolution src, so diff_bias is reduced
+/// over diff_dst separately.
+template <cpu_isa_t isa>
+struct brgemm_deconvolution_bwd_weights_t : public primitive_t {
+
+    struct pd_t : public cpu_deconvolution_bwd_weights_pd_t {
+        using cpu_deconvolution_bwd_weights_pd_t::
+                cpu_deconvolution_bwd_weights_pd_t;
+
+        pd_t(const pd_t &other)
+            : cpu_deconvolution_bwd_weights_pd_t(other)
+            , conv_pd_(other.conv_pd_->clone())
+            , name_(other.name_) {}
+
+        DECLARE_COMMON_PD_T(name_.c_str(), brgemm_deconvolution_bwd_weights_t);
+
+        status_t init(engine_t *engine);
+
+        std::shared_ptr<primitive_desc_t> conv_pd_;
+
+    private:
+        std::string name_;
+
+        void init_name() {
+            name_ = JIT_IMPL_NAME_HELPER("brg_deconv:", isa, "");
+            name_.append("+");
+            name_.append(conv_pd_->name());
+        }
+    };
+
+    brgemm_deconvolution_bwd_weights_t(const pd_t *apd) : primitive_t(apd) {};
+
+    ~brgemm_deconvolution_bwd_weights_t() override = default;
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const {
+        return static_cast<const pd_t *>(primitive_t::pd().get());
+    }
+
+    void compute_diff_bias(const exec_ctx_t &ctx) const;
+
+    std::shared_ptr<primitive_t> conv_p_;
+};
+
 } // namespace aarch64
 } // namespace cpu
 } // namespace impl
@@ -0,0 +1,480 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_brgemm_inner_product.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::utils;
+using namespace memory_tracking::names;
+using namespace brgemm_inner_product_utils;
+
+namespace {
+constexpr dim_t m_blk_default = 32;
+constexpr dim_t n_blk_default = 64;
+constexpr dim_t k_blk_default = 512;
+
+// out[cols, rows] = in[rows, cols]^T
+void transpose(const float *in, float *out, dim_t rows, dim_t cols) {
+    constexpr dim_t blk = 16;
+    parallel_nd(div_up(rows, blk), div_up(cols, blk), [&](dim_t rb, dim_t cb) {
+        const dim_t r_end = nstl::min(rows, (rb + 1) * blk);
+        const dim_t c_end = nstl::min(cols, (cb + 1) * blk);
+        for_(dim_t r = rb * blk; r < r_end; ++r)
+        for (dim_t c = cb * blk; c < c_end; ++c)
+            out[c * rows + r] = in[r * cols + c];
+    });
+}
+
+// Books the batch elements used by execute_gemm()
+void book_batch(memory_tracking::registrar_t &scratchpad,
+        const brgemm_ip_gemm_conf_t &g) {
+    scratchpad.template book<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch, g.nthr * nstl::max<dim_t>(g.nb_k, 1));
+}
+
+// Computes all the C blocks in parallel, post_process(m_start, M, n_start,
+// N) is called on every C block right after it is computed.
+template <typename post_process_t>
+void execute_gemm(const brgemm_ip_gemm_conf_t &g,
+        const std::unique_ptr<brgemm_kernel_t> *brg_kernels,
+        brgemm_batch_element_t *batch_base, const float *A, const float *B,
+        float *C, const post_process_t &post_process) {
+    const dim_t work_amount = g.nb_m * g.nb_n;
+    parallel(g.nthr, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+        brgemm_batch_element_t *batch
+                = batch_base + ithr * nstl::max<dim_t>(g.nb_k, 1);
+
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t m_start = (iwork / g.nb_n) * g.m_blk;
+            const dim_t n_start = (iwork % g.nb_n) * g.n_blk;
+            const dim_t M = nstl::min(g.m_blk, g.M - m_start);
+            const dim_t N = nstl::min(g.n_blk, g.N - n_start);
+            const bool is_m_tail = M < g.m_blk;
+            const bool is_n_tail = N < g.n_blk;
+            float *C_blk = C + m_start * g.LDC + n_start;
+
+            if (g.nb_k > 0) {
+                for (dim_t ik = 0; ik < g.nb_k; ++ik) {
+                    batch[ik].ptr.A = A + m_start * g.LDA + ik * g.k_blk;
+                    batch[ik].ptr.B = B + ik * g.k_blk * g.LDB + n_start;
+                }
+                const int idx = get_brg_idx(is_m_tail, is_n_tail, false);
+                brgemm_kernel_execute(brg_kernels[idx].get(),
+                        static_cast<int>(g.nb_k), batch, C_blk);
+            }
+            if (g.k_tail > 0) {
+                const dim_t k_start = g.nb_k * g.k_blk;
+                batch[0].ptr.A = A + m_start * g.LDA + k_start;
+                batch[0].ptr.B = B + k_start * g.LDB + n_start;
+                const int idx = get_brg_idx(is_m_tail, is_n_tail, true);
+                brgemm_kernel_execute(brg_kernels[idx].get(), 1, batch, C_blk);
+            }
+
+            post_process(m_start, M, n_start, N);
+        }
+    });
+}
+
+void no_post_process(dim_t, dim_t, dim_t, dim_t) {}
+} // namespace
+
+namespace brgemm_inner_product_utils {
+
+status_t init_gemm_conf(brgemm_ip_gemm_conf_t &g, cpu_isa_t isa, dim_t M,
+        dim_t N, dim_t K, dim_t LDA, dim_t LDB, dim_t LDC,
+        brgemm_desc_t *brg_descs) {
+    using namespace data_type;
+
+    g.M = M;
+    g.N = N;
+    g.K = K;
+    g.LDA = LDA;
+    g.LDB = LDB;
+    g.LDC = LDC;
+
+    g.m_blk = nstl::min(M, m_blk_default);
+    g.n_blk = nstl::min(N, n_blk_default);
+    // Small reductions are done in one block, larger ones are split so the
+    // A and B panels of a block stay in cache.
+    g.k_blk = K <= 2 * k_blk_default ? K : k_blk_default;
+    g.nb_m = div_up(M, g.m_blk);
+    g.nb_n = div_up(N, g.n_blk);
+    g.nb_k = K / g.k_blk;
+    g.m_tail = M % g.m_blk;
+    g.n_tail = N % g.n_blk;
+    g.k_tail = K % g.k_blk;
+    g.nthr = static_cast<int>(
+            nstl::min<dim_t>(dnnl_get_max_threads(), g.nb_m * g.nb_n));
+
+    for_(bool k_tail : {false, true})
+    for_(bool m_tail : {false, true})
+    for (bool n_tail : {false, true}) {
+        const dim_t bs = k_tail ? 1 : g.nb_k;
+        const dim_t M_blk = m_tail ? g.m_tail : g.m_blk;
+        const dim_t N_blk = n_tail ? g.n_tail : g.n_blk;
+        const dim_t K_blk = k_tail ? g.k_tail : g.k_blk;
+        if (bs == 0 || M_blk == 0 || N_blk == 0 || K_blk == 0) continue;
+
+        // The K tail is accumulated on top of the full K blocks
+        const float beta = k_tail && g.nb_k > 0 ? 1.f : 0.f;
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = static_cast<int>(bs);
+
+        auto &brg = brg_descs[get_brg_idx(m_tail, n_tail, k_tail)];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, f32, f32, false, false,
+                brgemm_row_major, 1.f, beta, LDA, LDB, LDC, M_blk, N_blk,
+                K_blk));
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+
+    return status::success;
+}
+
+status_t create_brg_kernels(const brgemm_ip_gemm_conf_t &g,
+        const brgemm_desc_t *brg_descs,
+        std::unique_ptr<brgemm_kernel_t> *brg_kernels) {
+    for_(bool k_tail : {false, true})
+    for_(bool m_tail : {false, true})
+    for (bool n_tail : {false, true}) {
+        const dim_t bs = k_tail ? 1 : g.nb_k;
+        const dim_t M_blk = m_tail ? g.m_tail : g.m_blk;
+        const dim_t N_blk = n_tail ? g.n_tail : g.n_blk;
+        const dim_t K_blk = k_tail ? g.k_tail : g.k_blk;
+        if (bs == 0 || M_blk == 0 || N_blk == 0 || K_blk == 0) continue;
+
+        const int idx = get_brg_idx(m_tail, n_tail, k_tail);
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg_descs[idx]));
+        CHECK(safe_ptr_assign(brg_kernels[idx], ker));
+    }
+    return status::success;
+}
+
+} // namespace brgemm_inner_product_utils
+
+template <cpu_isa_t isa>
+status_t brgemm_inner_product_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    const bool is_wei_any = weights_md_.format_kind == format_kind::any;
+
+    VDISPATCH_INNER_PRODUCT(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_INNER_PRODUCT(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_INNER_PRODUCT(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_INNER_PRODUCT(expect_data_types(f32, f32, f32, f32, f32),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_INNER_PRODUCT(attr()->has_default_values(
+                                    primitive_attr_t::skip_mask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_INNER_PRODUCT(ref_post_ops_t::post_ops_ok(attr()->post_ops_),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_INNER_PRODUCT(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+    // Prefer [IC, OC] weights, they are used by brgemm without a copy.
+    if (is_wei_any && weights_md_.format_desc.blocking.strides[0] != 1)
+        transpose_md(weights_md_);
+    VDISPATCH_INNER_PRODUCT(
+            dense_gemm_consitency_check(src_md(), weights_md(), dst_md()),
+            VERBOSE_INCOMPATIBLE_GEMM_FMT);
+    VDISPATCH_INNER_PRODUCT(
+            IMPLICATION(
+                    MB() > 1, src_md()->format_desc.blocking.strides[0] != 1),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VDISPATCH_INNER_PRODUCT(
+            attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    wei_trans_ = weights_md()->format_desc.blocking.strides[0] != 1;
+
+    const dim_t K = IC_total_padded();
+    CHECK(init_gemm_conf(gemm_, isa, MB(), OC(), K, K, OC(), OC(), brg_descs_));
+
+    auto scratchpad = scratchpad_registry().registrar();
+    book_batch(scratchpad, gemm_);
+    if (wei_trans_)
+        scratchpad.template book<float>(key_iprod_weights_reorder, K * OC());
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_inner_product_fwd_t<isa>::init(engine_t *engine) {
+    CHECK(create_brg_kernels(pd()->gemm_, pd()->brg_descs_, brg_kernels_));
+    if (pd()->attr()->post_ops_.len() > 0) {
+        ref_post_ops_
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops_) return status::out_of_memory;
+        CHECK(ref_post_ops_->init(pd()->dst_md()));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_inner_product_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto &g = pd()->gemm_;
+
+    const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto *batch = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+
+    const float *B = wei;
+    if (pd()->wei_trans_) {
+        float *wei_tr
+                = scratchpad.template get<float>(key_iprod_weights_reorder);
+        transpose(wei, wei_tr, g.N, g.K);
+        B = wei_tr;
+    }
+
+    const auto *ref_post_ops = ref_post_ops_.get();
+    const memory_desc_t *dst_md = pd()->dst_md();
+
+    auto post_process = [&](dim_t m_start, dim_t M, dim_t n_start, dim_t N) {
+        if (!bias && !ref_post_ops) return;
+        for (dim_t m = m_start; m < m_start + M; ++m) {
+            float *d = dst + m * g.LDC;
+            if (bias) {
+                PRAGMA_OMP_SIMD()
+                for (dim_t n = n_start; n < n_start + N; ++n)
+                    d[n] += bias[n];
+            }
+            if (ref_post_ops) {
+                for (dim_t n = n_start; n < n_start + N; ++n) {
+                    ref_post_ops_t::args_t args;
+                    args.dst_val = d[n];
+                    args.ctx = &ctx;
+                    args.l_offset = m * g.N + n;
+                    args.dst_md = dst_md;
+                    ref_post_ops->execute(d[n], args);
+                }
+            }
+        }
+    };
+
+    execute_gemm(g, brg_kernels_, batch, src, B, dst, post_process);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_inner_product_bwd_data_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    const bool is_wei_any = weights_md_.format_kind == format_kind::any;
+
+    VDISPATCH_INNER_PRODUCT(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_INNER_PRODUCT(desc()->prop_kind == prop_kind::backward_data,
+            VERBOSE_BAD_PROPKIND);
+    VDISPATCH_INNER_PRODUCT(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_INNER_PRODUCT(
+            everyone_is(f32, diff_src_md()->data_type, weights_md()->data_type,
+                    diff_dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_INNER_PRODUCT(
+            attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_INNER_PRODUCT(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+    // Prefer [OC, IC] weights, they are used by brgemm without a copy.
+    if (is_wei_any && weights_md_.format_desc.blocking.strides[0] == 1)
+        transpose_md(weights_md_);
+    VDISPATCH_INNER_PRODUCT(dense_gemm_consitency_check(diff_src_md(),
+                                    weights_md(), diff_dst_md()),
+            VERBOSE_INCOMPATIBLE_GEMM_FMT);
+    VDISPATCH_INNER_PRODUCT(
+            IMPLICATION(MB() > 1,
+                    diff_src_md()->format_desc.blocking.strides[0] != 1),
+            VERBOSE_UNSUPPORTED_TAG_S, "diff_src");
+
+    wei_trans_ = weights_md()->format_desc.blocking.strides[0] == 1;
+
+    const dim_t K = IC_total_padded();
+    CHECK(init_gemm_conf(gemm_, isa, MB(), K, OC(), OC(), K, K, brg_descs_));
+
+    auto scratchpad = scratchpad_registry().registrar();
+    book_batch(scratchpad, gemm_);
+    if (wei_trans_)
+        scratchpad.template book<float>(key_iprod_weights_reorder, K * OC());
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_inner_product_bwd_data_t<isa>::init(engine_t *engine) {
+    return create_brg_kernels(pd()->gemm_, pd()->brg_descs_, brg_kernels_);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_inner_product_bwd_data_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto &g = pd()->gemm_;
+
+    const auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    const auto wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto diff_src = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SRC);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto *batch = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+
+    // diff_src[MB, IC] = diff_dst[MB, OC] * wei[OC, IC]
+    const float *B = wei;
+    if (pd()->wei_trans_) {
+        float *wei_tr
+                = scratchpad.template get<float>(key_iprod_weights_reorder);
+        transpose(wei, wei_tr, g.N, g.K);
+        B = wei_tr;
+    }
+
+    execute_gemm(g, brg_kernels_, batch, diff_dst, B, diff_src,
+            no_post_process);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_inner_product_bwd_weights_t<isa>::pd_t::init(
+        engine_t *engine) {
+    using namespace data_type;
+
+    VDISPATCH_INNER_PRODUCT(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_INNER_PRODUCT(desc()->prop_kind == prop_kind::backward_weights,
+            VERBOSE_BAD_PROPKIND);
+    VDISPATCH_INNER_PRODUCT(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_INNER_PRODUCT(
+            everyone_is(f32, src_md()->data_type, diff_weights_md()->data_type,
+                    diff_dst_md()->data_type,
+                    with_bias() ? diff_weights_md(1)->data_type : f32),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_INNER_PRODUCT(
+            attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_INNER_PRODUCT(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_INNER_PRODUCT(dense_gemm_consitency_check(src_md(),
+                                    diff_weights_md(), diff_dst_md()),
+            VERBOSE_INCOMPATIBLE_GEMM_FMT);
+    VDISPATCH_INNER_PRODUCT(
+            IMPLICATION(
+                    MB() > 1, src_md()->format_desc.blocking.strides[0] != 1),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+
+    wei_trans_ = diff_weights_md()->format_desc.blocking.strides[0] == 1;
+
+    const dim_t K = IC_total_padded();
+    auto scratchpad = scratchpad_registry().registrar();
+    if (wei_trans_) {
+        // diff_wei[IC, OC] = src^T[IC, MB] * diff_dst[MB, OC]
+        CHECK(init_gemm_conf(
+                gemm_, isa, K, OC(), MB(), MB(), OC(), OC(), brg_descs_));
+        scratchpad.template book<float>(key_iprod_src_reorder, K * MB());
+    } else {
+        // diff_wei[OC, IC] = diff_dst^T[OC, MB] * src[MB, IC]
+        CHECK(init_gemm_conf(
+                gemm_, isa, OC(), K, MB(), MB(), K, K, brg_descs_));
+        scratchpad.template book<float>(key_iprod_dst_reorder, OC() * MB());
+    }
+    book_batch(scratchpad, gemm_);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_inner_product_bwd_weights_t<isa>::init(engine_t *engine) {
+    return create_brg_kernels(pd()->gemm_, pd()->brg_descs_, brg_kernels_);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_inner_product_bwd_weights_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto &g = pd()->gemm_;
+    const dim_t MB = pd()->MB();
+    const dim_t OC = pd()->OC();
+    const dim_t IC = pd()->IC_total_padded();
+
+    const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    auto diff_wei = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_WEIGHTS);
+    auto diff_bias = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_BIAS);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto *batch = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+
+    if (pd()->wei_trans_) {
+        float *src_tr = scratchpad.template get<float>(key_iprod_src_reorder);
+        transpose(src, src_tr, MB, IC);
+        execute_gemm(g, brg_kernels_, batch, src_tr, diff_dst, diff_wei,
+                no_post_process);
+    } else {
+        float *diff_dst_tr
+                = scratchpad.template get<float>(key_iprod_dst_reorder);
+        transpose(diff_dst, diff_dst_tr, MB, OC);
+        execute_gemm(g, brg_kernels_, batch, diff_dst_tr, src, diff_wei,
+                no_post_process);
+    }
+
+    if (diff_bias) {
+        parallel_nd(div_up(OC, n_blk_default), [&](dim_t ocb) {
+            const dim_t oc_start = ocb * n_blk_default;
+            const dim_t oc_end = nstl::min(OC, oc_start + n_blk_default);
+            for (dim_t oc = oc_start; oc < oc_end; ++oc)
+                diff_bias[oc] = 0.f;
+            for (dim_t mb = 0; mb < MB; ++mb) {
+                const float *d = diff_dst + mb * OC;
+                PRAGMA_OMP_SIMD()
+                for (dim_t oc = oc_start; oc < oc_end; ++oc)
+                    diff_bias[oc] += d[oc];
+            }
+        });
+    }
+
+    return status::success;
+}
+
+template struct brgemm_inner_product_fwd_t<sve_512>;
+template struct brgemm_inner_product_fwd_t<sve_256>;
+template struct brgemm_inner_product_fwd_t<sve_128>;
+template struct brgemm_inner_product_bwd_data_t<sve_512>;
+template struct brgemm_inner_product_bwd_data_t<sve_256>;
+template struct brgemm_inner_product_bwd_data_t<sve_128>;
+template struct brgemm_inner_product_bwd_weights_t<sve_512>;
+template struct brgemm_inner_product_bwd_weights_t<sve_256>;
+template struct brgemm_inner_product_bwd_weights_t<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
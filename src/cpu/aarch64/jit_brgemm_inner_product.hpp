@@ -0,0 +1,172 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_BRGEMM_INNER_PRODUCT_HPP
+#define CPU_AARCH64_JIT_BRGEMM_INNER_PRODUCT_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_inner_product_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/aarch64/brgemm/brgemm.hpp"
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace brgemm_inner_product_utils {
+
+// Kernels for every (M tail, N tail, K tail) combination
+constexpr int max_num_brg_kernels_ip = 8;
+
+// Blocking of a row-major C[M, N] = A[M, K] * B[K, N] computed with brgemm.
+// Full K blocks are passed as one batch and the K tail, if any, is
+// accumulated on top of them with a separate kernel.
+struct brgemm_ip_gemm_conf_t {
+    dim_t M, N, K;
+    dim_t LDA, LDB, LDC;
+
+    dim_t m_blk, n_blk, k_blk;
+    dim_t nb_m, nb_n, nb_k;
+    dim_t m_tail, n_tail, k_tail;
+
+    int nthr;
+};
+
+inline int get_brg_idx(bool m_tail, bool n_tail, bool k_tail) {
+    return 4 * static_cast<int>(k_tail) + 2 * static_cast<int>(m_tail)
+            + static_cast<int>(n_tail);
+}
+
+status_t init_gemm_conf(brgemm_ip_gemm_conf_t &g, cpu_isa_t isa, dim_t M,
+        dim_t N, dim_t K, dim_t LDA, dim_t LDB, dim_t LDC,
+        brgemm_desc_t *brg_descs);
+
+status_t create_brg_kernels(const brgemm_ip_gemm_conf_t &g,
+        const brgemm_desc_t *brg_descs,
+        std::unique_ptr<brgemm_kernel_t> *brg_kernels);
+
+} // namespace brgemm_inner_product_utils
+
+template <cpu_isa_t isa>
+struct brgemm_inner_product_fwd_t : public primitive_t {
+    struct pd_t : public cpu_inner_product_fwd_pd_t {
+        using cpu_inner_product_fwd_pd_t::cpu_inner_product_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgemm:", isa, ""),
+                brgemm_inner_product_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        brgemm_inner_product_utils::brgemm_ip_gemm_conf_t gemm_ {};
+        brgemm_desc_t brg_descs_
+                [brgemm_inner_product_utils::max_num_brg_kernels_ip];
+        // Weights are stored as [OC, IC] and are transposed to [IC, OC]
+        // in the scratchpad before the computation
+        bool wei_trans_ = false;
+    };
+
+    brgemm_inner_product_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t>
+            brg_kernels_[brgemm_inner_product_utils::max_num_brg_kernels_ip];
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
+};
+
+template <cpu_isa_t isa>
+struct brgemm_inner_product_bwd_data_t : public primitive_t {
+    struct pd_t : public cpu_inner_product_bwd_data_pd_t {
+        using cpu_inner_product_bwd_data_pd_t::cpu_inner_product_bwd_data_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgemm_bwd_d:", isa, ""),
+                brgemm_inner_product_bwd_data_t);
+
+        status_t init(engine_t *engine);
+
+        brgemm_inner_product_utils::brgemm_ip_gemm_conf_t gemm_ {};
+        brgemm_desc_t brg_descs_
+                [brgemm_inner_product_utils::max_num_brg_kernels_ip];
+        // Weights are stored as [IC, OC] and are transposed to [OC, IC]
+        // in the scratchpad before the computation
+        bool wei_trans_ = false;
+    };
+
+    brgemm_inner_product_bwd_data_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t>
+            brg_kernels_[brgemm_inner_product_utils::max_num_brg_kernels_ip];
+};
+
+template <cpu_isa_t isa>
+struct brgemm_inner_product_bwd_weights_t : public primitive_t {
+    struct pd_t : public cpu_inner_product_bwd_weights_pd_t {
+        using cpu_inner_product_bwd_weights_pd_t::
+                cpu_inner_product_bwd_weights_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgemm_bwd_w:", isa, ""),
+                brgemm_inner_product_bwd_weights_t);
+
+        status_t init(engine_t *engine);
+
+        brgemm_inner_product_utils::brgemm_ip_gemm_conf_t gemm_ {};
+        brgemm_desc_t brg_descs_
+                [brgemm_inner_product_utils::max_num_brg_kernels_ip];
+        // Diff weights are stored as [IC, OC], so they are computed as
+        // src^T * diff_dst with a transposed copy of src. Otherwise they are
+        // computed as diff_dst^T * src with a transposed copy of diff_dst.
+        bool wei_trans_ = false;
+    };
+
+    brgemm_inner_product_bwd_weights_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t>
+            brg_kernels_[brgemm_inner_product_utils::max_num_brg_kernels_ip];
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
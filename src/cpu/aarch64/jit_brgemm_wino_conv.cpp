@@ -0,0 +1,444 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/aarch64/jit_brgemm_wino_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::utils;
+using namespace memory_tracking::names;
+
+namespace {
+// F(4x4, 3x3): 4x4 output points are computed from 6x6 input points
+constexpr int alpha = 6;
+constexpr int tile_size = 4;
+constexpr int n_points = alpha * alpha;
+
+// Channels processed at once by the transforms, the temporaries of one
+// chunk stay in registers and L1
+constexpr dim_t c_chunk = 16;
+
+constexpr dim_t tile_blk_max = 64;
+constexpr dim_t tile_blk_min = 4;
+constexpr dim_t n_blk_default = 64;
+
+// Filter transform matrix G (6x3)
+constexpr float G[alpha][3] = {{1.f / 4, 0.f, 0.f},
+        {-1.f / 6, -1.f / 6, -1.f / 6}, {-1.f / 6, 1.f / 6, -1.f / 6},
+        {1.f / 24, 1.f / 12, 1.f / 6}, {1.f / 24, -1.f / 12, 1.f / 6},
+        {0.f, 0.f, 1.f}};
+
+// out = B^T * in, applied to n channels at a time
+inline void bt_1d(const float *const in[alpha], float *const out[alpha],
+        dim_t n) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t c = 0; c < n; ++c) {
+        const float d0 = in[0][c], d1 = in[1][c], d2 = in[2][c];
+        const float d3 = in[3][c], d4 = in[4][c], d5 = in[5][c];
+        out[0][c] = 4.f * d0 - 5.f * d2 + d4;
+        out[1][c] = -4.f * (d1 + d2) + d3 + d4;
+        out[2][c] = 4.f * (d1 - d2) - d3 + d4;
+        out[3][c] = 2.f * (d3 - d1) - d2 + d4;
+        out[4][c] = 2.f * (d1 - d3) - d2 + d4;
+        out[5][c] = 4.f * d1 - 5.f * d3 + d5;
+    }
+}
+
+// out = A^T * in, applied to n channels at a time
+inline void at_1d(const float *const in[alpha], float *const out[tile_size],
+        dim_t n) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t c = 0; c < n; ++c) {
+        const float m0 = in[0][c], m1 = in[1][c], m2 = in[2][c];
+        const float m3 = in[3][c], m4 = in[4][c], m5 = in[5][c];
+        const float s12 = m1 + m2, d12 = m1 - m2;
+        const float s34 = m3 + m4, d34 = m3 - m4;
+        out[0][c] = m0 + s12 + s34;
+        out[1][c] = d12 + 2.f * d34;
+        out[2][c] = s12 + 4.f * s34;
+        out[3][c] = d12 + 8.f * d34 + m5;
+    }
+}
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+
+    VDISPATCH_CONV(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    // Winograd has a lower accuracy than direct convolution, so it is only
+    // used when explicitly requested.
+    VDISPATCH_CONV(desc()->alg_kind == alg_kind::convolution_winograd,
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(expect_data_types(f32, f32, f32, f32, data_type::undef),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_CONV(attr()->has_default_values(
+                           primitive_attr_t::skip_mask_t::post_ops, f32),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(ref_post_ops_t::post_ops_ok(attr()->post_ops_),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(ndims() == 4, VERBOSE_BAD_NDIMS, "src", ndims());
+    VDISPATCH_CONV(!with_groups(), VERBOSE_UNSUPPORTED_FEATURE, "groups");
+    VDISPATCH_CONV(KH() == 3 && KW() == 3, VERBOSE_UNSUPPORTED_FEATURE,
+            "only 3x3 kernel is supported for winograd");
+    VDISPATCH_CONV(KSH() == 1 && KSW() == 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "only stride 1 is supported for winograd");
+    VDISPATCH_CONV(KDH() == 0 && KDW() == 0, VERBOSE_UNSUPPORTED_FEATURE,
+            "dilation is not supported for winograd");
+    VDISPATCH_CONV(set_default_formats_common(nhwc, oihw, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(memory_desc_matches_tag(src_md_, nhwc)
+                    && memory_desc_matches_tag(dst_md_, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(is_dense_format_kind({src_md(), weights_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    CHECK(init_conf());
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init_conf() {
+    auto &c = conf_;
+    c.mb = MB();
+    c.ic = IC();
+    c.oc = OC();
+    c.ih = IH();
+    c.iw = IW();
+    c.oh = OH();
+    c.ow = OW();
+    c.t_pad = padT();
+    c.l_pad = padL();
+    c.with_bias = with_bias();
+    c.with_post_ops = attr()->post_ops_.len() > 0;
+
+    c.nb_th = div_up(c.oh, tile_size);
+    c.nb_tw = div_up(c.ow, tile_size);
+    c.nb_tiles = c.nb_th * c.nb_tw;
+
+    // Keep the transformed src and dst of a tiles block in L2, but use
+    // smaller blocks when there is not enough work for all the threads.
+    const int max_nthr = dnnl_get_max_threads();
+    const dim_t tile_bytes = n_points * (c.ic + c.oc) * sizeof(float);
+    const dim_t l2_size = platform::get_per_core_cache_size(2);
+    c.tile_blk
+            = saturate(tile_blk_min, tile_blk_max, l2_size / 2 / tile_bytes);
+    while (c.tile_blk > tile_blk_min
+            && c.mb * div_up(c.nb_tiles, c.tile_blk) < max_nthr)
+        c.tile_blk /= 2;
+    c.tile_blk = nstl::min(c.tile_blk, c.nb_tiles);
+    c.nb_tile_blk = div_up(c.nb_tiles, c.tile_blk);
+    c.tile_tail = c.nb_tiles % c.tile_blk;
+
+    c.n_blk = nstl::min(c.oc, n_blk_default);
+    c.nb_n = div_up(c.oc, c.n_blk);
+    c.n_tail = c.oc % c.n_blk;
+
+    c.nthr = static_cast<int>(
+            nstl::min<dim_t>(max_nthr, c.mb * c.nb_tile_blk));
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init_brgemm_descs() {
+    using namespace data_type;
+    const auto &c = conf_;
+
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+
+    // One GEMM per Winograd point: [tiles, IC] x [IC, OC] -> [tiles, OC]
+    for (bool m_tail : {false, true})
+        for (bool n_tail : {false, true}) {
+            const dim_t M = m_tail ? c.tile_tail : c.tile_blk;
+            const dim_t N = n_tail ? c.n_tail : c.n_blk;
+            if (M == 0 || N == 0) continue;
+
+            auto &brg = brg_descs_[get_brg_idx(m_tail, n_tail)];
+            CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, f32, f32, false,
+                    false, brgemm_row_major, 1.f, 0.f, c.ic, c.oc, c.oc, M, N,
+                    c.ic));
+            CHECK(brgemm_desc_set_attr(&brg, brgattr));
+            CHECK(brgemm_desc_finalize(&brg));
+        }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(key_wino_U, n_points * c.ic * c.oc);
+    scratchpad.template book<float>(
+            key_wino_V, c.nthr * n_points * c.tile_blk * c.ic);
+    scratchpad.template book<float>(
+            key_wino_M, c.nthr * n_points * c.tile_blk * c.oc);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::init(engine_t *engine) {
+    const auto &c = pd()->conf_;
+    for (bool m_tail : {false, true})
+        for (bool n_tail : {false, true}) {
+            const dim_t M = m_tail ? c.tile_tail : c.tile_blk;
+            const dim_t N = n_tail ? c.n_tail : c.n_blk;
+            if (M == 0 || N == 0) continue;
+
+            const int idx = pd_t::get_brg_idx(m_tail, n_tail);
+            brgemm_kernel_t *ker = nullptr;
+            CHECK(brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
+            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        }
+
+    if (c.with_post_ops) {
+        ref_post_ops_
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops_) return status::out_of_memory;
+        CHECK(ref_post_ops_->init(pd()->dst_md()));
+    }
+    return status::success;
+}
+
+// U[point][ic][oc] = (G * g * G^T)[point]
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::transform_weights(
+        const float *wei, float *U) const {
+    const auto &c = pd()->conf_;
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+
+    parallel_nd(c.oc, c.ic, [&](dim_t oc, dim_t ic) {
+        float g[3][3];
+        for_(int h = 0; h < 3; ++h)
+        for (int w = 0; w < 3; ++w)
+            g[h][w] = wei[wei_d.off(oc, ic, h, w)];
+
+        float tmp[alpha][3];
+        for_(int i = 0; i < alpha; ++i)
+        for (int w = 0; w < 3; ++w)
+            tmp[i][w] = G[i][0] * g[0][w] + G[i][1] * g[1][w]
+                    + G[i][2] * g[2][w];
+
+        for_(int i = 0; i < alpha; ++i)
+        for (int j = 0; j < alpha; ++j) {
+            const float u = tmp[i][0] * G[j][0] + tmp[i][1] * G[j][1]
+                    + tmp[i][2] * G[j][2];
+            U[((i * alpha + j) * c.ic + ic) * c.oc + oc] = u;
+        }
+    });
+}
+
+// V[point][tile][ic] = (B^T * d * B)[point] for every tile of the block
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::transform_src(const float *src_img,
+        float *V, dim_t tile_start, dim_t n_tiles) const {
+    const auto &c = pd()->conf_;
+    const float zero[c_chunk] = {0.f};
+
+    for (dim_t t = 0; t < n_tiles; ++t) {
+        const dim_t tile = tile_start + t;
+        const dim_t iy0 = (tile / c.nb_tw) * tile_size - c.t_pad;
+        const dim_t ix0 = (tile % c.nb_tw) * tile_size - c.l_pad;
+
+        for (dim_t c0 = 0; c0 < c.ic; c0 += c_chunk) {
+            const dim_t cb = nstl::min(c_chunk, c.ic - c0);
+            // Rows of the tile transformed by B^T, stored column-wise
+            float tmp[alpha][alpha][c_chunk];
+
+            for (int j = 0; j < alpha; ++j) {
+                const dim_t ix = ix0 + j;
+                const float *in[alpha];
+                float *out[alpha];
+                for (int k = 0; k < alpha; ++k) {
+                    const dim_t iy = iy0 + k;
+                    const bool is_pad = iy < 0 || iy >= c.ih || ix < 0
+                            || ix >= c.iw;
+                    in[k] = is_pad ? zero
+                                   : src_img + (iy * c.iw + ix) * c.ic + c0;
+                    out[k] = tmp[k][j];
+                }
+                bt_1d(in, out, cb);
+            }
+
+            for (int i = 0; i < alpha; ++i) {
+                const float *in[alpha];
+                float *out[alpha];
+                for (int k = 0; k < alpha; ++k) {
+                    in[k] = tmp[i][k];
+                    out[k] = V + ((i * alpha + k) * c.tile_blk + t) * c.ic
+                            + c0;
+                }
+                bt_1d(in, out, cb);
+            }
+        }
+    }
+}
+
+// dst = A^T * M * A + bias, followed by the post-ops
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::transform_dst(const exec_ctx_t &ctx,
+        const float *M, const float *bias, float *dst, dim_t img,
+        dim_t tile_start, dim_t n_tiles) const {
+    const auto &c = pd()->conf_;
+    float *dst_img = dst + img * c.oh * c.ow * c.oc;
+
+    for (dim_t t = 0; t < n_tiles; ++t) {
+        const dim_t tile = tile_start + t;
+        const dim_t oy0 = (tile / c.nb_tw) * tile_size;
+        const dim_t ox0 = (tile % c.nb_tw) * tile_size;
+
+        for (dim_t c0 = 0; c0 < c.oc; c0 += c_chunk) {
+            const dim_t cb = nstl::min(c_chunk, c.oc - c0);
+            float tmp[tile_size][alpha][c_chunk];
+
+            for (int l = 0; l < alpha; ++l) {
+                const float *in[alpha];
+                float *out[tile_size];
+                for (int k = 0; k < alpha; ++k)
+                    in[k] = M + ((k * alpha + l) * c.tile_blk + t) * c.oc + c0;
+                for (int i = 0; i < tile_size; ++i)
+                    out[i] = tmp[i][l];
+                at_1d(in, out, cb);
+            }
+
+            for (int i = 0; i < tile_size; ++i) {
+                const dim_t oy = oy0 + i;
+                if (oy >= c.oh) break;
+
+                float res[tile_size][c_chunk];
+                const float *in[alpha];
+                float *out[tile_size];
+                for (int k = 0; k < alpha; ++k)
+                    in[k] = tmp[i][k];
+                for (int j = 0; j < tile_size; ++j)
+                    out[j] = res[j];
+                at_1d(in, out, cb);
+
+                for (int j = 0; j < tile_size; ++j) {
+                    const dim_t ox = ox0 + j;
+                    if (ox >= c.ow) break;
+
+                    float *d = dst_img + (oy * c.ow + ox) * c.oc + c0;
+                    if (c.with_bias) {
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t cc = 0; cc < cb; ++cc)
+                            res[j][cc] += bias[c0 + cc];
+                    }
+                    if (c.with_post_ops) {
+                        for (dim_t cc = 0; cc < cb; ++cc) {
+                            ref_post_ops_t::args_t args;
+                            args.dst_val = d[cc];
+                            args.ctx = &ctx;
+                            args.l_offset
+                                    = ((img * c.oc + c0 + cc) * c.oh + oy)
+                                            * c.ow
+                                    + ox;
+                            args.dst_md = pd()->dst_md();
+                            ref_post_ops_->execute(res[j][cc], args);
+                        }
+                    }
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t cc = 0; cc < cb; ++cc)
+                        d[cc] = res[j][cc];
+                }
+            }
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+
+    const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *U = scratchpad.template get<float>(key_wino_U);
+    float *V_base = scratchpad.template get<float>(key_wino_V);
+    float *M_base = scratchpad.template get<float>(key_wino_M);
+
+    transform_weights(wei, U);
+
+    const dim_t work_amount = c.mb * c.nb_tile_blk;
+    parallel(c.nthr, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+
+        float *V = V_base + ithr * n_points * c.tile_blk * c.ic;
+        float *M = M_base + ithr * n_points * c.tile_blk * c.oc;
+
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t img = iwork / c.nb_tile_blk;
+            const dim_t tile_start = (iwork % c.nb_tile_blk) * c.tile_blk;
+            const dim_t n_tiles
+                    = nstl::min(c.tile_blk, c.nb_tiles - tile_start);
+            const bool is_m_tail = n_tiles < c.tile_blk;
+
+            transform_src(src + img * c.ih * c.iw * c.ic, V, tile_start,
+                    n_tiles);
+
+            for_(int p = 0; p < n_points; ++p)
+            for (dim_t in = 0; in < c.nb_n; ++in) {
+                const dim_t n_start = in * c.n_blk;
+                const bool is_n_tail = c.oc - n_start < c.n_blk;
+                const int brg_idx = pd_t::get_brg_idx(is_m_tail, is_n_tail);
+
+                brgemm_batch_element_t batch;
+                batch.ptr.A = V + p * c.tile_blk * c.ic;
+                batch.ptr.B = U + p * c.ic * c.oc + n_start;
+                brgemm_kernel_execute(brg_kernels_[brg_idx].get(), 1, &batch,
+                        M + p * c.tile_blk * c.oc + n_start);
+            }
+
+            transform_dst(ctx, M, bias, dst, img, tile_start, n_tiles);
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_wino_convolution_fwd_t<sve_512>;
+template struct brgemm_wino_convolution_fwd_t<sve_256>;
+template struct brgemm_wino_convolution_fwd_t<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_BRGEMM_WINO_CONV_HPP
+#define CPU_AARCH64_JIT_BRGEMM_WINO_CONV_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/aarch64/brgemm/brgemm.hpp"
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct brgemm_wino_conf_t {
+    dim_t mb, ic, oc;
+    dim_t ih, iw, oh, ow;
+    dim_t t_pad, l_pad;
+
+    // Output tiles of 4x4 points per image
+    dim_t nb_th, nb_tw, nb_tiles;
+    // Number of tiles transformed and multiplied at once by a thread
+    dim_t tile_blk, nb_tile_blk, tile_tail;
+    // Output channels blocking of the brgemm kernels
+    dim_t n_blk, nb_n, n_tail;
+
+    bool with_bias;
+    bool with_post_ops;
+    int nthr;
+};
+
+/// Winograd F(4x4, 3x3) convolution for nhwc activations.
+///
+/// The 6x6 input tiles of a block of output tiles are transformed into a
+/// [36][tile_blk][IC] buffer, which is multiplied by the transformed weights
+/// [36][IC][OC] with brgemm kernels, one GEMM per Winograd point. The output
+/// transform then applies bias and post-ops while the result is stored to
+/// the destination, so no extra pass over dst is needed.
+template <cpu_isa_t isa>
+struct brgemm_wino_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgconv_wino:", isa, ""),
+                brgemm_wino_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernel index for a (tiles tail, output channels tail) combination
+        static int get_brg_idx(bool m_tail, bool n_tail) {
+            return 2 * static_cast<int>(m_tail) + static_cast<int>(n_tail);
+        }
+
+        brgemm_wino_conf_t conf_ {};
+        brgemm_desc_t brg_descs_[4];
+
+    private:
+        status_t init_conf();
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_wino_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    void transform_weights(const float *wei, float *U) const;
+    void transform_src(const float *src_img, float *V, dim_t tile_start,
+            dim_t n_tiles) const;
+    void transform_dst(const exec_ctx_t &ctx, const float *M,
+            const float *bias, float *dst, dim_t img, dim_t tile_start,
+            dim_t n_tiles) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[4];
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
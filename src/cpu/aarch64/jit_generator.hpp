@@ -20,6 +20,7 @@
 #define CPU_AARCH64_JIT_GENERATOR_HPP
 
 #include <limits.h>
+#include <string>
 #include <vector>
 
 #include "common/type_helpers.hpp"
@@ -195,6 +196,9 @@ public:
         using namespace Xbyak_aarch64::util;
         uint64_t sveLen = get_sve_length();
 
+        // Profilers are given unwinding information for the frame record
+        // when the kernel starts with it.
+        if (getSize() == 0) has_frame_record_ = true;
         stp(x29, x30, pre_ptr(sp, -16));
         /* x29 is a frame pointer. */
         mov(x29, sp);
@@ -907,9 +911,16 @@ public:
 
     virtual const char *name() const = 0;
     virtual const char *source_file() const = 0;
+    // Configuration of the kernel, e.g. its blocking, appended to name() in
+    // the symbols reported to profilers to tell the kernels apart.
+    virtual std::string code_name_suffix() const { return std::string(); }
 
     void register_jit_code(const uint8_t *code, size_t code_size) const {
-        jit_utils::register_jit_code(code, code_size, name(), source_file());
+        std::string code_name(name());
+        const std::string suffix = code_name_suffix();
+        if (!suffix.empty()) code_name += "_" + suffix;
+        jit_utils::register_jit_code(code, code_size, code_name.c_str(),
+                source_file(), has_frame_record_);
     }
 
     const uint8_t *jit_ker() const { return jit_ker_; }
@@ -929,6 +940,7 @@ public:
 
 private:
     const cpu_isa_t max_cpu_isa_;
+    bool has_frame_record_ = false;
     const uint8_t *getCode() {
         this->ready();
         if (!is_initialized()) return nullptr;
@@ -19,6 +19,7 @@
 #ifndef CPU_AARCH64_JIT_PRIMITIVE_CONF_HPP
 #define CPU_AARCH64_JIT_PRIMITIVE_CONF_HPP
 
+#include <queue>
 #include <stdint.h>
 
 #include "common/primitive_attr.hpp"
@@ -527,6 +528,7 @@ struct jit_uni_shuffle_args_t {
 
     dim_t cb_loop_size
             = 0; // number of loop iterations over corresponding C batches
+    dim_t sp_loop_size = 0; // number of spatial points for nspc layouts
     bool is_padded_block = false;
 };
 
@@ -654,6 +656,7 @@ struct jit_brgemm_conv_conf_t {
     // strides for brg_type == brgemm_strd
     dim_t brg_stride_a, brg_stride_b;
     int nthr;
+    dispatch_goal_t dispatch_goal;
 
     int max_batch;
     int max_vpad;
@@ -744,6 +747,123 @@ struct jit_uni_binary_args_t {
     const void *dst_orig;
 };
 
+/* reduction */
+// The src tensor is viewed as [idle_size][reduce_size][inner_size] and the
+// dst tensor as [idle_size][inner_size], inner_size is 1 for plain layouts
+// reduced over the trailing dimensions.
+struct jit_reduction_conf_t {
+    data_type_t src_type = data_type::undef;
+    data_type_t dst_type = data_type::undef;
+
+    std::size_t src_dt_size = 0;
+    std::size_t dst_dt_size = 0;
+
+    alg_kind_t alg = alg_kind::undef;
+    cpu_isa_t isa = isa_undef;
+
+    dim_t idle_size = 0;
+    dim_t reduce_size = 0;
+    dim_t inner_size = 1;
+    // inner_size is split into blocks of inner_block elements processed by
+    // a single kernel call, the last one may be shorter
+    dim_t inner_block = 1;
+    dim_t inner_nblocks = 1;
+
+    bool is_saturation_needed = false;
+
+    post_ops_t post_ops;
+    bool with_postops = false;
+    bool with_eltwise = false;
+    bool with_binary = false;
+    bool with_sum = false;
+    std::queue<float> sum_scales;
+};
+
+struct jit_uni_reduction_args_t {
+    const void *src = nullptr;
+    void *dst = nullptr;
+    const void *post_ops_binary_rhs_arg_vec = nullptr;
+    const void *dst_orig = nullptr;
+    size_t is_last_block = 0;
+};
+
+struct jit_resampling_conf_t {
+    unsigned ndims = 0;
+
+    unsigned c = 0;
+    unsigned id = 0, ih = 0, iw = 0;
+    unsigned od = 0, oh = 0, ow = 0;
+
+    unsigned stride_d = 0;
+    unsigned stride_h = 0;
+    unsigned stride_w = 0;
+    unsigned inner_stride = 0;
+
+    // The linear algorithm interpolates between 2, 4 or 8 corners of the
+    // input for 1D, 2D and 3D spatial respectively.
+    unsigned number_of_corners = 0;
+
+    bool is_saturation_needed = false;
+    data_type_t src_data_type = data_type::undef;
+    data_type_t dst_data_type = data_type::undef;
+    size_t src_dt_size = 0;
+    size_t dst_dt_size = 0;
+
+    format_tag_t src_tag = format_tag::undef;
+    jit_memory_tag_kind_t tag_kind = jit_memory_tag_kind_t::undef;
+    alg_kind_t alg = alg_kind::undef;
+
+    cpu_isa_t isa = isa_undef;
+
+    post_ops_t post_ops;
+    bool with_postops = false;
+    bool with_eltwise = false;
+    bool with_binary = false;
+    bool with_sum = false;
+    std::queue<float> sum_scales;
+};
+
+struct jit_uni_resampling_args_t {
+    size_t batch_of_sp_points_to_process = 0;
+
+    const void *src = nullptr;
+    const void *dst = nullptr;
+    const void *indices = nullptr;
+    const void *weights = nullptr;
+    const void *post_ops_binary_rhs_arg_vec = nullptr;
+    const void *dst_orig = nullptr;
+
+    size_t src_offset_top = 0;
+    size_t src_offset_bottom = 0;
+    size_t src_offset_front = 0;
+    size_t src_offset_back = 0;
+
+    float weight_top = 0.0f;
+    float weight_bottom = 0.0f;
+    float weight_front = 0.0f;
+    float weight_back = 0.0f;
+};
+
+// Contribution of a diff_dst point to a diff_src point along one spatial
+// dimension: the byte offset of the diff_dst point along that dimension and
+// the interpolation weight it was computed with.
+struct jit_resampling_bwd_entry_t {
+    unsigned offset = 0;
+    float weight = 0.0f;
+};
+
+struct jit_uni_resampling_bwd_args_t {
+    const void *diff_dst = nullptr;
+    void *diff_src = nullptr;
+
+    const void *entries_d = nullptr;
+    const void *entries_h = nullptr;
+    const void *entries_w = nullptr;
+    size_t n_entries_d = 0;
+    size_t n_entries_h = 0;
+    size_t n_entries_w = 0;
+};
+
 } // namespace aarch64
 } // namespace cpu
 } // namespace impl
@@ -134,6 +134,7 @@ void jit_sve_1x1_convolution_fwd_t<src_type, wei_type, dst_type,
             jcp.dst_tag, format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
     const bool is_src_layout_nxc = utils::one_of(
             jcp.src_tag, format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
+    const bool zero_pad_dst = pd()->zero_pads_dst();
 
     // Begin: declare Variables needed for dw conv.
     memory_tracking::grantor_t dw_scratchpad(
@@ -224,6 +225,14 @@ void jit_sve_1x1_convolution_fwd_t<src_type, wei_type, dst_type,
         p.dst_orig = dst;
 
         (*kernel_)(&p);
+
+        // the padded channels are zeroed while the dst points are in cache
+        if (zero_pad_dst && (p.first_last_flag & FLAG_REDUCE_LAST)
+                && ocb * jcp.oc_block + p.load_dim
+                        >= (size_t)jcp.oc_without_padding) {
+            const dim_t os = ((dim_t)od * jcp.oh + oh) * jcp.ow + ow;
+            pd()->zero_pad_dst_channels(dst, n, os, os + p.bcast_dim);
+        }
     };
     auto conv_1x1
             = [&](int bcast_start, int bcast_end, int ocb_start, int ocb_end) {
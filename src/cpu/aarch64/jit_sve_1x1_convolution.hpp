@@ -87,6 +87,10 @@ struct jit_sve_1x1_convolution_fwd_t : public primitive_t {
 
             rtus_prepare_space_info(this, scratchpad, jcp_.nthr);
 
+            zero_pads_dst_ = !jcp_.with_dw_conv && jcp_.ngroups == 1
+                    && !utils::one_of(jcp_.dst_tag, format_tag::nwc,
+                            format_tag::nhwc, format_tag::ndhwc);
+
             return status::success;
         }
 
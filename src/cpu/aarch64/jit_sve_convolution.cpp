@@ -178,6 +178,51 @@ void jit_sve_convolution_fwd_t<src_type, wei_type, dst_type,
     bias = padded_bias;
 }
 
+template <data_type_t src_type, data_type_t wei_type, data_type_t dst_type,
+        cpu_isa_t isa>
+void jit_sve_convolution_fwd_t<src_type, wei_type, dst_type,
+        isa>::zero_pad_dst_thr(dst_data_t *dst, int start, int end) const {
+    // Walks the work items [start, end) of a thread in the same order as the
+    // execute functions and zeroes the padded channels of the dst points the
+    // thread has just written. Spatial dimensions a convolution doesn't have
+    // are of size 1 in jcp, so one decomposition covers 1D, 2D and 3D.
+    const auto &jcp = pd()->jcp_;
+    const int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
+    const int nb_groups = jcp.ngroups;
+    int n {0}, gg {0}, occ {0}, od {0}, oh {0}, owb {0};
+
+    if (jcp.loop_order == loop_cwgn)
+        nd_iterator_init(start, occ, oc_chunks, owb, jcp.nb_ow, gg, nb_groups,
+                n, jcp.mb, od, jcp.od, oh, jcp.oh);
+    else if (jcp.loop_order == loop_gncw)
+        nd_iterator_init(start, gg, nb_groups, n, jcp.mb, occ, oc_chunks, owb,
+                jcp.nb_ow, od, jcp.od, oh, jcp.oh);
+    else if (jcp.loop_order == loop_nhwcg)
+        nd_iterator_init(start, n, jcp.mb, od, jcp.od, oh, jcp.oh, owb,
+                jcp.nb_ow, occ, oc_chunks, gg, nb_groups);
+    else
+        assert(!"unsupported loop order");
+
+    for (int iwork = start; iwork < end; ++iwork) {
+        if (occ == oc_chunks - 1 && gg == nb_groups - 1) {
+            const dim_t row = ((dim_t)od * jcp.oh + oh) * jcp.ow;
+            const int ow_s = owb * jcp.ow_block;
+            const int ow_e = nstl::min(jcp.ow, ow_s + jcp.ow_block);
+            pd()->zero_pad_dst_channels(dst, n, row + ow_s, row + ow_e);
+        }
+
+        if (jcp.loop_order == loop_cwgn)
+            nd_iterator_step(occ, oc_chunks, owb, jcp.nb_ow, gg, nb_groups, n,
+                    jcp.mb, od, jcp.od, oh, jcp.oh);
+        else if (jcp.loop_order == loop_gncw)
+            nd_iterator_step(gg, nb_groups, n, jcp.mb, occ, oc_chunks, owb,
+                    jcp.nb_ow, od, jcp.od, oh, jcp.oh);
+        else
+            nd_iterator_step(n, jcp.mb, od, jcp.od, oh, jcp.oh, owb, jcp.nb_ow,
+                    occ, oc_chunks, gg, nb_groups);
+    }
+}
+
 template <data_type_t src_type, data_type_t wei_type, data_type_t dst_type,
         cpu_isa_t isa>
 void jit_sve_convolution_fwd_t<src_type, wei_type, dst_type,
@@ -300,6 +345,8 @@ void jit_sve_convolution_fwd_t<src_type, wei_type, dst_type,
         // with nullptr, other parameters are not used in real jit call here
         jit_conv_ker_pipeline_ow_thr(
                 jit_ker, par_conv, src, dst, weights, bias, 0, 0, 0, 0, 0, 0);
+
+        if (pd()->zero_pads_dst()) zero_pad_dst_thr(dst, start_copy, end);
     });
 }
 
@@ -460,6 +507,8 @@ void jit_sve_convolution_fwd_t<src_type, wei_type, dst_type,
         // with nullptr, other parameters are not used in real jit call here
         jit_conv_ker_pipeline_ow_thr(
                 jit_ker, par_conv, src, dst, weights, bias, 0, 0, 0, 0, 0, 0);
+
+        if (pd()->zero_pads_dst()) zero_pad_dst_thr(dst, start_copy, end);
     });
 }
 
@@ -625,6 +674,8 @@ void jit_sve_convolution_fwd_t<src_type, wei_type, dst_type,
         // with nullptr, other parameters are not used in real jit call here
         jit_sve_conv_3d_ker_pipeline_ow_thr(jit_ker, par_conv, src, dst,
                 weights, bias, 0, 0, 0, 0, 0, 0, 0);
+
+        if (pd()->zero_pads_dst()) zero_pad_dst_thr(dst, start_copy, end);
     });
 }
 
@@ -71,6 +71,10 @@ struct jit_sve_convolution_fwd_t : public primitive_t {
             auto scratchpad = scratchpad_registry().registrar();
             jit_sve_conv_fwd_kernel_t<isa>::init_scratchpad(scratchpad, jcp_);
 
+            zero_pads_dst_ = jcp_.ngroups == 1
+                    && !utils::one_of(jcp_.dst_tag, format_tag::nwc,
+                            format_tag::nhwc, format_tag::ndhwc);
+
             return status;
         }
 
@@ -110,6 +114,7 @@ private:
     void execute_forward_1d(const exec_ctx_t &ctx) const;
     void execute_forward_2d(const exec_ctx_t &ctx) const;
     void execute_forward_3d(const exec_ctx_t &ctx) const;
+    void zero_pad_dst_thr(dst_data_t *dst, int start, int end) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<jit_sve_conv_fwd_kernel_t<isa>> kernel_;
@@ -70,6 +70,13 @@ bool is_nspc(const memory_desc_wrapper &d) {
     const bool is_nspc = d.matches_one_of_tag(nc, nwc, nhwc, ndhwc);
     return is_nspc;
 }
+
+// Forward nspc statistics are computed in a single pass over src: the sums
+// and the sums of squares are accumulated together.
+bool use_single_pass_stats(const batch_normalization_pd_t *pd) {
+    return pd->is_fwd() && !pd->stats_is_src()
+            && is_nspc(memory_desc_wrapper(pd->src_md()));
+}
 } // namespace
 
 struct jit_bnorm_conf_t {
@@ -80,6 +87,7 @@ struct jit_bnorm_conf_t {
     int simd_w_ {0};
     size_t dt_size_ {0};
     bool is_nspc_ {false};
+    bool single_pass_stats_ {false};
 
     // thread partition info
     bool do_blocking_ {false};
@@ -95,10 +103,15 @@ struct jit_bnorm_conf_t {
     int N_nthr_last_iter_ {0};
     int S_nthr_last_iter_ {0};
 
-    jit_bnorm_conf_t(const batch_normalization_pd_t *pd, int nthr, int simd_w)
+    // threads of the parallel section may be synchronized with barriers
+    bool syncable_ {false};
+
+    jit_bnorm_conf_t(const batch_normalization_pd_t *pd, int nthr, int simd_w,
+            bool syncable)
         : pd_(pd)
         , simd_w_(simd_w)
-        , dt_size_(types::data_type_size(pd_->src_md()->data_type)) {
+        , dt_size_(types::data_type_size(pd_->src_md()->data_type))
+        , syncable_(syncable) {
 
         const dim_t N = pd_->MB();
         const dim_t C_PADDED = get_c_padded(pd_);
@@ -109,6 +122,7 @@ struct jit_bnorm_conf_t {
 
         const memory_desc_wrapper src_d(pd_->src_md());
         is_nspc_ = is_nspc(src_d);
+        single_pass_stats_ = use_single_pass_stats(pd_);
 
         size_t data_size = dt_size_ * N * C_PADDED * SP;
         const size_t l3_size = platform::get_per_core_cache_size(3) * nthr;
@@ -159,7 +173,7 @@ struct jit_bnorm_conf_t {
 
         if ((((nthr <= C_blks) && IMPLICATION(is_nspc_, N == 1)
                      && !force_sve128_spatial)
-                    || !dnnl_thr_syncable())) {
+                    || !syncable_)) {
             C_nthr = nthr;
             N_nthr = 1;
             S_nthr = 1;
@@ -243,6 +257,7 @@ struct jit_bnorm_t : public jit_generator_t {
         const acc_data_t *rbuf1, *rbuf2;
         const uint8_t *ws;
         barrier::ctx_64_t *barrier;
+        const void *src_shift;
     };
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_bnorm_t)
@@ -350,7 +365,9 @@ struct jit_bnorm_t : public jit_generator_t {
         stack_off_diff_shift = 120,
         stack_off_soff_max = 128,
         stack_off_relu_alpha = 136,
-        stack_size_required = 144,
+        stack_off_src_shift = 144,
+        stack_off_coff_max_copy = 152,
+        stack_size_required = 160,
     };
 
     bool is_xf16() { return is_bf16_ || is_f16_; }
@@ -390,7 +407,8 @@ struct jit_bnorm_t : public jit_generator_t {
     }
 
         LDR_PARAM(reg_rbuf1, rbuf1);
-        if (!pd_->is_fwd()) LDR_PARAM(reg_rbuf2, rbuf2);
+        if (!pd_->is_fwd() || jbp_->single_pass_stats_)
+            LDR_PARAM(reg_rbuf2, rbuf2);
 
         LDR_PARAM(reg_coff_max, coff_max);
         LDR_PARAM(reg_soff_max, soff_max);
@@ -425,6 +443,10 @@ struct jit_bnorm_t : public jit_generator_t {
         STR_PARAM(X_TMP_0, stack_off_ws);
         LDR_PARAM(X_TMP_0, barrier);
         STR_PARAM(X_TMP_0, stack_off_barrier);
+        if (jbp_->single_pass_stats_) {
+            LDR_PARAM(X_TMP_0, src_shift);
+            STR_PARAM(X_TMP_0, stack_off_src_shift);
+        }
         if (jbp_->is_spatial_thr_) {
             LDR_PARAM(X_TMP_0, spat_size_loc);
             STR_PARAM(X_TMP_0, stack_off_spat_size_loc);
@@ -981,6 +1003,198 @@ struct jit_bnorm_t : public jit_generator_t {
         if (is_xf16()) lsl(reg_coff_max, reg_coff_max, 1);
     }
 
+    // The data is shifted by the first point of the batch before the sums in
+    // rbuf1 and the sums of squares in rbuf2 are accumulated, which keeps
+    // E[x^2] - E[x]^2 clear of cancellation when the mean is large.
+    void mean_variance_nspc_single_pass(
+            const int num_ch_blks, int num_spat_pts) {
+        auto vsum = [=](int idx) { return TReg(idx); };
+        auto vsqr = [=](int idx) { return TReg(idx + num_ch_blks); };
+        auto vpivot = [=](int idx) { return TReg(idx + 2 * num_ch_blks); };
+        auto chan_addr = [=](const XReg &base, int coff) {
+            add(X_TMP_0, base, reg_coff);
+            if (coff) add_imm(X_TMP_0, X_TMP_0, coff, X_TMP_1);
+            return X_TMP_0;
+        };
+
+        LDR_ASSERT(X_TMP_2, sp, (int)stack_off_src_shift);
+        for (int idx = 0; idx < num_ch_blks; ++idx) {
+            const int coff = idx * vlen;
+            uni_ldr(vsum(idx), chan_addr(reg_rbuf1, coff));
+            uni_ldr(vsqr(idx), chan_addr(reg_rbuf2, coff));
+            uni_load_spat_data(vpivot(idx), chan_addr(X_TMP_2, coff));
+        }
+
+        eor(reg_soff_nspc, reg_soff_nspc, reg_soff_nspc);
+
+        if (jbp_->is_spatial_thr_) {
+            LDR_ASSERT(reg_ctr, sp, (int)stack_off_spat_size_loc);
+            LDR_ASSERT(X_TMP_0, sp, (int)stack_off_s_s);
+            add(reg_soff_nspc, reg_soff_nspc, X_TMP_0);
+            num_spat_pts = 1;
+        } else {
+            mov_imm(reg_ctr, (int)spat_size);
+            num_spat_pts = nstl::min((size_t)num_spat_pts, spat_size);
+            if (spat_size % num_spat_pts != 0) num_spat_pts = 1;
+        }
+
+        Label spatial;
+        L(spatial);
+        {
+            const TRegS vsrc = t_tmp0.s;
+            for (int spat_pt = 0; spat_pt < num_spat_pts; ++spat_pt) {
+                add(X_TMP_0, reg_src, reg_soff_nspc);
+                for (int ch_idx = 0; ch_idx < num_ch_blks; ++ch_idx) {
+                    if (ch_idx)
+                        add_imm(X_TMP_0, X_TMP_0, vlen_spat_data_, X_TMP_1);
+                    uni_load_spat_data(t_tmp0, X_TMP_0);
+                    uni_fsub(vsrc, vsrc, vpivot(ch_idx).s);
+                    fadd(vsum(ch_idx).s, vsum(ch_idx).s, vsrc);
+                    uni_fmla(vsqr(ch_idx).s, vsrc, vsrc);
+                }
+                add_imm(reg_soff_nspc, reg_soff_nspc, (int)spat_step, X_TMP_0);
+            }
+            subs_imm(reg_ctr, reg_ctr, num_spat_pts, X_TMP_0);
+            b(NE, spatial);
+        }
+
+        for (int idx = 0; idx < num_ch_blks; ++idx) {
+            const int coff = idx * vlen;
+            uni_str(vsum(idx), chan_addr(reg_rbuf1, coff));
+            uni_str(vsqr(idx), chan_addr(reg_rbuf2, coff));
+        }
+    }
+
+    void compute_mean_variance_nspc_single_pass() {
+        eor(reg_coff, reg_coff, reg_coff);
+        // reg_coff_max_fwd_copy aliases reg_rbuf2 which is in use here
+        STR_ASSERT(reg_coff_max, sp, (int)stack_off_coff_max_copy);
+
+        // Three accumulators per channel block limit the unrolling to 4
+        Label ch_unroll_label[4];
+        const int max_ch_unroll = 3;
+
+        for (int ch_idx = max_ch_unroll, sp_idx = 1; ch_idx > 0;
+                --ch_idx, ++sp_idx) {
+            L(ch_unroll_label[ch_idx]);
+            {
+                const int ch_blk_size = (1 << (ch_idx - 1)); // 4, 2, 1
+                assert(vlen * ch_blk_size < 1024);
+                cmp(reg_coff_max, vlen * ch_blk_size);
+                b(LT, ch_unroll_label[ch_idx - 1]);
+
+                const int spat_blk_size = (1 << sp_idx);
+                mean_variance_nspc_single_pass(ch_blk_size, spat_blk_size);
+
+                add_imm(reg_src, reg_src, vlen_spat_data_ * ch_blk_size,
+                        X_TMP_0);
+                add_imm(reg_coff, reg_coff, vlen * ch_blk_size, X_TMP_0);
+
+                sub_imm(reg_coff_max, reg_coff_max, vlen * ch_blk_size,
+                        X_TMP_0);
+                b(ch_unroll_label[ch_idx]);
+            }
+        }
+        L(ch_unroll_label[0]);
+
+        // comeback
+        LDR_ASSERT(reg_coff_max, sp, (int)stack_off_coff_max_copy);
+        sub(reg_src, reg_src, reg_coff_max);
+    }
+
+    // Two barriers instead of four: the partial sums of all the threads are
+    // reduced at once and the variance is derived from them.
+    void compute_mean_variance_single_pass() {
+        uni_eor(TReg(0), TReg(0), TReg(0));
+        eor(reg_coff, reg_coff, reg_coff);
+        Label zero_rbuf;
+        L(zero_rbuf);
+        {
+            uni_str(TReg(0), reg_rbuf1, reg_coff);
+            uni_str(TReg(0), reg_rbuf2, reg_coff);
+            add_imm(reg_coff, reg_coff, vlen, X_TMP_0);
+            cmp(reg_coff, reg_coff_max);
+            b(NE, zero_rbuf);
+        }
+
+        LDR_ASSERT(reg_src, sp, (int)stack_off_src);
+
+        eor(reg_soff, reg_soff, reg_soff);
+        Label stats_spatial;
+        L(stats_spatial);
+        {
+            compute_mean_variance_nspc_single_pass();
+
+            // Process next image
+            if (mb_offt) {
+                add_imm(reg_src, reg_src, mb_offt, X_TMP_0);
+                add_imm(reg_soff, reg_soff, mb_offt, X_TMP_0);
+            }
+
+            cmp(reg_soff, reg_soff_max);
+            b(LT, stats_spatial);
+        }
+
+        LDR_ASSERT(reg_src, sp, (int)stack_off_src); // comeback
+
+        Label no_stats_reduction;
+        barrier();
+        {
+            LDR_ASSERT(reg_tmp, sp, (int)stack_off_N_ithr);
+            cmp(reg_tmp, 0);
+            b(NE, no_stats_reduction);
+
+            LDR_ASSERT(reg_nnthr, sp, (int)stack_off_N_nthr);
+            LDR_ASSERT(X_TMP_2, sp, (int)stack_off_src_shift);
+            eor(reg_coff, reg_coff, reg_coff);
+            Label stats_reduction_channels;
+            L(stats_reduction_channels);
+            {
+                const TReg vsqr = TReg(2);
+                const TReg vpivot = TReg(3);
+                mov(reg_roff, reg_coff);
+                uni_clear(vacc);
+                uni_clear(vsqr);
+                mov(reg_ctr, reg_nnthr);
+                Label stats_reduction_thrs;
+                L(stats_reduction_thrs);
+                {
+                    add(X_TMP_0, reg_rbuf1, reg_roff);
+                    uni_ldr(t_tmp0, X_TMP_0);
+                    fadd(vacc.s, vacc.s, t_tmp0.s);
+                    add(X_TMP_0, reg_rbuf2, reg_roff);
+                    uni_ldr(t_tmp0, X_TMP_0);
+                    fadd(vsqr.s, vsqr.s, t_tmp0.s);
+                    add(reg_roff, reg_roff, reg_coff_max);
+                    subs_imm(reg_ctr, reg_ctr, 1, X_TMP_0);
+                    b(NE, stats_reduction_thrs);
+                }
+
+                // var = E[(x - p)^2] - E[x - p]^2, mean = E[x - p] + p
+                uni_fdiv(vacc.s, vacc.s, TRegS(vchan_size.getIdx()), t_tmp0.s,
+                        P_ALL_ONE);
+                uni_fdiv(vsqr.s, vsqr.s, TRegS(vchan_size.getIdx()), t_tmp0.s,
+                        P_ALL_ONE);
+                uni_fmls(vsqr.s, vacc.s, vacc.s);
+                uni_clear(t_tmp0);
+                uni_fmaxnm(vsqr.s, vsqr.s, t_tmp0.s);
+                uni_store_maybe_tail(var_ptr(), vsqr);
+
+                add(X_TMP_0, X_TMP_2, reg_coff);
+                uni_load_spat_data(vpivot, X_TMP_0);
+                fadd(vacc.s, vacc.s, vpivot.s);
+                uni_store_maybe_tail(mean_ptr(), vacc);
+
+                add_imm(reg_coff, reg_coff, vlen, X_TMP_0);
+
+                cmp(reg_coff, reg_coff_max);
+                b(LT, stats_reduction_channels);
+            }
+        }
+        L(no_stats_reduction);
+        barrier();
+    }
+
     void var_channels() {
         Label ch_label;
         L(ch_label);
@@ -1016,6 +1230,11 @@ struct jit_bnorm_t : public jit_generator_t {
     }
 
     void compute_mean_variance() {
+        if (jbp_->single_pass_stats_) {
+            compute_mean_variance_single_pass();
+            return;
+        }
+
         uni_eor(TReg(0), TReg(0), TReg(0));
         eor(reg_coff, reg_coff, reg_coff);
         Label zero_rbuf;
@@ -1992,8 +2211,17 @@ namespace bnorm_impl {
 
 template <cpu_isa_t isa>
 struct driver_t : public c_compatible {
-    driver_t(const batch_normalization_pd_t *pd, int nthr)
-        : pd_(pd), jbp_(pd_, nthr, simd_w_), ker_(pd_, &jbp_) {}
+    driver_t(const batch_normalization_pd_t *pd, int nthr, bool syncable)
+        : pd_(pd), jbp_(pd_, nthr, simd_w_, syncable), ker_(pd_, &jbp_) {}
+
+    // Under THREADPOOL the threads can be synchronized only when the
+    // threadpool active at execution guarantees a concurrent team, so both
+    // partitions and the barriers are prepared in advance
+    static bool may_sync() {
+        return dnnl_thr_syncable()
+                || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL;
+    }
+
 
     ~driver_t() = default;
 
@@ -2004,13 +2232,14 @@ struct driver_t : public c_compatible {
         auto sbuf_sz = use_tmp_stats(pd) * 2 * C_PADDED;
         auto pbuf_sz
                 = (use_tmp_diff_scale(pd) + use_tmp_diff_shift(pd)) * C_PADDED;
-        auto rbuf_sz = (pd->is_fwd() ? 1 : 2) * C_PADDED * nthr;
+        const bool single_rbuf = pd->is_fwd() && !use_single_pass_stats(pd);
+        auto rbuf_sz = (single_rbuf ? 1 : 2) * C_PADDED * nthr;
 
         scratchpad.book<acc_data_t>(key_bnorm_tmp_stats, sbuf_sz);
         scratchpad.book<acc_data_t>(key_bnorm_tmp_diff_ss, pbuf_sz);
         scratchpad.book<acc_data_t>(key_bnorm_reduction, rbuf_sz);
 
-        if (dnnl_thr_syncable()) {
+        if (may_sync()) {
             auto n_barriers = C_PADDED / simd_elems(data_type::f32, isa);
             scratchpad.book<barrier::ctx_64_t>(key_barrier, n_barriers);
         }
@@ -2071,7 +2300,7 @@ struct driver_t : public c_compatible {
 
         int SP_N_ithr = N_ithr * jbp_.S_nthr_ + S_ithr;
         int SP_N_nthr = jbp_.N_nthr_ * jbp_.S_nthr_;
-        assert(IMPLICATION(!dnnl_thr_syncable(), SP_N_nthr == 1));
+        assert(IMPLICATION(!jbp_.syncable_, SP_N_nthr == 1));
 
         p.N_ithr = SP_N_ithr;
         p.N_nthr = SP_N_nthr;
@@ -2130,6 +2359,9 @@ struct driver_t : public c_compatible {
             p.soff_max = jbp_.dt_size_ * N_thr * img_size;
             if (src != nullptr)
                 p.src = (void *)((char *)src + soff_base * jbp_.dt_size_);
+            // the same shift for all the threads: the first point of the batch
+            if (src != nullptr && jbp_.single_pass_stats_)
+                p.src_shift = (const char *)src + coff_base * jbp_.dt_size_;
             if (dst != nullptr)
                 p.dst = (void *)((char *)dst + soff_base * jbp_.dt_size_);
             if (diff_src != nullptr)
@@ -2208,8 +2440,8 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_BNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
     VDISPATCH_BNORM(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
     VDISPATCH_BNORM(!has_zero_dim_memory(), "zero dims are not supported");
-    VDISPATCH_BNORM(
-            dnnl_thr_syncable(), "implementation requires DNNL_THR_SYNC");
+    VDISPATCH_BNORM(bnorm_impl::driver_t<isa>::may_sync(),
+            "implementation requires DNNL_THR_SYNC");
     VDISPATCH_BNORM(src_md()->data_type == f32, VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_BNORM(src_md()->data_type == dst_md()->data_type,
             VERBOSE_UNSUPPORTED_DT_CFG);
@@ -2284,9 +2516,15 @@ jit_uni_batch_normalization_fwd_t<isa>::jit_uni_batch_normalization_fwd_t(
 
 template <cpu_isa_t isa>
 status_t jit_uni_batch_normalization_fwd_t<isa>::init(engine_t *engine) {
-    CHECK(safe_ptr_assign(
-            bnorm_driver_, new bnorm_impl::driver_t<isa>(pd(), pd()->nthr_)));
-    return bnorm_driver_->create_kernel();
+    CHECK(safe_ptr_assign(bnorm_driver_,
+            new bnorm_impl::driver_t<isa>(
+                    pd(), pd()->nthr_, dnnl_thr_syncable())));
+    CHECK(bnorm_driver_->create_kernel());
+    if (dnnl_thr_syncable()) return status::success;
+
+    CHECK(safe_ptr_assign(bnorm_team_driver_,
+            new bnorm_impl::driver_t<isa>(pd(), pd()->nthr_, true)));
+    return bnorm_team_driver_->create_kernel();
 }
 
 template <cpu_isa_t isa>
@@ -2310,11 +2548,14 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::execute(
 
     const auto &scratchpad = ctx.get_scratchpad_grantor();
 
-    bnorm_driver_->init_barriers(scratchpad);
     const int nthr = pd()->nthr_;
+    auto *driver = bnorm_team_driver_ && dnnl_thr_team_syncable(nthr)
+            ? bnorm_team_driver_
+            : bnorm_driver_;
+    driver->init_barriers(scratchpad);
 
     parallel(nthr, [&](const int ithr, const int nthr) {
-        bnorm_driver_->exec(ithr, nthr, src, nullptr, dst, nullptr, scale,
+        driver->exec(ithr, nthr, src, nullptr, dst, nullptr, scale,
                 nullptr, shift, nullptr, mean, var, ws, scratchpad);
     });
 
@@ -2324,6 +2565,7 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::execute(
 template <cpu_isa_t isa>
 jit_uni_batch_normalization_fwd_t<isa>::~jit_uni_batch_normalization_fwd_t() {
     delete bnorm_driver_;
+    delete bnorm_team_driver_;
 }
 
 template <cpu_isa_t isa>
@@ -2331,8 +2573,8 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_BNORM(!is_fwd(), VERBOSE_BAD_PROPKIND);
     VDISPATCH_BNORM(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
     VDISPATCH_BNORM(!has_zero_dim_memory(), "zero dims are not supported");
-    VDISPATCH_BNORM(
-            dnnl_thr_syncable(), "implementation requires DNNL_THR_SYNC");
+    VDISPATCH_BNORM(bnorm_impl::driver_t<isa>::may_sync(),
+            "implementation requires DNNL_THR_SYNC");
     VDISPATCH_BNORM(src_md()->data_type == f32, VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_BNORM(utils::everyone_is(src_md()->data_type,
                             diff_src_md()->data_type, diff_dst_md()->data_type),
@@ -2414,9 +2656,15 @@ jit_uni_batch_normalization_bwd_t<isa>::jit_uni_batch_normalization_bwd_t(
 
 template <cpu_isa_t isa>
 status_t jit_uni_batch_normalization_bwd_t<isa>::init(engine_t *engine) {
-    CHECK(safe_ptr_assign(
-            bnorm_driver_, new bnorm_impl::driver_t<isa>(pd(), pd()->nthr_)));
-    return bnorm_driver_->create_kernel();
+    CHECK(safe_ptr_assign(bnorm_driver_,
+            new bnorm_impl::driver_t<isa>(
+                    pd(), pd()->nthr_, dnnl_thr_syncable())));
+    CHECK(bnorm_driver_->create_kernel());
+    if (dnnl_thr_syncable()) return status::success;
+
+    CHECK(safe_ptr_assign(bnorm_team_driver_,
+            new bnorm_impl::driver_t<isa>(pd(), pd()->nthr_, true)));
+    return bnorm_team_driver_->create_kernel();
 }
 
 template <cpu_isa_t isa>
@@ -2435,11 +2683,14 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::execute(
 
     const auto &scratchpad = ctx.get_scratchpad_grantor();
 
-    bnorm_driver_->init_barriers(scratchpad);
     const int nthr = pd()->nthr_;
+    auto *driver = bnorm_team_driver_ && dnnl_thr_team_syncable(nthr)
+            ? bnorm_team_driver_
+            : bnorm_driver_;
+    driver->init_barriers(scratchpad);
 
     parallel(nthr, [&](const int ithr, const int nthr) {
-        bnorm_driver_->exec(ithr, nthr, src, diff_src, nullptr, diff_dst, scale,
+        driver->exec(ithr, nthr, src, diff_src, nullptr, diff_dst, scale,
                 diff_scale, nullptr, diff_shift, mean, var, ws, scratchpad);
     });
 
@@ -2449,6 +2700,7 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::execute(
 template <cpu_isa_t isa>
 jit_uni_batch_normalization_bwd_t<isa>::~jit_uni_batch_normalization_bwd_t() {
     delete bnorm_driver_;
+    delete bnorm_team_driver_;
 }
 
 /* struct instantiation */
@@ -58,7 +58,9 @@ struct jit_uni_batch_normalization_fwd_t : public primitive_t {
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
-    bnorm_impl::driver_t<isa> *bnorm_driver_;
+    bnorm_impl::driver_t<isa> *bnorm_driver_ = nullptr;
+    // Driver with barriers for threadpools that guarantee a concurrent team
+    bnorm_impl::driver_t<isa> *bnorm_team_driver_ = nullptr;
 };
 
 template <cpu_isa_t isa>
@@ -84,7 +86,9 @@ struct jit_uni_batch_normalization_bwd_t : public primitive_t {
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
-    bnorm_impl::driver_t<isa> *bnorm_driver_;
+    bnorm_impl::driver_t<isa> *bnorm_driver_ = nullptr;
+    // Driver with barriers for threadpools that guarantee a concurrent team
+    bnorm_impl::driver_t<isa> *bnorm_team_driver_ = nullptr;
 };
 
 } // namespace aarch64
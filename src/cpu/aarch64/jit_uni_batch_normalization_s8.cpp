@@ -49,7 +49,7 @@ struct jit_uni_bnorm_s8_call_params_t {
 };
 
 template <cpu_isa_t isa>
-struct jit_bnorm_base_t : public jit_generator_t {
+struct jit_bnorm_s8_t : public jit_generator_t {
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_bnorm_s8_t)
 
@@ -75,6 +75,7 @@ struct jit_bnorm_base_t : public jit_generator_t {
     WReg reg_relu_alpha = WReg(abi_not_param1.getIdx());
 
     PReg kstore_mask = p1;
+    PReg tail_opmask = p1; // f32 mask for channel math
 
     ZReg vzero = z29;
     ZReg vone = z30;
@@ -83,14 +84,16 @@ struct jit_bnorm_base_t : public jit_generator_t {
     ZReg z_tmp0 = z25;
 
     size_t simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
-    size_t c_in_xmm_ = 16;
+    size_t c_in_xmm_ = simd_w_;
     size_t chan_data_offt_;
     size_t num_c_blocks_;
     size_t c_tail_;
     bool with_relu_;
     bool has_alpha_value_;
 
-    PReg p_lsb_128 = p6;
+    // Covers exactly one vector of the isa, which may be shorter than the
+    // hardware vector length
+    PReg p_vl = p6;
     PReg p_tmp0 = p5;
 
     XReg xreg_addr(const XReg &base, const XReg &off = XReg(DUMMY_IDX),
@@ -174,111 +177,36 @@ struct jit_bnorm_base_t : public jit_generator_t {
         return xreg_addr(reg_dst, reg_spat_offt, offt);
     }
 
-    virtual void prepare_tail_mask() {}
-    virtual void load_mean_and_var(const ZReg &vmean, const ZReg &vsqrtvar,
-            size_t offt, bool need_tail) {}
-    virtual void load_scale(const ZReg &vscale, size_t offt, bool need_tail) {}
-    virtual void load_shift(const ZReg &vshift, size_t offt, bool need_tail) {}
-    virtual void compute_dst(bool need_tail) {}
-
-    // Precomputes vscale and vshift for following
-    // `vdst = vscale * vsrc + vshift`
-    void compute_vscaleshift(const ZReg &vscale, const ZReg &vshift,
-            const ZReg &vmean, const ZReg &vsqrtvar, size_t offt,
-            bool need_tail) {
-        load_mean_and_var(vmean, vsqrtvar, offt, need_tail);
-        fadd(vsqrtvar.s, vsqrtvar.s, veps.s);
-        fsqrt(vsqrtvar.s, P_ALL_ONE / T_m, vsqrtvar.s);
-
-        if (pd_->use_scale() && pd_->use_shift()) {
-            load_scale(vscale, offt, need_tail);
-            uni_fdiv(vscale.s, vscale.s, vsqrtvar.s, z_tmp0.s, P_ALL_ONE);
-            load_shift(vshift, offt, need_tail);
-            fmls(vshift.s, P_ALL_ONE / T_m, vmean.s, vscale.s);
-        } else if (pd_->use_scale()) {
-            load_scale(vscale, offt, need_tail);
-            uni_fdiv(vscale.s, vscale.s, vsqrtvar.s, z_tmp0.s, P_ALL_ONE);
-            fmul(vmean.s, vmean.s, vscale.s);
-            uni_fsub(vshift.s, vzero.s, vmean.s);
-        } else if (pd_->use_shift()) {
-            uni_fdiv(vscale.s, vone.s, vsqrtvar.s, z_tmp0.s, P_ALL_ONE);
-            load_shift(vshift, offt, need_tail);
-            fmls(vshift.s, P_ALL_ONE / T_m, vmean.s, vscale.s);
-        } else {
-            uni_fdiv(vscale.s, vone.s, vsqrtvar.s, z_tmp0.s, P_ALL_ONE);
-            fmul(vmean.s, vmean.s, vscale.s);
-            uni_fsub(vshift.s, vzero.s, vmean.s);
-        }
-    }
-
-    void forward() {
-        eor(reg_channel_offt_1byte, reg_channel_offt_1byte,
-                reg_channel_offt_1byte);
-        eor(reg_channel_offt_4byte, reg_channel_offt_4byte,
-                reg_channel_offt_4byte);
-        mov(WReg(reg_tmp.getIdx()), sizeof(data_t) * c_in_xmm_);
-
-        if (num_c_blocks_) compute_dst(false);
-        if (c_tail_) compute_dst(true);
-    }
-
-    // either this stub or duplication at each jit_binary_t ctor due to methods
-    // that are participated are not defined at the moment of base ctor
-    // initialization.
-    void generate() override {
-        preamble();
-
-        // Only SVE512 is supported.
-        assert(isa == sve_512);
-        if (isa == sve_512) { ptrue(p_lsb_128.b, VL16); }
-
-        compute_predefined_variables();
-        load_common_params();
-        prepare_tail_mask();
-        forward();
-        postamble();
-    }
-
-    jit_bnorm_base_t(const batch_normalization_pd_t *pd) : pd_(pd) {}
-};
-
-template <cpu_isa_t isa>
-struct jit_bnorm_s8_t;
-
-template <>
-struct jit_bnorm_s8_t<sve_512> : public jit_bnorm_base_t<sve_512> {
-    PReg tail_opmask = PReg(1); // f32 mask for channel math
-
-    void prepare_tail_mask() override {
+    void prepare_tail_mask() {
         if (!c_tail_) return;
 
         set_preg(tail_opmask.s, c_tail_, X_TMP_0, X_TMP_1);
     }
 
     void load_mean_and_var(const ZReg &vmean, const ZReg &vsqrtvar, size_t offt,
-            bool need_tail) override {
+            bool need_tail) {
         if (need_tail) {
             ld1w(vmean.s, tail_opmask / T_z, ptr(mean_ptr(offt)));
             ld1w(vsqrtvar.s, tail_opmask / T_z, ptr(var_ptr(offt)));
         } else {
-            ldr(vmean, ptr(mean_ptr(offt)));
-            ldr(vsqrtvar, ptr(var_ptr(offt)));
+            ld1w(vmean.s, p_vl / T_z, ptr(mean_ptr(offt)));
+            ld1w(vsqrtvar.s, p_vl / T_z, ptr(var_ptr(offt)));
         }
     }
 
-    void load_scale(const ZReg &vscale, size_t offt, bool need_tail) override {
+    void load_scale(const ZReg &vscale, size_t offt, bool need_tail) {
         if (need_tail) {
             ld1w(vscale.s, tail_opmask / T_z, ptr(scale_ptr(offt)));
         } else {
-            ldr(vscale, ptr(scale_ptr(offt)));
+            ld1w(vscale.s, p_vl / T_z, ptr(scale_ptr(offt)));
         }
     }
 
-    void load_shift(const ZReg &vshift, size_t offt, bool need_tail) override {
+    void load_shift(const ZReg &vshift, size_t offt, bool need_tail) {
         if (need_tail) {
             ld1w(vshift.s, tail_opmask / T_z, ptr(shift_ptr(offt)));
         } else {
-            ldr(vshift, ptr(shift_ptr(offt)));
+            ld1w(vshift.s, p_vl / T_z, ptr(shift_ptr(offt)));
         }
     }
 
@@ -289,7 +217,7 @@ struct jit_bnorm_s8_t<sve_512> : public jit_bnorm_base_t<sve_512> {
         mov(vmm_dst.s, kstore_mask / T_m, vmm_aux.s);
     }
 
-    void compute_dst(bool need_tail) override {
+    void compute_dst(bool need_tail) {
         Label c_loop;
         L(c_loop);
         {
@@ -312,7 +240,7 @@ struct jit_bnorm_s8_t<sve_512> : public jit_bnorm_base_t<sve_512> {
                     set_preg(p_tmp0.s, c_tail_, X_TMP_0, X_TMP_1);
                     ld1sb(v.s, p_tmp0 / T_z, ptr(src_ptr()));
                 } else {
-                    ld1sb(v.s, P_ALL_ONE / T_z, ptr(src_ptr()));
+                    ld1sb(v.s, p_vl / T_z, ptr(src_ptr()));
                 }
 
                 scvtf(v.s, P_ALL_ONE / T_m, v.s);
@@ -332,7 +260,7 @@ struct jit_bnorm_s8_t<sve_512> : public jit_bnorm_base_t<sve_512> {
                 if (need_tail)
                     st1b(v.s, p_tmp0, ptr(dst_ptr()));
                 else
-                    st1b(v.s, P_ALL_ONE, ptr(dst_ptr()));
+                    st1b(v.s, p_vl, ptr(dst_ptr()));
 
                 add(reg_spat_offt, reg_spat_offt, reg_channel_offt_count);
                 cmp(reg_spat_offt, reg_spat_offt_count);
@@ -350,10 +278,66 @@ struct jit_bnorm_s8_t<sve_512> : public jit_bnorm_base_t<sve_512> {
         }
     }
 
-    jit_bnorm_s8_t(const batch_normalization_pd_t *pd)
-        : jit_bnorm_base_t<sve_512>(pd) {}
+    // Precomputes vscale and vshift for following
+    // `vdst = vscale * vsrc + vshift`
+    void compute_vscaleshift(const ZReg &vscale, const ZReg &vshift,
+            const ZReg &vmean, const ZReg &vsqrtvar, size_t offt,
+            bool need_tail) {
+        load_mean_and_var(vmean, vsqrtvar, offt, need_tail);
+        fadd(vsqrtvar.s, vsqrtvar.s, veps.s);
+        fsqrt(vsqrtvar.s, P_ALL_ONE / T_m, vsqrtvar.s);
+
+        if (pd_->use_scale() && pd_->use_shift()) {
+            load_scale(vscale, offt, need_tail);
+            uni_fdiv(vscale.s, vscale.s, vsqrtvar.s, z_tmp0.s, P_ALL_ONE);
+            load_shift(vshift, offt, need_tail);
+            fmls(vshift.s, P_ALL_ONE / T_m, vmean.s, vscale.s);
+        } else if (pd_->use_scale()) {
+            load_scale(vscale, offt, need_tail);
+            uni_fdiv(vscale.s, vscale.s, vsqrtvar.s, z_tmp0.s, P_ALL_ONE);
+            fmul(vmean.s, vmean.s, vscale.s);
+            uni_fsub(vshift.s, vzero.s, vmean.s);
+        } else if (pd_->use_shift()) {
+            uni_fdiv(vscale.s, vone.s, vsqrtvar.s, z_tmp0.s, P_ALL_ONE);
+            load_shift(vshift, offt, need_tail);
+            fmls(vshift.s, P_ALL_ONE / T_m, vmean.s, vscale.s);
+        } else {
+            uni_fdiv(vscale.s, vone.s, vsqrtvar.s, z_tmp0.s, P_ALL_ONE);
+            fmul(vmean.s, vmean.s, vscale.s);
+            uni_fsub(vshift.s, vzero.s, vmean.s);
+        }
+    }
+
+    void forward() {
+        eor(reg_channel_offt_1byte, reg_channel_offt_1byte,
+                reg_channel_offt_1byte);
+        eor(reg_channel_offt_4byte, reg_channel_offt_4byte,
+                reg_channel_offt_4byte);
+        mov(WReg(reg_tmp.getIdx()), sizeof(data_t) * c_in_xmm_);
+
+        if (num_c_blocks_) compute_dst(false);
+        if (c_tail_) compute_dst(true);
+    }
+
+    void generate() override {
+        preamble();
+
+        if (isa == sve_512)
+            ptrue(p_vl.b);
+        else
+            set_preg(p_vl.b, vlen);
+
+        compute_predefined_variables();
+        load_common_params();
+        prepare_tail_mask();
+        forward();
+        postamble();
+    }
+
+    jit_bnorm_s8_t(const batch_normalization_pd_t *pd) : pd_(pd) {}
 };
 
+
 namespace bnorm_s8_impl {
 
 template <cpu_isa_t isa>
@@ -474,6 +458,8 @@ jit_uni_batch_normalization_s8_fwd_t<
 
 /* struct instantiation */
 template struct jit_uni_batch_normalization_s8_fwd_t<sve_512>;
+template struct jit_uni_batch_normalization_s8_fwd_t<sve_256>;
+template struct jit_uni_batch_normalization_s8_fwd_t<sve_128>;
 
 } // namespace aarch64
 } // namespace cpu
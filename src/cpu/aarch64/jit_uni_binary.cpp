@@ -32,9 +32,57 @@ namespace aarch64 {
 static bcast_set_t get_supported_postops_bcast_strategies() {
     return {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
             broadcasting_strategy_t::per_oc_spatial,
+            broadcasting_strategy_t::per_mb_spatial,
+            broadcasting_strategy_t::per_mb_w, broadcasting_strategy_t::per_w,
+            broadcasting_strategy_t::batch,
             broadcasting_strategy_t::no_broadcast};
 }
 
+// src1 of these post-ops is read as a contiguous run of the dst offsets, so
+// a dst vector must not cross the boundary of the run.
+static bool is_contiguous_bcast(broadcasting_strategy_t bcast_type) {
+    return utils::one_of(bcast_type, broadcasting_strategy_t::per_mb_spatial,
+            broadcasting_strategy_t::per_mb_w, broadcasting_strategy_t::per_w,
+            broadcasting_strategy_t::batch);
+}
+
+// Returns the number of consecutive dst elements that map to consecutive
+// src1 elements, or 0 if src1 is not read contiguously.
+static dim_t get_contiguous_bcast_run(const memory_desc_wrapper &dst_d,
+        broadcasting_strategy_t bcast_type) {
+    using namespace injector_utils;
+    const auto layout = get_layout_type(dst_d);
+    const int ndims = dst_d.ndims();
+    const dim_t *pdims = dst_d.padded_dims();
+
+    if (bcast_type == broadcasting_strategy_t::batch)
+        return utils::one_of(layout, layout_t::ncsp, layout_t::nspc,
+                       layout_t::c_blocked)
+                ? dst_d.blocking_desc().strides[0]
+                : 0;
+    if (layout != layout_t::ncsp || ndims < 3) return 0;
+    if (bcast_type == broadcasting_strategy_t::per_mb_spatial)
+        return utils::array_product(pdims + 2, ndims - 2);
+    return pdims[ndims - 1];
+}
+
+// The kernel may run with a shorter vector than the maximal one, which keeps
+// the runs aligned as the vector lengths are powers of two.
+static int get_max_simd_w() {
+    return nstl::max((int)get_sve_length(), 16) / (int)sizeof(float);
+}
+
+static bool any_contiguous_bcast(
+        const post_ops_t &post_ops, const memory_desc_wrapper &dst_d) {
+    return std::any_of(post_ops.entry_.cbegin(), post_ops.entry_.cend(),
+            [&](const post_ops_t::entry_t &entry) -> bool {
+        return entry.is_binary()
+                && is_contiguous_bcast(get_rhs_arg_broadcasting_strategy(
+                        entry.binary.src1_desc, dst_d,
+                        get_supported_postops_bcast_strategies()));
+    });
+}
+
 static bool compare_layouts(const memory_desc_wrapper &src0_md,
         const memory_desc_wrapper &src1_md) {
     const strides_t &strides0 = src0_md.blocking_desc().strides;
@@ -184,6 +232,17 @@ status_t jit_uni_binary_t::pd_t::init(engine_t *engine) {
             && conf_.op_type == op_t::n_spatial_c;
 
     const auto ndims = src0_md_.ndims();
+    // the contiguous post-op broadcasts rely on the vectors being aligned
+    // to the flat dst offset, which holds for the strategies that split the
+    // tensor into its vectors only
+    const bool scalar_oc_tail = conf_.bcast_type == bcast_t::scalar
+            && ndims >= 2 && src0_md_.dims()[1] % get_max_simd_w() != 0;
+    if (any_contiguous_bcast(po, dst_md_)
+            && (!utils::one_of(conf_.bcast_type, bcast_t::none,
+                        bcast_t::scalar, bcast_t::per_batch)
+                    || scalar_oc_tail || conf_.postops_per_oc_broadcast_exists))
+        return status::unimplemented;
+
     if (conf_.is_src_different_layouts) {
         const auto &strides0 = src0_md_.blocking_desc().strides;
         const auto &strides1 = src1_md_.blocking_desc().strides;
@@ -519,6 +578,19 @@ bool jit_uni_binary_t::post_ops_ok(const primitive_attr_t *attr,
     const dim_t n_dims = src0_d.ndims();
     const dim_t &oc = n_dims >= 2 ? src0_d.dims()[1] : 1;
 
+    const int max_simd_w = get_max_simd_w();
+    for (int i = 0; i < p.len(); i++) {
+        if (!is_binary(i)) continue;
+        const auto bcast_type = get_rhs_arg_broadcasting_strategy(
+                p.entry_[i].binary.src1_desc, dst_d, supported_strategies);
+        if (!is_contiguous_bcast(bcast_type)) continue;
+        const dim_t run = get_contiguous_bcast_run(dst_d, bcast_type);
+        if (run == 0 || run % max_simd_w != 0 || is_src_different_layouts
+                || !dst_d.is_dense(true)
+                || (blocked_format && oc % max_simd_w != 0))
+            return false;
+    }
+
     /*
      * TODO: Remove limitation supporting tail with blocked format for i8i8
      */
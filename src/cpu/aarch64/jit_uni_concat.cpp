@@ -0,0 +1,236 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/aarch64/jit_uni_concat.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+using namespace memory_tracking::names;
+
+#define GET_OFF(field) static_cast<int32_t>(offsetof(call_params_t, field))
+
+static cpu_isa_t get_supported_isa() {
+    if (mayiuse(sve_512)) return sve_512;
+    if (mayiuse(sve_256)) return sve_256;
+    if (mayiuse(sve_128)) return sve_128;
+
+    return isa_undef;
+}
+
+void jit_uni_concat_kernel_t::copy(int unroll, const PReg &p) {
+    auto addr = [&](const XReg &base, int i) -> XReg {
+        if (i == 0) return base;
+        add_imm(X_DEFAULT_ADDR, base, i * vlen_, X_TMP_0);
+        return X_DEFAULT_ADDR;
+    };
+
+    for (int i = 0; i < unroll; i++)
+        ld1b(ZReg(i).b, p / T_z, ptr(addr(reg_src_, i)));
+    for (int i = 0; i < unroll; i++) {
+        if (non_temporal_)
+            stnt1b(ZReg(i).b, p, ptr(addr(reg_dst_, i)));
+        else
+            st1b(ZReg(i).b, p, ptr(addr(reg_dst_, i)));
+    }
+}
+
+void jit_uni_concat_kernel_t::advance_ptrs(size_t bytes) {
+    add_imm(reg_src_, reg_src_, bytes, X_TMP_0);
+    add_imm(reg_dst_, reg_dst_, bytes, X_TMP_0);
+    sub_imm(reg_size_, reg_size_, bytes, X_TMP_0);
+}
+
+void jit_uni_concat_kernel_t::generate() {
+    preamble();
+
+    ldr(reg_src_, ptr(abi_param1, GET_OFF(src)));
+    ldr(reg_dst_, ptr(abi_param1, GET_OFF(dst)));
+    ldr(reg_size_, ptr(abi_param1, GET_OFF(size)));
+
+    // The predicate covers a single vector of the isa which may be shorter
+    // than the hardware vector length
+    set_preg(p_vl_.b, vlen_);
+
+    Label unroll_loop, unroll_loop_end, single_loop, single_loop_end, end;
+
+    L(unroll_loop);
+    {
+        mov_imm(X_TMP_0, unroll_max_ * vlen_);
+        cmp(reg_size_, X_TMP_0);
+        b(LO, unroll_loop_end);
+        copy(unroll_max_, p_vl_);
+        advance_ptrs(unroll_max_ * vlen_);
+        b(unroll_loop);
+    }
+    L(unroll_loop_end);
+
+    L(single_loop);
+    {
+        cmp_imm(reg_size_, vlen_, X_TMP_0);
+        b(LO, single_loop_end);
+        copy(1, p_vl_);
+        advance_ptrs(vlen_);
+        b(single_loop);
+    }
+    L(single_loop_end);
+
+    cbz(reg_size_, end);
+    mov_imm(X_TMP_1, 0);
+    whilelo(p_tail_.b, X_TMP_1, reg_size_);
+    copy(1, p_tail_);
+
+    L(end);
+    postamble();
+}
+
+#undef GET_OFF
+
+template <data_type_t data_type>
+status_t jit_uni_concat_t<data_type>::pd_t::init(engine_t *engine) {
+    isa_ = get_supported_isa();
+
+    // disabling verbose dispatch messages for unsupported isa for better
+    // readability
+    if (isa_ == isa_undef) return status::unimplemented;
+
+    CHECK(base_pd_t::init(engine));
+
+    // Bypass the cache when the output does not fit into the L2 caches of
+    // the threads writing it
+    const memory_desc_wrapper dst_d(this->dst_md());
+    const size_t L2_size = platform::get_per_core_cache_size(2);
+    non_temporal_ = dst_d.size() > dnnl_get_max_threads() * L2_size;
+
+    return status::success;
+}
+
+template <data_type_t data_type>
+status_t jit_uni_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
+    using call_params_t = jit_uni_concat_kernel_t::call_params_t;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto iptrs = scratchpad.template get<const data_t *>(key_concat_iptrs);
+    auto optrs = scratchpad.template get<data_t *>(key_concat_optrs);
+    auto nelems_to_copy = scratchpad.template get<dim_t>(key_concat_nelems);
+    auto is = scratchpad.template get<strides_t>(key_concat_istrides);
+
+    const int num_arrs = pd()->n_inputs();
+    const int *perm = pd()->perm_, *iperm = pd()->iperm_;
+    const int concat_dim = pd()->concat_dim();
+    auto o_base_ptr = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    if (o_base_ptr == nullptr) return status::success;
+
+    for (int a = 0; a < num_arrs; ++a) {
+        const memory_desc_wrapper i_d(pd()->src_md(a));
+        const memory_desc_wrapper o_d(pd()->src_image_md(a));
+        const auto iptr = CTX_IN_MEM(const data_t *, DNNL_ARG_MULTIPLE_SRC + a);
+        if (iptr == nullptr) {
+            iptrs[a] = nullptr;
+            nelems_to_copy[a] = 0;
+            continue;
+        }
+        iptrs[a] = iptr + i_d.blk_off(0);
+        optrs[a] = o_base_ptr + o_d.blk_off(0);
+        nelems_to_copy[a] = pd()->nelems_to_concat(i_d);
+        for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
+            if (i < perm[concat_dim])
+                is[a][i] = size_t(i_d.blocking_desc().strides[iperm[i]]);
+            else
+                is[a][i] = 0;
+        }
+    }
+
+    const memory_desc_wrapper o_d(pd()->dst_md(0));
+
+    strides_t os = {0};
+    bool has_outer_loop = false;
+    for (int i = 0; i < perm[concat_dim]; i++) {
+        os[i] = o_d.blocking_desc().strides[iperm[i]];
+        if (o_d.padded_dims()[iperm[i]] != 1) has_outer_loop = true;
+    }
+
+    // Applies when concat axis is the outermost dimension, e.g. concat_axis = 0
+    // or concat_axis = 1, and dims[0] = 1;
+    if (!has_outer_loop) {
+        parallel(0, [&](int ithr, int nthr) {
+            for (int a = 0; a < num_arrs; ++a) {
+                dim_t start {0}, end {0};
+                balance211(nelems_to_copy[a], nthr, ithr, start, end);
+                if (start >= end) continue;
+
+                call_params_t p;
+                p.src = iptrs[a] + start;
+                p.dst = optrs[a] + start;
+                p.size = (end - start) * sizeof(data_t);
+                (*kernel_)(&p);
+            }
+        });
+
+        return status::success;
+    }
+
+    dims_t phys_dims;
+    for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
+        if (i < perm[concat_dim])
+            phys_dims[i]
+                    = o_d.padded_dims()[iperm[i]] / pd()->blocks_[iperm[i]];
+        else
+            phys_dims[i] = 1;
+    }
+
+    parallel_nd(phys_dims[0], phys_dims[1], phys_dims[2], phys_dims[3],
+            phys_dims[4], num_arrs,
+            [&](dim_t n0, dim_t n1, dim_t n2, dim_t n3, dim_t n4, dim_t a) {
+                // check if zero memory
+                if (iptrs[a] == nullptr) return;
+
+                const size_t in_off = is[a][0] * n0 + is[a][1] * n1
+                        + is[a][2] * n2 + is[a][3] * n3 + is[a][4] * n4;
+                const size_t out_off = os[0] * n0 + os[1] * n1 + os[2] * n2
+                        + os[3] * n3 + os[4] * n4;
+
+                call_params_t p;
+                p.src = &iptrs[a][in_off];
+                p.dst = &optrs[a][out_off];
+                p.size = nelems_to_copy[a] * sizeof(data_t);
+                (*kernel_)(&p);
+            });
+
+    return status::success;
+}
+
+template struct jit_uni_concat_t<data_type::f32>;
+template struct jit_uni_concat_t<data_type::u8>;
+template struct jit_uni_concat_t<data_type::s8>;
+template struct jit_uni_concat_t<data_type::s32>;
+template struct jit_uni_concat_t<data_type::bf16>;
+template struct jit_uni_concat_t<data_type::f16>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_CONCAT_HPP
+#define CPU_AARCH64_JIT_UNI_CONCAT_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/simple_concat.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Copies size bytes from src to dst. Non-temporal stores are used when the
+// destination is too big to stay in the cache, so that copying it does not
+// evict the data of the next primitives.
+struct jit_uni_concat_kernel_t : public jit_generator_t {
+    struct call_params_t {
+        const void *src = nullptr;
+        void *dst = nullptr;
+        size_t size = 0u;
+    };
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_concat_kernel_t)
+
+    jit_uni_concat_kernel_t(cpu_isa_t isa, bool non_temporal)
+        : vlen_(isa_max_vlen(isa)), non_temporal_(non_temporal) {}
+
+    void operator()(call_params_t *params) {
+        jit_generator_t::operator()(params);
+    }
+
+private:
+    void generate() override;
+    void copy(int unroll, const Xbyak_aarch64::PReg &p);
+    void advance_ptrs(size_t bytes);
+
+    static constexpr int unroll_max_ = 4;
+
+    const size_t vlen_;
+    const bool non_temporal_;
+
+    const Xbyak_aarch64::XReg reg_src_ = x1;
+    const Xbyak_aarch64::XReg reg_dst_ = x2;
+    const Xbyak_aarch64::XReg reg_size_ = x3;
+
+    const Xbyak_aarch64::PReg p_vl_ = p1;
+    const Xbyak_aarch64::PReg p_tail_ = p2;
+};
+
+// Same dispatching and work split as simple_concat_t with the copies done by
+// an SVE kernel.
+template <data_type_t data_type>
+struct jit_uni_concat_t : public primitive_t {
+    using base_pd_t = typename simple_concat_t<data_type>::pd_t;
+
+    struct pd_t : public base_pd_t {
+        using base_pd_t::base_pd_t;
+
+        // The base pd is a dependent type, so its member template has to be
+        // redeclared for DECLARE_CONCAT_PD_T to find it
+        template <typename T, typename... Args>
+        static std::unique_ptr<T> make_unique_pd(Args &&...args) {
+            return primitive_desc_t::make_unique_pd<T>(
+                    std::forward<Args>(args)...);
+        }
+
+        DECLARE_CONCAT_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa_, ""), jit_uni_concat_t);
+
+        status_t init(engine_t *engine);
+
+        cpu_isa_t isa_ = isa_undef;
+        bool non_temporal_ = false;
+    };
+
+    jit_uni_concat_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(kernel_,
+                new jit_uni_concat_kernel_t(pd()->isa_, pd()->non_temporal_)));
+        return kernel_->create_kernel();
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+    using data_t = typename prec_traits_t<data_type>::type;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_concat_kernel_t> kernel_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
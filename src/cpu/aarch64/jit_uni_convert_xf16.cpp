@@ -0,0 +1,159 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/type_helpers.hpp"
+
+#include "cpu/aarch64/jit_uni_convert_xf16.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+#define GET_OFF(field) \
+    static_cast<int32_t>(offsetof(cvt_xf16_support::jit_call_t, field))
+
+static cpu_isa_t get_supported_isa() {
+    if (mayiuse(sve_512)) return sve_512;
+    if (mayiuse(sve_256)) return sve_256;
+    if (mayiuse(sve_128)) return sve_128;
+
+    return isa_undef;
+}
+
+void jit_uni_cvt_xf16_kernel_t::convert(int unroll, const PReg &p) {
+    const size_t src_vlen = simd_w_ * types::data_type_size(src_dt_);
+    const size_t dst_vlen = simd_w_ * types::data_type_size(dst_dt_);
+
+    auto addr = [&](const XReg &base, size_t offt) -> XReg {
+        if (offt == 0) return base;
+        add_imm(X_DEFAULT_ADDR, base, offt, X_TMP_0);
+        return X_DEFAULT_ADDR;
+    };
+
+    // All loads are issued first so that the conversions of the different
+    // vectors can overlap
+    for (int i = 0; i < unroll; i++) {
+        const ZReg z(i);
+        const XReg a = addr(reg_inp_, i * src_vlen);
+        if (src_dt_ == data_type::f32)
+            ld1w(z.s, p / T_z, ptr(a));
+        else
+            ld1h(z.s, p / T_z, ptr(a));
+    }
+
+    for (int i = 0; i < unroll; i++) {
+        const ZReg z(i);
+        switch (src_dt_) {
+            case data_type::bf16: lsl(z.s, z.s, 16); break;
+            case data_type::f16: fcvt(z.s, p_vl_ / T_m, z.h); break;
+            default:
+                if (dst_dt_ == data_type::bf16)
+                    bfcvt(z.h, p_vl_ / T_m, z.s);
+                else
+                    fcvt(z.h, p_vl_ / T_m, z.s);
+                break;
+        }
+    }
+
+    for (int i = 0; i < unroll; i++) {
+        const ZReg z(i);
+        const XReg a = addr(reg_out_, i * dst_vlen);
+        if (dst_dt_ == data_type::f32)
+            st1w(z.s, p, ptr(a));
+        else
+            st1h(z.s, p, ptr(a));
+    }
+}
+
+void jit_uni_cvt_xf16_kernel_t::advance_ptrs(size_t nelems) {
+    add_imm(reg_inp_, reg_inp_, nelems * types::data_type_size(src_dt_),
+            X_TMP_0);
+    add_imm(reg_out_, reg_out_, nelems * types::data_type_size(dst_dt_),
+            X_TMP_0);
+    sub_imm(reg_nelems_, reg_nelems_, nelems, X_TMP_0);
+}
+
+void jit_uni_cvt_xf16_kernel_t::generate() {
+    preamble();
+
+    ldr(reg_inp_, ptr(abi_param1, GET_OFF(inp)));
+    ldr(reg_out_, ptr(abi_param1, GET_OFF(out)));
+    ldr(reg_nelems_, ptr(abi_param1, GET_OFF(nelems)));
+
+    // The predicate covers a single vector of the isa which may be shorter
+    // than the hardware vector length
+    set_preg(p_vl_.s, simd_w_);
+
+    Label unroll_loop, unroll_loop_end, single_loop, single_loop_end, end;
+
+    L(unroll_loop);
+    {
+        mov_imm(X_TMP_0, unroll_max_ * simd_w_);
+        cmp(reg_nelems_, X_TMP_0);
+        b(LO, unroll_loop_end);
+        convert(unroll_max_, p_vl_);
+        advance_ptrs(unroll_max_ * simd_w_);
+        b(unroll_loop);
+    }
+    L(unroll_loop_end);
+
+    L(single_loop);
+    {
+        cmp_imm(reg_nelems_, simd_w_, X_TMP_0);
+        b(LO, single_loop_end);
+        convert(1, p_vl_);
+        advance_ptrs(simd_w_);
+        b(single_loop);
+    }
+    L(single_loop_end);
+
+    cbz(reg_nelems_, end);
+    mov_imm(X_TMP_1, 0);
+    whilelo(p_tail_.s, X_TMP_1, reg_nelems_);
+    convert(1, p_tail_);
+
+    L(end);
+    postamble();
+}
+
+#undef GET_OFF
+
+bool jit_cvt_xf16_t::is_supported(data_type_t src_dt, data_type_t dst_dt) {
+    using namespace data_type;
+    if (get_supported_isa() == isa_undef) return false;
+    // BFCVT is only available with FEAT_BF16
+    if (src_dt == f32)
+        return dst_dt == f16 || (dst_dt == bf16 && mayiuse_bf16());
+    return utils::one_of(src_dt, bf16, f16) && dst_dt == f32;
+}
+
+jit_cvt_xf16_t::jit_cvt_xf16_t(data_type_t src_dt, data_type_t dst_dt)
+    : dst_dt_(dst_dt) {
+    assert(is_supported(src_dt, dst_dt));
+    kernel_ = utils::make_unique<jit_uni_cvt_xf16_kernel_t>(
+            get_supported_isa(), src_dt, dst_dt);
+    kernel_->create_kernel();
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_CONVERT_XF16_HPP
+#define CPU_AARCH64_JIT_UNI_CONVERT_XF16_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace cvt_xf16_support {
+struct jit_call_t {
+    const void *inp;
+    void *out;
+    size_t nelems;
+};
+} // namespace cvt_xf16_support
+
+// Converts a dense array of f32 values to bf16 or f16 with BFCVT and FCVT,
+// or bf16 and f16 values back to f32. The main loop converts unroll_max_
+// vectors per iteration to hide the latency of the conversions.
+struct jit_uni_cvt_xf16_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_cvt_xf16_kernel_t)
+
+    jit_uni_cvt_xf16_kernel_t(
+            cpu_isa_t isa, data_type_t src_dt, data_type_t dst_dt)
+        : simd_w_(isa_max_vlen(isa) / sizeof(float))
+        , src_dt_(src_dt)
+        , dst_dt_(dst_dt) {}
+
+private:
+    void generate() override;
+    void convert(int unroll, const Xbyak_aarch64::PReg &p);
+    void advance_ptrs(size_t nelems);
+
+    static constexpr int unroll_max_ = 8;
+
+    const size_t simd_w_;
+    const data_type_t src_dt_;
+    const data_type_t dst_dt_;
+
+    const Xbyak_aarch64::XReg reg_inp_ = x1;
+    const Xbyak_aarch64::XReg reg_out_ = x2;
+    const Xbyak_aarch64::XReg reg_nelems_ = x3;
+
+    const Xbyak_aarch64::PReg p_vl_ = p1;
+    const Xbyak_aarch64::PReg p_tail_ = p2;
+};
+
+// Owns a conversion kernel for the widest available SVE length.
+struct jit_cvt_xf16_t {
+    jit_cvt_xf16_t(data_type_t src_dt, data_type_t dst_dt);
+
+    // Returns true if the conversion can be done on this CPU
+    static bool is_supported(data_type_t src_dt, data_type_t dst_dt);
+
+    void operator()(void *out, const void *inp, size_t nelems) const {
+        cvt_xf16_support::jit_call_t p;
+        p.inp = inp;
+        p.out = out;
+        p.nelems = nelems;
+        (*kernel_)(&p);
+        msan_unpoison(out, nelems * types::data_type_size(dst_dt_));
+    }
+
+private:
+    const data_type_t dst_dt_;
+    std::unique_ptr<jit_uni_cvt_xf16_kernel_t> kernel_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
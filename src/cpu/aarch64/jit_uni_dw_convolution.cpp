@@ -78,6 +78,7 @@ void jit_uni_dw_convolution_fwd_t<isa, src_type, dst_type>::execute_forward(
     const int chb_work = utils::div_up(jcp.nb_ch, ch_step);
     const auto is_src_layout_nxc = jcp.src_tag == format_tag::nhwc;
     const auto is_dst_layout_nxc = jcp.dst_tag == format_tag::nhwc;
+    const bool zero_pad_dst = pd()->zero_pads_dst();
 
     const int work_amount = jcp.mb * chb_work * jcp.oh;
     const auto nthr = jcp.nthr;
@@ -146,6 +147,11 @@ void jit_uni_dw_convolution_fwd_t<isa, src_type, dst_type>::execute_forward(
 
             (*kernel_)(&par_conv);
 
+            // the padded channels are zeroed while the dst row is in cache
+            if (zero_pad_dst && ch + (int)par_conv.ch_blocks == jcp.nb_ch)
+                pd()->zero_pad_dst_channels(
+                        dst, n, (dim_t)oh * jcp.ow, (dim_t)(oh + 1) * jcp.ow);
+
             if (jcp.loop_order == loop_ngcw) {
                 ++iwork;
                 utils::nd_iterator_step(n, jcp.mb, chb, chb_work, oh, jcp.oh);
@@ -69,6 +69,8 @@ struct jit_uni_dw_convolution_fwd_t : public primitive_t {
             jit_uni_dw_conv_fwd_kernel_t<isa, src_type>::init_scratchpad(
                     scratchpad, jcp_);
 
+            zero_pads_dst_ = jcp_.dst_tag != format_tag::nhwc;
+
             return status::success;
         }
 
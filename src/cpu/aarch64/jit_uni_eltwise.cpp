@@ -1,7 +1,7 @@
 /*******************************************************************************
 * Copyright 2017 Intel Corporation
 * Copyright 2021-2023 FUJITSU LIMITED
-* Copyright 2022, 2025 Arm Ltd. and affiliates
+* Copyright 2022, 2025-2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -16,6 +16,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+
 #include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
@@ -23,8 +25,12 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/platform.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
 #include "cpu/aarch64/jit_generator.hpp"
 
+#include "cpu/aarch64/injectors/jit_sve_dropout_injector.hpp"
 #include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
 #include "cpu/aarch64/jit_uni_eltwise.hpp"
 
@@ -44,6 +50,9 @@ struct jit_args_t {
     const void *dst; // fwd: dst;  bwd: diff_src;
     const void *diff_dst; // fwd: nullptr;  bwd: diff_dst;
     size_t work_amount;
+    const dropout_args_t *dropout_args; // fwd: dropout, if any
+    uint8_t *dropout_mask; // fwd: dropout mask of the first element, if any
+    size_t idx; // fwd: dropout index of the first element
 };
 
 struct jit_uni_eltwise_kernel_t : public jit_generator_t {
@@ -83,6 +92,19 @@ protected:
 // jit kernels
 namespace {
 
+// Returns the distance in bytes the inputs of streaming kernels are prefetched
+// ahead of their loads, ONEDNN_CPU_PREFETCH_DISTANCE if set, 0 disabling the
+// prefetches. It is a multiple of the cache line below the PRFM offset limit.
+int get_prefetch_distance() {
+    static const int distance = [] {
+        const int line = 64;
+        const int max_distance = 32768 - line;
+        const int d = getenv_int_user("CPU_PREFETCH_DISTANCE", 16 * line);
+        return nstl::max(0, nstl::min(d, max_distance)) / line * line;
+    }();
+    return distance;
+}
+
 template <cpu_isa_t isa>
 struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_kernel)
@@ -97,6 +119,28 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
                 reg_injector_table, injector_mask, injector_p_tmp0, is_fwd,
                 pd_->use_dst(), true, true,
                 can_compute_as_f16() ? data_type::f16 : data_type::f32));
+
+        const auto &dropout = pd_->attr()->dropout_;
+        with_dropout_ = is_fwd && !dropout.has_default_values();
+        with_dropout_mask_ = with_dropout_ && dropout.has_output_mask();
+        if (with_dropout_)
+            dropout_injector_.reset(new jit_sve_dropout_injector_t(this,
+                    z_dropout_aux_start, p_dropout_aux, p_dropout_keep,
+                    p_dropout_tail, reg_dropout_args, X_TMP_2,
+                    with_dropout_mask_));
+
+        // An output which doesn't fit in the last level cache would be
+        // evicted before being used, so it bypasses the caches, and the
+        // inputs are prefetched ahead of the hardware prefetchers. ASIMD has
+        // no single register non-temporal store.
+        const memory_desc_wrapper dst_d(
+                is_fwd ? pd_->dst_md() : pd_->diff_src_md());
+        size_t llc_size = platform::get_per_core_cache_size(3);
+        if (llc_size == 0) llc_size = platform::get_per_core_cache_size(2);
+        const bool is_streaming
+                = dst_d.size() > llc_size * platform::get_num_cores();
+        use_nt_store_ = is_streaming && isa != asimd;
+        if (is_streaming) prefetch_distance_ = get_prefetch_distance();
     }
 
     void generate() override {
@@ -116,6 +160,17 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         }
         add_imm(X_TMP_0, param, GET_OFF(work_amount), X_TMP_1);
         ldr(reg_work_amount, ptr(X_TMP_0));
+        if (with_dropout_) {
+            add_imm(X_TMP_0, param, GET_OFF(dropout_args), X_TMP_1);
+            ldr(reg_dropout_args, ptr(X_TMP_0));
+            add_imm(X_TMP_0, param, GET_OFF(idx), X_TMP_1);
+            ldr(reg_dropout_idx, ptr(X_TMP_0));
+            if (with_dropout_mask_) {
+                add_imm(X_TMP_0, param, GET_OFF(dropout_mask), X_TMP_1);
+                ldr(reg_dropout_mask, ptr(X_TMP_0));
+            }
+            ptrue(p_dropout_tail.s, VL1);
+        }
         eltwise_injector_->load_table_addr();
         Label vectorized_loop_start, remainder_loop_start, remainder_loop_end;
         cmp(reg_work_amount, simd_elems_per_load);
@@ -133,6 +188,11 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         // can be relevantly easy controlled, this will cost much from code
         // perspective and will complicate the compute logic significantly.
 
+        if (prefetch_distance_ > 0) {
+            prfm(PLDL2STRM, ptr(reg_src, prefetch_distance_));
+            if (!is_fwd)
+                prfm(PLDL2STRM, ptr(reg_diff_dst, prefetch_distance_));
+        }
         load_vector(vmm_src.s, reg_src);
         if (can_compute_as_f16()) {
             // For F16-computable algorithms, we keep the data in 16-bit format
@@ -158,6 +218,9 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
             pack_fp16(vmm_src, tmp0);
         } else { // F32
             eltwise_injector_->compute_vector(vmm_src.getIdx());
+            if (with_dropout_)
+                dropout_injector_->compute_vector(ZReg(vmm_src.getIdx()),
+                        reg_dropout_idx, reg_dropout_mask);
             if (!is_fwd) {
                 load_vector(vmm_diff_dst, reg_diff_dst);
                 fmul(TRegS(vmm_src.getIdx()), TRegS(vmm_src.getIdx()),
@@ -173,6 +236,13 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         add_imm(reg_dst, reg_dst, simd_bytes(isa), X_TMP_0);
         if (!is_fwd)
             add_imm(reg_diff_dst, reg_diff_dst, simd_bytes(isa), X_TMP_0);
+        if (with_dropout_) {
+            add_imm(reg_dropout_idx, reg_dropout_idx, simd_elems_per_load,
+                    X_TMP_0);
+            if (with_dropout_mask_)
+                add_imm(reg_dropout_mask, reg_dropout_mask,
+                        simd_elems_per_load, X_TMP_0);
+        }
 
         sub_imm(reg_work_amount, reg_work_amount, simd_elems_per_load, X_TMP_0);
         cmp(reg_work_amount, simd_elems_per_load);
@@ -200,6 +270,9 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         } else {
             ld1(xmm_src[0], ptr(reg_src));
             eltwise_injector_->compute_vector(xmm_src.getIdx());
+            if (with_dropout_)
+                dropout_injector_->compute_vector(ZReg(xmm_src.getIdx()),
+                        reg_dropout_idx, reg_dropout_mask, true);
             if (!is_fwd) {
                 ld1(xmm_diff_dst[0], ptr(reg_diff_dst));
                 fmul(vmm_src.s, vmm_src.s, vmm_diff_dst);
@@ -217,6 +290,11 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         add_imm(reg_src, reg_src, dtype_size(), X_TMP_0);
         add_imm(reg_dst, reg_dst, dtype_size(), X_TMP_0);
         if (!is_fwd) add_imm(reg_diff_dst, reg_diff_dst, dtype_size(), X_TMP_0);
+        if (with_dropout_) {
+            add(reg_dropout_idx, reg_dropout_idx, 1);
+            if (with_dropout_mask_)
+                add(reg_dropout_mask, reg_dropout_mask, 1);
+        }
         subs(reg_work_amount, reg_work_amount, 1);
 
         b(remainder_loop_start);
@@ -241,6 +319,14 @@ private:
     PReg injector_mask = p1;
     PReg injector_p_tmp0 = p4;
     PReg injector_p_all = p7;
+    XReg reg_dropout_args = x12;
+    XReg reg_dropout_idx = x13;
+    XReg reg_dropout_mask = x14;
+    PReg p_dropout_aux = p2;
+    PReg p_dropout_keep = p3;
+    PReg p_dropout_tail = p5;
+    // Above the registers of the eltwise injector
+    static constexpr int z_dropout_aux_start = 16;
 
     VReg4S xmm_src {1};
     VReg8H v_bf16 {1};
@@ -251,6 +337,11 @@ private:
     TReg tmp0 {2};
     TReg tmp1 {7};
     std::unique_ptr<jit_uni_eltwise_injector_t<isa>> eltwise_injector_;
+    std::unique_ptr<jit_sve_dropout_injector_t> dropout_injector_;
+    bool with_dropout_ = false;
+    bool with_dropout_mask_ = false;
+    bool use_nt_store_ = false;
+    int prefetch_distance_ = 0;
 
     PReg p_tmp0 {4}; /* Index is temporal. */
 
@@ -350,7 +441,10 @@ inline void jit_uni_kernel_t<cpu_isa_t::asimd>::store_vector(
 template <>
 inline void jit_uni_kernel_t<cpu_isa_t::sve>::store_vector(
         const XReg &addr, const TRegS src) {
-    st1w(src, P_ALL_ONE / T_z, ptr(addr));
+    if (use_nt_store_)
+        stnt1w(src, P_ALL_ONE, ptr(addr));
+    else
+        st1w(src, P_ALL_ONE / T_z, ptr(addr));
 }
 
 // Template specializations for unpack_bf16
@@ -439,10 +533,37 @@ status_t jit_uni_eltwise_fwd_t<isa>::pd_t::init(engine_t *engine) {
     // refer to a comment in jit_uni_kernel why this is needed
     VDISPATCH_ELTWISE(IMPLICATION(!src_d.is_dense(), is_zero_preserved()),
             VERBOSE_UNSUPPORTED_ATTR);
-    VDISPATCH_ELTWISE(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_ELTWISE(
+            attr()->has_default_values(primitive_attr_t::skip_mask_t::dropout),
+            VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_ELTWISE(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
     VDISPATCH_ELTWISE(src_d == memory_desc_wrapper(dst_md()),
             VERBOSE_INCONSISTENT_MDS, "src", "dst");
+    CHECK(dropout_ok());
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_eltwise_fwd_t<isa>::pd_t::dropout_ok() {
+    if (attr()->dropout_.has_default_values()) return status::success;
+
+    // The random values are generated in SVE registers, for f32 only.
+    VDISPATCH_ELTWISE_IC(isa == sve, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_ELTWISE_IC(
+            src_md()->data_type == data_type::f32, VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_ELTWISE_IC(
+            attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_DROPOUT);
+
+    using namespace format_tag;
+    // See `ref_dropout(...)` comment which explains the requirement.
+    VDISPATCH_ELTWISE_IC(
+            memory_desc_matches_one_of_tag(*dst_md(0), ncdhw, nchw, ncw, nc)
+                    && IMPLICATION(attr_.dropout_.has_output_mask(),
+                            memory_desc_wrapper(dst_md(0)).similar_to(
+                                    attr_.dropout_.dropout_desc_, true, false)),
+            VERBOSE_UNSUPPORTED_DROPOUT);
 
     return status::success;
 }
@@ -462,14 +583,60 @@ status_t jit_uni_eltwise_fwd_t<isa>::init(engine_t *engine) {
 
 template <cpu_isa_t isa>
 status_t jit_uni_eltwise_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
 
+    // The dropout arguments are read once for all the threads.
+    const auto &dropout = pd()->attr()->dropout_;
+    const bool with_dropout = !dropout.has_default_values();
+    const dropout_args_t dropout_args = with_dropout
+            ? get_dropout_args(ctx, dropout)
+            : dropout_args_t();
+    auto dropout_mask = dropout.has_output_mask()
+            ? CTX_OUT_MEM(uint8_t *, DNNL_ARG_ATTR_DROPOUT_MASK)
+            : nullptr;
+
+    std::atomic<status_t> st(status::success);
+    parallel(0, [&](const int ithr, const int nthr) {
+        status_t st_thr = execute_thr(ithr, nthr, src, dst,
+                with_dropout ? &dropout_args : nullptr, dropout_mask);
+        if (st_thr != status::success) st = st_thr;
+    });
+    return st;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_eltwise_fwd_t<isa>::execute_in_team(
+        const exec_ctx_t &ctx, int ithr, int nthr) const {
+    // There is no serial section before a team runs, so every thread of the
+    // team resolves the arguments.
     auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
 
+    const auto &dropout = pd()->attr()->dropout_;
+    const bool with_dropout = !dropout.has_default_values();
+    const dropout_args_t dropout_args = with_dropout
+            ? get_dropout_args(ctx, dropout)
+            : dropout_args_t();
+    auto dropout_mask = dropout.has_output_mask()
+            ? CTX_OUT_MEM(uint8_t *, DNNL_ARG_ATTR_DROPOUT_MASK)
+            : nullptr;
+
+    return execute_thr(ithr, nthr, src, dst,
+            with_dropout ? &dropout_args : nullptr, dropout_mask);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_eltwise_fwd_t<isa>::execute_thr(int ithr, int nthr,
+        const uint8_t *src, uint8_t *dst, const dropout_args_t *dropout_args,
+        uint8_t *dropout_mask) const {
     const memory_desc_wrapper data_d(pd()->src_md());
     const auto nelems = data_d.nelems(true);
     // Number of elements in a cacheline. We don't want threads to share
-    const int cacheline_elems = 64 / data_d.data_type_size();
+    // cachelines, nor to leave whole vectors to the scalar tail loop, which
+    // matters when the vectors are longer than a cacheline.
+    const int cacheline_elems = nstl::max(64, static_cast<int>(simd_bytes(isa)))
+            / static_cast<int>(data_d.data_type_size());
 
     const data_type_t src_dt = pd()->src_md()->data_type;
     const auto offset_bytes
@@ -478,22 +645,24 @@ status_t jit_uni_eltwise_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     src += offset_bytes;
     dst += offset_bytes;
 
-    parallel(0, [&](const int ithr, const int nthr) {
-        dim_t start {0}, end {0};
-
-        balance211(
-                utils::div_up(nelems, cacheline_elems), nthr, ithr, start, end);
-        start = nstl::min(nelems, start * cacheline_elems);
-        end = nstl::min(nelems, end * cacheline_elems);
-        if (start == end) return;
-
-        jit_args_t args;
-        args.src = src + types::elements_to_bytes(src_dt, start);
-        args.dst = dst + types::elements_to_bytes(src_dt, start);
-        args.diff_dst = nullptr;
-        args.work_amount = end - start;
-        (*kernel_)(&args);
-    });
+    dim_t start {0}, end {0};
+    balance211(utils::div_up(nelems, cacheline_elems), nthr, ithr, start, end);
+    start = nstl::min(nelems, start * cacheline_elems);
+    end = nstl::min(nelems, end * cacheline_elems);
+    if (start == end) return status::success;
+
+    // The dropout mask is indexed by the dst offsets
+    const size_t idx0 = data_d.offset0();
+
+    jit_args_t args;
+    args.src = src + types::elements_to_bytes(src_dt, start);
+    args.dst = dst + types::elements_to_bytes(src_dt, start);
+    args.diff_dst = nullptr;
+    args.work_amount = end - start;
+    args.dropout_args = dropout_args;
+    args.dropout_mask = dropout_mask ? dropout_mask + idx0 + start : nullptr;
+    args.idx = idx0 + start;
+    (*kernel_)(&args);
 
     return status::success;
 }
@@ -562,7 +731,10 @@ status_t jit_uni_eltwise_bwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     const memory_desc_wrapper diff_data_d(pd()->diff_src_md());
     const auto nelems = data_d.nelems(true);
     // Number of elements in a cacheline. We don't want threads to share
-    const int cacheline_elems = 64 / data_d.data_type_size();
+    // cachelines, nor to leave whole vectors to the scalar tail loop, which
+    // matters when the vectors are longer than a cacheline.
+    const int cacheline_elems = nstl::max(64, static_cast<int>(simd_bytes(isa)))
+            / static_cast<int>(data_d.data_type_size());
 
     const data_type_t data_dt = pd()->use_dst() ? pd()->dst_md()->data_type
                                                 : pd()->src_md()->data_type;
@@ -589,6 +761,9 @@ status_t jit_uni_eltwise_bwd_t<isa>::execute(const exec_ctx_t &ctx) const {
         args.dst = diff_src + types::elements_to_bytes(data_dt, start);
         args.diff_dst = diff_dst + types::elements_to_bytes(data_dt, start);
         args.work_amount = end - start;
+        args.dropout_args = nullptr;
+        args.dropout_mask = nullptr;
+        args.idx = 0;
         (*kernel_)(&args);
     });
 
@@ -70,7 +70,7 @@ struct jit_uni_subkernel_int_t : public jit_uni_eltwise_int_kernel_t {
         assert(utils::one_of(desc.alg_kind, alg_kind::eltwise_relu,
                 alg_kind::eltwise_linear));
         assert(utils::one_of(data_type(), s32, data_type::s8, u8));
-        assert(isa == sve_512);
+        assert(utils::one_of(isa, sve_512, sve_256, sve_128));
     }
 
     void generate() override {
@@ -103,10 +103,13 @@ struct jit_uni_subkernel_int_t : public jit_uni_eltwise_int_kernel_t {
 
         eor(t_zero.d, t_zero.d, t_zero.d);
 
-        if (isa == sve_512) {
-            ptrue(p_vl1.b, VL1);
+        // The vector predicate covers exactly one vector of the isa, so that
+        // the kernel stays correct on hardware with a longer vector length.
+        ptrue(p_vl1.b, VL1);
+        if (isa == sve_512)
             ptrue(p_all_one.b);
-        }
+        else
+            set_preg(p_all_one.b, vlen);
 
         Label loop_label[3];
 
@@ -149,7 +152,7 @@ private:
 
     const PReg p_vl1 = p0;
     const PReg p_mask = p1;
-    const PReg p_mask_int8 = p_vl1; // Mask for store 1 byte in case of SVE_512
+    const PReg p_mask_int8 = p_vl1; // Mask for store 1 byte
     const PReg p_all_one = p3;
 
     bool is32bit() const { return data_type() == data_type::s32; }
@@ -160,7 +163,7 @@ private:
 
         if (vectorize) {
             // load full TReg size
-            uni_ldr(vr_from, mem_from);
+            ld1w(vr_from.s, p_all_one / T_z, ptr(mem_from));
         } else {
             // load exactly one data item
             ldr(W_TMP_0, ptr(mem_from));
@@ -174,15 +177,11 @@ private:
 
         // data type u8/s8 load as s32
         if (vectorize) {
-            // load full TReg size
-            ldr(QReg(t_tmp0.getIdx()), ptr(mem_from));
-            zip1(t_tmp0.b, t_tmp0.b, t_tmp0.b);
-            zip1(t_tmp0.h, t_tmp0.h, t_tmp0.h);
-
+            // load full TReg size, widening each byte to s32
             if (is_signed)
-                sxtb(vr_from.s, p_all_one / T_m, t_tmp0.s);
+                ld1sb(vr_from.s, p_all_one / T_z, ptr(mem_from));
             else
-                uxtb(vr_from.s, p_all_one / T_m, t_tmp0.s);
+                ld1b(vr_from.s, p_all_one / T_z, ptr(mem_from));
         } else {
             // load exactly one data item
             ldurb(W_TMP_0, ptr(mem_from));
@@ -217,14 +216,14 @@ private:
             const bool vectorize, const XReg &mem_to, const TReg &vr_to) {
         if (vectorize) {
             // store full TReg size
-            uni_str(vr_to, mem_to);
+            st1w(vr_to.s, p_all_one, ptr(mem_to));
         } else {
             // store exactly one data item
             st1w(vr_to.s, p_vl1, ptr(mem_to));
         }
     }
 
-    // Store 8 bit int - isa-dependent
+    // Store 8 bit int
     void store_8bit(const bool vectorize, const XReg &mem_to, const TReg &vr_to,
             bool is_signed);
 
@@ -292,12 +291,6 @@ void jit_uni_subkernel_int_t<isa>::process_linear(
 template <cpu_isa_t isa>
 void jit_uni_subkernel_int_t<isa>::process_relu(
         const TReg &vr_to, const TReg &vr_from) {
-    assert(!"unsupported isa");
-}
-
-template <>
-void jit_uni_subkernel_int_t<sve_512>::process_relu(
-        const TReg &vr_to, const TReg &vr_from) {
 
     scvtf(vr_from.s, p_all_one / T_m, vr_from.s);
 
@@ -314,12 +307,6 @@ void jit_uni_subkernel_int_t<sve_512>::process_relu(
 template <cpu_isa_t isa>
 void jit_uni_subkernel_int_t<isa>::store_8bit(const bool vectorize,
         const XReg &mem_to, const TReg &vr_to, bool is_signed) {
-    assert(!"unsupported isa");
-}
-
-template <>
-void jit_uni_subkernel_int_t<sve_512>::store_8bit(const bool vectorize,
-        const XReg &mem_to, const TReg &vr_to, bool is_signed) {
     if (vectorize) {
         // store full TReg size
         mov(t_tmp0.d, vr_to.d);
@@ -418,6 +405,12 @@ using namespace data_type;
 template struct jit_uni_eltwise_int_fwd_t<sve_512, s32>;
 template struct jit_uni_eltwise_int_fwd_t<sve_512, data_type::s8>;
 template struct jit_uni_eltwise_int_fwd_t<sve_512, u8>;
+template struct jit_uni_eltwise_int_fwd_t<sve_256, s32>;
+template struct jit_uni_eltwise_int_fwd_t<sve_256, data_type::s8>;
+template struct jit_uni_eltwise_int_fwd_t<sve_256, u8>;
+template struct jit_uni_eltwise_int_fwd_t<sve_128, s32>;
+template struct jit_uni_eltwise_int_fwd_t<sve_128, data_type::s8>;
+template struct jit_uni_eltwise_int_fwd_t<sve_128, u8>;
 
 } // namespace aarch64
 } // namespace cpu
@@ -0,0 +1,326 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_uni_global_pooling.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+using namespace dnnl::impl::utils;
+
+#define GET_OFF(field) static_cast<int32_t>(offsetof(call_params_t, field))
+
+namespace {
+struct call_params_t {
+    const void *src;
+    float *dst;
+    size_t sp;
+    size_t c_len;
+};
+} // namespace
+
+// Reduces sp spatial points of c_len channels into f32 sums or maxima.
+template <cpu_isa_t isa>
+struct jit_uni_global_pool_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_global_pool_kernel_t)
+
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    static constexpr int ur_c = 4;
+
+    jit_uni_global_pool_kernel_t(const jit_global_pool_conf_t &conf)
+        : jit_generator_t(), conf_(conf) {}
+
+private:
+    XReg reg_param = abi_param1;
+    XReg reg_src = x1;
+    XReg reg_dst = x2;
+    XReg reg_sp = x3;
+    XReg reg_c_len = x4;
+    XReg reg_c = x5;
+    XReg reg_src_row = x6;
+    XReg reg_sp_iter = x7;
+    XReg reg_lane_s = x8;
+    XReg reg_lane_e = x9;
+
+    PReg mask(int idx) const { return PReg(1 + idx); }
+    ZReg vacc(int idx) const { return ZReg(idx); }
+    ZReg vsrc(int idx) const { return ZReg(ur_c + idx); }
+    ZReg vinit = z31;
+
+    void load_src(const ZReg &z, const PReg &p, const XReg &addr) {
+        switch (conf_.src_dt) {
+            case data_type::f32: ld1w(z.s, p / T_z, ptr(addr)); break;
+            case data_type::bf16:
+                ld1h(z.s, p / T_z, ptr(addr));
+                lsl(z.s, z.s, 16);
+                break;
+            case data_type::f16:
+                ld1h(z.s, p / T_z, ptr(addr));
+                fcvt(z.s, p / T_m, z.h);
+                break;
+            case data_type::s8:
+                ld1sb(z.s, p / T_z, ptr(addr));
+                scvtf(z.s, p / T_m, z.s);
+                break;
+            case data_type::u8:
+                ld1b(z.s, p / T_z, ptr(addr));
+                ucvtf(z.s, p / T_m, z.s);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    void generate() override {
+        const bool is_max = conf_.alg == alg_kind::pooling_max;
+        const int src_dt_size = types::data_type_size(conf_.src_dt);
+        const int src_dt_shift = math::ilog2q(src_dt_size);
+        const size_t row_stride = conf_.c * src_dt_size;
+
+        preamble();
+
+        ldr(reg_src, ptr(reg_param, GET_OFF(src)));
+        ldr(reg_dst, ptr(reg_param, GET_OFF(dst)));
+        ldr(reg_sp, ptr(reg_param, GET_OFF(sp)));
+        ldr(reg_c_len, ptr(reg_param, GET_OFF(c_len)));
+
+        if (is_max) {
+            mov_imm(W_TMP_0, float2int(nstl::numeric_limits<float>::lowest()));
+            dup(vinit.s, W_TMP_0);
+        } else {
+            eor(vinit.d, vinit.d, vinit.d);
+        }
+
+        eor(reg_c, reg_c, reg_c);
+        Label l_c_loop;
+        L(l_c_loop);
+        {
+            // The lanes of a vector never exceed the isa vector length, which
+            // may be shorter than the hardware one
+            for (int i = 0; i < ur_c; i++) {
+                add_imm(reg_lane_s, reg_c, i * simd_w, X_TMP_0);
+                add_imm(reg_lane_e, reg_lane_s, simd_w, X_TMP_0);
+                cmp(reg_lane_e, reg_c_len);
+                csel(reg_lane_e, reg_lane_e, reg_c_len, LT);
+                whilelt(mask(i).s, reg_lane_s, reg_lane_e);
+                mov(vacc(i).d, vinit.d);
+            }
+
+            add(reg_src_row, reg_src, reg_c, LSL, src_dt_shift);
+            mov(reg_sp_iter, reg_sp);
+            Label l_sp_loop;
+            L(l_sp_loop);
+            {
+                for (int i = 0; i < ur_c; i++) {
+                    add_imm(X_DEFAULT_ADDR, reg_src_row,
+                            i * simd_w * src_dt_size, X_TMP_0);
+                    load_src(vsrc(i), mask(i), X_DEFAULT_ADDR);
+                    if (is_max)
+                        fmax(vacc(i).s, mask(i) / T_m, vsrc(i).s);
+                    else
+                        fadd(vacc(i).s, mask(i) / T_m, vsrc(i).s);
+                }
+                add_imm(reg_src_row, reg_src_row, row_stride, X_TMP_0);
+                subs(reg_sp_iter, reg_sp_iter, 1);
+                b(NE, l_sp_loop);
+            }
+
+            add(X_TMP_1, reg_dst, reg_c, LSL, 2);
+            for (int i = 0; i < ur_c; i++) {
+                add_imm(X_DEFAULT_ADDR, X_TMP_1, i * simd_w * sizeof(float),
+                        X_TMP_0);
+                st1w(vacc(i).s, mask(i), ptr(X_DEFAULT_ADDR));
+            }
+
+            add_imm(reg_c, reg_c, ur_c * simd_w, X_TMP_0);
+            cmp(reg_c, reg_c_len);
+            b(LT, l_c_loop);
+        }
+
+        postamble();
+    }
+
+    const jit_global_pool_conf_t conf_;
+};
+
+template <cpu_isa_t isa>
+bool jit_uni_global_pooling_fwd_t<isa>::pd_t::is_global() const {
+    return ID() == KD() && IH() == KH() && IW() == KW() && OD() == 1
+            && OH() == 1 && OW() == 1 && padFront() == 0 && padBack() == 0
+            && padT() == 0 && padB() == 0 && padL() == 0 && padR() == 0;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_global_pooling_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace alg_kind;
+
+    const data_type_t src_dt = src_md()->data_type;
+    const data_type_t dst_dt = dst_md()->data_type;
+    const format_tag_t desired_fmt_tag = utils::pick(ndims() - 3,
+            format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
+
+    VDISPATCH_POOLING(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_POOLING(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_POOLING(utils::one_of(desc()->alg_kind, pooling_max,
+                              pooling_avg_include_padding,
+                              pooling_avg_exclude_padding),
+            VERBOSE_BAD_ALGORITHM);
+    // max pooling for training needs a workspace with the indices
+    const bool is_inference
+            = desc()->prop_kind == prop_kind::forward_inference;
+    VDISPATCH_POOLING(
+            IMPLICATION(desc()->alg_kind == pooling_max, is_inference),
+            VERBOSE_BAD_PROPKIND);
+    VDISPATCH_POOLING(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_POOLING(utils::one_of(src_dt, f32, bf16, f16, s8, u8)
+                    && utils::one_of(dst_dt, f32, bf16, f16, s8, u8),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_POOLING(platform::has_data_type_support(src_dt)
+                    && platform::has_data_type_support(dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_POOLING(!is_dilated(), VERBOSE_UNSUPPORTED_FEATURE,
+            "does not support dilations");
+    VDISPATCH_POOLING(is_global(), VERBOSE_UNSUPPORTED_FEATURE,
+            "window does not cover the whole spatial");
+    VDISPATCH_POOLING(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_POOLING(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_POOLING(memory_desc_matches_tag(*src_md(), desired_fmt_tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VDISPATCH_POOLING(memory_desc_matches_tag(*dst_md(), desired_fmt_tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+
+    conf_.mb = MB();
+    conf_.c = IC();
+    conf_.sp = ID() * IH() * IW();
+    conf_.alg = desc()->alg_kind;
+    conf_.src_dt = src_dt;
+    conf_.dst_dt = dst_dt;
+
+    conf_.c_block = jit_uni_global_pool_kernel_t<isa>::ur_c
+            * jit_uni_global_pool_kernel_t<isa>::simd_w;
+    conf_.nb_c = div_up(conf_.c, conf_.c_block);
+
+    // Split the spatial only when the batch and the channels leave threads
+    // idle, and keep enough points per thread to amortize the reduction
+    const int nthr = dnnl_get_max_threads();
+    const dim_t work = conf_.mb * conf_.nb_c;
+    const dim_t min_sp_per_thr = 16;
+    conf_.nthr_sp = 1;
+    if (work < nthr)
+        conf_.nthr_sp = (int)nstl::max<dim_t>(1,
+                nstl::min<dim_t>(
+                        nthr / work, div_up(conf_.sp, min_sp_per_thr)));
+    conf_.sp_block = div_up(conf_.sp, conf_.nthr_sp);
+    conf_.nthr_sp = (int)div_up(conf_.sp, conf_.sp_block);
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_global_pooling_fwd_t<isa>::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_pool_reduction, conf_.nthr_sp * conf_.mb * conf_.c);
+}
+
+template <cpu_isa_t isa>
+jit_uni_global_pooling_fwd_t<isa>::jit_uni_global_pooling_fwd_t(
+        const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <cpu_isa_t isa>
+jit_uni_global_pooling_fwd_t<isa>::~jit_uni_global_pooling_fwd_t() = default;
+
+template <cpu_isa_t isa>
+status_t jit_uni_global_pooling_fwd_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(
+            ker_, new jit_uni_global_pool_kernel_t<isa>(pd()->conf_)));
+    return ker_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_global_pooling_fwd_t<isa>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const auto &conf = pd()->conf_;
+    float *acc = ctx.get_scratchpad_grantor().template get<float>(
+            key_pool_reduction);
+    const size_t src_dt_size = types::data_type_size(conf.src_dt);
+
+    parallel_nd(conf.nthr_sp, conf.mb, conf.nb_c,
+            [&](dim_t isp, dim_t n, dim_t bc) {
+        const dim_t sp_s = isp * conf.sp_block;
+        const dim_t sp_e = nstl::min(conf.sp, sp_s + conf.sp_block);
+        const dim_t c_s = bc * conf.c_block;
+
+        call_params_t p;
+        p.src = src + ((n * conf.sp + sp_s) * conf.c + c_s) * src_dt_size;
+        p.dst = acc + (isp * conf.mb + n) * conf.c + c_s;
+        p.sp = sp_e - sp_s;
+        p.c_len = nstl::min(conf.c_block, conf.c - c_s);
+        (*ker_)(&p);
+    });
+
+    // The partial results are combined, averaged, and converted
+    const bool is_max = conf.alg == alg_kind::pooling_max;
+    const float divider = 1.f / conf.sp;
+    parallel_nd(conf.mb, conf.nb_c, [&](dim_t n, dim_t bc) {
+        const dim_t c_s = bc * conf.c_block;
+        const dim_t c_e = nstl::min(conf.c, c_s + conf.c_block);
+        for (dim_t c = c_s; c < c_e; c++) {
+            float res = acc[n * conf.c + c];
+            for (int isp = 1; isp < conf.nthr_sp; isp++) {
+                const float v = acc[(isp * conf.mb + n) * conf.c + c];
+                res = is_max ? nstl::max(res, v) : res + v;
+            }
+            if (!is_max) res *= divider;
+            io::store_float_value(conf.dst_dt, res, dst, n * conf.c + c);
+        }
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_global_pooling_fwd_t<sve_512>;
+template struct jit_uni_global_pooling_fwd_t<sve_256>;
+template struct jit_uni_global_pooling_fwd_t<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_GLOBAL_POOLING_HPP
+#define CPU_AARCH64_JIT_UNI_GLOBAL_POOLING_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_pooling_pd.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct jit_global_pool_conf_t {
+    dim_t mb, c, sp;
+    alg_kind_t alg;
+    data_type_t src_dt, dst_dt;
+
+    // channels processed by one kernel call
+    dim_t c_block;
+    dim_t nb_c;
+    // the spatial is split between the threads when mb * nb_c is small
+    int nthr_sp;
+    dim_t sp_block;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_global_pool_kernel_t;
+
+// Pooling with the window covering the whole spatial, as found at the end of
+// CNNs. The spatial is reduced in f32 by a vectorized kernel, split between
+// the threads when the batch and the channels do not provide enough work.
+template <cpu_isa_t isa>
+struct jit_uni_global_pooling_fwd_t : public primitive_t {
+    struct pd_t : public cpu_pooling_fwd_pd_t {
+        using cpu_pooling_fwd_pd_t::cpu_pooling_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit_global:", isa, ""),
+                jit_uni_global_pooling_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_global_pool_conf_t conf_;
+
+    private:
+        bool is_global() const;
+        void init_scratchpad();
+    };
+
+    jit_uni_global_pooling_fwd_t(const pd_t *apd);
+    ~jit_uni_global_pooling_fwd_t() override;
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_global_pool_kernel_t<isa>> ker_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,618 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cassert>
+#include <cmath>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/injectors/jit_uni_postops_injector.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_uni_group_normalization.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+#define GET_STAT_OFF(field) (uint32_t) offsetof(stat_call_params_t, field)
+#define GET_NORM_OFF(field) (uint32_t) offsetof(norm_call_params_t, field)
+
+using pd_t = jit_uni_group_normalization_fwd_t::pd_t;
+using stat_call_params_t
+        = jit_uni_group_normalization_fwd_t::stat_call_params_t;
+using norm_call_params_t
+        = jit_uni_group_normalization_fwd_t::norm_call_params_t;
+
+namespace {
+
+cpu_isa_t get_supported_isa() {
+    if (mayiuse(sve_512)) return sve_512;
+    if (mayiuse(sve_256)) return sve_256;
+    if (mayiuse(sve_128)) return sve_128;
+    return isa_undef;
+}
+
+const bcast_set_t &get_supported_bcast_strategies() {
+    static const bcast_set_t supported_strategies
+            = {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
+                    broadcasting_strategy_t::per_oc_spatial};
+    return supported_strategies;
+}
+
+// Common SVE helpers of the statistics and the normalization kernels. Both
+// walk the C contiguous channels of a spatial point with full vectors and a
+// predicated tail.
+template <cpu_isa_t isa>
+struct jit_gnorm_base_t : public jit_generator_t {
+    jit_gnorm_base_t(const pd_t *pd)
+        : jit_generator_t(nullptr, MAX_CODE_SIZE, true, isa)
+        , C_(pd->C())
+        , src_dt_(pd->src_md()->data_type)
+        , dst_dt_(pd->dst_md()->data_type)
+        , tail_size_(C_ % simd_w_) {}
+
+protected:
+    static constexpr int vlen_ = cpu_isa_traits<isa>::vlen;
+    static constexpr dim_t simd_w_ = vlen_ / sizeof(float);
+    static constexpr int unroll_ = 4;
+
+    void init_predicates() {
+        switch (simd_w_) {
+            case 16: ptrue(p_full_.s, VL16); break;
+            case 8: ptrue(p_full_.s, VL8); break;
+            case 4: ptrue(p_full_.s, VL4); break;
+            default: assert(!"unreachable");
+        }
+        if (tail_size_ > 0) set_preg(p_tail_.s, tail_size_, X_TMP_0, X_TMP_1);
+    }
+
+    void load(const ZReg &vmm, const XReg &addr, const PReg &p,
+            data_type_t dt) {
+        switch (dt) {
+            case data_type::f32: ld1w(vmm.s, p / T_z, ptr(addr)); break;
+            case data_type::bf16:
+                ld1h(vmm.s, p / T_z, ptr(addr));
+                lsl(vmm.s, vmm.s, 16);
+                break;
+            case data_type::f16:
+                ld1h(vmm.s, p / T_z, ptr(addr));
+                fcvt(vmm.s, p_full_ / T_m, vmm.h);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    void store(const ZReg &vmm, const XReg &addr, const PReg &p,
+            data_type_t dt) {
+        switch (dt) {
+            case data_type::f32: st1w(vmm.s, p, ptr(addr)); break;
+            case data_type::bf16:
+                bfcvt(vmm.h, p_full_ / T_m, vmm.s);
+                st1h(vmm.s, p, ptr(addr));
+                break;
+            case data_type::f16:
+                fcvt(vmm.h, p_full_ / T_m, vmm.s);
+                st1h(vmm.s, p, ptr(addr));
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    // Address of the vector `v` away from `base` for elements of `dt`.
+    XReg vec_addr(const XReg &base, dim_t v, data_type_t dt) {
+        const dim_t off = v * simd_w_ * types::data_type_size(dt);
+        if (off == 0) return base;
+        add_imm(X_DEFAULT_ADDR, base, off, X_TMP_0);
+        return X_DEFAULT_ADDR;
+    }
+
+    const PReg p_full_ = p2;
+    const PReg p_tail_ = p3;
+
+    const dim_t C_;
+    const data_type_t src_dt_;
+    const data_type_t dst_dt_;
+    const dim_t tail_size_;
+};
+
+// Computes the per-channel running mean and M2 (the sum of squared
+// deviations from the mean) of `sp_size` consecutive spatial points with
+// Welford's algorithm:
+//   k += 1; delta = x - mean; mean += delta / k; M2 += delta * (x - mean)
+// The channels are processed in blocks of `unroll_` vectors so the whole
+// state stays in registers while walking the spatial points.
+template <cpu_isa_t isa>
+struct kernel_stat_t
+    : public jit_uni_group_normalization_fwd_t::kernel_stat_base_t,
+      public jit_gnorm_base_t<isa> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(kernel_stat_t)
+
+    using base_t = jit_gnorm_base_t<isa>;
+
+    kernel_stat_t(const pd_t *pd) : base_t(pd) {}
+
+    status_t create_kernel() override { return base_t::create_kernel(); }
+    void operator()(const stat_call_params_t *p) const override {
+        base_t::operator()(p);
+    }
+
+private:
+    using base_t::C_;
+    using base_t::p_full_;
+    using base_t::p_tail_;
+    using base_t::simd_w_;
+    using base_t::src_dt_;
+    using base_t::tail_size_;
+    using base_t::unroll_;
+
+    ZReg vmm_mean(int i) const { return ZReg(i); }
+    ZReg vmm_m2(int i) const { return ZReg(unroll_ + i); }
+    ZReg vmm_src(int i) const { return ZReg(2 * unroll_ + i); }
+    ZReg vmm_delta(int i) const { return ZReg(3 * unroll_ + i); }
+    const ZReg vmm_count_ = ZReg(16);
+    const ZReg vmm_one_ = ZReg(17);
+    const ZReg vmm_inv_count_ = ZReg(18);
+
+    const XReg reg_param_ = XReg(0);
+    const XReg reg_src_base_ = XReg(1);
+    const XReg reg_mean_ = XReg(2);
+    const XReg reg_m2_ = XReg(3);
+    const XReg reg_sp_size_ = XReg(4);
+    const XReg reg_src_ = XReg(5);
+    const XReg reg_sp_work_ = XReg(6);
+    const XReg reg_sp_stride_ = XReg(7);
+
+    void compute_block(dim_t v_start, int nvecs) {
+        const auto pred = [&](int i) {
+            const bool is_tail = v_start + i == C_ / simd_w_;
+            return is_tail ? p_tail_ : p_full_;
+        };
+
+        for (int i = 0; i < nvecs; i++) {
+            this->dup(vmm_mean(i).s, 0);
+            this->dup(vmm_m2(i).s, 0);
+        }
+        this->dup(vmm_count_.s, 0);
+
+        this->add_imm(reg_src_, reg_src_base_,
+                v_start * simd_w_ * types::data_type_size(src_dt_),
+                this->X_TMP_0);
+        this->mov(reg_sp_work_, reg_sp_size_);
+
+        Label l_sp_loop;
+        this->L(l_sp_loop);
+        {
+            // All lanes see the same number of points, so 1 / k is computed
+            // once per spatial point and shared by every channel.
+            this->fadd(SReg(vmm_count_.getIdx()), SReg(vmm_count_.getIdx()),
+                    SReg(vmm_one_.getIdx()));
+            this->fdiv(SReg(vmm_inv_count_.getIdx()), SReg(vmm_one_.getIdx()),
+                    SReg(vmm_count_.getIdx()));
+            this->dup(vmm_inv_count_.s, vmm_inv_count_.s[0]);
+
+            for (int i = 0; i < nvecs; i++)
+                this->load(vmm_src(i), this->vec_addr(reg_src_, i, src_dt_),
+                        pred(i), src_dt_);
+            for (int i = 0; i < nvecs; i++) {
+                this->fsub(vmm_delta(i).s, vmm_src(i).s, vmm_mean(i).s);
+                this->fmla(vmm_mean(i).s, p_full_ / T_m, vmm_delta(i).s,
+                        vmm_inv_count_.s);
+                this->fsub(vmm_src(i).s, vmm_src(i).s, vmm_mean(i).s);
+                this->fmla(vmm_m2(i).s, p_full_ / T_m, vmm_delta(i).s,
+                        vmm_src(i).s);
+            }
+
+            this->add(reg_src_, reg_src_, reg_sp_stride_);
+            this->subs(reg_sp_work_, reg_sp_work_, 1);
+            this->b(NE, l_sp_loop);
+        }
+
+        for (int i = 0; i < nvecs; i++) {
+            const dim_t v = v_start + i;
+            this->st1w(vmm_mean(i).s, pred(i),
+                    ptr(this->vec_addr(reg_mean_, v, data_type::f32)));
+            this->st1w(vmm_m2(i).s, pred(i),
+                    ptr(this->vec_addr(reg_m2_, v, data_type::f32)));
+        }
+    }
+
+    void generate() override {
+        this->preamble();
+        this->init_predicates();
+
+        this->ldr(reg_src_base_, ptr(reg_param_, GET_STAT_OFF(src)));
+        this->ldr(reg_mean_, ptr(reg_param_, GET_STAT_OFF(mean)));
+        this->ldr(reg_m2_, ptr(reg_param_, GET_STAT_OFF(m2)));
+        this->ldr(reg_sp_size_, ptr(reg_param_, GET_STAT_OFF(sp_size)));
+        this->mov_imm(reg_sp_stride_, C_ * types::data_type_size(src_dt_));
+        this->init_vmm(vmm_one_, this->X_TMP_0, 1.f);
+
+        const dim_t nvecs = utils::div_up(C_, simd_w_);
+        for (dim_t v = 0; v < nvecs; v += unroll_)
+            compute_block(
+                    v, static_cast<int>(nstl::min<dim_t>(unroll_, nvecs - v)));
+
+        this->postamble();
+    }
+};
+
+// dst = src * mul + add, followed by the post-ops. `mul` and `add` hold the
+// per-channel combination of mean, variance, scale and shift of the image.
+template <cpu_isa_t isa>
+struct kernel_norm_t
+    : public jit_uni_group_normalization_fwd_t::kernel_norm_base_t,
+      public jit_gnorm_base_t<isa> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(kernel_norm_t)
+
+    using base_t = jit_gnorm_base_t<isa>;
+
+    kernel_norm_t(const pd_t *pd)
+        : base_t(pd), post_ops_(pd->attr()->post_ops_) {
+        if (post_ops_.len() == 0) return;
+
+        const memory_desc_wrapper dst_d(pd->dst_md());
+        static constexpr bool preserve_gpr = true;
+        static constexpr bool preserve_vmm = true;
+        static constexpr bool use_exact_tail_scalar_bcast = false;
+        const binary_injector::rhs_arg_static_params_t rhs_arg_bsp {
+                static_cast<size_t>(rhs_dt_helper_vmm_.getIdx()),
+                reg_po_injector_helper_1_, reg_po_injector_helper_2_,
+                reg_po_injector_helper_3_, preserve_gpr, preserve_vmm,
+                GET_NORM_OFF(post_ops_binary_rhs_arg_vec),
+                GET_NORM_OFF(dst_orig),
+                dst_d, static_cast<size_t>(tail_size_), p_tail_,
+                use_exact_tail_scalar_bcast};
+        const binary_injector::static_params_t bsp(
+                reg_param_, get_supported_bcast_strategies(), rhs_arg_bsp);
+        postops_injector_ = utils::make_unique<
+                injector::jit_uni_postops_injector_t<to_vla_sve(isa)>>(
+                this, post_ops_, bsp);
+    }
+
+    status_t create_kernel() override { return base_t::create_kernel(); }
+    void operator()(const norm_call_params_t *p) const override {
+        base_t::operator()(p);
+    }
+
+private:
+    using base_t::C_;
+    using base_t::dst_dt_;
+    using base_t::p_full_;
+    using base_t::p_tail_;
+    using base_t::simd_w_;
+    using base_t::src_dt_;
+    using base_t::tail_size_;
+    using base_t::unroll_;
+
+    ZReg vmm_data(int i) const { return ZReg(16 + i); }
+    ZReg vmm_mul(int i) const { return ZReg(16 + unroll_ + i); }
+    ZReg vmm_add(int i) const { return ZReg(16 + 2 * unroll_ + i); }
+    const ZReg rhs_dt_helper_vmm_ = ZReg(31);
+
+    const XReg reg_param_ = XReg(0);
+    const XReg reg_src_ = XReg(1);
+    const XReg reg_dst_ = XReg(2);
+    const XReg reg_mul_base_ = XReg(3);
+    const XReg reg_add_base_ = XReg(4);
+    const XReg reg_sp_work_ = XReg(5);
+    const XReg reg_mul_ = XReg(6);
+    const XReg reg_add_ = XReg(7);
+    const XReg reg_c_work_ = XReg(8);
+    const XReg reg_po_injector_helper_1_ = XReg(14);
+    const XReg reg_po_injector_helper_2_ = XReg(15);
+    const XReg reg_po_injector_helper_3_ = XReg(13);
+
+    const post_ops_t post_ops_;
+    std::unique_ptr<injector::jit_uni_postops_injector_t<to_vla_sve(isa)>>
+            postops_injector_;
+
+    void compute(int nvecs, bool is_tail) {
+        const PReg &p = is_tail ? p_tail_ : p_full_;
+        for (int i = 0; i < nvecs; i++) {
+            this->load(vmm_data(i), this->vec_addr(reg_src_, i, src_dt_), p,
+                    src_dt_);
+            this->ld1w(vmm_mul(i).s, p / T_z,
+                    ptr(this->vec_addr(reg_mul_, i, data_type::f32)));
+            this->ld1w(vmm_add(i).s, p / T_z,
+                    ptr(this->vec_addr(reg_add_, i, data_type::f32)));
+            this->fmad(vmm_data(i).s, p_full_ / T_m, vmm_mul(i).s,
+                    vmm_add(i).s);
+        }
+
+        if (postops_injector_) {
+            binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+            for (int i = 0; i < nvecs; i++) {
+                const int idx = vmm_data(i).getIdx();
+                rhs_arg_params.vmm_idx_to_out_reg.emplace(idx, reg_dst_);
+                rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(
+                        idx, i * simd_w_ * types::data_type_size(dst_dt_));
+                if (is_tail) rhs_arg_params.vmm_tail_idx_.emplace(idx);
+            }
+            postops_injector_->compute_vector_range(vmm_data(0).getIdx(),
+                    vmm_data(0).getIdx() + nvecs, rhs_arg_params);
+        }
+
+        for (int i = 0; i < nvecs; i++)
+            this->store(vmm_data(i), this->vec_addr(reg_dst_, i, dst_dt_), p,
+                    dst_dt_);
+
+        const dim_t nelems = is_tail ? tail_size_ : nvecs * simd_w_;
+        this->add_imm(reg_src_, reg_src_,
+                nelems * types::data_type_size(src_dt_), this->X_TMP_0);
+        this->add_imm(reg_dst_, reg_dst_,
+                nelems * types::data_type_size(dst_dt_), this->X_TMP_0);
+        this->add_imm(
+                reg_mul_, reg_mul_, nelems * sizeof(float), this->X_TMP_0);
+        this->add_imm(
+                reg_add_, reg_add_, nelems * sizeof(float), this->X_TMP_0);
+    }
+
+    void generate() override {
+        this->preamble();
+        this->init_predicates();
+
+        this->ldr(reg_src_, ptr(reg_param_, GET_NORM_OFF(src)));
+        this->ldr(reg_dst_, ptr(reg_param_, GET_NORM_OFF(dst)));
+        this->ldr(reg_mul_base_, ptr(reg_param_, GET_NORM_OFF(mul)));
+        this->ldr(reg_add_base_, ptr(reg_param_, GET_NORM_OFF(add)));
+        this->ldr(reg_sp_work_, ptr(reg_param_, GET_NORM_OFF(sp_size)));
+
+        const dim_t nvecs = C_ / simd_w_;
+        const dim_t nblocks = nvecs / unroll_;
+        const int nvecs_rem = static_cast<int>(nvecs % unroll_);
+
+        // Channels are innermost, so src and dst are walked linearly and
+        // only the coefficient pointers go back to the start for every
+        // spatial point.
+        Label l_sp_loop;
+        this->L(l_sp_loop);
+        {
+            this->mov(reg_mul_, reg_mul_base_);
+            this->mov(reg_add_, reg_add_base_);
+
+            if (nblocks > 0) {
+                Label l_c_loop;
+                this->mov_imm(reg_c_work_, nblocks);
+                this->L(l_c_loop);
+                compute(unroll_, false);
+                this->subs(reg_c_work_, reg_c_work_, 1);
+                this->b(NE, l_c_loop);
+            }
+            if (nvecs_rem > 0) compute(nvecs_rem, false);
+            if (tail_size_ > 0) compute(1, true);
+
+            this->subs(reg_sp_work_, reg_sp_work_, 1);
+            this->b(NE, l_sp_loop);
+        }
+
+        this->postamble();
+
+        if (postops_injector_) postops_injector_->prepare_table();
+    }
+};
+
+} // namespace
+
+jit_uni_group_normalization_fwd_t::kernel_stat_base_t *
+jit_uni_group_normalization_fwd_t::kernel_stat_base_t::create(const pd_t *pd) {
+    switch (pd->isa_) {
+        case sve_512: return new kernel_stat_t<sve_512>(pd);
+        case sve_256: return new kernel_stat_t<sve_256>(pd);
+        case sve_128: return new kernel_stat_t<sve_128>(pd);
+        default: assert(!"kernel is empty."); return nullptr;
+    }
+}
+
+jit_uni_group_normalization_fwd_t::kernel_norm_base_t *
+jit_uni_group_normalization_fwd_t::kernel_norm_base_t::create(const pd_t *pd) {
+    switch (pd->isa_) {
+        case sve_512: return new kernel_norm_t<sve_512>(pd);
+        case sve_256: return new kernel_norm_t<sve_256>(pd);
+        case sve_128: return new kernel_norm_t<sve_128>(pd);
+        default: assert(!"kernel is empty."); return nullptr;
+    }
+}
+
+status_t jit_uni_group_normalization_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    isa_ = get_supported_isa();
+
+    VDISPATCH_GNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_GNORM(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_GNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "src");
+    VDISPATCH_GNORM(utils::one_of(src_md()->data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(utils::one_of(dst_md()->data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GNORM(IMPLICATION(dst_md()->data_type == bf16, mayiuse_bf16()),
+            VERBOSE_ISA_DT_MISMATCH);
+    VDISPATCH_GNORM(check_scale_shift_data_type(), VERBOSE_UNSUPPORTED_FEATURE,
+            "unsupported scale or shift data type");
+    VDISPATCH_GNORM(attr()->has_default_values(skip_mask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_GNORM(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_GNORM(
+            memory_desc_matches_one_of_tag(*src_md(), ndhwc, nhwc, nwc, nc),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VDISPATCH_GNORM(
+            memory_desc_matches_one_of_tag(*dst_md(), ndhwc, nhwc, nwc, nc),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+    VDISPATCH_GNORM(impl::is_dense_format_kind({src_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const std::vector<injector::post_op_type> accepted_post_ops
+            = {injector::eltwise, injector::binary};
+    const memory_desc_wrapper dst_d(dst_md());
+    injector::post_ops_ok_args_t post_ops_args(isa_, accepted_post_ops,
+            attr()->post_ops_, &dst_d, true, true, true, true,
+            get_supported_bcast_strategies());
+    VDISPATCH_GNORM(attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_GNORM(
+            injector::post_ops_ok(post_ops_args), VERBOSE_UNSUPPORTED_POSTOP);
+
+    // Split the spatial dimension so that every thread gets a share even
+    // for a single image; each chunk carries its own partial statistics.
+    const int nthr = dnnl_get_max_threads();
+    const dim_t SP = D() * H() * W();
+    sp_nchunks_ = nstl::max<dim_t>(
+            1, nstl::min<dim_t>(SP, utils::div_up(nthr, MB())));
+
+    auto scratchpad = scratchpad_registry().registrar();
+    using namespace memory_tracking::names;
+    if (!stats_is_src()) {
+        const size_t reduction_sz = 2 * MB() * sp_nchunks_ * C();
+        scratchpad.template book<float>(key_gnorm_reduction, reduction_sz);
+        if (!is_training()) {
+            scratchpad.template book<float>(key_gnorm_tmp_mean, MB() * G());
+            scratchpad.template book<float>(key_gnorm_tmp_var, MB() * G());
+        }
+    }
+    // Per-image multiplier and addend of every channel.
+    scratchpad.template book<float>(key_gnorm_cvt, 2 * MB() * C());
+
+    return status::success;
+}
+
+status_t jit_uni_group_normalization_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
+    auto shift = CTX_IN_MEM(const float *, DNNL_ARG_SHIFT);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto stat_reduction = scratchpad.template get<float>(key_gnorm_reduction);
+    auto tmp_mean = scratchpad.template get<float>(key_gnorm_tmp_mean);
+    auto tmp_var = scratchpad.template get<float>(key_gnorm_tmp_var);
+    auto coeffs = scratchpad.template get<float>(key_gnorm_cvt);
+
+    float *mean {nullptr}, *variance {nullptr};
+    mean = pd()->stats_is_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN))
+            : pd()->is_training() ? CTX_OUT_MEM(float *, DNNL_ARG_MEAN)
+                                  : tmp_mean;
+    variance = pd()->stats_is_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
+            : pd()->is_training() ? CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE)
+                                  : tmp_var;
+
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(
+                    pd()->attr()->post_ops_, ctx);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const size_t src_dt_size = src_d.data_type_size();
+    const size_t dst_dt_size = dst_d.data_type_size();
+
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t C_PER_G = C / G;
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t nchunks = pd()->sp_nchunks_;
+    const float eps = pd()->desc()->group_norm_epsilon;
+
+    if (!pd()->stats_is_src()) {
+        float *chunk_mean = stat_reduction;
+        float *chunk_m2 = stat_reduction + N * nchunks * C;
+
+        parallel_nd(N, nchunks, [&](dim_t n, dim_t ichunk) {
+            dim_t sp_start = 0, sp_end = 0;
+            balance211(SP, nchunks, ichunk, sp_start, sp_end);
+            if (sp_start == sp_end) return;
+
+            const size_t stat_off = (n * nchunks + ichunk) * C;
+            stat_call_params_t p;
+            p.src = src + (n * SP + sp_start) * C * src_dt_size;
+            p.mean = chunk_mean + stat_off;
+            p.m2 = chunk_m2 + stat_off;
+            p.sp_size = sp_end - sp_start;
+            (*kernel_stat_)(&p);
+        });
+
+        // Chan's formula merges the per-chunk, per-channel partial
+        // statistics of a group without a second pass over the data.
+        parallel_nd(N, G, [&](dim_t n, dim_t g) {
+            double cnt = 0, m = 0, m2 = 0;
+            for_(dim_t ichunk = 0; ichunk < nchunks; ichunk++)
+            for (dim_t c = g * C_PER_G; c < (g + 1) * C_PER_G; c++) {
+                dim_t sp_start = 0, sp_end = 0;
+                balance211(SP, nchunks, ichunk, sp_start, sp_end);
+                const double cnt_b = static_cast<double>(sp_end - sp_start);
+                if (cnt_b == 0) continue;
+
+                const size_t off = (n * nchunks + ichunk) * C + c;
+                const double delta = chunk_mean[off] - m;
+                const double cnt_ab = cnt + cnt_b;
+                m += delta * cnt_b / cnt_ab;
+                m2 += chunk_m2[off] + delta * delta * cnt * cnt_b / cnt_ab;
+                cnt = cnt_ab;
+            }
+            mean[n * G + g] = static_cast<float>(m);
+            variance[n * G + g] = static_cast<float>(m2 / cnt);
+        });
+    }
+
+    parallel_nd(N, C, [&](dim_t n, dim_t c) {
+        const dim_t g = c / C_PER_G;
+        const float inv_std = 1.f / sqrtf(variance[n * G + g] + eps);
+        const float sc = scale ? scale[c] : 1.f;
+        const float sh = shift ? shift[c] : 0.f;
+        const float mul = sc * inv_std;
+        coeffs[(2 * n) * C + c] = mul;
+        coeffs[(2 * n + 1) * C + c] = sh - mean[n * G + g] * mul;
+    });
+
+    parallel_nd(N, nchunks, [&](dim_t n, dim_t ichunk) {
+        dim_t sp_start = 0, sp_end = 0;
+        balance211(SP, nchunks, ichunk, sp_start, sp_end);
+        if (sp_start == sp_end) return;
+
+        const size_t data_off = (n * SP + sp_start) * C;
+        norm_call_params_t p;
+        p.src = src + data_off * src_dt_size;
+        p.dst = dst + data_off * dst_dt_size;
+        p.mul = coeffs + (2 * n) * C;
+        p.add = coeffs + (2 * n + 1) * C;
+        p.sp_size = sp_end - sp_start;
+        p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
+        p.dst_orig = dst;
+        (*kernel_norm_)(&p);
+    });
+
+    return status::success;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_GROUP_NORMALIZATION_HPP
+#define CPU_AARCH64_JIT_UNI_GROUP_NORMALIZATION_HPP
+
+#include <memory>
+
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_group_normalization_pd.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Forward group normalization for channel-last (nspc) layouts. Instance
+// normalization is the C_PER_G == 1 case of the same algorithm.
+//
+// Statistics are computed in a single pass with Welford's update: every
+// thread takes a chunk of spatial points of one image and produces a running
+// mean and M2 per channel, the chunks are then merged per group. The mean and
+// inverse standard deviation are folded with scale and shift into one
+// multiplier and one addend per channel, so normalization is a single fma per
+// vector over contiguous channels.
+struct jit_uni_group_normalization_fwd_t : public primitive_t {
+    using primitive_t::primitive_t;
+
+    struct pd_t : public cpu_group_normalization_fwd_pd_t {
+        using cpu_group_normalization_fwd_pd_t::
+                cpu_group_normalization_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa_, ""),
+                jit_uni_group_normalization_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        cpu_isa_t isa_ = isa_undef;
+        // Number of chunks the spatial dimension of each image is split in.
+        dim_t sp_nchunks_ = 1;
+    };
+
+    struct stat_call_params_t {
+        const void *src;
+        float *mean;
+        float *m2;
+        size_t sp_size;
+    };
+
+    struct norm_call_params_t {
+        const void *src;
+        void *dst;
+        const float *mul;
+        const float *add;
+        size_t sp_size;
+        const void *post_ops_binary_rhs_arg_vec;
+        const void *dst_orig;
+    };
+
+    struct kernel_stat_base_t {
+        virtual void operator()(const stat_call_params_t *p) const = 0;
+        virtual status_t create_kernel() = 0;
+        static kernel_stat_base_t *create(const pd_t *pd);
+        virtual ~kernel_stat_base_t() = default;
+    };
+
+    struct kernel_norm_base_t {
+        virtual void operator()(const norm_call_params_t *p) const = 0;
+        virtual status_t create_kernel() = 0;
+        static kernel_norm_base_t *create(const pd_t *pd);
+        virtual ~kernel_norm_base_t() = default;
+    };
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(kernel_stat_, kernel_stat_base_t::create(pd())));
+        CHECK(safe_ptr_assign(kernel_norm_, kernel_norm_base_t::create(pd())));
+        if (kernel_stat_) CHECK(kernel_stat_->create_kernel());
+        if (kernel_norm_) CHECK(kernel_norm_->create_kernel());
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<kernel_stat_base_t> kernel_stat_;
+    std::unique_ptr<kernel_norm_base_t> kernel_norm_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
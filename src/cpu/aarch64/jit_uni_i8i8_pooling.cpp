@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/aarch64/jit_generator.hpp"
@@ -97,6 +98,9 @@ struct jit_uni_i8i8_pooling_fwd_ker_t : public jit_generator_t {
 
     PReg p_all_zero = p2;
     PReg p_tmp0 = p1;
+    // Covers exactly one vector of the isa, which may be shorter than the
+    // hardware vector length
+    PReg p_vl = p8;
 
     VReg xmm_tmp = xreg(0); // temp to init vreg_tmp
     TReg vreg_tmp = vreg(0); // max pooling : holds minimum values for data_type
@@ -183,8 +187,8 @@ struct jit_uni_i8i8_pooling_fwd_ker_t : public jit_generator_t {
         : jit_generator_t(nullptr, MAX_CODE_SIZE, true), jpp(jpp_) {}
 };
 
-template <>
-void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::load_src_max_op(
+template <cpu_isa_t isa>
+void jit_uni_i8i8_pooling_fwd_ker_t<isa>::load_src_max_op(
         int jj, int ll, size_t offset, bool masked, uint64_t msk) {
     using namespace data_type;
 
@@ -202,12 +206,12 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::load_src_max_op(
         }
     } else {
         add_imm(X_DEFAULT_ADDR, aux_reg_src_w, offset, X_TMP_0);
-        ldr(vreg_src(jj), ptr(X_DEFAULT_ADDR));
+        ld1b(vreg_src(jj).b, p_vl / T_z, ptr(X_DEFAULT_ADDR));
     }
 }
 
-template <>
-void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::load_src_avg_op(
+template <cpu_isa_t isa>
+void jit_uni_i8i8_pooling_fwd_ker_t<isa>::load_src_avg_op(
         int jj, int ll, size_t offset, bool masked, uint64_t msk) {
     using namespace data_type;
 
@@ -223,7 +227,7 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::load_src_avg_op(
                 ld1w(z_tmp0.s, p_tmp0 / T_z, ptr(X_DEFAULT_ADDR));
                 mov(vr_src.s, p_tmp0 / T_m, z_tmp0.s);
             } else {
-                ldr(vr_src, ptr(X_DEFAULT_ADDR));
+                ld1w(vr_src.s, p_vl / T_z, ptr(X_DEFAULT_ADDR));
             }
             break;
         case data_type::s8:
@@ -235,8 +239,7 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::load_src_avg_op(
                 ld1b(z_tmp0.s, p_tmp0 / T_z, ptr(X_DEFAULT_ADDR));
                 sxtb(vr_src.s, p_tmp0 / T_m, z_tmp0.s);
             } else {
-                ld1b(z_tmp0.s, P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
-                sxtb(vr_src.s, P_ALL_ONE / T_m, z_tmp0.s);
+                ld1sb(vr_src.s, p_vl / T_z, ptr(X_DEFAULT_ADDR));
             }
             break;
         case u8:
@@ -248,10 +251,7 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::load_src_avg_op(
                 ld1b(z_tmp0.s, p_tmp0 / T_z, ptr(X_DEFAULT_ADDR));
                 uxtb(vr_src.s, p_tmp0 / T_m, z_tmp0.s);
             } else {
-                ldr(QReg(z_tmp0.getIdx()), ptr(X_DEFAULT_ADDR));
-                zip1(z_tmp0.b, z_tmp0.b, z_tmp0.b);
-                zip1(z_tmp0.h, z_tmp0.h, z_tmp0.h);
-                uxtb(vr_src.s, P_ALL_ONE / T_m, z_tmp0.s);
+                ld1b(vr_src.s, p_vl / T_z, ptr(X_DEFAULT_ADDR));
             }
             break;
         default: assert(!"unsupported src data type");
@@ -284,8 +284,8 @@ void jit_uni_i8i8_pooling_fwd_ker_t<isa>::load_src(int jj, int ll, int c_tail) {
     }
 }
 
-template <>
-void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::store_dst_max_op(
+template <cpu_isa_t isa>
+void jit_uni_i8i8_pooling_fwd_ker_t<isa>::store_dst_max_op(
         int jj, int ll, size_t offset, bool masked, uint64_t msk) {
     using namespace data_type;
 
@@ -306,12 +306,12 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::store_dst_max_op(
         }
     } else {
         add_imm(X_DEFAULT_ADDR, reg_ptr_dst_i8, offset, X_TMP_0);
-        str(vreg_dst(jj), ptr(X_DEFAULT_ADDR));
+        st1b(vreg_dst(jj).b, p_vl, ptr(X_DEFAULT_ADDR));
     }
 }
 
-template <>
-void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::store_dst_avg_op(
+template <cpu_isa_t isa>
+void jit_uni_i8i8_pooling_fwd_ker_t<isa>::store_dst_avg_op(
         int jj, int ll, size_t offset, bool masked, uint64_t msk) {
     using namespace data_type;
 
@@ -327,7 +327,7 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::store_dst_avg_op(
                 zip1(p_tmp0.h, p_tmp0.h, p_all_zero.h);
                 st1w(vr_dst.s, p_tmp0, ptr(X_DEFAULT_ADDR));
             } else {
-                str(vr_dst, ptr(X_DEFAULT_ADDR));
+                st1w(vr_dst.s, p_vl, ptr(X_DEFAULT_ADDR));
             }
             break;
         case data_type::s8:
@@ -343,7 +343,7 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::store_dst_avg_op(
                 mov(z_tmp0.d, vr_dst.d);
                 smin(z_tmp0.s, 127);
                 smax(z_tmp0.s, -128);
-                st1b(z_tmp0.s, P_ALL_ONE, ptr(X_DEFAULT_ADDR));
+                st1b(z_tmp0.s, p_vl, ptr(X_DEFAULT_ADDR));
             }
             break;
         case u8:
@@ -357,7 +357,7 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::store_dst_avg_op(
             } else {
                 mov(z_tmp0.d, vr_dst.d);
                 umin(z_tmp0.s, 255);
-                st1b(z_tmp0.s, P_ALL_ONE, ptr(X_DEFAULT_ADDR));
+                st1b(z_tmp0.s, p_vl, ptr(X_DEFAULT_ADDR));
             }
             break;
         default: assert(!"unsupported dst data_type");
@@ -391,8 +391,8 @@ void jit_uni_i8i8_pooling_fwd_ker_t<isa>::store_dst(
     }
 }
 
-template <>
-void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::compute_max_op(const int jj) {
+template <cpu_isa_t isa>
+void jit_uni_i8i8_pooling_fwd_ker_t<isa>::compute_max_op(const int jj) {
     using namespace data_type;
 
     // Compare
@@ -607,22 +607,21 @@ void jit_uni_i8i8_pooling_fwd_ker_t<isa>::compute_c_block() {
     if (ur_c_tail != 0) { compute_step(ur_c_tail, c_tail); }
 }
 
-template <>
-void jit_uni_i8i8_pooling_fwd_ker_t<sve_512>::init_mask() {
-    using namespace data_type;
-
-    const auto stack_space_bytes = utils::rnd_up(8 * max_num_ll, 16);
-    sub_imm(sp, sp, stack_space_bytes, X_TMP_0);
-
-    for (int ll = 0; ll < max_num_ll; ll++) {
-        mov_imm(reg_mask, jpp.tail[ll]);
-        str(reg_mask, ptr(sp, 8 * ll));
-    }
+template <cpu_isa_t isa>
+void jit_uni_i8i8_pooling_fwd_ker_t<isa>::init_mask() {
+    if (isa == sve_512)
+        ptrue(p_vl.b);
+    else
+        set_preg(p_vl.b, cpu_isa_traits<isa>::vlen);
+
+    // Every tail mask enables a contiguous range of the lowest byte lanes, so
+    // the predicates are built from the number of active lanes and do not
+    // depend on the hardware vector length.
     for (int ll = 0; ll < max_num_ll; ll++) {
-        ldr(PReg(mask(ll)), ptr(sp, 8 * ll));
+        const int nbits
+                = jpp.tail[ll] ? math::ilog2q(jpp.tail[ll]) + 1 : 0;
+        set_preg(mask(ll).b, nbits, reg_mask, reg_tmp);
     }
-
-    add_imm(sp, sp, stack_space_bytes, X_TMP_0);
 }
 
 template <cpu_isa_t isa>
@@ -658,10 +657,8 @@ void jit_uni_i8i8_pooling_fwd_ker_t<isa>::init_tmp_reg() {
             mov(xmm_tmp.d[0], reg_tmp);
             if (jpp.src_dt == s32) {
                 dup(vreg_tmp.s, ZRegS(xmm_tmp.getIdx())[0]);
-            } else if (mayiuse(sve_512)) {
-                dup(ZRegB(vreg_tmp.getIdx()), ZRegB(xmm_tmp.getIdx())[0]);
             } else {
-                assert(!"unreachable");
+                dup(ZRegB(vreg_tmp.getIdx()), ZRegB(xmm_tmp.getIdx())[0]);
             }
             break;
         default: assert(!"unsupported pooling algorithm");
@@ -761,16 +758,16 @@ status_t jit_uni_i8i8_pooling_fwd_ker_t<isa>::init_conf(
 
     // data_type items per one vreg on the <isa>
     //     isa == sve_512 : 64 bytes -> 64 for s8/u8, 16 for s32
+    //     isa == sve_256 : 32 bytes -> 32 for s8/u8, 8 for s32
+    //     isa == sve_128 : 16 bytes -> 16 for s8/u8, 4 for s32
     int simd_w = cpu_isa_traits<isa>::vlen / data_type_size(jpp.src_dt);
 
     /* Verify that vlen-sized memory access happens within the tensor's
      * size, otherwise load/store will always spill outside the memory
      * boundary.*/
-    bool safe_load_n_store = IMPLICATION(utils::one_of(isa, sve_512),
-            jpp.mb * jpp.c * nstl::min(jpp.id, jpp.od)
-                            * nstl::min(jpp.ih, jpp.oh)
-                            * nstl::min(jpp.iw, jpp.ow)
-                    >= simd_w);
+    bool safe_load_n_store = jpp.mb * jpp.c * nstl::min(jpp.id, jpp.od)
+                    * nstl::min(jpp.ih, jpp.oh) * nstl::min(jpp.iw, jpp.ow)
+            >= simd_w;
     if (!safe_load_n_store) return status::unimplemented;
 
     jpp.c_block = simd_w;
@@ -796,7 +793,7 @@ status_t jit_uni_i8i8_pooling_fwd_ker_t<isa>::init_conf(
         case pooling_avg_include_padding:
         case pooling_avg_exclude_padding: {
             // avg_proc_dt (s32) defines granularity (because u8/s8 processed as s32)
-            // sve_512 : 16
+            // sve_512 : 16, sve_256 : 8, sve_128 : 4
             const size_t msk_gran
                     = cpu_isa_traits<isa>::vlen / data_type_size(avg_proc_dt);
             const size_t msk_msk = (1ULL << msk_gran) - 1;
@@ -908,6 +905,10 @@ status_t jit_uni_i8i8_pooling_fwd_t<isa>::execute_forward(
 //
 template struct jit_uni_i8i8_pooling_fwd_ker_t<sve_512>;
 template struct jit_uni_i8i8_pooling_fwd_t<sve_512>;
+template struct jit_uni_i8i8_pooling_fwd_ker_t<sve_256>;
+template struct jit_uni_i8i8_pooling_fwd_t<sve_256>;
+template struct jit_uni_i8i8_pooling_fwd_ker_t<sve_128>;
+template struct jit_uni_i8i8_pooling_fwd_t<sve_128>;
 
 } // namespace aarch64
 } // namespace cpu
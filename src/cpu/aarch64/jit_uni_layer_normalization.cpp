@@ -455,6 +455,353 @@ private:
     }
 };
 
+template <cpu_isa_t isa>
+class jit_lnorm_bwd_kernel_base_t : public jit_generator_t {
+public:
+    using TReg = typename cpu_isa_traits<isa>::TReg;
+
+    jit_lnorm_bwd_kernel_base_t(const layer_normalization_pd_t *pd)
+        : jit_generator_t(nullptr, MAX_CODE_SIZE, true)
+        , pd_(pd)
+        , simd_w_(isa_max_vlen(isa) / sizeof(float))
+        , C_(pd_->norm_axis())
+        , axis_simd_full_(C_ / simd_w_)
+        , axis_simd_tail_(C_ % simd_w_)
+        , skip_mean_(pd_->skip_mean()) {
+        // Only f32 is supported on backward, so a single io helper is enough
+        // for data, scale and statistics.
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_, tail_opmask_,
+                static_cast<int>(vec_tail_mask_.getIdx()), reg_io_tmp1_,
+                reg_io_tmp2_);
+        typename io::jit_io_multi_dt_helper_t<TReg>::data_types_t io_dts {
+                f32};
+        io_ = utils::make_unique<io::jit_io_multi_dt_helper_t<TReg>>(
+                this, isa, io_dts, io_conf, io_tail_conf);
+    }
+
+protected:
+    const layer_normalization_pd_t *pd_;
+    const size_t simd_w_;
+    const dim_t C_;
+    const dim_t axis_simd_full_;
+    const dim_t axis_simd_tail_;
+    const bool skip_mean_;
+
+    const XReg reg_param_ = abi_param1;
+    const XReg reg_io_tmp1_ = x15;
+    const XReg reg_io_tmp2_ = x16;
+
+    const PReg tail_opmask_ = p2;
+    const TReg vec_tail_mask_ {0};
+
+    std::unique_ptr<io::jit_io_multi_dt_helper_t<TReg>> io_;
+
+    void load(const TReg &vec, const XReg &base, size_t offt_elems,
+            bool is_tail) {
+        io_->at(f32)->load(addr_off(base,
+                                   static_cast<int64_t>(
+                                           offt_elems * sizeof(float)),
+                                   X_DEFAULT_ADDR, X_TMP_0),
+                0, vec, is_tail);
+    }
+
+    void store(const TReg &vec, const XReg &base, size_t offt_elems,
+            bool is_tail) {
+        io_->at(f32)->store(vec,
+                addr_off(base,
+                        static_cast<int64_t>(offt_elems * sizeof(float)),
+                        X_DEFAULT_ADDR, X_TMP_0),
+                0, is_tail);
+    }
+};
+
+// Accumulates diff_gamma and diff_beta over a block of rows. The partial sums
+// live in a per-thread buffer and are reduced across threads afterwards. The
+// kernel also stores 1 / sqrt(var + eps) for reuse by the diff_data kernel.
+template <cpu_isa_t isa>
+class jit_lnorm_diff_ss_kernel_t : public diff_ss_kernel_iface_t,
+                                   public jit_lnorm_bwd_kernel_base_t<isa> {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_lnorm_diff_ss_kernel_t)
+
+    using base_t = jit_lnorm_bwd_kernel_base_t<isa>;
+    using TReg = typename base_t::TReg;
+
+    jit_lnorm_diff_ss_kernel_t(const layer_normalization_pd_t *pd)
+        : base_t(pd), eps_(pd->desc()->layer_norm_epsilon) {}
+
+    void operator()(const ker_args_t &args) const override {
+        jit_generator_t::operator()(args);
+    }
+
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+private:
+    const float eps_;
+
+    const XReg reg_src_ = XReg(1);
+    const XReg reg_diff_dst_ = XReg(2);
+    const XReg reg_diff_gamma_ = XReg(3);
+    const XReg reg_diff_beta_ = XReg(4);
+    const XReg reg_mean_ = XReg(5);
+    const XReg reg_var_ = XReg(6);
+    const XReg reg_inv_sqrtvar_ = XReg(7);
+    const XReg reg_block_end_ = XReg(8);
+
+    const TReg vec_mean_ {1};
+    const TReg vec_inv_sqrtvar_ {2};
+    const TReg vec_src_ {3};
+    const TReg vec_diff_dst_ {4};
+    const TReg vec_diff_gamma_ {5};
+    const TReg vec_diff_beta_ {6};
+
+    const SReg scalar_eps_ {7};
+    const SReg float_one_ {8};
+    const SReg scalar_mean_ {vec_mean_.getIdx()};
+    const SReg scalar_inv_sqrtvar_ {vec_inv_sqrtvar_.getIdx()};
+
+    void compute_diff_ss_body(size_t offt_elems, bool is_tail) {
+        this->load(vec_diff_dst_, reg_diff_dst_, offt_elems, is_tail);
+        this->load(vec_diff_beta_, reg_diff_beta_, offt_elems, is_tail);
+        this->fadd(vec_diff_beta_.s, vec_diff_beta_.s, vec_diff_dst_.s);
+        this->store(vec_diff_beta_, reg_diff_beta_, offt_elems, is_tail);
+
+        // Lanes past the tail hold zero diff_dst, so they do not contribute
+        // to the product below even though src - mean is nonzero there.
+        this->load(vec_src_, reg_src_, offt_elems, is_tail);
+        if (!this->skip_mean_)
+            this->fsub(vec_src_.s, vec_src_.s, vec_mean_.s);
+        this->fmul(vec_src_.s, vec_src_.s, vec_inv_sqrtvar_.s);
+        this->load(vec_diff_gamma_, reg_diff_gamma_, offt_elems, is_tail);
+        this->float_point_fused_multiply_add(
+                vec_diff_gamma_, vec_src_, vec_diff_dst_);
+        this->store(vec_diff_gamma_, reg_diff_gamma_, offt_elems, is_tail);
+    }
+
+    void generate() override {
+        const size_t c_size = this->C_ * sizeof(float);
+        static const size_t float_size = types::data_type_size(f32);
+        const XReg &reg_param = this->reg_param_;
+
+        this->preamble();
+        if (this->axis_simd_tail_) this->io_->prepare_tail_mask();
+
+#define PARAM_OFF(x) static_cast<int32_t>(offsetof(ker_args_t, x))
+        this->ldr(reg_src_, ptr(reg_param, PARAM_OFF(src)));
+        this->ldr(reg_diff_dst_, ptr(reg_param, PARAM_OFF(diff_dst)));
+        this->ldr(reg_diff_gamma_, ptr(reg_param, PARAM_OFF(diff_gamma)));
+        this->ldr(reg_diff_beta_, ptr(reg_param, PARAM_OFF(diff_beta)));
+        this->ldr(reg_mean_, ptr(reg_param, PARAM_OFF(mean)));
+        this->ldr(reg_var_, ptr(reg_param, PARAM_OFF(var)));
+        this->ldr(reg_inv_sqrtvar_, ptr(reg_param, PARAM_OFF(inv_sqrtvar)));
+        this->ldr(reg_block_end_, ptr(reg_param, PARAM_OFF(block_size_bytes)));
+#undef PARAM_OFF
+
+        this->mov_imm(this->W_TMP_0, float2int(eps_));
+        this->fmov(scalar_eps_, this->W_TMP_0);
+        this->fmov(float_one_, 1.0f);
+        this->add(reg_block_end_, reg_block_end_, reg_src_);
+
+        Label loop, done;
+        this->L(loop);
+        this->cmp(reg_src_, reg_block_end_);
+        this->b(GE, done);
+
+        if (!this->skip_mean_) {
+            this->ldr(scalar_mean_, ptr(reg_mean_));
+            this->dup(vec_mean_.s, vec_mean_.s[0]);
+        }
+
+        this->ldr(scalar_inv_sqrtvar_, ptr(reg_var_));
+        this->fadd(scalar_inv_sqrtvar_, scalar_inv_sqrtvar_, scalar_eps_);
+        this->fsqrt(scalar_inv_sqrtvar_, scalar_inv_sqrtvar_);
+        this->fdiv(scalar_inv_sqrtvar_, float_one_, scalar_inv_sqrtvar_);
+        this->str(scalar_inv_sqrtvar_, ptr(reg_inv_sqrtvar_));
+        this->dup(vec_inv_sqrtvar_.s, vec_inv_sqrtvar_.s[0]);
+
+        for (dim_t i = 0; i < this->axis_simd_full_; ++i)
+            compute_diff_ss_body(i * this->simd_w_, false);
+        if (this->axis_simd_tail_)
+            compute_diff_ss_body(this->axis_simd_full_ * this->simd_w_, true);
+
+        this->add_imm(reg_src_, reg_src_, c_size, this->X_TMP_0);
+        this->add_imm(reg_diff_dst_, reg_diff_dst_, c_size, this->X_TMP_0);
+        if (!this->skip_mean_)
+            this->add_imm(reg_mean_, reg_mean_, float_size, this->X_TMP_0);
+        this->add_imm(reg_var_, reg_var_, float_size, this->X_TMP_0);
+        this->add_imm(
+                reg_inv_sqrtvar_, reg_inv_sqrtvar_, float_size, this->X_TMP_0);
+        this->b(loop);
+
+        this->L(done);
+        this->postamble();
+    }
+};
+
+// Computes diff_src for a block of rows:
+//   diff_src = inv_sqrtvar * (dd_gamma - (sum(dd_gamma)
+//           + x_hat * sum(dd_gamma * x_hat)) / C),
+// where dd_gamma = diff_dst * gamma and x_hat = (src - mean) * inv_sqrtvar.
+// With global statistics the reduction terms are dropped.
+template <cpu_isa_t isa>
+class jit_lnorm_diff_data_kernel_t : public diff_data_kernel_iface_t,
+                                     public jit_lnorm_bwd_kernel_base_t<isa> {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_lnorm_diff_data_kernel_t)
+
+    using base_t = jit_lnorm_bwd_kernel_base_t<isa>;
+    using TReg = typename base_t::TReg;
+
+    jit_lnorm_diff_data_kernel_t(const layer_normalization_pd_t *pd)
+        : base_t(pd)
+        , use_scale_(pd->use_scale())
+        , calculate_diff_stats_(!pd->stats_are_src()) {}
+
+    void operator()(const ker_args_t &args) const override {
+        jit_generator_t::operator()(args);
+    }
+
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+private:
+    const bool use_scale_;
+    const bool calculate_diff_stats_;
+
+    const XReg reg_src_ = XReg(1);
+    const XReg reg_diff_dst_ = XReg(2);
+    const XReg reg_diff_src_ = XReg(3);
+    const XReg reg_scale_ = XReg(4);
+    const XReg reg_mean_ = XReg(5);
+    const XReg reg_inv_sqrtvar_ = XReg(6);
+    const XReg reg_block_end_ = XReg(7);
+
+    const TReg vec_mean_ {1};
+    const TReg vec_inv_sqrtvar_ {2};
+    const TReg vec_src_ {3};
+    const TReg vec_dsrc_ {4};
+    const TReg vec_scale_ {5};
+    const TReg vec_dd_scale_ {6};
+    const TReg vec_dd_scale_x_ {7};
+    const TReg vec_inv_c_ {8};
+
+    const SReg scalar_mean_ {vec_mean_.getIdx()};
+    const SReg scalar_inv_sqrtvar_ {vec_inv_sqrtvar_.getIdx()};
+    const SReg scalar_dd_scale_ {vec_dd_scale_.getIdx()};
+    const SReg scalar_dd_scale_x_ {vec_dd_scale_x_.getIdx()};
+
+    void load_dd_scale(size_t offt_elems, bool is_tail) {
+        this->load(vec_dsrc_, reg_diff_dst_, offt_elems, is_tail);
+        if (use_scale_) {
+            this->load(vec_scale_, reg_scale_, offt_elems, is_tail);
+            this->fmul(vec_dsrc_.s, vec_dsrc_.s, vec_scale_.s);
+        }
+    }
+
+    void compute_dd_scales(size_t offt_elems, bool is_tail) {
+        load_dd_scale(offt_elems, is_tail);
+        this->load(vec_src_, reg_src_, offt_elems, is_tail);
+
+        this->fadd(vec_dd_scale_.s, vec_dd_scale_.s, vec_dsrc_.s);
+        if (!this->skip_mean_)
+            this->fsub(vec_src_.s, vec_src_.s, vec_mean_.s);
+        this->float_point_fused_multiply_add(
+                vec_dd_scale_x_, vec_dsrc_, vec_src_);
+    }
+
+    void compute_diff_src(size_t offt_elems, bool is_tail) {
+        load_dd_scale(offt_elems, is_tail);
+        if (calculate_diff_stats_) {
+            this->load(vec_src_, reg_src_, offt_elems, is_tail);
+            if (!this->skip_mean_)
+                this->fsub(vec_src_.s, vec_src_.s, vec_mean_.s);
+            this->fmul(vec_src_.s, vec_src_.s, vec_inv_sqrtvar_.s);
+            this->uni_fmad(vec_src_.s, vec_dd_scale_x_.s, vec_dd_scale_.s);
+            this->fmul(vec_src_.s, vec_src_.s, vec_inv_c_.s);
+            this->fsub(vec_dsrc_.s, vec_dsrc_.s, vec_src_.s);
+        }
+        this->fmul(vec_dsrc_.s, vec_dsrc_.s, vec_inv_sqrtvar_.s);
+        this->store(vec_dsrc_, reg_diff_src_, offt_elems, is_tail);
+    }
+
+    void generate() override {
+        const size_t c_size = this->C_ * sizeof(float);
+        static const size_t float_size = types::data_type_size(f32);
+        const XReg &reg_param = this->reg_param_;
+
+        this->preamble();
+        if (this->axis_simd_tail_) this->io_->prepare_tail_mask();
+
+#define PARAM_OFF(x) static_cast<int32_t>(offsetof(ker_args_t, x))
+        this->ldr(reg_src_, ptr(reg_param, PARAM_OFF(src)));
+        this->ldr(reg_diff_dst_, ptr(reg_param, PARAM_OFF(diff_dst)));
+        this->ldr(reg_diff_src_, ptr(reg_param, PARAM_OFF(diff_src)));
+        this->ldr(reg_scale_, ptr(reg_param, PARAM_OFF(scale)));
+        this->ldr(reg_mean_, ptr(reg_param, PARAM_OFF(mean)));
+        this->ldr(reg_inv_sqrtvar_, ptr(reg_param, PARAM_OFF(inv_sqrtvar)));
+        this->ldr(reg_block_end_, ptr(reg_param, PARAM_OFF(block_size_bytes)));
+#undef PARAM_OFF
+
+        this->mov_imm(this->W_TMP_0,
+                float2int(1.f / static_cast<float>(this->C_)));
+        this->dup(vec_inv_c_.s, this->W_TMP_0);
+        this->add(reg_block_end_, reg_block_end_, reg_src_);
+
+        const bool load_mean = calculate_diff_stats_ && !this->skip_mean_;
+
+        Label loop, done;
+        this->L(loop);
+        this->cmp(reg_src_, reg_block_end_);
+        this->b(GE, done);
+
+        this->ldr(scalar_inv_sqrtvar_, ptr(reg_inv_sqrtvar_));
+        this->dup(vec_inv_sqrtvar_.s, vec_inv_sqrtvar_.s[0]);
+
+        if (calculate_diff_stats_) {
+            if (load_mean) {
+                this->ldr(scalar_mean_, ptr(reg_mean_));
+                this->dup(vec_mean_.s, vec_mean_.s[0]);
+            }
+
+            this->uni_clear(vec_dd_scale_);
+            this->uni_clear(vec_dd_scale_x_);
+
+            for (dim_t i = 0; i < this->axis_simd_full_; ++i)
+                compute_dd_scales(i * this->simd_w_, false);
+            if (this->axis_simd_tail_)
+                compute_dd_scales(this->axis_simd_full_ * this->simd_w_, true);
+
+            this->uni_fadd_reduce(scalar_dd_scale_, vec_dd_scale_.s);
+            this->uni_fadd_reduce(scalar_dd_scale_x_, vec_dd_scale_x_.s);
+            this->dup(vec_dd_scale_.s, vec_dd_scale_.s[0]);
+            this->dup(vec_dd_scale_x_.s, vec_dd_scale_x_.s[0]);
+            this->fmul(vec_dd_scale_x_.s, vec_dd_scale_x_.s,
+                    vec_inv_sqrtvar_.s);
+        }
+
+        for (dim_t i = 0; i < this->axis_simd_full_; ++i)
+            compute_diff_src(i * this->simd_w_, false);
+        if (this->axis_simd_tail_)
+            compute_diff_src(this->axis_simd_full_ * this->simd_w_, true);
+
+        this->add_imm(reg_src_, reg_src_, c_size, this->X_TMP_0);
+        this->add_imm(reg_diff_dst_, reg_diff_dst_, c_size, this->X_TMP_0);
+        this->add_imm(reg_diff_src_, reg_diff_src_, c_size, this->X_TMP_0);
+        if (load_mean)
+            this->add_imm(reg_mean_, reg_mean_, float_size, this->X_TMP_0);
+        this->add_imm(
+                reg_inv_sqrtvar_, reg_inv_sqrtvar_, float_size, this->X_TMP_0);
+        this->b(loop);
+
+        this->L(done);
+        this->postamble();
+    }
+};
+
 } // namespace
 
 template <cpu_isa_t isa>
@@ -662,8 +1009,209 @@ status_t jit_uni_layer_normalization_fwd_t<isa>::execute_forward(
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t jit_uni_layer_normalization_bwd_t<isa>::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper src_d(src_md());
+
+    VDISPATCH_LNORM(!is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_LNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "src");
+    VDISPATCH_LNORM(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_LNORM(utils::everyone_is(f32, src_md()->data_type,
+                            diff_dst_md()->data_type, diff_src_md()->data_type,
+                            stat_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_LNORM(check_scale_shift_data_type(), VERBOSE_UNSUPPORTED_FEATURE,
+            "unsupported scale or shift data type");
+    VDISPATCH_LNORM(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_LNORM(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_LNORM(src_d.is_blocking_desc(), VERBOSE_BLOCKING_FAIL,
+            "blocking descriptor fail");
+    VDISPATCH_LNORM(src_d.blocking_desc().strides[ndims() - 1] == 1,
+            VERBOSE_BLOCKING_FAIL, "bad stride value");
+    // The kernels walk src, diff_dst and diff_src with the same row stride.
+    VDISPATCH_LNORM(memory_desc_wrapper(diff_dst_md()) == src_d
+                    && memory_desc_wrapper(diff_src_md()) == src_d,
+            VERBOSE_INCONSISTENT_MDS, "src", "diff_dst");
+    VDISPATCH_LNORM(impl::is_dense_format_kind(
+                            {src_md(), diff_dst_md(), diff_src_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    VDISPATCH_LNORM(fill_compatible_stats_md(*src_md(), reordered_stat_md_)
+                    == status::success,
+            VERBOSE_INCONSISTENT_MDS, "src", "stat");
+
+    if (reordered_stat_md_ != *stat_md()) {
+        CHECK(reorder_primitive_desc_create(
+                reorder_pd_, engine, stat_md(), &reordered_stat_md_));
+    }
+
+    nthr_ = dnnl_get_max_threads();
+    init_scratchpad();
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_layer_normalization_bwd_t<isa>::init(engine_t *engine) {
+    if (pd()->reorder_pd_)
+        pd()->reorder_pd_->create_primitive(reorder_, engine);
+
+    CHECK(safe_ptr_assign(
+            diff_ss_kernel_, new jit_lnorm_diff_ss_kernel_t<isa>(pd())));
+    CHECK(safe_ptr_assign(
+            diff_data_kernel_, new jit_lnorm_diff_data_kernel_t<isa>(pd())));
+    CHECK(diff_ss_kernel_->create_kernel());
+    CHECK(diff_data_kernel_->create_kernel());
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_layer_normalization_bwd_t<isa>::reorder_stat(const exec_ctx_t &ctx,
+        engine_t *engine, const memory_arg_t &in,
+        const memory_arg_t &out) const {
+    exec_args_t r_args;
+    r_args[DNNL_ARG_SRC] = in;
+    r_args[DNNL_ARG_DST] = out;
+    exec_ctx_t r_ctx(ctx, std::move(r_args));
+
+    auto *nested_grantor = create_nested_grantor(ctx.get_scratchpad_grantor(),
+            key_nested, reorder_->pd()->scratchpad_registry());
+    r_ctx.set_scratchpad_grantor(nested_grantor);
+    reorder_->execute(r_ctx);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_layer_normalization_bwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    if (reorder_) {
+        engine_t *engine = ctx.stream()->engine();
+        const auto &scratchpad = ctx.get_scratchpad_grantor();
+        const bool skip_mean = pd()->skip_mean();
+
+        std::unique_ptr<memory_t, memory_deleter_t> mean;
+        if (!skip_mean) {
+            auto mean_mem = scratchpad.get_memory_storage(key_lnorm_tmp_mean);
+            CHECK(safe_ptr_assign(mean,
+                    new memory_t(engine, &(pd()->reordered_stat_md_),
+                            std::move(mean_mem))));
+            reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                    {mean.get(), false});
+        }
+
+        auto variance_mem = scratchpad.get_memory_storage(key_lnorm_tmp_var);
+        std::unique_ptr<memory_t, memory_deleter_t> variance;
+        CHECK(safe_ptr_assign(variance,
+                new memory_t(engine, &(pd()->reordered_stat_md_),
+                        std::move(variance_mem))));
+        reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
+                {variance.get(), false});
+    }
+
+    return execute_backward(ctx);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_layer_normalization_bwd_t<isa>::execute_backward(
+        const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto diff_dst = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST);
+    const auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
+    auto diff_src = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DIFF_SRC, status);
+    CHECK(status);
+    auto diff_scale = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SCALE, status);
+    CHECK(status);
+    auto diff_shift = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SHIFT, status);
+    CHECK(status);
+
+    const bool skip_mean = pd()->skip_mean();
+
+    const float *mean, *variance;
+    if (pd()->use_tmp_stats()) {
+        mean = skip_mean ? nullptr
+                         : scratchpad.template get<float>(key_lnorm_tmp_mean);
+        variance = scratchpad.template get<float>(key_lnorm_tmp_var);
+    } else {
+        mean = CTX_IN_MEM(const float *, DNNL_ARG_MEAN);
+        variance = CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE);
+    }
+
+    float *const inv_sqrtvar
+            = scratchpad.template get<float>(key_lnorm_inv_sqrtvar);
+    float *const reduce = scratchpad.template get<float>(key_lnorm_reduction);
+    if (diff_scale == nullptr)
+        diff_scale = scratchpad.template get<float>(key_lnorm_tmp_diff_ss);
+    if (diff_shift == nullptr)
+        diff_shift = scratchpad.template get<float>(key_lnorm_tmp_diff_ss)
+                + pd()->norm_axis();
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const dim_t N = pd()->across_axis();
+    const dim_t C = pd()->norm_axis();
+    const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
+    const size_t row_bytes = C_padded * sizeof(float);
+    const int max_nthr = pd()->nthr_;
+
+    // Each thread accumulates diff_gamma and diff_beta for its own rows,
+    // which keeps the first pass free of synchronization.
+    parallel(max_nthr, [&](int ithr, int nthr) {
+        dim_t N_start = 0, N_end = 0;
+        balance211(N, nthr, ithr, N_start, N_end);
+
+        // Also clear the slots of threads that were not spawned, as the
+        // reduction below always walks all max_nthr slots.
+        for (int t = ithr; t < max_nthr; t += nthr) {
+            utils::array_set(reduce + C * t, 0.f, C);
+            utils::array_set(reduce + C * max_nthr + C * t, 0.f, C);
+        }
+        if (N_start == N_end) return;
+
+        float *my_diff_gamma = reduce + C * ithr;
+        float *my_diff_beta = reduce + C * max_nthr + C * ithr;
+
+        const diff_ss_kernel_iface_t::ker_args_t args {
+                reinterpret_cast<const char *>(src) + N_start * row_bytes,
+                reinterpret_cast<const char *>(diff_dst) + N_start * row_bytes,
+                my_diff_gamma, my_diff_beta,
+                skip_mean ? nullptr : mean + N_start, variance + N_start,
+                inv_sqrtvar + N_start,
+                static_cast<size_t>(N_end - N_start) * C * sizeof(float)};
+        (*diff_ss_kernel_)(args);
+    });
+
+    parallel_nd(C, [&](dim_t c) {
+        float diff_gamma = 0.f, diff_beta = 0.f;
+        for (int n = 0; n < max_nthr; n++) {
+            diff_gamma += reduce[C * n + c];
+            diff_beta += reduce[C * max_nthr + C * n + c];
+        }
+        diff_scale[c] = diff_gamma;
+        diff_shift[c] = diff_beta;
+    });
+
+    parallel(max_nthr, [&](int ithr, int nthr) {
+        dim_t N_start = 0, N_end = 0;
+        balance211(N, nthr, ithr, N_start, N_end);
+        if (N_start == N_end) return;
+
+        const diff_data_kernel_iface_t::ker_args_t args {
+                reinterpret_cast<const char *>(src) + N_start * row_bytes,
+                reinterpret_cast<const char *>(diff_dst) + N_start * row_bytes,
+                reinterpret_cast<char *>(diff_src) + N_start * row_bytes,
+                scale, skip_mean ? nullptr : mean + N_start,
+                inv_sqrtvar + N_start,
+                static_cast<size_t>(N_end - N_start) * C * sizeof(float)};
+        (*diff_data_kernel_)(args);
+    });
+
+    return status::success;
+}
+
 template class jit_uni_layer_normalization_fwd_t<asimd>;
 template class jit_uni_layer_normalization_fwd_t<sve>;
+template class jit_uni_layer_normalization_bwd_t<asimd>;
+template class jit_uni_layer_normalization_bwd_t<sve>;
 
 } // namespace aarch64
 } // namespace cpu
@@ -54,6 +54,43 @@ struct stat_and_data_kernel_iface_t {
     virtual status_t create_kernel() = 0;
 };
 
+struct diff_ss_kernel_iface_t {
+    struct ker_args_t {
+        const void *src;
+        const void *diff_dst;
+        float *diff_gamma;
+        float *diff_beta;
+        const float *mean;
+        const float *var;
+        float *inv_sqrtvar;
+        size_t block_size_bytes;
+    };
+
+    virtual ~diff_ss_kernel_iface_t() = default;
+
+    virtual void operator()(const ker_args_t &args) const = 0;
+
+    virtual status_t create_kernel() = 0;
+};
+
+struct diff_data_kernel_iface_t {
+    struct ker_args_t {
+        const void *src;
+        const void *diff_dst;
+        void *diff_src;
+        const float *scale;
+        const float *mean;
+        const float *inv_sqrtvar;
+        size_t block_size_bytes;
+    };
+
+    virtual ~diff_data_kernel_iface_t() = default;
+
+    virtual void operator()(const ker_args_t &args) const = 0;
+
+    virtual status_t create_kernel() = 0;
+};
+
 template <cpu_isa_t isa>
 class jit_uni_layer_normalization_fwd_t : public primitive_t {
 public:
@@ -110,6 +147,65 @@ private:
     std::shared_ptr<primitive_t> reorder_;
 };
 
+template <cpu_isa_t isa>
+class jit_uni_layer_normalization_bwd_t : public primitive_t {
+public:
+    class pd_t : public cpu_layer_normalization_bwd_pd_t {
+    public:
+        using cpu_layer_normalization_bwd_pd_t::
+                cpu_layer_normalization_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit_lnorm:", isa, ""),
+                jit_uni_layer_normalization_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        bool use_tmp_stats() const { return reorder_pd_.get(); }
+
+        std::shared_ptr<primitive_desc_t> reorder_pd_;
+        memory_desc_t reordered_stat_md_;
+        int nthr_ {};
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            if (use_tmp_stats()) {
+                if (!skip_mean()) {
+                    scratchpad.template book<float>(
+                            key_lnorm_tmp_mean, across_axis());
+                }
+                scratchpad.template book<float>(
+                        key_lnorm_tmp_var, across_axis());
+                scratchpad.book(key_nested, reorder_pd_->scratchpad_registry());
+            }
+            // Per-thread partial diff_gamma and diff_beta, reduced after
+            // the first pass over the data.
+            scratchpad.template book<float>(
+                    key_lnorm_reduction, 2 * norm_axis() * nthr_);
+            scratchpad.template book<float>(
+                    key_lnorm_tmp_diff_ss, 2 * norm_axis());
+            scratchpad.template book<float>(
+                    key_lnorm_inv_sqrtvar, across_axis());
+        }
+    };
+
+    jit_uni_layer_normalization_bwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    void reorder_stat(const exec_ctx_t &ctx, engine_t *engine,
+            const memory_arg_t &in, const memory_arg_t &out) const;
+    status_t execute_backward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<diff_ss_kernel_iface_t> diff_ss_kernel_;
+    std::unique_ptr<diff_data_kernel_iface_t> diff_data_kernel_;
+    std::shared_ptr<primitive_t> reorder_;
+};
+
 } // namespace aarch64
 } // namespace cpu
 } // namespace impl
@@ -218,7 +218,8 @@ status_t jit_uni_pool_kernel_t<isa>::init_conf(jit_pool_conf_t &jpp,
     jpp.isa = isa;
 
     const bool args_ok = true && mayiuse(isa) && (fmt_tag != format_tag::undef)
-            && jpp.is_bf16 == false && jpp.is_f16 == false
+            && IMPLICATION(
+                    src_d.data_type() == data_type::bf16, mayiuse_bf16())
             && utils::one_of(pd.alg_kind, pooling_max,
                     pooling_avg_include_padding, pooling_avg_exclude_padding);
     if (!args_ok) return status::unimplemented;
@@ -256,6 +257,13 @@ status_t jit_uni_pool_kernel_t<isa>::init_conf(jit_pool_conf_t &jpp,
             || right_pad >= jpp.kw)
         return status::unimplemented;
 
+    // diff_src is accumulated in place, so overlapping windows would round
+    // the partial sums to xf16 at every step
+    if (jpp.is_backward && (jpp.is_bf16 || jpp.is_f16)
+            && (jpp.kd > jpp.stride_d || jpp.kh > jpp.stride_h
+                    || jpp.kw > jpp.stride_w))
+        return status::unimplemented;
+
     jpp.ind_dt = ppd->workspace_md() ? ppd->workspace_md()->data_type
                                      : data_type::undef;
 
@@ -354,6 +362,48 @@ template <cpu_isa_t isa>
 inline void jit_uni_pool_kernel_t<isa>::load(const int idx,
         const xreg_t &reg_ptr, const int offset,
         const bool is_c_tail_processing) {
+    if (!jpp.is_bf16 && !jpp.is_f16) {
+        load_f32(idx, reg_ptr, offset, is_c_tail_processing);
+        return;
+    }
+
+    // xf16 values are widened to f32, accumulation is always done in f32
+    add_imm(X_DEFAULT_ADDR, reg_ptr, offset, X_TMP_0);
+    if (is_c_tail_processing && !jpp.is_c_padded)
+        ld1h(ZRegS(idx), k_c_tail_mask_s / T_z, ptr(X_DEFAULT_ADDR));
+    else
+        ld1h(ZRegS(idx), P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
+    if (jpp.is_bf16)
+        lsl(ZRegS(idx), ZRegS(idx), 16);
+    else
+        fcvt(ZRegS(idx), P_ALL_ONE / T_m, ZRegH(idx));
+}
+
+template <cpu_isa_t isa>
+inline void jit_uni_pool_kernel_t<isa>::store(const int idx,
+        const xreg_t &reg_ptr, const int offset,
+        const bool is_c_tail_processing) {
+    if (!jpp.is_bf16 && !jpp.is_f16) {
+        store_f32(idx, reg_ptr, offset, is_c_tail_processing);
+        return;
+    }
+
+    const bool is_masked = is_c_tail_processing && !jpp.is_c_padded;
+    if (is_c_tail_processing && jpp.is_c_padded && jpp.with_postops)
+        mov(ZRegS(idx), k_c_tail_mask_s_not / T_m, 0);
+    if (jpp.is_bf16)
+        bfcvt(z_tmp0.h, P_ALL_ONE / T_m, ZRegS(idx));
+    else
+        fcvt(z_tmp0.h, P_ALL_ONE / T_m, ZRegS(idx));
+    add_imm(X_DEFAULT_ADDR, reg_ptr, offset, X_TMP_0);
+    st1h(z_tmp0.s, is_masked ? k_c_tail_mask_s : P_ALL_ONE,
+            ptr(X_DEFAULT_ADDR));
+}
+
+template <cpu_isa_t isa>
+inline void jit_uni_pool_kernel_t<isa>::load_f32(const int idx,
+        const xreg_t &reg_ptr, const int offset,
+        const bool is_c_tail_processing) {
     if (is_c_tail_processing && !jpp.is_c_padded) {
         add_imm(X_DEFAULT_ADDR, reg_ptr, offset, X_TMP_0);
         ld1w(ZRegS(idx), k_c_tail_mask_s / T_z, ptr(X_DEFAULT_ADDR));
@@ -364,7 +414,7 @@ inline void jit_uni_pool_kernel_t<isa>::load(const int idx,
 }
 
 template <cpu_isa_t isa>
-inline void jit_uni_pool_kernel_t<isa>::store(const int idx,
+inline void jit_uni_pool_kernel_t<isa>::store_f32(const int idx,
         const xreg_t &reg_ptr, const int offset,
         const bool is_c_tail_processing) {
     add_imm(X_DEFAULT_ADDR, reg_ptr, offset, X_TMP_0);
@@ -553,9 +603,8 @@ inline void jit_uni_pool_kernel_t<isa>::avg_step(int ur_w, int ur_bc, int pad_l,
                                 is_tail_processing(bci));
                         fadd(accvr, accvr, vmm_tmp_1);
                     } else {
-                        add_imm(X_DEFAULT_ADDR, aux_reg_input, input_offset,
-                                X_TMP_0);
-                        ld1w(z_tmp0.s, P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
+                        load(z_tmp0.getIdx(), aux_reg_input, input_offset,
+                                false);
                         fadd(accvr, accvr, z_tmp0.s);
                     }
                 }
@@ -722,7 +771,7 @@ inline void jit_uni_pool_kernel_t<isa>::max_step_fwd(int ur_w, int ur_bc,
                     st1b(vr.s, P_ALL_ONE, ptr(X_DEFAULT_ADDR));
                 }
             } else {
-                store(vr.getIdx(), reg_index, step_index,
+                store_f32(vr.getIdx(), reg_index, step_index,
                         is_tail_processing(bci));
             }
         }
@@ -764,7 +813,7 @@ inline void jit_uni_pool_kernel_t<isa>::max_step_bwd(int ur_w, int ur_bc,
                 ld1b(indvr.s, P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
             }
         } else {
-            load(indvr.getIdx(), reg_index, step_index,
+            load_f32(indvr.getIdx(), reg_index, step_index,
                     is_tail_processing(bci));
         }
     }
@@ -132,6 +132,10 @@ private:
             const bool is_c_tail_proccessing);
     void store(const int idx, const xreg_t &reg_ptr, const int offset,
             const bool is_c_tail_proccessing);
+    void load_f32(const int idx, const xreg_t &reg_ptr, const int offset,
+            const bool is_c_tail_proccessing);
+    void store_f32(const int idx, const xreg_t &reg_ptr, const int offset,
+            const bool is_c_tail_proccessing);
 
     void maybe_recalculate_divisor(int jj, int ur_w, int pad_l, int pad_r,
             bool with_c_tail_proccessing);
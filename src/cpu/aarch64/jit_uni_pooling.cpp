@@ -632,7 +632,9 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward(const data_t *src,
 
     if (jpp.tag_kind == jit_memory_tag_kind_t::nspc) {
         const auto nb2_c = utils::div_up(jpp.nb_c, jpp.ur_bc);
-        parallel_nd(jpp.mb, jpp.oh, nb2_c, [&](dim_t n, dim_t oh, dim_t b2_c) {
+        // Rows next to the padding have fewer taps, take them dynamically
+        parallel_nd_dynamic(jpp.mb, jpp.oh, nb2_c,
+                [&](dim_t n, dim_t oh, dim_t b2_c) {
             const auto b_c = b2_c * jpp.ur_bc;
             const auto ur_bc = nstl::min(dim_t(jpp.ur_bc), jpp.nb_c - b_c);
             ker(0, n, b_c, oh, ur_bc);
@@ -768,7 +770,9 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward_3d(const data_t *src,
 
     if (jpp.tag_kind == jit_memory_tag_kind_t::nspc) {
         const auto nb2_c = utils::div_up(jpp.nb_c, jpp.ur_bc);
-        parallel_nd(jpp.mb, jpp.od, nb2_c, [&](dim_t n, dim_t od, dim_t b2_c) {
+        // Slices next to the padding have fewer taps, take them dynamically
+        parallel_nd_dynamic(jpp.mb, jpp.od, nb2_c,
+                [&](dim_t n, dim_t od, dim_t b2_c) {
             const dim_t b_c = b2_c * jpp.ur_bc;
             const dim_t ur_bc = nstl::min(dim_t(jpp.ur_bc), jpp.nb_c - b_c);
 
@@ -1252,8 +1256,12 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward_3d(
 }
 
 template struct jit_uni_pooling_fwd_t<sve, data_type::f32>;
+template struct jit_uni_pooling_fwd_t<sve, data_type::bf16>;
+template struct jit_uni_pooling_fwd_t<sve, data_type::f16>;
 
 template struct jit_uni_pooling_bwd_t<sve, data_type::f32>;
+template struct jit_uni_pooling_bwd_t<sve, data_type::bf16>;
+template struct jit_uni_pooling_bwd_t<sve, data_type::f16>;
 
 } // namespace aarch64
 } // namespace cpu
@@ -0,0 +1,216 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/type_helpers.hpp"
+
+#include "cpu/aarch64/injectors/jit_uni_binary_injector.hpp"
+#include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/aarch64/jit_uni_post_ops_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+#define GET_OFF(field) (uint32_t) offsetof(jit_uni_post_ops_args_t, field)
+
+namespace {
+
+const bcast_set_t &get_supported_postops_bcast_strategies() {
+    static const bcast_set_t supported_strategies
+            = {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
+                    broadcasting_strategy_t::per_oc_spatial,
+                    broadcasting_strategy_t::no_broadcast};
+    return supported_strategies;
+}
+
+cpu_isa_t get_supported_isa() {
+    if (mayiuse(sve_512)) return sve_512;
+    if (mayiuse(sve_256)) return sve_256;
+    if (mayiuse(sve_128)) return sve_128;
+    return isa_undef;
+}
+
+} // namespace
+
+bool jit_uni_post_ops_kernel_base_t::post_ops_ok(
+        const post_ops_t &post_ops, const memory_desc_t &dst_md) {
+    using namespace injector;
+
+    const cpu_isa_t isa = get_supported_isa();
+    if (isa == isa_undef) return false;
+
+    const memory_desc_wrapper dst_d(dst_md);
+    if (dst_d.data_type() != data_type::f32 || !dst_d.is_dense()
+            || post_ops.len() == 0)
+        return false;
+
+    const auto &strategies = get_supported_postops_bcast_strategies();
+    for (const auto &e : post_ops.entry_) {
+        if (e.is_eltwise()) {
+            if (!eltwise_injector::is_alg_supported(e.eltwise.alg))
+                return false;
+        } else if (e.is_binary()) {
+            if (e.is_binary_with_ternary_op()) return false;
+            const auto &src1_md = e.binary.src1_desc;
+            if (src1_md.data_type != data_type::f32) return false;
+            // A full tensor is read with the offsets of dst
+            if (get_rhs_arg_broadcasting_strategy(src1_md, dst_d, strategies)
+                            == broadcasting_strategy_t::no_broadcast
+                    && !memory_desc_wrapper(src1_md).similar_to(
+                            dst_d, true, false))
+                return false;
+        } else {
+            return false;
+        }
+    }
+
+    return injector::post_ops_ok(post_ops_ok_args_t(isa, {eltwise, binary},
+            post_ops, &dst_d, false /*sum_at_pos_0_only*/,
+            false /*sum_requires_scale_one*/, true /*sum_requires_zp_zero*/,
+            true /*sum_requires_same_params*/, strategies));
+}
+
+status_t jit_uni_post_ops_kernel_base_t::create(
+        std::unique_ptr<jit_uni_post_ops_kernel_base_t> &ker,
+        const post_ops_t &post_ops, const memory_desc_t &dst_md) {
+    switch (get_supported_isa()) {
+        case sve_512:
+            CHECK(safe_ptr_assign(ker,
+                    new jit_uni_post_ops_kernel_t<sve_512>(post_ops, dst_md)));
+            break;
+        case sve_256:
+            CHECK(safe_ptr_assign(ker,
+                    new jit_uni_post_ops_kernel_t<sve_256>(post_ops, dst_md)));
+            break;
+        case sve_128:
+            CHECK(safe_ptr_assign(ker,
+                    new jit_uni_post_ops_kernel_t<sve_128>(post_ops, dst_md)));
+            break;
+        default: return status::unimplemented;
+    }
+    return ker->create_kernel();
+}
+
+template <cpu_isa_t isa>
+jit_uni_post_ops_kernel_t<isa>::jit_uni_post_ops_kernel_t(
+        const post_ops_t &post_ops, const memory_desc_t &dst_md)
+    : jit_uni_post_ops_kernel_base_t(isa)
+    , post_ops_(post_ops)
+    , dst_md_(dst_md)
+    , tail_size_(memory_desc_wrapper(dst_md).nelems(true) % simd_w_)
+    , with_binary_(post_ops.find(primitive_kind::binary) != -1)
+    , with_eltwise_(post_ops.find(primitive_kind::eltwise) != -1) {
+    static constexpr bool preserve_gpr = true;
+    static constexpr bool preserve_vmm = true;
+    static constexpr bool use_exact_tail_scalar_bcast = false;
+
+    const memory_desc_wrapper dst_d(dst_md_);
+    const binary_injector::rhs_arg_static_params_t rhs_arg_bsp {
+            static_cast<size_t>(rhs_dt_helper_vmm_.getIdx()),
+            reg_po_injector_helper_1_, reg_po_injector_helper_2_,
+            reg_po_injector_helper_3_, preserve_gpr, preserve_vmm,
+            GET_OFF(post_ops_binary_rhs_arg_vec), GET_OFF(dst_orig), dst_d,
+            tail_size_, p_tail_, use_exact_tail_scalar_bcast};
+    const binary_injector::static_params_t bsp(
+            reg_param_, get_supported_postops_bcast_strategies(), rhs_arg_bsp);
+
+    postops_injector_ = utils::make_unique<
+            injector::jit_uni_postops_injector_t<to_vla_sve(isa)>>(
+            this, post_ops_, bsp);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_post_ops_kernel_t<isa>::compute(int unroll, bool is_tail) {
+    const PReg &p = is_tail ? p_tail_ : p_full_;
+    for (int i = 0; i < unroll; i++)
+        ld1w(vmm_data(i).s, p / T_z, ptr(reg_dst_, i, MUL_VL));
+
+    binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+    if (with_binary_)
+        for (int i = 0; i < unroll; i++) {
+            const size_t idx = vmm_data(i).getIdx();
+            rhs_arg_params.vmm_idx_to_out_reg.emplace(idx, reg_dst_);
+            rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(idx, i * vlen_);
+            if (is_tail) rhs_arg_params.vmm_tail_idx_.emplace(idx);
+        }
+    postops_injector_->compute_vector_range(vmm_data(0).getIdx(),
+            vmm_data(unroll - 1).getIdx() + 1, rhs_arg_params);
+
+    for (int i = 0; i < unroll; i++)
+        st1w(vmm_data(i).s, p, ptr(reg_dst_, i, MUL_VL));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_post_ops_kernel_t<isa>::generate() {
+    preamble();
+
+    switch (simd_w_) {
+        case 16: ptrue(p_full_.s, VL16); break;
+        case 8: ptrue(p_full_.s, VL8); break;
+        case 4: ptrue(p_full_.s, VL4); break;
+        default: assert(!"unreachable");
+    }
+    if (tail_size_ > 0) set_preg(p_tail_.s, tail_size_, X_TMP_0, X_TMP_1);
+
+    ldr(reg_dst_, ptr(reg_param_, GET_OFF(dst)));
+    ldr(reg_nelems_, ptr(reg_param_, GET_OFF(nelems)));
+
+    Label l_unroll_loop, l_single_loop, l_tail, l_end;
+    L(l_unroll_loop);
+    {
+        cmp_imm(reg_nelems_, max_unroll_ * simd_w_, X_TMP_0);
+        b(LT, l_single_loop);
+        compute(max_unroll_, false);
+        add_imm(reg_dst_, reg_dst_, max_unroll_ * vlen_, X_TMP_0);
+        sub_imm(reg_nelems_, reg_nelems_, max_unroll_ * simd_w_, X_TMP_0);
+        b(l_unroll_loop);
+    }
+    L(l_single_loop);
+    {
+        cmp_imm(reg_nelems_, simd_w_, X_TMP_0);
+        b(LT, l_tail);
+        compute(1, false);
+        add_imm(reg_dst_, reg_dst_, vlen_, X_TMP_0);
+        sub_imm(reg_nelems_, reg_nelems_, simd_w_, X_TMP_0);
+        b(l_single_loop);
+    }
+    L(l_tail);
+    if (tail_size_ > 0) {
+        cbz(reg_nelems_, l_end);
+        compute(1, true);
+    }
+    L(l_end);
+
+    postamble();
+
+    if (with_eltwise_) postops_injector_->prepare_table();
+}
+
+template struct jit_uni_post_ops_kernel_t<sve_512>;
+template struct jit_uni_post_ops_kernel_t<sve_256>;
+template struct jit_uni_post_ops_kernel_t<sve_128>;
+
+#undef GET_OFF
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_POST_OPS_KERNEL_HPP
+#define CPU_AARCH64_JIT_UNI_POST_OPS_KERNEL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/injectors/jit_uni_postops_injector.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct jit_uni_post_ops_args_t {
+    // First element to process and the number of elements
+    void *dst = nullptr;
+    size_t nelems = 0;
+    const void *post_ops_binary_rhs_arg_vec = nullptr;
+    // Start of the tensor, used for the offsets of the binary post-ops
+    const void *dst_orig = nullptr;
+};
+
+// Applies a chain of eltwise and binary post-ops in place to a range of a
+// dense f32 tensor, so that the whole chain takes a single read and write of
+// each element. Only the last range of the tensor may end with a partial
+// vector.
+struct jit_uni_post_ops_kernel_base_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_post_ops_kernel)
+
+    jit_uni_post_ops_kernel_base_t(cpu_isa_t isa)
+        : jit_generator_t(nullptr, MAX_CODE_SIZE, true, isa) {}
+    ~jit_uni_post_ops_kernel_base_t() override = default;
+
+    void operator()(const jit_uni_post_ops_args_t *args) {
+        jit_generator_t::operator()(args);
+    }
+
+    virtual size_t get_simd_w() const = 0;
+
+    // Returns true if the post-ops can be applied to the tensor on this CPU
+    static bool post_ops_ok(
+            const post_ops_t &post_ops, const memory_desc_t &dst_md);
+
+    static status_t create(std::unique_ptr<jit_uni_post_ops_kernel_base_t> &ker,
+            const post_ops_t &post_ops, const memory_desc_t &dst_md);
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_post_ops_kernel_t : public jit_uni_post_ops_kernel_base_t {
+    jit_uni_post_ops_kernel_t(
+            const post_ops_t &post_ops, const memory_desc_t &dst_md);
+    ~jit_uni_post_ops_kernel_t() override = default;
+
+    size_t get_simd_w() const override { return simd_w_; }
+
+private:
+    using ZReg = Xbyak_aarch64::ZReg;
+    using PReg = Xbyak_aarch64::PReg;
+    using XReg = Xbyak_aarch64::XReg;
+
+    void compute(int unroll, bool is_tail);
+    void generate() override;
+
+    static constexpr int vlen_ = cpu_isa_traits<isa>::vlen;
+    static constexpr size_t simd_w_ = vlen_ / sizeof(float);
+    static constexpr int max_unroll_ = 8;
+
+    const post_ops_t post_ops_;
+    const memory_desc_t dst_md_;
+    const size_t tail_size_;
+    const bool with_binary_;
+    const bool with_eltwise_;
+
+    std::unique_ptr<injector::jit_uni_postops_injector_t<to_vla_sve(isa)>>
+            postops_injector_;
+
+    ZReg vmm_data(int i) const { return ZReg(16 + i); }
+    const ZReg rhs_dt_helper_vmm_ = ZReg(31);
+
+    const PReg p_full_ = p2;
+    const PReg p_tail_ = p3;
+
+    const XReg reg_param_ = x0;
+    const XReg reg_dst_ = x1;
+    const XReg reg_nelems_ = x2;
+    const XReg reg_po_injector_helper_1_ = x14;
+    const XReg reg_po_injector_helper_2_ = x15;
+    const XReg reg_po_injector_helper_3_ = x13;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,285 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/aarch64/jit_uni_reduction.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+static cpu_isa_t get_supported_isa() {
+    if (mayiuse(sve_512)) return sve_512;
+    if (mayiuse(sve_256)) return sve_256;
+    if (mayiuse(sve_128)) return sve_128;
+
+    return isa_undef;
+}
+
+static bool impl_supports_datatype(data_type_t data_type, bool is_dst) {
+    switch (data_type) {
+        case data_type::bf16: return !is_dst || mayiuse_bf16();
+        case data_type::f16:
+        case data_type::f32:
+        case data_type::s32:
+        case data_type::s8:
+        case data_type::u8: return true;
+        default: return false;
+    }
+}
+
+// Views src as [idle_size][reduce_size][inner_size] following the physical
+// order of the dimensions. The reduced dimensions must be adjacent in memory.
+status_t jit_uni_reduction_t::pd_t::init_layout(engine_t *engine) {
+    using namespace format_tag;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    const format_tag_t tag = memory_desc_matches_one_of_tag(*src_md(), a, ab,
+            abc, abcd, abcde, acb, acdb, acdeb, aBc16b, aBcd16b, aBcde16b,
+            aBc8b, aBcd8b, aBcde8b, aBc4b, aBcd4b, aBcde4b);
+    VDISPATCH_REDUCTION(tag != format_tag::undef
+                    && memory_desc_matches_tag(*dst_md(), tag),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_REDUCTION(src_d.is_dense() && dst_d.is_dense(),
+            VERBOSE_UNSUPPORTED_PAD_FEATURE, "");
+
+    dim_t blk = 1;
+    if (utils::one_of(tag, aBc16b, aBcd16b, aBcde16b))
+        blk = 16;
+    else if (utils::one_of(tag, aBc8b, aBcd8b, aBcde8b))
+        blk = 8;
+    else if (utils::one_of(tag, aBc4b, aBcd4b, aBcde4b))
+        blk = 4;
+    const bool is_nspc = utils::one_of(tag, acb, acdb, acdeb);
+
+    const int ndims = src_d.ndims();
+    const auto &src_dims = src_d.dims();
+    const auto &dst_dims = dst_d.dims();
+
+    std::vector<dim_t> src_phys, dst_phys;
+    const auto push_dim = [&](dim_t s, dim_t d) {
+        src_phys.push_back(s);
+        dst_phys.push_back(d);
+    };
+
+    if (is_nspc) {
+        push_dim(src_dims[0], dst_dims[0]);
+        for (int d = 2; d < ndims; d++)
+            push_dim(src_dims[d], dst_dims[d]);
+        push_dim(src_dims[1], dst_dims[1]);
+    } else if (blk > 1) {
+        // Reduction over the blocked dimension is not supported
+        VDISPATCH_REDUCTION(
+                src_dims[1] == dst_dims[1] && src_dims[1] % blk == 0,
+                VERBOSE_UNSUPPORTED_TAG);
+        push_dim(src_dims[0], dst_dims[0]);
+        push_dim(src_dims[1] / blk, dst_dims[1] / blk);
+        for (int d = 2; d < ndims; d++)
+            push_dim(src_dims[d], dst_dims[d]);
+        push_dim(blk, blk);
+    } else {
+        for (int d = 0; d < ndims; d++)
+            push_dim(src_dims[d], dst_dims[d]);
+    }
+
+    const int nphys = static_cast<int>(src_phys.size());
+    int first_reduced = -1, last_reduced = -1;
+    for (int d = 0; d < nphys; d++) {
+        if (src_phys[d] == dst_phys[d]) continue;
+        if (first_reduced < 0) first_reduced = d;
+        last_reduced = d;
+    }
+    VDISPATCH_REDUCTION(
+            first_reduced >= 0, "dimensionality reduction not possible");
+
+    conf_.idle_size = 1;
+    conf_.reduce_size = 1;
+    conf_.inner_size = 1;
+    for (int d = 0; d < nphys; d++) {
+        const bool is_reduced = src_phys[d] != dst_phys[d];
+        if (d < first_reduced)
+            conf_.idle_size *= src_phys[d];
+        else if (d > last_reduced)
+            conf_.inner_size *= src_phys[d];
+        else {
+            VDISPATCH_REDUCTION(is_reduced || src_phys[d] == 1,
+                    "reduced dimensions are not adjacent in memory");
+            conf_.reduce_size *= src_phys[d];
+        }
+    }
+
+    if (conf_.inner_size > 1) {
+        const dim_t simd_w = isa_max_vlen(conf_.isa) / sizeof(float);
+        const dim_t max_block
+                = jit_uni_reduction_kernel_base_t::max_unroll * simd_w;
+        conf_.inner_block = nstl::min(conf_.inner_size, max_block);
+        conf_.inner_nblocks
+                = utils::div_up(conf_.inner_size, conf_.inner_block);
+    }
+
+    return status::success;
+}
+
+status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
+    using namespace alg_kind;
+    using namespace data_type;
+    using sm = primitive_attr_t::skip_mask_t;
+
+    conf_.isa = get_supported_isa();
+    VDISPATCH_REDUCTION(conf_.isa != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    conf_.src_type = src_md()->data_type;
+    conf_.dst_type = dst_md()->data_type;
+    conf_.src_dt_size = types::data_type_size(conf_.src_type);
+    conf_.dst_dt_size = types::data_type_size(conf_.dst_type);
+
+    VDISPATCH_REDUCTION(impl_supports_datatype(conf_.src_type, false),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_REDUCTION(impl_supports_datatype(conf_.dst_type, true),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_REDUCTION(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_REDUCTION(
+            attr()->has_default_values(sm::post_ops), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_REDUCTION(attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_REDUCTION(impl::is_dense_format_kind({src_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    conf_.alg = desc()->alg_kind;
+    VDISPATCH_REDUCTION(
+            !(utils::one_of(conf_.alg, reduction_norm_lp_max,
+                    reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+                    reduction_norm_lp_power_p_sum)),
+            VERBOSE_BAD_ALGORITHM);
+
+    const auto dst_mdw = memory_desc_wrapper(dst_md());
+
+    const std::vector<injector::post_op_type> accepted_post_ops
+            = {injector::sum, injector::eltwise, injector::binary};
+    static constexpr bool sum_at_0_pos_only = false;
+    static constexpr bool sum_requires_scale_one = false;
+    static constexpr bool sum_requires_zp_zero = true;
+    static constexpr bool sum_requires_same_params = false;
+    const bcast_set_t accepted_broadcasts
+            = {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
+                    broadcasting_strategy_t::per_oc_spatial,
+                    broadcasting_strategy_t::no_broadcast};
+    injector::post_ops_ok_args_t post_ops_args(conf_.isa, accepted_post_ops,
+            attr()->post_ops_, &dst_mdw, sum_at_0_pos_only,
+            sum_requires_scale_one, sum_requires_zp_zero,
+            sum_requires_same_params, accepted_broadcasts);
+    VDISPATCH_REDUCTION(post_ops_ok(post_ops_args), VERBOSE_UNSUPPORTED_POSTOP);
+
+    conf_.post_ops = attr()->post_ops_;
+
+    static constexpr bool require_scale_one = false;
+    conf_.with_eltwise = conf_.with_binary = conf_.with_sum = false;
+    for (const auto &entry : conf_.post_ops.entry_) {
+        if (entry.is_eltwise()) {
+            conf_.with_eltwise = true;
+        } else if (entry.is_binary()) {
+            conf_.with_binary = true;
+        } else if (entry.is_sum(require_scale_one) && entry.sum.scale != 0.f) {
+            conf_.with_sum = true;
+            conf_.sum_scales.push(entry.sum.scale);
+        }
+    }
+    conf_.with_postops
+            = conf_.with_eltwise || conf_.with_binary || conf_.with_sum;
+
+    conf_.is_saturation_needed = utils::one_of(conf_.dst_type, s32, s8, u8);
+
+    CHECK(init_layout(engine));
+
+    return status::success;
+}
+
+status_t jit_uni_reduction_t::init(engine_t *engine) {
+    const memory_desc_t *dst_md = pd()->dst_md();
+    const jit_reduction_conf_t &conf = pd()->get_conf();
+
+    CHECK(get_proper_kernel(dst_md, conf));
+    CHECK(kernel_->create_kernel());
+
+    return status::success;
+}
+
+status_t jit_uni_reduction_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
+
+    const auto &conf = pd()->get_conf();
+    const dim_t idle_size = conf.idle_size;
+    const dim_t reduce_size = conf.reduce_size;
+    const dim_t inner_size = conf.inner_size;
+    const dim_t inner_block = conf.inner_block;
+    const dim_t inner_nblocks = conf.inner_nblocks;
+    const std::size_t src_dt_size = conf.src_dt_size;
+    const std::size_t dst_dt_size = conf.dst_dt_size;
+    const auto &post_ops = pd()->attr()->post_ops_;
+    const auto &post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(post_ops, ctx);
+
+    parallel_nd(idle_size, inner_nblocks,
+            [&](dim_t i, dim_t ib) {
+                const dim_t inner_off = ib * inner_block;
+                const dim_t src_off
+                        = (i * reduce_size * inner_size + inner_off)
+                        * src_dt_size;
+                const dim_t dst_off
+                        = (i * inner_size + inner_off) * dst_dt_size;
+
+                jit_uni_reduction_args_t args;
+                args.src = src + src_off;
+                args.dst = dst + dst_off;
+                args.dst_orig = dst;
+                args.post_ops_binary_rhs_arg_vec
+                        = post_ops_binary_rhs_arg_vec.data();
+                args.is_last_block = ib == inner_nblocks - 1;
+
+                (*kernel_)(&args);
+            });
+
+    return status::success;
+}
+
+status_t jit_uni_reduction_t::get_proper_kernel(
+        const memory_desc_t *dst_md, const jit_reduction_conf_t &conf) {
+    if (conf.isa == sve_512)
+        return safe_ptr_assign(kernel_,
+                new jit_uni_reduction_kernel_t<sve_512>(conf, dst_md));
+    else if (conf.isa == sve_256)
+        return safe_ptr_assign(kernel_,
+                new jit_uni_reduction_kernel_t<sve_256>(conf, dst_md));
+    else if (conf.isa == sve_128)
+        return safe_ptr_assign(kernel_,
+                new jit_uni_reduction_kernel_t<sve_128>(conf, dst_md));
+    else
+        return status::runtime_error;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
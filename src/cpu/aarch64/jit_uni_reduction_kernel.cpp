@@ -0,0 +1,405 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/aarch64/jit_uni_reduction_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+#define GET_OFF(field) (uint32_t) offsetof(jit_uni_reduction_args_t, field)
+
+static const bcast_set_t &get_supported_postops_bcast_strategies() {
+    static const bcast_set_t supported_strategies
+            = {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
+                    broadcasting_strategy_t::per_oc_spatial,
+                    broadcasting_strategy_t::no_broadcast};
+    return supported_strategies;
+}
+
+template <cpu_isa_t isa>
+jit_uni_reduction_kernel_t<isa>::jit_uni_reduction_kernel_t(
+        const jit_reduction_conf_t &conf, const memory_desc_t *dst_md)
+    : jit_uni_reduction_kernel_base_t(conf)
+    , is_horizontal_(conf.inner_size == 1)
+    , load_tail_size_(is_horizontal_
+                      ? conf.reduce_size % simd_w_
+                      : (conf.inner_size
+                                - (conf.inner_nblocks - 1) * conf.inner_block)
+                              % simd_w_)
+    , store_tail_size_(is_horizontal_ ? 1 : load_tail_size_) {
+    init_compute_op();
+    if (conf_.with_postops) init_post_ops_injector(dst_md);
+}
+
+template <cpu_isa_t isa>
+float jit_uni_reduction_kernel_t<isa>::starting_value() const {
+    using namespace alg_kind;
+    using namespace nstl;
+
+    switch (conf_.alg) {
+        case reduction_max: return numeric_limits<float>::lowest();
+        case reduction_min: return numeric_limits<float>::max();
+        case reduction_mean:
+        case reduction_sum: return 0.f;
+        case reduction_mul: return 1.f;
+        default: assert(!"unknown alg");
+    }
+    return 0.f;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::init_acc(int nvecs) {
+    init_vmm(vmm_acc(0), reg_tmp_, starting_value());
+    for (int i = 1; i < nvecs; i++)
+        mov(vmm_acc(i).d, vmm_acc(0).d);
+}
+
+// Merges `to_acc` into `acc` on the lanes active in `p`, the remaining lanes
+// of `acc` are left untouched.
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::init_compute_op() {
+    using namespace alg_kind;
+    switch (conf_.alg) {
+        case reduction_max:
+            compute_op_ = [&](const ZReg &acc, const ZReg &to_acc,
+                                  const PReg &p) {
+                fmax(acc.s, p / T_m, to_acc.s);
+            };
+            break;
+        case reduction_min:
+            compute_op_ = [&](const ZReg &acc, const ZReg &to_acc,
+                                  const PReg &p) {
+                fmin(acc.s, p / T_m, to_acc.s);
+            };
+            break;
+        case reduction_mean:
+        case reduction_sum:
+            compute_op_ = [&](const ZReg &acc, const ZReg &to_acc,
+                                  const PReg &p) {
+                fadd(acc.s, p / T_m, to_acc.s);
+            };
+            break;
+        case reduction_mul:
+            compute_op_ = [&](const ZReg &acc, const ZReg &to_acc,
+                                  const PReg &p) {
+                fmul(acc.s, p / T_m, to_acc.s);
+            };
+            break;
+        default: assert(!"unsupported alg.");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::init_post_ops_injector(
+        const memory_desc_t *dst_md) {
+    const memory_desc_wrapper dst_d(*dst_md);
+
+    static constexpr bool preserve_gpr = true;
+    static constexpr bool preserve_vmm = true;
+    static constexpr bool use_exact_tail_scalar_bcast = false;
+
+    const binary_injector::rhs_arg_static_params_t rhs_arg_bsp {
+            static_cast<size_t>(rhs_dt_helper_vmm_.getIdx()),
+            reg_po_injector_helper_1_, reg_po_injector_helper_2_,
+            reg_po_injector_helper_3_, preserve_gpr, preserve_vmm,
+            GET_OFF(post_ops_binary_rhs_arg_vec), GET_OFF(dst_orig), dst_d,
+            store_tail_size_, p_store_tail_, use_exact_tail_scalar_bcast};
+    const binary_injector::static_params_t bsp(
+            reg_param_, get_supported_postops_bcast_strategies(), rhs_arg_bsp);
+
+    postops_injector_ = utils::make_unique<
+            injector::jit_uni_postops_injector_t<to_vla_sve(isa)>>(
+            this, conf_.post_ops, bsp);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::load(
+        const ZReg &vmm, const XReg &addr, const PReg &p, data_type_t dt) {
+    switch (dt) {
+        case data_type::f32: ld1w(vmm.s, p / T_z, ptr(addr)); break;
+        case data_type::s32:
+            ld1w(vmm.s, p / T_z, ptr(addr));
+            scvtf(vmm.s, p_full_ / T_m, vmm.s);
+            break;
+        case data_type::bf16:
+            ld1h(vmm.s, p / T_z, ptr(addr));
+            lsl(vmm.s, vmm.s, 16);
+            break;
+        case data_type::f16:
+            ld1h(vmm.s, p / T_z, ptr(addr));
+            fcvt(vmm.s, p_full_ / T_m, vmm.h);
+            break;
+        case data_type::s8:
+            ld1sb(vmm.s, p / T_z, ptr(addr));
+            scvtf(vmm.s, p_full_ / T_m, vmm.s);
+            break;
+        case data_type::u8:
+            ld1b(vmm.s, p / T_z, ptr(addr));
+            scvtf(vmm.s, p_full_ / T_m, vmm.s);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::store(
+        const ZReg &vmm, const XReg &addr, const PReg &p) {
+    if (conf_.is_saturation_needed) {
+        saturate_f32(vmm, vmm_zero_saturation_, vmm_saturation_ubound_,
+                conf_.dst_type, p_full_, true);
+        frintn(vmm.s, p_full_ / T_m, vmm.s);
+        fcvtzs(vmm.s, p_full_ / T_m, vmm.s);
+    }
+
+    switch (conf_.dst_type) {
+        case data_type::f32:
+        case data_type::s32: st1w(vmm.s, p, ptr(addr)); break;
+        case data_type::bf16:
+            bfcvt(vmm.h, p_full_ / T_m, vmm.s);
+            st1h(vmm.s, p, ptr(addr));
+            break;
+        case data_type::f16:
+            fcvt(vmm.h, p_full_ / T_m, vmm.s);
+            st1h(vmm.s, p, ptr(addr));
+            break;
+        case data_type::s8:
+        case data_type::u8: st1b(vmm.s, p, ptr(addr)); break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+// Tree reduction of the simd_w lanes of `acc`, the result is left in lane 0.
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::reduce_vmm_to_scalar(
+        const ZReg &acc, const ZReg &tmp) {
+    for (std::size_t half = simd_w_ / 2; half > 0; half /= 2) {
+        mov(tmp.d, acc.d);
+        ext(tmp.b, acc.b, half * sizeof(float));
+        compute_op_(acc, tmp, p_full_);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::apply_sum(
+        const int data_idx, const XReg &addr, const PReg &p) {
+    if (conf_.with_sum) {
+        assert(!conf_.sum_scales.empty()
+                && "No scales for sum post operation.");
+        const auto sum_injector = [this, data_idx, addr, p]() {
+            const ZReg vmm_dst(data_idx);
+
+            load(vmm_prev_dst_, addr, p, conf_.dst_type);
+            const float sum_scale = sum_scales_.front();
+            if (sum_scale == 1.f)
+                fadd(vmm_dst.s, vmm_dst.s, vmm_prev_dst_.s);
+            else {
+                init_vmm(vmm_sum_scale_, reg_tmp_, sum_scale);
+                fmla(vmm_dst.s, p_full_ / T_m, vmm_prev_dst_.s,
+                        vmm_sum_scale_.s);
+            }
+            sum_scales_.push(sum_scale);
+            sum_scales_.pop();
+        };
+        postops_injector_->set_lambda_injector(
+                primitive_kind::sum, sum_injector);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::apply_postops(const int data_idx,
+        const XReg &addr, const PReg &p, dim_t out_off, bool is_tail) {
+    binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+
+    if (conf_.with_sum) apply_sum(data_idx, addr, p);
+
+    if (conf_.with_binary) {
+        rhs_arg_params.vmm_idx_to_out_reg.emplace(data_idx, reg_dst_);
+        rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(data_idx, out_off);
+        if (is_tail) rhs_arg_params.vmm_tail_idx_.emplace(data_idx);
+    }
+
+    postops_injector_->compute_vector(data_idx, rhs_arg_params);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::reduce_horizontal() {
+    const std::size_t src_dt_size = conf_.src_dt_size;
+    const dim_t nvecs = conf_.reduce_size / simd_w_;
+    const int ur = static_cast<int>(
+            nstl::max(dim_t(1), nstl::min(dim_t(max_unroll), nvecs)));
+    const dim_t niters = nvecs / ur;
+    const int rem = static_cast<int>(nvecs % ur);
+
+    const auto load_and_compute = [&](int i, dim_t off, const PReg &p) {
+        const XReg addr = off ? reg_addr_ : reg_src_;
+        if (off) add_imm(reg_addr_, reg_src_, off, X_TMP_0);
+        load(vmm_tmp(i), addr, p, conf_.src_type);
+        compute_op_(vmm_acc(i), vmm_tmp(i), p);
+    };
+
+    init_acc(ur);
+
+    if (niters > 0) {
+        Label l_loop;
+        mov_imm(reg_work_, niters);
+        L(l_loop);
+        {
+            for (int u = 0; u < ur; u++)
+                load_and_compute(u, u * simd_w_ * src_dt_size, p_full_);
+            add_imm(reg_src_, reg_src_, ur * simd_w_ * src_dt_size, X_TMP_0);
+            subs(reg_work_, reg_work_, 1);
+            b(NE, l_loop);
+        }
+    }
+    for (int u = 0; u < rem; u++)
+        load_and_compute(u, u * simd_w_ * src_dt_size, p_full_);
+    if (load_tail_size_ > 0)
+        load_and_compute(0, rem * simd_w_ * src_dt_size, p_load_tail_);
+
+    for (int u = 1; u < ur; u++)
+        compute_op_(vmm_acc(0), vmm_acc(u), p_full_);
+    reduce_vmm_to_scalar(vmm_acc(0), vmm_tmp(0));
+
+    if (conf_.alg == alg_kind::reduction_mean)
+        fdiv(vmm_acc(0).s, p_full_ / T_m, vmm_reduce_size_.s);
+
+    if (conf_.with_postops)
+        apply_postops(vmm_acc(0).getIdx(), reg_dst_, p_store_tail_, 0, true);
+
+    store(vmm_acc(0), reg_dst_, p_store_tail_);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::reduce_vertical(dim_t block_size) {
+    const std::size_t src_dt_size = conf_.src_dt_size;
+    const std::size_t dst_dt_size = conf_.dst_dt_size;
+    const int nvecs = static_cast<int>(utils::div_up(block_size, simd_w_));
+    const bool has_tail = block_size % simd_w_ != 0;
+    assert(nvecs <= max_unroll);
+    assert(IMPLICATION(has_tail, load_tail_size_ == block_size % simd_w_));
+
+    const auto is_tail = [&](int v) { return has_tail && v == nvecs - 1; };
+    const auto vec_addr = [&](const XReg &base, dim_t off) {
+        if (!off) return base;
+        add_imm(reg_addr_, base, off, X_TMP_0);
+        return reg_addr_;
+    };
+
+    init_acc(nvecs);
+
+    Label l_loop;
+    mov(reg_src_aux_, reg_src_);
+    mov_imm(reg_work_, conf_.reduce_size);
+    L(l_loop);
+    {
+        for (int v = 0; v < nvecs; v++) {
+            const PReg p = is_tail(v) ? p_load_tail_ : p_full_;
+            const XReg addr = vec_addr(reg_src_aux_, v * simd_w_ * src_dt_size);
+            load(vmm_tmp(v), addr, p, conf_.src_type);
+            compute_op_(vmm_acc(v), vmm_tmp(v), p_full_);
+        }
+        add_imm(reg_src_aux_, reg_src_aux_, conf_.inner_size * src_dt_size,
+                X_TMP_0);
+        subs(reg_work_, reg_work_, 1);
+        b(NE, l_loop);
+    }
+
+    for (int v = 0; v < nvecs; v++) {
+        const PReg p = is_tail(v) ? p_store_tail_ : p_full_;
+        const dim_t out_off = v * simd_w_ * dst_dt_size;
+
+        if (conf_.alg == alg_kind::reduction_mean)
+            fdiv(vmm_acc(v).s, p_full_ / T_m, vmm_reduce_size_.s);
+
+        if (conf_.with_postops) {
+            const XReg addr = vec_addr(reg_dst_, out_off);
+            apply_postops(vmm_acc(v).getIdx(), addr, p, out_off, is_tail(v));
+        }
+
+        store(vmm_acc(v), vec_addr(reg_dst_, out_off), p);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::load_params() {
+    ldr(reg_src_, ptr(reg_param_, GET_OFF(src)));
+    ldr(reg_dst_, ptr(reg_param_, GET_OFF(dst)));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_reduction_kernel_t<isa>::generate() {
+    preamble();
+
+    switch (simd_w_) {
+        case 16: ptrue(p_full_.s, VL16); break;
+        case 8: ptrue(p_full_.s, VL8); break;
+        case 4: ptrue(p_full_.s, VL4); break;
+        default: assert(!"unreachable");
+    }
+    if (load_tail_size_ > 0)
+        set_preg(p_load_tail_.s, load_tail_size_, X_TMP_0, X_TMP_1);
+    if (store_tail_size_ > 0)
+        set_preg(p_store_tail_.s, store_tail_size_, X_TMP_0, X_TMP_1);
+
+    if (conf_.is_saturation_needed)
+        init_saturate_f32(vmm_zero_saturation_, vmm_saturation_ubound_,
+                reg_tmp_, data_type::f32, conf_.dst_type, true);
+    if (conf_.alg == alg_kind::reduction_mean)
+        init_vmm(vmm_reduce_size_, reg_tmp_,
+                static_cast<float>(conf_.reduce_size));
+
+    load_params();
+
+    if (is_horizontal_) {
+        reduce_horizontal();
+    } else {
+        const dim_t last_block_size = conf_.inner_size
+                - (conf_.inner_nblocks - 1) * conf_.inner_block;
+        if (last_block_size == conf_.inner_block) {
+            reduce_vertical(conf_.inner_block);
+        } else {
+            Label l_last_block, l_end;
+            ldr(reg_tmp_, ptr(reg_param_, GET_OFF(is_last_block)));
+            cbnz(reg_tmp_, l_last_block);
+            reduce_vertical(conf_.inner_block);
+            b(l_end);
+            L(l_last_block);
+            reduce_vertical(last_block_size);
+            L(l_end);
+        }
+    }
+
+    postamble();
+
+    if (conf_.with_eltwise && postops_injector_)
+        postops_injector_->prepare_table();
+}
+
+template struct jit_uni_reduction_kernel_t<sve_512>;
+template struct jit_uni_reduction_kernel_t<sve_256>;
+template struct jit_uni_reduction_kernel_t<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,135 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_REDUCTION_KERNEL_HPP
+#define CPU_AARCH64_JIT_UNI_REDUCTION_KERNEL_HPP
+
+#include <functional>
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/injectors/jit_uni_postops_injector.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct jit_uni_reduction_kernel_base_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reduction)
+
+    jit_uni_reduction_kernel_base_t(const jit_reduction_conf_t &conf)
+        : jit_generator_t(nullptr, MAX_CODE_SIZE, true, conf.isa)
+        , conf_(conf)
+        , sum_scales_(conf_.sum_scales) {}
+    ~jit_uni_reduction_kernel_base_t() override = default;
+
+    virtual std::size_t get_simd_w() = 0;
+
+    // Maximum number of vectors accumulated independently
+    static constexpr int max_unroll = 4;
+
+protected:
+    const jit_reduction_conf_t &conf_;
+    std::queue<float> sum_scales_;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_reduction_kernel_t : public jit_uni_reduction_kernel_base_t {
+    jit_uni_reduction_kernel_t(
+            const jit_reduction_conf_t &conf, const memory_desc_t *dst_md);
+
+    ~jit_uni_reduction_kernel_t() override = default;
+
+    std::size_t get_simd_w() override { return simd_w_; }
+
+private:
+    using ZReg = Xbyak_aarch64::ZReg;
+    using PReg = Xbyak_aarch64::PReg;
+    using XReg = Xbyak_aarch64::XReg;
+    using compute_fn_t = std::function<void(
+            const ZReg &acc, const ZReg &to_acc, const PReg &p)>;
+
+    void init_compute_op();
+    void init_post_ops_injector(const memory_desc_t *dst_md);
+
+    float starting_value() const;
+    void init_acc(int nvecs);
+    void load(const ZReg &vmm, const XReg &addr, const PReg &p,
+            data_type_t dt);
+    void store(const ZReg &vmm, const XReg &addr, const PReg &p);
+    void reduce_vmm_to_scalar(const ZReg &acc, const ZReg &tmp);
+
+    void reduce_horizontal();
+    void reduce_vertical(dim_t block_size);
+
+    void apply_sum(const int data_idx, const XReg &addr, const PReg &p);
+    void apply_postops(const int data_idx, const XReg &addr, const PReg &p,
+            dim_t out_off, bool is_tail);
+    void load_params();
+    void generate() override;
+
+    static constexpr int vlen_ = cpu_isa_traits<isa>::vlen;
+    static constexpr std::size_t simd_w_ = vlen_ / sizeof(float);
+
+    ZReg vmm_acc(int i) const { return ZReg(16 + i); }
+    ZReg vmm_tmp(int i) const { return ZReg(16 + max_unroll + i); }
+    const ZReg vmm_reduce_size_ = ZReg(25);
+    const ZReg vmm_sum_scale_ = ZReg(26);
+    const ZReg vmm_prev_dst_ = ZReg(27);
+    const ZReg vmm_zero_saturation_ = ZReg(28);
+    const ZReg vmm_saturation_ubound_ = ZReg(29);
+    const ZReg rhs_dt_helper_vmm_ = ZReg(31);
+
+    // p1, p4 and p6 are used by the eltwise injector
+    const PReg p_full_ = p2;
+    const PReg p_load_tail_ = p3;
+    const PReg p_store_tail_ = p5;
+
+    const XReg reg_param_ = x0;
+    const XReg reg_src_ = x1;
+    const XReg reg_dst_ = x2;
+    const XReg reg_work_ = x3;
+    const XReg reg_src_aux_ = x4;
+    const XReg reg_addr_ = x5;
+    const XReg reg_tmp_ = x6;
+    const XReg reg_po_injector_helper_1_ = x14;
+    const XReg reg_po_injector_helper_2_ = x15;
+    const XReg reg_po_injector_helper_3_ = x13;
+
+    // Horizontal reduction (inner_size == 1) stores a single value per call
+    const bool is_horizontal_;
+    const std::size_t load_tail_size_;
+    const std::size_t store_tail_size_;
+
+    compute_fn_t compute_op_;
+
+    std::unique_ptr<injector::jit_uni_postops_injector_t<to_vla_sve(isa)>>
+            postops_injector_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,580 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cassert>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/resampling_utils.hpp"
+
+#include "cpu/aarch64/jit_uni_resampling.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace resampling_utils;
+
+static cpu_isa_t get_supported_isa() {
+    if (mayiuse(sve_512)) return sve_512;
+    if (mayiuse(sve_256)) return sve_256;
+    if (mayiuse(sve_128)) return sve_128;
+
+    return isa_undef;
+}
+
+static bool impl_supports_datatype(data_type_t data_type, bool is_dst) {
+    switch (data_type) {
+        case data_type::bf16: return !is_dst || mayiuse_bf16();
+        case data_type::f16:
+        case data_type::f32:
+        case data_type::s32:
+        case data_type::s8:
+        case data_type::u8: return true;
+        default: return false;
+    }
+}
+
+status_t jit_uni_resampling_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using sm = primitive_attr_t::skip_mask_t;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    conf_.src_data_type = src_md()->data_type;
+    conf_.dst_data_type = dst_md()->data_type;
+
+    fill_format_tag_info();
+    conf_.isa = get_supported_isa();
+
+    VDISPATCH_RESAMPLING(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_RESAMPLING(conf_.isa != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_RESAMPLING(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "src");
+    VDISPATCH_RESAMPLING(
+            conf_.src_tag != format_tag::undef, VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_RESAMPLING(set_default_params(conf_.src_tag) == status::success,
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_RESAMPLING(impl_supports_datatype(conf_.src_data_type, false),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_RESAMPLING(impl_supports_datatype(conf_.dst_data_type, true),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_RESAMPLING(
+            attr()->has_default_values(sm::post_ops, conf_.dst_data_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_RESAMPLING(
+            attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_RESAMPLING(memory_desc_matches_tag(*dst_md(), conf_.src_tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+    VDISPATCH_RESAMPLING(impl::is_dense_format_kind({src_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    conf_.alg = desc()->alg_kind;
+    conf_.c = C();
+    conf_.od = OD();
+    conf_.oh = OH();
+    conf_.ow = OW();
+    conf_.id = ID();
+    conf_.ih = IH();
+    conf_.iw = IW();
+    conf_.ndims = ndims();
+
+    if (conf_.alg == alg_kind::resampling_linear)
+        conf_.number_of_corners = 1u << (conf_.ndims - 2);
+
+    conf_.src_dt_size = types::data_type_size(conf_.src_data_type);
+    conf_.dst_dt_size = types::data_type_size(conf_.dst_data_type);
+
+    conf_.is_saturation_needed
+            = utils::one_of(conf_.dst_data_type, s32, s8, u8);
+
+    conf_.inner_stride = src_d.blocking_desc().strides[ndims() - 1];
+    conf_.stride_d = IH() * IW() * conf_.inner_stride * conf_.src_dt_size;
+    conf_.stride_h = IW() * conf_.inner_stride * conf_.src_dt_size;
+    conf_.stride_w = conf_.inner_stride * conf_.src_dt_size;
+
+    const std::vector<injector::post_op_type> accepted_post_ops
+            = {injector::sum, injector::eltwise, injector::binary};
+    static constexpr bool sum_at_0_pos_only = false;
+    static constexpr bool sum_requires_scale_one = false;
+    static constexpr bool sum_requires_zp_zero = true;
+    static constexpr bool sum_requires_same_params = false;
+    const bcast_set_t accepted_broadcasts
+            = {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
+                    broadcasting_strategy_t::per_oc_spatial};
+    injector::post_ops_ok_args_t post_ops_args(conf_.isa, accepted_post_ops,
+            attr()->post_ops_, &dst_d, sum_at_0_pos_only,
+            sum_requires_scale_one, sum_requires_zp_zero,
+            sum_requires_same_params, accepted_broadcasts);
+    VDISPATCH_RESAMPLING(
+            post_ops_ok(post_ops_args), VERBOSE_UNSUPPORTED_POSTOP);
+
+    conf_.post_ops = attr()->post_ops_;
+
+    static constexpr bool require_scale_one = false;
+    conf_.with_eltwise = conf_.with_binary = conf_.with_sum = false;
+    for (const auto &entry : conf_.post_ops.entry_) {
+        if (entry.is_eltwise()) {
+            conf_.with_eltwise = true;
+        } else if (entry.is_binary()) {
+            conf_.with_binary = true;
+        } else if (entry.is_sum(require_scale_one) && entry.sum.scale != 0.f) {
+            conf_.with_sum = true;
+            conf_.sum_scales.push(entry.sum.scale);
+        }
+    }
+    conf_.with_postops
+            = conf_.with_eltwise || conf_.with_binary || conf_.with_sum;
+
+    return status::success;
+}
+
+// Only channel-innermost layouts are handled: plain ncsp tensors are left to
+// simple_resampling_fwd_t.
+void jit_uni_resampling_fwd_t::pd_t::fill_format_tag_info() {
+    using namespace format_tag;
+
+    const format_tag_t blocked_format = memory_desc_matches_one_of_tag(
+            *src_md(), nCw16c, nChw16c, nCdhw16c, nCw8c, nChw8c, nCdhw8c);
+    const format_tag_t nspc_format
+            = memory_desc_matches_one_of_tag(*src_md(), nwc, nhwc, ndhwc);
+
+    if (blocked_format != undef) {
+        conf_.tag_kind = jit_memory_tag_kind_t::blocked;
+        conf_.src_tag = blocked_format;
+    } else if (nspc_format != undef) {
+        conf_.tag_kind = jit_memory_tag_kind_t::nspc;
+        conf_.src_tag = nspc_format;
+    } else {
+        conf_.tag_kind = jit_memory_tag_kind_t::undef;
+        conf_.src_tag = undef;
+    }
+}
+
+status_t jit_uni_resampling_fwd_t::get_proper_kernel(
+        const memory_desc_t *dst_md, const jit_resampling_conf_t &conf) {
+    if (conf.isa == sve_512)
+        return safe_ptr_assign(kernel_,
+                new jit_uni_resampling_kernel_t<sve_512>(conf, dst_md));
+    else if (conf.isa == sve_256)
+        return safe_ptr_assign(kernel_,
+                new jit_uni_resampling_kernel_t<sve_256>(conf, dst_md));
+    else if (conf.isa == sve_128)
+        return safe_ptr_assign(kernel_,
+                new jit_uni_resampling_kernel_t<sve_128>(conf, dst_md));
+
+    assert(!"Unsupported isa.");
+    return status::runtime_error;
+}
+
+status_t jit_uni_resampling_fwd_t::init(engine_t *engine) {
+    CHECK(get_proper_kernel(pd()->dst_md(), pd()->get_conf()));
+    CHECK(kernel_->create_kernel());
+
+    return fill_data_for_interpolation();
+}
+
+status_t jit_uni_resampling_fwd_t::fill_data_for_interpolation() {
+    switch (pd()->desc()->alg_kind) {
+        case alg_kind::resampling_nearest: return fill_data_for_nearest();
+        case alg_kind::resampling_linear: return fill_data_for_linear();
+        default:
+            assert(!"Invalid resampling algorithm.");
+            return status::invalid_arguments;
+    }
+}
+
+status_t jit_uni_resampling_fwd_t::fill_data_for_nearest() {
+    const auto &conf = pd()->get_conf();
+    indices_.reserve(pd()->OD() + pd()->OH() + pd()->OW());
+
+    for (dim_t od = 0; od < pd()->OD(); od++) {
+        const int offset_id
+                = nearest_idx(od, pd()->OD(), pd()->ID()) * conf.stride_d;
+        indices_.emplace_back(offset_id);
+    }
+    for (dim_t oh = 0; oh < pd()->OH(); oh++) {
+        const int offset_ih
+                = nearest_idx(oh, pd()->OH(), pd()->IH()) * conf.stride_h;
+        indices_.emplace_back(offset_ih);
+    }
+    for (dim_t ow = 0; ow < pd()->OW(); ow++) {
+        const int offset_iw
+                = nearest_idx(ow, pd()->OW(), pd()->IW()) * conf.stride_w;
+        indices_.emplace_back(offset_iw);
+    }
+
+    return status::success;
+}
+
+status_t jit_uni_resampling_fwd_t::fill_data_for_linear() {
+    const auto &conf = pd()->get_conf();
+    const dim_t OD = pd()->OD();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+
+    const size_t num_of_elements = 2 * (OD + OH + OW);
+    indices_.resize(num_of_elements);
+    weights_.resize(num_of_elements);
+
+    unsigned *indices_w = &indices_[0];
+    unsigned *indices_h = &indices_[2 * OW];
+    unsigned *indices_d = &indices_[2 * (OW + OH)];
+    float *weights_w = &weights_[0];
+    float *weights_h = &weights_[2 * OW];
+    float *weights_d = &weights_[2 * (OW + OH)];
+
+    for (dim_t ow = 0; ow < OW; ow++) {
+        const linear_coeffs_t coeffs_iw(ow, OW, pd()->IW());
+
+        // The left and right corners are stored next to each other as the
+        // kernel reads them in pairs while walking along the row.
+        weights_w[2 * ow] = coeffs_iw.wei[0];
+        weights_w[2 * ow + 1] = coeffs_iw.wei[1];
+        indices_w[2 * ow] = coeffs_iw.idx[0] * conf.stride_w;
+        indices_w[2 * ow + 1] = coeffs_iw.idx[1] * conf.stride_w;
+    }
+
+    for (dim_t oh = 0; oh < OH; oh++) {
+        const linear_coeffs_t coeffs_ih(oh, OH, pd()->IH());
+
+        weights_h[oh] = coeffs_ih.wei[0];
+        weights_h[OH + oh] = coeffs_ih.wei[1];
+        indices_h[oh] = coeffs_ih.idx[0] * conf.stride_h;
+        indices_h[OH + oh] = coeffs_ih.idx[1] * conf.stride_h;
+    }
+
+    for (dim_t od = 0; od < OD; od++) {
+        const linear_coeffs_t coeffs_id(od, OD, pd()->ID());
+
+        weights_d[od] = coeffs_id.wei[0];
+        weights_d[OD + od] = coeffs_id.wei[1];
+        indices_d[od] = coeffs_id.idx[0] * conf.stride_d;
+        indices_d[OD + od] = coeffs_id.idx[1] * conf.stride_d;
+    }
+
+    return status::success;
+}
+
+status_t jit_uni_resampling_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
+
+    const std::vector<const void *> post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(
+                    pd()->get_conf().post_ops, ctx);
+
+    switch (pd()->desc()->alg_kind) {
+        case alg_kind::resampling_nearest:
+            return interpolate_nearest(src, dst, post_ops_binary_rhs_arg_vec);
+        case alg_kind::resampling_linear:
+            return interpolate_linear(src, dst, post_ops_binary_rhs_arg_vec);
+        default:
+            assert(!"Invalid resampling algorithm.");
+            return status::invalid_arguments;
+    }
+}
+
+status_t jit_uni_resampling_fwd_t::interpolate_nearest(const uint8_t *src,
+        uint8_t *dst, const std::vector<const void *> &post_ops_args) const {
+    const size_t src_dt_size = pd()->get_conf().src_dt_size;
+    const size_t dst_dt_size = pd()->get_conf().dst_dt_size;
+    const size_t inner_stride = pd()->get_conf().inner_stride;
+
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t CB = utils::div_up(C, inner_stride);
+    const dim_t nsp_outer = MB * CB;
+    const dim_t OD = pd()->OD();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t ID = pd()->ID();
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+
+    const unsigned *indices_d = &indices_[0];
+    const unsigned *indices_h = &indices_[OD];
+    const unsigned *indices_w = &indices_[OD + OH];
+
+    parallel_nd(nsp_outer, OD, OH, [&](dim_t nsp, dim_t od, dim_t oh) {
+        const dim_t src_off = nsp * ID * IH * IW * inner_stride * src_dt_size
+                + indices_d[od] + indices_h[oh];
+        const dim_t dst_off
+                = ((nsp * OD + od) * OH + oh) * OW * inner_stride * dst_dt_size;
+
+        jit_uni_resampling_args_t args;
+        args.batch_of_sp_points_to_process = OW;
+        args.src = src + src_off;
+        args.dst = dst + dst_off;
+        args.dst_orig = dst;
+        args.indices = &indices_w[0];
+        args.post_ops_binary_rhs_arg_vec = post_ops_args.data();
+
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
+status_t jit_uni_resampling_fwd_t::interpolate_linear(const uint8_t *src,
+        uint8_t *dst, const std::vector<const void *> &post_ops_args) const {
+    const size_t src_dt_size = pd()->get_conf().src_dt_size;
+    const size_t dst_dt_size = pd()->get_conf().dst_dt_size;
+    const size_t inner_stride = pd()->get_conf().inner_stride;
+
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t CB = utils::div_up(C, inner_stride);
+    const dim_t nsp_outer = MB * CB;
+    const dim_t OD = pd()->OD();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t ID = pd()->ID();
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+
+    const unsigned *indices_top = &indices_[2 * OW];
+    const unsigned *indices_bottom = &indices_[2 * OW + OH];
+    const unsigned *indices_front = &indices_[2 * (OW + OH)];
+    const unsigned *indices_back = &indices_[2 * (OW + OH) + OD];
+    const float *weights_top = &weights_[2 * OW];
+    const float *weights_bottom = &weights_[2 * OW + OH];
+    const float *weights_front = &weights_[2 * (OW + OH)];
+    const float *weights_back = &weights_[2 * (OW + OH) + OD];
+
+    parallel_nd(nsp_outer, OD, OH, [&](dim_t nsp, dim_t od, dim_t oh) {
+        const dim_t src_off = nsp * ID * IH * IW * inner_stride * src_dt_size;
+        const dim_t dst_off
+                = ((nsp * OD + od) * OH + oh) * OW * inner_stride * dst_dt_size;
+
+        jit_uni_resampling_args_t args;
+        args.batch_of_sp_points_to_process = OW;
+        args.src = src + src_off;
+        args.dst = dst + dst_off;
+        args.dst_orig = dst;
+        args.indices = &indices_[0];
+        args.weights = &weights_[0];
+        args.post_ops_binary_rhs_arg_vec = post_ops_args.data();
+
+        args.src_offset_front = indices_front[od];
+        args.src_offset_back = indices_back[od];
+        args.src_offset_top = indices_top[oh];
+        args.src_offset_bottom = indices_bottom[oh];
+        args.weight_front = weights_front[od];
+        args.weight_back = weights_back[od];
+        args.weight_top = weights_top[oh];
+        args.weight_bottom = weights_bottom[oh];
+
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
+status_t jit_uni_resampling_bwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    // The kernel reads diff_dst through the src fields of the configuration
+    // and writes diff_src through the dst ones.
+    conf_.src_data_type = diff_dst_md()->data_type;
+    conf_.dst_data_type = diff_src_md()->data_type;
+
+    conf_.isa = get_supported_isa();
+
+    VDISPATCH_RESAMPLING(!is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_RESAMPLING(conf_.isa != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_RESAMPLING(
+            !has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "diff_src");
+    VDISPATCH_RESAMPLING(
+            utils::one_of(conf_.src_data_type, f32, bf16, f16)
+                    && utils::one_of(conf_.dst_data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_RESAMPLING(impl_supports_datatype(conf_.dst_data_type, true),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_RESAMPLING(
+            attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_RESAMPLING(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+
+    fill_format_tag_info();
+    VDISPATCH_RESAMPLING(
+            conf_.src_tag != format_tag::undef, VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_RESAMPLING(
+            memory_desc_matches_tag(*diff_dst_md(), conf_.src_tag),
+            VERBOSE_UNSUPPORTED_TAG_S, "diff_dst");
+    VDISPATCH_RESAMPLING(
+            impl::is_dense_format_kind({diff_src_md(), diff_dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    conf_.alg = desc()->alg_kind;
+    conf_.c = C();
+    conf_.od = OD();
+    conf_.oh = OH();
+    conf_.ow = OW();
+    conf_.id = ID();
+    conf_.ih = IH();
+    conf_.iw = IW();
+    conf_.ndims = ndims();
+
+    conf_.src_dt_size = types::data_type_size(conf_.src_data_type);
+    conf_.dst_dt_size = types::data_type_size(conf_.dst_data_type);
+
+    const memory_desc_wrapper diff_src_d(diff_src_md());
+    conf_.inner_stride = diff_src_d.blocking_desc().strides[ndims() - 1];
+    conf_.stride_d = OH() * OW() * conf_.inner_stride * conf_.src_dt_size;
+    conf_.stride_h = OW() * conf_.inner_stride * conf_.src_dt_size;
+    conf_.stride_w = conf_.inner_stride * conf_.src_dt_size;
+
+    return status::success;
+}
+
+void jit_uni_resampling_bwd_t::pd_t::fill_format_tag_info() {
+    using namespace format_tag;
+
+    const format_tag_t blocked_format = memory_desc_matches_one_of_tag(
+            *diff_src_md(), nCw16c, nChw16c, nCdhw16c, nCw8c, nChw8c, nCdhw8c);
+    const format_tag_t nspc_format
+            = memory_desc_matches_one_of_tag(*diff_src_md(), nwc, nhwc, ndhwc);
+
+    if (blocked_format != undef) {
+        conf_.tag_kind = jit_memory_tag_kind_t::blocked;
+        conf_.src_tag = blocked_format;
+    } else if (nspc_format != undef) {
+        conf_.tag_kind = jit_memory_tag_kind_t::nspc;
+        conf_.src_tag = nspc_format;
+    } else {
+        conf_.tag_kind = jit_memory_tag_kind_t::undef;
+        conf_.src_tag = undef;
+    }
+}
+
+status_t jit_uni_resampling_bwd_t::get_proper_kernel(
+        const jit_resampling_conf_t &conf) {
+    if (conf.isa == sve_512)
+        return safe_ptr_assign(
+                kernel_, new jit_uni_resampling_bwd_kernel_t<sve_512>(conf));
+    else if (conf.isa == sve_256)
+        return safe_ptr_assign(
+                kernel_, new jit_uni_resampling_bwd_kernel_t<sve_256>(conf));
+    else if (conf.isa == sve_128)
+        return safe_ptr_assign(
+                kernel_, new jit_uni_resampling_bwd_kernel_t<sve_128>(conf));
+
+    assert(!"Unsupported isa.");
+    return status::runtime_error;
+}
+
+void jit_uni_resampling_bwd_t::fill_table(
+        dim_t O, dim_t I, unsigned stride, std::vector<unsigned> &starts) {
+    std::vector<std::vector<jit_resampling_bwd_entry_t>> lists(I);
+
+    for (dim_t o = 0; o < O; o++) {
+        jit_resampling_bwd_entry_t entry;
+        entry.offset = static_cast<unsigned>(o * stride);
+        if (pd()->desc()->alg_kind == alg_kind::resampling_nearest) {
+            entry.weight = 1.f;
+            lists[nearest_idx(o, O, I)].push_back(entry);
+            continue;
+        }
+
+        const linear_coeffs_t coeffs(o, O, I);
+        entry.weight = coeffs.wei[0];
+        lists[coeffs.idx[0]].push_back(entry);
+        // Both corners are the same point at the borders, its contributions
+        // are merged to keep a single entry per diff_dst point.
+        if (coeffs.idx[1] == coeffs.idx[0]) {
+            lists[coeffs.idx[0]].back().weight += coeffs.wei[1];
+        } else {
+            entry.weight = coeffs.wei[1];
+            lists[coeffs.idx[1]].push_back(entry);
+        }
+    }
+
+    starts.resize(I + 1);
+    for (dim_t i = 0; i < I; i++) {
+        starts[i] = static_cast<unsigned>(entries_.size());
+        entries_.insert(entries_.end(), lists[i].begin(), lists[i].end());
+    }
+    starts[I] = static_cast<unsigned>(entries_.size());
+}
+
+status_t jit_uni_resampling_bwd_t::init(engine_t *engine) {
+    const auto &conf = pd()->get_conf();
+    CHECK(get_proper_kernel(conf));
+    CHECK(kernel_->create_kernel());
+
+    fill_table(pd()->OD(), pd()->ID(), conf.stride_d, starts_d_);
+    fill_table(pd()->OH(), pd()->IH(), conf.stride_h, starts_h_);
+    fill_table(pd()->OW(), pd()->IW(), conf.stride_w, starts_w_);
+
+    return status::success;
+}
+
+status_t jit_uni_resampling_bwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto diff_dst = CTX_IN_MEM(const uint8_t *, DNNL_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DIFF_SRC);
+
+    const size_t diff_dst_dt_size = pd()->get_conf().src_dt_size;
+    const size_t diff_src_dt_size = pd()->get_conf().dst_dt_size;
+    const size_t inner_stride = pd()->get_conf().inner_stride;
+
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t CB = utils::div_up(C, inner_stride);
+    const dim_t nsp_outer = MB * CB;
+    const dim_t OD = pd()->OD();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t ID = pd()->ID();
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+
+    const jit_resampling_bwd_entry_t *entries = entries_.data();
+
+    parallel_nd(nsp_outer, ID, IH, IW,
+            [&](dim_t nsp, dim_t id, dim_t ih, dim_t iw) {
+                const dim_t diff_dst_off
+                        = nsp * OD * OH * OW * inner_stride * diff_dst_dt_size;
+                const dim_t diff_src_off
+                        = (((nsp * ID + id) * IH + ih) * IW + iw)
+                        * inner_stride * diff_src_dt_size;
+
+                jit_uni_resampling_bwd_args_t args;
+                args.diff_dst = diff_dst + diff_dst_off;
+                args.diff_src = diff_src + diff_src_off;
+                args.entries_d = entries + starts_d_[id];
+                args.entries_h = entries + starts_h_[ih];
+                args.entries_w = entries + starts_w_[iw];
+                args.n_entries_d = starts_d_[id + 1] - starts_d_[id];
+                args.n_entries_h = starts_h_[ih + 1] - starts_h_[ih];
+                args.n_entries_w = starts_w_[iw + 1] - starts_w_[iw];
+
+                (*kernel_)(&args);
+            });
+
+    return status::success;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
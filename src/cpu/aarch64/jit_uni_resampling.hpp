@@ -0,0 +1,171 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_RESAMPLING_HPP
+#define CPU_AARCH64_JIT_UNI_RESAMPLING_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_resampling_pd.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_primitive_conf.hpp"
+#include "cpu/aarch64/jit_uni_resampling_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct jit_uni_resampling_fwd_t : public primitive_t {
+    struct pd_t : public cpu_resampling_fwd_pd_t {
+        using cpu_resampling_fwd_pd_t::cpu_resampling_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", conf_.isa, ""),
+                jit_uni_resampling_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        const jit_resampling_conf_t &get_conf() const { return conf_; }
+
+    private:
+        void fill_format_tag_info();
+
+        jit_resampling_conf_t conf_;
+    };
+
+    jit_uni_resampling_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    ~jit_uni_resampling_fwd_t() override = default;
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    status_t fill_data_for_interpolation();
+    /*
+     * Fills indices_ with the byte offset of the input point that
+     * corresponds to each output point.
+     * The data is arranged as follows:
+     * od_0 = id_0 * stride_d
+     * od_1 = id_1 * stride_d
+     * ...
+     * oh_0 = ih_0 * stride_h
+     * ...
+     * ow_0 = iw_0 * stride_w
+     * ...
+     */
+    status_t fill_data_for_nearest();
+    /*
+     * Fills indices_ with the byte offsets of the corners from the input
+     * tensor for each output point and weights_ with the weights of those
+     * corners.
+     * The data is arranged as follows:
+     *
+     * indices_:
+     * ow_0 = iw_0_left
+     * ow_0 = iw_0_right
+     * ow_1 = iw_1_left
+     * ...
+     * oh_0 = ih_0_top
+     * oh_1 = ih_1_top
+     * ...
+     * oh_0 = ih_0_bottom
+     * ...
+     * od_0 = id_0_front
+     * ...
+     * od_0 = id_0_back
+     * ...
+     *
+     * weights_ follow the same layout.
+     */
+    status_t fill_data_for_linear();
+
+    status_t interpolate_nearest(const uint8_t *src, uint8_t *dst,
+            const std::vector<const void *> &post_ops_args) const;
+    status_t interpolate_linear(const uint8_t *src, uint8_t *dst,
+            const std::vector<const void *> &post_ops_args) const;
+
+    status_t get_proper_kernel(
+            const memory_desc_t *dst_md, const jit_resampling_conf_t &conf);
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_resampling_kernel_base_t> kernel_;
+
+    std::vector<unsigned> indices_;
+    std::vector<float> weights_;
+};
+
+// Backward resampling computed as a gather: for every diff_src point the
+// kernel sums the diff_dst points that the forward pass computed from it,
+// found in per-dimension inverse index tables built at primitive creation.
+struct jit_uni_resampling_bwd_t : public primitive_t {
+    struct pd_t : public cpu_resampling_bwd_pd_t {
+        using cpu_resampling_bwd_pd_t::cpu_resampling_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", conf_.isa, ""),
+                jit_uni_resampling_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        const jit_resampling_conf_t &get_conf() const { return conf_; }
+
+    private:
+        void fill_format_tag_info();
+
+        jit_resampling_conf_t conf_;
+    };
+
+    jit_uni_resampling_bwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    ~jit_uni_resampling_bwd_t() override = default;
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    /*
+     * Fills the inverse index table of one spatial dimension of `I` diff_src
+     * and `O` diff_dst points: the entries of diff_src point i are
+     * entries_[starts[i]] to entries_[starts[i + 1] - 1] and hold the byte
+     * offsets, `stride` apart, of the diff_dst points computed from i along
+     * with their interpolation weights.
+     */
+    void fill_table(dim_t O, dim_t I, unsigned stride,
+            std::vector<unsigned> &starts);
+
+    status_t get_proper_kernel(const jit_resampling_conf_t &conf);
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_resampling_kernel_base_t> kernel_;
+
+    std::vector<jit_resampling_bwd_entry_t> entries_;
+    std::vector<unsigned> starts_d_, starts_h_, starts_w_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
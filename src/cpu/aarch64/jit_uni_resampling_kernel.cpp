@@ -0,0 +1,528 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cassert>
+
+#include "cpu/aarch64/jit_uni_resampling_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+#define GET_OFF(field) (uint32_t) offsetof(jit_uni_resampling_args_t, field)
+
+static const bcast_set_t &get_supported_postops_bcast_strategies() {
+    static const bcast_set_t supported_strategies
+            = {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
+                    broadcasting_strategy_t::per_oc_spatial};
+    return supported_strategies;
+}
+
+template <cpu_isa_t isa>
+jit_uni_resampling_kernel_t<isa>::jit_uni_resampling_kernel_t(
+        const jit_resampling_conf_t &conf, const memory_desc_t *dst_md)
+    : jit_uni_resampling_kernel_base_t(conf)
+    , tail_size_(conf.inner_stride % simd_w_) {
+    if (conf_.with_postops) init_post_ops_injector(dst_md);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel_t<isa>::init_post_ops_injector(
+        const memory_desc_t *dst_md) {
+    const memory_desc_wrapper dst_d(*dst_md);
+
+    static constexpr bool preserve_gpr = true;
+    static constexpr bool preserve_vmm = true;
+    static constexpr bool use_exact_tail_scalar_bcast = false;
+
+    const binary_injector::rhs_arg_static_params_t rhs_arg_bsp {
+            static_cast<size_t>(rhs_dt_helper_vmm_.getIdx()),
+            reg_po_injector_helper_1_, reg_po_injector_helper_2_,
+            reg_po_injector_helper_3_, preserve_gpr, preserve_vmm,
+            GET_OFF(post_ops_binary_rhs_arg_vec), GET_OFF(dst_orig), dst_d,
+            tail_size_, p_tail_, use_exact_tail_scalar_bcast};
+    const binary_injector::static_params_t bsp(
+            reg_param_, get_supported_postops_bcast_strategies(), rhs_arg_bsp);
+
+    postops_injector_ = utils::make_unique<
+            injector::jit_uni_postops_injector_t<to_vla_sve(isa)>>(
+            this, conf_.post_ops, bsp);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel_t<isa>::load(
+        const ZReg &vmm, const XReg &addr, const PReg &p, data_type_t dt) {
+    switch (dt) {
+        case data_type::f32: ld1w(vmm.s, p / T_z, ptr(addr)); break;
+        case data_type::s32:
+            ld1w(vmm.s, p / T_z, ptr(addr));
+            scvtf(vmm.s, p_full_ / T_m, vmm.s);
+            break;
+        case data_type::bf16:
+            ld1h(vmm.s, p / T_z, ptr(addr));
+            lsl(vmm.s, vmm.s, 16);
+            break;
+        case data_type::f16:
+            ld1h(vmm.s, p / T_z, ptr(addr));
+            fcvt(vmm.s, p_full_ / T_m, vmm.h);
+            break;
+        case data_type::s8:
+            ld1sb(vmm.s, p / T_z, ptr(addr));
+            scvtf(vmm.s, p_full_ / T_m, vmm.s);
+            break;
+        case data_type::u8:
+            ld1b(vmm.s, p / T_z, ptr(addr));
+            scvtf(vmm.s, p_full_ / T_m, vmm.s);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel_t<isa>::store(
+        const ZReg &vmm, const XReg &addr, const PReg &p) {
+    if (conf_.is_saturation_needed) {
+        saturate_f32(vmm, vmm_zero_saturation_, vmm_saturation_ubound_,
+                conf_.dst_data_type, p_full_, true);
+        frintn(vmm.s, p_full_ / T_m, vmm.s);
+        fcvtzs(vmm.s, p_full_ / T_m, vmm.s);
+    }
+
+    switch (conf_.dst_data_type) {
+        case data_type::f32:
+        case data_type::s32: st1w(vmm.s, p, ptr(addr)); break;
+        case data_type::bf16:
+            bfcvt(vmm.h, p_full_ / T_m, vmm.s);
+            st1h(vmm.s, p, ptr(addr));
+            break;
+        case data_type::f16:
+            fcvt(vmm.h, p_full_ / T_m, vmm.s);
+            st1h(vmm.s, p, ptr(addr));
+            break;
+        case data_type::s8:
+        case data_type::u8: st1b(vmm.s, p, ptr(addr)); break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel_t<isa>::apply_sum(
+        const int data_idx, const PReg &p) {
+    if (conf_.with_sum) {
+        assert(!conf_.sum_scales.empty()
+                && "No scales for sum post operation.");
+        const auto sum_injector = [this, data_idx, p]() {
+            const ZReg vmm_dst(data_idx);
+            load(vmm_prev_dst_, reg_dst_, p, conf_.dst_data_type);
+            const float sum_scale = sum_scales_.front();
+            if (sum_scale == 1.f)
+                fadd(vmm_dst.s, vmm_dst.s, vmm_prev_dst_.s);
+            else {
+                init_vmm(vmm_sum_scale_, X_TMP_0, sum_scale);
+                fmla(vmm_dst.s, p_full_ / T_m, vmm_prev_dst_.s,
+                        vmm_sum_scale_.s);
+            }
+            sum_scales_.push(sum_scale);
+            sum_scales_.pop();
+        };
+        postops_injector_->set_lambda_injector(
+                primitive_kind::sum, sum_injector);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel_t<isa>::apply_postops(
+        const int data_idx, const PReg &p, bool is_tail) {
+    binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+
+    if (conf_.with_sum) apply_sum(data_idx, p);
+
+    if (conf_.with_binary) {
+        rhs_arg_params.vmm_idx_to_out_reg.emplace(data_idx, reg_dst_);
+        rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(data_idx, 0);
+        if (is_tail) rhs_arg_params.vmm_tail_idx_.emplace(data_idx);
+    }
+
+    postops_injector_->compute_vector(data_idx, rhs_arg_params);
+}
+
+// Runs `body` over the inner_stride channels of one output point. The first
+// `n_src_ptrs` corner pointers and the dst pointer are advanced as it goes.
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel_t<isa>::channel_loop(
+        const body_fn_t &body, unsigned n_src_ptrs) {
+    const auto advance = [&](std::size_t nelems) {
+        for (unsigned i = 0; i < n_src_ptrs; i++)
+            add_imm(reg_src_corner(i), reg_src_corner(i),
+                    nelems * conf_.src_dt_size, X_TMP_0);
+        add_imm(reg_dst_, reg_dst_, nelems * conf_.dst_dt_size, X_TMP_0);
+    };
+
+    const std::size_t n_full = conf_.inner_stride / simd_w_;
+    if (n_full > 1) {
+        Label l_loop;
+        mov_imm(reg_c_work_, n_full);
+        L(l_loop);
+        body(p_full_, false);
+        advance(simd_w_);
+        subs(reg_c_work_, reg_c_work_, 1);
+        b(NE, l_loop);
+    } else if (n_full == 1) {
+        body(p_full_, false);
+        advance(simd_w_);
+    }
+
+    if (tail_size_ > 0) {
+        body(p_tail_, true);
+        advance(tail_size_);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel_t<isa>::nearest_alg() {
+    const XReg reg_src = reg_src_corner(0);
+    const auto body = [&](const PReg &p, bool is_tail) {
+        load(vmm_dst_, reg_src, p, conf_.src_data_type);
+        if (conf_.with_postops)
+            apply_postops(vmm_dst_.getIdx(), p, is_tail);
+        store(vmm_dst_, reg_dst_, p);
+    };
+
+    Label l_sp_loop;
+    L(l_sp_loop);
+    {
+        ldr(WReg(X_TMP_0.getIdx()), ptr(reg_indices_));
+        add(reg_src, reg_src_, X_TMP_0);
+
+        channel_loop(body, 1);
+
+        add_imm(reg_indices_, reg_indices_, sizeof(unsigned), X_TMP_0);
+        subs(reg_work_, reg_work_, 1);
+        b(NE, l_sp_loop);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel_t<isa>::linear_alg() {
+    const unsigned n_corners = conf_.number_of_corners;
+    const unsigned n_dh = n_corners / 2;
+    const bool has_h = conf_.ndims >= 4;
+    const bool has_d = conf_.ndims == 5;
+
+    // The d and h parts of the offsets and the weights do not change along
+    // the row, so they are combined once per call.
+    for (unsigned k = 0; k < n_dh; k++) {
+        const XReg reg_dh = reg_src_dh(k);
+        mov(reg_dh, reg_src_);
+        if (has_h) {
+            ldr(X_TMP_0,
+                    ptr(reg_param_,
+                            (k & 1) ? GET_OFF(src_offset_bottom)
+                                    : GET_OFF(src_offset_top)));
+            add(reg_dh, reg_dh, X_TMP_0);
+            uni_ld1rw(vmm_weight_dh(k).s, reg_param_,
+                    (k & 1) ? GET_OFF(weight_bottom) : GET_OFF(weight_top));
+        }
+        if (has_d) {
+            ldr(X_TMP_0,
+                    ptr(reg_param_,
+                            (k & 2) ? GET_OFF(src_offset_back)
+                                    : GET_OFF(src_offset_front)));
+            add(reg_dh, reg_dh, X_TMP_0);
+            uni_ld1rw(vmm_src_.s, reg_param_,
+                    (k & 2) ? GET_OFF(weight_back) : GET_OFF(weight_front));
+            fmul(vmm_weight_dh(k).s, vmm_weight_dh(k).s, vmm_src_.s);
+        }
+    }
+
+    const auto corner_weight = [&](unsigned i) {
+        return has_h ? vmm_weight(i) : vmm_weight_w(i);
+    };
+
+    const auto body = [&](const PReg &p, bool is_tail) {
+        load(vmm_dst_, reg_src_corner(0), p, conf_.src_data_type);
+        fmul(vmm_dst_.s, vmm_dst_.s, corner_weight(0).s);
+        for (unsigned i = 1; i < n_corners; i++) {
+            load(vmm_src_, reg_src_corner(i), p, conf_.src_data_type);
+            fmla(vmm_dst_.s, p_full_ / T_m, vmm_src_.s, corner_weight(i).s);
+        }
+        if (conf_.with_postops)
+            apply_postops(vmm_dst_.getIdx(), p, is_tail);
+        store(vmm_dst_, reg_dst_, p);
+    };
+
+    const XReg reg_idx_left = X_TMP_0;
+    const XReg reg_idx_right = X_TMP_1;
+
+    Label l_sp_loop;
+    L(l_sp_loop);
+    {
+        // The left and right indices and weights are stored one after the
+        // other for each output point.
+        ldr(WReg(reg_idx_left.getIdx()), ptr(reg_indices_));
+        ldr(WReg(reg_idx_right.getIdx()),
+                ptr(reg_indices_, static_cast<uint32_t>(sizeof(unsigned))));
+        for (unsigned k = 0; k < n_dh; k++) {
+            add(reg_src_corner(2 * k), reg_src_dh(k), reg_idx_left);
+            add(reg_src_corner(2 * k + 1), reg_src_dh(k), reg_idx_right);
+        }
+
+        uni_ld1rw(vmm_weight_w(0).s, reg_weights_, 0);
+        uni_ld1rw(vmm_weight_w(1).s, reg_weights_, sizeof(float));
+        if (has_h) {
+            for (unsigned i = 0; i < n_corners; i++)
+                fmul(vmm_weight(i).s, vmm_weight_w(i & 1).s,
+                        vmm_weight_dh(i >> 1).s);
+        }
+
+        channel_loop(body, n_corners);
+
+        add_imm(reg_indices_, reg_indices_, 2 * sizeof(unsigned), X_TMP_0);
+        add_imm(reg_weights_, reg_weights_, 2 * sizeof(float), X_TMP_0);
+        subs(reg_work_, reg_work_, 1);
+        b(NE, l_sp_loop);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel_t<isa>::generate() {
+    preamble();
+
+    switch (simd_w_) {
+        case 16: ptrue(p_full_.s, VL16); break;
+        case 8: ptrue(p_full_.s, VL8); break;
+        case 4: ptrue(p_full_.s, VL4); break;
+        default: assert(!"unreachable");
+    }
+    if (tail_size_ > 0) set_preg(p_tail_.s, tail_size_, X_TMP_0, X_TMP_1);
+
+    if (conf_.is_saturation_needed)
+        init_saturate_f32(vmm_zero_saturation_, vmm_saturation_ubound_,
+                X_TMP_0, data_type::f32, conf_.dst_data_type, true);
+
+    ldr(reg_src_, ptr(reg_param_, GET_OFF(src)));
+    ldr(reg_dst_, ptr(reg_param_, GET_OFF(dst)));
+    ldr(reg_indices_, ptr(reg_param_, GET_OFF(indices)));
+    ldr(reg_work_, ptr(reg_param_, GET_OFF(batch_of_sp_points_to_process)));
+
+    if (conf_.alg == alg_kind::resampling_nearest) {
+        nearest_alg();
+    } else {
+        ldr(reg_weights_, ptr(reg_param_, GET_OFF(weights)));
+        linear_alg();
+    }
+
+    postamble();
+
+    if (conf_.with_eltwise && postops_injector_)
+        postops_injector_->prepare_table();
+}
+
+template struct jit_uni_resampling_kernel_t<sve_512>;
+template struct jit_uni_resampling_kernel_t<sve_256>;
+template struct jit_uni_resampling_kernel_t<sve_128>;
+
+#undef GET_OFF
+#define GET_OFF(field) (uint32_t) offsetof(jit_uni_resampling_bwd_args_t, field)
+
+template <cpu_isa_t isa>
+jit_uni_resampling_bwd_kernel_t<isa>::jit_uni_resampling_bwd_kernel_t(
+        const jit_resampling_conf_t &conf)
+    : jit_uni_resampling_kernel_base_t(conf)
+    , tail_size_(conf.inner_stride % simd_w_) {}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_bwd_kernel_t<isa>::load(
+        const ZReg &vmm, const XReg &addr, const PReg &p) {
+    switch (conf_.src_data_type) {
+        case data_type::f32: ld1w(vmm.s, p / T_z, ptr(addr)); break;
+        case data_type::bf16:
+            ld1h(vmm.s, p / T_z, ptr(addr));
+            lsl(vmm.s, vmm.s, 16);
+            break;
+        case data_type::f16:
+            ld1h(vmm.s, p / T_z, ptr(addr));
+            fcvt(vmm.s, p_full_ / T_m, vmm.h);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_bwd_kernel_t<isa>::store(
+        const ZReg &vmm, const XReg &addr, const PReg &p) {
+    switch (conf_.dst_data_type) {
+        case data_type::f32: st1w(vmm.s, p, ptr(addr)); break;
+        case data_type::bf16:
+            bfcvt(vmm.h, p_full_ / T_m, vmm.s);
+            st1h(vmm.s, p, ptr(addr));
+            break;
+        case data_type::f16:
+            fcvt(vmm.h, p_full_ / T_m, vmm.s);
+            st1h(vmm.s, p, ptr(addr));
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_bwd_kernel_t<isa>::accumulate(
+        unsigned ur, bool with_tail) {
+    // Here src and dst stand for diff_dst and diff_src.
+    const bool is_linear = conf_.alg == alg_kind::resampling_linear;
+    const auto pred = [&](unsigned i) {
+        return with_tail && i == ur - 1 ? p_tail_ : p_full_;
+    };
+    const XReg reg_tmp_addr = X_TMP_1;
+    const XReg reg_off = X_TMP_2;
+
+    for (unsigned i = 0; i < ur; i++)
+        eor(vmm_acc(i).d, vmm_acc(i).d, vmm_acc(i).d);
+
+    // Walks the `n` entries from `entries`, setting `addr` to `base` plus the
+    // offset of the current entry before running `body`. Nothing is done for
+    // an empty list.
+    const auto entry_loop = [&](const XReg &cur, const XReg &cnt,
+                                    const XReg &entries, const XReg &n,
+                                    const XReg &addr, const XReg &base,
+                                    const std::function<void()> &body) {
+        Label l_loop, l_end;
+        mov(cur, entries);
+        mov(cnt, n);
+        cbz(cnt, l_end);
+        L(l_loop);
+        {
+            ldr(WReg(reg_off.getIdx()), ptr(cur));
+            add(addr, base, reg_off);
+            body();
+            add_imm(cur, cur, sizeof(jit_resampling_bwd_entry_t), X_TMP_0);
+            subs(cnt, cnt, 1);
+            b(NE, l_loop);
+        }
+        L(l_end);
+    };
+
+    const auto w_body = [&]() {
+        if (is_linear) {
+            uni_ld1rw(vmm_weight_.s, reg_cur_w_, sizeof(unsigned));
+            fmul(vmm_weight_.s, vmm_weight_.s, vmm_weight_dh_.s);
+        }
+        for (unsigned i = 0; i < ur; i++) {
+            XReg addr = reg_addr_;
+            if (i > 0) {
+                add_imm(reg_tmp_addr, reg_addr_,
+                        i * simd_w_ * conf_.src_dt_size, X_TMP_0);
+                addr = reg_tmp_addr;
+            }
+            load(vmm_data_, addr, pred(i));
+            if (is_linear)
+                fmla(vmm_acc(i).s, p_full_ / T_m, vmm_data_.s,
+                        vmm_weight_.s);
+            else
+                fadd(vmm_acc(i).s, vmm_acc(i).s, vmm_data_.s);
+        }
+    };
+    const auto h_body = [&]() {
+        if (is_linear) {
+            uni_ld1rw(vmm_weight_dh_.s, reg_cur_h_, sizeof(unsigned));
+            fmul(vmm_weight_dh_.s, vmm_weight_dh_.s, vmm_weight_d_.s);
+        }
+        entry_loop(reg_cur_w_, reg_cnt_w_, reg_entries_w_, reg_n_w_,
+                reg_addr_, reg_addr_dh_, w_body);
+    };
+    const auto d_body = [&]() {
+        if (is_linear)
+            uni_ld1rw(vmm_weight_d_.s, reg_cur_d_, sizeof(unsigned));
+        entry_loop(reg_cur_h_, reg_cnt_h_, reg_entries_h_, reg_n_h_,
+                reg_addr_dh_, reg_addr_d_, h_body);
+    };
+    entry_loop(reg_cur_d_, reg_cnt_d_, reg_entries_d_, reg_n_d_, reg_addr_d_,
+            reg_diff_dst_, d_body);
+
+    for (unsigned i = 0; i < ur; i++) {
+        XReg addr = reg_diff_src_;
+        if (i > 0) {
+            add_imm(reg_tmp_addr, reg_diff_src_,
+                    i * simd_w_ * conf_.dst_dt_size, X_TMP_0);
+            addr = reg_tmp_addr;
+        }
+        store(vmm_acc(i), addr, pred(i));
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_bwd_kernel_t<isa>::generate() {
+    preamble();
+
+    switch (simd_w_) {
+        case 16: ptrue(p_full_.s, VL16); break;
+        case 8: ptrue(p_full_.s, VL8); break;
+        case 4: ptrue(p_full_.s, VL4); break;
+        default: assert(!"unreachable");
+    }
+    if (tail_size_ > 0) set_preg(p_tail_.s, tail_size_, X_TMP_0, X_TMP_1);
+
+    ldr(reg_diff_dst_, ptr(reg_param_, GET_OFF(diff_dst)));
+    ldr(reg_diff_src_, ptr(reg_param_, GET_OFF(diff_src)));
+    ldr(reg_entries_d_, ptr(reg_param_, GET_OFF(entries_d)));
+    ldr(reg_entries_h_, ptr(reg_param_, GET_OFF(entries_h)));
+    ldr(reg_entries_w_, ptr(reg_param_, GET_OFF(entries_w)));
+    ldr(reg_n_d_, ptr(reg_param_, GET_OFF(n_entries_d)));
+    ldr(reg_n_h_, ptr(reg_param_, GET_OFF(n_entries_h)));
+    ldr(reg_n_w_, ptr(reg_param_, GET_OFF(n_entries_w)));
+
+    // The channels are processed in blocks of max_ur_ vectors so that the
+    // entries are walked once per block rather than once per vector.
+    const auto advance = [&](std::size_t nelems) {
+        add_imm(reg_diff_dst_, reg_diff_dst_, nelems * conf_.src_dt_size,
+                X_TMP_0);
+        add_imm(reg_diff_src_, reg_diff_src_, nelems * conf_.dst_dt_size,
+                X_TMP_0);
+    };
+
+    const std::size_t n_full = conf_.inner_stride / simd_w_;
+    const std::size_t n_blocks = n_full / max_ur_;
+    const unsigned n_rem = n_full % max_ur_;
+    if (n_blocks > 1) {
+        Label l_loop;
+        mov_imm(reg_c_work_, n_blocks);
+        L(l_loop);
+        accumulate(max_ur_, false);
+        advance(max_ur_ * simd_w_);
+        subs(reg_c_work_, reg_c_work_, 1);
+        b(NE, l_loop);
+    } else if (n_blocks == 1) {
+        accumulate(max_ur_, false);
+        advance(max_ur_ * simd_w_);
+    }
+
+    const bool with_tail = tail_size_ > 0;
+    if (n_rem > 0 || with_tail) accumulate(n_rem + with_tail, with_tail);
+
+    postamble();
+}
+
+template struct jit_uni_resampling_bwd_kernel_t<sve_512>;
+template struct jit_uni_resampling_bwd_kernel_t<sve_256>;
+template struct jit_uni_resampling_bwd_kernel_t<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,202 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_RESAMPLING_KERNEL_HPP
+#define CPU_AARCH64_JIT_UNI_RESAMPLING_KERNEL_HPP
+
+#include <functional>
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/injectors/jit_uni_postops_injector.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/jit_primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct jit_uni_resampling_kernel_base_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_resampling)
+
+    jit_uni_resampling_kernel_base_t(const jit_resampling_conf_t &conf)
+        : jit_generator_t(nullptr, MAX_CODE_SIZE, true, conf.isa)
+        , conf_(conf)
+        , sum_scales_(conf_.sum_scales) {}
+    ~jit_uni_resampling_kernel_base_t() override = default;
+
+    virtual std::size_t get_simd_w() = 0;
+
+protected:
+    const jit_resampling_conf_t &conf_;
+    std::queue<float> sum_scales_;
+};
+
+// Processes one row of `batch_of_sp_points_to_process` output points of an
+// nspc or blocked tensor, each point being `inner_stride` channels wide.
+template <cpu_isa_t isa>
+struct jit_uni_resampling_kernel_t : public jit_uni_resampling_kernel_base_t {
+    jit_uni_resampling_kernel_t(
+            const jit_resampling_conf_t &conf, const memory_desc_t *dst_md);
+
+    ~jit_uni_resampling_kernel_t() override = default;
+
+    std::size_t get_simd_w() override { return simd_w_; }
+
+private:
+    using ZReg = Xbyak_aarch64::ZReg;
+    using PReg = Xbyak_aarch64::PReg;
+    using XReg = Xbyak_aarch64::XReg;
+    using body_fn_t = std::function<void(const PReg &p, bool is_tail)>;
+
+    void init_post_ops_injector(const memory_desc_t *dst_md);
+
+    void load(const ZReg &vmm, const XReg &addr, const PReg &p,
+            data_type_t dt);
+    void store(const ZReg &vmm, const XReg &addr, const PReg &p);
+
+    void apply_sum(const int data_idx, const PReg &p);
+    void apply_postops(const int data_idx, const PReg &p, bool is_tail);
+
+    void channel_loop(const body_fn_t &body, unsigned n_src_ptrs);
+    void nearest_alg();
+    void linear_alg();
+    void generate() override;
+
+    static constexpr int vlen_ = cpu_isa_traits<isa>::vlen;
+    static constexpr std::size_t simd_w_ = vlen_ / sizeof(float);
+    static constexpr unsigned max_corners_ = 8;
+
+    ZReg vmm_weight_dh(int i) const { return ZReg(8 + i); }
+    ZReg vmm_weight_w(int i) const { return ZReg(12 + i); }
+    ZReg vmm_weight(int i) const { return ZReg(17 + i); }
+    const ZReg vmm_dst_ = ZReg(16);
+    const ZReg vmm_src_ = ZReg(25);
+    const ZReg vmm_sum_scale_ = ZReg(26);
+    const ZReg vmm_prev_dst_ = ZReg(27);
+    const ZReg vmm_zero_saturation_ = ZReg(28);
+    const ZReg vmm_saturation_ubound_ = ZReg(29);
+    const ZReg rhs_dt_helper_vmm_ = ZReg(31);
+
+    // p1, p4 and p6 are used by the eltwise injector
+    const PReg p_full_ = p2;
+    const PReg p_tail_ = p3;
+
+    const XReg reg_param_ = x0;
+    const XReg reg_src_ = x1;
+    const XReg reg_dst_ = x2;
+    const XReg reg_indices_ = x3;
+    const XReg reg_weights_ = x4;
+    const XReg reg_work_ = x5;
+    const XReg reg_c_work_ = x6;
+    const XReg reg_po_injector_helper_1_ = x14;
+    const XReg reg_po_injector_helper_2_ = x15;
+    const XReg reg_po_injector_helper_3_ = x13;
+
+    // Source pointers of the corners of the current output point: corner i
+    // takes its w index from bit 0, its h index from bit 1 and its d index
+    // from bit 2.
+    XReg reg_src_corner(int i) const {
+        static constexpr int idx[max_corners_]
+                = {9, 10, 11, 12, 16, 17, 19, 20};
+        return XReg(idx[i]);
+    }
+    // Source pointers with the d and h offsets applied, shared by the left
+    // and right corners.
+    XReg reg_src_dh(int i) const {
+        static constexpr int idx[max_corners_ / 2] = {7, 8, 21, 22};
+        return XReg(idx[i]);
+    }
+
+    const std::size_t tail_size_;
+
+    std::unique_ptr<injector::jit_uni_postops_injector_t<to_vla_sve(isa)>>
+            postops_injector_;
+};
+
+// Computes the `inner_stride` channels of one diff_src point as a gather: the
+// diff_dst points it contributes to are listed per spatial dimension by
+// tables precomputed at primitive creation, so each diff_src point is written
+// exactly once and no atomic accumulation is needed.
+template <cpu_isa_t isa>
+struct jit_uni_resampling_bwd_kernel_t
+    : public jit_uni_resampling_kernel_base_t {
+    jit_uni_resampling_bwd_kernel_t(const jit_resampling_conf_t &conf);
+
+    ~jit_uni_resampling_bwd_kernel_t() override = default;
+
+    std::size_t get_simd_w() override { return simd_w_; }
+
+private:
+    using ZReg = Xbyak_aarch64::ZReg;
+    using PReg = Xbyak_aarch64::PReg;
+    using XReg = Xbyak_aarch64::XReg;
+
+    void load(const ZReg &vmm, const XReg &addr, const PReg &p);
+    void store(const ZReg &vmm, const XReg &addr, const PReg &p);
+
+    // Accumulates `ur` vectors of channels, the last one being partial when
+    // `with_tail` is set, and stores them to diff_src.
+    void accumulate(unsigned ur, bool with_tail);
+    void generate() override;
+
+    static constexpr int vlen_ = cpu_isa_traits<isa>::vlen;
+    static constexpr std::size_t simd_w_ = vlen_ / sizeof(float);
+    static constexpr unsigned max_ur_ = 4;
+
+    ZReg vmm_acc(int i) const { return ZReg(i); }
+    const ZReg vmm_data_ = ZReg(4);
+    const ZReg vmm_weight_d_ = ZReg(5);
+    const ZReg vmm_weight_dh_ = ZReg(6);
+    const ZReg vmm_weight_ = ZReg(7);
+
+    const PReg p_full_ = p2;
+    const PReg p_tail_ = p3;
+
+    const XReg reg_param_ = x0;
+    const XReg reg_diff_dst_ = x1;
+    const XReg reg_diff_src_ = x2;
+    const XReg reg_entries_d_ = x3;
+    const XReg reg_entries_h_ = x4;
+    const XReg reg_entries_w_ = x5;
+    const XReg reg_n_d_ = x6;
+    const XReg reg_n_h_ = x7;
+    const XReg reg_n_w_ = x8;
+    const XReg reg_c_work_ = x9;
+    const XReg reg_cur_d_ = x10;
+    const XReg reg_cnt_d_ = x11;
+    const XReg reg_cur_h_ = x12;
+    const XReg reg_cnt_h_ = x13;
+    const XReg reg_cur_w_ = x14;
+    const XReg reg_cnt_w_ = x15;
+    const XReg reg_addr_d_ = x16;
+    const XReg reg_addr_dh_ = x17;
+    const XReg reg_addr_ = x19;
+
+    const std::size_t tail_size_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -17,18 +17,22 @@
 *******************************************************************************/
 
 #include <cassert>
+#include <cstring>
 #include <memory>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
 #include "common/memory_tracking.hpp"
 #include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
 #include "cpu/aarch64/jit_generator.hpp"
 #include "cpu/aarch64/jit_uni_softmax.hpp"
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
 
 #include "xbyak_aarch64/xbyak_aarch64_util.h"
 
@@ -47,6 +51,9 @@ struct jit_softmax_base_t : public jit_generator_t {
         const void *src_scales; // src_scales defined for all data type cases
         const void *dst_scales; // dst_scales defined for all data type cases
         size_t process_n_elems;
+        const void *attn_scale; // f32 multiplier of the source
+        const void *attn_mask; // row of the additive attention mask
+        size_t attn_n_valid; // number of keys kept by the causal mask
     };
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_softmax_t)
 
@@ -73,12 +80,16 @@ struct jit_softmax_base_t : public jit_generator_t {
     XReg reg_interim_spat_offt = abi_not_param1;
     XReg reg_src_scales = x6;
     XReg reg_dst_scales = x7;
+    XReg reg_attn_tmp = x2;
+    XReg reg_attn_mask = x4;
+    XReg reg_attn_n_valid = x5;
 
     const PReg p_shuff0 = p11;
     const PReg p_shuff1 = p5;
     const PReg injector_mask = p1;
     const PReg injector_tmp = p6;
     const PReg tail_opmask = p2;
+    const PReg p_attn_causal = p3;
 
     static constexpr int data_vreg_start_idx = 8;
     static const int vtmp_idx = 25;
@@ -90,6 +101,7 @@ struct jit_softmax_base_t : public jit_generator_t {
     static const int vzero_idx = 30;
     static const int vsaturation_ubound_idx = vneg_flt_max_idx;
     static const int v_tmp0_idx = 31;
+    static const int vattn_scale_idx = 24;
 
     bool is_softmax_ = pd_->is_softmax();
     bool is_logsoftmax_ = pd_->is_logsoftmax();
@@ -97,6 +109,9 @@ struct jit_softmax_base_t : public jit_generator_t {
             = !pd_->attr()->scales_.has_default_values(DNNL_ARG_SRC);
     bool need_dst_scale_
             = !pd_->attr()->scales_.has_default_values(DNNL_ARG_DST);
+    bool with_attn_scale_ = pd_->with_attn_scale();
+    bool with_attn_mask_ = pd_->with_attn_mask();
+    bool with_causal_mask_ = pd_->with_causal_mask();
     bool axis_is_blocked_;
     bool need_scratchpad_;
 
@@ -190,6 +205,9 @@ void jit_softmax_base_t::load_common_params() {
     if (need_scratchpad_) { PARAM_LOAD(reg_interim, interim); }
     if (need_src_scale_) { PARAM_LOAD(reg_src_scales, src_scales); }
     if (need_dst_scale_) { PARAM_LOAD(reg_dst_scales, dst_scales); }
+    if (with_attn_scale_) { PARAM_LOAD(reg_attn_tmp, attn_scale); }
+    if (with_attn_mask_) { PARAM_LOAD(reg_attn_mask, attn_mask); }
+    if (with_causal_mask_) { PARAM_LOAD(reg_attn_n_valid, attn_n_valid); }
 #undef PARAM_OFF
 #undef PARAM_LOAD
 }
@@ -312,6 +330,7 @@ struct jit_softmax_sve_t : public jit_softmax_base_t {
     const ZReg vzero = ZReg(vzero_idx);
     const ZReg vsaturation_ubound = ZReg(vsaturation_ubound_idx);
     const ZReg v_tmp0 = ZReg(v_tmp0_idx);
+    const ZReg vattn_scale = ZReg(vattn_scale_idx);
 
     void store(const XReg &addr, const ZReg &vmm, data_type_t dt, bool tail);
     void load(const ZReg &vmm, const XReg &addr, data_type_t dt, bool tail);
@@ -327,6 +346,8 @@ struct jit_softmax_sve_t : public jit_softmax_base_t {
     XReg diff_src_ptr(size_t offt = 0);
     XReg diff_dst_ptr(size_t offt = 0);
     void prepare_tail_mask();
+    void apply_attn_inputs(const ZReg &vmm, int i, bool tail);
+    void prepare_causal_mask(int i);
     void accumulate_vsbr();
     void compute_diff_src();
     void backward();
@@ -470,6 +491,33 @@ void jit_softmax_sve_t::prepare_tail_mask() {
     set_preg(tail_opmask.s, axis_simd_tail_, X_TMP_0, X_TMP_1);
 }
 
+// Applies the attention scale and additive mask to the source vector `i` of
+// the current unroll. The kernel processes a single plain row per call, so the
+// source offset gives the index of the key the vector starts with.
+void jit_softmax_sve_t::apply_attn_inputs(const ZReg &vmm, int i, bool tail) {
+    if (with_attn_scale_) fmul(vmm.s, vmm.s, vattn_scale.s);
+    if (!with_attn_mask_) return;
+
+    const data_type_t mask_dt = pd_->arg_md(DNNL_ARG_ATTN_MASK)->data_type;
+    const int mask_dt_size = types::data_type_size(mask_dt);
+    lsr(reg_attn_tmp, reg_src_spat_offt, math::ilog2q(src_d_.data_type_size()));
+    add(X_DEFAULT_ADDR, reg_attn_mask, reg_attn_tmp, LSL,
+            math::ilog2q(mask_dt_size));
+    add_imm(X_DEFAULT_ADDR, X_DEFAULT_ADDR, i * simd_w_ * mask_dt_size,
+            X_TMP_0);
+    load(vtmp, X_DEFAULT_ADDR, mask_dt, tail);
+    fadd(vmm.s, vmm.s, vtmp.s);
+}
+
+// Sets `p_attn_causal` to the lanes of the source vector `i` of the current
+// unroll masked out by the causal mask.
+void jit_softmax_sve_t::prepare_causal_mask(int i) {
+    lsr(reg_attn_tmp, reg_src_spat_offt, math::ilog2q(src_d_.data_type_size()));
+    add_imm(reg_attn_tmp, reg_attn_tmp, i * simd_w_, X_TMP_0);
+    whilelt(p_attn_causal.s, reg_attn_tmp, reg_attn_n_valid);
+    not_(p_attn_causal.b, P_ALL_ONE, p_attn_causal.b);
+}
+
 void jit_softmax_sve_t::get_horizontal_op(const ZReg &v, op_t op) {
     if (op == op_t::max)
         fmaxv(SReg(v.getIdx()), P_ALL_ONE, v.s);
@@ -488,6 +536,11 @@ void jit_softmax_sve_t::accumulate_vmax() {
             ZReg vreg_tmp_src = ZReg(data_vreg_start_idx + i);
             load(vreg_tmp_src, src_ptr(src_axis_stride_ * i),
                     src_d_.data_type(), tail);
+            apply_attn_inputs(vreg_tmp_src, i, tail);
+            if (with_causal_mask_) {
+                prepare_causal_mask(i);
+                mov(vreg_tmp_src.s, p_attn_causal / T_m, vneg_flt_max.s);
+            }
             if (tail) {
                 uni_fmax(vmax, vmax, vreg_tmp_src, tail_opmask);
             } else {
@@ -515,6 +568,7 @@ void jit_softmax_sve_t::accumulate_vsum() {
             ZReg vreg_tmp_src = ZReg(data_vreg_start_idx + i);
             load(vreg_tmp_src, src_ptr(src_axis_stride_ * i),
                     src_d_.data_type(), tail);
+            apply_attn_inputs(vreg_tmp_src, i, tail);
             fsub(vreg_tmp_src.s, vreg_tmp_src.s, vmax.s);
             if (is_logsoftmax_) { // store before applying exp
                 if (need_scratchpad_) {
@@ -531,6 +585,10 @@ void jit_softmax_sve_t::accumulate_vsum() {
 
         for (int i = 0; i < unroll; i++) {
             ZReg vreg_tmp_src = ZReg(data_vreg_start_idx + i);
+            if (with_causal_mask_) { // zero the masked out keys
+                prepare_causal_mask(i);
+                eor(vreg_tmp_src.s, p_attn_causal / T_m, vreg_tmp_src.s);
+            }
             if (tail)
                 fadd(vsum.s, tail_opmask / T_m, vreg_tmp_src.s);
             else
@@ -685,6 +743,8 @@ void jit_softmax_sve_t::generate() {
     if (log_injector_) log_injector_->load_table_addr();
     if (axis_simd_tail_) prepare_tail_mask();
     load_common_params();
+    if (with_attn_scale_)
+        ld1rw(vattn_scale.s, P_ALL_ONE / T_z, ptr(reg_attn_tmp));
     if (pd_->is_fwd())
         forward();
     else
@@ -980,6 +1040,22 @@ status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
 
     const int nthr = pd()->nthr_;
 
+    // Attention inputs come with a plain source, so every call of the kernel
+    // processes a row of `axis_size` keys and `ou` is the index of the row.
+    float attn_scale = 1.f;
+    if (pd()->with_attn_scale()) {
+        const auto scale = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+        attn_scale = io::load_float_value(
+                pd()->arg_md(DNNL_ARG_SCALE)->data_type, scale, 0);
+        if (pd()->desc()->invert_scale) attn_scale = 1.f / attn_scale;
+    }
+    const auto attn_mask = CTX_IN_MEM(const char *, DNNL_ARG_ATTN_MASK);
+    const memory_desc_wrapper attn_mask_d(pd()->arg_md(DNNL_ARG_ATTN_MASK));
+    const int ndims = pd()->ndims();
+    const dim_t axis_size = pd()->axis_size();
+    const dim_t queries = ndims >= 2 ? src_d.dims()[ndims - 2] : 1;
+    const auto attn_mask_type = pd()->desc()->attn_mask_type;
+
     parallel_nd_ext(nthr, outer_size, inner_size,
             [&](int ithr, int, dim_t ou, dim_t in) {
         dim_t offset = (ou * outer_stride + in * inner_stride);
@@ -988,8 +1064,30 @@ status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
         char *interim_ptr = scratchpad_ptr
                 ? scratchpad_ptr + ithr * axis_size_padded * sizeof(float)
                 : nullptr;
+
+        dim_t n_valid = axis_size;
+        if (attn_mask_type == attn_mask_type::top_left)
+            n_valid = ou % queries + 1;
+        else if (attn_mask_type == attn_mask_type::bottom_right)
+            n_valid = ou % queries + 1 + axis_size - queries;
+        if (n_valid <= 0) { // every key of the row is masked out
+            std::memset(dst_ptr, 0, axis_size * dst_data_type_size);
+            return;
+        }
+
+        const char *attn_mask_ptr = nullptr;
+        if (attn_mask) {
+            dims_t pos;
+            utils::l_dims_by_l_offset(pos, offset, src_d.dims(), ndims);
+            for (int d = 0; d < ndims; d++)
+                if (attn_mask_d.dims()[d] == 1) pos[d] = 0;
+            attn_mask_ptr = attn_mask
+                    + attn_mask_d.off_v(pos) * attn_mask_d.data_type_size();
+        }
+
         softmax_driver_->exec(src_ptr, dst_ptr, interim_ptr, src_scales,
-                dst_scales, process_n_elems);
+                dst_scales, process_n_elems, &attn_scale, attn_mask_ptr,
+                nstl::min(n_valid, axis_size));
     });
 
     return status::success;
@@ -1050,7 +1148,9 @@ struct driver_t : public c_compatible {
     driver_t(const softmax_pd_t *pd) : pd_(pd), ker_(pd_) {}
 
     void exec(const void *src, void *dst, void *interim, const void *src_scales,
-            const void *dst_scales, const dim_t process_n_elems) {
+            const void *dst_scales, const dim_t process_n_elems,
+            const float *attn_scale, const void *attn_mask,
+            const dim_t attn_n_valid) {
         typename jit_softmax_t<isa>::call_params_t p;
         p.process_n_elems = process_n_elems;
         p.src = src;
@@ -1058,6 +1158,9 @@ struct driver_t : public c_compatible {
         p.interim = interim;
         p.src_scales = src_scales;
         p.dst_scales = dst_scales;
+        p.attn_scale = attn_scale;
+        p.attn_mask = attn_mask;
+        p.attn_n_valid = attn_n_valid;
         ker_(&p);
     }
 
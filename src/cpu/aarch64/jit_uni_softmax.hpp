@@ -82,6 +82,8 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                             utils::one_of(src_dt, f32, f16)
                                     && utils::one_of(dst_dt, f32, f16)
                                     && is_softmax())
+                    && IMPLICATION(with_attn_inputs(),
+                            isa == sve && is_softmax())
                     && attr()->has_default_values(skip_mask_t::scales)
                     && attr_scales_ok()
                     && set_default_formats() == status::success;
@@ -89,7 +91,8 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
 
             ok = memory_desc_wrapper(src_md()).similar_to(
                          memory_desc_wrapper(dst_md()), true, false, 0)
-                    && is_dense(); // not dense impl can be easily done
+                    && is_dense() // not dense impl can be easily done
+                    && IMPLICATION(with_attn_inputs(), attn_inputs_ok());
             if (!ok) return status::unimplemented;
 
             nthr_ = dnnl_get_max_threads();
@@ -101,6 +104,18 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
         int nthr_; // To not exceed the limit in execute used for set up.
 
     private:
+        // The kernel is called for every row of a plain source and walks the
+        // keys of the mask row along with the ones of the source row.
+        bool attn_inputs_ok() const {
+            if (!memory_desc_wrapper(src_md()).is_plain()) return false;
+            if (!with_attn_mask()) return true;
+
+            const memory_desc_wrapper mask_d(arg_md(DNNL_ARG_ATTN_MASK));
+            const int last = ndims() - 1;
+            return mask_d.is_plain() && mask_d.dims()[last] == axis_size()
+                    && mask_d.blocking_desc().strides[last] == 1;
+        }
+
         void init_scratchpad() {
             if (utils::one_of(dst_md()->data_type, data_type::u8, data_type::s8,
                         data_type::bf16, data_type::f16)) {
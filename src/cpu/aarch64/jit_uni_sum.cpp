@@ -0,0 +1,262 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_uni_sum.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+#define GET_OFF(field) static_cast<int32_t>(offsetof(jit_sum_call_t, field))
+
+static cpu_isa_t get_supported_isa() {
+    if (mayiuse(sve_512)) return sve_512;
+    if (mayiuse(sve_256)) return sve_256;
+    if (mayiuse(sve_128)) return sve_128;
+
+    return isa_undef;
+}
+
+void jit_uni_sum_kernel_t::load(
+        const ZReg &z, const XReg &base, int offt, const PReg &p) {
+    XReg addr = base;
+    if (offt != 0) {
+        add_imm(X_DEFAULT_ADDR, base, offt, X_TMP_0);
+        addr = X_DEFAULT_ADDR;
+    }
+
+    switch (jsp.src_dt) {
+        case data_type::f32: ld1w(z.s, p / T_z, ptr(addr)); break;
+        case data_type::bf16:
+            ld1h(z.s, p / T_z, ptr(addr));
+            lsl(z.s, z.s, 16);
+            break;
+        case data_type::f16:
+            ld1h(z.s, p / T_z, ptr(addr));
+            fcvt(z.s, p_vl_ / T_m, z.h);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+void jit_uni_sum_kernel_t::store(
+        const ZReg &z, const XReg &base, int offt, const PReg &p) {
+    XReg addr = base;
+    if (offt != 0) {
+        add_imm(X_DEFAULT_ADDR, base, offt, X_TMP_0);
+        addr = X_DEFAULT_ADDR;
+    }
+
+    switch (jsp.dst_dt) {
+        case data_type::f32: st1w(z.s, p, ptr(addr)); break;
+        case data_type::bf16:
+            bfcvt(z.h, p_vl_ / T_m, z.s);
+            st1h(z.s, p, ptr(addr));
+            break;
+        case data_type::f16:
+            fcvt(z.h, p_vl_ / T_m, z.s);
+            st1h(z.s, p, ptr(addr));
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+void jit_uni_sum_kernel_t::compute(int unroll, const PReg &p) {
+    const int src_vlen = jsp.simd_w * types::data_type_size(jsp.src_dt);
+    const int dst_vlen = jsp.simd_w * types::data_type_size(jsp.dst_dt);
+
+    for (int a = 0; a < jsp.num_srcs; a++) {
+        for (int u = 0; u < unroll; u++) {
+            load(vmm_src(u), reg_src(a), u * src_vlen, p);
+            if (a == 0)
+                fmul(vmm_acc(u).s, vmm_src(u).s, vmm_scale(a).s);
+            else
+                fmla(vmm_acc(u).s, p_vl_ / T_m, vmm_src(u).s, vmm_scale(a).s);
+        }
+    }
+
+    for (int u = 0; u < unroll; u++)
+        store(vmm_acc(u), reg_dst_, u * dst_vlen, p);
+}
+
+void jit_uni_sum_kernel_t::advance_ptrs(dim_t nelems) {
+    for (int a = 0; a < jsp.num_srcs; a++)
+        add_imm(reg_src(a), reg_src(a),
+                nelems * types::data_type_size(jsp.src_dt), X_TMP_0);
+    add_imm(reg_dst_, reg_dst_, nelems * types::data_type_size(jsp.dst_dt),
+            X_TMP_0);
+    sub_imm(reg_sz_, reg_sz_, nelems, X_TMP_0);
+}
+
+void jit_uni_sum_kernel_t::generate() {
+    preamble();
+
+    ldr(reg_srcs_, ptr(abi_param1, GET_OFF(srcs)));
+    ldr(reg_dst_, ptr(abi_param1, GET_OFF(dst)));
+    ldr(reg_scales_, ptr(abi_param1, GET_OFF(scales)));
+    ldr(reg_sz_, ptr(abi_param1, GET_OFF(size)));
+
+    // The predicate covers a single vector of the isa which may be shorter
+    // than the hardware vector length
+    set_preg(p_vl_.s, jsp.simd_w);
+
+    for (int a = 0; a < jsp.num_srcs; a++) {
+        ldr(reg_src(a),
+                ptr(reg_srcs_, static_cast<int32_t>(a * sizeof(void *))));
+        ld1rw(vmm_scale(a).s, p_vl_ / T_z,
+                ptr(reg_scales_, static_cast<int32_t>(a * sizeof(float))));
+    }
+
+    Label unroll_loop, unroll_loop_end, single_loop, single_loop_end, end;
+
+    L(unroll_loop);
+    {
+        mov_imm(X_TMP_0, unroll_max_ * jsp.simd_w);
+        cmp(reg_sz_, X_TMP_0);
+        b(LT, unroll_loop_end);
+        compute(unroll_max_, p_vl_);
+        advance_ptrs(unroll_max_ * jsp.simd_w);
+        b(unroll_loop);
+    }
+    L(unroll_loop_end);
+
+    L(single_loop);
+    {
+        cmp_imm(reg_sz_, jsp.simd_w, X_TMP_0);
+        b(LT, single_loop_end);
+        compute(1, p_vl_);
+        advance_ptrs(jsp.simd_w);
+        b(single_loop);
+    }
+    L(single_loop_end);
+
+    cbz(reg_sz_, end);
+    mov_imm(X_TMP_1, 0);
+    whilelt(p_tail_.s, X_TMP_1, reg_sz_);
+    compute(1, p_tail_);
+
+    L(end);
+    postamble();
+}
+
+#undef GET_OFF
+
+template <data_type_t src_data_type, data_type_t dst_data_type>
+status_t jit_uni_sum_t<src_data_type, dst_data_type>::pd_t::init(
+        engine_t *engine) {
+    jsp_.isa = get_supported_isa();
+
+    // disabling verbose dispatch messages for unsupported isa for better
+    // readability
+    if (jsp_.isa == isa_undef) return status::unimplemented;
+
+    VDISPATCH_SUM(cpu_sum_pd_t::init(engine) == status::success,
+            VERBOSE_BAD_ENGINE_KIND);
+    VDISPATCH_SUM(src_mds_.size()
+                    <= (size_t)jit_uni_sum_kernel_t::max_num_arrs,
+            "number of inputs exceed max number of arrays");
+    VDISPATCH_SUM(
+            IMPLICATION(dst_data_type == data_type::bf16, mayiuse_bf16()),
+            VERBOSE_ISA_DT_MISMATCH);
+
+    const memory_desc_wrapper o_d(&dst_md_);
+    VDISPATCH_SUM(o_d.data_type() == dst_data_type, VERBOSE_INCONSISTENT_DT,
+            "o_d", "dst");
+    VDISPATCH_SUM(o_d.is_dense(true), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    for (size_t i = 0; i < src_mds_.size(); ++i) {
+        const memory_desc_wrapper i_d(&src_mds_[i]);
+        VDISPATCH_SUM(src_data_type == i_d.data_type(),
+                VERBOSE_INCONSISTENT_DT, "src", "i_d");
+        VDISPATCH_SUM(o_d.similar_to(i_d, true, false, 0),
+                VERBOSE_INCONSISTENT_MDS, "o_d", "i_d");
+        VDISPATCH_SUM(i_d.is_dense(true), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    }
+
+    jsp_.num_srcs = static_cast<int>(src_mds_.size());
+    jsp_.src_dt = src_data_type;
+    jsp_.dst_dt = dst_data_type;
+    jsp_.simd_w = static_cast<int>(isa_max_vlen(jsp_.isa) / sizeof(float));
+
+    return status::success;
+}
+
+template <data_type_t src_data_type, data_type_t dst_data_type>
+status_t jit_uni_sum_t<src_data_type, dst_data_type>::execute(
+        const exec_ctx_t &ctx) const {
+    auto output = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+    const memory_desc_wrapper o_d(pd()->dst_md());
+    output += o_d.blk_off(0);
+    const int num_arrs = pd()->n_inputs();
+    const dim_t nelems = o_d.nelems(true);
+    const src_data_t *input_ptrs[jit_uni_sum_kernel_t::max_num_arrs];
+    for (int a = 0; a < num_arrs; ++a) {
+        const memory_desc_wrapper i_d(pd()->src_md(a));
+
+        input_ptrs[a]
+                = CTX_IN_MEM(const src_data_t *, DNNL_ARG_MULTIPLE_SRC + a)
+                + i_d.blk_off(0);
+    }
+    const float *scales = &pd()->scales()[0];
+
+    const dim_t half_L1 = 16 * 1024; // bytes
+    const dim_t num_elems_in_block = utils::rnd_up(
+            utils::div_up(half_L1,
+                    num_arrs * sizeof(src_data_t) + sizeof(dst_data_t)),
+            pd()->jsp_.simd_w);
+    const dim_t num_blocks = utils::div_up(nelems, num_elems_in_block);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(num_blocks, nthr, ithr, start, end);
+        const void *local_input_ptrs[jit_uni_sum_kernel_t::max_num_arrs];
+
+        for (dim_t nb = start; nb < end; ++nb) {
+            const dim_t start_e = nb * num_elems_in_block;
+            for (int a = 0; a < num_arrs; ++a)
+                local_input_ptrs[a] = &input_ptrs[a][start_e];
+
+            auto arg = jit_sum_call_t();
+            arg.srcs = local_input_ptrs;
+            arg.dst = &output[start_e];
+            arg.scales = scales;
+            arg.size = nstl::min(num_elems_in_block, nelems - start_e);
+            (*kernel_)(&arg);
+        }
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_sum_t<data_type::f32, data_type::f32>;
+template struct jit_uni_sum_t<data_type::bf16, data_type::bf16>;
+template struct jit_uni_sum_t<data_type::bf16, data_type::f32>;
+template struct jit_uni_sum_t<data_type::f16, data_type::f16>;
+template struct jit_uni_sum_t<data_type::f16, data_type::f32>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_JIT_UNI_SUM_HPP
+#define CPU_AARCH64_JIT_UNI_SUM_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_sum_pd.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct jit_sum_conf_t {
+    cpu_isa_t isa;
+    int num_srcs;
+    data_type_t src_dt;
+    data_type_t dst_dt;
+    int simd_w;
+};
+
+struct jit_sum_call_t {
+    const void **srcs;
+    void *dst;
+    const float *scales;
+    dim_t size;
+};
+
+// Computes dst = sum_i(scales[i] * srcs[i]) over size elements with f32
+// accumulation. bf16 and f16 inputs are up-converted at load time, so the
+// result is rounded to the destination data type only once.
+struct jit_uni_sum_kernel_t : public jit_generator_t {
+    jit_uni_sum_kernel_t(const jit_sum_conf_t &ajsp) : jsp(ajsp) {}
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sum_kernel_t)
+
+    static constexpr int max_num_arrs = 8;
+
+    jit_sum_conf_t jsp;
+
+private:
+    void generate() override;
+    void compute(int unroll, const Xbyak_aarch64::PReg &p);
+    void advance_ptrs(dim_t nelems);
+    void load(const Xbyak_aarch64::ZReg &z, const Xbyak_aarch64::XReg &base,
+            int offt, const Xbyak_aarch64::PReg &p);
+    void store(const Xbyak_aarch64::ZReg &z, const Xbyak_aarch64::XReg &base,
+            int offt, const Xbyak_aarch64::PReg &p);
+
+    Xbyak_aarch64::ZReg vmm_acc(int i) const {
+        return Xbyak_aarch64::ZReg(i);
+    }
+    Xbyak_aarch64::ZReg vmm_src(int i) const {
+        return Xbyak_aarch64::ZReg(unroll_max_ + i);
+    }
+    Xbyak_aarch64::ZReg vmm_scale(int i) const {
+        return Xbyak_aarch64::ZReg(32 - max_num_arrs + i);
+    }
+
+    static constexpr int unroll_max_ = 4;
+
+    const Xbyak_aarch64::XReg reg_srcs_ = x1;
+    const Xbyak_aarch64::XReg reg_dst_ = x2;
+    const Xbyak_aarch64::XReg reg_scales_ = x3;
+    const Xbyak_aarch64::XReg reg_sz_ = x4;
+    // x5 - x12
+    Xbyak_aarch64::XReg reg_src(int i) const {
+        return Xbyak_aarch64::XReg(5 + i);
+    }
+
+    const Xbyak_aarch64::PReg p_vl_ = p1;
+    const Xbyak_aarch64::PReg p_tail_ = p2;
+};
+
+template <data_type_t src_data_type, data_type_t dst_data_type>
+struct jit_uni_sum_t : public primitive_t {
+    struct pd_t : public cpu_sum_pd_t {
+        using cpu_sum_pd_t::cpu_sum_pd_t;
+
+        DECLARE_SUM_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", jsp_.isa, ""), jit_uni_sum_t);
+
+        status_t init(engine_t *engine);
+
+        jit_sum_conf_t jsp_ {};
+    };
+
+    jit_uni_sum_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(kernel_, new jit_uni_sum_kernel_t(pd()->jsp_)));
+        return kernel_->create_kernel();
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+    using src_data_t = typename prec_traits_t<src_data_type>::type;
+    using dst_data_t = typename prec_traits_t<dst_data_type>::type;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<jit_uni_sum_kernel_t> kernel_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
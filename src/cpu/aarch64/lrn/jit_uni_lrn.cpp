@@ -0,0 +1,321 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/lrn/jit_uni_lrn.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+format_tag_t get_dat_tag(const memory_desc_t &md) {
+    return memory_desc_matches_one_of_tag(md, ncw, nchw, ncdhw, nwc, nhwc,
+            ndhwc, nCw8c, nChw8c, nCdhw8c, nCw16c, nChw16c, nCdhw16c);
+}
+
+dim_t get_blk(format_tag_t tag, dim_t C) {
+    if (one_of(tag, nwc, nhwc, ndhwc)) return C;
+    if (one_of(tag, nCw8c, nChw8c, nCdhw8c)) return 8;
+    if (one_of(tag, nCw16c, nChw16c, nCdhw16c)) return 16;
+    return 1;
+}
+
+void init_conf(jit_lrn_conf_t &conf, const lrn_desc_t &desc, dim_t C,
+        cpu_isa_t isa, bool is_fwd) {
+    const float alpha = desc.lrn_alpha;
+    const float beta = desc.lrn_beta;
+    const dim_t size = desc.local_size;
+
+    conf.C = C;
+    conf.half_size = (size - 1) / 2;
+    conf.k = desc.lrn_k;
+    conf.alpha_n = alpha / size;
+    conf.bwd_coef = 2.f * alpha * beta / size;
+    conf.simd_w = static_cast<int>(isa_max_vlen(isa) / sizeof(float));
+    conf.is_fwd = is_fwd;
+}
+
+// Copies n points starting at sp_start of an image to a [C][tile_size] tile
+void to_tile(float *tile, const float *img, dim_t C, dim_t SP, dim_t blk,
+        dim_t sp_start, dim_t n) {
+    for_(dim_t cb = 0; cb < C / blk; cb++)
+    for (dim_t p = 0; p < n; p++) {
+        const float *s = img + (cb * SP + sp_start + p) * blk;
+        float *t = tile + cb * blk * lrn_utils::tile_size + p;
+        for (dim_t c = 0; c < blk; c++)
+            t[c * lrn_utils::tile_size] = s[c];
+    }
+}
+
+void from_tile(float *img, const float *tile, dim_t C, dim_t SP, dim_t blk,
+        dim_t sp_start, dim_t n) {
+    for_(dim_t cb = 0; cb < C / blk; cb++)
+    for (dim_t p = 0; p < n; p++) {
+        float *d = img + (cb * SP + sp_start + p) * blk;
+        const float *t = tile + cb * blk * lrn_utils::tile_size + p;
+        for (dim_t c = 0; c < blk; c++)
+            d[c] = t[c * lrn_utils::tile_size];
+    }
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+status_t jit_uni_lrn_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_LRN(is_fwd(), VERBOSE_BAD_PROPKIND);
+
+    // disabling verbose dispatch checks for unsupported isa for better readability
+    if (!mayiuse(isa)) return status::unimplemented;
+
+    VDISPATCH_LRN(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "src");
+    VDISPATCH_LRN(everyone_is(f32, src_d.data_type(), dst_d.data_type()),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_LRN(desc()->alg_kind == alg_kind::lrn_across_channels,
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_LRN(desc()->lrn_beta == 0.75, VERBOSE_BAD_PARAM, "lrn_beta");
+    VDISPATCH_LRN(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_LRN(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_LRN(src_d == dst_d, VERBOSE_INCONSISTENT_MDS, "src", "dst");
+    VDISPATCH_LRN(impl::is_dense_format_kind({src_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const format_tag_t dat_tag = get_dat_tag(*src_md());
+    VDISPATCH_LRN(dat_tag != format_tag::undef, VERBOSE_UNSUPPORTED_TAG);
+    blk_ = get_blk(dat_tag, C());
+    VDISPATCH_LRN(C() % blk_ == 0, VERBOSE_UNSUPPORTED_PAD_FEATURE, "src");
+
+    init_conf(conf_, *desc(), C(), isa, true);
+    nthr_ = dnnl_get_max_threads();
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_lrn_fwd_t<isa>::pd_t::init_scratchpad() {
+    if (blk_ == 1) return;
+
+    // src and dst tiles
+    const size_t per_thr = 2 * C() * lrn_utils::tile_size;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(key_lrn_wsp, nthr_ * per_thr);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_lrn_fwd_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_, new jit_uni_lrn_kernel_t(pd()->conf_)));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_lrn_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const memory_desc_wrapper data_d(pd()->src_md());
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t stride_mb = data_d.blocking_desc().strides[0];
+    const dim_t blk = pd()->blk_;
+    const bool in_place = blk == 1;
+
+    const dim_t chunk = in_place ? lrn_utils::chunk_size : lrn_utils::tile_size;
+    const dim_t nb_chunks = div_up(SP, chunk);
+    float *wsp = in_place
+            ? nullptr
+            : ctx.get_scratchpad_grantor().template get<float>(key_lrn_wsp);
+
+    parallel_nd_ext(pd()->nthr_, MB, nb_chunks,
+            [&](int ithr, int, dim_t mb, dim_t ib) {
+                const float *src_img = src + mb * stride_mb;
+                float *dst_img = dst + mb * stride_mb;
+                const dim_t sp_start = ib * chunk;
+                const dim_t n = nstl::min(chunk, SP - sp_start);
+
+                jit_uni_lrn_kernel_t::call_params_t p;
+                p.work = n;
+                if (in_place) {
+                    p.src = src_img + sp_start;
+                    p.dst = dst_img + sp_start;
+                    p.c_stride = SP * sizeof(float);
+                    (*kernel_)(&p);
+                    return;
+                }
+
+                float *src_tile = wsp + ithr * 2 * C * lrn_utils::tile_size;
+                float *dst_tile = src_tile + C * lrn_utils::tile_size;
+                to_tile(src_tile, src_img, C, SP, blk, sp_start, n);
+                p.src = src_tile;
+                p.dst = dst_tile;
+                p.c_stride = lrn_utils::tile_size * sizeof(float);
+                (*kernel_)(&p);
+                from_tile(dst_img, dst_tile, C, SP, blk, sp_start, n);
+            });
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_lrn_bwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper diff_src_d(diff_src_md());
+    const memory_desc_wrapper diff_dst_d(diff_dst_md());
+
+    VDISPATCH_LRN(!is_fwd(), VERBOSE_BAD_PROPKIND);
+
+    // disabling verbose dispatch checks for unsupported isa for better readability
+    if (!mayiuse(isa)) return status::unimplemented;
+
+    VDISPATCH_LRN(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "src");
+    VDISPATCH_LRN(everyone_is(f32, src_d.data_type(), diff_src_d.data_type(),
+                          diff_dst_d.data_type()),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_LRN(desc()->alg_kind == alg_kind::lrn_across_channels,
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_LRN(desc()->lrn_beta == 0.75, VERBOSE_BAD_PARAM, "lrn_beta");
+    VDISPATCH_LRN(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_LRN(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_LRN(src_d == diff_dst_d, VERBOSE_INCONSISTENT_MDS, "src",
+            "diff_dst");
+    VDISPATCH_LRN(diff_dst_d == diff_src_d, VERBOSE_INCONSISTENT_MDS,
+            "diff_src", "diff_dst");
+    VDISPATCH_LRN(impl::is_dense_format_kind(
+                          {src_md(), diff_src_md(), diff_dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_LRN(compare_ws(hint_fwd_pd_), VERBOSE_WS_MISMATCH);
+
+    const format_tag_t dat_tag = get_dat_tag(*src_md());
+    VDISPATCH_LRN(dat_tag != format_tag::undef, VERBOSE_UNSUPPORTED_TAG);
+    blk_ = get_blk(dat_tag, C());
+    VDISPATCH_LRN(C() % blk_ == 0, VERBOSE_UNSUPPORTED_PAD_FEATURE, "src");
+
+    init_conf(conf_, *desc(), C(), isa, false);
+    nthr_ = dnnl_get_max_threads();
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_lrn_bwd_t<isa>::pd_t::init_scratchpad() {
+    // omega^-0.75 and t values of one vector of points, followed by the src,
+    // diff_dst and diff_src tiles if the data is transposed
+    size_t per_thr = 2 * C() * conf_.simd_w;
+    if (blk_ != 1) per_thr += 3 * C() * lrn_utils::tile_size;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(key_lrn_wsp, nthr_ * per_thr);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_lrn_bwd_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_, new jit_uni_lrn_kernel_t(pd()->conf_)));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_lrn_bwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SRC, status);
+    CHECK(status);
+
+    const memory_desc_wrapper data_d(pd()->src_md());
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t stride_mb = data_d.blocking_desc().strides[0];
+    const dim_t blk = pd()->blk_;
+    const bool in_place = blk == 1;
+
+    const dim_t chunk = in_place ? lrn_utils::chunk_size : lrn_utils::tile_size;
+    const dim_t nb_chunks = div_up(SP, chunk);
+    const dim_t tile_elems = C * lrn_utils::tile_size;
+    const dim_t per_thr
+            = 2 * C * pd()->conf_.simd_w + (in_place ? 0 : 3 * tile_elems);
+    float *wsp = ctx.get_scratchpad_grantor().template get<float>(key_lrn_wsp);
+
+    parallel_nd_ext(pd()->nthr_, MB, nb_chunks,
+            [&](int ithr, int, dim_t mb, dim_t ib) {
+                const float *src_img = src + mb * stride_mb;
+                const float *diff_dst_img = diff_dst + mb * stride_mb;
+                float *diff_src_img = diff_src + mb * stride_mb;
+                const dim_t sp_start = ib * chunk;
+                const dim_t n = nstl::min(chunk, SP - sp_start);
+                float *thr_wsp = wsp + ithr * per_thr;
+
+                jit_uni_lrn_kernel_t::call_params_t p;
+                p.scratch = thr_wsp;
+                p.work = n;
+                if (in_place) {
+                    p.src = src_img + sp_start;
+                    p.diff_dst = diff_dst_img + sp_start;
+                    p.dst = diff_src_img + sp_start;
+                    p.c_stride = SP * sizeof(float);
+                    (*kernel_)(&p);
+                    return;
+                }
+
+                float *src_tile = thr_wsp + 2 * C * pd()->conf_.simd_w;
+                float *diff_dst_tile = src_tile + tile_elems;
+                float *diff_src_tile = diff_dst_tile + tile_elems;
+                to_tile(src_tile, src_img, C, SP, blk, sp_start, n);
+                to_tile(diff_dst_tile, diff_dst_img, C, SP, blk, sp_start, n);
+                p.src = src_tile;
+                p.diff_dst = diff_dst_tile;
+                p.dst = diff_src_tile;
+                p.c_stride = lrn_utils::tile_size * sizeof(float);
+                (*kernel_)(&p);
+                from_tile(diff_src_img, diff_src_tile, C, SP, blk, sp_start, n);
+            });
+
+    return status::success;
+}
+
+template struct jit_uni_lrn_fwd_t<sve_512>;
+template struct jit_uni_lrn_fwd_t<sve_256>;
+template struct jit_uni_lrn_fwd_t<sve_128>;
+template struct jit_uni_lrn_bwd_t<sve_512>;
+template struct jit_uni_lrn_bwd_t<sve_256>;
+template struct jit_uni_lrn_bwd_t<sve_128>;
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
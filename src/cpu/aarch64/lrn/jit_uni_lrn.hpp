@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_LRN_JIT_UNI_LRN_HPP
+#define CPU_AARCH64_LRN_JIT_UNI_LRN_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_lrn_pd.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/lrn/jit_uni_lrn_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace lrn_utils {
+
+// Points of the spatial domain processed per call of the kernel for the
+// layouts that are transposed to channel-major tiles
+constexpr dim_t tile_size = 64;
+// Points of the spatial domain processed per call of the kernel for the
+// plain layouts that are processed in place
+constexpr dim_t chunk_size = 256;
+
+} // namespace lrn_utils
+
+// Across channels LRN: ncw, nchw and ncdhw are processed in place, while
+// channels-last and blocked data is transposed into per-thread channel-major
+// tiles of lrn_utils::tile_size points before calling the kernel. Each
+// channel of a point is a channel block of size blk_ of the layout, where
+// blk_ is 1 for plain and C for channels-last data.
+template <cpu_isa_t isa>
+struct jit_uni_lrn_fwd_t : public primitive_t {
+    struct pd_t : public cpu_lrn_fwd_pd_t {
+        using cpu_lrn_fwd_pd_t::cpu_lrn_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_lrn_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_lrn_conf_t conf_ {};
+        dim_t blk_ = 1;
+        int nthr_ = 0;
+
+    private:
+        void init_scratchpad();
+    };
+
+    jit_uni_lrn_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_lrn_kernel_t> kernel_;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_lrn_bwd_t : public primitive_t {
+    struct pd_t : public cpu_lrn_bwd_pd_t {
+        using cpu_lrn_bwd_pd_t::cpu_lrn_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_lrn_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_lrn_conf_t conf_ {};
+        dim_t blk_ = 1;
+        int nthr_ = 0;
+
+    private:
+        void init_scratchpad();
+    };
+
+    jit_uni_lrn_bwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_lrn_kernel_t> kernel_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
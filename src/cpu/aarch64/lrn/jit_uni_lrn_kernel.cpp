@@ -0,0 +1,238 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/lrn/jit_uni_lrn_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+#define GET_OFF(field) static_cast<int32_t>(offsetof(call_params_t, field))
+
+void jit_uni_lrn_kernel_t::load_const(const ZReg &z, float val) {
+    mov_imm(W_TMP_0, float2int(val));
+    dup(z.s, W_TMP_0);
+}
+
+void jit_uni_lrn_kernel_t::step(pass_t pass, bool add_edge, bool remove_edge) {
+    const size_t vlen = conf_.simd_w * sizeof(float);
+    const PReg &p = p_work_;
+
+    if (pass == pass_t::bwd_diff) {
+        // diff_src = diff_dst * omega^-0.75
+        //         - 2 * alpha * beta / n * src * sum(t)
+        ld1w(z_src_.s, p / T_z, ptr(reg_src_cur_));
+        ld1w(z_diff_dst_.s, p / T_z, ptr(reg_diff_dst_cur_));
+        ld1w(z_scale_.s, p / T_z, ptr(reg_a_cur_));
+        fmul(z_res_.s, z_diff_dst_.s, z_scale_.s);
+        fmul(z_tmp_.s, z_src_.s, z_sum_.s);
+        fmls(z_res_.s, p / T_m, z_tmp_.s, z_bwd_coef_.s);
+        st1w(z_res_.s, p, ptr(reg_dst_cur_));
+    } else {
+        // omega = k + alpha / n * sum(src^2)
+        // scale = omega^-0.75 = sqrt(1 / (sqrt(omega) * omega))
+        ld1w(z_src_.s, p / T_z, ptr(reg_src_cur_));
+        mov(z_omega_.d, z_k_.d);
+        fmla(z_omega_.s, p / T_m, z_alpha_n_.s, z_sum_.s);
+        fsqrt(z_tmp_.s, p / T_m, z_omega_.s);
+        fmul(z_tmp_.s, z_tmp_.s, z_omega_.s);
+        mov(z_scale_.d, z_one_.d);
+        fdiv(z_scale_.s, p / T_m, z_tmp_.s);
+        fsqrt(z_scale_.s, p / T_m, z_scale_.s);
+
+        if (pass == pass_t::fwd) {
+            fmul(z_res_.s, z_src_.s, z_scale_.s);
+            st1w(z_res_.s, p, ptr(reg_dst_cur_));
+        } else {
+            // t = src * diff_dst * omega^-0.75 / omega
+            ld1w(z_diff_dst_.s, p / T_z, ptr(reg_diff_dst_cur_));
+            st1w(z_scale_.s, p, ptr(reg_a_cur_));
+            fmul(z_res_.s, z_src_.s, z_diff_dst_.s);
+            fmul(z_res_.s, z_res_.s, z_scale_.s);
+            fdiv(z_res_.s, p / T_m, z_omega_.s);
+            st1w(z_res_.s, p, ptr(reg_t_cur_));
+        }
+    }
+
+    // Slide the window to the next channel
+    const bool square = pass != pass_t::bwd_diff;
+    const XReg &reg_win = square ? reg_src_cur_ : reg_t_cur_;
+    if (add_edge) {
+        add(X_DEFAULT_ADDR, reg_win, reg_add_off_);
+        ld1w(z_edge_.s, p / T_z, ptr(X_DEFAULT_ADDR));
+        if (square)
+            fmla(z_sum_.s, p / T_m, z_edge_.s, z_edge_.s);
+        else
+            fadd(z_sum_.s, p / T_m, z_edge_.s);
+    }
+    if (remove_edge) {
+        sub(X_DEFAULT_ADDR, reg_win, reg_rem_off_);
+        ld1w(z_edge_.s, p / T_z, ptr(X_DEFAULT_ADDR));
+        if (square) {
+            fmls(z_sum_.s, p / T_m, z_edge_.s, z_edge_.s);
+            // Rounding errors must not make the sum of squares negative
+            fmax(z_sum_.s, p / T_m, 0.0f);
+        } else
+            fsub(z_sum_.s, p / T_m, z_edge_.s);
+    }
+
+    add(reg_src_cur_, reg_src_cur_, reg_c_stride_);
+    if (pass != pass_t::bwd_omega)
+        add(reg_dst_cur_, reg_dst_cur_, reg_c_stride_);
+    if (pass != pass_t::fwd) {
+        add(reg_diff_dst_cur_, reg_diff_dst_cur_, reg_c_stride_);
+        add_imm(reg_a_cur_, reg_a_cur_, vlen, X_TMP_0);
+        add_imm(reg_t_cur_, reg_t_cur_, vlen, X_TMP_0);
+    }
+}
+
+void jit_uni_lrn_kernel_t::channel_loop(
+        pass_t pass, dim_t count, bool add_edge, bool remove_edge) {
+    if (count <= 0) return;
+    if (count == 1) {
+        step(pass, add_edge, remove_edge);
+        return;
+    }
+
+    Label loop;
+    mov_imm(reg_cnt_, count);
+    L(loop);
+    {
+        step(pass, add_edge, remove_edge);
+        subs(reg_cnt_, reg_cnt_, 1);
+        b(NE, loop);
+    }
+}
+
+void jit_uni_lrn_kernel_t::compute_pass(pass_t pass) {
+    const size_t vlen = conf_.simd_w * sizeof(float);
+    const dim_t C = conf_.C;
+    const dim_t half = conf_.half_size;
+    const bool square = pass != pass_t::bwd_diff;
+
+    mov(reg_src_cur_, reg_src_);
+    mov(reg_diff_dst_cur_, reg_diff_dst_);
+    mov(reg_dst_cur_, reg_dst_);
+    mov(reg_a_cur_, reg_scratch_);
+    add_imm(reg_t_cur_, reg_scratch_, C * vlen, X_TMP_0);
+
+    // The window slides over src with the data channel stride and over the
+    // scratch t values with the vector length stride
+    if (square) {
+        mov_imm(X_TMP_0, half + 1);
+        mul(reg_add_off_, reg_c_stride_, X_TMP_0);
+        mov_imm(X_TMP_0, half);
+        mul(reg_rem_off_, reg_c_stride_, X_TMP_0);
+    } else {
+        mov_imm(reg_add_off_, (half + 1) * vlen);
+        mov_imm(reg_rem_off_, half * vlen);
+    }
+
+    // Window of the first channel: [0, min(half, C - 1)]
+    eor(z_sum_.d, z_sum_.d, z_sum_.d);
+    const XReg &reg_win = square ? reg_src_cur_ : reg_t_cur_;
+    mov(X_TMP_1, reg_win);
+    Label init_loop;
+    mov_imm(reg_cnt_, nstl::min(half, C - 1) + 1);
+    L(init_loop);
+    {
+        ld1w(z_edge_.s, p_work_ / T_z, ptr(X_TMP_1));
+        if (square) {
+            fmla(z_sum_.s, p_work_ / T_m, z_edge_.s, z_edge_.s);
+            add(X_TMP_1, X_TMP_1, reg_c_stride_);
+        } else {
+            fadd(z_sum_.s, p_work_ / T_m, z_edge_.s);
+            add_imm(X_TMP_1, X_TMP_1, vlen, X_TMP_0);
+        }
+        subs(reg_cnt_, reg_cnt_, 1);
+        b(NE, init_loop);
+    }
+
+    // Channel c + half + 1 enters the window for c < add_end and channel
+    // c - half leaves it for c >= rem_start, which splits the channels into
+    // three ranges with fixed window updates.
+    const dim_t add_end = nstl::max(dim_t(0), C - 1 - half);
+    const dim_t rem_start = nstl::min(half, C);
+    const dim_t lo = nstl::min(add_end, rem_start);
+    const dim_t hi = nstl::max(add_end, rem_start);
+    const bool mid_updates = add_end > rem_start;
+
+    channel_loop(pass, lo, true, false);
+    channel_loop(pass, hi - lo, mid_updates, mid_updates);
+    channel_loop(pass, C - hi, false, true);
+}
+
+void jit_uni_lrn_kernel_t::generate() {
+    const size_t vlen = conf_.simd_w * sizeof(float);
+
+    preamble();
+
+    ldr(reg_src_, ptr(abi_param1, GET_OFF(src)));
+    ldr(reg_diff_dst_, ptr(abi_param1, GET_OFF(diff_dst)));
+    ldr(reg_dst_, ptr(abi_param1, GET_OFF(dst)));
+    ldr(reg_scratch_, ptr(abi_param1, GET_OFF(scratch)));
+    ldr(reg_c_stride_, ptr(abi_param1, GET_OFF(c_stride)));
+    ldr(reg_work_, ptr(abi_param1, GET_OFF(work)));
+
+    // The predicate covers a single vector of the isa which may be shorter
+    // than the hardware vector length
+    set_preg(p_vl_.s, conf_.simd_w);
+
+    load_const(z_k_, conf_.k);
+    load_const(z_alpha_n_, conf_.alpha_n);
+    load_const(z_one_, 1.f);
+    if (!conf_.is_fwd) load_const(z_bwd_coef_, conf_.bwd_coef);
+
+    Label pt_loop, end;
+    mov_imm(reg_pt_, 0);
+    L(pt_loop);
+    {
+        cmp(reg_pt_, reg_work_);
+        b(GE, end);
+        whilelt(p_work_.s, reg_pt_, reg_work_);
+        and_(p_work_.b, p_vl_ / T_z, p_work_.b, p_work_.b);
+
+        if (conf_.is_fwd) {
+            compute_pass(pass_t::fwd);
+        } else {
+            compute_pass(pass_t::bwd_omega);
+            compute_pass(pass_t::bwd_diff);
+        }
+
+        add_imm(reg_src_, reg_src_, vlen, X_TMP_0);
+        add_imm(reg_diff_dst_, reg_diff_dst_, vlen, X_TMP_0);
+        add_imm(reg_dst_, reg_dst_, vlen, X_TMP_0);
+        add_imm(reg_pt_, reg_pt_, conf_.simd_w, X_TMP_0);
+        b(pt_loop);
+    }
+    L(end);
+
+    postamble();
+}
+
+#undef GET_OFF
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_LRN_JIT_UNI_LRN_KERNEL_HPP
+#define CPU_AARCH64_LRN_JIT_UNI_LRN_KERNEL_HPP
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+struct jit_lrn_conf_t {
+    dim_t C;
+    dim_t half_size;
+    float k;
+    // alpha / local_size
+    float alpha_n;
+    // 2 * alpha * beta / local_size, backward only
+    float bwd_coef;
+    int simd_w;
+    bool is_fwd;
+};
+
+// Across channels LRN with beta = 0.75 over a channel-major block of f32
+// data: element (c, p) is located at base + c * c_stride + p * sizeof(float),
+// where p < work are contiguous points of the spatial domain. The sum of
+// squares is kept in a sliding window which is updated with one addition
+// and one subtraction per channel, so the cost does not depend on the local
+// size.
+//
+// Backward is done in two passes over the channels. The first pass stores
+// omega^-0.75 and src * diff_dst * omega^-1.75 for one vector of points into
+// the [2][C][simd_w] scratch, and the second one slides the window over the
+// latter to compute diff_src.
+class jit_uni_lrn_kernel_t : public jit_generator_t {
+public:
+    struct call_params_t {
+        const float *src = nullptr, *diff_dst = nullptr;
+        // dst for forward, diff_src for backward
+        float *dst = nullptr;
+        float *scratch = nullptr;
+        size_t c_stride = 0u;
+        size_t work = 0u;
+    };
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_lrn_kernel_t)
+
+    jit_uni_lrn_kernel_t(const jit_lrn_conf_t &conf) : conf_(conf) {}
+
+    void operator()(call_params_t *params) {
+        jit_generator_t::operator()(params);
+    }
+
+private:
+    enum class pass_t { fwd, bwd_omega, bwd_diff };
+
+    void generate() override;
+    void compute_pass(pass_t pass);
+    void step(pass_t pass, bool add_edge, bool remove_edge);
+    void channel_loop(
+            pass_t pass, dim_t count, bool add_edge, bool remove_edge);
+    void load_const(const Xbyak_aarch64::ZReg &z, float val);
+
+    const jit_lrn_conf_t conf_;
+
+    const Xbyak_aarch64::XReg reg_src_ = x1;
+    const Xbyak_aarch64::XReg reg_diff_dst_ = x2;
+    const Xbyak_aarch64::XReg reg_dst_ = x3;
+    const Xbyak_aarch64::XReg reg_scratch_ = x4;
+    const Xbyak_aarch64::XReg reg_c_stride_ = x5;
+    const Xbyak_aarch64::XReg reg_work_ = x6;
+    // Offsets of the channels entering and leaving the window
+    const Xbyak_aarch64::XReg reg_add_off_ = x7;
+    const Xbyak_aarch64::XReg reg_rem_off_ = x8;
+    const Xbyak_aarch64::XReg reg_src_cur_ = x10;
+    const Xbyak_aarch64::XReg reg_diff_dst_cur_ = x11;
+    const Xbyak_aarch64::XReg reg_dst_cur_ = x12;
+    const Xbyak_aarch64::XReg reg_a_cur_ = x13;
+    const Xbyak_aarch64::XReg reg_t_cur_ = x14;
+    const Xbyak_aarch64::XReg reg_cnt_ = x15;
+    const Xbyak_aarch64::XReg reg_pt_ = x19;
+
+    const Xbyak_aarch64::PReg p_vl_ = p1;
+    const Xbyak_aarch64::PReg p_work_ = p2;
+
+    const Xbyak_aarch64::ZReg z_sum_ = z0;
+    const Xbyak_aarch64::ZReg z_src_ = z1;
+    const Xbyak_aarch64::ZReg z_edge_ = z2;
+    const Xbyak_aarch64::ZReg z_omega_ = z3;
+    const Xbyak_aarch64::ZReg z_tmp_ = z4;
+    const Xbyak_aarch64::ZReg z_scale_ = z5;
+    const Xbyak_aarch64::ZReg z_diff_dst_ = z6;
+    const Xbyak_aarch64::ZReg z_res_ = z7;
+    const Xbyak_aarch64::ZReg z_k_ = z24;
+    const Xbyak_aarch64::ZReg z_alpha_n_ = z25;
+    const Xbyak_aarch64::ZReg z_one_ = z26;
+    const Xbyak_aarch64::ZReg z_bwd_coef_ = z27;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
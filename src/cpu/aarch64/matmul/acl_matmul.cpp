@@ -132,9 +132,22 @@ status_t acl_matmul_t::pd_t::init(engine_t *engine) {
         amp_.gemm_info.set_use_fp32_acc(use_fp32_acc);
     }
 
-    if (weights_format_kind_ == format_kind::any) {
+    // Weights already packed to the layout of a fixed format kernel, e.g.
+    // to the weights_desc() of another primitive descriptor, are accepted
+    // when this kernel expects the same layout. This way primitives created
+    // for different shapes share one copy of the packed weights, which the
+    // user keeps across primitive cache evictions, instead of each
+    // execution repacking plain weights.
+    const memory_desc_t weights_md_received = weights_md_;
+    const bool is_prepacked = weights_format_kind_ == format_kind::blocked
+            && weights_md_.format_desc.blocking.inner_nblks > 0;
+    is_fixed_format_ = weights_format_kind_ == format_kind::any || is_prepacked;
+    if (is_fixed_format_) {
         CHECK(acl_matmul_utils::init_conf_matmul<true>(
                 amp_, src_md_, weights_md_, dst_md_, *desc(), *attr()));
+        VDISPATCH_MATMUL(IMPLICATION(is_prepacked,
+                                 weights_md_received == weights_md_),
+                "weights are not in the layout of the fixed format kernel");
     } else {
         CHECK(acl_matmul_utils::init_conf_matmul<false>(
                 amp_, src_md_, weights_md_, dst_md_, *desc(), *attr()));
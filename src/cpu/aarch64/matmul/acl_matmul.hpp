@@ -40,6 +40,9 @@ struct acl_matmul_t : public primitive_t {
         acl_matmul_conf_t amp_ = utils::zero<decltype(amp_)>();
         acl_post_ops_t acl_post_ops;
         dnnl::impl::format_kind_t weights_format_kind_;
+        // Weights are in the blocked layout of an ACL fixed format kernel,
+        // either chosen for `any` or packed beforehand by the user
+        bool is_fixed_format_ = false;
     };
 
     acl_matmul_t(const pd_t *apd)
@@ -48,7 +51,7 @@ struct acl_matmul_t : public primitive_t {
     status_t init(engine_t *engine) override;
 
     status_t execute(const exec_ctx_t &ctx) const override {
-        if (pd()->weights_format_kind_ == format_kind::any) {
+        if (pd()->is_fixed_format_) {
             return execute_forward<true>(ctx);
         } else {
             return execute_forward<false>(ctx);
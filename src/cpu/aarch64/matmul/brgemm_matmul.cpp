@@ -18,12 +18,14 @@
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
 #include "common/memory_tracking.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/scale_utils.hpp"
 
 #include "cpu/aarch64/injectors/jit_uni_binary_injector.hpp"
@@ -58,7 +60,8 @@ int get_brg_kernel_index(const brgemm_matmul_conf_t &bgmmc, bool is_bs_tail,
             : bgmmc.M_blk;
     auto vN = (is_N_tail) ? bgmmc.N_tail : bgmmc.N_blk;
     auto vK = (is_K_tail) ? bgmmc.K_tail : bgmmc.K_blk;
-    if (vM == 0 || vN == 0 || vK == 0 || bs == 0 || bgmmc.LDA < vK
+    if (vM == 0 || vN == 0 || vK == 0 || bs == 0
+            || bgmmc.LDA < (bgmmc.read_A_transposed ? vM : vK)
             || bgmmc.LDB < vN || bgmmc.LDC < vN)
         return -1;
 
@@ -100,6 +103,12 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             = everyone_is(bf16, src_dt, wei_dt) && one_of(dst_dt, bf16, f32);
     const bool is_f16
             = everyone_is(f16, src_dt, wei_dt) && one_of(dst_dt, f16, f32);
+    const bool is_f32_with_int_wei
+            = src_dt == f32 && one_of(wei_dt, s8, u8, s4, u4) && dst_dt == f32;
+    const bool is_fp8_dst = one_of(dst_dt, f8_e5m2, f8_e4m3);
+    const bool is_fp8 = one_of(src_dt, f8_e5m2, f8_e4m3)
+            && one_of(wei_dt, f8_e5m2, f8_e4m3)
+            && (is_fp8_dst || one_of(dst_dt, f32, bf16, f16));
 
     auto check_bias = [&]() -> bool {
         const auto bia_dt = weights_md(1)->data_type;
@@ -107,7 +116,8 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         const bool is_bia_dt_correct
                 = IMPLICATION(is_int8 == true,
                           one_of(bia_dt, f32, s32, s8, u8, bf16))
-                && IMPLICATION(!is_int8, one_of(bia_dt, f32, src_dt));
+                && IMPLICATION(!is_int8, one_of(bia_dt, f32, src_dt))
+                && IMPLICATION(is_fp8, bia_dt == f32);
         return IMPLICATION(with_bias(), is_bia_dt_correct && is_bias_1xN());
     };
 
@@ -127,16 +137,25 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         return ok;
     };
 
-    auto check_attr_zero_points = [&]() -> bool {
+    auto check_attr_zero_points = [&](bool allow_multiple_wei_zp) -> bool {
         const auto &zp = attr()->zero_points_;
         static const std::vector<int> supported_args {
-                DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST};
+                DNNL_ARG_SRC, DNNL_ARG_DST};
         for (int arg : supported_args) {
             if (!zp.has_default_values(arg)) {
                 const int mask = zp.get_mask(arg);
                 if (mask > 0) return false;
             }
         }
+        if (!zp.has_default_values(DNNL_ARG_WEIGHTS)) {
+            const auto mask = zp.get_mask(DNNL_ARG_WEIGHTS);
+            if (allow_multiple_wei_zp) {
+                const auto kn_mask = wei_qmask_N() + wei_qmask_K();
+                return (mask & ~kn_mask) == 0;
+            } else {
+                return mask == 0;
+            }
+        }
         return true;
     };
 
@@ -147,12 +166,22 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     const bool no_dynamic_strides_for_B_and_C
             = !memory_desc_wrapper(weights_md_).has_runtime_strides()
             && !memory_desc_wrapper(dst_md_).has_runtime_strides();
-    const bool problem_dt_correct = is_int8 || is_bf16 || is_f32 || is_f16;
+    const bool problem_dt_correct = is_int8 || is_bf16 || is_f32 || is_f16
+            || is_fp8 || is_f32_with_int_wei;
     VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_NONTRIVIAL_STRIDE);
     VDISPATCH_MATMUL(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
     VDISPATCH_MATMUL(problem_dt_correct, VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_MATMUL(
             IMPLICATION(is_bf16, mayiuse_bf16()), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(IMPLICATION(is_fp8,
+                             jit_low_bit_cvt_t::is_supported(src_dt, f32)
+                                     && IMPLICATION(
+                                             dst_dt == bf16, mayiuse_bf16())),
+            VERBOSE_UNSUPPORTED_ISA);
+    // fp8 src and dst are converted in scratchpad buffers of the whole
+    // tensor size
+    VDISPATCH_MATMUL(IMPLICATION(is_fp8, !has_runtime_dims_or_strides()),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
     VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
     VDISPATCH_MATMUL(
             no_dynamic_strides_for_B_and_C, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
@@ -160,13 +189,34 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             attr()->has_default_values(primitive_attr_t::skip_mask_t::scales
                             | primitive_attr_t::skip_mask_t::zero_points
                             | primitive_attr_t::skip_mask_t::post_ops
-                            | primitive_attr_t::skip_mask_t::sum_dt,
+                            | primitive_attr_t::skip_mask_t::sum_dt
+                            | primitive_attr_t::skip_mask_t::fpmath_mode
+                            | primitive_attr_t::skip_mask_t::rounding_mode
+                            | primitive_attr_t::skip_mask_t::accumulation_mode,
                     dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
+    // f16 is the only data type accumulated in f16, int8 is accumulated in
+    // s32 and the others in f32
+    const auto acc_mode = attr()->acc_mode_;
+    VDISPATCH_MATMUL(IMPLICATION(acc_mode == accumulation_mode::f16, is_f16)
+                    && IMPLICATION(acc_mode == accumulation_mode::s32, is_int8)
+                    && IMPLICATION(
+                            acc_mode == accumulation_mode::f32, !is_int8),
+            VERBOSE_UNSUPPORTED_ATTR);
+    // Stochastic rounding is applied by the down-conversion of fp8 dst
+    VDISPATCH_MATMUL(IMPLICATION(!is_fp8_dst,
+                             attr()->rounding_mode_.has_default_values()),
+            VERBOSE_UNSUPPORTED_ATTR);
+    // The f32 result is down-converted after the post-ops, so sum can't read
+    // the fp8 dst
+    VDISPATCH_MATMUL(IMPLICATION(is_fp8_dst,
+                             attr()->post_ops_.find(primitive_kind::sum) == -1),
+            VERBOSE_UNSUPPORTED_POSTOP);
     VDISPATCH_MATMUL(attr()->post_ops_.check_sum_consistency(dst_dt, is_int8),
             VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_MATMUL(check_attr_scales(), VERBOSE_UNSUPPORTED_SCALES_CFG);
-    VDISPATCH_MATMUL(check_attr_zero_points(), VERBOSE_UNSUPPORTED_ZP_CFG);
+    VDISPATCH_MATMUL(check_attr_zero_points(is_f32_with_int_wei),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
     VDISPATCH_MATMUL(check_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
 
     CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
@@ -178,6 +228,12 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
     const int max_m_ker_idx
             = bgmmc_.is_runtime_M ? max_num_dynamic_m_tails + 1 : 2;
+    // distance of the weights prefetch, in rows of K
+    constexpr dim_t prf_B_k_rows = 16;
+
+    // The kernels store fp8 dst as f32 into the scratchpad buffer
+    memory_desc_t brg_dst_md = dst_md_;
+    brg_dst_md.data_type = bgmmc_.dst_dt;
 
     const auto backup_isa = isa;
     for_(int i_bs = 0; i_bs < 2; i_bs++)
@@ -204,17 +260,26 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         const auto layout = (one_of(bgmmc_.wei_tag, ba) && bgmmc_.M == 1)
                 ? brgemm_col_major
                 : brgemm_row_major;
+        // f16 weights kept by copy_B make brgemm accumulate in f16
+        const auto brg_wei_dt = bgmmc_.is_f16_acc ? f16 : bgmmc_.wei_dt;
         CHECK(brgemm_desc_init(&brg, kernel_isa, bgmmc_.brg_type, bgmmc_.src_dt,
-                bgmmc_.wei_dt, false, false, layout, alpha, vbeta, LDA,
-                bgmmc_.LDB, bgmmc_.LDC, vM, vN, vK));
+                brg_wei_dt, bgmmc_.read_A_transposed, false, layout, alpha,
+                vbeta, LDA, bgmmc_.LDB, bgmmc_.LDC, vM, vN, vK));
 
         auto LDD = bgmmc_.LDD;
+        if (bgmmc_.with_wei_decompression) brg.skip_zp_b_compensation = true;
+        if (bgmmc_.apply_scales_in_buffer_b) brg.skip_wei_scales = true;
         CHECK(brgemm_desc_set_postops(
-                &brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
+                &brg, attr(), &brg_dst_md, LDD, bgmmc_.bia_dt));
 
         brgemm_attr_t brgattr;
         brgattr.generate_skip_accumulation
                 = bgmmc_.post_ops_applicable && bgmmc_.nthr_k > 1;
+        // GEMV-like problems stream the weights with too little compute per
+        // byte to hide the load latency
+        if (bgmmc_.is_small_M)
+            brgattr.hint_prfB.dist1 = static_cast<int>(
+                    prf_B_k_rows * bgmmc_.LDB * bgmmc_.tr_b_dt_sz);
 
         CHECK(brgemm_desc_set_attr(&brg, brgattr));
 
@@ -226,7 +291,22 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
     auto scratchpad = scratchpad_registry().registrar();
     init_scratchpad(scratchpad, bgmmc_);
-    book_precomputed_scales(scratchpad, attr()->scales_, N());
+    if (!bgmmc_.apply_scales_in_buffer_b)
+        book_precomputed_scales(scratchpad, attr()->scales_, N());
+    if (one_of(bgmmc_.orig_src_dt, f8_e5m2, f8_e4m3))
+        scratchpad.book(key_matmul_src_trans,
+                memory_desc_wrapper(src_md_).size(), sizeof(float));
+    if (bgmmc_.orig_dst_dt != bgmmc_.dst_dt)
+        scratchpad.book(key_matmul_dst_in_acc_dt,
+                memory_desc_wrapper(dst_md_).size(), sizeof(float));
+    if (bgmmc_.is_bf32) {
+        scratchpad.book(key_matmul_src_trans,
+                memory_desc_wrapper(src_md_).size() / sizeof(float),
+                sizeof(bfloat16_t));
+        scratchpad.book(key_matmul_wei_trans,
+                memory_desc_wrapper(weights_md_).size() / sizeof(float),
+                sizeof(bfloat16_t));
+    }
 
     const bool is_B_transposed = one_of(bgmmc_.wei_tag, abdc, ba, acb, adbc,
             abced, abcdfe, abcdegf, abcdefhg, abcdefgih, abcdefghji,
@@ -236,7 +316,8 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             abced, abcdfe, abcdegf, abcdefhg, abcdefgih, abcdefghji,
             abcdefghikj, abcdefghijlk);
 
-    if ((mayiuse(sve_512) && is_B_transposed) || is_A_transposed)
+    if ((mayiuse(sve_512) && is_B_transposed)
+            || (is_A_transposed && !bgmmc_.read_A_transposed))
         return status::unimplemented;
 
     return status::success;
@@ -255,9 +336,7 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
         int idx = pd()->get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K);
         if (idx < 0) continue;
 
-        brgemm_kernel_t *ker = nullptr;
-        CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
-        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        CHECK(brg_kernels_.insert(idx, &pd()->get_brg_desc(idx)));
     }
 
     if (bgmmc.use_buffer_b) {
@@ -277,6 +356,19 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
         CHECK(acc_ker_s32_->create_kernel());
     }
 
+    if (one_of(bgmmc.orig_src_dt, f8_e5m2, f8_e4m3))
+        CHECK(safe_ptr_assign(src_cvt_,
+                new jit_low_bit_cvt_t(bgmmc.orig_src_dt, f32,
+                        low_bit_support::scale_kind_t::none)));
+    const bool is_dst_stochastic
+            = pd()->attr()->rounding_mode_.get(DNNL_ARG_DST)
+            == rounding_mode::stochastic;
+    if (bgmmc.orig_dst_dt == f8_e5m2 && !is_dst_stochastic
+            && jit_low_bit_cvt_t::is_supported(f32, f8_e5m2))
+        CHECK(safe_ptr_assign(dst_cvt_,
+                new jit_low_bit_cvt_t(
+                        f32, f8_e5m2, low_bit_support::scale_kind_t::none)));
+
     return status::success;
 }
 
@@ -292,12 +384,18 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     matmul_helper_t helper(src_d, weights_d, dst_d);
 
     const auto &scratchpad = ctx.get_scratchpad_grantor();
-    const float *oscales = precompute_scales(
-            scratchpad, src_scales, wei_scales, pd()->N(), pd()->attr());
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    // Scales along K are applied by copy_B
+    const float *oscales = bgmmc.apply_scales_in_buffer_b
+            ? nullptr
+            : precompute_scales(scratchpad, src_scales, wei_scales, pd()->N(),
+                    pd()->attr());
+
+    if (src_cvt_) convert_src_to_f32(ctx);
+    if (bgmmc.is_bf32) convert_inputs_to_bf16(ctx);
 
     brg_matmul_exec_ctx_t brgmm_ctx(ctx, pd(), oscales, dst_scales, helper);
 
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
     const bool use_buffer_a
             = bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only;
     const int num_threads = brgmm_ctx.get_num_threads_for_parallelization();
@@ -305,67 +403,170 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     const int M_chunks = brgmm_ctx.get_M_chunks();
     const int M_chunk_size = brgmm_ctx.get_M_chunk_size();
     const int M_chunk_tail = brgmm_ctx.get_M_chunk_tail();
+    // Without parallel reduction all the threads share the same iteration
+    // space, so it is handed out in chunks to keep the threads busy when some
+    // of them are slower or get blocks with more tails
+    std::unique_ptr<dynamic_work_counter_t> dynamic_work;
+    const int work_amount = brgmm_ctx.get_parallel_work_amount();
+    if (!brgmm_ctx.parallel_reduction_is_used() && num_threads > 1
+            && work_amount > num_threads)
+        dynamic_work = utils::make_unique<dynamic_work_counter_t>(work_amount,
+                get_dynamic_chunk_size(work_amount, num_threads));
     parallel(num_threads, [&](const int ithr, const int nthr) {
         const int ithr_bmn = brgmm_ctx.get_thread_idx_for_bmn(ithr);
         const int ithr_k = brgmm_ctx.get_thread_idx_for_k(ithr);
         if (ithr_bmn < 0 || ithr_k < 0) return;
-        int start {0}, end {0};
-        balance211(brgmm_ctx.get_parallel_work_amount(),
-                brgmm_ctx.get_num_threads_for_bmn(), ithr_bmn, start, end);
         int kc_start {0}, kc_end {bgmmc.K_chunks};
         if (brgmm_ctx.parallel_reduction_is_used())
             balance211((int)bgmmc.K_chunks, brgmm_ctx.get_num_threads_for_k(),
                     ithr_k, kc_start, kc_end);
 
         int prev_ker_idx = -1;
-
-        int b {0}, mc {0}, nc {0};
-        nd_iterator_init(
-                start, b, bgmmc.batch, mc, M_chunks, nc, bgmmc.N_chunks);
         int mc_prev = -1;
         int nc_prev = -1;
         int b_prev = -1;
-        while (start < end) {
-            auto m_start = mc * M_chunk_size;
-            const bool m_chunk_tail = mc == M_chunks - 1 && M_chunk_tail > 0;
-            auto m_end = m_start + (m_chunk_tail ? M_chunk_tail : M_chunk_size);
-            auto n_start = nc * bgmmc.N_chunk_size;
-            auto n_end = nstl::min(
-                    (nc + 1) * bgmmc.N_chunk_size, bgmmc.num_N_blocks);
-            int kc_prev = -1;
-            for_(int kc = kc_start; kc < kc_end; kc++)
-            for (int nb = n_start; nb < n_end; nb++) {
-                const bool skip_copy_b = nc_prev == nc && kc_prev == kc
-                        && (b_prev == b
-                                || bgmmc.bcast_B_desc
-                                           .bcast_across_all_batch_dims);
-                if (bgmmc.use_buffer_b && !skip_copy_b)
-                    copy_b_chunk_in_buffer(brgmm_ctx, ithr, b, nb, kc);
-                for (int mb = m_start; mb < m_end; mb++) {
-                    const bool skip_copy_a = mc_prev == mc && kc_prev == kc
+        const auto process_work = [&](int start, int end) {
+            int b {0}, mc {0}, nc {0};
+            nd_iterator_init(
+                    start, b, bgmmc.batch, mc, M_chunks, nc, bgmmc.N_chunks);
+            while (start < end) {
+                auto m_start = mc * M_chunk_size;
+                const bool m_chunk_tail
+                        = mc == M_chunks - 1 && M_chunk_tail > 0;
+                auto m_end = m_start
+                        + (m_chunk_tail ? M_chunk_tail : M_chunk_size);
+                auto n_start = nc * bgmmc.N_chunk_size;
+                auto n_end = nstl::min(
+                        (nc + 1) * bgmmc.N_chunk_size, bgmmc.num_N_blocks);
+                int kc_prev = -1;
+                for_(int kc = kc_start; kc < kc_end; kc++)
+                for (int nb = n_start; nb < n_end; nb++) {
+                    const bool skip_copy_b = nc_prev == nc && kc_prev == kc
                             && (b_prev == b
-                                    || bgmmc.bcast_A_desc
+                                    || bgmmc.bcast_B_desc
                                                .bcast_across_all_batch_dims);
-                    if (use_buffer_a && nb == n_start && !skip_copy_a)
-                        copy_a_chunk_in_buffer(brgmm_ctx, ithr, b, mb, kc);
-                    compute_kernel(brgmm_ctx, ithr, b, mb, nb, kc,
-                            kc == kc_start, prev_ker_idx);
+                    if (bgmmc.use_buffer_b && !skip_copy_b)
+                        copy_b_chunk_in_buffer(brgmm_ctx, ithr, b, nb, kc);
+                    for (int mb = m_start; mb < m_end; mb++) {
+                        const bool skip_copy_a = mc_prev == mc
+                                && kc_prev == kc
+                                && (b_prev == b
+                                        || bgmmc.bcast_A_desc
+                                                   .bcast_across_all_batch_dims);
+                        if (use_buffer_a && nb == n_start && !skip_copy_a)
+                            copy_a_chunk_in_buffer(
+                                    brgmm_ctx, ithr, b, mb, kc);
+                        compute_kernel(brgmm_ctx, ithr, b, mb, nb, kc,
+                                kc == kc_start, prev_ker_idx);
+                    }
+                    kc_prev = kc;
                 }
-                kc_prev = kc;
+                mc_prev = mc;
+                nc_prev = nc;
+                b_prev = b;
+                ++start;
+                nd_iterator_step(
+                        b, bgmmc.batch, mc, M_chunks, nc, bgmmc.N_chunks);
             }
-            mc_prev = mc;
-            nc_prev = nc;
-            b_prev = b;
-            ++start;
-            nd_iterator_step(b, bgmmc.batch, mc, M_chunks, nc, bgmmc.N_chunks);
+        };
+
+        if (dynamic_work) {
+            for_nd_dynamic(*dynamic_work, [&](dim_t start, dim_t end) {
+                process_work(static_cast<int>(start), static_cast<int>(end));
+            });
+        } else {
+            int start {0}, end {0};
+            balance211(work_amount, brgmm_ctx.get_num_threads_for_bmn(),
+                    ithr_bmn, start, end);
+            process_work(start, end);
         }
     });
 
     maybe_reduce_partial_results_and_apply_postops(brgmm_ctx);
+    CHECK(brg_kernels_.status());
+
+    if (bgmmc.orig_dst_dt != bgmmc.dst_dt)
+        convert_dst_from_f32(ctx, brgmm_ctx);
 
     return status::success;
 }
 
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::convert_src_to_f32(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
+    float *src_f32 = ctx.get_scratchpad_grantor().template get<float>(
+            key_matmul_src_trans);
+
+    // The whole buffer is converted to keep the layout of src, fp8 elements
+    // take a byte each
+    const dim_t nelems = memory_desc_wrapper(pd()->src_md()).size();
+    const dim_t chunk = 4096;
+    parallel_nd(utils::div_up(nelems, chunk), [&](dim_t i) {
+        const dim_t start = i * chunk;
+        const dim_t len = nstl::min(chunk, nelems - start);
+        (*src_cvt_)(src_f32 + start, src + start, nullptr, len);
+    });
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::convert_inputs_to_bf16(
+        const exec_ctx_t &ctx) const {
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    const auto convert = [&](int arg, const memory_desc_t *md,
+                                 memory_tracking::key_t key) {
+        const auto in = CTX_IN_MEM(const float *, arg);
+        bfloat16_t *out = scratchpad.template get<bfloat16_t>(key);
+
+        // The whole buffer is converted to keep the layout, padding included
+        const dim_t nelems = memory_desc_wrapper(md).size() / sizeof(float);
+        const dim_t chunk = 4096;
+        parallel_nd(utils::div_up(nelems, chunk), [&](dim_t i) {
+            const dim_t start = i * chunk;
+            const dim_t len = nstl::min(chunk, nelems - start);
+            cvt_float_to_bfloat16(out + start, in + start, len);
+        });
+    };
+    convert(DNNL_ARG_SRC, pd()->src_md(), key_matmul_src_trans);
+    convert(DNNL_ARG_WEIGHTS, pd()->weights_md(), key_matmul_wei_trans);
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::convert_dst_from_f32(const exec_ctx_t &ctx,
+        const brg_matmul_exec_ctx_t &brgmm_ctx) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    const auto rnd_seed
+            = CTX_IN_MEM(const uint32_t *, DNNL_ARG_ATTR_ROUNDING_SEED);
+    const float *acc = ctx.get_scratchpad_grantor().template get<float>(
+            key_matmul_dst_in_acc_dt);
+    const bool is_stochastic = pd()->attr()->rounding_mode_.get(DNNL_ARG_DST)
+            == rounding_mode::stochastic;
+    const auto dst_dt = bgmmc.orig_dst_dt;
+
+    // The f32 copy has the layout of dst, so both share element offsets
+    const bool is_row_dense = bgmmc.C_strides[0] == bgmmc.c_dt_sz;
+    parallel_nd(bgmmc.batch, bgmmc.M, [&](dim_t b, dim_t m) {
+        const auto off_C = [&](dim_t n) {
+            return brgmm_ctx.get_data_C_off(static_cast<int>(b),
+                           static_cast<int>(m), static_cast<int>(n))
+                    / bgmmc.c_dt_sz;
+        };
+        if (dst_cvt_ && is_row_dense) {
+            const dim_t row_off = off_C(0);
+            (*dst_cvt_)(static_cast<uint8_t *>(dst) + row_off, acc + row_off,
+                    nullptr, bgmmc.N);
+            return;
+        }
+        for (dim_t n = 0; n < bgmmc.N; n++) {
+            const dim_t off = off_C(n);
+            float d = acc[off];
+            if (is_stochastic)
+                d = math::stochastic_round_fwd(d, off, rnd_seed[0], dst_dt);
+            io::store_float_value(dst_dt, d, dst, off);
+        }
+    });
+}
+
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::compute_kernel(
         const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr, int b_idx,
@@ -415,8 +616,8 @@ void brgemm_matmul_t<isa>::compute_kernel(
         brgmm_ctx.copy_dst_values_to_buffer(b_idx, m_blk_idx, n_blk_idx);
 
     if (gemm_batch > 0 && brg_ker_idx >= 0) {
-        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
-        assert(brg_kernel != nullptr);
+        const auto brg_kernel = brg_kernels_[brg_ker_idx];
+        if (brg_kernel == nullptr) return;
 
         brgmm_ctx.init_brgemm_batch_elements_values(
                 ithr, 0, gemm_batch, b_idx, m_blk_idx, k_blk_idx, n_blk_idx);
@@ -462,7 +663,8 @@ void brgemm_matmul_t<isa>::compute_kernel(
         const int brg_ker_idx = pd()->get_brg_kernel_idx(
                 false, use_init_ker, m_ker_idx, is_N_tail, true);
         assert(brg_ker_idx >= 0);
-        const auto brg_kernel_k_tail = brg_kernels_[brg_ker_idx].get();
+        const auto brg_kernel_k_tail = brg_kernels_[brg_ker_idx];
+        if (brg_kernel_k_tail == nullptr) return;
 
         if (post_ops_applicable) {
             void *scratch = static_cast<void *>(
@@ -567,7 +769,8 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                                 = (bgmmc.N - nb * bgmmc.N_blk < bgmmc.N_blk);
                         const int brg_ker_idx = pd()->get_brg_kernel_idx(
                                 false, false, m_ker_idx, is_N_tail, false);
-                        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+                        const auto brg_kernel = brg_kernels_[brg_ker_idx];
+                        if (brg_kernel == nullptr) continue;
                         const int m = brgmm_ctx.get_M_idx(mb);
                         const int n = nb * bgmmc.N_blk;
                         const auto ptr_bias = brgmm_ctx.get_bias_ptr(n);
@@ -692,27 +895,46 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
             ithr, b_idx, n_blk_idx);
     ctx.zp_a_neg_value_ptr = (void *)brgmm_ctx.get_zp_a_neg_val_ptr();
 
+    auto copy_B_block = [&](int gb, int k, int k_iters) {
+        ctx.compensation_ptr
+                = (void *)brgmm_ctx.get_s8s8_comp_ptr(ithr, b_idx, n_blk_idx);
+        char *tr_src = brgmm_ctx.get_buf_B_ptr(ithr, gb, n_blk_idx);
+        if (!bgmmc.with_wei_decompression) {
+            ctx.src = (void *)brgmm_ctx.get_data_B_ptr(b_idx, k, n);
+            ctx.tr_src = (void *)tr_src;
+            ctx.current_K_start = k;
+            ctx.current_K_iters = k_iters;
+            (*copy_B_kernel_)(&ctx);
+            return;
+        }
+
+        // Each call dequantizes rows sharing the same scales and zero-points
+        const int k_end = k + k_iters;
+        for (int k_cur = k; k_cur < k_end;) {
+            const int k_next = nstl::min<int>(k_end,
+                    rnd_dn(k_cur, bgmmc.wei_decomp_k_gsize)
+                            + bgmmc.wei_decomp_k_gsize);
+            ctx.src = (void *)brgmm_ctx.get_data_B_ptr(b_idx, k_cur, n);
+            ctx.tr_src = (void *)(tr_src
+                    + (k_cur - k) * bgmmc.LDB * bgmmc.tr_b_dt_sz);
+            ctx.zp_b_value_ptr = brgmm_ctx.get_wei_zp_ptr(k_cur, n);
+            ctx.scales_ptr = brgmm_ctx.get_wei_scales_ptr(k_cur, n);
+            ctx.current_K_start = k_cur;
+            ctx.current_K_iters = k_next - k_cur;
+            (*copy_B_kernel_)(&ctx);
+            k_cur = k_next;
+        }
+    };
+
     int gb = 0;
     for (; gb < gemm_batch; gb++) {
         const int k = k_start + gb * bgmmc.K_blk;
-        ctx.src = (void *)brgmm_ctx.get_data_B_ptr(b_idx, k, n);
-        ctx.tr_src = (void *)brgmm_ctx.get_buf_B_ptr(ithr, gb, n_blk_idx);
-        ctx.compensation_ptr
-                = (void *)brgmm_ctx.get_s8s8_comp_ptr(ithr, b_idx, n_blk_idx);
-        ctx.current_K_start = k;
-        ctx.current_K_iters = nstl::min(bgmmc.K_blk, bgmmc.K);
-        (*copy_B_kernel_)(&ctx);
+        copy_B_block(gb, k, nstl::min(bgmmc.K_blk, bgmmc.K));
     }
 
     if (is_K_tail) {
         const int k = k_start + gb * bgmmc.K_blk;
-        ctx.src = (void *)brgmm_ctx.get_data_B_ptr(b_idx, k, n);
-        ctx.tr_src = (void *)brgmm_ctx.get_buf_B_ptr(ithr, gb, n_blk_idx);
-        ctx.compensation_ptr
-                = (void *)brgmm_ctx.get_s8s8_comp_ptr(ithr, b_idx, n_blk_idx);
-        ctx.current_K_start = k;
-        ctx.current_K_iters = bgmmc.K % bgmmc.K_blk;
-        (*copy_B_kernel_)(&ctx);
+        copy_B_block(gb, k, bgmmc.K % bgmmc.K_blk);
     }
 }
 
@@ -741,7 +963,9 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         , wsp_tile_ptr_(nullptr)
         , bias_ptr_(CTX_IN_MEM(const char *, DNNL_ARG_BIAS))
         , oscales_ptr_(oscales)
-        , dst_scales_ptr_(dst_scales) {
+        , dst_scales_ptr_(dst_scales)
+        , wei_scales_ptr_(CTX_IN_MEM(
+                  const char *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS)) {
 
         // setup scales / zp pointers
         const void *src_zero_points = CTX_IN_MEM(
@@ -763,6 +987,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                           wei_zero_points, 0)
                 : 0;
         zero_point_b_negative_val_ = -zero_point_b_val;
+        wei_zero_points_ptr_ = static_cast<const char *>(wei_zero_points);
         zero_point_c_val_ = dst_zero_points
                 ? cpu::io::load_int_value(
                           pd->attr()->zero_points_.get_data_type(DNNL_ARG_DST),
@@ -793,6 +1018,21 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 ? scratchpad.template get<char>(key_brgemm_primitive_buffer_d)
                 : nullptr;
 
+        // fp8 src and dst are replaced by their f32 copies of the same layout
+        if (one_of(bgmmc.orig_src_dt, f8_e5m2, f8_e4m3))
+            data_A_ptr_ = scratchpad.template get<const char>(
+                    key_matmul_src_trans);
+        if (bgmmc.orig_dst_dt != bgmmc.dst_dt)
+            data_C_ptr_ = scratchpad.template get<char>(
+                    key_matmul_dst_in_acc_dt);
+        // bf32 src and weights are replaced by their bf16 copies
+        if (bgmmc.is_bf32) {
+            data_A_ptr_ = scratchpad.template get<const char>(
+                    key_matmul_src_trans);
+            data_B_ptr_ = scratchpad.template get<const char>(
+                    key_matmul_wei_trans);
+        }
+
         const memory_desc_wrapper weights_d(pd->weights_md(0));
         const dim_t comp_offset = bgmmc_.b_dt_sz
                 * (weights_d.size() - weights_d.additional_buffer_size());
@@ -989,7 +1229,9 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
     const char *get_data_B_ptr(int b, int k, int n) const {
         int cur_b = get_bb_idx(b, bgmmc_.bcast_B_desc);
-        return data_B_ptr_ + get_data_B_off(cur_b, k, n);
+        // int4 weights are packed two per byte while B_strides count elements
+        const dim_t B_off = get_data_B_off(cur_b, k, n);
+        return data_B_ptr_ + (bgmmc_.is_int4_weights ? B_off / 2 : B_off);
     }
 
     char *get_data_C_ptr(int b, int m, int n) const {
@@ -1175,10 +1417,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             }
             return b_off + bgmmc_.B_strides[1] * k + bgmmc_.B_strides[0] * n;
         } else {
-            int dt_b_k_blk = bgmmc_.is_bf32
-                    ? data_type_vnni_simd_elems<sve_512>(f32)
-                    : bgmmc_.wei_k_blk;
-            int k_idx = bgmmc_.blocked_B ? k / dt_b_k_blk : k;
+            int k_idx = bgmmc_.blocked_B ? k / bgmmc_.wei_k_blk : k;
             int n_idx = bgmmc_.blocked_B ? n / bgmmc_.wei_n_blk : n;
             return bgmmc_.B_strides[2] * b + bgmmc_.B_strides[1] * k_idx
                     + bgmmc_.B_strides[0] * n_idx
@@ -1246,6 +1485,29 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return &zero_point_b_negative_val_;
     }
 
+    // Weights scales and zero-points applied by copy_B for weights
+    // decompression
+    const void *get_wei_scales_ptr(int k, int n) const {
+        if (!bgmmc_.apply_scales_in_buffer_b) return nullptr;
+        const dim_t ld = bgmmc_.is_wei_scale_per_n ? bgmmc_.N : 1;
+        const dim_t off = (k / bgmmc_.wei_scales_k_gsize) * ld
+                + bgmmc_.is_wei_scale_per_n * n;
+        return wei_scales_ptr_
+                + off * types::data_type_size(bgmmc_.wei_scales_dt);
+    }
+
+    const void *get_wei_zp_ptr(int k, int n) const {
+        if (!bgmmc_.with_wei_decompression
+                || bgmmc_.wei_zp_type == brgemm_broadcast_t::none)
+            return nullptr;
+        const dim_t ld = bgmmc_.is_wei_zp_per_n ? bgmmc_.N : 1;
+        const dim_t k_idx
+                = bgmmc_.is_wei_zp_per_k ? k / bgmmc_.wei_zp_k_gsize : 0;
+        const dim_t off = k_idx * ld + bgmmc_.is_wei_zp_per_n * n;
+        return wei_zero_points_ptr_
+                + off * types::data_type_size(bgmmc_.wei_zp_dt);
+    }
+
     const int32_t *get_zp_ab_mixed_comp_ptr() const {
         return &zero_point_mixed_ab_compensation_component_;
     }
@@ -1485,6 +1747,8 @@ private:
     const char *bias_ptr_;
     const float *oscales_ptr_;
     const float *dst_scales_ptr_;
+    const char *wei_scales_ptr_;
+    const char *wei_zero_points_ptr_;
     int32_t *s8s8_compensation_ptr_;
 
     int32_t *zero_point_a_compensations_ptr_;
@@ -30,6 +30,7 @@
 #include "cpu/aarch64/cpu_reducer.hpp"
 #include "cpu/aarch64/matmul/brgemm_matmul_copy_utils.hpp"
 #include "cpu/aarch64/matmul/brgemm_matmul_utils.hpp"
+#include "cpu/aarch64/reorder/jit_uni_reorder_low_bit.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -91,13 +92,22 @@ private:
             const brg_matmul_exec_ctx_t &brgmm_ctx) const;
     void accumulate(
             char *result_ptr, const char *reduce_ptr, size_t size) const;
+    void convert_src_to_f32(const exec_ctx_t &ctx) const;
+    void convert_inputs_to_bf16(const exec_ctx_t &ctx) const;
+    void convert_dst_from_f32(const exec_ctx_t &ctx,
+            const brg_matmul_exec_ctx_t &brgmm_ctx) const;
 
-    std::unique_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
+    brgemm_containers::brgemm_kernel_container_t brg_kernels_ {
+            max_num_brg_kernels_matmul};
 
     std::unique_ptr<jit_brgemm_matmul_copy_b_t> copy_B_kernel_;
     std::unique_ptr<jit_brgemm_matmul_copy_a_t> copy_A_kernel_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::f32>> acc_ker_f32_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::s32>> acc_ker_s32_;
+    // Conversions of fp8 src to f32 and of f32 dst to f8_e5m2 when it is
+    // rounded to nearest
+    std::unique_ptr<jit_low_bit_cvt_t> src_cvt_;
+    std::unique_ptr<jit_low_bit_cvt_t> dst_cvt_;
 };
 
 } // namespace matmul
@@ -17,6 +17,7 @@
 *******************************************************************************/
 
 #include "common/c_types_map.hpp"
+#include "common/float8.hpp"
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -359,7 +360,6 @@ void jit_brgemm_matmul_copy_a_transposed_impl_t::generate() {
     postamble();
 }
 
-template <cpu_isa_t isa>
 struct jit_brgemm_matmul_copy_b_int8_t : public jit_brgemm_matmul_copy_b_t,
                                          public jit_generator_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_b_int8_t)
@@ -372,28 +372,32 @@ struct jit_brgemm_matmul_copy_b_int8_t : public jit_brgemm_matmul_copy_b_t,
         , tr_src_stride_(conf->LDB * k_blk_step_ * sizeof(int8_t))
         , do_compute_compensation_(
                   conf->s8s8_compensation_required || conf->has_zero_point_a)
-        , comp_acc_idx_(25) {}
+        , simd_w_(static_cast<int>(get_sve_length()))
+        , n_comp_vecs_(div_up(conf->wei_n_blk * k_blk_step_, simd_w_)) {
+        // Every output vector holds simd_w_ / 4 columns of 4 interleaved K
+        // rows, so n_blk has to be a multiple of it for full vector stores.
+        assert(simd_w_ > 0 && simd_w_ <= 64);
+        assert((conf->wei_n_blk * k_blk_step_) % simd_w_ == 0);
+        assert(n_comp_vecs_ <= max_comp_vecs_);
+    }
 
     void operator()(ctx_t *ctx) override { jit_generator_t::operator()(ctx); }
     status_t create_kernel() override {
         return jit_generator_t::create_kernel();
     }
 
-protected:
+private:
     using reg64_t = const Xbyak_aarch64::XReg;
     using reg32_t = const Xbyak_aarch64::WReg;
 
-    static constexpr bool is_sve256_ = cpu_isa_traits<isa>::vlen == 32;
     static constexpr int k_blk_step_ = 4;
-    static constexpr int n_blk_step_ = 64;
-    static constexpr int blk_sz_ = 6;
-    static constexpr int simd_w_ = cpu_isa_traits<isa>::vlen;
+    static constexpr int max_comp_vecs_ = 16;
 
     const dim_t src_stride_;
     const dim_t tr_src_stride_;
     const bool do_compute_compensation_;
-
-    const int comp_acc_idx_;
+    const int simd_w_;
+    const int n_comp_vecs_;
 
     const Xbyak_aarch64::PReg kTail = p7;
 
@@ -406,98 +410,188 @@ protected:
     reg64_t reg_K_iters = x8;
     reg64_t reg_N_blk = x9;
     reg64_t reg_K_start = x10;
-    reg64_t regq_tmp = x14;
-    reg64_t imm_addr64 = x15;
-
-    ZReg vmm_ones_words = ZReg(24);
-    ZReg vmm_dot_product_temp = ZReg(25);
-
-    ZReg vreg_idx_lo_256 = z26;
-    ZReg vreg_idx_hi_256 = z27;
-    ZReg vreg_idx_lo_128 = z28;
-    ZReg vreg_idx_hi_128 = z29;
+    reg32_t regw_tmp = w14;
 
-    ZReg vmm_comp_mul = z30;
+    // z0..z3: source rows, z4..z7: interleave temporaries,
+    // z14..z29: per-column compensation accumulators.
+    ZReg get_src_vmm(int k) const { return ZReg(k); }
+    ZReg get_tmp_vmm(int i) const { return ZReg(4 + i); }
+    ZReg get_comp_acc(int i) const { return ZReg(29 - i); }
+    ZReg vmm_comp_res = z8;
+    ZReg vmm_comp_tmp = z9;
+    ZReg vmm_ones_bytes = z30;
     ZReg vmm_zero = z31;
 
-    ZReg get_comp_acc(int i) { return ZReg(comp_acc_idx_ - i); }
-    ZReg get_vmm_zp_comp_res(int i) { return get_comp_acc(i); }
-    ZReg get_vmm_oscale_comp_res(int i) { return ZReg(i); }
-
-    inline void vmovdqa64(ZReg vmm, const void *addr) {
-        assert(!"under construction");
-    }
-
-    inline ZReg get_vmm(int blk, int idx) {
-        if (idx < 0 || idx >= 32) assert(!"idx > vregs");
-        assert(IMPLICATION(!is_sve256_, idx < blk_sz_ && blk >= 0));
-        auto reg_idx = blk_sz_ * blk + idx;
-        return ZReg(reg_idx);
-    }
-    inline void load(int blk, int i, bool is_tail) {}
-    inline void kmovq(Xbyak_aarch64::PReg k, size_t q) {
-        assert(!"under construction");
-    }
-    virtual void init_permute() {}
-    virtual void copy_4x64(int nrows, int ncolumns) {}
-    inline void dot_product(ZReg v1, ZReg v2, ZReg v3) {
-        assert(!"under construction");
-    }
+    void copy_4x_n_block(int nrows, int ncolumns);
+    void compute_K_loop(int ncolumns);
+    void apply_and_store_compensation();
     void generate() override;
 };
 
-template <>
-inline void jit_brgemm_matmul_copy_b_int8_t<sve_512>::load(
-        int blk, int i, bool is_tail) {
-    assert(!"under construction");
+// Transforms up to 4 rows of plain K x N int8 data into the 4-row interleaved
+// (vnni) layout consumed by the SDOT/USDOT based brgemm kernel:
+// tr_src[n][k % 4] for n in [0, wei_n_blk). Rows beyond 'nrows' and columns
+// beyond 'ncolumns' are zero padded.
+void jit_brgemm_matmul_copy_b_int8_t::copy_4x_n_block(int nrows, int ncolumns) {
+    assert(nrows > 0 && nrows <= k_blk_step_);
+
+    const int cols_per_vec = simd_w_ / k_blk_step_;
+    const int columns_tail = ncolumns % simd_w_;
+    if (columns_tail > 0) set_preg(kTail.b, columns_tail, X_TMP_0, X_TMP_1);
+
+    for (int n = 0; n < conf_->wei_n_blk; n += simd_w_) {
+        const int vecs_to_store = nstl::min(k_blk_step_,
+                div_up(conf_->wei_n_blk - n, cols_per_vec));
+        const dim_t tr_src_off = n * k_blk_step_;
+        if (n >= ncolumns) {
+            for (int i = 0; i < vecs_to_store; i++) {
+                add_imm(X_DEFAULT_ADDR, reg_tr_src,
+                        tr_src_off + i * simd_w_, X_TMP_0);
+                str(vmm_zero, ptr(X_DEFAULT_ADDR));
+            }
+            continue;
+        }
+
+        const auto curr_msk
+                = ncolumns - n < simd_w_ ? kTail : P_ALL_ONE;
+        for (int k = 0; k < k_blk_step_; k++) {
+            if (k >= nrows) {
+                mov(get_src_vmm(k).d, vmm_zero.d);
+                continue;
+            }
+            add_imm(X_DEFAULT_ADDR, reg_src, k * src_stride_ + n, X_TMP_0);
+            ld1b(get_src_vmm(k).b, curr_msk / T_z, ptr(X_DEFAULT_ADDR));
+        }
+
+        // interleave bytes of rows (0, 1) and (2, 3), then interleave the
+        // resulting half-words to get 4 consecutive K values per column
+        zip1(get_tmp_vmm(0).b, get_src_vmm(0).b, get_src_vmm(1).b);
+        zip2(get_tmp_vmm(1).b, get_src_vmm(0).b, get_src_vmm(1).b);
+        zip1(get_tmp_vmm(2).b, get_src_vmm(2).b, get_src_vmm(3).b);
+        zip2(get_tmp_vmm(3).b, get_src_vmm(2).b, get_src_vmm(3).b);
+        zip1(get_src_vmm(0).h, get_tmp_vmm(0).h, get_tmp_vmm(2).h);
+        zip2(get_src_vmm(1).h, get_tmp_vmm(0).h, get_tmp_vmm(2).h);
+        zip1(get_src_vmm(2).h, get_tmp_vmm(1).h, get_tmp_vmm(3).h);
+        zip2(get_src_vmm(3).h, get_tmp_vmm(1).h, get_tmp_vmm(3).h);
+
+        for (int i = 0; i < vecs_to_store; i++) {
+            const auto vmm_out = get_src_vmm(i);
+            add_imm(X_DEFAULT_ADDR, reg_tr_src, tr_src_off + i * simd_w_,
+                    X_TMP_0);
+            str(vmm_out, ptr(X_DEFAULT_ADDR));
+            if (do_compute_compensation_) {
+                const int comp_idx = n / cols_per_vec + i;
+                sdot(get_comp_acc(comp_idx).s, vmm_out.b, vmm_ones_bytes.b);
+            }
+        }
+    }
 }
 
-template struct jit_brgemm_matmul_copy_b_int8_t<sve_512>;
-template struct jit_brgemm_matmul_copy_b_int8_t<sve_256>;
+void jit_brgemm_matmul_copy_b_int8_t::compute_K_loop(int ncolumns) {
+    Label K_loop, K_loop_tail_or_done, K_loop_done;
 
-struct jit_sve_512_core_brgemm_matmul_copy_b_int8_t
-    : public jit_brgemm_matmul_copy_b_int8_t<sve_512> {
+    L(K_loop);
+    cmp_imm(reg_K_iters, k_blk_step_, X_TMP_0);
+    b(LT, K_loop_tail_or_done);
 
-    jit_sve_512_core_brgemm_matmul_copy_b_int8_t(
-            const brgemm_matmul_conf_t *conf)
-        : jit_brgemm_matmul_copy_b_int8_t<sve_512>(conf) {}
+    copy_4x_n_block(k_blk_step_, ncolumns);
+    add_imm(reg_src, reg_src, k_blk_step_ * src_stride_, X_TMP_0);
+    add_imm(reg_tr_src, reg_tr_src, tr_src_stride_, X_TMP_0);
 
-private:
-    void init_permute() override { assert(!"under construction"); }
+    sub_imm(reg_K_iters, reg_K_iters, k_blk_step_, X_TMP_0);
+    b(K_loop);
 
-    void copy_4x64(int nrows, int ncolumns) override {
-        assert(!"under construction");
+    L(K_loop_tail_or_done);
+    // Only the last K block may have a tail which is not a multiple of
+    // k_blk_step_, so its size is known at kernel generation time.
+    const int k_blk_tail = conf_->K % k_blk_step_;
+    if (k_blk_tail > 0) {
+        cmp_imm(reg_K_iters, 0, X_TMP_0);
+        b(LE, K_loop_done);
+
+        copy_4x_n_block(k_blk_tail, ncolumns);
+        add_imm(reg_tr_src, reg_tr_src, tr_src_stride_, X_TMP_0);
     }
-};
+    L(K_loop_done);
+}
 
-struct jit_sve_256_core_brgemm_matmul_copy_b_int8_t
-    : public jit_brgemm_matmul_copy_b_int8_t<sve_256> {
+void jit_brgemm_matmul_copy_b_int8_t::apply_and_store_compensation() {
+    const bool req_s8s8_comp = conf_->s8s8_compensation_required;
+    const bool req_zp_comp = conf_->has_zero_point_a;
+    assert(IMPLICATION(req_zp_comp,
+            conf_->src_zp_type == brgemm_broadcast_t::per_tensor));
+
+    if (req_s8s8_comp) LDR_IMM(reg_comp_ptr, param1, GET_OFF(compensation_ptr));
+    if (req_zp_comp)
+        LDR_IMM(reg_zp_comp_ptr, param1, GET_OFF(zp_a_compensation_ptr));
+    LDR_IMM(reg_K_start, param1, GET_OFF(current_K_start));
+
+    // Partial sums are accumulated in memory across K blocks, the final
+    // scaling is applied once the last K block has been copied.
+    auto process = [&](const reg64_t &reg_ptr, bool is_s8s8) {
+        if (is_s8s8) {
+            // s8s8 compensation is -128 * sum_k(B)
+            mov_imm(regw_tmp, -128);
+        } else {
+            LDR_IMM(reg_zp_a_neg_val_ptr, param1, GET_OFF(zp_a_neg_value_ptr));
+            ldr(regw_tmp, ptr(reg_zp_a_neg_val_ptr));
+        }
+        for (int i = 0; i < n_comp_vecs_; i++) {
+            Label skip_acc, store;
+            add_imm(X_DEFAULT_ADDR, reg_ptr, i * simd_w_, X_TMP_0);
+            mov(vmm_comp_res.d, get_comp_acc(i).d);
+
+            cmp_imm(reg_K_start, 0, X_TMP_0);
+            b(EQ, skip_acc);
+            ld1w(vmm_comp_tmp.s, P_ALL_ONE / T_z, ptr(X_DEFAULT_ADDR));
+            add(vmm_comp_res.s, vmm_comp_res.s, vmm_comp_tmp.s);
+
+            L(skip_acc);
+            cmp_imm(reg_K_start, rnd_up(conf_->K, conf_->K_blk) - conf_->K_blk,
+                    X_TMP_0);
+            b(LT, store);
+            dup(vmm_comp_tmp.s, regw_tmp);
+            mul(vmm_comp_res.s, P_ALL_ONE / T_m, vmm_comp_tmp.s);
+
+            L(store);
+            st1w(vmm_comp_res.s, P_ALL_ONE, ptr(X_DEFAULT_ADDR));
+        }
+    };
 
-    jit_sve_256_core_brgemm_matmul_copy_b_int8_t(
-            const brgemm_matmul_conf_t *conf)
-        : jit_brgemm_matmul_copy_b_int8_t<sve_256>(conf) {}
+    if (req_s8s8_comp) process(reg_comp_ptr, true);
+    if (req_zp_comp) process(reg_zp_comp_ptr, false);
+}
 
-private:
-    static constexpr int perm2i128_l
-            = 0x20; // dst[127:0]=src1_low_128; dst[128:255]=src2_low_128
-    static constexpr int perm2i128_h
-            = 0x31; // dst[127:0]=src1_hi_128; dst[128:255]=src2_hi_128
+void jit_brgemm_matmul_copy_b_int8_t::generate() {
+    preamble();
 
-    Xbyak_aarch64::ZReg get_ymm(int idx) { return get_vmm(0, idx); }
+    eor(vmm_zero.d, vmm_zero.d, vmm_zero.d);
+    LDR_IMM(reg_src, param1, GET_OFF(src));
+    LDR_IMM(reg_tr_src, param1, GET_OFF(tr_src));
+    LDR_IMM(reg_K_iters, param1, GET_OFF(current_K_iters));
+    LDR_IMM(reg_N_blk, param1, GET_OFF(current_N_blk));
 
-    void load_ymm(int ymm_idx, size_t offset, bool is_tail, size_t tail_sz) {
-        assert(!"under construction");
+    if (do_compute_compensation_) {
+        for (int i = 0; i < n_comp_vecs_; i++)
+            eor(get_comp_acc(i).d, get_comp_acc(i).d, get_comp_acc(i).d);
+        dup(vmm_ones_bytes.b, 1);
     }
 
-    void copy_4x64(int nrows, int ncolumns) override {
-        assert(!"under construction");
+    Label done;
+    if (conf_->N_tail > 0) {
+        Label not_N_tail;
+        cmp_imm(reg_N_blk, conf_->N_tail, X_TMP_0);
+        b(NE, not_N_tail);
+        compute_K_loop(conf_->N_tail);
+        b(done);
+
+        L(not_N_tail);
     }
-};
+    compute_K_loop(conf_->N_blk);
+    L(done);
+
+    if (do_compute_compensation_) apply_and_store_compensation();
 
-template <cpu_isa_t isa>
-void jit_brgemm_matmul_copy_b_int8_t<isa>::generate() {
-    preamble();
-    assert(!"under construction");
     postamble();
 }
 
@@ -507,13 +601,36 @@ struct jit_brgemm_matmul_copy_b_f32_t : public jit_brgemm_matmul_copy_b_t,
 
     jit_brgemm_matmul_copy_b_f32_t(const brgemm_matmul_conf_t *conf)
         : jit_brgemm_matmul_copy_b_t(conf)
-        , dt_in_(data_type::f32)
+        , dt_in_(utils::one_of(conf->orig_wei_dt, data_type::f16,
+                         data_type::f8_e5m2, data_type::f8_e4m3,
+                         data_type::s8, data_type::u8, data_type::s4,
+                         data_type::u4)
+                          ? conf->orig_wei_dt
+                          : data_type::f32)
         , typesize_in_(types::data_type_size(dt_in_))
-        , src_stride_(conf_->wei_tag == acbd ? conf_->copy_B_wei_stride
-                                             : conf_->N * typesize_in_)
+        , is_wei_int_(utils::one_of(dt_in_, data_type::s8, data_type::u8,
+                  data_type::s4, data_type::u4))
+        , is_wei_int4_(utils::one_of(dt_in_, data_type::s4, data_type::u4))
+        , is_wei_fp8_(utils::one_of(
+                  dt_in_, data_type::f8_e5m2, data_type::f8_e4m3))
+        , typesize_out_(conf->tr_b_dt_sz)
+        , req_zp_(conf_->with_wei_decompression
+                  && conf_->wei_zp_type != brgemm_broadcast_t::none)
+        , req_scales_(conf_->apply_scales_in_buffer_b)
+        , src_stride_(conf_->wei_tag == acbd
+                          ? conf_->copy_B_wei_stride
+                          : (is_wei_int4_ ? conf_->N / 2
+                                          : conf_->N * typesize_in_))
         , tr_src_stride_(conf_->LDB * typesize_out_) {
         MAYBE_UNUSED(src_stride_);
         MAYBE_UNUSED(tr_src_stride_);
+        if (is_wei_fp8_)
+            for (int i = 0; i < 256; i++) {
+                const uint8_t b = static_cast<uint8_t>(i);
+                table_[i] = dt_in_ == data_type::f8_e5m2
+                        ? static_cast<float>(float8_e5m2_t(b, true))
+                        : static_cast<float>(float8_e4m3_t(b, true));
+            }
     }
 
     void operator()(ctx_t *ctx) override { jit_generator_t::operator()(ctx); }
@@ -527,17 +644,31 @@ private:
     using opmask_t = const Xbyak_aarch64::PReg;
     using zmm = const Xbyak_aarch64::ZReg;
 
-    enum { n_blk_step = 8, max_regs_available = 30 };
+    enum { n_blk_step = 8, max_regs_available = 27 };
     const data_type_t dt_in_;
     const size_t typesize_in_;
-    const size_t typesize_out_ = sizeof(float);
+    const bool is_wei_int_;
+    const bool is_wei_int4_;
+    const bool is_wei_fp8_;
+    // f16 weights are copied as is for f16 accumulation
+    const size_t typesize_out_;
+    const bool req_zp_;
+    const bool req_scales_;
     dim_t src_stride_, tr_src_stride_;
+    // Values of the fp8 weights indexed by their bits
+    float table_[256];
 
     opmask_t kTail = p7;
     opmask_t kFFFF = p6;
+    opmask_t kHalf = p5;
+    opmask_t kHalfTail = p4;
+    opmask_t kBlkTail = p3;
 
     reg64_t reg_src = x1;
     reg64_t reg_tr_src = x2;
+    reg64_t reg_zp_ptr = x3;
+    reg64_t reg_scales_ptr = x4;
+    reg64_t reg_table = x5;
 
     reg64_t reg_K_iters = x8;
     reg64_t reg_N_blk = x9;
@@ -545,18 +676,105 @@ private:
     reg32_t regw_tmp = w14;
     reg64_t imm_addr64 = x15;
 
+    zmm zmm_tmp = z27;
+    zmm zmm_zp = z28;
+    zmm zmm_scales = z29;
     zmm zmm_permw = z30;
     zmm zmm_zero = z31;
 
+    void load_int_weights(int blk, opmask_t mask, bool is_tail);
+    void load_zp(opmask_t mask, bool bcast);
+    void load_scales(opmask_t mask, bool bcast);
     void copy_16_8_x_n_block(int nrows, int ncolumns);
     void compute_k_loop(int ncolumns);
     void generate() override;
 };
 
+// Loads int weights from X_DEFAULT_ADDR as s32 lanes, int4 values are
+// unpacked from the lower half of a byte load (low nibble goes first)
+void jit_brgemm_matmul_copy_b_f32_t::load_int_weights(
+        int blk, opmask_t mask, bool is_tail) {
+    const auto src = ZRegS(blk);
+    switch (dt_in_) {
+        case data_type::s8: ld1sb(src, mask / T_z, ptr(X_DEFAULT_ADDR)); break;
+        case data_type::u8: ld1b(src, mask / T_z, ptr(X_DEFAULT_ADDR)); break;
+        case data_type::s4:
+        case data_type::u4: {
+            const bool is_signed = dt_in_ == data_type::s4;
+            const auto tmp = zmm_tmp.s;
+            ld1b(src, (is_tail ? kHalfTail : kHalf) / T_z,
+                    ptr(X_DEFAULT_ADDR));
+            if (is_signed) {
+                lsl(tmp, src, 24);
+                asr(tmp, tmp, 28);
+            } else {
+                lsr(tmp, src, 4);
+            }
+            lsl(src, src, 28);
+            if (is_signed)
+                asr(src, src, 28);
+            else
+                lsr(src, src, 28);
+            zip1(src, src, tmp);
+            break;
+        }
+        default: assert(!"unsupported data type");
+    }
+}
+
+void jit_brgemm_matmul_copy_b_f32_t::load_zp(opmask_t mask, bool bcast) {
+    const auto zp = zmm_zp.s;
+    switch (conf_->wei_zp_dt) {
+        case data_type::s32:
+            if (bcast)
+                ld1rw(zp, mask / T_z, ptr(X_DEFAULT_ADDR));
+            else
+                ld1w(zp, mask / T_z, ptr(X_DEFAULT_ADDR));
+            break;
+        case data_type::s8:
+            if (bcast)
+                ld1rsb(zp, mask / T_z, ptr(X_DEFAULT_ADDR));
+            else
+                ld1sb(zp, mask / T_z, ptr(X_DEFAULT_ADDR));
+            break;
+        case data_type::u8:
+            if (bcast)
+                ld1rb(zp, mask / T_z, ptr(X_DEFAULT_ADDR));
+            else
+                ld1b(zp, mask / T_z, ptr(X_DEFAULT_ADDR));
+            break;
+        default: assert(!"unsupported zero-point data type");
+    }
+}
+
+void jit_brgemm_matmul_copy_b_f32_t::load_scales(opmask_t mask, bool bcast) {
+    const auto scales = zmm_scales.s;
+    switch (conf_->wei_scales_dt) {
+        case data_type::f32:
+            if (bcast)
+                ld1rw(scales, mask / T_z, ptr(X_DEFAULT_ADDR));
+            else
+                ld1w(scales, mask / T_z, ptr(X_DEFAULT_ADDR));
+            break;
+        case data_type::bf16:
+        case data_type::f16:
+            if (bcast)
+                ld1rh(scales, mask / T_z, ptr(X_DEFAULT_ADDR));
+            else
+                ld1h(scales, mask / T_z, ptr(X_DEFAULT_ADDR));
+            if (conf_->wei_scales_dt == data_type::bf16)
+                lsl(scales, scales, 16);
+            else
+                fcvt(scales, P_ALL_ONE / T_m, zmm_scales.h);
+            break;
+        default: assert(!"unsupported scales data type");
+    }
+}
+
 void jit_brgemm_matmul_copy_b_f32_t::copy_16_8_x_n_block(
         int nrows, int ncolumns) {
 
-    int n_blk_step = get_sve_length() / typesize_in_;
+    int n_blk_step = get_sve_length() / typesize_out_;
 
     auto get_zmm = [](int reg_idx) {
         assert(reg_idx >= 0 && reg_idx < max_regs_available);
@@ -565,34 +783,86 @@ void jit_brgemm_matmul_copy_b_f32_t::copy_16_8_x_n_block(
 
     auto load = [this, get_zmm](int blk, int k, int n, opmask_t current_mask) {
         auto src_zmm = get_zmm(blk);
-        add_imm(X_DEFAULT_ADDR, reg_src, k * src_stride_ + n * typesize_in_,
-                X_TMP_0);
-        ld1w(src_zmm, current_mask / T_z, ptr(X_DEFAULT_ADDR));
+        const dim_t n_off = is_wei_int4_ ? n / 2 : n * typesize_in_;
+        add_imm(X_DEFAULT_ADDR, reg_src, k * src_stride_ + n_off, X_TMP_0);
+        if (is_wei_int_) {
+            // Dequantize as (w - zp) * scale so that brgemm computes in f32
+            const bool is_tail = current_mask.getIdx() == kTail.getIdx();
+            load_int_weights(blk, current_mask, is_tail);
+            if (req_zp_) {
+                if (conf_->is_wei_zp_per_n) {
+                    add_imm(X_DEFAULT_ADDR, reg_zp_ptr,
+                            n * types::data_type_size(conf_->wei_zp_dt),
+                            X_TMP_0);
+                    load_zp(current_mask, false);
+                }
+                sub(src_zmm, src_zmm, zmm_zp.s);
+            }
+            scvtf(src_zmm, P_ALL_ONE / T_m, src_zmm);
+            if (req_scales_) {
+                if (conf_->is_wei_scale_per_n) {
+                    add_imm(X_DEFAULT_ADDR, reg_scales_ptr,
+                            n * types::data_type_size(conf_->wei_scales_dt),
+                            X_TMP_0);
+                    load_scales(current_mask, false);
+                }
+                fmul(src_zmm, src_zmm, zmm_scales.s);
+            }
+            if (is_tail) sel(src_zmm, kTail, src_zmm, zmm_zero.s);
+        } else if (dt_in_ == data_type::f16 && typesize_out_ == 2) {
+            ld1h(ZRegH(blk), current_mask / T_z, ptr(X_DEFAULT_ADDR));
+        } else if (dt_in_ == data_type::f16) {
+            // f16 weights are up-converted so that brgemm computes in f32
+            ld1h(src_zmm, current_mask / T_z, ptr(X_DEFAULT_ADDR));
+            fcvt(src_zmm, P_ALL_ONE / T_m, ZRegH(blk));
+        } else if (is_wei_fp8_) {
+            // fp8 weights are decoded by a lookup of their bits, the masked
+            // off lanes look up the zero at index 0
+            ld1b(src_zmm, current_mask / T_z, ptr(X_DEFAULT_ADDR));
+            ld1w(src_zmm, current_mask / T_z,
+                    ptr(reg_table, src_zmm, UXTW, 2));
+        } else
+            ld1w(src_zmm, current_mask / T_z, ptr(X_DEFAULT_ADDR));
     };
 
     const int columns_tail = ncolumns % n_blk_step;
-
-    if (columns_tail < n_blk_step)
+    // A vector of f16 may be wider than the block, e.g. 32 f16 values of a
+    // block of 48
+    const int blk_tail = conf_->wei_n_blk % n_blk_step;
+
+    if (typesize_out_ == 2) {
+        set_preg(kTail.h, columns_tail, X_TMP_0, X_TMP_1);
+        if (blk_tail) set_preg(kBlkTail.h, blk_tail, X_TMP_0, X_TMP_1);
+    } else if (columns_tail < n_blk_step)
         set_preg(kTail.s, columns_tail, X_TMP_0, X_TMP_1);
+    if (is_wei_int4_) {
+        // N is even for int4 weights, so a tail takes a whole number of bytes
+        set_preg(kHalf.s, n_blk_step / 2, X_TMP_0, X_TMP_1);
+        set_preg(kHalfTail.s, columns_tail / 2, X_TMP_0, X_TMP_1);
+    }
 
     int iter = 0;
     for_(int k = 0; k < nrows; k++) //nrows = unroll
     for (int n = 0; n < conf_->wei_n_blk; n += n_blk_step) {
 
         const dim_t tr_src_off = k * tr_src_stride_ + n * typesize_out_;
+        auto store = [&](const ZReg &z) {
+            add_imm(X_DEFAULT_ADDR, reg_tr_src, tr_src_off, X_TMP_0);
+            if (blk_tail != 0 && conf_->wei_n_blk - n < n_blk_step)
+                st1h(ZRegH(z.getIdx()), kBlkTail, ptr(X_DEFAULT_ADDR));
+            else
+                str(z, ptr(X_DEFAULT_ADDR));
+        };
         const int zero_padding = ncolumns - n;
         if (zero_padding <= 0) {
-            add_imm(X_DEFAULT_ADDR, reg_tr_src, tr_src_off, X_TMP_0);
-            str(zmm_zero, ptr(X_DEFAULT_ADDR));
+            store(zmm_zero);
             continue;
         }
 
         const opmask_t curr_msk = zero_padding < n_blk_step ? kTail : P_ALL_ONE;
         const int blk_idx = iter % max_regs_available;
         load(blk_idx, k, n, curr_msk);
-        add_imm(X_DEFAULT_ADDR, reg_tr_src, tr_src_off, X_TMP_0);
-        const auto src_zmm0 = ZReg(blk_idx);
-        str(src_zmm0, ptr(X_DEFAULT_ADDR));
+        store(ZReg(blk_idx));
         iter++;
     }
 }
@@ -616,7 +886,11 @@ void jit_brgemm_matmul_copy_b_f32_t::compute_k_loop(int ncolumns) {
         L(K_end_label);
     };
 
-    int k_unroll = get_sve_length() / typesize_in_;
+    // Dequantization of int weights and decoding of fp8 ones take several
+    // instructions per vector, keep unrolling moderate to limit the kernel size
+    int k_unroll = (is_wei_int_ || is_wei_fp8_)
+            ? 8
+            : get_sve_length() / typesize_in_;
     compute_uni_k_loop(k_unroll);
     compute_uni_k_loop(1);
 }
@@ -630,6 +904,22 @@ void jit_brgemm_matmul_copy_b_f32_t::generate() {
     LDR_IMM(reg_K_iters, param1, GET_OFF(current_K_iters));
     LDR_IMM(reg_N_blk, param1, GET_OFF(current_N_blk));
     ptrue(kFFFF.s);
+    if (is_wei_fp8_) mov_imm(reg_table, reinterpret_cast<size_t>(table_));
+
+    if (req_zp_) {
+        LDR_IMM(reg_zp_ptr, param1, GET_OFF(zp_b_value_ptr));
+        if (!conf_->is_wei_zp_per_n) {
+            mov(X_DEFAULT_ADDR, reg_zp_ptr);
+            load_zp(P_ALL_ONE, true);
+        }
+    }
+    if (req_scales_) {
+        LDR_IMM(reg_scales_ptr, param1, GET_OFF(scales_ptr));
+        if (!conf_->is_wei_scale_per_n) {
+            mov(X_DEFAULT_ADDR, reg_scales_ptr);
+            load_scales(P_ALL_ONE, true);
+        }
+    }
 
     Label done;
     if (conf_->N_tail > 0) {
@@ -1100,9 +1390,26 @@ status_t create_brgemm_matmul_copy_b(
             = everyone_is(data_type::bf16, conf->src_dt, conf->wei_dt);
     const bool is_f32 = everyone_is(data_type::f32, conf->src_dt, conf->wei_dt);
 
-    const bool is_f16 = everyone_is(data_type::f16, conf->src_dt, conf->wei_dt);
-    assert(is_f32);
-    assert(!(is_bf16 || is_f16));
+    // f16 weights are up-converted to f32 by the copy routine
+    const bool is_f16 = conf->src_dt == data_type::f16
+            && conf->orig_wei_dt == data_type::f16
+            && conf->wei_dt == data_type::f32;
+    // fp8 weights are decoded to f32 by the copy routine, while src is
+    // converted to f32 beforehand, so is_f32 is true in that case
+    const bool is_fp8 = one_of(
+            conf->orig_wei_dt, data_type::f8_e5m2, data_type::f8_e4m3);
+    const bool is_int8 = one_of(conf->src_dt, data_type::u8, data_type::s8)
+            && conf->wei_dt == data_type::s8;
+    // int weights are dequantized to f32 by the copy routine as well, note
+    // is_f32 is true in that case as wei_dt is overridden to f32
+    const bool is_f32_with_int_wei = conf->is_f32_with_int_wei;
+    assert(is_f32 || is_f16 || is_int8);
+    assert(!is_bf16);
+    assert(IMPLICATION(is_f32_with_int_wei, is_f32 && !is_B_transposed));
+    assert(IMPLICATION(is_fp8, is_f32 && !is_B_transposed));
+    MAYBE_UNUSED(is_f32_with_int_wei);
+    MAYBE_UNUSED(is_fp8);
+    MAYBE_UNUSED(is_int8);
 
     if (is_B_transposed) {
         if (is_superset(conf->isa, sve_512))
@@ -1114,22 +1421,14 @@ status_t create_brgemm_matmul_copy_b(
                     new jit_brgemm_matmul_copy_b_transposed_t<sve_256>(conf)));
         }
     } else {
-        if (is_bf16 || is_f16 || conf->is_bf32) {
+        if (is_bf16 || conf->is_bf32) {
             assert(!"unreacable");
-        } else if (is_f32) {
+        } else if (is_f32 || is_f16) {
             CHECK(safe_ptr_assign(
                     copy_ker, new jit_brgemm_matmul_copy_b_f32_t(conf)));
         } else {
-            if (is_superset(conf->isa, sve_512))
-                CHECK(safe_ptr_assign(copy_ker,
-                        new jit_sve_512_core_brgemm_matmul_copy_b_int8_t(
-                                conf)));
-            else {
-                assert(is_superset(conf->isa, sve_256));
-                CHECK(safe_ptr_assign(copy_ker,
-                        new jit_sve_256_core_brgemm_matmul_copy_b_int8_t(
-                                conf)));
-            }
+            CHECK(safe_ptr_assign(
+                    copy_ker, new jit_brgemm_matmul_copy_b_int8_t(conf)));
         }
     }
 
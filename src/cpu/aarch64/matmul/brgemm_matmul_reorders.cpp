@@ -44,12 +44,9 @@ status_t brgemm_matmul_copy_reorder_t::pd_t::init(
             && utils::one_of(type_o, data_type::s8, data_type::bf16,
                     data_type::f16, data_type::f32);
     const bool is_f16 = utils::one_of(data_type::f16, type_i, type_o);
-    const bool is_s8s8 = type_i == data_type::s8 && type_o == data_type::s8;
     const bool has_adj_scale
             = od.extra().flags & memory_extra_flags::scale_adjust;
-    UNUSED(is_f16);
-    UNUSED(is_s8s8);
-    assert(!(is_f16 || is_s8s8));
+    if (is_f16) return status::unimplemented;
     const bool args_ok = true && dt_ok && id.is_dense()
             && utils::one_of(ndims, 2, 3) && !has_adj_scale
             && attr()->has_default_values() && od.is_blocking_desc()
@@ -16,16 +16,26 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_debug.h"
+
 #include "cpu/aarch64/matmul/brgemm_matmul_utils.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
+#include "cpu/aarch64/cpu_calibration.hpp"
 #include "cpu/aarch64/cpu_isa_traits.hpp"
 #include "cpu/aarch64/injectors/jit_uni_postops_injector.hpp"
 
 #include "cpu/binary_injector_utils.hpp"
 #include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/tuning_db.hpp"
 
 // TODO add a method to print brgemm conf info
 #define VCONDCHECK_BG(cond, msg, ...) \
@@ -148,7 +158,14 @@ bool post_ops_ok(brgemm_matmul_conf_t &bgmmc, const primitive_attr_t &attr,
 }
 
 status_t check_datatype(const brgemm_matmul_conf_utils_t &bm_conf_utils) {
-    if (one_of(true, bm_conf_utils.is_f32(), bm_conf_utils.is_bf16()))
+    if (one_of(true, bm_conf_utils.is_f32(), bm_conf_utils.is_bf16(),
+                bm_conf_utils.is_f16(), bm_conf_utils.is_fp8(),
+                bm_conf_utils.is_f32_with_int_wei()))
+        return status::success;
+    // int8 is computed with SDOT for s8s8 and with USDOT/SUDOT for u8s8,
+    // the latter being part of FEAT_I8MM.
+    if (bm_conf_utils.is_int8()
+            && IMPLICATION(bm_conf_utils.get_src_dt() == u8, mayiuse_i8mm()))
         return status::success;
     return status::unimplemented;
 }
@@ -163,9 +180,19 @@ brgemm_matmul_conf_utils_t::brgemm_matmul_conf_utils_t(
               && one_of(bgmmc.dst_dt, bf16, f32))
     , f16_dt(utils::everyone_is(f16, bgmmc.src_dt, bgmmc.wei_dt)
               && one_of(bgmmc.dst_dt, f16, f32))
+    , fp8_dt(one_of(bgmmc.src_dt, f8_e5m2, f8_e4m3)
+              && one_of(bgmmc.wei_dt, f8_e5m2, f8_e4m3)
+              && one_of(bgmmc.dst_dt, f32, bf16, f16, f8_e5m2, f8_e4m3))
     , int8_dt(utils::one_of(bgmmc.src_dt, u8, s8) && bgmmc.wei_dt == s8
               && one_of(bgmmc.dst_dt, u8, s8, s32, f32, bf16))
-    , bf32_dt(false)
+    , bf32_dt(utils::everyone_is(f32, bgmmc.orig_src_dt, bgmmc.orig_wei_dt)
+              && bf16_dt)
+    , weights_decompression_support(one_of(bgmmc.wei_dt, u8, s8, u4, s4)
+              && one_of(attr.fpmath_.mode_, fpmath_mode::strict,
+                      fpmath_mode::any)
+              && attr.fpmath_.apply_to_int_)
+    , f32_with_int_wei_dt(weights_decompression_support
+              && everyone_is(f32, bgmmc.src_dt, bgmmc.dst_dt))
     , A_any_layout(A_any_layout)
     , B_any_layout(B_any_layout)
     , C_any_layout(C_any_layout)
@@ -185,12 +212,36 @@ brgemm_matmul_conf_utils_t::brgemm_matmul_conf_utils_t(
               blocked_32n_B_layout_tag, blocked_16n_B_layout_tag))
     , n_blk_fixed((!B_any_layout) && blocked_B_layouts_allowed)
     , isa_(isa) {
-    assert(int8_dt || bf16_dt || f16_dt || f32_dt || bf32_dt);
+    assert(int8_dt || bf16_dt || f16_dt || fp8_dt || f32_dt || bf32_dt
+            || f32_with_int_wei_dt);
 }
 
 status_t brgemm_matmul_conf_utils_t::set_or_check_B_tag(
         memory_desc_t &B_md, bool init_n_tag) const {
     using namespace data_type;
+    if (this->is_f16() || this->is_fp8() || this->is_f32_with_int_wei()) {
+        // f16, fp8 and decompressed int weights always go through copy_B,
+        // which supports plain layout only for them
+        if (B_any_layout) {
+            bgmmc.wei_tag = plain_tensor_layout_tag;
+            VCHECK_BG(memory_desc_init_by_tag(B_md, bgmmc.wei_tag),
+                    VERBOSE_UNSUPPORTED_TAG);
+            const int dmax = nstl::min(bgmmc.ndims, 3);
+            const memory_desc_wrapper B_d(&B_md);
+            for (int d = 0; d < dmax; d++) {
+                int dim = bgmmc.ndims - 1 - d;
+                bgmmc.B_strides[d]
+                        = bgmmc.b_dt_sz * B_d.blocking_desc().strides[dim];
+            }
+        } else {
+            bgmmc.wei_tag = memory_desc_matches_one_of_tag(
+                    B_md, plain_tensor_layout_tag);
+            if (bgmmc.wei_tag == format_tag::undef)
+                return status::unimplemented;
+        }
+        return status::success;
+    }
+
     if (B_any_layout) {
         const int default_n_block = init_n_tag
                 ? get_default_n_block(format_tag::undef, bgmmc)
@@ -203,6 +254,7 @@ status_t brgemm_matmul_conf_utils_t::set_or_check_B_tag(
                 break;
 
             case bf16:
+            case s8:
                 if (!blocked_B_layouts_allowed) return status::unimplemented;
                 bgmmc.wei_tag = this->pick_blocked_B_layout(default_n_block);
                 break;
@@ -262,6 +314,20 @@ status_t brgemm_matmul_conf_utils_t::set_or_check_B_tag(
                         blocked_32n_B_layout_tag, blocked_16n_B_layout_tag);
                 break;
 
+            case s8:
+                // Plain B is copied into the blocked layout by copy_B, the
+                // transposed copy routine does not support int8 yet.
+                bgmmc.wei_tag = blocked_B_layouts_allowed
+                        ? memory_desc_matches_one_of_tag(B_md,
+                                  plain_tensor_layout_tag,
+                                  blocked_64n_B_layout_tag,
+                                  blocked_48n_B_layout_tag,
+                                  blocked_32n_B_layout_tag,
+                                  blocked_16n_B_layout_tag)
+                        : memory_desc_matches_one_of_tag(
+                                  B_md, plain_tensor_layout_tag);
+                break;
+
             default: return status::unimplemented;
         }
 
@@ -292,7 +358,7 @@ status_t brgemm_matmul_conf_utils_t::set_or_check_tags(memory_desc_t &A_md,
     } else {
         const bool can_treat_transposed_A_as_plain = bgmmc.M == 1;
         bgmmc.src_tag = (this->is_bf16() || this->is_f32() || this->is_bf32()
-                                || this->is_f16())
+                                || this->is_f16() || this->is_fp8())
                 ? memory_desc_matches_one_of_tag(A_md, plain_tensor_layout_tag,
                           transposed_tensor_layout_tag, acbd, adbc)
                 // Enable support of int8 problems with formally transposed A
@@ -379,7 +445,8 @@ format_tag_t brgemm_matmul_conf_utils_t::pick_blocked_B_layout(
         }
 
     // Note: bf32 assumes f32 blocking
-    if (this->is_f32() || this->is_bf32() || this->is_f16()) switch (n_blk) {
+    if (this->is_f32() || this->is_bf32() || this->is_f16() || this->is_fp8())
+        switch (n_blk) {
             case 64: return bgmmc.ndims == 3 ? aCB16b64c : BA16a64b;
             case 48: return bgmmc.ndims == 3 ? aCB16b48c : BA16a48b;
             case 32: return bgmmc.ndims == 3 ? aCB16b32c : BA16a32b;
@@ -538,12 +605,59 @@ struct matmul_brgemm_blocking_params_t {
 
         bgmmc.use_buffer_c = is_buffer_c_required(
                 bgmmc.acc_dt, bgmmc.dst_dt, bgmmc.with_sum);
-        bgmmc.LDA = (bgmmc.src_tag == acbd && !bgmmc.use_buffer_a
-                        ? bgmmc.A_strides[1] / bgmmc.a_dt_sz
-                        : get_actual_lda(bgmmc.use_buffer_a, bgmmc.tr_a_dt_sz));
+        bgmmc.LDA = bgmmc.read_A_transposed
+                ? bgmmc.A_strides[0] / bgmmc.a_dt_sz
+                : (bgmmc.src_tag == acbd && !bgmmc.use_buffer_a
+                                ? bgmmc.A_strides[1] / bgmmc.a_dt_sz
+                                : get_actual_lda(bgmmc.use_buffer_a,
+                                        bgmmc.tr_a_dt_sz));
     }
 };
 
+// The partial results of the K ranges are only reduced for 2d problems
+// computed by the row major kernels without compensations. The reduction is
+// extra work per call, which a throughput goal does not trade for parallelism.
+bool k_reduction_can_be_split(const brgemm_matmul_conf_t &bgmmc,
+        const matmul_brgemm_blocking_params_t::matmul_params_t &matmul) {
+    if (bgmmc.dispatch_goal == dispatch_goal::throughput) return false;
+    const bool is_col_major_gemv = matmul.M == 1 && bgmmc.wei_tag == ba;
+    const bool has_compensation = bgmmc.s8s8_compensation_required
+            || bgmmc.src_zp_type != brgemm_broadcast_t::none
+            || (bgmmc.wei_zp_type != brgemm_broadcast_t::none
+                    && !bgmmc.with_wei_decompression);
+    return matmul.batch == 1 && !is_col_major_gemv && !has_compensation;
+}
+
+// Returns the number of threads to split K over for problems with a long K
+// and too few M and N blocks, with `min_m_blk` the smallest M block of the
+// heuristic. At most half of the threads have M and N blocks for a split, as
+// the reduction of the partial results then costs less than the threads it
+// leaves idle. A latency goal splits shorter K as soon as a thread is idle.
+int get_tall_k_nthr_k(const brgemm_matmul_conf_t &bgmmc,
+        const matmul_brgemm_blocking_params_t::matmul_params_t &matmul,
+        int min_m_blk, int n_blk, int k_blk) {
+    const bool is_latency = bgmmc.dispatch_goal == dispatch_goal::latency;
+    const int min_K = is_latency ? 256 : 1024;
+    if (!k_reduction_can_be_split(bgmmc, matmul) || matmul.K < min_K)
+        return 1;
+    const int mn_work = div_up(matmul.M, min_m_blk) * div_up(matmul.N, n_blk);
+    if ((is_latency ? 1 : 2) * mn_work > bgmmc.nthr) return 1;
+    return nstl::min(bgmmc.nthr / mn_work, (int)div_up(matmul.K, k_blk));
+}
+
+// Returns `k_blk` reduced so that the block of B a thread reuses across its
+// M blocks takes at most half of the L2 share of a core.
+int limit_k_blk_to_l2(
+        const brgemm_matmul_conf_t &bgmmc, int k_blk, int n_blk) {
+    // shorter K blocks make the kernel calls too short
+    const int min_k_blk = 64;
+    const size_t b_row_size = static_cast<size_t>(n_blk) * bgmmc.tr_b_dt_sz;
+    const int l2_k_blk = static_cast<int>(
+            platform::get_per_core_cache_size(2) / 2 / b_row_size);
+    return nstl::max(nstl::min(k_blk, rnd_dn(l2_k_blk, min_k_blk)),
+            nstl::min(k_blk, min_k_blk));
+}
+
 float compute_blocking_heuristic_sve_512(brgemm_matmul_conf_t &bgmmc,
         const brgemm_matmul_conf_utils_t &bm_conf_utils,
         const matmul_brgemm_blocking_params_t::matmul_params_t &matmul,
@@ -563,7 +677,8 @@ float compute_blocking_heuristic_sve_512(brgemm_matmul_conf_t &bgmmc,
     const bool use_extended_k_blk = matmul.K > 1024
             && (!bm_conf_utils.check_is_transposed(bgmmc.src_tag));
     int default_k_blk = use_extended_k_blk ? 1024 : 512;
-    int k_blk = nstl::min(matmul.K, default_k_blk);
+    int k_blk = limit_k_blk_to_l2(
+            bgmmc, nstl::min(matmul.K, default_k_blk), n_blk);
     int start_nthr_k = 1;
 
     // for cases with low parallel work, reduce 'min_m_blk' to
@@ -599,15 +714,19 @@ float compute_blocking_heuristic_sve_512(brgemm_matmul_conf_t &bgmmc,
 
         // Parallelize across K for shapes with big 'K' dimension
         bool bwd_w_par_k_blk = bgmmc.batch == 1
+                && bgmmc.dispatch_goal != dispatch_goal::throughput
                 && bm_conf_utils.check_is_transposed(bgmmc.src_tag)
                 && IMPLICATION(bm_conf_utils.is_bf16(), math::is_pow2(matmul.K))
                 && matmul.K >= 2048;
         if (bwd_w_par_k_blk) {
             start_nthr_k = nstl::min(nthr, 4);
-            assert(k_blk == nstl::min(matmul.K, 512));
+            assert(k_blk <= nstl::min(matmul.K, 512));
         }
     }
 
+    start_nthr_k = nstl::max(start_nthr_k,
+            get_tall_k_nthr_k(bgmmc, matmul, min_m_blk, n_blk, k_blk));
+
     float best_imbalance = 1.f; // reduce
     for_(int nthr_k = start_nthr_k; nthr_k >= 1; --nthr_k)
     for_(int n_chunk_size = n_chunks_start; n_chunk_size >= 1; --n_chunk_size)
@@ -626,6 +745,52 @@ float compute_blocking_heuristic_sve_512(brgemm_matmul_conf_t &bgmmc,
     return best_imbalance;
 }
 
+float compute_blocking_heuristic_sme(brgemm_matmul_conf_t &bgmmc,
+        const brgemm_matmul_conf_utils_t &bm_conf_utils,
+        const matmul_brgemm_blocking_params_t::matmul_params_t &matmul,
+        matmul_brgemm_blocking_params_t &best_blocking) {
+
+    const int nthr = bgmmc.nthr;
+
+    // SME kernel holds up to 'tile_elems' rows of A in a ZA tile and reads
+    // A rows in chunks of 'tile_elems' 32-bit words, each holding 'vnni'
+    // elements along K. Aligning M and K blocks to that keeps tails in the
+    // last block only.
+    const int tile_elems = static_cast<int>(get_sme_length(data_type::f32));
+    const int vnni
+            = static_cast<int>(data_type_vnni_granularity(bgmmc.wei_dt));
+    const int k_tile = tile_elems * vnni;
+
+    const int max_m_blk = matmul.M <= tile_elems
+            ? matmul.M
+            : rnd_dn(nstl::min(256, matmul.M), tile_elems);
+    const int min_m_blk = nstl::min(matmul.M, tile_elems);
+
+    int n_blk = bgmmc.N_blk;
+    const int max_n_chunks = bgmmc.use_buffer_a ? 16 : 1;
+    const int n_chunks_start = nstl::min(max_n_chunks, div_up(matmul.N, n_blk));
+
+    const bool use_extended_k_blk = matmul.K > 1024
+            && (!bm_conf_utils.check_is_transposed(bgmmc.src_tag));
+    int k_blk = nstl::min(matmul.K, use_extended_k_blk ? 1024 : 512);
+    if (k_blk > k_tile) k_blk = rnd_dn(k_blk, k_tile);
+
+    float best_imbalance = 1.f; // reduce
+    for_(int n_chunk_size = n_chunks_start; n_chunk_size >= 1; --n_chunk_size)
+    for (int m_blk = max_m_blk; m_blk >= min_m_blk; m_blk -= tile_elems) {
+
+        matmul_brgemm_blocking_params_t cur_params(matmul, nthr);
+        cur_params.update_params(1, m_blk, n_chunk_size, n_blk, 1, k_blk, 1);
+
+        float cur_imbalance = cur_params.get_imbalance();
+        if (cur_imbalance < best_imbalance) {
+            best_imbalance = cur_imbalance;
+            best_blocking = cur_params;
+        }
+    }
+    return best_imbalance;
+}
+
 float compute_blocking_heuristic_sve_256(brgemm_matmul_conf_t &bgmmc,
         const brgemm_matmul_conf_utils_t &bm_conf_utils,
         const matmul_brgemm_blocking_params_t::matmul_params_t &matmul,
@@ -645,7 +810,8 @@ float compute_blocking_heuristic_sve_256(brgemm_matmul_conf_t &bgmmc,
 
     //It is found that for M<512 k_blk of 128 works better than 1024 for most of the shapes.
     int default_k_blk = (matmul.M >= 512) ? 1024 : 128;
-    int k_blk = nstl::min(matmul.K, default_k_blk);
+    int k_blk = limit_k_blk_to_l2(
+            bgmmc, nstl::min(matmul.K, default_k_blk), n_blk);
     int start_nthr_k = 1;
 
     // for cases with low parallel work, reduce 'min_m_blk' to
@@ -683,6 +849,9 @@ float compute_blocking_heuristic_sve_256(brgemm_matmul_conf_t &bgmmc,
         }
     }
 
+    start_nthr_k = nstl::max(start_nthr_k,
+            get_tall_k_nthr_k(bgmmc, matmul, min_m_blk, n_blk, k_blk));
+
     float best_imbalance = 1.f; // reduce
     for_(int nthr_k = start_nthr_k; nthr_k >= 1; --nthr_k)
     for_(int n_chunk_size = n_chunks_start; n_chunk_size >= 1; --n_chunk_size)
@@ -720,7 +889,8 @@ float compute_blocking_heuristic_sve_128(brgemm_matmul_conf_t &bgmmc,
     const int n_chunks_start = nstl::min(max_n_chunks, n_chunks);
 
     int default_k_blk = (matmul.M >= 256) ? 512 : 64;
-    int k_blk = nstl::min(matmul.K, default_k_blk);
+    int k_blk = limit_k_blk_to_l2(
+            bgmmc, nstl::min(matmul.K, default_k_blk), n_blk);
     int start_nthr_k = 1;
 
     // for cases with low parallel work, reduce 'min_m_blk' to
@@ -758,6 +928,9 @@ float compute_blocking_heuristic_sve_128(brgemm_matmul_conf_t &bgmmc,
         }
     }
 
+    start_nthr_k = nstl::max(start_nthr_k,
+            get_tall_k_nthr_k(bgmmc, matmul, min_m_blk, n_blk, k_blk));
+
     float best_imbalance = 1.f; // reduce
     for_(int nthr_k = start_nthr_k; nthr_k >= 1; --nthr_k)
     for_(int n_chunk_size = n_chunks_start; n_chunk_size >= 1; --n_chunk_size)
@@ -776,6 +949,148 @@ float compute_blocking_heuristic_sve_128(brgemm_matmul_conf_t &bgmmc,
     return best_imbalance;
 }
 
+// The rows of A of GEMV-like problems fit in one M block, so the weights are
+// read once and the threads are spread over N and then over K
+float compute_blocking_heuristic_small_m(brgemm_matmul_conf_t &bgmmc,
+        const matmul_brgemm_blocking_params_t::matmul_params_t &matmul,
+        matmul_brgemm_blocking_params_t &best_blocking) {
+    const int nthr = bgmmc.nthr;
+
+    // the widest N block of the weights layout keeps long B streams
+    const int n_blk = bgmmc.N_blk;
+    const int parallel_work = matmul.batch * div_up(matmul.N, n_blk);
+
+    int k_blk = nstl::min(matmul.K, 512);
+    int nthr_k = 1;
+    // the K ranges have to be long enough to pay off the reduction
+    const int min_k_blk = 128;
+    if (k_reduction_can_be_split(bgmmc, matmul) && parallel_work < nthr)
+        nthr_k = nstl::max(1,
+                nstl::min(nthr / parallel_work, matmul.K / min_k_blk));
+    if (nthr_k > 1) {
+        k_blk = nstl::min(k_blk,
+                (int)rnd_up(div_up(matmul.K, nthr_k),
+                        bgmmc.required_k_granularity));
+        nthr_k = nstl::min(nthr_k, (int)div_up(matmul.K, k_blk));
+    }
+
+    best_blocking.update_params(1, matmul.M, 1, n_blk, 1, k_blk, nthr_k);
+    return best_blocking.get_imbalance();
+}
+
+// Returns the time in milliseconds of a thread computing its part of the
+// problem with the blocking, or a negative value if the kernel of the
+// blocking cannot be generated. The brgemm kernel of a block is timed on hot
+// buffers and the time is scaled by the number of blocks of a thread.
+double time_blocking(const brgemm_matmul_conf_t &bgmmc,
+        const matmul_brgemm_blocking_params_t &blocking) {
+    const dim_t m_blk = blocking.m_blk;
+    const dim_t n_blk = blocking.n_blk;
+    const dim_t k_blk = rnd_up(blocking.k_blk, bgmmc.required_k_granularity);
+
+    const data_type_t brg_wei_dt = bgmmc.is_f16_acc ? f16 : bgmmc.wei_dt;
+    brgemm_desc_t brg;
+    if (brgemm_desc_init(&brg, bgmmc.isa, brgemm_addr, bgmmc.src_dt,
+                brg_wei_dt, false, false, brgemm_row_major, 1.f, 1.f, k_blk,
+                n_blk, n_blk, m_blk, n_blk, k_blk)
+                    != status::success
+            || brgemm_desc_finalize(&brg) != status::success)
+        return -1.0;
+    brgemm_kernel_t *ker = nullptr;
+    if (brgemm_kernel_create(&ker, brg) != status::success) return -1.0;
+    std::unique_ptr<brgemm_kernel_t> ker_guard(ker);
+
+    const size_t a_sz = m_blk * k_blk * types::data_type_size(bgmmc.src_dt);
+    const size_t b_sz = k_blk * n_blk * types::data_type_size(brg_wei_dt);
+    const size_t c_sz = m_blk * n_blk * sizeof(float);
+    const size_t wsp_sz = nstl::max(brg.get_wsp_buffer_size(), 1);
+    std::vector<char> buf(a_sz + b_sz + c_sz + wsp_sz, 0);
+    brgemm_batch_element_t batch;
+    batch.ptr.A = buf.data();
+    batch.ptr.B = buf.data() + a_sz;
+    void *ptr_C = buf.data() + a_sz + b_sz;
+    void *wsp = buf.data() + a_sz + b_sz + c_sz;
+
+    const dim_t k_blks_per_thr
+            = div_up(div_up(blocking.mp.K, k_blk), blocking.nthr_k);
+    const dim_t blks_per_thr = div_up(blocking.get_parallel_work(),
+                                       blocking.nthr / blocking.nthr_k)
+            * blocking.m_chunks * blocking.n_chunks * k_blks_per_thr;
+    // enough calls for the timer resolution
+    const dim_t ncalls = nstl::min(blks_per_thr, (dim_t)64);
+    const double ms = tuning_db::time_ms([&]() {
+        for (dim_t i = 0; i < ncalls; i++)
+            brgemm_kernel_execute(ker, 1, &batch, ptr_C, wsp);
+    });
+    return ms * blks_per_thr / ncalls;
+}
+
+// Replaces the blocking by the one of the tuning database, timing the
+// blockings around it at the first creation for the problem
+void autotune_blocking(const brgemm_matmul_conf_t &bgmmc,
+        const brgemm_matmul_conf_utils_t &bm_conf_utils,
+        const matmul_brgemm_blocking_params_t::matmul_params_t &matmul,
+        matmul_brgemm_blocking_params_t &best_blocking) {
+    const auto &b = best_blocking;
+    std::vector<int> m_blks {b.m_blk}, n_blks {b.n_blk}, k_blks {b.k_blk};
+    auto add = [](std::vector<int> &blks, int blk, int max_blk) {
+        blk = nstl::max(1, nstl::min(blk, max_blk));
+        if (std::find(blks.begin(), blks.end(), blk) == blks.end())
+            blks.push_back(blk);
+    };
+    add(m_blks, b.m_blk / 2, matmul.M);
+    add(m_blks, b.m_blk * 2, matmul.M);
+    add(k_blks, b.k_blk / 2, matmul.K);
+    add(k_blks, b.k_blk * 2, matmul.K);
+    // a smaller N block only reduces the block of the weights layout
+    if (!bm_conf_utils.check_n_blk_fixed()) add(n_blks, 32, b.n_blk);
+
+    std::ostringstream key;
+    key << "brgemm_matmul:" << static_cast<int>(bgmmc.isa) << ":"
+        << dnnl_dt2str(bgmmc.src_dt) << ":" << dnnl_dt2str(bgmmc.wei_dt) << ":"
+        << dnnl_dt2str(bgmmc.dst_dt) << ":" << dnnl_fmt_tag2str(bgmmc.src_tag)
+        << ":" << dnnl_fmt_tag2str(bgmmc.wei_tag) << ":" << matmul.batch << "x"
+        << matmul.M << "x" << matmul.N << "x" << matmul.K << ":" << b.nthr;
+
+    // params: m_chunks, m_blk, n_chunks, n_blk, batch_size, k_blk, nthr_k
+    std::vector<int> p;
+    if (tuning_db::lookup(key.str(), p)) {
+        const bool ok = p.size() == 7 && p[0] >= 1 && p[2] >= 1 && p[4] >= 1
+                && p[6] >= 1 && p[6] <= b.nthr
+                && std::find(m_blks.begin(), m_blks.end(), p[1])
+                        != m_blks.end()
+                && std::find(n_blks.begin(), n_blks.end(), p[3])
+                        != n_blks.end()
+                && std::find(k_blks.begin(), k_blks.end(), p[5])
+                        != k_blks.end();
+        if (ok)
+            best_blocking.update_params(
+                    p[0], p[1], p[2], p[3], p[4], p[5], p[6]);
+        return;
+    }
+
+    double best_ms = time_blocking(bgmmc, b);
+    if (best_ms < 0) return;
+    matmul_brgemm_blocking_params_t tuned(matmul, b.nthr);
+    tuned = b;
+    for_(int m_blk : m_blks)
+    for_(int n_blk : n_blks)
+    for (int k_blk : k_blks) {
+        matmul_brgemm_blocking_params_t cur(matmul, b.nthr);
+        cur.update_params(b.m_chunks, m_blk, b.n_chunks, n_blk, b.batch_size,
+                k_blk, b.nthr_k);
+        const double ms = time_blocking(bgmmc, cur);
+        if (ms >= 0 && ms < best_ms) {
+            best_ms = ms;
+            tuned = cur;
+        }
+    }
+    best_blocking = tuned;
+    tuning_db::store(key.str(),
+            {tuned.m_chunks, tuned.m_blk, tuned.n_chunks, tuned.n_blk,
+                    tuned.batch_size, tuned.k_blk, tuned.nthr_k});
+}
+
 status_t compute_blocking_heuristic(brgemm_matmul_conf_t &bgmmc,
         const brgemm_matmul_conf_utils_t &bm_conf_utils) {
 
@@ -783,67 +1098,91 @@ status_t compute_blocking_heuristic(brgemm_matmul_conf_t &bgmmc,
 
     bgmmc.M_chunk_size = bgmmc.N_chunk_size = 1;
 
+    // The M block is fixed for runtime M, the rest of the blocking is tuned
+    // for a nominal M giving one block to each thread
+    constexpr int runtime_M_blk = 64;
+    const dim_t M = bgmmc.is_runtime_M ? runtime_M_blk * bgmmc.nthr : bgmmc.M;
     const matmul_brgemm_blocking_params_t::matmul_params_t matmul(
-            bgmmc.M, bgmmc.N, bgmmc.K, bgmmc.batch);
+            M, bgmmc.N, bgmmc.K, bgmmc.batch);
     matmul_brgemm_blocking_params_t best_blocking(matmul, bgmmc.nthr);
 
+    // The SME kernels compute the M blocks by tiles
+    constexpr int small_M_max = 8;
+    bgmmc.is_small_M = !bgmmc.is_runtime_M && bgmmc.M <= small_M_max
+            && get_max_cpu_isa() != sme;
+
     float best_imbalance;
-    switch (get_max_cpu_isa()) {
-        // TODO:
-        // *) adjust K_BLK using 'rnd_up(bgmmc.K, bgmmc.required_k_granularity)'
-        //    for non-f32 datatypes.
-        // *) optimize param search complexity
-        //
-        // Approach for selecting ideal 'blocking parameters':
-        // M_blk:
-        // - main param for having parallel_work optimally distributed.
-        // - 'br_block' is a BRGeMM uKernel parameter derived from 'M_Blk',
-        // however, there is no measured performance impact from small
-        // variations in 'br_block' size.
-        //
-        // M_Chunks:
-        // - no noticeable performance impact i.e. 'M_blk = M_Chunks * M_Blk';
-        // with M_Chunks > 1', brgemm has the same performance results. Instead,
-        // choose a larger 'M_blk'.
-        //
-        // N_blk:
-        // - ideally 64 (from 'get_default_n_block()').
-        // - can be reduced to 32 to improve performance for some shapes, as
-        //  well as increasing parallelization search space.
-        //
-        // N_Chunks:
-        // - No different as long as thread/work balance is the same.
-        // - Note: for A_Transposed cases using A_buffer (i.e. bwd-w): select
-        // a higher count to increase performance -better for transposed data
-        // reuse.
-        //
-        // K_blk:
-        // - block size variation '512 <= K_blk < 1024' has negligible
-        // performance difference. However, Some cases benefit from higher
-        // block size.
-        // - can parallelize if not enough work; notice: requires reduction!
-        //
-        // Batch_Size:
-        // - unused.
-        case sme:
-        case sve_512:
-            best_imbalance = compute_blocking_heuristic_sve_512(
-                    bgmmc, bm_conf_utils, matmul, best_blocking);
-            break;
-
-        case sve_256:
-            best_imbalance = compute_blocking_heuristic_sve_256(
-                    bgmmc, bm_conf_utils, matmul, best_blocking);
-            break;
-
-        case sve_128:
-            best_imbalance = compute_blocking_heuristic_sve_128(
-                    bgmmc, bm_conf_utils, matmul, best_blocking);
-            break;
-
-        default: return status::unimplemented;
-    }
+    if (bgmmc.is_small_M)
+        best_imbalance = compute_blocking_heuristic_small_m(
+                bgmmc, matmul, best_blocking);
+    else
+        switch (get_max_cpu_isa()) {
+            // TODO:
+            // *) adjust K_BLK using 'rnd_up(bgmmc.K, bgmmc.required_k_granularity)'
+            //    for non-f32 datatypes.
+            // *) optimize param search complexity
+            //
+            // Approach for selecting ideal 'blocking parameters':
+            // M_blk:
+            // - main param for having parallel_work optimally distributed.
+            // - 'br_block' is a BRGeMM uKernel parameter derived from 'M_Blk',
+            // however, there is no measured performance impact from small
+            // variations in 'br_block' size.
+            //
+            // M_Chunks:
+            // - no noticeable performance impact i.e. 'M_blk = M_Chunks * M_Blk';
+            // with M_Chunks > 1', brgemm has the same performance results. Instead,
+            // choose a larger 'M_blk'.
+            //
+            // N_blk:
+            // - ideally 64 (from 'get_default_n_block()').
+            // - can be reduced to 32 to improve performance for some shapes, as
+            //  well as increasing parallelization search space.
+            //
+            // N_Chunks:
+            // - No different as long as thread/work balance is the same.
+            // - Note: for A_Transposed cases using A_buffer (i.e. bwd-w): select
+            // a higher count to increase performance -better for transposed data
+            // reuse.
+            //
+            // K_blk:
+            // - block size variation '512 <= K_blk < 1024' has negligible
+            // performance difference. However, Some cases benefit from higher
+            // block size.
+            // - can parallelize if not enough work; notice: requires reduction!
+            //
+            // Batch_Size:
+            // - unused.
+            case sme:
+                best_imbalance = compute_blocking_heuristic_sme(
+                        bgmmc, bm_conf_utils, matmul, best_blocking);
+                break;
+
+            case sve_512:
+                best_imbalance = compute_blocking_heuristic_sve_512(
+                        bgmmc, bm_conf_utils, matmul, best_blocking);
+                break;
+
+            case sve_256:
+                best_imbalance = compute_blocking_heuristic_sve_256(
+                        bgmmc, bm_conf_utils, matmul, best_blocking);
+                break;
+
+            case sve_128:
+                best_imbalance = compute_blocking_heuristic_sve_128(
+                        bgmmc, bm_conf_utils, matmul, best_blocking);
+                break;
+
+            default: return status::unimplemented;
+        }
     if (best_imbalance == 1.f) return status::unimplemented;
+    if (tuning_db::is_enabled() && !bgmmc.is_runtime_M)
+        autotune_blocking(bgmmc, bm_conf_utils, matmul, best_blocking);
+    // the M tails are not known, so the reduction over K is not split
+    if (bgmmc.is_runtime_M)
+        best_blocking.update_params(1, runtime_M_blk, best_blocking.n_chunks,
+                best_blocking.n_blk, best_blocking.batch_size,
+                best_blocking.k_blk, 1);
     best_blocking.update_configuration(bgmmc);
 
     return status::success;
@@ -859,12 +1198,36 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     bgmmc = utils::zero<decltype(bgmmc)>();
     bgmmc.isa = isa;
-    bgmmc.nthr = dnnl_get_max_threads();
+    bgmmc.nthr = attr.dispatch_hint_.get_nthr(dnnl_get_max_threads());
+    bgmmc.dispatch_goal = attr.dispatch_hint_.goal_;
     bgmmc.brg_type = brgemm_addr;
 
     bgmmc.src_dt = src_d.data_type();
     bgmmc.dst_dt = dst_d.data_type();
     bgmmc.wei_dt = weights_d.data_type();
+    bgmmc.orig_src_dt = bgmmc.src_dt;
+    bgmmc.orig_wei_dt = bgmmc.wei_dt;
+    bgmmc.orig_dst_dt = bgmmc.dst_dt;
+
+    // bf32: with the bf16 fpmath mode, f32 src and weights are down-converted
+    // to bf16 in scratchpad buffers of the same layout before the
+    // computation, which then runs as a bf16 matmul accumulating in f32. As
+    // the bf16 kernels need blocked weights, the weights layout must be left
+    // to the implementation. The weights are converted at each execution,
+    // which only pays off when enough rows of src reuse them. Other cases are
+    // computed in f32.
+    const dim_t bf32_min_M = 8;
+    const bool is_bf32_problem
+            = everyone_is(f32, bgmmc.src_dt, bgmmc.wei_dt, bgmmc.dst_dt)
+            && attr.fpmath_.mode_ == fpmath_mode::bf16 && mayiuse_bf16()
+            && isa != sme && weights_d.format_kind() == format_kind::any
+            && dst_d.ndims() <= 3 && !src_d.has_runtime_dims_or_strides()
+            && !weights_d.has_runtime_dims_or_strides()
+            && dst_d.dims()[dst_d.ndims() - 2] >= bf32_min_M;
+    if (is_bf32_problem) {
+        bgmmc.src_dt = bf16;
+        bgmmc.wei_dt = bf16;
+    }
 
     bgmmc.with_bias = mmd.bias_desc.format_kind != format_kind::undef;
     bgmmc.bia_dt = bgmmc.with_bias ? mmd.bias_desc.data_type : data_type::undef;
@@ -884,9 +1247,35 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     bgmmc.is_bf32 = bm_conf_utils.is_bf32();
 
-    // Make BRGeMM compute MatMul as if it were in bfloat16, while down-convert
-    // happens during copy-buffer computations
-    if (bgmmc.is_bf32 || bm_conf_utils.is_f16()) { assert(!"unreachable"); }
+    // f16 is computed in f32: weights are up-converted by copy_B and src is
+    // up-converted by the brgemm kernel on broadcast, unless f16 is
+    // accumulated in f16 (see is_f16_acc below)
+    if (bm_conf_utils.is_f16()) {
+        bgmmc.wei_dt = f32;
+        bgmmc.tr_b_dt_sz = types::data_type_size(f32);
+    }
+
+    // fp8 is computed in f32 as well: weights are up-converted by copy_B,
+    // src is up-converted in a scratchpad buffer of the same layout before
+    // the computation and fp8 dst is down-converted from an f32 scratchpad
+    // buffer after it
+    if (bm_conf_utils.is_fp8()) {
+        bgmmc.src_dt = f32;
+        bgmmc.a_dt_sz = bgmmc.tr_a_dt_sz = types::data_type_size(f32);
+        bgmmc.wei_dt = f32;
+        bgmmc.tr_b_dt_sz = types::data_type_size(f32);
+        if (one_of(bgmmc.dst_dt, f8_e5m2, f8_e4m3)) bgmmc.dst_dt = f32;
+    }
+
+    // Weights decompression: copy_B dequantizes int weights to f32 applying
+    // zero-points and, if they vary along K, scales
+    bgmmc.is_f32_with_int_wei = bm_conf_utils.is_f32_with_int_wei();
+    bgmmc.with_wei_decompression = bm_conf_utils.with_weights_decompression();
+    bgmmc.is_int4_weights = one_of(bgmmc.wei_dt, s4, u4);
+    if (bgmmc.is_f32_with_int_wei) {
+        bgmmc.wei_dt = f32;
+        bgmmc.tr_b_dt_sz = types::data_type_size(f32);
+    }
 
     bgmmc.acc_dt = bm_conf_utils.is_int8() ? s32 : f32;
 
@@ -897,15 +1286,37 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     const auto &src_scales = attr.scales_.get(DNNL_ARG_SRC);
     const auto &wei_scales = attr.scales_.get(DNNL_ARG_WEIGHTS);
     const bool has_wei_scales = !wei_scales.has_default_values();
-    bgmmc.with_scales = !src_scales.has_default_values() || has_wei_scales;
+    const int wei_qmask_N = 1 << (bgmmc.ndims - 1);
+    const int wei_qmask_K = 1 << (bgmmc.ndims - 2);
     if (has_wei_scales) {
-        bgmmc.is_oscale_per_n
-                = wei_scales.get_mask() == (1 << (bgmmc.ndims - 1));
-
-        // only common and per-oc-channel scales are supported
-        VCONDCHECK_BG(wei_scales.get_mask() == 0 || bgmmc.is_oscale_per_n,
+        const int wei_scale_mask = wei_scales.get_mask();
+        bgmmc.is_oscale_per_n = wei_scale_mask == wei_qmask_N;
+        bgmmc.is_wei_scale_per_n = wei_scale_mask & wei_qmask_N;
+        bgmmc.is_wei_scale_per_k = wei_scale_mask & wei_qmask_K;
+        bgmmc.apply_scales_in_buffer_b
+                = bgmmc.is_wei_scale_per_k && bgmmc.with_wei_decompression;
+        bgmmc.wei_scales_dt = wei_scales.get_data_type();
+        if (bgmmc.is_wei_scale_per_k)
+            bgmmc.wei_scales_k_gsize = wei_scales.get_group(0);
+
+        // only common and per-oc-channel scales are supported, weights
+        // decompression additionally supports scales grouped along K
+        VCONDCHECK_BG(wei_scale_mask == 0 || bgmmc.is_oscale_per_n
+                        || (bgmmc.apply_scales_in_buffer_b
+                                && (wei_scale_mask
+                                           & ~(wei_qmask_N | wei_qmask_K))
+                                        == 0
+                                && wei_scales.get_group(1) == 1),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        // The kernel would apply src scales as a product with weights scales
+        VCONDCHECK_BG(IMPLICATION(bgmmc.apply_scales_in_buffer_b,
+                              src_scales.has_default_values()
+                                      && one_of(bgmmc.wei_scales_dt, f32, bf16,
+                                              f16)),
                 VERBOSE_UNSUPPORTED_SCALES_CFG);
     }
+    bgmmc.with_scales = !src_scales.has_default_values()
+            || (has_wei_scales && !bgmmc.apply_scales_in_buffer_b);
 
     const auto &dst_scales = attr.scales_.get(DNNL_ARG_DST);
     bgmmc.with_dst_scales = !dst_scales.has_default_values();
@@ -929,9 +1340,31 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     VCONDCHECK_BG(
             IMPLICATION(!bm_conf_utils.is_int8(),
                     everyone_is(brgemm_broadcast_t::none, bgmmc.src_zp_type,
-                            bgmmc.wei_zp_type, bgmmc.dst_zp_type)),
+                            bgmmc.dst_zp_type)
+                            && IMPLICATION(!bgmmc.with_wei_decompression,
+                                    bgmmc.wei_zp_type
+                                            == brgemm_broadcast_t::none)),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    // Weights zero-point requires compensation computed in copy_A which is
+    // not implemented. With weights decompression it is applied by copy_B.
+    VCONDCHECK_BG(IMPLICATION(!bgmmc.with_wei_decompression,
+                          bgmmc.wei_zp_type == brgemm_broadcast_t::none),
             VERBOSE_UNSUPPORTED_ZP_CFG);
 
+    const auto &wei_zp = attr.zero_points_.get(DNNL_ARG_WEIGHTS);
+    if (bgmmc.with_wei_decompression && !wei_zp.has_default_values()) {
+        const int wei_zp_mask = wei_zp.get_mask();
+        bgmmc.is_wei_zp_per_n = wei_zp_mask & wei_qmask_N;
+        bgmmc.is_wei_zp_per_k = wei_zp_mask & wei_qmask_K;
+        bgmmc.wei_zp_dt = wei_zp.get_data_type();
+        if (bgmmc.is_wei_zp_per_k) bgmmc.wei_zp_k_gsize = wei_zp.get_group(0);
+
+        VCONDCHECK_BG((wei_zp_mask & ~(wei_qmask_N | wei_qmask_K)) == 0
+                        && wei_zp.get_group(1) == 1
+                        && one_of(bgmmc.wei_zp_dt, s32, s8, u8),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+    }
+
     matmul_helper_t helper(src_d, weights_d, dst_d);
 
     bgmmc.batch_ndims = bgmmc.ndims - 2;
@@ -948,9 +1381,33 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
             || bgmmc.is_runtime_K)
         return status::unimplemented;
 
-    const bool runtime_M_supported = false;
-    if (bgmmc.is_runtime_M && !runtime_M_supported)
-        return status::unimplemented;
+    // Runtime M value is supported for 2d problems without the whole tensor
+    // conversion buffers. The kernels for the M block and the M tails are
+    // generated at creation and the tails are selected at execution.
+    const bool runtime_M_supported = bgmmc.ndims == 2
+            && bgmmc.orig_src_dt == bgmmc.src_dt
+            && bgmmc.orig_dst_dt == bgmmc.dst_dt;
+    VCONDCHECK_BG(!(bgmmc.is_runtime_M && !runtime_M_supported),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    if (bgmmc.with_wei_decompression) {
+        // copy_B is called for K ranges that share a row of weights scales
+        // and zero-points
+        const dim_t scales_k_gsize = bgmmc.apply_scales_in_buffer_b
+                ? bgmmc.wei_scales_k_gsize
+                : bgmmc.K;
+        const dim_t zp_k_gsize
+                = bgmmc.is_wei_zp_per_k ? bgmmc.wei_zp_k_gsize : bgmmc.K;
+        VCONDCHECK_BG(IMPLICATION(bgmmc.apply_scales_in_buffer_b
+                                      && bgmmc.is_wei_zp_per_k,
+                              scales_k_gsize == zp_k_gsize),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        bgmmc.wei_decomp_k_gsize = nstl::min(scales_k_gsize, zp_k_gsize);
+
+        // Rows of int4 weights must start at a byte boundary
+        VCONDCHECK_BG(IMPLICATION(bgmmc.is_int4_weights, bgmmc.N % 2 == 0),
+                VERBOSE_BAD_PARAM, "N");
+    }
 
     bgmmc.batch_without_first_dim
             = bgmmc.batch_ndims > 1 ? helper.batch() / dst_d.dims()[0] : 0;
@@ -982,8 +1439,25 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.wei_n_blk = get_default_n_block(bgmmc.wei_tag, bgmmc);
 
     bgmmc.blocked_B = bm_conf_utils.get_blocked_B();
+    // SME kernel reads B directly: only f32 may skip the copy routine, other
+    // data types need weights already in the blocked (vnni) layout
+    const bool sme_B_layout_ok
+            = bm_conf_utils.is_f32() || !bm_conf_utils.use_buffer_b();
+    VCONDCHECK_BG(IMPLICATION(sme == isa, sme_B_layout_ok),
+            VERBOSE_UNSUPPORTED_TAG);
     bgmmc.use_buffer_b = bm_conf_utils.use_buffer_b() && (sme != isa);
 
+    // With the f16, relaxed or any accumulation mode, f16 is accumulated in
+    // f16 by brgemm, which adds the f16 sums to f32 accumulators after each
+    // block of K. The f16 halves of a vector must match the kernel vectors,
+    // and the BA gemv runs as a column major brgemm which can't do it.
+    bgmmc.is_f16_acc = bm_conf_utils.is_f16() && bgmmc.use_buffer_b
+            && one_of(attr.acc_mode_, accumulation_mode::f16,
+                    accumulation_mode::relaxed, accumulation_mode::any)
+            && isa != sme && simd_bytes(isa) == get_sve_length()
+            && !(bgmmc.wei_tag == format_tag::ba && bgmmc.M == 1);
+    if (bgmmc.is_f16_acc) bgmmc.tr_b_dt_sz = types::data_type_size(f16);
+
     const bool transposed_A = bm_conf_utils.check_is_transposed(bgmmc.src_tag);
     // if M == 1 we can still treat formally transposed A as plain
     // and avoid copy routine creation/execution
@@ -1029,10 +1503,21 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     }
 
     const bool lda_is_big_2pow = false;
+    // the kernels broadcast the elements of f32 transposed A from its rows
+    // along K, so no copy is needed
+    const bool kernel_reads_transposed_A = bm_conf_utils.is_f32()
+            && !bm_conf_utils.is_bf32() && bgmmc.isa != sme;
     const bool is_copy_a_required
             = bgmmc.wei_zp_type != brgemm_broadcast_t::none
-            || bgmmc.transposed_A || lda_is_big_2pow;
+            || (bgmmc.transposed_A && !kernel_reads_transposed_A)
+            || lda_is_big_2pow;
     bgmmc.use_buffer_a = is_copy_a_required;
+    bgmmc.read_A_transposed = bgmmc.transposed_A && !bgmmc.use_buffer_a;
+    // the stride along K is the leading dimension of the kernels
+    VCONDCHECK_BG(!(bgmmc.read_A_transposed
+                          && is_runtime_value(
+                                  helper.get_a_stride(bgmmc.ndims - 1))),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
     // Supported computation with copy only part of A related to K_tail if
     // is_copy_a_required == true, but the current performance measurements
@@ -1064,13 +1549,21 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
         bgmmc.C_strides[1] = bgmmc.C_strides[2];
     }
 
-    // BF32 'Hint' Heuristic:
-    // Under the following conditions, F32 through SVE512 performs better
-    // than using BF32 arithmetic.
-    VCONDCHECK_BG(!(bgmmc.is_bf32 && (bgmmc.M < 8)
-                          && ((bgmmc.wei_tag == abcd)
-                                  || bm_conf_utils.is_any_B_layout())),
-            VERBOSE_UNSUPPORTED_FPMATH_MODE);
+    // Memory bound problems saturate the bandwidth with fewer threads than
+    // the machine has. The roofline of the calibrated machine gives the
+    // threads the blocking is computed for, unless the user set them.
+    if (!bgmmc.is_runtime_M && attr.dispatch_hint_.max_threads_ == 0) {
+        const double batch = bgmmc.batch;
+        const double wei_batch
+                = bgmmc.bcast_B_desc.bcast_across_all_batch_dims ? 1 : batch;
+        const double M = bgmmc.M, N = bgmmc.N, K = bgmmc.K;
+        const double flops = 2 * batch * M * N * K;
+        const double bytes = batch * M * K * bgmmc.a_dt_sz
+                + wei_batch * K * N * bgmmc.b_dt_sz
+                + batch * M * N * bgmmc.c_dt_sz;
+        bgmmc.nthr = cpu_calibration::get_nthr_for_work(
+                bgmmc.nthr, flops, bytes);
+    }
 
     // Heuristic tries to optimize the following parameters:
     // - M_blk, M_Chunk
@@ -1283,7 +1776,8 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
             : 0;
 
     bgmmc.has_zero_point_a = bgmmc.src_zp_type != brgemm_broadcast_t::none;
-    bgmmc.has_zero_point_b = bgmmc.wei_zp_type != brgemm_broadcast_t::none;
+    bgmmc.has_zero_point_b = bgmmc.wei_zp_type != brgemm_broadcast_t::none
+            && !bgmmc.with_wei_decompression;
     bgmmc.has_zero_point_c = bgmmc.dst_zp_type != brgemm_broadcast_t::none;
     bgmmc.post_ops_applicable = one_of(true, bgmmc.with_sum, bgmmc.with_bias,
             bgmmc.with_scales, bgmmc.with_eltwise, bgmmc.with_binary,
@@ -1,7 +1,7 @@
 /*******************************************************************************
 * Copyright 2021 Intel Corporation
 * Copyright 2023-2024 FUJITSU LIMITED
-* Copyright 2025 Arm Ltd. and affiliates
+* Copyright 2025-2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -111,6 +111,8 @@ struct brgemm_matmul_conf_t {
 
     bool use_buffer_a;
     bool use_buffer_a_tail_only;
+    // the brgemm kernels read A transposed, without copy
+    bool read_A_transposed;
     bool use_buffer_b;
     bool use_buffer_c;
 
@@ -124,8 +126,10 @@ struct brgemm_matmul_conf_t {
     data_type_t bia_dt;
     data_type_t orig_src_dt;
     data_type_t orig_wei_dt;
+    data_type_t orig_dst_dt;
     int nthr;
     int nthr_k;
+    dispatch_goal_t dispatch_goal;
 
     // Auxiliary values for init_config() and execute()
     dim_t a_dt_sz, b_dt_sz, c_dt_sz, acc_dt_sz, bias_dt_sz;
@@ -185,10 +189,30 @@ struct brgemm_matmul_conf_t {
 
     int required_k_granularity;
     bool is_bf32 = false;
+    // f16 weights are kept in f16 by copy_B and brgemm accumulates in f16
+    bool is_f16_acc = false;
     bool req_wei_vnni_downconvert = false;
+
+    // Weights decompression: int weights are dequantized to f32 by copy_B
+    bool is_f32_with_int_wei = false;
+    bool with_wei_decompression = false;
+    bool is_int4_weights = false;
+    bool apply_scales_in_buffer_b = false;
+    bool is_wei_scale_per_n = false;
+    bool is_wei_scale_per_k = false;
+    data_type_t wei_scales_dt = data_type::undef;
+    dim_t wei_scales_k_gsize = 0;
+    bool is_wei_zp_per_n = false;
+    bool is_wei_zp_per_k = false;
+    data_type_t wei_zp_dt = data_type::undef;
+    dim_t wei_zp_k_gsize = 0;
+    // K range that shares the same weights scales and zero-points rows
+    dim_t wei_decomp_k_gsize = 0;
     bool is_runtime_M = false;
     bool is_runtime_N = false;
     bool is_runtime_K = false;
+    // GEMV-like problem, bound by reading the weights
+    bool is_small_M = false;
     inline bool lda_big_pow2() const {
         const dim_t big_K_threshold = 4096;
         return !transposed_A && math::is_pow2(K) && K >= big_K_threshold;
@@ -227,7 +251,10 @@ struct brgemm_matmul_conf_utils_t {
         bool use_copy_buffer = IMPLICATION(
                 this->is_f32(), use_heuristic && (big_LDB && is_pow2));
 
-        if (this->is_f16()) return false;
+        // f16 and fp8 weights are up-converted to f32 by copy_B, int weights
+        // are dequantized by it
+        if (this->is_f16() || this->is_fp8() || this->is_f32_with_int_wei())
+            return true;
 
         return (use_copy_buffer && this->check_is_plain(bgmmc.wei_tag))
                 || this->check_is_transposed(bgmmc.wei_tag)
@@ -269,10 +296,18 @@ struct brgemm_matmul_conf_utils_t {
 
     inline bool is_f16() const { return f16_dt; }
 
+    inline bool is_fp8() const { return fp8_dt; }
+
     inline bool is_int8() const { return int8_dt; }
 
     inline bool is_bf32() const { return bf32_dt; }
 
+    inline bool is_f32_with_int_wei() const { return f32_with_int_wei_dt; }
+
+    inline bool with_weights_decompression() const {
+        return f32_with_int_wei_dt;
+    }
+
     inline bool is_int8_with_bf16_dst() const {
         return this->is_int8() && bgmmc.dst_dt == data_type::bf16;
     }
@@ -285,6 +320,8 @@ struct brgemm_matmul_conf_utils_t {
 
     inline cpu_isa_t get_isa() const { return isa_; }
 
+    inline data_type_t get_src_dt() const { return bgmmc.src_dt; }
+
     status_t set_or_check_B_tag(
             memory_desc_t &B_md, bool init_n_tag = true) const;
     status_t update_and_check_B_tag(memory_desc_t &B_md, int n_blk_size) const;
@@ -296,7 +333,8 @@ struct brgemm_matmul_conf_utils_t {
 private:
     brgemm_matmul_conf_t &bgmmc;
 
-    const bool f32_dt, bf16_dt, f16_dt, int8_dt, bf32_dt;
+    const bool f32_dt, bf16_dt, f16_dt, fp8_dt, int8_dt, bf32_dt;
+    const bool weights_decompression_support, f32_with_int_wei_dt;
     const bool A_any_layout;
     const bool B_any_layout;
     const bool C_any_layout;
@@ -0,0 +1,209 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/matmul/brgemm_sparse_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+namespace matmul {
+
+namespace {
+// Rows of src per block and columns of weights per block
+constexpr dim_t m_blk_default = 32;
+constexpr dim_t n_blk_default = 64;
+
+cpu_isa_t get_brgemm_isa() {
+    // The SME brgemm kernel is not used here as it expects packed operands.
+    // The weights are plain, so the kernel may use vectors of any length.
+    if (is_wide_sve()) return sve;
+    if (mayiuse(sve_512)) return sve_512;
+    if (mayiuse(sve_256)) return sve_256;
+    if (mayiuse(sve_128)) return sve_128;
+    return isa_undef;
+}
+} // namespace
+
+using namespace memory_tracking::names;
+
+status_t brgemm_sparse_matmul_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md(0));
+
+    VDISPATCH_MATMUL(wei_d.is_sparse_desc() && !src_d.is_sparse_desc(),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(utils::one_of(wei_d.encoding(), sparse_encoding::csr,
+                             sparse_encoding::coo),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    if (wei_d.encoding() == sparse_encoding::csr)
+        VDISPATCH_MATMUL(utils::everyone_is(s32, wei_d.metadata_type(0),
+                                 wei_d.metadata_type(1)),
+                VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    else
+        VDISPATCH_MATMUL(
+                s32 == wei_d.metadata_type(0), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(utils::everyone_is(f32, src_md()->data_type,
+                             weights_md(0)->data_type, dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(ndims() == 2, VERBOSE_BAD_NDIMS, "dst", ndims());
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(get_brgemm_isa() != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(
+            memory_desc_wrapper(src_md()).matches_one_of_tag(format_tag::ab)
+                    && memory_desc_wrapper(dst_md()).matches_one_of_tag(
+                            format_tag::ab),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    auto &c = conf_;
+    c.M = M();
+    c.N = N();
+    c.K = K();
+    c.m_blk = nstl::min(c.M, m_blk_default);
+    c.n_blk = nstl::min(c.N, n_blk_default);
+    c.nb_m = utils::div_up(c.M, c.m_blk);
+    c.nb_n = utils::div_up(c.N, c.n_blk);
+    c.m_tail = c.M % c.m_blk;
+    c.n_tail = c.N % c.n_blk;
+    c.wei_encoding = wei_d.encoding();
+
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_sparse_matmul_t::pd_t::init_brgemm_descs() {
+    using namespace data_type;
+    const auto &c = conf_;
+
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+
+    for (bool m_tail : {false, true})
+        for (bool n_tail : {false, true}) {
+            const dim_t M = m_tail ? c.m_tail : c.m_blk;
+            const dim_t N = n_tail ? c.n_tail : c.n_blk;
+            if (M == 0 || N == 0) continue;
+
+            auto &brg = brg_descs_[get_brg_idx(m_tail, n_tail)];
+            CHECK(brgemm_desc_init(&brg, get_brgemm_isa(), brgemm_addr, f32,
+                    f32, false, false, brgemm_row_major, 1.f, 0.f, c.K, c.N,
+                    c.N, M, N, c.K));
+            CHECK(brgemm_desc_set_attr(&brg, brgattr));
+            CHECK(brgemm_desc_finalize(&brg));
+        }
+
+    return status::success;
+}
+
+void brgemm_sparse_matmul_t::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(key_matmul_wei_trans, c.K * c.N);
+    if (c.wei_encoding == sparse_encoding::coo)
+        scratchpad.template book<int32_t>(key_matmul_sparse_tmp_ptr, c.K + 1);
+}
+
+status_t brgemm_sparse_matmul_t::init(engine_t *engine) {
+    const auto &c = pd()->conf_;
+    for (bool m_tail : {false, true})
+        for (bool n_tail : {false, true}) {
+            const dim_t M = m_tail ? c.m_tail : c.m_blk;
+            const dim_t N = n_tail ? c.n_tail : c.n_blk;
+            if (M == 0 || N == 0) continue;
+
+            const int idx = pd_t::get_brg_idx(m_tail, n_tail);
+            brgemm_kernel_t *ker = nullptr;
+            CHECK(brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
+            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        }
+    return status::success;
+}
+
+status_t brgemm_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+
+    const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto wei_values = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS, 0);
+    const auto wei_buffer_1 = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+    const auto wei_buffer_2 = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *wei = scratchpad.template get<float>(key_matmul_wei_trans);
+
+    // Index 1 holds the column indices and index 2 the row pointers for CSR.
+    // For COO the two buffers hold the row and column indices, and the row
+    // indices are compressed into CSR pointers like in the reference
+    // implementation.
+    const int32_t *wei_indices = wei_buffer_1;
+    const int32_t *wei_pointers = wei_buffer_2;
+    if (c.wei_encoding == sparse_encoding::coo) {
+        const memory_desc_wrapper wei_d(pd()->weights_md(0));
+        const dim_t nnz = wei_d.nnz();
+        int32_t *row_pointers
+                = scratchpad.template get<int32_t>(key_matmul_sparse_tmp_ptr);
+        utils::array_set(row_pointers, 0, c.K + 1);
+        parallel_nd(nnz, [&](dim_t i) {
+            fetch_and_add(&row_pointers[wei_buffer_1[i] + 1], 1);
+        });
+        for (dim_t k = 0; k < c.K; ++k)
+            row_pointers[k + 1] += row_pointers[k];
+        wei_indices = wei_buffer_2;
+        wei_pointers = row_pointers;
+    }
+
+    // Decompress the weights, every row is independent.
+    parallel_nd(c.K, [&](dim_t k) {
+        float *wei_row = wei + k * c.N;
+        utils::array_set(wei_row, 0.f, c.N);
+        for (dim_t i = wei_pointers[k]; i < wei_pointers[k + 1]; ++i)
+            wei_row[wei_indices[i]] += wei_values[i];
+    });
+
+    parallel_nd(c.nb_m, c.nb_n, [&](dim_t im, dim_t in) {
+        const dim_t m_start = im * c.m_blk;
+        const dim_t n_start = in * c.n_blk;
+        const bool is_m_tail = c.M - m_start < c.m_blk;
+        const bool is_n_tail = c.N - n_start < c.n_blk;
+        const int brg_idx = pd_t::get_brg_idx(is_m_tail, is_n_tail);
+
+        brgemm_batch_element_t batch;
+        batch.ptr.A = src + m_start * c.K;
+        batch.ptr.B = wei + n_start;
+        brgemm_kernel_execute(brg_kernels_[brg_idx].get(), 1, &batch,
+                dst + m_start * c.N + n_start);
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
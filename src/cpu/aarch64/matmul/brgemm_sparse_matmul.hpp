@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_MATMUL_BRGEMM_SPARSE_MATMUL_HPP
+#define CPU_AARCH64_MATMUL_BRGEMM_SPARSE_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/brgemm/brgemm.hpp"
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+namespace matmul {
+
+struct brgemm_sparse_matmul_conf_t {
+    dim_t M, N, K;
+
+    dim_t m_blk, n_blk;
+    dim_t nb_m, nb_n;
+    dim_t m_tail, n_tail;
+
+    sparse_encoding_t wei_encoding;
+};
+
+/// Matmul with dense src and CSR or COO encoded weights.
+///
+/// The weights are decompressed into a dense [K, N] scratchpad buffer in
+/// parallel over the rows of the sparse matrix, and the product is computed
+/// with SVE brgemm kernels over blocks of src rows and weights columns. This
+/// does not skip the zero weights, but the vectorized dense kernels are
+/// faster than the scalar scatter loop of the reference implementation at
+/// the sparsity levels of pruned models.
+struct brgemm_sparse_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("brg:sparse", brgemm_sparse_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernel index for a (M tail, N tail) combination
+        static int get_brg_idx(bool m_tail, bool n_tail) {
+            return 2 * static_cast<int>(m_tail) + static_cast<int>(n_tail);
+        }
+
+        brgemm_sparse_matmul_conf_t conf_ {};
+        brgemm_desc_t brg_descs_[4];
+
+    private:
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_sparse_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[4];
+};
+
+} // namespace matmul
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
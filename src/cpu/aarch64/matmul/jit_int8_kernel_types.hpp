@@ -77,6 +77,8 @@ struct brg_int8_t {
     bool with_dst_scales;
     bool is_oc_scales;
     bool is_per_m_scales = false;
+    // f32 or bf16 src quantized to s8 with dynamic per-row scales
+    bool is_src_dyn_quant = false;
     jit_int8_broadcast_t zp_type_a = jit_int8_broadcast_t::none;
     jit_int8_broadcast_t zp_type_b = jit_int8_broadcast_t::none;
     jit_int8_broadcast_t zp_type_c = jit_int8_broadcast_t::none;
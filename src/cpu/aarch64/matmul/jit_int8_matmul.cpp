@@ -17,9 +17,12 @@
 *******************************************************************************/
 
 #include <cassert>
+#include <cmath>
+#include <cstring>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/dnnl_traits.hpp"
 #include "common/memory_tracking.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -29,6 +32,7 @@
 #include "cpu/matmul/matmul_utils.hpp"
 #include "cpu/platform.hpp"
 #include "cpu/scale_utils.hpp"
+#include "cpu/simple_q10n.hpp"
 
 #include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
 #include "cpu/aarch64/jit_generator.hpp"
@@ -800,6 +804,54 @@ private:
             eltwise_injectors_;
 };
 
+namespace {
+
+// Quantizes the rows of a plain f32 or bf16 `src` to s8 into the 8x8 blocks
+// of the A buffer, and computes the scale of each row in the same pass over
+// the row. Rows and columns of the blocks out of `src` are zero-padded.
+template <data_type_t src_dt>
+void quantize_a_s8(const void *src, int8_t *buf, float *scales, dim_t M,
+        dim_t K, int m_blk, int k_blk) {
+    using src_data_t = typename prec_traits_t<src_dt>::type;
+    const dim_t m_blks = utils::div_up(M, m_blk);
+    const dim_t k_blks = utils::div_up(K, k_blk);
+    const dim_t blk_sz = m_blk * k_blk;
+    parallel_nd(m_blks, [&](dim_t mb) {
+        int8_t *blk_buf = buf + mb * k_blks * blk_sz;
+        for (int r = 0; r < m_blk; r++) {
+            int8_t *row_buf = blk_buf + r * k_blk;
+            const dim_t m = mb * m_blk + r;
+            if (m >= M) {
+                for (dim_t kb = 0; kb < k_blks; kb++)
+                    std::memset(row_buf + kb * blk_sz, 0, k_blk);
+                continue;
+            }
+            const src_data_t *row
+                    = reinterpret_cast<const src_data_t *>(src) + m * K;
+            float amax = 0.f;
+            PRAGMA_OMP_SIMD(reduction(max : amax))
+            for (dim_t k = 0; k < K; k++)
+                amax = nstl::max(amax, std::fabs(static_cast<float>(row[k])));
+            const float scale = amax == 0.f ? 1.f : amax / 127.f;
+            const float inv_scale = 1.f / scale;
+            scales[m] = scale;
+            for (dim_t kb = 0; kb < k_blks; kb++) {
+                const dim_t k_start = kb * k_blk;
+                const dim_t k_len = nstl::min<dim_t>(k_blk, K - k_start);
+                int8_t *d = row_buf + kb * blk_sz;
+                PRAGMA_OMP_SIMD()
+                for (dim_t k = 0; k < k_len; k++)
+                    d[k] = q10n::saturate_and_round<int8_t>(
+                            static_cast<float>(row[k_start + k]) * inv_scale);
+                for (dim_t k = k_len; k < k_blk; k++)
+                    d[k] = 0;
+            }
+        }
+    });
+}
+
+} // namespace
+
 template <cpu_isa_t isa>
 status_t jit_int8_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
@@ -820,8 +872,13 @@ status_t jit_int8_matmul_t<isa>::pd_t::init(engine_t *engine) {
             no_runtime_dims_or_strides, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
     VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
+    // A f32 or bf16 src with dynamic per-row scales is quantized to s8 while
+    // it is copied to the A buffer, then the problem is a s8 one.
+    const bool is_src_dyn_quant = utils::one_of(src_type, f32, bf16)
+            && wei_type == s8
+            && attr()->scales_.get(DNNL_ARG_SRC).is_dynamic_fp();
     bool is_u8 = utils::everyone_is(u8, src_type, wei_type);
-    bool is_s8 = utils::everyone_is(s8, src_type, wei_type);
+    bool is_s8 = utils::everyone_is(s8, src_type, wei_type) || is_src_dyn_quant;
     bool is_u8_s8 = utils::everyone_is(u8, src_type)
             && utils::everyone_is(s8, wei_type);
     const bool is_per_m_scales
@@ -842,10 +899,17 @@ status_t jit_int8_matmul_t<isa>::pd_t::init(engine_t *engine) {
         auto src_scl_msk = src_scales.get_mask();
         const bool is_src_per_m = src_scl_msk == src_qmask_M();
 
-        bool ok = attr_scales_ok(supported_args,
-                {quantization_mode::static_sazp},
+        const std::vector<int> supported_qmodes = is_src_dyn_quant
+                ? std::vector<int> {quantization_mode::static_sazp,
+                        quantization_mode::dynamic_fp}
+                : std::vector<int> {quantization_mode::static_sazp};
+        bool ok = attr_scales_ok(supported_args, supported_qmodes,
                 {{DNNL_ARG_SRC, {src_qmask_M()}}});
         ok = ok && IMPLICATION(is_src_per_m, src_scales.has_default_groups());
+        ok = ok && !wei_scales.is_dynamic()
+                && !scales.get(DNNL_ARG_DST).is_dynamic();
+        // The dynamic scales are computed per row of a single batch.
+        ok = ok && IMPLICATION(is_src_dyn_quant, is_src_per_m && batch() == 1);
 
         if (is_src_scl && !scales.has_default_data_type(DNNL_ARG_SRC))
             return false;
@@ -927,6 +991,9 @@ status_t jit_int8_matmul_t<isa>::pd_t::init(engine_t *engine) {
     };
 
     VDISPATCH_MATMUL(init_zp_type(&brg_), VERBOSE_UNSUPPORTED_ZP_CFG);
+    VDISPATCH_MATMUL(IMPLICATION(is_src_dyn_quant,
+                             brg_.zp_type_a == jit_int8_broadcast_t::none),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
 
     VDISPATCH_MATMUL(check_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
 
@@ -944,7 +1011,8 @@ status_t jit_int8_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
     const bool problem_dt_correct = (is_s8 || is_u8 || is_u8_s8)
             && utils::one_of(dst_type, f32, bf16)
-            && platform::has_data_type_support(dst_type);
+            && platform::has_data_type_support(dst_type)
+            && platform::has_data_type_support(src_type);
 
     VDISPATCH_MATMUL(problem_dt_correct, VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_MATMUL(no_post_ops || with_eltwise(), VERBOSE_UNSUPPORTED_ATTR);
@@ -1139,6 +1207,7 @@ status_t jit_int8_matmul_t<isa>::pd_t::init(engine_t *engine) {
     brg_.with_dst_scales = is_dst_scales;
     brg_.is_oc_scales = wei_scales.get_mask() > 0;
     brg_.is_per_m_scales = is_per_m_scales;
+    brg_.is_src_dyn_quant = is_src_dyn_quant;
     dyn_.K = brg_.K;
     dyn_.N = brg_.N;
     dyn_.M = brg_.M;
@@ -1294,6 +1363,12 @@ status_t jit_int8_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
 
     const auto &b = pd()->get_b();
+
+    // The dynamic src scales are an output computed while copying A.
+    float *src_dyn_scales = b.is_src_dyn_quant
+            ? CTX_OUT_MEM(float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC)
+            : nullptr;
+    if (b.is_src_dyn_quant) src_scales = src_dyn_scales;
     const auto &d = pd()->get_d();
 
     const auto &scratchpad = ctx.get_scratchpad_grantor();
@@ -1668,9 +1743,21 @@ status_t jit_int8_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
             });
     };
 
+    auto quantize_a = [&]() {
+        if (pd()->src_md()->data_type == data_type::bf16)
+            quantize_a_s8<data_type::bf16>(src_b, (int8_t *)src,
+                    src_dyn_scales, M, K, b.m_blk, b.k_blk);
+        else
+            quantize_a_s8<data_type::f32>(src_b, (int8_t *)src,
+                    src_dyn_scales, M, K, b.m_blk, b.k_blk);
+    };
+
     if (b.b_reo) reorder_b();
 
-    reorder_a();
+    if (b.is_src_dyn_quant)
+        quantize_a();
+    else
+        reorder_a();
 
     if (b.zp_type_a != jit_int8_broadcast_t::none
             || b.zp_type_b != jit_int8_broadcast_t::none)
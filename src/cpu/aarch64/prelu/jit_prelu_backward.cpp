@@ -0,0 +1,236 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/aarch64/prelu/jit_prelu_backward.hpp"
+#include "cpu/aarch64/prelu/jit_prelu_utils.hpp"
+#include "cpu/aarch64/prelu/jit_uni_prelu_backward_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+static constexpr dim_t alignment = platform::get_cache_line_size()
+        / sizeof(float); // align to cache line size to avoid false sharing
+
+status_t jit_prelu_bwd_t::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper src_d {src_md(0)};
+    const memory_desc_wrapper weights_d {weights_md(0)};
+    const memory_desc_wrapper src_diff_d {diff_src_md(0)};
+    const memory_desc_wrapper weights_diff_d {diff_weights_md(0)};
+    const memory_desc_wrapper dst_diff_d {diff_dst_md(0)};
+
+    VDISPATCH_PRELU(!is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_PRELU(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "src");
+    VDISPATCH_PRELU(prelu::get_supported_isa() != isa_undef,
+            VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_PRELU(
+            prelu::dt_supported({src_d.data_type(), weights_d.data_type(),
+                    src_diff_d.data_type(), weights_diff_d.data_type(),
+                    dst_diff_d.data_type()}),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_PRELU(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_PRELU(src_d.is_dense(true), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_PRELU(weights_d.is_dense(true), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_PRELU(src_diff_d.is_dense(true), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_PRELU(
+            weights_diff_d.is_dense(true), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_PRELU(dst_diff_d.is_dense(true), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_PRELU(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_PRELU(dst_diff_d == src_diff_d, VERBOSE_INCONSISTENT_MDS,
+            "diff_dst", "diff_src");
+    VDISPATCH_PRELU(src_d == src_diff_d, VERBOSE_INCONSISTENT_MDS, "src",
+            "diff_src");
+    VDISPATCH_PRELU(weights_d == weights_diff_d, VERBOSE_INCONSISTENT_MDS,
+            "weights", "diff_weights");
+
+    const auto bcast = prelu::get_bcast_type(src_diff_d, weights_diff_d);
+    VDISPATCH_PRELU(prelu::bcast_supported(bcast, src_diff_d, weights_diff_d,
+                            prelu::get_simd_w()),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+
+    nthr_ = dnnl_get_max_threads();
+    if (bcast != prelu::bcast::full) {
+        auto scratchpad = scratchpad_registry().registrar();
+        const dim_t C = src_diff_d.dims()[1];
+        scratchpad.book<float>(memory_tracking::names::key_prelu_reduction,
+                nthr_ * utils::rnd_up(C, alignment));
+    }
+
+    return status::success;
+}
+
+const jit_prelu_bwd_t::pd_t *jit_prelu_bwd_t::pd() const {
+    return static_cast<const pd_t *>(primitive_t::pd().get());
+}
+
+jit_prelu_bwd_t::jit_prelu_bwd_t(const pd_t *apd) : primitive_t(apd) {}
+jit_prelu_bwd_t::~jit_prelu_bwd_t() = default;
+
+status_t jit_prelu_bwd_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_,
+            new jit_uni_prelu_backward_kernel_t(
+                    pd(), prelu::get_supported_isa())));
+    return kernel_->create_kernel();
+}
+
+status_t jit_prelu_bwd_t::execute(const exec_ctx_t &ctx) const {
+    const float *const src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const float *const weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    const float *const dst_diff = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    float *const weights_diff = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_WEIGHTS);
+    float *const src_diff = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SRC);
+    const memory_desc_wrapper src_d {pd()->src_md(0)};
+
+    const auto kernel = kernel_.get();
+    const auto bcast = kernel->get_bcast();
+    const dim_t simd_w = kernel->simd_w();
+    const int nthr = pd()->nthr_;
+
+    using call_params_t = jit_uni_prelu_backward_kernel_t::call_params_t;
+
+    if (bcast == prelu::bcast::full) {
+        const dim_t nelems = src_d.nelems(true);
+        const dim_t nelems_parallel = utils::div_up(nelems, simd_w);
+
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            dim_t start = 0, end = 0;
+            balance211(nelems_parallel, nthr, ithr, start, end);
+            if (start >= end) return;
+
+            const dim_t offset = start * simd_w;
+            call_params_t params;
+            params.compute_data_size
+                    = nstl::min(nelems, end * simd_w) - offset;
+            params.src = src + offset;
+            params.weights = weights + offset;
+            params.dst_diff = dst_diff + offset;
+            params.src_diff = src_diff + offset;
+            params.weights_diff = weights_diff + offset;
+            (*kernel)(&params);
+        });
+        return status::success;
+    }
+
+    const auto ndims = src_d.ndims();
+    const auto &dims = src_d.dims();
+    const dim_t MB = dims[0];
+    const dim_t C = dims[1];
+    const dim_t D = ndims >= 5 ? dims[ndims - 3] : 1;
+    const dim_t H = ndims >= 4 ? dims[ndims - 2] : 1;
+    const dim_t W = ndims >= 3 ? dims[ndims - 1] : 1;
+    const dim_t SP = D * H * W;
+    const dim_t nelems_single_mb
+            = utils::array_product(src_d.padded_dims() + 1, ndims - 1);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *const weights_diff_scratchpad = scratchpad.template get<float>(
+            memory_tracking::names::key_prelu_reduction);
+    const dim_t C_cache_line_aligned = utils::rnd_up(C, alignment);
+    size_t work_amount = 0;
+
+    parallel(nthr, [&](const int ithr, const int) {
+        std::memset(weights_diff_scratchpad + ithr * C_cache_line_aligned, 0,
+                C_cache_line_aligned * sizeof(float));
+    });
+
+    if (bcast == prelu::bcast::per_oc_blocked) {
+        const dim_t C_blocks = utils::div_up(C, simd_w);
+        work_amount = MB * C_blocks;
+        parallel_nd_ext(nthr, MB, C_blocks,
+                [&](int ithr, int, dim_t mb, dim_t c_blk) {
+            const dim_t offset = mb * nelems_single_mb + c_blk * SP * simd_w;
+            call_params_t params;
+            params.compute_data_size = SP * simd_w;
+            params.src = src + offset;
+            params.dst_diff = dst_diff + offset;
+            params.src_diff = src_diff + offset;
+            params.weights = weights + c_blk * simd_w;
+            params.weights_diff = weights_diff_scratchpad
+                    + ithr * C_cache_line_aligned + c_blk * simd_w;
+            (*kernel)(&params);
+        });
+    } else if (bcast == prelu::bcast::per_oc_n_c_spatial) {
+        work_amount = MB * C;
+        parallel_nd_ext(nthr, MB, C, [&](int ithr, int, dim_t mb, dim_t c) {
+            const dim_t offset = mb * nelems_single_mb + c * SP;
+            call_params_t params;
+            params.compute_data_size = SP;
+            params.src = src + offset;
+            params.dst_diff = dst_diff + offset;
+            params.src_diff = src_diff + offset;
+            params.weights = weights + c;
+            params.weights_diff
+                    = weights_diff_scratchpad + ithr * C_cache_line_aligned + c;
+            (*kernel)(&params);
+        });
+    } else if (bcast == prelu::bcast::per_oc_n_spatial_c) {
+        work_amount = MB * SP;
+        parallel_nd_ext(nthr, MB, SP, [&](int ithr, int, dim_t mb, dim_t sp) {
+            const dim_t offset = mb * nelems_single_mb + sp * C;
+            call_params_t params;
+            params.compute_data_size = C;
+            params.src = src + offset;
+            params.dst_diff = dst_diff + offset;
+            params.src_diff = src_diff + offset;
+            params.weights = weights;
+            params.weights_diff
+                    = weights_diff_scratchpad + ithr * C_cache_line_aligned;
+            (*kernel)(&params);
+        });
+    }
+
+    const memory_desc_wrapper weights_diff_d {pd()->diff_weights_md(0)};
+    const size_t reduction_blocks = nstl::min(work_amount, (size_t)nthr);
+    scratchpad_to_diff_weights_reduction(weights_diff_scratchpad,
+            weights_diff, C, weights_diff_d.padded_dims()[1],
+            reduction_blocks);
+
+    return status::success;
+}
+
+void jit_prelu_bwd_t::scratchpad_to_diff_weights_reduction(
+        const float *scratchpad, float *weights_diff, dim_t C, dim_t C_padded,
+        size_t reduction_blocks) const {
+    const dim_t C_cache_line_aligned = utils::rnd_up(C, alignment);
+    const dim_t C_blocks = utils::div_up(C_padded, alignment);
+
+    parallel_nd(C_blocks, [&](dim_t c_blk) {
+        const dim_t c_start = c_blk * alignment;
+        const dim_t c_end = nstl::min(c_start + alignment, C_padded);
+        for (dim_t c = c_start; c < c_end; c++) {
+            float sum = 0.f;
+            if (c < C) {
+                for (size_t i = 0; i < reduction_blocks; i++)
+                    sum += scratchpad[i * C_cache_line_aligned + c];
+            }
+            weights_diff[c] = sum;
+        }
+    });
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
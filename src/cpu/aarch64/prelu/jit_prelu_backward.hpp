@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_PRELU_JIT_PRELU_BACKWARD_HPP
+#define CPU_AARCH64_PRELU_JIT_PRELU_BACKWARD_HPP
+
+#include <memory>
+
+#include "common/primitive.hpp"
+#include "cpu/cpu_prelu_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+class jit_uni_prelu_backward_kernel_t;
+
+class jit_prelu_bwd_t : public primitive_t {
+public:
+    struct pd_t : public cpu_prelu_bwd_pd_t {
+    public:
+        using cpu_prelu_bwd_pd_t::cpu_prelu_bwd_pd_t;
+        DECLARE_COMMON_PD_T("jit_uni", jit_prelu_bwd_t);
+        status_t init(engine_t *engine);
+        int nthr_; // To not exceed the limit in execute used for set up.
+    };
+
+    jit_prelu_bwd_t(const pd_t *apd);
+    ~jit_prelu_bwd_t() override;
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    // Sums the per-thread partial diff weights from the scratchpad into the
+    // diff weights tensor and zeroes its padded channels
+    void scratchpad_to_diff_weights_reduction(const float *scratchpad,
+            float *weights_diff, dim_t C, dim_t C_padded,
+            size_t reduction_blocks) const;
+    const pd_t *pd() const;
+    std::unique_ptr<jit_uni_prelu_backward_kernel_t> kernel_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
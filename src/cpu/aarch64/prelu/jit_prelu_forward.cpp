@@ -0,0 +1,151 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdlib>
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/aarch64/prelu/jit_prelu_forward.hpp"
+#include "cpu/aarch64/prelu/jit_prelu_utils.hpp"
+#include "cpu/aarch64/prelu/jit_uni_prelu_forward_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+status_t jit_prelu_fwd_t::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper src_d {src_md(0)};
+    const memory_desc_wrapper weights_d {weights_md(0)};
+    const memory_desc_wrapper dst_d {dst_md(0)};
+
+    VDISPATCH_PRELU(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_PRELU(prelu::get_supported_isa() != isa_undef,
+            VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_PRELU(prelu::dt_supported({src_d.data_type(),
+                            weights_d.data_type(), dst_d.data_type()}),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_PRELU(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_PRELU(
+            prelu::bcast_supported(prelu::get_bcast_type(src_d, weights_d),
+                    src_d, weights_d, prelu::get_simd_w()),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_PRELU(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "src");
+    VDISPATCH_PRELU(src_d.is_dense(true), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_PRELU(weights_d.is_dense(true), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_PRELU(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_PRELU(dst_d == src_d, VERBOSE_INCONSISTENT_MDS, "src", "dst");
+
+    return status::success;
+}
+
+const jit_prelu_fwd_t::pd_t *jit_prelu_fwd_t::pd() const {
+    return static_cast<const pd_t *>(primitive_t::pd().get());
+}
+
+jit_prelu_fwd_t::jit_prelu_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+jit_prelu_fwd_t::~jit_prelu_fwd_t() = default;
+
+status_t jit_prelu_fwd_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_,
+            new jit_uni_prelu_forward_kernel_t(
+                    pd(), prelu::get_supported_isa())));
+    return kernel_->create_kernel();
+}
+
+status_t jit_prelu_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const float *const src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const float *const weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    float *const dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+    const memory_desc_wrapper src_d {pd()->src_md(0)};
+
+    const auto kernel = kernel_.get();
+    const auto bcast = kernel->get_bcast();
+    const dim_t simd_w = kernel->simd_w();
+    const auto ndims = src_d.ndims();
+    const dim_t MB = pd()->N();
+    const dim_t C = pd()->C();
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+
+    using call_params_t = jit_uni_prelu_forward_kernel_t::call_params_t;
+
+    if (bcast == prelu::bcast::full) {
+        const dim_t nelems = src_d.nelems(true);
+        const dim_t nelems_parallel = utils::div_up(nelems, simd_w);
+
+        parallel(0, [&](const int ithr, const int nthr) {
+            dim_t start = 0, end = 0;
+            balance211(nelems_parallel, nthr, ithr, start, end);
+            if (start >= end) return;
+
+            const dim_t offset = start * simd_w;
+            call_params_t params;
+            params.compute_data_size
+                    = nstl::min(nelems, end * simd_w) - offset;
+            params.src = src + offset;
+            params.weights = weights + offset;
+            params.dst = dst + offset;
+            (*kernel)(&params);
+        });
+        return status::success;
+    }
+
+    const dim_t nelems_single_mb
+            = utils::array_product(src_d.padded_dims() + 1, ndims - 1);
+
+    if (bcast == prelu::bcast::per_oc_n_spatial_c) {
+        parallel_nd(MB, SP, [&](dim_t mb, dim_t sp) {
+            const dim_t offset = mb * nelems_single_mb + sp * C;
+            call_params_t params;
+            params.compute_data_size = C;
+            params.src = src + offset;
+            params.weights = weights;
+            params.dst = dst + offset;
+            (*kernel)(&params);
+        });
+    } else if (bcast == prelu::bcast::per_oc_n_c_spatial) {
+        parallel_nd(MB, C, [&](dim_t mb, dim_t c) {
+            const dim_t offset = mb * nelems_single_mb + c * SP;
+            call_params_t params;
+            params.compute_data_size = SP;
+            params.src = src + offset;
+            params.weights = weights + c;
+            params.dst = dst + offset;
+            (*kernel)(&params);
+        });
+    } else if (bcast == prelu::bcast::per_oc_blocked) {
+        const dim_t C_blocks = utils::div_up(C, simd_w);
+
+        parallel_nd(MB, C_blocks, [&](dim_t mb, dim_t c_blk) {
+            const dim_t offset = mb * nelems_single_mb + c_blk * SP * simd_w;
+            call_params_t params;
+            params.compute_data_size = SP * simd_w;
+            params.src = src + offset;
+            params.weights = weights + c_blk * simd_w;
+            params.dst = dst + offset;
+            (*kernel)(&params);
+        });
+    }
+
+    return status::success;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
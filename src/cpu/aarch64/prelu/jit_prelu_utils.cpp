@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/memory_desc_wrapper.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/prelu/jit_prelu_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+namespace prelu {
+
+cpu_isa_t get_supported_isa() {
+    if (mayiuse(sve_512))
+        return sve_512;
+    else if (mayiuse(sve_256))
+        return sve_256;
+    else if (mayiuse(sve_128))
+        return sve_128;
+    return isa_undef;
+}
+
+int get_simd_w() noexcept {
+    return isa_max_vlen(get_supported_isa()) / sizeof(float);
+}
+
+static bool dims_equal(
+        const dims_t &lhs_dims, const dims_t &rhs_dims, const dim_t ndims) {
+
+    for (dim_t i = 0; i < ndims; ++i) {
+        if (lhs_dims[i] != rhs_dims[i]) return false;
+    }
+
+    return true;
+}
+
+static bool is_full_bcast(
+        const memory_desc_wrapper &lhs, const memory_desc_wrapper &rhs) {
+    const auto lhs_ndims = lhs.ndims();
+    const auto rhs_ndims = rhs.ndims();
+    const dims_t &lhs_dims = lhs.dims();
+    const dims_t &rhs_dims = rhs.dims();
+
+    if (lhs_ndims == rhs_ndims && dims_equal(lhs_dims, rhs_dims, lhs_ndims)
+            && lhs.format_kind() == rhs.format_kind()) {
+
+        if (lhs.is_blocking_desc()) {
+            const auto &lhs_bd = lhs.blocking_desc();
+            const auto &rhs_bd = rhs.blocking_desc();
+
+            return lhs_bd.inner_nblks == rhs_bd.inner_nblks
+                    && dims_equal(lhs_bd.strides, rhs_bd.strides, lhs_ndims)
+                    && dims_equal(
+                            lhs_bd.inner_blks, rhs_bd.inner_blks, lhs_ndims)
+                    && dims_equal(
+                            lhs_bd.inner_idxs, rhs_bd.inner_idxs, lhs_ndims);
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+static bool is_per_oc_bcast(
+        const memory_desc_wrapper &lhs, const memory_desc_wrapper &rhs) {
+
+    const auto &rhs_dims = rhs.dims();
+    const auto &lhs_dims = lhs.dims();
+    const auto &rhs_ndims = rhs.ndims();
+
+    bool bcast_per_oc_exists = rhs_dims[0] == 1 && rhs_dims[1] == lhs_dims[1];
+
+    for (int dim_id = 2; dim_id < rhs_ndims; ++dim_id)
+        bcast_per_oc_exists = bcast_per_oc_exists && rhs_dims[dim_id] == 1;
+
+    return bcast_per_oc_exists;
+}
+
+bcast get_bcast_type(
+        const memory_desc_wrapper &lhs, const memory_desc_wrapper &rhs) {
+
+    if (is_full_bcast(lhs, rhs)) return bcast::full;
+    const auto &lhs_ndims = lhs.ndims();
+    const auto &rhs_ndims = rhs.ndims();
+
+    if (lhs_ndims != rhs_ndims || lhs_ndims < 2) return bcast::unsupported;
+
+    if (is_per_oc_bcast(lhs, rhs)) {
+        const auto &strides = lhs.blocking_desc().strides;
+
+        if (!lhs.is_plain())
+            return bcast::per_oc_blocked;
+        else if (strides[1] == 1)
+            return bcast::per_oc_n_spatial_c;
+        else if (strides[0] >= strides[1]
+                && IMPLICATION(lhs_ndims >= 3, strides[1] >= strides[2]))
+            return bcast::per_oc_n_c_spatial;
+    }
+
+    return bcast::unsupported;
+}
+
+bool dt_supported(const std::set<data_type_t> &tensor_data_types) noexcept {
+    for (auto dt : tensor_data_types)
+        if (dt != data_type::f32) return false;
+
+    return true;
+}
+
+bool bcast_supported(const bcast &bcast, const memory_desc_wrapper &data_d,
+        const memory_desc_wrapper &weights_d, int simd_w) {
+
+    if (bcast == bcast::full)
+        return true;
+    else if (bcast == bcast::unsupported)
+        return false;
+    else if (bcast == bcast::per_oc_blocked) {
+        const auto check_block_consistency
+                = [&](const memory_desc_wrapper &mdw) {
+            const auto &bd = mdw.blocking_desc();
+
+            return bd.inner_nblks == 1 && bd.inner_blks[0] == simd_w
+                    && bd.inner_idxs[0] == 1;
+        };
+
+        return check_block_consistency(data_d)
+                && check_block_consistency(weights_d);
+    }
+
+    const auto &data_strides = data_d.blocking_desc().strides;
+    const auto &weights_strides = weights_d.blocking_desc().strides;
+    // C should be on second position in tag (example nchw or ncw) or on
+    // last postion (nhwc)
+    return data_strides[0] >= data_strides[1]
+            && IMPLICATION(
+                    data_strides[1] > 1, data_strides[1] >= data_strides[2])
+            && weights_strides[0] >= weights_strides[1];
+}
+
+} // namespace prelu
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_PRELU_JIT_PRELU_UTILS_HPP
+#define CPU_AARCH64_PRELU_JIT_PRELU_UTILS_HPP
+
+#include <set>
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct memory_desc_wrapper;
+
+namespace cpu {
+namespace aarch64 {
+namespace prelu {
+
+enum class bcast {
+    full,
+    per_oc_blocked,
+    per_oc_n_spatial_c,
+    per_oc_n_c_spatial,
+    unsupported
+};
+
+bcast get_bcast_type(
+        const memory_desc_wrapper &lhs, const memory_desc_wrapper &rhs);
+cpu_isa_t get_supported_isa();
+bool dt_supported(const std::set<data_type_t> &tensor_data_types) noexcept;
+int get_simd_w() noexcept;
+// Checks that the layouts of data and weights can be handled for a given
+// broadcast strategy
+bool bcast_supported(const bcast &bcast, const memory_desc_wrapper &data_d,
+        const memory_desc_wrapper &weights_d, int simd_w);
+
+} // namespace prelu
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,108 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_PRELU_JIT_UNI_PRELU_BACKWARD_KERNEL_HPP
+#define CPU_AARCH64_PRELU_JIT_UNI_PRELU_BACKWARD_KERNEL_HPP
+
+#include "cpu/cpu_prelu_pd.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/prelu/jit_prelu_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Computes over compute_data_size f32 elements
+//     diff_src = src > 0 ? diff_dst : diff_dst * weights
+//     diff_weights = src > 0 ? 0 : diff_dst * src
+// For the full broadcast diff_weights are stored directly. For the per-oc
+// broadcasts weights_diff points to f32 per-thread accumulators in the
+// scratchpad: one per channel for per_oc_n_spatial_c, or a single channel
+// (per_oc_n_c_spatial) or channel block (per_oc_blocked) to which the sum
+// over the processed elements is added.
+class jit_uni_prelu_backward_kernel_t : public jit_generator_t {
+public:
+    struct call_params_t {
+        const void *src = nullptr, *weights = nullptr, *dst_diff = nullptr;
+        void *src_diff = nullptr, *weights_diff = nullptr;
+        size_t compute_data_size = 0u;
+    };
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_prelu_backward_kernel_t)
+
+    jit_uni_prelu_backward_kernel_t(
+            const cpu_prelu_bwd_pd_t *pd, const cpu_isa_t &isa);
+
+    void operator()(call_params_t *params) {
+        jit_generator_t::operator()(params);
+    }
+
+    size_t simd_w() const noexcept { return simd_w_; }
+    prelu::bcast get_bcast() const noexcept { return bcast_; }
+
+private:
+    void generate() override;
+    void compute_dst(size_t unrolling_factor, const Xbyak_aarch64::PReg &p);
+    void advance_ptrs(size_t nelems);
+    bool weights_const() const noexcept;
+
+    Xbyak_aarch64::ZReg vmm_src(size_t i) const {
+        return Xbyak_aarch64::ZReg(i);
+    }
+    Xbyak_aarch64::ZReg vmm_dst_diff(size_t i) const {
+        return Xbyak_aarch64::ZReg(unroll_max_ + i);
+    }
+    Xbyak_aarch64::ZReg vmm_weights(size_t i) const {
+        return weights_const() ? vmm_weights_const_
+                               : Xbyak_aarch64::ZReg(2 * unroll_max_ + i);
+    }
+    Xbyak_aarch64::ZReg vmm_src_diff(size_t i) const {
+        return Xbyak_aarch64::ZReg(3 * unroll_max_ + i);
+    }
+    Xbyak_aarch64::ZReg vmm_weights_diff(size_t i) const {
+        return Xbyak_aarch64::ZReg(4 * unroll_max_ + i);
+    }
+
+    static constexpr size_t unroll_max_ = 4;
+
+    const size_t simd_w_;
+    const prelu::bcast bcast_;
+
+    const Xbyak_aarch64::XReg reg_src_ = x1;
+    const Xbyak_aarch64::XReg reg_weights_ = x2;
+    const Xbyak_aarch64::XReg reg_dst_diff_ = x3;
+    const Xbyak_aarch64::XReg reg_src_diff_ = x4;
+    const Xbyak_aarch64::XReg reg_weights_diff_ = x5;
+    const Xbyak_aarch64::XReg reg_data_size_ = x6;
+
+    const Xbyak_aarch64::PReg p_vl_ = p1;
+    const Xbyak_aarch64::PReg p_tail_ = p2;
+    const Xbyak_aarch64::PReg p_pos_ = p3;
+
+    const Xbyak_aarch64::ZReg vmm_zeros_ = z29;
+    const Xbyak_aarch64::ZReg vmm_weights_diff_acc_ = z30;
+    const Xbyak_aarch64::ZReg vmm_weights_const_ = z31;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/memory_desc_wrapper.hpp"
+
+#include "cpu/aarch64/prelu/jit_uni_prelu_forward_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+#define GET_OFF(field) static_cast<int32_t>(offsetof(call_params_t, field))
+
+jit_uni_prelu_forward_kernel_t::jit_uni_prelu_forward_kernel_t(
+        const cpu_prelu_fwd_pd_t *pd, const cpu_isa_t &isa)
+    : simd_w_(isa_max_vlen(isa) / sizeof(float))
+    , bcast_(prelu::get_bcast_type(memory_desc_wrapper(pd->src_md(0)),
+              memory_desc_wrapper(pd->weights_md(0)))) {}
+
+bool jit_uni_prelu_forward_kernel_t::weights_const() const noexcept {
+    return utils::one_of(bcast_, prelu::bcast::per_oc_n_c_spatial,
+            prelu::bcast::per_oc_blocked);
+}
+
+void jit_uni_prelu_forward_kernel_t::advance_ptrs(size_t nelems) {
+    const size_t bytes = nelems * sizeof(float);
+    add_imm(reg_src_, reg_src_, bytes, X_TMP_0);
+    add_imm(reg_dst_, reg_dst_, bytes, X_TMP_0);
+    if (!weights_const()) add_imm(reg_weights_, reg_weights_, bytes, X_TMP_0);
+    sub_imm(reg_data_size_, reg_data_size_, nelems, X_TMP_0);
+}
+
+void jit_uni_prelu_forward_kernel_t::compute_dst(
+        size_t unrolling_factor, const PReg &p) {
+    const size_t vlen = simd_w_ * sizeof(float);
+
+    auto addr = [&](const XReg &base, size_t i) -> XReg {
+        if (i == 0) return base;
+        add_imm(X_DEFAULT_ADDR, base, i * vlen, X_TMP_0);
+        return X_DEFAULT_ADDR;
+    };
+
+    for (size_t i = 0; i < unrolling_factor; i++) {
+        ld1w(vmm_src(i).s, p / T_z, ptr(addr(reg_src_, i)));
+        if (!weights_const())
+            ld1w(vmm_weights(i).s, p / T_z, ptr(addr(reg_weights_, i)));
+    }
+
+    for (size_t i = 0; i < unrolling_factor; i++) {
+        fmul(vmm_tmp(i).s, vmm_src(i).s, vmm_weights(i).s);
+        fcmlt(p_neg_.s, p / T_z, vmm_src(i).s, 0.0);
+        mov(vmm_src(i).s, p_neg_ / T_m, vmm_tmp(i).s);
+        st1w(vmm_src(i).s, p, ptr(addr(reg_dst_, i)));
+    }
+}
+
+void jit_uni_prelu_forward_kernel_t::generate() {
+    preamble();
+
+    ldr(reg_src_, ptr(abi_param1, GET_OFF(src)));
+    ldr(reg_weights_, ptr(abi_param1, GET_OFF(weights)));
+    ldr(reg_dst_, ptr(abi_param1, GET_OFF(dst)));
+    ldr(reg_data_size_, ptr(abi_param1, GET_OFF(compute_data_size)));
+
+    // The predicate covers a single vector of the isa which may be shorter
+    // than the hardware vector length
+    set_preg(p_vl_.s, simd_w_);
+
+    if (bcast_ == prelu::bcast::per_oc_n_c_spatial)
+        ld1rw(vmm_weights_const_.s, p_vl_ / T_z, ptr(reg_weights_));
+    else if (bcast_ == prelu::bcast::per_oc_blocked)
+        ld1w(vmm_weights_const_.s, p_vl_ / T_z, ptr(reg_weights_));
+
+    Label unroll_loop, unroll_loop_end, single_loop, single_loop_end, end;
+
+    L(unroll_loop);
+    {
+        mov_imm(X_TMP_0, unroll_max_ * simd_w_);
+        cmp(reg_data_size_, X_TMP_0);
+        b(LT, unroll_loop_end);
+        compute_dst(unroll_max_, p_vl_);
+        advance_ptrs(unroll_max_ * simd_w_);
+        b(unroll_loop);
+    }
+    L(unroll_loop_end);
+
+    L(single_loop);
+    {
+        cmp_imm(reg_data_size_, simd_w_, X_TMP_0);
+        b(LT, single_loop_end);
+        compute_dst(1, p_vl_);
+        advance_ptrs(simd_w_);
+        b(single_loop);
+    }
+    L(single_loop_end);
+
+    cbz(reg_data_size_, end);
+    mov_imm(X_TMP_1, 0);
+    whilelt(p_tail_.s, X_TMP_1, reg_data_size_);
+    compute_dst(1, p_tail_);
+
+    L(end);
+    postamble();
+}
+
+#undef GET_OFF
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
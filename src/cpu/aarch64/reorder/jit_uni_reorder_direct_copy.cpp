@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/reorder/jit_uni_reorder_direct_copy.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+status_t jit_uni_reorder_direct_copy_t::pd_t::create(reorder_pd_t **reorder_pd,
+        engine_t *engine, const primitive_attr_t *attr, engine_t *src_engine,
+        const memory_desc_t *src_md, engine_t *dst_engine,
+        const memory_desc_t *dst_md) {
+    auto _pd = make_unique_pd<pd_t>(
+            attr, src_engine->kind(), src_md, dst_engine->kind(), dst_md);
+    if (_pd == nullptr) return status::out_of_memory;
+
+    CHECK(_pd->init(engine, src_engine, dst_engine));
+    CHECK(_pd->init_scratchpad_md());
+
+    return safe_ptr_assign(*reorder_pd, _pd.release());
+}
+
+status_t jit_uni_reorder_direct_copy_t::pd_t::init(
+        engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
+    using namespace data_type;
+
+    VDISPATCH_REORDER(is_dense_format_kind({src_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const auto src_dt = src_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_REORDER(!src_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(!dst_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(
+            src_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_REORDER(
+            dst_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_REORDER(jit_cvt_xf16_t::is_supported(src_dt, dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+
+    // Direct copy operates only on identical formats.
+    VDISPATCH_REORDER(src_d.similar_to(dst_d, true, false, 0),
+            VERBOSE_TENSOR_FORMAT_MISMATCH, "src", "dst");
+    VDISPATCH_REORDER(IMPLICATION(src_d.is_plain(), src_d.is_dense()),
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "src");
+    VDISPATCH_REORDER(src_d.extra().flags == 0 && dst_d.extra().flags == 0,
+            VERBOSE_UNSUPPORTED_MD_FLAG, "src or dst");
+    VDISPATCH_REORDER(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+    return status::success;
+}
+
+status_t jit_uni_reorder_direct_copy_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_,
+            new jit_cvt_xf16_t(
+                    pd()->src_md()->data_type, pd()->dst_md()->data_type)));
+    return status::success;
+}
+
+status_t jit_uni_reorder_direct_copy_t::execute(const exec_ctx_t &ctx) const {
+    const auto in = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
+    auto out = CTX_OUT_MEM(char *, DNNL_ARG_TO);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto src_dt_size = src_d.data_type_size();
+    const auto dst_dt_size = dst_d.data_type_size();
+    const dim_t nelems = src_d.nelems(true);
+
+    // Chunks are big enough to amortize the call of the kernel and to keep
+    // the hardware prefetchers busy; small tensors are converted by a
+    // single thread.
+    const dim_t chunk = 4096;
+    const dim_t nchunks = utils::div_up(nelems, chunk);
+    const int nthr = nchunks == 1 ? 1 : 0;
+
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nchunks, nthr, ithr, start, end);
+        start = nstl::min(nelems, start * chunk);
+        end = nstl::min(nelems, end * chunk);
+        if (start == end) return;
+
+        (*kernel_)(out + (start + dst_d.offset0()) * dst_dt_size,
+                in + (start + src_d.offset0()) * src_dt_size, end - start);
+    });
+
+    return status::success;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
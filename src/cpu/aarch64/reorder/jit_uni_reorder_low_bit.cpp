@@ -0,0 +1,596 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/float4.hpp"
+#include "common/float8.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/aarch64/reorder/jit_uni_reorder_low_bit.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+using namespace low_bit_support;
+
+#define GET_OFF(field) static_cast<int32_t>(offsetof(jit_call_t, field))
+
+namespace {
+
+cpu_isa_t get_supported_isa() {
+    if (mayiuse(sve_512)) return sve_512;
+    if (mayiuse(sve_256)) return sve_256;
+    if (mayiuse(sve_128)) return sve_128;
+
+    return isa_undef;
+}
+
+bool is_sub_byte(data_type_t dt) {
+    using namespace data_type;
+    return utils::one_of(dt, s4, u4, f4_e2m1, f4_e3m0);
+}
+
+bool is_low_bit(data_type_t dt) {
+    using namespace data_type;
+    return is_sub_byte(dt) || utils::one_of(dt, f8_e5m2, f8_e4m3);
+}
+
+// Size in bytes of `nelems` elements, which must be even for sub-byte types
+size_t bytes(data_type_t dt, size_t nelems) {
+    return is_sub_byte(dt) ? nelems / 2 : nelems * types::data_type_size(dt);
+}
+
+} // namespace
+
+jit_uni_low_bit_cvt_kernel_t::jit_uni_low_bit_cvt_kernel_t(cpu_isa_t isa,
+        data_type_t src_dt, data_type_t dst_dt, scale_kind_t scale_kind)
+    : simd_w_(isa_max_vlen(isa) / sizeof(float))
+    , src_dt_(src_dt)
+    , dst_dt_(dst_dt)
+    , scale_kind_(scale_kind)
+    , is_decode_(is_low_bit(src_dt))
+    , is_sub_byte_(is_sub_byte(is_decode_ ? src_dt : dst_dt))
+    , elems_per_vec_(is_sub_byte_ ? 2 * simd_w_ : simd_w_) {}
+
+XReg jit_uni_low_bit_cvt_kernel_t::addr(const XReg &base, size_t offt) {
+    if (offt == 0) return base;
+    add_imm(X_DEFAULT_ADDR, base, offt, X_TMP_0);
+    return X_DEFAULT_ADDR;
+}
+
+void jit_uni_low_bit_cvt_kernel_t::store_xf16(const ZReg &z) {
+    if (dst_dt_ == data_type::bf16)
+        bfcvt(z.h, p_vl_ / T_m, z.s);
+    else
+        fcvt(z.h, p_vl_ / T_m, z.s);
+}
+
+void jit_uni_low_bit_cvt_kernel_t::load_f32(
+        const ZReg &z, const PReg &p, const XReg &addr) {
+    switch (src_dt_) {
+        case data_type::bf16:
+            ld1h(z.s, p / T_z, ptr(addr));
+            lsl(z.s, z.s, 16);
+            break;
+        case data_type::f16:
+            ld1h(z.s, p / T_z, ptr(addr));
+            fcvt(z.s, p_vl_ / T_m, z.h);
+            break;
+        default: ld1w(z.s, p / T_z, ptr(addr)); break;
+    }
+}
+
+void jit_uni_low_bit_cvt_kernel_t::decode(int unroll, const PReg &p) {
+    const size_t dst_vlen = bytes(dst_dt_, elems_per_vec_);
+    const size_t scales_vlen = elems_per_vec_ * sizeof(float);
+
+    // The even and odd elements of sub-byte values are kept in the pairs of
+    // registers z(2i) and z(2i + 1), their scales in z(8 + 2i) and
+    // z(9 + 2i); other types only use the first register of a pair.
+    for (int i = 0; i < unroll; i++) {
+        const ZReg lo(2 * i);
+        const XReg a = addr(reg_src_, i * simd_w_);
+        if (src_dt_ == data_type::s4)
+            ld1sb(lo.s, p / T_z, ptr(a));
+        else
+            ld1b(lo.s, p / T_z, ptr(a));
+    }
+
+    for (int i = 0; i < unroll; i++) {
+        const ZReg lo(2 * i), hi(2 * i + 1);
+        switch (src_dt_) {
+            case data_type::s4:
+                // The high nibble keeps the sign of the byte
+                asr(hi.s, lo.s, 4);
+                lsl(lo.s, lo.s, 28);
+                asr(lo.s, lo.s, 28);
+                scvtf(lo.s, p_vl_ / T_m, lo.s);
+                scvtf(hi.s, p_vl_ / T_m, hi.s);
+                break;
+            case data_type::u4:
+                lsr(hi.s, lo.s, 4);
+                and_(lo.s, 0xf);
+                ucvtf(lo.s, p_vl_ / T_m, lo.s);
+                ucvtf(hi.s, p_vl_ / T_m, hi.s);
+                break;
+            case data_type::f4_e2m1:
+            case data_type::f4_e3m0:
+                lsr(hi.s, lo.s, 4);
+                and_(lo.s, 0xf);
+                ld1w(lo.s, p / T_z, ptr(reg_table_, lo.s, UXTW, 2));
+                ld1w(hi.s, p / T_z, ptr(reg_table_, hi.s, UXTW, 2));
+                break;
+            default:
+                ld1w(lo.s, p / T_z, ptr(reg_table_, lo.s, UXTW, 2));
+                break;
+        }
+    }
+
+    if (scale_kind_ == scale_kind_t::per_elem) {
+        for (int i = 0; i < unroll; i++) {
+            const ZReg s(8 + 2 * i);
+            const XReg a = addr(reg_scales_, i * scales_vlen);
+            // De-interleaves the scales of the even and odd elements
+            if (is_sub_byte_)
+                ld2w(s.s, p / T_z, ptr(a));
+            else
+                ld1w(s.s, p / T_z, ptr(a));
+        }
+    }
+
+    if (scale_kind_ != scale_kind_t::none) {
+        for (int i = 0; i < unroll; i++) {
+            const bool per_elem = scale_kind_ == scale_kind_t::per_elem;
+            const ZReg lo(2 * i), hi(2 * i + 1);
+            const ZReg s_lo = per_elem ? ZReg(8 + 2 * i) : z_scale_;
+            const ZReg s_hi = per_elem ? ZReg(9 + 2 * i) : z_scale_;
+            fmul(lo.s, lo.s, s_lo.s);
+            if (is_sub_byte_) fmul(hi.s, hi.s, s_hi.s);
+        }
+    }
+
+    for (int i = 0; i < unroll; i++) {
+        const ZReg lo(2 * i), hi(2 * i + 1);
+        const XReg a = addr(reg_dst_, i * dst_vlen);
+        if (dst_dt_ == data_type::f32) {
+            if (is_sub_byte_)
+                st2w(lo.s, p, ptr(a));
+            else
+                st1w(lo.s, p, ptr(a));
+            continue;
+        }
+
+        // The narrowing conversions zero the upper half of each element, so
+        // a pair of values is merged into a single word
+        store_xf16(lo);
+        if (is_sub_byte_) {
+            store_xf16(hi);
+            lsl(hi.s, hi.s, 16);
+            orr(lo.d, lo.d, hi.d);
+            st1w(lo.s, p, ptr(a));
+        } else {
+            st1h(lo.s, p, ptr(a));
+        }
+    }
+}
+
+void jit_uni_low_bit_cvt_kernel_t::round_to_e5m2(const ZReg &z) {
+    // Same rounding to nearest even of f16 values as float8_e5m2_t: NaN
+    // values become quiet and infinities are kept as is
+    mov(z_tmp0_.d, z.d);
+    and_(z_tmp0_.s, 0x7fff);
+    cmphs(p_special_.s, p_vl_ / T_z, z_tmp0_.s, z_f16_naninf_.s);
+    cmphi(p_nan_.s, p_vl_ / T_z, z_tmp0_.s, z_f16_naninf_.s);
+
+    lsr(z_tmp1_.s, z.s, 8);
+    and_(z_tmp1_.s, 0x1);
+    add(z_tmp1_.s, 0x7f);
+    add(z_tmp1_.s, z.s, z_tmp1_.s);
+    sel(z.s, p_special_, z.s, z_tmp1_.s);
+    lsr(z.s, z.s, 8);
+    orr(z.s, p_nan_ / T_m, z_e5m2_qbit_.s);
+}
+
+void jit_uni_low_bit_cvt_kernel_t::encode(int unroll, const PReg &p) {
+    const size_t src_vlen = bytes(src_dt_, elems_per_vec_);
+
+    if (!is_sub_byte_) {
+        for (int i = 0; i < unroll; i++) {
+            const ZReg z(2 * i);
+            const XReg a = addr(reg_src_, i * src_vlen);
+            if (src_dt_ == data_type::f16) {
+                ld1h(z.s, p / T_z, ptr(a));
+            } else {
+                load_f32(z, p, a);
+                fcvt(z.h, p_vl_ / T_m, z.s);
+            }
+        }
+        for (int i = 0; i < unroll; i++) {
+            const ZReg z(2 * i);
+            round_to_e5m2(z);
+            st1b(z.s, p, ptr(addr(reg_dst_, i * simd_w_)));
+        }
+        return;
+    }
+
+    // The even elements are converted in z(2i) and the odd ones in z(2i + 1)
+    for (int i = 0; i < unroll; i++) {
+        const ZReg lo(2 * i), hi(2 * i + 1);
+        const XReg a = addr(reg_src_, i * src_vlen);
+        switch (src_dt_) {
+            case data_type::bf16:
+                ld1w(lo.s, p / T_z, ptr(a));
+                mov(hi.d, lo.d);
+                and_(hi.s, 0xffff0000);
+                lsl(lo.s, lo.s, 16);
+                break;
+            case data_type::f16:
+                ld1w(lo.s, p / T_z, ptr(a));
+                lsr(hi.s, lo.s, 16);
+                fcvt(lo.s, p_vl_ / T_m, lo.h);
+                fcvt(hi.s, p_vl_ / T_m, hi.h);
+                break;
+            default: ld2w(lo.s, p / T_z, ptr(a)); break;
+        }
+    }
+
+    const bool is_signed = dst_dt_ == data_type::s4;
+    for (int i = 0; i < 2 * unroll; i++) {
+        const ZReg z(i);
+        frintn(z.s, p_vl_ / T_m, z.s);
+        fcvtzs(z.s, p_vl_ / T_m, z.s);
+        smax(z.s, is_signed ? -8 : 0);
+        smin(z.s, is_signed ? 7 : 15);
+    }
+
+    for (int i = 0; i < unroll; i++) {
+        const ZReg lo(2 * i), hi(2 * i + 1);
+        and_(lo.s, 0xf);
+        lsl(hi.s, hi.s, 4);
+        orr(lo.d, lo.d, hi.d);
+        st1b(lo.s, p, ptr(addr(reg_dst_, i * simd_w_)));
+    }
+}
+
+void jit_uni_low_bit_cvt_kernel_t::convert(int unroll, const PReg &p) {
+    if (is_decode_)
+        decode(unroll, p);
+    else
+        encode(unroll, p);
+}
+
+void jit_uni_low_bit_cvt_kernel_t::advance_ptrs(size_t nelems) {
+    add_imm(reg_src_, reg_src_, bytes(src_dt_, nelems), X_TMP_0);
+    add_imm(reg_dst_, reg_dst_, bytes(dst_dt_, nelems), X_TMP_0);
+    if (scale_kind_ == scale_kind_t::per_elem)
+        add_imm(reg_scales_, reg_scales_, nelems * sizeof(float), X_TMP_0);
+    sub_imm(reg_nelems_, reg_nelems_, nelems, X_TMP_0);
+}
+
+void jit_uni_low_bit_cvt_kernel_t::generate() {
+    preamble();
+
+    ldr(reg_src_, ptr(abi_param1, GET_OFF(src)));
+    ldr(reg_dst_, ptr(abi_param1, GET_OFF(dst)));
+    ldr(reg_scales_, ptr(abi_param1, GET_OFF(scales)));
+    ldr(reg_table_, ptr(abi_param1, GET_OFF(table)));
+    ldr(reg_nelems_, ptr(abi_param1, GET_OFF(nelems)));
+
+    // The predicate covers a single vector of the isa which may be shorter
+    // than the hardware vector length
+    set_preg(p_vl_.s, simd_w_);
+
+    if (scale_kind_ == scale_kind_t::common)
+        ld1rw(z_scale_.s, p_vl_ / T_z, ptr(reg_scales_));
+    if (!is_decode_ && !is_sub_byte_) {
+        mov_imm(W_TMP_0, 0x7c00);
+        dup(z_f16_naninf_.s, W_TMP_0);
+        dup(z_e5m2_qbit_.s, 0x2);
+    }
+
+    Label unroll_loop, unroll_loop_end, single_loop, single_loop_end, end;
+
+    L(unroll_loop);
+    {
+        mov_imm(X_TMP_0, unroll_max_ * elems_per_vec_);
+        cmp(reg_nelems_, X_TMP_0);
+        b(LO, unroll_loop_end);
+        convert(unroll_max_, p_vl_);
+        advance_ptrs(unroll_max_ * elems_per_vec_);
+        b(unroll_loop);
+    }
+    L(unroll_loop_end);
+
+    L(single_loop);
+    {
+        cmp_imm(reg_nelems_, elems_per_vec_, X_TMP_0);
+        b(LO, single_loop_end);
+        convert(1, p_vl_);
+        advance_ptrs(elems_per_vec_);
+        b(single_loop);
+    }
+    L(single_loop_end);
+
+    // The tail predicate is set over bytes of sub-byte values, i.e. over
+    // pairs of elements
+    cbz(reg_nelems_, end);
+    if (is_sub_byte_)
+        lsr(X_TMP_2, reg_nelems_, 1);
+    else
+        mov(X_TMP_2, reg_nelems_);
+    mov_imm(X_TMP_1, 0);
+    whilelo(p_tail_.s, X_TMP_1, X_TMP_2);
+    convert(1, p_tail_);
+
+    L(end);
+    postamble();
+}
+
+#undef GET_OFF
+
+bool jit_low_bit_cvt_t::is_supported(data_type_t src_dt, data_type_t dst_dt) {
+    using namespace data_type;
+    if (get_supported_isa() == isa_undef) return false;
+    // BFCVT is only available with FEAT_BF16
+    const bool dst_ok = dst_dt == f32 || dst_dt == f16
+            || (dst_dt == bf16 && mayiuse_bf16());
+    if (is_low_bit(src_dt)) return dst_ok;
+    return utils::one_of(src_dt, f32, bf16, f16)
+            && utils::one_of(dst_dt, s4, u4, f8_e5m2);
+}
+
+jit_low_bit_cvt_t::jit_low_bit_cvt_t(data_type_t src_dt, data_type_t dst_dt,
+        scale_kind_t scale_kind)
+    : dst_dt_(dst_dt) {
+    using namespace data_type;
+    assert(is_supported(src_dt, dst_dt));
+
+    // Floating point values are decoded with a lookup by their bits
+    for (int i = 0; i < 256; i++) {
+        const uint8_t b = static_cast<uint8_t>(i);
+        switch (src_dt) {
+            case f8_e5m2: table_[i] = float8_e5m2_t(b, true); break;
+            case f8_e4m3: table_[i] = float8_e4m3_t(b, true); break;
+            case f4_e2m1: table_[i] = float4_e2m1_t(b & 0xf, true); break;
+            case f4_e3m0: table_[i] = float4_e3m0_t(b & 0xf, true); break;
+            default: table_[i] = 0.f; break;
+        }
+    }
+
+    kernel_ = utils::make_unique<jit_uni_low_bit_cvt_kernel_t>(
+            get_supported_isa(), src_dt, dst_dt, scale_kind);
+    kernel_->create_kernel();
+}
+
+void jit_low_bit_cvt_t::operator()(void *dst, const void *src,
+        const float *scales, size_t nelems) const {
+    jit_call_t p;
+    p.src = src;
+    p.dst = dst;
+    p.scales = scales;
+    p.table = table_;
+    p.nelems = nelems;
+    (*kernel_)(&p);
+    msan_unpoison(dst, bytes(dst_dt_, nelems));
+}
+
+status_t jit_uni_reorder_low_bit_t::pd_t::create(reorder_pd_t **reorder_pd,
+        engine_t *engine, const primitive_attr_t *attr, engine_t *src_engine,
+        const memory_desc_t *src_md, engine_t *dst_engine,
+        const memory_desc_t *dst_md) {
+    auto _pd = make_unique_pd<pd_t>(
+            attr, src_engine->kind(), src_md, dst_engine->kind(), dst_md);
+    if (_pd == nullptr) return status::out_of_memory;
+
+    CHECK(_pd->init(engine, src_engine, dst_engine));
+    CHECK(_pd->init_scratchpad_md());
+
+    return safe_ptr_assign(*reorder_pd, _pd.release());
+}
+
+status_t jit_uni_reorder_low_bit_t::pd_t::init_scales(engine_t *engine) {
+    const auto &scales = attr()->scales_;
+    if (scales.has_default_values(DNNL_ARG_SRC)) return status::success;
+
+    const int ndims = src_md()->ndims;
+    const int mask = scales.get_mask(DNNL_ARG_SRC);
+    if (!(mask & (1 << inner_dim_))) {
+        // The scale is constant along the rows
+        scale_kind_ = scale_kind_t::common;
+        return status::success;
+    }
+
+    // Groups apply to the two innermost logical dimensions
+    dim_t group = 1;
+    if (inner_dim_ == ndims - 1) group = scales.get_group(DNNL_ARG_SRC, 1);
+    if (inner_dim_ == ndims - 2) group = scales.get_group(DNNL_ARG_SRC, 0);
+
+    if (group > 1) {
+        VDISPATCH_REORDER(IMPLICATION(is_sub_byte(src_md()->data_type),
+                                  group % 2 == 0),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        scale_kind_ = scale_kind_t::common;
+        scale_group_ = group;
+        return status::success;
+    }
+
+    // A scale per element is loaded as a vector, so the scales of a row
+    // must be dense
+    memory_desc_t scales_md {};
+    CHECK(scales.get(DNNL_ARG_SRC).get_md(scales_md, *src_md()));
+    const memory_desc_wrapper scales_d(scales_md);
+    VDISPATCH_REORDER(scales_d.blocking_desc().strides[inner_dim_] == 1,
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    scale_kind_ = scale_kind_t::per_elem;
+    scale_group_ = 1;
+
+    return status::success;
+}
+
+status_t jit_uni_reorder_low_bit_t::pd_t::init(
+        engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_REORDER(is_dense_format_kind({src_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const auto src_dt = src_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_REORDER(!src_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(!dst_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(
+            src_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_REORDER(
+            dst_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_REORDER(jit_low_bit_cvt_t::is_supported(src_dt, dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+
+    // Only the data type changes, the rows are converted in place.
+    VDISPATCH_REORDER(src_d.similar_to(dst_d, true, false, 0),
+            VERBOSE_TENSOR_FORMAT_MISMATCH, "src", "dst");
+    VDISPATCH_REORDER(src_d.is_plain() && src_d.is_dense(),
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "src");
+    VDISPATCH_REORDER(dst_d.is_plain() && dst_d.is_dense(),
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "dst");
+    VDISPATCH_REORDER(src_d.extra().flags == 0 && dst_d.extra().flags == 0,
+            VERBOSE_UNSUPPORTED_MD_FLAG, "src or dst");
+
+    const int ndims = src_d.ndims();
+    inner_dim_ = ndims - 1;
+    for (int d = 0; d < ndims; d++) {
+        if (src_d.dims()[d] > 1 && src_d.blocking_desc().strides[d] == 1)
+            inner_dim_ = d;
+    }
+
+    // Every row must start at a byte boundary.
+    const bool sub_byte = is_sub_byte(src_dt) || is_sub_byte(dst_dt);
+    VDISPATCH_REORDER(IMPLICATION(sub_byte,
+                              src_d.dims()[inner_dim_] % 2 == 0
+                                      && src_d.offset0() % 2 == 0
+                                      && dst_d.offset0() % 2 == 0),
+            VERBOSE_BAD_DIM, "src", inner_dim_);
+
+    if (is_low_bit(src_dt)) {
+        VDISPATCH_REORDER(attr()->has_default_values(smask_t::scales_data_type
+                                  | smask_t::scales_groups),
+                VERBOSE_UNSUPPORTED_ATTR);
+        VDISPATCH_REORDER(attr()->scales_.has_default_values(DNNL_ARG_DST),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        // A host scalar scale is copied at execution to the buffer the
+        // kernel broadcasts a common scale from
+        const auto &src_scales = attr()->scales_.get(DNNL_ARG_SRC);
+        VDISPATCH_REORDER(src_scales.has_default_values()
+                        || src_scales.get_data_type() == f32,
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        CHECK(init_scales(engine));
+    } else {
+        VDISPATCH_REORDER(
+                attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    }
+
+    return status::success;
+}
+
+status_t jit_uni_reorder_low_bit_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_,
+            new jit_low_bit_cvt_t(pd()->src_md()->data_type,
+                    pd()->dst_md()->data_type, pd()->scale_kind_)));
+    return status::success;
+}
+
+status_t jit_uni_reorder_low_bit_t::execute(const exec_ctx_t &ctx) const {
+    const auto in = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
+    auto out = CTX_OUT_MEM(char *, DNNL_ARG_TO);
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto src_dt = src_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    const int ndims = src_d.ndims();
+    const int inner_dim = pd()->inner_dim_;
+    const dim_t scale_group = pd()->scale_group_;
+    const auto scale_kind = pd()->scale_kind_;
+
+    const auto &scales = pd()->attr()->scales_;
+    const bool with_scales = scale_kind != scale_kind_t::none;
+    const int scales_mask = with_scales ? scales.get_mask(DNNL_ARG_SRC) : 0;
+    const dim_t g0 = scales.get_group(DNNL_ARG_SRC, 0);
+    const dim_t g1 = scales.get_group(DNNL_ARG_SRC, 1);
+    memory_desc_t scales_md {};
+    if (with_scales)
+        CHECK(scales.get(DNNL_ARG_SRC).get_md(scales_md, *src_d.md_));
+    const memory_desc_wrapper scales_d(scales_md);
+
+    // Rows are split at the scale groups, or in chunks big enough to amortize
+    // the call of the kernel when the scale does not change along them
+    const dim_t chunk = 4096;
+    const dim_t row_len = src_d.dims()[inner_dim];
+    const dim_t nrows = src_d.nelems() / row_len;
+    const dim_t seg_len
+            = scale_group > 1 ? scale_group : nstl::min(row_len, chunk);
+    const dim_t nsegs = utils::div_up(row_len, seg_len);
+
+    dims_t row_dims {};
+    utils::array_copy(row_dims, src_d.dims(), ndims);
+    row_dims[inner_dim] = 1;
+
+    parallel_nd(nrows, nsegs, [&](dim_t r, dim_t s) {
+        dims_t idx {};
+        utils::l_dims_by_l_offset(idx, r, row_dims, ndims);
+        idx[inner_dim] = s * seg_len;
+        const dim_t len = nstl::min(seg_len, row_len - idx[inner_dim]);
+
+        const float *scales_ptr = nullptr;
+        if (with_scales) {
+            // Same offset of the quantization entry as in simple_reorder_t
+            dims_t quant_idx {};
+            utils::array_copy(quant_idx, idx, ndims);
+            utils::apply_mask_on_dims(quant_idx, ndims, scales_mask);
+            if (ndims >= 2) {
+                quant_idx[ndims - 1] /= g1;
+                quant_idx[ndims - 2] /= g0;
+            }
+            scales_ptr = scales_d.nelems() == 1
+                    ? src_scales
+                    : src_scales + scales_d.off_v(quant_idx);
+        }
+
+        (*kernel_)(out + bytes(dst_dt, dst_d.off_v(idx)),
+                in + bytes(src_dt, src_d.off_v(idx)), scales_ptr, len);
+    });
+
+    return status::success;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,183 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_REORDER_JIT_UNI_REORDER_LOW_BIT_HPP
+#define CPU_AARCH64_REORDER_JIT_UNI_REORDER_LOW_BIT_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/reorder/cpu_reorder_pd.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace low_bit_support {
+
+// How the scales are applied to the elements converted by a single call
+enum class scale_kind_t {
+    none,
+    // A single scale for all the elements
+    common,
+    // A scale per element, stored contiguously
+    per_elem,
+};
+
+struct jit_call_t {
+    const void *src;
+    void *dst;
+    const float *scales;
+    // Values of the 4-bit and 8-bit floating point types indexed by their
+    // bits
+    const float *table;
+    size_t nelems;
+};
+
+} // namespace low_bit_support
+
+// Converts a dense array of s4, u4, f4 or fp8 values to f32, bf16 or f16
+// with optional scales, or f32, bf16 and f16 values to s4, u4 or f8_e5m2.
+// Sub-byte values are unpacked into the even and odd elements of separate
+// vectors that are interleaved back by ST2W, so the number of elements of a
+// call must be even for them.
+struct jit_uni_low_bit_cvt_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_low_bit_cvt_kernel_t)
+
+    jit_uni_low_bit_cvt_kernel_t(cpu_isa_t isa, data_type_t src_dt,
+            data_type_t dst_dt, low_bit_support::scale_kind_t scale_kind);
+
+private:
+    void generate() override;
+    void convert(int unroll, const Xbyak_aarch64::PReg &p);
+    void decode(int unroll, const Xbyak_aarch64::PReg &p);
+    void encode(int unroll, const Xbyak_aarch64::PReg &p);
+    void advance_ptrs(size_t nelems);
+
+    // Converts f32 values to the destination floating point type and stores
+    // them
+    void store_xf16(const Xbyak_aarch64::ZReg &z);
+    // Loads and converts source values to f32
+    void load_f32(const Xbyak_aarch64::ZReg &z, const Xbyak_aarch64::PReg &p,
+            const Xbyak_aarch64::XReg &addr);
+    void round_to_e5m2(const Xbyak_aarch64::ZReg &z);
+
+    Xbyak_aarch64::XReg addr(const Xbyak_aarch64::XReg &base, size_t offt);
+
+    static constexpr int unroll_max_ = 4;
+
+    const size_t simd_w_;
+    const data_type_t src_dt_;
+    const data_type_t dst_dt_;
+    const low_bit_support::scale_kind_t scale_kind_;
+    // Decoding from the low precision types, otherwise encoding
+    const bool is_decode_;
+    // The low-precision side is 4-bit wide
+    const bool is_sub_byte_;
+    // Number of elements processed per vector of the isa
+    const size_t elems_per_vec_;
+
+    const Xbyak_aarch64::XReg reg_src_ = x1;
+    const Xbyak_aarch64::XReg reg_dst_ = x2;
+    const Xbyak_aarch64::XReg reg_nelems_ = x3;
+    const Xbyak_aarch64::XReg reg_scales_ = x4;
+    const Xbyak_aarch64::XReg reg_table_ = x5;
+
+    const Xbyak_aarch64::PReg p_vl_ = p1;
+    const Xbyak_aarch64::PReg p_tail_ = p2;
+    const Xbyak_aarch64::PReg p_special_ = p3;
+    const Xbyak_aarch64::PReg p_nan_ = p4;
+
+    const Xbyak_aarch64::ZReg z_tmp0_ = z16;
+    const Xbyak_aarch64::ZReg z_tmp1_ = z17;
+    const Xbyak_aarch64::ZReg z_e5m2_qbit_ = z29;
+    const Xbyak_aarch64::ZReg z_f16_naninf_ = z30;
+    const Xbyak_aarch64::ZReg z_scale_ = z31;
+};
+
+// Owns a conversion kernel for the widest available SVE length.
+struct jit_low_bit_cvt_t {
+    jit_low_bit_cvt_t(data_type_t src_dt, data_type_t dst_dt,
+            low_bit_support::scale_kind_t scale_kind);
+
+    // Returns true if the conversion can be done on this CPU
+    static bool is_supported(data_type_t src_dt, data_type_t dst_dt);
+
+    void operator()(void *dst, const void *src, const float *scales,
+            size_t nelems) const;
+
+private:
+    const data_type_t dst_dt_;
+    alignas(64) float table_[256];
+    std::unique_ptr<jit_uni_low_bit_cvt_kernel_t> kernel_;
+};
+
+// Reorder between identical plain formats that converts data from or to the
+// low precision types used for the weights of the decompression matmul. The
+// tensor is processed as rows of its innermost dimension, so the per-group
+// scales of the weights are applied while unpacking them, without the
+// intermediate buffer of the reference implementation.
+struct jit_uni_reorder_low_bit_t : public primitive_t {
+    using primitive_t::primitive_t;
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+
+        DECLARE_COMMON_PD_T("jit_low_bit:uni", jit_uni_reorder_low_bit_t);
+
+        status_t init(
+                engine_t *engine, engine_t *src_engine, engine_t *dst_engine);
+
+        // Innermost dimension of the tensor
+        int inner_dim_ = 0;
+        // Number of consecutive elements of a row sharing a scale, 0 if the
+        // scale does not change along the rows
+        dim_t scale_group_ = 0;
+        low_bit_support::scale_kind_t scale_kind_
+                = low_bit_support::scale_kind_t::none;
+
+    private:
+        status_t init_scales(engine_t *engine);
+
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md);
+
+        friend dnnl::impl::impl_list_item_t;
+    };
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<jit_low_bit_cvt_t> kernel_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
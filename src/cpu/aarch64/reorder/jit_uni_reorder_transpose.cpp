@@ -0,0 +1,255 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+#include <utility>
+
+#include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/tag_traits.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/aarch64/reorder/jit_uni_reorder_transpose.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+using namespace Xbyak_aarch64;
+
+#define GET_OFF(field) \
+    static_cast<int32_t>(offsetof(transpose_support::jit_call_t, field))
+
+int jit_uni_transpose_kernel_t::get_tile() {
+    if (!mayiuse(sve_128)) return 0;
+    // The ZIP instructions work on the whole hardware vector, so the tile
+    // follows the actual vector length. Two banks of `tile` registers are
+    // needed, which limits it to 16 rows.
+    switch (get_sve_length()) {
+        case 16: return 4;
+        case 32: return 8;
+        case 64: return 16;
+        default: return 0;
+    }
+}
+
+void jit_uni_transpose_kernel_t::generate() {
+    preamble();
+
+    ldr(reg_src_, ptr(abi_param1, GET_OFF(src)));
+    ldr(reg_dst_, ptr(abi_param1, GET_OFF(dst)));
+    ldr(reg_src_stride_, ptr(abi_param1, GET_OFF(src_stride)));
+    ldr(reg_dst_stride_, ptr(abi_param1, GET_OFF(dst_stride)));
+    ldr(reg_ntiles_, ptr(abi_param1, GET_OFF(ntiles)));
+
+    const int log2_tile = math::ilog2q(tile_);
+    lsl(reg_dst_tile_step_, reg_dst_stride_, log2_tile);
+
+    Label tile_loop;
+    L(tile_loop);
+    {
+        mov(reg_aux_, reg_src_);
+        for (int i = 0; i < tile_; i++) {
+            ld1w(ZRegS(i), P_ALL_ONE / T_z, ptr(reg_aux_));
+            if (i < tile_ - 1) add(reg_aux_, reg_aux_, reg_src_stride_);
+        }
+
+        // Each round interleaves row i with row i + tile / 2, after
+        // log2(tile) rounds register i holds column i of the tile. The rounds
+        // go back and forth between z0-z15 and z16-z31.
+        int in = 0, out = 16;
+        for (int round = 0; round < log2_tile; round++) {
+            for (int i = 0; i < tile_ / 2; i++) {
+                const ZRegS lo(in + i), hi(in + i + tile_ / 2);
+                zip1(ZRegS(out + 2 * i), lo, hi);
+                zip2(ZRegS(out + 2 * i + 1), lo, hi);
+            }
+            std::swap(in, out);
+        }
+
+        mov(reg_aux_, reg_dst_);
+        for (int i = 0; i < tile_; i++) {
+            if (nt_stores_)
+                stnt1w(ZRegS(in + i), P_ALL_ONE, ptr(reg_aux_));
+            else
+                st1w(ZRegS(in + i), P_ALL_ONE, ptr(reg_aux_));
+            if (i < tile_ - 1) add(reg_aux_, reg_aux_, reg_dst_stride_);
+        }
+
+        add_imm(reg_src_, reg_src_, tile_ * sizeof(uint32_t), X_TMP_0);
+        add(reg_dst_, reg_dst_, reg_dst_tile_step_);
+        subs(reg_ntiles_, reg_ntiles_, 1);
+        b(NE, tile_loop);
+    }
+
+    postamble();
+}
+
+#undef GET_OFF
+
+status_t jit_uni_reorder_transpose_t::pd_t::create(reorder_pd_t **reorder_pd,
+        engine_t *engine, const primitive_attr_t *attr, engine_t *src_engine,
+        const memory_desc_t *src_md, engine_t *dst_engine,
+        const memory_desc_t *dst_md) {
+    auto _pd = make_unique_pd<pd_t>(
+            attr, src_engine->kind(), src_md, dst_engine->kind(), dst_md);
+    if (_pd == nullptr) return status::out_of_memory;
+
+    CHECK(_pd->init(engine, src_engine, dst_engine));
+    CHECK(_pd->init_scratchpad_md());
+
+    return safe_ptr_assign(*reorder_pd, _pd.release());
+}
+
+status_t jit_uni_reorder_transpose_t::pd_t::init(
+        engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
+    using namespace data_type;
+    using namespace format_tag;
+
+    VDISPATCH_REORDER(is_dense_format_kind({src_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_REORDER(!src_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(!dst_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(src_d.data_type() == dst_d.data_type()
+                    && utils::one_of(src_d.data_type(), f32, s32),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_REORDER(jit_uni_transpose_kernel_t::get_tile() != 0,
+            VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_REORDER(src_d.extra().flags == 0 && dst_d.extra().flags == 0,
+            VERBOSE_UNSUPPORTED_MD_FLAG, "src or dst");
+    VDISPATCH_REORDER(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+    const int ndims = src_d.ndims();
+    VDISPATCH_REORDER(
+            ndims >= 2 && ndims <= 5, VERBOSE_BAD_NDIMS, "src", ndims);
+
+    // Plain tags with the two innermost dimensions swapped
+    const format_tag_t plain_tag = get_abx_tag(ndims);
+    const format_tag_t swapped_tag
+            = utils::pick(ndims - 2, ba, acb, abdc, abced);
+    const dims_t &dims = src_d.dims();
+    if (src_d.matches_tag(plain_tag) && dst_d.matches_tag(swapped_tag)) {
+        rows_ = dims[ndims - 2];
+        cols_ = dims[ndims - 1];
+    } else if (src_d.matches_tag(swapped_tag)
+            && dst_d.matches_tag(plain_tag)) {
+        rows_ = dims[ndims - 1];
+        cols_ = dims[ndims - 2];
+    } else {
+        VDISPATCH_REORDER(false, VERBOSE_UNSUPPORTED_TAG);
+    }
+    batch_ = utils::array_product(dims, ndims - 2);
+
+    // Smaller matrices are left to jit_uni_reorder_t
+    const dim_t tile = jit_uni_transpose_kernel_t::get_tile();
+    VDISPATCH_REORDER(
+            rows_ >= tile && cols_ >= tile, VERBOSE_SHAPE_RESTRICTION);
+
+    return status::success;
+}
+
+status_t jit_uni_reorder_transpose_t::init(engine_t *engine) {
+    const int tile = jit_uni_transpose_kernel_t::get_tile();
+
+    // A source block and a destination block take at most half of L2. The
+    // rows of a block are usually on different pages, so the block is also
+    // capped to keep the pages of both in the TLB.
+    const dim_t max_block = 256;
+    const size_t l2_size = platform::get_per_core_cache_size(2);
+    block_ = tile;
+    while (block_ < max_block
+            && 2 * (2 * block_) * (2 * block_) * sizeof(uint32_t)
+                    <= l2_size / 2)
+        block_ *= 2;
+
+    // A destination which doesn't fit in the last level cache would be
+    // evicted before being used, so it bypasses the caches.
+    size_t llc_size = platform::get_per_core_cache_size(3);
+    if (llc_size == 0) llc_size = l2_size;
+    const size_t dst_size = memory_desc_wrapper(pd()->dst_md()).size();
+    const bool nt_stores = dst_size > llc_size * platform::get_num_cores();
+
+    CHECK(safe_ptr_assign(
+            kernel_, new jit_uni_transpose_kernel_t(tile, nt_stores)));
+    return kernel_->create_kernel();
+}
+
+status_t jit_uni_reorder_transpose_t::execute(const exec_ctx_t &ctx) const {
+    auto in = CTX_IN_MEM(const uint32_t *, DNNL_ARG_FROM);
+    auto out = CTX_OUT_MEM(uint32_t *, DNNL_ARG_TO);
+
+    in += memory_desc_wrapper(pd()->src_md()).offset0();
+    out += memory_desc_wrapper(pd()->dst_md()).offset0();
+
+    const dim_t R = pd()->rows_;
+    const dim_t C = pd()->cols_;
+    const dim_t tile = kernel_->tile();
+    const dim_t nb_r = utils::div_up(R, block_);
+    const dim_t nb_c = utils::div_up(C, block_);
+
+    // Consecutive blocks of a thread share the same destination rows, so
+    // that each thread writes, and first touches, a contiguous range of the
+    // destination.
+    parallel_nd(pd()->batch_, nb_c, nb_r, [&](dim_t b, dim_t bc, dim_t br) {
+        const uint32_t *src = in + b * R * C;
+        uint32_t *dst = out + b * R * C;
+
+        const dim_t r_beg = br * block_;
+        const dim_t r_end = nstl::min(R, r_beg + block_);
+        const dim_t c_beg = bc * block_;
+        const dim_t c_end = nstl::min(C, c_beg + block_);
+        const dim_t r_tiles_end = r_beg + (r_end - r_beg) / tile * tile;
+        const dim_t c_tiles_end = c_beg + (c_end - c_beg) / tile * tile;
+
+        if (c_tiles_end > c_beg) {
+            for (dim_t r = r_beg; r < r_tiles_end; r += tile) {
+                transpose_support::jit_call_t p;
+                p.src = src + r * C + c_beg;
+                p.dst = dst + c_beg * R + r;
+                p.src_stride = C * sizeof(uint32_t);
+                p.dst_stride = R * sizeof(uint32_t);
+                p.ntiles = (c_tiles_end - c_beg) / tile;
+                (*kernel_)(&p);
+            }
+        }
+
+        // The edges of the matrix which don't make whole tiles
+        for (dim_t r = r_beg; r < r_end; r++) {
+            const dim_t c_start = r < r_tiles_end ? c_tiles_end : c_beg;
+            for (dim_t c = c_start; c < c_end; c++)
+                dst[c * R + r] = src[r * C + c];
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
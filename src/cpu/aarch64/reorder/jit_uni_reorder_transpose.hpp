@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_REORDER_JIT_UNI_REORDER_TRANSPOSE_HPP
+#define CPU_AARCH64_REORDER_JIT_UNI_REORDER_TRANSPOSE_HPP
+
+#include <memory>
+#include <string>
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/reorder/cpu_reorder_pd.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+namespace transpose_support {
+struct jit_call_t {
+    const void *src;
+    void *dst;
+    size_t src_stride; // bytes between two rows of the source
+    size_t dst_stride; // bytes between two rows of the destination
+    size_t ntiles;
+};
+} // namespace transpose_support
+
+// Transposes `ntiles` square tiles of 32-bit values lying next to each other
+// along the rows of the source. A tile has as many rows as a vector has
+// lanes (8x8 with 256-bit SVE, 16x16 with 512-bit SVE): its rows are loaded
+// in registers and transposed with log2(lanes) rounds of ZIP1/ZIP2.
+struct jit_uni_transpose_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_transpose_kernel_t)
+
+    jit_uni_transpose_kernel_t(int tile, bool nt_stores)
+        : tile_(tile), nt_stores_(nt_stores) {}
+
+    // Returns the tile size for the vector length of this CPU, or 0 if the
+    // kernel can't be used.
+    static int get_tile();
+
+    int tile() const { return tile_; }
+
+    std::string code_name_suffix() const override {
+        return std::to_string(tile_) + "x" + std::to_string(tile_)
+                + (nt_stores_ ? "_nt" : "");
+    }
+
+private:
+    void generate() override;
+
+    const int tile_;
+    const bool nt_stores_;
+
+    const Xbyak_aarch64::XReg reg_src_ = x1;
+    const Xbyak_aarch64::XReg reg_dst_ = x2;
+    const Xbyak_aarch64::XReg reg_src_stride_ = x3;
+    const Xbyak_aarch64::XReg reg_dst_stride_ = x4;
+    const Xbyak_aarch64::XReg reg_ntiles_ = x5;
+    const Xbyak_aarch64::XReg reg_dst_tile_step_ = x6;
+    const Xbyak_aarch64::XReg reg_aux_ = x7;
+};
+
+// Reorder of plain dense 32-bit tensors swapping their two innermost
+// dimensions, e.g. ab to ba or abc to acb, as done when preparing weights
+// or key-value caches. Each matrix is split in blocks sized to stay in L2
+// and in the TLB, the blocks being shared between threads so that each of
+// them writes a contiguous range of the destination, and each block is
+// transposed tile by tile in registers. Destinations larger than the last
+// level cache are written with non-temporal stores.
+struct jit_uni_reorder_transpose_t : public primitive_t {
+    using primitive_t::primitive_t;
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+
+        DECLARE_COMMON_PD_T("jit_transpose:uni", jit_uni_reorder_transpose_t);
+
+        status_t init(
+                engine_t *engine, engine_t *src_engine, engine_t *dst_engine);
+
+        // The tensors are seen as `batch_` matrices of `rows_` x `cols_`
+        // elements in the source, stored as `cols_` x `rows_` in the
+        // destination.
+        dim_t batch_ = 0;
+        dim_t rows_ = 0;
+        dim_t cols_ = 0;
+
+    private:
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md);
+
+        friend dnnl::impl::impl_list_item_t;
+    };
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Rows and columns of the blocks shared between threads, a multiple of
+    // the tile size
+    dim_t block_ = 0;
+    std::unique_ptr<jit_uni_transpose_kernel_t> kernel_;
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
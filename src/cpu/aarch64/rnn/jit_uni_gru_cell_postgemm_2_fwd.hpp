@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_RNN_JIT_UNI_GRU_CELL_POSTGEMM_2_FWD_HPP
+#define CPU_AARCH64_RNN_JIT_UNI_GRU_CELL_POSTGEMM_2_FWD_HPP
+
+#include <memory>
+
+#include "cpu/aarch64/rnn/jit_uni_rnn_common_postgemm.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+template <cpu_isa_t isa>
+struct jit_uni_gru_cell_postgemm_part2_fwd_t
+    : public jit_uni_rnn_postgemm_sve_t<isa> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gru_cell_postgemm_part2_fwd_t)
+
+    using base_t = jit_uni_rnn_postgemm_sve_t<isa>;
+    using typename base_t::injector_t;
+    using typename base_t::ZReg;
+    using typename base_t::PReg;
+
+    jit_uni_gru_cell_postgemm_part2_fwd_t(
+            const rnn_utils::rnn_conf_t &rnn, const rnn_pd_t *pd)
+        : base_t(rnn, pd) {}
+
+    status_t init(data_type_t sdt) override {
+        tanh_injector_ = utils::make_unique<injector_t>(this,
+                alg_kind::eltwise_tanh, 0.0f, 0.0f, 1.0f, false,
+                this->reg_table);
+        return base_t::init(sdt);
+    }
+
+protected:
+    std::unique_ptr<injector_t> tanh_injector_;
+
+    void generate() override {
+        using namespace Xbyak_aarch64;
+        const int vidx = this->first_vreg_idx;
+        const ZReg G0(vidx), G2(vidx + 1), h_tm1(vidx + 2), tmp(vidx + 3);
+
+        const auto body = [&](const PReg &p) {
+            this->load(G0, p, this->reg_scratch_gates, 0);
+            this->load(G2, p, this->reg_scratch_gates, 2);
+            this->load(tmp, p, this->reg_bias, 2);
+            this->fadd(G2.s, G2.s, tmp.s);
+            this->compute(tanh_injector_.get(), G2);
+
+            if (this->rnn_.is_training)
+                this->store(G2, p, this->reg_ws_gates, 2);
+
+            // h_t = G0 * h_{t-1} + (1 - G0) * G2 = G2 + G0 * (h_{t-1} - G2)
+            this->load(h_tm1, p, this->reg_src_iter);
+            this->fsub(tmp.s, h_tm1.s, G2.s);
+            this->fmla(G2.s, this->P_ALL_ONE / T_m, G0.s, tmp.s);
+            this->store_opt(G2, p, this->reg_dst_layer);
+            this->store_opt(G2, p, this->reg_dst_iter);
+        };
+
+        this->preamble();
+        this->load_args(false);
+        this->dhc_loop(body,
+                {this->reg_ws_gates, this->reg_scratch_gates, this->reg_bias,
+                        this->reg_dst_layer, this->reg_dst_iter,
+                        this->reg_src_iter});
+        this->postamble();
+
+        tanh_injector_->prepare_table();
+    }
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
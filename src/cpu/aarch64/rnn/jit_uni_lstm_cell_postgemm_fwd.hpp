@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_RNN_JIT_UNI_LSTM_CELL_POSTGEMM_FWD_HPP
+#define CPU_AARCH64_RNN_JIT_UNI_LSTM_CELL_POSTGEMM_FWD_HPP
+
+#include <memory>
+#include <vector>
+
+#include "cpu/aarch64/rnn/jit_uni_rnn_common_postgemm.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+template <cpu_isa_t isa>
+struct jit_uni_lstm_cell_postgemm_fwd_t
+    : public jit_uni_rnn_postgemm_sve_t<isa> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_lstm_cell_postgemm_fwd_t)
+
+    using base_t = jit_uni_rnn_postgemm_sve_t<isa>;
+    using typename base_t::injector_t;
+    using typename base_t::ZReg;
+    using typename base_t::PReg;
+    using typename base_t::XReg;
+
+    jit_uni_lstm_cell_postgemm_fwd_t(
+            const rnn_utils::rnn_conf_t &rnn, const rnn_pd_t *pd)
+        : base_t(rnn, pd) {}
+
+    status_t init(data_type_t sdt) override {
+        sigmoid_injector_ = utils::make_unique<injector_t>(this,
+                alg_kind::eltwise_logistic, 0.0f, 0.0f, 1.0f, false,
+                this->reg_table);
+        tanh_injector_ = utils::make_unique<injector_t>(this,
+                alg_kind::eltwise_tanh, 0.0f, 0.0f, 1.0f, false,
+                this->reg_table);
+        return base_t::init(sdt);
+    }
+
+protected:
+    std::unique_ptr<injector_t> sigmoid_injector_;
+    std::unique_ptr<injector_t> tanh_injector_;
+
+    void generate() override {
+        using namespace Xbyak_aarch64;
+        const int vidx = this->first_vreg_idx;
+        const ZReg c_tm1(vidx), G0(vidx + 1), G1(vidx + 2), G2(vidx + 3),
+                G3(vidx + 4), tmp(vidx + 5), c_t(vidx + 6), h_t(vidx + 7),
+                h_q(vidx + 8);
+        const PReg p_all = this->P_ALL_ONE;
+        const auto &rnn = this->rnn_;
+
+        const auto gate_preact = [&](const ZReg &G, const PReg &p, int gate) {
+            this->load(G, p, this->reg_scratch_gates, gate);
+            this->deq_w(G, p, gate, tmp);
+            this->load(tmp, p, this->reg_bias, gate);
+            this->fadd(G.s, G.s, tmp.s);
+        };
+        const auto peephole = [&](const ZReg &G, const PReg &p, int gate,
+                                      const ZReg &c) {
+            if (!rnn.is_lstm_peephole) return;
+            this->load(tmp, p, this->reg_wp, gate);
+            this->fmla(G.s, p_all / T_m, tmp.s, c.s);
+        };
+
+        const auto body = [&](const PReg &p) {
+            this->load(c_tm1, p, this->reg_src_iter);
+
+            gate_preact(G0, p, 0);
+            peephole(G0, p, 0, c_tm1);
+            gate_preact(G1, p, 1);
+            peephole(G1, p, 1, c_tm1);
+            gate_preact(G2, p, 2);
+            gate_preact(G3, p, 3);
+
+            this->compute(sigmoid_injector_.get(), G0);
+            this->compute(sigmoid_injector_.get(), G1);
+            this->compute(tanh_injector_.get(), G2);
+
+            // c_t = G1 * c_{t-1} + G0 * G2
+            this->fmul(c_t.s, G1.s, c_tm1.s);
+            this->fmla(c_t.s, p_all / T_m, G0.s, G2.s);
+            this->store(c_t, p, this->reg_dst_iter_c);
+
+            peephole(G3, p, 2, c_t);
+            this->compute(sigmoid_injector_.get(), G3);
+
+            // h_t = G3 * tanh(c_t)
+            this->mov(h_t.d, c_t.d);
+            this->compute(tanh_injector_.get(), h_t);
+            this->fmul(h_t.s, h_t.s, G3.s);
+
+            // the int8 states are quantized once for both destinations
+            const ZReg &h_out = this->is_int8() ? h_q : h_t;
+            if (this->is_int8()) this->q_d(h_q, h_t);
+            this->store_opt(h_out, p, this->reg_dst_layer);
+            this->store_opt(h_out, p, this->reg_dst_iter);
+
+            if (rnn.is_training) {
+                this->store(G0, p, this->reg_ws_gates, 0);
+                this->store(G1, p, this->reg_ws_gates, 1);
+                this->store(G2, p, this->reg_ws_gates, 2);
+                this->store(G3, p, this->reg_ws_gates, 3);
+            }
+        };
+
+        this->preamble();
+        this->load_args(true);
+
+        std::vector<XReg> regs {this->reg_ws_gates, this->reg_scratch_gates,
+                this->reg_bias, this->reg_src_iter, this->reg_dst_iter_c,
+                this->reg_wp};
+        std::vector<XReg> byte_regs;
+        if (this->is_int8()) {
+            if (this->per_oc_wscales()) regs.push_back(this->reg_wscales);
+            byte_regs = {this->reg_dst_layer, this->reg_dst_iter};
+        } else {
+            regs.push_back(this->reg_dst_layer);
+            regs.push_back(this->reg_dst_iter);
+        }
+        this->dhc_loop(body, regs, byte_regs);
+        this->postamble();
+
+        sigmoid_injector_->prepare_table();
+        tanh_injector_->prepare_table();
+    }
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
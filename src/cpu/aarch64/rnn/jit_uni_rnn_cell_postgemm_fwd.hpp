@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_RNN_JIT_UNI_RNN_CELL_POSTGEMM_FWD_HPP
+#define CPU_AARCH64_RNN_JIT_UNI_RNN_CELL_POSTGEMM_FWD_HPP
+
+#include <memory>
+
+#include "cpu/aarch64/rnn/jit_uni_rnn_common_postgemm.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+template <cpu_isa_t isa>
+struct jit_uni_rnn_cell_postgemm_fwd_t
+    : public jit_uni_rnn_postgemm_sve_t<isa> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_rnn_cell_postgemm_fwd_t)
+
+    using base_t = jit_uni_rnn_postgemm_sve_t<isa>;
+    using typename base_t::injector_t;
+    using typename base_t::ZReg;
+    using typename base_t::PReg;
+
+    jit_uni_rnn_cell_postgemm_fwd_t(
+            const rnn_utils::rnn_conf_t &rnn, const rnn_pd_t *pd)
+        : base_t(rnn, pd) {}
+
+    status_t init(data_type_t sdt) override {
+        injector_ = utils::make_unique<injector_t>(this,
+                this->pd_->activation_kind(), this->pd_->desc()->alpha, 0.0f,
+                1.0f, false, this->reg_table);
+        return base_t::init(sdt);
+    }
+
+protected:
+    std::unique_ptr<injector_t> injector_;
+
+    void generate() override {
+        const int vidx = this->first_vreg_idx;
+        const ZReg G(vidx), tmp(vidx + 1);
+
+        const auto body = [&](const PReg &p) {
+            this->load(G, p, this->reg_scratch_gates);
+            this->load(tmp, p, this->reg_bias);
+            this->fadd(G.s, G.s, tmp.s);
+            this->compute(injector_.get(), G);
+
+            this->store_opt(G, p, this->reg_dst_layer);
+            this->store_opt(G, p, this->reg_dst_iter);
+            if (this->rnn_.is_training) this->store(G, p, this->reg_ws_gates);
+        };
+
+        this->preamble();
+        this->load_args(false);
+        this->dhc_loop(body,
+                {this->reg_ws_gates, this->reg_scratch_gates, this->reg_bias,
+                        this->reg_dst_layer, this->reg_dst_iter});
+        this->postamble();
+
+        injector_->prepare_table();
+    }
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
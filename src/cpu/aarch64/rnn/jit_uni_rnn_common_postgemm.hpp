@@ -0,0 +1,298 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_AARCH64_RNN_JIT_UNI_RNN_COMMON_POSTGEMM_HPP
+#define CPU_AARCH64_RNN_JIT_UNI_RNN_COMMON_POSTGEMM_HPP
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/rnn_pd.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/jit_generator.hpp"
+
+#include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
+
+#include "cpu/rnn/rnn_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace aarch64 {
+
+// Pointers for a single minibatch row, filled by execute() before every call
+struct jit_rnn_postgemm_args_t {
+    void *ws_gates;
+    void *scratch_gates;
+    const void *bias;
+    void *dst_layer;
+    void *dst_iter;
+    const void *src_iter; // h_{t-1} for GRU, c_{t-1} for LSTM
+    void *dst_iter_c;
+    const void *weights_peephole;
+    const float *weights_scales;
+};
+
+#define GET_OFF_RNN(x) (uint32_t) offsetof(jit_rnn_postgemm_args_t, x)
+
+// Only the f32 and u8 forward non-brgemm paths are jitted, the rest falls
+// back to the reference postgemm.
+struct jit_uni_rnn_postgemm_t : public jit_generator_t {
+
+    jit_uni_rnn_postgemm_t(const rnn_utils::rnn_conf_t &rnn, const rnn_pd_t *pd)
+        : rnn_(rnn), pd_(pd) {}
+
+    virtual status_t init(data_type_t src_data_t) {
+        src_data_t_ = src_data_t;
+        return create_kernel();
+    }
+
+    template <typename dst_layer_t, typename dst_iter_t, typename src_iter_t,
+            typename gemm_acc_t, typename gates_t, typename scratch_t>
+    rnn_postgemm_sig(execute) {
+        using namespace rnn_utils;
+        assert(pd_->is_fwd() && !rnn.is_brgemm);
+
+        const ws_gates_aoc_t<gates_t> ws_gates(rnn, ws_gates_);
+        const scratch_gates_aoc_t<scratch_t> scratch_gates(
+                rnn, scratch_gates_);
+        const weights_peephole_aoc_t<const float> weights_peephole(
+                rnn, weights_peephole_);
+        const auto bias = rnn_utils::make_raw_aoc(
+                bias_, types::data_type_size(rnn.bias_dt), rnn.n_bias, rnn.dhc);
+
+        const auto src_iter_ld = rnn.src_iter_ld(cell_position);
+        const auto dst_layer_ld = rnn.dst_layer_ld(cell_position);
+        const auto dst_iter_ld = rnn.dst_iter_ld(cell_position);
+        const int src_iter_c_ld = rnn.src_iter_c_ld(cell_position);
+        const int dst_iter_c_ld = rnn.dst_iter_c_ld(cell_position);
+
+        const ws_states_layer_aoc_t<dst_layer_t> dst_layer(
+                rnn, dst_layer_, dst_layer_ld);
+        const ws_states_iter_aoc_t<dst_iter_t> dst_iter(
+                rnn, dst_iter_, dst_iter_ld);
+        const ws_states_iter_aoc_t<const src_iter_t> src_iter(
+                rnn, src_iter_, src_iter_ld);
+        const auto src_iter_c = rnn_utils::make_raw_aoc(src_iter_c_,
+                types::data_type_size(rnn.src_iter_c_dt),
+                rnn.ws_states_iter_c_nld, src_iter_c_ld);
+        const auto dst_iter_c = rnn_utils::make_raw_aoc(dst_iter_c_,
+                types::data_type_size(rnn.dst_iter_c_dt),
+                rnn.ws_states_iter_c_nld, dst_iter_c_ld);
+        const bool is_lstm = pd_->cell_kind() == alg_kind::vanilla_lstm;
+
+// Since the function F(...) returns by reference so an exception has
+// to be made for nullptr argument
+#define SAFE_PTR(F, ...) (CONCAT2(F, _) ? &(F(__VA_ARGS__)) : nullptr)
+        // Assumption: the kernel runs a loop on dhc elements
+        parallel_nd(rnn.mb, [&](dim_t i) {
+            jit_rnn_postgemm_args_t args;
+            args.ws_gates = SAFE_PTR(ws_gates, i, 0, 0);
+            args.scratch_gates = SAFE_PTR(scratch_gates, i, 0, 0);
+            args.bias = bias(0, 0);
+            args.dst_layer = SAFE_PTR(dst_layer, i, 0);
+            args.dst_iter = SAFE_PTR(dst_iter, i, 0);
+            args.src_iter = is_lstm ? src_iter_c(i, 0)
+                                    : (const void *)SAFE_PTR(src_iter, i, 0);
+            args.dst_iter_c
+                    = is_lstm ? const_cast<void *>(dst_iter_c(i, 0)) : nullptr;
+            args.weights_peephole = is_lstm
+                    ? (const void *)SAFE_PTR(weights_peephole, 0, 0)
+                    : nullptr;
+            args.weights_scales = weights_scales_;
+            this->operator()(&args);
+        });
+#undef SAFE_PTR
+    }
+
+protected:
+    const rnn_utils::rnn_conf_t &rnn_;
+    const rnn_pd_t *pd_;
+    data_type_t src_data_t_ = data_type::f32;
+};
+
+// Common register layout and helpers of the SVE postgemm kernels. The kernels
+// loop over dhc with full vectors followed by a single predicated tail.
+template <cpu_isa_t isa>
+struct jit_uni_rnn_postgemm_sve_t : public jit_uni_rnn_postgemm_t {
+    using ZReg = Xbyak_aarch64::ZReg;
+    using XReg = Xbyak_aarch64::XReg;
+    using PReg = Xbyak_aarch64::PReg;
+    using injector_t = jit_uni_eltwise_injector_t<isa>;
+
+    jit_uni_rnn_postgemm_sve_t(
+            const rnn_utils::rnn_conf_t &rnn, const rnn_pd_t *pd)
+        : jit_uni_rnn_postgemm_t(rnn, pd) {}
+
+protected:
+    static constexpr int vlen = cpu_isa_traits<isa>::vlen;
+    static constexpr int simd_w = vlen / sizeof(float);
+
+    // Injectors allocate their auxiliary registers from z0 upwards, so the
+    // kernels keep their live values from z16.
+    static constexpr int first_vreg_idx = 16;
+
+    const XReg reg_param = x0;
+    const XReg reg_ws_gates = x1;
+    const XReg reg_scratch_gates = x2;
+    const XReg reg_bias = x3;
+    const XReg reg_dst_layer = x4;
+    const XReg reg_dst_iter = x5;
+    const XReg reg_src_iter = x6;
+    const XReg reg_dst_iter_c = x7;
+    const XReg reg_wp = x8;
+    const XReg reg_wscales = x9;
+    const XReg reg_loop = x10;
+    const XReg reg_table = x15;
+
+    // Quantization parameters of the int8 kernels, kept above the registers
+    // of the cell computations.
+    const ZReg vmm_dscale = ZReg(29);
+    const ZReg vmm_dshift = ZReg(30);
+    const ZReg vmm_u8_max = ZReg(31);
+
+    // The injectors own p1 and p4, and some algorithms p6
+    const PReg p_tail = p2;
+
+    size_t gate_stride() const { return rnn_.dhc * sizeof(float); }
+
+    bool is_int8() const { return src_data_t_ == data_type::u8; }
+    bool per_oc_wscales() const {
+        return pd_->attr()->rnn_weights_qparams_.mask_ != 0;
+    }
+
+    void load_args(bool with_c_state) {
+        ldr(reg_ws_gates, ptr(reg_param, GET_OFF_RNN(ws_gates)));
+        ldr(reg_scratch_gates, ptr(reg_param, GET_OFF_RNN(scratch_gates)));
+        ldr(reg_bias, ptr(reg_param, GET_OFF_RNN(bias)));
+        ldr(reg_dst_layer, ptr(reg_param, GET_OFF_RNN(dst_layer)));
+        ldr(reg_dst_iter, ptr(reg_param, GET_OFF_RNN(dst_iter)));
+        ldr(reg_src_iter, ptr(reg_param, GET_OFF_RNN(src_iter)));
+        if (with_c_state) {
+            ldr(reg_dst_iter_c, ptr(reg_param, GET_OFF_RNN(dst_iter_c)));
+            ldr(reg_wp, ptr(reg_param, GET_OFF_RNN(weights_peephole)));
+        }
+        if (is_int8()) {
+            ldr(reg_wscales, ptr(reg_param, GET_OFF_RNN(weights_scales)));
+            const auto &qparams = pd_->attr()->rnn_data_qparams_;
+            init_vmm(vmm_dscale, X_TMP_0, qparams.scale_);
+            init_vmm(vmm_dshift, X_TMP_0, qparams.shift_);
+            init_vmm(vmm_u8_max, X_TMP_0, 255.0f);
+        }
+    }
+
+    Xbyak_aarch64::AdrNoOfs gate_addr(const XReg &base, int gate) {
+        if (gate == 0) return ptr(base);
+        add_imm(X_DEFAULT_ADDR, base, gate * gate_stride(), X_TMP_0);
+        return ptr(X_DEFAULT_ADDR);
+    }
+
+    void load(const ZReg &z, const PReg &p, const XReg &base, int gate = 0) {
+        ld1w(z.s, p / Xbyak_aarch64::T_z, gate_addr(base, gate));
+    }
+
+    void store(const ZReg &z, const PReg &p, const XReg &base, int gate = 0) {
+        st1w(z.s, p, gate_addr(base, gate));
+    }
+
+    // Stores to an optional destination, skipped when the pointer is null.
+    // The int8 kernels store the low byte of the quantized s32 lanes.
+    void store_opt(const ZReg &z, const PReg &p, const XReg &base) {
+        Xbyak_aarch64::Label l_skip;
+        cbz(base, l_skip);
+        if (is_int8())
+            st1b(z.s, p, ptr(base));
+        else
+            st1w(z.s, p, ptr(base));
+        L(l_skip);
+    }
+
+    // Dequantizes the s32 gate accumulators:
+    // G = float(G) / (wscale * data_scale)
+    void deq_w(const ZReg &G, const PReg &p, int gate, const ZReg &tmp) {
+        using namespace Xbyak_aarch64;
+        if (!is_int8()) return;
+        if (per_oc_wscales())
+            load(tmp, p, reg_wscales, gate);
+        else
+            ld1rw(tmp.s, p / T_z, ptr(reg_wscales));
+        fmul(tmp.s, tmp.s, vmm_dscale.s);
+        scvtf(G.s, p / T_m, G.s);
+        fdiv(G.s, p / T_m, tmp.s);
+    }
+
+    // Quantizes src to u8 in dst: saturate(round(src * scale + shift))
+    void q_d(const ZReg &dst, const ZReg &src) {
+        using namespace Xbyak_aarch64;
+        const PReg p_all = P_ALL_ONE;
+        fmul(dst.s, src.s, vmm_dscale.s);
+        fadd(dst.s, dst.s, vmm_dshift.s);
+        fmax(dst.s, p_all / T_m, 0.0f);
+        fmin(dst.s, p_all / T_m, vmm_u8_max.s);
+        frintn(dst.s, p_all / T_m, dst.s);
+        fcvtzu(dst.s, p_all / T_m, dst.s);
+    }
+
+    void compute(injector_t *inj, const ZReg &z) {
+        inj->load_table_addr();
+        inj->compute_vector(z.getIdx());
+    }
+
+    // Moves the pointers to the next vector, null ones are left untouched
+    void advance(const std::vector<XReg> &regs, int step = vlen) {
+        for (const auto &r : regs) {
+            Xbyak_aarch64::Label l_skip;
+            cbz(r, l_skip);
+            add_imm(r, r, step, X_TMP_0);
+            L(l_skip);
+        }
+    }
+
+    // Emits body(p) for ceil(dhc / simd_w) vectors, first with all lanes
+    // active and then with the tail predicate. The pointers in byte_regs
+    // address u8 data and move by simd_w bytes per vector.
+    template <typename body_t>
+    void dhc_loop(const body_t &body, const std::vector<XReg> &regs,
+            const std::vector<XReg> &byte_regs = {}) {
+        const dim_t nfull = rnn_.dhc / simd_w;
+        const dim_t tail = rnn_.dhc % simd_w;
+        if (nfull > 0) {
+            Xbyak_aarch64::Label l_loop;
+            mov_imm(reg_loop, nfull);
+            L(l_loop);
+            {
+                body(P_ALL_ONE);
+                advance(regs);
+                advance(byte_regs, simd_w);
+                subs(reg_loop, reg_loop, 1);
+                b(Xbyak_aarch64::NE, l_loop);
+            }
+        }
+        if (tail > 0) {
+            set_preg(p_tail.s, tail, X_TMP_0, X_TMP_1);
+            body(p_tail);
+        }
+    }
+};
+
+} // namespace aarch64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
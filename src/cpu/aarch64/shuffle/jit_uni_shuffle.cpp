@@ -33,6 +33,20 @@ namespace impl {
 namespace cpu {
 namespace aarch64 {
 
+static bool impl_supports_datatype(data_type_t data_type) {
+    switch (data_type) {
+        case data_type::bf16:
+            return platform::has_data_type_support(data_type::bf16);
+        // Shuffle only moves data, so no f16 arithmetic support is required.
+        case data_type::f16:
+        case data_type::f32:
+        case data_type::s32:
+        case data_type::s8:
+        case data_type::u8: return true;
+        default: return false;
+    }
+}
+
 template <cpu_isa_t isa>
 status_t jit_uni_shuffle_t<isa>::pd_t::init(engine_t *engine) {
     using namespace format_tag;
@@ -49,9 +63,8 @@ status_t jit_uni_shuffle_t<isa>::pd_t::init(engine_t *engine) {
     conf_.data_type = src_d.data_type();
 
     const bool ok = is_superset(get_max_cpu_isa(), isa)
-            && utils::one_of(conf_.data_type, f32, s32, bf16)
+            && impl_supports_datatype(conf_.data_type)
             && src_d.data_type() == dst_d.data_type()
-            && platform::has_data_type_support(conf_.data_type)
             && attr()->has_default_values() && axis() == 1
             && set_default_formats_common() && src_d == dst_d;
 
@@ -62,10 +75,11 @@ status_t jit_uni_shuffle_t<isa>::pd_t::init(engine_t *engine) {
     const format_tag_t blocked_format
             = memory_desc_matches_one_of_tag(*src_md(), nCw16c, nChw16c,
                     nCdhw16c, nCw8c, nChw8c, nCdhw8c, nCw4c, nChw4c, nCdhw4c);
+    const format_tag_t nspc_format
+            = memory_desc_matches_one_of_tag(*src_md(), nc, nwc, nhwc, ndhwc);
+    const format_tag_t ncsp_format
+            = memory_desc_matches_one_of_tag(*src_md(), ncw, nchw, ncdhw);
 
-    if (blocked_format == format_tag::undef) return status::unimplemented;
-
-    conf_.blk_size = src_d.blocking_desc().strides[ndims() - 1];
     /* Because "ST1H { <Zt>.S }, <Pg>, [<Xn|SP>, <Zm>.S, UXTW #1]" is used
        to gather data for bf16, simd_w must be calculated
        with sizeof(uint32_t). */
@@ -74,17 +88,45 @@ status_t jit_uni_shuffle_t<isa>::pd_t::init(engine_t *engine) {
     const bool has_spatial = utils::one_of(ndims(), 3, 4, 5);
     const dim_t HW = H() * W();
     conf_.sp = has_spatial ? D() * HW : HW;
+    conf_.dt_size = types::data_type_size(conf_.data_type);
+
+    const dim_t nthr = dnnl_get_max_threads();
+
+    if (blocked_format != format_tag::undef) {
+        conf_.blk_size = src_d.blocking_desc().strides[ndims() - 1];
+        if (conf_.simd_w > conf_.blk_size) return status::unimplemented;
 
-    if (conf_.simd_w <= conf_.blk_size) {
         conf_.tag_kind = jit_memory_tag_kind_t::blocked;
         conf_.simd_tail = C() % conf_.simd_w;
         conf_.c_split_size = conf_.blk_size;
         if (C() < std::sqrt(conf_.sp))
-            conf_.sp_split_size = conf_.sp
-                    / math::gcd(conf_.sp,
-                            static_cast<dim_t>(dnnl_get_max_threads()));
+            conf_.sp_split_size = conf_.sp / math::gcd(conf_.sp, nthr);
         else
             conf_.sp_split_size = conf_.sp;
+    } else if (nspc_format != format_tag::undef) {
+        // Channels of every spatial point are gathered through the
+        // transposed offsets, spatial points are split between threads.
+        conf_.tag_kind = jit_memory_tag_kind_t::nspc;
+        conf_.simd_tail = C() % conf_.simd_w;
+        conf_.c_split_size = C();
+        conf_.sp_split_size = nstl::max<dim_t>(1,
+                utils::div_up(conf_.sp,
+                        nstl::max<dim_t>(1, utils::div_up(nthr, MB()))));
+    } else if (ncsp_format != format_tag::undef) {
+        // Every channel is a contiguous plane copied from its transposed
+        // position. Offsets address whole planes and must fit in 32 bits.
+        if (C() * conf_.sp * conf_.dt_size > UINT32_MAX)
+            return status::unimplemented;
+
+        conf_.tag_kind = jit_memory_tag_kind_t::ncsp;
+        conf_.sp_split_size = conf_.sp;
+        // Keep at least a few KB of copy per job when planes are small.
+        static constexpr dim_t min_bytes_per_job = 4096;
+        conf_.c_split_size = nstl::min(C(),
+                nstl::max<dim_t>(1,
+                        utils::div_up(min_bytes_per_job,
+                                nstl::max<dim_t>(
+                                        1, conf_.sp * conf_.dt_size))));
     } else
         return status::unimplemented;
 
@@ -95,7 +137,6 @@ status_t jit_uni_shuffle_t<isa>::pd_t::init(engine_t *engine) {
     conf_.h = H();
     conf_.w = W();
 
-    conf_.dt_size = types::data_type_size(conf_.data_type);
     conf_.stride_mb = src_d.blocking_desc().strides[0];
     conf_.group_size = group_size();
     conf_.axis = axis();
@@ -122,11 +163,17 @@ status_t jit_uni_shuffle_t<isa>::precompute_offsets() {
     });
 
     const dim_t C = conf.c;
+    // The kernels load the indices by full vectors, so round the table up
+    // to avoid reading past its end for the channel tail.
+    const dim_t C_padded = utils::rnd_up(C, nstl::max(1u, conf.simd_w));
     input_off_ = (unsigned *)malloc(
-            C * sizeof(unsigned), platform::get_cache_line_size());
+            C_padded * sizeof(unsigned), platform::get_cache_line_size());
     if (input_off_ == nullptr) return dnnl_out_of_memory;
+    for (dim_t c = C; c < C_padded; ++c)
+        input_off_[c] = 0;
 
-    if (pd()->get_conf().tag_kind == jit_memory_tag_kind_t::blocked) {
+    const auto tag_kind = conf.tag_kind;
+    if (tag_kind == jit_memory_tag_kind_t::blocked) {
         const dim_t blk_size = conf.blk_size;
         const dim_t CB = utils::div_up(C, blk_size);
         const dim_t SP = conf.sp;
@@ -143,6 +190,14 @@ status_t jit_uni_shuffle_t<isa>::precompute_offsets() {
                         * conf.dt_size;
             }
         });
+    } else if (utils::one_of(tag_kind, jit_memory_tag_kind_t::nspc,
+                       jit_memory_tag_kind_t::ncsp)) {
+        // nspc gathers single elements, ncsp copies whole planes.
+        const dim_t stride_c
+                = tag_kind == jit_memory_tag_kind_t::nspc ? 1 : conf.sp;
+        parallel_nd(C, [&](dim_t c) {
+            input_off_[c] = rev_transposed_[c] * stride_c * conf.dt_size;
+        });
     } else {
         assert(!"Invalid memory format kind.");
         return status::invalid_arguments;
@@ -187,7 +242,7 @@ status_t jit_uni_shuffle_t<isa>::execute(const exec_ctx_t &ctx) const {
     const dim_t stride_mb = conf.stride_mb;
     const int data_type_size = conf.dt_size;
 
-    if (pd()->get_conf().tag_kind == jit_memory_tag_kind_t::blocked) {
+    if (conf.tag_kind == jit_memory_tag_kind_t::blocked) {
         const dim_t CB = utils::div_up(C, conf.c_split_size);
         const dim_t SPB = SP / conf.sp_split_size;
         parallel_nd(MB, SPB, CB, [&](dim_t mb, dim_t spb, dim_t cb) {
@@ -205,6 +260,38 @@ status_t jit_uni_shuffle_t<isa>::execute(const exec_ctx_t &ctx) const {
             args.cb_loop_size = c_work;
             args.is_padded_block = cb + 1 == CB;
 
+            args.input_off_ptr = this->input_off_ + c_curr;
+            (*kernel_)(&args);
+        });
+    } else if (conf.tag_kind == jit_memory_tag_kind_t::nspc) {
+        const dim_t SPB = utils::div_up(SP, conf.sp_split_size);
+        parallel_nd(MB, SPB, [&](dim_t mb, dim_t spb) {
+            const dim_t sp_curr = spb * conf.sp_split_size;
+            const dim_t sp_work = nstl::min(conf.sp_split_size, SP - sp_curr);
+            const dim_t off = mb * stride_mb + sp_curr * C;
+
+            jit_uni_shuffle_args_t args;
+            args.src = input + off * data_type_size;
+            args.dst = output + off * data_type_size;
+
+            args.sp_loop_size = sp_work;
+
+            args.input_off_ptr = this->input_off_;
+            (*kernel_)(&args);
+        });
+    } else if (conf.tag_kind == jit_memory_tag_kind_t::ncsp) {
+        const dim_t CB = utils::div_up(C, conf.c_split_size);
+        parallel_nd(MB, CB, [&](dim_t mb, dim_t cb) {
+            const dim_t c_curr = cb * conf.c_split_size;
+            const dim_t c_work = nstl::min(conf.c_split_size, C - c_curr);
+            const dim_t off = mb * stride_mb;
+
+            jit_uni_shuffle_args_t args;
+            args.src = input + off * data_type_size;
+            args.dst = output + (off + SP * c_curr) * data_type_size;
+
+            args.cb_loop_size = c_work;
+
             args.input_off_ptr = this->input_off_ + c_curr;
             (*kernel_)(&args);
         });
@@ -35,6 +35,7 @@ using namespace Xbyak_aarch64;
 #define GET_OFF(field) offsetof(jit_uni_shuffle_args_t, field)
 
 static size_t get_padding_size(const jit_shuffle_conf_t &conf) {
+    if (conf.tag_kind != jit_memory_tag_kind_t::blocked) return 0;
     const auto padding_tail_size = conf.c % conf.blk_size;
     return (padding_tail_size) ? conf.blk_size - padding_tail_size : 0;
 }
@@ -65,6 +66,17 @@ void jit_uni_shuffle_kernel_t<isa>::prepare_mask() {
         ptrue(k_full_mask_.s, VL8);
     else if (sve_length_ == util::SVE_128)
         ptrue(k_full_mask_.s, VL4);
+    else
+        ptrue(k_full_mask_.s);
+
+    if (conf_.tag_kind == jit_memory_tag_kind_t::ncsp) {
+        const size_t copy_tail = (conf_.sp * conf_.dt_size) % sve_length_;
+        if (copy_tail > 0) {
+            mov_imm(X_TMP_0, 0);
+            mov_imm(X_TMP_1, copy_tail);
+            whilelt(k_copy_tail_mask_.b, X_TMP_0, X_TMP_1);
+        }
+    }
 }
 
 template <>
@@ -76,14 +88,22 @@ void jit_uni_shuffle_kernel_t<isa>::gather_data(const XReg &reg_src_addr,
     using namespace data_type;
     const PReg &mask = is_tail ? k_tail_mask_ : k_full_mask_;
 
-    if (utils::one_of(conf_.data_type, f32, s32)) {
-        lsr(TRegS(indices_idx), TRegS(indices_idx), 2);
-        ld1w(TRegS(data_idx), mask / T_z,
-                ptr(reg_src_addr, TRegS(indices_idx), UXTW, 2));
-    } else if (conf_.data_type == bf16) {
-        lsr(TRegS(indices_idx), TRegS(indices_idx), 1);
-        ld1h(TRegS(data_idx), mask / T_z,
-                ptr(reg_src_addr, TRegS(indices_idx), UXTW, 1));
+    switch (conf_.dt_size) {
+        case 4:
+            lsr(TRegS(indices_idx), TRegS(indices_idx), 2);
+            ld1w(TRegS(data_idx), mask / T_z,
+                    ptr(reg_src_addr, TRegS(indices_idx), UXTW, 2));
+            break;
+        case 2:
+            lsr(TRegS(indices_idx), TRegS(indices_idx), 1);
+            ld1h(TRegS(data_idx), mask / T_z,
+                    ptr(reg_src_addr, TRegS(indices_idx), UXTW, 1));
+            break;
+        case 1:
+            ld1b(TRegS(data_idx), mask / T_z,
+                    ptr(reg_src_addr, TRegS(indices_idx), UXTW));
+            break;
+        default: assert(!"unsupported data type size");
     }
 }
 
@@ -99,7 +119,12 @@ void jit_uni_shuffle_kernel_t<asimd>::gather_data(const XReg &addr,
     for (unsigned j = 0; j < number_of_values_to_load; j++) {
         mov(W_TMP_0, VReg4S(indices_idx)[j]);
         add(X_DEFAULT_ADDR, addr, X_TMP_0);
-        ld1(v[j], ptr(X_DEFAULT_ADDR));
+        switch (conf_.dt_size) {
+            case 4: ld1(v[j], ptr(X_DEFAULT_ADDR)); break;
+            case 2: ld1(VReg8H(data_idx)[j], ptr(X_DEFAULT_ADDR)); break;
+            case 1: ld1(VReg16B(data_idx)[j], ptr(X_DEFAULT_ADDR)); break;
+            default: assert(!"unsupported data type size");
+        }
     }
 }
 
@@ -113,17 +138,21 @@ void jit_uni_shuffle_kernel_t<isa>::store_data(const int data_idx,
 
     add_imm(X_DEFAULT_ADDR, reg_dst_addr, offset, X_TMP_0);
 
+    // Elements are kept in 32-bit lanes and narrowed by the store.
+    auto store = [&](const TRegS &data, const PReg &pg) {
+        switch (conf_.dt_size) {
+            case 4: st1w(data, pg, ptr(X_DEFAULT_ADDR)); break;
+            case 2: st1h(data, pg, ptr(X_DEFAULT_ADDR)); break;
+            case 1: st1b(data, pg, ptr(X_DEFAULT_ADDR)); break;
+            default: assert(!"unsupported data type size");
+        }
+    };
+
     if (extend_for_padding) {
         sel(vmm_tmp_.s, k_tail_mask_, TRegS(data_idx), vmm_zero_.s);
-        if (utils::one_of(conf_.data_type, f32, s32))
-            st1w(vmm_tmp_.s, P_ALL_ONE, ptr(X_DEFAULT_ADDR));
-        else // bf16
-            st1h(vmm_tmp_.s, P_ALL_ONE, ptr(X_DEFAULT_ADDR));
+        store(vmm_tmp_.s, P_ALL_ONE);
     } else {
-        if (utils::one_of(conf_.data_type, f32, s32))
-            st1w(TRegS(data_idx), mask, ptr(X_DEFAULT_ADDR));
-        else // bf16
-            st1h(TRegS(data_idx), mask, ptr(X_DEFAULT_ADDR));
+        store(TRegS(data_idx), mask);
     }
 
     append_zero_padding(reg_dst_,
@@ -137,11 +166,22 @@ void jit_uni_shuffle_kernel_t<asimd>::store_data(const int data_idx,
         for (unsigned i = 0; i < conf_.simd_tail; i++) {
             add_imm(X_DEFAULT_ADDR, reg_dst_addr, offset + i * conf_.dt_size,
                     X_TMP_0);
-            st1(VReg4S(data_idx)[i], ptr(X_DEFAULT_ADDR));
+            switch (conf_.dt_size) {
+                case 4: st1(VReg4S(data_idx)[i], ptr(X_DEFAULT_ADDR)); break;
+                case 2: st1(VReg8H(data_idx)[i], ptr(X_DEFAULT_ADDR)); break;
+                case 1: st1(VReg16B(data_idx)[i], ptr(X_DEFAULT_ADDR)); break;
+                default: assert(!"unsupported data type size");
+            }
         }
     } else {
+        // gather_data fills the low 4 lanes of the element size.
         add_imm(X_DEFAULT_ADDR, reg_dst_addr, offset, X_TMP_0);
-        str(QReg(data_idx), ptr(X_DEFAULT_ADDR));
+        switch (conf_.dt_size) {
+            case 4: str(QReg(data_idx), ptr(X_DEFAULT_ADDR)); break;
+            case 2: str(DReg(data_idx), ptr(X_DEFAULT_ADDR)); break;
+            case 1: str(SReg(data_idx), ptr(X_DEFAULT_ADDR)); break;
+            default: assert(!"unsupported data type size");
+        }
     }
 
     append_zero_padding(reg_dst_, false);
@@ -279,6 +319,205 @@ void jit_uni_shuffle_kernel_t<isa>::shuffle_blocked_format() {
     L(blk_tail_check_end);
 }
 
+template <cpu_isa_t isa>
+void jit_uni_shuffle_kernel_t<isa>::shuffle_nspc_format() {
+    const XReg &reg_sp = reg_tmp2_;
+    const XReg &reg_c_chunk = reg_tmp3_;
+    const XReg &reg_sp_loop_size = reg_tmp4_;
+    const XReg &reg_indices_curr = reg_tmp5_;
+    const XReg &reg_dst_curr = reg_tmp6_;
+    const int c_full_chunks = conf_.c / conf_.simd_w;
+    const bool has_c_tail = conf_.simd_tail > 0;
+    const int c_chunks = c_full_chunks + has_c_tail;
+    const bool preload_indices = c_chunks <= max_preloaded_indices_;
+    const int chunk_size = conf_.simd_w * conf_.dt_size;
+    const int indices_chunk_size = conf_.simd_w * conf_.el_size_of_indices;
+
+    auto load_indices = [&](const TReg &vmm, const XReg &reg_addr, int off) {
+        if (is_superset(isa, sve))
+            ld1w(ZRegS(vmm.getIdx()), P_ALL_ONE,
+                    ptr(addr_off(reg_addr, off, X_DEFAULT_ADDR, X_TMP_0)));
+        else
+            uni_ldr(vmm, reg_addr, off);
+    };
+
+    auto shuffle = [&](const XReg &reg_dst_addr, int off, bool is_tail) {
+        gather_data(reg_src_, vmm_indices_.getIdx(), vmm_src_.getIdx(),
+                is_tail);
+        store_data(vmm_src_.getIdx(), reg_dst_addr, off, is_tail);
+    };
+
+    if (preload_indices) {
+        for (int i = 0; i < c_chunks; ++i)
+            load_indices(TReg(preloaded_indices_idx_ + i), reg_indices_,
+                    i * indices_chunk_size);
+    }
+
+    add_imm(X_DEFAULT_ADDR, reg_param, GET_OFF(sp_loop_size), X_TMP_0);
+    ldr(reg_sp_loop_size, ptr(X_DEFAULT_ADDR));
+
+    Label sp_loop_begin, sp_loop_end;
+
+    eor(reg_sp, reg_sp, reg_sp);
+    L(sp_loop_begin);
+    {
+        cmp(reg_sp, reg_sp_loop_size);
+        b(EQ, sp_loop_end);
+
+        if (preload_indices) {
+            for (int i = 0; i < c_chunks; ++i) {
+                const TReg vmm_preloaded(preloaded_indices_idx_ + i);
+                uni_orr(TReg(vmm_indices_.getIdx()), vmm_preloaded,
+                        vmm_preloaded);
+                shuffle(reg_dst_, i * chunk_size,
+                        has_c_tail && i == c_chunks - 1);
+            }
+        } else {
+            Label c_loop_begin;
+
+            mov(reg_indices_curr, reg_indices_);
+            mov(reg_dst_curr, reg_dst_);
+
+            mov_imm(reg_c_chunk, c_full_chunks);
+            L(c_loop_begin);
+            {
+                load_indices(vmm_indices_, reg_indices_curr, 0);
+                shuffle(reg_dst_curr, 0, false);
+
+                add_imm(reg_indices_curr, reg_indices_curr,
+                        indices_chunk_size, X_TMP_0);
+                add_imm(reg_dst_curr, reg_dst_curr, chunk_size, X_TMP_0);
+
+                subs(reg_c_chunk, reg_c_chunk, 1);
+                b(NE, c_loop_begin);
+            }
+
+            if (has_c_tail) {
+                load_indices(vmm_indices_, reg_indices_curr, 0);
+                shuffle(reg_dst_curr, 0, true);
+            }
+        }
+
+        add_imm(reg_sp, reg_sp, 1, X_TMP_0);
+        add_imm(reg_src_, reg_src_, conf_.c * conf_.dt_size, X_TMP_0);
+        add_imm(reg_dst_, reg_dst_, conf_.c * conf_.dt_size, X_TMP_0);
+
+        b(sp_loop_begin);
+    }
+    L(sp_loop_end);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_shuffle_kernel_t<isa>::copy_plane(
+        const XReg &reg_src_addr, const XReg &reg_dst_addr) {
+    const XReg &reg_loop = reg_tmp6_;
+    const bool is_sve = is_superset(isa, sve);
+    const size_t vlen = is_sve ? sve_length_ : simd_bytes(isa);
+    const size_t plane_size = conf_.sp * conf_.dt_size;
+    constexpr int unroll = 4;
+    const size_t unrolled_size = unroll * vlen;
+    const size_t n_unrolled = plane_size / unrolled_size;
+    const int n_vecs = (plane_size % unrolled_size) / vlen;
+    const size_t tail = plane_size % vlen;
+
+    // Both addresses are advanced past the plane.
+    auto copy_vecs = [&](int n) {
+        for (int i = 0; i < n; ++i) {
+            if (is_sve)
+                ld1b(ZRegB(5 + i), P_ALL_ONE / T_z,
+                        ptr(reg_src_addr, i, MUL_VL));
+            else
+                ldr(QReg(5 + i), ptr(reg_src_addr, i * (int)vlen));
+        }
+        for (int i = 0; i < n; ++i) {
+            if (is_sve)
+                st1b(ZRegB(5 + i), P_ALL_ONE, ptr(reg_dst_addr, i, MUL_VL));
+            else
+                str(QReg(5 + i), ptr(reg_dst_addr, i * (int)vlen));
+        }
+        add_imm(reg_src_addr, reg_src_addr, n * vlen, X_TMP_0);
+        add_imm(reg_dst_addr, reg_dst_addr, n * vlen, X_TMP_0);
+    };
+
+    if (n_unrolled > 0) {
+        Label loop_begin;
+        mov_imm(reg_loop, n_unrolled);
+        L(loop_begin);
+        {
+            copy_vecs(unroll);
+            subs(reg_loop, reg_loop, 1);
+            b(NE, loop_begin);
+        }
+    }
+
+    if (n_vecs > 0) copy_vecs(n_vecs);
+
+    if (tail == 0) return;
+
+    if (is_sve) {
+        ld1b(ZRegB(5), k_copy_tail_mask_ / T_z, ptr(reg_src_addr));
+        st1b(ZRegB(5), k_copy_tail_mask_, ptr(reg_dst_addr));
+    } else {
+        // Copy the remaining bytes with decreasing power-of-two chunks.
+        size_t off = 0;
+        for (size_t chunk = 8; chunk > 0; chunk /= 2) {
+            if (!((tail - off) & chunk)) continue;
+            const XReg reg_src_off = addr_off(
+                    reg_src_addr, off, X_DEFAULT_ADDR, X_TMP_0);
+            switch (chunk) {
+                case 8: ldr(reg_tmp_, ptr(reg_src_off)); break;
+                case 4: ldr(WReg(reg_tmp_.getIdx()), ptr(reg_src_off)); break;
+                case 2: ldrh(WReg(reg_tmp_.getIdx()), ptr(reg_src_off)); break;
+                case 1: ldrb(WReg(reg_tmp_.getIdx()), ptr(reg_src_off)); break;
+            }
+            const XReg reg_dst_off = addr_off(
+                    reg_dst_addr, off, X_DEFAULT_ADDR, X_TMP_0);
+            switch (chunk) {
+                case 8: str(reg_tmp_, ptr(reg_dst_off)); break;
+                case 4: str(WReg(reg_tmp_.getIdx()), ptr(reg_dst_off)); break;
+                case 2: strh(WReg(reg_tmp_.getIdx()), ptr(reg_dst_off)); break;
+                case 1: strb(WReg(reg_tmp_.getIdx()), ptr(reg_dst_off)); break;
+            }
+            off += chunk;
+        }
+    }
+    add_imm(reg_src_addr, reg_src_addr, tail, X_TMP_0);
+    add_imm(reg_dst_addr, reg_dst_addr, tail, X_TMP_0);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_shuffle_kernel_t<isa>::shuffle_ncsp_format() {
+    const XReg &reg_c = reg_tmp2_;
+    const XReg &reg_off = reg_tmp3_;
+    const XReg &reg_cb_loop_size = reg_tmp4_;
+    const XReg &reg_src_curr = reg_tmp5_;
+
+    add_imm(X_DEFAULT_ADDR, reg_param, GET_OFF(cb_loop_size), X_TMP_0);
+    ldr(reg_cb_loop_size, ptr(X_DEFAULT_ADDR));
+
+    Label c_loop_begin, c_loop_end;
+
+    eor(reg_c, reg_c, reg_c);
+    L(c_loop_begin);
+    {
+        cmp(reg_c, reg_cb_loop_size);
+        b(EQ, c_loop_end);
+
+        ldr(WReg(reg_off.getIdx()), ptr(reg_indices_));
+        add(reg_src_curr, reg_src_, reg_off);
+
+        // Advances reg_dst_ to the next output plane.
+        copy_plane(reg_src_curr, reg_dst_);
+
+        add_imm(reg_c, reg_c, 1, X_TMP_0);
+        add_imm(reg_indices_, reg_indices_, conf_.el_size_of_indices,
+                X_TMP_0);
+
+        b(c_loop_begin);
+    }
+    L(c_loop_end);
+}
+
 template <cpu_isa_t isa>
 void jit_uni_shuffle_kernel_t<isa>::append_zero_padding(
         const XReg &reg_dst_addr, const bool extend_for_padding) {
@@ -356,7 +595,12 @@ void jit_uni_shuffle_kernel_t<isa>::generate() {
     add_imm(X_DEFAULT_ADDR, reg_param, GET_OFF(is_padded_block), X_TMP_0);
     ldrb(WReg(reg_padded_block.getIdx()), ptr(X_DEFAULT_ADDR));
 
-    shuffle_blocked_format();
+    switch (conf_.tag_kind) {
+        case jit_memory_tag_kind_t::blocked: shuffle_blocked_format(); break;
+        case jit_memory_tag_kind_t::nspc: shuffle_nspc_format(); break;
+        case jit_memory_tag_kind_t::ncsp: shuffle_ncsp_format(); break;
+        default: assert(!"Invalid memory format kind.");
+    }
 
     postamble();
 }
@@ -67,6 +67,19 @@ struct jit_uni_shuffle_kernel_t : public jit_generator_t {
 
     void shuffle_blocked_format();
 
+    /*
+     * Gathers the channels of every spatial point through the precomputed
+     * offsets. The offsets stay in registers when the channels fit.
+     */
+    void shuffle_nspc_format();
+
+    /*
+     * Copies every channel plane from its transposed position.
+     */
+    void shuffle_ncsp_format();
+
+    void copy_plane(const XReg &reg_src_addr, const XReg &reg_dst_addr);
+
     void append_zero_padding(
             const XReg &reg_dst_addr, const bool zero_extend_write);
 
@@ -80,6 +93,11 @@ struct jit_uni_shuffle_kernel_t : public jit_generator_t {
 
     const PReg k_tail_mask_ = p1;
     const PReg k_full_mask_ = p2;
+    const PReg k_copy_tail_mask_ = p3;
+
+    // Registers holding the preloaded nspc offsets.
+    static constexpr int preloaded_indices_idx_ = 12;
+    static constexpr int max_preloaded_indices_ = 16;
 
     const XReg &reg_tmp_ = x7;
     const XReg &reg_dst_ = x3;
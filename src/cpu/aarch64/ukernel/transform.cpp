@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2025 Arm Ltd. and affiliates
+* Copyright 2025-2026 Arm Ltd. and affiliates
 * Copyright 2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
@@ -15,6 +15,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "common/dnnl_thread.hpp"
 #include "common/verbose.hpp"
 
 #include "cpu/aarch64/matmul/brgemm_matmul_utils.hpp"
@@ -77,7 +78,38 @@ status_t transform_t::generate() {
     return status::success;
 }
 
-status_t transform_t::execute(const void *src, void *dst) const {
+void transform_t::execute_block(const uint8_t *src_ptr, uint8_t *dst_ptr,
+        dim_t n_blk_idx, dim_t k_blk_idx) const {
+    const auto &kernel_conf = bmc_;
+    const dim_t k_blks = utils::div_up(kernel_conf.K, kernel_conf.K_blk);
+    const auto blk_size = kernel_conf.K_blk * kernel_conf.N_blk;
+
+    const auto i_dt_sz = kernel_conf.b_dt_sz;
+    const auto o_dt_sz = kernel_conf.a_dt_sz;
+
+    const auto n = n_blk_idx * kernel_conf.N_blk;
+    const auto k = k_blk_idx * kernel_conf.K_blk;
+    const bool is_N_tail = (kernel_conf.N - n) < kernel_conf.N_blk;
+    const bool is_K_tail = (kernel_conf.K - k) < kernel_conf.K_blk;
+
+    // Each block of N_blk columns holds all its K blocks contiguously, so
+    // the blocks are disjoint and can be packed in any order.
+    const auto src_offset = i_dt_sz * (k * strides_[0] + n * strides_[1]);
+    const auto dst_offset
+            = o_dt_sz * (n_blk_idx * k_blks + k_blk_idx) * blk_size;
+
+    auto ker_exec_ctx = matmul::jit_brgemm_matmul_copy_b_t::ctx_t();
+    ker_exec_ctx.current_N_blk
+            = is_N_tail ? kernel_conf.N_tail : kernel_conf.N_blk;
+    ker_exec_ctx.src = &src_ptr[src_offset];
+    ker_exec_ctx.tr_src = &dst_ptr[dst_offset];
+    ker_exec_ctx.current_K_start = k;
+    ker_exec_ctx.current_K_iters
+            = is_K_tail ? kernel_conf.K_tail : kernel_conf.K_blk;
+    (*pack_B_kernel_)(&ker_exec_ctx);
+}
+
+status_t transform_t::execute(const void *src, void *dst, bool parallel) const {
     double start_ms = 0;
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel))
         start_ms = get_msec();
@@ -88,43 +120,15 @@ status_t transform_t::execute(const void *src, void *dst) const {
     const auto &kernel_conf = bmc_;
     const dim_t n_blks = utils::div_up(kernel_conf.N, kernel_conf.N_blk);
     const dim_t k_blks = utils::div_up(kernel_conf.K, kernel_conf.K_blk);
-    const auto blk_size = kernel_conf.K_blk * kernel_conf.N_blk;
 
-    const auto i_dt_sz = kernel_conf.b_dt_sz;
-    const auto o_dt_sz = kernel_conf.a_dt_sz;
-
-    for (dim_t n_blk_idx = 0; n_blk_idx < n_blks; n_blk_idx++) {
-        const auto n = n_blk_idx * kernel_conf.N_blk;
-        const bool is_N_tail = (kernel_conf.N - n) < kernel_conf.N_blk;
-        auto ker_exec_ctx = matmul::jit_brgemm_matmul_copy_b_t::ctx_t();
-        ker_exec_ctx.current_N_blk
-                = is_N_tail ? kernel_conf.N_tail : kernel_conf.N_blk;
-
-        int k_blk_idx = 0;
-        for (; k_blk_idx < kernel_conf.K / kernel_conf.K_blk; k_blk_idx++) {
-            const auto k = k_blk_idx * kernel_conf.K_blk;
-            const auto src_offset
-                    = i_dt_sz * (k * strides_[0] + n * strides_[1]);
-            const auto dst_offset
-                    = o_dt_sz * (k_blk_idx * blk_size + n_blk_idx * k_blks);
-            ker_exec_ctx.src = &src_ptr[src_offset];
-            ker_exec_ctx.tr_src = &dst_ptr[dst_offset];
-            ker_exec_ctx.current_K_start = k;
-            ker_exec_ctx.current_K_iters = kernel_conf.K_blk;
-            (*pack_B_kernel_)(&ker_exec_ctx);
-        }
-        if (kernel_conf.K_tail > 0) {
-            const auto k = k_blk_idx * kernel_conf.K_blk;
-            const auto src_offset
-                    = i_dt_sz * (k * strides_[0] + n * strides_[1]);
-            const auto dst_offset
-                    = o_dt_sz * (k_blk_idx * blk_size + n_blk_idx * k_blks);
-            ker_exec_ctx.src = &src_ptr[src_offset];
-            ker_exec_ctx.tr_src = &dst_ptr[dst_offset];
-            ker_exec_ctx.current_K_start = k;
-            ker_exec_ctx.current_K_iters = kernel_conf.K_tail;
-            (*pack_B_kernel_)(&ker_exec_ctx);
-        }
+    if (parallel) {
+        parallel_nd(n_blks, k_blks, [&](dim_t n_blk_idx, dim_t k_blk_idx) {
+            execute_block(src_ptr, dst_ptr, n_blk_idx, k_blk_idx);
+        });
+    } else {
+        for (dim_t n_blk_idx = 0; n_blk_idx < n_blks; n_blk_idx++)
+            for (dim_t k_blk_idx = 0; k_blk_idx < k_blks; k_blk_idx++)
+                execute_block(src_ptr, dst_ptr, n_blk_idx, k_blk_idx);
     }
 
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
@@ -195,6 +199,15 @@ status_t dnnl_transform_execute(
     return status::success;
 }
 
+status_t dnnl_transform_execute_parallel(
+        const transform_t *transform, const void *in_ptr, void *out_ptr) {
+    if (utils::any_null(transform, in_ptr, out_ptr))
+        return status::invalid_arguments;
+
+    CHECK(transform->execute(in_ptr, out_ptr, /* parallel = */ true));
+    return status::success;
+}
+
 status_t dnnl_transform_destroy(transform_t *transform) {
     delete transform;
     return status::success;
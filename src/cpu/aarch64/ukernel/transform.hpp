@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2025 Arm Ltd. and affiliates
+* Copyright 2025-2026 Arm Ltd. and affiliates
 * Copyright 2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
@@ -36,8 +36,10 @@ struct dnnl_transform : public dnnl::impl::c_compatible {
     // Generates a transform kernel.
     dnnl::impl::status_t generate();
 
-    // Executes a transform kernel.
-    dnnl::impl::status_t execute(const void *src, void *dst) const;
+    // Executes a transform kernel. With `parallel`, the blocks are
+    // distributed between the library threads.
+    dnnl::impl::status_t execute(
+            const void *src, void *dst, bool parallel = false) const;
 
 private:
     // User's inputs.
@@ -56,6 +58,10 @@ private:
             dnnl::impl::cpu::aarch64::matmul::jit_brgemm_matmul_copy_b_t>
             pack_B_kernel_;
 
+    // Packs the block of K_blk rows and N_blk columns with the given indices.
+    void execute_block(const uint8_t *src_ptr, uint8_t *dst_ptr,
+            dnnl::impl::dim_t n_blk_idx, dnnl::impl::dim_t k_blk_idx) const;
+
     // Creates a `verbose_info_` string once during `generate()` call, and calls
     // it during execute(). This is done to avoid string re-creation.
     dnnl::impl::status_t create_verbose_info();
@@ -77,6 +83,9 @@ status_t dnnl_transform_generate(dnnl_transform *transform);
 status_t dnnl_transform_execute(
         const dnnl_transform *transform, const void *in_ptr, void *out_ptr);
 
+status_t dnnl_transform_execute_parallel(
+        const dnnl_transform *transform, const void *in_ptr, void *out_ptr);
+
 status_t dnnl_transform_destroy(dnnl_transform *transform);
 
 } // namespace ukernel
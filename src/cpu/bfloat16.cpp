@@ -27,6 +27,8 @@
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_uni_convert_xf16.hpp"
+#elif DNNL_AARCH64
+#include "cpu/aarch64/jit_uni_convert_xf16.hpp"
 #endif
 
 namespace dnnl {
@@ -62,6 +64,12 @@ void cvt_float_to_bfloat16(bfloat16_t *out, const float *inp, size_t nelems) {
         cvt_ps_to_bf16(&p_);
         return;
     }
+#elif DNNL_AARCH64
+    using namespace cpu::aarch64;
+    if (jit_cvt_xf16_t::is_supported(data_type::f32, data_type::bf16)) {
+        static const jit_cvt_xf16_t kernel(data_type::f32, data_type::bf16);
+        return kernel(out, inp, nelems);
+    }
 #endif
 
     PRAGMA_OMP_SIMD()
@@ -77,6 +85,12 @@ void cvt_bfloat16_to_float(float *out, const bfloat16_t *inp, size_t nelems) {
                 data_type::bf16, false);
         return kernel(out, inp, nelems);
     }
+#elif DNNL_AARCH64
+    using namespace cpu::aarch64;
+    if (jit_cvt_xf16_t::is_supported(data_type::bf16, data_type::f32)) {
+        static const jit_cvt_xf16_t kernel(data_type::bf16, data_type::f32);
+        return kernel(out, inp, nelems);
+    }
 #endif
 
     PRAGMA_OMP_SIMD()
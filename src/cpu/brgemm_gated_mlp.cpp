@@ -0,0 +1,335 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/brgemm_gated_mlp.hpp"
+
+#if DNNL_X64 || DNNL_AARCH64
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+#if DNNL_X64
+namespace brg_impl = dnnl::impl::cpu::x64;
+#elif DNNL_AARCH64
+namespace brg_impl = dnnl::impl::cpu::aarch64;
+#endif
+
+// Rows of src processed by one work item. The gate and up tiles are
+// m_blk * oc_blk floats each; with the defaults both fit in L1 together.
+constexpr dim_t m_blk_default = 32;
+constexpr dim_t oc_blk_default = 64;
+
+brg_impl::cpu_isa_t get_brgemm_isa() {
+    using namespace brg_impl;
+#if DNNL_X64
+    // The AMX kernels are not used here as they need the tiles configured.
+    if (mayiuse(avx512_core)) return avx512_core;
+    if (mayiuse(avx2)) return avx2;
+    return isa_undef;
+#elif DNNL_AARCH64
+    // The SME brgemm kernel is not used here as it expects packed operands.
+    if (mayiuse(sve_512)) return sve_512;
+    if (mayiuse(sve_256)) return sve_256;
+    if (mayiuse(sve_128)) return sve_128;
+    return isa_undef;
+#endif
+}
+
+// Row stride of a 2d matrix given as a 2d or 3d memory descriptor with a
+// unit outer dimension
+dim_t get_ld(const memory_desc_wrapper &mdw) {
+    return mdw.blocking_desc().strides[mdw.ndims() - 2];
+}
+
+bool is_row_major(const memory_desc_wrapper &mdw) {
+    return mdw.is_plain() && mdw.blocking_desc().strides[mdw.ndims() - 1] == 1;
+}
+
+} // namespace
+
+using namespace memory_tracking::names;
+
+status_t brgemm_gated_mlp_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    VDISPATCH_GATED_MLP(
+            utils::everyone_is(f32, arg_md(DNNL_ARG_SRC)->data_type,
+                    arg_md(DNNL_ARG_WEIGHTS_GATE)->data_type,
+                    arg_md(DNNL_ARG_WEIGHTS_UP)->data_type,
+                    arg_md(DNNL_ARG_WEIGHTS_DOWN)->data_type,
+                    arg_md(DNNL_ARG_DST)->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GATED_MLP(
+            attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_GATED_MLP(
+            utils::one_of(activation(), alg_kind::eltwise_swish,
+                    alg_kind::eltwise_gelu_erf, alg_kind::eltwise_gelu_tanh),
+            VERBOSE_BAD_ALGORITHM);
+
+    CHECK(init_conf(engine));
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_gated_mlp_t::pd_t::init_conf(engine_t *engine) {
+    const memory_desc_wrapper src_d(arg_md(DNNL_ARG_SRC));
+    const memory_desc_wrapper wei_gate_d(arg_md(DNNL_ARG_WEIGHTS_GATE));
+    const memory_desc_wrapper wei_up_d(arg_md(DNNL_ARG_WEIGHTS_UP));
+    const memory_desc_wrapper wei_down_d(arg_md(DNNL_ARG_WEIGHTS_DOWN));
+    const memory_desc_wrapper dst_d(arg_md(DNNL_ARG_DST));
+
+    VDISPATCH_GATED_MLP(get_brgemm_isa() != brg_impl::isa_undef,
+            VERBOSE_UNSUPPORTED_ISA);
+
+    // All operands are fed to brgemm directly.
+    VDISPATCH_GATED_MLP(is_row_major(src_d) && is_row_major(wei_gate_d)
+                    && is_row_major(wei_up_d) && is_row_major(wei_down_d)
+                    && is_row_major(dst_d),
+            VERBOSE_UNSUPPORTED_TAG);
+    // The gate and up tiles are computed by the same kernel.
+    VDISPATCH_GATED_MLP(get_ld(wei_gate_d) == get_ld(wei_up_d),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    auto &c = conf_;
+    c.mb = MB();
+    c.ic = IC();
+    c.oc = OC();
+    c.activation = activation();
+
+    // For 3d tensors src and dst are [mb][1][ic], so rows are strided by
+    // the outermost dimension.
+    c.src_ld = src_d.blocking_desc().strides[0];
+    c.dst_ld = dst_d.blocking_desc().strides[0];
+    c.wei_gu_ld = get_ld(wei_gate_d);
+    c.wei_down_ld = get_ld(wei_down_d);
+
+    c.m_blk = nstl::min(c.mb, m_blk_default);
+    c.oc_blk = nstl::min(c.oc, oc_blk_default);
+    c.nb_m = utils::div_up(c.mb, c.m_blk);
+    c.nb_oc = utils::div_up(c.oc, c.oc_blk);
+    c.m_tail = c.mb % c.m_blk;
+    c.oc_tail = c.oc % c.oc_blk;
+
+    c.nthr = dnnl_get_max_threads();
+
+    // Small batches (e.g. token generation) do not have enough row blocks to
+    // keep all threads busy, so the OC dimension is split as well.
+    c.oc_split = c.nb_m >= c.nthr
+            ? 1
+            : nstl::min(c.nb_oc, utils::div_up(dim_t(c.nthr), c.nb_m));
+    c.acc_ld = c.oc_split == 1 ? c.dst_ld : c.ic;
+
+    return status::success;
+}
+
+status_t brgemm_gated_mlp_t::pd_t::init_brgemm_descs() {
+    using namespace data_type;
+    const auto &c = conf_;
+    const auto isa = get_brgemm_isa();
+
+    brg_impl::brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+
+    for (bool m_tail : {false, true})
+        for (bool oc_tail : {false, true}) {
+            const dim_t M = m_tail ? c.m_tail : c.m_blk;
+            const dim_t N = oc_tail ? c.oc_tail : c.oc_blk;
+            if (M == 0 || N == 0) continue;
+
+            const int idx = get_brg_idx(m_tail, oc_tail);
+
+            auto &gu = brg_gate_up_[idx];
+            CHECK(brg_impl::brgemm_desc_init(&gu, isa, brg_impl::brgemm_addr,
+                    f32, f32, false, false, brg_impl::brgemm_row_major, 1.f,
+                    0.f, c.src_ld, c.wei_gu_ld, c.oc_blk, M, N, c.ic));
+            CHECK(brg_impl::brgemm_desc_set_attr(&gu, brgattr));
+            CHECK(brg_impl::brgemm_desc_finalize(&gu));
+
+            // beta = 1: the contributions of all OC blocks are accumulated.
+            auto &down = brg_down_[idx];
+            CHECK(brg_impl::brgemm_desc_init(&down, isa, brg_impl::brgemm_addr,
+                    f32, f32, false, false, brg_impl::brgemm_row_major, 1.f,
+                    1.f, c.oc_blk, c.wei_down_ld, c.acc_ld, M, c.ic, N));
+            CHECK(brg_impl::brgemm_desc_set_attr(&down, brgattr));
+            CHECK(brg_impl::brgemm_desc_finalize(&down));
+        }
+
+    return status::success;
+}
+
+void brgemm_gated_mlp_t::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_gated_mlp_gate, c.nthr * c.m_blk * c.oc_blk);
+    scratchpad.template book<float>(
+            key_gated_mlp_up, c.nthr * c.m_blk * c.oc_blk);
+    if (c.oc_split > 1) {
+        scratchpad.template book<float>(
+                key_gated_mlp_acc, c.nb_m * c.oc_split * c.m_blk * c.ic);
+    }
+}
+
+status_t brgemm_gated_mlp_t::init(engine_t *engine) {
+    const auto &c = pd()->conf_;
+    for (bool m_tail : {false, true})
+        for (bool oc_tail : {false, true}) {
+            const dim_t M = m_tail ? c.m_tail : c.m_blk;
+            const dim_t N = oc_tail ? c.oc_tail : c.oc_blk;
+            if (M == 0 || N == 0) continue;
+
+            const int idx = pd_t::get_brg_idx(m_tail, oc_tail);
+            brg_impl::brgemm_kernel_t *ker = nullptr;
+            CHECK(brg_impl::brgemm_kernel_create(
+                    &ker, pd()->brg_gate_up_[idx]));
+            CHECK(safe_ptr_assign(brg_gate_up_kernels_[idx], ker));
+            CHECK(brg_impl::brgemm_kernel_create(&ker, pd()->brg_down_[idx]));
+            CHECK(safe_ptr_assign(brg_down_kernels_[idx], ker));
+        }
+    return status::success;
+}
+
+status_t brgemm_gated_mlp_t::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+
+    const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto wei_gate = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS_GATE);
+    const auto wei_up = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS_UP);
+    const auto wei_down = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS_DOWN);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *gate_base = scratchpad.template get<float>(key_gated_mlp_gate);
+    float *up_base = scratchpad.template get<float>(key_gated_mlp_up);
+    float *acc_base = c.oc_split > 1
+            ? scratchpad.template get<float>(key_gated_mlp_acc)
+            : nullptr;
+
+    const alg_kind_t act = c.activation;
+    const dim_t work_amount = c.nb_m * c.oc_split;
+
+    parallel(c.nthr, [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start == end) return;
+
+        float *gate = gate_base + ithr * c.m_blk * c.oc_blk;
+        float *up = up_base + ithr * c.m_blk * c.oc_blk;
+
+        brg_impl::brgemm_batch_element_t batch;
+
+        dim_t im {0}, is {0};
+        utils::nd_iterator_init(start, im, c.nb_m, is, c.oc_split);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t m_start = im * c.m_blk;
+            const dim_t M = nstl::min(c.m_blk, c.mb - m_start);
+            const bool is_m_tail = M < c.m_blk;
+
+            dim_t ocb_start = 0, ocb_end = 0;
+            balance211(c.nb_oc, c.oc_split, is, ocb_start, ocb_end);
+
+            const float *src_ptr = src + m_start * c.src_ld;
+            float *acc = c.oc_split > 1
+                    ? acc_base + (im * c.oc_split + is) * c.m_blk * c.ic
+                    : dst + m_start * c.dst_ld;
+            for (dim_t i = 0; i < M; ++i)
+                utils::array_set(acc + i * c.acc_ld, 0.f, c.ic);
+
+            for (dim_t ocb = ocb_start; ocb < ocb_end; ++ocb) {
+                const dim_t oc_start = ocb * c.oc_blk;
+                const dim_t N = nstl::min(c.oc_blk, c.oc - oc_start);
+                const int brg_idx = pd_t::get_brg_idx(is_m_tail, N < c.oc_blk);
+                const auto *gu_ker = brg_gate_up_kernels_[brg_idx].get();
+
+                batch.ptr.A = src_ptr;
+                batch.ptr.B = wei_gate + oc_start;
+                brg_impl::brgemm_kernel_execute(gu_ker, 1, &batch, gate);
+                batch.ptr.B = wei_up + oc_start;
+                brg_impl::brgemm_kernel_execute(gu_ker, 1, &batch, up);
+
+                // The gated tile overwrites the gate tile in place and is
+                // consumed by the down projection right away.
+                for (dim_t i = 0; i < M; ++i) {
+                    float *g = gate + i * c.oc_blk;
+                    const float *u = up + i * c.oc_blk;
+                    switch (act) {
+                        case alg_kind::eltwise_swish:
+                            PRAGMA_OMP_SIMD()
+                            for (dim_t n = 0; n < N; ++n)
+                                g[n] = math::swish_fwd(g[n], 1.f) * u[n];
+                            break;
+                        case alg_kind::eltwise_gelu_erf:
+                            for (dim_t n = 0; n < N; ++n)
+                                g[n] = math::gelu_erf_fwd(g[n]) * u[n];
+                            break;
+                        case alg_kind::eltwise_gelu_tanh:
+                            for (dim_t n = 0; n < N; ++n)
+                                g[n] = math::gelu_tanh_fwd(g[n]) * u[n];
+                            break;
+                        default: assert(!"unsupported activation");
+                    }
+                }
+
+                batch.ptr.A = gate;
+                batch.ptr.B = wei_down + oc_start * c.wei_down_ld;
+                brg_impl::brgemm_kernel_execute(
+                        brg_down_kernels_[brg_idx].get(), 1, &batch, acc);
+            }
+
+            utils::nd_iterator_step(im, c.nb_m, is, c.oc_split);
+        }
+    });
+
+    if (c.oc_split > 1) {
+        parallel_nd(c.mb, [&](dim_t m) {
+            const dim_t im = m / c.m_blk;
+            const dim_t i = m % c.m_blk;
+            float *dst_row = dst + m * c.dst_ld;
+            const float *acc_row
+                    = acc_base + im * c.oc_split * c.m_blk * c.ic + i * c.ic;
+            PRAGMA_OMP_SIMD()
+            for (dim_t k = 0; k < c.ic; ++k)
+                dst_row[k] = acc_row[k];
+            for (dim_t is = 1; is < c.oc_split; ++is) {
+                const float *a = acc_row + is * c.m_blk * c.ic;
+                PRAGMA_OMP_SIMD()
+                for (dim_t k = 0; k < c.ic; ++k)
+                    dst_row[k] += a[k];
+            }
+        });
+    }
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
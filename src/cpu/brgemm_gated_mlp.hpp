@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_BRGEMM_GATED_MLP_HPP
+#define CPU_BRGEMM_GATED_MLP_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_gated_mlp_pd.hpp"
+#include "cpu/platform.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/brgemm/brgemm.hpp"
+#elif DNNL_AARCH64
+#include "cpu/aarch64/brgemm/brgemm.hpp"
+#endif
+
+#if DNNL_X64 || DNNL_AARCH64
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace gated_mlp_brgemm {
+#if DNNL_X64
+using brgemm_desc_t = x64::brgemm_desc_t;
+using brgemm_kernel_t = x64::brgemm_kernel_t;
+#elif DNNL_AARCH64
+using brgemm_desc_t = aarch64::brgemm_desc_t;
+using brgemm_kernel_t = aarch64::brgemm_kernel_t;
+#endif
+} // namespace gated_mlp_brgemm
+
+struct brgemm_gated_mlp_conf_t {
+    dim_t mb, ic, oc;
+
+    dim_t m_blk, oc_blk;
+    dim_t nb_m, nb_oc;
+    dim_t m_tail, oc_tail;
+    // Number of chunks the OC blocks of one M block are split into. With
+    // more than one chunk every chunk accumulates a partial dst into its own
+    // buffer and the partial results are summed at the end.
+    dim_t oc_split;
+
+    // Leading dimensions of the source, gate/up weights, down weights and
+    // destination, in elements
+    dim_t src_ld, wei_gu_ld, wei_down_ld, dst_ld;
+    // Leading dimension of the down projection accumulator
+    dim_t acc_ld;
+
+    alg_kind_t activation;
+
+    int nthr;
+};
+
+/// Fused gated MLP: dst = (act(src * W_gate) . (src * W_up)) * W_down.
+///
+/// Work is split over blocks of rows of src. For every block of OC the gate
+/// and up tiles are computed with brgemm from the same src rows, the
+/// activation and the product are applied while the tiles are still in
+/// cache, and the result is immediately consumed as the A operand of the
+/// down projection. The MB x OC intermediate is never materialized.
+struct brgemm_gated_mlp_t : public primitive_t {
+    struct pd_t : public cpu_gated_mlp_pd_t {
+        using cpu_gated_mlp_pd_t::cpu_gated_mlp_pd_t;
+
+        DECLARE_COMMON_PD_T("brg:any", brgemm_gated_mlp_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernel index for a (rows tail, OC tail) combination
+        static int get_brg_idx(bool m_tail, bool oc_tail) {
+            return 2 * static_cast<int>(m_tail) + static_cast<int>(oc_tail);
+        }
+
+        brgemm_gated_mlp_conf_t conf_ {};
+        // Gate/up tile = src * W_{gate,up}, N dim is the OC block
+        gated_mlp_brgemm::brgemm_desc_t brg_gate_up_[4];
+        // Acc += tile * W_down, K dim is the OC block
+        gated_mlp_brgemm::brgemm_desc_t brg_down_[4];
+
+    private:
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_gated_mlp_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<gated_mlp_brgemm::brgemm_kernel_t> brg_gate_up_kernels_[4];
+    std::unique_ptr<gated_mlp_brgemm::brgemm_kernel_t> brg_down_kernels_[4];
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
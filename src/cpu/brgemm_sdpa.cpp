@@ -0,0 +1,1368 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/brgemm_sdpa.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#if DNNL_X64 || DNNL_AARCH64
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+#if DNNL_X64
+namespace brg_impl = dnnl::impl::cpu::x64;
+#elif DNNL_AARCH64
+namespace brg_impl = dnnl::impl::cpu::aarch64;
+#endif
+
+// Queries processed by one work item. Every query row keeps its own running
+// max and sum, so the block only has to be large enough to amortize the
+// brgemm call overhead.
+constexpr dim_t q_blk_default = 32;
+// Keys per scores block. q_blk * k_blk floats of scores are live per thread;
+// with the defaults this is 16KB and stays in L1/L2.
+constexpr dim_t k_blk_default = 128;
+
+brg_impl::cpu_isa_t get_brgemm_isa() {
+    using namespace brg_impl;
+#if DNNL_X64
+    // The AMX kernels are not used here as they need the tiles configured.
+    if (mayiuse(avx512_core)) return avx512_core;
+    if (mayiuse(avx2)) return avx2;
+    return isa_undef;
+#elif DNNL_AARCH64
+    // The SME brgemm kernel is not used here as it expects packed operands.
+    if (mayiuse(sve_512)) return sve_512;
+    if (mayiuse(sve_256)) return sve_256;
+    if (mayiuse(sve_128)) return sve_128;
+    return isa_undef;
+#endif
+}
+
+bool is_bcast_or_equal(dim_t dim, dim_t full) {
+    return dim == 1 || dim == full;
+}
+
+// Checks that scales or zero-points of a 4d keys or values tensor can be
+// handled: groups are only allowed along the masked innermost dimensions and
+// must divide them. A host scalar is a single value read at execution like a
+// common one.
+bool quant_entry_ok(const quant_entry_t &e, const memory_desc_t &md) {
+    if (e.has_default_values()) return true;
+    if (e.is_dynamic()) return false;
+    if (e.is_host_scalar()) return e.get_mask() == 0;
+    for (int d = 2; d < 4; ++d) {
+        const dim_t g = e.get_group(d - 2);
+        if (g == 1) continue;
+        if (g <= 0 || !(e.get_mask() & (1 << d)) || md.dims[d] % g != 0)
+            return false;
+    }
+    return true;
+}
+
+// Dequantizes the elements of a 4d keys or values tensor. The scales and
+// zero-points are dense over the dimensions of their mask, with the two
+// innermost dimensions divided by the groups.
+struct kv_dequant_t {
+    kv_dequant_t(const quant_entry_t &sc, const quant_entry_t &zp,
+            const memory_desc_t &md, const void *scales, const void *zps)
+        : dt_(md.data_type)
+        , scales_(sc.has_default_values() ? nullptr : scales)
+        , zps_(zp.has_default_values() ? nullptr : zps)
+        , scales_dt_(sc.get_data_type())
+        , zps_dt_(zp.get_data_type()) {
+        init_strides(sc, md, scales_strides_, scales_groups_);
+        init_strides(zp, md, zps_strides_, zps_groups_);
+    }
+
+    float load(const void *src, dim_t off, dim_t d0, dim_t d1, dim_t d2,
+            dim_t d3) const {
+        float v = io::load_float_value(dt_, src, off);
+        if (zps_)
+            v -= io::load_float_value(zps_dt_, zps_,
+                    param_off(zps_strides_, zps_groups_, d0, d1, d2, d3));
+        if (scales_)
+            v *= io::load_float_value(scales_dt_, scales_,
+                    param_off(scales_strides_, scales_groups_, d0, d1, d2,
+                            d3));
+        return v;
+    }
+
+private:
+    static void init_strides(const quant_entry_t &e, const memory_desc_t &md,
+            dim_t *strides, dim_t *groups) {
+        dim_t stride = 1;
+        for (int d = 3; d >= 0; --d) {
+            const bool masked = e.get_mask() & (1 << d);
+            groups[d] = d >= 2 && masked ? e.get_group(d - 2) : 1;
+            strides[d] = masked ? stride : 0;
+            if (masked) stride *= md.dims[d] / groups[d];
+        }
+    }
+
+    static dim_t param_off(const dim_t *strides, const dim_t *groups,
+            dim_t d0, dim_t d1, dim_t d2, dim_t d3) {
+        return d0 * strides[0] + d1 * strides[1] + d2 / groups[2] * strides[2]
+                + d3 / groups[3] * strides[3];
+    }
+
+    data_type_t dt_;
+    const void *scales_;
+    const void *zps_;
+    data_type_t scales_dt_;
+    data_type_t zps_dt_;
+    dim_t scales_strides_[4], scales_groups_[4];
+    dim_t zps_strides_[4], zps_groups_[4];
+};
+
+} // namespace
+
+using namespace memory_tracking::names;
+
+status_t brgemm_sdpa_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    VDISPATCH_SDPA(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_SDPA(utils::everyone_is(4, desc()->qry_md()->ndims,
+                           desc()->key_md()->ndims, desc()->val_md()->ndims,
+                           dst_md()->ndims),
+            VERBOSE_SHAPE_RESTRICTION
+            ": qry(%d) key(%d) val(%d) dst(%d) must be 4d",
+            desc()->qry_md()->ndims, desc()->key_md()->ndims,
+            desc()->val_md()->ndims, dst_md()->ndims);
+    VDISPATCH_SDPA(utils::everyone_is(f32, desc()->qry_md()->data_type,
+                           dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    // Keys and values other than f32 are dequantized in the scratchpad.
+    for (const auto *md : {desc()->key_md(), desc()->val_md()})
+        VDISPATCH_SDPA(utils::one_of(md->data_type, f32, bf16, f16, f8_e5m2,
+                               f8_e4m3, s8, u8, s4, u4),
+                VERBOSE_UNSUPPORTED_DT);
+    if (with_attn_mask()) {
+        VDISPATCH_SDPA(desc()->attn_mask_md()->ndims == 4,
+                VERBOSE_SHAPE_RESTRICTION ": attn_mask(%d) must be 4d",
+                desc()->attn_mask_md()->ndims);
+        VDISPATCH_SDPA(utils::one_of(desc()->attn_mask_md()->data_type, f32,
+                               bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+    }
+    if (with_attn_scale()) {
+        VDISPATCH_SDPA(
+                utils::one_of(desc()->scale_md()->data_type, f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+    }
+    VDISPATCH_SDPA(utils::one_of(kq_acc_dt(), f32, data_type::undef)
+                    && utils::one_of(vs_acc_dt(), f32, data_type::undef),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(quant_entry_ok(desc()->kq_scales, *desc()->key_md())
+                    && quant_entry_ok(desc()->kq_zero_points, *desc()->key_md())
+                    && quant_entry_ok(desc()->vs_scales, *desc()->val_md())
+                    && quant_entry_ok(
+                            desc()->vs_zero_points, *desc()->val_md()),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(
+            utils::one_of(desc()->softmax_alg, alg_kind::softmax_accurate,
+                    alg_kind::softmax_accurate_inf_as_zero),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_conf(engine));
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    if (conf_.is_training) CHECK(init_default_ws());
+
+    return status::success;
+}
+
+status_t brgemm_sdpa_fwd_t::pd_t::init_conf(engine_t *engine) {
+    const memory_desc_wrapper q_d(desc()->qry_md());
+    const memory_desc_wrapper k_d(desc()->key_md());
+    const memory_desc_wrapper v_d(desc()->val_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_SDPA(get_brgemm_isa() != brg_impl::isa_undef,
+            VERBOSE_UNSUPPORTED_ISA);
+
+    VDISPATCH_SDPA(q_d.is_plain() && k_d.is_plain() && v_d.is_plain()
+                    && dst_d.is_plain(),
+            VERBOSE_UNSUPPORTED_TAG);
+    // Rows of Q, V and dst are fed to brgemm directly.
+    VDISPATCH_SDPA(utils::everyone_is(1, q_d.blocking_desc().strides[3],
+                           v_d.blocking_desc().strides[3],
+                           dst_d.blocking_desc().strides[3]),
+            VERBOSE_UNSUPPORTED_TAG);
+    // Keys are either [head_size][keys] or [keys][head_size] in memory.
+    VDISPATCH_SDPA(k_d.blocking_desc().strides[3] == 1
+                    || k_d.blocking_desc().strides[2] == 1,
+            VERBOSE_UNSUPPORTED_TAG);
+
+    const auto d = desc();
+    auto &c = conf_;
+    c.mb = d->batch();
+    c.heads = d->num_q_heads();
+    c.queries = d->queries();
+    c.keys = d->keys();
+    c.head_size = d->head_size();
+    c.values = d->values();
+
+    const dim_t kv_heads = k_d.dims()[1];
+    VDISPATCH_SDPA(kv_heads == v_d.dims()[1] && c.heads % kv_heads == 0,
+            VERBOSE_SHAPE_RESTRICTION
+            ": kv heads(%ld) must divide q heads(%ld)",
+            (long)kv_heads, (long)c.heads);
+    c.q_per_kv_head = c.heads / kv_heads;
+    // With a paged kv cache the outermost dimension of keys and values
+    // enumerates the pages of the pool rather than the batch.
+    c.with_kv_paging = with_kv_paging();
+    if (c.with_kv_paging) {
+        const memory_desc_wrapper pt_d(desc()->kv_page_table_md());
+        VDISPATCH_SDPA(pt_d.is_plain(), VERBOSE_UNSUPPORTED_TAG);
+        // The keys past the end of a sequence are only excluded by the mask.
+        VDISPATCH_SDPA(with_attn_mask(), VERBOSE_UNSUPPORTED_FEATURE,
+                "paged kv cache without attn_mask");
+        c.page_size = d->kv_page_size();
+    } else {
+        VDISPATCH_SDPA(is_bcast_or_equal(k_d.dims()[0], c.mb)
+                        && is_bcast_or_equal(v_d.dims()[0], c.mb),
+                VERBOSE_SHAPE_RESTRICTION ": unsupported kv batch broadcast");
+        c.page_size = 0;
+    }
+
+    // A variable-length batch packs the sequences along the queries and keys
+    // dimensions, so queries(), keys() and the default causal offset refer to
+    // the whole batch and are only used to size the blocks.
+    c.with_varlen = with_varlen();
+    c.seq_count = 0;
+    if (c.with_varlen) {
+        VDISPATCH_SDPA(!c.with_kv_paging, VERBOSE_UNSUPPORTED_FEATURE,
+                "paged kv cache with variable-length batch");
+        VDISPATCH_SDPA(!with_attn_mask(), VERBOSE_UNSUPPORTED_FEATURE,
+                "attn_mask with variable-length batch");
+        const memory_desc_wrapper q_off_d(desc()->q_seq_offsets_md());
+        const memory_desc_wrapper kv_off_d(desc()->kv_seq_offsets_md());
+        VDISPATCH_SDPA(q_off_d.is_dense() && kv_off_d.is_dense(),
+                VERBOSE_UNSUPPORTED_TAG);
+        c.seq_count = d->seq_count();
+    }
+
+    if (with_attn_mask()) {
+        const memory_desc_wrapper msk_d(desc()->attn_mask_md());
+        VDISPATCH_SDPA(msk_d.is_plain(), VERBOSE_UNSUPPORTED_TAG);
+        VDISPATCH_SDPA(is_bcast_or_equal(msk_d.dims()[0], c.mb)
+                        && is_bcast_or_equal(msk_d.dims()[1], c.heads)
+                        && is_bcast_or_equal(msk_d.dims()[2], c.queries)
+                        && msk_d.dims()[3] == c.keys,
+                VERBOSE_SHAPE_RESTRICTION ": unsupported attn_mask broadcast");
+    }
+
+    c.key_dequant = k_d.data_type() != data_type::f32 || with_key_scales()
+            || with_key_zp();
+    c.val_dequant = v_d.data_type() != data_type::f32 || with_value_scales()
+            || with_value_zp();
+    // Key blocks of a variable-length batch are always staged, so that the
+    // keys past the end of a sequence can be zeroed.
+    c.key_trans = k_d.blocking_desc().strides[3] != 1 || c.with_varlen
+            || c.key_dequant;
+    c.with_causal_mask = with_causal_mask();
+    c.causal_offset = d->mask_type == attn_mask_type::bottom_right
+            ? c.keys - c.queries
+            : 0;
+    c.inf_as_zero = d->softmax_alg == alg_kind::softmax_accurate_inf_as_zero;
+    c.is_training = d->prop_kind == prop_kind::forward_training;
+
+    // The stacked query blocks of a group keep about q_blk_default rows, so
+    // that the scores block stays the same size.
+    c.q_heads_blk = c.q_per_kv_head;
+    c.q_blk = nstl::min(
+            c.queries, nstl::max(dim_t(1), q_blk_default / c.q_heads_blk));
+    c.k_blk = nstl::min(c.keys, k_blk_default);
+    if (c.with_kv_paging) {
+        // A keys block must not cross a page boundary.
+        if (c.page_size <= k_blk_default)
+            c.k_blk = c.page_size;
+        else
+            VDISPATCH_SDPA(c.page_size % k_blk_default == 0,
+                    VERBOSE_SHAPE_RESTRICTION
+                    ": page size(%ld) is not a multiple of %ld",
+                    (long)c.page_size, (long)k_blk_default);
+    }
+    c.nb_q = utils::div_up(c.queries, c.q_blk);
+    c.nb_k = utils::div_up(c.keys, c.k_blk);
+    // Tails of a variable-length batch depend on the offsets and are padded
+    // at execution, so only the full-block kernels are created.
+    c.q_tail = c.with_varlen ? 0 : c.queries % c.q_blk;
+    c.k_tail = c.with_varlen ? 0 : c.keys % c.k_blk;
+
+    c.nthr = dnnl_get_max_threads();
+
+    // Split the keys when the query blocks alone cannot occupy the threads.
+    // Each split processes at least one key block.
+    const dim_t q_work = c.mb * (c.heads / c.q_heads_blk) * c.nb_q;
+    c.kv_splits = 1;
+    if (!c.with_varlen && q_work < c.nthr)
+        c.kv_splits = nstl::min(
+                c.nb_k, utils::div_up(static_cast<dim_t>(c.nthr), q_work));
+
+    return status::success;
+}
+
+status_t brgemm_sdpa_fwd_t::pd_t::init_brgemm_descs() {
+    using namespace data_type;
+    const auto &c = conf_;
+    const memory_desc_wrapper q_d(desc()->qry_md());
+    const memory_desc_wrapper k_d(desc()->key_md());
+    const memory_desc_wrapper v_d(desc()->val_md());
+
+    const auto isa = get_brgemm_isa();
+    // Stacked query blocks are copied with rows of head_size
+    const dim_t kq_lda = c.q_heads_blk > 1 ? c.head_size
+                                           : q_d.blocking_desc().strides[2];
+    const dim_t kq_ldb = c.key_trans ? c.k_blk : k_d.blocking_desc().strides[2];
+    const dim_t vs_ldb = v_d.blocking_desc().strides[2];
+
+    brg_impl::brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+
+    for (bool q_tail : {false, true})
+        for (bool k_tail : {false, true}) {
+            const dim_t M = (q_tail ? c.q_tail : c.q_blk) * c.q_heads_blk;
+            const dim_t N = k_tail ? c.k_tail : c.k_blk;
+            if (M == 0 || N == 0) continue;
+
+            const int idx = get_brg_idx(q_tail, k_tail);
+
+            auto &kq = brg_kq_[idx];
+            CHECK(brg_impl::brgemm_desc_init(&kq, isa, brg_impl::brgemm_addr,
+                    f32, f32, false, false, brg_impl::brgemm_row_major, 1.f,
+                    0.f, kq_lda, kq_ldb, c.k_blk, M, N, c.head_size));
+            CHECK(brg_impl::brgemm_desc_set_attr(&kq, brgattr));
+            CHECK(brg_impl::brgemm_desc_finalize(&kq));
+
+            // beta = 1: the partial output is rescaled in place and the
+            // current block is accumulated on top of it.
+            auto &vs = brg_vs_[idx];
+            CHECK(brg_impl::brgemm_desc_init(&vs, isa, brg_impl::brgemm_addr,
+                    f32, f32, false, false, brg_impl::brgemm_row_major, 1.f,
+                    1.f, c.k_blk, vs_ldb, c.values, M, c.values, N));
+            CHECK(brg_impl::brgemm_desc_set_attr(&vs, brgattr));
+            CHECK(brg_impl::brgemm_desc_finalize(&vs));
+        }
+
+    return status::success;
+}
+
+void brgemm_sdpa_fwd_t::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+    // Rows of the stacked query blocks of a work item
+    const dim_t rows = c.q_heads_blk * c.q_blk;
+    scratchpad.template book<float>(key_sdpa_scores, c.nthr * rows * c.k_blk);
+    scratchpad.template book<float>(key_sdpa_acc, c.nthr * rows * c.values);
+    // Running max and sum per query row
+    scratchpad.template book<float>(key_sdpa_row_stats, c.nthr * 2 * rows);
+    if (c.key_trans) {
+        scratchpad.template book<float>(
+                key_sdpa_key_trans, c.nthr * c.head_size * c.k_blk);
+    }
+    if (c.with_varlen || c.q_heads_blk > 1) {
+        const memory_desc_wrapper q_d(desc()->qry_md());
+        const dim_t q_ld = c.q_heads_blk > 1 ? c.head_size
+                                             : q_d.blocking_desc().strides[2];
+        scratchpad.template book<float>(
+                key_sdpa_qry_pad, c.nthr * rows * q_ld);
+    }
+    if (c.with_varlen) {
+        scratchpad.template book<dim_t>(
+                key_sdpa_seq_blk_offsets, c.seq_count + 1);
+    }
+    if (c.with_varlen || c.val_dequant) {
+        const memory_desc_wrapper v_d(desc()->val_md());
+        scratchpad.template book<float>(key_sdpa_val_pad,
+                c.nthr * c.k_blk * v_d.blocking_desc().strides[2]);
+    }
+    if (c.kv_splits > 1) {
+        const dim_t n_splits
+                = c.mb * (c.heads / c.q_heads_blk) * c.nb_q * c.kv_splits;
+        scratchpad.template book<float>(
+                key_sdpa_split_acc, n_splits * rows * c.values);
+        scratchpad.template book<float>(
+                key_sdpa_split_stats, n_splits * 2 * rows);
+    }
+}
+
+status_t brgemm_sdpa_fwd_t::init(engine_t *engine) {
+    const auto &c = pd()->conf_;
+    for (bool q_tail : {false, true})
+        for (bool k_tail : {false, true}) {
+            const dim_t M = q_tail ? c.q_tail : c.q_blk;
+            const dim_t N = k_tail ? c.k_tail : c.k_blk;
+            if (M == 0 || N == 0) continue;
+
+            const int idx = pd_t::get_brg_idx(q_tail, k_tail);
+            brg_impl::brgemm_kernel_t *ker = nullptr;
+            CHECK(brg_impl::brgemm_kernel_create(&ker, pd()->brg_kq_[idx]));
+            CHECK(safe_ptr_assign(brg_kq_kernels_[idx], ker));
+            CHECK(brg_impl::brgemm_kernel_create(&ker, pd()->brg_vs_[idx]));
+            CHECK(safe_ptr_assign(brg_vs_kernels_[idx], ker));
+        }
+    return status::success;
+}
+
+status_t brgemm_sdpa_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+    const auto d = pd()->desc();
+
+    const auto qry = CTX_IN_MEM(const float *, DNNL_ARG_QUERIES);
+    const auto key = CTX_IN_MEM(const void *, DNNL_ARG_KEYS);
+    const auto val = CTX_IN_MEM(const void *, DNNL_ARG_VALUES);
+    const auto key_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS);
+    const auto key_zps = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS);
+    const auto val_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES);
+    const auto val_zps = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES);
+    const auto mask = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    const auto scale_ptr = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    const auto page_table
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_KV_PAGE_TABLE);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+    auto ws = CTX_OUT_MEM(float *, DNNL_ARG_WORKSPACE);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *scores_base = scratchpad.template get<float>(key_sdpa_scores);
+    float *acc_base = scratchpad.template get<float>(key_sdpa_acc);
+    float *stats_base = scratchpad.template get<float>(key_sdpa_row_stats);
+    float *key_trans_base = c.key_trans
+            ? scratchpad.template get<float>(key_sdpa_key_trans)
+            : nullptr;
+    float *qry_pad_base = c.with_varlen || c.q_heads_blk > 1
+            ? scratchpad.template get<float>(key_sdpa_qry_pad)
+            : nullptr;
+    float *val_pad_base = c.with_varlen || c.val_dequant
+            ? scratchpad.template get<float>(key_sdpa_val_pad)
+            : nullptr;
+    const kv_dequant_t key_deq(
+            d->kq_scales, d->kq_zero_points, *d->key_md(), key_scales, key_zps);
+    const kv_dequant_t val_deq(
+            d->vs_scales, d->vs_zero_points, *d->val_md(), val_scales, val_zps);
+
+    float scale = 1.f;
+    if (pd()->with_attn_scale()) {
+        scale = io::load_float_value(d->scale_md()->data_type, scale_ptr, 0);
+        if (d->invert_scale) scale = 1.f / scale;
+    }
+
+    const memory_desc_wrapper q_d(d->qry_md());
+    const memory_desc_wrapper k_d(d->key_md());
+    const memory_desc_wrapper v_d(d->val_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper msk_d(d->attn_mask_md());
+    const auto &qs = q_d.blocking_desc().strides;
+    const auto &ks = k_d.blocking_desc().strides;
+    const auto &vs = v_d.blocking_desc().strides;
+    const auto &ds = dst_d.blocking_desc().strides;
+    const bool with_mask = pd()->with_attn_mask();
+    const data_type_t msk_dt = msk_d.data_type();
+    const dims_t &msk_dims = d->attn_mask_md()->dims;
+    const auto &ms = d->attn_mask_md()->format_desc.blocking.strides;
+
+    const dim_t *pts = c.with_kv_paging
+            ? d->kv_page_table_md()->format_desc.blocking.strides
+            : nullptr;
+
+    const bool k_bcast_mb = c.with_kv_paging || k_d.dims()[0] == 1;
+    const bool v_bcast_mb = c.with_kv_paging || v_d.dims()[0] == 1;
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+
+    // For a variable-length batch the query blocks of all the sequences are
+    // enumerated together: sequence b owns blocks [blk_off[b], blk_off[b+1]).
+    const int32_t *q_seq_off = nullptr, *kv_seq_off = nullptr;
+    dim_t *blk_off = nullptr;
+    dim_t nb_q_total = c.nb_q;
+    if (c.with_varlen) {
+        q_seq_off = CTX_IN_MEM(const int32_t *, DNNL_ARG_Q_SEQ_OFFSETS);
+        kv_seq_off = CTX_IN_MEM(const int32_t *, DNNL_ARG_KV_SEQ_OFFSETS);
+        blk_off = scratchpad.template get<dim_t>(key_sdpa_seq_blk_offsets);
+        blk_off[0] = 0;
+        for (dim_t b = 0; b < c.seq_count; ++b) {
+            const dim_t q_len = q_seq_off[b] - (b ? q_seq_off[b - 1] : 0);
+            blk_off[b + 1] = blk_off[b] + utils::div_up(q_len, c.q_blk);
+        }
+        nb_q_total = blk_off[c.seq_count];
+    }
+    const auto seq_beg = [](const int32_t *off, dim_t b) -> dim_t {
+        return b ? off[b - 1] : 0;
+    };
+
+    const dim_t kv_splits = c.kv_splits;
+    float *split_acc_base = kv_splits > 1
+            ? scratchpad.template get<float>(key_sdpa_split_acc)
+            : nullptr;
+    float *split_stats_base = kv_splits > 1
+            ? scratchpad.template get<float>(key_sdpa_split_stats)
+            : nullptr;
+
+    // Normalizes the output rows of a query block and stores them along with
+    // the log-sum-exp for training.
+    const auto store_rows = [&](dim_t b, dim_t h, dim_t q_first, dim_t M,
+                                    const float *acc, const float *row_max,
+                                    const float *row_sum) {
+        for (dim_t i = 0; i < M; ++i) {
+            const dim_t q_idx = q_first + i;
+            const float sum = row_sum[i];
+            // A fully masked row has no defined softmax: it is zeroed in
+            // the inf_as_zero mode and NaN otherwise, like 0 / 0.
+            const float inv_sum = sum > 0.f ? 1.f / sum
+                    : c.inf_as_zero         ? 0.f
+                                            : NAN;
+            const float *a = acc + i * c.values;
+            float *dst_row = dst + b * ds[0] + h * ds[1] + q_idx * ds[2];
+            for (dim_t v = 0; v < c.values; ++v)
+                dst_row[v] = a[v] * inv_sum;
+
+            if (c.is_training) {
+                const float lse = sum > 0.f ? row_max[i] + ::logf(sum)
+                        : c.inf_as_zero     ? 0.f
+                                            : neg_inf;
+                ws[(b * c.heads + h) * c.queries + q_idx] = lse;
+            }
+        }
+    };
+
+    // A work item processes the query blocks of q_heads_blk heads, stacked
+    // in rows of blk_rows: the rows of head j of the group start at j * Mp.
+    const dim_t G = c.q_heads_blk;
+    const dim_t n_hgroups = c.heads / G;
+    const dim_t blk_rows = G * c.q_blk;
+    const dim_t q_ld = G > 1 ? c.head_size : qs[2];
+    const dim_t work_amount = c.mb * n_hgroups * nb_q_total * kv_splits;
+
+    parallel(c.nthr, [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start == end) return;
+
+        float *scores = scores_base + ithr * blk_rows * c.k_blk;
+        float *acc = acc_base + ithr * blk_rows * c.values;
+        float *row_max = stats_base + ithr * 2 * blk_rows;
+        float *row_sum = row_max + blk_rows;
+        float *key_trans = c.key_trans
+                ? key_trans_base + ithr * c.head_size * c.k_blk
+                : nullptr;
+        float *qry_pad = c.with_varlen || G > 1
+                ? qry_pad_base + ithr * blk_rows * q_ld
+                : nullptr;
+        float *val_pad = c.with_varlen || c.val_dequant
+                ? val_pad_base + ithr * c.k_blk * vs[2]
+                : nullptr;
+
+        brg_impl::brgemm_batch_element_t batch;
+
+        dim_t b {0}, hg {0}, iq {0}, isplit {0};
+        utils::nd_iterator_init(start, b, c.mb, hg, n_hgroups, iq, nb_q_total,
+                isplit, kv_splits);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t h_first = hg * G;
+            const dim_t h_kv = h_first / c.q_per_kv_head;
+
+            // Rows of the current sequence in the queries and keys tensors
+            dim_t q_beg = 0, kv_beg = 0, n_queries = c.queries,
+                  n_keys = c.keys, causal_offset = c.causal_offset,
+                  q_start = iq * c.q_blk;
+            if (c.with_varlen) {
+                // Sequence owning query block iq; empty sequences own no
+                // blocks and are skipped by the search.
+                const dim_t seq
+                        = std::upper_bound(blk_off, blk_off + c.seq_count, iq)
+                        - blk_off - 1;
+                q_beg = seq_beg(q_seq_off, seq);
+                kv_beg = seq_beg(kv_seq_off, seq);
+                n_queries = q_seq_off[seq] - q_beg;
+                n_keys = kv_seq_off[seq] - kv_beg;
+                causal_offset = d->mask_type == attn_mask_type::bottom_right
+                        ? n_keys - n_queries
+                        : 0;
+                q_start = (iq - blk_off[seq]) * c.q_blk;
+            }
+            const dim_t M = nstl::min(c.q_blk, n_queries - q_start);
+            // Blocks of a variable-length batch are padded in the scratchpad
+            // so that the full-block kernels can be used for any length.
+            const bool is_q_tail = !c.with_varlen && M < c.q_blk;
+            // Rows per head in the stacked blocks, M plus the padding
+            const dim_t Mp = is_q_tail ? c.q_tail : c.q_blk;
+
+            const float *q_ptr = qry + b * qs[0] + h_first * qs[1]
+                    + (q_beg + q_start) * qs[2];
+            if (G > 1 || M < Mp) {
+                for (dim_t j = 0; j < G; ++j)
+                    for (dim_t i = 0; i < Mp; ++i)
+                        for (dim_t dd = 0; dd < c.head_size; ++dd)
+                            qry_pad[(j * Mp + i) * q_ld + dd] = i < M
+                                    ? q_ptr[j * qs[1] + i * qs[2] + dd]
+                                    : 0.f;
+                q_ptr = qry_pad;
+            }
+            // Returns the outermost indices of the keys and values tensors
+            // and the index of the first key of the block starting at key
+            // k_start. For a paged kv cache the block is looked up in the
+            // page table of the current sequence.
+            const auto get_kv_blk = [&](dim_t k_start, dim_t &k_n, dim_t &v_n,
+                                            dim_t &k_first) {
+                if (!c.with_kv_paging) {
+                    k_n = k_bcast_mb ? 0 : b;
+                    v_n = v_bcast_mb ? 0 : b;
+                    k_first = kv_beg + k_start;
+                    return;
+                }
+                const dim_t page = k_start / c.page_size;
+                k_n = v_n = page_table[b * pts[0] + page * pts[1]];
+                k_first = k_start % c.page_size;
+            };
+
+            // A split keeps its partial results in the scratchpad until the
+            // reduction.
+            if (kv_splits > 1) {
+                acc = split_acc_base + iwork * blk_rows * c.values;
+                row_max = split_stats_base + iwork * 2 * blk_rows;
+                row_sum = row_max + blk_rows;
+            }
+            utils::array_set(row_max, neg_inf, G * Mp);
+            utils::array_set(row_sum, 0.f, G * Mp);
+            utils::array_set(acc, 0.f, G * Mp * c.values);
+
+            // With a causal mask, key blocks past the diagonal of the last
+            // query in the block are fully masked and skipped altogether.
+            dim_t k_end = n_keys;
+            if (c.with_causal_mask)
+                k_end = nstl::max(dim_t(0),
+                        nstl::min(n_keys, q_start + M + causal_offset));
+            const dim_t nb_k = utils::div_up(k_end, c.k_blk);
+            dim_t ik_beg = 0, ik_end = nb_k;
+            if (kv_splits > 1)
+                balance211(nb_k, kv_splits, isplit, ik_beg, ik_end);
+
+            for (dim_t ik = ik_beg; ik < ik_end; ++ik) {
+                const dim_t k_start = ik * c.k_blk;
+                const dim_t N = nstl::min(c.k_blk, n_keys - k_start);
+                const bool is_k_tail = !c.with_varlen && N < c.k_blk;
+                const int brg_idx = pd_t::get_brg_idx(is_q_tail, is_k_tail);
+
+                dim_t k_n = 0, v_n = 0, k_first = 0;
+                get_kv_blk(k_start, k_n, v_n, k_first);
+                const dim_t k_off
+                        = k_n * ks[0] + h_kv * ks[1] + k_first * ks[3];
+                const dim_t v_off
+                        = v_n * vs[0] + h_kv * vs[1] + k_first * vs[2];
+                const float *k_blk_ptr = c.key_dequant
+                        ? nullptr
+                        : static_cast<const float *>(key) + k_off;
+                const float *v_blk_ptr = c.val_dequant
+                        ? nullptr
+                        : static_cast<const float *>(val) + v_off;
+
+                const float *k_ptr = nullptr;
+                if (c.key_dequant) {
+                    for (dim_t n = 0; n < N; ++n)
+                        for (dim_t dd = 0; dd < c.head_size; ++dd)
+                            key_trans[dd * c.k_blk + n] = key_deq.load(key,
+                                    k_off + n * ks[3] + dd * ks[2], k_n, h_kv,
+                                    dd, k_first + n);
+                } else if (c.key_trans) {
+                    for (dim_t n = 0; n < N; ++n)
+                        for (dim_t dd = 0; dd < c.head_size; ++dd)
+                            key_trans[dd * c.k_blk + n]
+                                    = k_blk_ptr[n * ks[3] + dd * ks[2]];
+                }
+                if (c.key_trans) {
+                    if (c.with_varlen && N < c.k_blk)
+                        for (dim_t dd = 0; dd < c.head_size; ++dd)
+                            utils::array_set(key_trans + dd * c.k_blk + N, 0.f,
+                                    c.k_blk - N);
+                    k_ptr = key_trans;
+                } else {
+                    k_ptr = k_blk_ptr;
+                }
+                if (c.val_dequant) {
+                    for (dim_t n = 0; n < N; ++n)
+                        for (dim_t v = 0; v < c.values; ++v)
+                            val_pad[n * vs[2] + v] = val_deq.load(val,
+                                    v_off + n * vs[2] + v, v_n, h_kv,
+                                    k_first + n, v);
+                    if (c.with_varlen && N < c.k_blk)
+                        for (dim_t n = N; n < c.k_blk; ++n)
+                            utils::array_set(
+                                    val_pad + n * vs[2], 0.f, c.values);
+                    v_blk_ptr = val_pad;
+                } else if (c.with_varlen && N < c.k_blk) {
+                    for (dim_t n = 0; n < c.k_blk; ++n)
+                        for (dim_t v = 0; v < c.values; ++v)
+                            val_pad[n * vs[2] + v]
+                                    = n < N ? v_blk_ptr[n * vs[2] + v] : 0.f;
+                    v_blk_ptr = val_pad;
+                }
+
+                batch.ptr.A = q_ptr;
+                batch.ptr.B = k_ptr;
+                brg_impl::brgemm_kernel_execute(
+                        brg_kq_kernels_[brg_idx].get(), 1, &batch, scores);
+
+                // Online softmax: rescale the partial output by
+                // exp(old_max - new_max) and keep unnormalized probabilities.
+                for (dim_t j = 0; j < G; ++j)
+                    for (dim_t i = 0; i < M; ++i) {
+                        const dim_t h = h_first + j;
+                        const dim_t r = j * Mp + i;
+                        const dim_t q_idx = q_start + i;
+                        float *s = scores + r * c.k_blk;
+                        float blk_max = neg_inf;
+                        for (dim_t n = 0; n < N; ++n) {
+                            const dim_t k_idx = k_start + n;
+                            float v = s[n] * scale;
+                            if (with_mask) {
+                                const dim_t off
+                                        = (msk_dims[0] == 1 ? 0 : b) * ms[0]
+                                        + (msk_dims[1] == 1 ? 0 : h) * ms[1]
+                                        + (msk_dims[2] == 1 ? 0 : q_idx) * ms[2]
+                                        + k_idx * ms[3];
+                                v += io::load_float_value(msk_dt, mask, off);
+                            }
+                            if (c.with_causal_mask
+                                    && k_idx > q_idx + causal_offset)
+                                v = neg_inf;
+                            s[n] = v;
+                            blk_max = nstl::max(blk_max, v);
+                        }
+
+                        const float max_new = nstl::max(row_max[r], blk_max);
+                        if (max_new == neg_inf) {
+                            // Nothing visible in this row so far.
+                            utils::array_set(s, 0.f, N);
+                            continue;
+                        }
+
+                        float blk_sum = 0.f;
+                        for (dim_t n = 0; n < N; ++n) {
+                            s[n] = ::expf(s[n] - max_new);
+                            blk_sum += s[n];
+                        }
+
+                        const float corr = ::expf(row_max[r] - max_new);
+                        row_sum[r] = row_sum[r] * corr + blk_sum;
+                        row_max[r] = max_new;
+                        if (corr != 1.f) {
+                            float *a = acc + r * c.values;
+                            for (dim_t v = 0; v < c.values; ++v)
+                                a[v] *= corr;
+                        }
+                    }
+
+                batch.ptr.A = scores;
+                batch.ptr.B = v_blk_ptr;
+                brg_impl::brgemm_kernel_execute(
+                        brg_vs_kernels_[brg_idx].get(), 1, &batch, acc);
+            }
+
+            if (kv_splits == 1)
+                for (dim_t j = 0; j < G; ++j)
+                    store_rows(b, h_first + j, q_beg + q_start, M,
+                            acc + j * Mp * c.values, row_max + j * Mp,
+                            row_sum + j * Mp);
+
+            utils::nd_iterator_step(b, c.mb, hg, n_hgroups, iq, nb_q_total,
+                    isplit, kv_splits);
+        }
+    });
+
+    if (kv_splits == 1) return status::success;
+
+    // Rescale the partial results of the splits to the common max and sum
+    // them into the first split. Splits are not used with a variable-length
+    // batch, so the query blocks are regular and a head has M rows.
+    parallel_nd(c.mb, n_hgroups, c.nb_q, [&](dim_t b, dim_t hg, dim_t iq) {
+        const dim_t q_start = iq * c.q_blk;
+        const dim_t M = nstl::min(c.q_blk, c.queries - q_start);
+        const dim_t first = ((b * n_hgroups + hg) * c.nb_q + iq) * kv_splits;
+        float *acc = split_acc_base + first * blk_rows * c.values;
+        float *row_max = split_stats_base + first * 2 * blk_rows;
+        float *row_sum = row_max + blk_rows;
+
+        for (dim_t r = 0; r < G * M; ++r) {
+            float max_all = row_max[r];
+            for (dim_t s = 1; s < kv_splits; ++s)
+                max_all = nstl::max(max_all,
+                        split_stats_base[(first + s) * 2 * blk_rows + r]);
+            if (max_all == neg_inf) continue; // fully masked row
+
+            float *a = acc + r * c.values;
+            const float corr0 = ::expf(row_max[r] - max_all);
+            float sum = row_sum[r] * corr0;
+            for (dim_t v = 0; v < c.values; ++v)
+                a[v] *= corr0;
+            for (dim_t s = 1; s < kv_splits; ++s) {
+                const float *st = split_stats_base + (first + s) * 2 * blk_rows;
+                const float corr = ::expf(st[r] - max_all);
+                if (corr == 0.f) continue;
+                sum += st[blk_rows + r] * corr;
+                const float *as = split_acc_base
+                        + ((first + s) * blk_rows + r) * c.values;
+                for (dim_t v = 0; v < c.values; ++v)
+                    a[v] += as[v] * corr;
+            }
+            row_max[r] = max_all;
+            row_sum[r] = sum;
+        }
+
+        for (dim_t j = 0; j < G; ++j)
+            store_rows(b, hg * G + j, q_start, M, acc + j * M * c.values,
+                    row_max + j * M, row_sum + j * M);
+    });
+
+    return status::success;
+}
+
+status_t brgemm_sdpa_bwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    VDISPATCH_SDPA(!is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_SDPA(utils::everyone_is(4, desc()->qry_md()->ndims,
+                           desc()->key_md()->ndims, desc()->val_md()->ndims,
+                           src_md(4)->ndims, diff_dst_md()->ndims),
+            VERBOSE_SHAPE_RESTRICTION
+            ": qry(%d) key(%d) val(%d) dst(%d) diff_dst(%d) must be 4d",
+            desc()->qry_md()->ndims, desc()->key_md()->ndims,
+            desc()->val_md()->ndims, src_md(4)->ndims, diff_dst_md()->ndims);
+    VDISPATCH_SDPA(utils::everyone_is(f32, desc()->qry_md()->data_type,
+                           desc()->key_md()->data_type,
+                           desc()->val_md()->data_type, src_md(4)->data_type,
+                           diff_dst_md()->data_type,
+                           desc()->diff_qry_md()->data_type,
+                           desc()->diff_key_md()->data_type,
+                           desc()->diff_val_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    if (with_attn_mask()) {
+        VDISPATCH_SDPA(desc()->attn_mask_md()->ndims == 4,
+                VERBOSE_SHAPE_RESTRICTION ": attn_mask(%d) must be 4d",
+                desc()->attn_mask_md()->ndims);
+        VDISPATCH_SDPA(utils::one_of(desc()->attn_mask_md()->data_type, f32,
+                               bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+    }
+    if (with_attn_scale()) {
+        VDISPATCH_SDPA(
+                utils::one_of(desc()->scale_md()->data_type, f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+    }
+    if (with_dS()) {
+        VDISPATCH_SDPA(desc()->dS_desc.data_type == f32
+                        && desc()->dS_desc.ndims == 4,
+                VERBOSE_UNSUPPORTED_DT);
+    }
+    VDISPATCH_SDPA(utils::one_of(kq_acc_dt(), f32, data_type::undef)
+                    && utils::one_of(vs_acc_dt(), f32, data_type::undef),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(!with_key_scales() && !with_key_zp() && !with_value_scales()
+                    && !with_value_zp(),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(!with_kv_paging(), VERBOSE_UNSUPPORTED_FEATURE,
+            "paged kv cache");
+    VDISPATCH_SDPA(!with_varlen(), VERBOSE_UNSUPPORTED_FEATURE,
+            "variable-length batch");
+    VDISPATCH_SDPA(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(
+            utils::one_of(desc()->softmax_alg, alg_kind::softmax_accurate,
+                    alg_kind::softmax_accurate_inf_as_zero),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_default_ws());
+    VDISPATCH_SDPA(compare_ws(hint_fwd_pd_), VERBOSE_WS_MISMATCH);
+
+    CHECK(init_conf(engine));
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_sdpa_bwd_t::pd_t::init_conf(engine_t *engine) {
+    const memory_desc_wrapper q_d(desc()->qry_md());
+    const memory_desc_wrapper k_d(desc()->key_md());
+    const memory_desc_wrapper v_d(desc()->val_md());
+    const memory_desc_wrapper dst_d(src_md(4));
+    const memory_desc_wrapper diff_dst_d(diff_dst_md());
+    const memory_desc_wrapper diff_q_d(desc()->diff_qry_md());
+    const memory_desc_wrapper diff_k_d(desc()->diff_key_md());
+    const memory_desc_wrapper diff_v_d(desc()->diff_val_md());
+
+    VDISPATCH_SDPA(get_brgemm_isa() != brg_impl::isa_undef,
+            VERBOSE_UNSUPPORTED_ISA);
+
+    VDISPATCH_SDPA(q_d.is_plain() && k_d.is_plain() && v_d.is_plain()
+                    && dst_d.is_plain() && diff_dst_d.is_plain()
+                    && diff_q_d.is_plain() && diff_k_d.is_plain()
+                    && diff_v_d.is_plain(),
+            VERBOSE_UNSUPPORTED_TAG);
+    // Rows of Q and dO are fed to brgemm directly. Keys and values are
+    // staged per block and the gradients are accumulated in the scratchpad,
+    // so their layouts are free.
+    VDISPATCH_SDPA(utils::everyone_is(1, q_d.blocking_desc().strides[3],
+                           diff_dst_d.blocking_desc().strides[3]),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    const auto d = desc();
+    auto &c = conf_;
+    c.mb = d->batch();
+    c.heads = d->num_q_heads();
+    c.queries = d->queries();
+    c.keys = d->keys();
+    c.head_size = d->head_size();
+    c.values = d->values();
+
+    const dim_t kv_heads = k_d.dims()[1];
+    VDISPATCH_SDPA(kv_heads == v_d.dims()[1] && c.heads % kv_heads == 0,
+            VERBOSE_SHAPE_RESTRICTION
+            ": kv heads(%ld) must divide q heads(%ld)",
+            (long)kv_heads, (long)c.heads);
+    c.q_per_kv_head = c.heads / kv_heads;
+    // A batch broadcast of keys or values would require a reduction of their
+    // gradients over the batch.
+    VDISPATCH_SDPA(k_d.dims()[0] == c.mb && v_d.dims()[0] == c.mb,
+            VERBOSE_SHAPE_RESTRICTION ": unsupported kv batch broadcast");
+
+    if (with_attn_mask()) {
+        const memory_desc_wrapper msk_d(desc()->attn_mask_md());
+        VDISPATCH_SDPA(msk_d.is_plain(), VERBOSE_UNSUPPORTED_TAG);
+        VDISPATCH_SDPA(is_bcast_or_equal(msk_d.dims()[0], c.mb)
+                        && is_bcast_or_equal(msk_d.dims()[1], c.heads)
+                        && is_bcast_or_equal(msk_d.dims()[2], c.queries)
+                        && msk_d.dims()[3] == c.keys,
+                VERBOSE_SHAPE_RESTRICTION ": unsupported attn_mask broadcast");
+    }
+    if (with_dS()) {
+        const memory_desc_wrapper ds_d(&d->dS_desc);
+        VDISPATCH_SDPA(ds_d.is_plain(), VERBOSE_UNSUPPORTED_TAG);
+        VDISPATCH_SDPA(ds_d.dims()[0] == c.mb && ds_d.dims()[1] == c.heads
+                        && ds_d.dims()[2] == c.queries
+                        && ds_d.dims()[3] == c.keys,
+                VERBOSE_SHAPE_RESTRICTION ": unexpected dS shape");
+    }
+
+    c.with_causal_mask = with_causal_mask();
+    c.causal_offset = d->mask_type == attn_mask_type::bottom_right
+            ? c.keys - c.queries
+            : 0;
+
+    c.q_blk = nstl::min(c.queries, q_blk_default);
+    c.k_blk = nstl::min(c.keys, k_blk_default);
+    c.nb_q = utils::div_up(c.queries, c.q_blk);
+    c.nb_k = utils::div_up(c.keys, c.k_blk);
+    c.q_tail = c.queries % c.q_blk;
+    c.k_tail = c.keys % c.k_blk;
+
+    c.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+status_t brgemm_sdpa_bwd_t::pd_t::init_brgemm_descs() {
+    using namespace data_type;
+    const auto &c = conf_;
+    const memory_desc_wrapper q_d(desc()->qry_md());
+    const memory_desc_wrapper diff_dst_d(diff_dst_md());
+
+    const auto isa = get_brgemm_isa();
+    const dim_t q_ld = q_d.blocking_desc().strides[2];
+    const dim_t dd_ld = diff_dst_d.blocking_desc().strides[2];
+
+    brg_impl::brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+
+    const auto init_desc = [&](sdpa_brgemm::brgemm_desc_t &brg, float beta,
+                                   dim_t lda, dim_t ldb, dim_t ldc, dim_t M,
+                                   dim_t N, dim_t K) {
+        CHECK(brg_impl::brgemm_desc_init(&brg, isa, brg_impl::brgemm_addr,
+                f32, f32, false, false, brg_impl::brgemm_row_major, 1.f,
+                beta, lda, ldb, ldc, M, N, K));
+        CHECK(brg_impl::brgemm_desc_set_attr(&brg, brgattr));
+        return brg_impl::brgemm_desc_finalize(&brg);
+    };
+
+    for (bool q_tail : {false, true})
+        for (bool k_tail : {false, true}) {
+            const dim_t M = q_tail ? c.q_tail : c.q_blk;
+            const dim_t N = k_tail ? c.k_tail : c.k_blk;
+            if (M == 0 || N == 0) continue;
+
+            const int idx = get_brg_idx(q_tail, k_tail);
+            CHECK(init_desc(brg_kq_[idx], 0.f, q_ld, c.k_blk, c.k_blk, M, N,
+                    c.head_size));
+            CHECK(init_desc(brg_dp_[idx], 0.f, dd_ld, c.k_blk, c.k_blk, M, N,
+                    c.values));
+            // beta = 1: the gradients are accumulated over the blocks
+            CHECK(init_desc(brg_dv_[idx], 1.f, c.q_blk, dd_ld, c.values, N,
+                    c.values, M));
+            CHECK(init_desc(brg_dk_[idx], 1.f, c.q_blk, q_ld, c.head_size, N,
+                    c.head_size, M));
+            CHECK(init_desc(brg_dq_[idx], 1.f, c.k_blk, c.head_size,
+                    c.head_size, M, c.head_size, N));
+        }
+
+    return status::success;
+}
+
+void brgemm_sdpa_bwd_t::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+    // rowsum(dO * O) per query
+    scratchpad.template book<float>(key_sdpa_Di, c.mb * c.heads * c.queries);
+    scratchpad.template book<float>(
+            key_sdpa_scores, c.nthr * c.q_blk * c.k_blk);
+    scratchpad.template book<float>(
+            key_sdpa_diff_scores, c.nthr * c.q_blk * c.k_blk);
+    // P^T and dS^T
+    scratchpad.template book<float>(
+            key_sdpa_scores_trans, c.nthr * 2 * c.k_blk * c.q_blk);
+    // Keys block as [head_size][k_blk] and as [k_blk][head_size]
+    scratchpad.template book<float>(
+            key_sdpa_key_trans, c.nthr * 2 * c.head_size * c.k_blk);
+    scratchpad.template book<float>(
+            key_sdpa_val_trans, c.nthr * c.values * c.k_blk);
+    scratchpad.template book<float>(
+            key_sdpa_dQ_reduction, c.nthr * c.q_blk * c.head_size);
+    scratchpad.template book<float>(
+            key_sdpa_dK_reduction, c.nthr * c.k_blk * c.head_size);
+    scratchpad.template book<float>(
+            key_sdpa_dV_reduction, c.nthr * c.k_blk * c.values);
+}
+
+status_t brgemm_sdpa_bwd_t::init(engine_t *engine) {
+    const auto &c = pd()->conf_;
+    const auto create = [](std::unique_ptr<sdpa_brgemm::brgemm_kernel_t> &k,
+                                const sdpa_brgemm::brgemm_desc_t &desc) {
+        brg_impl::brgemm_kernel_t *ker = nullptr;
+        CHECK(brg_impl::brgemm_kernel_create(&ker, desc));
+        return safe_ptr_assign(k, ker);
+    };
+    for (bool q_tail : {false, true})
+        for (bool k_tail : {false, true}) {
+            const dim_t M = q_tail ? c.q_tail : c.q_blk;
+            const dim_t N = k_tail ? c.k_tail : c.k_blk;
+            if (M == 0 || N == 0) continue;
+
+            const int idx = pd_t::get_brg_idx(q_tail, k_tail);
+            CHECK(create(brg_kq_kernels_[idx], pd()->brg_kq_[idx]));
+            CHECK(create(brg_dp_kernels_[idx], pd()->brg_dp_[idx]));
+            CHECK(create(brg_dv_kernels_[idx], pd()->brg_dv_[idx]));
+            CHECK(create(brg_dk_kernels_[idx], pd()->brg_dk_[idx]));
+            CHECK(create(brg_dq_kernels_[idx], pd()->brg_dq_[idx]));
+        }
+    return status::success;
+}
+
+status_t brgemm_sdpa_bwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+    const auto d = pd()->desc();
+
+    const auto qry = CTX_IN_MEM(const float *, DNNL_ARG_QUERIES);
+    const auto key = CTX_IN_MEM(const float *, DNNL_ARG_KEYS);
+    const auto val = CTX_IN_MEM(const float *, DNNL_ARG_VALUES);
+    const auto dst = CTX_IN_MEM(const float *, DNNL_ARG_DST);
+    const auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    const auto mask = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    const auto scale_ptr = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    const auto ws = CTX_IN_MEM(const float *, DNNL_ARG_WORKSPACE);
+    auto diff_qry = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_QUERIES);
+    auto diff_key = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_KEYS);
+    auto diff_val = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_VALUES);
+    auto diff_scores = CTX_OUT_MEM(float *, DNNL_ARG_DS);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *Di = scratchpad.template get<float>(key_sdpa_Di);
+    float *scores_base = scratchpad.template get<float>(key_sdpa_scores);
+    float *diff_scores_base
+            = scratchpad.template get<float>(key_sdpa_diff_scores);
+    float *scores_trans_base
+            = scratchpad.template get<float>(key_sdpa_scores_trans);
+    float *key_trans_base = scratchpad.template get<float>(key_sdpa_key_trans);
+    float *val_trans_base = scratchpad.template get<float>(key_sdpa_val_trans);
+    float *dq_acc_base = scratchpad.template get<float>(key_sdpa_dQ_reduction);
+    float *dk_acc_base = scratchpad.template get<float>(key_sdpa_dK_reduction);
+    float *dv_acc_base = scratchpad.template get<float>(key_sdpa_dV_reduction);
+
+    float scale = 1.f;
+    if (pd()->with_attn_scale()) {
+        scale = io::load_float_value(d->scale_md()->data_type, scale_ptr, 0);
+        if (d->invert_scale) scale = 1.f / scale;
+    }
+
+    const auto strides = [](const memory_desc_t *md) {
+        return md->format_desc.blocking.strides;
+    };
+    const dim_t *qs = strides(d->qry_md());
+    const dim_t *ks = strides(d->key_md());
+    const dim_t *vs = strides(d->val_md());
+    const dim_t *os = strides(pd()->src_md(4));
+    const dim_t *dos = strides(pd()->diff_dst_md());
+    const dim_t *dqs = strides(d->diff_qry_md());
+    const dim_t *dks = strides(d->diff_key_md());
+    const dim_t *dvs = strides(d->diff_val_md());
+    const dim_t *dss = strides(&d->dS_desc);
+    const dim_t *ms = strides(d->attn_mask_md());
+    const bool with_mask = pd()->with_attn_mask();
+    const bool with_ds = pd()->with_dS();
+    const data_type_t msk_dt = d->attn_mask_md()->data_type;
+    const dims_t &msk_dims = d->attn_mask_md()->dims;
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+
+    // D = rowsum(dO * O), the dot product of the output with its gradient
+    parallel_nd(c.mb, c.heads, c.queries, [&](dim_t b, dim_t h, dim_t q) {
+        const float *o = dst + b * os[0] + h * os[1] + q * os[2];
+        const float *dd = diff_dst + b * dos[0] + h * dos[1] + q * dos[2];
+        float sum = 0.f;
+        for (dim_t v = 0; v < c.values; ++v)
+            sum += o[v * os[3]] * dd[v];
+        Di[(b * c.heads + h) * c.queries + q] = sum;
+    });
+
+    // Per-thread buffers of the block products
+    struct thr_bufs_t {
+        float *scores, *diff_scores, *p_trans, *ds_trans;
+        float *key_trans, *key_rows, *val_trans;
+    };
+    const auto get_bufs = [&](int ithr) {
+        thr_bufs_t t;
+        t.scores = scores_base + ithr * c.q_blk * c.k_blk;
+        t.diff_scores = diff_scores_base + ithr * c.q_blk * c.k_blk;
+        t.p_trans = scores_trans_base + ithr * 2 * c.k_blk * c.q_blk;
+        t.ds_trans = t.p_trans + c.k_blk * c.q_blk;
+        t.key_trans = key_trans_base + ithr * 2 * c.head_size * c.k_blk;
+        t.key_rows = t.key_trans + c.head_size * c.k_blk;
+        t.val_trans = val_trans_base + ithr * c.values * c.k_blk;
+        return t;
+    };
+
+    // Stages the N keys and values from k_start as [head_size][k_blk],
+    // optionally [k_blk][head_size], and [values][k_blk].
+    const auto stage_kv = [&](const thr_bufs_t &t, dim_t b, dim_t h_kv,
+                                  dim_t k_start, dim_t N, bool with_rows) {
+        const float *k_ptr = key + b * ks[0] + h_kv * ks[1] + k_start * ks[3];
+        const float *v_ptr = val + b * vs[0] + h_kv * vs[1] + k_start * vs[2];
+        for (dim_t n = 0; n < N; ++n)
+            for (dim_t dd = 0; dd < c.head_size; ++dd) {
+                const float k_val = k_ptr[n * ks[3] + dd * ks[2]];
+                t.key_trans[dd * c.k_blk + n] = k_val;
+                if (with_rows) t.key_rows[n * c.head_size + dd] = k_val;
+            }
+        for (dim_t n = 0; n < N; ++n)
+            for (dim_t v = 0; v < c.values; ++v)
+                t.val_trans[v * c.k_blk + n] = v_ptr[n * vs[2] + v * vs[3]];
+    };
+
+    // Computes P and dS of the M x N block of queries from q_start and keys
+    // from k_start into t.scores and t.diff_scores.
+    const auto compute_p_ds = [&](const thr_bufs_t &t, dim_t b, dim_t h,
+                                      dim_t q_start, dim_t M, dim_t k_start,
+                                      dim_t N, int brg_idx) {
+        brg_impl::brgemm_batch_element_t batch;
+        batch.ptr.A = qry + b * qs[0] + h * qs[1] + q_start * qs[2];
+        batch.ptr.B = t.key_trans;
+        brg_impl::brgemm_kernel_execute(
+                brg_kq_kernels_[brg_idx].get(), 1, &batch, t.scores);
+        batch.ptr.A = diff_dst + b * dos[0] + h * dos[1] + q_start * dos[2];
+        batch.ptr.B = t.val_trans;
+        brg_impl::brgemm_kernel_execute(
+                brg_dp_kernels_[brg_idx].get(), 1, &batch, t.diff_scores);
+
+        const dim_t row = (b * c.heads + h) * c.queries + q_start;
+        for (dim_t i = 0; i < M; ++i) {
+            const dim_t q_idx = q_start + i;
+            const float lse = ws[row + i];
+            const float di = Di[row + i];
+            float *p = t.scores + i * c.k_blk;
+            float *ds = t.diff_scores + i * c.k_blk;
+            for (dim_t n = 0; n < N; ++n) {
+                const dim_t k_idx = k_start + n;
+                float v = p[n] * scale;
+                if (with_mask) {
+                    const dim_t off = (msk_dims[0] == 1 ? 0 : b) * ms[0]
+                            + (msk_dims[1] == 1 ? 0 : h) * ms[1]
+                            + (msk_dims[2] == 1 ? 0 : q_idx) * ms[2]
+                            + k_idx * ms[3];
+                    v += io::load_float_value(msk_dt, mask, off);
+                }
+                if (c.with_causal_mask && k_idx > q_idx + c.causal_offset)
+                    v = neg_inf;
+                // Masked scores have no probability, also in fully masked
+                // rows whose log-sum-exp is infinite.
+                p[n] = v == neg_inf ? 0.f : ::expf(v - lse);
+                ds[n] = p[n] * (ds[n] - di) * scale;
+            }
+        }
+    };
+
+    // Pass 1: dK and dV, a block of keys per work item
+    const dim_t kv_heads = c.heads / c.q_per_kv_head;
+    parallel_nd_ext(c.nthr, c.mb, kv_heads, c.nb_k,
+            [&](int ithr, int, dim_t b, dim_t h_kv, dim_t ik) {
+                const thr_bufs_t t = get_bufs(ithr);
+                float *dk_acc = dk_acc_base + ithr * c.k_blk * c.head_size;
+                float *dv_acc = dv_acc_base + ithr * c.k_blk * c.values;
+                const dim_t k_start = ik * c.k_blk;
+                const dim_t N = nstl::min(c.k_blk, c.keys - k_start);
+                const bool is_k_tail = N < c.k_blk;
+
+                stage_kv(t, b, h_kv, k_start, N, false);
+                utils::array_set(dk_acc, 0.f, N * c.head_size);
+                utils::array_set(dv_acc, 0.f, N * c.values);
+
+                // With a causal mask, the query blocks before the first query
+                // seeing the block are skipped.
+                dim_t iq_beg = 0;
+                if (c.with_causal_mask)
+                    iq_beg = nstl::max(dim_t(0), k_start - c.causal_offset)
+                            / c.q_blk;
+
+                brg_impl::brgemm_batch_element_t batch;
+                for (dim_t j = 0; j < c.q_per_kv_head; ++j) {
+                    const dim_t h = h_kv * c.q_per_kv_head + j;
+                    for (dim_t iq = iq_beg; iq < c.nb_q; ++iq) {
+                        const dim_t q_start = iq * c.q_blk;
+                        const dim_t M = nstl::min(c.q_blk, c.queries - q_start);
+                        const int brg_idx
+                                = pd_t::get_brg_idx(M < c.q_blk, is_k_tail);
+                        compute_p_ds(t, b, h, q_start, M, k_start, N, brg_idx);
+
+                        for (dim_t i = 0; i < M; ++i)
+                            for (dim_t n = 0; n < N; ++n) {
+                                t.p_trans[n * c.q_blk + i]
+                                        = t.scores[i * c.k_blk + n];
+                                t.ds_trans[n * c.q_blk + i]
+                                        = t.diff_scores[i * c.k_blk + n];
+                            }
+
+                        batch.ptr.A = t.p_trans;
+                        batch.ptr.B = diff_dst + b * dos[0] + h * dos[1]
+                                + q_start * dos[2];
+                        brg_impl::brgemm_kernel_execute(
+                                brg_dv_kernels_[brg_idx].get(), 1, &batch,
+                                dv_acc);
+                        batch.ptr.A = t.ds_trans;
+                        batch.ptr.B
+                                = qry + b * qs[0] + h * qs[1] + q_start * qs[2];
+                        brg_impl::brgemm_kernel_execute(
+                                brg_dk_kernels_[brg_idx].get(), 1, &batch,
+                                dk_acc);
+                    }
+                }
+
+                float *dk = diff_key + b * dks[0] + h_kv * dks[1]
+                        + k_start * dks[3];
+                float *dv = diff_val + b * dvs[0] + h_kv * dvs[1]
+                        + k_start * dvs[2];
+                for (dim_t n = 0; n < N; ++n) {
+                    for (dim_t dd = 0; dd < c.head_size; ++dd)
+                        dk[n * dks[3] + dd * dks[2]]
+                                = dk_acc[n * c.head_size + dd];
+                    for (dim_t v = 0; v < c.values; ++v)
+                        dv[n * dvs[2] + v * dvs[3]] = dv_acc[n * c.values + v];
+                }
+            });
+
+    // Pass 2: dQ, a block of queries per work item. P and dS are recomputed,
+    // and stored when dS is requested.
+    parallel_nd_ext(c.nthr, c.mb, c.heads, c.nb_q,
+            [&](int ithr, int, dim_t b, dim_t h, dim_t iq) {
+                const thr_bufs_t t = get_bufs(ithr);
+                float *dq_acc = dq_acc_base + ithr * c.q_blk * c.head_size;
+                const dim_t h_kv = h / c.q_per_kv_head;
+                const dim_t q_start = iq * c.q_blk;
+                const dim_t M = nstl::min(c.q_blk, c.queries - q_start);
+                utils::array_set(dq_acc, 0.f, M * c.head_size);
+
+                // With a causal mask, key blocks past the diagonal of the
+                // last query in the block are skipped.
+                dim_t k_end = c.keys;
+                if (c.with_causal_mask)
+                    k_end = nstl::max(dim_t(0),
+                            nstl::min(c.keys, q_start + M + c.causal_offset));
+                const dim_t nb_k = utils::div_up(k_end, c.k_blk);
+
+                brg_impl::brgemm_batch_element_t batch;
+                for (dim_t ik = 0; ik < nb_k; ++ik) {
+                    const dim_t k_start = ik * c.k_blk;
+                    const dim_t N = nstl::min(c.k_blk, c.keys - k_start);
+                    const int brg_idx
+                            = pd_t::get_brg_idx(M < c.q_blk, N < c.k_blk);
+                    stage_kv(t, b, h_kv, k_start, N, true);
+                    compute_p_ds(t, b, h, q_start, M, k_start, N, brg_idx);
+
+                    batch.ptr.A = t.diff_scores;
+                    batch.ptr.B = t.key_rows;
+                    brg_impl::brgemm_kernel_execute(
+                            brg_dq_kernels_[brg_idx].get(), 1, &batch, dq_acc);
+
+                    if (with_ds)
+                        for (dim_t i = 0; i < M; ++i)
+                            for (dim_t n = 0; n < N; ++n)
+                                diff_scores[b * dss[0] + h * dss[1]
+                                        + (q_start + i) * dss[2]
+                                        + (k_start + n) * dss[3]]
+                                        = t.diff_scores[i * c.k_blk + n];
+                }
+
+                // The skipped keys have no gradient
+                if (with_ds)
+                    for (dim_t i = 0; i < M; ++i)
+                        for (dim_t k = nstl::min(c.keys, nb_k * c.k_blk);
+                                k < c.keys; ++k)
+                            diff_scores[b * dss[0] + h * dss[1]
+                                    + (q_start + i) * dss[2] + k * dss[3]]
+                                    = 0.f;
+
+                float *dq = diff_qry + b * dqs[0] + h * dqs[1]
+                        + q_start * dqs[2];
+                for (dim_t i = 0; i < M; ++i)
+                    for (dim_t dd = 0; dd < c.head_size; ++dd)
+                        dq[i * dqs[2] + dd * dqs[3]]
+                                = dq_acc[i * c.head_size + dd];
+            });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
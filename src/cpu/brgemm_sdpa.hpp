@@ -0,0 +1,248 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_BRGEMM_SDPA_HPP
+#define CPU_BRGEMM_SDPA_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+#include "cpu/platform.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/brgemm/brgemm.hpp"
+#elif DNNL_AARCH64
+#include "cpu/aarch64/brgemm/brgemm.hpp"
+#endif
+
+#if DNNL_X64 || DNNL_AARCH64
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace sdpa_brgemm {
+#if DNNL_X64
+using brgemm_desc_t = x64::brgemm_desc_t;
+using brgemm_kernel_t = x64::brgemm_kernel_t;
+#elif DNNL_AARCH64
+using brgemm_desc_t = aarch64::brgemm_desc_t;
+using brgemm_kernel_t = aarch64::brgemm_kernel_t;
+#endif
+} // namespace sdpa_brgemm
+
+struct brgemm_sdpa_conf_t {
+    dim_t mb, heads, queries, keys, head_size, values;
+    // Ratio of query heads to key/value heads (grouped-query attention)
+    dim_t q_per_kv_head;
+    // Query heads processed together. Their query blocks are stacked along
+    // the M dimension of the products, head after head, so that every keys
+    // and values block is loaded once for all of them.
+    dim_t q_heads_blk;
+
+    dim_t q_blk, k_blk;
+    dim_t nb_q, nb_k;
+    dim_t q_tail, k_tail;
+
+    // Keys are given as [keys][head_size] in memory and each block is
+    // transposed into a scratchpad buffer before the KQ product
+    bool key_trans;
+    // Keys or values are not f32 or are quantized; each block is converted
+    // to f32 in the scratchpad with the scales and zero-points applied
+    bool key_dequant, val_dequant;
+    bool with_causal_mask;
+    // Offset of the causal diagonal: key k is visible from query q iff
+    // k <= q + causal_offset
+    dim_t causal_offset;
+    bool inf_as_zero;
+    bool is_training;
+    // Keys and values are pools of pages of page_size keys, the pages of
+    // each sequence are given by the page table
+    bool with_kv_paging;
+    dim_t page_size;
+    // The batch is made of seq_count variable-length sequences packed along
+    // the queries and keys dimensions
+    bool with_varlen;
+    dim_t seq_count;
+    // Number of ranges the key blocks of a query block are split into. The
+    // ranges are processed by different threads and their partial softmax
+    // results are reduced at the end (flash-decoding).
+    dim_t kv_splits;
+
+    int nthr;
+};
+
+/// Fused scaled dot-product attention with flash-style tiling.
+///
+/// For every block of queries the keys are processed block by block: the
+/// scores block Q * K is computed with a brgemm kernel, a running (online)
+/// softmax rescales the partial output, and the output is accumulated with a
+/// second brgemm kernel. Only a q_blk x k_blk block of scores is ever live per
+/// thread, so the memory traffic no longer grows with queries * keys.
+///
+/// With a paged kv cache every keys block lies within a single page, so blocks
+/// are located through the page table without gathering. The page table does
+/// not carry the length of the sequences, so an attention mask excluding the
+/// keys past the end of every sequence is required; configurations without
+/// one are rejected. Entries of the page table past the end of a sequence
+/// must still be valid page indices.
+///
+/// For a variable-length batch the query blocks of all the sequences are
+/// distributed together, and blocks shorter than the tiles are padded in the
+/// scratchpad, so no compute is spent on padding to the longest sequence.
+///
+/// When there are fewer query blocks than threads, e.g. for a decode step
+/// with a single query, the key blocks of every query block are split across
+/// the threads. Each split keeps its own running max, sum and unnormalized
+/// output, and the splits are rescaled to the common max and summed in a
+/// final reduction.
+///
+/// Low-precision keys and values (int8, int4, fp8, bf16 or f16), e.g. of a
+/// quantized kv cache, are dequantized block by block right before the
+/// products, with per-tensor, per-head or grouped scales and zero-points.
+///
+/// With grouped-query or multi-query attention, the query heads sharing a kv
+/// head are processed by the same work item: their query blocks are copied
+/// one after another into the scratchpad and multiplied with each keys and
+/// values block at once, which divides the kv traffic by the group size.
+struct brgemm_sdpa_fwd_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_fwd_pd_t {
+        using cpu_sdpa_fwd_pd_t::cpu_sdpa_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("brg:any", brgemm_sdpa_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernel index for a (queries tail, keys tail) combination
+        static int get_brg_idx(bool q_tail, bool k_tail) {
+            return 2 * static_cast<int>(q_tail) + static_cast<int>(k_tail);
+        }
+
+        brgemm_sdpa_conf_t conf_ {};
+        // Scores = Q * K, N dim is the keys block
+        sdpa_brgemm::brgemm_desc_t brg_kq_[4];
+        // Acc += P * V, K dim is the keys block
+        sdpa_brgemm::brgemm_desc_t brg_vs_[4];
+
+    private:
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_sdpa_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<sdpa_brgemm::brgemm_kernel_t> brg_kq_kernels_[4];
+    std::unique_ptr<sdpa_brgemm::brgemm_kernel_t> brg_vs_kernels_[4];
+};
+
+struct brgemm_sdpa_bwd_conf_t {
+    dim_t mb, heads, queries, keys, head_size, values;
+    // Ratio of query heads to key/value heads (grouped-query attention)
+    dim_t q_per_kv_head;
+
+    dim_t q_blk, k_blk;
+    dim_t nb_q, nb_k;
+    dim_t q_tail, k_tail;
+
+    bool with_causal_mask;
+    // Offset of the causal diagonal: key k is visible from query q iff
+    // k <= q + causal_offset
+    dim_t causal_offset;
+
+    int nthr;
+};
+
+/// Fused scaled dot-product attention backward with flash-style tiling.
+///
+/// The probabilities are recomputed block by block from Q, K and the
+/// log-sum-exp the forward pass stored in the workspace, so the attention
+/// matrix is never stored. Per block of queries and keys:
+///   P = exp(Q * K * scale + mask - lse)
+///   dP = dO * V^T
+///   dS = P * (dP - rowsum(dO * O)) * scale
+/// and the gradients dV = P^T * dO, dK = dS^T * Q and dQ = dS * K are
+/// accumulated with brgemm kernels.
+///
+/// To avoid both atomics and per-thread copies of the gradients, the work is
+/// done in two passes. The first one owns a block of keys per work item and
+/// accumulates its dK and dV over all the queries (and all the query heads
+/// sharing the kv head). The second one owns a block of queries and
+/// accumulates its dQ over all the keys, recomputing P and dS.
+struct brgemm_sdpa_bwd_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_bwd_pd_t {
+        using cpu_sdpa_bwd_pd_t::cpu_sdpa_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T("brg:any", brgemm_sdpa_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernel index for a (queries tail, keys tail) combination
+        static int get_brg_idx(bool q_tail, bool k_tail) {
+            return 2 * static_cast<int>(q_tail) + static_cast<int>(k_tail);
+        }
+
+        brgemm_sdpa_bwd_conf_t conf_ {};
+        // S = Q * K, N dim is the keys block
+        sdpa_brgemm::brgemm_desc_t brg_kq_[4];
+        // dP = dO * V^T, N dim is the keys block
+        sdpa_brgemm::brgemm_desc_t brg_dp_[4];
+        // dV += P^T * dO, M dim is the keys block
+        sdpa_brgemm::brgemm_desc_t brg_dv_[4];
+        // dK += dS^T * Q, M dim is the keys block
+        sdpa_brgemm::brgemm_desc_t brg_dk_[4];
+        // dQ += dS * K, K dim is the keys block
+        sdpa_brgemm::brgemm_desc_t brg_dq_[4];
+
+    private:
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_sdpa_bwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<sdpa_brgemm::brgemm_kernel_t> brg_kq_kernels_[4];
+    std::unique_ptr<sdpa_brgemm::brgemm_kernel_t> brg_dp_kernels_[4];
+    std::unique_ptr<sdpa_brgemm::brgemm_kernel_t> brg_dv_kernels_[4];
+    std::unique_ptr<sdpa_brgemm::brgemm_kernel_t> brg_dk_kernels_[4];
+    std::unique_ptr<sdpa_brgemm::brgemm_kernel_t> brg_dq_kernels_[4];
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -74,6 +74,8 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_X64(jit_uni_batch_normalization_s8_fwd_t<avx2>)
             CPU_INSTANCE_X64(jit_uni_batch_normalization_s8_fwd_t<sse41>)
             CPU_INSTANCE_AARCH64(jit_uni_batch_normalization_s8_fwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(jit_uni_batch_normalization_s8_fwd_t<sve_256>)
+            CPU_INSTANCE_AARCH64(jit_uni_batch_normalization_s8_fwd_t<sve_128>)
             CPU_INSTANCE(ref_batch_normalization_fwd_t<s8>)
             nullptr,
         }},
@@ -20,6 +20,11 @@
 #include "cpu/ref_concat.hpp"
 #include "cpu/simple_concat.hpp"
 
+#if DNNL_AARCH64
+#include "cpu/aarch64/jit_uni_concat.hpp"
+using namespace dnnl::impl::cpu::aarch64;
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -29,8 +34,15 @@ using namespace dnnl::impl::data_type;
 #define INSTANCE(...) \
     impl_list_item_t(impl_list_item_t::concat_type_deduction_helper_t< \
             __VA_ARGS__::pd_t>()),
+#define INSTANCE_AARCH64(...) DNNL_AARCH64_ONLY(INSTANCE(__VA_ARGS__))
 // clang-format off
 constexpr impl_list_item_t cpu_concat_impl_list[] = REG_CONCAT_P({
+        INSTANCE_AARCH64(jit_uni_concat_t<f32>)
+        INSTANCE_AARCH64(jit_uni_concat_t<u8>)
+        INSTANCE_AARCH64(jit_uni_concat_t<s8>)
+        INSTANCE_AARCH64(jit_uni_concat_t<s32>)
+        INSTANCE_AARCH64(jit_uni_concat_t<bf16>)
+        INSTANCE_AARCH64(jit_uni_concat_t<f16>)
         INSTANCE(simple_concat_t<f32>)
         INSTANCE(simple_concat_t<u8>)
         INSTANCE(simple_concat_t<s8>)
@@ -41,6 +53,7 @@ constexpr impl_list_item_t cpu_concat_impl_list[] = REG_CONCAT_P({
         nullptr,
 });
 // clang-format on
+#undef INSTANCE_AARCH64
 #undef INSTANCE
 } // namespace
 
@@ -29,6 +29,7 @@
 #include "cpu/ref_convolution.hpp"
 #include "cpu/ref_convolution_int8.hpp"
 #include "cpu/ref_fused_convolution.hpp"
+#include "cpu/wei_decomp_convolution.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/gemm_bf16_convolution.hpp"
@@ -59,8 +60,11 @@ using namespace dnnl::impl::cpu::x64;
 #elif DNNL_AARCH64
 #include "cpu/aarch64/jit_brdgmm_dw_conv.hpp"
 #include "cpu/aarch64/jit_brgemm_1x1_conv.hpp"
+#include "cpu/aarch64/jit_brgemm_1x1_dw_conv.hpp"
 #include "cpu/aarch64/jit_brgemm_conv.hpp"
 #include "cpu/aarch64/jit_brgemm_conv_bwd.hpp"
+#include "cpu/aarch64/jit_brgemm_conv_bwd_w.hpp"
+#include "cpu/aarch64/jit_brgemm_wino_conv.hpp"
 #include "cpu/aarch64/jit_sve_1x1_convolution.hpp"
 #include "cpu/aarch64/jit_sve_512_x8s8s32x_convolution.hpp"
 #include "cpu/aarch64/jit_sve_convolution.hpp"
@@ -115,6 +119,9 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AVX2(jit_avx2_convolution_fwd_t)
             CPU_INSTANCE_SSE41(jit_sse41_convolution_fwd_t)
             CPU_INSTANCE_AARCH64_ACL(acl_wino_convolution_fwd_t)
+            CPU_INSTANCE_AARCH64(brgemm_wino_convolution_fwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brgemm_wino_convolution_fwd_t<sve_256>)
+            CPU_INSTANCE_AARCH64(brgemm_wino_convolution_fwd_t<sve_128>)
             CPU_INSTANCE_AARCH64(brdgmm_dw_convolution_fwd_t<sve_512>)
             CPU_INSTANCE_AARCH64(brgemm_1x1_convolution_fwd_t<sve_512>)
             CPU_INSTANCE_AARCH64(brgemm_convolution_fwd_t<sve_512>)
@@ -136,6 +143,9 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AARCH64(brgemm_convolution_fwd_t<sve_128>)
             CPU_INSTANCE_AARCH64(jit_sve_1x1_convolution_fwd_t<f32,f32,f32,sve_128>)
             CPU_INSTANCE_AARCH64(jit_sve_convolution_fwd_t<f32,f32,f32,sve_128>)
+            CPU_INSTANCE_AARCH64(brgemm_1x1_dw_convolution_fwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brgemm_1x1_dw_convolution_fwd_t<sve_256>)
+            CPU_INSTANCE_AARCH64(brgemm_1x1_dw_convolution_fwd_t<sve_128>)
             CPU_INSTANCE_X64(jit_uni_ncsp_convolution_fwd_t)
             CPU_INSTANCE_RV64GCV(jit_rvv_1x1_convolution_fwd_t)
             CPU_INSTANCE_RV64GCV(rvv_wino_convolution_fwd_t)
@@ -165,6 +175,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AVX512(gemm_bf16_convolution_fwd_t<bf16>)
             CPU_INSTANCE_AVX2(brgemm_1x1_convolution_fwd_t<avx2_vnni_2>)
             CPU_INSTANCE_AVX2(brgemm_convolution_fwd_t<avx2_vnni_2>)
+            CPU_INSTANCE_AARCH64(brdgmm_dw_convolution_fwd_t<sve_512>)
             CPU_INSTANCE_AARCH64(jit_uni_dw_convolution_fwd_t<sve_256, bf16, bf16>)
             CPU_INSTANCE_AARCH64(brdgmm_dw_convolution_fwd_t<sve_256>)
             CPU_INSTANCE_AARCH64(brgemm_1x1_convolution_fwd_t<sve_256>)
@@ -173,6 +184,8 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AARCH64(jit_uni_dw_convolution_fwd_t<sve_128, bf16, bf16>)
             CPU_INSTANCE_AARCH64(brgemm_1x1_convolution_fwd_t<sve_128>)
             CPU_INSTANCE_AARCH64(brgemm_convolution_fwd_t<sve_128>)
+            CPU_INSTANCE_AARCH64(brgemm_1x1_dw_convolution_fwd_t<sve_256>)
+            CPU_INSTANCE_AARCH64(brgemm_1x1_dw_convolution_fwd_t<sve_128>)
             CPU_INSTANCE_AARCH64_ACL(acl_indirect_gemm_convolution_fwd_t)
             CPU_INSTANCE(ref_convolution_fwd_t)
             CPU_INSTANCE(ref_fused_convolution_fwd_t)
@@ -192,6 +205,9 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AVX2(brgemm_1x1_convolution_fwd_t<avx2_vnni_2>)
             CPU_INSTANCE_AVX2(brgemm_convolution_fwd_t<avx2_vnni_2>)
             CPU_INSTANCE_AARCH64_ACL(acl_wino_convolution_fwd_t)
+            CPU_INSTANCE_AARCH64(brdgmm_dw_convolution_fwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brdgmm_dw_convolution_fwd_t<sve_256>)
+            CPU_INSTANCE_AARCH64(brdgmm_dw_convolution_fwd_t<sve_128>)
             CPU_INSTANCE_AARCH64_ACL(acl_depthwise_convolution_fwd_t)
             CPU_INSTANCE_AARCH64_ACL(acl_indirect_gemm_convolution_fwd_t)
             CPU_INSTANCE_AARCH64_ACL(acl_gemm_convolution_fwd_t<f16>)
@@ -199,6 +215,39 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE(ref_fused_convolution_fwd_t)
             nullptr,
         }},
+        // FWD fp with weights decompression
+        {{forward, "f32:s8:*"}, {
+            CPU_INSTANCE(wei_decomp_convolution_fwd_t)
+            nullptr,
+        }},
+        {{forward, "f32:u8:*"}, {
+            CPU_INSTANCE(wei_decomp_convolution_fwd_t)
+            nullptr,
+        }},
+        {{forward, "f32:s4:*"}, {
+            CPU_INSTANCE(wei_decomp_convolution_fwd_t)
+            nullptr,
+        }},
+        {{forward, "f32:u4:*"}, {
+            CPU_INSTANCE(wei_decomp_convolution_fwd_t)
+            nullptr,
+        }},
+        {{forward, "bf16:s8:*"}, {
+            CPU_INSTANCE(wei_decomp_convolution_fwd_t)
+            nullptr,
+        }},
+        {{forward, "bf16:u8:*"}, {
+            CPU_INSTANCE(wei_decomp_convolution_fwd_t)
+            nullptr,
+        }},
+        {{forward, "bf16:s4:*"}, {
+            CPU_INSTANCE(wei_decomp_convolution_fwd_t)
+            nullptr,
+        }},
+        {{forward, "bf16:u4:*"}, {
+            CPU_INSTANCE(wei_decomp_convolution_fwd_t)
+            nullptr,
+        }},
         {{forward, "xf8:xf8:*"}, {
             CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx10_2_amx_2>)
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx10_2_amx_2>)
@@ -259,6 +308,9 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AVX512(gemm_bf16_convolution_bwd_data_t<bf16>)
             CPU_INSTANCE_AVX2(brgemm_convolution_bwd_t<avx2_vnni_2>)
             CPU_INSTANCE_AVX2(brgemm_convolution_bwd_strided_t<avx2_vnni_2>)
+            CPU_INSTANCE_AARCH64(brgemm_convolution_bwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brgemm_convolution_bwd_t<sve_256>)
+            CPU_INSTANCE_AARCH64(brgemm_convolution_bwd_t<sve_128>)
             CPU_INSTANCE(ref_convolution_bwd_data_t)
             nullptr,
         })},
@@ -273,6 +325,9 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AVX512(brgemm_convolution_bwd_strided_t<avx512_core_fp16>)
             CPU_INSTANCE_AVX2(brgemm_convolution_bwd_t<avx2_vnni_2>)
             CPU_INSTANCE_AVX2(brgemm_convolution_bwd_strided_t<avx2_vnni_2>)
+            CPU_INSTANCE_AARCH64(brgemm_convolution_bwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brgemm_convolution_bwd_t<sve_256>)
+            CPU_INSTANCE_AARCH64(brgemm_convolution_bwd_t<sve_128>)
             CPU_INSTANCE(ref_convolution_bwd_data_t)
             nullptr,
         })},
@@ -302,6 +357,9 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AARCH64(jit_uni_dw_convolution_bwd_weights_t<sve_256,f32>)
             CPU_INSTANCE_AARCH64(jit_sve_1x1_convolution_bwd_weights_t<f32,f32,f32,sve_256>)
             CPU_INSTANCE_AARCH64(jit_sve_convolution_bwd_weights_t<f32,f32,f32,sve_256>)
+            CPU_INSTANCE_AARCH64(brgemm_convolution_bwd_weights_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brgemm_convolution_bwd_weights_t<sve_256>)
+            CPU_INSTANCE_AARCH64(brgemm_convolution_bwd_weights_t<sve_128>)
             CPU_INSTANCE_X64(jit_uni_ncsp_convolution_bwd_weights_t)
             CPU_INSTANCE(gemm_convolution_bwd_weights_t)
             CPU_INSTANCE(ref_convolution_bwd_weights_t)
@@ -319,6 +377,9 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_X64(jit_uni_ncsp_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(gemm_bf16_convolution_bwd_weights_t<f32>)
             CPU_INSTANCE_AVX512(gemm_bf16_convolution_bwd_weights_t<bf16>)
+            CPU_INSTANCE_AARCH64(brgemm_convolution_bwd_weights_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brgemm_convolution_bwd_weights_t<sve_256>)
+            CPU_INSTANCE_AARCH64(brgemm_convolution_bwd_weights_t<sve_128>)
             CPU_INSTANCE(ref_convolution_bwd_weights_t)
             nullptr,
         })},
@@ -359,6 +420,9 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AVX2(jit_uni_x8s8s32x_convolution_fwd_t<avx2>)
             CPU_INSTANCE_SSE41(jit_uni_x8s8s32x_1x1_convolution_fwd_t<sse41>)
             CPU_INSTANCE_SSE41(jit_uni_x8s8s32x_convolution_fwd_t<sse41>)
+            CPU_INSTANCE_AARCH64(brdgmm_dw_convolution_fwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brgemm_1x1_convolution_fwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brgemm_convolution_fwd_t<sve_512>)
             CPU_INSTANCE_AARCH64(brdgmm_dw_convolution_fwd_t<sve_256>)
             CPU_INSTANCE_AARCH64(brgemm_1x1_convolution_fwd_t<sve_256>)
             CPU_INSTANCE_AARCH64(brgemm_convolution_fwd_t<sve_256>)
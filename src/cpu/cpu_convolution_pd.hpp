@@ -18,6 +18,7 @@
 #define CPU_CPU_CONVOLUTION_PD_HPP
 
 #include <assert.h>
+#include <cstring>
 
 #include "common/c_types_map.hpp"
 #include "common/convolution_pd.hpp"
@@ -38,7 +39,54 @@ struct cpu_convolution_fwd_pd_t : public convolution_fwd_pd_t {
         return has_padded_dst();
     }
 
+    // Returns true when dst needs a separate zero-padding pass after the
+    // kernels ran.
     bool wants_zero_pad_dst() const {
+        return !zero_pads_dst_ && has_dirty_dst_padding();
+    }
+
+    // Returns true when the implementation has to zero the padded channels of
+    // dst itself, from the threads computing the corresponding dst points.
+    bool zero_pads_dst() const {
+        return zero_pads_dst_ && has_dirty_dst_padding();
+    }
+
+    // Zeroes the padded channels of the dst points [sp_start, sp_end) of image
+    // `n`, the spatial points being flattened over (d, h, w). Only dst
+    // blocked by channels is supported.
+    void zero_pad_dst_channels(
+            void *dst, dim_t n, dim_t sp_start, dim_t sp_end) const {
+        const memory_desc_wrapper dst_d(&dst_md_);
+        const auto &blk = dst_d.blocking_desc();
+        assert(blk.inner_nblks == 1 && blk.inner_idxs[0] == 1);
+        const dim_t blksize = blk.inner_blks[0];
+        const dim_t tail = OC() % blksize;
+        if (tail == 0) return;
+
+        const int nd = dst_d.ndims();
+        const dim_t last_cb = OC() / blksize;
+        const dim_t OW = nd >= 3 ? dst_d.dims()[nd - 1] : 1;
+        const dim_t OH = nd >= 4 ? dst_d.dims()[nd - 2] : 1;
+        const size_t dt_size = dst_d.data_type_size();
+        for (dim_t sp = sp_start; sp < sp_end; sp++) {
+            const dim_t ow = sp % OW, oh = (sp / OW) % OH, od = sp / (OW * OH);
+            const dim_t off = nd == 3 ? dst_d.blk_off(n, last_cb, ow)
+                    : nd == 4         ? dst_d.blk_off(n, last_cb, oh, ow)
+                                      : dst_d.blk_off(n, last_cb, od, oh, ow);
+            std::memset(static_cast<char *>(dst) + (off + tail) * dt_size, 0,
+                    (blksize - tail) * dt_size);
+        }
+    }
+
+protected:
+    // Set by implementations which zero the padded channels of dst inside
+    // their parallel region with `zero_pad_dst_channels()`, so that the
+    // padded area is not traversed again by a standalone pass.
+    bool zero_pads_dst_ = false;
+
+    // Returns true when dst has padded channels which the kernels leave
+    // non-zero, i.e. a post-op doesn't preserve zero.
+    bool has_dirty_dst_padding() const {
         if (!has_padded_dst()) return false;
         bool is_zero_preserved = true;
         const auto &po = attr()->post_ops_;
@@ -54,7 +102,6 @@ struct cpu_convolution_fwd_pd_t : public convolution_fwd_pd_t {
         return !is_zero_preserved;
     }
 
-protected:
     // See `convolution_pd_t::attr_scales_ok` comment.
     status_t attr_scales_ok(
             const std::unordered_map<int, std::vector<int>> &supported_args_map
@@ -1,7 +1,7 @@
 /*******************************************************************************
 * Copyright 2019 Intel Corporation
 * Copyright 2022 FUJITSU LIMITED
-* Copyright 2022, 2024-2025 Arm Ltd. and affiliates
+* Copyright 2022, 2024-2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -66,6 +66,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_AVX2(jit_uni_x8s8s32x_deconvolution_fwd_t<avx2>)
             CPU_INSTANCE_SSE41(jit_uni_x8s8s32x_1x1_deconvolution_fwd_t<sse41>)
             CPU_INSTANCE_SSE41(jit_uni_x8s8s32x_deconvolution_fwd_t<sse41>)
+            CPU_INSTANCE_AARCH64(brgemm_deconvolution_fwd_t<sve_512>)
             CPU_INSTANCE_AARCH64(brgemm_deconvolution_fwd_t<sve_256>)
             CPU_INSTANCE_AARCH64(brgemm_deconvolution_fwd_t<sve_128>)
             CPU_INSTANCE_AARCH64(jit_sve_512_core_x8s8s32x_deconvolution_fwd_t)
@@ -74,10 +75,16 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             nullptr,
         }},
         {{backward_data}, REG_BWD_PK({
+            CPU_INSTANCE_AARCH64(brgemm_deconvolution_bwd_data_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brgemm_deconvolution_bwd_data_t<sve_256>)
+            CPU_INSTANCE_AARCH64(brgemm_deconvolution_bwd_data_t<sve_128>)
             CPU_INSTANCE(ref_deconvolution_bwd_data_t)
             nullptr,
         })},
         {{backward_weights}, REG_BWD_PK({
+            CPU_INSTANCE_AARCH64(brgemm_deconvolution_bwd_weights_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brgemm_deconvolution_bwd_weights_t<sve_256>)
+            CPU_INSTANCE_AARCH64(brgemm_deconvolution_bwd_weights_t<sve_128>)
             CPU_INSTANCE(ref_deconvolution_bwd_weights_t)
             nullptr,
         })},
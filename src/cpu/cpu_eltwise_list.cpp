@@ -65,6 +65,12 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t<sve_512, s32>)
             CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t<sve_512, s8>)
             CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t<sve_512, u8>)
+            CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t<sve_256, s32>)
+            CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t<sve_256, s8>)
+            CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t<sve_256, u8>)
+            CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t<sve_128, s32>)
+            CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t<sve_128, s8>)
+            CPU_INSTANCE_AARCH64(jit_uni_eltwise_int_fwd_t<sve_128, u8>)
             CPU_INSTANCE_AARCH64_ACL(acl_eltwise_fwd_t)
             CPU_INSTANCE_RV64(jit_uni_eltwise_fwd_t<v>)
             CPU_INSTANCE_RV64(jit_uni_eltwise_fwd_t<zvfh>)
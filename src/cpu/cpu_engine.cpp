@@ -17,6 +17,7 @@
 #include <assert.h>
 
 #include "common/memory.hpp"
+#include "common/serialization.hpp"
 #include "common/stream_impl.hpp"
 #include "common/type_helpers.hpp"
 
@@ -33,7 +34,11 @@ status_t cpu_engine_t::create_memory_storage(
     assert(runtime_kind() != runtime_kind::sycl);
     if (runtime_kind() == runtime_kind::sycl) return status::runtime_error;
 
-    auto _storage = new cpu_memory_storage_t(this);
+    const auto alloc_kind = (flags & memory_flags_t::scratchpad)
+            ? dnnl_cpu_alloc_scratch
+            : dnnl_cpu_alloc_persistent;
+    auto _storage
+            = new cpu_memory_storage_t(this, user_allocator(), alloc_kind);
     if (_storage == nullptr) return status::out_of_memory;
     status_t status = _storage->init(flags, size, handle);
     if (status != status::success) {
@@ -49,6 +54,16 @@ status_t cpu_engine_t::create_stream(
     return safe_ptr_assign(*stream, new cpu_stream_t(this, stream_impl));
 }
 
+status_t cpu_engine_t::serialize_device(
+        serialization_stream_t &sstream) const {
+    // JIT kernels are generated for the effective ISA, so blobs from a
+    // machine (or an ISA setting) with a different ISA must not match.
+    sstream.append(platform::get_effective_cpu_isa());
+    sstream.append(platform::get_cpu_isa_hints());
+    sstream.append(platform::get_vector_register_size());
+    return status::success;
+}
+
 engine_t *get_service_engine() {
     static std::unique_ptr<engine_t, engine_deleter_t> cpu_engine;
     static std::once_flag initialized;
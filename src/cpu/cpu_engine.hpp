@@ -26,7 +26,9 @@
 #include "common/engine.hpp"
 #include "common/engine_id.hpp"
 #include "common/impl_list_item.hpp"
+#include "common/sdpa_types.hpp"
 
+#include "cpu/cpu_memory_storage.hpp"
 #include "cpu/platform.hpp"
 
 #if DNNL_AARCH64 && defined(DNNL_AARCH64_USE_ACL)
@@ -34,8 +36,7 @@
 #endif
 
 #define CPU_INSTANCE(...) \
-    impl_list_item_t( \
-            impl_list_item_t::type_deduction_helper_t<__VA_ARGS__::pd_t>()),
+    DNNL_IMPL_LIST_ITEM(type_deduction_helper_t, __VA_ARGS__),
 #define CPU_INSTANCE_X64(...) DNNL_X64_ONLY(CPU_INSTANCE(__VA_ARGS__))
 #define CPU_INSTANCE_SSE41(...) REG_SSE41_ISA(CPU_INSTANCE(__VA_ARGS__))
 #define CPU_INSTANCE_AVX2(...) REG_AVX2_ISA(CPU_INSTANCE(__VA_ARGS__))
@@ -56,8 +57,12 @@
 
 #if DNNL_EXPERIMENTAL_GROUPED_MEMORY
 #define CPU_INSTANCE_GROUPED(...) CPU_INSTANCE(__VA_ARGS__)
+#define CPU_INSTANCE_GROUPED_X64(...) CPU_INSTANCE_X64(__VA_ARGS__)
+#define CPU_INSTANCE_GROUPED_AARCH64(...) CPU_INSTANCE_AARCH64(__VA_ARGS__)
 #else
 #define CPU_INSTANCE_GROUPED(...)
+#define CPU_INSTANCE_GROUPED_X64(...)
+#define CPU_INSTANCE_GROUPED_AARCH64(...)
 #endif
 
 namespace dnnl {
@@ -72,19 +77,23 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(embedding_bag);
+DECLARE_IMPL_LIST(gated_mlp);
 DECLARE_IMPL_LIST(group_normalization);
 DECLARE_IMPL_LIST(inner_product);
 DECLARE_IMPL_LIST(layer_normalization);
 DECLARE_IMPL_LIST(lrn);
 DECLARE_IMPL_LIST(matmul);
+DECLARE_IMPL_LIST(optimizer);
 DECLARE_IMPL_LIST(pooling);
 DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
 DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
+DECLARE_IMPL_LIST(sdpa);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax);
-
+DECLARE_IMPL_LIST(topk);
 #undef DECLARE_IMPL_LIST
 
 class cpu_engine_impl_list_t {
@@ -108,20 +117,23 @@ public:
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
+            CASE(gated_mlp);
             CASE(group_normalization);
             CASE(inner_product);
             CASE(layer_normalization);
             CASE(lrn);
             CASE(matmul);
+            CASE(optimizer);
             CASE(pooling);
             CASE(prelu);
             CASE(reduction);
             CASE(resampling);
             CASE(rnn);
+            CASE(sdpa);
             CASE(shuffle);
             CASE(softmax);
-            case primitive_kind::sdpa: return empty_list;
-            case primitive_kind::gated_mlp: return empty_list;
+            CASE(topk);
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
@@ -129,10 +141,61 @@ public:
     // clang-format on
 };
 
+// The id of a CPU engine with a user allocator. The primitives of such
+// engines are only shared with the engines that have the same allocator.
+struct cpu_user_allocator_engine_id_impl_t : public engine_id_impl_t {
+    cpu_user_allocator_engine_id_impl_t(
+            const cpu_user_allocator_t &user_allocator, size_t index)
+        : engine_id_impl_t(engine_kind::cpu, get_cpu_native_runtime(), index)
+        , user_allocator_(user_allocator) {}
+
+private:
+    bool compare_resource(const engine_id_impl_t *id_impl) const override {
+        const auto *typed_id
+                = static_cast<const cpu_user_allocator_engine_id_impl_t *>(
+                        id_impl);
+        return user_allocator_.allocate == typed_id->user_allocator_.allocate
+                && user_allocator_.deallocate
+                == typed_id->user_allocator_.deallocate
+                && user_allocator_.user_data
+                == typed_id->user_allocator_.user_data;
+    }
+
+    size_t hash_resource() const override {
+        size_t seed = 0;
+        seed = hash_combine(
+                seed, reinterpret_cast<size_t>(user_allocator_.allocate));
+        seed = hash_combine(
+                seed, reinterpret_cast<size_t>(user_allocator_.deallocate));
+        return hash_combine(
+                seed, reinterpret_cast<size_t>(user_allocator_.user_data));
+    }
+
+    cpu_user_allocator_t user_allocator_;
+};
+
 class cpu_engine_t : public engine_t {
 public:
     cpu_engine_t(impl::engine_impl_t *engine_impl) : engine_t(engine_impl) {}
 
+    cpu_engine_t(impl::engine_impl_t *engine_impl,
+            const cpu_user_allocator_t &user_allocator)
+        : engine_t(engine_impl)
+        , user_allocator_(user_allocator)
+        , has_user_allocator_(true) {}
+
+    // The allocator of the engine, nullptr if the buffers are allocated by
+    // the library
+    const cpu_user_allocator_t *user_allocator() const {
+        return has_user_allocator_ ? &user_allocator_ : nullptr;
+    }
+
+    engine_id_t engine_id() const override {
+        if (!has_user_allocator_) return engine_t::engine_id();
+        return engine_id_t(
+                new cpu_user_allocator_engine_id_impl_t(user_allocator_, 0));
+    }
+
     /* implementation part */
 
     status_t create_memory_storage(memory_storage_t **storage, unsigned flags,
@@ -159,10 +222,24 @@ public:
         return cpu_engine_impl_list_t::get_implementation_list(desc);
     }
 
+    status_t serialize_device(serialization_stream_t &sstream) const override;
+
 protected:
     ~cpu_engine_t() override = default;
+
+private:
+    cpu_user_allocator_t user_allocator_;
+    bool has_user_allocator_ = false;
 };
 
+// Returns true if the engine is a native CPU engine with a user allocator
+inline bool has_user_allocator(const engine_t *engine) {
+    return engine->kind() == engine_kind::cpu
+            && is_native_runtime(engine->runtime_kind())
+            && utils::downcast<const cpu_engine_t *>(engine)->user_allocator()
+            != nullptr;
+}
+
 class cpu_engine_factory_t : public engine_factory_t {
 public:
     size_t count() const override { return 1; }
@@ -171,6 +248,18 @@ public:
         *engine = new cpu_engine_t(new impl::engine_impl_t(
                 engine_kind::cpu, get_cpu_native_runtime(), 0));
 
+#if DNNL_AARCH64 && defined(DNNL_AARCH64_USE_ACL)
+        dnnl::impl::cpu::aarch64::acl_thread_utils::set_acl_threading();
+#endif
+        return status::success;
+    }
+
+    status_t engine_create_with_allocator(engine_t **engine,
+            const cpu_user_allocator_t &user_allocator) const {
+        *engine = new cpu_engine_t(new impl::engine_impl_t(engine_kind::cpu,
+                                           get_cpu_native_runtime(), 0),
+                user_allocator);
+
 #if DNNL_AARCH64 && defined(DNNL_AARCH64_USE_ACL)
         dnnl::impl::cpu::aarch64::acl_thread_utils::set_acl_threading();
 #endif
@@ -22,6 +22,9 @@
 #include "cpu/x64/jit_uni_group_normalization.hpp"
 #include "cpu/x64/jit_uni_instance_normalization.hpp"
 using namespace dnnl::impl::cpu::x64;
+#elif DNNL_AARCH64
+#include "cpu/aarch64/jit_uni_group_normalization.hpp"
+using namespace dnnl::impl::cpu::aarch64;
 #elif DNNL_RV64
 #include "cpu/rv64/jit_uni_group_normalization.hpp"
 using namespace dnnl::impl::cpu::rv64;
@@ -41,6 +44,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
         {{forward}, {
             CPU_INSTANCE_X64(jit_uni_group_normalization_fwd_t)
             CPU_INSTANCE_X64(jit_uni_instance_normalization_fwd_t)
+            CPU_INSTANCE_AARCH64(jit_uni_group_normalization_fwd_t)
             CPU_INSTANCE_RV64(jit_uni_group_normalization_fwd_t)
             CPU_INSTANCE(ncsp_group_normalization_fwd_t)
             CPU_INSTANCE(ref_group_normalization_fwd_t)
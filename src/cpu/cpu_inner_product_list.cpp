@@ -28,10 +28,11 @@
 #include "cpu/x64/matmul_inner_product.hpp"
 using namespace dnnl::impl::cpu::x64;
 #elif DNNL_AARCH64
+#include "cpu/aarch64/jit_brgemm_inner_product.hpp"
 #if defined(DNNL_AARCH64_USE_ACL)
 #include "cpu/aarch64/acl_inner_product.hpp"
-using namespace dnnl::impl::cpu::aarch64;
 #endif
+using namespace dnnl::impl::cpu::aarch64;
 #elif DNNL_RV64
 #if defined(DNNL_RISCV_USE_RVV_INTRINSICS)
 #include "cpu/rv64/rvv_brgemm_inner_product.hpp"
@@ -58,6 +59,9 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AVX512(brgemm_inner_product_fwd_t<avx512_core>)
             CPU_INSTANCE_AVX2(brgemm_inner_product_fwd_t<avx2>)
             CPU_INSTANCE_AARCH64_ACL(acl_inner_product_fwd_t)
+            CPU_INSTANCE_AARCH64(brgemm_inner_product_fwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brgemm_inner_product_fwd_t<sve_256>)
+            CPU_INSTANCE_AARCH64(brgemm_inner_product_fwd_t<sve_128>)
             CPU_INSTANCE_RV64GCV(rvv_brgemm_inner_product_fwd_t)
             CPU_INSTANCE_RV64GCV(rvv_gemm_inner_product_fwd_t)
             CPU_INSTANCE(gemm_inner_product_fwd_t<f32>)
@@ -82,6 +86,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AVX512(brgemm_inner_product_fwd_t<avx512_core_fp16>)
             CPU_INSTANCE_AVX2(brgemm_inner_product_fwd_t<avx2_vnni_2>)
             CPU_INSTANCE_AARCH64_ACL(acl_inner_product_fwd_t)
+            CPU_INSTANCE_RV64GCV(rvv_brgemm_inner_product_fwd_t)
             CPU_INSTANCE(ref_inner_product_fwd_t)
             nullptr,
         }},
@@ -96,6 +101,9 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(brgemm_inner_product_bwd_data_t<avx512_core_amx>) // bf32
             CPU_INSTANCE_AVX512(brgemm_inner_product_bwd_data_t<avx512_core>)
             CPU_INSTANCE_AVX2(brgemm_inner_product_bwd_data_t<avx2>)
+            CPU_INSTANCE_AARCH64(brgemm_inner_product_bwd_data_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brgemm_inner_product_bwd_data_t<sve_256>)
+            CPU_INSTANCE_AARCH64(brgemm_inner_product_bwd_data_t<sve_128>)
             CPU_INSTANCE(gemm_inner_product_bwd_data_t<f32>)
             CPU_INSTANCE(ref_inner_product_bwd_data_t)
             nullptr,
@@ -122,6 +130,9 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(brgemm_inner_product_bwd_weights_t<avx512_core_amx>) // bf32
             CPU_INSTANCE_AVX512(brgemm_inner_product_bwd_weights_t<avx512_core>)
             CPU_INSTANCE_AVX2(brgemm_inner_product_bwd_weights_t<avx2>)
+            CPU_INSTANCE_AARCH64(brgemm_inner_product_bwd_weights_t<sve_512>)
+            CPU_INSTANCE_AARCH64(brgemm_inner_product_bwd_weights_t<sve_256>)
+            CPU_INSTANCE_AARCH64(brgemm_inner_product_bwd_weights_t<sve_128>)
             CPU_INSTANCE(gemm_inner_product_bwd_weights_t<f32>)
             CPU_INSTANCE(ref_inner_product_bwd_weights_t)
             nullptr,
@@ -152,6 +163,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AVX512(brgemm_inner_product_fwd_t<avx512_core>)
             CPU_INSTANCE_AVX2(brgemm_inner_product_fwd_t<avx2_vnni_2>)
             CPU_INSTANCE_AVX2(brgemm_inner_product_fwd_t<avx2_vnni>)
+            CPU_INSTANCE_RV64GCV(rvv_brgemm_inner_product_fwd_t)
             CPU_INSTANCE_RV64GCV(rvv_inner_product_fwd_t)
             CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t)
             CPU_INSTANCE(ref_inner_product_int8_fwd_t)
@@ -22,6 +22,9 @@
 #include "cpu/x64/lrn/jit_avx512_common_lrn.hpp"
 #include "cpu/x64/lrn/jit_uni_lrn.hpp"
 using namespace dnnl::impl::cpu::x64;
+#elif DNNL_AARCH64
+#include "cpu/aarch64/lrn/jit_uni_lrn.hpp"
+using namespace dnnl::impl::cpu::aarch64;
 #endif
 
 namespace dnnl {
@@ -46,6 +49,9 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_X64(jit_uni_lrn_fwd_t<avx2_vnni_2, f16>)
             CPU_INSTANCE_X64(jit_uni_lrn_fwd_t<avx2, f32>)
             CPU_INSTANCE_X64(jit_uni_lrn_fwd_t<sse41, f32>)
+            CPU_INSTANCE_AARCH64(jit_uni_lrn_fwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(jit_uni_lrn_fwd_t<sve_256>)
+            CPU_INSTANCE_AARCH64(jit_uni_lrn_fwd_t<sve_128>)
             CPU_INSTANCE(ref_lrn_fwd_t<f32>)
             CPU_INSTANCE(ref_lrn_fwd_t<bf16>)
             CPU_INSTANCE(ref_lrn_fwd_t<f16>)
@@ -59,6 +65,9 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_X64(jit_uni_lrn_bwd_t<avx512_core, f32>)
             CPU_INSTANCE_X64(jit_uni_lrn_bwd_t<avx512_core, bf16>)
             CPU_INSTANCE_X64(jit_uni_lrn_bwd_t<avx2, f32>)
+            CPU_INSTANCE_AARCH64(jit_uni_lrn_bwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(jit_uni_lrn_bwd_t<sve_256>)
+            CPU_INSTANCE_AARCH64(jit_uni_lrn_bwd_t<sve_128>)
             CPU_INSTANCE(ref_lrn_bwd_t<f32>)
             CPU_INSTANCE(ref_lrn_bwd_t<bf16>)
             CPU_INSTANCE(ref_lrn_bwd_t<f16>)
@@ -31,11 +31,23 @@ namespace dnnl {
 namespace impl {
 namespace cpu {
 
+// User functions that allocate the buffers of a CPU engine
+struct cpu_user_allocator_t {
+    dnnl_cpu_allocate_f allocate = nullptr;
+    dnnl_cpu_deallocate_f deallocate = nullptr;
+    void *user_data = nullptr;
+};
+
 class cpu_memory_storage_t : public memory_storage_t {
 public:
-    cpu_memory_storage_t(engine_t *engine)
-        : memory_storage_t(engine), data_(nullptr, release) {}
-    ~cpu_memory_storage_t() override = default;
+    cpu_memory_storage_t(engine_t *engine,
+            const cpu_user_allocator_t *user_allocator = nullptr,
+            dnnl_cpu_alloc_kind_t alloc_kind = dnnl_cpu_alloc_persistent)
+        : memory_storage_t(engine)
+        , data_(nullptr, release)
+        , user_allocator_(user_allocator)
+        , alloc_kind_(alloc_kind) {}
+    ~cpu_memory_storage_t() override { release_user_buffer(); }
 
     status_t get_data_handle(void **handle) const override {
         *handle = data_.get();
@@ -43,6 +55,7 @@ public:
     }
 
     status_t set_data_handle(void *handle) override {
+        release_user_buffer();
         data_ = decltype(data_)(handle, release);
         return status::success;
     }
@@ -87,7 +100,16 @@ public:
 
 protected:
     status_t init_allocate(size_t size) override {
-        void *ptr = malloc(size, platform::get_cache_line_size());
+        if (user_allocator_) {
+            void *ptr = user_allocator_->allocate(size,
+                    platform::get_cache_line_size(), alloc_kind_,
+                    user_allocator_->user_data);
+            if (!ptr) return status::out_of_memory;
+            data_ = decltype(data_)(ptr, release);
+            user_buffer_size_ = size;
+            return status::success;
+        }
+        void *ptr = malloc_large(size, platform::get_cache_line_size());
         if (!ptr) return status::out_of_memory;
         data_ = decltype(data_)(ptr, destroy);
         return status::success;
@@ -95,11 +117,25 @@ protected:
 
 private:
     std::unique_ptr<void, void (*)(void *)> data_;
+    // The allocator of the engine if it has one. The engine outlives the
+    // storage, which retains it.
+    const cpu_user_allocator_t *user_allocator_;
+    dnnl_cpu_alloc_kind_t alloc_kind_;
+    // The size of the buffer allocated with the user allocator, 0 if data_
+    // doesn't hold such a buffer
+    size_t user_buffer_size_ = 0;
+
+    void release_user_buffer() {
+        if (user_buffer_size_ == 0) return;
+        user_allocator_->deallocate(data_.get(), user_buffer_size_,
+                alloc_kind_, user_allocator_->user_data);
+        user_buffer_size_ = 0;
+    }
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_memory_storage_t);
 
     static void release(void *ptr) {}
-    static void destroy(void *ptr) { free(ptr); }
+    static void destroy(void *ptr) { free_large(ptr); }
 };
 
 } // namespace cpu
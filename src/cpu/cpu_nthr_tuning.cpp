@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+#include "common/nthr_tuner.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/profiler.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_nthr_tuning.hpp"
+#include "cpu/tuning_db.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace cpu_nthr_tuning {
+
+bool is_enabled() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    static const bool enabled = getenv_int_user("CPU_NTHR_TUNING", 0) == 1;
+    return enabled;
+#else
+    // The number of threads of TBB and threadpool parallel regions can't be
+    // limited for an execution.
+    return false;
+#endif
+}
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+namespace {
+std::string db_key(const primitive_iface_t *primitive_iface, int max_nthr) {
+    std::string key = "nthr:" + std::to_string(max_nthr) + ":"
+            + primitive_iface->pd()->info();
+    std::replace(key.begin(), key.end(), ' ', '_');
+    return key;
+}
+} // namespace
+
+status_t execute(const primitive_iface_t *primitive_iface,
+        const std::function<status_t()> &f) {
+    // Nested executions run sequentially.
+    if (dnnl_in_parallel()) return f();
+
+    nthr_tuner_t &tuner = primitive_iface->nthr_tuner();
+    const int max_nthr = dnnl_get_max_threads();
+    const bool with_db = tuning_db::is_enabled();
+    if (with_db && tuner.is_new(max_nthr)) {
+        std::vector<int> params;
+        if (tuning_db::lookup(db_key(primitive_iface, max_nthr), params)
+                && params.size() == 1)
+            tuner.set_nthr(max_nthr, params[0]);
+    }
+
+    const int nthr = tuner.get_nthr(max_nthr);
+    if (nthr != max_nthr) omp_set_num_threads(nthr);
+    const double start_ms = get_msec();
+    const status_t status = f();
+    const double ms = get_msec() - start_ms;
+    if (nthr != max_nthr) omp_set_num_threads(max_nthr);
+
+    if (status == status::success && tuner.record(nthr, ms) && with_db)
+        tuning_db::store(db_key(primitive_iface, max_nthr),
+                {tuner.get_nthr(max_nthr)});
+    return status;
+}
+#else
+status_t execute(const primitive_iface_t *primitive_iface,
+        const std::function<status_t()> &f) {
+    UNUSED(primitive_iface);
+    return f();
+}
+#endif
+
+} // namespace cpu_nthr_tuning
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
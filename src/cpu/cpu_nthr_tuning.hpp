@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_NTHR_TUNING_HPP
+#define CPU_CPU_NTHR_TUNING_HPP
+
+#include <functional>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_iface.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// The selection of the number of threads of the executions of a primitive
+// with its nthr_tuner_t, enabled by ONEDNN_CPU_NTHR_TUNING=1 with the OpenMP
+// runtime. The selected numbers of threads are kept in the tuning database,
+// if any, for the next runs of the application.
+namespace cpu_nthr_tuning {
+
+// Returns true if the number of threads of the primitives is tuned
+bool is_enabled();
+
+// Runs the execution `f` of `primitive_iface` on the number of threads
+// selected by its tuner and records the time it took.
+status_t execute(const primitive_iface_t *primitive_iface,
+        const std::function<status_t()> &f);
+
+} // namespace cpu_nthr_tuning
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
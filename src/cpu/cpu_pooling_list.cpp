@@ -27,6 +27,7 @@
 #include "cpu/x64/jit_uni_pooling.hpp"
 using namespace dnnl::impl::cpu::x64;
 #elif DNNL_AARCH64
+#include "cpu/aarch64/jit_uni_global_pooling.hpp"
 #include "cpu/aarch64/jit_uni_i8i8_pooling.hpp"
 #include "cpu/aarch64/jit_uni_pooling.hpp"
 using namespace dnnl::impl::cpu::aarch64;
@@ -61,7 +62,12 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx2, f32>)
             CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx, f32>)
             CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<sse41, f32>)
+            CPU_INSTANCE_AARCH64(jit_uni_global_pooling_fwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(jit_uni_global_pooling_fwd_t<sve_256>)
+            CPU_INSTANCE_AARCH64(jit_uni_global_pooling_fwd_t<sve_128>)
             CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<sve, f32>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<sve, bf16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_fwd_t<sve, f16>)
             CPU_INSTANCE_AARCH64_ACL(acl_pooling_fwd_t)
             CPU_INSTANCE_RV64(jit_uni_pooling_fwd_t<v>)
             CPU_INSTANCE_RV64(jit_uni_pooling_fwd_t<zvfh>)
@@ -80,6 +86,8 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_X64(jit_uni_i8i8_pooling_fwd_t<avx2>)
             CPU_INSTANCE_X64(jit_uni_i8i8_pooling_fwd_t<sse41>)
             CPU_INSTANCE_AARCH64(jit_uni_i8i8_pooling_fwd_t<sve_512>)
+            CPU_INSTANCE_AARCH64(jit_uni_i8i8_pooling_fwd_t<sve_256>)
+            CPU_INSTANCE_AARCH64(jit_uni_i8i8_pooling_fwd_t<sve_128>)
             CPU_INSTANCE(ref_pooling_fwd_t)
             nullptr,
         }},
@@ -91,6 +99,8 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx, f32>)
             CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<sse41, f32>)
             CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<sve, f32>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<sve, bf16>)
+            CPU_INSTANCE_AARCH64(jit_uni_pooling_bwd_t<sve, f16>)
             CPU_INSTANCE(nchw_pooling_bwd_t<bf16>)
             CPU_INSTANCE(nchw_pooling_bwd_t<f32>)
             CPU_INSTANCE(nchw_pooling_bwd_t<f16>)
@@ -23,8 +23,12 @@
 #include "cpu/x64/prelu/jit_prelu_forward.hpp"
 
 using namespace dnnl::impl::cpu::x64;
-#elif DNNL_AARCH64 && defined(DNNL_AARCH64_USE_ACL)
+#elif DNNL_AARCH64
+#include "cpu/aarch64/prelu/jit_prelu_backward.hpp"
+#include "cpu/aarch64/prelu/jit_prelu_forward.hpp"
+#if defined(DNNL_AARCH64_USE_ACL)
 #include "cpu/aarch64/acl_prelu.hpp"
+#endif
 using namespace dnnl::impl::cpu::aarch64;
 #endif
 
@@ -42,11 +46,13 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
         {{forward}, {
             CPU_INSTANCE_X64(jit_prelu_fwd_t)
             CPU_INSTANCE_AARCH64_ACL(acl_prelu_fwd_t)
+            CPU_INSTANCE_AARCH64(jit_prelu_fwd_t)
             CPU_INSTANCE(ref_prelu_fwd_t)
             nullptr,
         }},
         {{backward}, REG_BWD_PK({
             CPU_INSTANCE_X64(jit_prelu_bwd_t)
+            CPU_INSTANCE_AARCH64(jit_prelu_bwd_t)
             CPU_INSTANCE(ref_prelu_bwd_t)
             nullptr,
         })},
@@ -23,6 +23,9 @@
 #include "cpu/x64/jit_avx512_core_resampling.hpp"
 #include "cpu/x64/jit_uni_resampling.hpp"
 using namespace dnnl::impl::cpu::x64;
+#elif DNNL_AARCH64
+#include "cpu/aarch64/jit_uni_resampling.hpp"
+using namespace dnnl::impl::cpu::aarch64;
 #endif
 
 namespace dnnl {
@@ -38,12 +41,14 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
     static std::map<pk_impl_key_t, std::vector<impl_list_item_t>> the_map = REG_RESAMPLING_P({
         {{forward}, {
             CPU_INSTANCE_X64(jit_uni_resampling_fwd_t)
+            CPU_INSTANCE_AARCH64(jit_uni_resampling_fwd_t)
             CPU_INSTANCE(simple_resampling_fwd_t)
             CPU_INSTANCE(ref_resampling_fwd_t)
             nullptr,
         }},
         {{backward}, REG_BWD_PK({
             CPU_INSTANCE_X64(jit_avx512_core_resampling_bwd_t)
+            CPU_INSTANCE_AARCH64(jit_uni_resampling_bwd_t)
             CPU_INSTANCE(simple_resampling_bwd_t)
             CPU_INSTANCE(ref_resampling_bwd_t)
             nullptr,
@@ -0,0 +1,43 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_SDPA_PD_HPP
+#define CPU_CPU_SDPA_PD_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/sdpa_pd.hpp"
+#include "common/utils.hpp"
+#include "cpu/cpu_engine.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_sdpa_fwd_pd_t : public sdpa_fwd_pd_t {
+    using sdpa_fwd_pd_t::sdpa_fwd_pd_t;
+};
+
+struct cpu_sdpa_bwd_pd_t : public sdpa_bwd_pd_t {
+    using sdpa_bwd_pd_t::sdpa_bwd_pd_t;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -27,16 +27,31 @@
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
 
+#include "common/primitive_iface.hpp"
+
+#include "cpu/cpu_nthr_tuning.hpp"
+#include "cpu/cpu_stream_profiler.hpp"
+#include "cpu/cpu_stream_scheduler.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
 struct cpu_stream_t : public stream_t {
     cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl)
-        : stream_t(engine, stream_impl) {}
+        : stream_t(engine, stream_impl) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL
+        // The executions of a threadpool stream stay on the threadpool of
+        // the user, in order.
+        if (flags() & stream_flags::out_of_order)
+            scheduler_.reset(new cpu_stream_scheduler_t(
+                    cpu_stream_scheduler_t::get_default_nworkers()));
+#endif
+    }
     ~cpu_stream_t() override = default;
 
     dnnl::impl::status_t wait() override {
+        if (scheduler_) return scheduler_->wait();
         // CPU execution is synchronous so return immediately
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
         dnnl::threadpool_interop::threadpool_iface *tp;
@@ -50,6 +65,32 @@ struct cpu_stream_t : public stream_t {
         return dnnl::impl::status::success;
     }
 
+    status_t enqueue_primitive(const primitive_iface_t *primitive_iface,
+            exec_ctx_t &ctx) override {
+        if (scheduler_) return enqueue_out_of_order(primitive_iface, ctx);
+        if (cpu_nthr_tuning::is_enabled())
+            return cpu_nthr_tuning::execute(primitive_iface,
+                    [&]() { return enqueue_in_order(primitive_iface, ctx); });
+        return enqueue_in_order(primitive_iface, ctx);
+    }
+
+    status_t enqueue_barrier() override {
+        if (scheduler_) scheduler_->submit_barrier();
+        return status::success;
+    }
+
+    status_t reset_profiling() override {
+        if (!is_profiling_enabled()) return status::invalid_arguments;
+        profiler_.reset();
+        return status::success;
+    }
+
+    status_t get_profiling_data(profiling_data_kind_t data_kind,
+            int *num_entries, uint64_t *data) const override {
+        if (!is_profiling_enabled()) return status::invalid_arguments;
+        return profiler_.get_info(data_kind, num_entries, data);
+    }
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     cpu_stream_t(engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
@@ -65,6 +106,57 @@ struct cpu_stream_t : public stream_t {
         threadpool_utils::deactivate_threadpool();
     }
 #endif
+
+private:
+    cpu_stream_profiler_t profiler_;
+    // Set for out-of-order streams. Declared last so that it waits for the
+    // executions before the other members are destroyed.
+    std::unique_ptr<cpu_stream_scheduler_t> scheduler_;
+
+    status_t enqueue_in_order(
+            const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+        if (!is_profiling_enabled())
+            return stream_t::enqueue_primitive(primitive_iface, ctx);
+
+        const uint64_t start_nsec = cpu_stream_profiler_t::get_nsec();
+        status_t status = stream_t::enqueue_primitive(primitive_iface, ctx);
+        if (status == status::success)
+            profiler_.record(start_nsec, cpu_stream_profiler_t::get_nsec());
+        return status;
+    }
+
+    // Submits the execution to the scheduler and returns. The context is
+    // shared with the task, which keeps the memory objects of the arguments
+    // alive, and the primitive is retained until the execution is done.
+    // A primitive with a shared scratchpad runs on the calling thread once
+    // the submitted executions are done: the global scratchpad is only
+    // allocated for the thread that created the primitive, and the
+    // executions of the primitive would overwrite each other's scratchpad.
+    status_t enqueue_out_of_order(
+            const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+        if (primitive_iface->has_shared_scratchpad()) {
+            CHECK(scheduler_->wait());
+            return enqueue_in_order(primitive_iface, ctx);
+        }
+
+        auto *p = const_cast<primitive_iface_t *>(primitive_iface);
+        p->retain();
+        const bool with_profiling = is_profiling_enabled();
+        exec_ctx_t task_ctx(ctx);
+        scheduler_->submit(
+                ctx.args(), [this, p, task_ctx, with_profiling]() mutable {
+                    const uint64_t start_nsec = with_profiling
+                            ? cpu_stream_profiler_t::get_nsec()
+                            : 0;
+                    const status_t status = p->execute(task_ctx);
+                    if (with_profiling && status == status::success)
+                        profiler_.record(
+                                start_nsec, cpu_stream_profiler_t::get_nsec());
+                    p->release();
+                    return status;
+                });
+        return status::success;
+    }
 };
 
 } // namespace cpu
@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_STREAM_PROFILER_HPP
+#define CPU_CPU_STREAM_PROFILER_HPP
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <functional>
+#include <thread>
+#endif
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Keeps the timestamps of the primitive executions of a CPU stream created
+// with the profiling flag. Execution on CPU is synchronous, so an entry is
+// recorded by the thread that executed the primitive right after it returns.
+// The entries are not capped, like on GPU they accumulate until the user
+// resets the profiler, which is documented as a limitation of the API.
+struct cpu_stream_profiler_t {
+    struct entry_t {
+        uint64_t start_nsec;
+        uint64_t end_nsec;
+        uint64_t thread_id;
+    };
+
+    // Timestamp of a monotonic clock in nanoseconds
+    static uint64_t get_nsec() {
+        using namespace std::chrono;
+        return static_cast<uint64_t>(
+                duration_cast<nanoseconds>(
+                        steady_clock::now().time_since_epoch())
+                        .count());
+    }
+
+    // Operating system identifier of the calling thread when available
+    static uint64_t get_thread_id() {
+#if defined(__linux__)
+        static thread_local uint64_t tid = 0;
+        if (tid == 0) tid = static_cast<uint64_t>(syscall(SYS_gettid));
+        return tid;
+#else
+        return static_cast<uint64_t>(
+                std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+    }
+
+    void record(uint64_t start_nsec, uint64_t end_nsec) {
+        const entry_t e = {start_nsec, end_nsec, get_thread_id()};
+        std::lock_guard<std::mutex> guard(m_);
+        entries_.push_back(e);
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> guard(m_);
+        entries_.clear();
+    }
+
+    status_t get_info(profiling_data_kind_t data_kind, int *num_entries,
+            uint64_t *data) const {
+        if (!num_entries) return status::invalid_arguments;
+        std::lock_guard<std::mutex> guard(m_);
+        if (!data) {
+            *num_entries = static_cast<int>(entries_.size());
+            return status::success;
+        }
+
+        for (size_t i = 0; i < entries_.size(); i++) {
+            const auto &e = entries_[i];
+            switch ((int)data_kind) {
+                case profiling_data_kind::time:
+                    data[i] = e.end_nsec - e.start_nsec;
+                    break;
+                case profiling_data_kind::start_time:
+                    data[i] = e.start_nsec;
+                    break;
+                case profiling_data_kind::end_time:
+                    data[i] = e.end_nsec;
+                    break;
+                case profiling_data_kind::thread_id:
+                    data[i] = e.thread_id;
+                    break;
+                default: return status::unimplemented;
+            }
+        }
+        return status::success;
+    }
+
+private:
+    mutable std::mutex m_;
+    std::vector<entry_t> entries_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/nstl.hpp"
+
+#include "cpu/cpu_stream_scheduler.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+// The scheduler whose task the calling thread runs, if any
+thread_local const cpu_stream_scheduler_t *current_scheduler = nullptr;
+} // namespace
+
+cpu_stream_scheduler_t::cpu_stream_scheduler_t(int nworkers) {
+    nworkers = nstl::max(1, nworkers);
+    const int team_nthr = nstl::max(1, dnnl_get_max_threads() / nworkers);
+    workers_.reserve(nworkers);
+    for (int i = 0; i < nworkers; i++)
+        workers_.emplace_back([this, team_nthr]() { worker_loop(team_nthr); });
+}
+
+cpu_stream_scheduler_t::~cpu_stream_scheduler_t() {
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    ready_cv_.notify_all();
+    for (auto &w : workers_)
+        w.join();
+}
+
+int cpu_stream_scheduler_t::get_default_nworkers() {
+    static const int nworkers
+            = nstl::max(1, getenv_int_user("CPU_STREAM_OOO_TEAMS", 2));
+    return nworkers;
+}
+
+bool cpu_stream_scheduler_t::depends_on(
+        const task_t &task, const task_t &prev) {
+    if (task.is_barrier || prev.is_barrier) return true;
+    for (const auto &r : task.ranges)
+        for (const auto &p : prev.ranges) {
+            if (!r.is_write && !p.is_write) continue;
+            if (r.begin < p.end && p.begin < r.end) return true;
+        }
+    return false;
+}
+
+void cpu_stream_scheduler_t::submit(
+        const exec_args_t &args, task_func_t &&func) {
+    std::unique_ptr<task_t> task(new task_t);
+    task->func = std::move(func);
+    for (const auto &arg : args) {
+        const memory_t *mem = arg.second.mem();
+        if (!mem) continue;
+        const memory_desc_wrapper mdw(mem->md());
+        for (int i = 0; i < (int)mem->get_num_handles(); i++) {
+            void *handle = nullptr;
+            mem->get_data_handle(&handle, i);
+            if (!handle) continue;
+            const uintptr_t begin = reinterpret_cast<uintptr_t>(handle);
+            const size_t size = nstl::max(size_t(1), mdw.size(i));
+            const bool is_write = !arg.second.is_const();
+            task->ranges.push_back({begin, begin + size, is_write});
+        }
+    }
+    enqueue(std::move(task));
+}
+
+void cpu_stream_scheduler_t::submit_barrier() {
+    std::unique_ptr<task_t> task(new task_t);
+    task->is_barrier = true;
+    enqueue(std::move(task));
+}
+
+void cpu_stream_scheduler_t::enqueue(std::unique_ptr<task_t> &&task) {
+    task_t *t = task.get();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &prev : pending_) {
+            if (!depends_on(*t, *prev)) continue;
+            prev->dependents.push_back(t);
+            t->ndeps++;
+        }
+        pending_.push_back(std::move(task));
+        t->it = std::prev(pending_.end());
+        if (t->ndeps > 0) return;
+        ready_.push_back(t);
+    }
+    ready_cv_.notify_one();
+}
+
+status_t cpu_stream_scheduler_t::wait() {
+    if (current_scheduler == this) return status::success;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [&]() { return pending_.empty(); });
+    const status_t status = status_;
+    status_ = status::success;
+    return status;
+}
+
+void cpu_stream_scheduler_t::worker_loop(int team_nthr) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    omp_set_num_threads(team_nthr);
+#else
+    UNUSED(team_nthr);
+#endif
+    current_scheduler = this;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        ready_cv_.wait(lock, [&]() { return stop_ || !ready_.empty(); });
+        if (ready_.empty()) return;
+        task_t *t = ready_.front();
+        ready_.pop_front();
+
+        if (t->func) {
+            lock.unlock();
+            const status_t status = t->func();
+            // The function is released before the task is done so that the
+            // context it holds is destroyed before wait() returns.
+            t->func = nullptr;
+            lock.lock();
+            if (status != status::success && status_ == status::success)
+                status_ = status;
+        }
+
+        size_t nready = 0;
+        for (task_t *d : t->dependents)
+            if (--d->ndeps == 0) {
+                ready_.push_back(d);
+                nready++;
+            }
+        pending_.erase(t->it);
+        if (nready > 1) ready_cv_.notify_all();
+        if (nready == 1) ready_cv_.notify_one();
+        if (pending_.empty()) done_cv_.notify_all();
+    }
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_STREAM_SCHEDULER_HPP
+#define CPU_CPU_STREAM_SCHEDULER_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Runs the primitive executions of an out-of-order CPU stream on a fixed set
+// of worker threads. An execution starts once the ones it depends on are done:
+// - the earlier executions writing memory it accesses, or reading memory it
+//   writes, the memory being compared by address ranges;
+// - the executions submitted before a barrier.
+// Each worker owns a thread team of the maximum number of threads divided by
+// the number of workers, so that independent executions run side by side on
+// disjoint teams. The teams are only sized with the OpenMP runtime; the other
+// runtimes share their threads between the workers by themselves.
+struct cpu_stream_scheduler_t {
+    using task_func_t = std::function<status_t()>;
+
+    // Creates `nworkers` workers splitting the maximum number of threads of
+    // the calling thread
+    explicit cpu_stream_scheduler_t(int nworkers);
+    // Waits for the submitted executions
+    ~cpu_stream_scheduler_t();
+
+    // Returns the number of workers of a stream, set with
+    // ONEDNN_CPU_STREAM_OOO_TEAMS and 2 by default.
+    static int get_default_nworkers();
+
+    // Submits `func` which accesses the memory of `args`
+    void submit(const exec_args_t &args, task_func_t &&func);
+
+    // Makes the executions submitted next depend on the ones submitted so far
+    void submit_barrier();
+
+    // Waits for the submitted executions and returns the first error they
+    // returned since the previous wait. Returns immediately when called from
+    // an execution of this scheduler, which could otherwise wait for itself.
+    status_t wait();
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_stream_scheduler_t)
+
+private:
+    struct range_t {
+        uintptr_t begin;
+        uintptr_t end;
+        bool is_write;
+    };
+
+    struct task_t {
+        task_func_t func;
+        std::vector<range_t> ranges;
+        bool is_barrier = false;
+        // Number of the tasks this one waits for
+        size_t ndeps = 0;
+        std::vector<task_t *> dependents;
+        std::list<std::unique_ptr<task_t>>::iterator it;
+    };
+
+    static bool depends_on(const task_t &task, const task_t &prev);
+
+    void enqueue(std::unique_ptr<task_t> &&task);
+    void worker_loop(int team_nthr);
+
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable ready_cv_;
+    std::condition_variable done_cv_;
+    // The tasks submitted and not done, in the submission order, protected
+    // by mutex_ as the members below
+    std::list<std::unique_ptr<task_t>> pending_;
+    std::deque<task_t *> ready_;
+    status_t status_ = status::success;
+    bool stop_ = false;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
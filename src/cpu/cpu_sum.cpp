@@ -24,6 +24,9 @@
 #if DNNL_X64
 #include "cpu/x64/jit_uni_xf16_sum.hpp"
 using namespace dnnl::impl::cpu::x64;
+#elif DNNL_AARCH64
+#include "cpu/aarch64/jit_uni_sum.hpp"
+using namespace dnnl::impl::cpu::aarch64;
 #endif
 
 namespace dnnl {
@@ -37,6 +40,7 @@ using namespace dnnl::impl::data_type;
             __VA_ARGS__::pd_t>()),
 #define SUM_INSTANCE_AVX512(...) REG_AVX512_ISA(INSTANCE(__VA_ARGS__))
 #define SUM_INSTANCE_AVX2(...) REG_AVX2_ISA(INSTANCE(__VA_ARGS__))
+#define SUM_INSTANCE_AARCH64(...) DNNL_AARCH64_ONLY(INSTANCE(__VA_ARGS__))
 // clang-format off
 constexpr impl_list_item_t cpu_sum_impl_list[] = REG_SUM_P({
         SUM_INSTANCE_AVX512(jit_xf16_sum_t<bf16, bf16, avx512_core>)
@@ -45,6 +49,11 @@ constexpr impl_list_item_t cpu_sum_impl_list[] = REG_SUM_P({
         SUM_INSTANCE_AVX2(jit_xf16_sum_t<bf16, f32, avx2_vnni_2>)
         SUM_INSTANCE_AVX2(jit_xf16_sum_t<f16, f16, avx2_vnni_2>)
         SUM_INSTANCE_AVX2(jit_xf16_sum_t<f16, f32, avx2_vnni_2>)
+        SUM_INSTANCE_AARCH64(jit_uni_sum_t<bf16, bf16>)
+        SUM_INSTANCE_AARCH64(jit_uni_sum_t<bf16, f32>)
+        SUM_INSTANCE_AARCH64(jit_uni_sum_t<f16, f16>)
+        SUM_INSTANCE_AARCH64(jit_uni_sum_t<f16, f32>)
+        SUM_INSTANCE_AARCH64(jit_uni_sum_t<f32, f32>)
         INSTANCE(simple_sum_t<f16>)
         INSTANCE(simple_sum_t<f16, f32>)
         INSTANCE(simple_sum_t<bf16>)
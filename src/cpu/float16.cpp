@@ -22,6 +22,8 @@
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "cpu/x64/jit_avx512_core_fp16cvt.hpp"
 #include "cpu/x64/jit_uni_convert_xf16.hpp"
+#elif DNNL_AARCH64
+#include "cpu/aarch64/jit_uni_convert_xf16.hpp"
 #endif
 
 namespace dnnl {
@@ -54,6 +56,12 @@ void cvt_float_to_float16(float16_t *out, const float *inp, size_t nelems) {
         cvt_ps_to_f16(&p_);
         return;
     }
+#elif DNNL_AARCH64
+    using namespace cpu::aarch64;
+    if (jit_cvt_xf16_t::is_supported(data_type::f32, data_type::f16)) {
+        static const jit_cvt_xf16_t kernel(data_type::f32, data_type::f16);
+        return kernel(out, inp, nelems);
+    }
 #endif
 
     PRAGMA_OMP_SIMD()
@@ -68,6 +76,12 @@ void cvt_float16_to_float(float *out, const float16_t *inp, size_t nelems) {
         static const jit_cvt_xf16_to_ps_t kernel(data_type::f16, false);
         return kernel(out, inp, nelems);
     }
+#elif DNNL_AARCH64
+    using namespace cpu::aarch64;
+    if (jit_cvt_xf16_t::is_supported(data_type::f16, data_type::f32)) {
+        static const jit_cvt_xf16_t kernel(data_type::f16, data_type::f32);
+        return kernel(out, inp, nelems);
+    }
 #endif
 
     PRAGMA_OMP_SIMD()
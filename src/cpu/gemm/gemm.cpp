@@ -150,6 +150,24 @@ dnnl_status_t extended_sgemm(const char *transa, const char *transb,
     }
 #endif
 
+#if DNNL_PPC64
+#ifdef __MMA__
+    {
+        float *dummy_ao = nullptr;
+        float *dummy_bo = nullptr;
+        auto status = gemm_driver(transa, transb, bias ? "C" : nullptr, M, N, K,
+                alpha, A, lda, dummy_ao, B, ldb, dummy_bo, beta, C, ldc, bias,
+                force_jit_nocopy_gemm);
+        if (status != status::unimplemented) return status;
+    }
+#endif
+#endif
+
+#if DNNL_S390X && DNNL_S390X_VXE
+    return s390x::sgemm(transa, transb, *M, *N, *K, *alpha, A, *lda, B, *ldb,
+            *beta, C, *ldc, bias);
+#endif
+
 #if DNNL_RV64 && defined(DNNL_RISCV_USE_RVV_INTRINSICS)
     return rvv_gemm_f32(
             transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, bias);
@@ -314,7 +332,17 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
             (const bfloat16 *)A, *lda, (const bfloat16 *)B, *ldb, *beta, C,
             *ldc);
     return dnnl_success;
+#elif defined(__MMA__)
+    bfloat16_t *dummy_ao = nullptr;
+    bfloat16_t *dummy_bo = nullptr;
+    float *dummy_co = nullptr;
+    status = gemm_driver(transa, transb, nullptr, M, N, K, alpha, A, lda,
+            dummy_ao, B, ldb, dummy_bo, beta, C, ldc, dummy_co, false);
+    if (status != status::unimplemented) return status;
 #endif
+#elif DNNL_S390X && DNNL_S390X_VXE
+    return s390x::gemm_bf16bf16f32(transa, transb, *M, *N, *K, *alpha, A, *lda,
+            B, *ldb, *beta, C, *ldc);
 #endif
 
     return ref_gemm_bf16bf16f32(
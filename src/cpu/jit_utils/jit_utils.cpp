@@ -17,6 +17,7 @@
 
 #include <mutex>
 
+#include "common/primitive_cache.hpp"
 #include "common/utils.hpp"
 #include "common/verbose.hpp"
 
@@ -109,23 +110,29 @@ void register_jit_code_vtune(const void *code, size_t code_size,
 }
 
 void register_jit_code_linux_perf(const void *code, size_t code_size,
-        const char *code_name, const char *source_file_name) {
+        const char *code_name, const char *source_file_name,
+        bool has_frame_record) {
 #if DNNL_ENABLE_JIT_PROFILING && defined(__linux__)
     unsigned flags = get_jit_profiling_flags();
     if (flags & DNNL_JIT_PROFILE_LINUX_JITDUMP)
-        linux_perf_jitdump_record_code_load(code, code_size, code_name);
+        linux_perf_jitdump_record_code_load(
+                code, code_size, code_name, has_frame_record);
     if (flags & DNNL_JIT_PROFILE_LINUX_PERFMAP)
         linux_perf_perfmap_record_code_load(code, code_size, code_name);
 #else
     UNUSED(code);
     UNUSED(code_size);
     UNUSED(code_name);
+    UNUSED(has_frame_record);
 #endif
     UNUSED(source_file_name);
 }
 
 void register_jit_code(const void *code, size_t code_size,
-        const char *code_name, const char *source_file_name) {
+        const char *code_name, const char *source_file_name,
+        bool has_frame_record) {
+    add_generated_code_size(code_size);
+
     // The #ifdef guards are required to avoid generating a function that only
     // consists of lock and unlock code
 #if DNNL_ENABLE_JIT_PROFILING || DNNL_ENABLE_JIT_DUMP
@@ -142,13 +149,14 @@ void register_jit_code(const void *code, size_t code_size,
     // VTune Profiler does not need a unique name, because it uses
     // unique method_id
     register_jit_code_vtune(code, code_size, code_name, source_file_name);
-    register_jit_code_linux_perf(
-            code, code_size, unique_code_name, source_file_name);
+    register_jit_code_linux_perf(code, code_size, unique_code_name,
+            source_file_name, has_frame_record);
 #else
     UNUSED(code);
     UNUSED(code_size);
     UNUSED(code_name);
     UNUSED(source_file_name);
+    UNUSED(has_frame_record);
 #endif
 }
 
@@ -24,8 +24,13 @@ namespace impl {
 namespace cpu {
 namespace jit_utils {
 
+// `has_frame_record` tells that the code starts by setting up the standard
+// frame record of the platform ABI, in which case unwinding information is
+// reported to the profilers supporting it (only Linux perf jitdump on
+// AArch64 at the moment).
 void register_jit_code(const void *code, size_t code_size,
-        const char *code_name, const char *source_file_name);
+        const char *code_name, const char *source_file_name,
+        bool has_frame_record = false);
 
 }
 } // namespace cpu
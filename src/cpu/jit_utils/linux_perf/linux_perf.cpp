@@ -42,6 +42,7 @@
 #include <ctime>
 
 #include <string>
+#include <vector>
 
 #include "common/utils.hpp"
 #include "common/verbose.hpp"
@@ -72,9 +73,12 @@ public:
         finalize();
     }
 
-    void record_code_load(
-            const void *code, size_t code_size, const char *code_name) {
-        if (is_active()) write_code_load(code, code_size, code_name);
+    void record_code_load(const void *code, size_t code_size,
+            const char *code_name, bool has_frame_record) {
+        if (!is_active()) return;
+        // The unwinding information must precede the code it describes
+        if (has_frame_record) write_unwinding_info(code_size);
+        write_code_load(code, code_size, code_name);
     }
 
 private:
@@ -235,7 +239,11 @@ private:
         h.magic = 0x4A695444; // JITHEADER_MAGIC ('DTiJ')
         h.version = 1;
         h.total_size = sizeof(h);
+#if DNNL_AARCH64
+        h.elf_mach = EM_AARCH64;
+#else
         h.elf_mach = EM_X86_64;
+#endif
         h.pad1 = 0;
         h.pid = getpid();
 
@@ -290,6 +298,94 @@ private:
         return write_or_fail(code, code_size);
     }
 
+    bool write_unwinding_info(size_t code_size) {
+#if DNNL_AARCH64
+        // The .eh_frame describing the frame record set up at the start of
+        // AArch64 kernels:
+        //     stp x29, x30, [sp, #-16]!
+        //     mov x29, sp
+        // perf inject places the .eh_frame right after the code, aligned to
+        // 8 bytes, and the .eh_frame_hdr after it, so the offsets below are
+        // relative to where the code ends up.
+        std::vector<uint8_t> buf;
+        auto put_u8 = [&](uint8_t v) { buf.push_back(v); };
+        auto put_u32 = [&](uint32_t v) {
+            for (int i = 0; i < 4; i++)
+                buf.push_back((uint8_t)(v >> (8 * i)));
+        };
+        // Pads an entry with DW_CFA_nop and fills its length field
+        auto close_entry = [&](size_t entry) {
+            while ((buf.size() - entry) % 8)
+                put_u8(0x00);
+            const uint32_t len = (uint32_t)(buf.size() - entry - 4);
+            for (int i = 0; i < 4; i++)
+                buf[entry + i] = (uint8_t)(len >> (8 * i));
+        };
+        const int64_t code_end = (int64_t)utils::rnd_up(code_size, 8);
+
+        const size_t cie = buf.size();
+        put_u32(0); // length
+        put_u32(0); // CIE id
+        put_u8(1); // version
+        put_u8('z'), put_u8('R'), put_u8(0); // augmentation
+        put_u8(4); // code alignment factor
+        put_u8(0x78); // data alignment factor, -8
+        put_u8(30); // return address register, x30
+        put_u8(1); // augmentation data length
+        put_u8(0x1b); // FDE pointers encoding, DW_EH_PE_pcrel | sdata4
+        put_u8(0x0c), put_u8(31), put_u8(0); // DW_CFA_def_cfa sp, 0
+        close_entry(cie);
+
+        const size_t fde = buf.size();
+        put_u32(0); // length
+        put_u32((uint32_t)(buf.size() - cie)); // CIE pointer
+        put_u32((uint32_t)(-(code_end + (int64_t)buf.size()))); // code start
+        put_u32((uint32_t)code_size); // code range
+        put_u8(0); // augmentation data length
+        put_u8(0x40 | 1); // DW_CFA_advance_loc past stp
+        put_u8(0x0e), put_u8(16); // DW_CFA_def_cfa_offset 16
+        put_u8(0x80 | 29), put_u8(2); // DW_CFA_offset x29, cfa - 16
+        put_u8(0x80 | 30), put_u8(1); // DW_CFA_offset x30, cfa - 8
+        put_u8(0x40 | 1); // DW_CFA_advance_loc past mov
+        put_u8(0x0d), put_u8(29); // DW_CFA_def_cfa_register x29
+        close_entry(fde);
+        put_u32(0); // terminator
+
+        const int64_t eh_frame_size = (int64_t)buf.size();
+        put_u8(1); // version
+        put_u8(0x1b); // eh_frame_ptr encoding, DW_EH_PE_pcrel | sdata4
+        put_u8(0x03); // fde_count encoding, DW_EH_PE_udata4
+        put_u8(0x3b); // table encoding, DW_EH_PE_datarel | sdata4
+        put_u32((uint32_t)(-(eh_frame_size + 4))); // eh_frame_ptr
+        put_u32(1); // fde_count
+        put_u32((uint32_t)(-(code_end + eh_frame_size))); // code start
+        put_u32((uint32_t)(fde - eh_frame_size)); // FDE address
+        const size_t mapped_size = buf.size();
+        while (buf.size() % 8)
+            put_u8(0);
+
+        struct {
+            uint32_t id;
+            uint32_t total_size;
+            uint64_t timestamp;
+            uint64_t unwinding_size;
+            uint64_t eh_frame_hdr_size;
+            uint64_t mapped_size;
+        } u;
+        u.id = 4; // JIT_CODE_UNWINDING_INFO
+        u.total_size = (uint32_t)(sizeof(u) + buf.size());
+        u.timestamp = get_timestamp(use_tsc_);
+        u.unwinding_size = buf.size();
+        u.eh_frame_hdr_size = mapped_size - eh_frame_size;
+        u.mapped_size = mapped_size;
+        write_or_fail(&u, sizeof(u));
+        return write_or_fail(buf.data(), buf.size());
+#else
+        UNUSED(code_size);
+        return true;
+#endif
+    }
+
     void *marker_addr_;
     size_t marker_size_;
     int fd_;
@@ -297,10 +393,10 @@ private:
     bool use_tsc_;
 };
 
-void linux_perf_jitdump_record_code_load(
-        const void *code, size_t code_size, const char *code_name) {
+void linux_perf_jitdump_record_code_load(const void *code, size_t code_size,
+        const char *code_name, bool has_frame_record) {
     static linux_perf_jitdump_t jitdump;
-    jitdump.record_code_load(code, code_size, code_name);
+    jitdump.record_code_load(code, code_size, code_name, has_frame_record);
 }
 
 class linux_perf_jitmap_t {
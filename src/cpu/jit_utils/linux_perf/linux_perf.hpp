@@ -25,8 +25,8 @@ namespace impl {
 namespace cpu {
 namespace jit_utils {
 
-void linux_perf_jitdump_record_code_load(
-        const void *code, size_t code_size, const char *code_name);
+void linux_perf_jitdump_record_code_load(const void *code, size_t code_size,
+        const char *code_name, bool has_frame_record = false);
 
 void linux_perf_perfmap_record_code_load(
         const void *code, size_t code_size, const char *code_name);
@@ -0,0 +1,438 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/matmul/brgemm_grouped_gemm.hpp"
+
+#if DNNL_EXPERIMENTAL_GROUPED_MEMORY && (DNNL_X64 || DNNL_AARCH64)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+namespace {
+#if DNNL_X64
+namespace brg_impl = dnnl::impl::cpu::x64;
+#elif DNNL_AARCH64
+namespace brg_impl = dnnl::impl::cpu::aarch64;
+#endif
+
+// Rows per block; must be a power of two, row tails are split into
+// power-of-two pieces down to a single row.
+constexpr dim_t m_blk_default = 32;
+// Output channels per block. The packed weights block of a thread is
+// K * n_blk elements.
+constexpr dim_t n_blk_default = 64;
+
+// Scales masks of the [G, K, N] weights
+constexpr int wei_qmask_G = 1 << 0;
+constexpr int wei_qmask_N3d = 1 << 2;
+
+// Returns the isa of the kernels for operands of type `dt`, or isa_undef if
+// there is none
+brg_impl::cpu_isa_t get_brgemm_isa(data_type_t dt) {
+    using namespace brg_impl;
+#if DNNL_X64
+    // The AMX kernels are not used here as they need the tiles configured.
+    if (dt == data_type::bf16)
+        return mayiuse(avx512_core_bf16) ? avx512_core_bf16 : isa_undef;
+    if (mayiuse(avx512_core)) return avx512_core;
+    if (mayiuse(avx2)) return avx2;
+    return isa_undef;
+#elif DNNL_AARCH64
+    // The SME brgemm kernel is not used here as it expects packed operands.
+    if (dt != data_type::f32) return isa_undef;
+    if (mayiuse(sve_512)) return sve_512;
+    if (mayiuse(sve_256)) return sve_256;
+    if (mayiuse(sve_128)) return sve_128;
+    return isa_undef;
+#endif
+}
+
+} // namespace
+
+using namespace memory_tracking::names;
+
+status_t brgemm_grouped_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    // Supported configurations: grouped src/dst, dense 3D weights
+    VDISPATCH_MATMUL(src_d.is_grouped_desc() && dst_d.is_grouped_desc(),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(weights_md(0)->ndims == 3, VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    if (memory_desc_wrapper(weights_md(0)).format_any())
+        CHECK(memory_desc_init_by_tag(weights_md_, format_tag::abc));
+    const memory_desc_wrapper wei_d(weights_md(0));
+    VDISPATCH_MATMUL(wei_d.is_plain(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const auto src_dt = src_md()->data_type;
+    VDISPATCH_MATMUL(utils::one_of(src_dt, f32, bf16)
+                    && weights_md(0)->data_type == src_dt,
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(utils::one_of(dst_md()->data_type, f32, bf16),
+            VERBOSE_UNSUPPORTED_DT);
+    if (with_bias()) {
+        if (memory_desc_wrapper(weights_md(1)).format_any())
+            CHECK(memory_desc_init_by_strides(bias_md_, nullptr));
+        const memory_desc_wrapper bia_d(weights_md(1));
+        VDISPATCH_MATMUL(bia_d.data_type() == f32, VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_MATMUL(bia_d.is_dense()
+                        && bia_d.nelems() == wei_d.dims()[0] * wei_d.dims()[2],
+                VERBOSE_UNSUPPORTED_BIAS_CFG);
+    }
+
+    VDISPATCH_MATMUL(
+            attr()->has_default_values(smask_t::scales | smask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+    const auto &po = attr()->post_ops_;
+    for (int i = 0; i < po.len(); ++i)
+        VDISPATCH_MATMUL(po.entry_[i].is_eltwise(), VERBOSE_UNSUPPORTED_POSTOP);
+    const auto &attr_scales = attr()->scales_;
+    VDISPATCH_MATMUL(attr_scales.has_default_values(DNNL_ARG_DST),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS}) {
+        if (attr_scales.has_default_values(arg)) continue;
+        VDISPATCH_MATMUL(attr_scales.get(arg).has_default_groups()
+                        && utils::one_of(attr_scales.get_data_type(arg), f32,
+                                bf16, f16),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+    if (!attr_scales.has_default_values(DNNL_ARG_SRC)) {
+        const int mask = attr_scales.get_mask(DNNL_ARG_SRC);
+        VDISPATCH_MATMUL(utils::one_of(mask, 0, src_qmask_M()),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+    if (!attr_scales.has_default_values(DNNL_ARG_WEIGHTS)) {
+        const int mask = attr_scales.get_mask(DNNL_ARG_WEIGHTS);
+        VDISPATCH_MATMUL((mask & ~(wei_qmask_G | wei_qmask_N3d)) == 0,
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+
+    VDISPATCH_MATMUL(get_brgemm_isa(src_dt) != brg_impl::isa_undef,
+            VERBOSE_UNSUPPORTED_ISA);
+
+    CHECK(init_conf(engine));
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_grouped_t::pd_t::init_conf(engine_t *engine) {
+    const memory_desc_wrapper wei_d(weights_md(0));
+    const auto &ws = wei_d.blocking_desc().strides;
+    VDISPATCH_MATMUL(ws[2] == 1 || ws[1] == 1, VERBOSE_UNSUPPORTED_TAG);
+
+    auto &c = conf_;
+    c.group_count = src_md()->format_desc.sparse_desc.grouped_desc.group_count;
+    VDISPATCH_MATMUL(c.group_count == wei_d.dims()[0],
+            VERBOSE_INCONSISTENT_DIM, "src_groups", (int)c.group_count, "wei",
+            0);
+    c.total_M = src_md()->dims[0];
+    c.K = wei_d.dims()[1];
+    c.N = wei_d.dims()[2];
+
+    c.m_blk = m_blk_default;
+    c.n_blk = nstl::min(c.N, n_blk_default);
+    c.nb_n = utils::div_up(c.N, c.n_blk);
+    c.n_tail = c.N % c.n_blk;
+
+    c.src_dt = src_md()->data_type;
+    c.wei_dt = wei_d.data_type();
+    c.dst_dt = dst_md()->data_type;
+
+    c.wei_trans = ws[2] != 1;
+    c.wei_vnni = c.wei_dt == data_type::bf16;
+    c.use_buffer_c = c.dst_dt != data_type::f32;
+    c.with_bias = with_bias();
+
+    const auto &attr_scales = attr()->scales_;
+    c.with_src_scales = !attr_scales.has_default_values(DNNL_ARG_SRC);
+    c.src_scales_per_m = c.with_src_scales
+            && attr_scales.get_mask(DNNL_ARG_SRC) == src_qmask_M();
+    c.with_wei_scales = !attr_scales.has_default_values(DNNL_ARG_WEIGHTS);
+    const int wei_mask
+            = c.with_wei_scales ? attr_scales.get_mask(DNNL_ARG_WEIGHTS) : 0;
+    c.wei_scales_per_g = wei_mask & wei_qmask_G;
+    c.wei_scales_per_n = wei_mask & wei_qmask_N3d;
+    c.src_scales_dt = attr_scales.get_data_type(DNNL_ARG_SRC);
+    c.wei_scales_dt = attr_scales.get_data_type(DNNL_ARG_WEIGHTS);
+    c.with_eltwise = attr()->post_ops_.len() > 0;
+
+    c.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+status_t brgemm_grouped_t::pd_t::init_brgemm_descs() {
+    using namespace data_type;
+    const auto &c = conf_;
+    const memory_desc_wrapper wei_d(weights_md(0));
+
+    const auto isa = get_brgemm_isa(c.wei_dt);
+    const dim_t ldb
+            = c.pack_wei() ? c.n_blk : wei_d.blocking_desc().strides[1];
+    const dim_t ldc = c.use_buffer_c ? c.n_blk : c.N;
+
+    brg_impl::brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+
+    for (int m_idx = 0; m_idx < max_m_kernels; ++m_idx)
+        for (bool n_tail : {false, true}) {
+            const dim_t M = c.m_blk >> m_idx;
+            const dim_t N = n_tail ? c.n_tail : c.n_blk;
+            if (M == 0 || N == 0) continue;
+
+            auto &brg = brg_descs_[2 * m_idx + static_cast<int>(n_tail)];
+            CHECK(brg_impl::brgemm_desc_init(&brg, isa, brg_impl::brgemm_addr,
+                    c.src_dt, c.wei_dt, false, false,
+                    brg_impl::brgemm_row_major, 1.f, 0.f, c.K, ldb, ldc, M, N,
+                    c.K));
+            CHECK(brg_impl::brgemm_desc_set_attr(&brg, brgattr));
+            CHECK(brg_impl::brgemm_desc_finalize(&brg));
+        }
+
+    return status::success;
+}
+
+void brgemm_grouped_t::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+    if (c.pack_wei())
+        scratchpad.book(key_matmul_wei_trans,
+                c.nthr * c.wei_pack_size() * types::data_type_size(c.wei_dt),
+                1);
+    if (c.use_buffer_c)
+        scratchpad.template book<float>(
+                key_matmul_dst_in_acc_dt, c.nthr * c.m_blk * c.n_blk);
+    scratchpad.template book<dim_t>(
+            key_matmul_grouped_work_offsets, c.group_count + 1);
+}
+
+status_t brgemm_grouped_t::init(engine_t *engine) {
+    const auto &c = pd()->conf_;
+    for (int m_idx = 0; m_idx < pd_t::max_m_kernels; ++m_idx)
+        for (bool n_tail : {false, true}) {
+            const dim_t M = c.m_blk >> m_idx;
+            const dim_t N = n_tail ? c.n_tail : c.n_blk;
+            if (M == 0 || N == 0) continue;
+
+            const int idx = 2 * m_idx + static_cast<int>(n_tail);
+            brg_impl::brgemm_kernel_t *ker = nullptr;
+            CHECK(brg_impl::brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
+            CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        }
+
+    const auto &po = pd()->attr()->post_ops_;
+    for (int i = 0; i < po.len(); ++i)
+        eltwise_po_.emplace_back(po.entry_[i].eltwise);
+    return status::success;
+}
+
+status_t brgemm_grouped_t::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC, 0);
+    const auto src_offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+    const auto wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    const auto src_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    const auto wei_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST, 0);
+    const auto dst_offsets = CTX_OUT_MEM(const int32_t *, DNNL_ARG_DST, 1);
+
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const auto &ws = wei_d.blocking_desc().strides;
+    const size_t src_dt_sz = types::data_type_size(c.src_dt);
+    const size_t wei_dt_sz = types::data_type_size(c.wei_dt);
+    const size_t dst_dt_sz = types::data_type_size(c.dst_dt);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    char *wei_pack_base = c.pack_wei()
+            ? scratchpad.template get<char>(key_matmul_wei_trans)
+            : nullptr;
+    float *buffer_c_base = c.use_buffer_c
+            ? scratchpad.template get<float>(key_matmul_dst_in_acc_dt)
+            : nullptr;
+    // Group g owns the work items [work_off[g], work_off[g + 1]).
+    dim_t *work_off
+            = scratchpad.template get<dim_t>(key_matmul_grouped_work_offsets);
+
+    const auto group_beg = [](const int32_t *off, dim_t g) -> dim_t {
+        return g ? off[g - 1] : 0;
+    };
+
+    work_off[0] = 0;
+    for (dim_t g = 0; g < c.group_count; ++g) {
+        const dim_t src_beg = group_beg(src_offsets, g);
+        const dim_t dst_beg = group_beg(dst_offsets, g);
+        const dim_t M = src_offsets[g] - src_beg;
+        if (src_beg < 0 || M < 0 || src_offsets[g] > c.total_M
+                || dst_beg != src_beg || dst_offsets[g] != src_offsets[g])
+            return status::invalid_arguments;
+        work_off[g + 1] = work_off[g] + utils::div_up(M, c.m_blk) * c.nb_n;
+    }
+    const dim_t work_amount = work_off[c.group_count];
+
+    const bool with_epilogue = c.use_buffer_c || c.with_src_scales
+            || c.with_wei_scales || c.with_bias || c.with_eltwise;
+
+    parallel(c.nthr, [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start == end) return;
+
+        char *wei_pack = c.pack_wei()
+                ? wei_pack_base + ithr * c.wei_pack_size() * wei_dt_sz
+                : nullptr;
+        float *buffer_c = c.use_buffer_c
+                ? buffer_c_base + ithr * c.m_blk * c.n_blk
+                : nullptr;
+        // Expert and output channels block of the packed weights
+        dim_t packed_g = -1, packed_in = -1;
+
+        brg_impl::brgemm_batch_element_t batch;
+
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            // Empty experts own no work items and are skipped by the search.
+            const dim_t g = std::upper_bound(
+                                    work_off, work_off + c.group_count, iwork)
+                    - work_off - 1;
+            const dim_t M_g = src_offsets[g] - group_beg(src_offsets, g);
+            const dim_t nb_m = utils::div_up(M_g, c.m_blk);
+            const dim_t in = (iwork - work_off[g]) / nb_m;
+            const dim_t im = (iwork - work_off[g]) % nb_m;
+
+            const dim_t n_start = in * c.n_blk;
+            const dim_t N = nstl::min(c.n_blk, c.N - n_start);
+            const bool is_n_tail = N < c.n_blk;
+
+            const char *wei_blk
+                    = wei + (g * ws[0] + n_start * ws[2]) * wei_dt_sz;
+            if (c.pack_wei()) {
+                if (g != packed_g || in != packed_in) {
+                    if (c.wei_vnni) {
+                        const auto *w = reinterpret_cast<const bfloat16_t *>(
+                                wei_blk);
+                        auto *p = reinterpret_cast<bfloat16_t *>(wei_pack);
+                        // Pairs of consecutive k are interleaved, with a
+                        // zero pair member past an odd K.
+                        for_(dim_t k = 0; k < c.K; ++k)
+                        for (dim_t n = 0; n < N; ++n)
+                            p[(k / 2 * c.n_blk + n) * 2 + k % 2]
+                                    = w[k * ws[1] + n * ws[2]];
+                        if (c.K % 2)
+                            for (dim_t n = 0; n < N; ++n)
+                                p[(c.K / 2 * c.n_blk + n) * 2 + 1] = 0.f;
+                    } else {
+                        const auto *w = reinterpret_cast<const float *>(
+                                wei_blk);
+                        auto *p = reinterpret_cast<float *>(wei_pack);
+                        for_(dim_t k = 0; k < c.K; ++k)
+                        for (dim_t n = 0; n < N; ++n)
+                            p[k * c.n_blk + n] = w[k * ws[1] + n * ws[2]];
+                    }
+                    packed_g = g;
+                    packed_in = in;
+                }
+                wei_blk = wei_pack;
+            }
+
+            const dim_t row_start = group_beg(src_offsets, g) + im * c.m_blk;
+            const dim_t row_end
+                    = nstl::min(row_start + c.m_blk, dim_t(src_offsets[g]));
+
+            // Row tails are split into power-of-two pieces
+            for (dim_t row = row_start; row < row_end;) {
+                const int brg_idx = pd()->get_brg_idx(row_end - row, is_n_tail);
+                const dim_t M = c.m_blk >> (brg_idx / 2);
+
+                char *dst_blk = dst + (row * c.N + n_start) * dst_dt_sz;
+                float *c_blk = c.use_buffer_c
+                        ? buffer_c
+                        : reinterpret_cast<float *>(dst_blk);
+                const dim_t ldc = c.use_buffer_c ? c.n_blk : c.N;
+                batch.ptr.A = src + row * c.K * src_dt_sz;
+                batch.ptr.B = wei_blk;
+                brg_impl::brgemm_kernel_execute(
+                        brg_kernels_[brg_idx].get(), 1, &batch, c_blk);
+
+                if (with_epilogue) {
+                    for (dim_t i = 0; i < M; ++i) {
+                        const float src_scale = c.with_src_scales
+                                ? io::load_float_value(c.src_scales_dt,
+                                        src_scales,
+                                        c.src_scales_per_m ? row + i : 0)
+                                : 1.f;
+                        float *d = c_blk + i * ldc;
+                        for (dim_t n = 0; n < N; ++n) {
+                            float s = src_scale;
+                            if (c.with_wei_scales) {
+                                const dim_t idx
+                                        = (c.wei_scales_per_g ? g : 0)
+                                                * (c.wei_scales_per_n ? c.N
+                                                                      : 1)
+                                        + (c.wei_scales_per_n ? n_start + n
+                                                              : 0);
+                                s *= io::load_float_value(
+                                        c.wei_scales_dt, wei_scales, idx);
+                            }
+                            d[n] *= s;
+                            if (c.with_bias)
+                                d[n] += bias[g * c.N + n_start + n];
+                            for (const auto &e : eltwise_po_)
+                                d[n] = e.compute_scalar(d[n]);
+                        }
+                        if (c.use_buffer_c)
+                            cvt_float_to_bfloat16(
+                                    reinterpret_cast<bfloat16_t *>(dst_blk)
+                                            + i * c.N,
+                                    d, N);
+                    }
+                }
+                row += M;
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
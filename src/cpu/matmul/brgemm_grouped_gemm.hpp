@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_BRGEMM_GROUPED_GEMM_HPP
+#define CPU_MATMUL_BRGEMM_GROUPED_GEMM_HPP
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#include "cpu/platform.hpp"
+
+#if DNNL_EXPERIMENTAL_GROUPED_MEMORY && (DNNL_X64 || DNNL_AARCH64)
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/brgemm/brgemm.hpp"
+#elif DNNL_AARCH64
+#include "cpu/aarch64/brgemm/brgemm.hpp"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+namespace grouped_brgemm {
+#if DNNL_X64
+using brgemm_desc_t = x64::brgemm_desc_t;
+using brgemm_kernel_t = x64::brgemm_kernel_t;
+#elif DNNL_AARCH64
+using brgemm_desc_t = aarch64::brgemm_desc_t;
+using brgemm_kernel_t = aarch64::brgemm_kernel_t;
+#endif
+} // namespace grouped_brgemm
+
+struct brgemm_grouped_conf_t {
+    dim_t group_count, total_M, K, N;
+
+    dim_t m_blk, n_blk;
+    dim_t nb_n, n_tail;
+
+    data_type_t src_dt, wei_dt, dst_dt;
+
+    // Weights are given as [G, N, K] in memory and every N block of an
+    // expert is copied into a [K, n_blk] scratchpad buffer before use
+    bool wei_trans;
+    // bf16 weights blocks are copied into a [K / 2, n_blk, 2] scratchpad
+    // buffer, with K padded to even, as the kernels expect
+    bool wei_vnni;
+    // The kernels write a [m_blk, n_blk] f32 buffer of the thread rather
+    // than dst, which is then written with the scales, bias and post-ops
+    bool use_buffer_c;
+    bool with_bias;
+    // Scales are common or per row for src, and common, per expert or per
+    // expert and output channel for weights
+    bool with_src_scales, src_scales_per_m;
+    bool with_wei_scales, wei_scales_per_g, wei_scales_per_n;
+    data_type_t src_scales_dt, wei_scales_dt;
+    bool with_eltwise;
+
+    int nthr;
+
+    bool pack_wei() const { return wei_trans || wei_vnni; }
+    // Elements of a packed weights block
+    dim_t wei_pack_size() const { return utils::rnd_up(K, 2) * n_blk; }
+};
+
+/// Grouped (Mixture-of-Experts) matmul based on brgemm kernels.
+///
+/// The rows of every expert are split into blocks of m_blk rows, and a work
+/// item is one row block of one expert for one block of output channels.
+/// Work items of all the experts are balanced across threads together, so a
+/// few heavily loaded experts do not serialize the computation. Row blocks
+/// are the innermost work dimension, so consecutive work items of a thread
+/// share, and reuse, the same weights block. Row tails are computed with
+/// kernels for power-of-two row counts, so experts with a handful of tokens
+/// are not padded.
+///
+/// f32 and, on x64 with avx512_core_bf16, bf16 src and weights are
+/// supported, with f32 or bf16 dst. Eltwise post-ops are applied with the
+/// scales and the bias once a block is computed.
+struct brgemm_grouped_t : public primitive_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("brg_grouped:any", brgemm_grouped_t);
+
+        status_t init(engine_t *engine);
+
+        // Number of kernels with distinct row counts: m_blk, m_blk / 2, ...,
+        // 1 rows
+        static constexpr int max_m_kernels = 6;
+
+        // Kernel index for a (row count, output channels tail) combination
+        int get_brg_idx(dim_t M, bool n_tail) const {
+            int m_idx = 0;
+            for (dim_t m = conf_.m_blk; m > M; m /= 2)
+                m_idx++;
+            return 2 * m_idx + static_cast<int>(n_tail);
+        }
+
+        brgemm_grouped_conf_t conf_ {};
+        grouped_brgemm::brgemm_desc_t brg_descs_[2 * max_m_kernels];
+
+    private:
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_grouped_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<grouped_brgemm::brgemm_kernel_t>
+            brg_kernels_[2 * pd_t::max_m_kernels];
+    std::vector<ref_eltwise_scalar_fwd_t> eltwise_po_;
+};
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -22,6 +22,7 @@
 #include "cpu/matmul/gemm_f32_matmul.hpp"
 #include "cpu/matmul/gemm_x8s8s32x_matmul.hpp"
 #if DNNL_EXPERIMENTAL_GROUPED_MEMORY
+#include "cpu/matmul/brgemm_grouped_gemm.hpp"
 #include "cpu/matmul/ref_grouped_gemm.hpp"
 #endif
 #include "cpu/matmul/ref_matmul.hpp"
@@ -35,6 +36,7 @@ using namespace dnnl::impl::cpu::x64::matmul;
 using namespace dnnl::impl::cpu::x64;
 #elif DNNL_AARCH64
 #include "cpu/aarch64/matmul/brgemm_matmul.hpp"
+#include "cpu/aarch64/matmul/brgemm_sparse_matmul.hpp"
 #include "cpu/aarch64/matmul/jit_bf16_matmul.hpp"
 #include "cpu/aarch64/matmul/jit_int8_matmul.hpp"
 #ifdef DNNL_AARCH64_USE_ACL
@@ -93,7 +95,10 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE(ref_matmul_t)
         CPU_INSTANCE(ref_matmul_int8_t)
         CPU_INSTANCE_X64(jit_uni_sparse_matmul_t)
+        CPU_INSTANCE_AARCH64(brgemm_sparse_matmul_t)
         CPU_INSTANCE(ref_sparse_matmul_t)
+        CPU_INSTANCE_GROUPED_X64(brgemm_grouped_t)
+        CPU_INSTANCE_GROUPED_AARCH64(brgemm_grouped_t)
         CPU_INSTANCE_GROUPED(ref_grouped_t)
         /* eol */
         nullptr,
@@ -34,6 +34,7 @@
 #include "cpu/x64/cpu_isa_traits.hpp"
 #elif DNNL_AARCH64
 #include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/cpu_topology.hpp"
 #if defined(DNNL_AARCH64_USE_ACL)
 // For checking if fp16 isa is supported on the platform
 #include "arm_compute/core/CPP/CPPTypes.h"
@@ -224,6 +225,9 @@ uint32_t get_num_sets_in_cache(int level) {
         return num_sets;
     } else
         return 0;
+#elif DNNL_AARCH64
+    const auto &cache = aarch64::cpu_topology::get_cache_info(level);
+    return cache.sets > 0 ? cache.sets : guess(level);
 #else
     return guess(level);
 #endif
@@ -255,6 +259,9 @@ uint32_t get_num_ways_in_cache(int level) {
     } else
         return 0;
 
+#elif DNNL_AARCH64
+    const auto &cache = aarch64::cpu_topology::get_cache_info(level);
+    return cache.ways > 0 ? cache.ways : guess(level);
 #else
     return guess(level);
 #endif
@@ -280,6 +287,15 @@ unsigned get_per_core_cache_size(int level) {
     } else
         return 0;
 #elif DNNL_AARCH64
+    // The caches described by Linux, from the ACPI PPTT or the devicetree,
+    // come first: unlike the ID registers read by Xbyak_aarch64 they include
+    // the system level caches shared by all the cores.
+    if (aarch64::cpu_topology::get_cache_info(1).size > 0) {
+        const auto &cache = aarch64::cpu_topology::get_cache_info(level);
+        return static_cast<unsigned>(
+                cache.size / get_num_cores_sharing_cache(level));
+    }
+
     const auto num_caches
             = static_cast<int>(aarch64::cpu().getLastDataCacheLevel());
 
@@ -299,6 +315,33 @@ unsigned get_per_core_cache_size(int level) {
 #endif
 }
 
+unsigned get_num_cores_sharing_cache(int level) {
+#if DNNL_X64
+    using namespace x64;
+    if (level > 0 && (unsigned)level <= cpu().getDataCacheLevels())
+        return nstl::max(1u, cpu().getCoresSharingDataCache(level - 1));
+    return 1;
+#elif DNNL_AARCH64
+    const auto &cache = aarch64::cpu_topology::get_cache_info(level);
+    if (cache.size > 0)
+        return static_cast<unsigned>(nstl::max(1,
+                cache.sharing_cpus
+                        / aarch64::cpu_topology::get_threads_per_core()));
+
+    const auto num_caches
+            = static_cast<int>(aarch64::cpu().getLastDataCacheLevel());
+    if (level > 0 && level <= num_caches) {
+        const auto &cache_level
+                = static_cast<Xbyak_aarch64::util::Arm64CacheLevel>(level);
+        return nstl::max(
+                1u, aarch64::cpu().getCoresSharingDataCache(cache_level));
+    }
+    return 1;
+#else
+    return 1;
+#endif
+}
+
 unsigned get_num_cores() {
 #if DNNL_X64
     return x64::cpu().getNumCores(Xbyak::util::CoreLevel);
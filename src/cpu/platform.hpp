@@ -1,6 +1,6 @@
 /*******************************************************************************
 * Copyright 2020 Intel Corporation
-* Copyright 2020 Arm Ltd. and affiliates
+* Copyright 2020, 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -182,6 +182,9 @@ float DNNL_API s8s8_weights_scale_factor();
 unsigned DNNL_API get_per_core_cache_size(int level);
 uint32_t get_num_ways_in_cache(int level);
 uint32_t get_num_sets_in_cache(int level);
+// Returns the number of cores sharing the data or unified cache of `level`,
+// at least 1.
+unsigned get_num_cores_sharing_cache(int level);
 unsigned DNNL_API get_num_cores();
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 unsigned DNNL_API get_max_threads_to_use();
@@ -202,7 +205,7 @@ static constexpr bool is_ppc64() {
 #endif
 }
 
-size_t get_timestamp();
+size_t DNNL_API get_timestamp();
 
 } // namespace platform
 
@@ -24,6 +24,7 @@
 #include <iostream>
 #include <vector>
 
+#include "common/bfloat16.hpp"
 #include "common/dnnl_traits.hpp"
 #include "common/nstl.hpp"
 #include "common/utils.hpp"
@@ -1587,6 +1588,229 @@ template // Instantiate gemm_s8u8s32
                 const float *beta, int32_t *c, const dim_t *ldc,
                 const int32_t *oc, const bool force_nocopy, pack_type packing,
                 gemm_pack_storage_t *pack_dst, bool measure_only);
+// Floating-point gemm on the POWER10 MMA unit. C is computed by 16x8 tiles
+// held in the eight accumulators, the rows of a tile being four vectors of
+// op(A) (m) and its columns two vectors of op(B) (n). op(A) and op(B) are
+// packed per cache block in the order the ger instructions consume them:
+// k-major panels of 16 rows of op(A) and 8 columns of op(B), with the k pairs
+// of bf16 interleaved for xvbf16ger2pp. The thread grid is the same 2D
+// partitioning as the int8 driver.
+namespace {
+
+constexpr dim_t mma_um = 16, mma_un = 8;
+constexpr dim_t mma_mc = 128, mma_nc = 256, mma_kc = 256;
+
+typedef __vector float vec_f32_t;
+
+template <typename data_t>
+struct mma_traits_t;
+
+template <>
+struct mma_traits_t<float> {
+    static constexpr dim_t k_step = 1;
+    static void ger(__vector_quad *acc, vec_t b, vec_t a) {
+        __builtin_mma_xvf32gerpp(acc, b, a);
+    }
+};
+
+template <>
+struct mma_traits_t<bfloat16_t> {
+    static constexpr dim_t k_step = 2;
+    static void ger(__vector_quad *acc, vec_t b, vec_t a) {
+        __builtin_mma_xvbf16ger2pp(acc, b, a);
+    }
+};
+
+// Packs rows [0, len) and k [0, k_len) of a matrix in panels of `blk` rows,
+// padded with zeros to `blk` rows and `k_pad` k. The element (r, k) is at
+// x[r * r_stride + k * k_stride].
+template <typename data_t>
+void mma_pack(data_t *dst, const data_t *x, dim_t r_stride, dim_t k_stride,
+        dim_t len, dim_t k_len, dim_t k_pad, dim_t blk) {
+    constexpr dim_t ks = mma_traits_t<data_t>::k_step;
+    const data_t zero = 0.f;
+    for (dim_t r0 = 0; r0 < len; r0 += blk)
+        for (dim_t k0 = 0; k0 < k_pad; k0 += ks)
+            for (dim_t r = r0; r < r0 + blk; r++)
+                for (dim_t kk = k0; kk < k0 + ks; kk++)
+                    *dst++ = (r < len && kk < k_len)
+                            ? x[r * r_stride + kk * k_stride]
+                            : zero;
+}
+
+// C(0:m_len, 0:n_len) = alpha * acc + beta * C for one 4x4 accumulator, the
+// accumulator rows being the columns of C.
+void mma_save_acc(__vector_quad *acc, float *c, dim_t ldc, float alpha,
+        float beta, dim_t m_len, dim_t n_len) {
+    if (m_len <= 0 || n_len <= 0) return;
+    vec_f32_t res[4];
+    __builtin_mma_disassemble_acc((void *)res, acc);
+    const vec_f32_t valpha = vec_splats(alpha);
+    const vec_f32_t vbeta = vec_splats(beta);
+    for (dim_t i = 0; i < nstl::min(n_len, dim_t(4)); i++) {
+        float *cc = c + i * ldc;
+        if (m_len >= 4) {
+            vec_f32_t r = valpha * res[i];
+            if (beta != 0.f) r += vbeta * vec_xl(0, cc);
+            vec_xst(r, 0, cc);
+        } else {
+            for (dim_t j = 0; j < m_len; j++)
+                cc[j] = alpha * res[i][j] + (beta != 0.f ? beta * cc[j] : 0.f);
+        }
+    }
+}
+
+template <typename data_t>
+void mma_tile(dim_t k_pad, const data_t *ap, const data_t *bp, float *c,
+        dim_t ldc, float alpha, float beta, dim_t m_len, dim_t n_len) {
+    using traits = mma_traits_t<data_t>;
+    constexpr dim_t ks = traits::k_step;
+    constexpr dim_t vlen = 16 / sizeof(data_t);
+
+    __vector_quad acc0, acc1, acc2, acc3, acc4, acc5, acc6, acc7;
+    SET_ACC_ZERO8();
+    for (dim_t k = 0; k < k_pad; k += ks) {
+        const data_t *pa = ap + k * mma_um;
+        const data_t *pb = bp + k * mma_un;
+        const vec_t a0 = *(const vec_t *)(pa + 0 * vlen);
+        const vec_t a1 = *(const vec_t *)(pa + 1 * vlen);
+        const vec_t a2 = *(const vec_t *)(pa + 2 * vlen);
+        const vec_t a3 = *(const vec_t *)(pa + 3 * vlen);
+        const vec_t b0 = *(const vec_t *)(pb + 0 * vlen);
+        const vec_t b1 = *(const vec_t *)(pb + 1 * vlen);
+        traits::ger(&acc0, b0, a0);
+        traits::ger(&acc1, b0, a1);
+        traits::ger(&acc2, b0, a2);
+        traits::ger(&acc3, b0, a3);
+        traits::ger(&acc4, b1, a0);
+        traits::ger(&acc5, b1, a1);
+        traits::ger(&acc6, b1, a2);
+        traits::ger(&acc7, b1, a3);
+    }
+
+    mma_save_acc(&acc0, c, ldc, alpha, beta, m_len, n_len);
+    mma_save_acc(&acc1, c + 4, ldc, alpha, beta, m_len - 4, n_len);
+    mma_save_acc(&acc2, c + 8, ldc, alpha, beta, m_len - 8, n_len);
+    mma_save_acc(&acc3, c + 12, ldc, alpha, beta, m_len - 12, n_len);
+    c += 4 * ldc;
+    mma_save_acc(&acc4, c, ldc, alpha, beta, m_len, n_len - 4);
+    mma_save_acc(&acc5, c + 4, ldc, alpha, beta, m_len - 4, n_len - 4);
+    mma_save_acc(&acc6, c + 8, ldc, alpha, beta, m_len - 8, n_len - 4);
+    mma_save_acc(&acc7, c + 12, ldc, alpha, beta, m_len - 12, n_len - 4);
+}
+
+template <typename data_t>
+dnnl_status_t mma_gemm_driver(const char *transA, const char *transB,
+        const char *offsetC, dim_t m, dim_t n, dim_t k, float alpha,
+        const data_t *a, dim_t lda, const data_t *b, dim_t ldb, float beta,
+        float *c, dim_t ldc, const float *co) {
+    constexpr dim_t ks = mma_traits_t<data_t>::k_step;
+    if (m <= 0 || n <= 0) return dnnl_success;
+    // Only the column offset, which extended_sgemm uses for the bias
+    if (offsetC != nullptr && !utils::one_of(*offsetC, 'C', 'c'))
+        return dnnl_unimplemented;
+
+    const bool trans_a = utils::one_of(*transA, 't', 'T');
+    const bool trans_b = utils::one_of(*transB, 't', 'T');
+    // (row, k) strides of op(A) and (column, k) strides of op(B)
+    const dim_t a_r_stride = trans_a ? lda : 1;
+    const dim_t a_k_stride = trans_a ? 1 : lda;
+    const dim_t b_r_stride = trans_b ? 1 : ldb;
+    const dim_t b_k_stride = trans_b ? ldb : 1;
+
+    int nthr = (m * n * k < 64 * 64 * 64) ? 1 : dnnl_get_max_threads();
+    int nthr_m = 1, nthr_n = 1;
+    std::tie(nthr_m, nthr_n) = partition_2d_minblk(m, n, mma_mc, mma_nc,
+            mma_um, mma_un, mma_um, mma_un, nthr, true);
+    nthr = nthr_m * nthr_n;
+
+    const dim_t kc_pad = utils::rnd_up(nstl::min(k, mma_kc), ks);
+    const dim_t a_buf_sz = mma_mc * kc_pad;
+    const dim_t b_buf_sz = utils::rnd_up(nstl::min(n, mma_nc), mma_un) * kc_pad;
+    const dim_t thr_buf_sz = utils::rnd_up(a_buf_sz + b_buf_sz, 64);
+    data_t *buf = nullptr;
+    if (thr_buf_sz > 0) {
+        buf = (data_t *)malloc(sizeof(data_t) * thr_buf_sz * nthr, 128);
+        if (!buf) return dnnl_out_of_memory;
+    }
+
+    parallel(nthr, [&](int ithr, int) {
+        const int ithr_m = ithr % nthr_m;
+        const int ithr_n = ithr / nthr_m;
+        int nthr_eff = nthr;
+        dim_t m_off = 0, m_band = 0, n_off = 0, n_band = 0;
+        partition_2d(ithr, &nthr_eff, ithr_m, ithr_n, nthr_m, nthr_n, m, n,
+                m_off, m_band, n_off, n_band);
+        if (m_band <= 0 || n_band <= 0) return;
+
+        data_t *a_buf = buf + ithr * thr_buf_sz;
+        data_t *b_buf = a_buf + a_buf_sz;
+        for (dim_t jc = 0; jc < n_band; jc += mma_nc) {
+            const dim_t nb = nstl::min(mma_nc, n_band - jc);
+            // k == 0 still takes one pass to apply beta
+            for (dim_t pc = 0; pc == 0 || pc < k; pc += mma_kc) {
+                const dim_t kb = nstl::min(mma_kc, k - pc);
+                const dim_t kp = utils::rnd_up(kb, ks);
+                const float beta_blk = pc == 0 ? beta : 1.f;
+                mma_pack(b_buf,
+                        b + (n_off + jc) * b_r_stride + pc * b_k_stride,
+                        b_r_stride, b_k_stride, nb, kb, kp, mma_un);
+                for (dim_t ic = 0; ic < m_band; ic += mma_mc) {
+                    const dim_t mb = nstl::min(mma_mc, m_band - ic);
+                    mma_pack(a_buf,
+                            a + (m_off + ic) * a_r_stride + pc * a_k_stride,
+                            a_r_stride, a_k_stride, mb, kb, kp, mma_um);
+                    for (dim_t jr = 0; jr < nb; jr += mma_un)
+                        for (dim_t ir = 0; ir < mb; ir += mma_um)
+                            mma_tile(kp, a_buf + ir * kp, b_buf + jr * kp,
+                                    c + (m_off + ic + ir)
+                                            + (n_off + jc + jr) * ldc,
+                                    ldc, alpha, beta_blk,
+                                    nstl::min(mma_um, mb - ir),
+                                    nstl::min(mma_un, nb - jr));
+                }
+            }
+        }
+
+        if (offsetC != nullptr && co != nullptr) {
+            for (dim_t j = n_off; j < n_off + n_band; j++)
+                for (dim_t i = m_off; i < m_off + m_band; i++)
+                    c[i + j * ldc] += co[i];
+        }
+    });
+
+    free(buf);
+    return dnnl_success;
+}
+
+} // namespace
+
+dnnl_status_t gemm_driver(const char *transA, const char *transB,
+        const char *offsetC, const dim_t *m, const dim_t *n, const dim_t *k,
+        const float *alpha, const float *a, const dim_t *lda, const float *oa,
+        const float *b, const dim_t *ldb, const float *ob, const float *beta,
+        float *c, const dim_t *ldc, const float *oc,
+        const bool force_jit_nocopy_gemm) {
+    UNUSED(oa);
+    UNUSED(ob);
+    UNUSED(force_jit_nocopy_gemm);
+    return mma_gemm_driver(transA, transB, offsetC, *m, *n, *k, *alpha, a,
+            *lda, b, *ldb, *beta, c, *ldc, oc);
+}
+
+dnnl_status_t gemm_driver(const char *transA, const char *transB,
+        const char *offsetC, const dim_t *m, const dim_t *n, const dim_t *k,
+        const float *alpha, const bfloat16_t *a, const dim_t *lda,
+        const bfloat16_t *oa, const bfloat16_t *b, const dim_t *ldb,
+        const bfloat16_t *ob, const float *beta, float *c, const dim_t *ldc,
+        const float *oc, const bool force_jit_nocopy_gemm) {
+    UNUSED(oa);
+    UNUSED(ob);
+    UNUSED(force_jit_nocopy_gemm);
+    return mma_gemm_driver(transA, transB, offsetC, *m, *n, *k, *alpha, a,
+            *lda, b, *ldb, *beta, c, *ldc, oc);
+}
+
 #undef MAX_STACK_SZ
 } // namespace ppc64
 } // namespace cpu
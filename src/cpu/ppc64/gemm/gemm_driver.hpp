@@ -17,6 +17,7 @@
 #ifndef CPU_PPC64_GEMM_GEMM_DRIVER_HPP
 #define CPU_PPC64_GEMM_GEMM_DRIVER_HPP
 
+#include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "oneapi/dnnl/dnnl_types.h"
@@ -38,6 +39,22 @@ dnnl_status_t gemm_driver(const char *transA, const char *transB,
         const bool force_jit_nocopy_gemm, pack_type packing = pack_type::none,
         gemm_pack_storage_t *pack_dst = NULL, bool measure_only = false);
 
+// f32 and bf16 gemm on the MMA unit. Only the column offset (bias) form of
+// offsetC is supported.
+dnnl_status_t gemm_driver(const char *transA, const char *transB,
+        const char *offsetC, const dim_t *m, const dim_t *n, const dim_t *k,
+        const float *alpha, const float *a, const dim_t *lda, const float *oa,
+        const float *b, const dim_t *ldb, const float *ob, const float *beta,
+        float *c, const dim_t *ldc, const float *oc,
+        const bool force_jit_nocopy_gemm);
+
+dnnl_status_t gemm_driver(const char *transA, const char *transB,
+        const char *offsetC, const dim_t *m, const dim_t *n, const dim_t *k,
+        const float *alpha, const bfloat16_t *a, const dim_t *lda,
+        const bfloat16_t *oa, const bfloat16_t *b, const dim_t *ldb,
+        const bfloat16_t *ob, const float *beta, float *c, const dim_t *ldc,
+        const float *oc, const bool force_jit_nocopy_gemm);
+
 void prep_ref_gemm_s8u8s32_pack(
         bool do_a, dim_t rows, dim_t cols, gemm_pack_storage_t *pack_dst);
 
@@ -309,6 +309,35 @@ float ref_dropout(float src, uint8_t *mask, dim_t idx, float p, int64_t seed,
     return (m) ? src * inv_q : 0;
 }
 
+dropout_args_t get_dropout_args(
+        const exec_ctx_t &ctx, const dropout_t &dropout) {
+    const auto dropout_p
+            = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_DROPOUT_PROBABILITY);
+    const auto dropout_seed
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_DROPOUT_SEED);
+    const auto dropout_offset
+            = CTX_IN_MEM(const int64_t *, DNNL_ARG_ATTR_DROPOUT_OFFSET);
+
+    const float p = dropout_p[0];
+    const uint64_t seed
+            = io::load_int64_value(dropout.seed_dt_, dropout_seed, 0);
+    const uint64_t offset = dropout.use_offset_ ? dropout_offset[0] : 0;
+
+    dropout_args_t args;
+    args.seed[0] = uint32_t(seed);
+    args.seed[1] = uint32_t(seed >> 32);
+    args.offset[0] = uint32_t(offset);
+    args.offset[1] = uint32_t(offset >> 32);
+    args.use_offset = offset != 0;
+    // `r > max * p` holds for an integer `r` iff `r > floor(max * p)`. A NaN
+    // probability keeps nothing, like the comparison in `ref_dropout(...)`.
+    const uint32_t max = std::numeric_limits<uint32_t>::max();
+    const double thr = double(max) * std::max(std::min(p, 1.f), 0.f);
+    args.threshold = std::isnan(thr) ? max : uint32_t(thr);
+    args.inv_q = (p != 1.f) ? 1.f / (1.f - p) : 0.f;
+    return args;
+}
+
 void ref_post_ops_t::execute(float &res, const args_t &args) const {
     if (po_.len() == 0) return;
 
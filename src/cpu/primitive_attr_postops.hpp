@@ -113,6 +113,23 @@ private:
 float ref_dropout(float src, uint8_t *mask, dim_t idx, float p, int64_t seed,
         int64_t offset);
 
+// Runtime arguments of dropout for the jit implementations, which generate the
+// same random values as `ref_dropout(...)`. An element is kept when its random
+// value is greater than `threshold`, the integer equivalent of the comparison
+// to the scaled probability there. The layout is read by the jit injectors.
+struct dropout_args_t {
+    uint32_t seed[2]; // low and high halves
+    uint32_t offset[2]; // low and high halves
+    // Non-zero for a non-zero offset, which selects the generator with 64-bit
+    // counters. The legacy one with 32-bit indices is used otherwise.
+    uint32_t use_offset;
+    uint32_t threshold;
+    float inv_q;
+};
+
+dropout_args_t get_dropout_args(
+        const exec_ctx_t &ctx, const dropout_t &dropout);
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
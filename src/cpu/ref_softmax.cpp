@@ -261,6 +261,27 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
     const bool with_dst_scales
             = !pd()->attr()->scales_.has_default_values(DNNL_ARG_DST);
 
+    // Attention inputs, applied to the source values on load. They imply the
+    // softmax axis is the last dimension, so `ou` enumerates the logical
+    // rows of the source and `inner_size_` is 1.
+    const bool with_attn_inputs = pd()->with_attn_inputs();
+    const bool with_attn_scale = pd()->with_attn_scale();
+    const bool with_attn_mask = pd()->with_attn_mask();
+    const bool invert_scale = pd()->desc()->invert_scale;
+    const memory_desc_wrapper attn_mask_d(pd()->arg_md(DNNL_ARG_ATTN_MASK));
+    const void *attn_mask = with_attn_mask
+            ? CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK)
+            : nullptr;
+    float attn_scale = 1.f;
+    if (with_attn_scale) {
+        const void *scale = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+        attn_scale = io::load_float_value(
+                pd()->arg_md(DNNL_ARG_SCALE)->data_type, scale, 0);
+    }
+    const int ndims = pd()->ndims();
+    const dim_t queries = ndims >= 2 ? src_d.dims()[ndims - 2] : 1;
+    const auto attn_mask_type = pd()->desc()->attn_mask_type;
+
     void *interim_ptr
             = pd()->need_intermediate_scratchpad() ? interim_scratchpad : dst;
     const auto interim_dt = pd()->need_intermediate_scratchpad()
@@ -316,18 +337,48 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
         utils::array_set(space_max, -FLT_MAX, inner_size_);
         utils::array_set(space_denom, 0, inner_size_);
 
+        // The implicit causal mask keeps the first `n_valid` keys of a row.
+        dim_t n_valid = channels_;
+        if (attn_mask_type == attn_mask_type::top_left)
+            n_valid = ou % queries + 1;
+        else if (attn_mask_type == attn_mask_type::bottom_right)
+            n_valid = ou % queries + 1 + channels_ - queries;
+
+        dims_t mask_pos {};
+        if (with_attn_mask) {
+            utils::l_dims_by_l_offset(
+                    mask_pos, ou * channels_, src_d.dims(), ndims);
+            for (int d = 0; d < ndims; d++)
+                if (attn_mask_d.dims()[d] == 1) mask_pos[d] = 0;
+        }
+
+        auto load_src = [&](size_t off, int c) {
+            float s = io::load_float_value(src_d.data_type(), src, off);
+            if (!with_attn_inputs) return s;
+            if (with_attn_scale)
+                s = invert_scale ? s / attn_scale : s * attn_scale;
+            if (with_attn_mask) {
+                if (attn_mask_d.dims()[ndims - 1] != 1)
+                    mask_pos[ndims - 1] = c;
+                s += io::load_float_value(attn_mask_d.data_type(), attn_mask,
+                        attn_mask_d.off_v(mask_pos));
+            }
+            if (c >= n_valid) s = -INFINITY;
+            return s;
+        };
+
         for (int in = 0; in < inner_size_; in++) {
             dim_t ou_in_offset = ou * channels_ * inner_size_ + in;
 
             for (int c = 0; c < channels_; c++) {
                 size_t off = src_d.off_l(ou_in_offset + c * inner_size_);
-                float s = io::load_float_value(src_d.data_type(), src, off);
+                float s = load_src(off, c);
                 space_max[in] = nstl::max(space_max[in], s);
             }
 
             for (int c = 0; c < channels_; c++) {
                 size_t src_off = src_d.off_l(ou_in_offset + c * inner_size_);
-                float s = io::load_float_value(src_d.data_type(), src, src_off);
+                float s = load_src(src_off, c);
                 float d = s - space_max[in];
                 if (pd()->is_softmax()) {
                     d = expf(d);
@@ -156,7 +156,9 @@ struct ref_softmax_fwd_t : public primitive_t {
             if (bd.inner_idxs[iblk] == axis)
                 axis_blk_size *= bd.inner_blks[iblk];
 
-        use_dense_ = inner_size_ == 1 && src_d == dst_d && src_d.is_dense(true)
+        // Attention inputs are applied by the generic path only.
+        use_dense_ = !pd()->with_attn_inputs() && inner_size_ == 1
+                && src_d == dst_d && src_d.is_dense(true)
                 && src_d.only_padded_dim(axis)
                 && bd.strides[axis] == axis_blk_size;
 
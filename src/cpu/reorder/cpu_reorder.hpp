@@ -30,6 +30,7 @@
 
 #include "cpu/cpu_engine.hpp"
 #include "cpu/reorder/cpu_reorder_pd.hpp"
+#include "cpu/reorder/dynamic_quant_reorder.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/jit_uni_reorder.hpp"
@@ -39,12 +40,16 @@
 #include "cpu/aarch64/matmul/brgemm_matmul_reorders.hpp"
 #include "cpu/aarch64/reorder/jit_blk_reorder.hpp"
 #include "cpu/aarch64/reorder/jit_uni_reorder.hpp"
+#include "cpu/aarch64/reorder/jit_uni_reorder_direct_copy.hpp"
+#include "cpu/aarch64/reorder/jit_uni_reorder_low_bit.hpp"
+#include "cpu/aarch64/reorder/jit_uni_reorder_transpose.hpp"
 #if defined(DNNL_AARCH64_USE_ACL)
 #include "cpu/aarch64/reorder/acl_reorder.hpp"
 #endif
 #elif DNNL_PPC64
 #include "cpu/ppc64/ppc64_gemm_reorder.hpp"
 #elif DNNL_RV64
+#include "cpu/rv64/jit_uni_reorder.hpp"
 #ifdef DNNL_RISCV_USE_RVV_INTRINSICS
 #include "cpu/rv64/rvv_gemm_reorder.hpp"
 #endif
@@ -138,8 +143,7 @@ extern const impl_list_map_t &comp_s8_s8_impl_list_map();
 #endif
 
 #define CPU_REORDER_INSTANCE(...) \
-    impl_list_item_t(impl_list_item_t::reorder_type_deduction_helper_t< \
-            __VA_ARGS__::pd_t>()),
+    DNNL_IMPL_LIST_ITEM(reorder_type_deduction_helper_t, __VA_ARGS__),
 
 } // namespace cpu
 } // namespace impl
@@ -23,6 +23,7 @@
 #include "common/reorder_pd.hpp"
 #include "common/utils.hpp"
 #include "cpu/cpu_engine.hpp"
+#include "cpu/primitive_attr_postops.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -31,12 +32,17 @@ namespace cpu {
 struct cpu_reorder_pd_t : public reorder_pd_t {
     using reorder_pd_t::reorder_pd_t;
 
-    status_t init(
-            engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
+    // Implementations applying eltwise and binary post-ops themselves pass
+    // `post_ops_support`, the others only take a single sum post-op.
+    status_t init(engine_t *engine, engine_t *src_engine, engine_t *dst_engine,
+            bool post_ops_support = false) {
         const auto &post_ops = attr()->post_ops_;
-        bool args_ok = IMPLICATION(post_ops.len() != 0,
-                post_ops.len() == 1
-                        && post_ops.entry_[0].kind == primitive_kind::sum);
+        bool args_ok = post_ops_support
+                ? ref_post_ops_t::post_ops_ok(post_ops)
+                : IMPLICATION(post_ops.len() != 0,
+                        post_ops.len() == 1
+                                && post_ops.entry_[0].kind
+                                        == primitive_kind::sum);
         VDISPATCH_REORDER(args_ok, VERBOSE_UNSUPPORTED_POSTOP);
         auto gpu_zp = memory_extra_flags::compensation_gpu_conv_asymmetric_src;
         VDISPATCH_REORDER(!(dst_md()->extra.flags & gpu_zp),
@@ -25,10 +25,12 @@ namespace cpu {
 const impl_list_map_t &regular_fp4_impl_list_map() {
     static const impl_list_map_t the_map = REG_REORDER_P({
         {{f32, f4_e2m1, 0}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
             REG_SR(f32, any, f4_e2m1, any, fmt_order::any, spec::reference)
             nullptr,
         }},
         {{f4_e2m1, data_type::undef, 0}, {
+            DNNL_AARCH64_ONLY(CPU_REORDER_INSTANCE(aarch64::jit_uni_reorder_low_bit_t))
             REG_SR(f4_e2m1, any, f32, any, fmt_order::any, spec::reference)
             nullptr,
         }},
@@ -37,6 +39,7 @@ const impl_list_map_t &regular_fp4_impl_list_map() {
             nullptr,
         }},
         {{f4_e3m0, data_type::undef, 0}, {
+            DNNL_AARCH64_ONLY(CPU_REORDER_INSTANCE(aarch64::jit_uni_reorder_low_bit_t))
             REG_SR(f4_e3m0, any, f32, any, fmt_order::any, spec::reference)
             nullptr,
         }},
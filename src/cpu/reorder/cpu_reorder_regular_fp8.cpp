@@ -29,6 +29,7 @@ const impl_list_map_t &regular_fp8_impl_list_map() {
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_direct_copy_t))
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_blk_reorder_t))
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
+            DNNL_AARCH64_ONLY(CPU_REORDER_INSTANCE(aarch64::jit_uni_reorder_low_bit_t))
 
             REG_SR(f8_e5m2, any, f8_e5m2, any, fmt_order::any, spec::reference)
             REG_SR(f8_e5m2, any, f16, any, fmt_order::any, spec::reference)
@@ -42,6 +43,7 @@ const impl_list_map_t &regular_fp8_impl_list_map() {
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_direct_copy_t))
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_blk_reorder_t))
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
+            DNNL_AARCH64_ONLY(CPU_REORDER_INSTANCE(aarch64::jit_uni_reorder_low_bit_t))
 
             REG_SR(f8_e4m3, any, f8_e4m3, any, fmt_order::any, spec::reference)
             REG_SR(f8_e4m3, any, f16, any, fmt_order::any, spec::reference)
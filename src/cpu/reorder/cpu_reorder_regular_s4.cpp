@@ -25,11 +25,14 @@ namespace cpu {
 const impl_list_map_t &regular_s4_impl_list_map() {
     static const impl_list_map_t the_map = REG_REORDER_P({
         {{f32, s4, 0}, {
+            CPU_REORDER_INSTANCE(dynamic_quant_reorder_t)
+            DNNL_AARCH64_ONLY(CPU_REORDER_INSTANCE(aarch64::jit_uni_reorder_low_bit_t))
             REG_SR(f32, any, s4, any, fmt_order::any, spec::reference)
             nullptr,
         }},
         {{s4, data_type::undef, 0}, {
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::brgemm_matmul_copy_reorder_t))
+            DNNL_AARCH64_ONLY(CPU_REORDER_INSTANCE(aarch64::jit_uni_reorder_low_bit_t))
             REG_SR(s4, any, f32, any, fmt_order::any, spec::reference)
             REG_SR(s4, any, bf16, any, fmt_order::any, spec::reference)
             REG_SR(s4, any, f16, any, fmt_order::any, spec::reference)
@@ -0,0 +1,234 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <type_traits>
+
+#include "common/dnnl_thread.hpp"
+#include "common/dnnl_traits.hpp"
+#include "common/int4.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_q10n.hpp"
+
+#include "cpu/reorder/dynamic_quant_reorder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+template <typename dst_data_t>
+dst_data_t cvt_4bit(float v) {
+    return dst_data_t(v);
+}
+
+template <>
+int4_t cvt_4bit<int4_t>(float v) {
+    return int4_t(nstl::min(nstl::max(::nearbyintf(v), -8.f), 7.f));
+}
+
+template <>
+uint4_t cvt_4bit<uint4_t>(float v) {
+    return uint4_t(nstl::min(nstl::max(::nearbyintf(v), 0.f), 15.f));
+}
+
+// Quantizes `n` values of a group, the 4-bit types are packed by pairs and
+// the offset of the group is even.
+template <typename dst_data_t, typename src_data_t>
+void quantize_group(const src_data_t *src, void *dst, dim_t off, dim_t n,
+        float inv_scale, std::true_type /* is_4bit */) {
+    uint8_t *d = reinterpret_cast<uint8_t *>(dst) + off / 2;
+    for (dim_t i = 0; i < n; i += 2) {
+        const auto v0 = cvt_4bit<dst_data_t>(
+                static_cast<float>(src[i]) * inv_scale);
+        const auto v1 = cvt_4bit<dst_data_t>(
+                static_cast<float>(src[i + 1]) * inv_scale);
+        d[i / 2] = nibble2_t(v0.raw_bits_, v1.raw_bits_).get();
+    }
+}
+
+template <typename dst_data_t, typename src_data_t>
+void quantize_group(const src_data_t *src, void *dst, dim_t off, dim_t n,
+        float inv_scale, std::false_type /* is_4bit */) {
+    dst_data_t *d = reinterpret_cast<dst_data_t *>(dst) + off;
+    PRAGMA_OMP_SIMD()
+    for (dim_t i = 0; i < n; i++)
+        d[i] = q10n::saturate_and_round<dst_data_t>(
+                static_cast<float>(src[i]) * inv_scale);
+}
+
+} // namespace
+
+status_t dynamic_quant_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
+        engine_t *engine, const primitive_attr_t *attr, engine_t *src_engine,
+        const memory_desc_t *src_md, engine_t *dst_engine,
+        const memory_desc_t *dst_md) {
+    using namespace status;
+    using namespace data_type;
+
+    const memory_desc_wrapper id(src_md), od(dst_md);
+    bool args_ok = impl::is_dense_format_kind({src_md, dst_md})
+            && utils::one_of(id.data_type(), f32, bf16, f16)
+            && utils::one_of(od.data_type(), s8, u8, s4, u4, f8_e5m2, f8_e4m3,
+                    f4_e2m1)
+            && attr->scales_.get(DNNL_ARG_DST).is_dynamic();
+    if (!args_ok) return invalid_arguments;
+
+    auto _pd = make_unique_pd<pd_t>(
+            attr, src_engine->kind(), src_md, dst_engine->kind(), dst_md);
+    if (_pd == nullptr) return out_of_memory;
+    CHECK(_pd->init(engine, src_engine, dst_engine));
+    CHECK(_pd->init_scratchpad_md());
+    return safe_ptr_assign(*reorder_pd, _pd.release());
+}
+
+status_t dynamic_quant_reorder_t::pd_t::init(
+        engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
+    using namespace data_type;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    CHECK(cpu_reorder_pd_t::init(engine, src_engine, dst_engine));
+
+    const memory_desc_wrapper id(src_md()), od(dst_md());
+    VDISPATCH_REORDER(!id.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(attr()->has_default_values(skip_mask_t::scales_groups
+                              | skip_mask_t::scales_data_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_REORDER(attr()->scales_.has_default_values(DNNL_ARG_SRC),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    // the groups span the last dimension, which is dense in both tensors
+    const int ndims = id.ndims();
+    const auto is_dense_plain = [&](const memory_desc_wrapper &mdw) {
+        return mdw.is_dense() && mdw.is_plain()
+                && mdw.blocking_desc().strides[ndims - 1] == 1;
+    };
+    VDISPATCH_REORDER(is_dense_plain(id), VERBOSE_UNSUPPORTED_TENSOR_LAYOUT,
+            "src");
+    VDISPATCH_REORDER(is_dense_plain(od), VERBOSE_UNSUPPORTED_TENSOR_LAYOUT,
+            "dst");
+
+    const auto &sc = attr()->scales_.get(DNNL_ARG_DST);
+    const dim_t K = id.dims()[ndims - 1];
+    group_ = sc.get_group(1);
+    VDISPATCH_REORDER(ndims >= 2 && sc.get_mask() == (1 << ndims) - 1
+                    && sc.get_group(0) == 1 && group_ > 0 && K % group_ == 0,
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_REORDER(IMPLICATION(utils::one_of(od.data_type(), s4, u4,
+                                          f4_e2m1),
+                              group_ % 2 == 0),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    const auto scales_dt = sc.get_data_type();
+    VDISPATCH_REORDER(sc.is_mx() ? scales_dt == e8m0
+                                 : utils::one_of(scales_dt, f32, bf16, f16,
+                                         f8_e4m3),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    return status::success;
+}
+
+template <data_type_t src_type, data_type_t dst_type>
+void dynamic_quant_reorder_t::execute_impl(const exec_ctx_t &ctx) const {
+    using src_data_t = typename prec_traits_t<src_type>::type;
+    using dst_data_t = typename prec_traits_t<dst_type>::type;
+    using is_4bit = std::integral_constant<bool,
+            utils::one_of(dst_type, data_type::s4, data_type::u4,
+                    data_type::f4_e2m1)>;
+
+    const auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_FROM);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_TO);
+    auto scales = CTX_OUT_MEM(void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto &sc = pd()->attr()->scales_.get(DNNL_ARG_DST);
+    const data_type_t scales_dt = sc.get_data_type();
+    const bool is_mx = sc.is_mx();
+    const float dst_max = types::max_value<float>(dst_type);
+    const float rounded_dst_max = types::round_to_dt(scales_dt, dst_max);
+
+    const dim_t K = src_d.dims()[src_d.ndims() - 1];
+    const dim_t G = pd()->group_;
+    const dim_t ngroups = K / G;
+    const dim_t nrows = src_d.nelems() / K;
+
+    // the group is read twice while it's in cache, to find the abs-max and to
+    // quantize it
+    parallel_nd(nrows, ngroups, [&](dim_t r, dim_t g) {
+        const dim_t l_off = r * K + g * G;
+        const src_data_t *s = src + src_d.off_l(l_off);
+
+        float amax = 0.f;
+        PRAGMA_OMP_SIMD(reduction(max : amax))
+        for (dim_t i = 0; i < G; i++)
+            amax = nstl::max(amax, ::fabsf(static_cast<float>(s[i])));
+
+        // same formulas as for the dynamic destination scales of matmul
+        float scale = 1.f;
+        if (is_mx) {
+            // the rounding to a power of two happens before the division
+            scale = types::round_to_dt(scales_dt,
+                    types::round_to_dt(scales_dt, amax) / rounded_dst_max);
+        } else if (amax != 0.f) {
+            scale = types::round_to_dt(scales_dt, amax / dst_max);
+        }
+        io::store_float_value(scales_dt, scale, scales, r * ngroups + g);
+
+        quantize_group<dst_data_t>(
+                s, dst, dst_d.off_l(l_off), G, 1.f / scale, is_4bit());
+    });
+}
+
+status_t dynamic_quant_reorder_t::execute(const exec_ctx_t &ctx) const {
+    using namespace data_type;
+
+#define CASE_DST(sdt, ddt) \
+    case ddt: execute_impl<sdt, ddt>(ctx); break;
+#define CASE_SRC(sdt) \
+    case sdt: \
+        switch (pd()->dst_md()->data_type) { \
+            CASE_DST(sdt, s8) \
+            CASE_DST(sdt, u8) \
+            CASE_DST(sdt, s4) \
+            CASE_DST(sdt, u4) \
+            CASE_DST(sdt, f8_e5m2) \
+            CASE_DST(sdt, f8_e4m3) \
+            CASE_DST(sdt, f4_e2m1) \
+            default: assert(!"unsupported dst data type"); \
+        } \
+        break;
+
+    switch (pd()->src_md()->data_type) {
+        CASE_SRC(f32)
+        CASE_SRC(bf16)
+        CASE_SRC(f16)
+        default: assert(!"unsupported src data type");
+    }
+#undef CASE_SRC
+#undef CASE_DST
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
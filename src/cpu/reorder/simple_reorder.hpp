@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <memory>
+#include <type_traits>
 
 #include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
@@ -31,6 +33,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/primitive_attr_postops.hpp"
 #include "cpu/reorder/cpu_reorder_pd.hpp"
 
 #include "cpu/simple_q10n.hpp"
@@ -2080,6 +2083,15 @@ struct simple_reorder_impl_t<SIMPLE_REORDER_TEMPL_CALL,
                 output_d.is_dense(), VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "dst");
         VDISPATCH_REORDER_IC(input_d.similar_to(output_d, true, false, 0),
                 VERBOSE_TENSOR_FORMAT_MISMATCH, "src", "dst");
+        // Binary post-ops are indexed by logical offsets, which match the
+        // physical ones for plain row-major tensors only.
+        const auto &po = attr->post_ops_;
+        const bool with_po_args = po.find(primitive_kind::binary) != -1
+                || po.find(primitive_kind::prelu) != -1;
+        VDISPATCH_REORDER_IC(IMPLICATION(with_po_args,
+                                     input_d.matches_tag(
+                                             get_abx_tag(input_d.ndims()))),
+                VERBOSE_UNSUPPORTED_POSTOP);
 
         return status::success;
     }
@@ -2094,6 +2106,27 @@ struct simple_reorder_impl_t<SIMPLE_REORDER_TEMPL_CALL,
 
         const size_t nelems = input_d.nelems();
 
+        // Post-ops other than a single sum, e.g. the eltwise and binary ops
+        // following a type conversion in a graph, are applied in the same
+        // pass, before the destination scale.
+        if (!simple_po_check(pd->attr())) {
+            ref_post_ops_t ref_post_ops(pd->attr()->post_ops_);
+            CHECK(ref_post_ops.init(pd->dst_md()));
+            const float src_scale = with_src_scales ? src_scales[0] : 1.f;
+            const float dst_scale = with_dst_scales ? dst_scales[0] : 1.f;
+            parallel_nd(static_cast<dim_t>(nelems), [&](dim_t e) {
+                ref_post_ops_t::args_t args;
+                args.dst_val = static_cast<float>(output[e]);
+                args.ctx = &ctx;
+                args.l_offset = e;
+                args.dst_md = pd->dst_md();
+                float d = src_scale * static_cast<float>(input[e]);
+                ref_post_ops.execute(d, args);
+                output[e] = _qz_a1b0<data_type::f32, type_o>()(d / dst_scale);
+            });
+            return status::success;
+        }
+
         constexpr int block_size = 16;
         const auto num_blocks = nelems / block_size;
         const auto rem_elems = nelems % block_size;
@@ -2565,7 +2598,9 @@ struct simple_reorder_impl_t<SIMPLE_REORDER_TEMPL_CALL,
                 | smask_t::post_ops;
         VDISPATCH_REORDER_IC(
                 attr->has_default_values(skip_mask), VERBOSE_UNSUPPORTED_ATTR);
-        VDISPATCH_REORDER_IC(simple_po_check(attr), VERBOSE_UNSUPPORTED_POSTOP);
+        // eltwise and binary post-ops are applied in the same pass
+        VDISPATCH_REORDER_IC(ref_post_ops_t::post_ops_ok(attr->post_ops_),
+                VERBOSE_UNSUPPORTED_POSTOP);
         const auto &scales = attr->scales_;
         const bool with_dst_scales = !scales.has_default_values(DNNL_ARG_DST);
         if (with_dst_scales) {
@@ -2621,6 +2656,19 @@ struct simple_reorder_impl_t<SIMPLE_REORDER_TEMPL_CALL,
             CHECK(zps.get(DNNL_ARG_SRC).get_md(src_zps_md, *input_d.md_));
         }
 
+        // Post-ops other than a single sum, e.g. the eltwise and binary ops
+        // following a reorder in a graph, are applied before the values are
+        // quantized to the destination data type.
+        std::unique_ptr<ref_post_ops_t> ref_post_ops;
+        if (!simple_po_check(pd->attr())) {
+            ref_post_ops = utils::make_unique<ref_post_ops_t>(
+                    pd->attr()->post_ops_);
+            if (!ref_post_ops) return status::out_of_memory;
+            CHECK(ref_post_ops->init(pd->dst_md()));
+        }
+        const ref_post_ops_t *post_ops = ref_post_ops.get();
+        const exec_ctx_t *exec_ctx = &ctx;
+
         parallel_nd(input_d.nelems(), [=](dim_t idx) {
             // Must be per thread; when shared, race condition happens.
             dims_t input_idx {};
@@ -2660,7 +2708,15 @@ struct simple_reorder_impl_t<SIMPLE_REORDER_TEMPL_CALL,
             const auto i_off = input_d.off_l(idx);
             const auto o_off = output_d.off_l(idx);
             float d = src_scale * (input[i_off] - src_zp_val);
-            if (beta) d += beta * output[o_off];
+            if (post_ops) {
+                ref_post_ops_t::args_t args;
+                args.dst_val = static_cast<float>(output[o_off]);
+                args.ctx = exec_ctx;
+                args.l_offset = idx;
+                args.dst_md = pd->dst_md();
+                post_ops->execute(d, args);
+            } else if (beta)
+                d += beta * output[o_off];
             d = d / dst_scale + dst_zp;
             output[o_off] = _qz_a1b0<data_type::f32, type_o>()(d);
         });
@@ -2709,7 +2765,10 @@ struct simple_reorder_t : public primitive_t {
             auto _pd = make_unique_pd<pd_t>(attr, src_engine->kind(), src_md,
                     dst_engine->kind(), dst_md);
             if (_pd == nullptr) return status::out_of_memory;
-            CHECK(_pd->init(engine, src_engine, dst_engine));
+            constexpr bool post_ops_support
+                    = std::is_same<spec, cpu::spec::reference>::value
+                    || std::is_same<spec, cpu::spec::direct_copy>::value;
+            CHECK(_pd->init(engine, src_engine, dst_engine, post_ops_support));
 
             const size_t scratchpad_sz_
                     = simple_reorder_impl_t<SIMPLE_REORDER_TEMPL_CALL,
@@ -17,6 +17,8 @@
 /*
  * Common for RNN and LSTM cell execution
  */
+#include <vector>
+
 #include "common/bfloat16.hpp"
 #include "common/dnnl_thread.hpp"
 
@@ -64,6 +66,86 @@ rnn_cell_execution_sig(
     const auto dst_postgemm = rnn.is_lstm_projection ? proj_ht_ : dst_layer_;
     // for lstmp, the copy to dst_iter happens after the projection
     const auto dst_iter_postgemm = rnn.is_lstm_projection ? nullptr : dst_iter_;
+
+    if (rnn.fuse_lstm_projection) {
+        // Each thread runs the postgemm and then the projection on its blocks
+        // of rows, so that the hidden states of a block are projected while
+        // they are still in L1. The postgemm and GEMM routines run
+        // single-threaded inside the parallel region and take the number of
+        // rows from the configuration, hence the per-thread copy of it.
+        const auto proj_ht_ld = rnn.dst_layer_ld(cell_position);
+        const auto dst_layer_ld = rnn.dst_layer_ld(cell_position, true);
+        const auto dst_iter_ld = rnn.dst_iter_ld(cell_position);
+        const auto dst_iter_c_ld = rnn.dst_iter_c_ld(cell_position);
+        const auto src_iter_c_ld = rnn.src_iter_c_ld(cell_position);
+
+        // As below, the projection of non-f32 configurations accumulates
+        // into the scratch gates, which each block overwrites only after its
+        // postgemm has consumed them.
+        gemm_acc_t *dst_proj = rnn.dt_conf == all_f32 ? (gemm_acc_t *)dst_layer_
+                                                      : scratch_gates_;
+        const int dst_proj_ld
+                = rnn.dt_conf == all_f32 ? dst_layer_ld : rnn.scratch_gates_ld;
+
+        const dim_t m_block = nstl::min(rnn.proj_m_block,
+                utils::div_up(
+                        (dim_t)rnn.mb, (dim_t)dnnl_get_current_num_threads()));
+        const dim_t n_blocks = utils::div_up((dim_t)rnn.mb, m_block);
+        std::vector<status_t> block_status(n_blocks, status::success);
+
+        parallel(0, [&](int ithr, int nthr) {
+            dim_t start {0}, end {0};
+            balance211(n_blocks, nthr, ithr, start, end);
+            if (start == end) return;
+
+            rnn_conf_t block_rnn = rnn;
+            for (dim_t b = start; b < end; b++) {
+                const int m = static_cast<int>(b * m_block);
+                const dim_t rows = nstl::min<dim_t>(m_block, rnn.mb - m);
+                block_rnn.mb = static_cast<int>(rows);
+
+                ht_t *proj_ht_m = proj_ht_ + m * proj_ht_ld;
+                this->rnn_postgemm_->execute(block_rnn, cell_position,
+                        ws_gates_ ? ws_gates_ + m * rnn.ws_gates_ld : nullptr,
+                        scratch_gates_ + m * rnn.scratch_gates_ld,
+                        augru_attention_, proj_ht_m,
+                        inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                                m * dst_iter_c_ld),
+                        src_iter_ + m * src_iter_ld,
+                        inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
+                                m * src_iter_c_ld),
+                        diff_src_layer_, diff_augru_attention_, diff_src_iter_,
+                        diff_src_iter_c_, diff_dst_layer_, diff_dst_iter_,
+                        diff_dst_iter_c_, weights_peephole_, bias_[0],
+                        ws_grid_, scratch_cell_, nullptr, weights_scales,
+                        rnn.dhc * sizeof(scratch_t));
+
+                gemm_acc_t *dst_proj_m = dst_proj + m * dst_proj_ld;
+                const dnnl_status_t st = (this->*gemm_projection_func)('N',
+                        'N', rnn.dic, block_rnn.mb, rnn.dhc, 1.0f,
+                        w_projection_[0], rnn.weights_projection_ld, proj_ht_m,
+                        rnn.proj_ht_ld, 0.0f, dst_proj_m, dst_proj_ld);
+                if (st != dnnl_success) {
+                    block_status[b] = st;
+                    continue;
+                }
+
+                this->rnn_postgemm_->execute_part2(block_rnn, cell_position,
+                        nullptr, dst_proj_m, nullptr,
+                        dst_layer_ + m * dst_layer_ld, nullptr, nullptr,
+                        w_proj_comp, nullptr, nullptr, nullptr, nullptr,
+                        nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                        nullptr,
+                        dst_iter_ ? dst_iter_ + m * dst_iter_ld : nullptr,
+                        weights_projection_scales,
+                        rnn.dlc * sizeof(dst_layer_t));
+            }
+        });
+        for (const auto st : block_status)
+            CHECK(st);
+        return dnnl_success;
+    }
+
     this->rnn_postgemm_->execute(rnn, cell_position, ws_gates_, scratch_gates_,
             augru_attention_, dst_postgemm, dst_iter_c_, src_iter_, src_iter_c_,
             diff_src_layer_, diff_augru_attention_, diff_src_iter_,
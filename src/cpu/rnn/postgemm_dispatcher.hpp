@@ -41,6 +41,14 @@
 #include "cpu/x64/rnn/jit_uni_rnn_common_postgemm.hpp"
 #endif
 
+#if DNNL_AARCH64
+#include "cpu/aarch64/rnn/jit_uni_gru_cell_postgemm_1_fwd.hpp"
+#include "cpu/aarch64/rnn/jit_uni_gru_cell_postgemm_2_fwd.hpp"
+#include "cpu/aarch64/rnn/jit_uni_lstm_cell_postgemm_fwd.hpp"
+#include "cpu/aarch64/rnn/jit_uni_rnn_cell_postgemm_fwd.hpp"
+#include "cpu/aarch64/rnn/jit_uni_rnn_common_postgemm.hpp"
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -106,6 +114,7 @@ struct rnn_postgemm_dispatcher_t {
 
     status_t init(const rnn_utils::rnn_conf_t &rnn) {
         DNNL_X64_ONLY(CHECK(initialize_jit(rnn)));
+        DNNL_AARCH64_ONLY(CHECK(initialize_jit(rnn)));
         return status::success;
     }
 
@@ -154,7 +163,7 @@ struct rnn_postgemm_dispatcher_t {
          * multiple times. Be careful when changing it.
          * XXX: The code is compiler sensitive, jit might help with that.
          */
-#if DNNL_X64
+#if DNNL_X64 || DNNL_AARCH64
         if (rnn_postgemm_) {
             rnn_postgemm_->execute(rnn, cell_position, ws_gates_,
                     scratch_gates_, augru_attention_, dst_layer_, dst_iter_c_,
@@ -188,7 +197,7 @@ struct rnn_postgemm_dispatcher_t {
          * multiple times. Be careful when changing it.
          * XXX: The code is compiler sensitive, jit might help with that.
          */
-#if DNNL_X64
+#if DNNL_X64 || DNNL_AARCH64
         if (rnn_postgemm_part2_) {
             rnn_postgemm_part2_->execute(rnn, cell_position, ws_gates_,
                     scratch_gates_, augru_attention_, dst_layer_, dst_iter_c_,
@@ -289,6 +298,59 @@ protected:
 #undef CREATE
 #undef CREATE_WITH_DIR
 
+        if (rnn_postgemm_) CHECK(rnn_postgemm_->init(src_type));
+        if (rnn_postgemm_part2_) CHECK(rnn_postgemm_part2_->init(src_type));
+        return status::success;
+    }
+#elif DNNL_AARCH64
+    std::unique_ptr<aarch64::jit_uni_rnn_postgemm_t> rnn_postgemm_;
+    std::unique_ptr<aarch64::jit_uni_rnn_postgemm_t> rnn_postgemm_part2_;
+
+    status_t initialize_jit(const rnn_utils::rnn_conf_t &rnn) {
+        using namespace dnnl::impl::cpu::aarch64;
+
+        if (pd_->attr()->rnn_tparams_.test_mode_) return status::success;
+
+        // Only f32 forward without brgemm and projection is jitted for now,
+        // as well as the u8 LSTM inference with dequantization and
+        // requantization fused into the kernel
+        const bool is_u8_lstm = src_type == data_type::u8
+                && pd_->cell_kind() == alg_kind::vanilla_lstm
+                && !rnn.is_training;
+        const bool jit_fwd = pd_->is_fwd()
+                && (src_type == data_type::f32 || is_u8_lstm)
+                && !rnn.is_brgemm && !rnn.is_lstm_projection
+                && rnn.bias_dt == data_type::f32
+                && utils::everyone_is(data_type::f32, rnn.src_iter_c_dt,
+                        rnn.dst_iter_c_dt)
+                && mayiuse(sve_128);
+        if (!jit_fwd) return status::success;
+
+        //NOLINTBEGIN(bugprone-macro-parentheses)
+#define CREATE(k, ker_t) \
+    do { \
+        if (mayiuse(sve_512)) \
+            (k).reset(new ker_t<sve_512>(rnn, pd_)); \
+        else if (mayiuse(sve_256)) \
+            (k).reset(new ker_t<sve_256>(rnn, pd_)); \
+        else \
+            (k).reset(new ker_t<sve_128>(rnn, pd_)); \
+    } while (0)
+        //NOLINTEND(bugprone-macro-parentheses)
+
+        if (pd_->cell_kind() == alg_kind::vanilla_lstm) {
+            CREATE(rnn_postgemm_, jit_uni_lstm_cell_postgemm_fwd_t);
+        } else if (pd_->cell_kind() == alg_kind::vanilla_rnn) {
+            if (eltwise_injector::is_supported(
+                        sve_128, pd_->activation_kind()))
+                CREATE(rnn_postgemm_, jit_uni_rnn_cell_postgemm_fwd_t);
+        } else if (pd_->cell_kind() == alg_kind::vanilla_gru) {
+            CREATE(rnn_postgemm_, jit_uni_gru_cell_postgemm_part1_fwd_t);
+            CREATE(rnn_postgemm_part2_, jit_uni_gru_cell_postgemm_part2_fwd_t);
+        }
+
+#undef CREATE
+
         if (rnn_postgemm_) CHECK(rnn_postgemm_->init(src_type));
         if (rnn_postgemm_part2_) CHECK(rnn_postgemm_part2_->init(src_type));
         return status::success;
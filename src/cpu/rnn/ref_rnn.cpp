@@ -29,6 +29,9 @@
 
  */
 
+#include <algorithm>
+#include <vector>
+
 #include "common/dnnl_thread.hpp"
 #include "common/matmul_pd.hpp"
 #include "common/primitive.hpp"
@@ -551,6 +554,14 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init(
         size_t scratchpad_sz {0}, ws_sz {0};
         get_scratchpad_and_workspace_sizes(rnn_, scratchpad_sz, ws_sz);
 
+        // the carried states feed the next execution as the source states
+        if (this->is_stateful()) {
+            VDISPATCH_RNN(*this->src_md(1) == *this->dst_md(1),
+                    VERBOSE_INCONSISTENT_MDS, "src_iter", "dst_iter");
+            VDISPATCH_RNN(*this->src_md(2) == *this->dst_md(2),
+                    VERBOSE_INCONSISTENT_MDS, "src_iter_c", "dst_iter_c");
+        }
+
         init_scratchpad(scratchpad_sz);
         // initialize the workspace if needed
         if (rnn_.is_training) {
@@ -1039,7 +1050,188 @@ rnn_grid_execution_sig((ref_rnn_common_t<aprop, src_type, weights_type,
         return dnnl_success;
     };
 
+    // Executes the cell of the j-th layer and the i-th iteration in the
+    // order of the propagation kind
+    const auto compute_cell = [&](int dir, int j, int i) {
+        const int lay = (aprop == prop_kind::forward) ? j : rnn.n_layer - j - 1;
+        const int iter = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
+
+        // We set parameters to the cell execution call
+
+        // dst_layer is equal to dst_iter. To avoid
+        // duplication of memory access we hence use only
+        // dst_layer and set dst_iter to nullptr, unless we
+        // cannot for one of the following condition:
+        // - in the last layer and last iteration, we need to
+        //   copy ht in two tensors (dst_layer and dst_iter)
+        dst_layer_t *cell_dst_layer
+                = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
+        dst_iter_t *cell_dst_iter = nullptr;
+        const src_layer_t *cell_src_layer
+                = &(ws_states_layer(lay, dir, iter + 1, 0));
+        const src_iter_t *cell_src_iter
+                = &(ws_states_iter(lay + 1, dir, iter, 0));
+
+        void *cell_dst_iter_c = const_cast<void *>(
+                ws_states_iter_c(lay + 1, dir, iter + 1, 0));
+        const void *cell_src_iter_c
+                = ws_states_iter_c(lay + 1, dir, iter, 0);
+
+        // the cell_position is used only when skip_data_copy is
+        // supported currently supported only for forward
+        cell_position_t cell_position = middle_cell;
+        if (iter == 0) cell_position |= first_iter;
+        if (lay == 0) cell_position |= first_layer;
+        if (iter == rnn.n_iter - 1) cell_position |= last_iter;
+        if (lay == rnn.n_layer - 1) cell_position |= last_layer;
+
+        // The dst_* paths should be before the src_* paths as
+        // the later will override cell_src_layer and
+        // cell_src_iter appropriately for 1st layer and 1st
+        // iter.
+        const bool last_iter_skip_copy
+                = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
+        if (last_iter_skip_copy) {
+            cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
+            cell_src_layer
+                    = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
+        }
+
+        if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
+            // Note: for last layer and last iter, the output is in dst_layer
+            // and still need to be copied to dst_iter
+            cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
+            cell_dst_iter = last_iter_skip_copy
+                    ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
+                    : nullptr;
+            cell_src_iter = (iter != 0)
+                    ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
+                    : cell_src_iter;
+        }
+        if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
+            cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
+
+        if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
+            cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
+
+        // because the c state is always f32 and require no
+        // conversion, we can always skip to copy for the 1st
+        // and last iteration
+        if (iter == 0 && src_iter_c_) {
+            cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
+                    src_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_first_iter;
+        }
+        if (iter == rnn.n_iter - 1 && dst_iter_c_) {
+            cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                    dst_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_last_iter;
+        }
+        const size_t sg_start_idx = rnn.n_iter_scratch_gates == 1
+                ? static_cast<size_t>(0)
+                : static_cast<size_t>(iter) * rnn.scratch_gates_nld
+                        * rnn.scratch_gates_ld;
+        const auto cell_scratch_gates = &scratch_gates_[sg_start_idx];
+
+        dst_iter_t *proj_ht = nullptr;
+        if (rnn.is_lstm_projection) {
+            if (rnn.is_training)
+                proj_ht = &(ws_ht(lay, dir, iter, 0));
+            else
+                proj_ht = scratch_ht_;
+        }
+
+#if DNNL_X64
+        CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
+                scratch_gates_blocked_, scratch_src_layer_,
+                scratch_src_iter_, cell_dst_iter, amx_scratchpad,
+                addr_batch_global));
+#else
+        CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
+                cell_dst_iter, amx_scratchpad));
+#endif
+        return dnnl_success;
+    };
+#undef SAFE_PTR
+
     // We run the grid of computation
+    if (rnn.use_wavefront) {
+        // The cells (lay, iter) with lay + iter == d only depend on the cells
+        // of the diagonal d - 1, so they run concurrently. The layers are
+        // statically distributed over the threads so that each thread keeps
+        // reusing the weights of its layers.
+        CHECK(compute_merged_layer_part_if_applicable(
+                prop_kind::forward, 0, 0));
+        const int nthr_wavefront
+                = std::min(rnn.n_layer, dnnl_get_current_num_threads());
+        std::vector<status_t> cell_status(rnn.n_layer, status::success);
+        for (int d = 0; d < rnn.n_layer + rnn.n_iter - 1; d++) {
+            parallel(nthr_wavefront, [&](int ithr, int nthr) {
+                int start {0}, end {0};
+                balance211(rnn.n_layer, nthr, ithr, start, end);
+                for (int j = start; j < end; j++) {
+                    const int i = d - j;
+                    if (i < 0 || i >= rnn.n_iter) continue;
+                    const status_t st = compute_cell(0, j, i);
+                    if (st != status::success) cell_status[j] = st;
+                }
+            });
+            for (const auto st : cell_status)
+                CHECK(st);
+        }
+        return dnnl_success;
+    }
+
     for_(int dir = 0; dir < rnn.n_dir; dir++)
     for (int j = 0; j < rnn.n_layer; j++) {
         const int lay = (aprop == prop_kind::forward) ? j : rnn.n_layer - j - 1;
@@ -1049,161 +1241,12 @@ rnn_grid_execution_sig((ref_rnn_common_t<aprop, src_type, weights_type,
 
         // TODO: enable merging projection gemm in bwd lstm projection
 
-        for (int i = 0; i < rnn.n_iter; i++) {
-            const int iter
-                    = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
-
-            // We set parameters to the cell execution call
-
-            // dst_layer is equal to dst_iter. To avoid
-            // duplication of memory access we hence use only
-            // dst_layer and set dst_iter to nullptr, unless we
-            // cannot for one of the following condition:
-            // - in the last layer and last iteration, we need to
-            //   copy ht in two tensors (dst_layer and dst_iter)
-            dst_layer_t *cell_dst_layer
-                    = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
-            dst_iter_t *cell_dst_iter = nullptr;
-            const src_layer_t *cell_src_layer
-                    = &(ws_states_layer(lay, dir, iter + 1, 0));
-            const src_iter_t *cell_src_iter
-                    = &(ws_states_iter(lay + 1, dir, iter, 0));
-
-            void *cell_dst_iter_c = const_cast<void *>(
-                    ws_states_iter_c(lay + 1, dir, iter + 1, 0));
-            const void *cell_src_iter_c
-                    = ws_states_iter_c(lay + 1, dir, iter, 0);
-
-            // the cell_position is used only when skip_data_copy is
-            // supported currently supported only for forward
-            cell_position_t cell_position = middle_cell;
-            if (iter == 0) cell_position |= first_iter;
-            if (lay == 0) cell_position |= first_layer;
-            if (iter == rnn.n_iter - 1) cell_position |= last_iter;
-            if (lay == rnn.n_layer - 1) cell_position |= last_layer;
-
-            // The dst_* paths should be before the src_* paths as
-            // the later will override cell_src_layer and
-            // cell_src_iter appropriately for 1st layer and 1st
-            // iter.
-            const bool last_iter_skip_copy
-                    = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
-            if (last_iter_skip_copy) {
-                cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
-                cell_src_layer
-                        = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
-            }
-
-            if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
-                // Note: for last layer and last iter, the output is in dst_layer
-                // and still need to be copied to dst_iter
-                cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
-                cell_dst_iter = last_iter_skip_copy
-                        ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
-                        : nullptr;
-                cell_src_iter = (iter != 0)
-                        ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
-                        : cell_src_iter;
-            }
-            if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
-                cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
-
-            if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
-                cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
-
-            // because the c state is always f32 and require no
-            // conversion, we can always skip to copy for the 1st
-            // and last iteration
-            if (iter == 0 && src_iter_c_) {
-                cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
-                        src_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_first_iter;
-            }
-            if (iter == rnn.n_iter - 1 && dst_iter_c_) {
-                cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
-                        dst_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_last_iter;
-            }
-            const size_t sg_start_idx = rnn.n_iter_scratch_gates == 1
-                    ? static_cast<size_t>(0)
-                    : static_cast<size_t>(iter) * rnn.scratch_gates_nld
-                            * rnn.scratch_gates_ld;
-            const auto cell_scratch_gates = &scratch_gates_[sg_start_idx];
-
-            dst_iter_t *proj_ht = nullptr;
-            if (rnn.is_lstm_projection) {
-                if (rnn.is_training)
-                    proj_ht = &(ws_ht(lay, dir, iter, 0));
-                else
-                    proj_ht = scratch_ht_;
-            }
-
-#if DNNL_X64
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    scratch_gates_blocked_, scratch_src_layer_,
-                    scratch_src_iter_, cell_dst_iter, amx_scratchpad,
-                    addr_batch_global));
-#else
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    cell_dst_iter, amx_scratchpad));
-#endif
-        }
+        for (int i = 0; i < rnn.n_iter; i++)
+            CHECK(compute_cell(dir, j, i));
 
         CHECK(compute_merged_layer_part_if_applicable(
                 prop_kind::backward, dir, lay));
 
-#undef SAFE_PTR
-
         if ((aprop == prop_kind::backward) && rnn.merge_gemm_iter) {
             // This is split in 3 pieces if we skip copies.
             // last iter in user mem, middle iters in ws, first iter in user mem
@@ -2021,6 +2064,24 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
             : const_cast<char *>(CTX_IN_MEM(const char *, DNNL_ARG_DST_ITER));
     auto dst_iter_c = CTX_OUT_MEM(void *, DNNL_ARG_DST_ITER_C);
 
+    // A stateful primitive uses its carried states for the states not passed
+    // by the user
+    const rnn_carried_states_t *carried_states = pd()->is_stateful()
+            ? ctx.get_resource_mapper()->get<rnn_carried_states_t>(this)
+            : nullptr;
+    char *const user_dst_iter = dst_iter;
+    void *const user_dst_iter_c = dst_iter_c;
+    if (carried_states) {
+        using cs_t = rnn_carried_states_t;
+        if (!src_iter)
+            src_iter = static_cast<const char *>(
+                    carried_states->cur(cs_t::iter));
+        if (!src_iter_c) src_iter_c = carried_states->cur(cs_t::iter_c);
+        if (!dst_iter)
+            dst_iter = static_cast<char *>(carried_states->next(cs_t::iter));
+        if (!dst_iter_c) dst_iter_c = carried_states->next(cs_t::iter_c);
+    }
+
     auto diff_dst_layer
             = CTX_IN_MEM(const gemm_acc_t *, DNNL_ARG_DIFF_DST_LAYER);
     auto diff_dst_iter = CTX_IN_MEM(const gemm_acc_t *, DNNL_ARG_DIFF_DST_ITER);
@@ -2285,6 +2346,11 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
                     ws_diff_states_iter_c);
     }
 
+    if (carried_states) {
+        carried_states->advance(rnn_carried_states_t::iter, user_dst_iter);
+        carried_states->advance(rnn_carried_states_t::iter_c, user_dst_iter_c);
+    }
+
     return status::success;
 }
 /* Fix for MSVS warning C4661 */
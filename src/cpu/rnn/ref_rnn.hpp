@@ -18,11 +18,13 @@
 #define CPU_RNN_REF_RNN_HPP
 
 #include <assert.h>
+#include <cstring>
 #include <tuple>
 
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
 #include "common/reorder.hpp"
+#include "common/resource.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/gemm/gemm.hpp"
@@ -84,6 +86,55 @@ template <impl::data_type_t src_type, impl::data_type_t weights_type,
         impl::data_type_t acc_type>
 struct ref_rnn_bwd_t;
 
+// The hidden and cell states carried over the executions of a stateful RNN
+// primitive. Every state is double buffered: an execution reads the current
+// buffer and writes the next one, which becomes current afterwards.
+struct rnn_carried_states_t : public resource_t {
+    enum { iter = 0, iter_c = 1, n_states = 2 };
+
+    rnn_carried_states_t() = default;
+    ~rnn_carried_states_t() override {
+        for (int k = 0; k < n_states; k++)
+            for (int b = 0; b < 2; b++)
+                free(buf_[k][b]);
+    }
+
+    status_t init(size_t iter_size, size_t iter_c_size) {
+        const size_t sizes[n_states] = {iter_size, iter_c_size};
+        for (int k = 0; k < n_states; k++) {
+            size_[k] = sizes[k];
+            if (size_[k] == 0) continue;
+            for (int b = 0; b < 2; b++) {
+                buf_[k][b] = malloc(size_[k], 64);
+                if (!buf_[k][b]) return status::out_of_memory;
+                std::memset(buf_[k][b], 0, size_[k]);
+            }
+        }
+        return status::success;
+    }
+
+    void *cur(int k) const { return buf_[k][cur_[k]]; }
+    void *next(int k) const { return buf_[k][1 - cur_[k]]; }
+
+    // Makes the states written by the execution current. If the user passed
+    // a destination, the states are copied from it instead. The resources
+    // are accessed as constant during execution, hence the mutable index.
+    void advance(int k, const void *user_dst) const {
+        if (size_[k] == 0) return;
+        if (user_dst)
+            std::memcpy(cur(k), user_dst, size_[k]);
+        else
+            cur_[k] = 1 - cur_[k];
+    }
+
+private:
+    void *buf_[n_states][2] = {{nullptr, nullptr}, {nullptr, nullptr}};
+    size_t size_[n_states] = {0, 0};
+    mutable int cur_[n_states] = {0, 0};
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(rnn_carried_states_t);
+};
+
 template <prop_kind_t aprop, impl::data_type_t src_type,
         impl::data_type_t weights_type, impl::data_type_t acc_type>
 struct ref_rnn_common_t : public primitive_t {
@@ -180,6 +231,18 @@ struct ref_rnn_common_t : public primitive_t {
     status_t init(engine_t *engine) override;
     ~ref_rnn_common_t() override { delete rnn_postgemm_; }
 
+    status_t create_resource(
+            engine_t *engine, resource_mapper_t &mapper) const override {
+        if (!pd()->is_stateful() || mapper.has_resource(this))
+            return status::success;
+        auto r = utils::make_unique<rnn_carried_states_t>();
+        if (!r) return status::out_of_memory;
+        CHECK(r->init(memory_desc_wrapper(pd()->src_md(1)).size(),
+                memory_desc_wrapper(pd()->src_md(2)).size()));
+        mapper.add(this, std::move(r));
+        return status::success;
+    }
+
     status_t execute(const exec_ctx_t &ctx) const override;
 
 protected:
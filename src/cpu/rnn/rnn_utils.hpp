@@ -406,6 +406,13 @@ struct rnn_conf_t {
     bool merge_gemm_iter = false, merge_gemm_layer = false,
          force_nocopy = false, use_layer_packed_gemm = false,
          use_iter_packed_gemm = false, use_projection_packed_gemm = false;
+    // Cells are executed in layer x time wavefront order, see
+    // linear_execution()
+    bool use_wavefront = false;
+    // The LSTM postgemm and the projection GEMM run back to back on blocks
+    // of at most proj_m_block rows, see cell_execution_ref()
+    bool fuse_lstm_projection = false;
+    dim_t proj_m_block = 0;
     int n_iter_scratch_gates = 0;
 
     bool diff_weights_overwrite = false;
@@ -601,6 +608,9 @@ struct rnn_conf_t {
     }
 
     inline bool need_gemm_layer(cell_position_t cell_position) const {
+        // With the wavefront execution only the first layer gemm is merged,
+        // the input of the other layers is produced along the diagonal.
+        if (use_wavefront) return !(cell_position & first_layer);
         // In case of merge_gemm_layer we might still need a layer gemm if we store
         // the states of the last iteration in the destination memory. The
         // exception of this rule is the first layer though, in which case all
@@ -920,6 +930,39 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.merge_gemm_iter = !(rnn.is_brgemm || rnn.use_matmul)
             ? rnn.dst_layer_is_trivial_stride && !(rnn.is_fwd || is_gru)
             : false;
+
+    // For small batches the cell GEMMs have little parallelism, so the cells
+    // of a layer x time diagonal run concurrently instead, one layer per
+    // thread, with the first layer input projection merged over time. This
+    // pays off when the weights of a layer stay resident in the L2 cache of
+    // the thread that owns the layer.
+    const size_t wavefront_layer_weights_size = (size_t)rnn.n_gates * rnn.dhc
+            * (rnn.slc + rnn.sic)
+            * types::data_type_size(weights_layer_d.data_type());
+    rnn.use_wavefront = is_inference && rnn.is_fwd && rnn.merge_gemm_layer
+            && rnn.n_layer > 1 && rnn.n_dir == 1 && rnn.mb <= 4
+            && utils::one_of(
+                    rd.cell_kind, alg_kind::vanilla_lstm, alg_kind::vanilla_rnn)
+            && !rnn.is_lstm_projection
+            && wavefront_layer_weights_size
+                    <= platform::get_per_core_cache_size(2);
+
+    // Without a brgemm cell, the projection of an LSTM cell is a GEMM over the
+    // whole minibatch that reads the hidden states back from memory once the
+    // postgemm has written all of them. On aarch64 the postgemm and the
+    // projection of a block of rows run one after the other on a thread
+    // instead, with the block small enough for its hidden states and
+    // projection outputs to stay in L1.
+    rnn.fuse_lstm_projection = false;
+#if DNNL_AARCH64
+    rnn.fuse_lstm_projection = rnn.is_lstm_projection && is_inference
+            && rnn.is_fwd && !rnn.is_brgemm;
+#endif
+    if (rnn.fuse_lstm_projection) {
+        const size_t proj_row_size = (rnn.dhc + rnn.dic) * sizeof(float);
+        rnn.proj_m_block = nstl::max<dim_t>(1,
+                platform::get_per_core_cache_size(1) / 2 / proj_row_size);
+    }
     rnn.force_nocopy = false;
 #if DNNL_X64
     rnn.force_nocopy = x64::mayiuse(x64::avx)
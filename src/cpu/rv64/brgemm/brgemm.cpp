@@ -42,12 +42,16 @@ status_t brgemm_desc_init(brgemm_desc_t *brg, cpu_isa_t isa,
     //   f32  × f32  → f32  (always)
     //   bf16 × bf16 → f32  (Zvfbfwma widening FMA)
     //   f16  × f16  → f32  (Zvfh widening FMA)
+    //   x8   × x8   → s32  (widening integer MAC)
     const bool is_f32 = everyone_is(data_type::f32, dt_a, dt_b);
     const bool is_bf16
             = everyone_is(data_type::bf16, dt_a, dt_b) && mayiuse(zvfbfwma);
     const bool is_f16
             = everyone_is(data_type::f16, dt_a, dt_b) && mayiuse(zvfh);
-    if (!is_f32 && !is_bf16 && !is_f16) return status::unimplemented;
+    const bool is_int8 = one_of(dt_a, data_type::s8, data_type::u8)
+            && one_of(dt_b, data_type::s8, data_type::u8);
+    if (!is_f32 && !is_bf16 && !is_f16 && !is_int8)
+        return status::unimplemented;
 
     *brg = utils::zero<brgemm_desc_t>();
 
@@ -65,7 +69,7 @@ status_t brgemm_desc_init(brgemm_desc_t *brg, cpu_isa_t isa,
 
     brg->dt_a = dt_a;
     brg->dt_b = dt_b;
-    brg->dt_c = data_type::f32;
+    brg->dt_c = is_int8 ? data_type::s32 : data_type::f32;
     brg->typesize_A = static_cast<int>(types::data_type_size(dt_a));
     brg->typesize_B = static_cast<int>(types::data_type_size(dt_b));
     brg->typesize_C = static_cast<int>(types::data_type_size(brg->dt_c));
@@ -97,7 +101,7 @@ status_t brgemm_kernel_create(
     if (!brg_kernel) return status::invalid_arguments;
     *brg_kernel = nullptr;
 
-    // Pick the per-dtype kernel class. f32 / bf16 / f16 each live in
+    // Pick the per-dtype kernel class. f32 / bf16 / f16 / int8 each live in
     // their own class so the f32 JIT codegen stays untouched.
     brgemm_kernel_t *kernel = nullptr;
     if (brg.is_f32) {
@@ -106,6 +110,8 @@ status_t brgemm_kernel_create(
         kernel = new brgemm_kernel_bf16_t(brg);
     } else if (brg.dt_a == data_type::f16) {
         kernel = new brgemm_kernel_f16_t(brg);
+    } else if (brg.dt_c == data_type::s32) {
+        kernel = new brgemm_kernel_s8_t(brg);
     } else {
         return status::unimplemented;
     }
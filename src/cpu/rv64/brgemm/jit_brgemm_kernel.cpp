@@ -1187,6 +1187,277 @@ void brgemm_kernel_bf16_t::operator()(brgemm_kernel_params_t *p) const {
     (*jit_kernel_)(p);
 }
 
+// =====================================================================
+// int8 JIT kernel: u8/s8 x u8/s8 -> s32 via widening integer MAC.
+// =====================================================================
+
+struct jit_brgemm_s8_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_s8_kernel_t)
+
+    jit_brgemm_s8_kernel_t(const brgemm_desc_t &brg)
+        : jit_generator_t("rv64_brgemm_kernel_s8_jit"), brg_(brg) {}
+
+    void operator()(brgemm_kernel_params_t *p) const {
+        jit_generator_t::operator()(p);
+    }
+
+    const brgemm_desc_t &get_brg() const { return brg_; }
+
+protected:
+    void generate() override;
+
+private:
+    brgemm_desc_t brg_;
+};
+
+void jit_brgemm_s8_kernel_t::generate() {
+#if defined(XBYAK_RISCV_V) && XBYAK_RISCV_V == 1
+    const dim_t LDA_bytes = brg_.LDA * brg_.typesize_A; // 8-bit → ×1
+    const dim_t LDB_bytes = brg_.LDB * brg_.typesize_B; // 8-bit → ×1
+    const dim_t LDC_bytes = brg_.LDC * brg_.typesize_C; // s32 → ×4
+    const dim_t N_stride_B = 4 * LDB_bytes;
+    const dim_t N_stride_C = 4 * LDC_bytes;
+
+    const bool use_single_b = (3 * LDB_bytes <= 2047);
+    const bool a_signed = brg_.dt_a == data_type::s8;
+    const bool b_signed = brg_.dt_b == data_type::s8;
+
+    const Reg reg_param = a0;
+    const Reg reg_tmp0 = a0;
+
+    const Reg reg_A = a1;
+    const Reg reg_n = a2;
+    const Reg reg_C = a3;
+    const Reg reg_k = a4;
+    const Reg reg_B0 = a5;
+    const Reg reg_B1 = a6;
+    const Reg reg_B2 = a7;
+
+    const Reg reg_lda = t0;
+    const Reg reg_ldb = t1;
+    const Reg reg_ldc = t2;
+    const Reg reg_K_val = t3;
+    const Reg reg_N = t4;
+    const Reg reg_beta = t5;
+    const Reg reg_tmp1 = t6;
+
+    const Reg reg_A_base = s0;
+    const Reg reg_B_base = s1;
+    const Reg reg_B3 = s2;
+    const Reg reg_M = s3;
+    const Reg reg_b0 = s4;
+    const Reg reg_b1 = s5;
+    const Reg reg_b2 = s6;
+    const Reg reg_b3 = s7;
+
+    const VReg v_c0(0);
+    const VReg v_c1(4);
+    const VReg v_c2(8);
+    const VReg v_c3(12);
+    const VReg v_a8(16); // e8 m1: raw A column
+    const VReg v_a(20); // e16 m2: A column widened to 16 bits
+    const VReg v_tmp(24);
+
+    // sp shrinks by 64 bytes: 8 callee-saved regs × 8 = 64,
+    // which keeps sp 16-byte aligned per the RISC-V LP64 ABI.
+    addi(sp, sp, -64);
+    sd(reg_A_base, sp, 0);
+    sd(reg_B_base, sp, 8);
+    sd(reg_B3, sp, 16);
+    sd(reg_M, sp, 24);
+    sd(reg_b0, sp, 32);
+    sd(reg_b1, sp, 40);
+    sd(reg_b2, sp, 48);
+    sd(reg_b3, sp, 56);
+
+    ld(reg_A_base, reg_param, 0);
+    ld(reg_B_base, reg_param, 8);
+    ld(reg_C, reg_param, 16);
+    ld(reg_N, reg_param, 24);
+    ld(reg_M, reg_param, 32);
+    ld(reg_K_val, reg_param, 40);
+    lw(reg_beta, reg_param, 48);
+
+    vsetvli(x0, reg_M, SEW::e32, LMUL::m4, VTA::ta, VMA::ma);
+
+    li(reg_lda, LDA_bytes);
+    li(reg_ldb, LDB_bytes);
+    li(reg_ldc, LDC_bytes);
+
+    // B values are sign- or zero-extended to XLEN by the scalar loads, so
+    // they are exact as e16 operands of vwmacc.vx.
+    auto emit_b_load = [&](const Reg &rd, const Reg &rs, int off) {
+        if (b_signed)
+            lb(rd, rs, off);
+        else
+            lbu(rd, rs, off);
+    };
+
+    // Loads one A column at e8 and widens it to e16. The products of two
+    // 8-bit values always fit into 16 bits, and vwmacc.vx accumulates them
+    // into the e32 accumulators. e8/m1, e16/m2 and e32/m4 share VLMAX, so
+    // vl is unchanged by the switches.
+    auto emit_a_load = [&]() {
+        vsetvli(x0, reg_M, SEW::e8, LMUL::m1, VTA::ta, VMA::ma);
+        vle8_v(v_a8, reg_A);
+        add(reg_A, reg_A, reg_lda);
+        vsetvli(x0, reg_M, SEW::e16, LMUL::m2, VTA::ta, VMA::ma);
+        if (a_signed)
+            vsext_vf2(v_a, v_a8);
+        else
+            vzext_vf2(v_a, v_a8);
+    };
+
+    auto emit_store = [&](const VReg &v_c) {
+        Label lbl_bz, lbl_done;
+        beq(reg_beta, x0, lbl_bz);
+        vle32_v(v_tmp, reg_tmp0);
+        vadd_vv(v_tmp, v_tmp, v_c);
+        vse32_v(v_tmp, reg_tmp0);
+        j_(lbl_done);
+        L(lbl_bz);
+        vse32_v(v_c, reg_tmp0);
+        L(lbl_done);
+    };
+
+    mv(reg_n, x0);
+
+    Label lbl_n_loop, lbl_n_tail_loop, lbl_n_end;
+
+    L(lbl_n_loop);
+    addi(reg_tmp0, reg_n, 4);
+    blt(reg_N, reg_tmp0, lbl_n_tail_loop);
+
+    mv(reg_A, reg_A_base);
+    mv(reg_B0, reg_B_base);
+    if (!use_single_b) {
+        add(reg_B1, reg_B_base, reg_ldb);
+        add(reg_B2, reg_B1, reg_ldb);
+        add(reg_B3, reg_B2, reg_ldb);
+    }
+
+    vmv_v_i(v_c0, 0);
+    vmv_v_i(v_c1, 0);
+    vmv_v_i(v_c2, 0);
+    vmv_v_i(v_c3, 0);
+
+    mv(reg_k, x0);
+    {
+        Label lbl_k, lbl_k_end;
+        L(lbl_k);
+        bge(reg_k, reg_K_val, lbl_k_end);
+
+        emit_a_load();
+        emit_b_load(reg_b0, reg_B0, 0);
+        if (use_single_b) {
+            emit_b_load(reg_b1, reg_B0, LDB_bytes);
+            emit_b_load(reg_b2, reg_B0, 2 * LDB_bytes);
+            emit_b_load(reg_b3, reg_B0, 3 * LDB_bytes);
+        } else {
+            emit_b_load(reg_b1, reg_B1, 0);
+            emit_b_load(reg_b2, reg_B2, 0);
+            emit_b_load(reg_b3, reg_B3, 0);
+        }
+        vwmacc_vx(v_c0, reg_b0, v_a);
+        vwmacc_vx(v_c1, reg_b1, v_a);
+        vwmacc_vx(v_c2, reg_b2, v_a);
+        vwmacc_vx(v_c3, reg_b3, v_a);
+
+        addi(reg_B0, reg_B0, 1);
+        if (!use_single_b) {
+            addi(reg_B1, reg_B1, 1);
+            addi(reg_B2, reg_B2, 1);
+            addi(reg_B3, reg_B3, 1);
+        }
+        addi(reg_k, reg_k, 1);
+        j_(lbl_k);
+        L(lbl_k_end);
+    }
+
+    vsetvli(x0, reg_M, SEW::e32, LMUL::m4, VTA::ta, VMA::ma);
+
+    mv(reg_tmp0, reg_C);
+    emit_store(v_c0);
+    add(reg_tmp0, reg_tmp0, reg_ldc);
+    emit_store(v_c1);
+    add(reg_tmp0, reg_tmp0, reg_ldc);
+    emit_store(v_c2);
+    add(reg_tmp0, reg_tmp0, reg_ldc);
+    emit_store(v_c3);
+
+    li(reg_tmp1, N_stride_B);
+    add(reg_B_base, reg_B_base, reg_tmp1);
+    li(reg_tmp1, N_stride_C);
+    add(reg_C, reg_C, reg_tmp1);
+
+    addi(reg_n, reg_n, 4);
+    j_(lbl_n_loop);
+
+    // ---- N tail: 1 column at a time ----
+    L(lbl_n_tail_loop);
+    bge(reg_n, reg_N, lbl_n_end);
+
+    mv(reg_A, reg_A_base);
+    mv(reg_B0, reg_B_base);
+    vmv_v_i(v_c0, 0);
+
+    mv(reg_k, x0);
+    {
+        Label lbl_k, lbl_k_end;
+        L(lbl_k);
+        bge(reg_k, reg_K_val, lbl_k_end);
+        emit_a_load();
+        emit_b_load(reg_b0, reg_B0, 0);
+        vwmacc_vx(v_c0, reg_b0, v_a);
+        addi(reg_B0, reg_B0, 1);
+        addi(reg_k, reg_k, 1);
+        j_(lbl_k);
+        L(lbl_k_end);
+    }
+
+    vsetvli(x0, reg_M, SEW::e32, LMUL::m4, VTA::ta, VMA::ma);
+
+    mv(reg_tmp0, reg_C);
+    emit_store(v_c0);
+
+    add(reg_B_base, reg_B_base, reg_ldb);
+    add(reg_C, reg_C, reg_ldc);
+
+    addi(reg_n, reg_n, 1);
+    j_(lbl_n_tail_loop);
+
+    L(lbl_n_end);
+
+    ld(reg_A_base, sp, 0);
+    ld(reg_B_base, sp, 8);
+    ld(reg_B3, sp, 16);
+    ld(reg_M, sp, 24);
+    ld(reg_b0, sp, 32);
+    ld(reg_b1, sp, 40);
+    ld(reg_b2, sp, 48);
+    ld(reg_b3, sp, 56);
+    addi(sp, sp, 64);
+    ret();
+#else
+    ret();
+#endif
+}
+
+brgemm_kernel_s8_t::brgemm_kernel_s8_t(const brgemm_desc_t &brg)
+    : brg_(brg), jit_kernel_(new jit_brgemm_s8_kernel_t(brg)) {}
+
+brgemm_kernel_s8_t::~brgemm_kernel_s8_t() {
+    delete jit_kernel_;
+}
+
+status_t brgemm_kernel_s8_t::create_kernel() {
+    return jit_kernel_->create_kernel();
+}
+
+void brgemm_kernel_s8_t::operator()(brgemm_kernel_params_t *p) const {
+    (*jit_kernel_)(p);
+}
+
 } // namespace rv64
 } // namespace cpu
 } // namespace impl
@@ -15,6 +15,8 @@
 *******************************************************************************/
 #include <cstring>
 
+#include <cmath>
+
 #include "cpu/rv64/injectors/jit_uni_eltwise_injector.hpp"
 
 namespace dnnl {
@@ -26,6 +28,15 @@ using namespace Xbyak_riscv;
 
 namespace eltwise_injector {
 
+namespace {
+// Largest |beta| of an integer-exponent pow computed by repeated squaring
+constexpr float max_pow_int_exponent = 64.f;
+
+bool is_int_exponent(float beta) {
+    return std::isfinite(beta) && std::trunc(beta) == beta;
+}
+} // namespace
+
 bool is_alg_supported(alg_kind_t alg) {
     using namespace alg_kind;
     switch (alg) {
@@ -44,11 +55,31 @@ bool is_alg_supported(alg_kind_t alg) {
         case eltwise_tanh:
         case eltwise_elu:
         case eltwise_swish:
-        case eltwise_gelu_tanh: return true;
+        case eltwise_gelu_tanh:
+        case eltwise_gelu_erf:
+        case eltwise_mish:
+        // built on the inline-coefficient log() primitive (and exp())
+        case eltwise_log:
+        case eltwise_soft_relu:
+        case eltwise_pow:
+        // arithmetic, rounding through the float <-> int conversions
+        case eltwise_clip_v2:
+        case eltwise_round: return true;
         default: return false;
     }
 }
 
+bool is_supported(alg_kind_t alg, float alpha, float beta) {
+    using namespace alg_kind;
+    if (!is_alg_supported(alg)) return false;
+    // pow with an odd integer exponent needs the sign of x, which only the
+    // multiplication chain keeps; exp(beta * log|x|) drops it.
+    if (alg == eltwise_pow && is_int_exponent(beta)
+            && std::fabs(beta) > max_pow_int_exponent)
+        return std::fmod(beta, 2.f) == 0.f;
+    return true;
+}
+
 } // namespace eltwise_injector
 
 template <cpu_isa_t isa>
@@ -144,6 +175,138 @@ void jit_uni_eltwise_injector_t<isa>::logistic_compute_vector(const Vmm &v) {
     h_->vfrdiv_vf(v, v, f_aux0_); // 1 / (1 + exp(-x))
 }
 
+// log(x) + v_aux1_ via frexp-style range reduction (m in [sqrt(2)/2,
+// sqrt(2))) + the degree-4 minimax polynomial in s = f / (2 + f) (the classic
+// fdlibm/musl logf), with constants materialized inline. The addend in v_aux1_
+// lets callers fold a term into the result for free (the NaN/-inf guard of
+// log(), max(x, 0) of soft_relu); pass 0 otherwise. Uses all three aux vector
+// groups. Inputs are expected positive and finite; +inf comes out finite.
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_t<isa>::log_compute_vector(const Vmm &v) {
+    const Vmm &a0 = v_aux0_; // result accumulator
+    const Vmm &a1 = v_aux1_; // addend, then s = f / (2 + f)
+    const Vmm &a2 = v_aux2_; // biased bits, then f, then z = s^2
+
+    // shift the bits so that the mantissa lands in [sqrt(2)/2, sqrt(2)):
+    // k = exponent of (bits + (1.0f - sqrt(2)/2)), m = its mantissa
+    h_->li(gpr_aux0_, 0x3f800000 - 0x3f3504f3);
+    h_->vadd_vx(a2, v, gpr_aux0_);
+    h_->li(gpr_aux0_, 23);
+    h_->vsra_vx(a0, a2, gpr_aux0_);
+    h_->li(gpr_aux0_, 127);
+    h_->vsub_vx(a0, a0, gpr_aux0_);
+    h_->vfcvt_f_x_v(a0, a0); // k
+    load_f32_const(f_aux0_, 0.693147180559945f); // ln2
+    h_->vfmul_vf(a0, a0, f_aux0_); // k*ln2
+    h_->vfadd_vv(a0, a0, a1); // + addend
+
+    h_->li(gpr_aux0_, 0x007fffff);
+    h_->vand_vx(a2, a2, gpr_aux0_);
+    h_->li(gpr_aux0_, 0x3f3504f3);
+    h_->vadd_vx(a2, a2, gpr_aux0_); // m
+    load_f32_const(f_aux0_, 1.f);
+    h_->vfsub_vf(a2, a2, f_aux0_); // f = m - 1
+    h_->vfadd_vv(a0, a0, a2); // + f
+
+    load_f32_const(f_aux0_, 2.f);
+    h_->vfadd_vf(a1, a2, f_aux0_);
+    h_->vfdiv_vv(a1, a2, a1); // s = f / (2 + f)
+    h_->vfmul_vv(v, a2, a2);
+    load_f32_const(f_aux0_, 0.5f);
+    h_->vfmul_vf(v, v, f_aux0_); // hfsq = f^2 / 2
+    h_->vfsub_vv(a0, a0, v); // - hfsq
+    h_->vfmacc_vv(a0, a1, v); // + s*hfsq
+
+    // R = z*(Lg1 + z*(Lg2 + z*(Lg3 + z*Lg4))), z = s^2
+    h_->vfmul_vv(a2, a1, a1);
+    load_f32_const(f_aux0_, 0.24279078841f); // Lg4
+    h_->vfmv_v_f(v, f_aux0_);
+    const float lg[] = {0.28498786688f, 0.40000972152f, 0.66666662693f};
+    for (float c : lg) {
+        h_->vfmul_vv(v, v, a2);
+        load_f32_const(f_aux0_, c);
+        h_->vfadd_vf(v, v, f_aux0_);
+    }
+    h_->vfmul_vv(v, v, a2); // R
+    h_->vfmacc_vv(a0, a1, v); // + s*R
+    h_->vmv_v_v(v, a0);
+}
+
+// v_aux1_ = (x < 0 ? NaN : 0) + (x == +-0 ? -inf : 0), the addend that gives
+// log() its special values below zero. Leaves v untouched.
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_t<isa>::log_guard(const Vmm &v) {
+    load_f32_const(f_aux0_, 0.f);
+    h_->vfmin_vf(v_aux1_, v, f_aux0_);
+    h_->vfsqrt_v(v_aux1_, v_aux1_); // NaN for x < 0, +-0 otherwise
+    // (|bits| - 1) >> 31 is all ones only for +-0, which selects -inf
+    h_->li(gpr_aux0_, 0x7fffffff);
+    h_->vand_vx(v_aux0_, v, gpr_aux0_);
+    h_->li(gpr_aux0_, 1);
+    h_->vsub_vx(v_aux0_, v_aux0_, gpr_aux0_);
+    h_->li(gpr_aux0_, 31);
+    h_->vsra_vx(v_aux0_, v_aux0_, gpr_aux0_);
+    h_->li(gpr_aux0_, 0xff800000);
+    h_->vand_vx(v_aux0_, v_aux0_, gpr_aux0_);
+    h_->vfadd_vv(v_aux1_, v_aux1_, v_aux0_);
+}
+
+// alpha * x^beta. Integer exponents up to max_pow_int_exponent go through
+// repeated squaring, which is exact in sign; the rest use exp(beta * log(x))
+// on |x| for even integer exponents and on x otherwise (NaN for x < 0 as in
+// powf). is_supported() rejects the odd integer exponents this cannot handle.
+template <cpu_isa_t isa>
+void jit_uni_eltwise_injector_t<isa>::pow_compute_vector(const Vmm &v) {
+    using namespace eltwise_injector;
+    const Vmm &a0 = v_aux0_;
+
+    if (beta_ == 0.f) {
+        load_f32_const(f_aux0_, alpha_);
+        h_->vfmv_v_f(v, f_aux0_);
+        return;
+    }
+
+    if (beta_ == 0.5f) {
+        h_->vfsqrt_v(v, v);
+    } else if (is_int_exponent(beta_)
+            && std::fabs(beta_) <= max_pow_int_exponent) {
+        load_f32_const(f_aux0_, 1.f);
+        h_->vfmv_v_f(a0, f_aux0_);
+        for (int n = static_cast<int>(std::fabs(beta_)); n > 0; n >>= 1) {
+            if (n & 1) h_->vfmul_vv(a0, a0, v);
+            if (n > 1) h_->vfmul_vv(v, v, v);
+        }
+        h_->vmv_v_v(v, a0);
+        if (beta_ < 0.f) {
+            load_f32_const(f_aux0_, 1.f);
+            h_->vfrdiv_vf(v, v, f_aux0_);
+        }
+    } else {
+        if (is_int_exponent(beta_)) {
+            h_->li(gpr_aux0_, 0x7fffffff);
+            h_->vand_vx(v, v, gpr_aux0_); // |x|, the exponent is even
+        }
+        // NaN below zero only: +-0 comes out of log() as ~-88, which exp()
+        // then saturates to 0 (or to ~FLT_MAX for beta < 0)
+        load_f32_const(f_aux0_, 0.f);
+        h_->vfmin_vf(v_aux1_, v, f_aux0_);
+        h_->vfsqrt_v(v_aux1_, v_aux1_);
+        log_compute_vector(v);
+        load_f32_const(f_aux0_, beta_);
+        h_->vfmul_vf(v, v, f_aux0_);
+        // exp() clamps NaN away, so carry it around the call as NaN * 0
+        load_f32_const(f_aux0_, 0.f);
+        h_->vfmul_vf(v_aux1_, v, f_aux0_);
+        exp_compute_vector(v);
+        h_->vfadd_vv(v, v, v_aux1_);
+    }
+
+    if (alpha_ != 1.f) {
+        load_f32_const(f_aux0_, alpha_);
+        h_->vfmul_vf(v, v, f_aux0_);
+    }
+}
+
 // Backward: transform a register holding `s` into alg'(s). Uses v0 as the RVV
 // mask register (the standalone eltwise primitive keeps v0 free) plus the two
 // aux vector groups. The caller multiplies the resulting alg'(s) by diff_dst.
@@ -427,6 +590,111 @@ void jit_uni_eltwise_injector_t<isa>::compute_body(const Vmm &v) {
             h_->vfmul_vf(v, v, f_aux0_); // 0.5*x*(1+tanh)
             break;
 
+        case eltwise_gelu_erf:
+            // 0.5*x*(1 + erf(x/sqrt(2))), with erf(s) from Abramowitz-Stegun
+            // 7.1.26: sign(s)*(1 - t*P(t)*exp(-s^2)), t = 1/(1 + p*|s|)
+            load_f32_const(f_aux0_, 0.70710678118654752f); // 1/sqrt(2)
+            h_->vfmul_vf(v, v, f_aux0_); // s
+            h_->vmv_v_v(v_aux1_, v); // save s
+            h_->vfmul_vv(v, v, v);
+            h_->vfneg_v(v, v);
+            exp_compute_vector(v); // exp(-s^2)
+            h_->vfabs_v(v_aux0_, v_aux1_);
+            load_f32_const(f_aux0_, 0.3275911f); // p
+            h_->vfmul_vf(v_aux0_, v_aux0_, f_aux0_);
+            load_f32_const(f_aux0_, 1.f);
+            h_->vfadd_vf(v_aux0_, v_aux0_, f_aux0_);
+            h_->vfrdiv_vf(v_aux0_, v_aux0_, f_aux0_); // t
+            load_f32_const(f_aux0_, 1.061405429f);
+            h_->vfmv_v_f(v_aux2_, f_aux0_);
+            {
+                const float c[]
+                        = {-1.453152027f, 1.421413741f, -0.284496736f,
+                                0.254829592f};
+                for (float ci : c) {
+                    h_->vfmul_vv(v_aux2_, v_aux2_, v_aux0_);
+                    load_f32_const(f_aux0_, ci);
+                    h_->vfadd_vf(v_aux2_, v_aux2_, f_aux0_);
+                }
+            }
+            h_->vfmul_vv(v_aux2_, v_aux2_, v_aux0_); // t*P(t)
+            h_->vfmul_vv(v, v, v_aux2_);
+            load_f32_const(f_aux0_, 1.f);
+            h_->vfrsub_vf(v, v, f_aux0_); // erf(|s|)
+            h_->vfsgnj_vv(v, v, v_aux1_); // erf(s)
+            h_->vfadd_vf(v, v, f_aux0_); // 1 + erf(s)
+            h_->vfmul_vv(v, v, v_aux1_);
+            load_f32_const(f_aux0_, 0.70710678118654752f);
+            h_->vfmul_vf(v, v, f_aux0_); // s/sqrt(2) = x/2
+            break;
+
+        case eltwise_mish:
+            // x * tanh(log(1 + e)) = x * n / (n + 2), n = e*(e + 2), e =
+            // exp(x); exp() saturates past x = 20 where the ratio is 1
+            h_->vmv_v_v(v_aux1_, v); // save x
+            load_f32_const(f_aux0_, 20.f);
+            h_->vfmin_vf(v, v, f_aux0_);
+            exp_compute_vector(v); // e
+            load_f32_const(f_aux0_, 2.f);
+            h_->vfadd_vf(v_aux0_, v, f_aux0_);
+            h_->vfmul_vv(v, v, v_aux0_); // n
+            h_->vfadd_vf(v_aux0_, v, f_aux0_);
+            h_->vfdiv_vv(v, v, v_aux0_);
+            h_->vfmul_vv(v, v, v_aux1_);
+            break;
+
+        case eltwise_log:
+            log_guard(v);
+            log_compute_vector(v);
+            break;
+
+        case eltwise_soft_relu: {
+            // log(1 + exp(alpha*x)) / alpha, computed as max(t, 0) +
+            // log1p(exp(-|t|)) with t = alpha*x so that it never overflows.
+            // log1p(e) = log(u) + (e - (u - 1)) / u, u = 1 + e, keeps the
+            // small e (t << 0) that 1 + e rounds away.
+            load_f32_const(f_aux0_, alpha_);
+            h_->vfmul_vf(v, v, f_aux0_); // t
+            load_f32_const(f_aux0_, 0.f);
+            h_->vfmax_vf(v_aux1_, v, f_aux0_); // max(t, 0)
+            h_->li(gpr_aux0_, 0x80000000);
+            h_->vor_vx(v, v, gpr_aux0_); // -|t|
+            exp_compute_vector(v); // e
+            load_f32_const(f_aux0_, 1.f);
+            h_->vfadd_vf(v_aux0_, v, f_aux0_); // u
+            h_->vfsub_vf(v_aux2_, v_aux0_, f_aux0_);
+            h_->vfsub_vv(v_aux2_, v, v_aux2_);
+            h_->vfdiv_vv(v_aux2_, v_aux2_, v_aux0_);
+            h_->vfadd_vv(v_aux1_, v_aux1_, v_aux2_);
+            h_->vmv_v_v(v, v_aux0_);
+            log_compute_vector(v);
+            load_f32_const(f_aux0_, 1.f / alpha_);
+            h_->vfmul_vf(v, v, f_aux0_);
+            break;
+        }
+
+        case eltwise_pow: pow_compute_vector(v); break;
+
+        case eltwise_clip_v2:
+            // clamp(x, alpha, beta); differs from clip only in backward
+            clamp(v, alpha_, beta_);
+            break;
+
+        case eltwise_round: {
+            // round half to even through the float -> int conversion (frm is
+            // RNE by default). x is clamped to +-2^23 first, where floats are
+            // already integral, and only the rounding difference is added
+            // back so that larger values and NaN pass through unchanged.
+            constexpr float big = 8388608.f; // 2^23
+            h_->vmv_v_v(v_aux0_, v);
+            clamp(v_aux0_, -big, big);
+            h_->vfcvt_x_f_v(v_aux2_, v_aux0_);
+            h_->vfcvt_f_x_v(v_aux2_, v_aux2_);
+            h_->vfsub_vv(v_aux2_, v_aux2_, v_aux0_);
+            h_->vfadd_vv(v, v, v_aux2_);
+            break;
+        }
+
         default: assert(!"unsupported eltwise alg"); break;
     }
 
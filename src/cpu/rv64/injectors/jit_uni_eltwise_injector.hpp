@@ -52,8 +52,9 @@ struct static_params_t {
         , is_fwd(is_fwd) {}
 
     // Up to three vector scratch groups (same LMUL as the host accumulator).
-    // Forward arithmetic algorithms use at most v_aux0; exp/logistic use
-    // v_aux0 and v_aux2; tanh/elu/swish/gelu_tanh use all three. Backward
+    // Forward arithmetic algorithms use at most v_aux0 (round uses v_aux0 and
+    // v_aux2); exp/logistic use v_aux0 and v_aux2; the other transcendentals
+    // use all three. Backward
     // derivatives may use v_aux0 and v_aux1 plus v0 as a mask.
     Xbyak_riscv::VReg v_aux0, v_aux1, v_aux2;
     Xbyak_riscv::FReg f_aux0, f_aux1; // two FP scratch regs for constants
@@ -64,13 +65,16 @@ struct static_params_t {
     bool is_fwd;
 };
 
-// Whether the JIT eltwise injector can emit this algorithm. Covers the
-// mask-free arithmetic forward algorithms plus the transcendentals built on the
-// inline-coefficient exp() primitive (exp/logistic/tanh/elu/swish/gelu_tanh).
-// Algorithms still needing log/erf (mish, gelu_erf, soft_relu, pow) are not yet
-// supported and fall back to a reference impl (the consumer pd rejects them).
+// Whether the JIT eltwise injector can emit this forward algorithm. Covers the
+// mask-free arithmetic algorithms plus the transcendentals built on the
+// inline-coefficient exp() and log() primitives, i.e. every forward eltwise
+// algorithm except the *_use_dst_for_bwd ones.
 bool is_alg_supported(alg_kind_t alg);
 
+// is_alg_supported() refined by the algorithm parameters: pow with an odd
+// integer exponent above 64 is not supported.
+bool is_supported(alg_kind_t alg, float alpha, float beta);
+
 } // namespace eltwise_injector
 
 // In-kernel forward eltwise post-op injector for RVV.
@@ -98,7 +102,7 @@ struct jit_uni_eltwise_injector_t {
         , f_aux0_(sp.f_aux0)
         , f_aux1_(sp.f_aux1)
         , gpr_aux0_(sp.gpr_aux0) {
-        assert(eltwise_injector::is_alg_supported(alg_));
+        assert(eltwise_injector::is_supported(alg_, alpha_, beta_));
     }
 
     jit_uni_eltwise_injector_t(jit_generator_t *host,
@@ -128,6 +132,12 @@ private:
     void exp_compute_vector(const Vmm &v);
     // sigmoid(v) = 1 / (1 + exp(-v)), in place. Uses the exp building block.
     void logistic_compute_vector(const Vmm &v);
+    // log(v) + v_aux1 in place. Uses all three aux vector groups. Building
+    // block for log/soft_relu/pow.
+    void log_compute_vector(const Vmm &v);
+    // Sets v_aux1 to the addend that gives log(v) its values for v <= 0.
+    void log_guard(const Vmm &v);
+    void pow_compute_vector(const Vmm &v);
 
     const alg_kind_t alg_;
     const float alpha_;
@@ -93,7 +93,8 @@ bool jit_uni_postops_injector_t<isa>::post_ops_ok(const post_ops_t &post_ops) {
     for (int i = 0; i < post_ops.len(); i++) {
         const auto &e = post_ops.entry_[i];
         if (e.is_eltwise()) {
-            if (!eltwise_injector::is_alg_supported(e.eltwise.alg))
+            if (!eltwise_injector::is_supported(
+                        e.eltwise.alg, e.eltwise.alpha, e.eltwise.beta))
                 return false;
         } else if (e.is_binary()) {
             if (!binary_injector::is_alg_supported(e.binary.alg)) return false;
@@ -93,12 +93,13 @@ struct jit_uni_eltwise_fwd_t : public primitive_t {
 
         bool use_dense_;
 
-        // Forward exposes every alg the eltwise injector implements (the 8
-        // arithmetic ones plus exp/logistic/tanh/elu/swish/gelu_tanh); the
+        // Forward exposes every alg the eltwise injector implements (the
+        // arithmetic ones plus the exp/log based transcendentals); the
         // kernel feeds alg + alpha/beta straight to the injector. Backward is
         // narrower (see below) — only the algs with an implemented derivative.
         bool check_alg_kind() const {
-            return eltwise_injector::is_alg_supported(desc()->alg_kind);
+            return eltwise_injector::is_supported(
+                    desc()->alg_kind, desc()->alpha, desc()->beta);
         }
     };
 
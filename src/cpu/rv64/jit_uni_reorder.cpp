@@ -0,0 +1,236 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/rv64/cpu_isa_traits.hpp"
+#include "cpu/rv64/jit_uni_reorder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+using namespace Xbyak_riscv;
+
+void jit_uni_reorder_kernel_t::generate() {
+#if defined(XBYAK_RISCV_V) && XBYAK_RISCV_V == 1
+    const Reg reg_param = a0;
+    const Reg reg_src = a1;
+    const Reg reg_dst = a2;
+    const Reg reg_len = a3;
+    const Reg reg_stride = a4;
+    const Reg reg_vl = t0;
+    const Reg reg_bytes = t1;
+
+    const VReg v_data(0);
+
+    const SEW sew = dt_size_ == 4 ? SEW::e32
+            : dt_size_ == 2       ? SEW::e16
+                                  : SEW::e8;
+    const int shift = dt_size_ == 4 ? 2 : dt_size_ == 2 ? 1 : 0;
+    const bool is_unit = src_stride_ == static_cast<dim_t>(dt_size_);
+
+    // call_params_t layout:
+    //  0: src, 8: dst, 16: len
+    ld(reg_src, reg_param, 0);
+    ld(reg_dst, reg_param, 8);
+    ld(reg_len, reg_param, 16);
+    if (!is_unit) li(reg_stride, src_stride_);
+
+    Label loop, done;
+    L(loop);
+    beqz(reg_len, done);
+    vsetvli(reg_vl, reg_len, sew, LMUL::m8);
+    if (is_unit) {
+        if (dt_size_ == 4)
+            vle32_v(v_data, reg_src);
+        else if (dt_size_ == 2)
+            vle16_v(v_data, reg_src);
+        else
+            vle8_v(v_data, reg_src);
+    } else {
+        if (dt_size_ == 4)
+            vlse32_v(v_data, reg_src, reg_stride);
+        else if (dt_size_ == 2)
+            vlse16_v(v_data, reg_src, reg_stride);
+        else
+            vlse8_v(v_data, reg_src, reg_stride);
+    }
+    if (dt_size_ == 4)
+        vse32_v(v_data, reg_dst);
+    else if (dt_size_ == 2)
+        vse16_v(v_data, reg_dst);
+    else
+        vse8_v(v_data, reg_dst);
+
+    if (shift)
+        slli(reg_bytes, reg_vl, shift);
+    else
+        mv(reg_bytes, reg_vl);
+    add(reg_dst, reg_dst, reg_bytes);
+    if (is_unit) {
+        add(reg_src, reg_src, reg_bytes);
+    } else {
+        mul(reg_bytes, reg_vl, reg_stride);
+        add(reg_src, reg_src, reg_bytes);
+    }
+    sub(reg_len, reg_len, reg_vl);
+    j_(loop);
+
+    L(done);
+    ret();
+#else
+    ret();
+#endif
+}
+
+status_t jit_uni_reorder_t::pd_t::init(
+        engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
+    using namespace data_type;
+    CHECK(cpu_reorder_pd_t::init(engine, src_engine, dst_engine));
+
+    const memory_desc_wrapper id(src_md()), od(dst_md());
+
+    VDISPATCH_REORDER(mayiuse(v), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_REORDER(id.data_type() == od.data_type()
+                    && utils::one_of(id.data_type(), f32, bf16, s8),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_REORDER(
+            attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_REORDER(id.is_blocking_desc() && od.is_blocking_desc(),
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_REORDER(!id.has_runtime_dims_or_strides()
+                    && !od.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(id.extra().flags == memory_extra_flags::none
+                    && od.extra().flags == memory_extra_flags::none,
+            VERBOSE_UNSUPPORTED_MD_FLAG, "extra");
+
+    const int ndims = id.ndims();
+    VDISPATCH_REORDER(ndims > 0, VERBOSE_BAD_NDIMS, "src", ndims);
+    for (int d = 0; d < ndims; d++) {
+        VDISPATCH_REORDER(id.padded_dims()[d] == id.dims()[d]
+                        && od.padded_dims()[d] == od.dims()[d],
+                VERBOSE_UNSUPPORTED_PAD_FEATURE, "padded dims");
+    }
+
+    // The destination row: the innermost block, or else the unit stride
+    // dimension (the innermost non-trivial one if several have unit stride)
+    const auto &dst_blk = od.blocking_desc();
+    row_dim_ = -1;
+    if (dst_blk.inner_nblks > 0) {
+        const int last = dst_blk.inner_nblks - 1;
+        row_dim_ = static_cast<int>(dst_blk.inner_idxs[last]);
+        row_len_ = dst_blk.inner_blks[last];
+    } else {
+        for (int d = ndims - 1; d >= 0; d--) {
+            if (dst_blk.strides[d] != 1) continue;
+            if (row_dim_ < 0 || od.dims()[d] > 1) row_dim_ = d;
+            if (od.dims()[d] > 1) break;
+        }
+        VDISPATCH_REORDER(row_dim_ >= 0, VERBOSE_UNSUPPORTED_TAG);
+        row_len_ = od.dims()[row_dim_];
+    }
+
+    const auto &src_blk = id.blocking_desc();
+    for (int i = 0; i < src_blk.inner_nblks; i++)
+        VDISPATCH_REORDER(src_blk.inner_idxs[i] != row_dim_,
+                VERBOSE_UNSUPPORTED_TAG);
+    src_row_stride_ = src_blk.strides[row_dim_];
+
+    return status::success;
+}
+
+status_t jit_uni_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
+        engine_t *engine, const primitive_attr_t *attr, engine_t *src_engine,
+        const memory_desc_t *src_md, engine_t *dst_engine,
+        const memory_desc_t *dst_md) {
+    auto _pd = make_unique_pd<pd_t>(
+            attr, src_engine->kind(), src_md, dst_engine->kind(), dst_md);
+    if (_pd == nullptr) return status::out_of_memory;
+    CHECK(_pd->init(engine, src_engine, dst_engine));
+    CHECK(_pd->init_scratchpad_md());
+    return safe_ptr_assign<reorder_pd_t>(*reorder_pd, _pd.release());
+}
+
+status_t jit_uni_reorder_t::init(engine_t *engine) {
+    UNUSED(engine);
+    const size_t dt_size = types::data_type_size(pd()->src_md()->data_type);
+    kernel_.reset(new jit_uni_reorder_kernel_t(
+            dt_size, pd()->src_row_stride_ * static_cast<dim_t>(dt_size)));
+    return status::success;
+}
+
+status_t jit_uni_reorder_t::execute(const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
+    auto *dst = CTX_OUT_MEM(char *, DNNL_ARG_TO);
+
+    const memory_desc_wrapper id(pd()->src_md()), od(pd()->dst_md());
+    const size_t dt_size = types::data_type_size(id.data_type());
+    const int ndims = id.ndims();
+    const int row_dim = pd()->row_dim_;
+    const dim_t row_len = pd()->row_len_;
+
+    // Rows are enumerated over the logical dimensions with the row one
+    // counted in rows
+    dims_t rows_dims;
+    utils::array_copy(rows_dims, id.dims(), ndims);
+    rows_dims[row_dim] /= row_len;
+    const dim_t nrows = utils::array_product(rows_dims, ndims);
+    if (nrows == 0) return status::success;
+
+    parallel(0, [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(nrows, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        dims_t pos;
+        dim_t rem = start;
+        for (int d = ndims - 1; d >= 0; d--) {
+            pos[d] = rem % rows_dims[d];
+            rem /= rows_dims[d];
+        }
+
+        dims_t idx;
+        jit_uni_reorder_kernel_t::call_params_t p;
+        p.len = row_len;
+        for (dim_t r = start; r < end; r++) {
+            utils::array_copy(idx, pos, ndims);
+            idx[row_dim] *= row_len;
+            p.src = src + id.off_v(idx) * dt_size;
+            p.dst = dst + od.off_v(idx) * dt_size;
+            (*kernel_)(&p);
+
+            for (int d = ndims - 1; d >= 0; d--) {
+                if (++pos[d] < rows_dims[d]) break;
+                pos[d] = 0;
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
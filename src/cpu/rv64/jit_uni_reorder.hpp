@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_RV64_JIT_UNI_REORDER_HPP
+#define CPU_RV64_JIT_UNI_REORDER_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/reorder/cpu_reorder_pd.hpp"
+
+#include "cpu/rv64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace rv64 {
+
+// Copies `len` elements of `dt_size` bytes from src, `src_stride` bytes
+// apart, to contiguous dst. A unit src stride is a plain vector copy.
+struct jit_uni_reorder_kernel_t : public jit_generator_t {
+    struct call_params_t {
+        const void *src;
+        void *dst;
+        dim_t len;
+    };
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reorder_kernel_t)
+
+    jit_uni_reorder_kernel_t(size_t dt_size, dim_t src_stride)
+        : jit_generator_t("jit_uni_reorder_kernel")
+        , dt_size_(dt_size)
+        , src_stride_(src_stride) {
+        create_kernel();
+    }
+
+    void operator()(const call_params_t *p) const {
+        jit_generator_t::operator()(p);
+    }
+
+protected:
+    void generate() override;
+
+private:
+    const size_t dt_size_;
+    const dim_t src_stride_;
+};
+
+// Same data type reorder between plain and blocked layouts. The destination
+// is walked in rows along its innermost contiguous run (the innermost block,
+// or the unit stride dimension of a plain layout), which the source must not
+// block, so that each row is one strided gather from the source. This covers
+// plain transposes (nchw <-> nhwc, ab <-> ba) and plain <-> blocked
+// conversions (nchw <-> nChw16c, oihw -> OIhw16i16o).
+struct jit_uni_reorder_t : public primitive_t {
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+
+        DECLARE_COMMON_PD_T("jit:rvv", jit_uni_reorder_t);
+
+        status_t init(
+                engine_t *engine, engine_t *src_engine, engine_t *dst_engine);
+
+        // Logical dimension and length of a destination row, and the source
+        // stride along it (in elements)
+        int row_dim_ = 0;
+        dim_t row_len_ = 0;
+        dim_t src_row_stride_ = 0;
+
+    private:
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md);
+
+        friend dnnl::impl::impl_list_item_t;
+    };
+
+    jit_uni_reorder_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<jit_uni_reorder_kernel_t> kernel_;
+};
+
+} // namespace rv64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_RV64_JIT_UNI_REORDER_HPP
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -22,6 +22,10 @@
 #include "common/utils.hpp"
 #include "common/verbose.hpp"
 
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/scale_utils.hpp"
+
 #include "cpu/rv64/brgemm/brgemm.hpp"
 #include "cpu/rv64/rvv_brgemm_inner_product.hpp"
 
@@ -45,14 +49,25 @@ status_t rvv_brgemm_inner_product_fwd_t::pd_t::init(engine_t *engine) {
     const auto wei_type = weights_md(0)->data_type;
     const auto dst_type = dst_md(0)->data_type;
     const auto bia_type = weights_md(1)->data_type;
-    const bool types_ok = src_type == f32 && wei_type == f32 && dst_type == f32
-            && IMPLICATION(with_bias(), bia_type == f32);
+    // Accepted: f32/f32/f32, f16/f16/f32 (Zvfh) and u8|s8/s8/f32|s32|s8|u8.
+    const bool is_fp = dst_type == f32
+            && (everyone_is(f32, src_type, wei_type)
+                    || (everyone_is(f16, src_type, wei_type)
+                            && mayiuse(zvfh)));
+    is_int8_ = one_of(src_type, u8, s8) && wei_type == s8
+            && one_of(dst_type, f32, s32, s8, u8);
+    const bool types_ok
+            = (is_fp || is_int8_) && IMPLICATION(with_bias(), bia_type == f32);
     VDISPATCH_INNER_PRODUCT(types_ok, VERBOSE_UNSUPPORTED_DT);
 
-    // No post-ops supported
-    VDISPATCH_INNER_PRODUCT(
-            attr()->has_default_values(primitive_attr_t::skip_mask_t::none),
+    // No post-ops supported, int8 supports scales
+    using smask_t = primitive_attr_t::skip_mask_t;
+    VDISPATCH_INNER_PRODUCT(attr()->has_default_values(is_int8_
+                                            ? smask_t::scales
+                                            : smask_t::none,
+                                    dst_type),
             VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_INNER_PRODUCT(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
 
     // Only support 2D tensors
     VDISPATCH_INNER_PRODUCT(src_md(0)->ndims == 2, VERBOSE_UNSUPPORTED_TAG);
@@ -125,34 +140,64 @@ status_t rvv_brgemm_inner_product_fwd_t::pd_t::init(engine_t *engine) {
     const dim_t K = IC_total_padded();
     const dim_t LDA = M; // weights ba: stride[1] = OC
     const dim_t LDB = K; // src row-major: stride[0] = IC
+
+    // f32 and s32 dst hold the accumulator, other int8 dst use a buffer
+    // with the same layout.
+    dst_is_acc_ = types::data_type_size(dst_type) == sizeof(int32_t);
     const dim_t LDC = M; // dst row-major: stride[0] = OC
 
+    // The weights are the vector operand A and the src the scalar operand B
+    const cpu_isa_t brg_isa = src_type == f16 ? zvfh : v;
     brgemm_desc_t brg_desc;
-    CHECK(brgemm_desc_init(&brg_desc, v, brgemm_strd, data_type::f32,
-            data_type::f32, brgemm_col_major, 1.0f, 0.0f, LDA, LDB, LDC, M,
-            MB(), K));
+    CHECK(brgemm_desc_init(&brg_desc, brg_isa, brgemm_strd, wei_type,
+            src_type, brgemm_col_major, 1.0f, 0.0f, LDA, LDB, LDC, M, MB(),
+            K));
 
     brgemm_kernel_t *kernel = nullptr;
     CHECK(brgemm_kernel_create(&kernel, brg_desc));
     brg_kernel_.reset(kernel);
 
+    init_scratchpad();
+
     return status::success;
 }
 
+void rvv_brgemm_inner_product_fwd_t::pd_t::init_scratchpad() {
+    if (!is_int8_) return;
+    auto scratchpad = scratchpad_registry().registrar();
+    if (!dst_is_acc_)
+        scratchpad.template book<int32_t>(
+                memory_tracking::names::key_iprod_int_dat_in_acc_dt,
+                MB() * OC());
+    book_precomputed_scales(scratchpad, attr()->scales_, OC());
+}
+
 status_t rvv_brgemm_inner_product_fwd_t::execute(const exec_ctx_t &ctx) const {
-    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
-    auto wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    // Byte arithmetic so one code path handles all the data types.
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
     auto bia = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
-    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
 
     const dim_t MB = pd()->MB();
     const dim_t OC = pd()->OC();
     const dim_t K = pd()->IC_total_padded();
+    const bool is_int8 = pd()->is_int8_;
 
     const auto *brg_kernel = pd()->brg_kernel_.get();
     const auto &brg = brg_kernel->get_brg();
     const int bd = brg.bd_block;
     const int total_m_tiles = brg.bdb + (brg.bdb_tail > 0 ? 1 : 0);
+    const dim_t ts_wei = brg.typesize_A;
+    const dim_t ts_src = brg.typesize_B;
+    const dim_t ts_acc = brg.typesize_C;
+
+    // The int8 kernel doesn't apply the bias: it is added on conversion.
+    const float *brg_bia = is_int8 ? nullptr : bia;
+    char *acc = is_int8 && !pd()->dst_is_acc_
+            ? ctx.get_scratchpad_grantor().template get<char>(
+                      memory_tracking::names::key_iprod_int_dat_in_acc_dt)
+            : static_cast<char *>(dst);
 
     const int nthr = dnnl_get_max_threads();
 
@@ -166,8 +211,8 @@ status_t rvv_brgemm_inner_product_fwd_t::execute(const exec_ctx_t &ctx) const {
             const dim_t n_work = n_end - n_start;
             if (n_work <= 0) return;
 
-            brgemm_kernel_execute(brg_kernel, wei, src + n_start * K,
-                    dst + n_start * OC, n_work, 0.0f, bia);
+            brgemm_kernel_execute(brg_kernel, wei, src + n_start * K * ts_src,
+                    acc + n_start * OC * ts_acc, n_work, 0.0f, brg_bia);
         });
     } else {
         // MB < nthr: not enough rows for 1D parallelism.
@@ -189,20 +234,44 @@ status_t rvv_brgemm_inner_product_fwd_t::execute(const exec_ctx_t &ctx) const {
                     const float beta_kb = (kb == 0) ? 0.0f : 1.0f;
 
                     brgemm_kernel_params_t p;
-                    p.ptr_A = wei + kb * OC + m_offset;
-                    p.ptr_B = src + kb;
-                    p.ptr_C = dst + m_offset;
+                    p.ptr_A = wei + (kb * OC + m_offset) * ts_wei;
+                    p.ptr_B = src + kb * ts_src;
+                    p.ptr_C = acc + m_offset * ts_acc;
                     p.N = MB;
                     p.M = m_size;
                     p.K = K_inner;
                     p.beta = beta_kb;
-                    p.ptr_bias = (kb == 0 && bia) ? bia + m_offset : nullptr;
+                    p.ptr_bias = (kb == 0 && brg_bia) ? brg_bia + m_offset
+                                                      : nullptr;
                     (*brg_kernel)(&p);
                 }
             }
         });
     }
 
+    if (!is_int8) return status::success;
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
+    DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+
+    const int wei_scale_mask = pd()->attr()->scales_.get_mask(DNNL_ARG_WEIGHTS);
+    const bool scale_per_oc = wei_scale_mask > 0;
+    const float *scales = precompute_scales(ctx.get_scratchpad_grantor(),
+            src_scales, wei_scales, OC, pd()->attr());
+    const bool with_dst_scales
+            = !pd()->attr()->scales_.has_default_values(DNNL_ARG_DST);
+    const auto dst_dt = pd()->dst_md()->data_type;
+    const auto *acc_s32 = reinterpret_cast<const int32_t *>(acc);
+
+    parallel_nd(MB, OC, [&](dim_t mb, dim_t oc) {
+        const dim_t off = mb * OC + oc;
+        float d = static_cast<float>(acc_s32[off]) * scales[scale_per_oc * oc];
+        if (bia) d += bia[oc];
+        if (with_dst_scales) d /= dst_scales[0];
+        io::store_float_value(dst_dt, d, dst, off);
+    });
+
     return status::success;
 }
 
@@ -43,6 +43,14 @@ struct rvv_brgemm_inner_product_fwd_t : public primitive_t {
         status_t init(engine_t *engine);
 
         std::shared_ptr<brgemm_kernel_t> brg_kernel_;
+        // u8/s8 src with s8 weights: the s32 accumulator is converted to dst
+        // with the scales and the bias after the brgemm calls
+        bool is_int8_ = false;
+        // The s32 accumulator is kept in dst (f32 or s32 dst)
+        bool dst_is_acc_ = false;
+
+    private:
+        void init_scratchpad();
     };
 
     rvv_brgemm_inner_product_fwd_t(const pd_t *apd) : primitive_t(apd) {}
@@ -25,7 +25,10 @@
 #include "common/utils.hpp"
 #include "common/verbose.hpp"
 
+#include "cpu/cpu_primitive.hpp"
 #include "cpu/platform.hpp"
+#include "cpu/scale_utils.hpp"
+
 #include "cpu/rv64/jit_generator.hpp"
 #include "cpu/rv64/rvv_brgemm_matmul.hpp"
 
@@ -41,7 +44,7 @@ using namespace data_type;
 
 // ---------------------------------------------------------------------------
 // JIT kernel: pack_a_tile
-// Copies valid_rows floats per column from col-major A (stride LDA_orig)
+// Copies valid_rows elements per column from col-major A (stride LDA_orig)
 // into contiguous workspace (stride bd). Vectorized with LMUL=m4.
 // ---------------------------------------------------------------------------
 struct jit_pack_a_tile_t : public jit_generator_t {
@@ -56,10 +59,10 @@ struct jit_pack_a_tile_t : public jit_generator_t {
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_pack_a_tile_t)
 
-    // input_typesize: 4 for f32, 2 for bf16/f16.
+    // input_typesize: 4 for f32, 2 for bf16/f16, 1 for s8.
     explicit jit_pack_a_tile_t(int input_typesize)
         : jit_generator_t("jit_pack_a_tile"), input_typesize_(input_typesize) {
-        assert(input_typesize == 2 || input_typesize == 4);
+        assert(utils::one_of(input_typesize, 1, 2, 4));
         create_kernel();
     }
 
@@ -88,7 +91,9 @@ protected:
 
         const VReg v_tmp(0);
 
-        const int elem_shift = (input_typesize_ == 4) ? 2 : 1;
+        const int elem_shift = (input_typesize_ == 4)
+                ? 2
+                : (input_typesize_ == 2 ? 1 : 0);
 
         // Load parameters
         ld(reg_ws, reg_param, 0);
@@ -126,10 +131,14 @@ protected:
             vsetvli(reg_vl, reg_rows_remaining, SEW::e32, LMUL::m4);
             vle32_v(v_tmp, reg_src);
             vse32_v(v_tmp, reg_dst);
-        } else {
+        } else if (input_typesize_ == 2) {
             vsetvli(reg_vl, reg_rows_remaining, SEW::e16, LMUL::m4);
             vle16_v(v_tmp, reg_src);
             vse16_v(v_tmp, reg_dst);
+        } else {
+            vsetvli(reg_vl, reg_rows_remaining, SEW::e8, LMUL::m4);
+            vle8_v(v_tmp, reg_src);
+            vse8_v(v_tmp, reg_dst);
         }
 
         slli(reg_bytes, reg_vl, elem_shift);
@@ -175,22 +184,42 @@ status_t rvv_brgemm_matmul_t::pd_t::init(engine_t *engine) {
                     && !bias_mdw.has_runtime_dims_or_strides(),
             VERBOSE_UNSUPPORTED_TAG);
 
-    // Accepted: f32/f32/f32, bf16/bf16/f32 (Zvfbfwma), f16/f16/f32 (Zvfh).
+    // Accepted: f32/f32/f32, bf16/bf16/f32 (Zvfbfwma), f16/f16/f32 (Zvfh),
+    // u8|s8/s8/f32.
     const auto src_dt = src_mdw.data_type();
     const auto wei_dt = wei_mdw.data_type();
     const bool same_in_dt = src_dt == wei_dt;
-    const bool in_dt_ok = same_in_dt
+    const bool fp_dt_ok = same_in_dt
             && (src_dt == f32 || (src_dt == bf16 && mayiuse(zvfbfwma))
                     || (src_dt == f16 && mayiuse(zvfh)));
-    const bool types_ok = in_dt_ok && dst_mdw.data_type() == f32
+    is_int8_ = one_of(src_dt, u8, s8) && wei_dt == s8;
+    const bool types_ok = (fp_dt_ok || is_int8_) && dst_mdw.data_type() == f32
             && IMPLICATION(!bias_mdw.is_zero(), bias_mdw.data_type() == f32)
-            && desc()->accum_data_type == f32;
+            && desc()->accum_data_type == (is_int8_ ? s32 : f32);
     VDISPATCH_MATMUL(types_ok, VERBOSE_UNSUPPORTED_DT);
 
-    input_typesize_ = static_cast<int>(types::data_type_size(src_dt));
+    input_typesize_ = static_cast<int>(types::data_type_size(wei_dt));
 
-    VDISPATCH_MATMUL(attr()->has_default_values(smask_t::post_ops, f32),
+    VDISPATCH_MATMUL(attr()->has_default_values(is_int8_
+                                     ? smask_t::post_ops | smask_t::scales
+                                     : smask_t::post_ops,
+                             f32),
             VERBOSE_UNSUPPORTED_ATTR);
+    if (is_int8_) {
+        // Common src scale and common or per-N weights scales: they are
+        // applied when the s32 accumulator is converted to f32.
+        const auto &scales = attr()->scales_;
+        VDISPATCH_MATMUL(
+                attr_scales_ok({DNNL_ARG_SRC, DNNL_ARG_WEIGHTS})
+                        && scales.has_default_groups()
+                        && IMPLICATION(!scales.has_default_values(DNNL_ARG_SRC),
+                                scales.get_mask(DNNL_ARG_SRC) == 0)
+                        && IMPLICATION(
+                                !scales.has_default_values(DNNL_ARG_WEIGHTS),
+                                one_of(scales.get_mask(DNNL_ARG_WEIGHTS), 0,
+                                        wei_qmask_N())),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
 
     // Resolve primary + post-op binary src1 formats before the post-op check:
     // a post-op binary src1 may be format_any and must be matched to dst before
@@ -279,13 +308,14 @@ status_t rvv_brgemm_matmul_t::pd_t::init(engine_t *engine) {
     VDISPATCH_MATMUL(
             N_ >= 16, VERBOSE_IMPL_HEURISTIC_FAIL, "N too small for brgemm");
 
-    // f32 keeps the K/A_bytes thresholds; bf16/f16 only require batch*M.
-    const bool is_low_prec
-            = (src_dt == data_type::bf16 || src_dt == data_type::f16);
+    // f32 keeps the K/A_bytes thresholds; bf16/f16/int8 only require
+    // batch*M.
+    const bool is_low_prec = is_int8_
+            || (src_dt == data_type::bf16 || src_dt == data_type::f16);
     if (is_low_prec) {
         VDISPATCH_MATMUL(K_ >= BRGEMM_BK && batch_ * M_ >= 128,
                 VERBOSE_IMPL_HEURISTIC_FAIL,
-                "shape too small for bf16/f16 brgemm matmul");
+                "shape too small for low precision brgemm matmul");
     } else {
         const dim_t A_bytes = N_ * K_ * (dim_t)input_typesize_;
         const auto L2_bytes = platform::get_per_core_cache_size(3);
@@ -306,8 +336,9 @@ status_t rvv_brgemm_matmul_t::pd_t::init(engine_t *engine) {
 
     cpu_isa_t brg_isa = src_dt == bf16 ? zvfbfwma : (src_dt == f16 ? zvfh : v);
 
+    // The weights are the vector operand A and the src the scalar operand B
     brgemm_desc_t brg_desc;
-    CHECK(brgemm_desc_init(&brg_desc, brg_isa, brgemm_strd, src_dt, src_dt,
+    CHECK(brgemm_desc_init(&brg_desc, brg_isa, brgemm_strd, wei_dt, src_dt,
             brgemm_col_major, 1.0f, 0.0f, LDA, LDB, LDC, M_brg, N_brg, K_brg));
 
     brgemm_kernel_t *kernel = nullptr;
@@ -343,10 +374,11 @@ void rvv_brgemm_matmul_t::pd_t::init_scratchpad() {
     auto scratchpad = scratchpad_registry().registrar();
     const size_t ws_bytes = (size_t)brg.bd_block * K_ * input_typesize_;
     scratchpad.template book<char>(key_brgemm_primitive_buffer_a, ws_bytes);
+    if (is_int8_) book_precomputed_scales(scratchpad, attr()->scales_, N_);
 }
 
 status_t rvv_brgemm_matmul_t::execute(const exec_ctx_t &ctx) const {
-    // Byte arithmetic so one code path handles f32/bf16/f16.
+    // Byte arithmetic so one code path handles f32/bf16/f16/int8.
     auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
     auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
@@ -355,7 +387,9 @@ status_t rvv_brgemm_matmul_t::execute(const exec_ctx_t &ctx) const {
     const dim_t N = pd()->N_;
     const dim_t K = pd()->K_;
     const dim_t batch = pd()->batch_;
+    // Element sizes of the weights (A) and of the src (B)
     const int in_ts = pd()->input_typesize_;
+    const int src_ts = pd()->brg_kernel_->get_brg().typesize_B;
 
     const auto &brg = pd()->brg_kernel_->get_brg();
     const int bd = brg.bd_block;
@@ -396,8 +430,8 @@ status_t rvv_brgemm_matmul_t::execute(const exec_ctx_t &ctx) const {
 
             brgemm_kernel_params_t p;
             p.ptr_A = ws + kb * bd * in_ts;
-            p.ptr_B = src + kb * in_ts;
-            p.ptr_C = dst + t * bd; // dst stays f32
+            p.ptr_B = src + kb * src_ts;
+            p.ptr_C = dst + t * bd; // dst stays f32 (s32 for int8)
             p.N = total_N;
             p.M = rows;
             p.K = K_inner;
@@ -407,6 +441,23 @@ status_t rvv_brgemm_matmul_t::execute(const exec_ctx_t &ctx) const {
         }
     }
 
+    // Convert the int8 s32 accumulator to f32 in place with the scales.
+    if (pd()->is_int8_) {
+        DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+        DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
+        const bool scale_per_n
+                = pd()->attr()->scales_.get_mask(DNNL_ARG_WEIGHTS) > 0;
+        const float *scales = precompute_scales(
+                grantor, src_scales, wei_scales, N, pd()->attr());
+        parallel_nd(total_N, [&](dim_t row) {
+            float *row_dst = dst + row * N;
+            const auto *row_acc = reinterpret_cast<const int32_t *>(row_dst);
+            for (dim_t n = 0; n < N; n++)
+                row_dst[n] = static_cast<float>(row_acc[n])
+                        * scales[scale_per_n * n];
+        });
+    }
+
     // Apply bias + post-ops using JIT kernel
     const memory_desc_wrapper dst_d(pd()->dst_md());
     const memory_desc_wrapper bias_d(pd()->desc()->bias_desc);
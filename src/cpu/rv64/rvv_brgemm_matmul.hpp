@@ -55,8 +55,12 @@ struct rvv_brgemm_matmul_t : public primitive_t {
         dim_t K_ = 0;
         dim_t batch_ = 0;
         bool weights_are_broadcast_ = false;
-        // Input element size in bytes (4=f32, 2=bf16/f16). dst is always f32.
+        // Weights element size in bytes (4=f32, 2=bf16/f16, 1=s8). dst is
+        // always f32.
         int input_typesize_ = 4;
+        // u8/s8 src with s8 weights: dst holds the s32 accumulator until it
+        // is converted with the scales.
+        bool is_int8_ = false;
 
     private:
         void init_scratchpad();
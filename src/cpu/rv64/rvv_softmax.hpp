@@ -54,6 +54,8 @@ struct rvv_softmax_fwd_t : public primitive_t {
                     VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_SOFTMAX(
                     attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_SOFTMAX(!with_attn_inputs(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "attention inputs");
             VDISPATCH_SOFTMAX(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
 
             const memory_desc_wrapper src_d(src_md());
@@ -15,6 +15,17 @@
 *******************************************************************************/
 #ifndef CPU_S390X_GEMM_H
 #define CPU_S390X_GEMM_H
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+
+// The f32 kernels need vector float support (z14 and newer)
+#if defined(__VX__) && defined(__VEC__) && (__VEC__ >= 10302)
+#define DNNL_S390X_VXE 1
+#else
+#define DNNL_S390X_VXE 0
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -32,6 +43,17 @@ dnnl_status_t gemmx8x8s32(const char *transa, const char *transb,
         dim_t ldB, const int8_t *bo, float beta, int32_t *C, dim_t ldC,
         const int32_t *co);
 
+#if DNNL_S390X_VXE
+dnnl_status_t sgemm(const char *transa, const char *transb, dim_t M, dim_t N,
+        dim_t K, float alpha, const float *A, dim_t ldA, const float *B,
+        dim_t ldB, float beta, float *C, dim_t ldC, const float *bias);
+
+dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
+        dim_t M, dim_t N, dim_t K, float alpha, const bfloat16_t *A,
+        dim_t ldA, const bfloat16_t *B, dim_t ldB, float beta, float *C,
+        dim_t ldC);
+#endif
+
 } // namespace s390x
 } // namespace cpu
 } // namespace impl
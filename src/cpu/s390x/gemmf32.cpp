@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/s390x/gemm.h"
+
+#if DNNL_S390X_VXE
+
+#include <atomic>
+
+#include "common/bfloat16.hpp"
+#include "common/dnnl_thread.hpp"
+#include "cpu/s390x/kernel_f32f32f32.hpp"
+#include "cpu/s390x/pack.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace s390x {
+
+constexpr dim_t MC = 256;
+constexpr dim_t KC = 256;
+constexpr dim_t NC = 1024;
+
+// C = beta * C + bias, so that the K blocks can be accumulated directly into C
+__attribute__((noinline)) void scaleResults(dim_t m, dim_t n, float beta,
+        float *__restrict C, dim_t ldC, const float *__restrict bias) {
+    for (dim_t j = 0; j < n; j++) {
+        for (dim_t i = 0; i < m; i++) {
+            float val = beta == 0.f ? 0.f : beta * gPtr(i, j);
+            gPtr(i, j) = bias ? val + bias[i] : val;
+        }
+    }
+}
+
+template <typename T>
+inline void LoopKC(bool transA, bool transB, dim_t m, dim_t n, dim_t k,
+        float alpha, const T *A, dim_t ldA, const T *B, dim_t ldB, float *C,
+        dim_t ldC, float *Apacked, float *Bpacked) {
+    for (dim_t p = 0; p < k; p += KC) {
+        dim_t pb = nstl::min(KC, k - p);
+        if (transB) {
+            pack_K<T, float, NR_F32, 1, true>(
+                    pb, n, &bPtr(0, p), ldB, Bpacked);
+        } else {
+            pack_K<T, float, NR_F32, 1, false>(
+                    pb, n, &bPtr(p, 0), ldB, Bpacked);
+        }
+
+        for (dim_t i = 0; i < m; i += MC) {
+            dim_t ib = nstl::min(MC, m - i);
+            if (transA) {
+                pack_K<T, float, MR_F32, 1, false>(
+                        pb, ib, &aPtr(p, i), ldA, Apacked);
+            } else {
+                pack_K<T, float, MR_F32, 1, true>(
+                        pb, ib, &aPtr(i, p), ldA, Apacked);
+            }
+            LoopTwo<NR_F32>(
+                    ib, n, pb, alpha, Apacked, Bpacked, &gPtr(i, 0), ldC);
+        }
+    }
+}
+
+template <typename T>
+inline bool LoopNC(bool transA, bool transB, dim_t m, dim_t n, dim_t k,
+        float alpha, const T *A, dim_t ldA, const T *B, dim_t ldB, float beta,
+        float *C, dim_t ldC, const float *bias) {
+
+    dim_t kC = nstl::min(k, KC);
+    dim_t nC = nstl::min(n, NC);
+
+    auto Bpack = (float *)malloc((kC * nC) * sizeof(float) + 16, 4096);
+    auto Apack = (float *)malloc((MC * kC) * sizeof(float) + 16, 4096);
+    if (utils::any_null(Apack, Bpack)) {
+        free(Apack);
+        free(Bpack);
+        return false;
+    }
+
+    auto AP = utils::align_ptr(Apack, 16);
+    auto BP = utils::align_ptr(Bpack, 16);
+
+    // (NC->KC->MC) blocking: the packed B block is reused by all M blocks
+    for (dim_t j = 0; j < n; j += NC) {
+        dim_t jb = nstl::min(NC, n - j);
+        scaleResults(m, jb, beta, &gPtr(0, j), ldC, bias);
+        LoopKC(transA, transB, m, jb, k, alpha, A, ldA,
+                transB ? &bPtr(j, 0) : &bPtr(0, j), ldB, &gPtr(0, j), ldC, AP,
+                BP);
+    }
+
+    free(Apack);
+    free(Bpack);
+    return true;
+}
+
+template <typename T>
+dnnl_status_t gemmXf32(const char *transa, const char *transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const T *A, dim_t ldA, const T *B,
+        dim_t ldB, float beta, float *C, dim_t ldC, const float *bias) {
+    if (M == 0 || N == 0) return dnnl_success;
+
+    bool trA = *transa == 't' || *transa == 'T';
+    bool trB = *transb == 't' || *transb == 'T';
+    int thr_count = dnnl_get_current_num_threads();
+    dim_t nC = thr_count > 1 && N > (NC / 4)
+            ? ((N / thr_count + NR_F32 - 1) & (-NR_F32))
+            : N;
+    const dim_t nPanels = (N + nC - 1) / nC;
+    const dim_t tileY = N - (nPanels - 1) * nC;
+    std::atomic<bool> out_of_memory {false};
+    dnnl::impl::parallel_nd(nPanels, [&](int64_t n) {
+        dim_t localN = n + 1 == nPanels ? tileY : nC;
+        auto j = n * nC;
+        auto localB = trB ? &bPtr(j, 0) : &bPtr(0, j);
+
+        if (!LoopNC<T>(trA, trB, M, localN, K, alpha, A, ldA, localB, ldB,
+                    beta, &gPtr(0, j), ldC, bias))
+            out_of_memory = true;
+    });
+    return out_of_memory ? dnnl_out_of_memory : dnnl_success;
+}
+
+dnnl_status_t sgemm(const char *transa, const char *transb, dim_t M, dim_t N,
+        dim_t K, float alpha, const float *A, dim_t ldA, const float *B,
+        dim_t ldB, float beta, float *C, dim_t ldC, const float *bias) {
+    return gemmXf32<float>(transa, transb, M, N, K, alpha, A, ldA, B, ldB,
+            beta, C, ldC, bias);
+}
+
+dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
+        dim_t M, dim_t N, dim_t K, float alpha, const bfloat16_t *A,
+        dim_t ldA, const bfloat16_t *B, dim_t ldB, float beta, float *C,
+        dim_t ldC) {
+    // bf16 values are converted to f32 while packing
+    return gemmXf32<bfloat16_t>(transa, transb, M, N, K, alpha, A, ldA, B,
+            ldB, beta, C, ldC, nullptr);
+}
+
+} // namespace s390x
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,189 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_S390X_KERNEL_F32F32F32_HPP
+#define CPU_S390X_KERNEL_F32F32F32_HPP
+
+#include "common/utils.hpp"
+#include "cpu/s390x/helpers.h"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace s390x {
+
+constexpr int MR_F32 = 16;
+constexpr int NR_F32 = 4;
+
+template <int ROWS, int COLS>
+inline typename utils::enable_if<(ROWS % 4 == 0), void>::type gbp(dim_t k,
+        float alpha, const float *__restrict MP_A,
+        const float *__restrict MP_B, float *__restrict C, dim_t ldC) {
+    using vType = typename vec_type_t<float>::Type;
+    constexpr int VLEN = vec_type_t<float>::size();
+
+    vType Caux[ROWS / VLEN][COLS] = {};
+    dim_t k_4 = k & (-4);
+
+    for (dim_t p = 0; p < k_4; p += 4) {
+        for (int i = 0; i < ROWS / VLEN; i++) {
+            vType Ak0 = vec_type_t<float>::loadu(&MP_A[i * VLEN]);
+            vType Ak1 = vec_type_t<float>::loadu(&MP_A[i * VLEN + ROWS]);
+            vType Ak2 = vec_type_t<float>::loadu(&MP_A[i * VLEN + 2 * ROWS]);
+            vType Ak3 = vec_type_t<float>::loadu(&MP_A[i * VLEN + 3 * ROWS]);
+            for (int j = 0; j < COLS; j++) {
+                vType BkI0 = vec_type_t<float>(MP_B[j]);
+                vType BkI1 = vec_type_t<float>(MP_B[j + COLS]);
+                vType BkI2 = vec_type_t<float>(MP_B[j + 2 * COLS]);
+                vType BkI3 = vec_type_t<float>(MP_B[j + 3 * COLS]);
+
+                Caux[i][j] = Ak0 * BkI0 + Caux[i][j];
+                Caux[i][j] = Ak1 * BkI1 + Caux[i][j];
+                Caux[i][j] = Ak2 * BkI2 + Caux[i][j];
+                Caux[i][j] = Ak3 * BkI3 + Caux[i][j];
+            }
+        }
+        MP_A += 4 * ROWS;
+        MP_B += 4 * COLS;
+    }
+
+    asm("");
+
+    for (dim_t p = k_4; p < k; p++) {
+        for (int i = 0; i < ROWS / VLEN; i++) {
+            vType Ak = vec_type_t<float>::loadu(&MP_A[i * VLEN]);
+            for (int j = 0; j < COLS; j++) {
+                vType BkI = vec_type_t<float>(MP_B[j]);
+                Caux[i][j] = Ak * BkI + Caux[i][j];
+            }
+        }
+        MP_A += ROWS;
+        MP_B += COLS;
+    }
+
+    asm("");
+    vType valpha = vec_type_t<float>(alpha);
+    for (int j = 0; j < COLS; j++) {
+        for (int i = 0; i < ROWS / VLEN; i++) {
+            vType C_ij = vec_type_t<float>::loadu(&gPtr(i * VLEN, j));
+            C_ij += valpha * Caux[i][j];
+            vec_type_t<float>(C_ij).store(&gPtr(i * VLEN, j));
+        }
+    }
+}
+
+// Rows tails of 1 and 2 elements, "k" is traversed with length loads
+template <int ROWS, int COLS>
+inline typename utils::enable_if<(ROWS % 4 != 0), void>::type gbp(dim_t k,
+        float alpha, const float *__restrict MP_A,
+        const float *__restrict MP_B, float *__restrict C, dim_t ldC) {
+    using vType = typename vec_type_t<float>::Type;
+    constexpr int BYTE_INDEX = ROWS * sizeof(float) - 1;
+
+    vType Caux[COLS] = {};
+
+    for (dim_t p = 0; p < k; p++) {
+        vType Ak = vec_type_t<float>::loadLen(MP_A, BYTE_INDEX);
+        for (int j = 0; j < COLS; j++) {
+            vType BkI = vec_type_t<float>(MP_B[j]);
+            Caux[j] = Ak * BkI + Caux[j];
+        }
+        MP_A += ROWS;
+        MP_B += COLS;
+    }
+
+    asm("");
+    vType valpha = vec_type_t<float>(alpha);
+    for (int j = 0; j < COLS; j++) {
+        vType C_ij = vec_type_t<float>::loadLen(&gPtr(0, j), BYTE_INDEX);
+        C_ij += valpha * Caux[j];
+        vec_type_t<float>(C_ij).storeLen(&gPtr(0, j), BYTE_INDEX);
+    }
+}
+
+template <int M, int ROWS, int COLS>
+typename utils::enable_if<(M >= ROWS), void>::type LoopOne_TAIL(dim_t m,
+        dim_t k, float alpha, const float *Apacked, const float *Bpacked,
+        float *C, dim_t ldC) {
+    // end of the roll
+}
+
+template <int M, int ROWS, int COLS>
+typename utils::enable_if<(M < ROWS), void>::type LoopOne_TAIL(dim_t m, dim_t k,
+        float alpha, const float *Apacked, const float *Bpacked, float *C,
+        dim_t ldC) {
+    if (m & M) {
+        gbp<M, COLS>(k, alpha, Apacked, Bpacked, C, ldC);
+        Apacked = &Apacked[M * k];
+        C = &gPtr(M, 0);
+    }
+    LoopOne_TAIL<2 * M, ROWS, COLS>(m, k, alpha, Apacked, Bpacked, C, ldC);
+}
+
+template <int ROWS, int COLS>
+inline void LoopOne(dim_t m, dim_t k, float alpha, const float *Apacked,
+        const float *Bpacked, float *C, dim_t ldC) {
+    for (dim_t i = 0; i < m / ROWS; i++) {
+        gbp<ROWS, COLS>(k, alpha, &Apacked[i * ROWS * k], Bpacked,
+                &gPtr(i * ROWS, 0), ldC);
+    }
+    dim_t II = m - m % ROWS;
+    if (m > II)
+        LoopOne_TAIL<1, ROWS, COLS>(
+                m - II, k, alpha, &Apacked[II * k], Bpacked, &gPtr(II, 0), ldC);
+}
+
+template <int N, int COLS>
+typename utils::enable_if<(N >= COLS), void>::type LoopTwo_TAIL(dim_t m,
+        dim_t n, dim_t k, float alpha, const float *Apacked,
+        const float *Bpacked, float *C, dim_t ldC) {
+    // end of the roll
+}
+
+template <int N, int COLS>
+typename utils::enable_if<(N < COLS), void>::type LoopTwo_TAIL(dim_t m, dim_t n,
+        dim_t k, float alpha, const float *Apacked, const float *Bpacked,
+        float *C, dim_t ldC) {
+    if (n & N) {
+        LoopOne<MR_F32, N>(m, k, alpha, Apacked, Bpacked, C, ldC);
+        Bpacked = &Bpacked[N * k];
+        C = &gPtr(0, N);
+    }
+    LoopTwo_TAIL<2 * N, COLS>(m, n, k, alpha, Apacked, Bpacked, C, ldC);
+}
+
+// Computes C += alpha * A * B for A and B packed with pack_K<..., 1, ...>
+template <int COLS>
+void __attribute__((noinline)) LoopTwo(dim_t m, dim_t n, dim_t k, float alpha,
+        const float *Apacked, const float *Bpacked, float *C, dim_t ldC) {
+    for (dim_t j = 0; j < n / COLS; j++) {
+        LoopOne<MR_F32, COLS>(m, k, alpha, Apacked, &Bpacked[j * COLS * k],
+                &gPtr(0, j * COLS), ldC);
+    }
+    dim_t JJ = n - n % COLS;
+    if (n > JJ)
+        LoopTwo_TAIL<1, COLS>(m, n - JJ, k, alpha, Apacked, &Bpacked[JJ * k],
+                &gPtr(0, JJ), ldC);
+}
+
+} // namespace s390x
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
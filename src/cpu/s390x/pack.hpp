@@ -46,8 +46,9 @@ typename utils::enable_if<(KK == 2), void>::type pack_G_KK(int k,
 }
 
 template <int G, int KK, bool accessSide, typename T, typename DT>
-typename utils::enable_if<(KK == 1), void>::type pack_G_KK(
-        int k, const T *src, int srcLD, T *dst, DT add_val) {
+typename utils::enable_if<(KK == 1), void>::type pack_G_KK(int k,
+        const T *__restrict src, int srcLD, DT *__restrict dst,
+        DT add_val = 0) {
     auto Src = matrix_ptr_t<const T, accessSide> {src, srcLD};
 
     for (int p = 0; p < k; p++) {
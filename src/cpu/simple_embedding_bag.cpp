@@ -0,0 +1,205 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_embedding_bag.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// Embedding columns processed at a time by a thread. Splitting the rows lets
+// all threads work on small batches of wide embeddings.
+constexpr dim_t block_size = 512;
+// How many indices ahead of the current one the rows are prefetched.
+constexpr dim_t prefetch_distance = 4;
+
+inline void prefetch(const char *ptr, size_t size) {
+#if defined(__GNUC__) || defined(__clang__)
+    for (size_t off = 0; off < size; off += platform::get_cache_line_size())
+        __builtin_prefetch(ptr + off, 0, 0);
+#else
+    UNUSED(ptr);
+    UNUSED(size);
+#endif
+}
+
+// Adds `scale * (row[d] - zp)` to `acc[d]` for `len` columns, starting at
+// element `off` of the table.
+using accumulate_fn_t = void (*)(float *acc, const void *table, dim_t off,
+        dim_t len, float scale, float zp);
+
+template <data_type_t dt>
+void accumulate(float *acc, const void *table, dim_t off, dim_t len,
+        float scale, float zp) {
+    using data_t = typename prec_traits_t<dt>::type;
+    const data_t *row = static_cast<const data_t *>(table) + off;
+    PRAGMA_OMP_SIMD()
+    for (dim_t d = 0; d < len; d++)
+        acc[d] += scale * (static_cast<float>(row[d]) - zp);
+}
+
+// 4-bit values are unpacked one at a time.
+template <data_type_t dt>
+void accumulate_4bit(float *acc, const void *table, dim_t off, dim_t len,
+        float scale, float zp) {
+    for (dim_t d = 0; d < len; d++)
+        acc[d] += scale * (io::load_float_value(dt, table, off + d) - zp);
+}
+
+accumulate_fn_t get_accumulate_fn(data_type_t dt) {
+    using namespace data_type;
+    switch (dt) {
+        case f32: return accumulate<f32>;
+        case bf16: return accumulate<bf16>;
+        case f16: return accumulate<f16>;
+        case s8: return accumulate<s8>;
+        case u8: return accumulate<u8>;
+        case f8_e5m2: return accumulate<f8_e5m2>;
+        case f8_e4m3: return accumulate<f8_e4m3>;
+        case s4: return accumulate_4bit<s4>;
+        case u4: return accumulate_4bit<u4>;
+        default: assert(!"unsupported data type"); return nullptr;
+    }
+}
+
+void store(data_type_t dt, void *dst, dim_t off, const float *acc, dim_t len) {
+    using namespace data_type;
+    switch (dt) {
+        case f32:
+            utils::array_copy(static_cast<float *>(dst) + off, acc, len);
+            break;
+        case bf16:
+            cvt_float_to_bfloat16(
+                    static_cast<bfloat16_t *>(dst) + off, acc, len);
+            break;
+        case f16:
+            cvt_float_to_float16(static_cast<float16_t *>(dst) + off, acc, len);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+} // namespace
+
+status_t simple_embedding_bag_t::execute(const exec_ctx_t &ctx) const {
+    using namespace data_type;
+    status_t status = status::success;
+    auto table = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_EMBEDDING_INDICES);
+    auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_EMBEDDING_OFFSETS);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const auto *attr = pd()->attr();
+    const bool with_scales = !attr->scales_.has_default_values(DNNL_ARG_SRC);
+    const bool with_zp = !attr->zero_points_.has_default_values(DNNL_ARG_SRC);
+    const void *scales = with_scales
+            ? CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC)
+            : nullptr;
+    const void *zero_points = with_zp
+            ? CTX_IN_MEM(const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC)
+            : nullptr;
+    const bool per_row_scales
+            = with_scales && attr->scales_.get_mask(DNNL_ARG_SRC) != 0;
+    const bool per_row_zp
+            = with_zp && attr->zero_points_.get_mask(DNNL_ARG_SRC) != 0;
+    const data_type_t scales_dt = attr->scales_.get_data_type(DNNL_ARG_SRC);
+    const data_type_t zp_dt = attr->zero_points_.get_data_type(DNNL_ARG_SRC);
+
+    const memory_desc_wrapper table_d(pd()->src_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const data_type_t table_dt = table_d.data_type();
+    const bool is_4bit = utils::one_of(table_dt, s4, u4);
+    const dim_t n_rows = pd()->n_rows();
+    const dim_t D = pd()->emb_dim();
+    const dim_t n_indices = pd()->n_indices();
+    const dim_t n_bags = pd()->n_bags();
+    const bool is_mean = pd()->alg_kind() == alg_kind::reduction_mean;
+    const accumulate_fn_t accumulate_fn = get_accumulate_fn(table_dt);
+
+    const dim_t n_blocks = utils::div_up(D, block_size);
+    // the bytes of the table an element offset is at
+    auto table_bytes = [&](dim_t off) {
+        return static_cast<const char *>(table)
+                + (is_4bit ? off / 2 : off * table_d.data_type_size());
+    };
+    const size_t block_bytes = is_4bit ? block_size / 2
+                                       : block_size * table_d.data_type_size();
+
+    std::atomic<bool> bad_index(false);
+    parallel_nd(n_bags, n_blocks, [&](dim_t b, dim_t blk) {
+        const dim_t d_beg = blk * block_size;
+        const dim_t len = nstl::min(block_size, D - d_beg);
+        float acc[block_size];
+        utils::array_set(acc, 0.f, len);
+
+        const dim_t beg = offsets[b];
+        const dim_t end = b + 1 < n_bags ? offsets[b + 1] : n_indices;
+        if (beg < 0 || beg > end || end > n_indices) {
+            bad_index = true;
+            return;
+        }
+
+        for (dim_t i = beg; i < end; i++) {
+            if (i + prefetch_distance < end) {
+                const dim_t next = indices[i + prefetch_distance];
+                if (next >= 0 && next < n_rows)
+                    prefetch(table_bytes(table_d.off(next, d_beg)),
+                            block_bytes);
+            }
+            const dim_t row = indices[i];
+            if (row < 0 || row >= n_rows) {
+                bad_index = true;
+                return;
+            }
+            float scale = 1.f, zp = 0.f;
+            if (with_scales)
+                scale = io::load_float_value(
+                        scales_dt, scales, per_row_scales ? row : 0);
+            if (with_zp)
+                zp = static_cast<float>(io::load_int_value(
+                        zp_dt, zero_points, per_row_zp ? row : 0));
+            accumulate_fn(acc, table, table_d.off(row, d_beg), len, scale, zp);
+        }
+
+        if (is_mean && end > beg) {
+            const float factor = 1.f / static_cast<float>(end - beg);
+            PRAGMA_OMP_SIMD()
+            for (dim_t d = 0; d < len; d++)
+                acc[d] *= factor;
+        }
+        store(dst_d.data_type(), dst, dst_d.off(b, d_beg), acc, len);
+    });
+
+    return bad_index ? status::invalid_arguments : status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
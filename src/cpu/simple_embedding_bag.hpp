@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_EMBEDDING_BAG_HPP
+#define CPU_SIMPLE_EMBEDDING_BAG_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_embedding_bag_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct simple_embedding_bag_t : public primitive_t {
+    struct pd_t : public cpu_embedding_bag_pd_t {
+        using cpu_embedding_bag_pd_t::cpu_embedding_bag_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_embedding_bag_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using namespace format_tag;
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+            const data_type_t src_dt = src_md(0)->data_type;
+            const data_type_t dst_dt = dst_md(0)->data_type;
+            VDISPATCH_EMBEDDING_BAG(utils::one_of(src_dt, f32, bf16, f16, s8,
+                                            u8, s4, u4, f8_e5m2, f8_e4m3),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_EMBEDDING_BAG(utils::one_of(dst_dt, f32, bf16, f16),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_EMBEDDING_BAG(platform::has_data_type_support(src_dt)
+                            && platform::has_data_type_support(dst_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            // 4-bit rows must start on a byte boundary
+            VDISPATCH_EMBEDDING_BAG(
+                    IMPLICATION(utils::one_of(src_dt, s4, u4),
+                            emb_dim() % 2 == 0),
+                    VERBOSE_BAD_DIM, "src", 1);
+
+            VDISPATCH_EMBEDDING_BAG(
+                    attr()->has_default_values(skip_mask_t::scales_data_type
+                            | skip_mask_t::zero_points_data_type),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_EMBEDDING_BAG(
+                    attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VDISPATCH_EMBEDDING_BAG(
+                    zero_points_ok(), VERBOSE_UNSUPPORTED_ZP_CFG);
+
+            VDISPATCH_EMBEDDING_BAG(
+                    set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_EMBEDDING_BAG(
+                    memory_desc_wrapper(src_md(0)).matches_tag(ab),
+                    VERBOSE_UNSUPPORTED_TAG_S, "src");
+            VDISPATCH_EMBEDDING_BAG(
+                    memory_desc_wrapper(dst_md(0)).matches_tag(ab),
+                    VERBOSE_UNSUPPORTED_TAG_S, "dst");
+            VDISPATCH_EMBEDDING_BAG(
+                    memory_desc_wrapper(src_md(1)).matches_tag(a)
+                            && memory_desc_wrapper(src_md(2)).matches_tag(a),
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            return status::success;
+        }
+
+    private:
+        // Scales and zero points are either common or per row of the table.
+        bool attr_scales_ok() const {
+            using namespace data_type;
+            const auto &scales = attr()->scales_;
+            if (!scales.has_default_values({DNNL_ARG_SRC})) return false;
+            return scales.has_default_values(DNNL_ARG_SRC)
+                    || (utils::one_of(scales.get_mask(DNNL_ARG_SRC), 0, 1)
+                            && scales.has_default_groups(DNNL_ARG_SRC)
+                            && utils::one_of(
+                                    scales.get_data_type(DNNL_ARG_SRC), f32,
+                                    bf16, f16));
+        }
+
+        bool zero_points_ok() const {
+            using namespace data_type;
+            const auto &zp = attr()->zero_points_;
+            if (!zp.has_default_values({DNNL_ARG_SRC})) return false;
+            return zp.has_default_values(DNNL_ARG_SRC)
+                    || (utils::one_of(zp.get_mask(DNNL_ARG_SRC), 0, 1)
+                            && zp.has_default_groups(DNNL_ARG_SRC)
+                            && utils::one_of(zp.get_data_type(DNNL_ARG_SRC),
+                                    s32, s8, u8, s4, u4));
+        }
+    };
+
+    simple_embedding_bag_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
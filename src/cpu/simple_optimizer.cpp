@@ -0,0 +1,177 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/simple_optimizer.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+struct tensor_ptrs_t {
+    const void *grad;
+    float *param;
+    float *m;
+    float *v;
+    void *param_copy;
+};
+
+struct step_params_t {
+    float lr;
+    float beta1;
+    float beta2;
+    float epsilon;
+    float weight_decay;
+    // 1 / (1 - beta^t), the Adam bias corrections
+    float inv_bias_correction1;
+    float inv_bias_correction2;
+};
+
+void sgd_momentum(const float *g, float *p, float *m, dim_t len,
+        const step_params_t &sp) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t i = 0; i < len; i++) {
+        const float grad = g[i] + sp.weight_decay * p[i];
+        m[i] = sp.beta1 * m[i] + grad;
+        p[i] -= sp.lr * m[i];
+    }
+}
+
+template <bool decoupled_weight_decay>
+void adam(const float *g, float *p, float *m, float *v, dim_t len,
+        const step_params_t &sp) {
+    const float l2 = decoupled_weight_decay ? 0.f : sp.weight_decay;
+    const float decay = decoupled_weight_decay ? sp.lr * sp.weight_decay : 0.f;
+    PRAGMA_OMP_SIMD()
+    for (dim_t i = 0; i < len; i++) {
+        const float grad = g[i] + l2 * p[i];
+        m[i] = sp.beta1 * m[i] + (1.f - sp.beta1) * grad;
+        v[i] = sp.beta2 * v[i] + (1.f - sp.beta2) * grad * grad;
+        const float m_hat = m[i] * sp.inv_bias_correction1;
+        const float v_hat = v[i] * sp.inv_bias_correction2;
+        p[i] -= decay * p[i] + sp.lr * m_hat / (std::sqrt(v_hat) + sp.epsilon);
+    }
+}
+
+} // namespace
+
+status_t simple_optimizer_t::execute(const exec_ctx_t &ctx) const {
+    using namespace data_type;
+    const auto *desc = pd()->desc();
+    const int n = pd()->n_tensors();
+    const bool with_v = pd()->with_v();
+    const bool with_copy = pd()->with_param_copy();
+
+    auto hyperparams
+            = CTX_IN_MEM(const float *, DNNL_ARG_OPTIMIZER_HYPERPARAMS);
+    const float step = hyperparams[1];
+    step_params_t sp;
+    sp.lr = hyperparams[0];
+    sp.beta1 = desc->beta1;
+    sp.beta2 = desc->beta2;
+    sp.epsilon = desc->epsilon;
+    sp.weight_decay = desc->weight_decay;
+    sp.inv_bias_correction1 = with_v ? 1.f / (1.f - std::pow(sp.beta1, step))
+                                     : 1.f;
+    sp.inv_bias_correction2 = with_v ? 1.f / (1.f - std::pow(sp.beta2, step))
+                                     : 1.f;
+
+    // The tensors are dense: only their first element is offset.
+    std::vector<tensor_ptrs_t> tensors(n);
+    for (int i = 0; i < n; i++) {
+        const dim_t off = memory_desc_wrapper(pd()->dst_md(4 * i)).offset0();
+        auto &t = tensors[i];
+        const size_t grad_dt_size = types::data_type_size(desc->grad_data_type);
+        t.grad = CTX_IN_MEM(const char *, DNNL_ARG_OPTIMIZER_GRAD(i))
+                + off * grad_dt_size;
+        t.param = CTX_OUT_MEM(float *, DNNL_ARG_OPTIMIZER_PARAM(i)) + off;
+        t.m = CTX_OUT_MEM(float *, DNNL_ARG_OPTIMIZER_M(i)) + off;
+        t.v = with_v ? CTX_OUT_MEM(float *, DNNL_ARG_OPTIMIZER_V(i)) + off
+                     : nullptr;
+        if (with_copy) {
+            const size_t copy_dt_size
+                    = types::data_type_size(desc->param_copy_data_type);
+            t.param_copy
+                    = CTX_OUT_MEM(char *, DNNL_ARG_OPTIMIZER_PARAM_COPY(i))
+                    + off * copy_dt_size;
+        } else
+            t.param_copy = nullptr;
+    }
+
+    const auto &blocks = pd()->blocks_;
+    parallel_nd((dim_t)blocks.size(), [&](dim_t ib) {
+        const int i = blocks[ib].first;
+        const dim_t beg = blocks[ib].second;
+        const dim_t len = nstl::min(pd_t::block_size,
+                memory_desc_wrapper(pd()->dst_md(4 * i)).nelems() - beg);
+        const auto &t = tensors[i];
+        float *p = t.param + beg;
+        float *m = t.m + beg;
+
+        float g_buf[pd_t::block_size];
+        const float *g = g_buf;
+        switch (desc->grad_data_type) {
+            case f32: g = static_cast<const float *>(t.grad) + beg; break;
+            case bf16:
+                cvt_bfloat16_to_float(g_buf,
+                        static_cast<const bfloat16_t *>(t.grad) + beg, len);
+                break;
+            case f16:
+                cvt_float16_to_float(g_buf,
+                        static_cast<const float16_t *>(t.grad) + beg, len);
+                break;
+            default: assert(!"unsupported data type");
+        }
+
+        switch (desc->alg) {
+            case dnnl_optimizer_sgd_momentum:
+                sgd_momentum(g, p, m, len, sp);
+                break;
+            case dnnl_optimizer_adam:
+                adam<false>(g, p, m, t.v + beg, len, sp);
+                break;
+            case dnnl_optimizer_adamw:
+                adam<true>(g, p, m, t.v + beg, len, sp);
+                break;
+            default: assert(!"unknown optimizer");
+        }
+
+        if (!with_copy) return;
+        if (desc->param_copy_data_type == bf16)
+            cvt_float_to_bfloat16(
+                    static_cast<bfloat16_t *>(t.param_copy) + beg, p, len);
+        else
+            cvt_float_to_float16(
+                    static_cast<float16_t *>(t.param_copy) + beg, p, len);
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_OPTIMIZER_HPP
+#define CPU_SIMPLE_OPTIMIZER_HPP
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_optimizer_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Updates all the tensors of a launch in a single parallel loop over blocks
+// of elements, so that many small tensors share one dispatch.
+struct simple_optimizer_t : public primitive_t {
+    struct pd_t : public cpu_optimizer_pd_t {
+        using cpu_optimizer_pd_t::cpu_optimizer_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_optimizer_t);
+
+        status_t init(engine_t *engine) {
+            VDISPATCH_OPTIMIZER(platform::has_data_type_support(
+                                        desc()->grad_data_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_OPTIMIZER(
+                    IMPLICATION(with_param_copy(),
+                            platform::has_data_type_support(
+                                    desc()->param_copy_data_type)),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_OPTIMIZER(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+            for (int i = 0; i < n_tensors(); i++) {
+                const memory_desc_wrapper param_d(dst_md(4 * i));
+                VDISPATCH_OPTIMIZER(param_d.is_dense(),
+                        VERBOSE_UNSUPPORTED_TAG_S, "param");
+                for (dim_t off = 0; off < param_d.nelems();
+                        off += block_size)
+                    blocks_.emplace_back(i, off);
+            }
+            return status::success;
+        }
+
+        // Elements updated at a time by a thread.
+        static constexpr dim_t block_size = 4096;
+
+        // The tensor index and the first element of each block.
+        std::vector<std::pair<int, dim_t>> blocks_;
+    };
+
+    simple_optimizer_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,196 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+using candidate_t = simple_topk_t::candidate_t;
+using chunk_stats_t = simple_topk_t::chunk_stats_t;
+
+// Elements converted to f32 and filtered at a time.
+constexpr dim_t block_size = 256;
+
+// Larger values come first, equal values are ordered by index. Used as the
+// heap comparator, it keeps the worst candidate at the front of the heap.
+bool is_better(const candidate_t &a, const candidate_t &b) {
+    return a.value > b.value || (a.value == b.value && a.index < b.index);
+}
+
+// Returns a pointer to `len` f32 values of the source starting at `off`,
+// converting them into `buf` if needed.
+const float *load_block(data_type_t dt, const void *src, dim_t off, dim_t len,
+        float *buf) {
+    switch (dt) {
+        case data_type::f32: return static_cast<const float *>(src) + off;
+        case data_type::bf16:
+            cvt_bfloat16_to_float(
+                    buf, static_cast<const bfloat16_t *>(src) + off, len);
+            return buf;
+        case data_type::f16:
+            cvt_float16_to_float(
+                    buf, static_cast<const float16_t *>(src) + off, len);
+            return buf;
+        default: assert(!"unsupported data type"); return nullptr;
+    }
+}
+
+} // namespace
+
+status_t simple_topk_t::execute(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+    auto indices = CTX_OUT_CLEAN_MEM(int32_t *, DNNL_ARG_TOPK_INDICES, status);
+    CHECK(status);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto candidates = scratchpad.template get<candidate_t>(key_topk_candidates);
+    auto stats = scratchpad.template get<chunk_stats_t>(key_topk_stats);
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const memory_desc_wrapper indices_d(pd()->dst_md(1));
+    const data_type_t src_dt = src_d.data_type();
+    const data_type_t dst_dt = dst_d.data_type();
+    const dim_t rows = pd()->rows();
+    const dim_t n = pd()->n();
+    const dim_t k = pd()->k();
+    const dim_t n_chunks = pd()->n_chunks();
+    const dim_t chunk_size = pd()->chunk_size();
+    const bool with_softmax = pd()->with_softmax();
+    const float inv_temperature
+            = with_softmax ? 1.f / pd()->temperature() : 1.f;
+
+    // Each thread keeps a heap of the k best elements of its chunk. A block
+    // whose maximum does not beat the worst of a full heap is skipped, so
+    // most of the row is only read once to compute the maximum.
+    parallel_nd(rows, n_chunks, [&](dim_t r, dim_t c) {
+        const dim_t beg = c * chunk_size;
+        const dim_t end = nstl::min(n, beg + chunk_size);
+        const dim_t row_off = src_d.off(r, 0);
+        candidate_t *heap = candidates + (r * n_chunks + c) * k;
+        dim_t n_heap = 0;
+        float threshold = -INFINITY;
+        float chunk_max = -INFINITY;
+        float buf[block_size];
+
+        for (dim_t b = beg; b < end; b += block_size) {
+            const dim_t len = nstl::min(block_size, end - b);
+            const float *vals = load_block(src_dt, src, row_off + b, len, buf);
+            float block_max = -INFINITY;
+            PRAGMA_OMP_SIMD(reduction(max : block_max))
+            for (dim_t i = 0; i < len; i++)
+                block_max = nstl::max(block_max, vals[i]);
+            chunk_max = nstl::max(chunk_max, block_max);
+            if (n_heap == k && !(block_max > threshold)) continue;
+
+            for (dim_t i = 0; i < len; i++) {
+                const float v = vals[i];
+                // Elements are visited in increasing index order, so an
+                // element equal to the worst candidate never replaces it.
+                if (n_heap == k && !(v > threshold)) continue;
+                if (std::isnan(v)) continue;
+                const candidate_t cand = {v, static_cast<int32_t>(b + i)};
+                if (n_heap < k) {
+                    heap[n_heap++] = cand;
+                    std::push_heap(heap, heap + n_heap, is_better);
+                } else {
+                    std::pop_heap(heap, heap + n_heap, is_better);
+                    heap[n_heap - 1] = cand;
+                    std::push_heap(heap, heap + n_heap, is_better);
+                }
+                if (n_heap == k) threshold = heap[0].value;
+            }
+        }
+
+        float sum_exp = 0.f;
+        if (with_softmax && chunk_max > -INFINITY) {
+            for (dim_t b = beg; b < end; b += block_size) {
+                const dim_t len = nstl::min(block_size, end - b);
+                const float *vals
+                        = load_block(src_dt, src, row_off + b, len, buf);
+                PRAGMA_OMP_SIMD(reduction(+ : sum_exp))
+                for (dim_t i = 0; i < len; i++)
+                    sum_exp += ::expf((vals[i] - chunk_max) * inv_temperature);
+            }
+        }
+        stats[r * n_chunks + c] = {chunk_max, sum_exp, n_heap};
+    });
+
+    parallel_nd(rows, [&](dim_t r) {
+        candidate_t *row_cands = candidates + r * n_chunks * k;
+        const chunk_stats_t *row_stats = stats + r * n_chunks;
+
+        // Moves the candidates of all chunks next to each other.
+        dim_t n_cands = row_stats[0].n_candidates;
+        for (dim_t c = 1; c < n_chunks; c++) {
+            const candidate_t *chunk_cands = row_cands + c * k;
+            for (dim_t i = 0; i < row_stats[c].n_candidates; i++)
+                row_cands[n_cands++] = chunk_cands[i];
+        }
+        const dim_t n_out = nstl::min(k, n_cands);
+        std::partial_sort(
+                row_cands, row_cands + n_out, row_cands + n_cands, is_better);
+
+        float row_max = -INFINITY;
+        for (dim_t c = 0; c < n_chunks; c++)
+            row_max = nstl::max(row_max, row_stats[c].max);
+        float row_sum_exp = 0.f;
+        if (with_softmax && row_max > -INFINITY) {
+            for (dim_t c = 0; c < n_chunks; c++) {
+                if (row_stats[c].sum_exp == 0.f) continue;
+                row_sum_exp += row_stats[c].sum_exp
+                        * ::expf((row_stats[c].max - row_max)
+                                * inv_temperature);
+            }
+        }
+
+        // Rows of NaNs only have fewer candidates than requested.
+        for (dim_t j = 0; j < k; j++) {
+            const bool valid = j < n_out;
+            float v = valid ? row_cands[j].value : NAN;
+            if (with_softmax && valid)
+                v = ::expf((v - row_max) * inv_temperature) / row_sum_exp;
+            io::store_float_value(dst_dt, v, dst, dst_d.off(r, j));
+            indices[indices_d.off(r, j)] = valid ? row_cands[j].index : -1;
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
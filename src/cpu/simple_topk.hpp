@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_TOPK_HPP
+#define CPU_SIMPLE_TOPK_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_topk_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Splits each row into chunks that threads select candidates from
+// independently; the candidates of a row are merged at the end.
+struct simple_topk_t : public primitive_t {
+    struct candidate_t {
+        float value;
+        int32_t index;
+    };
+
+    struct chunk_stats_t {
+        float max;
+        float sum_exp;
+        dim_t n_candidates;
+    };
+
+    struct pd_t : public cpu_topk_pd_t {
+        using cpu_topk_pd_t::cpu_topk_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_topk_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using namespace format_tag;
+
+            const data_type_t src_dt = src_md(0)->data_type;
+            const data_type_t dst_dt = dst_md(0)->data_type;
+            VDISPATCH_TOPK(utils::one_of(src_dt, f32, bf16, f16)
+                            && utils::one_of(dst_dt, f32, bf16, f16),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(platform::has_data_type_support(src_dt)
+                            && platform::has_data_type_support(dst_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(n() <= INT32_MAX, VERBOSE_BAD_DIM, "src", 1);
+            VDISPATCH_TOPK(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+            VDISPATCH_TOPK(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_TOPK(memory_desc_wrapper(src_md(0)).matches_tag(ab),
+                    VERBOSE_UNSUPPORTED_TAG_S, "src");
+            VDISPATCH_TOPK(memory_desc_wrapper(dst_md(0)).matches_tag(ab)
+                            && memory_desc_wrapper(dst_md(1)).matches_tag(ab),
+                    VERBOSE_UNSUPPORTED_TAG_S, "dst");
+
+            init_scratchpad();
+            return status::success;
+        }
+
+        dim_t n_chunks() const { return n_chunks_; }
+        dim_t chunk_size() const { return utils::div_up(n(), n_chunks_); }
+
+    private:
+        // Rows shorter than this are not split between threads.
+        static constexpr dim_t min_chunk_size = 4096;
+
+        dim_t n_chunks_ = 1;
+
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            // A decoding step has few rows of a large vocabulary: the rows
+            // are split to keep all threads busy.
+            const dim_t nthr = dnnl_get_max_threads();
+            if (rows() < nthr)
+                n_chunks_ = nstl::max(dim_t(1),
+                        nstl::min(utils::div_up(nthr, rows()),
+                                n() / min_chunk_size));
+            n_chunks_ = utils::div_up(n(), utils::div_up(n(), n_chunks_));
+
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<candidate_t>(
+                    key_topk_candidates, rows() * n_chunks_ * k());
+            scratchpad.template book<chunk_stats_t>(
+                    key_topk_stats, rows() * n_chunks_);
+        }
+    };
+
+    simple_topk_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2024 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -64,6 +65,21 @@ struct stream_t : public cpu::cpu_stream_t {
     status_t enqueue_primitive(const primitive_iface_t *prim_iface,
             exec_ctx_t &exec_ctx) override {
         assert(engine()->kind() == engine_kind::cpu);
+        // On an in-order queue, a primitive with USM arguments only is
+        // executed on the calling thread once the preceding work completes,
+        // which saves the host task submission. The output event is then
+        // only created if it's requested.
+        const bool native_exec = (flags() & stream_flags::in_order)
+                && !is_profiling_enabled()
+                && has_only_host_accessible_args(exec_ctx);
+        if (native_exec) {
+            ::sycl::event::wait_and_throw(sycl_ctx().get_sycl_deps().events);
+            queue().wait_and_throw();
+            status_t status = prim_iface->execute(exec_ctx);
+            sycl_ctx().set_deps(xpu::sycl::event_t());
+            return status;
+        }
+
         auto event = queue().submit([&](::sycl::handler &cgh) {
             register_deps(cgh);
             submit_cpu_primitive(this, prim_iface, exec_ctx, cgh);
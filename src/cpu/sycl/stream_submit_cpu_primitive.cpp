@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2019 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -91,6 +92,22 @@ void fast_dispatch_by_size(submit_ctx_t *submit_ctx, ::sycl::handler &cgh,
 
 } // namespace
 
+bool has_only_host_accessible_args(const exec_ctx_t &exec_ctx) {
+    for (auto &a : exec_ctx.args()) {
+        const auto *mem = a.second.mem();
+        // Host scalar memory objects have no engine
+        if (mem->engine() == nullptr) continue;
+        if (mem->engine()->runtime_kind() != runtime_kind::sycl) continue;
+        const auto *mem_storage = mem->memory_storage();
+        if (mem_storage->is_null()) continue;
+        auto mem_api_kind = utils::downcast<
+                const xpu::sycl::memory_storage_base_t *>(mem_storage)
+                                    ->memory_kind();
+        if (mem_api_kind != xpu::sycl::memory_kind::usm) return false;
+    }
+    return true;
+}
+
 // CPU primitive submission is implemented this way:
 // 1. Obtain all accessible SYCL memory storages from iterating
 //    over the execution context.
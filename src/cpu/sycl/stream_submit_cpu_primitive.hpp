@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2019 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -33,6 +34,10 @@ namespace sycl {
 void submit_cpu_primitive(stream_t *stream, const primitive_iface_t *prim_iface,
         const exec_ctx_t &exec_ctx, ::sycl::handler &cgh);
 
+// Returns true if none of the arguments is a SYCL buffer, so the primitive
+// can access all of them without a host task.
+bool has_only_host_accessible_args(const exec_ctx_t &exec_ctx);
+
 }
 } // namespace cpu
 } // namespace impl
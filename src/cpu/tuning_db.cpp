@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+#include "cpu/tuning_db.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace tuning_db {
+
+namespace {
+
+struct db_t {
+    db_t() : file_name_(getenv_string_user("TUNING_DB")) { load(); }
+
+    bool lookup(const std::string &key, std::vector<int> &params) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        const auto it = entries_.find(key);
+        if (it == entries_.end()) return false;
+        params = it->second;
+        return true;
+    }
+
+    void store(const std::string &key, const std::vector<int> &params) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        entries_[key] = params;
+
+        FILE *f = fopen(file_name_.c_str(), "a");
+        if (!f) {
+            VERROR(common, common, "cannot update tuning database %s",
+                    file_name_.c_str());
+            return;
+        }
+        fprintf(f, "%s", key.c_str());
+        for (int p : params)
+            fprintf(f, " %d", p);
+        fprintf(f, "\n");
+        fclose(f);
+    }
+
+    const std::string &file_name() const { return file_name_; }
+
+private:
+    void load() {
+        if (file_name_.empty()) return;
+        // the database is created at the first store
+        FILE *f = fopen(file_name_.c_str(), "r");
+        if (!f) return;
+
+        std::string line;
+        int c;
+        while ((c = fgetc(f)) != EOF) {
+            if (c != '\n') {
+                line.push_back(static_cast<char>(c));
+                continue;
+            }
+            add_entry(line);
+            line.clear();
+        }
+        add_entry(line);
+        fclose(f);
+    }
+
+    void add_entry(const std::string &line) {
+        std::istringstream ss(line);
+        std::string key;
+        if (!(ss >> key)) return;
+        std::vector<int> params;
+        int p;
+        while (ss >> p)
+            params.push_back(p);
+        entries_[key] = params;
+    }
+
+    std::string file_name_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::vector<int>> entries_;
+};
+
+db_t &db() {
+    // never destroyed, as the primitives can be created at the program exit
+    static auto *db = new db_t();
+    return *db;
+}
+
+} // namespace
+
+bool is_enabled() {
+    return !db().file_name().empty();
+}
+
+bool lookup(const std::string &key, std::vector<int> &params) {
+    return is_enabled() && db().lookup(key, params);
+}
+
+void store(const std::string &key, const std::vector<int> &params) {
+    if (is_enabled()) db().store(key, params);
+}
+
+} // namespace tuning_db
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
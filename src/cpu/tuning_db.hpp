@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_TUNING_DB_HPP
+#define CPU_TUNING_DB_HPP
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/profiler.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// The database of the implementation parameters found by timing candidates,
+// persisted in the file set by ONEDNN_TUNING_DB. Every line of the file is an
+// entry: a key with no spaces followed by the integer parameters. Entries
+// added later override the earlier ones with the same key.
+//
+// The keys identify the problem and the machine properties it was tuned
+// on, for example the ISA and the number of threads, so a database can be
+// shared by the primitives of different kinds.
+namespace tuning_db {
+
+// Returns true if autotuning is enabled, i.e. a database file is set
+bool is_enabled();
+
+// Returns true and the parameters if the key is in the database
+bool lookup(const std::string &key, std::vector<int> &params);
+
+// Adds the parameters of the key to the database and to its file
+void store(const std::string &key, const std::vector<int> &params);
+
+// Returns the best of `nruns` timings of `f` in milliseconds
+template <typename F>
+double time_ms(const F &f, int nruns = 3) {
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < nruns; i++) {
+        const double start = get_msec();
+        f();
+        const double duration = get_msec() - start;
+        if (duration < best) best = duration;
+    }
+    return best;
+}
+
+} // namespace tuning_db
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_TUNING_DB_HPP
@@ -1,6 +1,6 @@
 /*******************************************************************************
 * Copyright 2025 Intel Corporation
-* Copyright 2025 Arm Ltd. and affiliates
+* Copyright 2025-2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -65,6 +65,18 @@ status_t dnnl_transform_execute(
     return status::unimplemented;
 }
 
+status_t dnnl_transform_execute_parallel(
+        const transform_t *transform, const void *in_ptr, void *out_ptr) {
+#if DNNL_X64
+    // The x64 transform packs in the calling thread only.
+    return x64::ukernel::dnnl_transform_execute(transform, in_ptr, out_ptr);
+#elif DNNL_AARCH64
+    return aarch64::ukernel::dnnl_transform_execute_parallel(
+            transform, in_ptr, out_ptr);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_transform_destroy(transform_t *transform) {
 #if DNNL_X64
     return x64::ukernel::dnnl_transform_destroy(transform);
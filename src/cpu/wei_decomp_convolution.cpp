@@ -0,0 +1,241 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/stream.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/wei_decomp_convolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace memory_tracking::names;
+
+bool wei_decomp_convolution_fwd_t::pd_t::wei_scales_ok() const {
+    const auto &scales = attr()->scales_;
+    if (!scales.has_default_values({DNNL_ARG_WEIGHTS})) return false;
+    if (scales.has_default_values(DNNL_ARG_WEIGHTS)) return true;
+
+    const auto &wei_scales = scales.get(DNNL_ARG_WEIGHTS);
+    const int g_mask = with_groups() ? 1 : 0;
+    const int oc_mask = 1 << with_groups();
+    const int ic_mask = 1 << (with_groups() + 1);
+    const int mask = wei_scales.get_mask();
+    const bool mask_ok = utils::one_of(mask, 0, g_mask | oc_mask,
+            g_mask | oc_mask | ic_mask);
+    const dim_t ic_group = wei_scales.get_group(1);
+    const bool groups_ok = wei_scales.has_default_groups()
+            || (wei_scales.get_group(0) == 1 && ic_group > 0
+                    && (IC() / G()) % ic_group == 0 && (mask & ic_mask));
+    return mask_ok && groups_ok
+            && utils::one_of(wei_scales.get_data_type(), data_type::f32,
+                    data_type::bf16, data_type::f16);
+}
+
+status_t wei_decomp_convolution_fwd_t::pd_t::init_convolution(
+        engine_t *engine) {
+    // The nested convolution gets the weights in the data type of the
+    // activations and picks their layout.
+    memory_desc_t conv_wei_md;
+    CHECK(memory_desc_init_by_md_and_dt(
+            conv_wei_md, desc()->weights_desc, src_md()->data_type));
+    conv_wei_md.format_kind = format_kind::any;
+
+    convolution_desc_t cd = convolution_desc_t();
+    CHECK(conv_desc_init(&cd, desc()->prop_kind, desc()->alg_kind,
+            &desc()->src_desc, &conv_wei_md, &desc()->bias_desc,
+            &desc()->dst_desc, desc()->strides, desc()->dilates,
+            desc()->padding[0], desc()->padding[1]));
+
+    primitive_attr_t conv_attr;
+    CHECK(conv_attr.set_post_ops(attr()->post_ops_));
+    CHECK(conv_attr.set_fpmath_mode(attr()->fpmath_.mode_));
+
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&cd, &conv_attr, nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+    while (++it != it.end()) {
+        conv_pd_ = *it;
+        // Compensations would need the quantized weights.
+        if (conv_pd_->weights_md(0)->extra.flags == 0) return status::success;
+    }
+    return status::unimplemented;
+}
+
+status_t wei_decomp_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(utils::one_of(src_md()->data_type, f32, bf16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(utils::one_of(weights_md(0)->data_type, s8, u8, s4, u4),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(
+            attr()->has_default_values(smask_t::scales_groups
+                    | smask_t::scales_data_type | smask_t::post_ops
+                    | smask_t::sum_dt | smask_t::fpmath_mode),
+            VERBOSE_UNSUPPORTED_ATTR);
+    // As for matmul, integer weights are converted to floating-point only
+    // when the fpmath mode applies to them.
+    VDISPATCH_CONV(attr()->fpmath_.apply_to_int_, VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(wei_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    if (weights_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_strides(weights_md_, nullptr));
+    VDISPATCH_CONV(weights_md_.format_kind == format_kind::blocked
+                    && weights_md_.extra.flags == 0,
+            VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_convolution(engine));
+
+    if (src_md_.format_kind == format_kind::any)
+        src_md_ = *conv_pd_->src_md();
+    if (dst_md_.format_kind == format_kind::any)
+        dst_md_ = *conv_pd_->dst_md();
+    if (bias_md_.format_kind == format_kind::any)
+        bias_md_ = *conv_pd_->weights_md(1);
+
+    name_.append(conv_pd_->name());
+    init_scratchpad();
+    return attr_.set_default_formats(dst_md(0));
+}
+
+void wei_decomp_convolution_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_nested, conv_pd_->scratchpad_registry());
+    const memory_desc_wrapper conv_wei_d(conv_pd_->weights_md(0));
+    scratchpad.book(key_conv_decompressed_wei, conv_wei_d.size(), 1,
+            platform::get_cache_line_size());
+}
+
+dim_t wei_decomp_convolution_fwd_t::pd_t::wei_scale_off(
+        dim_t g, dim_t oc, dim_t ic) const {
+    const auto &wei_scales = attr()->scales_.get(DNNL_ARG_WEIGHTS);
+    const int mask = wei_scales.get_mask();
+    dim_t off = 0;
+    if (with_groups() && (mask & 1)) off = g;
+    if (mask & (1 << with_groups())) off = off * (OC() / G()) + oc;
+    if (mask & (1 << (with_groups() + 1))) {
+        const dim_t ic_group = wei_scales.get_group(1);
+        off = off * (IC() / G() / ic_group) + ic / ic_group;
+    }
+    return off;
+}
+
+void wei_decomp_convolution_fwd_t::decompress_weights(
+        const exec_ctx_t &ctx, void *wei_buf) const {
+    const auto wei = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    const auto wei_scales = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const memory_desc_wrapper buf_d(pd()->conv_pd_->weights_md(0));
+    const auto wei_dt = wei_d.data_type();
+    const auto buf_dt = buf_d.data_type();
+    const auto scales_dt = pd()->attr()->scales_.get_data_type(
+            DNNL_ARG_WEIGHTS);
+    const bool with_scales
+            = !pd()->attr()->scales_.has_default_values(DNNL_ARG_WEIGHTS);
+
+    // Padded channels of the buffer are zeroed beforehand as the loop below
+    // only writes the logical elements.
+    if (buf_d.nelems(true) != buf_d.nelems()) {
+        const size_t size = buf_d.size();
+        parallel(0, [&](int ithr, int nthr) {
+            size_t start = 0, end = 0;
+            balance211(size, nthr, ithr, start, end);
+            if (start < end)
+                std::memset(static_cast<char *>(wei_buf) + start, 0,
+                        end - start);
+        });
+    }
+
+    const bool with_groups = pd()->with_groups();
+    const int sp_ndims = pd()->ndims() - 2;
+    const dim_t G = pd()->G();
+    const dim_t OC = pd()->OC() / G;
+    const dim_t IC = pd()->IC() / G;
+    const dim_t KD = pd()->KD(), KH = pd()->KH(), KW = pd()->KW();
+
+    parallel_nd(G, OC, [&](dim_t g, dim_t oc) {
+        dims_t pos {};
+        if (with_groups) pos[0] = g;
+        pos[with_groups + 0] = oc;
+        const int sp_off = with_groups + 2;
+        for (dim_t ic = 0; ic < IC; ++ic) {
+            pos[with_groups + 1] = ic;
+            const float scale = with_scales
+                    ? io::load_float_value(scales_dt, wei_scales,
+                            pd()->wei_scale_off(g, oc, ic))
+                    : 1.f;
+            for_(dim_t kd = 0; kd < KD; ++kd)
+            for_(dim_t kh = 0; kh < KH; ++kh)
+            for (dim_t kw = 0; kw < KW; ++kw) {
+                const dim_t sp[3] = {kd, kh, kw};
+                for (int d = 0; d < sp_ndims; ++d)
+                    pos[sp_off + d] = sp[3 - sp_ndims + d];
+                const float w = io::load_float_value(
+                        wei_dt, wei, wei_d.off_v(pos));
+                io::store_float_value(
+                        buf_dt, w * scale, wei_buf, buf_d.off_v(pos));
+            }
+        }
+    });
+}
+
+status_t wei_decomp_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    engine_t *engine = ctx.stream()->engine();
+
+    decompress_weights(
+            ctx, scratchpad.template get<void>(key_conv_decompressed_wei));
+
+    auto wei_buf_storage
+            = scratchpad.get_memory_storage(key_conv_decompressed_wei);
+
+    std::unique_ptr<memory_t, memory_deleter_t> wei_buf;
+    CHECK(safe_ptr_assign(wei_buf,
+            new memory_t(engine, pd()->conv_pd_->weights_md(0),
+                    std::move(wei_buf_storage))));
+
+    // The arguments are copied to pass the post-ops memories through.
+    exec_args_t conv_args = ctx.args();
+    conv_args[DNNL_ARG_WEIGHTS] = {wei_buf.get(), true};
+    conv_args.erase(DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+
+    exec_ctx_t conv_ctx(ctx, std::move(conv_args));
+    auto *nested_grantor = create_nested_grantor(
+            scratchpad, key_nested, conv_p_->pd()->scratchpad_registry());
+    conv_ctx.set_scratchpad_grantor(nested_grantor);
+    return conv_p_->execute(conv_ctx);
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
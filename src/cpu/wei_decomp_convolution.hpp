@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_WEI_DECOMP_CONVOLUTION_HPP
+#define CPU_WEI_DECOMP_CONVOLUTION_HPP
+
+#include <memory>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Forward convolution with s8, u8, s4 or u4 weights and f32 or bf16
+// activations. The weights are dequantized with their scales, per output
+// channel and optionally per group of input channels, into a scratchpad
+// buffer in the layout of a nested convolution with weights of the
+// activations data type, which then does the computations.
+//
+// The scales groups are given over the (output channels, input channels)
+// dimensions of the weights as {1, G_ic}, G_ic dividing the input channels of
+// a convolution group.
+struct wei_decomp_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        pd_t(const pd_t &other)
+            : cpu_convolution_fwd_pd_t(other)
+            , conv_pd_(other.conv_pd_->clone())
+            , name_(other.name_) {}
+
+        DECLARE_COMMON_PD_T(name_.c_str(), wei_decomp_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Returns the offset of the scale of weights element (g, oc, ic),
+        // oc and ic being taken within the group.
+        dim_t wei_scale_off(dim_t g, dim_t oc, dim_t ic) const;
+
+        std::shared_ptr<primitive_desc_t> conv_pd_;
+
+    private:
+        std::string name_ = "wei_decomp:any+";
+
+        bool wei_scales_ok() const;
+        status_t init_convolution(engine_t *engine);
+        void init_scratchpad();
+    };
+
+    wei_decomp_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        return pd()->conv_pd_->create_primitive(conv_p_, engine);
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Writes the dequantized weights to `wei_buf` in the layout of the nested
+    // convolution weights.
+    void decompress_weights(const exec_ctx_t &ctx, void *wei_buf) const;
+
+    std::shared_ptr<primitive_t> conv_p_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -17,8 +17,11 @@
 #ifndef CPU_X64_BRGEMM_BRGEMM_CONTAINERS_HPP
 #define CPU_X64_BRGEMM_BRGEMM_CONTAINERS_HPP
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <set>
-#include "common/rw_mutex.hpp"
+
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/brgemm/brgemm.hpp"
 
@@ -67,8 +70,39 @@ private:
     std::vector<std::vector<brgemm_batch_element_t>> static_offsets_list_;
 };
 
-// global storage disabled for now
-// #define BRGEMM_KERNEL_GLOBAL_STORAGE
+// Process-wide cache of generated brgemm kernels shared by all primitives.
+// Kernels are keyed by the full descriptor, including its attributes and
+// destination memory descriptor, so identical kernels requested by different
+// primitives are generated and stored once. The cache holds weak references
+// only: a kernel is released with the last primitive using it.
+struct brgemm_kernel_cache_t {
+    static brgemm_kernel_cache_t &instance();
+
+    // Returns in `kernel` the cached kernel for `brg`, generating it on a miss.
+    status_t get_or_create(std::shared_ptr<const brgemm_kernel_t> &kernel,
+            const brgemm_desc_t &brg);
+
+private:
+    struct entry_t;
+    struct desc_ptr_less_t {
+        bool operator()(
+                const brgemm_desc_t *lhs, const brgemm_desc_t *rhs) const {
+            return *lhs < *rhs;
+        }
+    };
+
+    brgemm_kernel_cache_t();
+    ~brgemm_kernel_cache_t();
+
+    std::shared_ptr<const brgemm_kernel_t> find(const brgemm_desc_t &brg);
+    void evict_expired();
+
+    std::mutex mutex_;
+    std::multimap<const brgemm_desc_t *, std::unique_ptr<entry_t>,
+            desc_ptr_less_t>
+            map_;
+    size_t n_inserted_since_evict_ = 0;
+};
 
 struct brgemm_kernel_container_t {
     brgemm_kernel_container_t() = default;
@@ -79,35 +113,13 @@ struct brgemm_kernel_container_t {
     }
 
     status_t insert(int idx, const brgemm_desc_t *brg);
-    static bool brgemm_kernel_cmp(const std::shared_ptr<brgemm_kernel_t> &lhs,
-            const std::shared_ptr<brgemm_kernel_t> &rhs);
 
 private:
     std::vector<const brgemm_kernel_t *> refs_;
-#ifdef BRGEMM_KERNEL_GLOBAL_STORAGE
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
-
-    void lock_write() { rw_mutex().lock_write(); }
-    void unlock_write() { rw_mutex().unlock_write(); }
-
-#else
-    std::set<std::shared_ptr<brgemm_kernel_t>,
-            decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>
-            set_ {std::set<std::shared_ptr<brgemm_kernel_t>,
-                    decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>(
-                    brgemm_kernel_container_t::brgemm_kernel_cmp)};
-
-    void lock_write() {}
-    void unlock_write() {}
-#endif
-    std::set<std::shared_ptr<brgemm_kernel_t>,
-            decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *> &
-    get_set();
-
-    std::map<const brgemm_desc_t *, const brgemm_kernel_t *> brgemm_map_;
+    // Owns the kernels used by the container. Descriptors are unique inside a
+    // primitive, so several indices may share an entry.
+    std::map<const brgemm_desc_t *, std::shared_ptr<const brgemm_kernel_t>>
+            brgemm_map_;
 };
 
 struct brgemm_palette_container_t {
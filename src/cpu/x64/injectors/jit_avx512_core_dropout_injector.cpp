@@ -0,0 +1,170 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstddef>
+
+#include "cpu/x64/injectors/jit_avx512_core_dropout_injector.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+
+Address jit_avx512_core_dropout_injector_t::table_val(key_t key) {
+    return h->ptr[h->rip + l_table_ + static_cast<int>(key)];
+}
+
+Address jit_avx512_core_dropout_injector_t::table_bcst(key_t key) {
+    return h->ptr_b[h->rip + l_table_ + static_cast<int>(key)];
+}
+
+Address jit_avx512_core_dropout_injector_t::args_val(size_t offset) const {
+    return h->dword[reg_args_ + offset];
+}
+
+Address jit_avx512_core_dropout_injector_t::args_bcst(size_t offset) const {
+    return h->ptr_b[reg_args_ + offset];
+}
+
+void jit_avx512_core_dropout_injector_t::mulhilo(
+        const Zmm &hi, const Zmm &lo, const Zmm &a, key_t mul, key_t mul_q) {
+    // vpmuludq multiplies the even dwords into qwords. The high halves of the
+    // products of the even lanes are shifted down in place, the ones of the
+    // odd lanes are already there in the products of the shifted lanes.
+    h->vpmuludq(lo, a, table_bcst(mul_q));
+    h->vpsrlq(lo, lo, 32);
+    h->vpsrlq(hi, a, 32);
+    h->vpmuludq(hi, hi, table_bcst(mul_q));
+    // hi = (hi & hi_mask) | lo
+    h->vpternlogq(hi, lo, table_bcst(hi_mask_q), 0xec);
+    h->vpmulld(lo, a, table_bcst(mul));
+}
+
+void jit_avx512_core_dropout_injector_t::compute_vector(const Zmm &zmm_data,
+        const Reg64 &reg_idx, const Address &mask_addr, bool tail) {
+    // Registers are renamed across the rounds instead of being moved.
+    Zmm ctr[4] = {aux(0), aux(1), aux(2), aux(3)};
+    Zmm tmp[4] = {aux(4), aux(5), aux(6), aux(7)};
+    const Zmm key0 = aux(8), key1 = aux(9);
+    const Address use_offset
+            = args_val(offsetof(dropout_args_t, use_offset));
+
+    Label l_legacy, l_rounds, l_selected;
+
+    // Low halves of the indices of the lanes, and the counter word holding
+    // them rounded down to a multiple of 4
+    h->vpbroadcastq(tmp[0], reg_idx);
+    h->vpshufd(ctr[3], tmp[0], 0x55);
+    h->vpshufd(tmp[0], tmp[0], 0x00);
+    h->vpaddd(tmp[1], tmp[0], table_val(iota));
+    h->vpandd(ctr[2], tmp[1], table_bcst(not_three));
+
+    h->cmp(use_offset, 0);
+    h->je(l_legacy, h->T_NEAR);
+    // The counter is (offset, index) with 64-bit halves: the high half of the
+    // index is carried into where the low halves of the lanes wrap around.
+    h->vpcmpud(k_aux_, tmp[1], tmp[0], jit_generator_t::_cmp_lt_os);
+    h->vpaddd(ctr[3] | k_aux_, ctr[3], table_bcst(one));
+    h->vpbroadcastd(ctr[0], args_val(offsetof(dropout_args_t, offset)));
+    h->vpbroadcastd(ctr[1], args_val(offsetof(dropout_args_t, offset) + 4));
+    h->vpbroadcastd(key0, args_val(offsetof(dropout_args_t, seed)));
+    h->vpbroadcastd(key1, args_val(offsetof(dropout_args_t, seed) + 4));
+    h->jmp(l_rounds, h->T_NEAR);
+
+    // The legacy counter is (x, x + 1, x, x + 3) for the 32-bit index x
+    // rounded down to a multiple of 4, with the low half of the seed as both
+    // keys.
+    h->L(l_legacy);
+    h->vmovdqa32(ctr[0], ctr[2]);
+    h->vpaddd(ctr[1], ctr[2], table_bcst(one));
+    h->vpaddd(ctr[3], ctr[2], table_bcst(three));
+    h->vpbroadcastd(key0, args_val(offsetof(dropout_args_t, seed)));
+    h->vmovdqa32(key1, key0);
+
+    h->L(l_rounds);
+    constexpr int n_rounds = 10;
+    for (int r = 0; r < n_rounds; r++) {
+        mulhilo(tmp[1], tmp[0], ctr[0], mul_0, mul_0_q);
+        mulhilo(tmp[3], tmp[2], ctr[2], mul_1, mul_1_q);
+        // (hi_1 ^ c_1 ^ k_0, lo_1, hi_0 ^ c_3 ^ k_1, lo_0)
+        h->vpternlogd(ctr[1], tmp[3], key0, 0x96);
+        h->vpternlogd(ctr[3], tmp[1], key1, 0x96);
+        const Zmm new_ctr[4] = {ctr[1], tmp[2], ctr[3], tmp[0]};
+        const Zmm new_tmp[4] = {ctr[0], ctr[2], tmp[1], tmp[3]};
+        for (int i = 0; i < 4; i++) {
+            ctr[i] = new_ctr[i];
+            tmp[i] = new_tmp[i];
+        }
+        if (r == n_rounds - 1) break;
+        h->vpaddd(key0, key0, table_bcst(key_inc_0));
+        h->vpaddd(key1, key1, table_bcst(key_inc_1));
+    }
+
+    // The legacy generator returns the third word to all the lanes, the other
+    // one the word of the lane index modulo 4.
+    const Zmm rnd = tmp[0];
+    h->vmovdqa32(rnd, ctr[2]);
+    h->cmp(use_offset, 0);
+    h->je(l_selected, h->T_NEAR);
+    h->vpbroadcastd(tmp[1], reg_idx.cvt32());
+    h->vpaddd(tmp[1], tmp[1], table_val(iota));
+    h->vpandd(tmp[1], tmp[1], table_bcst(three));
+    h->vmovdqa32(rnd, ctr[0]);
+    const key_t words[] = {one, two, three};
+    for (int w = 1; w < 4; w++) {
+        h->vpcmpeqd(k_aux_, tmp[1], table_bcst(words[w - 1]));
+        h->vmovdqa32(rnd | k_aux_, ctr[w]);
+    }
+    h->L(l_selected);
+
+    h->vpcmpud(k_keep_, rnd, args_bcst(offsetof(dropout_args_t, threshold)),
+            jit_generator_t::_cmp_nle_us);
+    h->vmulps(zmm_data | k_keep_ | h->T_z, zmm_data,
+            args_bcst(offsetof(dropout_args_t, inv_q)));
+    if (with_mask_) {
+        h->vpbroadcastd(tmp[1] | k_keep_ | h->T_z, table_val(one));
+        if (tail)
+            h->vpmovdb(mask_addr | k_tail_, tmp[1]);
+        else
+            h->vpmovdb(mask_addr, tmp[1]);
+    }
+}
+
+void jit_avx512_core_dropout_injector_t::prepare_table() {
+    h->align(64);
+    h->L(l_table_);
+    for (int i = 0; i < 16; i++)
+        h->dd(i);
+    h->dd(1);
+    h->dd(2);
+    h->dd(3);
+    h->dd(0xfffffffc);
+    // Philox 4x32 multipliers and key increments
+    h->dd(0xd2511f53);
+    h->dd(0xcd9e8d57);
+    h->dd(0x9e3779b9);
+    h->dd(0xbb67ae85);
+    h->dq(0xd2511f53);
+    h->dq(0xcd9e8d57);
+    h->dq(0xffffffff00000000);
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_INJECTORS_JIT_AVX512_CORE_DROPOUT_INJECTOR_HPP
+#define CPU_X64_INJECTORS_JIT_AVX512_CORE_DROPOUT_INJECTOR_HPP
+
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Applies dropout to f32 vectors, generating the random values in registers
+// with the Philox 4x32-10 generator of `ref_dropout(...)`. The random value of
+// an element depends only on its logical index, the seed and the offset, so
+// it is computed where the element is produced and no mask tensor is read or
+// written unless the user requested it.
+struct jit_avx512_core_dropout_injector_t {
+    // Arguments description:
+    // host - jit generator which is filled with instructions
+    // vmm_aux_start - first of the `n_vregs` consecutive Zmm registers the
+    //   injector uses
+    // k_aux, k_keep - opmask registers the injector uses
+    // k_tail - opmask of the valid lanes of a tail vector
+    // reg_args - GPR holding the address of a `dropout_args_t`
+    // with_mask - when true, the mask of the kept elements is stored as u8
+    jit_avx512_core_dropout_injector_t(jit_generator_t *host, int vmm_aux_start,
+            const Xbyak::Opmask &k_aux, const Xbyak::Opmask &k_keep,
+            const Xbyak::Opmask &k_tail, const Xbyak::Reg64 &reg_args,
+            bool with_mask)
+        : h(host)
+        , vmm_aux_start_(vmm_aux_start)
+        , k_aux_(k_aux)
+        , k_keep_(k_keep)
+        , k_tail_(k_tail)
+        , reg_args_(reg_args)
+        , with_mask_(with_mask) {}
+
+    static constexpr int n_vregs = 10;
+
+    // Applies dropout to the 16 elements of `zmm_data` of logical indices
+    // from `reg_idx`. The mask, if any, is stored to `mask_addr`; only the
+    // lanes of `k_tail` are stored when `tail` is set.
+    void compute_vector(const Xbyak::Zmm &zmm_data, const Xbyak::Reg64 &reg_idx,
+            const Xbyak::Address &mask_addr, bool tail = false);
+
+    // Must be called from the host kernel after postamble.
+    void prepare_table();
+
+private:
+    jit_generator_t *const h;
+    const int vmm_aux_start_;
+    const Xbyak::Opmask k_aux_;
+    const Xbyak::Opmask k_keep_;
+    const Xbyak::Opmask k_tail_;
+    const Xbyak::Reg64 reg_args_;
+    const bool with_mask_;
+
+    Xbyak::Label l_table_;
+
+    // Offsets of the constants in the table
+    enum key_t {
+        iota = 0, // 16 dwords
+        one = 64,
+        two = 68,
+        three = 72,
+        not_three = 76,
+        mul_0 = 80,
+        mul_1 = 84,
+        key_inc_0 = 88,
+        key_inc_1 = 92,
+        mul_0_q = 96, // qwords
+        mul_1_q = 104,
+        hi_mask_q = 112,
+    };
+
+    Xbyak::Address table_val(key_t key);
+    Xbyak::Address table_bcst(key_t key);
+    Xbyak::Address args_val(size_t offset) const;
+    Xbyak::Address args_bcst(size_t offset) const;
+
+    Xbyak::Zmm aux(int i) const { return Xbyak::Zmm(vmm_aux_start_ + i); }
+
+    // hi:lo = m * a for the multiplier m stored at `mul` as a dword and at
+    // `mul_q` as a qword
+    void mulhilo(const Xbyak::Zmm &hi, const Xbyak::Zmm &lo,
+            const Xbyak::Zmm &a, key_t mul, key_t mul_q);
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
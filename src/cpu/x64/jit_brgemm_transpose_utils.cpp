@@ -3040,6 +3040,9 @@ void jit_amx_ip_trans_diff_wei_to_vnni_t::generate() {
                                 + typesize_acc * (ic2 * jbgp_->oc_block)]);
                 if (jbgp_->wei_dt == data_type::bf16) {
                     vcvtne2ps2bf16(zmm_src_0, zmm_src_1, zmm_src_0);
+                } else if (mayiuse(avx10_2)) {
+                    assert(jbgp_->wei_dt == data_type::f16);
+                    vcvt2ps2phx(zmm_src_0, zmm_src_1, zmm_src_0);
                 } else {
                     assert(jbgp_->wei_dt == data_type::f16);
                     vcvtps2phx(Ymm(zmm_src_0.getIdx()), zmm_src_0);
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+
 #include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/compiler_workarounds.hpp"
@@ -21,9 +23,12 @@
 #include "common/nstl.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/primitive_attr_postops.hpp"
+
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
+#include "cpu/x64/injectors/jit_avx512_core_dropout_injector.hpp"
 #include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
 #include "cpu/x64/jit_uni_eltwise.hpp"
 #include "cpu/x64/utils/jit_io_helper.hpp"
@@ -42,6 +47,10 @@ struct jit_args_t {
     const void *dst; // fwd: dst;  bwd: diff_src;
     const void *diff_dst; // fwd: nullptr;  bwd: diff_dst;
     size_t work_amount;
+    // fwd with dropout only
+    const dropout_args_t *dropout_args;
+    void *dropout_mask; // mask of the first element, or nullptr
+    size_t idx; // logical index of the first element
 };
 
 struct jit_uni_eltwise_kernel_t : public jit_generator_t {
@@ -86,7 +95,10 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
                           : is_f8()   ? cpu_isa_traits_t<isa>::vlen / 4
                                       : cpu_isa_traits_t<isa>::vlen)
         , simd_w_(vlen_ / dtype_size())
-        , is_fwd_(pd_->is_fwd()) {
+        , is_fwd_(pd_->is_fwd())
+        , with_dropout_(is_fwd_ && !pd_->attr()->dropout_.has_default_values())
+        , with_dropout_mask_(
+                  with_dropout_ && pd_->attr()->dropout_.has_output_mask()) {
 
         const auto &desc = *pd_->desc();
         // we can consider that there's no auxiliary vregs on fwd path
@@ -108,11 +120,20 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, get_io_isa(isa),
                 {data_type()}, io_conf, io_tail_conf, io_bf16_conf, {},
                 utils::nullopt, io_fp8_conf);
+        if (with_dropout_)
+            dropout_injector_.reset(new jit_avx512_core_dropout_injector_t(
+                    this, dropout_vmm_start_idx_,
+                    Opmask(dropout_kmask_aux_idx_),
+                    Opmask(dropout_kmask_keep_idx_), Opmask(tail_opmask_idx_),
+                    reg_dropout_args, with_dropout_mask_));
     }
 
     void compute_dst(const bool tail) {
         io_[data_type()]->load(ptr[reg_src], vmm_src, tail);
         eltwise_injector_->compute_vector(vmm_src.getIdx());
+        if (with_dropout_)
+            dropout_injector_->compute_vector(Zmm(vmm_src.getIdx()), reg_idx,
+                    ptr[reg_dropout_mask], tail);
         if (!is_fwd_) {
             io_[data_type()]->load(ptr[reg_diff_dst], vmm_diff_dst, tail);
             uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
@@ -178,6 +199,8 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
             add(reg_src, vlen_);
             add(reg_dst, vlen_);
             if (!is_fwd_) add(reg_diff_dst, vlen_);
+            if (with_dropout_) add(reg_idx, simd_w_);
+            if (with_dropout_mask_) add(reg_dropout_mask, simd_w_);
 
             sub(reg_work_amount, simd_w_);
             cmp(reg_work_amount, simd_w_);
@@ -193,6 +216,8 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
             add(reg_src, dtype_size());
             add(reg_dst, dtype_size());
             if (!is_fwd_) add(reg_diff_dst, dtype_size());
+            if (with_dropout_) inc(reg_idx);
+            if (with_dropout_mask_) inc(reg_dropout_mask);
 
             dec(reg_work_amount);
             jmp(reminder_loop_start, T_NEAR);
@@ -211,6 +236,12 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         mov(reg_dst, ptr[param + GET_OFF(dst)]);
         if (!is_fwd_) mov(reg_diff_dst, ptr[param + GET_OFF(diff_dst)]);
         mov(reg_work_amount, ptr[param + GET_OFF(work_amount)]);
+        if (with_dropout_) {
+            mov(reg_dropout_args, ptr[param + GET_OFF(dropout_args)]);
+            mov(reg_idx, ptr[param + GET_OFF(idx)]);
+            if (with_dropout_mask_)
+                mov(reg_dropout_mask, ptr[param + GET_OFF(dropout_mask)]);
+        }
         eltwise_injector_->load_table_addr();
 
         // TODO: consider improving.
@@ -229,6 +260,7 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
 
         eltwise_injector_->prepare_table();
         if (is_f8()) io_.prepare_table_fp8();
+        if (with_dropout_) dropout_injector_->prepare_table();
     }
 
 private:
@@ -239,6 +271,8 @@ private:
     const int vlen_;
     const int simd_w_;
     const bool is_fwd_;
+    const bool with_dropout_;
+    const bool with_dropout_mask_;
     const int tail_size_ = 1;
 
     Reg64 reg_src = rax;
@@ -248,6 +282,9 @@ private:
     Reg64 reg_work_amount = rsi;
     Reg64 imm_addr64 = rbx;
     Reg64 reg_tmp = r14;
+    Reg64 reg_dropout_args = r12;
+    Reg64 reg_idx = r13;
+    Reg64 reg_dropout_mask = r15;
 
     Opmask injector_mask = Opmask(1);
 
@@ -263,6 +300,7 @@ private:
     Vmm vmm_diff_dst_even = vmm_diff_dst;
     Vmm vmm_diff_dst_odd = Vmm(9);
     std::unique_ptr<jit_uni_eltwise_injector_t<injector_isa>> eltwise_injector_;
+    std::unique_ptr<jit_avx512_core_dropout_injector_t> dropout_injector_;
     io::jit_io_multi_dt_helper_t<Vmm> io_;
 
     /* bf16 and fp8 support */
@@ -273,6 +311,11 @@ private:
     const int emu_zmm_5_idx_ = 29;
     const int tail_opmask_idx_ = 6;
     const int emu_kmask_aux_idx_ = 2;
+
+    /* dropout support */
+    const int dropout_vmm_start_idx_ = 10;
+    const int dropout_kmask_aux_idx_ = 3;
+    const int dropout_kmask_keep_idx_ = 4;
 };
 
 } // namespace
@@ -315,10 +358,35 @@ status_t jit_uni_eltwise_fwd_t<isa>::pd_t::init(engine_t *engine) {
     // refer to a comment in jit_uni_kernel why this is needed
     VDISPATCH_ELTWISE(IMPLICATION(!src_d.is_dense(), is_zero_preserved()),
             VERBOSE_UNSUPPORTED_SPARSE_CFG);
-    VDISPATCH_ELTWISE(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_ELTWISE(attr()->has_default_values(
+                              primitive_attr_t::skip_mask_t::dropout),
+            VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_ELTWISE(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
     VDISPATCH_ELTWISE(src_d == memory_desc_wrapper(dst_md()),
             VERBOSE_INCONSISTENT_MDS, "src", "dst");
+    CHECK(dropout_ok());
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_eltwise_fwd_t<isa>::pd_t::dropout_ok() {
+    if (attr()->dropout_.has_default_values()) return status::success;
+
+    VDISPATCH_ELTWISE_IC(
+            is_superset(isa, avx512_core), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_ELTWISE_IC(
+            attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_DROPOUT);
+
+    using namespace format_tag;
+    // See `ref_dropout(...)` comment which explains the requirement.
+    VDISPATCH_ELTWISE_IC(
+            memory_desc_matches_one_of_tag(*dst_md(0), ncdhw, nchw, ncw, nc)
+                    && IMPLICATION(attr_.dropout_.has_output_mask(),
+                            memory_desc_wrapper(dst_md(0)).similar_to(
+                                    attr_.dropout_.dropout_desc_, true, false)),
+            VERBOSE_UNSUPPORTED_DROPOUT);
 
     return status::success;
 }
@@ -341,28 +409,73 @@ status_t jit_uni_eltwise_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
 
+    // The dropout arguments are read once for all the threads.
+    const auto &dropout = pd()->attr()->dropout_;
+    const dropout_args_t dropout_args = !dropout.has_default_values()
+            ? get_dropout_args(ctx, dropout)
+            : dropout_args_t();
+    auto dropout_mask = dropout.has_output_mask()
+            ? CTX_OUT_MEM(unsigned char *, DNNL_ARG_ATTR_DROPOUT_MASK)
+            : nullptr;
+
+    std::atomic<status_t> st(status::success);
+    parallel(0, [&](const int ithr, const int nthr) {
+        status_t st_thr = execute_thr(
+                ithr, nthr, src, dst, &dropout_args, dropout_mask);
+        if (st_thr != status::success) st = st_thr;
+    });
+    return st;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_eltwise_fwd_t<isa>::execute_in_team(
+        const exec_ctx_t &ctx, int ithr, int nthr) const {
+    // There is no serial section before a team runs, so every thread of the
+    // team resolves the arguments.
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const auto &dropout = pd()->attr()->dropout_;
+    const dropout_args_t dropout_args = !dropout.has_default_values()
+            ? get_dropout_args(ctx, dropout)
+            : dropout_args_t();
+    auto dropout_mask = dropout.has_output_mask()
+            ? CTX_OUT_MEM(unsigned char *, DNNL_ARG_ATTR_DROPOUT_MASK)
+            : nullptr;
+
+    return execute_thr(ithr, nthr, src, dst, &dropout_args, dropout_mask);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_eltwise_fwd_t<isa>::execute_thr(int ithr, int nthr,
+        const char *src, char *dst, const dropout_args_t *dropout_args,
+        unsigned char *dropout_mask) const {
     const memory_desc_wrapper data_d(pd()->src_md());
     const auto nelems = data_d.nelems(true);
     const int simd_w = 64 / data_d.data_type_size();
 
+    // The logical index of an element is its offset in dst, which has a
+    // plain layout with dropout.
+    const dim_t idx0 = data_d.offset0();
+
     src += data_d.data_type_size() * data_d.offset0();
     dst += data_d.data_type_size() * data_d.offset0();
 
-    parallel(0, [= COMPAT_THIS_CAPTURE](const int ithr, const int nthr) {
-        dim_t start {0}, end {0};
-
-        balance211(utils::div_up(nelems, simd_w), nthr, ithr, start, end);
-        start = nstl::min(nelems, start * simd_w);
-        end = nstl::min(nelems, end * simd_w);
-        if (start == end) return;
-
-        jit_args_t args;
-        args.src = src + data_d.data_type_size() * start;
-        args.dst = dst + data_d.data_type_size() * start;
-        args.diff_dst = nullptr;
-        args.work_amount = end - start;
-        (*kernel_)(&args);
-    });
+    dim_t start {0}, end {0};
+    balance211(utils::div_up(nelems, simd_w), nthr, ithr, start, end);
+    start = nstl::min(nelems, start * simd_w);
+    end = nstl::min(nelems, end * simd_w);
+    if (start == end) return status::success;
+
+    jit_args_t args;
+    args.src = src + data_d.data_type_size() * start;
+    args.dst = dst + data_d.data_type_size() * start;
+    args.diff_dst = nullptr;
+    args.work_amount = end - start;
+    args.dropout_args = dropout_args;
+    args.dropout_mask = dropout_mask ? dropout_mask + idx0 + start : nullptr;
+    args.idx = idx0 + start;
+    (*kernel_)(&args);
 
     return status::success;
 }
@@ -461,6 +574,9 @@ status_t jit_uni_eltwise_bwd_t<isa>::execute(const exec_ctx_t &ctx) const {
         args.dst = diff_src + diff_data_d.data_type_size() * start;
         args.diff_dst = diff_dst + diff_data_d.data_type_size() * start;
         args.work_amount = end - start;
+        args.dropout_args = nullptr;
+        args.dropout_mask = nullptr;
+        args.idx = 0;
         (*kernel_)(&args);
     });
 
@@ -25,6 +25,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_eltwise_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
 
@@ -44,6 +45,9 @@ struct jit_uni_eltwise_fwd_t : public primitive_t {
                 JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_eltwise_fwd_t);
 
         status_t init(engine_t *engine);
+
+    private:
+        status_t dropout_ok();
     };
 
     jit_uni_eltwise_fwd_t(const pd_t *apd);
@@ -53,9 +57,18 @@ struct jit_uni_eltwise_fwd_t : public primitive_t {
     status_t init(engine_t *engine) override;
 
     status_t execute(const exec_ctx_t &ctx) const override;
+    bool has_team_execute() const override { return true; }
+    status_t execute_in_team(
+            const exec_ctx_t &ctx, int ithr, int nthr) const override;
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    // Processes the share of the thread `ithr` with the arguments resolved
+    // from the execution context.
+    status_t execute_thr(int ithr, int nthr, const char *src, char *dst,
+            const dropout_args_t *dropout_args,
+            unsigned char *dropout_mask) const;
+
     std::unique_ptr<jit_uni_eltwise_kernel_t> kernel_;
 };
 
@@ -97,6 +97,8 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                     "the axis blocking configuration is not supported");
 
             VDISPATCH_SOFTMAX(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_SOFTMAX(!with_attn_inputs(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "attention inputs");
 
             VDISPATCH_SOFTMAX(
                     !has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "dst");
@@ -2750,6 +2750,10 @@ protected:
         switch (dst_dt) {
             case data_type::bf16: vcvtne2ps2bf16(reg1, reg2, reg1); break;
             case data_type::f16: {
+                if (mayiuse(avx10_2)) {
+                    vcvt2ps2phx(reg1, reg2, reg1);
+                    break;
+                }
                 const auto src_vmm_lower0 = Vmm_lower_t(reg1.getIdx());
                 const auto src_vmm_lower1 = Vmm_lower_t(reg2.getIdx());
                 vcvtps2phx(src_vmm_lower0, reg1);
@@ -28,6 +28,8 @@
 #include "gpu/amd/sycl_hip_scoped_context.hpp"
 #include "gpu/amd/sycl_hip_utils.hpp"
 
+#include <map>
+#include <mutex>
 #include <vector>
 #include <miopen/miopen.h>
 
@@ -248,6 +250,68 @@ public:
         return status::success;
     }
 
+    // Solutions selected for the convolution problems already seen in the
+    // process. The compiled kernels are kept by MIOpen in its own kernel
+    // cache, so reusing the solution skips the solution queries when a
+    // primitive for the same problem is created again.
+    enum class solution_kind_t { fwd, bwd_data, bwd_weights };
+    using solution_key_t = std::vector<int64_t>;
+
+    static std::map<solution_key_t, miopenConvSolution_t> &solution_cache() {
+        static std::map<solution_key_t, miopenConvSolution_t> cache;
+        return cache;
+    }
+    static std::mutex &solution_cache_mutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    solution_key_t get_solution_key(
+            impl::engine_t *engine, solution_kind_t kind) const {
+        auto &sycl_engine = *utils::downcast<amd::engine_t *>(engine);
+        solution_key_t key {static_cast<int64_t>(kind),
+                static_cast<int64_t>(sycl_engine.get_underlying_device()),
+                group_count};
+        auto append_desc = [&](miopenTensorDescriptor_t desc) {
+            int size = 0;
+            miopenDataType_t dt;
+            int d[DNNL_MAX_NDIMS], s[DNNL_MAX_NDIMS];
+            MIOPEN_EXECUTE_FUNC_V(miopenGetTensorDescriptorSize, desc, &size);
+            MIOPEN_EXECUTE_FUNC_V(miopenGetTensorDescriptor, desc, &dt, d, s);
+            key.push_back(dt);
+            for (int i = 0; i < size; i++) {
+                key.push_back(d[i]);
+                key.push_back(s[i]);
+            }
+        };
+        append_desc(descs[io::x]);
+        append_desc(weights_desc);
+        append_desc(descs[io::y]);
+        for (int i = 0; i < ndims[io::x] - 2; i++) {
+            key.push_back(padding[i]);
+            key.push_back(filter_strides[i]);
+            key.push_back(dilation[i]);
+        }
+        return key;
+    }
+
+    // On a hit, the cached solution becomes the only selectable one.
+    bool get_cached_solution(const solution_key_t &key,
+            std::vector<miopenConvSolution_t> &sols) {
+        std::lock_guard<std::mutex> lock(solution_cache_mutex());
+        auto it = solution_cache().find(key);
+        if (it == solution_cache().end()) return false;
+        sols.assign(1, it->second);
+        selected_sol = 0;
+        return true;
+    }
+
+    void put_cached_solution(
+            const solution_key_t &key, const miopenConvSolution_t &sol) {
+        std::lock_guard<std::mutex> lock(solution_cache_mutex());
+        solution_cache().emplace(key, sol);
+    }
+
     status_t create_and_set_convolution_desc(const convolution_pd_t *pd) {
 
         CHECK(MIOPEN_EXECUTE_FUNC_S(
@@ -422,8 +486,9 @@ protected:
     std::vector<miopenConvSolution_t> solutions;
     size_t actualCount = 0;
 
-    miopenFusionPlanDescriptor_t fusePlanDesc;
-    miopenOperatorArgs_t fusionArgs;
+    bool fused_ = false;
+    miopenFusionPlanDescriptor_t fusePlanDesc = nullptr;
+    miopenOperatorArgs_t fusionArgs = nullptr;
     miopenFusionOpDescriptor_t convoOp;
     miopenFusionOpDescriptor_t biasOp;
     miopenFusionOpDescriptor_t activOp;
@@ -442,6 +507,10 @@ public:
         if (reorder_dst_desc)
             MIOPEN_EXECUTE_FUNC_V(
                     miopenDestroyTensorDescriptor, reorder_dst_desc);
+        if (fusionArgs)
+            MIOPEN_EXECUTE_FUNC_V(miopenDestroyOperatorArgs, fusionArgs);
+        if (fusePlanDesc)
+            MIOPEN_EXECUTE_FUNC_V(miopenDestroyFusionPlan, fusePlanDesc);
     }
 
     status_t configure_post_ops(convolution_pd_t *pd) {
@@ -474,11 +543,73 @@ public:
         CHECK(create_miopen_descs(pd));
         CHECK(configure_alg_kind(engine, pd));
         CHECK(configure_post_ops(pd));
+        CHECK(init_fusion_plan(engine, pd));
         CHECK(init_scratchpad(engine, pd));
 
         return status::success;
     }
 
+    // Fuses the convolution with the bias and the activation using the
+    // MIOpen fusion API. When MIOpen has no fused kernel for the problem,
+    // the bias and the activation are applied by separate calls.
+    status_t init_fusion_plan(impl::engine_t *engine, convolution_pd_t *pd) {
+        const bool fusable = with_bias && num_post_ops == 1
+                && post_ops[0] == dnnl_eltwise && !need_reorder && !do_scaling
+                && !using_transformed_filter() && group_count == 1
+                && utils::one_of(data_types[x], miopenFloat, miopenHalf);
+        if (!fusable) return status::success;
+
+        auto &sycl_engine = *utils::downcast<amd::engine_t *>(engine);
+        hip_sycl_scoped_context_handler_t sc(sycl_engine);
+        impl::stream_t *service_stream;
+        CHECK(sycl_engine.get_service_stream(service_stream));
+        auto hip_stream = utils::downcast<stream_t *>(service_stream);
+        auto handle = hip_stream->get_miopen_handle();
+
+        miopenActivationMode_t act_mode;
+        double act_alpha, act_beta, act_gamma;
+        CHECK(MIOPEN_EXECUTE_FUNC_S(miopenGetActivationDescriptor,
+                eltwise_desc, &act_mode, &act_alpha, &act_beta, &act_gamma));
+
+        CHECK(MIOPEN_EXECUTE_FUNC_S(miopenCreateFusionPlan, &fusePlanDesc,
+                miopenVerticalFusion, descs[io::x]));
+        CHECK(MIOPEN_EXECUTE_FUNC_S(miopenCreateOpConvForward, fusePlanDesc,
+                &convoOp, conv_desc, weights_desc));
+        CHECK(MIOPEN_EXECUTE_FUNC_S(miopenCreateOpBiasForward, fusePlanDesc,
+                &biasOp, descs[io::bias]));
+        CHECK(MIOPEN_EXECUTE_FUNC_S(miopenCreateOpActivationForward,
+                fusePlanDesc, &activOp, act_mode));
+
+        if (miopenCompileFusionPlan(handle, fusePlanDesc)
+                != miopenStatusSuccess) {
+            MIOPEN_EXECUTE_FUNC_V(miopenDestroyFusionPlan, fusePlanDesc);
+            fusePlanDesc = nullptr;
+            return status::success;
+        }
+        CHECK(MIOPEN_EXECUTE_FUNC_S(miopenCreateOperatorArgs, &fusionArgs));
+
+        activeAlphaFusionAct = static_cast<float>(act_alpha);
+        activeBetaFusionAct = static_cast<float>(act_beta);
+        activeGammaFusionAct = static_cast<float>(act_gamma);
+        fused_ = true;
+        // The fused kernel writes the final result directly to dst.
+        use_temp_dst_ = false;
+        return status::success;
+    }
+
+    void execute_fused(miopenHandle_t handle, void *x, void *weights,
+            void *y, void *bias) const {
+        MIOPEN_EXECUTE_FUNC_V(miopenSetOpArgsConvForward, fusionArgs, convoOp,
+                &alpha, &beta, weights);
+        MIOPEN_EXECUTE_FUNC_V(miopenSetOpArgsBiasForward, fusionArgs, biasOp,
+                &alpha, &beta, bias);
+        MIOPEN_EXECUTE_FUNC_V(miopenSetOpArgsActivForward, fusionArgs, activOp,
+                &alpha, &beta, activeAlphaFusionAct, activeBetaFusionAct,
+                activeGammaFusionAct);
+        MIOPEN_EXECUTE_FUNC_V(miopenExecuteFusionPlan, handle, fusePlanDesc,
+                descs[io::x], x, descs[io::y], y, fusionArgs);
+    }
+
     void execute_reorder(miopenHandle_t handle, void *src, void *dst,
             bool flip_formats) const {
         const float alpha = 1.0f;
@@ -506,6 +637,11 @@ public:
              post_op_reorder = args[7], runtime_oscale = args[8];
         void *output = use_temp_dst_ ? post_op_scratch : y;
 
+        if (fused_) {
+            execute_fused(handle, x, weights, y, bias);
+            return;
+        }
+
         if (using_transformed_filter()) {
             auto w_scratch = args[5];
             transform_filter(handle, weights, w_scratch);
@@ -571,23 +707,29 @@ public:
         auto hip_stream = utils::downcast<stream_t *>(service_stream);
         auto handle = hip_stream->get_miopen_handle();
 
-        CHECK(MIOPEN_EXECUTE_FUNC_S(miopenConvolutionForwardGetSolutionCount,
-                handle, weights_desc, descs[io::x], conv_desc, descs[io::y],
-                &maxSolutionCount));
+        const auto key = get_solution_key(engine, solution_kind_t::fwd);
+        if (!get_cached_solution(key, solutions)) {
+            CHECK(MIOPEN_EXECUTE_FUNC_S(
+                    miopenConvolutionForwardGetSolutionCount, handle,
+                    weights_desc, descs[io::x], conv_desc, descs[io::y],
+                    &maxSolutionCount));
 
-        solutions.resize(maxSolutionCount);
+            solutions.resize(maxSolutionCount);
 
-        CHECK(MIOPEN_EXECUTE_FUNC_S(miopenConvolutionForwardGetSolution, handle,
-                weights_desc, descs[io::x], conv_desc, descs[io::y],
-                maxSolutionCount, &actualCount, solutions.data()));
+            CHECK(MIOPEN_EXECUTE_FUNC_S(miopenConvolutionForwardGetSolution,
+                    handle, weights_desc, descs[io::x], conv_desc,
+                    descs[io::y], maxSolutionCount, &actualCount,
+                    solutions.data()));
 
-        for (size_t i = 0; i < actualCount; i++) {
-            if (solutions[i].workspace_size > 0) continue;
-            selected_sol = i;
-            break;
-        }
+            for (size_t i = 0; i < actualCount; i++) {
+                if (solutions[i].workspace_size > 0) continue;
+                selected_sol = i;
+                break;
+            }
 
-        if (selected_sol == -1) return status::unimplemented;
+            if (selected_sol == -1) return status::unimplemented;
+            put_cached_solution(key, solutions[selected_sol]);
+        }
 
         CHECK(MIOPEN_EXECUTE_FUNC_S(
                 miopenConvolutionForwardGetSolutionWorkspaceSize, handle,
@@ -695,26 +837,33 @@ protected:
         auto hip_stream = utils::downcast<stream_t *>(service_stream);
         auto handle = hip_stream->get_miopen_handle();
 
-        CHECK(MIOPEN_EXECUTE_FUNC_S(
-                miopenConvolutionBackwardDataGetSolutionCount, handle,
-                descs[io::y], weights_desc, conv_desc, descs[io::x],
-                &solutionCountm));
+        const auto key = get_solution_key(engine, solution_kind_t::bwd_data);
+        if (!get_cached_solution(key, solutions)) {
+            CHECK(MIOPEN_EXECUTE_FUNC_S(
+                    miopenConvolutionBackwardDataGetSolutionCount, handle,
+                    descs[io::y], weights_desc, conv_desc, descs[io::x],
+                    &solutionCountm));
 
-        solutions.resize(solutionCountm);
+            solutions.resize(solutionCountm);
 
-        CHECK(MIOPEN_EXECUTE_FUNC_S(miopenConvolutionBackwardDataGetSolution,
-                handle, descs[io::y], weights_desc, conv_desc, descs[io::x],
-                solutionCountm, &solutionCount, solutions.data()));
+            CHECK(MIOPEN_EXECUTE_FUNC_S(
+                    miopenConvolutionBackwardDataGetSolution, handle,
+                    descs[io::y], weights_desc, conv_desc, descs[io::x],
+                    solutionCountm, &solutionCount, solutions.data()));
 
-        for (size_t i = 0; i < solutionCount; i++) {
-            if (selected_sol == -1) {
-                ws_size = solutions[i].workspace_size;
-                selected_sol = i;
-            }
-            if (solutions[i].workspace_size < ws_size) {
-                ws_size = solutions[i].workspace_size;
-                selected_sol = i;
+            for (size_t i = 0; i < solutionCount; i++) {
+                if (selected_sol == -1) {
+                    ws_size = solutions[i].workspace_size;
+                    selected_sol = i;
+                }
+                if (solutions[i].workspace_size < ws_size) {
+                    ws_size = solutions[i].workspace_size;
+                    selected_sol = i;
+                }
             }
+
+            if (selected_sol == -1) return status::unimplemented;
+            put_cached_solution(key, solutions[selected_sol]);
         }
 
         ws_size = solutions[selected_sol].workspace_size;
@@ -832,26 +981,34 @@ public:
         auto hip_stream = utils::downcast<stream_t *>(service_stream);
         auto handle = hip_stream->get_miopen_handle();
 
-        CHECK(MIOPEN_EXECUTE_FUNC_S(
-                miopenConvolutionBackwardWeightsGetSolutionCount, handle,
-                descs[io::y], descs[io::x], conv_desc, weights_desc,
-                &solutionCountm));
-
-        solutions.resize(solutionCountm);
-
-        CHECK(MIOPEN_EXECUTE_FUNC_S(miopenConvolutionBackwardWeightsGetSolution,
-                handle, descs[io::y], descs[io::x], conv_desc, weights_desc,
-                solutionCountm, &solutionCount, solutions.data()));
-
-        for (size_t i = 0; i < solutionCount; i++) {
-            if (selected_sol == -1) {
-                ws_size = solutions[i].workspace_size;
-                selected_sol = i;
-            }
-            if (solutions[i].workspace_size <= ws_size) {
-                ws_size = solutions[i].workspace_size;
-                selected_sol = i;
+        const auto key
+                = get_solution_key(engine, solution_kind_t::bwd_weights);
+        if (!get_cached_solution(key, solutions)) {
+            CHECK(MIOPEN_EXECUTE_FUNC_S(
+                    miopenConvolutionBackwardWeightsGetSolutionCount, handle,
+                    descs[io::y], descs[io::x], conv_desc, weights_desc,
+                    &solutionCountm));
+
+            solutions.resize(solutionCountm);
+
+            CHECK(MIOPEN_EXECUTE_FUNC_S(
+                    miopenConvolutionBackwardWeightsGetSolution, handle,
+                    descs[io::y], descs[io::x], conv_desc, weights_desc,
+                    solutionCountm, &solutionCount, solutions.data()));
+
+            for (size_t i = 0; i < solutionCount; i++) {
+                if (selected_sol == -1) {
+                    ws_size = solutions[i].workspace_size;
+                    selected_sol = i;
+                }
+                if (solutions[i].workspace_size <= ws_size) {
+                    ws_size = solutions[i].workspace_size;
+                    selected_sol = i;
+                }
             }
+
+            if (selected_sol == -1) return status::unimplemented;
+            put_cached_solution(key, solutions[selected_sol]);
         }
 
         ws_size = solutions[selected_sol].workspace_size;
@@ -0,0 +1,195 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/generic/sycl/igemm_convolution.hpp"
+#include "gpu/generic/sycl/igemm_convolution_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace generic {
+namespace sycl {
+
+namespace {
+
+// Fills `out` with the strides of `md` in (outer..., c, d, h, w) order,
+// inserting zero strides for the spatial dimensions missing from `md`.
+void get_logical_strides(
+        const memory_desc_t *md, int n_outer, int n_spatial, dim_t *out) {
+    const memory_desc_wrapper mdw(md);
+    const auto &strides = mdw.blocking_desc().strides;
+    const int n_md_spatial = mdw.ndims() - n_outer;
+    for (int i = 0; i < n_outer; i++)
+        out[i] = strides[i];
+    for (int i = 0; i < n_spatial; i++) {
+        const int md_idx = i - (n_spatial - n_md_spatial);
+        out[n_outer + i] = md_idx >= 0 ? strides[n_outer + md_idx] : 0;
+    }
+}
+
+} // namespace
+
+status_t init_igemm_conf(sycl_convolution_igemm_conf_t &conf,
+        const convolution_pd_t *pd, const memory_desc_t *src_md,
+        const memory_desc_t *weights_md, const memory_desc_t *dst_md) {
+    conf = sycl_convolution_igemm_conf_t();
+
+    conf.src_md = xpu::sycl::md_t(src_md);
+    conf.weights_md = xpu::sycl::md_t(weights_md);
+    conf.dst_md = xpu::sycl::md_t(dst_md);
+
+    conf.mb = pd->MB();
+    conf.ic = pd->IC() / pd->G();
+    conf.oc = pd->OC() / pd->G();
+    conf.id = pd->ID();
+    conf.ih = pd->IH();
+    conf.iw = pd->IW();
+    conf.od = pd->OD();
+    conf.oh = pd->OH();
+    conf.ow = pd->OW();
+    conf.kd = pd->KD();
+    conf.kh = pd->KH();
+    conf.kw = pd->KW();
+
+    conf.strides[0] = pd->KSD();
+    conf.strides[1] = pd->KSH();
+    conf.strides[2] = pd->KSW();
+    conf.padding[0] = pd->padFront();
+    conf.padding[1] = pd->padT();
+    conf.padding[2] = pd->padL();
+    conf.dilation[0] = pd->KDD();
+    conf.dilation[1] = pd->KDH();
+    conf.dilation[2] = pd->KDW();
+
+    get_logical_strides(src_md, 2, 3, conf.src_strides);
+    get_logical_strides(dst_md, 2, 3, conf.dst_strides);
+    if (pd->with_groups()) {
+        get_logical_strides(weights_md, 3, 3, conf.weights_strides);
+    } else {
+        conf.weights_strides[0] = 0;
+        get_logical_strides(weights_md, 2, 3, conf.weights_strides + 1);
+    }
+
+    return status::success;
+}
+
+status_t igemm_convolution_fwd_t::pd_t::init_conf() {
+    CHECK(init_igemm_conf(conf_, this, src_md(), weights_md(0), dst_md()));
+
+    if (with_bias()) {
+        conf_.bias_dt = weights_md(1)->data_type;
+        conf_.has_bias = true;
+    }
+
+    conf_.do_scale_data = !attr()->scales_.has_default_values(DNNL_ARG_SRC_0);
+    conf_.do_scale_weights
+            = !attr()->scales_.has_default_values(DNNL_ARG_WEIGHTS);
+    conf_.do_scale_dst = !attr()->scales_.has_default_values(DNNL_ARG_DST);
+    conf_.single_weight_scale = attr()->scales_.get_mask(DNNL_ARG_WEIGHTS) == 0;
+    conf_.post_ops = sycl_post_ops_t(attr(), dst_md());
+    return status::success;
+}
+
+status_t igemm_convolution_fwd_t::init(impl::engine_t *engine) {
+    const auto kid = ::sycl::get_kernel_id<igemm_convolution_fwd_kernel_t>();
+    CHECK(create_kernel(engine, kid, &kernel_));
+    return status::success;
+}
+
+status_t igemm_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
+    if (memory_desc_wrapper(pd()->dst_md()).size() == 0) return status::success;
+
+    using kernel_t = igemm_convolution_fwd_kernel_t;
+    const auto &conf = pd()->conf_;
+    const auto global_range = tiled_gemm_t::global_range(pd()->G(),
+            kernel_t::gemm_m(conf), kernel_t::gemm_n(conf));
+    const auto local_range = tiled_gemm_t::local_range();
+
+    parallel_for(ctx, kernel_, [&](::sycl::handler &cgh) {
+        ::sycl::local_accessor<float, 1> local_memory(
+                tiled_gemm_t::local_mem_size, cgh);
+        kernel_t convolution_kernel(conf, local_memory, cgh, ctx);
+
+        cgh.parallel_for(::sycl::nd_range<3>(global_range, local_range),
+                convolution_kernel);
+    });
+
+    return status::success;
+}
+
+status_t igemm_convolution_bwd_data_t::init(impl::engine_t *engine) {
+    const auto kid
+            = ::sycl::get_kernel_id<igemm_convolution_bwd_data_kernel_t>();
+    CHECK(create_kernel(engine, kid, &kernel_));
+    return status::success;
+}
+
+status_t igemm_convolution_bwd_data_t::execute(const exec_ctx_t &ctx) const {
+    if (memory_desc_wrapper(pd()->diff_src_md()).size() == 0)
+        return status::success;
+
+    using kernel_t = igemm_convolution_bwd_data_kernel_t;
+    const auto &conf = pd()->conf_;
+    const auto global_range = tiled_gemm_t::global_range(pd()->G(),
+            kernel_t::gemm_m(conf), kernel_t::gemm_n(conf));
+    const auto local_range = tiled_gemm_t::local_range();
+
+    parallel_for(ctx, kernel_, [&](::sycl::handler &cgh) {
+        ::sycl::local_accessor<float, 1> local_memory(
+                tiled_gemm_t::local_mem_size, cgh);
+        kernel_t convolution_kernel(conf, local_memory, cgh, ctx);
+
+        cgh.parallel_for(::sycl::nd_range<3>(global_range, local_range),
+                convolution_kernel);
+    });
+
+    return status::success;
+}
+
+status_t igemm_convolution_bwd_weights_t::init(impl::engine_t *engine) {
+    const auto kid
+            = ::sycl::get_kernel_id<igemm_convolution_bwd_weights_kernel_t>();
+    CHECK(create_kernel(engine, kid, &kernel_));
+    return status::success;
+}
+
+status_t igemm_convolution_bwd_weights_t::execute(const exec_ctx_t &ctx) const {
+    if (memory_desc_wrapper(pd()->diff_weights_md()).size() == 0)
+        return status::success;
+
+    using kernel_t = igemm_convolution_bwd_weights_kernel_t;
+    const auto &conf = pd()->conf_;
+    const auto global_range = tiled_gemm_t::global_range(pd()->G(),
+            kernel_t::gemm_m(conf), kernel_t::gemm_n(conf));
+    const auto local_range = tiled_gemm_t::local_range();
+
+    parallel_for(ctx, kernel_, [&](::sycl::handler &cgh) {
+        ::sycl::local_accessor<float, 1> local_memory(
+                tiled_gemm_t::local_mem_size, cgh);
+        kernel_t convolution_kernel(conf, local_memory, cgh, ctx);
+
+        cgh.parallel_for(::sycl::nd_range<3>(global_range, local_range),
+                convolution_kernel);
+    });
+
+    return status::success;
+}
+
+} // namespace sycl
+} // namespace generic
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,253 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_GENERIC_SYCL_IGEMM_CONVOLUTION_HPP
+#define GPU_GENERIC_SYCL_IGEMM_CONVOLUTION_HPP
+
+#include "gpu/generic/sycl/ref_convolution.hpp"
+#include "gpu/generic/sycl/sycl_gpu_primitive.hpp"
+#include "gpu/generic/sycl/sycl_post_ops.hpp"
+#include "gpu/generic/sycl/sycl_primitive_conf.hpp"
+#include "gpu/gpu_convolution_pd.hpp"
+#include "xpu/sycl/types.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace generic {
+namespace sycl {
+
+// Implicit GEMM convolutions built on the tiled GEMM core of the tiled
+// matmul. They cover floating-point problems with channels-last
+// activations; quantized problems and other layouts use the reference
+// implementations.
+
+inline bool check_igemm_convolution_data_types(
+        const memory_desc_wrapper &src0, const memory_desc_wrapper &src1,
+        const memory_desc_wrapper &dst) {
+    using namespace data_type;
+    for (const auto &mdw : {src0, src1, dst}) {
+        if (!utils::one_of(mdw.data_type(), f32, bf16, f16)) return false;
+    }
+    return true;
+}
+
+inline bool check_igemm_convolution_formats(const memory_desc_wrapper &src,
+        const memory_desc_wrapper &weights, const memory_desc_wrapper &dst) {
+    using namespace format_tag;
+    for (const auto &mdw : {src, dst}) {
+        if (!mdw.matches_one_of_tag(nwc, nhwc, ndhwc)) return false;
+    }
+    return weights.is_plain();
+}
+
+status_t init_igemm_conf(sycl_convolution_igemm_conf_t &conf,
+        const convolution_pd_t *pd, const memory_desc_t *src_md,
+        const memory_desc_t *weights_md, const memory_desc_t *dst_md);
+
+struct igemm_convolution_fwd_t : public gpu::generic::sycl::primitive_t {
+    using gpu::generic::sycl::primitive_t::primitive_t;
+
+    struct pd_t : public convolution_fwd_pd_t {
+        using convolution_fwd_pd_t::convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("sycl:igemm:any", igemm_convolution_fwd_t);
+
+        status_t init(impl::engine_t *engine) {
+            using namespace data_type;
+            using sm = primitive_attr_t::skip_mask_t;
+
+            const memory_desc_wrapper data_d(src_md());
+            const memory_desc_wrapper weights_d(weights_md());
+            const memory_desc_wrapper bias_d(weights_md(1));
+            const memory_desc_wrapper dst_d(dst_md());
+
+            VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_CONV(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_CONV(md_dims_in_range(src_md()),
+                    VERBOSE_OUT_OF_RANGE_DIMS, "src");
+            VDISPATCH_CONV_SC(attr_.set_default_formats(dst_md()),
+                    VERBOSE_UNSUPPORTED_TAG_S, "dst");
+            VDISPATCH_CONV(check_igemm_convolution_data_types(
+                                   data_d, weights_d, dst_d),
+                    VERBOSE_UNSUPPORTED_DT_CFG);
+            VDISPATCH_CONV(IMPLICATION(with_bias(),
+                                   utils::one_of(bias_d.data_type(), f32,
+                                           bf16, f16)),
+                    VERBOSE_UNSUPPORTED_BIAS_CFG);
+            VDISPATCH_CONV(check_igemm_convolution_formats(
+                                   data_d, weights_d, dst_d),
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_CONV(attr()->has_default_values(
+                                   sm::scales | sm::post_ops | sm::sum_dt),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            CHECK(attr_scales_ok({{DNNL_ARG_SRC, {0}}, {DNNL_ARG_WEIGHTS, {0}},
+                    {DNNL_ARG_DST, {0}}}));
+            VDISPATCH_CONV(IMPLICATION(!attr()->scales_.has_default_values(),
+                                   check_convolution_scales_types(attr())),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VDISPATCH_CONV(IMPLICATION(!attr()->scales_.has_default_values(),
+                                   !attr()->scales_.has_host_scalars()),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VDISPATCH_CONV(sycl_post_ops_t::post_ops_ok(attr(), false),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+            VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
+                    VERBOSE_BAD_ALGORITHM);
+
+            return init_conf();
+        }
+
+        sycl_convolution_igemm_conf_t conf_;
+
+    private:
+        status_t init_conf();
+
+        bool set_default_formats() {
+            using namespace format_tag;
+            auto dat_tag = utils::pick(ndims() - 3, nwc, nhwc, ndhwc);
+            auto wei_tag = with_groups()
+                    ? utils::pick(ndims() - 3, goiw, goihw, goidhw)
+                    : utils::pick(ndims() - 3, oiw, oihw, oidhw);
+            return set_default_formats_common(dat_tag, wei_tag, dat_tag);
+        }
+    };
+
+    status_t init(impl::engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    kernel_t kernel_;
+};
+
+struct igemm_convolution_bwd_data_t : public gpu::generic::sycl::primitive_t {
+    using gpu::generic::sycl::primitive_t::primitive_t;
+
+    struct pd_t : public convolution_bwd_data_pd_t {
+        using convolution_bwd_data_pd_t::convolution_bwd_data_pd_t;
+
+        DECLARE_COMMON_PD_T("sycl:igemm:any", igemm_convolution_bwd_data_t);
+
+        status_t init(impl::engine_t *engine) {
+            const memory_desc_wrapper diff_data_d(diff_src_md());
+            const memory_desc_wrapper weights_d(weights_md());
+            const memory_desc_wrapper diff_dst_d(diff_dst_md());
+
+            VDISPATCH_CONV(is_bwd_d(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_CONV(md_dims_in_range(diff_src_md()),
+                    VERBOSE_OUT_OF_RANGE_DIMS, "diff_src");
+            VDISPATCH_CONV(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_CONV(check_igemm_convolution_data_types(
+                                   diff_data_d, weights_d, diff_dst_d),
+                    VERBOSE_UNSUPPORTED_DT_CFG);
+            VDISPATCH_CONV(check_igemm_convolution_formats(
+                                   diff_data_d, weights_d, diff_dst_d),
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_CONV(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
+                    VERBOSE_BAD_ALGORITHM);
+
+            return init_igemm_conf(
+                    conf_, this, diff_src_md(), weights_md(), diff_dst_md());
+        }
+
+        sycl_convolution_igemm_conf_t conf_;
+
+    private:
+        bool set_default_formats() {
+            using namespace format_tag;
+            auto dat_tag = utils::pick(ndims() - 3, nwc, nhwc, ndhwc);
+            auto wei_tag = with_groups()
+                    ? utils::pick(ndims() - 3, goiw, goihw, goidhw)
+                    : utils::pick(ndims() - 3, oiw, oihw, oidhw);
+            return set_default_formats_common(dat_tag, wei_tag, dat_tag);
+        }
+    };
+
+    status_t init(impl::engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    kernel_t kernel_;
+};
+
+struct igemm_convolution_bwd_weights_t
+    : public gpu::generic::sycl::primitive_t {
+    using gpu::generic::sycl::primitive_t::primitive_t;
+
+    struct pd_t : public convolution_bwd_weights_pd_t {
+        using convolution_bwd_weights_pd_t::convolution_bwd_weights_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                "sycl:igemm:any", igemm_convolution_bwd_weights_t);
+
+        status_t init(impl::engine_t *engine) {
+            const memory_desc_wrapper data_d(src_md());
+            const memory_desc_wrapper diff_weights_d(diff_weights_md());
+            const memory_desc_wrapper diff_dst_d(diff_dst_md());
+
+            VDISPATCH_CONV(is_bwd_w(), VERBOSE_BAD_PROPKIND);
+            // The bias gradient is a reduction over the whole diff_dst and
+            // does not map onto the GEMM tiles.
+            VDISPATCH_CONV(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+            VDISPATCH_CONV(md_dims_in_range(src_md()),
+                    VERBOSE_OUT_OF_RANGE_DIMS, "src");
+            VDISPATCH_CONV(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_CONV(check_igemm_convolution_data_types(
+                                   data_d, diff_weights_d, diff_dst_d),
+                    VERBOSE_UNSUPPORTED_DT_CFG);
+            VDISPATCH_CONV(check_igemm_convolution_formats(
+                                   data_d, diff_weights_d, diff_dst_d),
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_CONV(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
+                    VERBOSE_BAD_ALGORITHM);
+
+            return init_igemm_conf(
+                    conf_, this, src_md(), diff_weights_md(), diff_dst_md());
+        }
+
+        sycl_convolution_igemm_conf_t conf_;
+
+    private:
+        bool set_default_formats() {
+            using namespace format_tag;
+            auto dat_tag = utils::pick(ndims() - 3, nwc, nhwc, ndhwc);
+            auto wei_tag = with_groups()
+                    ? utils::pick(ndims() - 3, goiw, goihw, goidhw)
+                    : utils::pick(ndims() - 3, oiw, oihw, oidhw);
+            return set_default_formats_common(dat_tag, wei_tag, dat_tag);
+        }
+    };
+
+    status_t init(impl::engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    kernel_t kernel_;
+};
+
+} // namespace sycl
+} // namespace generic
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
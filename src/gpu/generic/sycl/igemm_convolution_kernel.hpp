@@ -0,0 +1,342 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_GENERIC_SYCL_IGEMM_CONVOLUTION_KERNEL_HPP
+#define GPU_GENERIC_SYCL_IGEMM_CONVOLUTION_KERNEL_HPP
+
+#include "common/primitive_exec_types.hpp"
+#include "gpu/generic/sycl/sycl_io_helper.hpp"
+#include "gpu/generic/sycl/sycl_post_ops.hpp"
+#include "gpu/generic/sycl/sycl_primitive_conf.hpp"
+#include "gpu/generic/sycl/tiled_matmul_kernel.hpp"
+#include "xpu/sycl/memory_storage_base.hpp"
+#include "xpu/sycl/types.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace generic {
+namespace sycl {
+
+enum class igemm_conv_kind_t { fwd, bwd_data, bwd_weights };
+
+// Implicit GEMM convolution on top of the tiled GEMM core. The GEMM operands
+// are gathered from the convolution tensors on the fly, one group per
+// dimension 0 of the nd-range:
+//   fwd:         dst[mb*od*oh*ow][oc] = src[..][kd*kh*kw*ic] * wei[..][oc]
+//   bwd_data:    diff_src[mb*id*ih*iw][ic]
+//                        = diff_dst[..][kd*kh*kw*oc] * wei[..][ic]
+//   bwd_weights: diff_wei[oc][kd*kh*kw*ic]
+//                        = diff_dst^T[oc][mb*od*oh*ow] * src[..][..]
+// Channels are the innermost index of the gathered dimensions, so reads are
+// contiguous for channels-last activations.
+template <igemm_conv_kind_t kind>
+struct igemm_convolution_kernel_t {
+    using gemm_t = tiled_gemm_t;
+    using vec_t = gemm_t::vec_t;
+
+    static constexpr bool is_fwd = kind == igemm_conv_kind_t::fwd;
+    static constexpr bool is_bwd_d = kind == igemm_conv_kind_t::bwd_data;
+    static constexpr bool is_bwd_w = kind == igemm_conv_kind_t::bwd_weights;
+
+    static constexpr int a_arg = is_fwd ? DNNL_ARG_SRC : DNNL_ARG_DIFF_DST;
+    static constexpr int b_arg = is_bwd_w ? DNNL_ARG_SRC : DNNL_ARG_WEIGHTS;
+    static constexpr int c_arg = is_fwd ? DNNL_ARG_DST
+            : is_bwd_d                  ? DNNL_ARG_DIFF_SRC
+                                        : DNNL_ARG_DIFF_WEIGHTS;
+
+    static dim_t gemm_m(const sycl_convolution_igemm_conf_t &conf) {
+        if (is_bwd_w) return conf.oc;
+        if (is_bwd_d) return dim_t(conf.mb) * conf.id * conf.ih * conf.iw;
+        return dim_t(conf.mb) * conf.od * conf.oh * conf.ow;
+    }
+    static dim_t gemm_n(const sycl_convolution_igemm_conf_t &conf) {
+        const dim_t ksp = dim_t(conf.kd) * conf.kh * conf.kw;
+        if (is_bwd_w) return ksp * conf.ic;
+        return is_bwd_d ? conf.ic : conf.oc;
+    }
+    static dim_t gemm_k(const sycl_convolution_igemm_conf_t &conf) {
+        const dim_t ksp = dim_t(conf.kd) * conf.kh * conf.kw;
+        if (is_bwd_w) return dim_t(conf.mb) * conf.od * conf.oh * conf.ow;
+        return ksp * (is_bwd_d ? conf.oc : conf.ic);
+    }
+
+    igemm_convolution_kernel_t(const sycl_convolution_igemm_conf_t &conf,
+            ::sycl::local_accessor<float, 1> &local_memory,
+            ::sycl::handler &cgh, const exec_ctx_t &ctx)
+        : conf_(conf)
+        , a_(CTX_IN_SYCL_KERNEL_MEMORY(a_arg))
+        , b_(CTX_IN_SYCL_KERNEL_MEMORY(b_arg))
+        , c_(CTX_INOUT_SYCL_KERNEL_MEMORY(c_arg))
+        , bias_(CTX_IN_SYCL_KERNEL_MEMORY(DNNL_ARG_BIAS))
+        , data_scale_(CTX_IN_SYCL_KERNEL_MEMORY(
+                  DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC_0))
+        , weights_scale_(CTX_IN_SYCL_KERNEL_MEMORY(
+                  DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS))
+        , dst_scale_(CTX_IN_SYCL_KERNEL_MEMORY(
+                  DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST))
+        , scales_data_dt_(conf_.do_scale_data
+                          ? ctx.memory_mdw(
+                                       DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC_0)
+                                    .data_type()
+                          : data_type_t::dnnl_f32)
+        , scales_weights_dt_(conf_.do_scale_weights
+                          ? ctx.memory_mdw(
+                                       DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS)
+                                    .data_type()
+                          : data_type_t::dnnl_f32)
+        , scales_dst_dt_(conf_.do_scale_dst
+                          ? ctx.memory_mdw(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST)
+                                    .data_type()
+                          : data_type_t::dnnl_f32)
+        , local_memory_(local_memory) {}
+
+    void operator()(::sycl::nd_item<3> item) const {
+        const int g = item.get_group(0);
+
+        memory_tensor_t a_mem(a_, is_fwd ? conf_.src_md : conf_.dst_md);
+        memory_tensor_t b_mem(b_, is_bwd_w ? conf_.src_md : conf_.weights_md);
+        memory_tensor_t c_mem(c_,
+                is_fwd ? conf_.dst_md
+                       : (is_bwd_d ? conf_.src_md : conf_.weights_md));
+
+        const auto load_a = [&](dim_t m, dim_t k) {
+            if (is_fwd) {
+                dim_t n, od, oh, ow, ic, kd, kh, kw;
+                split_spatial(m, conf_.od, conf_.oh, conf_.ow, n, od, oh, ow);
+                split_kernel(k, conf_.ic, ic, kd, kh, kw);
+                dim_t id, ih, iw;
+                if (!src_position(od, oh, ow, kd, kh, kw, id, ih, iw))
+                    return 0.f;
+                return a_mem.load(
+                        src_off(n, g * conf_.ic + ic, id, ih, iw));
+            } else if (is_bwd_d) {
+                dim_t n, id, ih, iw, oc, kd, kh, kw;
+                split_spatial(m, conf_.id, conf_.ih, conf_.iw, n, id, ih, iw);
+                split_kernel(k, conf_.oc, oc, kd, kh, kw);
+                dim_t od, oh, ow;
+                if (!dst_position(id, ih, iw, kd, kh, kw, od, oh, ow))
+                    return 0.f;
+                return a_mem.load(
+                        dst_off(n, g * conf_.oc + oc, od, oh, ow));
+            } else {
+                dim_t n, od, oh, ow;
+                split_spatial(k, conf_.od, conf_.oh, conf_.ow, n, od, oh, ow);
+                return a_mem.load(dst_off(n, g * conf_.oc + m, od, oh, ow));
+            }
+        };
+        const auto load_b = [&](dim_t k, dim_t n) {
+            if (is_fwd) {
+                dim_t ic, kd, kh, kw;
+                split_kernel(k, conf_.ic, ic, kd, kh, kw);
+                return b_mem.load(wei_off(g, n, ic, kd, kh, kw));
+            } else if (is_bwd_d) {
+                dim_t oc, kd, kh, kw;
+                split_kernel(k, conf_.oc, oc, kd, kh, kw);
+                return b_mem.load(wei_off(g, oc, n, kd, kh, kw));
+            } else {
+                dim_t mb, od, oh, ow, ic, kd, kh, kw;
+                split_spatial(
+                        k, conf_.od, conf_.oh, conf_.ow, mb, od, oh, ow);
+                split_kernel(n, conf_.ic, ic, kd, kh, kw);
+                dim_t id, ih, iw;
+                if (!src_position(od, oh, ow, kd, kh, kw, id, ih, iw))
+                    return 0.f;
+                return b_mem.load(
+                        src_off(mb, g * conf_.ic + ic, id, ih, iw));
+            }
+        };
+
+        const dim_t M = gemm_m(conf_);
+        const dim_t N = gemm_n(conf_);
+        const dim_t K = gemm_k(conf_);
+
+        vec_t acc[gemm_t::block_m];
+        gemm_t::accumulate(item, local_memory_, M, N, K, load_a, load_b, acc);
+
+        const float sm_data = conf_.do_scale_data
+                ? load_float_value(scales_data_dt_, data_scale_ptr(), 0)
+                : 1.f;
+        const float sm_dst = conf_.do_scale_dst
+                ? load_float_value(scales_dst_dt_, dst_scale_ptr(), 0)
+                : 1.f;
+
+        const dim_t m0 = gemm_t::block_m_start(item);
+        const dim_t n0 = gemm_t::block_n_start(item);
+        // Along N consecutive elements of dst (diff_src) are consecutive
+        // channels; diff_weights are always stored element-wise.
+        const dim_t c_channel_stride = is_fwd
+                ? conf_.dst_strides[1]
+                : (is_bwd_d ? conf_.src_strides[1] : 0);
+        const bool vec_store_ok
+                = c_channel_stride == 1 && n0 + gemm_t::block_n <= N;
+
+        for (int i = 0; i < gemm_t::block_m; i++) {
+            const dim_t m = m0 + i;
+            if (m >= M) break;
+
+            vec_t res = acc[i];
+            for (int j = 0; j < gemm_t::block_n; j++) {
+                const dim_t n = n0 + j;
+                if (n >= N) break;
+                const dim_t c_off = c_offset(g, m, n);
+                float val = res[j];
+                if (is_fwd) {
+                    const dim_t oc_tot = g * conf_.oc + n;
+                    if (conf_.do_scale_data) val *= sm_data;
+                    if (conf_.do_scale_weights) {
+                        val *= load_float_value(scales_weights_dt_,
+                                weights_scale_ptr(),
+                                conf_.single_weight_scale ? 0 : oc_tot);
+                    }
+                    if (conf_.has_bias) {
+                        val += load_float_value(
+                                conf_.bias_dt, bias_ptr(), oc_tot);
+                    }
+                    val = conf_.post_ops.apply(val, c_, c_off);
+                    if (conf_.do_scale_dst) val /= sm_dst;
+                }
+                res[j] = val;
+                if (!vec_store_ok) c_mem.store(val, c_off);
+            }
+            if (vec_store_ok) {
+                const data_type_t dt = c_mem.md().data_type();
+                char *ptr = static_cast<char *>(c_mem.ptr())
+                        + data_type_size(dt) * c_offset(g, m, n0);
+                store_float_vec<gemm_t::vec_len>(dt, res, ptr, 0);
+            }
+        }
+    }
+
+private:
+    void *bias_ptr() const { return bias_.get_pointer(); }
+    void *data_scale_ptr() const { return data_scale_.get_pointer(); }
+    void *weights_scale_ptr() const { return weights_scale_.get_pointer(); }
+    void *dst_scale_ptr() const { return dst_scale_.get_pointer(); }
+
+    // Splits a flattened (mb, d, h, w) index.
+    static void split_spatial(dim_t idx, dim_t D, dim_t H, dim_t W, dim_t &n,
+            dim_t &d, dim_t &h, dim_t &w) {
+        w = idx % W;
+        idx /= W;
+        h = idx % H;
+        idx /= H;
+        d = idx % D;
+        n = idx / D;
+    }
+
+    // Splits a flattened (kd, kh, kw, c) index, channels innermost.
+    void split_kernel(dim_t idx, dim_t C, dim_t &c, dim_t &kd, dim_t &kh,
+            dim_t &kw) const {
+        c = idx % C;
+        idx /= C;
+        kw = idx % conf_.kw;
+        idx /= conf_.kw;
+        kh = idx % conf_.kh;
+        kd = idx / conf_.kh;
+    }
+
+    // Input position read by output (od, oh, ow) through kernel point
+    // (kd, kh, kw); false for the padding area.
+    bool src_position(dim_t od, dim_t oh, dim_t ow, dim_t kd, dim_t kh,
+            dim_t kw, dim_t &id, dim_t &ih, dim_t &iw) const {
+        id = od * conf_.strides[0] - conf_.padding[0]
+                + kd * (1 + conf_.dilation[0]);
+        ih = oh * conf_.strides[1] - conf_.padding[1]
+                + kh * (1 + conf_.dilation[1]);
+        iw = ow * conf_.strides[2] - conf_.padding[2]
+                + kw * (1 + conf_.dilation[2]);
+        return id >= 0 && id < conf_.id && ih >= 0 && ih < conf_.ih
+                && iw >= 0 && iw < conf_.iw;
+    }
+
+    // Output position receiving input (id, ih, iw) through kernel point
+    // (kd, kh, kw); false if there is none.
+    bool dst_position(dim_t id, dim_t ih, dim_t iw, dim_t kd, dim_t kh,
+            dim_t kw, dim_t &od, dim_t &oh, dim_t &ow) const {
+        const dim_t d = id + conf_.padding[0] - kd * (1 + conf_.dilation[0]);
+        const dim_t h = ih + conf_.padding[1] - kh * (1 + conf_.dilation[1]);
+        const dim_t w = iw + conf_.padding[2] - kw * (1 + conf_.dilation[2]);
+        if (d < 0 || h < 0 || w < 0) return false;
+        if (d % conf_.strides[0] || h % conf_.strides[1]
+                || w % conf_.strides[2])
+            return false;
+        od = d / conf_.strides[0];
+        oh = h / conf_.strides[1];
+        ow = w / conf_.strides[2];
+        return od < conf_.od && oh < conf_.oh && ow < conf_.ow;
+    }
+
+    dim_t src_off(dim_t n, dim_t c, dim_t d, dim_t h, dim_t w) const {
+        const dim_t *s = conf_.src_strides;
+        return n * s[0] + c * s[1] + d * s[2] + h * s[3] + w * s[4];
+    }
+    dim_t dst_off(dim_t n, dim_t c, dim_t d, dim_t h, dim_t w) const {
+        const dim_t *s = conf_.dst_strides;
+        return n * s[0] + c * s[1] + d * s[2] + h * s[3] + w * s[4];
+    }
+    dim_t wei_off(dim_t g, dim_t oc, dim_t ic, dim_t d, dim_t h,
+            dim_t w) const {
+        const dim_t *s = conf_.weights_strides;
+        return g * s[0] + oc * s[1] + ic * s[2] + d * s[3] + h * s[4]
+                + w * s[5];
+    }
+
+    // Offset of C(m, n) in dst, diff_src or diff_weights.
+    dim_t c_offset(dim_t g, dim_t m, dim_t n) const {
+        if (is_bwd_w) {
+            dim_t ic, kd, kh, kw;
+            split_kernel(n, conf_.ic, ic, kd, kh, kw);
+            return wei_off(g, m, ic, kd, kh, kw);
+        }
+        dim_t mb, d, h, w;
+        if (is_bwd_d) {
+            split_spatial(m, conf_.id, conf_.ih, conf_.iw, mb, d, h, w);
+            return src_off(mb, g * conf_.ic + n, d, h, w);
+        }
+        split_spatial(m, conf_.od, conf_.oh, conf_.ow, mb, d, h, w);
+        return dst_off(mb, g * conf_.oc + n, d, h, w);
+    }
+
+    sycl_convolution_igemm_conf_t conf_;
+
+    xpu::sycl::in_memory_arg_t a_;
+    xpu::sycl::in_memory_arg_t b_;
+    xpu::sycl::inout_memory_arg_t c_;
+    xpu::sycl::in_memory_arg_t bias_;
+    xpu::sycl::in_memory_arg_t data_scale_;
+    xpu::sycl::in_memory_arg_t weights_scale_;
+    xpu::sycl::in_memory_arg_t dst_scale_;
+    data_type_t scales_data_dt_;
+    data_type_t scales_weights_dt_;
+    data_type_t scales_dst_dt_;
+    ::sycl::local_accessor<float, 1> local_memory_;
+};
+
+using igemm_convolution_fwd_kernel_t
+        = igemm_convolution_kernel_t<igemm_conv_kind_t::fwd>;
+using igemm_convolution_bwd_data_kernel_t
+        = igemm_convolution_kernel_t<igemm_conv_kind_t::bwd_data>;
+using igemm_convolution_bwd_weights_kernel_t
+        = igemm_convolution_kernel_t<igemm_conv_kind_t::bwd_weights>;
+
+} // namespace sycl
+} // namespace generic
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -95,6 +95,38 @@ struct sycl_convolution_bwd_weights_conf_t : sycl_convolution_common_conf_t {
     xpu::sycl::md_t diff_weights_md;
 };
 
+// Implicit GEMM convolution. Channel counts are per group and the spatial
+// sizes are normalized to 3D. Strides are in the logical order of the
+// memory descriptors: (mb, c, d, h, w) for activations and
+// (g, oc, ic, d, h, w) for weights, with zero for the missing dimensions.
+struct sycl_convolution_igemm_conf_t {
+    xpu::sycl::md_t src_md;
+    xpu::sycl::md_t weights_md;
+    xpu::sycl::md_t dst_md;
+
+    bool has_bias;
+    data_type_t bias_dt;
+
+    bool do_scale_data;
+    bool do_scale_weights;
+    bool do_scale_dst;
+    bool single_weight_scale;
+
+    int mb, ic, oc;
+    int id, ih, iw;
+    int od, oh, ow;
+    int kd, kh, kw;
+    int strides[3];
+    int padding[3];
+    int dilation[3];
+
+    dim_t src_strides[5];
+    dim_t weights_strides[6];
+    dim_t dst_strides[5];
+
+    sycl_post_ops_t post_ops;
+};
+
 struct sycl_eltwise_conf_t {
     prop_kind_t prop_kind;
     xpu::sycl::md_t src_md;
@@ -544,6 +576,7 @@ CHECK_SYCL_KERNEL_ARG_TYPE(sycl_pooling_bwd_conf_t);
 CHECK_SYCL_KERNEL_ARG_TYPE(sycl_convolution_fwd_conf_t);
 CHECK_SYCL_KERNEL_ARG_TYPE(sycl_convolution_bwd_data_conf_t);
 CHECK_SYCL_KERNEL_ARG_TYPE(sycl_convolution_bwd_weights_conf_t);
+CHECK_SYCL_KERNEL_ARG_TYPE(sycl_convolution_igemm_conf_t);
 CHECK_SYCL_KERNEL_ARG_TYPE(sycl_simple_reduction_conf_t);
 CHECK_SYCL_KERNEL_ARG_TYPE(sycl_reduction_conf_t);
 CHECK_SYCL_KERNEL_ARG_TYPE(sycl_rnn_copy_conf_t);
@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/generic/sycl/tiled_matmul.hpp"
+#include "gpu/generic/sycl/tiled_matmul_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace generic {
+namespace sycl {
+
+void tiled_matmul_t::pd_t::init_conf() {
+    conf_ = sycl_matmul_conf_t();
+
+    conf_.do_scale_data = !attr()->scales_.has_default_values(DNNL_ARG_SRC_0);
+    conf_.do_scale_weights
+            = !attr()->scales_.has_default_values(DNNL_ARG_WEIGHTS);
+    conf_.do_scale_dst = !attr()->scales_.has_default_values(DNNL_ARG_DST);
+    conf_.single_weights_scale
+            = attr()->scales_.get_mask(DNNL_ARG_WEIGHTS) == 0;
+    conf_.post_ops = sycl_post_ops_t(attr(), dst_md());
+
+    const memory_desc_wrapper src_d = src_md();
+    const memory_desc_wrapper weights_d = weights_md();
+    const memory_desc_wrapper dst_d = dst_md();
+    const memory_desc_wrapper bias_d = weights_md(1);
+
+    conf_.data_md = xpu::sycl::md_t(src_d.md_);
+    conf_.weights_md = xpu::sycl::md_t(weights_d.md_);
+    conf_.dst_md = xpu::sycl::md_t(dst_d.md_);
+    if (with_bias()) conf_.bias_md = xpu::sycl::md_t(bias_d.md_);
+
+    conf_.data_mask
+            = utils::get_dims_mask(dst_d.dims(), src_d.dims(), ndims());
+    conf_.weights_mask
+            = utils::get_dims_mask(dst_d.dims(), weights_d.dims(), ndims());
+    conf_.bias_mask
+            = utils::get_dims_mask(dst_d.dims(), bias_d.dims(), ndims());
+
+    // Work size is the number of dst tiles.
+    const dim_t M = dst_d.dims()[ndims() - 2];
+    const dim_t N = dst_d.dims()[ndims() - 1];
+    conf_.wk_size = batch() * math::div_up(M, tiled_gemm_t::tile_m)
+            * math::div_up(N, tiled_gemm_t::tile_n);
+}
+
+status_t tiled_matmul_t::init(impl::engine_t *engine) {
+    const auto kid = ::sycl::get_kernel_id<matmul_tiled_kernel_fwd_t>();
+    CHECK(create_kernel(engine, kid, &kernel_));
+    return status::success;
+}
+
+status_t tiled_matmul_t::execute(const exec_ctx_t &ctx) const {
+    if (memory_desc_wrapper(pd()->dst_md()).size() == 0) return status::success;
+
+    const sycl_matmul_conf_t &conf = pd()->conf_;
+    const int ndims = pd()->ndims();
+    const auto global_range = tiled_gemm_t::global_range(pd()->batch(),
+            pd()->dst_md()->dims[ndims - 2], pd()->dst_md()->dims[ndims - 1]);
+    const auto local_range = tiled_gemm_t::local_range();
+
+    parallel_for(ctx, kernel_, [&](::sycl::handler &cgh) {
+        ::sycl::local_accessor<float, 1> local_memory(
+                tiled_gemm_t::local_mem_size, cgh);
+        matmul_tiled_kernel_fwd_t matmul_kernel(conf, local_memory, cgh, ctx);
+
+        cgh.parallel_for(::sycl::nd_range<3>(global_range, local_range),
+                matmul_kernel);
+    });
+
+    return status::success;
+}
+
+} // namespace sycl
+} // namespace generic
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,175 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_GENERIC_SYCL_TILED_MATMUL_HPP
+#define GPU_GENERIC_SYCL_TILED_MATMUL_HPP
+
+#include "gpu/generic/sycl/sycl_gpu_primitive.hpp"
+#include "gpu/generic/sycl/sycl_io_helper.hpp"
+#include "gpu/generic/sycl/sycl_post_ops.hpp"
+#include "gpu/generic/sycl/sycl_primitive_conf.hpp"
+#include "gpu/generic/sycl/sycl_utils.hpp"
+#include "gpu/gpu_matmul_pd.hpp"
+#include "xpu/sycl/types.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace generic {
+namespace sycl {
+
+// Vendor-neutral matmul staging src and weights tiles in work-group local
+// memory. Covers the floating-point subset of ref_matmul_t; quantized,
+// dropout and runtime-shaped problems are left to the reference kernel.
+struct tiled_matmul_t : public gpu::generic::sycl::primitive_t {
+    using gpu::generic::sycl::primitive_t::primitive_t;
+
+    struct pd_t : public gpu_matmul_pd_t {
+        using gpu_matmul_pd_t::gpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("sycl:tiled:any", tiled_matmul_t);
+
+        status_t init(impl::engine_t *engine) {
+            using namespace data_type;
+            using sm = primitive_attr_t::skip_mask_t;
+
+            const memory_desc_wrapper src_d(src_md());
+            const memory_desc_wrapper weights_d(weights_md(0));
+            const memory_desc_wrapper bias_d(weights_md(1));
+            const memory_desc_wrapper dst_d(dst_md());
+
+            VDISPATCH_MATMUL_SC(set_default_params(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_MATMUL_SC(attr_.set_default_formats(dst_md()),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_MATMUL(
+                    check_data_types(src_d, weights_d, bias_d, dst_d),
+                    VERBOSE_UNSUPPORTED_DT_CFG);
+            VDISPATCH_MATMUL(check_formats(src_d, weights_d, bias_d, dst_d),
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_MATMUL(!src_d.has_runtime_dims_or_strides()
+                            && !weights_d.has_runtime_dims_or_strides()
+                            && !bias_d.has_runtime_dims_or_strides()
+                            && !dst_d.has_runtime_dims_or_strides(),
+                    VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+            VDISPATCH_MATMUL(attr()->has_default_values(
+                                     sm::post_ops | sm::scales_data_type),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_MATMUL(IMPLICATION(!attr()->scales_.has_default_values(),
+                                     scales_ok()),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VDISPATCH_MATMUL(sycl_post_ops_t::post_ops_ok(attr()),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+            VDISPATCH_MATMUL(md_dims_in_range(src_md()),
+                    VERBOSE_OUT_OF_RANGE_DIMS, "src");
+            VDISPATCH_MATMUL(md_dims_in_range(weights_md()),
+                    VERBOSE_OUT_OF_RANGE_DIMS, "weights");
+
+            init_conf();
+            return status::success;
+        }
+
+        sycl_matmul_conf_t conf_;
+
+    private:
+        void init_conf();
+
+        status_t set_default_params() {
+            if (src_md_.format_kind == format_kind::any) {
+                auto src_tag = utils::pick(ndims() - 2, format_tag::ab,
+                        format_tag::abc, format_tag::abcd);
+                CHECK(memory_desc_init_by_tag(src_md_, src_tag));
+            }
+            const memory_desc_wrapper src_d(src_md());
+            if (src_d.is_blocking_desc()) {
+                if (weights_md_.format_kind == format_kind::any) {
+                    CHECK(memory_desc_init_by_blocking_desc(
+                            weights_md_, src_d.blocking_desc()));
+                }
+                if (dst_md_.format_kind == format_kind::any) {
+                    CHECK(memory_desc_init_by_blocking_desc(
+                            dst_md_, src_d.blocking_desc()));
+                }
+            }
+            const memory_desc_wrapper dst_d(dst_md());
+            if (dst_d.is_blocking_desc()) {
+                if (bias_md_.format_kind == format_kind::any) {
+                    CHECK(memory_desc_init_by_blocking_desc(
+                            bias_md_, dst_d.blocking_desc()));
+                }
+            }
+            return status::success;
+        }
+
+        // Only common scales and per-N weights scales are applied by the
+        // kernel epilogue.
+        bool scales_ok() const {
+            const std::vector<int> supported_args
+                    = {DNNL_ARG_SRC_0, DNNL_ARG_WEIGHTS_0, DNNL_ARG_DST};
+
+            const auto &scales = attr()->scales_;
+            bool ok = true;
+            for (auto arg : supported_args) {
+                if (scales.get(arg).has_default_values()) continue;
+                const int mask = scales.get_mask(arg);
+                ok = ok && is_supported_type(scales.get_data_type(arg))
+                        && !scales.get(arg).is_host_scalar()
+                        && (mask == 0
+                                || (arg == DNNL_ARG_WEIGHTS_0
+                                        && mask == 1 << (ndims() - 1)));
+            }
+            return ok && attr_scales_ok(supported_args);
+        }
+
+        static bool check_data_types(const memory_desc_wrapper &src,
+                const memory_desc_wrapper &weights,
+                const memory_desc_wrapper &bias,
+                const memory_desc_wrapper &dst) {
+            using namespace data_type;
+
+            for (auto t : {src.data_type(), weights.data_type(),
+                         dst.data_type()}) {
+                if (!utils::one_of(t, f32, bf16, f16)) return false;
+            }
+            return IMPLICATION(!bias.is_zero(),
+                    utils::one_of(bias.data_type(), f32, bf16, f16));
+        }
+
+        static bool check_formats(const memory_desc_wrapper &src,
+                const memory_desc_wrapper &weights,
+                const memory_desc_wrapper &bias,
+                const memory_desc_wrapper &dst) {
+            for (const auto &mdw : {src, weights, dst}) {
+                if (!mdw.is_plain()) { return false; }
+            }
+            return IMPLICATION(!bias.is_zero(), bias.is_plain());
+        }
+    };
+
+    status_t init(impl::engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    kernel_t kernel_;
+};
+
+} // namespace sycl
+} // namespace generic
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,300 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_GENERIC_SYCL_TILED_MATMUL_KERNEL_HPP
+#define GPU_GENERIC_SYCL_TILED_MATMUL_KERNEL_HPP
+
+#include "common/primitive_exec_types.hpp"
+#include "gpu/generic/sycl/sycl_io_helper.hpp"
+#include "gpu/generic/sycl/sycl_post_ops.hpp"
+#include "gpu/generic/sycl/sycl_primitive_conf.hpp"
+#include "gpu/generic/sycl/sycl_utils.hpp"
+#include "xpu/sycl/memory_storage_base.hpp"
+#include "xpu/sycl/types.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace generic {
+namespace sycl {
+
+// Work-group tiled GEMM core shared by the tiled SYCL kernels. Every
+// work-group computes a tile_m x tile_n block of C = A * B: tiles of A and B
+// are staged in local memory tile_k columns at a time and every work-item
+// accumulates a block_m x block_n block of the C tile in registers. A and B
+// are read element-wise through callables, so the same core serves plain
+// matrices as well as implicit (gathered) ones.
+struct tiled_gemm_t {
+    static constexpr int vec_len = 4;
+    static constexpr int block_m = 4;
+    static constexpr int block_n = vec_len;
+
+    static constexpr int wg_m = 8;
+    static constexpr int wg_n = 8;
+    static constexpr int wg_size = wg_m * wg_n;
+
+    static constexpr int tile_m = wg_m * block_m;
+    static constexpr int tile_n = wg_n * block_n;
+    static constexpr int tile_k = 16;
+
+    // Local memory holds the A tile as [tile_k][tile_m] and the B tile as
+    // [tile_k][tile_n], so that both are read with vector loads.
+    static constexpr int local_mem_size = tile_k * (tile_m + tile_n);
+
+    using vec_t = ::sycl::vec<float, vec_len>;
+
+    // Tiles along M and N map to dimensions 1 and 2 of the nd-range,
+    // dimension 0 is left to the caller.
+    static ::sycl::range<3> local_range() { return {1, wg_m, wg_n}; }
+    static ::sycl::range<3> global_range(size_t batch, dim_t M, dim_t N) {
+        return {batch, size_t(utils::div_up(M, tile_m) * wg_m),
+                size_t(utils::div_up(N, tile_n) * wg_n)};
+    }
+
+    // First row and column of the C block owned by the work-item.
+    static dim_t block_m_start(const ::sycl::nd_item<3> &item) {
+        return item.get_group(1) * tile_m + item.get_local_id(1) * block_m;
+    }
+    static dim_t block_n_start(const ::sycl::nd_item<3> &item) {
+        return item.get_group(2) * tile_n + item.get_local_id(2) * block_n;
+    }
+
+    // load_a(m, k) and load_b(k, n) are only called for in-bounds indices.
+    template <typename load_a_t, typename load_b_t>
+    static void accumulate(const ::sycl::nd_item<3> &item,
+            const ::sycl::local_accessor<float, 1> &local_memory, dim_t M,
+            dim_t N, dim_t K, const load_a_t &load_a, const load_b_t &load_b,
+            vec_t (&acc)[block_m]) {
+        const dim_t m_tile = item.get_group(1) * tile_m;
+        const dim_t n_tile = item.get_group(2) * tile_n;
+        const int lm = item.get_local_id(1);
+        const int ln = item.get_local_id(2);
+        const int lid = lm * wg_n + ln;
+
+        auto local_ptr = local_memory.get_multi_ptr<
+                ::sycl::access::decorated::no>();
+        auto a_tile = local_ptr;
+        auto b_tile = local_ptr + tile_k * tile_m;
+
+        for (int i = 0; i < block_m; i++)
+            acc[i] = vec_t(0.f);
+
+        for (dim_t k_tile = 0; k_tile < K; k_tile += tile_k) {
+            // Consecutive work-items walk along M (N), so the local stores
+            // are conflict-free.
+            for (int e = lid; e < tile_k * tile_m; e += wg_size) {
+                const int m = e % tile_m;
+                const int k = e / tile_m;
+                const dim_t gm = m_tile + m;
+                const dim_t gk = k_tile + k;
+                a_tile[k * tile_m + m]
+                        = (gm < M && gk < K) ? load_a(gm, gk) : 0.f;
+            }
+            for (int e = lid; e < tile_k * tile_n; e += wg_size) {
+                const int n = e % tile_n;
+                const int k = e / tile_n;
+                const dim_t gn = n_tile + n;
+                const dim_t gk = k_tile + k;
+                b_tile[k * tile_n + n]
+                        = (gn < N && gk < K) ? load_b(gk, gn) : 0.f;
+            }
+            ::sycl::group_barrier(item.get_group());
+
+            for (int k = 0; k < tile_k; k++) {
+                vec_t a, b;
+                a.load((k * tile_m + lm * block_m) / vec_len, a_tile);
+                b.load((k * tile_n + ln * block_n) / vec_len, b_tile);
+                for (int i = 0; i < block_m; i++)
+                    acc[i] += a[i] * b;
+            }
+            ::sycl::group_barrier(item.get_group());
+        }
+    }
+};
+
+// Tiled matmul kernel. The kernel works on the strides of the last two
+// dimensions directly, so any plain layout of src, weights and dst is
+// supported without a transposed copy.
+struct matmul_tiled_kernel_fwd_t {
+    static constexpr int max_supported_ndims = 6;
+
+    using gemm_t = tiled_gemm_t;
+    using vec_t = gemm_t::vec_t;
+
+    matmul_tiled_kernel_fwd_t(const sycl_matmul_conf_t &conf,
+            ::sycl::local_accessor<float, 1> &local_memory,
+            ::sycl::handler &cgh, const exec_ctx_t &ctx)
+        : conf_(conf)
+        , data_(CTX_IN_SYCL_KERNEL_MEMORY(DNNL_ARG_SRC_0))
+        , weights_(CTX_IN_SYCL_KERNEL_MEMORY(DNNL_ARG_WEIGHTS))
+        , bias_(CTX_IN_SYCL_KERNEL_MEMORY(DNNL_ARG_BIAS))
+        , dst_(CTX_INOUT_SYCL_KERNEL_MEMORY(DNNL_ARG_DST))
+        , data_scale_(CTX_IN_SYCL_KERNEL_MEMORY(
+                  DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC_0))
+        , data_scales_dt_((conf_.do_scale_data)
+                          ? ctx.memory_mdw(
+                                       DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC_0)
+                                    .data_type()
+                          : data_type_t::dnnl_f32)
+        , weights_scale_(CTX_IN_SYCL_KERNEL_MEMORY(
+                  DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS))
+        , weights_scales_dt_((conf_.do_scale_weights)
+                          ? ctx.memory_mdw(
+                                       DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS)
+                                    .data_type()
+                          : data_type_t::dnnl_f32)
+        , dst_scale_(CTX_IN_SYCL_KERNEL_MEMORY(
+                  DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST))
+        , dst_scales_dt_((conf_.do_scale_dst)
+                          ? ctx.memory_mdw(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST)
+                                    .data_type()
+                          : data_type_t::dnnl_f32)
+        , po_args_(cgh, ctx, conf_.post_ops)
+        , local_memory_(local_memory) {}
+
+    void operator()(::sycl::nd_item<3> item) const {
+        memory_tensor_t data_mem(data_, conf_.data_md);
+        memory_tensor_t weights_mem(weights_, conf_.weights_md);
+        memory_tensor_t bias_mem(bias_, conf_.bias_md);
+        memory_tensor_t dst_mem(dst_, conf_.dst_md);
+        memory_plain_t data_scale_mem(data_scale_, data_scales_dt_);
+        memory_plain_t weights_scale_mem(weights_scale_, weights_scales_dt_);
+        memory_plain_t dst_scale_mem(dst_scale_, dst_scales_dt_);
+
+        const int ndims = dst_mem.md().ndims();
+        const int dim_m = ndims - 2;
+        const int dim_n = ndims - 1;
+
+        const dim_t M = dst_mem.md().dims()[dim_m];
+        const dim_t N = dst_mem.md().dims()[dim_n];
+        const dim_t K = data_mem.md().dims()[dim_n];
+
+        const dim_t data_stride_m = data_mem.md().strides()[dim_m];
+        const dim_t data_stride_k = data_mem.md().strides()[dim_n];
+        const dim_t weights_stride_k = weights_mem.md().strides()[dim_m];
+        const dim_t weights_stride_n = weights_mem.md().strides()[dim_n];
+        const dim_t dst_stride_m = dst_mem.md().strides()[dim_m];
+        const dim_t dst_stride_n = dst_mem.md().strides()[dim_n];
+
+        // Decompose the batch index over the dst batch dimensions and
+        // compute the batch offsets taking broadcasting into account.
+        dims_t off_dst;
+        dim_t batch = item.get_group(0);
+        for (int i = max_supported_ndims - 1; i >= 0; i--) {
+            if (i >= dim_m) {
+                off_dst[i] = 0;
+                continue;
+            }
+            const dim_t dim = dst_mem.md().dims()[i];
+            off_dst[i] = batch % dim;
+            batch /= dim;
+        }
+        const dim_t data_base
+                = data_mem.md().off_v_masked(off_dst, conf_.data_mask);
+        const dim_t weights_base
+                = weights_mem.md().off_v_masked(off_dst, conf_.weights_mask);
+        const dim_t dst_base = dst_mem.md().off_v(off_dst);
+
+        const auto load_a = [&](dim_t m, dim_t k) {
+            return data_mem.load(
+                    data_base + m * data_stride_m + k * data_stride_k);
+        };
+        const auto load_b = [&](dim_t k, dim_t n) {
+            return weights_mem.load(
+                    weights_base + k * weights_stride_k + n * weights_stride_n);
+        };
+        vec_t acc[gemm_t::block_m];
+        gemm_t::accumulate(item, local_memory_, M, N, K, load_a, load_b, acc);
+
+        const float data_scale
+                = conf_.do_scale_data ? data_scale_mem.load(0) : 1.f;
+        const float dst_scale
+                = conf_.do_scale_dst ? dst_scale_mem.load(0) : 1.f;
+        const bool has_bias = bias_mem.md().ndims() != 0;
+
+        const dim_t m0 = gemm_t::block_m_start(item);
+        const dim_t n0 = gemm_t::block_n_start(item);
+        vec_t weights_scale(1.f);
+        if (conf_.do_scale_weights) {
+            if (conf_.single_weights_scale) {
+                weights_scale = vec_t(weights_scale_mem.load(0));
+            } else {
+                for (int j = 0; j < gemm_t::block_n && n0 + j < N; j++)
+                    weights_scale[j] = weights_scale_mem.load(n0 + j);
+            }
+        }
+
+        dims_t off_po;
+        for (int i = 0; i < max_supported_ndims; i++)
+            off_po[i] = off_dst[i];
+
+        for (int i = 0; i < gemm_t::block_m; i++) {
+            const dim_t m = m0 + i;
+            if (m >= M) break;
+            const dim_t dst_row = dst_base + m * dst_stride_m;
+            const bool full_vec
+                    = n0 + gemm_t::block_n <= N && dst_stride_n == 1;
+
+            vec_t res = acc[i] * data_scale * weights_scale;
+            for (int j = 0; j < gemm_t::block_n; j++) {
+                const dim_t n = n0 + j;
+                if (n >= N) break;
+                off_po[dim_m] = m;
+                off_po[dim_n] = n;
+                float val = res[j];
+                if (has_bias)
+                    val += bias_mem.load(bias_mem.md().off_v_masked(
+                            off_po, conf_.bias_mask));
+                const float prev_dst
+                        = dst_mem.load(dst_row + n * dst_stride_n);
+                val = conf_.post_ops.apply(val, prev_dst, po_args_, off_po);
+                if (conf_.do_scale_dst) val /= dst_scale;
+                res[j] = val;
+                if (!full_vec) dst_mem.store(val, dst_row + n * dst_stride_n);
+            }
+            if (full_vec) {
+                data_type_t dt = dst_mem.md().data_type();
+                char *ptr = static_cast<char *>(dst_mem.ptr())
+                        + data_type_size(dt) * (dst_row + n0);
+                store_float_vec<gemm_t::vec_len>(dt, res, ptr, 0);
+            }
+        }
+    }
+
+private:
+    sycl_matmul_conf_t conf_;
+
+    xpu::sycl::in_memory_arg_t data_;
+    xpu::sycl::in_memory_arg_t weights_;
+    xpu::sycl::in_memory_arg_t bias_;
+    xpu::sycl::inout_memory_arg_t dst_;
+    xpu::sycl::in_memory_arg_t data_scale_;
+    data_type_t data_scales_dt_;
+    xpu::sycl::in_memory_arg_t weights_scale_;
+    data_type_t weights_scales_dt_;
+    xpu::sycl::in_memory_arg_t dst_scale_;
+    data_type_t dst_scales_dt_;
+    post_op_input_args po_args_;
+    ::sycl::local_accessor<float, 1> local_memory_;
+};
+
+} // namespace sycl
+} // namespace generic
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -37,6 +37,7 @@
 
 #ifdef GENERIC_SYCL_KERNELS_ENABLED
 #include "gpu/generic/sycl/ref_matmul.hpp"
+#include "gpu/generic/sycl/tiled_matmul.hpp"
 #endif
 
 namespace dnnl {
@@ -55,6 +56,7 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         GPU_INSTANCE_NVIDIA(nvidia::cudnn_matmul_lt_t)
         GPU_INSTANCE_NVIDIA(nvidia::cudnn_matmul_t)
         GPU_INSTANCE_AMD(amd::miopen_matmul_t)
+        GPU_INSTANCE_GENERIC_SYCL(generic::sycl::tiled_matmul_t)
         GPU_INSTANCE_GENERIC_SYCL(generic::sycl::ref_matmul_t)
         nullptr,
 });
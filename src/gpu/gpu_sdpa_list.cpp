@@ -23,6 +23,10 @@
 #include "gpu/intel/sdpa/ref.hpp"
 #endif
 
+#if DNNL_GPU_VENDOR == DNNL_VENDOR_NVIDIA
+#include "gpu/nvidia/cudnn_sdpa.hpp"
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace gpu {
@@ -36,6 +40,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>>
     {{forward}, {
         GPU_INSTANCE_INTEL(intel::sdpa::micro_fwd_t)
         GPU_INSTANCE_INTEL_DEVMODE(intel::sdpa::ref_fwd_t)
+        GPU_INSTANCE_NVIDIA(nvidia::cudnn_sdpa_fwd_t)
         nullptr,
     }},
     {{backward}, REG_BWD_PK({
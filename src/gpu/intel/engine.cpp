@@ -71,6 +71,10 @@ status_t engine_t::init() {
 }
 
 status_t engine_t::init(const std::vector<uint8_t> &cache_blob) {
+    const size_t pool_budget = scratchpad_pool_t::default_budget();
+    if (pool_budget > 0)
+        scratchpad_pool_.reset(new scratchpad_pool_t(this, pool_budget));
+
     if (device_info_cache_get(&device_info_, this)) return status::success;
     // Since init_device_info that takes a cache blob is only defined for
     // OpenCL we need to do manual dispatching here.
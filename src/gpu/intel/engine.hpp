@@ -27,6 +27,7 @@
 #include "common/primitive.hpp"
 #include "common/primitive_desc_iterator.hpp"
 #include "common/resource.hpp"
+#include "common/scratchpad.hpp"
 #include "common/verbose.hpp"
 
 #include "xpu/utils.hpp"
@@ -188,6 +189,10 @@ public:
 
     virtual gpu_utils::device_id_t device_id() const = 0;
 
+    scratchpad_pool_t *scratchpad_pool() override {
+        return scratchpad_pool_.get();
+    }
+
 protected:
     virtual status_t init_device_info() = 0;
     virtual status_t init_device_info(const std::vector<uint8_t> &cache_blob) {
@@ -200,6 +205,11 @@ protected:
     std::shared_ptr<compute::device_info_t> device_info_;
 
 private:
+    // The pool keeps the scratchpads of the destroyed primitives for reuse
+    // by the primitives created next. Must be destroyed after the primitives
+    // owned by the engine.
+    std::unique_ptr<scratchpad_pool_t> scratchpad_pool_;
+
     // Implement a zero_pad_primitive shared across the engine. The purpose is
     // to prevent extra overhead associated with creating zero_pad_primitives
     // for different inputs as ideally the zero_pad operations fast relative to
@@ -606,72 +606,93 @@ status_t gen_t::execute(const exec_ctx_t &ctx) const {
         }
     }
 
-    for (int64_t Bk = 0; Bk < nstl::max<dim_t>(k, 1); Bk += block_k) {
-        int64_t size_k = k - Bk;
-        bool last_k_block = (size_k <= block_k);
-        if (!last_k_block) size_k = block_k;
-
-        for (int64_t Bm = 0; Bm < m; Bm += block_m) {
-            int64_t size_m = m - Bm;
-            if (size_m > block_m) size_m = block_m;
-
-            auto off_a_src
-                    = off_a0 + (!trans_a ? (Bm + Bk * lda) : (Bk + Bm * lda));
-
-            for (int64_t Bn = 0; Bn < n; Bn += block_n) {
-                int64_t size_n = n - Bn;
-                if (size_n > block_n) size_n = block_n;
-
-                auto off_b_src = off_b0
-                        + (!trans_b ? (Bk + Bn * ldb) : (Bn + Bk * ldb));
-
-                auto off_c = off_c0 + Bm + Bn * ldc;
-
-                auto off_aq = off_aq0;
-                auto off_bq = off_bq0;
-                if (problem.aoPtrDims >= 1 || a_scales) off_aq += Bm;
-                if (problem.boPtrDims >= 1 || b_scales) off_bq += Bn;
-
-                auto off_co = off_co0;
-                switch (cmask & 3) {
-                    case 1: off_co += Bn; break;
-                    case 2: off_co += Bm; break;
-                    case 3:
-                        off_co += isColMajor(problem.CO.layout)
-                                ? (Bn * ldco + Bm)
-                                : (Bm * ldco + Bn);
-                        break;
-                }
-
-                for (int i = 0; i < po_count; i++) {
-                    po_offsets[i] = po_offsets0[i];
-                    bool row = problem.postOps.binaryRow[i],
-                         col = problem.postOps.binaryCol[i];
-                    if (row && col) {
-                        auto ld = pd()->ld_binary(i);
-                        po_offsets[i] += isColMajor(problem.binary[i].layout)
-                                ? (Bn * ld + Bm)
-                                : (Bm * ld + Bn);
-                    } else if (row)
-                        po_offsets[i] += Bm;
-                    else if (col)
-                        po_offsets[i] += Bn;
+    // With chunked completion signaling the destination is computed one
+    // chunk of the matmul N dimension at a time. The matmul N dimension is
+    // the gemm M dimension, which becomes the kernel N one with swapped A/B.
+    const dim_t chunk_size = compute_stream->signal_chunk_size();
+    const bool chunk_n = swap_ab;
+    const int64_t chunk_dim = chunk_n ? n : m;
+    const int64_t chunk_step
+            = chunk_size > 0 ? chunk_size : nstl::max<int64_t>(chunk_dim, 1);
+
+    for (int64_t Bc = 0; Bc < chunk_dim; Bc += chunk_step) {
+        const int64_t chunk_end = nstl::min(chunk_dim, Bc + chunk_step);
+        const int64_t m_begin = chunk_n ? 0 : Bc;
+        const int64_t m_end = chunk_n ? m : chunk_end;
+        const int64_t n_begin = chunk_n ? Bc : 0;
+        const int64_t n_end = chunk_n ? chunk_end : n;
+
+        for (int64_t Bk = 0; Bk < nstl::max<dim_t>(k, 1); Bk += block_k) {
+            int64_t size_k = k - Bk;
+            bool last_k_block = (size_k <= block_k);
+            if (!last_k_block) size_k = block_k;
+
+            for (int64_t Bm = m_begin; Bm < m_end; Bm += block_m) {
+                int64_t size_m = m_end - Bm;
+                if (size_m > block_m) size_m = block_m;
+
+                auto off_a_src = off_a0
+                        + (!trans_a ? (Bm + Bk * lda) : (Bk + Bm * lda));
+
+                for (int64_t Bn = n_begin; Bn < n_end; Bn += block_n) {
+                    int64_t size_n = n_end - Bn;
+                    if (size_n > block_n) size_n = block_n;
+
+                    auto off_b_src = off_b0
+                            + (!trans_b ? (Bk + Bn * ldb) : (Bn + Bk * ldb));
+
+                    auto off_c = off_c0 + Bm + Bn * ldc;
+
+                    auto off_aq = off_aq0;
+                    auto off_bq = off_bq0;
+                    if (problem.aoPtrDims >= 1 || a_scales) off_aq += Bm;
+                    if (problem.boPtrDims >= 1 || b_scales) off_bq += Bn;
+
+                    auto off_co = off_co0;
+                    switch (cmask & 3) {
+                        case 1: off_co += Bn; break;
+                        case 2: off_co += Bm; break;
+                        case 3:
+                            off_co += isColMajor(problem.CO.layout)
+                                    ? (Bn * ldco + Bm)
+                                    : (Bm * ldco + Bn);
+                            break;
+                    }
+
+                    for (int i = 0; i < po_count; i++) {
+                        po_offsets[i] = po_offsets0[i];
+                        bool row = problem.postOps.binaryRow[i],
+                             col = problem.postOps.binaryCol[i];
+                        if (row && col) {
+                            auto ld = pd()->ld_binary(i);
+                            po_offsets[i]
+                                    += isColMajor(problem.binary[i].layout)
+                                    ? (Bn * ld + Bm)
+                                    : (Bm * ld + Bn);
+                        } else if (row)
+                            po_offsets[i] += Bm;
+                        else if (col)
+                            po_offsets[i] += Bn;
+                    }
+
+                    float eff_beta = (Bk == 0) ? beta : 1.0f;
+                    status = launch_nocopy(ctx, compute_stream, zero_pool, a,
+                            b, c, ao, bo, ao_host_scalar, bo_host_scalar,
+                            a_scales, b_scales, c_scales, ag, bg, *co,
+                            co_host_scalar, c_temp.get(), sround_seed,
+                            po_count, po_srcs, off_a_src, off_b_src, off_c,
+                            off_aq, off_bq, off_co, po_offsets, lda, ldb, ldc,
+                            into<int32_t>(size_m), into<int32_t>(size_n),
+                            into<int32_t>(size_k), k0, alpha, eff_beta, cmask,
+                            last_k_block, swap_ab, disable_hilbert);
+
+                    if (status) return status;
                 }
-
-                float eff_beta = (Bk == 0) ? beta : 1.0f;
-                status = launch_nocopy(ctx, compute_stream, zero_pool, a, b, c,
-                        ao, bo, ao_host_scalar, bo_host_scalar, a_scales,
-                        b_scales, c_scales, ag, bg, *co, co_host_scalar,
-                        c_temp.get(), sround_seed, po_count, po_srcs, off_a_src,
-                        off_b_src, off_c, off_aq, off_bq, off_co, po_offsets,
-                        lda, ldb, ldc, into<int32_t>(size_m),
-                        into<int32_t>(size_n), into<int32_t>(size_k), k0, alpha,
-                        eff_beta, cmask, last_k_block, swap_ab,
-                        disable_hilbert);
-
-                if (status) return status;
             }
         }
+
+        if (chunk_size > 0)
+            CHECK(compute_stream->signal_chunk(into<int>(Bc / chunk_size)));
     }
 
 #ifdef DNNL_WITH_SYCL
@@ -14,7 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+
 #include "gpu/intel/kernel_cache.hpp"
+#include "gpu/intel/kernel_disk_cache.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -23,25 +26,100 @@ namespace intel {
 
 using namespace compute;
 
+namespace {
+
+// Conversions between cached values and kernels for the on-disk kernel cache.
+template <typename value_type>
+struct disk_value_t;
+
+template <>
+struct disk_value_t<kernel_t> {
+    static gpu_kernel_value_t make(std::vector<kernel_t> &&kernels,
+            const std::vector<const char *> &kernel_names) {
+        return gpu_kernel_value_t(
+                std::make_shared<gpu_kernel_value_container_t<kernel_t>>(
+                        std::move(kernels[0])));
+    }
+    static status_t get(const kernel_cache::value_impl_t *value,
+            const std::vector<const char *> &kernel_names,
+            std::vector<kernel_t> &kernels) {
+        kernels = {utils::downcast<
+                const gpu_kernel_value_container_t<kernel_t> *>(value)
+                        ->value};
+        return status::success;
+    }
+};
+
+template <>
+struct disk_value_t<kernel_bundle_t> {
+    static gpu_kernel_value_t make(std::vector<kernel_t> &&kernels,
+            const std::vector<const char *> &kernel_names) {
+        return gpu_kernel_value_t(std::make_shared<
+                gpu_kernel_value_container_t<kernel_bundle_t>>(
+                kernel_bundle_t(std::move(kernels), kernel_names)));
+    }
+    static status_t get(const kernel_cache::value_impl_t *value,
+            const std::vector<const char *> &kernel_names,
+            std::vector<kernel_t> &kernels) {
+        return utils::downcast<
+                const gpu_kernel_value_container_t<kernel_bundle_t> *>(value)
+                ->value.get_kernels(kernels, kernel_names);
+    }
+};
+
+} // namespace
+
+template <typename value_type>
 status_t get_or_create(const kernel_cache::key_t &key,
         gpu_kernel_value_t &jit_generator, impl::engine_t *engine,
+        const std::vector<const char *> &kernel_names,
         cache_state_t &kernel_cache_hit) {
     struct create_context_t {
         const gpu_kernel_key_impl_t &params;
         impl::engine_t *engine;
+        const std::vector<const char *> &kernel_names;
         cache_state_t cache_status;
     };
 
     kernel_cache::iface_t::create_func_ptr_t create = [](void *context) {
         auto &c = *static_cast<create_context_t *>(context);
+        c.cache_status = cache_state_t::miss;
+
+        // Kernels missing from the in-memory cache are looked up in the
+        // on-disk cache before being compiled.
+        const bool use_disk_cache = kernel_disk_cache::is_enabled(c.engine)
+                && std::none_of(c.kernel_names.begin(), c.kernel_names.end(),
+                        [](const char *name) { return name == nullptr; });
+        serialization_stream_t disk_key;
+        if (use_disk_cache) {
+            disk_key = kernel_disk_cache::make_key(
+                    c.engine, c.kernel_names, c.params.serialization());
+            std::vector<kernel_t> kernels;
+            if (kernel_disk_cache::load(
+                        c.engine, disk_key, kernels, c.kernel_names)
+                    == status::success) {
+                c.cache_status = cache_state_t::persistent_hit;
+                auto generator = disk_value_t<value_type>::make(
+                        std::move(kernels), c.kernel_names);
+                return kernel_cache::iface_t::result_t {
+                        generator.release(), status::success};
+            }
+        }
+
         gpu_kernel_value_t generator;
         auto status = c.params.create_generator(c.engine, generator);
-        c.cache_status = cache_state_t::miss;
+        if (use_disk_cache && status == status::success) {
+            std::vector<kernel_t> kernels;
+            if (disk_value_t<value_type>::get(
+                        generator.impl(), c.kernel_names, kernels)
+                    == status::success)
+                kernel_disk_cache::store(c.engine, disk_key, kernels);
+        }
         return kernel_cache::iface_t::result_t {generator.release(), status};
     };
     create_context_t context {
             *utils::downcast<gpu_kernel_key_impl_t *>(key.impl()), engine,
-            cache_state_t::kernel_hit};
+            kernel_names, cache_state_t::kernel_hit};
     auto result = kernel_cache::get().get_or_create(key, *create, &context);
     kernel_cache_hit = context.cache_status;
     jit_generator = std::static_pointer_cast<kernel_cache::value_impl_t>(
@@ -57,7 +135,8 @@ status_t get_cached_kernels(std::shared_ptr<gpu_kernel_key_impl_t> &&key_impl,
     kernel_cache::key_t key {std::move(key_impl)};
 
     gpu_kernel_value_t value;
-    CHECK(get_or_create(key, value, engine, kernel_cache_hit));
+    CHECK(get_or_create<value_type>(
+            key, value, engine, kernel_names, kernel_cache_hit));
 
     static_assert(std::is_same<value_type, kernel_t>()
                     || std::is_same<value_type, kernel_bundle_t>(),
@@ -101,6 +101,9 @@ struct trivial_key_t : public T {
         return serialization == other.serialization && id_ == other.id_;
     }
     size_t hash() const { return hash_; }
+    const serialization_stream_t &get_serialization() const {
+        return serialization;
+    }
 
     bool is_valid() const {
         const T *base = this;
@@ -143,6 +146,8 @@ struct gpu_kernel_key_impl_t : public kernel_cache::key_impl_t {
     virtual status_t create_generator(
             impl::engine_t *engine, gpu_kernel_value_t &generator) const
             = 0;
+    // Serialized key parameters, excluding the engine.
+    virtual const serialization_stream_t &serialization() const = 0;
 };
 
 // Templated key container which implements the necessary virtual interfaces
@@ -184,6 +189,10 @@ struct gpu_kernel_key_container_t final : public gpu_kernel_key_impl_t {
 
     size_t hash() const override { return key.hash(); }
 
+    const serialization_stream_t &serialization() const override {
+        return key.get_serialization();
+    }
+
     K key;
 };
 
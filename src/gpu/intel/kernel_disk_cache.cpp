@@ -0,0 +1,296 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <process.h>
+#include <sys/utime.h>
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/cache_blob.hpp"
+#include "common/utils.hpp"
+#include "gpu/intel/engine.hpp"
+#include "gpu/intel/kernel_disk_cache.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+namespace kernel_disk_cache {
+
+namespace {
+
+const char entry_prefix[] = "dnnl_kernel_";
+const char entry_suffix[] = ".bin";
+const uint8_t entry_magic[8] = {'D', 'N', 'N', 'L', 'K', 'C', '0', '1'};
+
+const std::string &cache_dir() {
+    static const std::string dir = []() {
+        std::string d = getenv_string_user("GPU_KERNEL_CACHE_DIR");
+        if (!d.empty() && d.back() != '/' && d.back() != '\\') d += '/';
+        return d;
+    }();
+    return dir;
+}
+
+size_t cache_capacity() {
+    static const size_t capacity_mb = static_cast<size_t>(
+            nstl::max(0, getenv_int_user("GPU_KERNEL_CACHE_CAPACITY", 1024)));
+    return capacity_mb << 20;
+}
+
+// Serializes the accesses to the cache directory within the process. Other
+// processes sharing the directory are tolerated: entries are published with
+// an atomic rename and every entry is validated when loaded.
+std::mutex &cache_mutex() {
+    static std::mutex m;
+    return m;
+}
+
+std::string entry_path(const serialization_stream_t &key) {
+    char hash[2 * sizeof(uint64_t) + 1];
+    snprintf(hash, sizeof(hash), "%016llx",
+            static_cast<unsigned long long>(key.get_hash()));
+    return cache_dir() + entry_prefix + hash + entry_suffix;
+}
+
+bool read_file(const std::string &path, std::vector<uint8_t> &data) {
+    FILE *f = impl::fopen(path.c_str(), "rb");
+    if (!f) return false;
+    bool ok = fseek(f, 0, SEEK_END) == 0;
+    long size = ok ? ftell(f) : -1;
+    ok = ok && size > 0 && fseek(f, 0, SEEK_SET) == 0;
+    if (ok) {
+        data.resize(static_cast<size_t>(size));
+        ok = fread(data.data(), 1, data.size(), f) == data.size();
+    }
+    fclose(f);
+    return ok;
+}
+
+bool write_file(const std::string &path, const std::vector<uint8_t> &data) {
+    // Publish the entry atomically so that readers never see a partial file.
+#ifdef _WIN32
+    const int pid = _getpid();
+#else
+    const int pid = static_cast<int>(getpid());
+#endif
+    const std::string tmp_path = path + ".tmp" + std::to_string(pid);
+    FILE *f = impl::fopen(tmp_path.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+    ok = (fclose(f) == 0) && ok;
+#ifdef _WIN32
+    // rename() does not replace existing files on Windows.
+    if (ok) remove(path.c_str());
+#endif
+    ok = ok && rename(tmp_path.c_str(), path.c_str()) == 0;
+    if (!ok) remove(tmp_path.c_str());
+    return ok;
+}
+
+// Marks the entry as recently used.
+void touch(const std::string &path) {
+#ifdef _WIN32
+    _utime(path.c_str(), nullptr);
+#else
+    utime(path.c_str(), nullptr);
+#endif
+}
+
+struct entry_info_t {
+    std::string path;
+    size_t size;
+    time_t mtime;
+};
+
+std::vector<entry_info_t> list_entries() {
+    std::vector<entry_info_t> entries;
+    const auto is_entry = [](const std::string &name) {
+        const size_t prefix_len = sizeof(entry_prefix) - 1;
+        const size_t suffix_len = sizeof(entry_suffix) - 1;
+        return name.size() > prefix_len + suffix_len
+                && name.compare(0, prefix_len, entry_prefix) == 0
+                && name.compare(name.size() - suffix_len, suffix_len,
+                           entry_suffix)
+                == 0;
+    };
+    const auto add_entry = [&](const std::string &name) {
+        if (!is_entry(name)) return;
+        const std::string path = cache_dir() + name;
+        struct stat st;
+        if (stat(path.c_str(), &st) != 0) return;
+        entries.push_back({path, static_cast<size_t>(st.st_size), st.st_mtime});
+    };
+#ifdef _WIN32
+    WIN32_FIND_DATAA data;
+    HANDLE h = FindFirstFileA((cache_dir() + "*").c_str(), &data);
+    if (h == INVALID_HANDLE_VALUE) return entries;
+    do {
+        add_entry(data.cFileName);
+    } while (FindNextFileA(h, &data));
+    FindClose(h);
+#else
+    DIR *dir = opendir(cache_dir().c_str());
+    if (!dir) return entries;
+    while (const struct dirent *e = readdir(dir))
+        add_entry(e->d_name);
+    closedir(dir);
+#endif
+    return entries;
+}
+
+// Removes the least recently used entries until the cache fits its capacity.
+void evict() {
+    auto entries = list_entries();
+    size_t total = 0;
+    for (const auto &e : entries)
+        total += e.size;
+    if (total <= cache_capacity()) return;
+
+    std::sort(entries.begin(), entries.end(),
+            [](const entry_info_t &a, const entry_info_t &b) {
+                return a.mtime < b.mtime;
+            });
+    for (const auto &e : entries) {
+        if (total <= cache_capacity()) break;
+        if (remove(e.path.c_str()) == 0) total -= e.size;
+    }
+}
+
+// Checks that the binaries of the entry lie within the data, as cache blob
+// accessors do not check this.
+bool is_valid_blob(const uint8_t *data, size_t size) {
+    size_t pos = 0;
+    while (pos < size) {
+        size_t binary_size = 0;
+        if (size - pos < sizeof(binary_size)) return false;
+        std::memcpy(&binary_size, data + pos, sizeof(binary_size));
+        pos += sizeof(binary_size);
+        if (binary_size == 0 || binary_size > size - pos) return false;
+        pos += binary_size;
+    }
+    return true;
+}
+
+} // namespace
+
+bool is_enabled(const impl::engine_t *engine) {
+    return !cache_dir().empty() && engine->is_cache_blob_supported();
+}
+
+serialization_stream_t make_key(const impl::engine_t *engine,
+        const std::vector<const char *> &kernel_names,
+        const serialization_stream_t &params) {
+    serialization_stream_t key;
+    if (engine->serialize_device(key) != status::success) return {};
+
+    auto version = dnnl_version();
+    key.append(version->major);
+    key.append(version->minor);
+    key.append(version->patch);
+    key.append_array(std::strlen(version->hash), version->hash);
+
+    key.append(kernel_names.size());
+    for (const char *name : kernel_names)
+        key.append(std::string(name ? name : ""));
+    key.append(params.get_data());
+    return key;
+}
+
+status_t load(impl::engine_t *engine, const serialization_stream_t &key,
+        std::vector<compute::kernel_t> &kernels,
+        const std::vector<const char *> &kernel_names) {
+    if (key.empty()) return status::runtime_error;
+
+    const std::string path = entry_path(key);
+    std::vector<uint8_t> data;
+    {
+        std::lock_guard<std::mutex> guard(cache_mutex());
+        if (!read_file(path, data)) return status::runtime_error;
+        touch(path);
+    }
+
+    // The file name is only a hash, the entry stores the full key.
+    const auto &key_data = key.get_data();
+    uint64_t key_size = 0;
+    const size_t header_size = sizeof(entry_magic) + sizeof(key_size);
+    if (data.size() < header_size
+            || std::memcmp(data.data(), entry_magic, sizeof(entry_magic)) != 0)
+        return status::runtime_error;
+    std::memcpy(&key_size, data.data() + sizeof(entry_magic), sizeof(key_size));
+    if (key_size != key_data.size() || data.size() - header_size < key_size
+            || std::memcmp(data.data() + header_size, key_data.data(),
+                       key_data.size())
+                    != 0)
+        return status::runtime_error;
+
+    const size_t blob_offset = header_size + key_data.size();
+    uint8_t *blob_data = data.data() + blob_offset;
+    const size_t blob_size = data.size() - blob_offset;
+    if (!is_valid_blob(blob_data, blob_size)) return status::runtime_error;
+
+    cache_blob_t blob(blob_data, blob_size);
+    auto *intel_engine = utils::downcast<engine_t *>(engine);
+    return intel_engine->create_kernels_from_cache_blob(
+            blob, kernels, kernel_names);
+}
+
+void store(impl::engine_t *engine, const serialization_stream_t &key,
+        const std::vector<compute::kernel_t> &kernels) {
+    if (key.empty()) return;
+
+    const auto &key_data = key.get_data();
+    const uint64_t key_size = key_data.size();
+    std::vector<uint8_t> data(entry_magic, entry_magic + sizeof(entry_magic));
+    const auto *key_size_ptr = reinterpret_cast<const uint8_t *>(&key_size);
+    data.insert(data.end(), key_size_ptr, key_size_ptr + sizeof(key_size));
+    data.insert(data.end(), key_data.begin(), key_data.end());
+
+    // Same layout as in primitive cache blobs.
+    for (const auto &k : kernels) {
+        if (!k) continue;
+        xpu::binary_t binary;
+        if (k.get_binary(engine, binary) != status::success || binary.empty())
+            return;
+        const size_t binary_size = binary.size();
+        const auto *size_ptr = reinterpret_cast<const uint8_t *>(&binary_size);
+        data.insert(data.end(), size_ptr, size_ptr + sizeof(binary_size));
+        data.insert(data.end(), binary.begin(), binary.end());
+    }
+
+    std::lock_guard<std::mutex> guard(cache_mutex());
+    if (write_file(entry_path(key), data)) evict();
+}
+
+} // namespace kernel_disk_cache
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_INTEL_KERNEL_DISK_CACHE_HPP
+#define GPU_INTEL_KERNEL_DISK_CACHE_HPP
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/serialization.hpp"
+#include "gpu/intel/compute/kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace intel {
+namespace kernel_disk_cache {
+
+// Opt-in on-disk cache of kernel binaries, enabled by setting the
+// ONEDNN_GPU_KERNEL_CACHE_DIR environment variable to an existing directory.
+// Entries are keyed by the device, the driver, the library version and the
+// kernel key, so applications get warm starts without managing cache blobs.
+// Once the directory grows beyond ONEDNN_GPU_KERNEL_CACHE_CAPACITY megabytes
+// (default 1024) the least recently used entries are removed.
+
+// Returns true when the cache is enabled and usable with the engine.
+bool is_enabled(const impl::engine_t *engine);
+
+// Returns the cache key for kernels identified by their names and by the
+// serialized parameters they are compiled with.
+serialization_stream_t make_key(const impl::engine_t *engine,
+        const std::vector<const char *> &kernel_names,
+        const serialization_stream_t &params);
+
+// Creates the kernels from the cache. Returns status::success on a hit and
+// an error status on a miss.
+status_t load(impl::engine_t *engine, const serialization_stream_t &key,
+        std::vector<compute::kernel_t> &kernels,
+        const std::vector<const char *> &kernel_names);
+
+// Stores the kernel binaries in the cache. Failures are not reported as the
+// cache is only an optimization.
+void store(impl::engine_t *engine, const serialization_stream_t &key,
+        const std::vector<compute::kernel_t> &kernels);
+
+} // namespace kernel_disk_cache
+} // namespace intel
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
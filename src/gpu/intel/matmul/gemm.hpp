@@ -66,6 +66,8 @@ struct gemm_t : public primitive_t {
             // Check for grouped encoding early before reshape attempts
             VDISPATCH_MATMUL(
                     is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_MATMUL(!attr()->scales_.get(DNNL_ARG_SRC).is_dynamic(),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
 
             auto maybe_reshape = [&]() -> status_t {
                 dim_t batch_b_dims = 1;
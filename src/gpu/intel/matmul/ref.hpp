@@ -71,6 +71,8 @@ struct ref_t : public primitive_t {
                                              quantization_mode::dynamic_mx,
                                              quantization_mode::dynamic_fp}),
                     VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VDISPATCH_MATMUL(!attr()->scales_.get(DNNL_ARG_SRC).is_dynamic(),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
             VDISPATCH_MATMUL(zero_points_ok(), VERBOSE_UNSUPPORTED_ZP_CFG);
             VDISPATCH_MATMUL(
                     precomputed_reductions_ok(), VERBOSE_UNSUPPORTED_PR_CFG);
@@ -16,6 +16,7 @@
 
 #include "gpu/intel/primitive.hpp"
 #include "gpu/intel/jit/generator_base.hpp"
+#include "gpu/intel/kernel_disk_cache.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -56,9 +57,28 @@ status_t primitive_t::create_kernels(impl::engine_t *engine,
         CHECK(register_kernels(*kernels));
         return status::success;
     }
+
+    // Kernels with custom headers are not cached on disk as their sources
+    // are not part of the key.
+    const bool use_disk_cache = kernel_disk_cache::is_enabled(engine)
+            && !kernel_ctx.has_custom_headers();
+    serialization_stream_t disk_key;
+    if (use_disk_cache) {
+        disk_key = kernel_disk_cache::make_key(engine, kernel_names,
+                serialization_stream_t(kernel_ctx.options()));
+        if (kernel_disk_cache::load(engine, disk_key, *kernels, kernel_names)
+                == status::success) {
+            for (auto &k : *kernels)
+                k.hash_dump("disk");
+            CHECK(register_kernels(*kernels));
+            return status::success;
+        }
+    }
+
     CHECK(intel_engine->create_kernels(kernels, kernel_names, kernel_ctx));
     for (auto &k : *kernels)
         k.hash_dump("real");
+    if (use_disk_cache) kernel_disk_cache::store(engine, disk_key, *kernels);
     CHECK(register_kernels(*kernels));
     return status::success;
 }
@@ -501,6 +501,10 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
 #endif
         ,
         const int remainder_k
+#if KV_PAGING
+        ,
+        const global int *kv_page_table, int kv_page_table_stride
+#endif
 #if WITH_DROPOUT
         ,
         global uchar *dropout_mask_buf, int dropout_use_offset,
@@ -592,13 +596,24 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
     const bool need_sum_barrier = (ugemm_vs_barrier_count == 0);
 
     /* Convert to half precision and store */
+#if KV_PAGING
+    /* K/V hold a pool of pages; the page is resolved per k block */
+    const size_t k_offset = KEY_BATCH(0, b0_kv);
+    const size_t v_offset = VAL_BATCH(0, b0_kv);
+#else
     const size_t k_offset = KEY_BATCH(b1, b0_kv);
     const size_t v_offset = VAL_BATCH(b1, b0_kv);
+#endif
     /* Locate K/Q/V/A matrices within batch */
     K += k_offset / KEY_ELEMENTS_PER_BYTE;
     Q += QRY_BATCH(b1, b0);
     V += v_offset / VAL_ELEMENTS_PER_BYTE;
     A += DST_BATCH(b1, b0);
+#if KV_PAGING
+    kv_page_table += b1 * kv_page_table_stride;
+    const global KEY_DATA_T *K_pool = K;
+    const global VAL_DATA_T *V_pool = V;
+#endif
 #if WITH_ATTN_MASK
     msk += MSK_BATCH(b1 % MSK_D0, b0 % MSK_D1);
     int mask_aligned = (((size_t)msk) % 4) == 0;
@@ -771,6 +786,21 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
         int knext = k0 + ugemm_kq_wg_tile_m;
         bool last = (knext >= k0end);
 
+#if KV_PAGING
+        /* Each k block lies within a single page of the kv cache */
+        int page_k0 = k0 - k0 % KV_PAGE_SIZE;
+        int page = kv_page_table[k0 / KV_PAGE_SIZE];
+        K = K_pool + (size_t)page * KEY_S0 / KEY_ELEMENTS_PER_BYTE;
+        V = V_pool
+                + ((size_t)page * VAL_S0 + (size_t)(k0 - page_k0) * ldv)
+                        / VAL_ELEMENTS_PER_BYTE;
+        int kq_m = min(k0end - page_k0, KV_PAGE_SIZE);
+        int kq_i0 = k0 - page_k0;
+#else
+        int kq_m = k0end;
+        int kq_i0 = k0;
+#endif
+
 #if WITH_ATTN_MASK
         /* Load mask. No remainder handling needed assuming k block size is a power of 2. */
         mask_tile_type mask_tile;
@@ -814,8 +844,8 @@ micro_sdpa(const global KEY_DATA_T *K, const global QRY_DATA_T *Q,
         s_tile_type S_tile
 #endif
                 = ugemm_kq(AS_KEY_TILE_PTR(K), ldk, AS_QRY_SLM_TILE_PTR(Q_slm),
-                        D_MAX, k0end, ugemm_kq_wg_tile_n, d, k0, 0, 0, sg_i_kq,
-                        sg_j_kq, (local char *)ugemm_slm
+                        D_MAX, kq_m, ugemm_kq_wg_tile_n, d, kq_i0, 0, 0,
+                        sg_i_kq, sg_j_kq, (local char *)ugemm_slm
 #if KEY_SCALES == QUANTIZE_2D
                         ,
                         AS_KEY_SCALES_PTR(K_scales)
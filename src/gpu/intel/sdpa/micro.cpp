@@ -945,10 +945,20 @@ status_t micro_fwd_t::pd_t::init_conf(impl::engine_t *engine) {
         if (lda % 16 == 0 && vbytes % 4 == 0) conf.block_2d_a = true;
     }
 
+    /* With a paged kv cache each k block must stay within a single page */
+    conf.kv_page_size = 0;
+    if (with_kv_paging()) {
+        conf.kv_page_size = static_cast<int>(desc()->kv_page_size());
+        VDISPATCH_SDPA(conf.kv_page_size % tile_k == 0,
+                "kv cache page size(%d) is not a multiple of the k tile(%d)",
+                conf.kv_page_size, tile_k);
+    }
+
     if (arch() >= compute::gpu_arch_t::xe_hpc) {
         conf.prefetch_mask = true;
-        conf.prefetch_k0 = true;
-        conf.prefetch_k = true;
+        /* K prefetches walk the logical sequence, not the page table */
+        conf.prefetch_k0 = !with_kv_paging();
+        conf.prefetch_k = !with_kv_paging();
         conf.prefetch_v = true;
         conf.prefetch_d_max = nstl::min(d_max(), 64);
         bool no_rem = d_full && v_full && (desc()->keys() % tile_k == 0);
@@ -1137,6 +1147,9 @@ status_t micro_fwd_params_t::get_kernel_ctx(
     kernel_ctx.define_int("PREFETCH_D_MAX", prefetch_d_max);
     kernel_ctx.define_int("REMAINDER_Q", remainder_q);
 
+    kernel_ctx.define_int("KV_PAGING", kv_page_size > 0);
+    kernel_ctx.define_int("KV_PAGE_SIZE", kv_page_size);
+
     kernel_ctx.define_int("Q_ARRIVE_AWAIT_BARRIER", q_arrive_await_barrier);
     kernel_ctx.define_int("SOFTMAX_INF_AS_ZERO", softmax_inf_as_zero);
     kernel_ctx.define_int("USE_SYSTOLIC_UKERNEL", use_systolic_ukernel);
@@ -1676,6 +1689,11 @@ status_t micro_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
     const int remainder_k = (K % kq_wg_tile_m) != 0;
 
     arg_list.append(remainder_k);
+    if (pd()->with_kv_paging()) {
+        const memory_desc_wrapper pt_mdw(pd()->desc()->kv_page_table_md());
+        arg_list.append(CTX_IN_STORAGE(DNNL_ARG_KV_PAGE_TABLE));
+        arg_list.append(static_cast<int>(pt_mdw.blocking_desc().strides[0]));
+    }
 
     CHECK(append_dropout_args(ctx, arg_list, pd()->conf, /*is_fwd*/ true));
     compute::range_t lws = {(size_t)pd()->sg_size(), (size_t)sg_per_wg, 1};
@@ -90,6 +90,7 @@ struct micro_fwd_params_t : trivially_serializable_t<micro_fwd_params_t> {
     bool remainder_q;
     uint8_t padding2[5] = {0};
     int prefetch_d_max;
+    int kv_page_size;
 
     bool softmax_inf_as_zero;
     bool q_arrive_await_barrier;
@@ -167,6 +168,23 @@ struct micro_fwd_t : public primitive_t {
             using smask_t = primitive_attr_t::skip_mask_t;
 
             VDISPATCH_SDPA(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_SDPA(!with_varlen(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "variable-length batch");
+            if (with_kv_paging()) {
+                memory_desc_wrapper pt_mdw(desc()->kv_page_table_md());
+                VDISPATCH_SDPA(pt_mdw.data_type() == s32,
+                        VERBOSE_UNSUPPORTED_DT_CFG);
+                VDISPATCH_SDPA(pt_mdw.ndims() == 2 && pt_mdw.is_plain()
+                                && pt_mdw.blocking_desc().strides[1] == 1,
+                        VERBOSE_UNSUPPORTED_TAG);
+                VDISPATCH_SDPA(
+                        utils::one_of(desc()->kv_page_size(), 16, 32, 64),
+                        VERBOSE_UNSUPPORTED_FEATURE, "kv cache page size");
+                VDISPATCH_SDPA(!with_key_scales() && !with_key_zp()
+                                && !with_value_scales() && !with_value_zp(),
+                        VERBOSE_UNSUPPORTED_FEATURE,
+                        "quantized paged kv cache");
+            }
             memory_desc_wrapper qry_mdw(desc()->qry_md());
             memory_desc_wrapper key_mdw(desc()->key_md());
             memory_desc_wrapper val_mdw(desc()->val_md());
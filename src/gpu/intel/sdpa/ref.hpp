@@ -41,6 +41,10 @@ struct ref_fwd_t : public primitive_t {
             /* Reference SDPA is only enabled on-demand, for testing. */
             bool enable_ref = gpu_utils::dev_getenv("enable_ref_sdpa", false);
             VDISPATCH_SDPA(enable_ref, VERBOSE_SKIP_PRIMITIVE_IMPL);
+            VDISPATCH_SDPA(!with_kv_paging(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "paged kv cache");
+            VDISPATCH_SDPA(!with_varlen(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "variable-length batch");
 
             VDISPATCH_SDPA(attr()->has_default_values(smask_t::scales),
                     VERBOSE_UNSUPPORTED_ATTR);
@@ -34,6 +34,12 @@ public:
     virtual status_t enter_immediate_mode() { return status::success; }
     virtual status_t exit_immediate_mode() { return status::success; }
 
+    // Chunked completion signaling: when the chunk size is not zero,
+    // implementations computing the destination one chunk of N columns at a
+    // time call `signal_chunk()` after submitting each chunk.
+    virtual dim_t signal_chunk_size() const { return 0; }
+    virtual status_t signal_chunk(int idx) { return status::success; }
+
 protected:
     bool has_zero_pad_primitive() const { return engine()->kind() == dnnl_gpu; }
 
@@ -49,6 +49,13 @@ public:
     status_t wait() override { return impl()->wait(); }
     status_t barrier() override { return impl()->barrier(); }
 
+    dim_t signal_chunk_size() const override {
+        return impl()->ze_ctx().chunk_size();
+    }
+    status_t signal_chunk(int idx) override {
+        return impl()->signal_chunk(idx);
+    }
+
     void before_exec_hook() override;
     void after_exec_hook() override;
 
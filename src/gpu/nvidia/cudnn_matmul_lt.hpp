@@ -350,8 +350,8 @@ struct cudnn_matmul_lt_t : public gpu::primitive_t {
             int eltwise_idx_ = attr()->post_ops_.find(primitive_kind::eltwise);
             auto eltwise_algo
                     = attr()->post_ops_.entry_[eltwise_idx_].eltwise.alg;
-            if (eltwise_algo == alg_kind::eltwise_relu) { return true; }
-            return false;
+            return utils::one_of(eltwise_algo, alg_kind::eltwise_relu,
+                    alg_kind::eltwise_gelu_tanh);
         }
 
         bool imma_blocks() {
@@ -18,6 +18,10 @@
 #ifndef GPU_NVIDIA_CUDNN_MATMUL_LT_IMPL_HPP
 #define GPU_NVIDIA_CUDNN_MATMUL_LT_IMPL_HPP
 
+#include <map>
+#include <mutex>
+#include <vector>
+
 #include <cublasLt.h>
 #include "cudnn.h"
 #include <cublas_v2.h>
@@ -110,25 +114,35 @@ struct cublas_lt_params : cublas_base_params {
                 return status::unimplemented;
             } else {
                 with_relu_ = eltwise_algo(attr) == alg_kind::eltwise_relu;
-                if (!with_relu_ || dst_row_major || with_separate_bias_) {
+                // cuBLASLt GELU epilogues use the tanh approximation
+                with_gelu_
+                        = eltwise_algo(attr) == alg_kind::eltwise_gelu_tanh;
+                if ((!with_relu_ && !with_gelu_) || dst_row_major
+                        || with_separate_bias_) {
                     with_separate_eltwise_ = true;
                 }
             }
         }
         with_relu_epilogue_ = with_relu_ && !with_separate_eltwise_;
+        with_gelu_epilogue_ = with_gelu_ && !with_separate_eltwise_;
+        const bool with_eltwise_epilogue
+                = with_relu_epilogue_ || with_gelu_epilogue_;
 
         // Separate activation is not supported and separate bias in non-imma case not supported.
         if ((with_separate_bias_ && !imma_case_) || with_separate_eltwise_) {
             return status::unimplemented;
         }
 
-        // CublasLt is only used for the IMMA case and when the bias and relu are used in the epilogue
-        if (!imma_case_ && !with_relu_epilogue_ && !with_bias_epilogue_) {
+        // CublasLt is only used for the IMMA case and when the bias and
+        // activation are used in the epilogue
+        if (!imma_case_ && !with_eltwise_epilogue && !with_bias_epilogue_) {
             return status::unimplemented;
         }
 
         // Imma case only supports default epilogue
-        if (imma_case_ && with_relu_epilogue_) { return status::unimplemented; }
+        if (imma_case_ && with_eltwise_epilogue) {
+            return status::unimplemented;
+        }
 
         // we use separate bias to support imma case
         if (imma_case_ && with_bias_epilogue_) {
@@ -139,7 +153,7 @@ struct cublas_lt_params : cublas_base_params {
         // if dst case is single value but we have post ops
         if (with_dst_scale_
                 && (with_bias_epilogue_ || with_separate_bias_
-                        || with_relu_epilogue_)) {
+                        || with_eltwise_epilogue)) {
             multi_dst_scale_ = true;
         }
 
@@ -183,6 +197,7 @@ struct cublas_lt_params : cublas_base_params {
         reorder_required_ = other->reorder_required_;
         with_bias_epilogue_ = other->with_bias_epilogue_;
         with_relu_epilogue_ = other->with_relu_epilogue_;
+        with_gelu_epilogue_ = other->with_gelu_epilogue_;
         imma_ampere_case_ = other->imma_ampere_case_;
         imma_plain_case_ = other->imma_plain_case_;
         alpha_beta_size_bytes_ = other->alpha_beta_size_bytes_;
@@ -237,11 +252,23 @@ struct cublas_lt_params : cublas_base_params {
         auto cuda_stream = utils::downcast<nvidia::stream_t *>(service_stream);
         auto cublas_handle = cuda_stream->get_cublas_handle();
         auto lt_handle = (cublasLtHandle_t)cublas_handle;
-        CHECK(init_scratchpad_size(lt_handle, src_d, weights_d, dst_d));
+        CHECK(init_scratchpad_size(lt_handle,
+                sycl_engine.get_underlying_device(), src_d, weights_d, dst_d));
 
         return status::success;
     }
 
+    cublasLtEpilogue_t get_epilogue() const {
+        if (with_bias_epilogue_) {
+            if (with_relu_epilogue_) return CUBLASLT_EPILOGUE_RELU_BIAS;
+            if (with_gelu_epilogue_) return CUBLASLT_EPILOGUE_GELU_BIAS;
+            return CUBLASLT_EPILOGUE_BIAS;
+        }
+        if (with_relu_epilogue_) return CUBLASLT_EPILOGUE_RELU;
+        if (with_gelu_epilogue_) return CUBLASLT_EPILOGUE_GELU;
+        return CUBLASLT_EPILOGUE_DEFAULT;
+    }
+
     void check_imma_case(const memory_desc_wrapper &src_d,
             const memory_desc_wrapper &weights_d,
             const memory_desc_wrapper &dst_d) {
@@ -357,8 +384,35 @@ struct cublas_lt_params : cublas_base_params {
         return status::success;
     }
 
+    // Process-wide cache of cublasLtMatmulAlgoGetHeuristic results. The
+    // heuristic query is expensive compared to small GEMMs, and it is
+    // repeated for every primitive creation and, with runtime dimensions,
+    // for every execution of the same problem.
+    using algo_cache_key_t = std::vector<int64_t>;
+    static std::map<algo_cache_key_t, cublasLtMatmulHeuristicResult_t> &
+    algo_cache() {
+        static std::map<algo_cache_key_t, cublasLtMatmulHeuristicResult_t>
+                cache;
+        return cache;
+    }
+    static std::mutex &algo_cache_mutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    algo_cache_key_t get_algo_cache_key(
+            CUdevice device, uint64_t workspace_size) const {
+        return {static_cast<int64_t>(device), static_cast<int64_t>(M_),
+                static_cast<int64_t>(N_), static_cast<int64_t>(K_),
+                static_cast<int64_t>(batch_count_), stride_a_, stride_b_,
+                stride_c_, trans_a_, trans_b_, trans_c_, imma_ampere_case_,
+                src_type_, weights_type_, dst_type_, acc_type_,
+                compute_type_, get_epilogue(),
+                static_cast<int64_t>(workspace_size)};
+    }
+
     // Initialization for scratchpad memory
-    status_t init_scratchpad_size(cublasLtHandle_t lt_handle,
+    status_t init_scratchpad_size(cublasLtHandle_t lt_handle, CUdevice device,
             const memory_desc_wrapper &src_d,
             const memory_desc_wrapper &weights_d,
             const memory_desc_wrapper &dst_d) {
@@ -380,21 +434,35 @@ struct cublas_lt_params : cublas_base_params {
                 CUBLASLT_MATMUL_PREF_REDUCTION_SCHEME_MASK, &reduction_scheme,
                 sizeof(reduction_scheme));
 
-        int num_results = 0;
-        if (imma_ampere_case_) {
-            CUBLAS_EXECUTE_FUNC(cublasLtMatmulAlgoGetHeuristic, lt_handle,
-                    operation_desc_, blocked_a_layout_, blocked_b_layout_,
-                    blocked_c_layout_, blocked_c_layout_, preference_,
-                    1 /* Num requested algos*/, &heuristic_results_,
-                    &num_results);
+        // The epilogue affects the algorithm selection, so it must be set
+        // before querying the heuristic.
+        cublasLtEpilogue_t epilogue = get_epilogue();
+        CUBLAS_EXECUTE_FUNC(cublasLtMatmulDescSetAttribute, operation_desc_,
+                CUBLASLT_MATMUL_DESC_EPILOGUE, &epilogue, sizeof(epilogue));
+
+        const auto key = get_algo_cache_key(device, workspace_size);
+        std::lock_guard<std::mutex> lock(algo_cache_mutex());
+        auto it = algo_cache().find(key);
+        if (it != algo_cache().end()) {
+            heuristic_results_ = it->second;
         } else {
-            CUBLAS_EXECUTE_FUNC(cublasLtMatmulAlgoGetHeuristic, lt_handle,
-                    operation_desc_, a_layout_, b_layout_, c_layout_, c_layout_,
-                    preference_, 1 /* Num requested algos*/,
-                    &heuristic_results_, &num_results);
-        }
+            int num_results = 0;
+            if (imma_ampere_case_) {
+                CUBLAS_EXECUTE_FUNC(cublasLtMatmulAlgoGetHeuristic, lt_handle,
+                        operation_desc_, blocked_a_layout_, blocked_b_layout_,
+                        blocked_c_layout_, blocked_c_layout_, preference_,
+                        1 /* Num requested algos*/, &heuristic_results_,
+                        &num_results);
+            } else {
+                CUBLAS_EXECUTE_FUNC(cublasLtMatmulAlgoGetHeuristic, lt_handle,
+                        operation_desc_, a_layout_, b_layout_, c_layout_,
+                        c_layout_, preference_, 1 /* Num requested algos*/,
+                        &heuristic_results_, &num_results);
+            }
 
-        if (num_results == 0) { return status_t::dnnl_runtime_error; }
+            if (num_results == 0) { return status_t::dnnl_runtime_error; }
+            algo_cache().emplace(key, heuristic_results_);
+        }
         gemm_algo_ = heuristic_results_.algo;
         algo_scratch_size_ = heuristic_results_.workspaceSize;
 
@@ -605,6 +673,8 @@ struct cublas_lt_params : cublas_base_params {
     bool with_bias_epilogue_ = false;
     bool with_relu_;
     bool with_relu_epilogue_ = false;
+    bool with_gelu_ = false;
+    bool with_gelu_epilogue_ = false;
     bool imma_case_ = false;
     bool imma_ampere_case_ = false;
     bool imma_plain_case_ = false;
@@ -687,22 +757,13 @@ struct cudnn_matmul_lt_impl_t {
             }
         }
 
-        cublasLtEpilogue_t epilogue = CUBLASLT_EPILOGUE_DEFAULT;
-        auto with_bias_epilogue = params->with_bias_epilogue_;
-        auto with_relu_epilogue = params->with_relu_epilogue_;
+        cublasLtEpilogue_t epilogue = params->get_epilogue();
 
         auto operation_desc = params->operation_desc_;
 
-        if (with_bias_epilogue) {
-            if (with_relu_epilogue) {
-                epilogue = CUBLASLT_EPILOGUE_RELU_BIAS;
-            } else {
-                epilogue = CUBLASLT_EPILOGUE_BIAS;
-            }
+        if (params->with_bias_epilogue_) {
             CUBLAS_EXECUTE_FUNC(cublasLtMatmulDescSetAttribute, operation_desc,
                     CUBLASLT_MATMUL_DESC_BIAS_POINTER, &bias, sizeof(bias));
-        } else if (with_relu_epilogue && !with_bias_epilogue) {
-            epilogue = CUBLASLT_EPILOGUE_RELU;
         }
         CUBLAS_EXECUTE_FUNC(cublasLtMatmulDescSetAttribute, operation_desc,
                 CUBLASLT_MATMUL_DESC_EPILOGUE, &epilogue, sizeof(epilogue));
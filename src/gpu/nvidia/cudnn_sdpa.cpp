@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gpu/nvidia/cudnn_sdpa.hpp"
+#include "common/host_scalar_memory_storage.hpp"
+#include "gpu/nvidia/stream.hpp"
+#include "gpu/nvidia/sycl_cuda_scoped_context.hpp"
+#include "gpu/nvidia/sycl_cuda_stream_utils.hpp"
+#include "xpu/sycl/buffer_memory_storage.hpp"
+#include "xpu/sycl/memory_storage_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace nvidia {
+
+status_t cudnn_sdpa_fwd_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    nvidia::stream_t *cuda_stream
+            = utils::downcast<nvidia::stream_t *>(ctx.stream());
+
+    const bool invert_scale = pd()->desc()->invert_scale;
+    if (pd()->with_attn_scale()) {
+        if (pd()->with_host_scale()) {
+            const auto *scale_storage
+                    = utils::downcast<const host_scalar_memory_storage_t *>(
+                            &CTX_IN_STORAGE(DNNL_ARG_SCALE));
+            CHECK(scale_storage->get_scalar_value(
+                    &host_scale_[0], sizeof(float)));
+        } else {
+            CHECK(stream_utils::copy_input_arg_to_host(ctx, cuda_stream,
+                    &host_scale_[0], DNNL_ARG_SCALE, sizeof(float)));
+        }
+    }
+
+    return cuda_stream->interop_task([&](::sycl::handler &cgh) {
+        auto arg_qry = CTX_IN_SYCL_MEMORY(DNNL_ARG_QUERIES);
+        auto arg_key = CTX_IN_SYCL_MEMORY(DNNL_ARG_KEYS);
+        auto arg_val = CTX_IN_SYCL_MEMORY(DNNL_ARG_VALUES);
+        auto arg_msk = CTX_IN_SYCL_MEMORY(DNNL_ARG_ATTN_MASK);
+        auto arg_dst = CTX_OUT_SYCL_MEMORY(DNNL_ARG_DST);
+        auto arg_scores = CTX_SCRATCH_SYCL_MEMORY(
+                memory_tracking::names::key_sdpa_scores);
+
+        compat::host_task(cgh, [=, this](const compat::interop_handle &ih) {
+            auto &sycl_engine = *utils::downcast<nvidia::engine_t *>(
+                    cuda_stream->engine());
+            auto sc = cuda_sycl_scoped_context_handler_t(sycl_engine);
+            // Use cuBLAS and cuDNN handles of the same CUstream so that the
+            // GEMMs and the softmax are ordered.
+            auto native_stream = cuda_stream->get_underlying_stream();
+            auto cublas_handle = cuda_stream->get_cublas_handle(native_stream);
+            auto cudnn_handle = cuda_stream->get_cudnn_handle(native_stream);
+
+            const float scale = pd()->with_attn_scale()
+                    ? (invert_scale ? 1.f / host_scale_[0] : host_scale_[0])
+                    : 1.f;
+
+            pd()->sdpa_impl_->execute(cublas_handle, cudnn_handle,
+                    arg_qry.get_native_pointer(ih),
+                    arg_key.get_native_pointer(ih),
+                    arg_val.get_native_pointer(ih),
+                    pd()->with_attn_mask() ? arg_msk.get_native_pointer(ih)
+                                           : nullptr,
+                    arg_dst.get_native_pointer(ih),
+                    arg_scores.get_native_pointer(ih), scale);
+        });
+    });
+}
+
+} // namespace nvidia
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
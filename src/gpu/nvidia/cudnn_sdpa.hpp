@@ -0,0 +1,134 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_NVIDIA_CUDNN_SDPA_HPP
+#define GPU_NVIDIA_CUDNN_SDPA_HPP
+
+#include "common/sdpa_pd.hpp"
+#include "gpu/gpu_primitive.hpp"
+#include "gpu/nvidia/cudnn_sdpa_impl.hpp"
+#include "gpu/nvidia/engine.hpp"
+#include "gpu/nvidia/sycl_cuda_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace nvidia {
+
+struct cudnn_sdpa_fwd_t : public gpu::primitive_t {
+    using gpu::primitive_t::primitive_t;
+
+    struct pd_t : public sdpa_fwd_pd_t {
+        using sdpa_fwd_pd_t::sdpa_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("cuda:cublas:any", cudnn_sdpa_fwd_t);
+
+        status_t init(impl::engine_t *engine) {
+            using namespace data_type;
+
+            const auto *d = desc();
+            const auto qry_dt = d->qry_md()->data_type;
+            auto sycl_dev
+                    = utils::downcast<nvidia::engine_t *>(engine)->device();
+
+            VDISPATCH_SDPA(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_SDPA(utils::one_of(qry_dt, f32, f16, bf16),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(utils::everyone_is(qry_dt, d->key_md()->data_type,
+                                   d->val_md()->data_type,
+                                   dst_md()->data_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(
+                    IMPLICATION(qry_dt == bf16, has_bf16_support(sycl_dev)),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(attr()->has_default_values(),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_SDPA(!with_key_scales() && !with_value_scales()
+                            && !with_key_zp() && !with_value_zp(),
+                    VERBOSE_UNSUPPORTED_FEATURE, "kv quantization");
+            VDISPATCH_SDPA(!with_kv_paging(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "paged kv cache");
+            VDISPATCH_SDPA(!with_varlen(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "variable-length batch");
+            VDISPATCH_SDPA(!with_causal_mask(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "causal mask");
+            VDISPATCH_SDPA(d->softmax_alg == alg_kind::softmax_accurate,
+                    VERBOSE_BAD_ALGORITHM);
+            VDISPATCH_SDPA(utils::everyone_is(4, d->qry_md()->ndims,
+                                   d->key_md()->ndims, d->val_md()->ndims,
+                                   dst_md()->ndims),
+                    VERBOSE_BAD_NDIMS, "sdpa", d->qry_md()->ndims);
+            VDISPATCH_SDPA(d->key_md()->dims[0] == d->qry_md()->dims[0]
+                            && d->val_md()->dims[0] == d->qry_md()->dims[0],
+                    VERBOSE_UNSUPPORTED_FEATURE, "batch broadcast");
+            VDISPATCH_SDPA(d->key_md()->dims[1] == d->qry_md()->dims[1]
+                            && d->val_md()->dims[1] == d->qry_md()->dims[1],
+                    VERBOSE_UNSUPPORTED_FEATURE, "grouped kv heads");
+            if (with_attn_scale()) {
+                VDISPATCH_SDPA(d->scale_md()->data_type == f32,
+                        VERBOSE_UNSUPPORTED_DT);
+            }
+            if (with_attn_mask()) {
+                const auto *msk_md = d->attn_mask_md();
+                VDISPATCH_SDPA(msk_md->data_type == qry_dt,
+                        VERBOSE_UNSUPPORTED_DT);
+                VDISPATCH_SDPA(msk_md->ndims == 4
+                                && memory_desc_wrapper(msk_md).is_plain(),
+                        VERBOSE_UNSUPPORTED_TAG);
+            }
+            VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            for (auto *md : {d->qry_md(), d->key_md(), d->val_md(),
+                         dst_md()}) {
+                VDISPATCH_SDPA(memory_desc_wrapper(md).is_plain(),
+                        VERBOSE_UNSUPPORTED_TAG);
+            }
+
+            sdpa_impl_.reset(new cudnn_sdpa_fwd_impl_t());
+            VDISPATCH_SDPA_SC(sdpa_impl_->init(this), VERBOSE_UNSUPPORTED_TAG);
+
+            scratchpad_registry().registrar().book(
+                    memory_tracking::names::key_sdpa_scores,
+                    sdpa_impl_->scores_size(), 1, 256);
+
+            return status::success;
+        }
+
+        std::shared_ptr<cudnn_sdpa_fwd_impl_t> sdpa_impl_;
+    };
+
+    status_t init(impl::engine_t *engine) override {
+        host_scale_ = new float[1];
+        if (!host_scale_) return status::out_of_memory;
+        host_scale_[0] = 1.0f;
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+    ~cudnn_sdpa_fwd_t() override { delete[] host_scale_; }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    float *host_scale_ = nullptr;
+};
+
+} // namespace nvidia
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,199 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GPU_NVIDIA_CUDNN_SDPA_IMPL_HPP
+#define GPU_NVIDIA_CUDNN_SDPA_IMPL_HPP
+
+#include "cudnn.h"
+#include <cublas_v2.h>
+
+#include "common/sdpa_pd.hpp"
+#include "gpu/nvidia/sycl_cuda_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace gpu {
+namespace nvidia {
+
+// Scaled dot product attention computed as two strided batched cuBLAS GEMMs
+// with the attention mask added by cudnnAddTensor and the softmax computed by
+// cudnnSoftmaxForward in between. The scores are materialized in the
+// scratchpad in the data type of the queries.
+struct cudnn_sdpa_fwd_impl_t {
+    status_t init(const sdpa_fwd_pd_t *pd) {
+        const auto *desc = pd->desc();
+        const memory_desc_wrapper qry_d(desc->qry_md());
+        const memory_desc_wrapper key_d(desc->key_md());
+        const memory_desc_wrapper val_d(desc->val_md());
+        const memory_desc_wrapper dst_d(pd->dst_md());
+
+        mb_ = qry_d.dims()[0];
+        heads_ = qry_d.dims()[1];
+        queries_ = desc->queries();
+        keys_ = desc->keys();
+        head_size_ = desc->head_size();
+        values_ = val_d.dims()[3];
+
+        CHECK(get_cublas_data_type(qry_d.data_type(), data_type_));
+        dt_size_ = qry_d.data_type_size();
+
+        // The GEMMs are expressed in the column-major convention of cuBLAS:
+        //   S^T (keys x queries) = K^T (keys x head_size) * Q^T
+        //   O^T (values x queries) = V^T (values x keys) * P^T
+        const auto &qs = qry_d.blocking_desc().strides;
+        const auto &ks = key_d.blocking_desc().strides;
+        const auto &vs = val_d.blocking_desc().strides;
+        const auto &ds = dst_d.blocking_desc().strides;
+        CHECK(get_operand(ks[3], ks[2], trans_k_, ld_k_));
+        CHECK(get_operand(qs[3], qs[2], trans_q_, ld_q_));
+        CHECK(get_operand(vs[3], vs[2], trans_v_, ld_v_));
+        if (ds[3] != 1) return status::unimplemented;
+        ld_dst_ = ds[2];
+
+        head_stride_q_ = qs[1];
+        head_stride_k_ = ks[1];
+        head_stride_v_ = vs[1];
+        head_stride_dst_ = ds[1];
+        mb_stride_q_ = qs[0];
+        mb_stride_k_ = ks[0];
+        mb_stride_v_ = vs[0];
+        mb_stride_dst_ = ds[0];
+
+        cudnnDataType_t cudnn_dt;
+        CHECK(convert_data_type(desc->qry_md(), &cudnn_dt));
+
+        int scores_dims[4] = {(int)mb_, (int)heads_, (int)queries_,
+                (int)keys_};
+        int scores_strides[4] = {(int)(heads_ * queries_ * keys_),
+                (int)(queries_ * keys_), (int)keys_, 1};
+        CHECK(create_and_set_tensor_descriptor(
+                &scores_desc_, cudnn_dt, 4, scores_dims, scores_strides));
+
+        // Softmax is computed over the keys of every row of the scores.
+        int rows_dims[4] = {(int)(mb_ * heads_ * queries_), (int)keys_, 1, 1};
+        int rows_strides[4] = {(int)keys_, 1, 1, 1};
+        CHECK(create_and_set_tensor_descriptor(
+                &rows_desc_, cudnn_dt, 4, rows_dims, rows_strides));
+
+        if (pd->with_attn_mask()) {
+            const memory_desc_wrapper msk_d(desc->attn_mask_md());
+            int msk_dims[4], msk_strides[4];
+            for (int i = 0; i < 4; i++) {
+                msk_dims[i] = (int)msk_d.dims()[i];
+                msk_strides[i] = (int)msk_d.blocking_desc().strides[i];
+            }
+            CHECK(create_and_set_tensor_descriptor(
+                    &mask_desc_, cudnn_dt, 4, msk_dims, msk_strides));
+        }
+
+        return status::success;
+    }
+
+    size_t scores_size() const {
+        return mb_ * heads_ * queries_ * keys_ * dt_size_;
+    }
+
+    void execute(cublasHandle_t cublas_handle, cudnnHandle_t cudnn_handle,
+            void *qry, void *key, void *val, void *msk, void *dst,
+            void *scores, float scale) const {
+        const float zero = 0.f, one = 1.f;
+        auto offset = [&](void *ptr, dim_t elems) {
+            return static_cast<void *>(
+                    static_cast<char *>(ptr) + elems * dt_size_);
+        };
+        const int64_t scores_head_stride = queries_ * keys_;
+
+        for (dim_t mb = 0; mb < mb_; mb++) {
+            void *scores_mb = offset(scores, mb * heads_ * scores_head_stride);
+            CUBLAS_EXECUTE_FUNC(cublasGemmStridedBatchedEx, cublas_handle,
+                    trans_k_, trans_q_, keys_, queries_, head_size_, &scale,
+                    offset(key, mb * mb_stride_k_), data_type_, ld_k_,
+                    head_stride_k_, offset(qry, mb * mb_stride_q_), data_type_,
+                    ld_q_, head_stride_q_, &zero, scores_mb, data_type_, keys_,
+                    scores_head_stride, heads_, CUBLAS_COMPUTE_32F,
+                    CUBLAS_GEMM_DEFAULT_TENSOR_OP);
+        }
+
+        if (msk) {
+            CUDNN_EXECUTE_FUNC(cudnnAddTensor, cudnn_handle, &one, mask_desc_,
+                    msk, &one, scores_desc_, scores);
+        }
+
+        CUDNN_EXECUTE_FUNC(cudnnSoftmaxForward, cudnn_handle,
+                CUDNN_SOFTMAX_ACCURATE, CUDNN_SOFTMAX_MODE_INSTANCE, &one,
+                rows_desc_, scores, &zero, rows_desc_, scores);
+
+        for (dim_t mb = 0; mb < mb_; mb++) {
+            void *scores_mb = offset(scores, mb * heads_ * scores_head_stride);
+            CUBLAS_EXECUTE_FUNC(cublasGemmStridedBatchedEx, cublas_handle,
+                    trans_v_, CUBLAS_OP_N, values_, queries_, keys_, &one,
+                    offset(val, mb * mb_stride_v_), data_type_, ld_v_,
+                    head_stride_v_, scores_mb, data_type_, keys_,
+                    scores_head_stride, &zero, offset(dst, mb * mb_stride_dst_),
+                    data_type_, ld_dst_, head_stride_dst_, heads_,
+                    CUBLAS_COMPUTE_32F, CUBLAS_GEMM_DEFAULT_TENSOR_OP);
+        }
+    }
+
+    ~cudnn_sdpa_fwd_impl_t() {
+        for (auto desc : {scores_desc_, rows_desc_, mask_desc_}) {
+            if (desc) {
+                CUDNN_EXECUTE_FUNC_V(cudnnDestroyTensorDescriptor, desc);
+            }
+        }
+    }
+
+private:
+    // Returns the cuBLAS operation and leading dimension for a column-major
+    // operand whose rows and columns are laid out with the given strides.
+    static status_t get_operand(dim_t row_stride, dim_t col_stride,
+            cublasOperation_t &op, int64_t &ld) {
+        if (row_stride == 1) {
+            op = CUBLAS_OP_N;
+            ld = col_stride;
+        } else if (col_stride == 1) {
+            op = CUBLAS_OP_T;
+            ld = row_stride;
+        } else {
+            return status::unimplemented;
+        }
+        return status::success;
+    }
+
+    dim_t mb_ = 0, heads_ = 0, queries_ = 0, keys_ = 0, head_size_ = 0,
+          values_ = 0;
+    size_t dt_size_ = 0;
+    cudaDataType_t data_type_ = CUDA_R_32F;
+
+    cublasOperation_t trans_q_ = CUBLAS_OP_N, trans_k_ = CUBLAS_OP_N,
+                      trans_v_ = CUBLAS_OP_N;
+    int64_t ld_q_ = 0, ld_k_ = 0, ld_v_ = 0, ld_dst_ = 0;
+    int64_t head_stride_q_ = 0, head_stride_k_ = 0, head_stride_v_ = 0,
+            head_stride_dst_ = 0;
+    dim_t mb_stride_q_ = 0, mb_stride_k_ = 0, mb_stride_v_ = 0,
+          mb_stride_dst_ = 0;
+
+    cudnnTensorDescriptor_t scores_desc_ = nullptr;
+    cudnnTensorDescriptor_t rows_desc_ = nullptr;
+    cudnnTensorDescriptor_t mask_desc_ = nullptr;
+};
+
+} // namespace nvidia
+} // namespace gpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -115,6 +115,103 @@ status_t stream_t::interop_task(
     } catch (std::runtime_error &e) { return status::runtime_error; }
 }
 
+stream_t::~stream_t() {
+    if (graph_exec_) {
+        auto &sycl_engine = *utils::downcast<nvidia::engine_t *>(engine());
+        auto sc = cuda_sycl_scoped_context_handler_t(sycl_engine);
+        CUDA_EXECUTE_FUNC_V(cuGraphExecDestroy, graph_exec_);
+    }
+}
+
+status_t stream_t::begin_graph_capture() {
+    VCONDCHECK(primitive, exec, check, stream,
+            (flags() & stream_flags::in_order) != 0, status::invalid_arguments,
+            "graph capture requires an in-order stream");
+    if (capturing_) return status::invalid_arguments;
+
+    // The capture is started from a host task so that it is ordered with the
+    // host tasks of the primitives executed on the stream.
+    status_t capture_status = status::success;
+    CHECK(interop_task([&](::sycl::handler &cgh) {
+        compat::host_task(cgh, [&](const compat::interop_handle &) {
+            auto &sycl_engine
+                    = *utils::downcast<nvidia::engine_t *>(engine());
+            auto sc = cuda_sycl_scoped_context_handler_t(sycl_engine);
+            capture_status = CUDA_EXECUTE_FUNC_S(cuStreamBeginCapture,
+                    get_underlying_stream(), CU_STREAM_CAPTURE_MODE_RELAXED);
+        });
+    }));
+    CHECK(wait());
+    CHECK(capture_status);
+
+    capturing_ = true;
+    return status::success;
+}
+
+status_t stream_t::end_graph_capture() {
+    if (!capturing_) return status::invalid_arguments;
+    capturing_ = false;
+
+    CUgraph graph = nullptr;
+    status_t capture_status = status::success;
+    CHECK(interop_task([&](::sycl::handler &cgh) {
+        compat::host_task(cgh, [&](const compat::interop_handle &) {
+            auto &sycl_engine
+                    = *utils::downcast<nvidia::engine_t *>(engine());
+            auto sc = cuda_sycl_scoped_context_handler_t(sycl_engine);
+            capture_status = CUDA_EXECUTE_FUNC_S(
+                    cuStreamEndCapture, get_underlying_stream(), &graph);
+        });
+    }));
+    CHECK(wait());
+    CHECK(capture_status);
+
+    auto &sycl_engine = *utils::downcast<nvidia::engine_t *>(engine());
+    auto sc = cuda_sycl_scoped_context_handler_t(sycl_engine);
+
+    // Updating the executable graph in place only rewrites the node
+    // parameters, which is much cheaper than instantiating a new one.
+    bool updated = false;
+    if (graph_exec_) {
+#if CUDA_VERSION >= 12000
+        CUgraphExecUpdateResultInfo info;
+        updated = cuGraphExecUpdate(graph_exec_, graph, &info) == CUDA_SUCCESS;
+#else
+        CUgraphNode error_node;
+        CUgraphExecUpdateResult result;
+        updated = cuGraphExecUpdate(graph_exec_, graph, &error_node, &result)
+                == CUDA_SUCCESS;
+#endif
+        if (!updated) {
+            CUDA_EXECUTE_FUNC_V(cuGraphExecDestroy, graph_exec_);
+            graph_exec_ = nullptr;
+        }
+    }
+
+    status_t status = status::success;
+    if (!updated)
+        status = CUDA_EXECUTE_FUNC_S(
+                cuGraphInstantiate, &graph_exec_, graph, 0);
+    CUDA_EXECUTE_FUNC_V(cuGraphDestroy, graph);
+    if (status != status::success) graph_exec_ = nullptr;
+    return status;
+}
+
+status_t stream_t::replay_graph() {
+    if (capturing_ || !graph_exec_) return status::invalid_arguments;
+
+    return interop_task([&](::sycl::handler &cgh) {
+        CUgraphExec graph_exec = graph_exec_;
+        compat::host_task(cgh, [=, this](const compat::interop_handle &) {
+            auto &sycl_engine
+                    = *utils::downcast<nvidia::engine_t *>(engine());
+            auto sc = cuda_sycl_scoped_context_handler_t(sycl_engine);
+            CUDA_EXECUTE_FUNC(
+                    cuGraphLaunch, graph_exec, get_underlying_stream());
+        });
+    });
+}
+
 } // namespace nvidia
 } // namespace gpu
 } // namespace impl
@@ -87,6 +87,12 @@ public:
         return impl()->register_deps(cgh);
     }
 
+    status_t begin_graph_capture() override;
+    status_t end_graph_capture() override;
+    status_t replay_graph() override;
+
+    ~stream_t() override;
+
     status_t interop_task(std::function<void(::sycl::handler &)>);
     CUstream get_underlying_stream();
     CUcontext get_underlying_context();
@@ -100,6 +106,11 @@ private:
     status_t init();
     stream_t(impl::engine_t *engine, impl::stream_impl_t *stream_impl)
         : gpu::stream_t(engine, stream_impl) {}
+
+    // Graph capture state. The executable graph is kept between captures so
+    // that a re-capture with the same structure only updates it.
+    bool capturing_ = false;
+    CUgraphExec graph_exec_ = nullptr;
 };
 
 } // namespace nvidia
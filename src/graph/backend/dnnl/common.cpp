@@ -18,7 +18,9 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -620,6 +622,17 @@ size_t generate_constant_md_hash(
     return key;
 }
 
+dnnl::memory::desc get_packed_weights_md(
+        size_t key, const dnnl::memory::desc &md) {
+    static std::mutex mutex;
+    // Intentionally leaked to be usable while other static objects are
+    // destroyed.
+    static auto *packed_mds
+            = new std::unordered_map<size_t, dnnl::memory::desc>();
+    std::lock_guard<std::mutex> lock(mutex);
+    return packed_mds->emplace(key, md).first->second;
+}
+
 dnnl::accumulation_mode str2accumulation_mode(
         const std::string &accumulation_mode_str) {
     if (accumulation_mode_str == "strict") {
@@ -29,6 +29,7 @@
 #include "graph/interface/allocator.hpp"
 #include "graph/interface/constant_tensor_cache.hpp"
 #include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/op.hpp"
 #include "graph/interface/value.hpp"
 
 #include "graph/utils/any.hpp"
@@ -142,6 +143,43 @@ dnnl::accumulation_mode str2accumulation_mode(
 size_t generate_constant_md_hash(
         size_t part_id, const std::vector<dnnl::memory::desc> &const_mds);
 
+// Returns the layout constant weights identified by `key` were packed to by
+// the first primitive descriptor created for them in the process, recording
+// `md` if there is none yet.
+dnnl::memory::desc get_packed_weights_md(
+        size_t key, const dnnl::memory::desc &md);
+
+// Compiled partitions which differ only in the shapes of the activations,
+// e.g. in the batch size, may get different blocked layouts for the same
+// constant weights and then hold a copy of them per layout in the constant
+// tensor cache. This function returns a primitive descriptor for the layout
+// chosen by the first compilation instead of `pd` when the same
+// implementation accepts it, so that all such partitions share one packed
+// copy. `create_pd` creates a primitive descriptor with the given weights
+// memory descriptor and returns an empty one on failure.
+template <typename pd_t, typename create_pd_t>
+pd_t reuse_packed_weights_layout(
+        const op_t &op, const pd_t &pd, const create_pd_t &create_pd) {
+    const auto wei_lt = op.get_input_logical_tensor(1);
+    size_t key = 0;
+    key = hash_combine(key, static_cast<size_t>(op.get_kind()));
+    key = hash_combine(key, wei_lt.id);
+    key = hash_combine(key, static_cast<size_t>(wei_lt.data_type));
+    for (int d = 0; d < wei_lt.ndims; d++)
+        key = hash_combine(key, wei_lt.dims[d]);
+    key = hash_combine(key, std::string(pd.impl_info_str()));
+
+    const auto wei_md = pd.weights_desc();
+    const auto packed_md = get_packed_weights_md(key, wei_md);
+    if (packed_md == wei_md) return pd;
+
+    const pd_t packed_pd = create_pd(packed_md);
+    if (!packed_pd
+            || std::string(packed_pd.impl_info_str()) != pd.impl_info_str())
+        return pd;
+    return packed_pd;
+}
+
 // This function is mostly a copy-paste of public `dnnl_primitive_execute` but
 // doesn't have calls for hooks since this API is intended to be used in nested
 // parallelism scenario in sdp-decomposed kernels, and double
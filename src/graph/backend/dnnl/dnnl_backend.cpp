@@ -14,6 +14,7 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <algorithm>
 #include <utility>
 
 #include "graph/utils/any.hpp"
@@ -21,6 +22,7 @@
 
 #include "graph/backend/dnnl/dnnl_backend.hpp"
 #include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
 #include "graph/backend/dnnl/kernels/kernels.hpp"
 #include "graph/backend/dnnl/patterns/data_type_check_pass.hpp"
 #include "graph/backend/dnnl/patterns/fusions.hpp"
@@ -89,6 +91,37 @@ bool dnnl_backend_t::compare_logical_tensor(
     return md1 == md2;
 }
 
+status_t dnnl_backend_t::create_partition_impl(const std::string &pass_name,
+        engine_kind_t engine_kind, const fpmath_t &fpmath_mode,
+        partition_kind_t pkind, const std::vector<std::shared_ptr<op_t>> &ops,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs,
+        std::shared_ptr<partition_impl_t> &pimpl) const {
+    const auto &passes = pass_registry_.get_passes();
+    auto pass = std::find_if(passes.begin(), passes.end(),
+            [&](const pass::pass_base_ptr &p) {
+                return p->get_pass_name() == pass_name;
+            });
+    if (pass == passes.end() || !(*pass)->has_attr("FCreateKernel"))
+        return status::invalid_arguments;
+
+    auto dnnl_pimpl = std::make_shared<dnnl_partition_impl_t>(
+            engine_kind, fpmath_mode, pkind);
+    for (const auto &op : ops) {
+        dnnl_pimpl->add_op(op);
+        op->set_partition(dnnl_pimpl.get());
+    }
+    dnnl_pimpl->kernel_creator_
+            = (*pass)->get_attr<FCreateKernel>("FCreateKernel")[0];
+    dnnl_pimpl->pass_name_ = pass_name;
+    // The ops lost their consumers outside of the partition, so the inputs
+    // and outputs can't be found again from the ops.
+    dnnl_pimpl->inputs_ = inputs;
+    dnnl_pimpl->outputs_ = outputs;
+    pimpl = dnnl_pimpl;
+    return status::success;
+}
+
 graph::utils::optional_t<size_t> dnnl_backend_t::set_mem_desc(
         const memory::desc &md) {
     return layout_id_manager_.set_mem_desc(md);
@@ -91,6 +91,14 @@ public:
         return supported_kind.count(kind);
     }
 
+    status_t create_partition_impl(const std::string &pass_name,
+            engine_kind_t engine_kind, const fpmath_t &fpmath_mode,
+            partition_kind_t pkind,
+            const std::vector<std::shared_ptr<op_t>> &ops,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs,
+            std::shared_ptr<partition_impl_t> &pimpl) const override;
+
     status_t get_partitions(
             graph_t &agraph, partition_policy_t policy) override {
         // - priority == 50.f: data type check pass (fixed highest priority)
@@ -43,11 +43,13 @@ status_t get_ordered_inputs_outputs(
 }
 } // namespace
 
-void dnnl_partition_impl_t::init(FCreateKernel kernel_creator) {
+void dnnl_partition_impl_t::init(
+        FCreateKernel kernel_creator, const std::string &pass_name) {
     init_inputs_outputs();
 
     // init kernel
     kernel_creator_ = std::move(kernel_creator);
+    pass_name_ = pass_name;
 }
 
 void dnnl_partition_impl_t::add_op(const std::shared_ptr<op_t> &op) {
@@ -106,6 +108,7 @@ std::shared_ptr<partition_impl_t> dnnl_partition_impl_t::clone() const {
     ret->inputs_ = inputs_;
     ret->outputs_ = outputs_;
     ret->kernel_creator_ = kernel_creator_;
+    ret->pass_name_ = pass_name_;
     ret->id_ = id_;
     ret->can_use_blocked_layout_ = can_use_blocked_layout_;
     return ret;
@@ -84,6 +84,15 @@ public:
         return kernel_->get_scratchpad_size();
     }
 
+    status_t prepare_constants(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override {
+        const status_t ret
+                = kernel_->prepare_constants(g_stream, inputs, outputs);
+        // kernels without constant ops have nothing to prepare
+        return ret == status::unimplemented ? status::success : ret;
+    }
+
     std::string str() const override { return kernel_->str(); }
 
 private:
@@ -101,7 +110,8 @@ public:
     ~dnnl_partition_impl_t() override = default;
 
     ///// The following are used only in backend for constructing object
-    void init(FCreateKernel kernel_creator);
+    void init(FCreateKernel kernel_creator,
+            const std::string &pass_name = std::string());
     void add_op(const std::shared_ptr<op_t> &op);
 
     // init backend partition's input/output logical tensors
@@ -110,6 +120,8 @@ public:
 
     FCreateKernel get_kernel_creator() const;
 
+    std::string get_pass_name() const override { return pass_name_; }
+
     /////////////// the followings are the implementation of interface
 
     bool is_initialized() const override { return kernel_creator_ != nullptr; }
@@ -128,6 +140,9 @@ public:
 
 private:
     FCreateKernel kernel_creator_;
+    // Name of the pass which created the partition, empty for the partitions
+    // created by passes without a kernel creator of their own
+    std::string pass_name_;
 };
 
 } // namespace dnnl_impl
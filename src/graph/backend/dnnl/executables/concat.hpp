@@ -31,6 +31,12 @@ struct concat_executable_t : public op_executable_t {
     concat_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
             pd_cache_t &pd_cache, const fpmath_t &fpmath,
             bool use_block_layout) {
+        // the inputs are placed into the output buffer by the memory planner
+        if (op->has_attr(op_attr::is_zero_copy)
+                && op->get_attr<bool>(op_attr::is_zero_copy)) {
+            is_zero_copy_ = true;
+            return;
+        }
         auto desc
                 = create_desc(op, p_engine, pd_cache, fpmath, use_block_layout);
         prim_ = dnnl::concat(desc);
@@ -38,6 +44,7 @@ struct concat_executable_t : public op_executable_t {
 
     void execute(const stream &stream,
             const std::unordered_map<int, memory> &args) const override {
+        if (is_zero_copy_) return;
         prim_.execute(stream, args);
     }
 
@@ -60,10 +67,13 @@ struct concat_executable_t : public op_executable_t {
     }
 #endif
 
-    bool is_initialized() const override { return bool(prim_); }
+    bool is_initialized() const override {
+        return is_zero_copy_ || bool(prim_);
+    }
 
 private:
     dnnl::concat prim_;
+    bool is_zero_copy_ = false;
 };
 
 } // namespace dnnl_impl
@@ -14,6 +14,7 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
 #include "graph/backend/dnnl/executables/conv.hpp"
 
 namespace dnnl {
@@ -228,18 +229,21 @@ conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
     }
     auto dst = make_dnnl_memory_desc(base_conv_dst_lt);
     auto create_pd = [&](const dnnl::memory::desc &src_md,
-                             const dnnl::memory::desc &dst_md) {
+                             const dnnl::memory::desc &dst_md,
+                             bool allow_empty = false) {
         if (op->has_attr(op_attr::with_bias)
                 && op->get_attr<bool>(op_attr::with_bias)) {
             auto bias = make_dnnl_memory_desc(op->get_input_logical_tensor(2));
             bias = to_format_any(bias);
             return dnnl::convolution_forward::primitive_desc(p_engine, pkind,
                     algorithm::convolution_direct, src_md, weight, bias, dst_md,
-                    strides, dilates, pads_begin, pads_end, prm_attr);
+                    strides, dilates, pads_begin, pads_end, prm_attr,
+                    allow_empty);
         } else {
             return dnnl::convolution_forward::primitive_desc(p_engine, pkind,
                     algorithm::convolution_direct, src_md, weight, dst_md,
-                    strides, dilates, pads_begin, pads_end, prm_attr);
+                    strides, dilates, pads_begin, pads_end, prm_attr,
+                    allow_empty);
         }
     };
 
@@ -282,6 +286,14 @@ conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
     }
 
     dnnl::convolution_forward::primitive_desc pd = create_pd(src, dst);
+    if (use_block_layout && pkind == prop_kind::forward_inference
+            && is_constant_cache_enabled(p_engine)) {
+        pd = reuse_packed_weights_layout(*op, pd,
+                [&](const dnnl::memory::desc &md) {
+                    weight = md;
+                    return create_pd(src, dst, true);
+                });
+    }
 
     pd_cache.insert({op.get(), pd});
 
@@ -406,14 +418,24 @@ conv_bwd_weights_executable_t::create_desc(std::shared_ptr<op_t> &op,
     auto diff_weight = make_dnnl_memory_desc(op->get_output_logical_tensor(0));
     diff_weight = to_format_any(diff_weight);
 
+    // the bias gradient is reduced from diff_dst by the same primitive
+    const bool with_bias = op->has_attr(op_attr::with_bias)
+            && op->get_attr<bool>(op_attr::with_bias);
+    dnnl::memory::desc diff_bias;
+    if (with_bias) {
+        diff_bias = make_dnnl_memory_desc(op->get_output_logical_tensor(1));
+        diff_bias = to_format_any(diff_bias);
+    }
+
     auto fwd_hints = dnnl::convolution_forward::primitive_desc(p_engine,
             dnnl::prop_kind::forward_training,
-            dnnl::algorithm::convolution_direct, src, diff_weight, diff_dst,
-            strides, dilates, pads_begin, pads_end, prm_attr);
+            dnnl::algorithm::convolution_direct, src, diff_weight, diff_bias,
+            diff_dst, strides, dilates, pads_begin, pads_end, prm_attr);
 
     dnnl::convolution_backward_weights::primitive_desc pd(p_engine,
-            dnnl::algorithm::convolution_direct, src, diff_weight, diff_dst,
-            strides, dilates, pads_begin, pads_end, fwd_hints, prm_attr);
+            dnnl::algorithm::convolution_direct, src, diff_weight, diff_bias,
+            diff_dst, strides, dilates, pads_begin, pads_end, fwd_hints,
+            prm_attr);
 
     pd_cache.insert({op.get(), pd});
 
@@ -421,7 +443,6 @@ conv_bwd_weights_executable_t::create_desc(std::shared_ptr<op_t> &op,
 }
 
 arg_indices_t conv_bwd_weights_executable_t::get_arg_indices(const op_t *op) {
-    UNUSED(op);
     arg_indices_t args;
 
     // inputs
@@ -429,8 +450,13 @@ arg_indices_t conv_bwd_weights_executable_t::get_arg_indices(const op_t *op) {
     args.insert({DNNL_ARG_DIFF_DST, {indices_t::type_t::input, 1}});
 
     // outputs
-    args.insert({DNNL_ARG_DIFF_WEIGHTS, {indices_t::type_t::output, 0}});
-    args.insert({DNNL_ARG_SCRATCHPAD, {indices_t::type_t::output, 1}});
+    size_t index = 0;
+    args.insert({DNNL_ARG_DIFF_WEIGHTS, {indices_t::type_t::output, index++}});
+    if (op->has_attr(op_attr::with_bias)
+            && op->get_attr<bool>(op_attr::with_bias)) {
+        args.insert({DNNL_ARG_DIFF_BIAS, {indices_t::type_t::output, index++}});
+    }
+    args.insert({DNNL_ARG_SCRATCHPAD, {indices_t::type_t::output, index++}});
 
     return args;
 }
@@ -14,8 +14,16 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <cmath>
+
 #include "graph/backend/dnnl/executables/layer_norm.hpp"
 
+#include "common/compiler_workarounds.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/stream.hpp"
+
+#include "cpu/simple_q10n.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace graph {
@@ -158,6 +166,181 @@ arg_indices_t layernorm_bwd_executable_t::get_arg_indices(const op_t *op) {
     return args;
 }
 
+residual_layernorm_executable_t::residual_layernorm_executable_t(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        pd_cache_t &pd_cache, const fpmath_t &fpmath, bool use_block_layout) {
+    UNUSED(pd_cache);
+    UNUSED(fpmath);
+    UNUSED(use_block_layout);
+    using ltw = logical_tensor_wrapper_t;
+    const auto src_lt = ltw(op->get_input_logical_tensor(0));
+    ncols_ = src_lt.vdims().back();
+    nrows_ = ncols_ == 0 ? 0 : src_lt.nelems() / ncols_;
+    src_dt_ = src_lt.data_type();
+    dst_dt_ = op->get_output_logical_tensor(0).data_type;
+
+    if (op->has_attr(op_attr::epsilon))
+        epsilon_ = op->get_attr<float>(op_attr::epsilon);
+    if (op->has_attr(op_attr::is_rms))
+        is_rms_ = op->get_attr<bool>(op_attr::is_rms);
+    use_scale_ = op->num_inputs() > 2;
+    use_shift_ = op->num_inputs() > 3;
+    if (op->has_attr(op_attr::scales))
+        scale_ = op->get_attr<std::vector<float>>(op_attr::scales)[0];
+    if (op->has_attr(op_attr::zps))
+        zp_ = static_cast<float>(
+                op->get_attr<std::vector<int64_t>>(op_attr::zps)[0]);
+
+    info_ = std::string(dnnl_engine_kind2str(
+                    static_cast<dnnl_engine_kind_t>(p_engine.get_kind())))
+            + "," + op->str();
+}
+
+template <data_type_t src_dt, data_type_t dst_dt>
+void residual_layernorm_executable_t::execute_impl(
+        const std::unordered_map<int, memory> &args) const {
+    using src_t = typename prec_traits_t<src_dt>::type;
+    using dst_t = typename prec_traits_t<dst_dt>::type;
+
+    const auto *src = static_cast<const src_t *>(
+            args.at(DNNL_ARG_SRC_0).get_data_handle());
+    const auto *res = static_cast<const src_t *>(
+            args.at(DNNL_ARG_SRC_1).get_data_handle());
+    auto *dst = static_cast<dst_t *>(args.at(DNNL_ARG_DST).get_data_handle());
+    auto *res_dst = static_cast<src_t *>(
+            args.at(DNNL_ARG_DST_1).get_data_handle());
+    const float *gamma = use_scale_ ? static_cast<const float *>(
+                                 args.at(DNNL_ARG_SCALE).get_data_handle())
+                                    : nullptr;
+    const float *beta = use_shift_ ? static_cast<const float *>(
+                                args.at(DNNL_ARG_SHIFT).get_data_handle())
+                                   : nullptr;
+
+    const dim_t C = ncols_;
+    // The sum is stored to the residual output first and read back while the
+    // row is still in cache, so the statistics and the normalization see the
+    // same rounded values as a separate Add would produce.
+    dnnl::impl::parallel_nd(nrows_, [= COMPAT_THIS_CAPTURE](dim_t r) {
+        const src_t *s = src + r * C;
+        const src_t *x = res + r * C;
+        src_t *rd = res_dst + r * C;
+        dst_t *d = dst + r * C;
+
+        float sum = 0.f, sum_sq = 0.f;
+        for (dim_t c = 0; c < C; ++c) {
+            rd[c] = static_cast<src_t>(
+                    static_cast<float>(s[c]) + static_cast<float>(x[c]));
+            const float v = static_cast<float>(rd[c]);
+            sum += v;
+            sum_sq += v * v;
+        }
+
+        float mean = 0.f, variance = 0.f;
+        if (is_rms_) {
+            variance = sum_sq / C;
+        } else {
+            mean = sum / C;
+            for (dim_t c = 0; c < C; ++c) {
+                const float v = static_cast<float>(rd[c]) - mean;
+                variance += v * v;
+            }
+            variance /= C;
+        }
+        const float inv_sqrtvar = 1.f / std::sqrt(variance + epsilon_);
+
+        for (dim_t c = 0; c < C; ++c) {
+            float v = (static_cast<float>(rd[c]) - mean) * inv_sqrtvar;
+            if (gamma) v *= gamma[c];
+            if (beta) v += beta[c];
+            d[c] = cpu::q10n::saturate_and_round<dst_t>(v * scale_ + zp_);
+        }
+    });
+}
+
+void residual_layernorm_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const bool with_profile = get_verbose(dnnl::impl::verbose_t::exec_profile,
+            dnnl::impl::component_t::graph);
+    double start_ms = 0.0;
+    if (with_profile) {
+        stream.get()->wait();
+        start_ms = dnnl::impl::get_msec();
+    }
+
+    stream.get()->before_exec_hook();
+#define CASE(sdt, ddt) \
+    if (src_dt_ == graph::data_type::sdt && dst_dt_ == graph::data_type::ddt) \
+        execute_impl<graph::data_type::sdt, graph::data_type::ddt>(args);
+#define DST_CASES(sdt) \
+    CASE(sdt, f32) \
+    CASE(sdt, bf16) \
+    CASE(sdt, f16) \
+    CASE(sdt, s8) \
+    CASE(sdt, u8) \
+    CASE(sdt, f8_e5m2) \
+    CASE(sdt, f8_e4m3)
+    DST_CASES(f32)
+    DST_CASES(bf16)
+    DST_CASES(f16)
+#undef DST_CASES
+#undef CASE
+    stream.get()->after_exec_hook();
+
+    if (with_profile) {
+        stream.get()->wait();
+        double duration_ms = dnnl::impl::get_msec() - start_ms;
+        VPROF(start_ms, graph, exec, VERBOSE_profile, info_.c_str(),
+                duration_ms);
+    }
+}
+
+#ifdef DNNL_WITH_SYCL
+std::optional<::sycl::event> residual_layernorm_executable_t::execute_sycl(
+        const stream &stream, const std::unordered_map<int, memory> &args,
+        const std::vector<::sycl::event> &deps) const {
+    assertm(stream.get_engine().get_kind() == engine::kind::cpu,
+            "residual layernorm is only implemented for CPU");
+    auto strm_t = stream.get();
+    auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+            dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+    strm_t->before_exec_hook();
+    if (!deps.empty()) { sycl_stream_impl->sycl_ctx().set_deps(deps); }
+
+    execute(stream, args);
+
+    ::sycl::event return_event = sycl_stream_impl->get_output_event();
+    strm_t->after_exec_hook();
+    return return_event;
+}
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+cl_event residual_layernorm_executable_t::execute_ocl(const stream &stream,
+        const std::unordered_map<int, memory> &args,
+        const std::vector<cl_event> &deps) const {
+    UNUSED(stream);
+    UNUSED(args);
+    UNUSED(deps);
+    assertm(false, "residual layernorm is only implemented for CPU");
+    throw std::runtime_error("Unimplement");
+}
+#endif
+
+arg_indices_t residual_layernorm_executable_t::get_arg_indices(
+        const op_t *op) {
+    arg_indices_t args;
+    args.insert({DNNL_ARG_SRC_0, {indices_t::type_t::input, 0}});
+    args.insert({DNNL_ARG_SRC_1, {indices_t::type_t::input, 1}});
+    if (op->num_inputs() > 2)
+        args.insert({DNNL_ARG_SCALE, {indices_t::type_t::input, 2}});
+    if (op->num_inputs() > 3)
+        args.insert({DNNL_ARG_SHIFT, {indices_t::type_t::input, 3}});
+    args.insert({DNNL_ARG_DST, {indices_t::type_t::output, 0}});
+    args.insert({DNNL_ARG_DST_1, {indices_t::type_t::output, 1}});
+    return args;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
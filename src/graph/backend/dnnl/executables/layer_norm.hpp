@@ -17,6 +17,8 @@
 #ifndef GRAPH_BACKEND_DNNL_EXECUTABLES_LAYER_NORM_HPP
 #define GRAPH_BACKEND_DNNL_EXECUTABLES_LAYER_NORM_HPP
 
+#include <string>
+
 #include "graph/backend/dnnl/executables/base.hpp"
 
 namespace dnnl {
@@ -110,6 +112,51 @@ private:
     dnnl::layer_normalization_backward prim_;
 };
 
+// Computes `residual_output = input + residual` and the LayerNorm or RMSNorm
+// of the sum over the last axis in a single pass over each row, optionally
+// followed by a per-tensor quantization of the normalized output. Only CPU
+// engines and dense plain layouts are supported.
+struct residual_layernorm_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    residual_layernorm_executable_t(std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+            const fpmath_t &fpmath, bool use_block_layout);
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override;
+
+#ifdef DNNL_WITH_SYCL
+    std::optional<::sycl::event> execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override;
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override;
+#endif
+
+    bool is_initialized() const override { return true; }
+
+private:
+    template <data_type_t src_dt, data_type_t dst_dt>
+    void execute_impl(const std::unordered_map<int, memory> &args) const;
+
+    dim_t nrows_ = 0;
+    dim_t ncols_ = 0;
+    float epsilon_ = 1e-5f;
+    bool is_rms_ = false;
+    bool use_scale_ = false;
+    bool use_shift_ = false;
+    float scale_ = 1.f;
+    float zp_ = 0.f;
+    data_type_t src_dt_ = graph::data_type::undef;
+    data_type_t dst_dt_ = graph::data_type::undef;
+    std::string info_;
+};
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
@@ -199,15 +199,25 @@ matmul_executable_t::desc_t matmul_executable_t::create_desc(
         // 2) It is the partition output and defined by user
         dst = to_ncx_format(dst);
     }
-    dnnl::matmul::primitive_desc pd;
-    if (op->has_attr(op_attr::with_bias)
-            && op->get_attr<bool>(op_attr::with_bias)) {
-        auto bias = make_dnnl_memory_desc(op->get_input_logical_tensor(2));
-        bias = to_format_any(bias);
-        pd = dnnl::matmul::primitive_desc(
-                p_engine, src, wei, bias, dst, prm_attr);
-    } else {
-        pd = dnnl::matmul::primitive_desc(p_engine, src, wei, dst, prm_attr);
+    auto create_pd = [&](const dnnl::memory::desc &wei_md,
+                             bool allow_empty) {
+        if (op->has_attr(op_attr::with_bias)
+                && op->get_attr<bool>(op_attr::with_bias)) {
+            auto bias = make_dnnl_memory_desc(op->get_input_logical_tensor(2));
+            bias = to_format_any(bias);
+            return dnnl::matmul::primitive_desc(p_engine, src, wei_md, bias,
+                    dst, prm_attr, allow_empty);
+        } else {
+            return dnnl::matmul::primitive_desc(
+                    p_engine, src, wei_md, dst, prm_attr, allow_empty);
+        }
+    };
+    dnnl::matmul::primitive_desc pd = create_pd(wei, false);
+    if (use_block_layout && const_weight) {
+        pd = reuse_packed_weights_layout(*op, pd,
+                [&](const dnnl::memory::desc &md) {
+                    return create_pd(md, true);
+                });
     }
 
     pd_cache.insert({op.get(), pd});
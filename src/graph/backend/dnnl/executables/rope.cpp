@@ -0,0 +1,226 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/executables/rope.hpp"
+
+#include "common/compiler_workarounds.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/stream.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+
+template <data_type_t src_dt, data_type_t cs_dt>
+void rope_fwd_row_impl(const rope_conf_t &conf, const void *src_ptr,
+        dim_t src_stride, const void *cos_ptr, dim_t cos_stride,
+        const void *sin_ptr, dim_t sin_stride, void *dst_ptr,
+        dim_t dst_stride) {
+    using src_t = typename prec_traits_t<src_dt>::type;
+    using cs_t = typename prec_traits_t<cs_dt>::type;
+    const auto *src = static_cast<const src_t *>(src_ptr);
+    const auto *cos = static_cast<const cs_t *>(cos_ptr);
+    const auto *sin = static_cast<const cs_t *>(sin_ptr);
+    auto *dst = static_cast<src_t *>(dst_ptr);
+
+    const dim_t half = conf.head_size / 2;
+    for (dim_t j = 0; j < half; ++j) {
+        const dim_t i0 = conf.interleaved ? 2 * j : j;
+        const dim_t i1 = conf.interleaved ? 2 * j + 1 : j + half;
+        // both elements are read first as dst may alias src
+        const float x0 = static_cast<float>(src[i0 * src_stride]);
+        const float x1 = static_cast<float>(src[i1 * src_stride]);
+        dst[i0 * dst_stride] = static_cast<src_t>(
+                x0 * static_cast<float>(cos[i0 * cos_stride])
+                - x1 * static_cast<float>(sin[i0 * sin_stride]));
+        dst[i1 * dst_stride] = static_cast<src_t>(
+                x1 * static_cast<float>(cos[i1 * cos_stride])
+                + x0 * static_cast<float>(sin[i1 * sin_stride]));
+    }
+}
+
+} // namespace
+
+void rope_fwd_row(const rope_conf_t &conf, const void *src, dim_t src_stride,
+        const void *cos, dim_t cos_stride, const void *sin, dim_t sin_stride,
+        void *dst, dim_t dst_stride) {
+#define CASE(sdt, cdt) \
+    if (conf.src_dt == graph::data_type::sdt \
+            && conf.cs_dt == graph::data_type::cdt) \
+        return rope_fwd_row_impl<graph::data_type::sdt, \
+                graph::data_type::cdt>(conf, src, src_stride, cos, \
+                cos_stride, sin, sin_stride, dst, dst_stride);
+    CASE(f32, f32)
+    CASE(bf16, bf16)
+    CASE(bf16, f32)
+    CASE(f16, f16)
+    CASE(f16, f32)
+#undef CASE
+    assertm(false, "unsupported data types for rope");
+}
+
+rope_executable_t::rope_executable_t(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout) {
+    UNUSED(pd_cache);
+    UNUSED(fpmath);
+    UNUSED(use_block_layout);
+    using ltw = logical_tensor_wrapper_t;
+    const auto src_lt = ltw(op->get_input_logical_tensor(0));
+    const auto cos_lt = ltw(op->get_input_logical_tensor(1));
+    const auto sin_lt = ltw(op->get_input_logical_tensor(2));
+    const auto dst_lt = ltw(op->get_output_logical_tensor(0));
+
+    ndims_ = src_lt.ndims();
+    const auto src_dims = src_lt.vdims();
+    const auto src_strides = src_lt.vstrides();
+    const auto dst_strides = dst_lt.vstrides();
+    for (int d = 0; d < ndims_; ++d) {
+        dims_[d] = src_dims[d];
+        src_strides_[d] = src_strides[d];
+        dst_strides_[d] = dst_strides[d];
+    }
+
+    // cos and sin are aligned to the trailing dimensions of src
+    const auto cs_dims = cos_lt.vdims();
+    const auto cos_strides = cos_lt.vstrides();
+    const auto sin_strides = sin_lt.vstrides();
+    const int cs_offset = ndims_ - cos_lt.ndims();
+    for (int d = cs_offset; d < ndims_; ++d) {
+        if (cs_dims[d - cs_offset] == 1 && dims_[d] != 1) continue;
+        cos_strides_[d] = cos_strides[d - cs_offset];
+        sin_strides_[d] = sin_strides[d - cs_offset];
+    }
+
+    conf_.src_dt = src_lt.data_type();
+    conf_.cs_dt = cos_lt.data_type();
+    conf_.head_size = src_dims.back();
+    conf_.interleaved = op->has_attr(op_attr::mode)
+            && op->get_attr<std::string>(op_attr::mode) == "interleaved";
+
+    info_ = std::string(dnnl_engine_kind2str(
+                    static_cast<dnnl_engine_kind_t>(p_engine.get_kind())))
+            + "," + op->str();
+}
+
+void rope_executable_t::execute_impl(
+        const std::unordered_map<int, memory> &args) const {
+    const auto *src = static_cast<const char *>(
+            args.at(DNNL_ARG_SRC_0).get_data_handle());
+    const auto *cos = static_cast<const char *>(
+            args.at(DNNL_ARG_SRC_1).get_data_handle());
+    const auto *sin = static_cast<const char *>(
+            args.at(DNNL_ARG_SRC_2).get_data_handle());
+    auto *dst = static_cast<char *>(args.at(DNNL_ARG_DST).get_data_handle());
+
+    const size_t src_dt_size = types::data_type_size(conf_.src_dt);
+    const size_t cs_dt_size = types::data_type_size(conf_.cs_dt);
+    const int last = ndims_ - 1;
+    dim_t nrows = 1;
+    for (int d = 0; d < last; ++d)
+        nrows *= dims_[d];
+
+    dnnl::impl::parallel_nd(nrows, [= COMPAT_THIS_CAPTURE](dim_t r) {
+        dim_t src_off = 0, dst_off = 0, cos_off = 0, sin_off = 0;
+        for (int d = last - 1; d >= 0; --d) {
+            const dim_t idx = r % dims_[d];
+            r /= dims_[d];
+            src_off += idx * src_strides_[d];
+            dst_off += idx * dst_strides_[d];
+            cos_off += idx * cos_strides_[d];
+            sin_off += idx * sin_strides_[d];
+        }
+        rope_fwd_row(conf_, src + src_off * src_dt_size, src_strides_[last],
+                cos + cos_off * cs_dt_size, cos_strides_[last],
+                sin + sin_off * cs_dt_size, sin_strides_[last],
+                dst + dst_off * src_dt_size, dst_strides_[last]);
+    });
+}
+
+void rope_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const bool with_profile = get_verbose(dnnl::impl::verbose_t::exec_profile,
+            dnnl::impl::component_t::graph);
+    double start_ms = 0.0;
+    if (with_profile) {
+        stream.get()->wait();
+        start_ms = dnnl::impl::get_msec();
+    }
+
+    stream.get()->before_exec_hook();
+    execute_impl(args);
+    stream.get()->after_exec_hook();
+
+    if (with_profile) {
+        stream.get()->wait();
+        double duration_ms = dnnl::impl::get_msec() - start_ms;
+        VPROF(start_ms, graph, exec, VERBOSE_profile, info_.c_str(),
+                duration_ms);
+    }
+}
+
+#ifdef DNNL_WITH_SYCL
+std::optional<::sycl::event> rope_executable_t::execute_sycl(
+        const stream &stream, const std::unordered_map<int, memory> &args,
+        const std::vector<::sycl::event> &deps) const {
+    assertm(stream.get_engine().get_kind() == engine::kind::cpu,
+            "rope is only implemented for CPU");
+    auto strm_t = stream.get();
+    auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+            dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+    strm_t->before_exec_hook();
+    if (!deps.empty()) { sycl_stream_impl->sycl_ctx().set_deps(deps); }
+
+    execute(stream, args);
+
+    ::sycl::event return_event = sycl_stream_impl->get_output_event();
+    strm_t->after_exec_hook();
+    return return_event;
+}
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+cl_event rope_executable_t::execute_ocl(const stream &stream,
+        const std::unordered_map<int, memory> &args,
+        const std::vector<cl_event> &deps) const {
+    UNUSED(stream);
+    UNUSED(args);
+    UNUSED(deps);
+    assertm(false, "rope is only implemented for CPU");
+    throw std::runtime_error("Unimplement");
+}
+#endif
+
+arg_indices_t rope_executable_t::get_arg_indices(const op_t *op) {
+    UNUSED(op);
+    arg_indices_t args;
+    args.insert({DNNL_ARG_SRC_0, {indices_t::type_t::input, 0}});
+    args.insert({DNNL_ARG_SRC_1, {indices_t::type_t::input, 1}});
+    args.insert({DNNL_ARG_SRC_2, {indices_t::type_t::input, 2}});
+    args.insert({DNNL_ARG_DST, {indices_t::type_t::output, 0}});
+    return args;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_EXECUTABLES_ROPE_HPP
+#define GRAPH_BACKEND_DNNL_EXECUTABLES_ROPE_HPP
+
+#include <string>
+
+#include "graph/backend/dnnl/executables/base.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Describes the rotation of the rows of a RoPE input. A row is the last
+// dimension of the input, of head_size elements. The rotated pairs are the
+// two halves of the row for the rotate_half mode and the adjacent elements
+// for the interleaved mode.
+struct rope_conf_t {
+    data_type_t src_dt = graph::data_type::undef;
+    data_type_t cs_dt = graph::data_type::undef;
+    dim_t head_size = 0;
+    bool interleaved = false;
+};
+
+// Rotates one row. The row of dst is of the src data type and may alias the
+// src row. Strides are in elements.
+void rope_fwd_row(const rope_conf_t &conf, const void *src, dim_t src_stride,
+        const void *cos, dim_t cos_stride, const void *sin, dim_t sin_stride,
+        void *dst, dim_t dst_stride);
+
+struct rope_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    rope_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            pd_cache_t &pd_cache, const fpmath_t &fpmath,
+            bool use_block_layout);
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override;
+
+#ifdef DNNL_WITH_SYCL
+    std::optional<::sycl::event> execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override;
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override;
+#endif
+
+    bool is_initialized() const override { return true; }
+
+private:
+    void execute_impl(const std::unordered_map<int, memory> &args) const;
+
+    rope_conf_t conf_;
+    int ndims_ = 0;
+    dims_t dims_ {}, src_strides_ {}, dst_strides_ {};
+    // aligned to the src dimensions, 0 for the broadcast ones
+    dims_t cos_strides_ {}, sin_strides_ {};
+    std::string info_;
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif // GRAPH_BACKEND_DNNL_EXECUTABLES_ROPE_HPP
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
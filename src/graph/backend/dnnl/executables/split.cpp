@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/executables/split.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+split_executable_t::split_executable_t(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout) {
+    UNUSED(pd_cache);
+    UNUSED(fpmath);
+    UNUSED(use_block_layout);
+
+    // the outputs are placed into the input buffer by the memory planner
+    if (op->has_attr(op_attr::is_zero_copy)
+            && op->get_attr<bool>(op_attr::is_zero_copy)) {
+        is_zero_copy_ = true;
+        return;
+    }
+
+    const auto src_md = make_dnnl_memory_desc(op->get_input_logical_tensor(0));
+    const int ndims = src_md.get_ndims();
+    int64_t axis = op->get_attr<int64_t>(op_attr::axis);
+    if (axis < 0) axis += ndims;
+
+    memory::dims offsets(ndims, 0);
+    for (size_t i = 0; i < op->num_outputs(); ++i) {
+        const auto dst_md
+                = make_dnnl_memory_desc(op->get_output_logical_tensor(i));
+        sub_mds_.emplace_back(
+                src_md.submemory_desc(dst_md.get_dims(), offsets));
+        prims_.emplace_back(dnnl::reorder::primitive_desc(
+                p_engine, sub_mds_.back(), p_engine, dst_md));
+        offsets[axis] += dst_md.get_dims()[axis];
+    }
+}
+
+void split_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    if (is_zero_copy_) return;
+    const memory &src = args.at(DNNL_ARG_FROM);
+    for (size_t i = 0; i < prims_.size(); ++i) {
+        memory sub_src(
+                sub_mds_[i], stream.get_engine(), src.get_data_handle());
+        prims_[i].execute(stream,
+                {{DNNL_ARG_FROM, sub_src},
+                        {DNNL_ARG_TO,
+                                args.at(DNNL_ARG_MULTIPLE_DST
+                                        + static_cast<int>(i))}});
+    }
+}
+
+#ifdef DNNL_WITH_SYCL
+std::optional<::sycl::event> split_executable_t::execute_sycl(
+        const stream &stream, const std::unordered_map<int, memory> &args,
+        const std::vector<::sycl::event> &deps) const {
+    const memory &src = args.at(DNNL_ARG_FROM);
+    auto sycl_deps = deps;
+    for (size_t i = 0; i < prims_.size(); ++i) {
+        memory sub_src(
+                sub_mds_[i], stream.get_engine(), src.get_data_handle());
+        auto e = dnnl::sycl_interop::execute(prims_[i], stream,
+                {{DNNL_ARG_FROM, sub_src},
+                        {DNNL_ARG_TO,
+                                args.at(DNNL_ARG_MULTIPLE_DST
+                                        + static_cast<int>(i))}},
+                sycl_deps);
+        sycl_deps = {e};
+    }
+    if (stream.get_engine().get_kind() == engine::kind::cpu)
+        sycl_deps.back().wait();
+    return sycl_deps.back();
+}
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+cl_event split_executable_t::execute_ocl(const stream &stream,
+        const std::unordered_map<int, memory> &args,
+        const std::vector<cl_event> &deps) const {
+    UNUSED(stream);
+    UNUSED(args);
+    UNUSED(deps);
+    assertm(false, "split is only implemented for CPU");
+    throw std::runtime_error("Unimplement");
+}
+#endif
+
+arg_indices_t split_executable_t::get_arg_indices(const op_t *op) {
+    arg_indices_t args;
+    args.insert({DNNL_ARG_FROM, {indices_t::type_t::input, 0}});
+    for (size_t i = 0; i < op->num_outputs(); ++i) {
+        args.insert({DNNL_ARG_MULTIPLE_DST + static_cast<int>(i),
+                {indices_t::type_t::output, i}});
+    }
+    return args;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
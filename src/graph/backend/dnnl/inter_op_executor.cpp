@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+
+#include "graph/backend/dnnl/inter_op_executor.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+scoped_num_threads_t::scoped_num_threads_t(int nthr) {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    if (nthr <= 0) return;
+    saved_nthr_ = omp_get_max_threads();
+    omp_set_num_threads(nthr);
+#else
+    UNUSED(nthr);
+#endif
+}
+
+scoped_num_threads_t::~scoped_num_threads_t() {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    if (saved_nthr_ > 0) omp_set_num_threads(saved_nthr_);
+#endif
+}
+
+inter_op_executor_t::inter_op_executor_t(size_t nworkers)
+    : errors_(nworkers + 1) {
+    workers_.reserve(nworkers);
+    for (size_t i = 0; i < nworkers; i++)
+        workers_.emplace_back([this, i]() { worker_loop(i); });
+}
+
+inter_op_executor_t::~inter_op_executor_t() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto &w : workers_)
+        w.join();
+}
+
+void inter_op_executor_t::worker_loop(size_t iworker) {
+    size_t seen_generation = 0;
+    while (true) {
+        const std::function<void(size_t)> *task = nullptr;
+        size_t itask = iworker + 1;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_cv_.wait(lock, [&]() {
+                return stop_ || generation_ != seen_generation;
+            });
+            if (stop_) return;
+            seen_generation = generation_;
+            if (itask >= ntasks_) continue;
+            task = task_;
+        }
+
+        try {
+            (*task)(itask);
+        } catch (...) { errors_[itask] = std::current_exception(); }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--pending_ == 0) done_cv_.notify_one();
+    }
+}
+
+void inter_op_executor_t::run(
+        size_t ntasks, const std::function<void(size_t)> &task) {
+    assertm(ntasks <= workers_.size() + 1, "too many tasks");
+    if (ntasks == 0) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        ntasks_ = ntasks;
+        pending_ = ntasks - 1;
+        generation_++;
+        for (auto &e : errors_)
+            e = nullptr;
+    }
+    if (ntasks > 1) start_cv_.notify_all();
+
+    try {
+        task(0);
+    } catch (...) { errors_[0] = std::current_exception(); }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [&]() { return pending_ == 0; });
+        task_ = nullptr;
+    }
+
+    for (const auto &e : errors_)
+        if (e) std::rethrow_exception(e);
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_INTER_OP_EXECUTOR_HPP
+#define GRAPH_BACKEND_DNNL_INTER_OP_EXECUTOR_HPP
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/utils.hpp"
+
+#include "graph/utils/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Sets the number of threads used by the parallel regions of the calling
+// thread for the lifetime of the object. A non-positive number of threads
+// keeps the current setting. Only has an effect with the OpenMP runtime.
+class scoped_num_threads_t {
+public:
+    explicit scoped_num_threads_t(int nthr);
+    ~scoped_num_threads_t();
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scoped_num_threads_t)
+
+private:
+    int saved_nthr_ = 0;
+};
+
+// A fixed set of worker threads that run the concurrent ops of an inter-op
+// schedule. The workers are kept alive between executions, so that the thread
+// teams they own stay warm. The executor runs one set of tasks at a time, the
+// callers should use try_lock() and run the tasks by themselves if it fails.
+class inter_op_executor_t {
+public:
+    explicit inter_op_executor_t(size_t nworkers);
+    ~inter_op_executor_t();
+
+    bool try_lock() { return run_mutex_.try_lock(); }
+    void unlock() { run_mutex_.unlock(); }
+
+    // Runs task(i) for i in [0, ntasks), task(0) on the calling thread and the
+    // others on the workers, and returns once all of them are done. ntasks
+    // must not exceed the number of workers plus one. Exceptions thrown by the
+    // tasks are rethrown in the calling thread.
+    void run(size_t ntasks, const std::function<void(size_t)> &task);
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(inter_op_executor_t)
+
+private:
+    void worker_loop(size_t iworker);
+
+    std::vector<std::thread> workers_;
+    std::mutex run_mutex_;
+
+    std::mutex mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    // the tasks of the current run, protected by mutex_
+    const std::function<void(size_t)> *task_ = nullptr;
+    size_t ntasks_ = 0;
+    size_t generation_ = 0;
+    size_t pending_ = 0;
+    bool stop_ = false;
+    std::vector<std::exception_ptr> errors_;
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
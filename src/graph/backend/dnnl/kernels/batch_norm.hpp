@@ -93,6 +93,7 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(batch_norm_fwd_t)
+    DEF_KERNEL_METHOD_PREPARE_CONSTANTS()
     DEF_KERNEL_METHOD_SCRATCHPAD_SIZE()
     DNNL_DISALLOW_COPY_AND_ASSIGN(batch_norm_fwd_t)
 };
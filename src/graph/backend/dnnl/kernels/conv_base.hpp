@@ -89,6 +89,7 @@ public:
             cl_event *ocl_event) override;
 #endif
 
+    DEF_KERNEL_METHOD_PREPARE_CONSTANTS()
     DNNL_DISALLOW_COPY_AND_ASSIGN(conv_base_t)
 };
 
@@ -103,6 +103,7 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(eltwise_fwd_t)
+    DEF_KERNEL_METHOD_PREPARE_CONSTANTS()
     DEF_KERNEL_METHOD_SCRATCHPAD_SIZE()
     DNNL_DISALLOW_COPY_AND_ASSIGN(eltwise_fwd_t)
 };
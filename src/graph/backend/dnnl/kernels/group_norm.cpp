@@ -151,37 +151,47 @@ status_t group_norm_fwd_t::execute_impl(const stream_t *g_stream,
         if (is_from_cache) {
             c_buffer = cached_value.get();
             grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
-                    c_buffer->data<char>());
+                    acquire_constant_buffer(c_buffer));
             for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
                 mem_offkey.first.set_data_handle(
                         c_grantor.get(mem_offkey.second));
             }
         } else {
-            c_buffer = std::make_shared<dnnl_constant_buffer_t>(
-                    memory_planner_.total_internal_persistent_size(), p_engine_,
-                    g_alloc_);
+            c_buffer = create_constant_buffer(inputs,
+                    memory_planner_.total_internal_persistent_size(), g_alloc_);
             grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
-                    c_buffer->data<char>());
+                    acquire_constant_buffer(c_buffer));
             for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
                 mem_offkey.first.set_data_handle(
                         c_grantor.get(mem_offkey.second));
             }
 
-            for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
-                if (!subgraph_->is_constant_[i]) continue;
-                subgraph_->execs_[i]->execute(
-                        p_stream, res->get_exec_args()[i]);
+            if (!c_buffer->is_loaded()) {
+                for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+                    if (!subgraph_->is_constant_[i]) continue;
+                    subgraph_->execs_[i]->execute(
+                            p_stream, res->get_exec_args()[i]);
+                }
+                notify_constant_buffer_filled(p_stream, c_buffer);
             }
 
             c_promise.set_value(c_buffer);
         }
     }
 
+    // Only the constant ops run when preparing the constants
+    if (preparing_constants()) {
+        release_constant_buffer(p_stream, c_buffer);
+        prolong_scratchpad_lifetime(g_stream, scratchpad);
+        return status::success;
+    }
+
     for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
         if (subgraph_->is_constant_[i]) continue;
         subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
     }
 
+    release_constant_buffer(p_stream, c_buffer);
     prolong_scratchpad_lifetime(g_stream, scratchpad);
 
     return status::success;
@@ -14,19 +14,98 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <cstring>
+#include <string>
+
+#include "common/dnnl_thread.hpp"
+#include "cpu/platform.hpp"
+
+#include "graph/interface/partition_hashing.hpp"
+
 #include "graph/backend/dnnl/kernels/kernel_base.hpp"
 #include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace graph {
 namespace dnnl_impl {
 
+namespace {
+// Set while a kernel prepares its constants on this thread
+bool &preparing_constants_flag() {
+    static thread_local bool flag = false;
+    return flag;
+}
+
+// The content hash of a constant input, computed by chunks in parallel
+size_t get_content_hash(const void *data, size_t size) {
+    constexpr size_t chunk_size = 1 << 20;
+    const size_t nchunks = impl::utils::div_up(size, chunk_size);
+    std::vector<size_t> chunk_hashes(nchunks, 0);
+    parallel_nd(static_cast<dim_t>(nchunks), [&](dim_t c) {
+        const char *ptr = static_cast<const char *>(data) + c * chunk_size;
+        const size_t len = std::min(chunk_size, size - c * chunk_size);
+        size_t seed = 0;
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, ptr + i, sizeof(word));
+            seed = hash_combine(seed, static_cast<size_t>(word));
+        }
+        for (; i < len; i++)
+            seed = hash_combine(seed, static_cast<size_t>(ptr[i]));
+        chunk_hashes[c] = seed;
+    });
+
+    size_t seed = size;
+    for (size_t h : chunk_hashes)
+        seed = hash_combine(seed, h);
+    return seed;
+}
+} // namespace
+
 status_t kernel_base_t::compile(const dnnl_partition_impl_t *part,
         const engine_t *aengine, const std::vector<logical_tensor_t> &inputs,
         const std::vector<logical_tensor_t> &outputs) {
     auto ret = compile_impl(part, aengine, inputs, outputs);
     if (ret != status::success) return ret;
+
+    // The key of the files of the mapped constant buffers must not depend on
+    // the process, so it is made of the ops and the logical tensors of the
+    // partition instead of its id, and of what determines the kernels of the
+    // library.
+    use_mapped_constant_buffers_ = !get_constant_tensor_cache_dir().empty()
+            && aengine->kind() == engine_kind::cpu
+            && is_native_runtime(aengine->runtime_kind());
+    if (use_mapped_constant_buffers_) {
+        size_t seed = 0;
+        for (const auto &op : part->get_ops())
+            seed = hash_combine(seed, partition_hashing::get_op_hash(*op));
+        for (const auto &lt : inputs)
+            seed = hash_combine(seed, logical_tensor_wrapper_t(lt).hash());
+        for (const auto &lt : outputs)
+            seed = hash_combine(seed, logical_tensor_wrapper_t(lt).hash());
+        const auto &fpmath = part->get_fpmath_mode();
+        seed = hash_combine(seed, static_cast<size_t>(fpmath.mode_));
+        seed = hash_combine(seed, static_cast<size_t>(fpmath.apply_to_int_));
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        seed = hash_combine(seed, dnnl_get_max_threads());
+        seed = hash_combine(seed,
+                std::hash<std::string> {}(cpu::platform::get_isa_info()));
+#endif
+        const auto *version = dnnl_version();
+        seed = hash_combine(seed, version->major);
+        seed = hash_combine(seed, version->minor);
+        seed = hash_combine(seed, version->patch);
+        seed = hash_combine(seed, std::hash<std::string> {}(version->hash));
+        mapped_constant_key_seed_ = seed;
+    }
+
+    use_compressed_constant_buffers_ = get_constant_tensor_cache_compression()
+            && aengine->kind() == engine_kind::cpu
+            && is_native_runtime(aengine->runtime_kind());
+
     return prepare_inplace_pairs_impl();
 }
 
@@ -36,6 +115,18 @@ status_t kernel_base_t::execute(const stream_t *astream,
     return execute_impl(astream, inputs, outputs, scratchpad_buf);
 }
 
+bool kernel_base_t::preparing_constants() {
+    return preparing_constants_flag();
+}
+
+kernel_base_t::preparing_constants_guard_t::preparing_constants_guard_t() {
+    preparing_constants_flag() = true;
+}
+
+kernel_base_t::preparing_constants_guard_t::~preparing_constants_guard_t() {
+    preparing_constants_flag() = false;
+}
+
 bool kernel_base_t::enabled_constant_cache() const {
     if (!p_engine_.get(true)) { return false; }
 
@@ -56,6 +147,48 @@ size_t kernel_base_t::encode_constant_cache_key(
     return encoded_cache_key;
 }
 
+constant_tensor_cache_t::cached_t kernel_base_t::create_constant_buffer(
+        const std::vector<tensor_t> &inputs, size_t size,
+        allocator_t *alloc) const {
+    if (use_mapped_constant_buffers_) {
+        size_t key = hash_combine(mapped_constant_key_seed_, size);
+        for (const auto &in : inputs) {
+            const logical_tensor_wrapper_t ltw(in.get_logical_tensor());
+            if (!ltw.is_constant()) continue;
+            key = hash_combine(
+                    key, get_content_hash(in.get_data_handle(), ltw.size()));
+        }
+        auto c_buffer
+                = mapped_constant_buffer_t::create(key, size, p_engine_.get());
+        if (c_buffer) return c_buffer;
+    }
+
+    if (use_compressed_constant_buffers_) {
+        return std::make_shared<compressed_constant_buffer_t>(size,
+                p_engine_.get(), alloc, dnnl_constant_buffer_t::malloc_func,
+                dnnl_constant_buffer_t::free_func);
+    }
+
+    dnnl::engine p_engine = p_engine_;
+    return std::make_shared<dnnl_constant_buffer_t>(size, p_engine, alloc);
+}
+
+void kernel_base_t::notify_constant_buffer_filled(dnnl::stream &p_stream,
+        const constant_tensor_cache_t::cached_t &c_buffer) const {
+    if (!use_mapped_constant_buffers_) return;
+    // the data must be computed before other processes can map it
+    p_stream.wait();
+    c_buffer->notify_filled();
+}
+
+void kernel_base_t::release_constant_buffer(dnnl::stream &p_stream,
+        const constant_tensor_cache_t::cached_t &c_buffer) const {
+    if (!c_buffer || !use_compressed_constant_buffers_) return;
+    // the data must not be compressed while kernels still use it
+    p_stream.wait();
+    c_buffer->release_data();
+}
+
 const std::vector<inplace_pair_t> &kernel_base_t::get_inplace_pairs() const {
     return inplace_pairs_;
 }
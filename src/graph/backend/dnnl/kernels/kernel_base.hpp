@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "graph/interface/c_types_map.hpp"
+#include "graph/interface/constant_tensor_cache.hpp"
 #include "graph/interface/logical_tensor.hpp"
 
 // required for dnnl::engine
@@ -104,6 +105,19 @@ struct kernel_base_t {
 
     virtual status_t prepare_inplace_pairs_impl() { return status::success; }
 
+    // Runs the constant ops of the kernel to fill its constant tensor cache
+    // entry for the given constant inputs, so that the first execution finds
+    // them ready. The other inputs and the outputs have no data. Kernels
+    // without constant ops return unimplemented.
+    virtual status_t prepare_constants(const stream_t *astream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) {
+        UNUSED(astream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        return status::unimplemented;
+    }
+
     /// Returns the scratchpad size in bytes required for execution.
     virtual size_t get_scratchpad_size() const = 0;
 
@@ -116,11 +130,52 @@ struct kernel_base_t {
     size_t encode_constant_cache_key(
             const std::vector<tensor_t> &inputs, size_t cache_key) const;
 
+    // Creates the buffer of a constant tensor cache miss. With
+    // ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_DIR set on CPU, the buffer is mapped
+    // from a file keyed by the constant inputs content, and may already hold
+    // the constant data computed by another process.
+    constant_tensor_cache_t::cached_t create_constant_buffer(
+            const std::vector<tensor_t> &inputs, size_t size,
+            allocator_t *alloc) const;
+
+    // Notifies a new constant buffer that the constant ops submitted to the
+    // stream computed its data.
+    void notify_constant_buffer_filled(dnnl::stream &p_stream,
+            const constant_tensor_cache_t::cached_t &c_buffer) const;
+
+    // Returns the data of a constant buffer for the current execution, and
+    // releases it once the kernels submitted to the stream are done with it.
+    // With ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_COMPRESSION set on CPU, the data
+    // is expanded and compressed again around every execution.
+    char *acquire_constant_buffer(
+            const constant_tensor_cache_t::cached_t &c_buffer) const {
+        return static_cast<char *>(c_buffer->acquire_data());
+    }
+    void release_constant_buffer(dnnl::stream &p_stream,
+            const constant_tensor_cache_t::cached_t &c_buffer) const;
+
     const std::vector<inplace_pair_t> &get_inplace_pairs() const;
 
 protected:
+    // Whether execute_impl() is called by prepare_constants() on this thread,
+    // in which case it returns once the constant ops are submitted
+    static bool preparing_constants();
+
+    struct preparing_constants_guard_t {
+        preparing_constants_guard_t();
+        ~preparing_constants_guard_t();
+    };
+
     std::vector<inplace_pair_t> inplace_pairs_;
     dnnl::engine p_engine_;
+
+private:
+    // Whether the constant buffers are mapped from files, and the part of
+    // their keys that is common to all the executions of the kernel
+    bool use_mapped_constant_buffers_ = false;
+    size_t mapped_constant_key_seed_ = 0;
+    // Whether the constant buffers are kept compressed between executions
+    bool use_compressed_constant_buffers_ = false;
 };
 
 using kernel_ptr = std::shared_ptr<kernel_base_t>;
@@ -136,6 +191,15 @@ using FCreateKernel = std::function<kernel_ptr(void)>;
         return memory_planner_.total_internal_temporary_size(); \
     }
 
+#define DEF_KERNEL_METHOD_PREPARE_CONSTANTS() \
+    status_t prepare_constants(const stream_t *astream, \
+            const std::vector<tensor_t> &inputs, \
+            const std::vector<tensor_t> &outputs) override { \
+        if (!enabled_constant_cache()) return status::success; \
+        preparing_constants_guard_t guard; \
+        return execute_impl(astream, inputs, outputs, nullptr); \
+    }
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
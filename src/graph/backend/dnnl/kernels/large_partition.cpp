@@ -14,11 +14,17 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+
+#include "common/utils.hpp"
+#include "cpu/platform.hpp"
+
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
 
 #include "graph/backend/dnnl/passes/compile_ops.hpp"
 #include "graph/backend/dnnl/passes/constant_propagation.hpp"
 #include "graph/backend/dnnl/passes/insert_ops.hpp"
+#include "graph/backend/dnnl/passes/inter_op_schedule.hpp"
 #include "graph/backend/dnnl/passes/layout_propagation.hpp"
 #include "graph/backend/dnnl/passes/lower.hpp"
 #include "graph/backend/dnnl/passes/memory_planning.hpp"
@@ -31,6 +37,33 @@ namespace dnnl {
 namespace impl {
 namespace graph {
 namespace dnnl_impl {
+namespace {
+// Reading the weights of the next op ahead of time is mostly useful when the
+// execution is bound by the memory latency, e.g. for small batch inference,
+// so it is disabled by default.
+bool is_weights_prefetch_enabled() {
+    static const bool enabled
+            = impl::getenv_int_user("GRAPH_PREFETCH_WEIGHTS", 0) > 0;
+    return enabled;
+}
+
+// Reads one byte of each cache line of [ptr, ptr + size) until stop is set.
+void prefetch_buffer(
+        const char *ptr, size_t size, const std::atomic<bool> &stop) {
+    constexpr size_t line_size = 64;
+    constexpr size_t chunk_size = 4096;
+    unsigned char sum = 0;
+    for (size_t off = 0; off < size; off += chunk_size) {
+        if (stop.load(std::memory_order_relaxed)) break;
+        const size_t end = std::min(size, off + chunk_size);
+        for (size_t i = off; i < end; i += line_size)
+            sum ^= static_cast<unsigned char>(ptr[i]);
+    }
+    // keep the loads from being optimized out
+    volatile unsigned char sink = sum;
+    MAYBE_UNUSED(sink);
+}
+} // namespace
 
 void larger_partition_kernel_t::setup_pipeline_stage1(
         pass_pipeline_t &pipeline) {
@@ -115,6 +148,8 @@ void larger_partition_kernel_t::setup_pipeline_stage1(
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_dynamic_sub_zps_mul_scales);
     BACKEND_DNNL_ADD_PASS(pipeline, convert_dynamic_quantize_ops);
 
+    BACKEND_DNNL_ADD_PASS(pipeline, fuse_sibling_matmuls);
+
     BACKEND_DNNL_ADD_PASS(pipeline, insert_u8_to_s8_for_matmul);
     BACKEND_DNNL_ADD_PASS(pipeline, insert_permute_for_matmul);
     BACKEND_DNNL_ADD_PASS(pipeline, insert_reshape_for_ndx2d_matmul);
@@ -158,6 +193,7 @@ void larger_partition_kernel_t::setup_pipeline_stage2(pass_pipeline_t &pipeline,
     auto memory_plan = [&](std::shared_ptr<subgraph_t> &sg) {
         return mem_planner.run(sg);
     };
+    BACKEND_DNNL_ADD_PASS(pipeline, schedule_inter_op);
     pipeline.reset_visualize_arg(true, true);
     BACKEND_DNNL_ADD_PASS(pipeline, memory_plan);
     BACKEND_DNNL_ADD_PASS(pipeline, compile_ops);
@@ -199,6 +235,119 @@ void larger_partition_kernel_t::prepare_args_set(
     for (auto &mem_offkey : res->get_mems_use_internal_temporary()) {
         mem_offkey.first.set_data_handle(var_grantor.get(mem_offkey.second));
     }
+
+    // shift the views to their place in the buffer of the base
+    for (const auto &mem_offset : res->get_mems_use_view_offsets()) {
+        char *base = static_cast<char *>(mem_offset.first.get_data_handle());
+        mem_offset.first.set_data_handle(base + mem_offset.second);
+    }
+}
+
+void larger_partition_kernel_t::prepare_inter_op_steps() {
+    inter_op_steps_.clear();
+    inter_op_executor_.reset();
+    if (subgraph_->op_steps_.empty()) return;
+
+    for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+        if (subgraph_->is_constant_[i]) continue;
+        const size_t step = subgraph_->op_steps_[i];
+        if (step >= inter_op_steps_.size()) inter_op_steps_.resize(step + 1);
+        inter_op_steps_[step].push_back(i);
+    }
+
+    size_t max_concurrency = 1;
+    for (const auto &step : inter_op_steps_)
+        max_concurrency = std::max(max_concurrency, step.size());
+    inter_op_executor_.reset(new inter_op_executor_t(max_concurrency - 1));
+}
+
+void larger_partition_kernel_t::execute_inter_op_steps(
+        const dnnl::stream &p_stream, execution_args_set_t *res) {
+    // the workers are used by one execution at a time, the others run the
+    // ops of each step one after another
+    std::unique_lock<inter_op_executor_t> lock(
+            *inter_op_executor_, std::try_to_lock);
+
+    for (const auto &step : inter_op_steps_) {
+        if (lock.owns_lock() && step.size() > 1) {
+            inter_op_executor_->run(step.size(), [&](size_t i) {
+                const size_t idx = step[i];
+                scoped_num_threads_t scoped_nthr(subgraph_->op_nthr_[idx]);
+                subgraph_->execs_[idx]->execute(
+                        p_stream, res->get_exec_args()[idx]);
+            });
+        } else {
+            for (size_t idx : step)
+                subgraph_->execs_[idx]->execute(
+                        p_stream, res->get_exec_args()[idx]);
+        }
+    }
+}
+
+void larger_partition_kernel_t::prepare_weights_prefetch() {
+    prefetch_executor_.reset();
+    if (!is_weights_prefetch_enabled()
+            || p_engine_.get_kind() != dnnl::engine::kind::cpu
+            || !inter_op_steps_.empty())
+        return;
+
+    const auto &const_args = subgraph_->op_const_args_;
+    if (std::all_of(const_args.begin(), const_args.end(),
+                [](const std::vector<int> &args) { return args.empty(); }))
+        return;
+
+    // reading more than the last level cache would evict the first lines
+    const size_t llc_size
+            = static_cast<size_t>(cpu::platform::get_per_core_cache_size(3))
+            * cpu::platform::get_num_cores();
+    if (llc_size == 0) return;
+
+    prefetch_limit_ = llc_size;
+    prefetch_executor_.reset(new inter_op_executor_t(1));
+}
+
+void larger_partition_kernel_t::execute_with_weights_prefetch(
+        const dnnl::stream &p_stream, execution_args_set_t *res) {
+    // the helper thread is used by one execution at a time
+    std::unique_lock<inter_op_executor_t> lock(
+            *prefetch_executor_, std::try_to_lock);
+
+    const auto &execs = subgraph_->execs_;
+    const auto &exec_args = res->get_exec_args();
+    for (size_t i = 0; i < execs.size(); i++) {
+        if (subgraph_->is_constant_[i]) continue;
+
+        size_t next = i + 1;
+        while (next < execs.size() && subgraph_->is_constant_[next])
+            next++;
+        if (!lock.owns_lock() || next == execs.size()
+                || subgraph_->op_const_args_[next].empty()) {
+            execs[i]->execute(p_stream, exec_args[i]);
+            continue;
+        }
+
+        std::atomic<bool> done {false};
+        prefetch_executor_->run(2, [&](size_t t) {
+            if (t == 0) {
+                execs[i]->execute(p_stream, exec_args[i]);
+                done = true;
+                return;
+            }
+            size_t budget = prefetch_limit_;
+            for (int arg : subgraph_->op_const_args_[next]) {
+                const auto it = exec_args[next].find(arg);
+                if (it == exec_args[next].end()) continue;
+                const auto *ptr = static_cast<const char *>(
+                        it->second.get_data_handle());
+                if (!ptr) continue;
+                const size_t size
+                        = std::min(it->second.get_desc().get_size(), budget);
+                prefetch_buffer(ptr, size, done);
+                budget -= size;
+                if (budget == 0) break;
+            }
+        });
+    }
 }
 
 status_t larger_partition_kernel_t::compile_impl(
@@ -213,6 +362,7 @@ status_t larger_partition_kernel_t::compile_impl(
     subgraph_ = std::make_shared<subgraph_t>(part->get_ops(), p_engine_,
             part->get_fpmath_mode(), part->get_use_blocked_layout(), true);
     BACKEND_DNNL_CHECK(set_given_inputs_outputs(subgraph_, inputs, outputs));
+    memory_planner_.set_enable_buffer_views(true);
 
     // Populate the transform passes into the pipeline
     // Note: `std::call_once` should be kept in a single translation unit since
@@ -240,6 +390,9 @@ status_t larger_partition_kernel_t::compile_impl(
         out = subgraph_->outs_[i];
     }
 
+    prepare_inter_op_steps();
+    prepare_weights_prefetch();
+
     resource_ctor_ = [this]() {
         return this->memory_planner_.get_exec_args_set().clone();
     };
@@ -278,37 +431,53 @@ status_t larger_partition_kernel_t::execute_impl(const stream_t *g_stream,
         if (is_from_cache) {
             c_buffer = cached_value.get();
             grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
-                    c_buffer->data<char>());
+                    acquire_constant_buffer(c_buffer));
             for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
                 mem_offkey.first.set_data_handle(
                         c_grantor.get(mem_offkey.second));
             }
         } else {
-            c_buffer = std::make_shared<dnnl_constant_buffer_t>(
-                    memory_planner_.total_internal_persistent_size(), p_engine_,
-                    g_alloc_);
+            c_buffer = create_constant_buffer(inputs,
+                    memory_planner_.total_internal_persistent_size(), g_alloc_);
             grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
-                    c_buffer->data<char>());
+                    acquire_constant_buffer(c_buffer));
             for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
                 mem_offkey.first.set_data_handle(
                         c_grantor.get(mem_offkey.second));
             }
 
-            for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
-                if (!subgraph_->is_constant_[i]) continue;
-                subgraph_->execs_[i]->execute(
-                        p_stream, res->get_exec_args()[i]);
+            if (!c_buffer->is_loaded()) {
+                for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+                    if (!subgraph_->is_constant_[i]) continue;
+                    subgraph_->execs_[i]->execute(
+                            p_stream, res->get_exec_args()[i]);
+                }
+                notify_constant_buffer_filled(p_stream, c_buffer);
             }
 
             c_promise.set_value(c_buffer);
         }
     }
 
-    for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
-        if (subgraph_->is_constant_[i]) continue;
-        subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
+    // Only the constant ops run when preparing the constants
+    if (preparing_constants()) {
+        release_constant_buffer(p_stream, c_buffer);
+        prolong_scratchpad_lifetime(g_stream, scratchpad);
+        return status::success;
+    }
+
+    if (!inter_op_steps_.empty()) {
+        execute_inter_op_steps(p_stream, res);
+    } else if (prefetch_executor_) {
+        execute_with_weights_prefetch(p_stream, res);
+    } else {
+        for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+            if (subgraph_->is_constant_[i]) continue;
+            subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
+        }
     }
 
+    release_constant_buffer(p_stream, c_buffer);
     prolong_scratchpad_lifetime(g_stream, scratchpad);
 
     return status::success;
@@ -27,6 +27,7 @@
 
 #include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
 #include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/inter_op_executor.hpp"
 #include "graph/backend/dnnl/scratchpad.hpp"
 #include "graph/backend/dnnl/subgraph.hpp"
 #include "graph/backend/dnnl/thread_local_cache.hpp"
@@ -54,6 +55,25 @@ protected:
     subgraph_visualizer_t vis_;
     pass_pipeline_t pipeline_;
 
+    // The non-constant executables of each step of the inter-op schedule.
+    // Empty if the executables run one after another in topological order.
+    std::vector<std::vector<size_t>> inter_op_steps_;
+    std::unique_ptr<inter_op_executor_t> inter_op_executor_;
+
+    void prepare_inter_op_steps();
+    void execute_inter_op_steps(
+            const dnnl::stream &p_stream, execution_args_set_t *res);
+
+    // A helper thread that reads the constant inputs of the next op into the
+    // caches while the current op is executed. Null if disabled.
+    std::unique_ptr<inter_op_executor_t> prefetch_executor_;
+    // The maximum number of bytes read ahead for an op
+    size_t prefetch_limit_ = 0;
+
+    void prepare_weights_prefetch();
+    void execute_with_weights_prefetch(
+            const dnnl::stream &p_stream, execution_args_set_t *res);
+
 public:
     larger_partition_kernel_t() {
         thread_local_cache_t<execution_args_set_t> res_cache;
@@ -110,6 +130,7 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(larger_partition_kernel_t)
+    DEF_KERNEL_METHOD_PREPARE_CONSTANTS()
     DEF_KERNEL_METHOD_SCRATCHPAD_SIZE()
     DNNL_DISALLOW_COPY_AND_ASSIGN(larger_partition_kernel_t)
 };
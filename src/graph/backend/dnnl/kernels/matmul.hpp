@@ -101,6 +101,7 @@ public:
     }
 
     DEF_KERNEL_METHOD_STR(matmul_t)
+    DEF_KERNEL_METHOD_PREPARE_CONSTANTS()
     DEF_KERNEL_METHOD_SCRATCHPAD_SIZE()
     DNNL_DISALLOW_COPY_AND_ASSIGN(matmul_t)
 };
@@ -96,6 +96,7 @@ public:
 #endif
 
     DEF_KERNEL_METHOD_STR(pooling_fwd_t)
+    DEF_KERNEL_METHOD_PREPARE_CONSTANTS()
     DEF_KERNEL_METHOD_SCRATCHPAD_SIZE()
     DNNL_DISALLOW_COPY_AND_ASSIGN(pooling_fwd_t)
 };
@@ -186,6 +186,19 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
             inputs[sdp_cfg_.graph_inport[sdp_decomp_config_t::mm2_wei]]
                     .get_data_handle());
     char *dst2_user_pointer = static_cast<char *>(outputs[0].get_data_handle());
+    const auto get_input_pointer = [&](int index) -> const char * {
+        const int port = sdp_cfg_.graph_inport[index];
+        if (port == -1) return nullptr;
+        return static_cast<const char *>(inputs[port].get_data_handle());
+    };
+    const char *rope_q_cos_pointer
+            = get_input_pointer(sdp_decomp_config_t::rope_q_cos);
+    const char *rope_q_sin_pointer
+            = get_input_pointer(sdp_decomp_config_t::rope_q_sin);
+    const char *rope_k_cos_pointer
+            = get_input_pointer(sdp_decomp_config_t::rope_k_cos);
+    const char *rope_k_sin_pointer
+            = get_input_pointer(sdp_decomp_config_t::rope_k_sin);
 
     size_t block_size = sdp_registry_.size();
     auto scratchpad = std::make_shared<scratchpad_t>(
@@ -375,8 +388,34 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
         }
 
         // in parallel region - these primitives should use single thread.
-        sdp_cfg_.sub_reorder0.execute(strm, res->sub_reorder0_args[tid]);
-        sdp_cfg_.sub_reorder1.execute(strm, res->sub_reorder1_args[tid]);
+        // RoPE rotates query and key while they're copied to the dense
+        // buffers of matmul1, in place of reorder0 and reorder1.
+        if (sdp_cfg_.has_rope_q) {
+            const dims head_idx = sdp_cfg_.ndims == 4
+                    ? dims {bo, bi}
+                    : dims {bo, static_cast<dim_t>(wei_head_offset),
+                            static_cast<dim_t>(group_id)};
+            sdp_cfg_.rope_q.execute(head_idx, src1_user_pointer,
+                    rope_q_cos_pointer, rope_q_sin_pointer,
+                    static_cast<char *>(
+                            res->mem_map[sdp_cfg_.sub_mm1_src.get()][tid]
+                                    .get_data_handle()),
+                    sdp_cfg_.seq_len_q);
+        } else {
+            sdp_cfg_.sub_reorder0.execute(strm, res->sub_reorder0_args[tid]);
+        }
+        if (sdp_cfg_.has_rope_k) {
+            dims head_idx = {bo, static_cast<dim_t>(wei_head_offset)};
+            if (sdp_cfg_.ndims == 5) head_idx.push_back(0);
+            sdp_cfg_.rope_k.execute(head_idx, wei1_user_pointer,
+                    rope_k_cos_pointer, rope_k_sin_pointer,
+                    static_cast<char *>(
+                            res->mem_map[sdp_cfg_.sub_mm1_wei.get()][tid]
+                                    .get_data_handle()),
+                    sdp_cfg_.seq_len_kv);
+        } else {
+            sdp_cfg_.sub_reorder1.execute(strm, res->sub_reorder1_args[tid]);
+        }
         dnnl_primitive_execute_without_tp_hook(
                 sdp_cfg_.sub_mm1_prim, strm, res->sub_mm1_args[tid]);
         if (sdp_cfg_.has_select && !sdp_cfg_.select_fusiable)
@@ -691,9 +691,75 @@ impl::status_t sdp_decomp_config_t::record_input_offset(
         graph_inport.emplace_back(-1);
         graph_inport.emplace_back(-1);
     }
+
+    // RoPE of query and key. The rotation is applied when a head of the user
+    // input is copied, so the input of RoPE must be a graph input.
+    const auto get_rope = [](const std::shared_ptr<value_t> &val) -> op_ptr {
+        if (!val->has_producer()) return nullptr;
+        auto &producer = val->get_producer();
+        if (producer.get_kind() != graph::op_kind::RoPE) return nullptr;
+        return producer.shared_from_this();
+    };
+    const op_ptr rope_ops[2] = {get_rope(mm1->get_input_value(0)),
+            get_rope(mm1->get_input_value(1))};
+    has_rope_q = rope_ops[0] != nullptr;
+    has_rope_k = rope_ops[1] != nullptr;
+    VCHECK_SDP_DECOMP(!has_rope_k || mm1->get_attr<bool>(op_attr::transpose_b),
+            status::unimplemented,
+            "Not support RoPE of key when matmul 1 transpose_b is false");
+    for (int i = 0; i < 2; i++) {
+        const op_ptr &rope = rope_ops[i];
+        if (!rope) {
+            //placeholder
+            graph_inport.emplace_back(-1);
+            graph_inport.emplace_back(-1);
+            continue;
+        }
+        VCHECK_SDP_DECOMP(!rope->get_input_value(0)->has_producer(),
+                status::unimplemented,
+                "Not support RoPE of an intermediate tensor");
+        const int cos_id = find_graph_inport(rope->get_input_value(1));
+        const int sin_id = find_graph_inport(rope->get_input_value(2));
+        VCHECK_SDP_DECOMP(cos_id != -1 && sin_id != -1, status::invalid_graph,
+                "failed to find graph inport");
+        graph_inport.emplace_back(cos_id);
+        graph_inport.emplace_back(sin_id);
+
+        const std::string mode = rope->has_attr(op_attr::mode)
+                ? rope->get_attr<std::string>(op_attr::mode)
+                : "rotate_half";
+        init_rope(i == 0 ? rope_q : rope_k,
+                inputs[graph_inport[i == 0 ? mm1_src : mm1_wei]],
+                inputs[cos_id], inputs[sin_id], mode);
+    }
     return status::success;
 }
 
+void sdp_decomp_config_t::init_rope(sdp_rope_t &rope,
+        const logical_tensor_t &src, const logical_tensor_t &cos,
+        const logical_tensor_t &sin, const std::string &mode) const {
+    const auto src_dims = ltw(src).vdims();
+    rope.conf.src_dt = ltw(src).data_type();
+    rope.conf.cs_dt = ltw(cos).data_type();
+    rope.conf.head_size = src_dims.back();
+    rope.conf.interleaved = mode == "interleaved";
+    rope.src_strides = ltw(src).vstrides();
+
+    // cos and sin are aligned to the trailing dimensions of the input
+    const auto align_strides = [&](const logical_tensor_t &lt, dims &strides) {
+        const auto lt_dims = ltw(lt).vdims();
+        const auto lt_strides = ltw(lt).vstrides();
+        const size_t offset = src_dims.size() - lt_dims.size();
+        strides.assign(src_dims.size(), 0);
+        for (size_t d = offset; d < src_dims.size(); d++) {
+            if (lt_dims[d - offset] == 1 && src_dims[d] != 1) continue;
+            strides[d] = lt_strides[d - offset];
+        }
+    };
+    align_strides(cos, rope.cos_strides);
+    align_strides(sin, rope.sin_strides);
+}
+
 impl::status_t sdp_decomp_config_t::record_sdp_ops(
         std::shared_ptr<subgraph_t> &sg, bool is_quantize) {
     const auto get_wei_pre_op = [](const op_ptr &op) -> op_ptr {
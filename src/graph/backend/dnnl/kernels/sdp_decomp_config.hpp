@@ -30,6 +30,7 @@
 
 #include "graph/interface/c_types_map.hpp"
 
+#include "graph/backend/dnnl/executables/rope.hpp"
 #include "graph/backend/dnnl/scratchpad.hpp"
 #include "graph/backend/dnnl/subgraph.hpp"
 
@@ -70,6 +71,39 @@ private:
     bool is_inplace_ = false;
 };
 
+// RoPE of query or key, applied while a head is copied to the dense per-thread
+// buffer in place of the corresponding reorder.
+struct sdp_rope_t {
+    rope_conf_t conf;
+    // strides of the user input
+    dims src_strides;
+    // strides of cos and sin aligned to the user input, 0 for broadcast dims
+    dims cos_strides, sin_strides;
+
+    // Rotates the rows [0, nrows) of the head at head_idx, which indexes the
+    // leading dimensions of the user input, to the dense dst.
+    void execute(const dims &head_idx, const char *src, const char *cos,
+            const char *sin, char *dst, dim_t nrows) const {
+        const size_t src_dt_size = types::data_type_size(conf.src_dt);
+        const size_t cs_dt_size = types::data_type_size(conf.cs_dt);
+        for (size_t d = 0; d < head_idx.size(); ++d) {
+            src += head_idx[d] * src_strides[d] * src_dt_size;
+            cos += head_idx[d] * cos_strides[d] * cs_dt_size;
+            sin += head_idx[d] * sin_strides[d] * cs_dt_size;
+        }
+        const size_t last = src_strides.size() - 1;
+        for (dim_t r = 0; r < nrows; ++r) {
+            rope_fwd_row(conf, src + r * src_strides[last - 1] * src_dt_size,
+                    src_strides[last],
+                    cos + r * cos_strides[last - 1] * cs_dt_size,
+                    cos_strides[last],
+                    sin + r * sin_strides[last - 1] * cs_dt_size,
+                    sin_strides[last], dst + r * conf.head_size * src_dt_size,
+                    1);
+        }
+    }
+};
+
 struct sdp_decomp_config_t {
 public:
     sdp_decomp_config_t() = default;
@@ -86,7 +120,8 @@ public:
     int nthr = 0;
 
     // Used to record the exact input offset in subgraph
-    // [mm1_src,mm1_wei,mm2_wei,mm1_scale,mm1_soft_capping,mm1_add,select_condition,select_other_input]
+    // [mm1_src,mm1_wei,mm2_wei,mm1_scale,mm1_soft_capping,mm1_add,select_condition,select_other_input,
+    //  rope_q_cos,rope_q_sin,rope_k_cos,rope_k_sin]
     std::vector<int> graph_inport;
     enum input_index_t {
         mm1_src = 0,
@@ -96,7 +131,11 @@ public:
         mm1_soft_capping,
         mm1_add,
         select_condition,
-        select_other_input
+        select_other_input,
+        rope_q_cos,
+        rope_q_sin,
+        rope_k_cos,
+        rope_k_sin
     };
 
     // Primitives that actually perform calculations
@@ -142,6 +181,11 @@ public:
     // select's 1st input connected to previous matmul.
     bool select_fusiable = false;
 
+    // Record if query and key are rotated with RoPE before matmul1. The
+    // rotation replaces reorder0 and reorder1 respectively.
+    bool has_rope_q = false, has_rope_k = false;
+    sdp_rope_t rope_q, rope_k;
+
 private:
     // Used to record the ops contained in SDP
     // sdp_op = [reorder1, mm1, softmax, reorder2, mm2, binary_select]
@@ -176,6 +220,10 @@ private:
     impl::status_t record_sdp_ops(
             std::shared_ptr<subgraph_t> &sg, bool is_quantize);
 
+    void init_rope(sdp_rope_t &rope, const logical_tensor_t &src,
+            const logical_tensor_t &cos, const logical_tensor_t &sin,
+            const std::string &mode) const;
+
     void memory_planning(registry_t &sdp_registry);
 
     impl::status_t prepare_sdp_scales_zps(std::shared_ptr<op_t> &op, int index,
@@ -1467,8 +1467,19 @@ status_t layout_propagator_for_conv_bwd_weights(op_ptr &op,
             "failed to fill layout info for reorder after conv_bwd_weights "
             "diff_weights");
 
+    if (op->has_attr(op_attr::with_bias)
+            && op->get_attr<bool>(op_attr::with_bias)) {
+        insert_reorder_after(op, 1, pd.diff_bias_desc(), p_engine, pd_cache,
+                fpmath, use_block_layout, rewriter);
+        value_ptr diff_bias = op->get_output_value(1);
+        status = fill_layout_info(diff_bias, pd.diff_bias_desc());
+        VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+                "failed to fill layout info for reorder after "
+                "conv_bwd_weights diff_bias");
+    }
+
     // fill scratchpads dimensions and data type to scratchpad value_t
-    auto scratchpad_val = op->get_output_value(1);
+    auto scratchpad_val = op->get_output_values().back();
     const memory::desc scratchpad_desc = pd.scratchpad_desc();
     status = fill_layout_info(scratchpad_val, scratchpad_desc);
     return status;
@@ -2024,6 +2035,92 @@ status_t layout_propagator_for_gated_mlp(std::shared_ptr<op_t> &op,
     return status;
 }
 
+status_t layout_propagator_for_residual_layernorm(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout,
+        subgraph_rewriter_t &rewriter) {
+    // The kernel walks over dense rows, so all the tensors are kept in the
+    // plain ncx format.
+    status_t status = status::success;
+    for (size_t i = 0; i < 2; ++i) {
+        const auto md = to_ncx_format(
+                make_dnnl_memory_desc(op->get_input_logical_tensor(i)));
+        insert_reorder_before(op, i, md, p_engine, pd_cache, fpmath,
+                use_block_layout, rewriter);
+        status = fill_layout_info(op->get_input_value(i), md);
+        VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+                "failed to fill layout info for residual layernorm input %zu",
+                i);
+    }
+
+    for (size_t i = 0; i < 2; ++i) {
+        const auto md = to_ncx_format(
+                make_dnnl_memory_desc(op->get_output_logical_tensor(i)));
+        insert_reorder_after(op, i, md, p_engine, pd_cache, fpmath,
+                use_block_layout, rewriter);
+        status = fill_layout_info(op->get_output_value(i), md);
+        VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+                "failed to fill layout info for residual layernorm output %zu",
+                i);
+    }
+    return status;
+}
+
+status_t layout_propagator_for_rope(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout,
+        subgraph_rewriter_t &rewriter) {
+    // The kernel accepts any strides, only blocked inputs are reordered.
+    status_t status = status::success;
+    for (size_t i = 0; i < op->num_inputs(); ++i) {
+        auto md = make_dnnl_memory_desc(op->get_input_logical_tensor(i));
+        if (is_plain(md)) continue;
+        md = to_ncx_format(md);
+        insert_reorder_before(op, i, md, p_engine, pd_cache, fpmath,
+                use_block_layout, rewriter);
+        status = fill_layout_info(op->get_input_value(i), md);
+        VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+                "failed to fill layout info for rope input %zu", i);
+    }
+
+    const auto dst_md = to_ncx_format(
+            make_dnnl_memory_desc(op->get_output_logical_tensor(0)));
+    insert_reorder_after(
+            op, 0, dst_md, p_engine, pd_cache, fpmath, use_block_layout, rewriter);
+    status = fill_layout_info(op->get_output_value(0), dst_md);
+    VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+            "failed to fill layout info for rope output");
+    return status;
+}
+
+status_t layout_propagator_for_split(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout,
+        subgraph_rewriter_t &rewriter) {
+    // The outputs are reordered from sub-memories of the input, which
+    // requires a plain input. The outputs can have any layout.
+    status_t status = status::success;
+    auto src_md = make_dnnl_memory_desc(op->get_input_logical_tensor(0));
+    if (!is_plain(src_md)) {
+        src_md = to_ncx_format(src_md);
+        insert_reorder_before(op, 0, src_md, p_engine, pd_cache, fpmath,
+                use_block_layout, rewriter);
+        status = fill_layout_info(op->get_input_value(0), src_md);
+        VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+                "failed to fill layout info for split input");
+    }
+
+    for (size_t i = 0; i < op->num_outputs(); ++i) {
+        value_ptr dst = op->get_output_value(i);
+        if (!ltw(dst->get_logical_tensor()).is_any()) continue;
+        const auto md = make_dnnl_memory_desc(dst->get_logical_tensor());
+        status = fill_layout_info(dst, to_ncx_format(md));
+        VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+                "failed to fill layout info for split output %zu", i);
+    }
+    return status;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
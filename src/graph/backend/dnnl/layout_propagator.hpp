@@ -98,6 +98,9 @@ DECLARE_LAYOUT_PROPAGATOR(sdpa_bwd);
 DECLARE_LAYOUT_PROPAGATOR(host_scalar);
 DECLARE_LAYOUT_PROPAGATOR(identity);
 DECLARE_LAYOUT_PROPAGATOR(gated_mlp);
+DECLARE_LAYOUT_PROPAGATOR(residual_layernorm);
+DECLARE_LAYOUT_PROPAGATOR(rope);
+DECLARE_LAYOUT_PROPAGATOR(split);
 
 #undef DECLARE_LAYOUT_PROPAGATOR
 
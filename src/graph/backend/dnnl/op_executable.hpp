@@ -35,9 +35,11 @@
 #include "graph/backend/dnnl/executables/reduction.hpp"
 #include "graph/backend/dnnl/executables/reorder.hpp"
 #include "graph/backend/dnnl/executables/resampling.hpp"
+#include "graph/backend/dnnl/executables/rope.hpp"
 #include "graph/backend/dnnl/executables/sdpa.hpp"
 #include "graph/backend/dnnl/executables/shuffle.hpp"
 #include "graph/backend/dnnl/executables/softmax.hpp"
+#include "graph/backend/dnnl/executables/split.hpp"
 #include "graph/backend/dnnl/executables/sum.hpp"
 
 #include "graph/backend/dnnl/layout_propagator.hpp"
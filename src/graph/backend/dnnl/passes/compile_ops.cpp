@@ -14,13 +14,21 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <memory>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 
+#include "common/utils.hpp"
+
 #include "graph/interface/c_types_map.hpp"
+#include "graph/interface/logical_tensor.hpp"
 #include "graph/interface/value.hpp"
 
+#include "graph/backend/dnnl/inter_op_executor.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
 #include "graph/backend/dnnl/passes/compile_ops.hpp"
 
@@ -34,6 +42,40 @@ namespace dnnl {
 namespace impl {
 namespace graph {
 namespace dnnl_impl {
+namespace {
+// Number of threads used to create the executables of a subgraph. Creating
+// the executables is dominated by primitive creation (mostly JIT code
+// generation) and every op is independent of the others, so the work can be
+// spread across threads. Disabled by default as the primitives are created
+// in threads with default threading settings.
+int get_compile_threads() {
+    static const int nthr = impl::getenv_int_user("GRAPH_COMPILE_THREADS", 1);
+    return nthr;
+}
+
+// Returns the dnnl execution args of the op inputs that are either constant
+// partition inputs or produced by constant ops.
+std::vector<int> get_constant_args(op_t *op) {
+    std::vector<int> const_args;
+    auto getter = op_func_t::get_arg_indices_getter(op->get_kind());
+    if (!getter) return const_args;
+
+    for (const auto &arg_idx : getter(op)) {
+        if (arg_idx.second.type_ != indices_t::type_t::input) continue;
+        const auto &val = op->get_input_value(arg_idx.second.value_);
+        bool is_const = logical_tensor_wrapper_t(val->get_logical_tensor())
+                                .is_constant();
+        if (val->has_producer()) {
+            const op_t &producer = val->get_producer();
+            is_const = producer.has_attr(op_attr::is_constant)
+                    && producer.get_attr<bool>(op_attr::is_constant);
+        }
+        if (is_const) const_args.push_back(arg_idx.first);
+    }
+    return const_args;
+}
+} // namespace
+
 /// After the lower down, infer shape, infer type and layout propagation passes,
 /// each op in the subgraph will has complete attributes and each edge will have
 /// complete shape/dtype/layout information. We can create executable for these
@@ -44,14 +86,63 @@ status_t compile_ops(std::shared_ptr<subgraph_t> &sg) {
     auto &fpm = sg->get_fpmath_mode();
     bool use_block_layout = sg->can_use_blocked_layout_;
 
-    return topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+    std::vector<op_t *> ops;
+    CHECK(topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
         auto creator = op_func_t::get_executable_creator(op->get_kind());
         VCHECK_COMPILE_OPS(creator != nullptr, status::invalid_graph_op,
                 "no executable creator in schema of op %s",
                 op->get_name().c_str());
-        auto cur_op = op->shared_from_this();
-        std::shared_ptr<op_executable_t> exec
-                = creator(cur_op, p_engine, pd_cache, fpm, use_block_layout);
+        ops.push_back(op);
+        return status::success;
+    }));
+
+    std::vector<std::shared_ptr<op_executable_t>> execs(ops.size());
+    const auto create_exec = [&](size_t i, pd_cache_t &cache) {
+        auto creator = op_func_t::get_executable_creator(ops[i]->get_kind());
+        auto cur_op = ops[i]->shared_from_this();
+        // ops scheduled to run concurrently are created for their share of
+        // the threads
+        scoped_num_threads_t scoped_nthr(
+                sg->op_nthr_.empty() ? 0 : sg->op_nthr_[i]);
+        execs[i] = creator(cur_op, p_engine, cache, fpm, use_block_layout);
+    };
+
+    const size_t nthr = std::min(
+            static_cast<size_t>(std::max(get_compile_threads(), 1)),
+            ops.size());
+    if (nthr <= 1) {
+        for (size_t i = 0; i < ops.size(); i++)
+            create_exec(i, pd_cache);
+    } else {
+        // The pd cache is not thread-safe: every thread works with its own
+        // copy and the new entries are merged back once all threads are done.
+        // Identical primitives requested from several threads are created
+        // only once thanks to the primitive cache.
+        std::vector<pd_cache_t> thr_pd_caches(nthr, pd_cache);
+        // Exceptions thrown by the creators are rethrown in the caller.
+        std::vector<std::exception_ptr> thr_errors(nthr);
+        std::atomic<size_t> next_op {0};
+        std::vector<std::thread> workers;
+        workers.reserve(nthr);
+        for (size_t ithr = 0; ithr < nthr; ithr++) {
+            workers.emplace_back([&, ithr]() {
+                try {
+                    for (size_t i = next_op++; i < ops.size(); i = next_op++)
+                        create_exec(i, thr_pd_caches[ithr]);
+                } catch (...) { thr_errors[ithr] = std::current_exception(); }
+            });
+        }
+        for (auto &w : workers)
+            w.join();
+        for (const auto &e : thr_errors)
+            if (e) std::rethrow_exception(e);
+        for (const auto &thr_pd_cache : thr_pd_caches)
+            pd_cache.insert(thr_pd_cache.begin(), thr_pd_cache.end());
+    }
+
+    for (size_t i = 0; i < ops.size(); i++) {
+        op_t *op = ops[i];
+        const auto &exec = execs[i];
         VCHECK_COMPILE_OPS(exec != nullptr, status::invalid_graph_op,
                 "unimplemented op, can't compile op %s",
                 op->get_name().c_str());
@@ -63,8 +154,11 @@ status_t compile_ops(std::shared_ptr<subgraph_t> &sg) {
 
         sg->is_constant_.push_back(op->has_attr(op_attr::is_constant)
                 && op->get_attr<bool>(op_attr::is_constant));
-        return status::success;
-    });
+        sg->op_const_args_.push_back(sg->is_constant_.back()
+                        ? std::vector<int>()
+                        : get_constant_args(op));
+    }
+    return status::success;
 }
 
 } // namespace dnnl_impl
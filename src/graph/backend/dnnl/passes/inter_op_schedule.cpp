@@ -0,0 +1,207 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+#include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/value.hpp"
+
+#include "graph/backend/dnnl/passes/inter_op_schedule.hpp"
+#include "graph/backend/dnnl/passes/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+namespace {
+using ltw = logical_tensor_wrapper_t;
+
+bool is_inter_op_parallelism_enabled() {
+    static const bool enabled
+            = impl::getenv_int_user("GRAPH_INTER_OP_PARALLELISM", 0) > 0;
+    return enabled;
+}
+
+double get_nelems(const value_t *val) {
+    return static_cast<double>(
+            std::max(ltw(val->get_logical_tensor()).nelems(), dim_t(1)));
+}
+
+// The work of convolutions and matmuls is estimated as the number of
+// multiply-add operations, and the work of other ops as the number of elements
+// they read and write.
+double estimate_work(const op_t *op) {
+    const op_kind_t kind = op->get_kind();
+    if (kind == op_kind::_matmul) {
+        const auto src_dims
+                = ltw(op->get_input_value(0)->get_logical_tensor()).vdims();
+        const double k = src_dims.empty() ? 1.0 : src_dims.back();
+        return get_nelems(op->get_output_value(0).get()) * k;
+    }
+    if (kind == op_kind::_convolution) {
+        // convolutions are in ncx format at this point
+        const auto dst_dims
+                = ltw(op->get_output_value(0)->get_logical_tensor()).vdims();
+        const double oc = dst_dims.size() > 1 ? dst_dims[1] : 1.0;
+        const double k = get_nelems(op->get_input_value(1).get()) / oc;
+        return get_nelems(op->get_output_value(0).get()) * k;
+    }
+
+    double work = 0;
+    for (const auto &in : op->get_input_values())
+        work += get_nelems(in.get());
+    for (const auto &out : op->get_output_values())
+        work += get_nelems(out.get());
+    return work;
+}
+
+// Splits nthr threads among the ops proportionally to their work, with at
+// least one thread per op. Requires nthr >= work.size().
+std::vector<int> split_threads(const std::vector<double> &work, int nthr) {
+    double total_work = 0;
+    for (double w : work)
+        total_work += w;
+
+    std::vector<int> teams(work.size());
+    int used = 0;
+    for (size_t i = 0; i < work.size(); i++) {
+        const double share = total_work > 0 ? nthr * work[i] / total_work
+                                            : double(nthr) / work.size();
+        teams[i] = std::max(1, static_cast<int>(share));
+        used += teams[i];
+    }
+
+    // fix the rounding by taking threads from the largest teams or by giving
+    // them to the ops with the most work per thread
+    while (used > nthr) {
+        auto it = std::max_element(teams.begin(), teams.end());
+        --(*it);
+        --used;
+    }
+    while (used < nthr) {
+        size_t best = 0;
+        for (size_t i = 1; i < work.size(); i++) {
+            if (work[i] / teams[i] > work[best] / teams[best]) best = i;
+        }
+        ++teams[best];
+        ++used;
+    }
+    return teams;
+}
+} // namespace
+
+status_t schedule_inter_op(std::shared_ptr<subgraph_t> &sg) {
+    sg->op_steps_.clear();
+    sg->op_nthr_.clear();
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    if (!is_inter_op_parallelism_enabled()
+            || sg->p_engine_->get_kind() != dnnl::engine::kind::cpu)
+        return status::success;
+
+    const int nthr = dnnl_get_max_threads();
+    if (nthr < 2) return status::success;
+
+    // the level of an op is the length of the longest path to it from the
+    // subgraph inputs, so the ops of a level don't depend on each other
+    std::vector<op_t *> ops;
+    std::unordered_map<const op_t *, size_t> levels;
+    size_t nlevels = 0;
+    CHECK(topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+        size_t level = 0;
+        for (const auto &in : op->get_input_values()) {
+            if (!in->has_producer()) continue;
+            auto pos = levels.find(&in->get_producer());
+            if (pos != levels.end())
+                level = std::max(level, pos->second + 1);
+        }
+        levels[op] = level;
+        nlevels = std::max(nlevels, level + 1);
+        ops.push_back(op);
+        return status::success;
+    }));
+
+    std::vector<std::vector<size_t>> level_ops(nlevels);
+    for (size_t i = 0; i < ops.size(); i++)
+        level_ops[levels.at(ops[i])].push_back(i);
+
+    sg->op_steps_.assign(ops.size(), 0);
+    sg->op_nthr_.assign(ops.size(), 0);
+    size_t step = 0;
+    size_t max_concurrency = 1;
+    for (const auto &cur_ops : level_ops) {
+        // constant ops are executed once before the others, so they don't
+        // take part in the inter-op parallelism
+        std::vector<size_t> cur_exec_ops;
+        for (size_t i : cur_ops) {
+            const bool is_constant = ops[i]->has_attr(op_attr::is_constant)
+                    && ops[i]->get_attr<bool>(op_attr::is_constant);
+            if (is_constant)
+                sg->op_steps_[i] = step;
+            else
+                cur_exec_ops.push_back(i);
+        }
+
+        // a level with more ops than threads is split into several steps
+        for (size_t begin = 0; begin < cur_exec_ops.size();
+                begin += static_cast<size_t>(nthr)) {
+            const size_t end = std::min(
+                    cur_exec_ops.size(), begin + static_cast<size_t>(nthr));
+            std::vector<double> work;
+            for (size_t j = begin; j < end; j++)
+                work.push_back(estimate_work(ops[cur_exec_ops[j]]));
+
+            // a single op keeps the default number of threads
+            const std::vector<int> teams = work.size() > 1
+                    ? split_threads(work, nthr)
+                    : std::vector<int>(1, 0);
+            for (size_t j = begin; j < end; j++) {
+                sg->op_steps_[cur_exec_ops[j]] = step;
+                sg->op_nthr_[cur_exec_ops[j]] = teams[j - begin];
+            }
+            max_concurrency = std::max(max_concurrency, end - begin);
+            step++;
+        }
+        if (cur_exec_ops.empty()) step++;
+    }
+
+    // the schedule brings nothing if no ops can run concurrently
+    if (max_concurrency == 1) {
+        sg->op_steps_.clear();
+        sg->op_nthr_.clear();
+        return status::success;
+    }
+
+    VINFO(graph, create, dispatch, inter_op_schedule,
+            "ops:%zu,steps:%zu,max concurrency:%zu", ops.size(), step,
+            max_concurrency);
+#endif
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_PASSES_INTER_OP_SCHEDULE_HPP
+#define GRAPH_BACKEND_DNNL_PASSES_INTER_OP_SCHEDULE_HPP
+
+#include <memory>
+
+#include "graph/interface/c_types_map.hpp"
+
+#include "graph/backend/dnnl/subgraph.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+/// Groups the ops that don't depend on each other into steps, so that the ops
+/// of a step can be executed concurrently by split thread teams. Each op gets
+/// a share of the threads proportional to its work estimate, which is used to
+/// create and execute its primitive. The schedule is stored in
+/// subgraph_t::op_steps_ and subgraph_t::op_nthr_ and must be computed after
+/// all the passes that change the subgraph structure, before memory planning.
+///
+/// The pass is only enabled for CPU engines with the OpenMP runtime when the
+/// ONEDNN_GRAPH_INTER_OP_PARALLELISM environment variable is set to 1.
+status_t schedule_inter_op(std::shared_ptr<subgraph_t> &sg);
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -163,6 +163,64 @@ static status_t bias_add_handler(
     return status::success;
 }
 
+// A BiasAddBackward is compiled only when it reduces the same diff_dst as a
+// ConvolutionBackwardWeights, as the diff_bias output of the convolution.
+static bool is_fusible_bias_add_bwd(const op_t &bias_bwd, const op_t &conv) {
+    const auto get_format = [](const op_t &op) {
+        return op.has_attr(op_attr::data_format)
+                ? op.get_attr<std::string>(op_attr::data_format)
+                : std::string("NXC");
+    };
+    return bias_bwd.get_kind() == graph::op_kind::BiasAddBackward
+            && conv.get_input_value(1) == bias_bwd.get_input_value(0)
+            && get_format(bias_bwd) == get_format(conv);
+}
+
+static status_t conv_bwd_weights_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    // look for the bias gradient before the inputs move to the new op
+    op_t *bias_bwd = nullptr;
+    for (const auto &csm : op->get_input_value(1)->get_consumers()) {
+        if (is_fusible_bias_add_bwd(csm.get_op(), *op)) {
+            bias_bwd = &csm.get_op();
+            break;
+        }
+    }
+
+    auto new_op = std::make_shared<op_t>(op_kind::_conv_bwd_weights);
+    new_op->merge_attributes(op->get_attributes());
+    rewriter.replace_op(op, new_op);
+
+    // diff_bias is reduced by the convolution while it reads diff_dst
+    if (bias_bwd) {
+        bias_bwd->get_input_value(0)->remove_consumer(*bias_bwd, 0);
+        new_op->add_output(bias_bwd->get_output_value(0));
+        new_op->set_attr<bool>(op_attr::with_bias, true);
+        rewriter.to_remove(bias_bwd->shared_from_this());
+    }
+    insert_empty_scratchpad(new_op);
+    return status::success;
+}
+
+static status_t bias_add_bwd_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    UNUSED(rewriter);
+    // lowered together with the convolution by conv_bwd_weights_handler
+    bool fusible = false;
+    for (const auto &csm : op->get_input_value(0)->get_consumers()) {
+        const op_t &conv = csm.get_op();
+        fusible = fusible
+                || (impl::utils::one_of(conv.get_kind(),
+                            graph::op_kind::ConvolutionBackwardWeights,
+                            op_kind::_conv_bwd_weights)
+                        && is_fusible_bias_add_bwd(*op, conv));
+    }
+    VCHECK_UNIMPLEMENTED(fusible,
+            "BiasAddBackward is only supported as the bias gradient of a "
+            "ConvolutionBackwardWeights");
+    return status::success;
+}
+
 static status_t eltwise_fwd_handler(
         const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
     auto new_op = std::make_shared<op_t>(op_kind::_eltwise);
@@ -799,6 +857,14 @@ static status_t gen_index_handler(
     return status::success;
 }
 
+static status_t rope_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    auto new_op = std::make_shared<op_t>(op_kind::_rope);
+    new_op->merge_attributes(op->get_attributes());
+    rewriter.replace_op(op, new_op);
+    return status::success;
+}
+
 static status_t rmsnorm_handler(
         const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
     auto new_op = std::make_shared<op_t>(op_kind::_layernorm);
@@ -829,8 +895,7 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         // conv
         ITEM(Convolution, common_handler<op_kind::_convolution>),
         ITEM(ConvolutionBackwardData, common_handler<op_kind::_conv_bwd_data>),
-        ITEM(ConvolutionBackwardWeights,
-                common_handler<op_kind::_conv_bwd_weights>),
+        ITEM(ConvolutionBackwardWeights, conv_bwd_weights_handler),
         // convtranspose
         ITEM(ConvTranspose, common_handler<op_kind::_convtranspose>),
         ITEM(ConvTransposeBackwardData,
@@ -923,6 +988,7 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         ITEM(StaticTranspose, static_transpose_handler),
         // misc
         ITEM(BiasAdd, bias_add_handler),
+        ITEM(BiasAddBackward, bias_add_bwd_handler),
         ITEM(Reorder, reorder_handler),
         ITEM(TypeCast, typecast_handler),
         ITEM(Reciprocal, reciprocal_handler),
@@ -931,6 +997,7 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         ITEM(Select, select_handler),
         ITEM(GenIndex, gen_index_handler),
         ITEM(Dropout, dropout_handler),
+        ITEM(RoPE, rope_handler),
         // utility
         ITEM(Wildcard, dummy_handler),
         ITEM(End, identity_handler),
@@ -15,6 +15,7 @@
  *******************************************************************************/
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <set>
 #include <vector>
@@ -240,6 +241,13 @@ std::shared_ptr<execution_args_set_t> execution_args_set_t::clone() const {
                 mem_offkey.second);
     }
 
+    ret->mems_use_view_offsets_.reserve(mems_use_view_offsets_.size());
+    for (const auto &mem_offset : mems_use_view_offsets_) {
+        ret->mems_use_view_offsets_.emplace_back(
+                ret->value_mem_map_.at(find_val(mem_offset.first)),
+                mem_offset.second);
+    }
+
     ret->topo_ordered_exec_args_.reserve(topo_ordered_exec_args_.size());
     for (const auto &args : topo_ordered_exec_args_) {
         std::unordered_map<int, memory> new_args;
@@ -259,6 +267,7 @@ void execution_args_set_t::clear() {
     mems_use_external_outputs_.clear();
     mems_use_internal_temporary_.clear();
     mems_use_internal_persistent_.clear();
+    mems_use_view_offsets_.clear();
     value_mem_map_.clear();
     topo_ordered_exec_args_.clear();
 }
@@ -332,6 +341,122 @@ std::vector<const value_t *> alias_analyzer_t::get_all_aliases(
     return ret;
 }
 
+namespace {
+bool is_constant_op(const op_t &op) {
+    return op.has_attr(op_attr::is_constant)
+            && op.get_attr<bool>(op_attr::is_constant);
+}
+
+// Get the byte offset of the sub-tensor of the given dims at the given offsets
+// in a tensor of the base layout, if the sub-tensor is a contiguous part of it
+// with the layout of md.
+bool get_contiguous_slice_offset(const memory::desc &base_md,
+        const memory::desc &md, const memory::dims &offsets, size_t &offset) {
+    if (!is_plain(base_md) || !is_plain(md)
+            || base_md.get_data_type() != md.get_data_type())
+        return false;
+
+    const auto dims = md.get_dims();
+    const auto strides = md.get_strides();
+    const auto sub_strides
+            = base_md.submemory_desc(dims, offsets).get_strides();
+    const size_t dt_size = memory::data_type_size(md.get_data_type());
+    size_t nelems = 1;
+    for (const auto d : dims)
+        nelems *= static_cast<size_t>(d);
+    // a dense slice with the strides of the base is contiguous in it
+    if (nelems == 0 || md.get_size() != nelems * dt_size) return false;
+    for (size_t d = 0; d < dims.size(); d++) {
+        if (dims[d] != 1 && strides[d] != sub_strides[d]) return false;
+    }
+
+    const auto base_strides = base_md.get_strides();
+    offset = 0;
+    for (size_t d = 0; d < offsets.size(); d++)
+        offset += static_cast<size_t>(offsets[d] * base_strides[d]);
+    offset *= dt_size;
+    return true;
+}
+} // namespace
+
+// Find the concat ops whose inputs are contiguous slices of the output, and the
+// split ops whose outputs are contiguous slices of the input. These slices are
+// placed as views into the buffer of the concatenated tensor, and the op is
+// marked as zero-copy so that it's not executed. The ops are handled as a whole
+// or not at all. A view must have no alias and not be a partition output, as
+// its buffer is decided by the base.
+status_t memory_planner_t::prepare_buffer_views(
+        std::shared_ptr<subgraph_t> &sg) {
+    const auto sg_outs = sg->get_output_values();
+    const std::unordered_set<const value_t *> outs(
+            sg_outs.begin(), sg_outs.end());
+    auto can_be_view = [&](const value_t *val) {
+        return !views_.count(val) && !outs.count(val)
+                && alias_analyzer_.get_all_aliases(val).empty();
+    };
+
+    // concat ops first, so that the slices of a split which are concatenated
+    // again are not copied by the concat
+    for (const op_kind_t kind : {op_kind::_concat, op_kind::_split}) {
+        for (auto &op : sg->get_ops()) {
+            if (op->get_kind() != kind || is_constant_op(*op)
+                    || op->has_attr(op_attr::fusion_info))
+                continue;
+
+            const bool is_concat = kind == op_kind::_concat;
+            value_t *base = is_concat ? op->get_output_value(0).get()
+                                      : op->get_input_value(0).get();
+            if (base->has_producer() && is_constant_op(base->get_producer()))
+                continue;
+
+            const auto base_md
+                    = make_dnnl_memory_desc(base->get_logical_tensor());
+            const auto res = utils::try_reverse_axis(
+                    op->get_attr<int64_t>(op_attr::axis), base_md.get_ndims());
+            if (!res.first) continue;
+            const auto axis = static_cast<size_t>(res.second);
+
+            std::vector<value_t *> slices;
+            if (is_concat) {
+                for (auto &in : op->get_input_values())
+                    slices.emplace_back(in.get());
+            } else {
+                for (auto &out : op->get_output_values())
+                    slices.emplace_back(out.get());
+            }
+
+            std::unordered_map<const value_t *, view_info_t> op_views;
+            memory::dims offsets(base_md.get_ndims(), 0);
+            bool ok = true;
+            for (value_t *val : slices) {
+                // the inputs of a concat are written by their own producer,
+                // and the outputs of a split are only read
+                if (is_concat)
+                    ok = val->has_producer() && val->get_consumers().size() == 1
+                            && !is_constant_op(val->get_producer());
+                else
+                    ok = !val->get_consumers().empty();
+                ok = ok && can_be_view(val) && !op_views.count(val);
+                if (!ok) break;
+
+                const auto md
+                        = make_dnnl_memory_desc(val->get_logical_tensor());
+                size_t offset = 0;
+                ok = get_contiguous_slice_offset(base_md, md, offsets, offset);
+                if (!ok) break;
+
+                op_views.insert({val, {base, offset}});
+                offsets[axis] += md.get_dims()[axis];
+            }
+            if (!ok) continue;
+
+            views_.insert(op_views.begin(), op_views.end());
+            op->set_attr<bool>(op_attr::is_zero_copy, true);
+        }
+    }
+    return status::success;
+}
+
 // Assign partition's input edges to user given external inputs buffer. Those
 // external inputs buffers may be used by other partition (which is under the
 // control of user), so we can't reuse them.
@@ -428,13 +553,15 @@ status_t memory_planner_t::assign_external_outputs_buffer(
                         for (auto &pair : op_inplace_pairs) {
                             if (pair.out_idx_ != cur_val->get_offset())
                                 continue;
+                            // a view keeps the buffer of its base
                             auto in_val
                                     = producer.get_input_value(pair.in_idx_);
                             if (buffer_assignments_.at(in_val.get())
                                             != orig_info
                                     || buffer_assignments_.at(in_val.get())
                                                     .kind_
-                                            == external_input)
+                                            == external_input
+                                    || views_.count(in_val.get()))
                                 continue;
                             q.push(in_val.get());
                         }
@@ -512,8 +639,43 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
         const std::unordered_map<value_t *, size_t> &edge_ref_count,
         bool enable_standard_sharing) {
     std::unordered_map<size_t, size_t> temporary_buffer_ref_count;
+    // with an inter-op schedule, a buffer can't be reused inplace by an op if
+    // it's read by other ops of the same step
+    std::unordered_map<size_t, size_t> temporary_buffer_last_step;
+    size_t op_idx = 0;
+
+    // place a view into the buffer of its base, which is allocated first if
+    // the view is written before the base (i.e. a concat input)
+    std::function<void(const value_t *)> assign_view
+            = [&](const value_t *val) {
+        const view_info_t &view = views_.at(val);
+        if (!buffer_assignments_.count(view.base_)) {
+            if (views_.count(view.base_)) {
+                assign_view(view.base_);
+            } else {
+                auto lt = view.base_->get_logical_tensor();
+                size_t idx = temporary_buffer_assigner_.request(
+                        make_dnnl_memory_desc(lt).get_size());
+                buffer_assignments_.insert(std::make_pair(
+                        view.base_, assign_info_t(internal_temporary, idx)));
+                temporary_buffer_ref_count[idx] = edge_ref_count.at(
+                        const_cast<value_t *>(view.base_));
+            }
+        }
+
+        assign_info_t info = buffer_assignments_.at(view.base_);
+        info.offset_ += view.offset_;
+        buffer_assignments_.insert(std::make_pair(val, info));
+        if (info.kind_ == internal_temporary)
+            temporary_buffer_ref_count[info.index_]
+                    += edge_ref_count.at(const_cast<value_t *>(val));
+    };
 
     auto func = [&](op_t *op) {
+        const bool has_schedule = !sg->op_steps_.empty();
+        const size_t step = has_schedule ? sg->op_steps_[op_idx] : op_idx;
+        op_idx++;
+
         // Handle alias first
         auto inputs = op->get_input_values();
         for (auto &in : inputs) {
@@ -527,6 +689,15 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             }
         }
 
+        // Handle views before inplace, as the buffer of a view is decided by
+        // its base
+        for (auto &out : op->get_output_values()) {
+            if (!views_.count(out.get())
+                    || buffer_assignments_.count(out.get()))
+                continue;
+            assign_view(out.get());
+        }
+
         // Handle inplace
         auto op_inplace_pairs = get_op_inplace_pairs(*op);
         if (!op_inplace_pairs.empty()) {
@@ -537,6 +708,12 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
 
                 bool reuse_in_buffer
                         = temporary_buffer_ref_count[info.index_] == 1;
+                if (has_schedule) {
+                    auto pos = temporary_buffer_last_step.find(info.index_);
+                    if (pos != temporary_buffer_last_step.end()
+                            && pos->second >= step)
+                        reuse_in_buffer = false;
+                }
                 if (reuse_in_buffer) {
                     value_t *out = op->get_output_value(pair.out_idx_).get();
                     if (!buffer_assignments_.count(out)) {
@@ -567,6 +744,9 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             assign_info_t info = buffer_assignments_.at(in.get());
             if (info.kind_ != internal_temporary) continue;
 
+            size_t &last_step = temporary_buffer_last_step[info.index_];
+            last_step = std::max(last_step, step);
+
             --temporary_buffer_ref_count[info.index_];
             // if we decrease it to zero, we are ready to release
             if (enable_standard_sharing
@@ -595,6 +775,125 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
     return topo_order_visit(sg->get_output_ops(), func);
 }
 
+// Assign an offset in the scratchpad to each internal temporary buffer with the
+// greedy-by-size algorithm. The live range of a buffer spans from the first op
+// that produces or consumes it to the last one, in the topological order used
+// at execution. The buffers are visited from the largest to the smallest, and
+// each of them is placed at the lowest aligned offset where it doesn't overlap
+// the buffers already placed with an intersecting live range. The planned size
+// is reported together with the lower bound of the peak memory, which is the
+// largest total size of the buffers that are alive at the same time.
+status_t memory_planner_t::plan_internal_temporary_offsets(
+        std::shared_ptr<subgraph_t> &sg) {
+    // same as the default alignment of registrar_t
+    const size_t alignment = 64;
+
+    // with an inter-op schedule, the ops of a step run concurrently and share
+    // the same time point
+    std::unordered_map<size_t, time_bound_t> live_ranges;
+    size_t op_idx = 0, time_point = 0, end_time_point = 0;
+    auto extend_live_range = [&](const value_t *val) {
+        const assign_info_t &info = buffer_assignments_.at(val);
+        if (info.kind_ != internal_temporary
+                || info.index_ == static_cast<size_t>(-1))
+            return;
+
+        auto pos = live_ranges.find(info.index_);
+        if (pos == live_ranges.end()) {
+            live_ranges.insert({info.index_, {time_point, time_point}});
+        } else {
+            pos->second.start_ = std::min(pos->second.start_, time_point);
+            pos->second.end_ = std::max(pos->second.end_, time_point);
+        }
+    };
+
+    CHECK(topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+        time_point = sg->op_steps_.empty() ? op_idx : sg->op_steps_[op_idx];
+        end_time_point = std::max(end_time_point, time_point + 1);
+        for (auto &in : op->get_input_values())
+            extend_live_range(in.get());
+        for (auto &out : op->get_output_values())
+            extend_live_range(out.get());
+        op_idx++;
+        return status::success;
+    }));
+
+    // the subgraph outputs must stay alive until the end of the execution
+    time_point = end_time_point;
+    for (const auto &val : sg->get_output_values()) {
+        const assign_info_t &info = buffer_assignments_.at(val);
+        if (info.kind_ == internal_temporary && live_ranges.count(info.index_))
+            live_ranges.at(info.index_).end_ = time_point;
+    }
+
+    struct buffer_t {
+        size_t index_;
+        size_t size_;
+        time_bound_t live_range_;
+        size_t offset_;
+    };
+
+    std::vector<buffer_t> buffers;
+    buffers.reserve(live_ranges.size());
+    for (const auto &range : live_ranges) {
+        buffers.push_back({range.first,
+                temporary_buffer_assigner_.query_size(range.first),
+                range.second, 0});
+    }
+    // ties are broken by the index to keep the plan deterministic
+    std::sort(buffers.begin(), buffers.end(),
+            [](const buffer_t &a, const buffer_t &b) {
+                if (a.size_ != b.size_) return a.size_ > b.size_;
+                return a.index_ < b.index_;
+            });
+
+    size_t planned_size = 0;
+    std::vector<const buffer_t *> conflicts;
+    for (size_t i = 0; i < buffers.size(); i++) {
+        buffer_t &buf = buffers[i];
+
+        conflicts.clear();
+        for (size_t j = 0; j < i; j++) {
+            const time_bound_t &other = buffers[j].live_range_;
+            if (other.start_ <= buf.live_range_.end_
+                    && buf.live_range_.start_ <= other.end_)
+                conflicts.push_back(&buffers[j]);
+        }
+        std::sort(conflicts.begin(), conflicts.end(),
+                [](const buffer_t *a, const buffer_t *b) {
+                    return a->offset_ < b->offset_;
+                });
+
+        // find the lowest gap between the conflicting buffers that fits
+        size_t offset = 0;
+        for (const buffer_t *other : conflicts) {
+            if (offset + buf.size_ <= other->offset_) break;
+            offset = std::max(offset,
+                    dnnl::impl::utils::rnd_up(
+                            other->offset_ + other->size_, alignment));
+        }
+
+        buf.offset_ = offset;
+        temporary_offsets_[buf.index_] = offset;
+        planned_size = std::max(planned_size, offset + buf.size_);
+    }
+
+    size_t lower_bound = 0;
+    for (size_t t = 0; t <= time_point; t++) {
+        size_t live_size = 0;
+        for (const auto &buf : buffers) {
+            if (buf.live_range_.start_ <= t && t <= buf.live_range_.end_)
+                live_size += buf.size_;
+        }
+        lower_bound = std::max(lower_bound, live_size);
+    }
+
+    VINFO(graph, create, dispatch, memory_planning,
+            "temporary buffers:%zu,planned size:%zu,lower bound:%zu",
+            buffers.size(), planned_size, lower_bound);
+    return status::success;
+}
+
 status_t memory_planner_t::prepare_subgraph_inplace_pairs(
         std::shared_ptr<subgraph_t> &sg, bool enable_standard_sharing) {
     size_t time_point = 0;
@@ -615,7 +914,13 @@ status_t memory_planner_t::prepare_subgraph_inplace_pairs(
 
                 auto in_val = cur_op->get_input_value(pair.in_idx_);
                 auto in_buf = buffer_assignments_.at(in_val.get());
-                if (in_buf.kind_ != external_input) continue;
+                if (in_buf.kind_ != external_input || in_buf.offset_ != 0)
+                    continue;
+                // other consumers may run concurrently with an inter-op
+                // schedule
+                if (!sg->op_steps_.empty()
+                        && in_val->get_consumers().size() > 1)
+                    continue;
 
                 in_lt = sg->ins_[in_buf.index_];
                 inplace_shared = true;
@@ -727,10 +1032,16 @@ status_t memory_planner_t::book_buffers(std::shared_ptr<subgraph_t> &sg) {
             case external_input:
             case external_output: break;
             // book buffers for internal temporary and persistent
-            case internal_temporary:
-                temporary_registrar.book(info.index_,
-                        temporary_buffer_assigner_.query_size(info.index_));
+            case internal_temporary: {
+                const size_t size
+                        = temporary_buffer_assigner_.query_size(info.index_);
+                auto pos = temporary_offsets_.find(info.index_);
+                if (pos != temporary_offsets_.end())
+                    temporary_registrar.book_at(info.index_, size, pos->second);
+                else
+                    temporary_registrar.book(info.index_, size);
                 break;
+            }
             case internal_persistent:
                 persistent_registrar.book(info.index_,
                         persistent_buffer_assigner_.query_size(info.index_));
@@ -768,6 +1079,8 @@ status_t memory_planner_t::prepare_execution_args_set(
                 break;
             default: break;
         }
+        if (info.offset_ != 0)
+            exec_args_set_.add_mem_use_view_offset({mem, info.offset_});
     };
 
     // create memory object for each value, and classify the memory objects into
@@ -847,6 +1160,7 @@ status_t memory_planner_t::prepare_execution_args_set(
 // - Count the reference count of each edges. the reference count will be used
 //   during assign temporary buffer to determine which edge's buffer can be
 //   reused since it ref count reduce to zero.
+// - Find the values that can be views into the buffer of another value.
 // - Assign external user given inputs/outputs buffer to corresponding edges
 // - Assign internal allocated temporary buffer to corresponding edges.
 // - Assign internal allocated persistent buffer to corresponding edges.
@@ -885,6 +1199,19 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
         }
     }
 
+    // By default, the kernels that support the zero-copy views get them. The
+    // env var is for debugging purpose only and may be removed without any
+    // prior notice.
+    // The views are only done on the CPU engine with a native runtime, where
+    // the data handles can be shifted freely.
+    bool enable_buffer_views = enable_buffer_views_
+            && p_engine.get_kind() == dnnl::engine::kind::cpu
+            && graph::utils::getenv_int_internal("ENABLE_MEM_VIEWS", 1) > 0;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+    enable_buffer_views = false;
+#endif
+    if (enable_buffer_views) CHECK(prepare_buffer_views(sg));
+
     // Assign external_input buffers to subgraph's inputs and their alias
     CHECK(assign_external_inputs_buffer(sg, inputs));
 
@@ -909,9 +1236,27 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
         }
     }
 
+    // By default, the temporary buffers share memory through the offsets
+    // assigned over their live ranges. The env var is for debugging purpose
+    // only and may be removed without any prior notice.
+    bool enable_offset_planning = enable_memory_sharing
+            && graph::utils::getenv_int_internal(
+                       "ENABLE_MEM_OFFSET_PLANNING", 1)
+                    > 0;
+    // the sharing through the free list follows the topological order, so the
+    // ops can't run out of it
+    if (enable_memory_sharing && !enable_offset_planning) {
+        sg->op_steps_.clear();
+        sg->op_nthr_.clear();
+    }
+
     // Re-assign internal temporary buffer for reset ones (will re-do memory
-    // sharing between temporary buffers)
-    CHECK(assign_internal_temporary_buffer(sg, edge_ref_count, true));
+    // sharing between temporary buffers). With the offset assignment, each
+    // value gets its own buffer except for inplace and alias ones, and the
+    // sharing is decided by the offsets instead.
+    CHECK(assign_internal_temporary_buffer(
+            sg, edge_ref_count, !enable_offset_planning));
+    if (enable_offset_planning) CHECK(plan_internal_temporary_offsets(sg));
     // Check which input/output pair of the subgraph can be inplaced
     CHECK(prepare_subgraph_inplace_pairs(sg, false));
 
@@ -86,6 +86,11 @@ public:
         return mems_use_internal_persistent_;
     }
 
+    const std::vector<std::pair<dnnl::memory, size_t>> &
+    get_mems_use_view_offsets() const {
+        return mems_use_view_offsets_;
+    }
+
     std::vector<dnnl::memory::desc> get_persistent_mem_desc_list() const {
         std::vector<dnnl::memory::desc> mds;
         mds.reserve(mems_use_internal_persistent_.size());
@@ -130,6 +135,11 @@ public:
         mems_use_internal_persistent_.emplace_back(mem_offkey);
     }
 
+    void add_mem_use_view_offset(
+            const std::pair<dnnl::memory, size_t> &mem_offset) {
+        mems_use_view_offsets_.emplace_back(mem_offset);
+    }
+
     // finders
     bool find_value_mem_map(value_t *key, memory &mem) const {
         auto pos = value_mem_map_.find(key);
@@ -151,6 +161,10 @@ private:
     // memory <-> offset key of used underlying buffer in the internal
     // persistent registry
     std::vector<std::pair<dnnl::memory, size_t>> mems_use_internal_persistent_;
+    // memory <-> byte offset into the underlying buffer, for the memories of
+    // the values that are views into the buffer of another value. The offset
+    // is added to the data handle after it's set from one of the lists above
+    std::vector<std::pair<dnnl::memory, size_t>> mems_use_view_offsets_;
     // value pointer -> memory
     std::unordered_map<value_t *, memory> value_mem_map_;
     // execution args for each op in the subgraph
@@ -298,10 +312,29 @@ private:
 //   as an example: when writing data to t4, t2 is not used any more, so they
 //   have disjoint live range and we can make them share same buffer.
 //
+// - Zero-copy views. The inputs of a concat op that are contiguous slices of
+//   its output are placed into the output buffer, and the same is done for the
+//   outputs of a split op and its input, so that the op doesn't copy anything.
+//   The views are enabled on demand by the kernels that shift the data handles
+//   of the views when preparing the execution args.
+//
+// Internal temporary buffers are placed into the scratchpad by a greedy-by-size
+// offset assignment over their live ranges: buffers are placed from the
+// largest to the smallest at the lowest aligned offset that doesn't overlap
+// any already placed buffer with an intersecting live range. Inplace and alias
+// values share one buffer whose live range covers all of them.
+//
 // The following internal env vars can be used to control the memory planning:
 // - _ONEDNN_GRAPH_ENABLE_MEM_REUSE
 //     - 0: Disable memory sharing
 //     - 1 (default): Enable memory sharing
+// - _ONEDNN_GRAPH_ENABLE_MEM_OFFSET_PLANNING
+//     - 0: Share temporary buffers through the free list of the buffer
+//       assigner instead of the offset assignment
+//     - 1 (default): Enable the offset assignment
+// - _ONEDNN_GRAPH_ENABLE_MEM_VIEWS
+//     - 0: Disable the zero-copy views
+//     - 1 (default): Enable the zero-copy views if the kernel supports them
 class memory_planner_t {
 public:
     memory_planner_t()
@@ -330,6 +363,10 @@ public:
 
     execution_args_set_t &get_exec_args_set() { return exec_args_set_; }
 
+    // The kernel must apply the offsets of get_mems_use_view_offsets() to the
+    // data handles when views are enabled
+    void set_enable_buffer_views(bool enable) { enable_buffer_views_ = enable; }
+
     status_t run(std::shared_ptr<subgraph_t> &sg);
 
     const std::vector<inplace_pair_t> &get_subgraph_inplace_pairs() const {
@@ -354,6 +391,7 @@ public:
         }
 
         str += std::to_string(info.index_);
+        if (info.offset_) str += "+" + std::to_string(info.offset_);
         return str;
     }
 
@@ -367,15 +405,16 @@ private:
 
     class assign_info_t {
     public:
-        assign_info_t(buffer_kind_t kind, size_t index)
-            : kind_(kind), index_(index) {}
+        assign_info_t(buffer_kind_t kind, size_t index, size_t offset = 0)
+            : kind_(kind), index_(index), offset_(offset) {}
 
         assign_info_t() = default;
         assign_info_t(const assign_info_t &other) = default;
         assign_info_t &operator=(const assign_info_t &other) = default;
 
         bool operator==(const assign_info_t &other) const {
-            return kind_ == other.kind_ && index_ == other.index_;
+            return kind_ == other.kind_ && index_ == other.index_
+                    && offset_ == other.offset_;
         }
 
         bool operator!=(const assign_info_t &other) const {
@@ -384,6 +423,14 @@ private:
 
         buffer_kind_t kind_;
         size_t index_; // the index to allocated buffer
+        size_t offset_ = 0; // the byte offset of a view into the buffer
+    };
+
+    struct view_info_t {
+        // the value whose buffer holds the view
+        const value_t *base_;
+        // the byte offset of the view into the buffer of the base
+        size_t offset_;
     };
 
     struct time_bound_t {
@@ -401,8 +448,12 @@ private:
         temporary_registry_.clear();
         external_inputs_live_range_.clear();
         inplace_pairs_.clear();
+        temporary_offsets_.clear();
+        views_.clear();
     }
 
+    status_t prepare_buffer_views(std::shared_ptr<subgraph_t> &sg);
+
     status_t assign_external_inputs_buffer(std::shared_ptr<subgraph_t> &sg,
             const std::vector<logical_tensor_t> &inputs);
 
@@ -415,6 +466,8 @@ private:
             const std::unordered_map<value_t *, size_t> &edge_ref_count,
             bool enable_standard_sharing);
 
+    status_t plan_internal_temporary_offsets(std::shared_ptr<subgraph_t> &sg);
+
     status_t prepare_subgraph_inplace_pairs(
             std::shared_ptr<subgraph_t> &sg, bool enable_standard_sharing);
 
@@ -436,6 +489,13 @@ private:
     std::unordered_map<const assign_info_t *, time_bound_t>
             external_inputs_live_range_;
     std::vector<inplace_pair_t> inplace_pairs_;
+    // offsets of internal temporary buffers computed by the offset assignment,
+    // empty if it is disabled
+    std::unordered_map<size_t, size_t> temporary_offsets_;
+    // values placed into the buffer of another value, empty if the views are
+    // disabled
+    std::unordered_map<const value_t *, view_info_t> views_;
+    bool enable_buffer_views_ = false;
 };
 
 } // namespace dnnl_impl
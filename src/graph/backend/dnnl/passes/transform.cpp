@@ -33,6 +33,7 @@
 #include "graph/interface/shape_infer.hpp"
 #include "graph/utils/utils.hpp"
 
+#include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
 #include "graph/backend/dnnl/fusion_info.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
 #include "graph/backend/dnnl/passes/insert_ops.hpp"
@@ -2686,6 +2687,16 @@ status_t fuse_adjacent_reorders(std::shared_ptr<subgraph_t> &sg) {
             if (op->num_inputs() > 1 || next_op.num_inputs() > 1)
                 return status::success;
 
+            // eltwise post-ops can't be folded into the scales and zps below
+            auto has_post_ops = [](const op_t *o) {
+                return o->has_attr(op_attr::fusion_info)
+                        && !o->get_attr<fusion_info_t>(op_attr::fusion_info)
+                                    .get_post_ops()
+                                    .empty();
+            };
+            if (has_post_ops(op) || has_post_ops(&next_op))
+                return status::success;
+
             // two reorders should have same shape
             auto next_op_out = next_op.get_output_value(0);
             auto lhs = out_val->get_logical_tensor();
@@ -4972,6 +4983,286 @@ status_t fuse_gated_mlp(std::shared_ptr<subgraph_t> &sg) {
     return status::success;
 }
 
+status_t fuse_sibling_matmuls(std::shared_ptr<subgraph_t> &sg) {
+    if (sg->get_engine_kind() != graph::engine_kind::cpu
+            || !is_constant_cache_enabled(*sg->p_engine_))
+        return status::success;
+
+    const auto is_constant = [](const value_ptr &val) {
+        return val->get_logical_tensor().property == property_type::constant;
+    };
+    const auto with_bias = [](const op_t &op) {
+        return op.has_attr(op_attr::with_bias)
+                && op.get_attr<bool>(op_attr::with_bias);
+    };
+    const auto transpose_b = [](const op_t &op) {
+        return op.has_attr(op_attr::transpose_b)
+                && op.get_attr<bool>(op_attr::transpose_b);
+    };
+    const auto transpose_a = [](const op_t &op) {
+        return op.has_attr(op_attr::transpose_a)
+                && op.get_attr<bool>(op_attr::transpose_a);
+    };
+    // N and K of the 2D weights
+    const auto get_n = [&](const op_t &op) {
+        const auto wei = ltw(op.get_input_logical_tensor(1));
+        return wei.dims()[transpose_b(op) ? 0 : 1];
+    };
+    const auto get_k = [&](const op_t &op) {
+        const auto wei = ltw(op.get_input_logical_tensor(1));
+        return wei.dims()[transpose_b(op) ? 1 : 0];
+    };
+
+    const auto can_merge = [&](const op_t &op) {
+        if (op.get_kind() != op_kind::_matmul
+                || op.has_attr(op_attr::fusion_info))
+            return false;
+        if (op.num_inputs() != (with_bias(op) ? 3U : 2U)) return false;
+        const auto wei = ltw(op.get_input_logical_tensor(1));
+        if (wei.ndims() != 2 || wei.is_shape_unknown()
+                || !is_constant(op.get_input_value(1)))
+            return false;
+        if (with_bias(op)) {
+            const auto bia = ltw(op.get_input_logical_tensor(2));
+            if (bia.ndims() != 1 || bia.dims()[0] != get_n(op)
+                    || !is_constant(op.get_input_value(2)))
+                return false;
+        }
+        return true;
+    };
+    const auto dt = [](const op_t &op, size_t idx) {
+        return op.get_input_logical_tensor(idx).data_type;
+    };
+    const auto can_merge_with = [&](const op_t &a, const op_t &b) {
+        if (a.get_input_value(0) != b.get_input_value(0)
+                || transpose_a(a) != transpose_a(b)
+                || transpose_b(a) != transpose_b(b)
+                || with_bias(a) != with_bias(b) || get_k(a) != get_k(b)
+                || dt(a, 1) != dt(b, 1)
+                || a.get_output_logical_tensor(0).data_type
+                        != b.get_output_logical_tensor(0).data_type)
+            return false;
+        return !with_bias(a) || dt(a, 2) == dt(b, 2);
+    };
+
+    std::vector<std::vector<op_ptr>> groups;
+    for (const auto &op : sg->get_ops()) {
+        if (!can_merge(*op)) continue;
+        auto it = std::find_if(groups.begin(), groups.end(),
+                [&](const std::vector<op_ptr> &group) {
+                    return can_merge_with(*group[0], *op);
+                });
+        if (it == groups.end())
+            groups.push_back({op});
+        else
+            it->emplace_back(op);
+    }
+
+    subgraph_rewriter_t rewriter(sg);
+    for (const auto &group : groups) {
+        if (group.size() < 2) continue;
+        const op_t &front = *group[0];
+
+        // concatenates the input idx of the matmuls along an axis
+        const auto concat_inputs = [&](size_t idx, int64_t axis) {
+            op_ptr concat_op = std::make_shared<op_t>(op_kind::_concat);
+            concat_op->set_attr<int64_t>(op_attr::axis, axis);
+            for (size_t i = 0; i < group.size(); ++i) {
+                auto in_val = group[i]->get_input_value(idx);
+                in_val->remove_consumer(*group[i], idx);
+                concat_op->connect_input(i, in_val);
+            }
+            logical_tensor_t lt = empty_logical_tensor_with_default_id();
+            auto out_val = std::make_shared<value_t>(*concat_op, 0, lt, true);
+            out_val->set_data_type(dt(front, idx));
+            concat_op->add_output(out_val);
+            insert_empty_scratchpad(concat_op);
+            rewriter.to_insert(concat_op);
+            return out_val;
+        };
+
+        std::vector<int64_t> sizes;
+        for (const auto &op : group)
+            sizes.emplace_back(get_n(*op));
+
+        op_ptr matmul_op = std::make_shared<op_t>(op_kind::_matmul);
+        matmul_op->merge_attributes(front.get_attributes());
+        auto src_val = front.get_input_value(0);
+        for (const auto &op : group)
+            src_val->remove_consumer(*op, 0);
+        matmul_op->connect_input(0, src_val);
+        const int64_t wei_axis = transpose_b(front) ? 0 : 1;
+        matmul_op->connect_input(1, concat_inputs(1, wei_axis));
+        if (with_bias(front)) matmul_op->connect_input(2, concat_inputs(2, 0));
+        logical_tensor_t lt = empty_logical_tensor_with_default_id();
+        auto matmul_dst = std::make_shared<value_t>(*matmul_op, 0, lt, true);
+        matmul_dst->set_data_type(front.get_output_logical_tensor(0).data_type);
+        matmul_op->add_output(matmul_dst);
+        insert_empty_scratchpad(matmul_op);
+
+        op_ptr split_op = std::make_shared<op_t>(op_kind::_split);
+        split_op->set_attr<int64_t>(op_attr::axis, -1);
+        split_op->set_attr<std::vector<int64_t>>(op_attr::sizes, sizes);
+        split_op->connect_input(0, matmul_dst);
+        for (const auto &op : group) {
+            split_op->add_output(op->get_output_value(0));
+            rewriter.to_remove(op);
+        }
+
+        rewriter.to_insert(matmul_op);
+        rewriter.to_insert(split_op);
+    }
+    rewriter.run();
+
+    return infer_shape(sg);
+}
+
+status_t fuse_residual_add_to_layernorm(std::shared_ptr<subgraph_t> &sg) {
+    if (sg->get_engine_kind() != graph::engine_kind::cpu)
+        return status::success;
+
+    namespace dt = graph::data_type;
+    const auto is_per_tensor = [](const op_t &op) {
+        if (op.has_attr(op_attr::qtype)
+                && op.get_attr<std::string>(op_attr::qtype) != "per_tensor")
+            return false;
+        if (op.get_kind() == op_kind::_mul_scales) {
+            return !(op.has_attr(op_attr::with_runtime_scales)
+                           && op.get_attr<bool>(op_attr::with_runtime_scales))
+                    && op.get_attr<std::vector<float>>(op_attr::scales).size()
+                    == 1;
+        }
+        return !(op.has_attr(op_attr::with_runtime_zps)
+                       && op.get_attr<bool>(op_attr::with_runtime_zps))
+                && op.get_attr<std::vector<int64_t>>(op_attr::zps).size() == 1;
+    };
+
+    std::vector<std::vector<op_t *>> fusion_groups;
+    for (auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::_layernorm) continue;
+        op_t *ln = cur_op.get();
+        if (ln->has_attr(op_attr::fusion_info)) continue;
+        if (ln->has_attr(op_attr::keep_stats)
+                && ln->get_attr<bool>(op_attr::keep_stats))
+            continue;
+
+        const auto src = ltw(ln->get_input_logical_tensor(0));
+        if (src.ndims() < 1 || src.has_zero_dim()) continue;
+        if (ln->has_attr(op_attr::begin_norm_axis)) {
+            const auto axis = ln->get_attr<int64_t>(op_attr::begin_norm_axis);
+            if (axis != -1 && axis != src.ndims() - 1) continue;
+        }
+        if (!impl::utils::one_of(src.data_type(), dt::f32, dt::bf16, dt::f16))
+            continue;
+        bool f32_scale_shift = true;
+        for (size_t i = 1; i < ln->num_inputs(); ++i)
+            f32_scale_shift = f32_scale_shift
+                    && ln->get_input_logical_tensor(i).data_type == dt::f32;
+        if (!f32_scale_shift) continue;
+
+        auto src_val = ln->get_input_value(0);
+        if (!src_val->has_producer()) continue;
+        op_t *add = &src_val->get_producer();
+        if (add->get_kind() != op_kind::_binary || add->num_inputs() != 2
+                || add->has_attr(op_attr::fusion_info))
+            continue;
+        if (static_cast<dnnl::algorithm>(
+                    add->get_attr<int64_t>(op_attr::alg_kind))
+                != dnnl::algorithm::binary_add)
+            continue;
+        bool same_inputs = true;
+        for (size_t i = 0; i < 2; ++i) {
+            const auto in = ltw(add->get_input_logical_tensor(i));
+            same_inputs = same_inputs && in.vdims() == src.vdims()
+                    && in.data_type() == src.data_type();
+        }
+        if (!same_inputs) continue;
+
+        // the normalized output may only go through the quantization
+        std::vector<op_t *> group {add, ln};
+        value_ptr out_val = ln->get_output_value(0);
+        bool fusible = true;
+        for (op_kind_t kind : {op_kind::_mul_scales, op_kind::_add_zps}) {
+            const auto &consumers = out_val->get_consumers();
+            if (consumers.empty()) break;
+            op_t &next = consumers[0].get_op();
+            if (consumers.size() != 1) {
+                fusible = false;
+                break;
+            }
+            if (next.get_kind() != kind) continue;
+            if (!is_per_tensor(next)) {
+                fusible = false;
+                break;
+            }
+            group.emplace_back(&next);
+            out_val = next.get_output_value(0);
+        }
+        if (!fusible || !out_val->get_consumers().empty()) continue;
+        const auto dst_dt = out_val->get_logical_tensor().data_type;
+        if (!impl::utils::one_of(dst_dt, dt::f32, dt::bf16, dt::f16, dt::s8,
+                    dt::u8, dt::f8_e5m2, dt::f8_e4m3))
+            continue;
+
+        fusion_groups.emplace_back(group);
+    }
+
+    if (fusion_groups.empty()) return status::success;
+
+    subgraph_rewriter_t rewriter(sg);
+    for (const auto &group : fusion_groups) {
+        op_t *add = group[0];
+        op_t *ln = group[1];
+
+        op_ptr fused_op = std::make_shared<op_t>(op_kind::_residual_layernorm);
+        if (ln->has_attr(op_attr::epsilon))
+            fused_op->set_attr<float>(
+                    op_attr::epsilon, ln->get_attr<float>(op_attr::epsilon));
+        if (ln->has_attr(op_attr::is_rms))
+            fused_op->set_attr<bool>(
+                    op_attr::is_rms, ln->get_attr<bool>(op_attr::is_rms));
+        fused_op->set_attr<bool>(op_attr::use_affine, ln->num_inputs() > 1);
+
+        for (size_t i = 0; i < 2; ++i) {
+            auto in_val = add->get_input_value(i);
+            in_val->remove_consumer(*add, i);
+            fused_op->connect_input(i, in_val);
+        }
+        for (size_t i = 1; i < ln->num_inputs(); ++i) {
+            auto in_val = ln->get_input_value(i);
+            in_val->remove_consumer(*ln, i);
+            fused_op->connect_input(i + 1, in_val);
+        }
+
+        value_ptr dst_val = ln->get_output_value(0);
+        for (size_t i = 2; i < group.size(); ++i) {
+            op_t *quant_op = group[i];
+            if (quant_op->get_kind() == op_kind::_mul_scales) {
+                fused_op->set_attr<std::vector<float>>(op_attr::scales,
+                        quant_op->get_attr<std::vector<float>>(
+                                op_attr::scales));
+            } else {
+                fused_op->set_attr<std::vector<int64_t>>(op_attr::zps,
+                        quant_op->get_attr<std::vector<int64_t>>(
+                                op_attr::zps));
+            }
+            dst_val = quant_op->get_output_value(0);
+        }
+        fused_op->add_output(dst_val);
+
+        value_ptr res_val = add->get_output_value(0);
+        res_val->remove_consumer(*ln, 0);
+        fused_op->add_output(res_val);
+
+        for (op_t *op : group)
+            rewriter.to_remove(op->shared_from_this());
+        rewriter.to_insert(fused_op);
+    }
+
+    rewriter.run();
+    return status::success;
+}
+
 // Fuses a backward SDPA subgraph into a single _sdpa_bwd op.
 //
 // Pattern (all optional nodes indicated with []):
@@ -307,6 +307,43 @@ status_t fuse_sdpa_bwd(std::shared_ptr<subgraph_t> &sg);
 /// This pass will transform the gated mlp subgraph into a _gated_mlp op.
 status_t fuse_gated_mlp(std::shared_ptr<subgraph_t> &sg);
 
+/// This pass will merge the matmuls which share the same src, and whose
+/// constant weights and biases can be concatenated along the N dimension,
+/// into a single wide matmul followed by a split of the output:
+///
+///          src                          src   [w0|w1|w2]
+///       /   |   \                          \   /
+///  matmul matmul matmul         =>        matmul
+///     |     |     |                         |
+///  [dst0] [dst1] [dst2]                   split
+///                                       /   |   \
+///                                  [dst0] [dst1] [dst2]
+///
+/// src is read only once and the wide matmul has more parallelism along N.
+/// The concatenation of the weights is computed once and cached, so the
+/// pass is only applied on CPU with the constant tensor cache enabled.
+status_t fuse_sibling_matmuls(std::shared_ptr<subgraph_t> &sg);
+
+/// This pass will transform a residual add followed by a layernorm or rmsnorm
+/// over the last axis, and the optional quantization of the normalized output,
+/// into a _residual_layernorm op, which passes over each row only once:
+///
+///     in0   in1                in0   in1
+///       \   /                    \   /
+///        add ----> [residual]   _residual_layernorm ---> [residual]
+///         |                 =>          |
+///     layernorm                       [dst]
+///         |
+///   [mul_scales]*
+///         |
+///     [add_zps]*
+///         |
+///       [dst]
+///
+/// The fusion is only done on CPU, for dense inputs of the same shape and for
+/// per-tensor quantization parameters, otherwise the subgraph is left intact.
+status_t fuse_residual_add_to_layernorm(std::shared_ptr<subgraph_t> &sg);
+
 /// This pass will decompose the softmax with stats output into a normal softmax
 /// without stats output and some small ops to compute the stats.
 /// The main reason for this pass is that the current implementation
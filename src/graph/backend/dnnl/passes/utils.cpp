@@ -392,8 +392,9 @@ bool post_binary_fusible(
     auto other_in = bin_op->get_input_logical_tensor(1 - fused_in_off);
 
     // Special check: dnnl_reorder only support fuse non-broadcast binary_add as
-    // post-sum
-    if (base_op->get_kind() == op_kind::_reorder) {
+    // post-sum, except on CPU where the reference reorder applies any binary
+    // post-op
+    if (base_op->get_kind() == op_kind::_reorder && ekind != dnnl_cpu) {
         if (ltw(fused_in).vdims() != ltw(other_in).vdims()
                 || static_cast<dnnl::algorithm>(
                            bin_op->get_attr<int64_t>(op_attr::alg_kind))
@@ -438,6 +439,10 @@ bool post_eltwise_fusible(
         return !fusion_info.with_dropout();
     }
 
+    // eltwise post-ops of reorder are only implemented on CPU
+    if (base_op->get_kind() == op_kind::_reorder && ekind != dnnl_cpu)
+        return false;
+
 // binary + sqrt post-op fusion is unsupported on NVIDIA GPU
 #if DNNL_GPU_RUNTIME != DNNL_RUNTIME_NONE \
         && DNNL_GPU_VENDOR == DNNL_VENDOR_NVIDIA
@@ -542,7 +547,7 @@ get_post_ops_fusible_map() {
                     {_reduction, {_eltwise, _binary}},
                     // resample
                     {_resampling, {_eltwise, _binary}},
-                    {_reorder, {_binary}},
+                    {_reorder, {_eltwise, _binary}},
                     {_softmax, {_eltwise, _binary}},
                     {_layernorm, {_eltwise, _binary}},
                     {_groupnorm, {_eltwise, _binary}},
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "graph/backend/dnnl/kernels/batch_norm.hpp"
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
 #include "graph/backend/dnnl/patterns/fusions.hpp"
 #include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
 #include "graph/backend/dnnl/patterns/utils.hpp"
@@ -122,6 +123,41 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_bnorm_bwd_relu_bwd)
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
             return std::make_shared<batch_norm_bwd_t>();
         });
+
+/*
+      relu_bwd
+         |
+       bn_bwd
+         |
+   conv_bwd_data
+
+The backward of a conv + batchnorm + relu block is compiled as one partition,
+so that the diff tensors passed between the three ops stay in the partition
+scratchpad instead of being written out to the user buffers.
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
+        dnnl, fp_bnorm_bwd_relu_bwd_conv_bwd_data)
+        .set_priority(9.0f)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto relu_bwd
+                            = pgraph->append_op(graph::op_kind::ReLUBackward);
+                    auto bn_bwd = pgraph->append_op(
+                            graph::op_kind::BatchNormTrainingBackward,
+                            {in_edge(0, relu_bwd, 0)});
+                    bn_bwd->append_decision_function(
+                            check_input_dtype_from_offset<impl::data_type::f32,
+                                    2>);
+                    bn_bwd->BATCHNORM_OUTPUT_NUM_CHECK(1, 3);
+                    auto conv_bwd_data = pgraph->append_op(
+                            graph::op_kind::ConvolutionBackwardData,
+                            {in_edge(0, bn_bwd, 0)});
+                    conv_bwd_data->append_decision_function(check_input_num<2>);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
 #endif
 
 DNNL_BACKEND_REGISTER_PATTERN_DEF_END
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+
 #include "graph/backend/dnnl/kernels/conv.hpp"
 #include "graph/backend/dnnl/patterns/fusions.hpp"
 #include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
@@ -54,6 +56,24 @@ bool check_f8_conv_with_no_scale_and_zp(op_t *op) {
     return true;
 }
 
+// Returns the BiasAddBackward reducing the diff_dst of a
+// ConvolutionBackwardWeights, if it isn't in a partition yet.
+op_t *get_bias_add_bwd(const op_t *conv) {
+    const auto get_format = [](const op_t *op) {
+        return op->has_attr(op_attr::data_format)
+                ? op->get_attr<std::string>(op_attr::data_format)
+                : std::string("NXC");
+    };
+    for (const auto &csm : conv->get_input_value(1)->get_consumers()) {
+        op_t *op = &csm.get_op();
+        if (op->get_kind() == graph::op_kind::BiasAddBackward
+                && !op->get_partition()
+                && get_format(op) == get_format(conv))
+            return op;
+    }
+    return nullptr;
+}
+
 } // namespace
 
 namespace pm = graph::utils::pm;
@@ -61,6 +81,59 @@ using in_edges_t = pm::in_edges_t;
 using pb_graph_t = pm::pb_graph_t;
 using FCreatePattern = graph::pass::FCreatePattern;
 
+// The pattern matches single ConvolutionBackwardWeights, which are grouped
+// with the BiasAddBackward reading the same diff_dst. The two ops have no edge
+// to each other, so they can't be described by one pattern graph.
+class conv_bwd_weights_bias_pass_t : public pattern_matcher_pass_t {
+public:
+    explicit conv_bwd_weights_bias_pass_t(
+            std::string pbackend, std::string pname)
+        : pattern_matcher_pass_t(std::move(pbackend), std::move(pname)) {}
+
+    static graph::pass::pass_base_ptr create(
+            std::string pbackend, std::string pname) {
+        return std::make_shared<conv_bwd_weights_bias_pass_t>(
+                std::move(pbackend), std::move(pname));
+    }
+
+    impl::status_t run(graph_t &agraph) override {
+        engine_kind_t graph_engine_kind = agraph.get_engine_kind();
+        if (get_engine_kind() != engine_kind::any_engine
+                && get_engine_kind() != graph_engine_kind)
+            return impl::status::success;
+
+        const auto &pgraph = get_attr<graph::pass::Pattern>("Pattern")[0];
+        pattern_utils_t pu;
+        std::vector<std::vector<op_t *>> matched_ops;
+        pu.match(agraph, pgraph, matched_ops);
+
+        std::vector<std::vector<op_t *>> fusion_ops;
+        for (const auto &ops : matched_ops) {
+            op_t *bias_bwd = get_bias_add_bwd(ops[0]);
+            // a diff_dst shared by several convs has its bias gradient
+            // computed by the first one
+            if (!bias_bwd
+                    || std::any_of(fusion_ops.begin(), fusion_ops.end(),
+                            [&](const std::vector<op_t *> &pair) {
+                                return pair[1] == bias_bwd;
+                            }))
+                continue;
+            fusion_ops.push_back({ops[0], bias_bwd});
+        }
+        if (fusion_ops.empty()) return impl::status::success;
+
+        if (graph::utils::get_graph_dump_mode(
+                    graph::graph_dump_mode_t::pattern)) {
+            verbose_printf(
+                    "graph,info,pattern,hit,%s\n", get_pass_name().c_str());
+        }
+        pu.init_partition(agraph, fusion_ops,
+                get_attr<FCreateKernel>("FCreateKernel")[0], get_kind(),
+                get_pass_name());
+        return impl::status::success;
+    }
+};
+
 DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(conv_post_ops)
 
 // Conv: Currently DNNL backend doesn't support conv + depthwise conv
@@ -826,28 +899,23 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
         });
 
 /*
-                  wildcard
+                  diff_dst
               \   /      \
       conv_bwd_weight  biasadd_bwd
                 |          |
 */
 #if BUILD_TRAINING
-DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_conv_bwd_weights_bias)
-        .set_enable(false)
+registry.register_pass("dnnl", "fp_conv_bwd_weights_bias",
+                &conv_bwd_weights_bias_pass_t::create)
         .set_kind(partition_kind_t::convolution_backward_post_ops)
         .set_priority(9.7f)
         .set_attr<FCreatePattern>("FCreatePattern",
                 [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
-                    pm::pb_op_t *wildcard
-                            = pgraph->append_op(graph::op_kind::Wildcard);
                     graph::utils::pm::pb_op_t *p_conv_backward_weights
                             = pgraph->append_op(
-                                    graph::op_kind::ConvolutionBackwardWeights,
-                                    in_edges_t {in_edge(1, wildcard, 0)});
+                                    graph::op_kind::ConvolutionBackwardWeights);
                     p_conv_backward_weights->append_decision_function(
                             check_input_num<2>);
-                    pgraph->append_op(graph::op_kind::BiasAddBackward,
-                            in_edges_t {in_edge(0, wildcard, 0)});
                 })
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
             return std::make_shared<conv_bwd_weights_t>();
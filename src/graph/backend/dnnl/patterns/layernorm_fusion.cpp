@@ -89,6 +89,62 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, layernorm_post_ops_fusion_cpu)
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
             return std::make_shared<layer_norm_fwd_t>();
         });
+
+//    in0   in1
+//      \   /
+//       Add ---> [residual]
+//        |
+// LayerNorm | RMSNorm
+//        |
+//   [TypeCast]*
+//        |
+//     Quantize
+//
+// The sum is also an output of the partition, and the whole chain is
+// computed with a single pass over each row on CPU.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
+        dnnl, residual_add_layernorm_quant_fusion_cpu)
+        .set_priority(8.4f)
+        .set_kind(graph::partition_kind_t::misc_quantized_post_ops)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *padd = pgraph->append_op(graph::op_kind::Add);
+                    padd->allow_external_outputs();
+
+                    pm::pb_op_t *pnorm = pgraph->append_alternation(
+                            {graph::op_kind::LayerNorm,
+                                    graph::op_kind::RMSNorm},
+                            in_edges_t {in_edge(0, padd, 0)});
+                    pnorm->append_decision_function(
+                            check_input_dtype_from_offset<impl::data_type::f32,
+                                    1>);
+                    pnorm->append_decision_function(check_begin_norm_axis_attr);
+                    pnorm->append_decision_function(
+                            check_input_ndim_from_offset<0, 2, 5>);
+                    // the statistics are not outputs of the fused kernel
+                    pnorm->append_decision_function([](op_t *op) -> bool {
+                        return op->get_kind() == graph::op_kind::RMSNorm
+                                || (op->has_attr(op_attr::keep_stats)
+                                        && !op->get_attr<bool>(
+                                                op_attr::keep_stats));
+                    });
+
+                    // optional typecast
+                    auto tc_graph = std::make_shared<pb_graph_t>();
+                    pm::pb_op_t *ptypecast
+                            = tc_graph->append_op(graph::op_kind::TypeCast);
+                    tc_graph->create_input_port(0, ptypecast, 0);
+                    tc_graph->create_output_port(0, ptypecast, 0);
+                    auto pre_tc = pgraph->append_optional(
+                            tc_graph, in_edges_t {in_edge(0, pnorm, 0)});
+
+                    pgraph->append_op(graph::op_kind::Quantize,
+                            in_edges_t {in_edge(0, pre_tc, 0)});
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<layer_norm_fwd_t>();
+        });
 #endif
 DNNL_BACKEND_REGISTER_PATTERN_DEF_END
 
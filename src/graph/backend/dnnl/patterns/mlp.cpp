@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <set>
+
 #include "graph/backend/dnnl/kernels/gated_mlp.hpp"
 
 #include "graph/backend/dnnl/patterns/fusions.hpp"
@@ -33,6 +36,83 @@ using in_edges_t = pm::in_edges_t;
 using pb_graph_t = pm::pb_graph_t;
 using FCreatePattern = graph::pass::FCreatePattern;
 
+namespace {
+
+// A MatMul whose post-ops would be fused by the matmul patterns isn't merged
+// with its siblings, as the post-ops would then be left out.
+bool has_no_post_op_consumer(const op_t *op) {
+    static const std::set<op_kind_t> post_ops = [] {
+        std::set<op_kind_t> kinds(get_unary_binary_ops().begin(),
+                get_unary_binary_ops().end());
+        kinds.insert({graph::op_kind::BiasAdd, graph::op_kind::TypeCast,
+                graph::op_kind::Quantize, graph::op_kind::Select});
+        return kinds;
+    }();
+    for (const auto &csm : op->get_output_value(0)->get_consumers()) {
+        if (post_ops.count(csm.get_op().get_kind())) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+// The pattern matches single MatMuls, which are grouped into one partition
+// when they share the same src. The siblings have no edge to each other, so
+// they can't be described by one pattern graph.
+class sibling_matmul_pass_t : public pattern_matcher_pass_t {
+public:
+    explicit sibling_matmul_pass_t(std::string pbackend, std::string pname)
+        : pattern_matcher_pass_t(std::move(pbackend), std::move(pname)) {}
+
+    static graph::pass::pass_base_ptr create(
+            std::string pbackend, std::string pname) {
+        return std::make_shared<sibling_matmul_pass_t>(
+                std::move(pbackend), std::move(pname));
+    }
+
+    impl::status_t run(graph_t &agraph) override {
+        engine_kind_t graph_engine_kind = agraph.get_engine_kind();
+        if (get_engine_kind() != engine_kind::any_engine
+                && get_engine_kind() != graph_engine_kind)
+            return impl::status::success;
+
+        const auto &pgraph = get_attr<graph::pass::Pattern>("Pattern")[0];
+        pattern_utils_t pu;
+        std::vector<std::vector<op_t *>> matched_ops;
+        pu.match(agraph, pgraph, matched_ops);
+
+        std::vector<std::vector<op_t *>> fusion_ops;
+        for (const auto &ops : matched_ops) {
+            op_t *matmul = ops[0];
+            auto it = std::find_if(fusion_ops.begin(), fusion_ops.end(),
+                    [&](const std::vector<op_t *> &siblings) {
+                        return siblings[0]->get_input_value(0)
+                                == matmul->get_input_value(0);
+                    });
+            if (it == fusion_ops.end())
+                fusion_ops.push_back({matmul});
+            else
+                it->emplace_back(matmul);
+        }
+        fusion_ops.erase(std::remove_if(fusion_ops.begin(), fusion_ops.end(),
+                                 [](const std::vector<op_t *> &siblings) {
+                                     return siblings.size() < 2;
+                                 }),
+                fusion_ops.end());
+        if (fusion_ops.empty()) return impl::status::success;
+
+        if (graph::utils::get_graph_dump_mode(
+                    graph::graph_dump_mode_t::pattern)) {
+            verbose_printf(
+                    "graph,info,pattern,hit,%s\n", get_pass_name().c_str());
+        }
+        pu.init_partition(agraph, fusion_ops,
+                get_attr<FCreateKernel>("FCreateKernel")[0], get_kind(),
+                get_pass_name());
+        return impl::status::success;
+    }
+};
+
 DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(mlp)
 
 /*
@@ -248,6 +328,46 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, quantized_gated_mlp_v1)
             return std::make_shared<gated_mlp_base_t<true>>();
         });
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+/*
+//              src
+//        /      |      \
+//  matmul (q) matmul (k) matmul (v)
+//
+// The MatMuls sharing src, such as the Q, K and V or the gate and up
+// projections, are merged into one matmul with the concatenated weights.
+*/
+registry.register_pass("dnnl", "sibling_matmul_fusion_cpu",
+                &sibling_matmul_pass_t::create)
+        .set_priority(19.0f)
+        .set_kind(partition_kind_t::matmul_post_ops)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *matmul
+                            = pgraph->append_op(graph::op_kind::MatMul);
+                    matmul->append_decision_function(
+                            check_input_ndim_from_offset<1, 2, 2>);
+                    matmul->append_decision_function([](op_t *op) -> bool {
+                        // constant weights given by the user, and a src which
+                        // isn't dequantized by a quantized pattern
+                        if (op->get_input_value(1)->has_producer())
+                            return false;
+                        const auto &src = op->get_input_value(0);
+                        return !src->has_producer()
+                                || !impl::utils::one_of(
+                                        src->get_producer().get_kind(),
+                                        graph::op_kind::Dequantize,
+                                        graph::op_kind::DynamicDequantize,
+                                        graph::op_kind::TypeCast);
+                    });
+                    matmul->append_decision_function(has_no_post_op_consumer);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+#endif
+
 DNNL_BACKEND_REGISTER_PATTERN_DEF_END
 
 } // namespace pattern
@@ -42,7 +42,8 @@ public:
 
     inline void init_partition(graph_t &backend_graph,
             std::vector<std::vector<op_t *>> &fusion_ops,
-            const FCreateKernel &kernel_creator, partition_kind_t pkind);
+            const FCreateKernel &kernel_creator, partition_kind_t pkind,
+            const std::string &pass_name = std::string());
 
     pattern_utils_t() = default;
     pattern_utils_t(const pattern_utils_t &) = delete;
@@ -58,7 +59,8 @@ inline void pattern_utils_t::match(graph_t &backend_graph,
 
 inline void pattern_utils_t::init_partition(graph_t &backend_graph,
         std::vector<std::vector<op_t *>> &fusion_ops,
-        const FCreateKernel &kernel_creator, partition_kind_t pkind) {
+        const FCreateKernel &kernel_creator, partition_kind_t pkind,
+        const std::string &pass_name) {
     for (auto &pairs : fusion_ops) {
         std::shared_ptr<dnnl_partition_impl_t> pimpl
                 = std::make_shared<dnnl_partition_impl_t>(
@@ -71,7 +73,7 @@ inline void pattern_utils_t::init_partition(graph_t &backend_graph,
             // claim the op belong to the partition
             pairs[i]->set_partition(pimpl.get());
         }
-        pimpl->init(kernel_creator);
+        pimpl->init(kernel_creator, pass_name);
         backend_graph.add_partition(pimpl);
     }
 }
@@ -130,8 +132,8 @@ public:
                             get_pass_name().c_str());
                 }
 
-                pu.init_partition(
-                        agraph, fusion_ops, kernel_creator, get_kind());
+                pu.init_partition(agraph, fusion_ops, kernel_creator,
+                        get_kind(), get_pass_name());
             }
         }
         return impl::status::success;
@@ -70,6 +70,89 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, x8_reorder)
             return std::make_shared<quantized_reorder>();
         });
 
+/*
+Eltwise and binary post-ops of reorder are only implemented on CPU, where the
+whole chain, including a leading transpose that is taken as a strided view of
+the input, runs as a single reorder pass.
+[StaticTranspose]?
+      |
+Reorder | TypeCast
+      |
+[Unary | Binary]+
+*/
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_reorder_post_ops_cpu)
+        .set_priority(8.2f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph> &pgraph) -> void {
+                    auto transpose_subgraph = std::make_shared<pb_graph>();
+                    pm::pb_op_t *transpose = transpose_subgraph->append_op(
+                            graph::op_kind::StaticTranspose);
+                    transpose_subgraph->create_input_port(0, transpose, 0);
+                    transpose_subgraph->create_output_port(0, transpose, 0);
+                    pm::repetition_t *prep = pgraph->append_optional(
+                            transpose_subgraph);
+
+                    pm::pb_op_t *reorder = pgraph->append_alternation(
+                            {graph::op_kind::Reorder, graph::op_kind::TypeCast},
+                            {in_edge(0, prep, 0)});
+
+                    auto post_subgraph = std::make_shared<pb_graph>();
+                    pm::pb_op_t *post_op = post_subgraph->append_alternation(
+                            get_unary_binary_ops());
+                    post_op->allow_internal_inputs();
+                    post_subgraph->create_input_port(0, post_op, 0);
+                    post_subgraph->create_output_port(0, post_op, 0);
+                    pgraph->append_repetition(post_subgraph, {0, 0}, 1,
+                            MAX_REPETITION, {in_edge(0, reorder, 0)});
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<float_reorder>();
+        });
+
+// The same chain quantized to int8 at the end, the quantization taken as the
+// destination scales and zero points of the reorder.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
+        dnnl, fp_reorder_post_ops_quantize_cpu)
+        .set_priority(8.3f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::misc_quantized_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph> &pgraph) -> void {
+                    auto transpose_subgraph = std::make_shared<pb_graph>();
+                    pm::pb_op_t *transpose = transpose_subgraph->append_op(
+                            graph::op_kind::StaticTranspose);
+                    transpose_subgraph->create_input_port(0, transpose, 0);
+                    transpose_subgraph->create_output_port(0, transpose, 0);
+                    pm::repetition_t *prep = pgraph->append_optional(
+                            transpose_subgraph);
+
+                    pm::pb_op_t *reorder = pgraph->append_alternation(
+                            {graph::op_kind::Reorder, graph::op_kind::TypeCast},
+                            {in_edge(0, prep, 0)});
+
+                    auto post_subgraph = std::make_shared<pb_graph>();
+                    pm::pb_op_t *post_op = post_subgraph->append_alternation(
+                            get_unary_binary_ops());
+                    post_op->allow_internal_inputs();
+                    post_subgraph->create_input_port(0, post_op, 0);
+                    post_subgraph->create_output_port(0, post_op, 0);
+                    pm::repetition_t *post_ops = pgraph->append_repetition(
+                            post_subgraph, {0, 0}, 1, MAX_REPETITION,
+                            {in_edge(0, reorder, 0)});
+
+                    pm::pb_op_t *quant = pgraph->append_op(
+                            graph::op_kind::Quantize,
+                            {in_edge(0, post_ops, 0)});
+                    quant->append_decision_function(is_int8_quantization);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<quantized_reorder>();
+        });
+#endif
+
 /*
 Currently DNNL Backend doesn't support Post-sum/binary with zero points
 on GPU, while CPU supports.
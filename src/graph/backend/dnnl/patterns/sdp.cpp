@@ -160,6 +160,46 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_gemma_fusion_cpu)
             return std::make_shared<sdp_base_t<>>();
         });
 
+/*
+ [query] [cos] [sin]    [key] [cos] [sin]
+      \    |    /         \    |    /
+         RoPE                RoPE
+            \                /
+                  MatMul
+                    |
+         (same as float_sdp_fusion)
+
+The rotary positional embedding of query and key is fused into the partition,
+so the decomposed kernel rotates each head while it's copied to the thread
+local buffers instead of materializing the rotated tensors.
+*/
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_rope_fusion_cpu)
+        .set_priority(21.1f)
+        .set_kind(partition_kind_t::sdp)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto rope_q = pgraph->append_op(graph::op_kind::RoPE);
+                    auto rope_k = pgraph->append_op(graph::op_kind::RoPE);
+                    auto matmul_qk = pgraph->append_op(graph::op_kind::MatMul,
+                            {in_edge(0, rope_q, 0), in_edge(1, rope_k, 0)});
+                    auto optional_scale_and_mask
+                            = optional_scale_and_masks(pgraph, matmul_qk);
+                    auto softmax = pgraph->append_op(graph::op_kind::SoftMax,
+                            {in_edge(0, optional_scale_and_mask, 0)});
+                    // for xf16, there might be a typecast from f32 to xf16.
+                    auto tc = optional_typecast(pgraph, softmax);
+                    auto matmul_v = pgraph->append_op(
+                            graph::op_kind::MatMul, {in_edge(0, tc, 0)});
+                    // Optional transpose + reshape/reorder
+                    optional_transpose_reshape(pgraph, matmul_v, 0);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<sdp_base_t<>>();
+        });
+#endif
+
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_backward_fusion)
         .set_priority(21.0f)
         .set_kind(partition_kind_t::sdp)
@@ -448,6 +448,21 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, rmsn_pass)
             return std::make_shared<layer_norm_fwd_t>();
         });
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+// RoPE is computed by a hand-written kernel which is only available on CPU.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, rope_pass_cpu)
+        .set_priority(DEFAULT_P)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pgraph->append_op(graph::op_kind::RoPE);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+#endif
+
 #undef DNNL_BACKEND_SINGLE_OP_TRANSFORM
 #undef DEFAULT_P
 
@@ -16,6 +16,7 @@
 #ifndef GRAPH_BACKEND_DNNL_SCRATCHPAD_HPP
 #define GRAPH_BACKEND_DNNL_SCRATCHPAD_HPP
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <unordered_map>
@@ -129,6 +130,18 @@ public:
         lcm_alignment_ = graph::utils::lcm(lcm_alignment_, alignment);
     }
 
+    // book a piece of memory at an offset computed by the caller, which must
+    // be a multiple of the alignment. Pieces booked this way may overlap.
+    void book(const key_t &key, size_t size, size_t alignment,
+            offset_t offset) {
+        if (offset_map_.count(key)) return;
+
+        assertm(offset % alignment == 0, "unaligned offset");
+        offset_map_.insert({key, offset});
+        size_ = std::max(size_, offset + size);
+        lcm_alignment_ = graph::utils::lcm(lcm_alignment_, alignment);
+    }
+
     // get the offset of a booked piece of memory
     offset_t get(const key_t &key) const {
         if (size_ == 0 || offset_map_.count(key) != 1) return 0;
@@ -170,6 +183,11 @@ public:
         registry_.book(key, size, alignment);
     }
 
+    void book_at(const registry_t::key_t &key, size_t size,
+            registry_t::offset_t offset, size_t alignment = 64) {
+        registry_.book(key, size, alignment, offset);
+    }
+
 private:
     registry_t &registry_;
 };
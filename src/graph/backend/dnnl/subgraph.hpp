@@ -89,6 +89,18 @@ public:
 
     // The executable for each op in subgraph
     std::vector<std::shared_ptr<op_executable_t>> execs_;
+
+    // The dnnl execution args of the inputs of each op that keep the same
+    // content between executions, such as the constant weights
+    std::vector<std::vector<int>> op_const_args_;
+
+    // The inter-op schedule of the ops in topological order, filled by the
+    // schedule_inter_op pass. Ops in the same step don't depend on each other
+    // and can run concurrently, each one with the given number of threads
+    // (0 means the default number of threads). Empty if the ops run one after
+    // another in topological order.
+    std::vector<size_t> op_steps_;
+    std::vector<int> op_nthr_;
 };
 
 class subgraph_visualizer_t {
@@ -107,6 +107,33 @@ public:
     /// Check if a backend supports a specific engine kind
     virtual bool support_engine_kind(engine_kind_t kind) const = 0;
 
+    /// Create again a partition made of the given ops, as the pass named
+    /// `pass_name` created it. It's used to load compiled partitions from a
+    /// cache blob without running the passes on a graph.
+    /// @param pass_name The name returned by partition_impl_t::get_pass_name()
+    /// @param ops The ops of the partition, connected to each other
+    /// @param inputs The input logical tensors of the partition
+    /// @param outputs The output logical tensors of the partition
+    /// @param pimpl The created partition
+    /// @return The status code, unimplemented by default
+    virtual status_t create_partition_impl(const std::string &pass_name,
+            engine_kind_t engine_kind, const fpmath_t &fpmath_mode,
+            partition_kind_t pkind,
+            const std::vector<std::shared_ptr<op_t>> &ops,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs,
+            std::shared_ptr<partition_impl_t> &pimpl) const {
+        UNUSED(pass_name);
+        UNUSED(engine_kind);
+        UNUSED(fpmath_mode);
+        UNUSED(pkind);
+        UNUSED(ops);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(pimpl);
+        return status::unimplemented;
+    }
+
 private:
     static size_t get_counter() {
         static std::atomic<size_t> counter {RESERVED_BACKEND_ID + 1};
@@ -0,0 +1,390 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+#include "common/dnnl_thread.hpp"
+#include "common/stream.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+#include "graph/interface/allocator.hpp"
+#include "graph/interface/bucketed_partition.hpp"
+#include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/partition.hpp"
+#include "graph/interface/tensor.hpp"
+
+#define VCHECK_SYMBOLIC_DIMS(cond, status, msg, ...) \
+    VCONDCHECK(graph, create, check, symbolic_dims, (cond), status, msg, \
+            ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+namespace {
+using ltw = logical_tensor_wrapper_t;
+
+// The bucket sizes of a symbol are the powers of two in [min_size, max_size)
+// followed by max_size
+std::vector<dim_t> get_bucket_sizes(dim_t min_size, dim_t max_size) {
+    std::vector<dim_t> sizes;
+    for (dim_t size = 1; size < max_size; size *= 2) {
+        if (size >= min_size) sizes.push_back(size);
+    }
+    sizes.push_back(max_size);
+    return sizes;
+}
+
+void set_dense_strides(logical_tensor_t &lt) {
+    lt.layout_type = layout_type::strided;
+    dim_t stride = 1;
+    for (int d = lt.ndims - 1; d >= 0; d--) {
+        lt.layout.strides[d] = stride;
+        stride *= std::max(lt.dims[d], dim_t(1));
+    }
+}
+
+const logical_tensor_t *find_lt(
+        const std::vector<logical_tensor_t> &lts, size_t id) {
+    for (const auto &lt : lts) {
+        if (lt.id == id) return &lt;
+    }
+    return nullptr;
+}
+
+// Copies the leading block of a strided tensor with the given dims into
+// another strided tensor. The strides of both tensors are in elements.
+void copy_block(const char *src, const dim_t *src_strides, char *dst,
+        const dim_t *dst_strides, const dim_t *dims, int ndims,
+        size_t dt_size) {
+    if (ndims == 0) {
+        std::memcpy(dst, src, dt_size);
+        return;
+    }
+
+    const int last = ndims - 1;
+    dim_t outer = 1;
+    for (int d = 0; d < last; d++)
+        outer *= dims[d];
+    const bool dense_rows = src_strides[last] == 1 && dst_strides[last] == 1;
+
+    parallel_nd(outer, [&](dim_t i) {
+        dim_t src_off = 0, dst_off = 0, rem = i;
+        for (int d = last - 1; d >= 0; d--) {
+            const dim_t idx = rem % dims[d];
+            rem /= dims[d];
+            src_off += idx * src_strides[d];
+            dst_off += idx * dst_strides[d];
+        }
+        const char *s = src + src_off * dt_size;
+        char *t = dst + dst_off * dt_size;
+        if (dense_rows) {
+            std::memcpy(t, s, dims[last] * dt_size);
+            return;
+        }
+        for (dim_t j = 0; j < dims[last]; j++)
+            std::memcpy(t + j * dst_strides[last] * dt_size,
+                    s + j * src_strides[last] * dt_size, dt_size);
+    });
+}
+
+// Whether a user tensor can be passed to the bucket as is or has to be copied
+// into a buffer of the bucket shape, in which case its dims must fit it. The
+// tensors of opaque layouts are not affected by the symbols and are passed as
+// is.
+status_t needs_copy(
+        const logical_tensor_t &user_lt, const logical_tensor_t &cp_lt,
+        bool &copy) {
+    copy = ltw(user_lt).is_strided()
+            && (!ltw(user_lt).has_same_shape_as(ltw(cp_lt))
+                    || !ltw(user_lt).has_same_layout_as(ltw(cp_lt)));
+    if (!copy) return status::success;
+
+    VCHECK_SYMBOLIC_DIMS(user_lt.ndims == cp_lt.ndims,
+            status::invalid_arguments,
+            "tensor %zu doesn't match the rank of the bucket", user_lt.id);
+    for (int d = 0; d < user_lt.ndims; d++) {
+        VCHECK_SYMBOLIC_DIMS(user_lt.dims[d] <= cp_lt.dims[d],
+                status::invalid_arguments,
+                "dimension %d of tensor %zu is larger than the bucket", d,
+                user_lt.id);
+    }
+    return status::success;
+}
+
+// Temporary buffers of the bucket shape, freed on destruction
+struct temp_buffers_t {
+    temp_buffers_t(const allocator_t *alloc) : alloc_(alloc) {}
+    ~temp_buffers_t() {
+        for (void *buf : buffers_)
+            alloc_->deallocate(buf);
+    }
+
+    void *allocate(size_t size) {
+        void *buf = alloc_->allocate(
+                size, {allocator_t::mem_type_t::temp, 64});
+        if (buf) buffers_.push_back(buf);
+        return buf;
+    }
+
+    bool empty() const { return buffers_.empty(); }
+
+private:
+    const allocator_t *alloc_;
+    std::vector<void *> buffers_;
+};
+} // namespace
+
+status_t bucketed_compiled_partition_impl_t::create(
+        std::shared_ptr<compiled_partition_impl_t> &impl,
+        const partition_t *partition,
+        const std::vector<const logical_tensor_t *> &inputs,
+        const std::vector<const logical_tensor_t *> &outputs,
+        const std::vector<symbolic_dim_t> &symbolic_dims,
+        const engine_t *engine) {
+    VCHECK_SYMBOLIC_DIMS(engine->kind() == engine_kind::cpu
+                    && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL,
+            status::unimplemented,
+            "symbolic dimensions are only supported on CPU engines");
+    VCHECK_SYMBOLIC_DIMS(!symbolic_dims.empty(), status::invalid_arguments,
+            "no symbolic dimensions given");
+
+    std::vector<size_t> symbols, dim_symbols;
+    std::vector<std::vector<dim_t>> symbol_sizes;
+    size_t num_buckets = 1;
+    for (const auto &d : symbolic_dims) {
+        VCHECK_SYMBOLIC_DIMS(d.input_index < inputs.size(),
+                status::invalid_arguments, "invalid input index %zu",
+                d.input_index);
+        const logical_tensor_t &lt = *inputs[d.input_index];
+        VCHECK_SYMBOLIC_DIMS(d.axis >= 0 && d.axis < lt.ndims,
+                status::invalid_arguments, "invalid axis %d of input %zu",
+                d.axis, d.input_index);
+        VCHECK_SYMBOLIC_DIMS(ltw(lt).is_strided() && !ltw(lt).is_host_scalar()
+                        && ltw(lt).sub_byte_data_type_multiplier() == 1,
+                status::invalid_arguments,
+                "input %zu with symbolic dimensions must be a strided tensor "
+                "of a byte-sized data type",
+                d.input_index);
+        VCHECK_SYMBOLIC_DIMS(d.min_size > 0 && d.min_size <= d.max_size,
+                status::invalid_arguments,
+                "invalid range [%ld, %ld] of symbol %zu", (long)d.min_size,
+                (long)d.max_size, d.symbol);
+
+        auto pos = std::find(symbols.begin(), symbols.end(), d.symbol);
+        const size_t isym = static_cast<size_t>(pos - symbols.begin());
+        const auto sizes = get_bucket_sizes(d.min_size, d.max_size);
+        if (pos == symbols.end()) {
+            symbols.push_back(d.symbol);
+            symbol_sizes.push_back(sizes);
+            num_buckets *= sizes.size();
+            VCHECK_SYMBOLIC_DIMS(num_buckets <= max_num_buckets,
+                    status::invalid_arguments,
+                    "too many buckets, the limit is %zu", max_num_buckets);
+        } else {
+            VCHECK_SYMBOLIC_DIMS(symbol_sizes[isym] == sizes,
+                    status::invalid_arguments,
+                    "symbol %zu is given with different ranges", d.symbol);
+        }
+        dim_symbols.push_back(isym);
+    }
+
+    std::vector<std::shared_ptr<compiled_partition_t>> buckets;
+    buckets.reserve(num_buckets);
+    size_t scratchpad_size = 0;
+    for (size_t b = 0; b < num_buckets; b++) {
+        // the bucket sizes of each symbol for the b-th combination
+        std::vector<dim_t> sizes(symbol_sizes.size());
+        size_t rem = b;
+        for (size_t s = symbol_sizes.size(); s-- > 0;) {
+            sizes[s] = symbol_sizes[s][rem % symbol_sizes[s].size()];
+            rem /= symbol_sizes[s].size();
+        }
+
+        std::vector<logical_tensor_t> ins, outs;
+        for (const auto *in : inputs)
+            ins.push_back(*in);
+        for (size_t i = 0; i < symbolic_dims.size(); i++) {
+            const auto &d = symbolic_dims[i];
+            ins[d.input_index].dims[d.axis] = sizes[dim_symbols[i]];
+        }
+        for (const auto &d : symbolic_dims)
+            set_dense_strides(ins[d.input_index]);
+
+        // the output shapes are deduced from the input ones
+        for (const auto *out : outputs) {
+            logical_tensor_t lt = *out;
+            for (int d = 0; d < lt.ndims; d++) {
+                lt.dims[d] = DNNL_GRAPH_UNKNOWN_DIM;
+                lt.layout.strides[d] = DNNL_GRAPH_UNKNOWN_DIM;
+            }
+            lt.layout_type = layout_type::strided;
+            outs.push_back(lt);
+        }
+
+        std::vector<const logical_tensor_t *> in_ptrs, out_ptrs;
+        for (const auto &lt : ins)
+            in_ptrs.push_back(&lt);
+        for (const auto &lt : outs)
+            out_ptrs.push_back(&lt);
+
+        auto cp = std::make_shared<compiled_partition_t>(*partition);
+        std::pair<compiled_partition_t *, cache_state_t> cp_state {
+                cp.get(), cache_state_t::compiled_partition_hit};
+        CHECK(partition->compile(cp_state, in_ptrs, out_ptrs, engine));
+
+        for (const auto &lt : cp->get_outputs()) {
+            VCHECK_SYMBOLIC_DIMS(ltw(lt).is_strided()
+                            && !ltw(lt).is_shape_unknown()
+                            && !ltw(lt).is_stride_unknown(),
+                    status::unimplemented,
+                    "output %zu doesn't have a known strided layout", lt.id);
+        }
+        scratchpad_size = std::max(scratchpad_size, cp->get_scratchpad_size());
+        buckets.push_back(cp);
+    }
+
+    // the compiled partition is described by its largest bucket
+    const auto &largest = buckets.back();
+    std::shared_ptr<bucketed_compiled_partition_impl_t> bucketed(
+            new bucketed_compiled_partition_impl_t(
+                    *engine, largest->get_inputs(), largest->get_outputs()));
+    bucketed->dims_ = symbolic_dims;
+    bucketed->dim_symbols_ = dim_symbols;
+    bucketed->symbol_sizes_ = symbol_sizes;
+    bucketed->buckets_ = buckets;
+    bucketed->scratchpad_size_ = scratchpad_size;
+    impl = bucketed;
+    return status::success;
+}
+
+std::string bucketed_compiled_partition_impl_t::str() const {
+    std::ostringstream ss;
+    ss << "bucketed:" << buckets_.size() << ":"
+       << buckets_.back()->get_pimpl()->str();
+    return ss.str();
+}
+
+status_t bucketed_compiled_partition_impl_t::execute(const stream_t *astream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs, const tensor_t *scratchpad) {
+    // find the bucket of the actual sizes of the symbols
+    std::vector<dim_t> sizes(symbol_sizes_.size(), DNNL_GRAPH_UNKNOWN_DIM);
+    for (size_t i = 0; i < dims_.size(); i++) {
+        const auto &d = dims_[i];
+        VCONDCHECK(graph, exec, check, symbolic_dims,
+                d.input_index < inputs.size(), status::invalid_arguments,
+                "input %zu is not given", d.input_index);
+        const dim_t size
+                = inputs[d.input_index].get_logical_tensor().dims[d.axis];
+        VCONDCHECK(graph, exec, check, symbolic_dims,
+                size >= d.min_size && size <= d.max_size,
+                status::invalid_arguments,
+                "size %ld of symbol %zu is out of its range", (long)size,
+                d.symbol);
+        dim_t &sym_size = sizes[dim_symbols_[i]];
+        VCONDCHECK(graph, exec, check, symbolic_dims,
+                sym_size == DNNL_GRAPH_UNKNOWN_DIM || sym_size == size,
+                status::invalid_arguments,
+                "dimensions of symbol %zu have different sizes", d.symbol);
+        sym_size = size;
+    }
+
+    size_t idx = 0;
+    for (size_t s = 0; s < symbol_sizes_.size(); s++) {
+        const auto &bucket_sizes = symbol_sizes_[s];
+        const auto pos = std::lower_bound(
+                bucket_sizes.begin(), bucket_sizes.end(), sizes[s]);
+        idx = idx * bucket_sizes.size()
+                + static_cast<size_t>(pos - bucket_sizes.begin());
+    }
+    const compiled_partition_t &cp = *buckets_[idx];
+
+    const auto *alloc
+            = static_cast<const allocator_t *>(get_engine()->get_allocator());
+    temp_buffers_t temps(alloc);
+
+    std::vector<tensor_t> ins, outs;
+    ins.reserve(inputs.size());
+    for (const auto &in : inputs) {
+        const logical_tensor_t &user_lt = in.get_logical_tensor();
+        const logical_tensor_t *cp_lt = find_lt(cp.get_inputs(), user_lt.id);
+        bool copy = false;
+        if (cp_lt) CHECK(needs_copy(user_lt, *cp_lt, copy));
+        if (!copy) {
+            ins.push_back(in);
+            continue;
+        }
+
+        const size_t size = ltw(*cp_lt).size();
+        char *buf = static_cast<char *>(temps.allocate(size));
+        if (!buf) return status::out_of_memory;
+        std::memset(buf, 0, size);
+        copy_block(static_cast<const char *>(in.get_data_handle()),
+                user_lt.layout.strides, buf, cp_lt->layout.strides,
+                user_lt.dims, user_lt.ndims, ltw(user_lt).data_type_size());
+        ins.emplace_back(*cp_lt, get_engine(), buf);
+    }
+
+    // the outputs computed into temporary buffers and their user tensors
+    std::vector<std::pair<size_t, const tensor_t *>> out_copies;
+    outs.reserve(outputs.size());
+    for (const auto &out : outputs) {
+        const logical_tensor_t &user_lt = out.get_logical_tensor();
+        const logical_tensor_t *cp_lt = find_lt(cp.get_outputs(), user_lt.id);
+        bool copy = false;
+        if (cp_lt) CHECK(needs_copy(user_lt, *cp_lt, copy));
+        if (!copy) {
+            outs.push_back(out);
+            continue;
+        }
+
+        void *buf = temps.allocate(ltw(*cp_lt).size());
+        if (!buf) return status::out_of_memory;
+        out_copies.emplace_back(outs.size(), &out);
+        outs.emplace_back(*cp_lt, get_engine(), buf);
+    }
+
+    // the tensors are already pre-processed for the backend, so the bucket
+    // implementation is executed directly
+    auto *bucket_impl
+            = const_cast<compiled_partition_impl_t *>(cp.get_pimpl());
+    CHECK(bucket_impl->execute(astream, ins, outs, scratchpad));
+    if (temps.empty()) return status::success;
+
+    // the temporary buffers are released once the computations are done
+    CHECK(const_cast<stream_t *>(astream)->wait());
+    for (const auto &oc : out_copies) {
+        const tensor_t &src = outs[oc.first];
+        const tensor_t &dst = *oc.second;
+        const logical_tensor_t &dst_lt = dst.get_logical_tensor();
+        copy_block(static_cast<const char *>(src.get_data_handle()),
+                src.get_logical_tensor().layout.strides,
+                static_cast<char *>(dst.get_data_handle()),
+                dst_lt.layout.strides, dst_lt.dims, dst_lt.ndims,
+                ltw(dst_lt).data_type_size());
+    }
+    return status::success;
+}
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
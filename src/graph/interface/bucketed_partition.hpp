@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_INTERFACE_BUCKETED_PARTITION_HPP
+#define GRAPH_INTERFACE_BUCKETED_PARTITION_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "graph/interface/c_types_map.hpp"
+#include "graph/interface/partition_impl.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+// A compiled partition whose inputs have symbolic dimensions. It holds one
+// compiled partition per bucket of the symbol sizes and, on execution, runs the
+// one of the smallest bucket that fits the sizes of the input tensors. Inputs
+// smaller than the bucket are copied into zero-padded buffers and the outputs
+// are computed into buffers of the bucket shape before their leading part is
+// copied to the output tensors.
+class bucketed_compiled_partition_impl_t : public compiled_partition_impl_t {
+public:
+    // Compiles the partition for every bucket and creates the implementation
+    static status_t create(std::shared_ptr<compiled_partition_impl_t> &impl,
+            const partition_t *partition,
+            const std::vector<const logical_tensor_t *> &inputs,
+            const std::vector<const logical_tensor_t *> &outputs,
+            const std::vector<symbolic_dim_t> &symbolic_dims,
+            const engine_t *engine);
+
+    std::string str() const override;
+
+    status_t execute(const stream_t *astream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const tensor_t *scratchpad) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t execute_sycl(const stream_t *astream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, const tensor_t *scratchpad,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t execute_ocl(const stream_t *astream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, const tensor_t *scratchpad,
+            const std::vector<cl_event> &ocl_deps,
+            cl_event *ocl_event) override {
+        return status::unimplemented;
+    }
+#endif
+
+    size_t get_scratchpad_size() const override { return scratchpad_size_; }
+
+    // the maximum number of buckets of a compiled partition
+    static constexpr size_t max_num_buckets = 256;
+
+private:
+    bucketed_compiled_partition_impl_t(const engine_t &engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs)
+        : compiled_partition_impl_t(engine, inputs, outputs, {}) {}
+
+    std::vector<symbolic_dim_t> dims_;
+    // the index of the symbol of each dimension in symbol_sizes_
+    std::vector<size_t> dim_symbols_;
+    // the bucket sizes of each symbol, in increasing order
+    std::vector<std::vector<dim_t>> symbol_sizes_;
+    // the compiled partitions of every combination of the bucket sizes, the
+    // last symbol varying the fastest
+    std::vector<std::shared_ptr<compiled_partition_t>> buckets_;
+    size_t scratchpad_size_ = 0;
+};
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -195,6 +195,7 @@ const op_kind_t ReduceSum = dnnl_graph_op_reduce_sum;
 const op_kind_t ReLU = dnnl_graph_op_relu;
 const op_kind_t ReLUBackward = dnnl_graph_op_relu_backward;
 const op_kind_t RMSNorm = dnnl_graph_op_rms_norm;
+const op_kind_t RoPE = dnnl_graph_op_rope;
 const op_kind_t Reorder = dnnl_graph_op_reorder;
 const op_kind_t Round = dnnl_graph_op_round;
 const op_kind_t Select = dnnl_graph_op_select;
@@ -271,6 +272,9 @@ const op_kind_t _identity = 1071;
 const op_kind_t _dropout = 1072;
 const op_kind_t _gated_mlp = 1073;
 const op_kind_t _sdpa_bwd = 1074;
+const op_kind_t _residual_layernorm = 1075;
+const op_kind_t _rope = 1076;
+const op_kind_t _split = 1077;
 } // namespace op_kind
 
 using op_attr_t = typename std::underlying_type<dnnl_graph_op_attr_t>::type;
@@ -352,6 +356,7 @@ const op_attr_t with_scale = 0x10010;
 const op_attr_t is_invert_scale = 0x10011;
 const op_attr_t mask_type = 0x10012;
 const op_attr_t is_rms = 0x10013;
+const op_attr_t is_zero_copy = 0x10014;
 
 // int64_t
 const op_attr_t partition_id = 0x10100;
@@ -429,6 +434,7 @@ using ocl_allocate_f = dnnl_graph_ocl_allocate_f;
 using ocl_deallocate_f = dnnl_graph_ocl_deallocate_f;
 #endif
 using inplace_pair_t = dnnl_graph_inplace_pair_t;
+using symbolic_dim_t = dnnl_graph_symbolic_dim_t;
 
 using graph_t = dnnl_graph_graph;
 using op_t = dnnl_graph_op;
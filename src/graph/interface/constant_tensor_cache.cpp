@@ -15,11 +15,15 @@
  *******************************************************************************/
 
 #include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
 
+#include "common/dnnl_thread.hpp"
 #include "common/engine.hpp"
 #include "common/utils.hpp"
 
@@ -43,6 +47,14 @@
 #include <windows.h>
 #endif
 
+#if defined __unix__ || defined __APPLE__ || defined __FreeBSD__
+#define DNNL_GRAPH_MAPPED_CONSTANT_BUFFER
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 namespace std {
 template <>
 struct hash<dnnl::impl::engine_kind_t> {
@@ -434,6 +446,265 @@ constant_tensor_cache_t *get_constant_tensor_cache(
     return cache.get();
 }
 
+const std::string &get_constant_tensor_cache_dir() {
+    static const std::string dir
+            = impl::getenv_string_user("GRAPH_CONSTANT_TENSOR_CACHE_DIR");
+    return dir;
+}
+
+namespace {
+// The header of the files of the mapped constant buffers. The data follows at
+// the next page boundary.
+struct mapped_file_header_t {
+    char magic[8];
+    uint64_t key;
+    uint64_t size;
+};
+
+constexpr char mapped_file_magic[8] = {'D', 'N', 'N', 'L', 'C', 'T', 'C', '1'};
+constexpr size_t mapped_file_data_offset = 4096;
+
+std::string get_mapped_file_path(size_t key) {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.bin",
+            static_cast<unsigned long long>(key));
+    return get_constant_tensor_cache_dir() + "/" + name;
+}
+} // namespace
+
+mapped_constant_buffer_t::mapped_constant_buffer_t(size_t key, size_t size,
+        impl::engine_t *eng, void *addr, size_t mapped_size, bool is_loaded,
+        const std::string &tmp_path)
+    : constant_buffer_t(
+            size, static_cast<char *>(addr) + mapped_file_data_offset, eng)
+    , key_(key)
+    , addr_(addr)
+    , mapped_size_(mapped_size)
+    , is_loaded_(is_loaded)
+    , tmp_path_(tmp_path) {}
+
+#ifdef DNNL_GRAPH_MAPPED_CONSTANT_BUFFER
+std::shared_ptr<mapped_constant_buffer_t> mapped_constant_buffer_t::create(
+        size_t key, size_t size, impl::engine_t *eng) {
+    if (get_constant_tensor_cache_dir().empty() || size == 0) return nullptr;
+
+    const std::string path = get_mapped_file_path(key);
+    const size_t mapped_size = mapped_file_data_offset + size;
+
+    // The data of the files is never written back, so that a kernel writing
+    // to a constant buffer can't corrupt the file of the other processes
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat st;
+        void *addr = MAP_FAILED;
+        if (fstat(fd, &st) == 0
+                && static_cast<size_t>(st.st_size) == mapped_size)
+            addr = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (addr != MAP_FAILED) {
+            const auto *header
+                    = static_cast<const mapped_file_header_t *>(addr);
+            if (std::memcmp(header->magic, mapped_file_magic,
+                        sizeof(mapped_file_magic))
+                            == 0
+                    && header->key == key && header->size == size) {
+                return std::shared_ptr<mapped_constant_buffer_t>(
+                        new mapped_constant_buffer_t(key, size, eng, addr,
+                                mapped_size, true, std::string()));
+            }
+            munmap(addr, mapped_size);
+        }
+        // An unexpected file is replaced once the new buffer is filled
+    }
+
+    static std::atomic<size_t> tmp_counter {0};
+    const std::string tmp_path = path + "." + std::to_string(getpid()) + "."
+            + std::to_string(tmp_counter++) + ".tmp";
+    fd = open(tmp_path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) {
+        VERROR(graph, constant_tensor_cache, "could not create file %s",
+                tmp_path.c_str());
+        return nullptr;
+    }
+
+    // The space is reserved upfront, as running out of it while the mapped
+    // memory is written would raise a bus error
+#ifdef __linux__
+    bool ok = posix_fallocate(fd, 0, static_cast<off_t>(mapped_size)) == 0;
+#else
+    bool ok = ftruncate(fd, static_cast<off_t>(mapped_size)) == 0;
+#endif
+    void *addr = ok ? mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+                              MAP_SHARED, fd, 0)
+                    : MAP_FAILED;
+    close(fd);
+    if (addr == MAP_FAILED) {
+        VERROR(graph, constant_tensor_cache,
+                "could not map %zu bytes of file %s", mapped_size,
+                tmp_path.c_str());
+        unlink(tmp_path.c_str());
+        return nullptr;
+    }
+    return std::shared_ptr<mapped_constant_buffer_t>(
+            new mapped_constant_buffer_t(
+                    key, size, eng, addr, mapped_size, false, tmp_path));
+}
+
+mapped_constant_buffer_t::~mapped_constant_buffer_t() {
+    munmap(addr_, mapped_size_);
+    if (!tmp_path_.empty()) unlink(tmp_path_.c_str());
+}
+
+void mapped_constant_buffer_t::notify_filled() {
+    if (tmp_path_.empty()) return;
+
+    // The header is written last so that a file is only valid once complete
+    auto *header = static_cast<mapped_file_header_t *>(addr_);
+    header->key = key_;
+    header->size = size_;
+    std::memcpy(header->magic, mapped_file_magic, sizeof(mapped_file_magic));
+    const std::string path = get_mapped_file_path(key_);
+    if (msync(addr_, mapped_size_, MS_SYNC) != 0
+            || rename(tmp_path_.c_str(), path.c_str()) != 0) {
+        VERROR(graph, constant_tensor_cache, "could not write file %s",
+                path.c_str());
+        unlink(tmp_path_.c_str());
+    }
+    tmp_path_.clear();
+}
+#else
+std::shared_ptr<mapped_constant_buffer_t> mapped_constant_buffer_t::create(
+        size_t key, size_t size, impl::engine_t *eng) {
+    UNUSED(key);
+    UNUSED(size);
+    UNUSED(eng);
+    return nullptr;
+}
+
+mapped_constant_buffer_t::~mapped_constant_buffer_t() = default;
+
+void mapped_constant_buffer_t::notify_filled() {}
+#endif
+
+bool get_constant_tensor_cache_compression() {
+    static const bool compression = impl::getenv_int_user(
+            "GRAPH_CONSTANT_TENSOR_CACHE_COMPRESSION", 0);
+    return compression;
+}
+
+namespace {
+// The words of a compressed buffer are encoded by groups of 64, and the
+// groups by independent segments so that they are processed in parallel.
+constexpr size_t group_words = 64;
+constexpr size_t segment_groups = 1024;
+constexpr size_t segment_words = segment_groups * group_words;
+// the mask of a group takes two words
+constexpr size_t mask_words = sizeof(uint64_t) / sizeof(uint32_t);
+} // namespace
+
+compressed_constant_buffer_t::compressed_constant_buffer_t(size_t size,
+        impl::engine_t *eng, allocator_t *alc, malloc_func_t malloc_func,
+        free_func_t free_func)
+    : constant_buffer_t(size, eng, alc, malloc_func, free_func)
+    , footprint_(size) {}
+
+void *compressed_constant_buffer_t::acquire_data() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (users_++ == 0 && !data_) expand();
+    return data_;
+}
+
+void compressed_constant_buffer_t::release_data() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    assert(users_ > 0);
+    if (--users_ > 0 || is_incompressible_) return;
+    if (!is_compressed_) compress();
+    if (!is_compressed_) return;
+
+    free_func_(data_, eng_, alc_);
+    data_ = nullptr;
+    footprint_ = compressed_.size() * sizeof(uint32_t)
+            + segment_offsets_.size() * sizeof(size_t);
+}
+
+void compressed_constant_buffer_t::compress() {
+    const auto *src = static_cast<const uint32_t *>(data_);
+    const size_t n_words = size_ / sizeof(uint32_t);
+    const size_t tail_bytes = size_ % sizeof(uint32_t);
+    const size_t n_segments = utils::div_up(n_words, segment_words);
+
+    // offsets[s + 1] first holds the encoded size of segment s
+    std::vector<size_t> offsets(n_segments + 1, 0);
+    parallel_nd(n_segments, [&](dim_t s) {
+        const size_t beg = s * segment_words;
+        const size_t end = std::min(n_words, beg + segment_words);
+        size_t n_nonzero = 0;
+        for (size_t w = beg; w < end; w++)
+            n_nonzero += src[w] != 0;
+        offsets[s + 1] = n_nonzero
+                + mask_words * utils::div_up(end - beg, group_words);
+    });
+    for (size_t s = 0; s < n_segments; s++)
+        offsets[s + 1] += offsets[s];
+
+    // Keep the data expanded when too few words are zero for the
+    // compression to pay off.
+    const size_t n_compressed = offsets[n_segments] + (tail_bytes ? 1 : 0);
+    if (n_compressed * sizeof(uint32_t) > size_ / 4 * 3) {
+        is_incompressible_ = true;
+        return;
+    }
+
+    compressed_.resize(n_compressed);
+    parallel_nd(n_segments, [&](dim_t s) {
+        uint32_t *dst = compressed_.data() + offsets[s];
+        const size_t end = std::min(n_words, (s + 1) * segment_words);
+        for (size_t g = s * segment_words; g < end; g += group_words) {
+            uint32_t *mask_dst = dst;
+            dst += mask_words;
+            uint64_t mask = 0;
+            for (size_t w = g; w < std::min(end, g + group_words); w++) {
+                if (src[w] == 0) continue;
+                mask |= uint64_t(1) << (w - g);
+                *dst++ = src[w];
+            }
+            std::memcpy(mask_dst, &mask, sizeof(mask));
+        }
+    });
+    if (tail_bytes)
+        std::memcpy(&compressed_.back(), src + n_words, tail_bytes);
+
+    segment_offsets_ = std::move(offsets);
+    is_compressed_ = true;
+}
+
+void compressed_constant_buffer_t::expand() {
+    data_ = malloc_func_(size_, eng_, alc_);
+    auto *dst = static_cast<uint32_t *>(data_);
+    const size_t n_words = size_ / sizeof(uint32_t);
+    const size_t tail_bytes = size_ % sizeof(uint32_t);
+    const size_t n_segments = segment_offsets_.size() - 1;
+
+    parallel_nd(n_segments, [&](dim_t s) {
+        const uint32_t *src = compressed_.data() + segment_offsets_[s];
+        const size_t end = std::min(n_words, (s + 1) * segment_words);
+        for (size_t g = s * segment_words; g < end; g += group_words) {
+            uint64_t mask = 0;
+            std::memcpy(&mask, src, sizeof(mask));
+            src += mask_words;
+            for (size_t w = g; w < std::min(end, g + group_words); w++)
+                dst[w] = (mask >> (w - g)) & 1 ? *src++ : 0;
+        }
+    });
+    if (tail_bytes)
+        std::memcpy(dst + n_words, &compressed_.back(), tail_bytes);
+
+    footprint_ = size_ + compressed_.size() * sizeof(uint32_t)
+            + segment_offsets_.size() * sizeof(size_t);
+}
+
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
@@ -21,8 +21,11 @@
 #include <future>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include "common/c_types_map.hpp"
 #include "common/engine.hpp"
@@ -53,7 +56,7 @@ public:
     }
 
     virtual ~constant_buffer_t() {
-        free_func_(data_, eng_, alc_);
+        if (free_func_ && data_) free_func_(data_, eng_, alc_);
         eng_->release();
     }
 
@@ -68,19 +71,43 @@ public:
         return static_cast<T *>(data_);
     }
 
-    size_t size() const { return size_; }
+    virtual size_t size() const { return size_; }
 
     // used to notify backend the buffer has been evict. backend can use this
     // api to avoid query constant cache frequently to reduce overhead.
     virtual void notify_evict() {}
 
+    // Whether the buffer already holds the constant data, for example when it
+    // is loaded from a file written by another process. Backends don't need
+    // to compute the constant tensors of such buffers.
+    virtual bool is_loaded() const { return false; }
+
+    // used by backend to notify the buffer that the constant data has been
+    // computed into it.
+    virtual void notify_filled() {}
+
+    // Returns the constant data for one execution of the backend kernels,
+    // which must call release_data() once the kernels using it are complete.
+    // Buffers that keep their data compressed expand it here.
+    virtual void *acquire_data() { return data_; }
+    virtual void release_data() {}
+
 protected:
+    // For buffers whose memory is managed by the derived class
+    constant_buffer_t(size_t size, void *data, impl::engine_t *eng)
+        : data_(data)
+        , size_(size)
+        , eng_(eng)
+        , alc_(nullptr)
+        , malloc_func_(nullptr)
+        , free_func_(nullptr) {
+        eng_->retain();
+    }
+
     void *data_;
     size_t size_;
     impl::engine_t *eng_;
     allocator_t *alc_;
-
-private:
     malloc_func_t malloc_func_;
     free_func_t free_func_;
 };
@@ -168,6 +195,79 @@ private:
 constant_tensor_cache_t *get_constant_tensor_cache(
         impl::engine_kind_t eng_kind, size_t index);
 
+// A constant buffer backed by a file in the directory set by the
+// ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_DIR environment variable. A new buffer is
+// mapped from a temporary file, which gets its final name once the backend has
+// filled it, so that other processes and later runs map the same data instead
+// of computing it again. The files are named after a key that the backend
+// must derive from the constant tensors content and the way they are computed.
+class mapped_constant_buffer_t : public constant_buffer_t {
+public:
+    // Maps the file of the given key if it exists, a new temporary file
+    // otherwise. Returns nullptr if the files can't be used, in which case the
+    // caller should fall back to a buffer in memory.
+    static std::shared_ptr<mapped_constant_buffer_t> create(
+            size_t key, size_t size, impl::engine_t *eng);
+
+    ~mapped_constant_buffer_t() override;
+
+    bool is_loaded() const override { return is_loaded_; }
+
+    void notify_filled() override;
+
+private:
+    mapped_constant_buffer_t(size_t key, size_t size, impl::engine_t *eng,
+            void *addr, size_t mapped_size, bool is_loaded,
+            const std::string &tmp_path);
+
+    size_t key_;
+    void *addr_;
+    size_t mapped_size_;
+    bool is_loaded_;
+    // the temporary file of a buffer that is not yet filled
+    std::string tmp_path_;
+};
+
+// Returns the directory of the file-backed constant buffers, or an empty
+// string if constant buffers are kept in memory.
+const std::string &get_constant_tensor_cache_dir();
+
+// A constant buffer that keeps its data losslessly compressed while no kernel
+// uses it, for constant tensors with many zeros such as pruned weights. The
+// data is compressed the first time the buffer is released once filled, and
+// expanded by the next acquire_data() call, so that only the buffers in use
+// are resident in full. Buffers that don't compress well stay expanded. The
+// size of a compressed buffer is the size of its compressed data.
+class compressed_constant_buffer_t : public constant_buffer_t {
+public:
+    compressed_constant_buffer_t(size_t size, impl::engine_t *eng,
+            allocator_t *alc, malloc_func_t malloc_func, free_func_t free_func);
+
+    size_t size() const override { return footprint_.load(); }
+
+    void *acquire_data() override;
+    void release_data() override;
+
+private:
+    void compress();
+    void expand();
+
+    std::mutex mutex_;
+    int users_ = 0;
+    bool is_compressed_ = false;
+    // whether compression was tried and didn't pay off
+    bool is_incompressible_ = false;
+    // groups of 64 words, each encoded as a mask of its non-zero words
+    // followed by them, and the offset of every segment of groups
+    std::vector<uint32_t> compressed_;
+    std::vector<size_t> segment_offsets_;
+    std::atomic<size_t> footprint_;
+};
+
+// Returns whether the constant buffers are compressed, as set by the
+// ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_COMPRESSION environment variable.
+bool get_constant_tensor_cache_compression();
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
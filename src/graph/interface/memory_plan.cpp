@@ -0,0 +1,151 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/memory_plan.hpp"
+#include "graph/interface/partition.hpp"
+
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+#define VCHECK_MEMORY_PLAN(cond, msg, ...) \
+    VCONDCHECK(graph, create, check, memory_plan, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+namespace {
+
+struct buffer_t {
+    size_t size;
+    // Indices of the first and the last compiled partitions using the buffer
+    size_t first, last;
+    size_t offset;
+    bool consumed;
+};
+
+bool lifetimes_overlap(const buffer_t &a, const buffer_t &b) {
+    return a.first <= b.last && b.first <= a.last;
+}
+
+// Greedy by size placement: larger buffers are placed first at the lowest
+// offset that does not overlap any placed buffer alive at the same time.
+size_t place_buffers(std::vector<buffer_t> &buffers, size_t alignment) {
+    std::vector<size_t> order(buffers.size());
+    for (size_t i = 0; i < order.size(); i++)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return buffers[a].size > buffers[b].size;
+    });
+
+    size_t arena_size = 0;
+    std::vector<size_t> placed;
+    for (size_t idx : order) {
+        auto &b = buffers[idx];
+        b.offset = 0;
+        if (b.size == 0) continue;
+
+        std::vector<size_t> alive;
+        for (size_t p : placed)
+            if (lifetimes_overlap(b, buffers[p])) alive.push_back(p);
+        std::sort(alive.begin(), alive.end(), [&](size_t x, size_t y) {
+            return buffers[x].offset < buffers[y].offset;
+        });
+
+        size_t offset = 0;
+        for (size_t p : alive) {
+            const auto &pb = buffers[p];
+            if (offset + b.size <= pb.offset) break;
+            offset = std::max(offset,
+                    dnnl::impl::utils::rnd_up(pb.offset + pb.size, alignment));
+        }
+        b.offset = offset;
+        arena_size = std::max(arena_size, offset + b.size);
+        placed.push_back(idx);
+    }
+    return arena_size;
+}
+
+} // namespace
+
+status_t memory_plan_t::init(
+        const std::vector<const compiled_partition_t *> &cps) {
+    std::vector<buffer_t> buffers;
+    // Tensor id of each intermediate tensor candidate and its buffer index
+    std::vector<std::pair<size_t, size_t>> tensors;
+    std::unordered_map<size_t, size_t> id2buffer;
+    std::vector<size_t> scratchpad_buffers(cps.size());
+
+    for (size_t i = 0; i < cps.size(); i++) {
+        const auto *cp = cps[i];
+        VCHECK_MEMORY_PLAN(cp && cp->is_initialized(),
+                "compiled partition %zu is not initialized", i);
+
+        for (const auto &lt : cp->get_inputs()) {
+            auto it = id2buffer.find(lt.id);
+            if (it == id2buffer.end()) continue;
+            auto &b = buffers[it->second];
+            b.last = i;
+            b.consumed = true;
+            // The layout queried from the producer is expected, but a
+            // consumer may describe the tensor with a larger padded layout
+            b.size = std::max(b.size, logical_tensor_wrapper_t(lt).size());
+        }
+
+        for (const auto &lt : cp->get_outputs()) {
+            const logical_tensor_wrapper_t ltw(lt);
+            VCHECK_MEMORY_PLAN(!ltw.is_shape_unknown(),
+                    "output %zu of compiled partition %zu has unknown shape",
+                    lt.id, i);
+            VCHECK_MEMORY_PLAN(id2buffer.count(lt.id) == 0,
+                    "tensor %zu is produced more than once", lt.id);
+            id2buffer[lt.id] = buffers.size();
+            tensors.emplace_back(lt.id, buffers.size());
+            buffers.push_back({ltw.size(), i, i, 0, false});
+        }
+
+        scratchpad_buffers[i] = buffers.size();
+        buffers.push_back({cp->get_scratchpad_size(), i, i, 0, true});
+    }
+
+    // Outputs not consumed in the sequence are not planned
+    for (auto &b : buffers)
+        if (!b.consumed) b.size = 0;
+
+    arena_size_ = place_buffers(buffers, alignment);
+
+    tensor_offsets_.clear();
+    for (const auto &t : tensors) {
+        const auto &b = buffers[t.second];
+        if (b.consumed) tensor_offsets_.emplace_back(t.first, b.offset);
+    }
+    scratchpad_offsets_.resize(cps.size());
+    for (size_t i = 0; i < cps.size(); i++)
+        scratchpad_offsets_[i] = buffers[scratchpad_buffers[i]].offset;
+
+    return status::success;
+}
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_INTERFACE_MEMORY_PLAN_HPP
+#define GRAPH_INTERFACE_MEMORY_PLAN_HPP
+
+#include <utility>
+#include <vector>
+
+#include "graph/interface/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+// Placement of the intermediate tensors and of the scratchpads of a sequence
+// of compiled partitions executed in order into a single arena.
+//
+// An intermediate tensor is an output of a compiled partition consumed by a
+// later compiled partition of the sequence. It lives from its producer to its
+// last consumer, and a scratchpad lives for the execution of its compiled
+// partition only. Buffers whose lifetimes do not overlap share memory. The
+// inputs of the sequence and the outputs not consumed in the sequence are not
+// planned, since their lifetimes are defined by the user.
+struct memory_plan_t {
+    // Alignment of every buffer offset in the arena
+    static constexpr size_t alignment = 64;
+
+    status_t init(const std::vector<const compiled_partition_t *> &cps);
+
+    size_t arena_size() const { return arena_size_; }
+    // Pairs of (tensor id, offset in the arena)
+    const std::vector<std::pair<size_t, size_t>> &tensor_offsets() const {
+        return tensor_offsets_;
+    }
+    // Offset of the scratchpad of each compiled partition
+    const std::vector<size_t> &scratchpad_offsets() const {
+        return scratchpad_offsets_;
+    }
+
+private:
+    size_t arena_size_ = 0;
+    std::vector<std::pair<size_t, size_t>> tensor_offsets_;
+    std::vector<size_t> scratchpad_offsets_;
+};
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
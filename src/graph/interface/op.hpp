@@ -396,6 +396,7 @@ public:
             CASE(qk_acc_mode);
             CASE(vs_acc_mode);
             CASE(is_rms);
+            CASE(is_zero_copy);
             CASE(with_dropout);
             default: return "undefined_attr";
         }
@@ -478,6 +479,7 @@ public:
             CASE(Reorder);
             CASE(Round);
             CASE(RMSNorm);
+            CASE(RoPE);
             CASE(Select);
             CASE(Sigmoid);
             CASE(SigmoidBackward);
@@ -548,6 +550,9 @@ public:
             CASE(_dropout);
             CASE(_gated_mlp);
             CASE(_sdpa_bwd);
+            CASE(_residual_layernorm);
+            CASE(_rope);
+            CASE(_split);
             default: return "undefined_op";
         }
 #undef CASE
@@ -1374,6 +1374,23 @@ DNNL_GRAPH_OP_SCHEMA(RMSNorm, 1,
                 .set_shape_inference_function(infer_norm_output_shape)
                 .set_op_def_constraint_function(check_norm_data_type))
 
+DNNL_GRAPH_OP_SCHEMA(RoPE, 1,
+        op_schema_t()
+                .set_num_inputs(3)
+                .set_num_outputs(1)
+                .set_input(0, "src", "T1")
+                .set_input(1, "cos", "T2")
+                .set_input(2, "sin", "T2")
+                .set_output(0, "dst", "T1")
+                .set_attr(op_attr::mode, false, attribute_kind::s,
+                        "rotate_half", {"rotate_half", "interleaved"})
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints(
+                        "T2", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_shape_inference_function(infer_rope_output_shape)
+                .set_op_def_constraint_function(check_rope_data_type))
+
 // Definitions of internal ops
 #define SET_ATTR_IS_CONSTANT \
     set_attr(op_attr::is_constant, false, attribute_kind::b, false)
@@ -1850,17 +1867,20 @@ DNNL_GRAPH_OP_SCHEMA(_conv_bwd_data, 1,
 DNNL_GRAPH_OP_SCHEMA(_conv_bwd_weights, 1,
         op_schema_t()
                 .set_num_inputs(2)
-                .set_num_outputs(2)
+                .set_outputs_option(op_schema_t::param_num_option::optional)
+                .set_num_outputs(std::set<size_t>({2, 3}))
                 .set_input(0, "input")
                 .set_input(1, "output_delta")
                 .set_output(0, "weight_delta")
-                .set_output(1, "scratchpad")
+                .set_output(1, "bias_delta")
+                .set_output(2, "scratchpad")
                 .set_attr(op_attr::weights_shape, false, attribute_kind::is,
                         std::vector<int64_t>(DNNL_MAX_NDIMS, 0))
                 .SET_CONV_COMMON_ATTRS
                 // New added attributes
                 .set_attr(
                         op_attr::canonicalized, false, attribute_kind::b, false)
+                .set_attr(op_attr::with_bias, false, attribute_kind::b, false)
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
                 // Analysis rules
                 .set_shape_inference_function(
@@ -2431,6 +2451,65 @@ DNNL_GRAPH_OP_SCHEMA(_sdpa_bwd, 1,
                 .set_attr(op_attr::vs_acc_mode, true, attribute_kind::s)
                 .set_shape_inference_function(infer_dnnl_sdpa_bwd_output_shape))
 
+// Residual add followed by LayerNorm/RMSNorm over the last axis, with an
+// optional per-tensor quantization of the normalized output. The sum of the
+// two inputs is the second output.
+DNNL_GRAPH_OP_SCHEMA(_residual_layernorm, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({2, 3, 4}))
+                .set_num_outputs(2)
+                .set_input(0, "input")
+                .set_input(1, "residual")
+                .set_input(2, "gamma")
+                .set_input(3, "beta")
+                .set_output(0, "output")
+                .set_output(1, "residual_output")
+                // Attributes inherited from LayerNorm
+                .set_attr(op_attr::use_affine, false, attribute_kind::b, true)
+                .set_attr(op_attr::epsilon, false, attribute_kind::f, 1e-5f)
+                .set_attr(op_attr::is_rms, false, attribute_kind::b, false)
+                // Attributes inherited from Quantize
+                .set_attr(op_attr::scales, false, attribute_kind::fs,
+                        std::vector<float>(1, 1.f))
+                .set_attr(op_attr::zps, false, attribute_kind::is,
+                        std::vector<int64_t>(1, 0))
+                // New added attributes
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(
+                        infer_dnnl_residual_layernorm_output_shape))
+
+DNNL_GRAPH_OP_SCHEMA(_rope, 1,
+        op_schema_t()
+                .set_num_inputs(3)
+                .set_num_outputs(1)
+                .set_input(0, "input")
+                .set_input(1, "cos")
+                .set_input(2, "sin")
+                .set_output(0, "output")
+                // Attributes inherited from front RoPE ops
+                .set_attr(op_attr::mode, false, attribute_kind::s,
+                        "rotate_half", {"rotate_half", "interleaved"})
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(infer_rope_output_shape))
+
+// Splits the input along an axis into outputs of the given sizes.
+DNNL_GRAPH_OP_SCHEMA(_split, 1,
+        op_schema_t()
+                .set_num_inputs(1)
+                .set_outputs_option(op_schema_t::param_num_option::variadic)
+                .set_num_outputs(std::set<size_t>({1, 64}))
+                .set_input(0, "input")
+                .set_output(0, "output")
+                .set_attr(op_attr::axis, true, attribute_kind::i)
+                .set_attr(op_attr::sizes, true, attribute_kind::is)
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(
+                        infer_dnnl_split_output_shape))
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
@@ -196,6 +196,21 @@ bool check_typecast_data_type(const op_t *n) {
     return true;
 }
 
+// check function for data_type of RoPE.
+// cos and sin are either f32 or of the same data type as src
+bool check_rope_data_type(const op_t *n) {
+    const logical_tensor_t &src_lt = n->get_input_logical_tensor(0);
+    const logical_tensor_t &cos_lt = n->get_input_logical_tensor(1);
+
+    VCHECK_SHAPE_INFER((cos_lt.data_type == data_type::f32
+                               || cos_lt.data_type == src_lt.data_type),
+            "%s, given cos and sin data type %s v.s. expected data type f32 "
+            "or %s.",
+            op_t::kind2str(n->get_kind()).c_str(),
+            dnnl_dt2str(cos_lt.data_type), dnnl_dt2str(src_lt.data_type));
+    return true;
+}
+
 // check function for src_shape of Avgpool backward.
 // if src_shape is not specified in inputs,
 // it should be specified in attributes.
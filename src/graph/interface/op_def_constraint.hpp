@@ -38,6 +38,8 @@ bool check_norm_data_type(const op_t *n);
 
 bool check_typecast_data_type(const op_t *n);
 
+bool check_rope_data_type(const op_t *n);
+
 bool check_avgpool_bwd_input_shape(const op_t *n);
 
 bool check_conv_bwd_data_output_shape(const op_t *n);
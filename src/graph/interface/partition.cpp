@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <limits>
@@ -33,11 +34,14 @@
 
 #include "graph/interface/allocator.hpp"
 #include "graph/interface/backend.hpp"
+#include "graph/interface/bucketed_partition.hpp"
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/graph.hpp"
 #include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/memory_plan.hpp"
 #include "graph/interface/op_schema.hpp"
 #include "graph/interface/partition.hpp"
+#include "graph/interface/partition_blob.hpp"
 #include "graph/interface/partition_cache.hpp"
 
 #ifdef DNNL_WITH_SYCL
@@ -217,6 +221,36 @@ status_t DNNL_API dnnl_graph_partition_compile(partition_t *partition,
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_partition_compile_with_symbolic_dims(
+        partition_t *partition, compiled_partition_t *compiled_partition,
+        size_t in_num, const logical_tensor_t **inputs, size_t out_num,
+        const logical_tensor_t **outputs, size_t num_symbolic_dims,
+        const symbolic_dim_t *symbolic_dims, engine_t *engine) {
+    if (utils::any_null(partition, compiled_partition, symbolic_dims, engine)) {
+        return status::invalid_arguments;
+    }
+
+    if (!partition->is_supported()) return status::invalid_arguments;
+
+    std::vector<const logical_tensor_t *> in {inputs, inputs + in_num};
+    std::vector<const logical_tensor_t *> out {outputs, outputs + out_num};
+    std::vector<symbolic_dim_t> dims {
+            symbolic_dims, symbolic_dims + num_symbolic_dims};
+
+    std::shared_ptr<compiled_partition_impl_t> impl;
+    double start_ms = dnnl::impl::get_msec();
+    CHECK(bucketed_compiled_partition_impl_t::create(
+            impl, partition, in, out, dims, engine));
+    compiled_partition->init(impl);
+    if (get_verbose(dnnl::impl::verbose_t::create_profile,
+                dnnl::impl::component_t::graph)) {
+        double duration_ms = dnnl::impl::get_msec() - start_ms;
+        VPROF(start_ms, graph, compile, ":symbolic_dims",
+                compiled_partition->info(), duration_ms);
+    }
+    return status::success;
+}
+
 status_t DNNL_API dnnl_graph_partition_get_input_ports_num(
         const partition_t *partition, size_t *num) {
     if (utils::any_null(partition, num)) { return status::invalid_arguments; }
@@ -544,6 +578,92 @@ status_t DNNL_API dnnl_graph_compiled_partition_get_scratchpad_logical_tensor(
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_compiled_partition_plan_memory(
+        size_t num_compiled_partitions,
+        const compiled_partition_t *const *compiled_partitions,
+        size_t *arena_size, size_t *num_tensors, size_t *tensor_ids,
+        size_t *tensor_offsets, size_t *scratchpad_offsets) {
+    if (utils::any_null(arena_size, num_tensors))
+        return status::invalid_arguments;
+    if (num_compiled_partitions > 0 && compiled_partitions == nullptr)
+        return status::invalid_arguments;
+
+    std::vector<const compiled_partition_t *> cps(compiled_partitions,
+            compiled_partitions + num_compiled_partitions);
+    memory_plan_t plan;
+    CHECK(plan.init(cps));
+
+    *arena_size = plan.arena_size();
+    const auto &offsets = plan.tensor_offsets();
+    if (!tensor_ids && !tensor_offsets && !scratchpad_offsets) {
+        *num_tensors = offsets.size();
+        return status::success;
+    }
+
+    if (utils::any_null(tensor_ids, tensor_offsets, scratchpad_offsets)
+            || *num_tensors != offsets.size())
+        return status::invalid_arguments;
+
+    for (size_t i = 0; i < offsets.size(); i++) {
+        tensor_ids[i] = offsets[i].first;
+        tensor_offsets[i] = offsets[i].second;
+    }
+    for (size_t i = 0; i < num_compiled_partitions; i++)
+        scratchpad_offsets[i] = plan.scratchpad_offsets()[i];
+
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_compiled_partition_prepare_constants(
+        const compiled_partition_t *compiled_partition, stream_t *stream,
+        size_t num_inputs, const tensor_t **inputs) {
+    if (utils::any_null(compiled_partition, stream))
+        return status::invalid_arguments;
+    if (num_inputs > 0 && inputs == nullptr) return status::invalid_arguments;
+
+    std::vector<tensor_t> ins;
+    ins.reserve(num_inputs);
+    for (size_t i = 0; i < num_inputs; i++) {
+        if (inputs[i] == nullptr) return status::invalid_arguments;
+        ins.emplace_back(*inputs[i]);
+    }
+    return compiled_partition->prepare_constants(stream, ins);
+}
+
+status_t DNNL_API dnnl_graph_compiled_partition_get_cache_blob_size(
+        const compiled_partition_t *compiled_partition, size_t *size) {
+    if (utils::any_null(compiled_partition, size))
+        return status::invalid_arguments;
+
+    std::vector<uint8_t> blob;
+    CHECK(get_partition_blob(compiled_partition, blob));
+    *size = blob.size();
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_compiled_partition_get_cache_blob(
+        const compiled_partition_t *compiled_partition, size_t size,
+        uint8_t *cache_blob) {
+    if (utils::any_null(compiled_partition, cache_blob))
+        return status::invalid_arguments;
+
+    std::vector<uint8_t> blob;
+    CHECK(get_partition_blob(compiled_partition, blob));
+    if (size != blob.size()) return status::invalid_arguments;
+    std::memcpy(cache_blob, blob.data(), size);
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_compiled_partition_create_from_cache_blob(
+        compiled_partition_t **compiled_partition, engine_t *engine,
+        size_t size, const uint8_t *cache_blob) {
+    if (utils::any_null(compiled_partition, engine, cache_blob))
+        return status::invalid_arguments;
+
+    return create_from_partition_blob(
+            compiled_partition, engine, cache_blob, size);
+}
+
 status_t dnnl_graph_partition::infer_shape(
         std::vector<const logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs) {
@@ -781,6 +901,44 @@ status_t dnnl_graph_compiled_partition::execute(const stream_t *astream,
     }
 }
 
+status_t dnnl_graph_compiled_partition::prepare_constants(
+        const stream_t *astream, const std::vector<tensor_t> &inputs) const {
+    if (!astream || astream->engine()->kind() != pimpl_->get_engine()->kind())
+        return status::invalid_arguments;
+
+    const backend_t *backend = src_partition_.get_assigned_backend();
+    if (!backend) return status::invalid_arguments;
+
+    std::vector<tensor_t> processed_inputs, processed_outputs;
+    CHECK(pre_process(processed_inputs, inputs, backend));
+
+    // The inputs are arranged as for an execution. Those not given, which
+    // the constant ops don't read, and the outputs have no data.
+    int64_t zero_scalar = 0;
+    std::vector<tensor_t> all_inputs, all_outputs;
+    for (const auto &lt : get_inputs()) {
+        auto it = std::find_if(processed_inputs.begin(),
+                processed_inputs.end(), [&](const tensor_t &t) {
+                    return t.get_logical_tensor().id == lt.id;
+                });
+        if (it != processed_inputs.end()) {
+            all_inputs.push_back(*it);
+        } else if (logical_tensor_wrapper_t(lt).is_constant()) {
+            return status::invalid_arguments;
+        } else {
+            void *handle = lt.property == property_type::host_scalar
+                    ? &zero_scalar
+                    : nullptr;
+            all_inputs.emplace_back(lt, pimpl_->get_engine(), handle);
+        }
+    }
+    for (const auto &lt : get_outputs())
+        all_outputs.emplace_back(lt, pimpl_->get_engine(), nullptr);
+
+    CHECK(pimpl_->prepare_constants(astream, all_inputs, all_outputs));
+    return const_cast<stream_t *>(astream)->wait();
+}
+
 #ifdef DNNL_WITH_SYCL
 status_t dnnl_graph_compiled_partition::execute_sycl(const stream_t *astream,
         const std::vector<tensor_t> &inputs,
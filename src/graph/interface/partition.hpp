@@ -198,6 +198,9 @@ public:
             const std::vector<cl_event> &ocl_deps, cl_event *ocl_event) const;
 #endif
 
+    graph::status_t prepare_constants(const graph::stream_t *astream,
+            const std::vector<graph::tensor_t> &inputs) const;
+
     size_t get_scratchpad_size() const {
         if (!pimpl_) return 0;
         return pimpl_->get_scratchpad_size();
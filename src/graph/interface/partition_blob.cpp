@@ -0,0 +1,439 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/serialization.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+#include "graph/interface/backend.hpp"
+#include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/op.hpp"
+#include "graph/interface/partition.hpp"
+#include "graph/interface/partition_blob.hpp"
+#include "graph/interface/value.hpp"
+
+#define VCHECK_PARTITION_BLOB(cond, status, msg, ...) \
+    VCONDCHECK(graph, create, check, partition_blob, (cond), status, msg, \
+            ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+namespace {
+
+const char *blob_magic = "dnnl_graph_compiled_partition";
+// To be increased on any change of the layout of the blob
+const uint32_t blob_format_version = 1;
+
+// Reads the blob back, failing instead of reading past its end.
+struct blob_reader_t {
+    blob_reader_t(const uint8_t *data, size_t size)
+        : data_(data), size_(size) {}
+
+    template <typename T>
+    bool read(T &t) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                "only trivially copyable types can be read");
+        if (size_ - pos_ < sizeof(T)) return false;
+        std::memcpy(&t, data_ + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    bool read(std::string &s) {
+        size_t len = 0;
+        if (!read(len) || size_ - pos_ < len) return false;
+        s.assign(reinterpret_cast<const char *>(data_ + pos_), len);
+        pos_ += len;
+        return true;
+    }
+
+    template <typename T>
+    bool read(std::vector<T> &v) {
+        size_t len = 0;
+        // Each element takes at least a byte
+        if (!read(len) || size_ - pos_ < len) return false;
+        v.resize(len);
+        for (auto &e : v)
+            if (!read(e)) return false;
+        return true;
+    }
+
+    bool at_end() const { return pos_ == size_; }
+
+private:
+    const uint8_t *data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
+// The layout ids of opaque logical tensors only have a meaning in the
+// process which created them.
+bool has_portable_layout(const logical_tensor_t &lt) {
+    return lt.layout_type != layout_type::opaque;
+}
+
+void write_lt(serialization_stream_t &s, const logical_tensor_t &lt) {
+    s.append(lt.id);
+    s.append(static_cast<int32_t>(lt.ndims));
+    for (int d = 0; d < lt.ndims; d++)
+        s.append(static_cast<int64_t>(lt.dims[d]));
+    s.append(static_cast<int32_t>(lt.data_type));
+    s.append(static_cast<int32_t>(lt.property));
+    s.append(static_cast<int32_t>(lt.layout_type));
+    if (lt.layout_type == layout_type::strided) {
+        for (int d = 0; d < lt.ndims; d++)
+            s.append(static_cast<int64_t>(lt.layout.strides[d]));
+    }
+}
+
+bool read_lt(blob_reader_t &r, logical_tensor_t &lt) {
+    int32_t ndims = 0, data_type = 0, property = 0, layout = 0;
+    lt = empty_logical_tensor_with_default_id();
+    if (!r.read(lt.id) || !r.read(ndims)) return false;
+    if (ndims > DNNL_MAX_NDIMS || ndims < DNNL_GRAPH_UNKNOWN_NDIMS)
+        return false;
+    lt.ndims = ndims;
+    for (int d = 0; d < ndims; d++) {
+        int64_t dim = 0;
+        if (!r.read(dim)) return false;
+        lt.dims[d] = dim;
+    }
+    if (!r.read(data_type) || !r.read(property) || !r.read(layout))
+        return false;
+    lt.data_type = static_cast<data_type_t>(data_type);
+    lt.property = static_cast<property_type_t>(property);
+    lt.layout_type = static_cast<layout_type_t>(layout);
+    if (lt.layout_type == layout_type::opaque) return false;
+    if (lt.layout_type == layout_type::strided) {
+        for (int d = 0; d < ndims; d++) {
+            int64_t stride = 0;
+            if (!r.read(stride)) return false;
+            lt.layout.strides[d] = stride;
+        }
+    }
+    return true;
+}
+
+void write_lts(
+        serialization_stream_t &s, const std::vector<logical_tensor_t> &lts) {
+    s.append(lts.size());
+    for (const auto &lt : lts)
+        write_lt(s, lt);
+}
+
+bool read_lts(blob_reader_t &r, std::vector<logical_tensor_t> &lts) {
+    size_t n = 0;
+    if (!r.read(n)) return false;
+    lts.clear();
+    for (size_t i = 0; i < n; i++) {
+        logical_tensor_t lt;
+        if (!read_lt(r, lt)) return false;
+        lts.push_back(lt);
+    }
+    return true;
+}
+
+bool write_attr(serialization_stream_t &s, op_attr_t name,
+        const utils::attribute_value_t &value) {
+    s.append(static_cast<int64_t>(name));
+    s.append(static_cast<uint32_t>(value.get_kind()));
+    switch (value.get_kind()) {
+        case attribute_kind::f: s.append(value.get<float>()); break;
+        case attribute_kind::fs:
+            s.append(value.get<std::vector<float>>());
+            break;
+        case attribute_kind::i: s.append(value.get<int64_t>()); break;
+        case attribute_kind::is:
+            s.append(value.get<std::vector<int64_t>>());
+            break;
+        case attribute_kind::s: s.append(value.get<std::string>()); break;
+        case attribute_kind::b:
+            s.append(static_cast<uint8_t>(value.get<bool>()));
+            break;
+        // Attributes set by the backends don't belong to source partitions
+        default: return false;
+    }
+    return true;
+}
+
+bool read_attr(blob_reader_t &r, op_t &op) {
+    int64_t name = 0;
+    uint32_t kind = 0;
+    if (!r.read(name) || !r.read(kind)) return false;
+    const op_attr_t attr = static_cast<op_attr_t>(name);
+    switch (kind) {
+        case attribute_kind::f: {
+            float v = 0;
+            if (!r.read(v)) return false;
+            op.set_attr(attr, v);
+        } break;
+        case attribute_kind::fs: {
+            std::vector<float> v;
+            if (!r.read(v)) return false;
+            op.set_attr(attr, v);
+        } break;
+        case attribute_kind::i: {
+            int64_t v = 0;
+            if (!r.read(v)) return false;
+            op.set_attr(attr, v);
+        } break;
+        case attribute_kind::is: {
+            std::vector<int64_t> v;
+            if (!r.read(v)) return false;
+            op.set_attr(attr, v);
+        } break;
+        case attribute_kind::s: {
+            std::string v;
+            if (!r.read(v)) return false;
+            op.set_attr(attr, v);
+        } break;
+        case attribute_kind::b: {
+            uint8_t v = 0;
+            if (!r.read(v)) return false;
+            op.set_attr(attr, static_cast<bool>(v));
+        } break;
+        default: return false;
+    }
+    return true;
+}
+
+void write_header(serialization_stream_t &s) {
+    const dnnl_version_t *ver = dnnl_version();
+    s.append(std::string(blob_magic));
+    s.append(blob_format_version);
+    s.append(static_cast<int32_t>(ver->major));
+    s.append(static_cast<int32_t>(ver->minor));
+    s.append(static_cast<int32_t>(ver->patch));
+    s.append(std::string(ver->hash));
+}
+
+bool check_header(blob_reader_t &r) {
+    const dnnl_version_t *ver = dnnl_version();
+    std::string magic, hash;
+    uint32_t format_version = 0;
+    int32_t major = 0, minor = 0, patch = 0;
+    if (!r.read(magic) || !r.read(format_version) || !r.read(major)
+            || !r.read(minor) || !r.read(patch) || !r.read(hash))
+        return false;
+    return magic == blob_magic && format_version == blob_format_version
+            && major == ver->major && minor == ver->minor
+            && patch == ver->patch && hash == ver->hash;
+}
+
+} // namespace
+
+status_t get_partition_blob(
+        const compiled_partition_t *cp, std::vector<uint8_t> &blob) {
+    const partition_t &part = cp->src_partition();
+    const partition_impl_t *pimpl = part.get_pimpl();
+    VCHECK_PARTITION_BLOB(pimpl && cp->is_initialized(),
+            status::invalid_arguments, "compiled partition is not initialized");
+    const std::string pass_name = pimpl->get_pass_name();
+    VCHECK_PARTITION_BLOB(!pass_name.empty(), status::unimplemented,
+            "partition was not created by a named pass");
+
+    auto portable = [](const std::vector<logical_tensor_t> &lts) {
+        return std::all_of(lts.begin(), lts.end(), has_portable_layout);
+    };
+    VCHECK_PARTITION_BLOB(portable(pimpl->get_inputs())
+                    && portable(pimpl->get_outputs())
+                    && portable(cp->get_inputs())
+                    && portable(cp->get_outputs()),
+            status::unimplemented, "opaque layouts are not supported");
+
+    serialization_stream_t s;
+    write_header(s);
+    s.append(part.get_assigned_backend()->get_name());
+    s.append(pass_name);
+    s.append(static_cast<int32_t>(part.get_engine_kind()));
+    s.append(static_cast<int32_t>(part.get_fpmath_mode().mode_));
+    s.append(static_cast<uint8_t>(part.get_fpmath_mode().apply_to_int_));
+    s.append(static_cast<int32_t>(part.get_kind()));
+
+    // The values connecting the ops, numbered in order of appearance
+    const auto &ops = part.get_ops();
+    std::unordered_map<const value_t *, size_t> value_idx;
+    std::vector<const value_t *> values;
+    for (const auto &op : ops) {
+        for (const auto *vals : {&op->get_input_values(),
+                     &op->get_output_values()}) {
+            for (const auto &v : *vals) {
+                if (value_idx.count(v.get())) continue;
+                VCHECK_PARTITION_BLOB(
+                        has_portable_layout(v->get_logical_tensor()),
+                        status::unimplemented,
+                        "opaque layouts are not supported");
+                value_idx[v.get()] = values.size();
+                values.push_back(v.get());
+            }
+        }
+    }
+    s.append(values.size());
+    for (const auto *v : values) {
+        write_lt(s, v->get_logical_tensor());
+        s.append(static_cast<uint8_t>(v->is_internal()));
+    }
+
+    s.append(ops.size());
+    for (const auto &op : ops) {
+        s.append(op->get_id());
+        s.append(static_cast<int64_t>(op->get_kind()));
+        s.append(op->get_name());
+        s.append(static_cast<uint8_t>(op->is_internal()));
+        const auto &attrs = op->get_attributes();
+        s.append(attrs.size());
+        for (const auto &attr : attrs) {
+            VCHECK_PARTITION_BLOB(write_attr(s, attr.first, attr.second),
+                    status::unimplemented, "unsupported attribute kind");
+        }
+        s.append(op->num_inputs());
+        for (const auto &v : op->get_input_values())
+            s.append(value_idx[v.get()]);
+        s.append(op->num_outputs());
+        for (const auto &v : op->get_output_values())
+            s.append(value_idx[v.get()]);
+    }
+
+    write_lts(s, pimpl->get_inputs());
+    write_lts(s, pimpl->get_outputs());
+    write_lts(s, cp->get_inputs());
+    write_lts(s, cp->get_outputs());
+
+    blob = s.get_data();
+    return status::success;
+}
+
+status_t create_from_partition_blob(compiled_partition_t **cp,
+        const engine_t *engine, const uint8_t *blob, size_t size) {
+    blob_reader_t r(blob, size);
+    VCHECK_PARTITION_BLOB(check_header(r), status::invalid_arguments,
+            "cache blob was not created by this version of the library");
+
+    std::string backend_name, pass_name;
+    int32_t engine_kind = 0, fpmath_mode = 0, pkind = 0;
+    uint8_t apply_to_int = 0;
+    size_t n_values = 0;
+    const bool ok = r.read(backend_name) && r.read(pass_name)
+            && r.read(engine_kind) && r.read(fpmath_mode)
+            && r.read(apply_to_int) && r.read(pkind) && r.read(n_values);
+    VCHECK_PARTITION_BLOB(ok, status::invalid_arguments, "bad cache blob");
+    VCHECK_PARTITION_BLOB(
+            engine_kind == static_cast<int32_t>(engine->kind()),
+            status::invalid_arguments, "engine kind mismatch");
+
+    const backend_t *backend = nullptr;
+    for (const auto *bkd :
+            backend_registry_t::get_singleton().get_registered_backends()) {
+        if (bkd->get_name() == backend_name) backend = bkd;
+    }
+    VCHECK_PARTITION_BLOB(backend, status::invalid_arguments,
+            "backend %s is not available", backend_name.c_str());
+
+    std::vector<std::shared_ptr<value_t>> values;
+    for (size_t i = 0; i < n_values; i++) {
+        logical_tensor_t lt;
+        uint8_t internal = 0;
+        VCHECK_PARTITION_BLOB(read_lt(r, lt) && r.read(internal),
+                status::invalid_arguments, "bad cache blob");
+        values.push_back(std::make_shared<value_t>(lt, internal != 0));
+    }
+
+    size_t n_ops = 0;
+    VCHECK_PARTITION_BLOB(
+            r.read(n_ops), status::invalid_arguments, "bad cache blob");
+    std::vector<std::shared_ptr<op_t>> ops;
+    for (size_t i = 0; i < n_ops; i++) {
+        size_t id = 0, n_attrs = 0;
+        int64_t kind = 0;
+        std::string name;
+        uint8_t internal = 0;
+        VCHECK_PARTITION_BLOB(r.read(id) && r.read(kind) && r.read(name)
+                        && r.read(internal) && r.read(n_attrs),
+                status::invalid_arguments, "bad cache blob");
+        auto op = std::make_shared<op_t>(
+                id, static_cast<op_kind_t>(kind), name, internal != 0);
+        for (size_t a = 0; a < n_attrs; a++) {
+            VCHECK_PARTITION_BLOB(read_attr(r, *op), status::invalid_arguments,
+                    "bad cache blob");
+        }
+
+        std::vector<size_t> inputs, outputs;
+        VCHECK_PARTITION_BLOB(r.read(inputs) && r.read(outputs),
+                status::invalid_arguments, "bad cache blob");
+        for (size_t idx : inputs) {
+            VCHECK_PARTITION_BLOB(idx < values.size(),
+                    status::invalid_arguments, "bad cache blob");
+            values[idx]->add_consumer(*op, op->num_inputs());
+            op->add_input(values[idx]);
+        }
+        for (size_t idx : outputs) {
+            VCHECK_PARTITION_BLOB(idx < values.size(),
+                    status::invalid_arguments, "bad cache blob");
+            op->add_output(values[idx]);
+        }
+        ops.push_back(op);
+    }
+
+    std::vector<logical_tensor_t> part_inputs, part_outputs, cp_inputs,
+            cp_outputs;
+    VCHECK_PARTITION_BLOB(read_lts(r, part_inputs) && read_lts(r, part_outputs)
+                    && read_lts(r, cp_inputs) && read_lts(r, cp_outputs)
+                    && r.at_end(),
+            status::invalid_arguments, "bad cache blob");
+
+    const fpmath_t fpmath(
+            static_cast<fpmath_mode_t>(fpmath_mode), apply_to_int != 0);
+    std::shared_ptr<partition_impl_t> pimpl;
+    CHECK(backend->create_partition_impl(pass_name,
+            static_cast<engine_kind_t>(engine_kind), fpmath,
+            static_cast<partition_kind_t>(pkind), ops, part_inputs,
+            part_outputs, pimpl));
+
+    partition_t part;
+    part.init(pimpl);
+
+    std::vector<const logical_tensor_t *> in, out;
+    for (const auto &lt : cp_inputs)
+        in.push_back(&lt);
+    for (const auto &lt : cp_outputs)
+        out.push_back(&lt);
+
+    std::unique_ptr<compiled_partition_t> new_cp(
+            new compiled_partition_t(part));
+    std::pair<compiled_partition_t *, cache_state_t> cp_state {
+            new_cp.get(), cache_state_t::compiled_partition_hit};
+    CHECK(part.compile(cp_state, in, out, engine));
+
+    *cp = new_cp.release();
+    return status::success;
+}
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_INTERFACE_PARTITION_BLOB_HPP
+#define GRAPH_INTERFACE_PARTITION_BLOB_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "graph/interface/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+// Cache blob of a compiled partition.
+//
+// The blob holds the ops of the source partition with their attributes and
+// logical tensors, the name of the backend and of the pass which created the
+// partition, and the logical tensors the partition was compiled with. Loading
+// it creates the partition again without building and partitioning a graph,
+// and compiles it for the given engine, going through the compiled partition
+// cache. A blob can only be loaded by the same version of the library.
+//
+// Partitions whose logical tensors have opaque layouts, or which were not
+// created by a named pass of their backend, have no blob.
+status_t get_partition_blob(
+        const compiled_partition_t *cp, std::vector<uint8_t> &blob);
+
+status_t create_from_partition_blob(compiled_partition_t **cp,
+        const engine_t *engine, const uint8_t *blob, size_t size);
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -115,6 +115,11 @@ public:
     /// Return the assigned backend of this partition
     virtual const backend_t *get_assigned_backend() const = 0;
 
+    /// Return the name of the pass which created this partition, used to
+    /// create it again from a cache blob. Empty if the partition can't be
+    /// created again this way.
+    virtual std::string get_pass_name() const { return std::string(); }
+
     /// Infer the outputs shape according to the inputs shape and the ops in
     /// this partition.
     /// @param inputs The inputs logical tensors whose shapes are valid
@@ -374,6 +379,23 @@ public:
     /// Returns the required scratchpad size in bytes.
     virtual size_t get_scratchpad_size() const = 0;
 
+    /// Computes and caches the constant intermediate tensors of the compiled
+    /// partition, e.g. reordered weights, ahead of the first execution
+    /// @param astream The stream used to compute them
+    /// @param inputs The inputs tensors, in the same order as for execute().
+    ///     Only the constant ones have data.
+    /// @param outputs The outputs tensors, without data
+    /// @return The status code. Backends which don't cache constant tensors
+    ///     have nothing to do and succeed.
+    virtual status_t prepare_constants(const stream_t *astream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) {
+        UNUSED(astream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        return status::success;
+    }
+
 protected:
     /// The engine which this compiled_partition_impl_t is specialized
     /// for. Should directly store the engine that is given when calling
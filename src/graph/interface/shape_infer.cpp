@@ -1048,6 +1048,54 @@ status_t infer_dropout_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_rope_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto in0 = logical_tensor_wrapper_t(inputs[0]);
+    auto cos = logical_tensor_wrapper_t(inputs[1]);
+    auto sin = logical_tensor_wrapper_t(inputs[2]);
+    const dims src_dims = in0.vdims();
+    const int32_t ndims = in0.ndims();
+
+    VCHECK_INVALID_SHAPE(ndims >= 2,
+            "%s, src should have at least 2 dimensions, but got %d",
+            op_t::kind2str(n->get_kind()).c_str(), ndims);
+    VCHECK_INVALID_SHAPE(src_dims.back() % 2 == 0,
+            "%s, the last dimension of src should be even, but got %ld",
+            op_t::kind2str(n->get_kind()).c_str(),
+            static_cast<long int>(src_dims.back()));
+    VCHECK_INVALID_SHAPE(cos.vdims() == sin.vdims(),
+            "%s, cos and sin should have the same shape, but got cos shape: "
+            "%s, sin shape: %s",
+            op_t::kind2str(n->get_kind()).c_str(),
+            dims2str(cos.vdims()).c_str(), dims2str(sin.vdims()).c_str());
+
+    // cos and sin are broadcast to src except for the rotated dimension
+    const dims cs_dims = cos.vdims();
+    bool cs_ok = !cs_dims.empty() && cs_dims.size() <= src_dims.size()
+            && cs_dims.back() == src_dims.back();
+    for (size_t i = 1; cs_ok && i < cs_dims.size(); ++i) {
+        const dim_t cs_d = cs_dims[cs_dims.size() - 1 - i];
+        const dim_t src_d = src_dims[src_dims.size() - 1 - i];
+        cs_ok = cs_d == 1 || cs_d == src_d;
+    }
+    VCHECK_INVALID_SHAPE(cs_ok,
+            "%s, cos and sin shape %s can't be broadcast to src shape %s",
+            op_t::kind2str(n->get_kind()).c_str(), dims2str(cs_dims).c_str(),
+            dims2str(src_dims).c_str());
+
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+    // check if partial set shape aligns with inferred shape
+    if (out0.ndims() != -1) {
+        VCHECK_INVALID_SHAPE(validate(src_dims, out0.vdims()),
+                "%s, input and output shapes are not compatible",
+                op_t::kind2str(n->get_kind()).c_str());
+    }
+
+    set_shape_and_strides(*outputs[0], src_dims);
+    return status::success;
+}
+
 status_t infer_identity_output_shape(op_t *n,
         std::vector<logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs) {
@@ -2565,6 +2613,68 @@ status_t infer_dnnl_sdpa_bwd_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_dnnl_residual_layernorm_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto in0 = ltw(inputs[0]);
+    auto in1 = ltw(inputs[1]);
+    VCHECK_INVALID_SHAPE(in0.vdims() == in1.vdims(),
+            "%s, input and residual should have the same shape, but got "
+            "input shape: %s, residual shape: %s",
+            op_t::kind2str(n->get_kind()).c_str(),
+            dims2str(in0.vdims()).c_str(), dims2str(in1.vdims()).c_str());
+
+    for (auto *out : outputs) {
+        auto out_lt = ltw(out);
+        if (out_lt.ndims() != -1) {
+            VCHECK_INVALID_SHAPE(validate(in0.vdims(), out_lt.vdims()),
+                    "%s, input and output shapes are not compatible",
+                    op_t::kind2str(n->get_kind()).c_str());
+        }
+        set_shape_and_strides(*out, in0.vdims());
+    }
+    return status::success;
+}
+
+status_t infer_dnnl_split_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto in0 = ltw(inputs[0]);
+    const auto ndims = in0.ndims();
+    const auto &sizes = n->get_attr<std::vector<int64_t>>(op_attr::sizes);
+    VCHECK_INVALID_SHAPE(sizes.size() == outputs.size(),
+            "%s, number of sizes should be equal to number of outputs",
+            op_t::kind2str(n->get_kind()).c_str());
+
+    int64_t axis = n->get_attr<int64_t>(op_attr::axis);
+    VCHECK_INVALID_SHAPE(axis >= -ndims && axis < ndims,
+            "%s, axis %d is out of range for input of %d dims",
+            op_t::kind2str(n->get_kind()).c_str(), static_cast<int>(axis),
+            static_cast<int>(ndims));
+    if (axis < 0) axis += ndims;
+
+    int64_t sum = 0;
+    for (const auto size : sizes)
+        sum += size;
+    VCHECK_INVALID_SHAPE(in0.dims()[axis] == sum,
+            "%s, sum of sizes should be equal to the input dim on axis",
+            op_t::kind2str(n->get_kind()).c_str());
+
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        auto out_dims = in0.vdims();
+        out_dims[axis] = sizes[i];
+        auto out_lt = ltw(outputs[i]);
+        if (!out_lt.is_shape_unknown()) {
+            VCHECK_INVALID_SHAPE(validate(out_dims, out_lt.vdims()),
+                    "%s, inferred output shape and shape from logical tensor "
+                    "are not compatible",
+                    op_t::kind2str(n->get_kind()).c_str());
+        }
+        set_shape_and_strides(*outputs[i], out_dims);
+    }
+    return status::success;
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "common/utils.hpp"
+
 #include "graph/utils/alloc.hpp"
 
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
@@ -60,23 +62,13 @@ void sycl_allocator_t::free(
 #endif
 
 void *cpu_allocator_t::malloc(size_t size, size_t alignment) {
-    void *ptr = nullptr;
     const size_t align = alignment == 0 ? DEFAULT_ALIGNMENT : alignment;
-#ifdef _WIN32
-    ptr = _aligned_malloc(size, align);
-    int rc = ((ptr) ? 0 : errno);
-#else
-    int rc = ::posix_memalign(&ptr, align, size);
-#endif /* _WIN32 */
-    return (rc == 0) ? ptr : nullptr;
+    // large buffers such as constant tensors may be backed by huge pages
+    return impl::malloc_large(size, static_cast<int>(align));
 }
 
 void cpu_allocator_t::free(void *p) {
-#ifdef _WIN32
-    _aligned_free((void *)p);
-#else
-    ::free((void *)p);
-#endif /* _WIN32 */
+    impl::free_large(p);
 }
 
 } // namespace utils
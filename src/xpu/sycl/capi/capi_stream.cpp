@@ -67,3 +67,27 @@ status_t dnnl_sycl_interop_stream_get_queue(stream_t *stream, void **queue) {
     *queue = static_cast<void *>(&sycl_queue);
     return status::success;
 }
+
+status_t dnnl_sycl_interop_stream_begin_capture(stream_t *stream) {
+    using namespace dnnl::impl;
+    bool args_ok = stream != nullptr
+            && stream->engine()->runtime_kind() == runtime_kind::sycl;
+    if (!args_ok) return status::invalid_arguments;
+    return stream->begin_graph_capture();
+}
+
+status_t dnnl_sycl_interop_stream_end_capture(stream_t *stream) {
+    using namespace dnnl::impl;
+    bool args_ok = stream != nullptr
+            && stream->engine()->runtime_kind() == runtime_kind::sycl;
+    if (!args_ok) return status::invalid_arguments;
+    return stream->end_graph_capture();
+}
+
+status_t dnnl_sycl_interop_stream_replay(stream_t *stream) {
+    using namespace dnnl::impl;
+    bool args_ok = stream != nullptr
+            && stream->engine()->runtime_kind() == runtime_kind::sycl;
+    if (!args_ok) return status::invalid_arguments;
+    return stream->replay_graph();
+}
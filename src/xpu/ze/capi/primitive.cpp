@@ -72,3 +72,37 @@ status_t dnnl_ze_interop_primitive_execute(
 
     return status;
 }
+
+status_t dnnl_ze_interop_matmul_execute_chunked(
+        const primitive_iface_t *primitive_iface, stream_t *stream, int nargs,
+        const dnnl_exec_arg_t *args, int ndeps, const ze_event_handle_t *deps,
+        dim_t chunk_size, int nchunks, const ze_event_handle_t *chunk_events,
+        ze_event_handle_t *return_event) {
+    const bool ok = !utils::any_null(primitive_iface, stream, chunk_events)
+            && stream->engine()->runtime_kind() == runtime_kind::ze
+            && primitive_iface->pd()->impl()->kind() == primitive_kind::matmul
+            && chunk_size > 0;
+    if (!ok) return status::invalid_arguments;
+
+    const auto *dst_md = primitive_iface->pd()->impl()->dst_md();
+    const dim_t n = dst_md->dims[dst_md->ndims - 1];
+    if (is_runtime_value(n)) return status::unimplemented;
+    if (nchunks != utils::div_up(n, chunk_size))
+        return status::invalid_arguments;
+
+    auto *ze_stream_impl
+            = utils::downcast<xpu::ze::stream_impl_t *>(stream->impl());
+    ze_stream_impl->ze_ctx().set_chunk_events(chunk_size,
+            std::vector<ze_event_handle_t>(
+                    chunk_events, chunk_events + nchunks));
+
+    auto status = dnnl_ze_interop_primitive_execute(primitive_iface, stream,
+            nargs, args, ndeps, deps, return_event);
+
+    // Signal the chunks the implementation did not signal by itself.
+    if (status == status::success)
+        status = ze_stream_impl->signal_chunk(nchunks - 1);
+    ze_stream_impl->ze_ctx().reset_chunk_events();
+
+    return status;
+}
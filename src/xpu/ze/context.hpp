@@ -17,6 +17,8 @@
 #ifndef XPU_ZE_CONTEXT_HPP
 #define XPU_ZE_CONTEXT_HPP
 
+#include "common/c_types_map.hpp"
+
 #include "xpu/context.hpp"
 
 #include "xpu/ze/utils.hpp"
@@ -98,8 +100,29 @@ public:
         event_.append(event);
     }
 
+    // Events signaled when consecutive chunks of `chunk_size` destination
+    // columns are computed, see dnnl_ze_interop_matmul_execute_chunked().
+    void set_chunk_events(
+            dim_t chunk_size, std::vector<ze_event_handle_t> &&events) {
+        chunk_size_ = chunk_size;
+        chunk_events_ = std::move(events);
+        chunks_signaled_ = 0;
+    }
+    void reset_chunk_events() { set_chunk_events(0, {}); }
+
+    dim_t chunk_size() const { return chunk_size_; }
+    int nchunks() const { return static_cast<int>(chunk_events_.size()); }
+    int chunks_signaled() const { return chunks_signaled_; }
+    // Returns the next chunk event to signal.
+    ze_event_handle_t next_chunk_event() {
+        return chunk_events_[chunks_signaled_++];
+    }
+
 private:
     event_t event_;
+    dim_t chunk_size_ = 0;
+    std::vector<ze_event_handle_t> chunk_events_;
+    int chunks_signaled_ = 0;
 };
 
 } // namespace ze
@@ -121,6 +121,19 @@ status_t stream_impl_t::barrier() {
     return status::success;
 }
 
+status_t stream_impl_t::signal_chunk(int idx) {
+    auto &ctx = ze_ctx();
+    while (ctx.chunks_signaled() <= idx
+            && ctx.chunks_signaled() < ctx.nchunks()) {
+        // The barrier signals the event once all the previously submitted
+        // commands are completed.
+        ZE_CHECK(ze::zeCommandListAppendBarrier(
+                list_, ctx.next_chunk_event(), 0, nullptr));
+    }
+
+    return status::success;
+}
+
 status_t stream_impl_t::init_flags(
         unsigned *flags, ze_command_list_handle_t list, bool profiling) {
     *flags = 0;
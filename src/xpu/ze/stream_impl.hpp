@@ -53,6 +53,10 @@ public:
 
     status_t barrier();
 
+    // Signals the chunk events up to and including `idx` that have not been
+    // signaled yet, see dnnl_ze_interop_matmul_execute_chunked().
+    status_t signal_chunk(int idx);
+
     const xpu::ze::context_t &ze_ctx() const;
     xpu::ze::context_t &ze_ctx();
     xpu::context_t &ctx();
@@ -42,6 +42,7 @@
 #include "prelu/prelu.hpp"
 #include "reduction/reduction.hpp"
 #include "reorder/reorder.hpp"
+#include "replay/replay.hpp"
 #include "resampling/resampling.hpp"
 #include "rnn/rnn.hpp"
 #include "sdpa/sdpa.hpp"
@@ -69,6 +70,8 @@ int fix_times_per_prb {default_fix_times_per_prb};
 int default_fix_times_per_prb {0};
 int repeats_per_prb {default_repeats_per_prb};
 int default_repeats_per_prb {1};
+double peak_bw {0};
+double peak_flops {0};
 
 bool default_fast_ref {DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE};
 bool fast_ref {default_fast_ref};
@@ -77,6 +80,46 @@ bool allow_enum_tags_only {true};
 int test_start {0};
 bool attr_same_pd_check {false};
 bool check_ref_impl {false};
+bool impl_shootout {false};
+int create_repeats {0};
+bool create_cache_bypass {false};
+
+// Returns the entry point of a driver given by its option name.
+static bench_f get_bench(const char *driver) {
+    if (!strcmp("--self", driver)) return self::bench;
+    if (!strcmp("--conv", driver)) return conv::bench;
+    if (!strcmp("--deconv", driver)) return deconv::bench;
+    if (!strcmp("--ip", driver)) return ip::bench;
+    if (!strcmp("--shuffle", driver)) return shuffle::bench;
+    if (!strcmp("--reorder", driver)) return reorder::bench;
+    if (!strcmp("--bnorm", driver)) return bnorm::bench;
+    if (!strcmp("--gnorm", driver)) return gnorm::bench;
+    if (!strcmp("--lnorm", driver)) return lnorm::bench;
+    if (!strcmp("--rnn", driver)) return rnn::bench;
+    if (!strcmp("--softmax", driver)) return softmax::bench;
+    if (!strcmp("--pool", driver)) return pool::bench;
+    if (!strcmp("--prelu", driver)) return prelu::bench;
+    if (!strcmp("--sum", driver)) return sum::bench;
+    if (!strcmp("--eltwise", driver)) return eltwise::bench;
+    if (!strcmp("--concat", driver)) return concat::bench;
+    if (!strcmp("--lrn", driver)) return lrn::bench;
+    if (!strcmp("--binary", driver)) return binary::bench;
+    if (!strcmp("--matmul", driver)) return matmul::bench;
+    if (!strcmp("--resampling", driver)) return resampling::bench;
+    if (!strcmp("--reduction", driver)) return reduction::bench;
+    if (!strcmp("--sdpa", driver)) return sdpa::bench;
+    if (!strcmp("--zeropad", driver)) return zeropad::bench;
+    if (!strcmp("--brgemm", driver)) return brgemm::bench;
+    if (!strcmp("--graph", driver)) {
+#ifdef BUILD_GRAPH
+        return graph::bench;
+#else
+        printf("Error: the library was built without Graph API support.\n");
+        exit(1);
+#endif
+    }
+    return nullptr;
+}
 
 int main(int argc, char **argv) {
     using namespace parser;
@@ -98,65 +141,16 @@ int main(int argc, char **argv) {
     for (; argc > 0; --argc, ++argv)
         if (!parse_bench_settings(argv[0])) break;
 
-    if (!strcmp("--self", argv[0])) {
-        self::bench(--argc, ++argv);
-    } else if (!strcmp("--conv", argv[0])) {
-        conv::bench(--argc, ++argv);
-    } else if (!strcmp("--deconv", argv[0])) {
-        deconv::bench(--argc, ++argv);
-    } else if (!strcmp("--ip", argv[0])) {
-        ip::bench(--argc, ++argv);
-    } else if (!strcmp("--shuffle", argv[0])) {
-        shuffle::bench(--argc, ++argv);
-    } else if (!strcmp("--reorder", argv[0])) {
-        reorder::bench(--argc, ++argv);
-    } else if (!strcmp("--bnorm", argv[0])) {
-        bnorm::bench(--argc, ++argv);
-    } else if (!strcmp("--gnorm", argv[0])) {
-        gnorm::bench(--argc, ++argv);
-    } else if (!strcmp("--lnorm", argv[0])) {
-        lnorm::bench(--argc, ++argv);
-    } else if (!strcmp("--rnn", argv[0])) {
-        rnn::bench(--argc, ++argv);
-    } else if (!strcmp("--softmax", argv[0])) {
-        softmax::bench(--argc, ++argv);
-    } else if (!strcmp("--pool", argv[0])) {
-        pool::bench(--argc, ++argv);
-    } else if (!strcmp("--prelu", argv[0])) {
-        prelu::bench(--argc, ++argv);
-    } else if (!strcmp("--sum", argv[0])) {
-        sum::bench(--argc, ++argv);
-    } else if (!strcmp("--eltwise", argv[0])) {
-        eltwise::bench(--argc, ++argv);
-    } else if (!strcmp("--concat", argv[0])) {
-        concat::bench(--argc, ++argv);
-    } else if (!strcmp("--lrn", argv[0])) {
-        lrn::bench(--argc, ++argv);
-    } else if (!strcmp("--binary", argv[0])) {
-        binary::bench(--argc, ++argv);
-    } else if (!strcmp("--matmul", argv[0])) {
-        matmul::bench(--argc, ++argv);
-    } else if (!strcmp("--resampling", argv[0])) {
-        resampling::bench(--argc, ++argv);
-    } else if (!strcmp("--reduction", argv[0])) {
-        reduction::bench(--argc, ++argv);
-    } else if (!strcmp("--sdpa", argv[0])) {
-        sdpa::bench(--argc, ++argv);
-    } else if (!strcmp("--zeropad", argv[0])) {
-        zeropad::bench(--argc, ++argv);
-    } else if (!strcmp("--brgemm", argv[0])) {
-        brgemm::bench(--argc, ++argv);
-        brgemm::brgemm_finalize();
-    } else if (!strcmp("--graph", argv[0])) {
-#ifdef BUILD_GRAPH
-        graph::bench(--argc, ++argv);
-#else
-        printf("Error: the library was built without Graph API support.\n");
-        exit(1);
-#endif
+    if (!strcmp("--replay", argv[0])) {
+        replay::bench(--argc, ++argv, get_bench);
     } else {
-        printf("Error: can't parse the driver name \'%s\'.\n", argv[0]);
-        exit(1);
+        const bench_f bench = get_bench(argv[0]);
+        if (!bench) {
+            printf("Error: can't parse the driver name \'%s\'.\n", argv[0]);
+            exit(1);
+        }
+        bench(--argc, ++argv);
+        if (bench == brgemm::bench) brgemm::brgemm_finalize();
     }
 
     total_time.stamp();
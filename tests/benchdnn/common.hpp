@@ -96,6 +96,9 @@ extern bool canonical;
 extern bool mem_check;
 extern bool attr_same_pd_check;
 extern bool check_ref_impl;
+extern bool impl_shootout;
+extern int create_repeats;
+extern bool create_cache_bypass;
 extern std::string skip_impl; /* empty or "" means skip nothing */
 extern std::string driver_name;
 
@@ -174,6 +177,8 @@ extern int fix_times_per_prb; // if non-zero run prb that many times
 extern int default_fix_times_per_prb; // 0, rely on time criterion
 extern int repeats_per_prb; // test repeats per prb
 extern int default_repeats_per_prb; // default test repeats per prb
+extern double peak_bw; // memory bandwidth roof in GB/s, 0 to measure it
+extern double peak_flops; // compute roof in GFLOPS, 0 if unknown
 
 extern bool fast_ref;
 extern bool default_fast_ref;
@@ -15,16 +15,23 @@
 *******************************************************************************/
 
 #include <algorithm> // for std::reverse and std::copy
+#include <atomic>
 #include <functional> // for std::bind and std::placeholders
 #include <future> // for std::promise and std::future
 #include <list>
 #include <numeric>
 #include <string> // for std::string
+#include <thread>
 #include <utility> // for std::pair
 #include <vector> // for std::vector
 
 #include <assert.h>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include "oneapi/dnnl/dnnl.hpp"
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 #include "oneapi/dnnl/dnnl_ocl.hpp"
@@ -52,8 +59,11 @@
 
 #include "utils/cold_cache.hpp"
 #include "utils/dnnl_query.hpp"
+#include "utils/energy.hpp"
 #include "utils/execution_mode.hpp"
 #include "utils/fill.hpp"
+#include "utils/numa.hpp"
+#include "utils/replay.hpp"
 #include "utils/stream_kind.hpp"
 
 extern "C" dnnl_status_t dnnl_impl_notify_profiling_complete(
@@ -283,6 +293,15 @@ memory_kind_ext_t memory_kind {default_memory_kind};
 int default_num_streams = 1;
 int num_streams = default_num_streams;
 
+int default_num_instances = 1;
+int num_instances = default_num_instances;
+// The number of cores each instance is pinned to, `0` to not pin instances
+int instance_cores = 0;
+// Prints the distribution of the execution times of each problem
+bool latency_dist = false;
+// The kind of the threadpools of instances with the threadpool runtime
+std::string threadpool_kind = "native";
+
 void init_isa_settings() {
     if (hints.get() == isa_hints_t::no_hints) {
         DNN_SAFE_V(dnnl_set_cpu_isa_hints(dnnl_cpu_isa_no_hints));
@@ -544,18 +563,36 @@ int update_timer_with_profiling_info(timer::timer_t &t, bool use_profiling,
     return OK;
 }
 
-inline int measure_perf_individual(timer::timer_t &t, dnnl_stream_t stream,
-        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args) {
+// Reads the energy counters only when the energy is measured, as reading them
+// takes a noticeable time.
+static energy::sample_t read_energy() {
+    return energy_measure ? energy::read() : energy::sample_t();
+}
+
+// Saves the energy per execution of a problem consumed from `begin` to `end`
+// over `n_execs` executions.
+static void set_energy(res_t *res, const energy::sample_t &begin,
+        const energy::sample_t &end, size_t n_execs) {
+    if (!energy_measure || n_execs == 0) return;
+    res->energy_j = energy::joules(begin, end) / n_execs;
+}
+
+inline int measure_perf_individual(timer::timer_t &t, res_t *res,
+        dnnl_stream_t stream, perf_function_t &perf_func,
+        std::vector<dnnl_exec_arg_t> &dnnl_args) {
     // Warm-up run, this is not measured due to possibility the associated
     // kernel has not been built and skews the results.
     if (!has_bench_mode_bit(mode_bit_t::sim)) {
+        const double start_ms = timer::ms_now();
         DNN_SAFE(perf_func(stream, dnnl_args), WARN);
         DNN_SAFE(dnnl_stream_wait(stream), CRIT);
+        res->cold_ms = timer::ms_now() - start_ms;
     }
 
     cold_cache_t cold_cache(dnnl_args, stream);
 
     t.reset();
+    const auto energy_start = read_energy();
     while (true) {
         if (!cold_cache.update_dnnl_args(dnnl_args)) break;
         t.start();
@@ -563,10 +600,11 @@ inline int measure_perf_individual(timer::timer_t &t, dnnl_stream_t stream,
         t.stamp();
         if (should_stop(t)) break;
     }
+    set_energy(res, energy_start, read_energy(), t.times());
     return OK;
 }
 
-inline int measure_perf_aggregate(timer::timer_t &t,
+inline int measure_perf_aggregate(timer::timer_t &t, res_t *res,
         const std::vector<stream_t> &v_stream, perf_function_t &perf_func,
         std::vector<std::vector<dnnl_exec_arg_t>> &dnnl_args) {
     std::vector<cold_cache_t> cold_cache(num_streams);
@@ -578,8 +616,10 @@ inline int measure_perf_aggregate(timer::timer_t &t,
     // kernel has not been built and skews the results.
     if (!has_bench_mode_bit(mode_bit_t::sim)) {
         for (size_t j = 0; j < v_stream.size(); j++) {
+            const double start_ms = timer::ms_now();
             DNN_SAFE(perf_func(v_stream[j], dnnl_args[j]), WARN);
             DNN_SAFE(dnnl_stream_wait(v_stream[j]), CRIT);
+            if (j == 0) res->cold_ms = timer::ms_now() - start_ms;
         }
     }
 
@@ -613,6 +653,7 @@ inline int measure_perf_aggregate(timer::timer_t &t,
     // Measuring loop. A single synchronization point, called once, the number
     // of submissions determined above based on n_times or plain time criterion.
     t.reset();
+    const auto energy_start = read_energy();
     // Keep a separate variable due to a `break` inside the loop.
     int execute_count = 0;
     // Keep inner loop over streams for better submission overlapping.
@@ -626,6 +667,7 @@ inline int measure_perf_aggregate(timer::timer_t &t,
     for (size_t j = 0; j < v_stream.size(); j++) {
         DNN_SAFE(dnnl_stream_wait(v_stream[j]), CRIT);
     }
+    set_energy(res, energy_start, read_energy(), execute_count);
 
     SAFE(update_timer_with_profiling_info(
                  t, use_profiling, v_stream, execute_count),
@@ -642,20 +684,197 @@ inline int measure_perf_aggregate(timer::timer_t &t,
     return OK;
 }
 
+// Pins the calling thread to the `instance_cores` cores of an instance. The
+// threads of the threading runtime created by the calling thread inherit its
+// affinity.
+static void pin_instance_thread(int instance) {
+    if (!instance_cores) return;
+#if defined(__linux__)
+    const int first_core = instance * instance_cores;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int c = first_core; c < first_core + instance_cores; c++)
+        CPU_SET(c, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set)) {
+        BENCHDNN_PRINT(0,
+                "WARNING: could not pin instance %d to cores [%d, %d).\n",
+                instance, first_core, first_core + instance_cores);
+    }
+#else
+    BENCHDNN_PRINT(0, "%s\n",
+            "WARNING: instances pinning is supported on Linux only.");
+#endif
+}
+
+// Runs the problem on `num_instances` OS threads at the same time, each with
+// its own stream and memory objects and in its own threading context, to
+// reproduce the contention of concurrent instances of an application. The
+// measurements of all instances are collected in `t`.
+inline int measure_perf_instances(const thr_ctx_t &ctx, timer::timer_t &t,
+        res_t *res, const std::vector<stream_t> &v_stream,
+        perf_function_t &perf_func,
+        std::vector<std::vector<dnnl_exec_arg_t>> &dnnl_args) {
+    std::vector<timer::timer_t> timers(num_instances);
+    std::vector<int> status(num_instances, OK);
+    std::vector<double> start_ms(num_instances), end_ms(num_instances);
+    std::vector<double> instance_cold_ms(num_instances);
+    std::vector<energy::sample_t> energy_start(num_instances),
+            energy_end(num_instances);
+    std::atomic<int> n_ready(0);
+
+    auto run_instance = [&](int i) -> int {
+        // Warm-up run, this is not measured due to possibility the associated
+        // kernel has not been built and skews the results.
+        dnnl_status_t warm_up_status = dnnl_success;
+        if (!has_bench_mode_bit(mode_bit_t::sim)) {
+            const double warm_up_start_ms = timer::ms_now();
+            warm_up_status = perf_func(v_stream[i], dnnl_args[i]);
+            if (warm_up_status == dnnl_success)
+                warm_up_status = dnnl_stream_wait(v_stream[i]);
+            instance_cold_ms[i] = timer::ms_now() - warm_up_start_ms;
+        }
+
+        cold_cache_t cold_cache(dnnl_args[i], v_stream[i]);
+
+        // Instances start measuring together, so each of them runs with the
+        // others for the whole measurement.
+        n_ready++;
+        while (n_ready.load() < num_instances)
+            std::this_thread::yield();
+        DNN_SAFE(warm_up_status, WARN);
+
+        auto &ti = timers[i];
+        ti.reset();
+        energy_start[i] = read_energy();
+        start_ms[i] = timer::ms_now();
+        while (true) {
+            if (!cold_cache.update_dnnl_args(dnnl_args[i])) break;
+            ti.start();
+            DNN_SAFE(perf_func(v_stream[i], dnnl_args[i]), WARN);
+            ti.stamp();
+            if (should_stop(ti)) break;
+        }
+        end_ms[i] = timer::ms_now();
+        energy_end[i] = read_energy();
+        return OK;
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_instances; i++) {
+        threads.emplace_back([&, i]() {
+            pin_instance_thread(i);
+            status[i] = execute_in_thr_ctx(ctx, run_instance, i);
+        });
+    }
+    for (auto &th : threads)
+        th.join();
+
+    t.reset();
+    for (int i = 0; i < num_instances; i++) {
+        SAFE(status[i], WARN);
+        t.append(timers[i]);
+    }
+
+    const auto first_start = std::min_element(start_ms.begin(), start_ms.end());
+    const auto last_end = std::max_element(end_ms.begin(), end_ms.end());
+    const double wall_ms = *last_end - *first_start;
+    res->throughput = wall_ms > 0 ? t.times() / wall_ms * 1e3 : 0;
+    res->cold_ms = *std::max_element(
+            instance_cold_ms.begin(), instance_cold_ms.end());
+    // The energy counters are system-wide, so the energy is taken over the
+    // time all instances ran.
+    set_energy(res, energy_start[first_start - start_ms.begin()],
+            energy_end[last_end - end_ms.begin()], t.times());
+    return OK;
+}
+
+// Prints the percentiles and the histogram of the execution times collected in
+// `t`, followed by the times themselves in the order of the executions.
+static void report_latency_dist(const timer::timer_t &t, double cold_ms) {
+    if (t.samples_.empty()) return;
+
+    const double min_ms = t.ms(timer::timer_t::min);
+    const double max_ms = t.ms(timer::timer_t::max);
+    BENCHDNN_PRINT(0,
+            "[LATENCY] cold(ms):%g iterations:%zu min(ms):%g p50(ms):%g "
+            "p90(ms):%g p99(ms):%g max(ms):%g\n",
+            cold_ms, t.samples_.size(), min_ms, t.ms_percentile(50),
+            t.ms_percentile(90), t.ms_percentile(99), max_ms);
+
+    constexpr int n_bins = 10;
+    const double bin_ms = (max_ms - min_ms) / n_bins;
+    std::vector<size_t> bins(n_bins);
+    for (const auto &s : t.samples_) {
+        const int b = bin_ms > 0 ? static_cast<int>((s.ms - min_ms) / bin_ms)
+                                 : 0;
+        bins[std::min(b, n_bins - 1)]++;
+    }
+    for (int b = 0; b < n_bins; b++) {
+        if (bin_ms == 0 && b > 0) break;
+        BENCHDNN_PRINT(0, "[LATENCY] bin(ms):[%g,%g%s count:%zu share:%.2f%%\n",
+                min_ms + b * bin_ms, min_ms + (b + 1) * bin_ms,
+                b == n_bins - 1 ? "]" : ")", bins[b],
+                100. * bins[b] / t.samples_.size());
+    }
+
+    std::string times;
+    for (const auto &s : t.samples_)
+        times += " " + std::to_string(s.ms);
+    BENCHDNN_PRINT(0, "[LATENCY] times(ms):%s\n", times.c_str());
+}
+
 int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
         args_t &args) {
     if (!has_bench_mode_bit(mode_bit_t::perf)) return OK;
 
+    if (energy_measure && !energy::is_available()) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "Error: `--energy` requires powercap or hwmon energy counters, "
+                "none was found.");
+        return FAIL;
+    }
+
     const auto &engine = get_test_engine();
-    std::vector<stream_t> v_stream(num_streams);
-    for (int i = 0; i < num_streams; i++)
-        v_stream[i] = stream_t(engine, ctx.get_interop_obj());
+    // Instances are OS threads executing synchronously on their own streams.
+    // With the threadpool runtime, each instance brings its own threadpool.
+    const bool use_instances = num_instances > 1;
+    if (use_instances && (!is_cpu(engine) || is_async(engine))) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "Error: `--num-instances` is supported for CPU engines with "
+                "synchronous runtimes only.");
+        return FAIL;
+    }
 
-    std::vector<std::vector<dnnl_exec_arg_t>> dnnl_args(num_streams);
-    std::vector<dnn_mem_map_t> mem_map(num_streams);
-    std::vector<args_t> v_args(num_streams);
+    // Each stream or instance operates on its own copy of memory objects.
+    const int n_copies = use_instances ? num_instances : num_streams;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    // The threadpools must outlive the streams using them.
+    std::vector<std::unique_ptr<dnnl::threadpool_interop::threadpool_iface>>
+            v_threadpool(use_instances ? n_copies : 0);
+    for (size_t i = 0; i < v_threadpool.size(); i++) {
+        // The threads of a threadpool inherit the affinity of the thread
+        // creating them, which is pinned to the cores of the instance.
+        std::thread([&, i]() {
+            pin_instance_thread(static_cast<int>(i));
+            v_threadpool[i] = dnnl::testing::create_threadpool(
+                    threadpool_kind, instance_cores);
+        }).join();
+    }
+#endif
+    std::vector<stream_t> v_stream(n_copies);
+    for (int i = 0; i < n_copies; i++) {
+        void *interop_obj = ctx.get_interop_obj();
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        if (use_instances) interop_obj = v_threadpool[i].get();
+#endif
+        v_stream[i] = stream_t(engine, interop_obj);
+    }
+
+    std::vector<std::vector<dnnl_exec_arg_t>> dnnl_args(n_copies);
+    std::vector<dnn_mem_map_t> mem_map(n_copies);
+    std::vector<args_t> v_args(n_copies);
     v_args[0] = args;
-    for (int j = 1; j < num_streams; j++) {
+    for (int j = 1; j < n_copies; j++) {
         for (int i = 0; i < args.size(); i++) {
             int arg = args.arg(i);
             const auto &m = args.dnn_mem(i);
@@ -669,6 +888,7 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
         execute_unmap_args(v_args[j], dnnl_args[j]);
     }
     execute_unmap_args(args, dnnl_args[0]);
+    if (numa_report) report_numa_placement(args);
 
     auto &t = res->timer_map.perf_timer();
     // For non-DPCPP CPU: measure individual iterations.
@@ -676,17 +896,31 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
     // overhead. DPCPP CPU follows the model of GPU, thus, handled similar.
     // For async threadpool CPU: use aggregate as well, similar to DPCPP CPU.
     int ret = OK;
-    if (is_async(engine)) {
-        ret = execute_in_thr_ctx(
-                ctx, measure_perf_aggregate, t, v_stream, perf_func, dnnl_args);
+    if (use_instances) {
+        ret = measure_perf_instances(
+                ctx, t, res, v_stream, perf_func, dnnl_args);
+    } else if (is_async(engine)) {
+        ret = execute_in_thr_ctx(ctx, measure_perf_aggregate, t, res,
+                v_stream, perf_func, dnnl_args);
     } else {
-        ret = execute_in_thr_ctx(ctx, measure_perf_individual, t, v_stream[0],
-                perf_func, dnnl_args[0]);
+        ret = execute_in_thr_ctx(ctx, measure_perf_individual, t, res,
+                v_stream[0], perf_func, dnnl_args[0]);
+    }
+    if (ret == OK && latency_dist) report_latency_dist(t, res->cold_ms);
+    if (ret == OK && energy_measure) {
+        // Instances run concurrently, so the power is taken over the wall
+        // time of all executions.
+        const double sec = t.sec(timer::timer_t::avg);
+        const double power = res->throughput
+                ? res->energy_j * res->throughput
+                : (sec > 0 ? res->energy_j / sec : 0.);
+        BENCHDNN_PRINT(0, "[ENERGY] execution(J):%g power(W):%g\n",
+                res->energy_j, power);
     }
 
     res->state = (ret == OK ? EXECUTED : FAILED);
     execute_map_args(args);
-    for (int j = 1; j < num_streams; j++) {
+    for (int j = 1; j < n_copies; j++) {
         execute_map_args(v_args[j]);
     }
 
@@ -695,6 +929,10 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
 
 int measure_perf(
         const thr_ctx_t &ctx, res_t *res, dnnl_primitive_t prim, args_t &args) {
+    auto &replay_sequence = get_replay_sequence();
+    if (replay_sequence.is_recording() && has_bench_mode_bit(mode_bit_t::perf))
+        SAFE(replay_sequence.record(prim, args, res->impl_name), WARN);
+
     perf_function_t perf_func = std::bind(&primitive_executor, prim,
             std::placeholders::_1, std::placeholders::_2);
 
@@ -940,6 +1178,22 @@ int check_same_pd(const dnnl_primitive_desc_t &pd_no_attr, res_t *res) {
 }
 
 // Checks if unexpected reference implementation was hit.
+void report_create_time(const timer::timer_t &cpd_timer,
+        const timer::timer_t &cp_timer, const timer::timer_t &cp_hit_timer) {
+    const auto report = [](const char *name, const timer::timer_t &t) {
+        if (!t.times()) return;
+        BENCHDNN_PRINT(0,
+                "[CREATE_TIME] %s(ms): min:%g p50:%g p90:%g p99:%g max:%g "
+                "avg:%g\n",
+                name, t.ms(timer::timer_t::min), t.ms_percentile(50),
+                t.ms_percentile(90), t.ms_percentile(99),
+                t.ms(timer::timer_t::max), t.ms(timer::timer_t::avg));
+    };
+    report("create_pd", cpd_timer);
+    report("create_prim", cp_timer);
+    report("create_prim_cache_hit", cp_hit_timer);
+}
+
 int check_ref_impl_hit(res_t *res) {
     if (!check_ref_impl) return OK;
 
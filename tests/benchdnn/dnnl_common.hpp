@@ -60,6 +60,11 @@ int check_primitive_cache(dnnl_primitive_t p, res_t *res);
 extern isa_hints_t hints;
 extern int default_num_streams;
 extern int num_streams;
+extern int default_num_instances;
+extern int num_instances;
+extern int instance_cores;
+extern bool latency_dist;
+extern std::string threadpool_kind;
 
 bool is_f64_supported(const engine_t &engine = get_test_engine());
 
@@ -278,12 +283,23 @@ int fetch_impl(benchdnn_dnnl_wrapper_t<dnnl_primitive_desc_t> &pdw,
     // Service primitive is not supposed to utilize further logic.
     if (is_service_prim) return OK;
 
+    // The implementations taken by the previous runs in the
+    // implementation-shootout mode. Prim_ref objects don't participate.
+    const int n_impls_to_skip
+            = impl_filter.respect_global_filter() ? impl_shootout_idx : 0;
+    int n_impls_skipped = 0;
     while (true) {
         const auto impl_name = query_impl_info(pdw);
-        if (!need_next_impl(impl_name, impl_filter)) return OK;
-
-        BENCHDNN_PRINT(6, "[IMPL_FILTER] Implementation skipped: %s\n",
-                impl_name.c_str());
+        if (need_next_impl(impl_name, impl_filter)) {
+            BENCHDNN_PRINT(6, "[IMPL_FILTER] Implementation skipped: %s\n",
+                    impl_name.c_str());
+        } else if (n_impls_skipped < n_impls_to_skip) {
+            BENCHDNN_PRINT(6, "[IMPL_SHOOTOUT] Implementation skipped: %s\n",
+                    impl_name.c_str());
+            n_impls_skipped++;
+        } else {
+            return OK;
+        }
 
         // Iterator is not supported, further logic is not applicable.
         if (!init_pd_args.is_iterator_supported) {
@@ -402,6 +418,64 @@ int check_pd_w_and_wo_attr(dnnl_engine_t engine, const func_t &init_pd_func,
 
 int check_ref_impl_hit(res_t *res);
 
+// Prints the creation time statistics collected by `measure_create_time`.
+void report_create_time(const timer::timer_t &cpd_timer,
+        const timer::timer_t &cp_timer, const timer::timer_t &cp_hit_timer);
+
+// Creates the tested primitive `create_repeats` times and reports the time of
+// the primitive descriptor creation (dispatching), of the primitive creation
+// on a primitive cache miss (kernel generation) and on a cache hit. The cache
+// is emptied before each repetition to guarantee the miss. With
+// `create_cache_bypass` the cache is disabled for the measurements, and the
+// cache-hit creation is not measured.
+template <typename func_t, typename prb_t>
+int measure_create_time(const func_t &init_pd_func, const prb_t *prb,
+        dir_t dir, const_dnnl_primitive_desc_t hint) {
+    int capacity = 0;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    DNN_SAFE(dnnl_get_primitive_cache_capacity(&capacity), WARN);
+    if (capacity > 0 && create_cache_bypass)
+        DNN_SAFE(dnnl_set_primitive_cache_capacity(0), WARN);
+#endif
+    const bool use_cache = capacity > 0 && !create_cache_bypass;
+
+    timer::timer_t cpd_timer, cp_timer, cp_hit_timer;
+    for (int r = 0; r < create_repeats; r++) {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+        // Changing the capacity evicts all entries.
+        if (use_cache) {
+            DNN_SAFE(dnnl_set_primitive_cache_capacity(0), WARN);
+            DNN_SAFE(dnnl_set_primitive_cache_capacity(capacity), WARN);
+        }
+#endif
+        benchdnn_dnnl_wrapper_t<dnnl_primitive_t> primw;
+        res_t miss_res {};
+        SAFE(create_primitive(primw, get_test_engine(), init_pd_func, prb,
+                     &miss_res, dir, hint, /* is_service_prim = */ false,
+                     /* src_md = */ nullptr, /* force_f32_dt = */ false),
+                WARN);
+        if (miss_res.state == SKIPPED) break;
+        cpd_timer.append(miss_res.timer_map.cpd_timer());
+        cp_timer.append(miss_res.timer_map.cp_timer());
+        if (!use_cache) continue;
+
+        res_t hit_res {};
+        SAFE(create_primitive(primw, get_test_engine(), init_pd_func, prb,
+                     &hit_res, dir, hint, /* is_service_prim = */ false,
+                     /* src_md = */ nullptr, /* force_f32_dt = */ false),
+                WARN);
+        cp_hit_timer.append(hit_res.timer_map.cp_timer());
+    }
+
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    if (capacity > 0 && create_cache_bypass)
+        DNN_SAFE(dnnl_set_primitive_cache_capacity(capacity), WARN);
+#endif
+
+    report_create_time(cpd_timer, cp_timer, cp_hit_timer);
+    return OK;
+}
+
 template <typename func_t, typename prb_t>
 int init_prim(benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &user_prim,
         const func_t &init_pd_func, const prb_t *prb, res_t *res,
@@ -471,6 +545,9 @@ int init_prim(benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &user_prim,
         SAFE(check_ref_impl_hit(res), WARN);
     }
 
+    if (create_repeats > 0)
+        SAFE(measure_create_time(init_pd_func, prb, dir, hint), WARN);
+
     user_prim.reset(primw.release());
     return res->state = INITIALIZED, OK;
 }
@@ -590,6 +667,10 @@ void check_correctness(const prb_t *prb, const std::vector<data_kind_t> &kinds,
 using perf_function_t = std::function<dnnl_status_t(
         const dnnl_stream_t &, const std::vector<dnnl_exec_arg_t> &)>;
 
+void execute_unmap_args(
+        const args_t &args, std::vector<dnnl_exec_arg_t> &dnnl_args);
+void execute_map_args(const args_t &args);
+
 int execute_and_wait(perf_function_t &exec_func, const dnnl_engine_t &engine,
         const args_t &args, res_t *res = nullptr);
 int execute_and_wait(
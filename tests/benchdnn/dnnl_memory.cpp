@@ -45,6 +45,7 @@
 #include "utils/cold_cache.hpp"
 #include "utils/dnnl_query.hpp"
 #include "utils/memory.hpp"
+#include "utils/numa.hpp"
 #include "utils/parallel.hpp"
 
 extern "C" dnnl_status_t dnnl_memory_desc_create_with_string_tag(
@@ -1059,6 +1060,7 @@ int dnn_mem_t::initialize_memory_create(const handle_info_t &handle_info) {
         for (int i = 0; i < nhandles; i++) {
             size_t sz = dnnl_memory_desc_get_size_v2(md_, i);
             data_.push_back(zmalloc(sz, alignment));
+            apply_mem_bind(data_.back(), sz);
         }
         if (std::any_of(
                     data_.cbegin(), data_.cend(), [](void *p) { return !p; })) {
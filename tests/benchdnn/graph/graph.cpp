@@ -345,8 +345,11 @@ namespace graph {
 
 using namespace dnnl::graph;
 
-prb_t::prb_t(const deserialized_graph_t &dg, const size_t &expected_n_partition)
-    : dg(dg), expected_n_partition(expected_n_partition) {
+prb_t::prb_t(const deserialized_graph_t &dg, const size_t &expected_n_partition,
+        bool partition_breakdown)
+    : dg(dg)
+    , expected_n_partition(expected_n_partition)
+    , partition_breakdown(partition_breakdown) {
 
     const auto &fpmath = dg.get_fpmath_mode();
     fpmath_mode.mode_ = fpmath.first;
@@ -615,6 +618,84 @@ int skip_unimplemented_execution_mode(
     return OK;
 }
 
+// Times each compiled partition separately and reports its share of the time
+// of the graph together with the memory it requires. The partitions made of
+// Reorder ops only are the layout conversions between the fused partitions,
+// their time is reported separately.
+int report_partition_breakdown(const deserialized_graph_t &dg,
+        const std::vector<partition> &partitions,
+        const std::vector<compiled_partition> &c_partitions,
+        const std::vector<std::vector<tensor>> &input_ts_all,
+        const std::vector<std::vector<tensor>> &output_ts_all,
+        const std::vector<tensor> &scratchpad_ts_all, res_t *res) {
+    const size_t n_partitions = c_partitions.size();
+    std::vector<timer::timer_t> timers(n_partitions);
+    for (size_t i = 0; i < n_partitions; i++) {
+        SAFE(measure_perf(timers[i], {c_partitions[i]}, {input_ts_all[i]},
+                     {output_ts_all[i]}, {scratchpad_ts_all[i]}, res),
+                WARN);
+    }
+
+    // The arena holds the tensors passed between the partitions and the
+    // scratchpads. The buffers that are not alive at the same time share
+    // memory, so the arena is smaller than the sum of the buffers.
+    dnnl::graph::memory_plan plan;
+    DNN_GRAPH_SAFE(plan = dnnl::graph::plan_memory(c_partitions), WARN, res);
+
+    std::unordered_map<size_t, size_t> out_sizes;
+    std::vector<size_t> in_size(n_partitions, 0), out_size(n_partitions, 0),
+            scratchpad_size(n_partitions, 0);
+    std::vector<std::string> ops_str(n_partitions);
+    std::vector<bool> is_reorder(n_partitions, true);
+    double total_ms = 0, reorder_ms = 0;
+    size_t buffers_size = 0;
+    for (size_t i = 0; i < n_partitions; i++) {
+        const auto &cp = c_partitions[i];
+        for (const auto &lt : partitions[i].get_input_ports())
+            in_size[i] += cp.query_logical_tensor(lt.get_id()).get_mem_size();
+        for (const auto &lt : partitions[i].get_output_ports()) {
+            const size_t sz
+                    = cp.query_logical_tensor(lt.get_id()).get_mem_size();
+            out_sizes[lt.get_id()] = sz;
+            out_size[i] += sz;
+        }
+        scratchpad_size[i] = cp.get_scratchpad_logical_tensor().get_mem_size();
+        buffers_size += scratchpad_size[i];
+
+        for (size_t op_id : partitions[i].get_ops()) {
+            const auto &kind = dg.get_op(op_id).kind_;
+            if (!ops_str[i].empty()) ops_str[i] += "+";
+            ops_str[i] += kind;
+            if (kind != "Reorder") is_reorder[i] = false;
+        }
+
+        const double avg_ms = timers[i].ms(timer::timer_t::avg);
+        total_ms += avg_ms;
+        if (is_reorder[i]) reorder_ms += avg_ms;
+    }
+    for (const auto &t : plan.tensor_offsets)
+        buffers_size += out_sizes[t.first];
+
+    BENCHDNN_PRINT(0,
+            "[PARTITION_BREAKDOWN] total: partitions:%d avg(ms):%g "
+            "reorders(ms):%g arena(bytes):%zu buffers(bytes):%zu\n",
+            static_cast<int>(n_partitions), total_ms, reorder_ms,
+            plan.arena_size, buffers_size);
+    for (size_t i = 0; i < n_partitions; i++) {
+        const double avg_ms = timers[i].ms(timer::timer_t::avg);
+        BENCHDNN_PRINT(0,
+                "[PARTITION_BREAKDOWN] %d: id:%zu min(ms):%g avg(ms):%g "
+                "share:%.2f%% in(bytes):%zu out(bytes):%zu "
+                "scratchpad(bytes):%zu ops:%s%s\n",
+                static_cast<int>(i), partitions[i].get_id(),
+                timers[i].ms(timer::timer_t::min), avg_ms,
+                total_ms > 0 ? 100. * avg_ms / total_ms : 0., in_size[i],
+                out_size[i], scratchpad_size[i], ops_str[i].c_str(),
+                is_reorder[i] ? " (reorder)" : "");
+    }
+    return OK;
+}
+
 int doit(const prb_t *prb, res_t *res) {
     if (bench_mode == bench_mode_t::list) return res->state = LISTED, OK;
 
@@ -844,6 +925,11 @@ int doit(const prb_t *prb, res_t *res) {
         SAFE(measure_perf(res->timer_map.perf_timer(), c_partitions,
                      input_ts_all, output_ts_all, scratchpad_ts_all, res),
                 WARN);
+        if (prb->partition_breakdown) {
+            SAFE(report_partition_breakdown(dg, partitions, c_partitions,
+                         input_ts_all, output_ts_all, scratchpad_ts_all, res),
+                    WARN);
+        }
     }
 
     return OK;
@@ -55,6 +55,7 @@ struct settings_t : public base_settings_t {
             {{SIZE_MAX, dnnl_data_type_undef}}};
     std::vector<std::map<size_t, std::string>> op_kind_map {
             {{SIZE_MAX, "default"}}};
+    bool partition_breakdown = false;
 
     const char *perf_template_csv = "perf,%engine%,%desc%,%-time%,%0time%";
     static constexpr const char *perf_template_def
@@ -65,11 +66,13 @@ struct settings_t : public base_settings_t {
 
 // TODO evaluate prb_t struct
 struct prb_t {
-    prb_t(const deserialized_graph_t &dg, const size_t &expected_n_partition);
+    prb_t(const deserialized_graph_t &dg, const size_t &expected_n_partition,
+            bool partition_breakdown = false);
 
     deserialized_graph_t dg;
     size_t expected_n_partition;
     graph_fpmath_mode_t fpmath_mode;
+    bool partition_breakdown;
 };
 
 std::string case_to_str(const std::string &json_file,
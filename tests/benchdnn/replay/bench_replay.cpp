@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "dnnl_common.hpp"
+#include "utils/parser.hpp"
+#include "utils/replay.hpp"
+
+#include "replay/replay.hpp"
+
+namespace replay {
+
+// Runs the problems of a sequence file line by line. Every line starts with
+// a driver name followed by the driver options and a problem, as the
+// verbose converter generates them for a verbose log of a model.
+static int run_sequence_file(const std::string &fname, get_bench_f get_bench) {
+    std::ifstream ifs(locate_file(fname));
+    SAFE(ifs.is_open() ? OK : FAIL, CRIT);
+
+    auto &replay_sequence = get_replay_sequence();
+    std::string line;
+    while (std::getline(ifs, line)) {
+        std::istringstream iss(line);
+        std::vector<std::string> opts;
+        std::string str;
+        while (iss >> str) {
+            if (str.front() == '#') break; // shell style comments
+            opts.push_back(std::move(str));
+        }
+        if (opts.empty()) continue;
+
+        const bench_f bench = get_bench(opts[0].c_str());
+        if (!bench) {
+            BENCHDNN_PRINT(0,
+                    "Error: can't parse the driver name \'%s\' in the "
+                    "sequence file.\n",
+                    opts[0].c_str());
+            return FAIL;
+        }
+
+        replay_sequence.set_layer_name(line);
+        std::vector<char *> c_opts;
+        for (size_t i = 1; i < opts.size(); i++)
+            c_opts.push_back(const_cast<char *>(opts[i].c_str()));
+        bench(static_cast<int>(c_opts.size()), c_opts.data());
+    }
+    return OK;
+}
+
+int bench(int argc, char **argv, get_bench_f get_bench) {
+    driver_name = "replay";
+    using namespace parser;
+
+    get_replay_sequence().start_recording();
+    for (; argc > 0; --argc, ++argv) {
+        if (parse_bench_settings(argv[0])) continue;
+
+        catch_unknown_options(argv[0]);
+        SAFE(run_sequence_file(argv[0], get_bench), CRIT);
+    }
+
+    SAFE(get_replay_sequence().replay(), WARN);
+    return OK;
+}
+
+} // namespace replay
@@ -0,0 +1,32 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include "common.hpp"
+
+namespace replay {
+
+// Returns the entry point of a driver given by its option name, e.g.
+// `--conv`, or `nullptr` if the name is unknown.
+using get_bench_f = bench_f (*)(const char *driver);
+
+int bench(int argc, char **argv, get_bench_f get_bench);
+
+} // namespace replay
+
+#endif
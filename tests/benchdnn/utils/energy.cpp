@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <fstream>
+#include <string>
+
+#if defined(__linux__)
+#include <dirent.h>
+#endif
+
+#include "utils/energy.hpp"
+
+bool energy_measure {false};
+
+namespace energy {
+
+namespace {
+
+struct counter_t {
+    std::string path;
+    // The value the counter wraps around at, `0` if it does not wrap.
+    uint64_t max_uj;
+};
+
+bool read_uint64(const std::string &path, uint64_t &value) {
+    std::ifstream f(path);
+    return static_cast<bool>(f >> value);
+}
+
+#if defined(__linux__)
+std::vector<std::string> list_dir(const std::string &path) {
+    std::vector<std::string> names;
+    DIR *dir = opendir(path.c_str());
+    if (!dir) return names;
+    while (const dirent *e = readdir(dir))
+        names.emplace_back(e->d_name);
+    closedir(dir);
+    return names;
+}
+#endif
+
+std::vector<counter_t> discover_counters() {
+    std::vector<counter_t> counters;
+#if defined(__linux__)
+    // Only the top-level domains, e.g. `intel-rapl:0`, are taken, as the
+    // subdomains, e.g. `intel-rapl:0:0`, are a part of them.
+    const std::string powercap = "/sys/class/powercap/";
+    for (const auto &name : list_dir(powercap)) {
+        const size_t colon = name.find(':');
+        if (colon == std::string::npos
+                || name.find(':', colon + 1) != std::string::npos)
+            continue;
+        const std::string path = powercap + name + "/energy_uj";
+        uint64_t value = 0, max_uj = 0;
+        if (!read_uint64(path, value)) continue;
+        read_uint64(powercap + name + "/max_energy_range_uj", max_uj);
+        counters.push_back({path, max_uj});
+    }
+    if (!counters.empty()) return counters;
+
+    const std::string hwmon = "/sys/class/hwmon/";
+    for (const auto &dev : list_dir(hwmon)) {
+        if (dev.compare(0, 5, "hwmon") != 0) continue;
+        for (const auto &name : list_dir(hwmon + dev)) {
+            if (name.compare(0, 6, "energy") != 0
+                    || name.find("_input") == std::string::npos)
+                continue;
+            const std::string path = hwmon + dev + "/" + name;
+            uint64_t value = 0;
+            if (read_uint64(path, value)) counters.push_back({path, 0});
+        }
+    }
+#endif
+    return counters;
+}
+
+const std::vector<counter_t> &counters() {
+    static const std::vector<counter_t> c = discover_counters();
+    return c;
+}
+
+} // namespace
+
+bool is_available() {
+    return !counters().empty();
+}
+
+sample_t read() {
+    sample_t s;
+    for (const auto &c : counters()) {
+        uint64_t value = 0;
+        read_uint64(c.path, value);
+        s.uj.push_back(value);
+    }
+    return s;
+}
+
+double joules(const sample_t &begin, const sample_t &end) {
+    const auto &c = counters();
+    if (begin.uj.size() != c.size() || end.uj.size() != c.size()) return 0;
+
+    double uj = 0;
+    for (size_t i = 0; i < c.size(); i++) {
+        if (end.uj[i] >= begin.uj[i])
+            uj += static_cast<double>(end.uj[i] - begin.uj[i]);
+        else if (c[i].max_uj)
+            uj += static_cast<double>(c[i].max_uj - begin.uj[i] + end.uj[i]);
+    }
+    return uj / 1e6;
+}
+
+} // namespace energy
@@ -0,0 +1,45 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_ENERGY_HPP
+#define UTILS_ENERGY_HPP
+
+#include <stdint.h>
+#include <vector>
+
+// Measures the energy of the performance runs when set.
+extern bool energy_measure;
+
+namespace energy {
+
+// The values of the energy counters of the system in microjoules. The
+// counters are the package domains of the powercap interface (RAPL on x64)
+// and the energy sensors of hwmon (e.g., SCMI sensors on Arm servers).
+struct sample_t {
+    std::vector<uint64_t> uj;
+};
+
+// Returns `true` if the system exposes at least one energy counter.
+bool is_available();
+// Returns the current values of the energy counters.
+sample_t read();
+// Returns the energy consumed between `begin` and `end` in joules. Handles
+// the wrap around of the counters.
+double joules(const sample_t &begin, const sample_t &end);
+
+} // namespace energy
+
+#endif
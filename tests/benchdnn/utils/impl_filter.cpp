@@ -14,11 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+
 #include "common.hpp"
 
 #include "utils/impl_filter.hpp"
 
 impl_filter_t global_impl_filter {};
+int impl_shootout_idx {0};
 
 const impl_filter_t &get_prim_ref_impl_filter() {
     static const impl_filter_t prim_ref_impl_filter({"ref:any", "ref_int8:any"},
@@ -81,3 +84,25 @@ bool need_next_impl(
     }
     return use_impl;
 }
+
+void report_impl_shootout(
+        const char *prb_str, std::vector<impl_shootout_entry_t> &entries) {
+    std::stable_sort(entries.begin(), entries.end(),
+            [](const impl_shootout_entry_t &lhs,
+                    const impl_shootout_entry_t &rhs) {
+                return lhs.min_ms < rhs.min_ms;
+            });
+
+    BENCHDNN_PRINT(0, "[IMPL_SHOOTOUT] %s\n", prb_str);
+    for (size_t i = 0; i < entries.size(); i++) {
+        const auto &e = entries[i];
+        // The ratio is against the fastest implementation.
+        const double ratio = entries[0].min_ms > 0
+                ? e.min_ms / entries[0].min_ms
+                : 1.;
+        BENCHDNN_PRINT(0,
+                "[IMPL_SHOOTOUT] %d: %s min(ms):%g avg(ms):%g ratio:%.2f\n",
+                static_cast<int>(i + 1), e.impl_name.c_str(), e.min_ms,
+                e.avg_ms, ratio);
+    }
+}
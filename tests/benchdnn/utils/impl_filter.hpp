@@ -61,4 +61,19 @@ std::ostream &operator<<(std::ostream &s, const impl_filter_t &impl_filter);
 bool need_next_impl(
         const std::string &impl_name, const impl_filter_t &impl_filter);
 
+// The implementation-shootout mode runs a problem once per implementation
+// passing the filter. `impl_shootout_idx` is the ordinal number of such
+// implementation to fetch for the current run.
+extern int impl_shootout_idx;
+
+struct impl_shootout_entry_t {
+    std::string impl_name;
+    double min_ms;
+    double avg_ms;
+};
+
+// Prints the implementations ranked by the minimum time.
+void report_impl_shootout(
+        const char *prb_str, std::vector<impl_shootout_entry_t> &entries);
+
 #endif
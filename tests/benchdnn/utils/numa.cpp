@@ -0,0 +1,240 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "common.hpp"
+#include "dnnl_common.hpp"
+
+#include "utils/numa.hpp"
+
+std::vector<int> cpu_bind;
+mem_bind_t mem_bind;
+bool numa_report {false};
+
+std::vector<int> str2id_list(const std::string &str) {
+    std::vector<int> ids;
+    std::stringstream ss(str);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        const size_t dash = range.find('-');
+        const std::string first_str = range.substr(0, dash);
+        const std::string last_str = dash == std::string::npos
+                ? first_str
+                : range.substr(dash + 1);
+        const auto is_number = [](const std::string &s) {
+            return !s.empty()
+                    && s.find_first_not_of("0123456789") == std::string::npos;
+        };
+        if (!is_number(first_str) || !is_number(last_str)) return {};
+        const int first = std::stoi(first_str), last = std::stoi(last_str);
+        if (first > last) return {};
+        for (int id = first; id <= last; id++)
+            ids.push_back(id);
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+}
+
+mem_bind_t str2mem_bind(const std::string &str) {
+    mem_bind_t mb;
+    if (str == "none") return mb;
+    if (str == "interleave") {
+        mb.kind = mem_bind_t::interleave;
+        return mb;
+    }
+    const auto nodes = str2id_list(str);
+    if (nodes.size() != 1) {
+        mb.node = -1;
+        return mb;
+    }
+    mb.kind = mem_bind_t::bind;
+    mb.node = nodes[0];
+    return mb;
+}
+
+#if defined(__linux__)
+namespace {
+
+// The values of the memory policy modes from <numaif.h>, not included to
+// avoid the dependency on libnuma.
+constexpr int mpol_bind = 2;
+constexpr int mpol_interleave = 3;
+constexpr size_t max_nodes = 1024;
+
+size_t page_size() {
+    static const size_t ps = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return ps;
+}
+
+const std::vector<int> &online_nodes() {
+    static const std::vector<int> nodes = []() {
+        std::ifstream ifs("/sys/devices/system/node/online");
+        std::string str;
+        if (!(ifs >> str)) return std::vector<int> {0};
+        auto ids = str2id_list(str);
+        return ids.empty() ? std::vector<int> {0} : ids;
+    }();
+    return nodes;
+}
+
+} // namespace
+#endif
+
+int apply_cpu_bind() {
+    if (cpu_bind.empty()) return OK;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int c : cpu_bind) {
+        if (c >= CPU_SETSIZE) {
+            BENCHDNN_PRINT(0, "Error: core %d is out of range.\n", c);
+            return FAIL;
+        }
+        CPU_SET(c, &set);
+    }
+    // The threads of the threading runtime may already exist, so bind every
+    // thread of the process.
+    DIR *dir = opendir("/proc/self/task");
+    if (!dir) {
+        BENCHDNN_PRINT(0, "%s\n", "Error: could not list the threads.");
+        return FAIL;
+    }
+    int status = OK;
+    while (struct dirent *entry = readdir(dir)) {
+        if (entry->d_name[0] == '.') continue;
+        const pid_t tid = static_cast<pid_t>(atoi(entry->d_name));
+        if (sched_setaffinity(tid, sizeof(set), &set)) {
+            BENCHDNN_PRINT(0, "Error: could not bind thread %d to the cores.\n",
+                    static_cast<int>(tid));
+            status = FAIL;
+        }
+    }
+    closedir(dir);
+    return status;
+#else
+    BENCHDNN_PRINT(
+            0, "%s\n", "Error: core binding is supported on Linux only.");
+    return FAIL;
+#endif
+}
+
+void apply_mem_bind(void *ptr, size_t size) {
+    if (mem_bind.kind == mem_bind_t::none || !ptr || size == 0) return;
+#if defined(__linux__)
+    unsigned long mask[max_nodes / (8 * sizeof(unsigned long))] = {};
+    const auto set_node = [&](int node) {
+        if (node < 0 || static_cast<size_t>(node) >= max_nodes) return;
+        const size_t bits = 8 * sizeof(unsigned long);
+        mask[node / bits] |= 1UL << (node % bits);
+    };
+    if (mem_bind.kind == mem_bind_t::bind)
+        set_node(mem_bind.node);
+    else
+        for (int node : online_nodes())
+            set_node(node);
+
+    const int mode = mem_bind.kind == mem_bind_t::bind ? mpol_bind
+                                                        : mpol_interleave;
+    // The policy is set for whole pages, the pages shared with other data
+    // that were touched already keep their placement.
+    const uintptr_t beg = reinterpret_cast<uintptr_t>(ptr) & ~(page_size() - 1);
+    const uintptr_t end = reinterpret_cast<uintptr_t>(ptr) + size;
+    if (syscall(SYS_mbind, beg, end - beg, mode, mask, max_nodes, 0)) {
+        static bool warned = false;
+        if (!warned) {
+            BENCHDNN_PRINT(0, "%s\n",
+                    "WARNING: could not set the memory policy of a buffer.");
+            warned = true;
+        }
+    }
+#else
+    static bool warned = false;
+    if (!warned) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "WARNING: memory binding is supported on Linux only.");
+        warned = true;
+    }
+#endif
+}
+
+void report_numa_placement(const args_t &args) {
+#if defined(__linux__)
+    // Querying every page of large buffers is slow, so a limited number of
+    // evenly spaced pages is queried.
+    const size_t max_pages = 4096;
+    for (int i = 0; i < args.size(); i++) {
+        const auto &m = args.dnn_mem(i);
+        const size_t size = m.size();
+        void *handle = nullptr;
+        if (size == 0 || !is_cpu(m.engine())
+                || dnnl_memory_get_data_handle(m.m_, &handle) != dnnl_success
+                || !handle)
+            continue;
+        const uintptr_t base = reinterpret_cast<uintptr_t>(handle);
+        const uintptr_t beg = base & ~(page_size() - 1);
+        const size_t n_pages = (base + size - beg + page_size() - 1)
+                / page_size();
+        const size_t n_queried = std::min(n_pages, max_pages);
+
+        std::vector<void *> pages(n_queried);
+        std::vector<int> status(n_queried, -1);
+        for (size_t p = 0; p < n_queried; p++)
+            pages[p] = reinterpret_cast<void *>(
+                    beg + (p * n_pages / n_queried) * page_size());
+        if (syscall(SYS_move_pages, 0, n_queried, pages.data(), nullptr,
+                    status.data(), 0)) {
+            BENCHDNN_PRINT(0, "%s\n",
+                    "WARNING: could not query the NUMA placement of a "
+                    "buffer.");
+            return;
+        }
+
+        // Negative statuses are errors, e.g., pages not allocated yet.
+        std::map<int, size_t> node_pages;
+        for (int s : status)
+            node_pages[s < 0 ? -1 : s]++;
+        std::stringstream ss;
+        for (const auto &np : node_pages) {
+            if (np.first < 0)
+                ss << " none:";
+            else
+                ss << " " << np.first << ":";
+            ss << std::fixed << std::setprecision(2)
+               << 100. * np.second / n_queried << "%";
+        }
+        BENCHDNN_PRINT(0, "[NUMA] arg:%s size(bytes):%zu nodes:%s\n",
+                arg2str(args.arg(i)).c_str(), size, ss.str().c_str());
+    }
+#else
+    (void)args;
+    BENCHDNN_PRINT(0, "%s\n",
+            "WARNING: the NUMA placement report is supported on Linux only.");
+#endif
+}
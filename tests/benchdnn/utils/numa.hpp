@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_NUMA_HPP
+#define UTILS_NUMA_HPP
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+struct args_t;
+
+// The policy of placement of the buffers allocated by the driver on NUMA
+// nodes.
+struct mem_bind_t {
+    enum kind_t { none, bind, interleave };
+    kind_t kind = none;
+    int node = 0;
+};
+
+// The cores to bind the threads of the benchmark to, empty if not bound.
+extern std::vector<int> cpu_bind;
+extern mem_bind_t mem_bind;
+// Reports the NUMA nodes the buffers of each problem landed on.
+extern bool numa_report;
+
+// Parses a list of IDs in the `0-3,8,10-11` format. Returns an empty list
+// for an ill-formed string.
+std::vector<int> str2id_list(const std::string &str);
+// Parses `none`, `interleave`, or a node ID. Returns `kind == none` with a
+// negative node for an ill-formed string.
+mem_bind_t str2mem_bind(const std::string &str);
+
+// Binds the existing threads of the process to `cpu_bind`. The threads
+// created later, e.g., by the threading runtime, inherit the affinity of the
+// thread creating them.
+int apply_cpu_bind();
+// Applies the `mem_bind` policy to a buffer. The policy takes effect for the
+// pages touched for the first time after the call.
+void apply_mem_bind(void *ptr, size_t size);
+// Prints the shares of pages of the buffers of `args` per NUMA node.
+void report_numa_placement(const args_t &args);
+
+#endif
@@ -20,8 +20,11 @@
 #include <unordered_map>
 
 #include "utils/cold_cache.hpp"
+#include "utils/energy.hpp"
 #include "utils/fill.hpp"
+#include "utils/numa.hpp"
 #include "utils/parser.hpp"
+#include "utils/perf_baseline.hpp"
 #include "utils/stream_kind.hpp"
 #include "utils/summary.hpp"
 
@@ -1403,6 +1406,24 @@ static bool parse_cold_cache(
             option_name, help);
 }
 
+static bool parse_cpu_bind(
+        const char *str, const std::string &option_name = "cpu-bind") {
+    static const std::string help
+            = "CORES    (Default: not specified)\n    Binds the threads of "
+              "the benchmark to the list of `CORES`, e.g., `0-7,16-23`.\n    "
+              "The threads created later inherit the binding.\n";
+    bool parsed = parse_single_value_option(cpu_bind, std::vector<int>(),
+            str2id_list, str, option_name, help);
+    if (parsed) {
+        if (cpu_bind.empty()) {
+            BENCHDNN_PRINT(0, "Error: ill-formed core list \'%s\'.\n", str);
+            SAFE_V(FAIL);
+        }
+        SAFE_V(apply_cpu_bind());
+    }
+    return parsed;
+}
+
 static bool parse_cpu_isa_hints(
         const char *str, const std::string &option_name = "cpu-isa-hints") {
     static const std::string help
@@ -1577,6 +1598,43 @@ static bool parse_fix_times_per_prb(
     return parsed;
 }
 
+static bool parse_create_repeats(
+        const char *str, const std::string &option_name = "create-repeats") {
+    static const std::string help
+            = "UINT    (Default: `0`)\n    Specifies the number of times to "
+              "create the tested primitive to measure the creation time.\n    "
+              "If `UINT` is greater than `0`, the driver reports the "
+              "statistics of primitive descriptor creation, primitive "
+              "creation, and cache-hit primitive creation times.\n";
+    bool parsed = parse_single_value_option(create_repeats, 0,
+            utils::stoll_safe, str, option_name, help);
+    if (parsed) create_repeats = MAX2(0, create_repeats);
+    return parsed;
+}
+
+static bool parse_create_cache_bypass(const char *str,
+        const std::string &option_name = "create-cache-bypass") {
+    static const std::string help
+            = "BOOL    (Default: `false`)\n    Instructs the driver to "
+              "disable the primitive cache for creation time measurements.\n"
+              "    When set to `true`, cache-hit creation time is not "
+              "reported.\n";
+    return parse_single_value_option(create_cache_bypass, false,
+            parsers::str2bool, str, option_name, help);
+}
+
+static bool parse_impl_shootout(
+        const char *str, const std::string &option_name = "impl-shootout") {
+    static const std::string help
+            = "BOOL    (Default: `false`)\n    Instructs the driver to run "
+              "each problem with every implementation passing the "
+              "implementation filter.\n    When set to `true` in the "
+              "performance mode, the driver prints the implementations ranked "
+              "by the minimum time.\n";
+    return parse_single_value_option(
+            impl_shootout, false, parsers::str2bool, str, option_name, help);
+}
+
 static bool parse_max_ms_per_prb(
         const char *str, const std::string &option_name = "max-ms-per-prb") {
     static const std::string help
@@ -1616,6 +1674,153 @@ static bool parse_num_streams(
     return parsed;
 }
 
+static bool parse_numa_report(
+        const char *str, const std::string &option_name = "numa-report") {
+    static const std::string help
+            = "BOOL    (Default: `false`)\n    Instructs the driver to print "
+              "the NUMA nodes the buffers of each problem landed on in the "
+              "performance mode.\n";
+    return parse_single_value_option(
+            numa_report, false, parsers::str2bool, str, option_name, help);
+}
+
+static bool parse_energy(
+        const char *str, const std::string &option_name = "energy") {
+    static const std::string help
+            = "BOOL    (Default: `false`)\n    Instructs the driver to "
+              "measure the energy consumed by the system per execution in the "
+              "performance mode.\n    Requires powercap or hwmon energy "
+              "counters.\n";
+    return parse_single_value_option(
+            energy_measure, false, parsers::str2bool, str, option_name, help);
+}
+
+static bool parse_threadpool_kind(
+        const char *str, const std::string &option_name = "threadpool-kind") {
+    static const std::string help
+            = "KIND    (Default: `native`)\n    Specifies the kind of the "
+              "threadpool of each instance of `--num-instances` with the "
+              "threadpool runtime.\n    `KIND` values are `native`, `fixed` "
+              "and `dynamic`.\n";
+    const auto str2self = [](const std::string &str) { return str; };
+    bool parsed = parse_single_value_option(threadpool_kind,
+            std::string("native"), str2self, str, option_name, help);
+    if (parsed && threadpool_kind != "native" && threadpool_kind != "fixed"
+            && threadpool_kind != "dynamic") {
+        BENCHDNN_PRINT(0, "Error: unknown threadpool kind `%s`.\n",
+                threadpool_kind.c_str());
+        SAFE_V(FAIL);
+    }
+    return parsed;
+}
+
+static bool parse_latency_dist(
+        const char *str, const std::string &option_name = "latency-dist") {
+    static const std::string help
+            = "BOOL    (Default: `false`)\n    Instructs the driver to print "
+              "the percentiles, the histogram and the list of the execution "
+              "times of each problem in the performance mode.\n";
+    return parse_single_value_option(
+            latency_dist, false, parsers::str2bool, str, option_name, help);
+}
+
+static bool parse_num_instances(
+        const char *str, const std::string &option_name = "num-instances") {
+    static const std::string help
+            = "N    (Default: `1`)\n    Specifies the number `N` of "
+              "instances running a problem at the same time for performance "
+              "benchmarking.\n    `N` is a positive integer.\n";
+    bool parsed = parse_single_value_option(num_instances,
+            default_num_instances, utils::stoll_safe, str, option_name, help);
+    if (parsed) {
+        if (num_instances <= 0) {
+            BENCHDNN_PRINT(0, "%s\n",
+                    "Error: number of instances must be positive.");
+            SAFE_V(FAIL);
+        }
+    }
+    return parsed;
+}
+
+static bool parse_instance_cores(
+        const char *str, const std::string &option_name = "instance-cores") {
+    static const std::string help
+            = "N    (Default: `0`)\n    Pins instance `i` of `--num-instances` "
+              "to cores `[i * N, (i + 1) * N)`.\n    When `N` is `0`, "
+              "instances are not pinned.\n";
+    bool parsed = parse_single_value_option(
+            instance_cores, 0, utils::stoll_safe, str, option_name, help);
+    if (parsed) instance_cores = MAX2(0, instance_cores);
+    return parsed;
+}
+
+static bool parse_perf_baseline_save(const char *str,
+        const std::string &option_name = "perf-baseline-save") {
+    static const std::string help
+            = "FILE    (Default: not specified)\n    Instructs the driver to "
+              "save the performance results of each problem to `FILE`.\n    "
+              "Problems are keyed by their canonical form, thus, the option "
+              "enables `--canonical`.\n";
+    const auto str2self = [](const std::string &str) { return str; };
+    bool parsed = parse_single_value_option(perf_baseline_save,
+            std::string(), str2self, str, option_name, help);
+    if (parsed && !perf_baseline_save.empty()) canonical = true;
+    return parsed;
+}
+
+static bool parse_perf_baseline(
+        const char *str, const std::string &option_name = "perf-baseline") {
+    static const std::string help
+            = "FILE    (Default: not specified)\n    Instructs the driver to "
+              "compare the performance results of each problem against the "
+              "ones saved to `FILE` by `--perf-baseline-save`.\n    A "
+              "significant slowdown above `--perf-regression-threshold` "
+              "fails the problem. The option enables `--canonical`.\n";
+    const auto str2self = [](const std::string &str) { return str; };
+    bool parsed = parse_single_value_option(
+            perf_baseline, std::string(), str2self, str, option_name, help);
+    if (parsed && !perf_baseline.empty()) canonical = true;
+    return parsed;
+}
+
+static bool parse_perf_regression_threshold(const char *str,
+        const std::string &option_name = "perf-regression-threshold") {
+    static const std::string help
+            = "PCT    (Default: `5`)\n    Specifies the relative slowdown in "
+              "percents against the `--perf-baseline` results above which a "
+              "problem regresses.\n";
+    bool parsed = parse_single_value_option(perf_regression_threshold, 5.,
+            utils::stof_safe, str, option_name, help);
+    if (parsed) perf_regression_threshold = MAX2(0., perf_regression_threshold);
+    return parsed;
+}
+
+static bool parse_peak_bw(
+        const char *str, const std::string &option_name = "peak-bw") {
+    static const std::string help
+            = "GBPS    (Default: `0`)\n    Specifies the memory bandwidth "
+              "roof in `GBPS` gigabytes per second used by the `roofline` "
+              "performance report option.\n    When `GBPS` is `0`, the "
+              "bandwidth is measured on CPU with a STREAM-like probe.\n";
+    bool parsed = parse_single_value_option(
+            peak_bw, 0., utils::stof_safe, str, option_name, help);
+    if (parsed) peak_bw = MAX2(0., peak_bw);
+    return parsed;
+}
+
+static bool parse_peak_flops(
+        const char *str, const std::string &option_name = "peak-flops") {
+    static const std::string help
+            = "GFLOPS    (Default: `0`)\n    Specifies the compute roof in "
+              "`GFLOPS` used by the `roofline` and `bound` performance report "
+              "options.\n    When `GFLOPS` is `0`, only the memory "
+              "bandwidth roof is used.\n";
+    bool parsed = parse_single_value_option(
+            peak_flops, 0., utils::stof_safe, str, option_name, help);
+    if (parsed) peak_flops = MAX2(0., peak_flops);
+    return parsed;
+}
+
 static bool parse_repeats_per_prb(
         const char *str, const std::string &option_name = "repeats-per-prb") {
     static const std::string help
@@ -1637,6 +1842,23 @@ static bool parse_mem_check(
             mem_check, true, parsers::str2bool, str, option_name, help);
 }
 
+static bool parse_mem_bind(
+        const char *str, const std::string &option_name = "mem-bind") {
+    static const std::string help
+            = "POLICY    (Default: `none`)\n    Specifies the NUMA placement "
+              "of the buffers allocated by the driver for CPU engines.\n    "
+              "`POLICY` values can be `none`, `interleave`, or a node "
+              "number.\n";
+    bool parsed = parse_single_value_option(
+            mem_bind, mem_bind_t(), str2mem_bind, str, option_name, help);
+    if (parsed && mem_bind.node < 0) {
+        BENCHDNN_PRINT(
+                0, "Error: ill-formed memory binding \'%s\'.\n", str);
+        SAFE_V(FAIL);
+    }
+    return parsed;
+}
+
 static bool parse_memory_kind(
         const char *str, const std::string &option_name = "memory-kind") {
     static const std::string help
@@ -1890,15 +2112,27 @@ bool parse_bench_settings(const char *str) {
     bool parsed = parse_allow_enum_tags_only(str)
             || parse_attr_same_pd_check(str) || parse_canonical(str)
             || parse_check_ref_impl(str) || parse_cold_cache(str)
-            || parse_cpu_isa_hints(str) || parse_engine(str)
+            || parse_cpu_bind(str) || parse_cpu_isa_hints(str)
+            || parse_create_repeats(str)
+            || parse_create_cache_bypass(str) || parse_energy(str)
+            || parse_engine(str)
             || parse_fast_ref(str) || parse_fix_times_per_prb(str)
             || parse_global_impl(str) || parse_global_skip_impl(str)
-            || parse_max_ms_per_prb(str) || parse_num_streams(str)
-            || parse_repeats_per_prb(str) || parse_mem_check(str)
-            || parse_memory_kind(str) || parse_mode(str)
-            || parse_mode_modifier(str) || parse_start(str)
-            || parse_stream_kind(str) || parse_summary(str)
-            || parse_verbose(str) || parse_execution_mode(str)
+            || parse_impl_shootout(str) || parse_latency_dist(str)
+            || parse_max_ms_per_prb(str)
+            || parse_num_streams(str) || parse_num_instances(str)
+            || parse_numa_report(str)
+            || parse_instance_cores(str) || parse_perf_baseline_save(str)
+            || parse_perf_baseline(str) || parse_perf_regression_threshold(str)
+            || parse_peak_bw(str)
+            || parse_peak_flops(str) || parse_repeats_per_prb(str)
+            || parse_mem_bind(str) || parse_mem_check(str)
+            || parse_memory_kind(str)
+            || parse_mode(str) || parse_mode_modifier(str)
+            || parse_start(str) || parse_stream_kind(str)
+            || parse_summary(str) || parse_threadpool_kind(str)
+            || parse_verbose(str)
+            || parse_execution_mode(str)
             || parse_buffer_prefix(str);
 
     // Last condition makes this help message to be triggered once driver_name
@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+#include "common.hpp"
+
+#include "utils/perf_baseline.hpp"
+
+std::string perf_baseline_save;
+std::string perf_baseline;
+double perf_regression_threshold {5.};
+
+namespace {
+
+// Accumulated statistics of execution times in milliseconds.
+struct perf_stats_t {
+    size_t n = 0;
+    double sum = 0;
+    double sum_sq = 0;
+
+    perf_stats_t() = default;
+    perf_stats_t(size_t n, double mean, double stddev)
+        : n(n)
+        , sum(mean * n)
+        , sum_sq(stddev * stddev * (n > 1 ? n - 1 : 0) + mean * mean * n) {}
+
+    void append(const perf_stats_t &rhs) {
+        n += rhs.n;
+        sum += rhs.sum;
+        sum_sq += rhs.sum_sq;
+    }
+
+    double mean() const { return n ? sum / n : 0; }
+    double stddev() const {
+        if (n < 2) return 0;
+        const double var = (sum_sq - sum * sum / n) / (n - 1);
+        return var > 0 ? std::sqrt(var) : 0;
+    }
+    // The variance of the mean estimate.
+    double mean_var() const { return n ? stddev() * stddev() / n : 0; }
+};
+
+using perf_stats_map_t = std::unordered_map<std::string, perf_stats_t>;
+
+// The file consists of lines of `N MEAN STDDEV KEY`. Entries of the same key,
+// e.g., from `--repeats-per-prb`, are combined.
+const perf_stats_map_t &get_baseline() {
+    static const perf_stats_map_t baseline = []() {
+        perf_stats_map_t m;
+        std::ifstream ifs(perf_baseline);
+        if (!ifs.is_open()) {
+            BENCHDNN_PRINT(0, "Error: can't open the baseline file \'%s\'.\n",
+                    perf_baseline.c_str());
+            exit(2);
+        }
+        std::string line;
+        while (std::getline(ifs, line)) {
+            std::istringstream iss(line);
+            size_t n = 0;
+            double mean = 0, stddev = 0;
+            if (!(iss >> n >> mean >> stddev)) continue;
+            std::string key;
+            std::getline(iss >> std::ws, key);
+            m[key].append(perf_stats_t(n, mean, stddev));
+        }
+        return m;
+    }();
+    return baseline;
+}
+
+void save_stats(const std::string &key, const perf_stats_t &stats) {
+    static std::ofstream ofs(perf_baseline_save);
+    if (!ofs.is_open()) {
+        BENCHDNN_PRINT(0, "Error: can't open the baseline file \'%s\'.\n",
+                perf_baseline_save.c_str());
+        exit(2);
+    }
+    ofs << stats.n << " " << stats.mean() << " " << stats.stddev() << " "
+        << key << std::endl;
+}
+
+} // namespace
+
+int check_perf_baseline(const char *prb_str, res_t *res) {
+    if (perf_baseline_save.empty() && perf_baseline.empty()) return OK;
+    if (res->state != EXECUTED && res->state != PASSED) return OK;
+
+    const auto &t = res->timer_map.perf_timer();
+    if (!t.times()) return OK;
+
+    const perf_stats_t cur(
+            t.times(), t.ms(timer::timer_t::avg), t.ms_stddev());
+    const std::string key = "--" + driver_name + " " + prb_str;
+    if (!perf_baseline_save.empty()) save_stats(key, cur);
+    if (perf_baseline.empty()) return OK;
+
+    const auto &baseline = get_baseline();
+    const auto it = baseline.find(key);
+    if (it == baseline.end()) {
+        BENCHDNN_PRINT(0, "[PERF_BASELINE] not found: %s\n", key.c_str());
+        return OK;
+    }
+
+    const auto &base = it->second;
+    if (base.mean() <= 0) return OK;
+    const double diff = cur.mean() - base.mean();
+    const double diff_pct = 100. * diff / base.mean();
+    // 95% confidence interval of the difference of the means.
+    const double ci = 1.96 * std::sqrt(cur.mean_var() + base.mean_var());
+    const bool is_significant = std::fabs(diff) > ci
+            && std::fabs(diff_pct) > perf_regression_threshold;
+    const bool is_regression = is_significant && diff > 0;
+
+    const char *verdict = !is_significant ? "same"
+            : is_regression               ? "regression"
+                                          : "improvement";
+    BENCHDNN_PRINT(0,
+            "[PERF_BASELINE] %s: %+.2f%% (baseline(ms):%g+-%g "
+            "current(ms):%g+-%g ci(ms):%g) %s\n",
+            verdict, diff_pct, base.mean(), base.stddev(), cur.mean(),
+            cur.stddev(), ci, key.c_str());
+
+    if (is_regression) {
+        res->state = FAILED;
+        res->reason = reason_t::perf_regression;
+    }
+    return OK;
+}
@@ -0,0 +1,37 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_PERF_BASELINE_HPP
+#define UTILS_PERF_BASELINE_HPP
+
+#include <string>
+
+#include "utils/res.hpp"
+
+// A file to save the performance results to, keyed by the driver name and the
+// canonical problem string.
+extern std::string perf_baseline_save;
+// A file with the saved results to compare the performance against.
+extern std::string perf_baseline;
+// A relative slowdown, in percents, above which a problem regresses.
+extern double perf_regression_threshold;
+
+// Saves the performance results of a problem and compares them against the
+// baseline, if requested. A regression beyond both the threshold and the
+// confidence interval of the difference of the means fails the problem.
+int check_perf_baseline(const char *prb_str, res_t *res);
+
+#endif
@@ -15,11 +15,63 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <memory>
+
 #include "dnn_types.hpp"
 #include "dnnl_common.hpp"
 
+#include "utils/parallel.hpp"
 #include "utils/perf_report.hpp"
 
+namespace {
+
+// Measures the memory bandwidth in GB/s with a STREAM-like triad over buffers
+// much larger than the last level cache. The buffers are initialized with the
+// same split across threads as the measured loop to keep the pages local to
+// the threads that access them.
+double measure_peak_bw() {
+    const int64_t n = (int64_t)1 << 24;
+    const int64_t chunk = 4096;
+    const int64_t nchunks = n / chunk;
+    std::unique_ptr<float[]> a(new float[n]);
+    std::unique_ptr<float[]> b(new float[n]);
+    std::unique_ptr<float[]> c(new float[n]);
+
+    float *pa = a.get(), *pb = b.get(), *pc = c.get();
+    benchdnn_parallel_nd(nchunks, [&](int64_t i) {
+        for (int64_t j = i * chunk; j < (i + 1) * chunk; j++) {
+            pa[j] = 0.f;
+            pb[j] = 1.f;
+            pc[j] = 2.f;
+        }
+    });
+
+    timer::timer_t t;
+    for (int r = 0; r < 10; r++) {
+        t.start();
+        benchdnn_parallel_nd(nchunks, [&](int64_t i) {
+            for (int64_t j = i * chunk; j < (i + 1) * chunk; j++)
+                pa[j] = pb[j] + 3.f * pc[j];
+        });
+        t.stamp();
+    }
+
+    const double bytes = 3. * n * sizeof(float);
+    const double sec = t.sec(timer::timer_t::min);
+    return sec ? bytes / sec / 1e9 : 0;
+}
+
+// Returns the memory bandwidth roof in GB/s. It is measured once when not
+// provided, and only for CPU since the probe runs on the host.
+double get_peak_bw() {
+    if (peak_bw > 0) return peak_bw;
+    if (!is_cpu()) return 0;
+    static const double measured_bw = measure_peak_bw();
+    return measured_bw;
+}
+
+} // namespace
+
 void base_perf_report_t::report(res_t *res, const char *prb_str) const {
     dump_perf_header();
 
@@ -82,6 +134,48 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
         return t.ticks(mode) / t.sec(mode) / unit;
     };
 
+    auto get_ai = [&]() -> double {
+        const double iobytes = res->ibytes + res->obytes;
+        if (!iobytes) return 0;
+        return ops() / iobytes;
+    };
+
+    // Ops based problems are compared to the roof at their arithmetic
+    // intensity, other problems are compared to the memory bandwidth.
+    auto get_roofline = [&](const timer::timer_t &t) -> double {
+        if (!t.sec(mode)) return 0;
+        const double bw_roof = get_peak_bw() * 1e9;
+        const double flops_roof = peak_flops * 1e9;
+        double work = res->ibytes + res->obytes, roof = bw_roof;
+        if (ops() > 0) {
+            work = ops();
+            roof = bw_roof * get_ai();
+            if (flops_roof > 0)
+                roof = roof > 0 ? MIN2(roof, flops_roof) : flops_roof;
+        }
+        if (!roof) return 0;
+        return 100. * work / t.sec(mode) / roof;
+    };
+
+    auto get_bound = [&]() -> const char * {
+        if (ops() <= 0) return "memory";
+        const double bw_roof = get_peak_bw();
+        if (!bw_roof || !peak_flops) return "undef";
+        return bw_roof * get_ai() < peak_flops ? "memory" : "compute";
+    };
+
+    // Executions per second, aggregated over concurrent instances if any
+    auto get_flops_per_watt = [&]() -> double {
+        if (!res->energy_j) return 0;
+        return ops() / res->energy_j / unit;
+    };
+
+    auto get_throughput = [&](const timer::timer_t &t) -> double {
+        if (res->throughput) return res->throughput / unit;
+        if (!t.sec(timer::timer_t::sum)) return 0;
+        return t.times() / t.sec(timer::timer_t::sum) / unit;
+    };
+
     auto get_create_time = [&](const timer::timer_t &t) -> double {
         // If user didn't ask for mode, choose the maximum one to return time
         // for no-cache-hit creation.
@@ -129,9 +223,13 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     HANDLE("ctx-init", s << *ctx_init());
     HANDLE("ctx-exe", s << *ctx_exe());
     // Options operating on driver independent objects, e.g. timer values.
+    HANDLE("ai", s << get_ai());
+    HANDLE("bound", s << get_bound());
     HANDLE("bw", s << get_bw(res->timer_map.perf_timer()));
     HANDLE("driver", s << driver_name);
     HANDLE("flops", s << get_flops(res->timer_map.perf_timer()));
+    HANDLE("flopsw", s << get_flops_per_watt());
+    HANDLE("energy", s << res->energy_j / unit);
     HANDLE("clocks", s << res->timer_map.perf_timer().ticks(mode) / unit);
     HANDLE("prb", s << prb_str);
     HANDLE("freq", s << get_freq(res->timer_map.perf_timer()));
@@ -141,7 +239,13 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     HANDLE("obytes", s << res->obytes / unit);
     HANDLE("iobytes", s << (res->ibytes + res->obytes) / unit);
     HANDLE("idx", s << benchdnn_stat.tests);
+    HANDLE("p50", s << res->timer_map.perf_timer().ms_percentile(50) / unit);
+    HANDLE("p90", s << res->timer_map.perf_timer().ms_percentile(90) / unit);
+    HANDLE("p99", s << res->timer_map.perf_timer().ms_percentile(99) / unit);
+    HANDLE("roofline", s << get_roofline(res->timer_map.perf_timer()));
     HANDLE("time", s << res->timer_map.perf_timer().ms(mode) / unit);
+    HANDLE("cold", s << res->cold_ms / unit);
+    HANDLE("tput", s << get_throughput(res->timer_map.perf_timer()));
     HANDLE("ctime",
             s << get_create_time(res->timer_map.cp_timer())
                             + get_create_time(res->timer_map.cpd_timer()));
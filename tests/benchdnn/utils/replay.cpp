@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "dnnl_common.hpp"
+#include "dnnl_memory.hpp"
+
+#include "utils/dnnl_query.hpp"
+#include "utils/replay.hpp"
+#include "utils/stream_kind.hpp"
+
+namespace {
+
+// The activations flow between the layers: the source of a layer takes the
+// buffer the previous layer wrote its destination to.
+bool is_activation_arg(int arg, const_dnnl_memory_desc_t md) {
+    return (arg == DNNL_ARG_SRC || arg == DNNL_ARG_DST)
+            && query_md_format_kind(md) != dnnl_format_kind_host_scalar
+            && query_md_num_handles(md) == 1;
+}
+
+} // namespace
+
+replay_sequence_t &get_replay_sequence() {
+    static replay_sequence_t replay_sequence;
+    return replay_sequence;
+}
+
+int replay_sequence_t::record(dnnl_primitive_t prim, const args_t &args,
+        const std::string &impl_name) {
+    // The primitive object of a driver dies with its test case, the sequence
+    // creates its own one, which comes from the primitive cache.
+    dnnl_primitive_desc_t pd {};
+    DNN_SAFE(dnnl_primitive_desc_clone(&pd, query_pd(prim)), WARN);
+    benchdnn_dnnl_wrapper_t<dnnl_primitive_desc_t> pdw(pd);
+    dnnl_primitive_t prim_copy {};
+    DNN_SAFE(dnnl_primitive_create(&prim_copy, pdw), WARN);
+
+    layer_t layer;
+    layer.name = layer_name_;
+    layer.impl_name = impl_name;
+    layer.prim.reset(prim_copy);
+    for (int i = 0; i < args.size(); i++) {
+        dnnl_memory_desc_t md {};
+        DNN_SAFE(dnnl_memory_desc_clone(&md, args.dnn_mem(i).md_), WARN);
+        layer.mds.emplace_back(
+                args.arg(i), benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t>(md));
+    }
+    layers_.push_back(std::move(layer));
+    return OK;
+}
+
+int replay_sequence_t::replay() const {
+    if (layers_.empty()) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "[REPLAY] No layers were recorded. The replay requires the "
+                "performance mode.");
+        return OK;
+    }
+    if (!is_cpu()) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "Error: the replay is supported for CPU engines only.");
+        return FAIL;
+    }
+
+    const auto &engine = get_test_engine();
+    const size_t n_layers = layers_.size();
+
+    // Two activation buffers are enough for a chain of layers. The scratchpad
+    // is shared by all layers. The rest of the arguments, e.g., weights, are
+    // owned by each layer.
+    size_t act_size = 0, scratchpad_size = 0;
+    for (const auto &l : layers_) {
+        for (const auto &e : l.mds) {
+            const size_t sz = dnnl_memory_desc_get_size(e.second);
+            if (is_activation_arg(e.first, e.second))
+                act_size = std::max(act_size, sz);
+            else if (e.first == DNNL_ARG_SCRATCHPAD)
+                scratchpad_size = std::max(scratchpad_size, sz);
+        }
+    }
+    const auto make_buffer = [&](size_t size) {
+        const dnnl_dims_t dims {static_cast<dnnl_dim_t>(std::max(
+                size, size_t(1)))};
+        auto md = dnn_mem_t::init_md(1, dims, dnnl_u8, tag::abx);
+        return dnn_mem_t(md, engine, /* prefill = */ true);
+    };
+    dnn_mem_t act_bufs[2] = {make_buffer(act_size), make_buffer(act_size)};
+    dnn_mem_t scratchpad_buf = make_buffer(scratchpad_size);
+
+    std::vector<dnn_mem_map_t> mem_maps(n_layers);
+    std::vector<args_t> v_args(n_layers);
+    std::vector<std::vector<dnnl_exec_arg_t>> dnnl_args(n_layers);
+    for (size_t i = 0; i < n_layers; i++) {
+        for (const auto &e : layers_[i].mds) {
+            const int arg = e.first;
+            const auto &md = e.second;
+            void *ptr = nullptr;
+            if (is_activation_arg(arg, md)) {
+                const auto &buf = act_bufs[(i + (arg == DNNL_ARG_SRC)) % 2];
+                ptr = static_cast<void *>(buf);
+            } else if (arg == DNNL_ARG_SCRATCHPAD) {
+                ptr = static_cast<void *>(scratchpad_buf);
+            }
+
+            if (ptr)
+                mem_maps[i].emplace(
+                        arg, dnn_mem_t::create_from_host_ptr(md, engine, ptr));
+            else if (query_md_format_kind(md) == dnnl_format_kind_host_scalar)
+                mem_maps[i].emplace(arg, dnn_mem_t(md));
+            else
+                mem_maps[i].emplace(
+                        arg, dnn_mem_t(md, engine, /* prefill = */ true));
+        }
+        v_args[i] = args_t(mem_maps[i]);
+        execute_unmap_args(v_args[i], dnnl_args[i]);
+    }
+
+    stream_t stream(engine);
+    const auto run_layer = [&](size_t i) {
+        DNN_SAFE(dnnl_primitive_execute(layers_[i].prim, stream,
+                         static_cast<int>(dnnl_args[i].size()),
+                         dnnl_args[i].data()),
+                WARN);
+        DNN_SAFE(dnnl_stream_wait(stream), CRIT);
+        return OK;
+    };
+
+    // Warm-up run, this is not measured due to possibility the associated
+    // kernels have not been built and skews the results.
+    for (size_t i = 0; i < n_layers; i++)
+        SAFE(run_layer(i), WARN);
+
+    std::vector<timer::timer_t> layer_timers(n_layers);
+    timer::timer_t total_timer;
+    while (true) {
+        total_timer.start();
+        for (size_t i = 0; i < n_layers; i++) {
+            layer_timers[i].start();
+            SAFE(run_layer(i), WARN);
+            layer_timers[i].stamp();
+        }
+        total_timer.stamp();
+        if (should_stop(total_timer)) break;
+    }
+
+    for (size_t i = 0; i < n_layers; i++)
+        execute_map_args(v_args[i]);
+
+    const double total_ms = total_timer.ms(timer::timer_t::avg);
+    BENCHDNN_PRINT(0,
+            "[REPLAY] total: layers:%d runs:%d min(ms):%g avg(ms):%g\n",
+            static_cast<int>(n_layers),
+            static_cast<int>(total_timer.times()),
+            total_timer.ms(timer::timer_t::min), total_ms);
+    for (size_t i = 0; i < n_layers; i++) {
+        const auto &t = layer_timers[i];
+        const double avg_ms = t.ms(timer::timer_t::avg);
+        BENCHDNN_PRINT(0,
+                "[REPLAY] %d: min(ms):%g avg(ms):%g share:%.2f%% impl:%s "
+                "%s\n",
+                static_cast<int>(i), t.ms(timer::timer_t::min), avg_ms,
+                total_ms > 0 ? 100. * avg_ms / total_ms : 0.,
+                layers_[i].impl_name.c_str(), layers_[i].name.c_str());
+    }
+    return OK;
+}
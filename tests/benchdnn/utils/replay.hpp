@@ -0,0 +1,63 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_REPLAY_HPP
+#define UTILS_REPLAY_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "utils/wrapper.hpp"
+
+struct args_t;
+
+// Collects the primitives measured by the drivers to execute them back to back
+// in the order of their recording, as a model would do.
+struct replay_sequence_t {
+    bool is_recording() const { return is_recording_; }
+    void start_recording() { is_recording_ = true; }
+
+    // The name is assigned to the layers recorded next.
+    void set_layer_name(const std::string &name) { layer_name_ = name; }
+
+    // Keeps an own copy of `prim` and the memory descriptors of `args`.
+    int record(dnnl_primitive_t prim, const args_t &args,
+            const std::string &impl_name);
+
+    // Executes the recorded sequence and reports the end-to-end time and the
+    // time of each layer.
+    int replay() const;
+
+private:
+    struct layer_t {
+        std::string name;
+        std::string impl_name;
+        benchdnn_dnnl_wrapper_t<dnnl_primitive_t> prim;
+        std::vector<std::pair<int, benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t>>>
+                mds;
+    };
+
+    bool is_recording_ = false;
+    std::string layer_name_;
+    std::vector<layer_t> layers_;
+};
+
+replay_sequence_t &get_replay_sequence();
+
+#endif
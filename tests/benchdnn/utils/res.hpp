@@ -133,6 +133,8 @@ enum class reason_t {
     failed_ref_not_expected,
     // The problem requires more RAM than the system provides.
     skip_not_enough_ram,
+    // The performance is worse than the baseline.
+    perf_regression,
     // The library fetched the implementation that was requested to be skipped.
     skip_impl_hit,
     // The problem has an ordinal number that was requested to be skipped.
@@ -172,6 +174,16 @@ struct res_t {
     size_t obytes = 0;
     // Detailed information about test case memory requirements.
     check_mem_size_args_t mem_size_args;
+    // The number of executions per second of all instances together when
+    // `--num-instances` is used, `0` otherwise.
+    double throughput = 0;
+    // The time of the first execution of a problem in milliseconds. It is not
+    // a part of the measurements and includes one-time costs, such as kernel
+    // generation or the first touch of the scratchpad.
+    double cold_ms = 0;
+    // The energy of the system per execution of a problem in joules when
+    // `--energy` is used, `0` otherwise.
+    double energy_j = 0;
 
     // Resets `state`, `errors`, `total`, `reason` field with default values
     // and a given `new_state`.
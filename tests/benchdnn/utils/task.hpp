@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "common.hpp"
+#include "utils/perf_baseline.hpp"
 #include "utils/wrapper.hpp"
 
 template <typename prb_t, typename perf_report_t, typename create_func_t,
@@ -92,6 +93,8 @@ struct task_t {
         return report();
     }
 
+    res_t &res() { return res_; }
+
 private:
     prb_t prb_;
     create_func_t create_func_;
@@ -117,6 +120,8 @@ private:
     // Note: can't be `const` because of `parse_result`.
     int report() {
         const prb_t *prb = &prb_;
+        if (has_bench_mode_bit(mode_bit_t::perf))
+            SAFE(check_perf_baseline(prb_.str(), &res_), WARN);
         parse_result(res_, prb_.str());
         if (has_bench_mode_bit(mode_bit_t::perf)) {
             perf_report_t pr(prb, perf_template_.c_str());
@@ -17,6 +17,7 @@
 #ifndef UTILS_TASK_EXECUTOR_HPP
 #define UTILS_TASK_EXECUTOR_HPP
 
+#include "utils/impl_filter.hpp"
 #include "utils/parallel.hpp"
 #include "utils/task.hpp"
 
@@ -47,6 +48,10 @@ struct task_executor_t {
             const do_func_t &do_func) {
         static const int nthreads = benchdnn_get_max_threads();
         for (int r = 0; r < repeats_per_prb; r++) {
+            if (impl_shootout && bench_mode != bench_mode_t::list) {
+                shootout(prb, perf_template, create_func, check_func, do_func);
+                continue;
+            }
             tasks_.emplace_back(prb, perf_template, create_func, check_func,
                     do_func, get_idx());
             if (has_bench_mode_modifier(mode_modifier_t::par_create)
@@ -77,6 +82,46 @@ struct task_executor_t {
         tasks_.clear();
     }
 
+    // Runs the problem with every implementation passing the filter, one at
+    // a time, and ranks them by performance.
+    void shootout(const prb_t &prb, const std::string &perf_template,
+            const create_func_t &create_func, const check_func_t &check_func,
+            const do_func_t &do_func) {
+        if (!tasks_.empty()) flush();
+
+        std::vector<impl_shootout_entry_t> entries;
+        for (int idx = 0;; idx++) {
+            impl_shootout_idx = idx;
+            task_t<prb_t, perf_report_t, create_func_t, check_func_t,
+                    do_func_t>
+                    task(prb, perf_template, create_func, check_func, do_func,
+                            get_idx());
+            task.create(/* in_parallel = */ false);
+
+            auto &res = task.res();
+            const bool is_created = res.state == INITIALIZED;
+            // Running out of implementations is not reported as a test.
+            const bool is_exhausted = idx > 0 && res.state == SKIPPED
+                    && res.reason == reason_t::skip_impl_hit;
+            if (!is_exhausted) {
+                task.check();
+                task.exec();
+            }
+            if (!is_created) break;
+
+            if (res.state == PASSED || res.state == EXECUTED
+                    || res.state == MISTRUSTED) {
+                auto &t = res.timer_map.perf_timer();
+                entries.push_back({res.impl_name, t.ms(timer::timer_t::min),
+                        t.ms(timer::timer_t::avg)});
+            }
+        }
+        impl_shootout_idx = 0;
+
+        if (has_bench_mode_bit(mode_bit_t::perf) && !entries.empty())
+            report_impl_shootout(prb.str(), entries);
+    }
+
     std::vector<task_t<prb_t, perf_report_t, create_func_t, check_func_t,
             do_func_t>>
             tasks_;
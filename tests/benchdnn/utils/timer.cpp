@@ -207,6 +207,37 @@ void timer_t::filter_collection() {
             min_n_samples, deltas_size, msg.c_str());
 }
 
+void timer_t::append(const timer_t &rhs) {
+    for (const auto &s : rhs.samples_)
+        stop(1, s.ticks, s.ms);
+}
+
+double timer_t::ms_percentile(double p) const {
+    if (samples_.empty()) return 0; // nothing to report
+
+    std::vector<double> ms(samples_.size());
+    for (size_t i = 0; i < samples_.size(); i++)
+        ms[i] = samples_[i].ms;
+    // Nearest-rank percentile
+    const size_t rank = static_cast<size_t>(std::ceil(p / 100. * ms.size()));
+    const size_t idx = std::min(ms.size() - 1, rank ? rank - 1 : 0);
+    std::nth_element(ms.begin(), ms.begin() + idx, ms.end());
+    return ms[idx];
+}
+
+double timer_t::ms_stddev() const {
+    if (samples_.size() < 2) return 0;
+
+    double mean = 0;
+    for (const auto &s : samples_)
+        mean += s.ms;
+    mean /= samples_.size();
+    double var = 0;
+    for (const auto &s : samples_)
+        var += (s.ms - mean) * (s.ms - mean);
+    return std::sqrt(var / (samples_.size() - 1));
+}
+
 timer_t &timer_t::operator=(const timer_t &rhs) {
     if (this == &rhs) return *this;
     *this = timer_t(rhs);
@@ -48,6 +48,9 @@
 
 namespace timer {
 
+// Returns the current time in milliseconds
+double ms_now();
+
 struct timer_t {
     enum mode_t { min = 0, avg = 1, max = 2, sum = 3, n_modes };
 
@@ -87,6 +90,16 @@ struct timer_t {
     // inside the definition.
     void filter_collection();
 
+    // Adds the measurements of `rhs` to the collection
+    void append(const timer_t &rhs);
+
+    // Returns the execution time below which `p` percent of the collected
+    // measurements fall
+    double ms_percentile(double p) const;
+
+    // Returns the sample standard deviation of the collected measurements
+    double ms_stddev() const;
+
     timer_t(const timer_t &rhs) = default;
     timer_t &operator=(const timer_t &rhs);
     timer_t &operator=(timer_t &&rhs) = default;
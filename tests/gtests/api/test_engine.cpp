@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <thread>
 
 #include "dnnl_test_common.hpp"
@@ -73,6 +74,80 @@ HANDLE_EXCEPTIONS_FOR_TEST_P(engine_test_t, TestMultithreading) {
     exe.join();
 }
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+namespace {
+struct alloc_stats_t {
+    std::atomic<int> n_allocs[2] {{0}, {0}};
+    std::atomic<int> n_live {0};
+};
+
+void *test_allocate(size_t size, size_t alignment, dnnl_cpu_alloc_kind_t kind,
+        void *user_data) {
+    auto *stats = static_cast<alloc_stats_t *>(user_data);
+    stats->n_allocs[kind]++;
+    stats->n_live++;
+    void *ptr = nullptr;
+#ifdef _WIN32
+    ptr = _aligned_malloc(size, alignment);
+#else
+    if (::posix_memalign(&ptr, alignment, size) != 0) ptr = nullptr;
+#endif
+    return ptr;
+}
+
+void test_deallocate(
+        void *ptr, size_t size, dnnl_cpu_alloc_kind_t kind, void *user_data) {
+    auto *stats = static_cast<alloc_stats_t *>(user_data);
+    stats->n_live--;
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    ::free(ptr);
+#endif
+}
+} // namespace
+
+class cpu_user_allocator_test_t : public ::testing::Test {};
+
+HANDLE_EXCEPTIONS_FOR_TEST(cpu_user_allocator_test_t, TestAllocations) {
+    alloc_stats_t stats;
+    {
+        engine eng = make_cpu_engine_with_allocator(
+                test_allocate, test_deallocate, &stats);
+        stream s(eng);
+
+        const memory::dims dims = {2, 64, 16, 16};
+        memory::desc src_md(
+                dims, memory::data_type::f32, memory::format_tag::nchw);
+        memory::desc dst_md(
+                dims, memory::data_type::f32, memory::format_tag::nhwc);
+        memory src(src_md, eng);
+        memory dst(dst_md, eng);
+        ASSERT_EQ(stats.n_allocs[dnnl_cpu_alloc_persistent], 2);
+
+        float *src_ptr = static_cast<float *>(src.get_data_handle());
+        for (size_t i = 0; i < src_md.get_size() / sizeof(float); i++)
+            src_ptr[i] = static_cast<float>(i);
+
+        auto softmax_pd = softmax_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::softmax_accurate,
+                src_md, dst_md, 1);
+        softmax_forward(softmax_pd).execute(
+                s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        s.wait();
+        // a scratchpad, if any, is allocated with the user allocator
+        if (softmax_pd.scratchpad_desc().get_size() > 0)
+            ASSERT_GT(stats.n_allocs[dnnl_cpu_alloc_scratch], 0);
+    }
+    ASSERT_EQ(stats.n_live, 0);
+
+    EXPECT_EQ(dnnl_cpu_engine_create_with_allocator(
+                      nullptr, test_allocate, test_deallocate, &stats),
+            dnnl_invalid_arguments);
+}
+#endif
+
 INSTANTIATE_TEST_SUITE_P(AllEngineKinds, engine_test_t,
         ::testing::Values(engine::kind::cpu, engine::kind::gpu));
 
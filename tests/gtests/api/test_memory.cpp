@@ -313,4 +313,43 @@ TEST(cpp_api_host_scalar_mem, TestDataTypeMismatch) {
     }
 }
 
+TEST(cpp_api_read_only_mem, TestReorder) {
+    using namespace dnnl;
+
+    engine::kind eng_kind = engine::kind::cpu;
+    SKIP_IF(engine::get_count(eng_kind) == 0, "Engine is not found.");
+    SKIP_IF(DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Read-only memory is not supported with SYCL CPU runtime.");
+    engine eng(eng_kind, 0);
+    stream strm(eng);
+
+    alignas(64) static const float src_data[2 * 32] = {0};
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+    memory::desc src_md({2, 32}, dt::f32, tag::ab);
+    memory::desc dst_md({2, 32}, dt::f32, tag::ba);
+
+    auto src = make_read_only_memory(src_md, eng, src_data);
+    ASSERT_EQ(src.get_data_handle(), (const void *)src_data);
+
+    // The data handle can't be changed and the buffer must be aligned
+    float other_data[2 * 32];
+    EXPECT_THROW(src.set_data_handle(other_data), dnnl::error);
+    EXPECT_THROW(make_read_only_memory(src_md, eng, src_data + 1), dnnl::error);
+
+    memory dst(dst_md, eng);
+    float *dst_ptr = static_cast<float *>(dst.get_data_handle());
+    for (int i = 0; i < 2 * 32; i++)
+        dst_ptr[i] = 1.f;
+
+    reorder(src, dst).execute(strm, src, dst);
+    strm.wait();
+    for (int i = 0; i < 2 * 32; i++)
+        ASSERT_EQ(dst_ptr[i], 0.f);
+
+    // Read-only memory can't be passed as an output
+    reorder r(dst, src);
+    EXPECT_THROW(r.execute(strm, dst, src), dnnl::error);
+}
+
 } // namespace dnnl
@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2019 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -20,6 +21,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include <tuple>
+#include <vector>
 
 namespace dnnl {
 
@@ -29,10 +31,6 @@ static bool are_valid_flags(
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
     if (engine_kind == dnnl_gpu && (stream_flags & dnnl_stream_out_of_order))
         ok = false;
-#endif
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
-    if (engine_kind == dnnl_cpu && (stream_flags & dnnl_stream_out_of_order))
-        ok = false;
 #endif
     return ok;
 }
@@ -137,6 +135,122 @@ TEST(stream_test_c_t, GetStream) {
 }
 #endif
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+TEST(stream_test_cpp_t, OutOfOrderDependencies) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng, stream::flags::out_of_order);
+
+    const memory::dim n = 1024;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    // dst = 2 * src + 1
+    auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_linear, md, md, 2.f, 1.f);
+    eltwise_forward linear(pd);
+
+    memory a(md, eng), b(md, eng), c(md, eng), d(md, eng);
+    float *a_ptr = static_cast<float *>(a.get_data_handle());
+    for (memory::dim i = 0; i < n; i++)
+        a_ptr[i] = static_cast<float>(i % 7);
+
+    // c depends on b, d only on a; a is then overwritten after its readers
+    linear.execute(s, {{DNNL_ARG_SRC, a}, {DNNL_ARG_DST, b}});
+    linear.execute(s, {{DNNL_ARG_SRC, b}, {DNNL_ARG_DST, c}});
+    linear.execute(s, {{DNNL_ARG_SRC, a}, {DNNL_ARG_DST, d}});
+    linear.execute(s, {{DNNL_ARG_SRC, c}, {DNNL_ARG_DST, a}});
+    s.enqueue_barrier();
+    linear.execute(s, {{DNNL_ARG_SRC, d}, {DNNL_ARG_DST, d}});
+    s.wait();
+
+    const float *c_ptr = static_cast<const float *>(c.get_data_handle());
+    const float *d_ptr = static_cast<const float *>(d.get_data_handle());
+    for (memory::dim i = 0; i < n; i++) {
+        const float x = static_cast<float>(i % 7);
+        ASSERT_EQ(c_ptr[i], 4 * x + 3);
+        ASSERT_EQ(a_ptr[i], 8 * x + 7);
+        ASSERT_EQ(d_ptr[i], 4 * x + 3);
+    }
+}
+
+// The executions of a primitive with a scratchpad, including the ones sharing
+// the global scratchpad, give the same results as on an in-order stream
+TEST(stream_test_cpp_t, OutOfOrderScratchpad) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng, stream::flags::out_of_order);
+    stream s_ref(eng);
+
+    using tag = memory::format_tag;
+    const memory::data_type f32 = memory::data_type::f32;
+    memory::desc src_md({2, 8, 19, 19}, f32, tag::nchw);
+    memory::desc wei_md({16, 8, 3, 3}, f32, tag::oihw);
+    memory::desc dst_md({2, 16, 17, 17}, f32, tag::nchw);
+    auto conv_pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_md, dst_md, {1, 1}, {0, 0}, {0, 0});
+    convolution_forward conv(conv_pd);
+
+    memory::desc a_md({3, 37, 45}, f32, tag::abc);
+    memory::desc b_md({3, 45, 29}, f32, tag::abc);
+    memory::desc c_md({3, 37, 29}, f32, tag::abc);
+    matmul mm(matmul::primitive_desc(eng, a_md, b_md, c_md));
+
+    // The scratchpad is booked by at least one of the implementations
+    primitive_attr user_attr;
+    user_attr.set_scratchpad_mode(scratchpad_mode::user);
+    auto conv_user_pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_md, dst_md, {1, 1}, {0, 0}, {0, 0}, user_attr);
+    auto mm_user_pd
+            = matmul::primitive_desc(eng, a_md, b_md, c_md, user_attr);
+    if (conv_user_pd.scratchpad_desc().get_size() == 0
+            && mm_user_pd.scratchpad_desc().get_size() == 0)
+        GTEST_SKIP() << "No implementation requires a scratchpad.";
+
+    const int n_execs = 4;
+    memory wei(wei_md, eng), b(b_md, eng);
+    fill_data<float>(wei_md.get_size() / sizeof(float), wei);
+    fill_data<float>(b_md.get_size() / sizeof(float), b);
+    std::vector<memory> src, dst, dst_ref, a, c, c_ref;
+    for (int i = 0; i < n_execs; i++) {
+        src.emplace_back(src_md, eng);
+        fill_data<float>(src_md.get_size() / sizeof(float), src.back(),
+                float(i + 1), 0.5f);
+        dst.emplace_back(dst_md, eng);
+        dst_ref.emplace_back(dst_md, eng);
+        a.emplace_back(a_md, eng);
+        fill_data<float>(a_md.get_size() / sizeof(float), a.back(),
+                float(i + 1), 0.5f);
+        c.emplace_back(c_md, eng);
+        c_ref.emplace_back(c_md, eng);
+    }
+
+    // The executions are independent and interleaved with each other
+    for (int i = 0; i < n_execs; i++) {
+        conv.execute(s,
+                {{DNNL_ARG_SRC, src[i]}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst[i]}});
+        mm.execute(s,
+                {{DNNL_ARG_SRC, a[i]}, {DNNL_ARG_WEIGHTS, b},
+                        {DNNL_ARG_DST, c[i]}});
+    }
+    s.wait();
+
+    for (int i = 0; i < n_execs; i++) {
+        conv.execute(s_ref,
+                {{DNNL_ARG_SRC, src[i]}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst_ref[i]}});
+        mm.execute(s_ref,
+                {{DNNL_ARG_SRC, a[i]}, {DNNL_ARG_WEIGHTS, b},
+                        {DNNL_ARG_DST, c_ref[i]}});
+    }
+    s_ref.wait();
+
+    for (int i = 0; i < n_execs; i++) {
+        compare_data<float>(dst_ref[i], dst[i]);
+        compare_data<float>(c_ref[i], c[i]);
+    }
+}
+#endif
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
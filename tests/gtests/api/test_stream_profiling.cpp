@@ -0,0 +1,134 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include <vector>
+
+namespace dnnl {
+
+#if defined(DNNL_EXPERIMENTAL_PROFILING) \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+
+class cpu_stream_profiling_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        memory::desc md({2, 3, 4, 5}, memory::data_type::f32,
+                memory::format_tag::nchw);
+        auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward,
+                algorithm::eltwise_relu, md, md, 0.f);
+        relu = eltwise_forward(pd);
+        mem = memory(md, eng);
+    }
+
+    void execute(stream &s, int n) {
+        for (int i = 0; i < n; i++)
+            relu.execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+        s.wait();
+    }
+
+    engine eng {engine::kind::cpu, 0};
+    eltwise_forward relu;
+    memory mem;
+};
+
+TEST_F(cpu_stream_profiling_test_t, QueryAndReset) {
+    stream s(eng, stream::flags::profiling);
+    ASSERT_NO_THROW(reset_profiling(s));
+
+    const int n_execs = 3;
+    execute(s, n_execs);
+
+    std::vector<uint64_t> nsec, start, end, tid;
+    ASSERT_NO_THROW(nsec = get_profiling_data(s, profiling_data_kind::time));
+    ASSERT_NO_THROW(
+            start = get_profiling_data(s, profiling_data_kind::start_time));
+    ASSERT_NO_THROW(end = get_profiling_data(s, profiling_data_kind::end_time));
+    ASSERT_NO_THROW(
+            tid = get_profiling_data(s, profiling_data_kind::thread_id));
+
+    ASSERT_EQ(nsec.size(), size_t(n_execs));
+    ASSERT_EQ(start.size(), size_t(n_execs));
+    ASSERT_EQ(end.size(), size_t(n_execs));
+    ASSERT_EQ(tid.size(), size_t(n_execs));
+    for (int i = 0; i < n_execs; i++) {
+        ASSERT_LE(start[i], end[i]);
+        ASSERT_EQ(nsec[i], end[i] - start[i]);
+        ASSERT_NE(tid[i], 0u);
+        // Executions of an in-order stream do not overlap
+        if (i > 0) { ASSERT_LE(end[i - 1], start[i]); }
+    }
+
+    // The entries accumulate until the profiler is reset
+    execute(s, 1);
+    ASSERT_NO_THROW(nsec = get_profiling_data(s, profiling_data_kind::time));
+    ASSERT_EQ(nsec.size(), size_t(n_execs + 1));
+
+    ASSERT_NO_THROW(reset_profiling(s));
+    ASSERT_NO_THROW(nsec = get_profiling_data(s, profiling_data_kind::time));
+    ASSERT_TRUE(nsec.empty());
+    ASSERT_NO_THROW(
+            tid = get_profiling_data(s, profiling_data_kind::thread_id));
+    ASSERT_TRUE(tid.empty());
+
+    // Recording resumes after a reset
+    execute(s, 2);
+    ASSERT_NO_THROW(
+            start = get_profiling_data(s, profiling_data_kind::start_time));
+    ASSERT_EQ(start.size(), size_t(2));
+}
+
+TEST_F(cpu_stream_profiling_test_t, InvalidArguments) {
+    stream s(eng, stream::flags::profiling);
+    execute(s, 1);
+
+    int num_entries = 0;
+    ASSERT_EQ(dnnl_query_profiling_data(s.get(), dnnl_profiling_data_kind_time,
+                      nullptr, nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_query_profiling_data(s.get(), dnnl_profiling_data_kind_time,
+                      &num_entries, nullptr),
+            dnnl_success);
+    ASSERT_EQ(num_entries, 1);
+
+    std::vector<uint64_t> data(num_entries);
+    ASSERT_EQ(dnnl_query_profiling_data(s.get(),
+                      dnnl_profiling_data_kind_undef, &num_entries,
+                      data.data()),
+            dnnl_unimplemented);
+    EXPECT_ANY_THROW(get_profiling_data(s, profiling_data_kind::undef));
+}
+
+TEST_F(cpu_stream_profiling_test_t, StreamWithoutProfiling) {
+    stream s(eng);
+    execute(s, 1);
+
+    int num_entries = 0;
+    ASSERT_EQ(dnnl_reset_profiling(s.get()), dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_query_profiling_data(s.get(), dnnl_profiling_data_kind_time,
+                      &num_entries, nullptr),
+            dnnl_invalid_arguments);
+    EXPECT_ANY_THROW(reset_profiling(s));
+    EXPECT_ANY_THROW(get_profiling_data(s, profiling_data_kind::start_time));
+}
+
+#endif
+
+} // namespace dnnl
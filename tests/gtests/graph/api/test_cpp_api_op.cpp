@@ -118,6 +118,7 @@ TEST(APIOp, CreateAllOps) {
             op::kind::GreaterEqual,
             op::kind::RMSNorm,
             op::kind::Dropout,
+            op::kind::RoPE,
     };
     // clang-format on
 
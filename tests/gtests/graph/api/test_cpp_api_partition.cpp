@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2020 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -19,7 +20,10 @@
 #include "test_api_common.hpp"
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 TEST(APIPartition, PartitionTest) {
     using namespace dnnl::graph;
@@ -456,3 +460,445 @@ TEST(APIPartition, UseMultipleEngines) {
     // Executing cp1 with eng2 should throw exception.
     EXPECT_ANY_THROW(cp1.execute(str2, {ts_src2, ts_wei2}, {ts_output2}));
 }
+
+TEST(APIPartition, CacheBlob) {
+    using namespace dnnl::graph;
+    const engine::kind ekind = static_cast<engine::kind>(api_test_engine_kind);
+    SKIP_IF(ekind != engine::kind::cpu,
+            "cpu engine is used to compare the outputs.");
+
+    graph g(ekind);
+    size_t id = 0;
+    const auto dt = logical_tensor::data_type::f32;
+
+    auto src = logical_tensor(
+            id++, dt, {16, 64}, logical_tensor::layout_type::strided);
+    auto wei = logical_tensor(
+            id++, dt, {64, 32}, logical_tensor::layout_type::strided);
+    auto dst = logical_tensor(
+            id++, dt, {16, 32}, logical_tensor::layout_type::strided);
+
+    auto matmul = op(id++, op::kind::MatMul, "matmul");
+    matmul.set_attr<bool>(op::attr::transpose_a, false);
+    matmul.add_inputs({src, wei});
+    matmul.add_outputs({dst});
+
+    auto output = logical_tensor(
+            id++, dt, {16, 32}, logical_tensor::layout_type::any);
+    auto relu = op(id++, op::kind::ReLU, "relu");
+    relu.add_inputs({dst});
+    relu.add_outputs({output});
+
+    g.add_op(matmul);
+    g.add_op(relu);
+    g.finalize();
+    auto parts = g.get_partitions();
+    ASSERT_EQ(parts.size(), 1UL);
+
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(ekind);
+    auto cp = parts[0].compile({src, wei}, {output}, eng);
+    std::vector<uint8_t> blob = cp.get_cache_blob();
+    ASSERT_FALSE(blob.empty());
+
+    // The compiled partition loaded from the blob has the same layouts.
+    compiled_partition loaded(eng, blob);
+    auto out_lt = cp.query_logical_tensor(output.get_id());
+    auto loaded_out_lt = loaded.query_logical_tensor(output.get_id());
+    ASSERT_EQ(out_lt.get_layout_type(), loaded_out_lt.get_layout_type());
+    ASSERT_EQ(out_lt.get_strides(), loaded_out_lt.get_strides());
+
+    std::vector<float> src_data(16 * 64), wei_data(64 * 32);
+    for (size_t i = 0; i < src_data.size(); i++)
+        src_data[i] = static_cast<float>(i % 7) - 3.f;
+    for (size_t i = 0; i < wei_data.size(); i++)
+        wei_data[i] = static_cast<float>(i % 5) - 2.f;
+    std::vector<float> out_data(16 * 32), loaded_out_data(16 * 32);
+
+    dnnl::stream strm(eng);
+    tensor ts_src(src, eng, src_data.data());
+    tensor ts_wei(wei, eng, wei_data.data());
+    tensor ts_out(out_lt, eng, out_data.data());
+    tensor ts_loaded_out(loaded_out_lt, eng, loaded_out_data.data());
+    cp.execute(strm, {ts_src, ts_wei}, {ts_out});
+    loaded.execute(strm, {ts_src, ts_wei}, {ts_loaded_out});
+    strm.wait();
+    ASSERT_EQ(out_data, loaded_out_data);
+
+    // A corrupted blob is rejected.
+    blob.resize(blob.size() / 2);
+    EXPECT_THROW(compiled_partition(eng, blob), dnnl::error);
+}
+
+TEST(APIPartition, PrepareConstants) {
+    using namespace dnnl::graph;
+    const engine::kind ekind = static_cast<engine::kind>(api_test_engine_kind);
+    SKIP_IF(ekind != engine::kind::cpu,
+            "cpu engine is used to check the outputs.");
+
+    graph g(ekind);
+    const auto dt = logical_tensor::data_type::f32;
+    const int64_t M = 4, K = 32, N = 16;
+
+    auto src = logical_tensor(
+            0, dt, {M, K}, logical_tensor::layout_type::strided);
+    auto wei = logical_tensor(1, dt, {K, N},
+            logical_tensor::layout_type::strided,
+            logical_tensor::property_type::constant);
+    auto dst = logical_tensor(
+            2, dt, {M, N}, logical_tensor::layout_type::strided);
+
+    auto matmul = op(3, op::kind::MatMul, "matmul");
+    matmul.add_inputs({src, wei});
+    matmul.add_outputs({dst});
+
+    g.add_op(matmul);
+    g.finalize();
+    auto parts = g.get_partitions();
+    ASSERT_EQ(parts.size(), 1UL);
+
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(ekind);
+    auto cp = parts[0].compile({src, wei}, {dst}, eng);
+
+    std::vector<float> src_data(M * K), wei_data(K * N), dst_data(M * N);
+    for (size_t i = 0; i < src_data.size(); i++)
+        src_data[i] = static_cast<float>(i % 3) - 1.f;
+    for (size_t i = 0; i < wei_data.size(); i++)
+        wei_data[i] = static_cast<float>(i % 5) - 2.f;
+
+    dnnl::stream strm(eng);
+    tensor ts_src(src, eng, src_data.data());
+    tensor ts_wei(wei, eng, wei_data.data());
+    tensor ts_dst(dst, eng, dst_data.data());
+
+    // The constant input is required.
+    EXPECT_THROW(cp.prepare_constants(strm, {}), dnnl::error);
+    EXPECT_NO_THROW(cp.prepare_constants(strm, {ts_wei}));
+
+    cp.execute(strm, {ts_src, ts_wei}, {ts_dst});
+    strm.wait();
+    for (int64_t m = 0; m < M; m++) {
+        for (int64_t n = 0; n < N; n++) {
+            float ref = 0.f;
+            for (int64_t k = 0; k < K; k++)
+                ref += src_data[m * K + k] * wei_data[k * N + n];
+            ASSERT_EQ(dst_data[m * N + n], ref);
+        }
+    }
+}
+
+namespace {
+
+// Compiles a partition with a single eltwise op of kind `kind` from tensor
+// `in_id` to tensor `out_id`.
+dnnl::graph::compiled_partition compile_eltwise(dnnl::graph::op::kind kind,
+        size_t in_id, size_t out_id, const std::vector<int64_t> &dims,
+        const dnnl::engine &eng) {
+    using namespace dnnl::graph;
+    const auto dt = logical_tensor::data_type::f32;
+    auto src = logical_tensor(
+            in_id, dt, dims, logical_tensor::layout_type::strided);
+    auto dst = logical_tensor(
+            out_id, dt, dims, logical_tensor::layout_type::strided);
+    auto eltwise = op(out_id, kind, "eltwise");
+    eltwise.add_inputs({src});
+    eltwise.add_outputs({dst});
+
+    graph g(eng.get_kind());
+    g.add_op(eltwise);
+    g.finalize();
+    auto parts = g.get_partitions();
+    return parts.at(0).compile({src}, {dst}, eng);
+}
+
+} // namespace
+
+TEST(APIPartition, PlanMemory) {
+    using namespace dnnl::graph;
+    const engine::kind ekind = static_cast<engine::kind>(api_test_engine_kind);
+    SKIP_IF(ekind != engine::kind::cpu,
+            "cpu engine is used to allocate the arena.");
+
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(ekind);
+    const std::vector<int64_t> dims {7, 33};
+    const size_t nelems = 7 * 33, size = nelems * sizeof(float);
+
+    // 0 -> ReLU -> 1 -> Abs -> 2 -> Square -> 3
+    std::vector<compiled_partition> cps {
+            compile_eltwise(op::kind::ReLU, 0, 1, dims, eng),
+            compile_eltwise(op::kind::Abs, 1, 2, dims, eng),
+            compile_eltwise(op::kind::Square, 2, 3, dims, eng)};
+
+    memory_plan plan;
+    ASSERT_NO_THROW(plan = plan_memory(cps));
+    ASSERT_EQ(plan.scratchpad_offsets.size(), cps.size());
+
+    // The sequence input 0 and output 3 are not planned, and the
+    // intermediate tensors 1 and 2 are alive in the second partition.
+    ASSERT_EQ(plan.tensor_offsets.size(), 2U);
+    std::unordered_map<size_t, size_t> offsets(
+            plan.tensor_offsets.begin(), plan.tensor_offsets.end());
+    ASSERT_EQ(offsets.count(1), 1U);
+    ASSERT_EQ(offsets.count(2), 1U);
+    const size_t off1 = offsets[1], off2 = offsets[2];
+    ASSERT_EQ(off1 % 64, 0U);
+    ASSERT_EQ(off2 % 64, 0U);
+    ASSERT_TRUE(off1 + size <= off2 || off2 + size <= off1);
+    ASSERT_LE(std::max(off1, off2) + size, plan.arena_size);
+    for (size_t i = 0; i < cps.size(); i++) {
+        const auto lt = cps[i].get_scratchpad_logical_tensor();
+        ASSERT_EQ(plan.scratchpad_offsets[i] % 64, 0U);
+        ASSERT_LE(plan.scratchpad_offsets[i] + lt.get_mem_size(),
+                plan.arena_size);
+    }
+
+    // Execute the sequence against the arena
+    std::vector<char> arena(plan.arena_size + 64);
+    char *base = arena.data();
+    base += (64 - reinterpret_cast<uintptr_t>(base) % 64) % 64;
+
+    std::vector<float> src_data(nelems), dst_data(nelems);
+    for (size_t i = 0; i < nelems; i++)
+        src_data[i] = static_cast<float>(i % 9) - 4.f;
+
+    dnnl::stream strm(eng);
+    const auto dt = logical_tensor::data_type::f32;
+    auto lt = [&](size_t id) {
+        return logical_tensor(
+                id, dt, dims, logical_tensor::layout_type::strided);
+    };
+    std::vector<tensor> ts {tensor(lt(0), eng, src_data.data()),
+            tensor(lt(1), eng, base + off1), tensor(lt(2), eng, base + off2),
+            tensor(lt(3), eng, dst_data.data())};
+    for (size_t i = 0; i < cps.size(); i++) {
+        const auto sp_lt = cps[i].get_scratchpad_logical_tensor();
+        tensor sp;
+        if (sp_lt.get_mem_size() > 0)
+            sp = tensor(sp_lt, eng, base + plan.scratchpad_offsets[i]);
+        ASSERT_NO_THROW(cps[i].execute(strm, {ts[i]}, {ts[i + 1]}, sp));
+    }
+    strm.wait();
+
+    for (size_t i = 0; i < nelems; i++) {
+        const float r = std::max(src_data[i], 0.f);
+        ASSERT_EQ(dst_data[i], r * r) << "at " << i;
+    }
+
+    // An empty sequence needs no arena
+    ASSERT_NO_THROW(plan = plan_memory({}));
+    ASSERT_EQ(plan.arena_size, 0U);
+    ASSERT_TRUE(plan.tensor_offsets.empty());
+    ASSERT_TRUE(plan.scratchpad_offsets.empty());
+}
+
+TEST(APIPartition, PlanMemoryInvalidArguments) {
+    using namespace dnnl::graph;
+    const engine::kind ekind = static_cast<engine::kind>(api_test_engine_kind);
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(ekind);
+    const std::vector<int64_t> dims {4, 16};
+
+    std::vector<compiled_partition> cps {
+            compile_eltwise(op::kind::ReLU, 0, 1, dims, eng),
+            compile_eltwise(op::kind::Abs, 1, 2, dims, eng)};
+    std::vector<const_dnnl_graph_compiled_partition_t> c_cps {
+            cps[0].get(), cps[1].get()};
+
+    size_t arena_size = 0, num_tensors = 0;
+    ASSERT_EQ(dnnl_graph_compiled_partition_plan_memory(c_cps.size(),
+                      c_cps.data(), nullptr, &num_tensors, nullptr, nullptr,
+                      nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_graph_compiled_partition_plan_memory(c_cps.size(),
+                      c_cps.data(), &arena_size, nullptr, nullptr, nullptr,
+                      nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_graph_compiled_partition_plan_memory(c_cps.size(),
+                      nullptr, &arena_size, &num_tensors, nullptr, nullptr,
+                      nullptr),
+            dnnl_invalid_arguments);
+
+    ASSERT_EQ(dnnl_graph_compiled_partition_plan_memory(c_cps.size(),
+                      c_cps.data(), &arena_size, &num_tensors, nullptr,
+                      nullptr, nullptr),
+            dnnl_success);
+    ASSERT_EQ(num_tensors, 1U);
+
+    // The second call requires all the arrays and the queried count
+    std::vector<size_t> ids(num_tensors + 1), offs(num_tensors + 1),
+            sp_offs(c_cps.size());
+    ASSERT_EQ(dnnl_graph_compiled_partition_plan_memory(c_cps.size(),
+                      c_cps.data(), &arena_size, &num_tensors, ids.data(),
+                      offs.data(), nullptr),
+            dnnl_invalid_arguments);
+    size_t wrong_num_tensors = num_tensors + 1;
+    ASSERT_EQ(dnnl_graph_compiled_partition_plan_memory(c_cps.size(),
+                      c_cps.data(), &arena_size, &wrong_num_tensors,
+                      ids.data(), offs.data(), sp_offs.data()),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_graph_compiled_partition_plan_memory(c_cps.size(),
+                      c_cps.data(), &arena_size, &num_tensors, ids.data(),
+                      offs.data(), sp_offs.data()),
+            dnnl_success);
+    ASSERT_EQ(ids[0], 1U);
+
+    // A null compiled partition and a tensor produced twice are rejected
+    c_cps.push_back(nullptr);
+    EXPECT_EQ(dnnl_graph_compiled_partition_plan_memory(c_cps.size(),
+                      c_cps.data(), &arena_size, &num_tensors, nullptr,
+                      nullptr, nullptr),
+            dnnl_invalid_arguments);
+    cps.push_back(compile_eltwise(op::kind::ReLU, 0, 2, dims, eng));
+    EXPECT_THROW(plan_memory(cps), dnnl::error);
+}
+
+TEST(APIPartition, CompileWithSymbolicDims) {
+    using namespace dnnl::graph;
+    const engine::kind ekind = static_cast<engine::kind>(api_test_engine_kind);
+    SKIP_IF(ekind != engine::kind::cpu,
+            "symbolic dimensions are only supported on cpu.");
+
+    const auto dt = logical_tensor::data_type::f32;
+    const auto strided = logical_tensor::layout_type::strided;
+    const int64_t max_m = 20, K = 24, N = 10;
+    const int64_t unknown = DNNL_GRAPH_UNKNOWN_DIM;
+
+    auto src = logical_tensor(0, dt, {max_m, K}, strided);
+    auto wei = logical_tensor(1, dt, {K, N}, strided);
+    auto dst = logical_tensor(2, dt, {unknown, unknown}, strided);
+    auto matmul = op(3, op::kind::MatMul, "matmul");
+    matmul.add_inputs({src, wei});
+    matmul.add_outputs({dst});
+
+    graph g(ekind);
+    g.add_op(matmul);
+    g.finalize();
+    auto parts = g.get_partitions();
+    ASSERT_EQ(parts.size(), 1UL);
+
+    // The rows of the MatMul source vary between 1 and max_m
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(ekind);
+    const symbolic_dim m_dim {0, 0, 7, 1, max_m};
+    compiled_partition cp;
+    ASSERT_NO_THROW(cp = parts[0].compile_with_symbolic_dims(
+                            {src, wei}, {dst}, {m_dim}, eng));
+
+    // The queried logical tensors describe the largest bucket
+    auto dst_lt = cp.query_logical_tensor(2);
+    ASSERT_EQ(dst_lt.get_dims(), logical_tensor::dims({max_m, N}));
+
+    std::vector<float> wei_data(K * N);
+    for (size_t i = 0; i < wei_data.size(); i++)
+        wei_data[i] = static_cast<float>(i % 5) - 2.f;
+
+    dnnl::stream strm(eng);
+    // Sizes inside buckets, equal to a bucket, and the largest one
+    for (int64_t M : {int64_t(1), int64_t(3), int64_t(8), int64_t(13), max_m}) {
+        std::vector<float> src_data(M * K), dst_data(M * N, -1.f);
+        for (size_t i = 0; i < src_data.size(); i++)
+            src_data[i] = static_cast<float>(i % 7) - 3.f;
+
+        tensor ts_src(logical_tensor(0, dt, {M, K}, strided), eng,
+                src_data.data());
+        tensor ts_wei(wei, eng, wei_data.data());
+        tensor ts_dst(logical_tensor(2, dt, {M, N}, strided), eng,
+                dst_data.data());
+        ASSERT_NO_THROW(cp.execute(strm, {ts_src, ts_wei}, {ts_dst}));
+        strm.wait();
+
+        for (int64_t m = 0; m < M; m++) {
+            for (int64_t n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (int64_t k = 0; k < K; k++)
+                    ref += src_data[m * K + k] * wei_data[k * N + n];
+                ASSERT_EQ(dst_data[m * N + n], ref)
+                        << "M " << M << " at " << m << ", " << n;
+            }
+        }
+    }
+
+    // A size out of the declared range is rejected on execution
+    std::vector<float> big_src((max_m + 1) * K), big_dst((max_m + 1) * N);
+    tensor ts_big_src(logical_tensor(0, dt, {max_m + 1, K}, strided), eng,
+            big_src.data());
+    tensor ts_wei(wei, eng, wei_data.data());
+    tensor ts_big_dst(logical_tensor(2, dt, {max_m + 1, N}, strided), eng,
+            big_dst.data());
+    EXPECT_THROW(cp.execute(strm, {ts_big_src, ts_wei}, {ts_big_dst}),
+            dnnl::error);
+}
+
+TEST(APIPartition, CompileWithSymbolicDimsInvalidArguments) {
+    using namespace dnnl::graph;
+    const engine::kind ekind = static_cast<engine::kind>(api_test_engine_kind);
+    const auto dt = logical_tensor::data_type::f32;
+    const auto strided = logical_tensor::layout_type::strided;
+
+    auto src = logical_tensor(0, dt, {16, 8}, strided);
+    auto wei = logical_tensor(1, dt, {8, 4}, strided);
+    auto dst = logical_tensor(2, dt, {16, 4}, strided);
+    auto matmul = op(3, op::kind::MatMul, "matmul");
+    matmul.add_inputs({src, wei});
+    matmul.add_outputs({dst});
+
+    graph g(ekind);
+    g.add_op(matmul);
+    g.finalize();
+    auto parts = g.get_partitions();
+    ASSERT_EQ(parts.size(), 1UL);
+
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(ekind);
+    auto compile = [&](const std::vector<symbolic_dim> &dims) {
+        return parts[0].compile_with_symbolic_dims(
+                {src, wei}, {dst}, dims, eng);
+    };
+
+    if (ekind != engine::kind::cpu) {
+        // Only CPU engines are supported
+        EXPECT_THROW(compile({{0, 0, 0, 1, 16}}), dnnl::error);
+        return;
+    }
+
+    EXPECT_NO_THROW(compile({{0, 0, 0, 1, 16}}));
+    // No symbolic dimensions
+    EXPECT_THROW(compile({}), dnnl::error);
+    // Invalid input index and axis
+    EXPECT_THROW(compile({{2, 0, 0, 1, 16}}), dnnl::error);
+    EXPECT_THROW(compile({{0, 2, 0, 1, 16}}), dnnl::error);
+    EXPECT_THROW(compile({{0, -1, 0, 1, 16}}), dnnl::error);
+    // Invalid ranges
+    EXPECT_THROW(compile({{0, 0, 0, 0, 16}}), dnnl::error);
+    EXPECT_THROW(compile({{0, 0, 0, 17, 16}}), dnnl::error);
+    // A symbol declared with different ranges
+    EXPECT_THROW(compile({{0, 0, 0, 1, 16}, {1, 1, 0, 1, 8}}), dnnl::error);
+
+    // The C API rejects null arguments
+    dnnl_graph_compiled_partition_t c_cp = nullptr;
+    ASSERT_EQ(dnnl_graph_compiled_partition_create(&c_cp, parts[0].get()),
+            dnnl_success);
+    dnnl_graph_logical_tensor_t c_src, c_wei, c_dst;
+    const dnnl_dims_t src_dims {16, 8}, wei_dims {8, 4}, dst_dims {16, 4};
+    ASSERT_EQ(dnnl_graph_logical_tensor_init_with_dims(&c_src, 0, dnnl_f32, 2,
+                      src_dims, dnnl_graph_layout_type_strided,
+                      dnnl_graph_tensor_property_undef),
+            dnnl_success);
+    ASSERT_EQ(dnnl_graph_logical_tensor_init_with_dims(&c_wei, 1, dnnl_f32, 2,
+                      wei_dims, dnnl_graph_layout_type_strided,
+                      dnnl_graph_tensor_property_undef),
+            dnnl_success);
+    ASSERT_EQ(dnnl_graph_logical_tensor_init_with_dims(&c_dst, 2, dnnl_f32, 2,
+                      dst_dims, dnnl_graph_layout_type_strided,
+                      dnnl_graph_tensor_property_undef),
+            dnnl_success);
+    const dnnl_graph_logical_tensor_t *c_ins[] = {&c_src, &c_wei};
+    const dnnl_graph_logical_tensor_t *c_outs[] = {&c_dst};
+    EXPECT_EQ(dnnl_graph_partition_compile_with_symbolic_dims(parts[0].get(),
+                      c_cp, 2, c_ins, 1, c_outs, 1, nullptr, eng.get()),
+            dnnl_invalid_arguments);
+    const dnnl_graph_symbolic_dim_t c_dim {0, 0, 0, 1, 16};
+    EXPECT_EQ(dnnl_graph_partition_compile_with_symbolic_dims(parts[0].get(),
+                      c_cp, 2, c_ins, 1, c_outs, 1, &c_dim, nullptr),
+            dnnl_invalid_arguments);
+    EXPECT_EQ(dnnl_graph_partition_compile_with_symbolic_dims(parts[0].get(),
+                      c_cp, 2, c_ins, 1, c_outs, 1, &c_dim, eng.get()),
+            dnnl_success);
+    ASSERT_EQ(dnnl_graph_compiled_partition_destroy(c_cp), dnnl_success);
+}
@@ -261,6 +261,99 @@ TEST(test_convolution_compile,
             || lt.layout_type == graph::layout_type::strided);
 }
 
+TEST(test_convolution_execute, ConvolutionBackwardWeightsWithBias) {
+    using dims = graph::dnnl_impl::dims;
+
+    graph::engine_t *eng = get_engine();
+
+    // src is 1x1x3x3, diff_dst is 1x2x2x2 and the filters are 2x1x2x2
+    std::vector<float> src {1.0, -2.0, 0.5, 3.0, 0.0, -1.0, 2.0, 1.5, -0.5};
+    std::vector<float> diff_dst {1.0, 2.0, -1.0, 0.5, -2.0, 1.0, 0.0, 3.0};
+    std::vector<float> diff_weight(8, 0.f);
+    std::vector<float> diff_bias(2, 0.f);
+    std::vector<float> ref_diff_weight(8, 0.f);
+    std::vector<float> ref_diff_bias(2, 0.f);
+    for (size_t oc = 0; oc < 2; ++oc) {
+        for (size_t oh = 0; oh < 2; ++oh) {
+            for (size_t ow = 0; ow < 2; ++ow) {
+                const float dd = diff_dst[oc * 4 + oh * 2 + ow];
+                ref_diff_bias[oc] += dd;
+                for (size_t kh = 0; kh < 2; ++kh) {
+                    for (size_t kw = 0; kw < 2; ++kw) {
+                        ref_diff_weight[oc * 4 + kh * 2 + kw]
+                                += dd * src[(oh + kh) * 3 + ow + kw];
+                    }
+                }
+            }
+        }
+    }
+
+    graph::op_t conv_op(0, graph::op_kind::ConvolutionBackwardWeights, "conv");
+    conv_op.set_attr<dims>(graph::op_attr::strides, dims {1, 1});
+    conv_op.set_attr<dims>(graph::op_attr::dilations, dims {1, 1});
+    conv_op.set_attr<dims>(graph::op_attr::pads_begin, dims {0, 0});
+    conv_op.set_attr<dims>(graph::op_attr::pads_end, dims {0, 0});
+    conv_op.set_attr<std::string>(graph::op_attr::data_format, "NCX");
+    conv_op.set_attr<std::string>(graph::op_attr::weights_format, "OIX");
+    conv_op.set_attr<dims>(graph::op_attr::weights_shape, dims {2, 1, 2, 2});
+    graph::op_t bias_op(1, graph::op_kind::BiasAddBackward, "bias_bwd");
+    bias_op.set_attr<std::string>(graph::op_attr::data_format, "NCX");
+
+    graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+            0, {1, 1, 3, 3}, graph::data_type::f32);
+    graph::logical_tensor_t diff_dst_lt = utils::logical_tensor_init(
+            1, {1, 2, 2, 2}, graph::data_type::f32);
+    graph::logical_tensor_t diff_weight_lt = utils::logical_tensor_init(
+            2, {2, 1, 2, 2}, graph::data_type::f32);
+    graph::logical_tensor_t diff_bias_lt
+            = utils::logical_tensor_init(3, {2}, graph::data_type::f32);
+
+    conv_op.add_input(src_lt);
+    conv_op.add_input(diff_dst_lt);
+    conv_op.add_output(diff_weight_lt);
+    bias_op.add_input(diff_dst_lt);
+    bias_op.add_output(diff_bias_lt);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&conv_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&bias_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("fp_conv_bwd_weights_bias");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 2U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt, &diff_dst_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {
+            &diff_weight_lt, &diff_bias_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    test_tensor_t src_ts(src_lt, eng, src);
+    test_tensor_t diff_dst_ts(diff_dst_lt, eng, diff_dst);
+    test_tensor_t diff_weight_ts(diff_weight_lt, eng, diff_weight);
+    test_tensor_t diff_bias_ts(diff_bias_lt, eng, diff_bias);
+
+    graph::stream_t *strm = get_stream();
+    ASSERT_EQ(cp.execute(strm, {src_ts.get(), diff_dst_ts.get()},
+                      {diff_weight_ts.get(), diff_bias_ts.get()}),
+            graph::status::success);
+    strm->wait();
+    diff_weight = diff_weight_ts.as_vec_type<float>();
+    diff_bias = diff_bias_ts.as_vec_type<float>();
+    for (size_t i = 0; i < diff_weight.size(); ++i) {
+        ASSERT_FLOAT_EQ(diff_weight[i], ref_diff_weight[i]);
+    }
+    for (size_t i = 0; i < diff_bias.size(); ++i) {
+        ASSERT_FLOAT_EQ(diff_bias[i], ref_diff_bias[i]);
+    }
+}
+
 TEST(test_convolution_partition, InvalidInputNumForConvolutionBackwardData) {
     using dims = dnnl::impl::graph::dnnl_impl::dims;
 
@@ -1370,3 +1370,93 @@ TEST(test_large_partition_execute, Int8Bf16GptMha_CPU) {
             graph::status::success);
     strm->wait();
 }
+
+TEST(test_large_partition_execute, F32SiblingMatmuls_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    using dims = graph::dnnl_impl::dims;
+    const graph::dim_t B = 2, M = 8, K = 32;
+    const dims Ns {64, 16, 16};
+
+    for (const bool with_bias : {false, true}) {
+        for (const bool transpose_b : {false, true}) {
+            graph::graph_t g(eng->kind());
+            auto src = utils::logical_tensor_init(
+                    0, {B, M, K}, graph::data_type::f32);
+            size_t id = 1;
+            for (size_t i = 0; i < Ns.size(); ++i) {
+                const graph::dim_t N = Ns[i];
+                graph::op_t matmul(i, graph::op_kind::MatMul, "matmul");
+                matmul.set_attr<bool>(graph::op_attr::transpose_b, transpose_b);
+
+                auto wei = utils::logical_tensor_init(id++,
+                        transpose_b ? dims {N, K} : dims {K, N},
+                        graph::data_type::f32);
+                wei.property = graph::property_type::constant;
+                matmul.add_input(src);
+                matmul.add_input(wei);
+                if (with_bias) {
+                    auto bia = utils::logical_tensor_init(
+                            id++, {N}, graph::data_type::f32);
+                    bia.property = graph::property_type::constant;
+                    matmul.add_input(bia);
+                }
+                matmul.add_output(utils::logical_tensor_init(
+                        id++, {B, M, N}, graph::data_type::f32));
+                ASSERT_EQ(g.add_op(&matmul), graph::status::success);
+            }
+            ASSERT_EQ(g.finalize(), graph::status::success);
+
+            graph::pass::pass_base_ptr apass
+                    = get_pass("sibling_matmul_fusion_cpu");
+            apass->run(g);
+            ASSERT_EQ(g.get_num_partitions(), 1U);
+            auto part = g.get_partitions()[0];
+            ASSERT_EQ(part->get_ops().size(), Ns.size());
+
+            graph::partition_t p;
+            p.init(part);
+            auto partition_inputs = p.get_inputs();
+            auto partition_outputs = p.get_outputs();
+            ASSERT_EQ(partition_outputs.size(), Ns.size());
+
+            std::vector<const graph::logical_tensor_t *> inputs, outputs;
+            for (auto &lt : partition_inputs)
+                inputs.emplace_back(&lt);
+            for (auto &lt : partition_outputs)
+                outputs.emplace_back(&lt);
+
+            graph::compiled_partition_t cp(p);
+            ASSERT_EQ(p.compile(&cp, inputs, outputs, eng),
+                    graph::status::success);
+
+            std::vector<test_tensor_t> inputs_ts, outputs_ts, ref_ts;
+            for (auto &lt : inputs) {
+                inputs_ts.emplace_back(*lt, eng);
+                inputs_ts.back().fill<float>();
+            }
+            for (auto &lt : outputs) {
+                outputs_ts.emplace_back(*lt, eng);
+                ref_ts.emplace_back(*lt, eng);
+            }
+
+            ASSERT_EQ(run_graph(g, inputs_ts, ref_ts, *eng, *strm),
+                    graph::status::success);
+            // run twice to use the cached concatenated weights
+            for (int run = 0; run < 2; ++run) {
+                ASSERT_EQ(cp.execute(strm,
+                                  test_tensor_t::to_graph_tensor(inputs_ts),
+                                  test_tensor_t::to_graph_tensor(outputs_ts)),
+                        graph::status::success);
+                strm->wait();
+                for (size_t i = 0; i < outputs_ts.size(); ++i) {
+                    ASSERT_TRUE(allclose<float>(outputs_ts[i], ref_ts[i],
+                            /*rtol*/ 1e-5f, /*atol*/ 1e-5f));
+                }
+            }
+        }
+    }
+}
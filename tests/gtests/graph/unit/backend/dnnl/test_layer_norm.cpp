@@ -527,3 +527,119 @@ TEST(test_layer_norm_execute_subgraph_int8, LayernormTypecastQuant_CPU) {
         ASSERT_FLOAT_EQ(ref_data[i], dst_data[i]);
     }
 }
+
+TEST(test_layer_norm_execute_subgraph_int8, ResidualAddNormQuant_CPU) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet");
+
+    std::vector<int64_t> shape {2, 3, 16};
+    std::vector<int64_t> scale_lt_shape {16};
+    std::vector<float> src_data(product(shape));
+    std::vector<float> res_data(product(shape));
+    std::vector<float> scale(product(scale_lt_shape));
+    std::vector<float> shift(product(scale_lt_shape));
+
+    // random seed = 7
+    std::default_random_engine generator(7);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    for (auto *vec : {&src_data, &res_data, &scale, &shift})
+        std::generate(vec->begin(), vec->end(),
+                [&]() { return distribution(generator); });
+
+    for (const bool is_rms : {false, true}) {
+        graph::op_t add_op(0, graph::op_kind::Add, "add");
+        graph::op_t norm_op(1,
+                is_rms ? graph::op_kind::RMSNorm : graph::op_kind::LayerNorm,
+                "norm");
+        norm_op.set_attr<float>(graph::op_attr::epsilon, 1e-5f);
+        if (!is_rms) norm_op.set_attr<bool>(graph::op_attr::keep_stats, false);
+        graph::op_t quantize(2, graph::op_kind::Quantize, "quantize");
+        quantize.set_attr<std::vector<float>>(graph::op_attr::scales, {0.02f});
+        quantize.set_attr<std::vector<int64_t>>(graph::op_attr::zps, {3});
+        quantize.set_attr<std::string>(graph::op_attr::qtype, "per_tensor");
+
+        graph::logical_tensor_t src
+                = utils::logical_tensor_init(0, shape, graph::data_type::f32);
+        graph::logical_tensor_t res
+                = utils::logical_tensor_init(1, shape, graph::data_type::f32);
+        graph::logical_tensor_t sum
+                = utils::logical_tensor_init(2, shape, graph::data_type::f32);
+        graph::logical_tensor_t scale_lt = utils::logical_tensor_init(
+                3, scale_lt_shape, graph::data_type::f32);
+        graph::logical_tensor_t shift_lt = utils::logical_tensor_init(
+                4, scale_lt_shape, graph::data_type::f32);
+        graph::logical_tensor_t norm_dst
+                = utils::logical_tensor_init(5, shape, graph::data_type::f32);
+        graph::logical_tensor_t quant_dst
+                = utils::logical_tensor_init(6, shape, graph::data_type::s8);
+
+        add_op.add_input(src);
+        add_op.add_input(res);
+        add_op.add_output(sum);
+        norm_op.add_input(sum);
+        norm_op.add_input(scale_lt);
+        if (!is_rms) norm_op.add_input(shift_lt);
+        norm_op.add_output(norm_dst);
+        quantize.add_input(norm_dst);
+        quantize.add_output(quant_dst);
+
+        graph::graph_t g(engine->kind());
+        ASSERT_EQ(g.add_op(&add_op), graph::status::success);
+        ASSERT_EQ(g.add_op(&norm_op), graph::status::success);
+        ASSERT_EQ(g.add_op(&quantize), graph::status::success);
+        ASSERT_EQ(g.finalize(), graph::status::success);
+
+        graph::pass::pass_base_ptr apass
+                = get_pass("residual_add_layernorm_quant_fusion_cpu");
+        apass->run(g);
+        ASSERT_EQ(g.get_num_partitions(), 1U);
+        auto part = g.get_partitions()[0];
+        ASSERT_EQ(part->get_outputs().size(), 2U);
+
+        graph::partition_t p;
+        p.init(part);
+        graph::compiled_partition_t cp(p);
+
+        std::vector<const graph::logical_tensor_t *> lt_ins {
+                &src, &res, &scale_lt};
+        if (!is_rms) lt_ins.emplace_back(&shift_lt);
+        std::vector<const graph::logical_tensor_t *> lt_outs;
+        for (const auto &lt : part->get_outputs())
+            lt_outs.emplace_back(lt.id == sum.id ? &sum : &quant_dst);
+        ASSERT_EQ(p.compile(&cp, lt_ins, lt_outs, engine),
+                graph::status::success);
+
+        test_tensor_t src_ts(src, engine, src_data);
+        test_tensor_t res_ts(res, engine, res_data);
+        test_tensor_t scale_ts(scale_lt, engine, scale);
+        test_tensor_t shift_ts(shift_lt, engine, shift);
+        test_tensor_t sum_ts(sum, engine);
+        test_tensor_t dst_ts(quant_dst, engine);
+        test_tensor_t ref_sum_ts(sum, engine);
+        test_tensor_t ref_ts(quant_dst, engine);
+
+        std::vector<test_tensor_t> ins {src_ts, res_ts, scale_ts};
+        if (!is_rms) ins.emplace_back(shift_ts);
+        ASSERT_EQ(run_graph(g, ins, {ref_sum_ts, ref_ts}, *engine, *strm),
+                graph::status::success);
+
+        std::vector<graph::tensor_t> in_ts, out_ts;
+        for (const auto &t : ins)
+            in_ts.emplace_back(t.get());
+        for (const auto *lt : lt_outs)
+            out_ts.emplace_back(lt->id == sum.id ? sum_ts.get() : dst_ts.get());
+        ASSERT_EQ(cp.execute(strm, in_ts, out_ts), graph::status::success);
+        strm->wait();
+
+        auto sum_data = sum_ts.as_vec_type<float>();
+        auto ref_sum_data = ref_sum_ts.as_vec_type<float>();
+        for (size_t i = 0; i < ref_sum_data.size(); ++i)
+            ASSERT_FLOAT_EQ(ref_sum_data[i], sum_data[i]);
+        auto dst_data = dst_ts.as_vec_type<int8_t>();
+        auto ref_data = ref_ts.as_vec_type<int8_t>();
+        for (size_t i = 0; i < ref_data.size(); ++i)
+            ASSERT_NEAR(ref_data[i], dst_data[i], 1);
+    }
+}
@@ -2175,6 +2175,62 @@ TEST(test_pass_system, TestBnBwdReluBwd) {
     ASSERT_EQ(agraph.get_partitions()[0]->get_outputs()[2].id, 9U);
 }
 
+TEST(test_pass_system, TestBnBwdReluBwdConvBwdData) {
+    /*
+        ReLUBackward
+         |
+        BatchNormTrainingBackward
+         |
+        ConvolutionBackwardData
+    */
+    const auto engine_kind = get_test_engine_kind();
+    graph_t agraph(engine_kind);
+    op_t op1 {0, ReLUBackward, "op1"};
+    op_t op2 {1, BatchNormTrainingBackward, "op2"};
+    op2.set_attr(op_attr::epsilon, 0.001f);
+    op_t op3 {2, ConvolutionBackwardData, "op3"};
+    set_conv_common_attr(op3);
+
+    std::vector<logical_tensor_t> lt_vec = create_logical_tensors(12);
+    op1.add_input(lt_vec[0]);
+    op1.add_input(lt_vec[1]);
+    op1.add_output(lt_vec[2]);
+
+    op2.add_input(lt_vec[2]);
+    op2.add_input(lt_vec[3]);
+    op2.add_input(lt_vec[4]);
+    op2.add_input(lt_vec[5]);
+    op2.add_input(lt_vec[6]);
+    op2.add_output(lt_vec[7]);
+    op2.add_output(lt_vec[8]);
+    op2.add_output(lt_vec[9]);
+
+    op3.add_input(lt_vec[7]);
+    op3.add_input(lt_vec[10]);
+    op3.add_output(lt_vec[11]);
+
+    ASSERT_EQ(agraph.add_op(&op1), status::success);
+    ASSERT_EQ(agraph.add_op(&op2), status::success);
+    ASSERT_EQ(agraph.add_op(&op3), status::success);
+    agraph.finalize();
+
+    pass::pass_base_ptr apass = get_pass("fp_bnorm_bwd_relu_bwd_conv_bwd_data");
+    apass->run(agraph);
+
+    ASSERT_EQ(agraph.get_num_partitions(), 1U);
+    ASSERT_EQ((agraph.get_partitions()[0])->get_kind(),
+            partition_kind_t::misc_post_ops);
+
+    ASSERT_EQ(agraph.get_partitions()[0]->get_inputs().size(), 7U);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_outputs().size(), 3U);
+    std::unordered_set<size_t> output_ids;
+    for (const auto &lt : agraph.get_partitions()[0]->get_outputs())
+        output_ids.insert(lt.id);
+    ASSERT_TRUE(output_ids.find(8) != output_ids.end());
+    ASSERT_TRUE(output_ids.find(9) != output_ids.end());
+    ASSERT_TRUE(output_ids.find(11) != output_ids.end());
+}
+
 TEST(test_pass, FuseConvSumRelu) {
     /*   conv
            \   /
@@ -12351,6 +12407,82 @@ TEST(test_pass, FailToFuseReorderAdd) {
     ASSERT_EQ(agraph.get_num_partitions(), 0U);
 }
 
+TEST(test_pass, FuseTransposeTypecastPostOpsIntoReorder) {
+    /*
+         transpose
+             |
+         typecast
+             |
+           relu
+             |  /
+            mul
+             |
+         [quantize]
+             |
+    */
+    const auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind == engine_kind::gpu, "skip on gpu");
+    for (bool with_quant : {false, true}) {
+        graph_t agraph(engine_kind);
+        op_t transpose {0, StaticTranspose, "transpose"};
+        transpose.set_attr(op_attr::order, std::vector<int64_t> {1, 0});
+        op_t typecast {1, TypeCast, "typecast"};
+        op_t relu {2, ReLU, "relu"};
+        op_t mul {3, Multiply, "mul"};
+        op_t quant {4, Quantize, "quant"};
+        quant.set_attr(op_attr::scales, std::vector<float> {0.5f});
+        quant.set_attr(op_attr::zps, std::vector<int64_t> {0});
+
+        logical_tensor_t src_lt
+                = logical_tensor_init(0, {3, 2}, data_type::bf16);
+        logical_tensor_t transpose_dst_lt
+                = logical_tensor_init(1, {2, 3}, data_type::bf16);
+        logical_tensor_t typecast_dst_lt
+                = logical_tensor_init(2, {2, 3}, data_type::f32);
+        logical_tensor_t relu_dst_lt
+                = logical_tensor_init(3, {2, 3}, data_type::f32);
+        logical_tensor_t mul_src_lt
+                = logical_tensor_init(4, {2, 3}, data_type::f32);
+        logical_tensor_t mul_dst_lt
+                = logical_tensor_init(5, {2, 3}, data_type::f32);
+        logical_tensor_t quant_dst_lt
+                = logical_tensor_init(6, {2, 3}, data_type::u8);
+        transpose.add_input(src_lt);
+        transpose.add_output(transpose_dst_lt);
+        typecast.add_input(transpose_dst_lt);
+        typecast.add_output(typecast_dst_lt);
+        relu.add_input(typecast_dst_lt);
+        relu.add_output(relu_dst_lt);
+        mul.add_input(relu_dst_lt);
+        mul.add_input(mul_src_lt);
+        mul.add_output(mul_dst_lt);
+        quant.add_input(mul_dst_lt);
+        quant.add_output(quant_dst_lt);
+
+        ASSERT_EQ(agraph.add_op(&transpose), status::success);
+        ASSERT_EQ(agraph.add_op(&typecast), status::success);
+        ASSERT_EQ(agraph.add_op(&relu), status::success);
+        ASSERT_EQ(agraph.add_op(&mul), status::success);
+        if (with_quant) ASSERT_EQ(agraph.add_op(&quant), status::success);
+        ASSERT_EQ(agraph.finalize(), status::success);
+
+        pass::pass_base_ptr apass = get_pass(with_quant
+                        ? "fp_reorder_post_ops_quantize_cpu"
+                        : "fp_reorder_post_ops_cpu");
+        apass->run(agraph);
+
+        ASSERT_EQ(agraph.get_num_partitions(), 1U);
+        ASSERT_EQ(agraph.get_partitions()[0]->get_ops().size(),
+                with_quant ? 5U : 4U);
+        ASSERT_EQ(agraph.get_partitions()[0]->get_inputs().size(), 2U);
+        ASSERT_EQ(agraph.get_partitions()[0]->get_inputs()[0].id, 0U);
+        ASSERT_EQ(agraph.get_partitions()[0]->get_inputs()[1].id, 4U);
+        ASSERT_EQ(agraph.get_partitions()[0]->get_outputs().size(), 1U);
+        ASSERT_EQ(agraph.get_partitions()[0]->get_outputs()[0].id,
+                with_quant ? 6U : 5U);
+    }
+}
+
 TEST(test_pass, FuseInt8Reorder) {
     /*
          dequantize
@@ -13953,7 +14085,7 @@ TEST(test_pass, SingleSoftPlusForwardAndBackwardPass) {
 }
 
 TEST(test_pass, FuseConvBwdBiasaddBwd) {
-    /*       Wildcard
+    /*       ReLU
         \        /\
       Convolution  BiasAddBackward
     BackwardWeights
@@ -13988,11 +14120,11 @@ TEST(test_pass, FuseConvBwdBiasaddBwd) {
     ASSERT_EQ((agraph.get_partitions()[0])->get_kind(),
             partition_kind_t::convolution_backward_post_ops);
 
-    ASSERT_EQ(agraph.get_partitions()[0]->get_inputs().size(), 3U);
+    // the producer of diff_dst is left out of the partition
+    ASSERT_EQ(agraph.get_partitions()[0]->get_inputs().size(), 2U);
     std::unordered_set<size_t> input_ids;
     input_ids.insert(agraph.get_partitions()[0]->get_inputs()[0].id);
     input_ids.insert(agraph.get_partitions()[0]->get_inputs()[1].id);
-    input_ids.insert(agraph.get_partitions()[0]->get_inputs()[2].id);
     ASSERT_TRUE(input_ids.find(2) != input_ids.end());
     ASSERT_TRUE(input_ids.find(1) != input_ids.end());
 
@@ -14004,6 +14136,31 @@ TEST(test_pass, FuseConvBwdBiasaddBwd) {
     ASSERT_TRUE(output_ids.find(5) != output_ids.end());
 }
 
+TEST(test_pass, NotFuseConvBwdBiasaddBwdWithDifferentFormat) {
+    const auto engine_kind = get_test_engine_kind();
+    graph_t agraph(engine_kind);
+    std::vector<logical_tensor_t> lt_vec = create_logical_tensors(4);
+    op_t op0 {0, ConvolutionBackwardWeights, "op0"};
+    set_conv_common_attr(op0);
+    op0.set_attr<std::string>(op_attr::data_format, "NCX");
+    op_t op1 {1, BiasAddBackward, "op1"};
+    op1.set_attr<std::string>(op_attr::data_format, "NXC");
+
+    op0.add_input(lt_vec[0]);
+    op0.add_input(lt_vec[1]);
+    op0.add_output(lt_vec[2]);
+    op1.add_input(lt_vec[1]);
+    op1.add_output(lt_vec[3]);
+
+    ASSERT_EQ(agraph.add_op(&op0), status::success);
+    ASSERT_EQ(agraph.add_op(&op1), status::success);
+    agraph.finalize();
+
+    pass::pass_base_ptr apass = get_pass("fp_conv_bwd_weights_bias");
+    apass->run(agraph);
+    ASSERT_EQ(agraph.get_num_partitions(), 0U);
+}
+
 // TODO(zitian): wait for the implementation of comparison ops:
 //      Gt, Ge, Le, Lt, Eq, Ne
 TEST(test_pass, BinaryPostops) {
@@ -1603,3 +1603,206 @@ TEST(test_sdp_decomp_execute, MultithreaSdpDecompCorr_CPU) {
         t2.join();
     }
 }
+
+TEST(test_sdp_decomp_execute, RopeRef_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    const dim_t N = 2, H = 3, S = 5, D = 8;
+    const dims src_shape {N, H, S, D};
+    const dims cs_shape {S, D};
+
+    for (const std::string mode : {"rotate_half", "interleaved"}) {
+        graph::op_t rope_op(0, graph::op_kind::RoPE, "rope");
+        rope_op.set_attr<std::string>(graph::op_attr::mode, mode);
+
+        auto src = utils::logical_tensor_init(
+                0, src_shape, graph::data_type::f32);
+        auto cos = utils::logical_tensor_init(
+                1, cs_shape, graph::data_type::f32);
+        auto sin = utils::logical_tensor_init(
+                2, cs_shape, graph::data_type::f32);
+        auto dst = utils::logical_tensor_init(
+                3, src_shape, graph::data_type::f32);
+        rope_op.add_input(src);
+        rope_op.add_input(cos);
+        rope_op.add_input(sin);
+        rope_op.add_output(dst);
+
+        graph::graph_t g(eng->kind());
+        ASSERT_EQ(g.add_op(&rope_op), graph::status::success);
+        ASSERT_EQ(g.finalize(), graph::status::success);
+
+        graph::pass::pass_base_ptr apass = get_pass("rope_pass_cpu");
+        apass->run(g);
+        ASSERT_EQ(g.get_num_partitions(), 1U);
+
+        graph::partition_t p;
+        p.init(g.get_partitions()[0]);
+        graph::compiled_partition_t cp(p);
+        std::vector<const graph::logical_tensor_t *> inputs {&src, &cos, &sin};
+        std::vector<const graph::logical_tensor_t *> outputs {&dst};
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+        test_tensor_t src_ts(src, eng), cos_ts(cos, eng), sin_ts(sin, eng),
+                dst_ts(dst, eng);
+        src_ts.fill<float>();
+        cos_ts.fill<float>();
+        sin_ts.fill<float>();
+        ASSERT_EQ(cp.execute(strm,
+                          test_tensor_t::to_graph_tensor(
+                                  {src_ts, cos_ts, sin_ts}),
+                          {dst_ts.get()}),
+                graph::status::success);
+        strm->wait();
+
+        const auto x = src_ts.as_vec_type<float>();
+        const auto c = cos_ts.as_vec_type<float>();
+        const auto s = sin_ts.as_vec_type<float>();
+        const auto y = dst_ts.as_vec_type<float>();
+        const bool interleaved = mode == "interleaved";
+        for (dim_t r = 0; r < N * H * S; ++r) {
+            const dim_t row = r * D, cs_row = (r % S) * D;
+            for (dim_t j = 0; j < D / 2; ++j) {
+                const dim_t i0 = interleaved ? 2 * j : j;
+                const dim_t i1 = interleaved ? 2 * j + 1 : j + D / 2;
+                const float ref0 = x[row + i0] * c[cs_row + i0]
+                        - x[row + i1] * s[cs_row + i0];
+                const float ref1 = x[row + i1] * c[cs_row + i1]
+                        + x[row + i0] * s[cs_row + i1];
+                ASSERT_NEAR(y[row + i0], ref0, 1e-5f);
+                ASSERT_NEAR(y[row + i1], ref1, 1e-5f);
+            }
+        }
+    }
+}
+
+TEST(test_sdp_decomp_execute, F32SdpRopeDecomp_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    const dim_t N = 4, H = 16, S = 32, D = 64;
+    const dims qkv_shape {N, H, S, D};
+    const dims cs_shape {S, D};
+    const dims score_shape {N, H, S, S};
+
+    for (const std::string mode : {"rotate_half", "interleaved"}) {
+        auto q = utils::logical_tensor_init(
+                0, qkv_shape, graph::data_type::f32);
+        auto k = utils::logical_tensor_init(
+                1, qkv_shape, graph::data_type::f32);
+        auto cos = utils::logical_tensor_init(
+                2, cs_shape, graph::data_type::f32);
+        auto sin = utils::logical_tensor_init(
+                3, cs_shape, graph::data_type::f32);
+        auto q_rot = utils::logical_tensor_init(
+                4, qkv_shape, graph::data_type::f32);
+        auto k_rot = utils::logical_tensor_init(
+                5, qkv_shape, graph::data_type::f32);
+        auto score = utils::logical_tensor_init(
+                6, score_shape, graph::data_type::f32);
+        auto scale = utils::logical_tensor_init(
+                7, dims {1}, graph::data_type::f32);
+        auto scaled = utils::logical_tensor_init(
+                8, score_shape, graph::data_type::f32);
+        auto probs = utils::logical_tensor_init(
+                9, score_shape, graph::data_type::f32);
+        auto v = utils::logical_tensor_init(
+                10, qkv_shape, graph::data_type::f32);
+        auto dst = utils::logical_tensor_init(
+                11, qkv_shape, graph::data_type::f32);
+
+        graph::op_t rope_q(0, graph::op_kind::RoPE, "rope_q");
+        rope_q.set_attr<std::string>(graph::op_attr::mode, mode);
+        rope_q.add_input(q);
+        rope_q.add_input(cos);
+        rope_q.add_input(sin);
+        rope_q.add_output(q_rot);
+
+        graph::op_t rope_k(1, graph::op_kind::RoPE, "rope_k");
+        rope_k.set_attr<std::string>(graph::op_attr::mode, mode);
+        rope_k.add_input(k);
+        rope_k.add_input(cos);
+        rope_k.add_input(sin);
+        rope_k.add_output(k_rot);
+
+        graph::op_t bmm1(2, graph::op_kind::MatMul, "bmm1");
+        bmm1.set_attr<bool>(graph::op_attr::transpose_b, true);
+        bmm1.add_input(q_rot);
+        bmm1.add_input(k_rot);
+        bmm1.add_output(score);
+
+        graph::op_t div(3, graph::op_kind::Divide, "div");
+        div.add_input(score);
+        div.add_input(scale);
+        div.add_output(scaled);
+
+        graph::op_t softmax(4, graph::op_kind::SoftMax, "softmax");
+        softmax.set_attr<int64_t>(graph::op_attr::axis, -1);
+        softmax.add_input(scaled);
+        softmax.add_output(probs);
+
+        graph::op_t bmm2(5, graph::op_kind::MatMul, "bmm2");
+        bmm2.add_input(probs);
+        bmm2.add_input(v);
+        bmm2.add_output(dst);
+
+        graph::graph_t g(eng->kind());
+        for (auto *op : {&rope_q, &rope_k, &bmm1, &div, &softmax, &bmm2})
+            ASSERT_EQ(g.add_op(op), graph::status::success);
+        ASSERT_EQ(g.finalize(), graph::status::success);
+
+        graph::pass::pass_base_ptr apass
+                = get_pass("float_sdp_rope_fusion_cpu");
+        apass->run(g);
+        ASSERT_EQ(g.get_num_partitions(), 1U);
+
+        graph::partition_t p;
+        p.init(g.get_partitions()[0]);
+        auto partition_inputs = p.get_inputs();
+        auto partition_outputs = p.get_outputs();
+        std::vector<const graph::logical_tensor_t *> inputs, outputs;
+        for (auto &lt : partition_inputs)
+            inputs.emplace_back(&lt);
+        for (auto &lt : partition_outputs)
+            outputs.emplace_back(&lt);
+
+        std::vector<test_tensor_t> inputs_ts;
+        for (auto &lt : inputs) {
+            inputs_ts.emplace_back(*lt, eng);
+            inputs_ts.back().fill<float>();
+        }
+
+        // The rotated heads of the decomposition kernel must match the
+        // primitive based implementation.
+        std::vector<test_tensor_t> outputs_ts[2];
+        for (int force_prim : {1, 0}) {
+            custom_setenv("_ONEDNN_GRAPH_SDPA_FORCE_PRIMITIVE",
+                    force_prim ? "1" : "0", 1);
+            graph::compiled_partition_t cp(p);
+            ASSERT_EQ(p.compile(&cp, inputs, outputs, eng),
+                    graph::status::success);
+            for (auto &lt : outputs) {
+                graph::logical_tensor_t compiled_output;
+                cp.query_logical_tensor(lt->id, &compiled_output);
+                outputs_ts[force_prim].emplace_back(compiled_output, eng);
+            }
+            ASSERT_EQ(
+                    cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                            test_tensor_t::to_graph_tensor(
+                                    outputs_ts[force_prim])),
+                    graph::status::success);
+            strm->wait();
+        }
+
+        ASSERT_TRUE(allclose<float>(outputs_ts[1][0], outputs_ts[0][0],
+                /*rtol*/ 0.01f,
+                /*atol*/ 1e-6f));
+    }
+}
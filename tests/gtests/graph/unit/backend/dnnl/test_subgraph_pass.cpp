@@ -1271,6 +1271,102 @@ TEST(test_subgraph_pass, MemoryPlanning) {
     ASSERT_TRUE(mem_offkeys.empty());
 }
 
+TEST(test_subgraph_pass, MemoryPlanningConcatViews_CPU) {
+    /*
+    mul_scales \
+                -> concat -> mul_scales
+    mul_scales /
+    */
+    graph::engine_t *g_eng = get_engine();
+    SKIP_IF(g_eng->kind() == graph::engine_kind::gpu,
+            "skip zero-copy concat test for gpu");
+    dnnl::engine p_eng = dnnl::impl::graph::dnnl_impl::make_dnnl_engine(*g_eng);
+
+    // the slices are contiguous when concatenated along the outermost axis
+    for (int64_t axis : {0, 1}) {
+        const std::vector<int64_t> in_shape {2, 3, 4};
+        std::vector<int64_t> out_shape = in_shape;
+        out_shape[axis] *= 2;
+
+        graph::op_t op1(1, op_kind::_mul_scales, "op1");
+        graph::op_t op2(2, op_kind::_mul_scales, "op2");
+        graph::op_t op3(3, op_kind::_concat, "op3");
+        graph::op_t op4(4, op_kind::_mul_scales, "op4");
+        op1.set_attr<std::vector<float>>(op_attr::scales, {0.5});
+        op2.set_attr<std::vector<float>>(op_attr::scales, {0.5});
+        op3.set_attr<int64_t>(op_attr::axis, axis);
+        op4.set_attr<std::vector<float>>(op_attr::scales, {0.5});
+
+        logical_tensor_t val0
+                = logical_tensor_init(0, in_shape, graph::data_type::f32);
+        logical_tensor_t val1
+                = logical_tensor_init(1, in_shape, graph::data_type::f32);
+        logical_tensor_t val2
+                = logical_tensor_init(2, in_shape, graph::data_type::f32);
+        logical_tensor_t val3
+                = logical_tensor_init(3, in_shape, graph::data_type::f32);
+        logical_tensor_t val4
+                = logical_tensor_init(4, out_shape, graph::data_type::f32);
+        logical_tensor_t val5
+                = logical_tensor_init(5, out_shape, graph::data_type::f32);
+
+        op1.add_input(val0);
+        op1.add_output(val2);
+        op2.add_input(val1);
+        op2.add_output(val3);
+        op3.add_input(val2);
+        op3.add_input(val3);
+        op3.add_output(val4);
+        op4.add_input(val4);
+        op4.add_output(val5);
+
+        graph::graph_t g;
+        g.add_op(&op1);
+        g.add_op(&op2);
+        g.add_op(&op3);
+        g.add_op(&op4);
+        g.finalize();
+        const graph::fpmath_t fpm {fpmath_mode::strict, false};
+        auto subgraph = std::make_shared<dnnl_impl::subgraph_t>(
+                g.get_ops(), p_eng, fpm, false, /* reset_layout */ false);
+
+        std::vector<logical_tensor_t> inputs = {val0, val1};
+        std::vector<logical_tensor_t> outputs = {val5};
+        dnnl_impl::set_given_inputs_outputs(subgraph, inputs, outputs);
+
+        dnnl_impl::memory_planner_t memory_planner;
+        memory_planner.set_enable_buffer_views(true);
+        ASSERT_EQ(memory_planner.run(subgraph), graph::status::success);
+
+        auto concat = std::find_if(subgraph->get_ops().begin(),
+                subgraph->get_ops().end(), [](const op_ptr &op) {
+                    return op->get_kind() == op_kind::_concat;
+                });
+        ASSERT_NE(concat, subgraph->get_ops().end());
+        const bool is_zero_copy = (*concat)->has_attr(op_attr::is_zero_copy);
+        ASSERT_EQ(is_zero_copy, axis == 0);
+
+        const auto &view_offsets = memory_planner.get_exec_args_set()
+                                           .get_mems_use_view_offsets();
+        if (!is_zero_copy) {
+            ASSERT_TRUE(view_offsets.empty());
+            continue;
+        }
+
+        // the second input is placed after the first one in the output
+        const std::string dst_info = memory_planner.get_memory_info(
+                (*concat)->get_output_value(0).get());
+        ASSERT_EQ(memory_planner.get_memory_info(
+                          (*concat)->get_input_value(0).get()),
+                dst_info);
+        ASSERT_EQ(memory_planner.get_memory_info(
+                          (*concat)->get_input_value(1).get()),
+                dst_info + "+" + std::to_string(2 * 3 * 4 * sizeof(float)));
+        ASSERT_EQ(view_offsets.size(), 1U);
+        ASSERT_EQ(view_offsets[0].second, 2 * 3 * 4 * sizeof(float));
+    }
+}
+
 TEST(test_subgraph_pass, FusePostOpsForConvDepthwise_CPU) {
     /*   conv
           |
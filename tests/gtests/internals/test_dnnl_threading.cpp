@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2018 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,6 +15,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <vector>
 
 #include "dnnl_test_common.hpp"
@@ -165,4 +167,77 @@ CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_t,
                 np_t {{4, 1, 4, 5, 2}}, np_t {{4, 3, 0, 3, 0, 1}},
                 np_t {{2, 1, 3, 1, 2, 1}}, np_t {{4, 1, 4, 3, 2, 2}}));
 
+class test_parallel_nd_dynamic_t : public test_nd_t {
+protected:
+    // Counts the visits of each index in `visits` and the indices out of
+    // range in `n_out_of_range`
+    void emit_parallel_nd_dynamic(std::vector<std::atomic<int>> &visits,
+            std::atomic<int> &n_out_of_range) {
+        const std::vector<ptrdiff_t> &D = p.dims;
+        auto visit = [&](std::initializer_list<ptrdiff_t> idx) {
+            ptrdiff_t off = 0;
+            int i = 0;
+            for (ptrdiff_t d : idx) {
+                if (d < 0 || d >= D[i]) {
+                    n_out_of_range++;
+                    return;
+                }
+                off = off * D[i++] + d;
+            }
+            visits[off]++;
+        };
+        using dim_t = impl::dim_t;
+        switch ((int)D.size()) {
+            case 1:
+                impl::parallel_nd_dynamic(
+                        D[0], [&](dim_t d0) { visit({d0}); });
+                break;
+            case 2:
+                impl::parallel_nd_dynamic(D[0], D[1],
+                        [&](dim_t d0, dim_t d1) { visit({d0, d1}); });
+                break;
+            case 3:
+                impl::parallel_nd_dynamic(D[0], D[1], D[2],
+                        [&](dim_t d0, dim_t d1, dim_t d2) {
+                    visit({d0, d1, d2});
+                });
+                break;
+            case 4:
+                impl::parallel_nd_dynamic(D[0], D[1], D[2], D[3],
+                        [&](dim_t d0, dim_t d1, dim_t d2, dim_t d3) {
+                    visit({d0, d1, d2, d3});
+                });
+                break;
+            case 5:
+                impl::parallel_nd_dynamic(D[0], D[1], D[2], D[3], D[4],
+                        [&](dim_t d0, dim_t d1, dim_t d2, dim_t d3, dim_t d4) {
+                    visit({d0, d1, d2, d3, d4});
+                });
+                break;
+            default: ASSERT_TRUE(false);
+        }
+    }
+};
+
+// Every index is visited exactly once
+TEST_P(test_parallel_nd_dynamic_t, Test) {
+    std::vector<std::atomic<int>> visits((size_t)size);
+    for (auto &v : visits)
+        v = 0;
+    std::atomic<int> n_out_of_range(0);
+    emit_parallel_nd_dynamic(visits, n_out_of_range);
+    synchronize_threadpool(dnnl::engine::kind::cpu);
+    ASSERT_EQ(n_out_of_range.load(), 0);
+    for (ptrdiff_t i = 0; i < size; ++i)
+        ASSERT_EQ(visits[i].load(), 1) << "at " << i;
+}
+
+CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_dynamic_t,
+        ::testing::Values(np_t {{0}}, np_t {{1}}, np_t {{1000}}, np_t {{0, 0}},
+                np_t {{1, 2}}, np_t {{37, 29}}, np_t {{0, 1, 0}},
+                np_t {{1, 2, 1}}, np_t {{4, 7, 10}}, np_t {{0, 3, 0, 1}},
+                np_t {{1, 1, 2, 1}}, np_t {{4, 5, 6, 7}},
+                np_t {{3, 0, 3, 0, 1}}, np_t {{2, 1, 1, 2, 1}},
+                np_t {{4, 3, 4, 5, 6}}));
+
 } // namespace dnnl
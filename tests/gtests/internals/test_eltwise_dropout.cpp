@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "common/math_utils.hpp"
+
+// Validates dropout fused into the eltwise primitive against the same eltwise
+// followed by a standalone dropout computed on the host.
+
+namespace dnnl {
+
+using dim = memory::dim;
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+namespace {
+
+std::vector<float> rand_vec(dim n, unsigned seed) {
+    std::minstd_rand gen(seed);
+    std::uniform_real_distribution<float> dist(-4.f, 4.f);
+    std::vector<float> v(n);
+    for (auto &x : v)
+        x = dist(gen);
+    return v;
+}
+
+// Standalone dropout, mirrors `ref_dropout(...)` of the library.
+float standalone_dropout(float src, uint8_t &mask, dim idx, float p,
+        int64_t seed, int64_t offset) {
+    using namespace dnnl::impl::math;
+    const float inv_q = (p != 1.f) ? 1.f / (1.f - p) : 0.f;
+    const uint32_t r = offset ? philox4x32(idx, seed, offset)
+                              : philox4x32(uint32_t(idx), uint32_t(seed));
+    mask = r > double(std::numeric_limits<uint32_t>::max()) * p;
+    return mask ? src * inv_q : 0.f;
+}
+
+} // namespace
+
+struct eltwise_dropout_params_t {
+    memory::dims dims;
+    tag dat_tag;
+    algorithm alg;
+    float alpha, beta;
+    float p;
+    int64_t seed, offset;
+};
+
+class eltwise_dropout_test_t
+    : public ::testing::TestWithParam<eltwise_dropout_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+                "Test requires host-allocated memory.");
+        Test();
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        auto eng = get_test_engine();
+        stream strm(eng);
+
+        const memory::desc data_md(p.dims, dt::f32, p.dat_tag);
+        const memory::desc mask_md(p.dims, dt::u8, p.dat_tag);
+        const memory::desc scalar_md({1}, dt::f32, tag::a);
+        const memory::desc s64_md({1}, dt::s64, tag::a);
+        const dim n = data_md.get_size() / sizeof(float);
+
+        auto src = rand_vec(n, 1);
+        std::vector<float> dst(n, 0.f), dst_plain(n, 0.f);
+        std::vector<uint8_t> mask(n, 2);
+        float prob = p.p;
+        int64_t seed = p.seed, offset = p.offset;
+        const bool use_offset = p.offset != 0;
+
+        const auto fwd = prop_kind::forward_training;
+        primitive_attr attr;
+        attr.set_dropout(mask_md, dt::s64, use_offset, false);
+        eltwise_forward::primitive_desc pd(
+                eng, fwd, p.alg, data_md, data_md, p.alpha, p.beta, attr);
+        eltwise_forward::primitive_desc plain_pd(
+                eng, fwd, p.alg, data_md, data_md, p.alpha, p.beta);
+
+        std::unordered_map<int, memory> args {
+                {DNNL_ARG_SRC, memory(data_md, eng, src.data())},
+                {DNNL_ARG_DST, memory(data_md, eng, dst.data())},
+                {DNNL_ARG_ATTR_DROPOUT_MASK,
+                        memory(mask_md, eng, mask.data())},
+                {DNNL_ARG_ATTR_DROPOUT_PROBABILITY,
+                        memory(scalar_md, eng, &prob)},
+                {DNNL_ARG_ATTR_DROPOUT_SEED, memory(s64_md, eng, &seed)}};
+        if (use_offset)
+            args.emplace(DNNL_ARG_ATTR_DROPOUT_OFFSET,
+                    memory(s64_md, eng, &offset));
+        eltwise_forward(pd).execute(strm, args);
+        eltwise_forward(plain_pd).execute(strm,
+                {{DNNL_ARG_SRC, memory(data_md, eng, src.data())},
+                        {DNNL_ARG_DST,
+                                memory(data_md, eng, dst_plain.data())}});
+        strm.wait();
+
+        // Both layouts are dense, so the physical offset is the mask index.
+        for (dim i = 0; i < n; i++) {
+            uint8_t ref_mask = 0;
+            const float ref = standalone_dropout(
+                    dst_plain[i], ref_mask, i, p.p, p.seed, p.offset);
+            ASSERT_EQ(mask[i], ref_mask) << "at " << i;
+            ASSERT_NEAR(dst[i], ref, 1e-6f * (1.f + std::fabs(ref)))
+                    << "at " << i;
+        }
+    }
+};
+
+TEST_P(eltwise_dropout_test_t, TestsEltwiseDropout) {}
+
+// Plain layouts take the jit implementation where it is available, and the
+// sizes are not multiples of the vector length to exercise the tails.
+INSTANTIATE_TEST_SUITE_P(TestEltwiseDropout, eltwise_dropout_test_t,
+        ::testing::Values(
+                eltwise_dropout_params_t {{7, 37}, tag::nc,
+                        algorithm::eltwise_relu, 0.f, 0.f, 0.5f, 12345678, 0},
+                eltwise_dropout_params_t {{2, 19, 5, 7}, tag::nchw,
+                        algorithm::eltwise_relu, 0.1f, 0.f, 0.25f, 843921,
+                        1238976},
+                eltwise_dropout_params_t {{3, 16, 9, 11}, tag::nchw,
+                        algorithm::eltwise_linear, 0.5f, 1.f, 0.75f, 111786,
+                        0},
+                eltwise_dropout_params_t {{2, 8, 3, 5, 7}, tag::ncdhw,
+                        algorithm::eltwise_tanh, 0.f, 0.f, 0.5f, 7, 121716},
+                eltwise_dropout_params_t {{4, 13, 6, 6}, tag::nhwc,
+                        algorithm::eltwise_relu, 0.f, 0.f, 0.5f, 99, 0}));
+
+} // namespace dnnl
@@ -0,0 +1,213 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "common/embedding_bag_iface.hpp"
+
+#define DNNL_ARG_EMBEDDING_INDICES DNNL_ARG_SRC_1
+#define DNNL_ARG_EMBEDDING_OFFSETS DNNL_ARG_SRC_2
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using mdt = memory::data_type;
+
+/// Embedding bag internal primitive.
+struct embedding_bag_t : public dnnl::primitive {
+    /// Primitive descriptor for an embedding bag primitive.
+    struct pd_t : public dnnl::primitive_desc {
+        pd_t() = default;
+
+        pd_t(const engine &aengine, algorithm alg,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr()) {
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_embedding_bag_primitive_desc_create(
+                    &pd, aengine.get(), convert_to_c(alg), src_desc.get(),
+                    indices_desc.get(), offsets_desc.get(), dst_desc.get(),
+                    attr.get());
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for an "
+                    "embedding bag primitive");
+            reset(pd);
+        }
+    };
+
+    embedding_bag_t() = default;
+    embedding_bag_t(const pd_t &pd) : primitive(pd) {}
+};
+
+struct embedding_bag_params_t {
+    algorithm alg;
+    mdt src_dt;
+    memory::dim n_rows;
+    memory::dim emb_dim;
+    std::vector<int32_t> indices;
+    std::vector<int32_t> offsets;
+    bool with_scales;
+};
+
+class embedding_bag_test_t
+    : public ::testing::TestWithParam<embedding_bag_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Embedding bag is only implemented on CPU.");
+        p = GetParam();
+    }
+
+    void Test() {
+        const engine eng = get_test_engine();
+        stream strm(eng);
+        const memory::dim n_indices = p.indices.size();
+        const memory::dim n_bags = p.offsets.size();
+
+        memory::desc src_md({p.n_rows, p.emb_dim}, p.src_dt, tag::ab);
+        memory::desc indices_md({n_indices}, mdt::s32, tag::a);
+        memory::desc offsets_md({n_bags}, mdt::s32, tag::a);
+        memory::desc dst_md({n_bags, p.emb_dim}, mdt::f32, tag::ab);
+        memory::desc scales_md({p.n_rows}, mdt::f32, tag::a);
+
+        primitive_attr attr;
+        if (p.with_scales) attr.set_scales_mask(DNNL_ARG_SRC, 1);
+
+        embedding_bag_t::pd_t pd(eng, p.alg, src_md, indices_md, offsets_md,
+                dst_md, attr);
+        embedding_bag_t prim(pd);
+
+        // Small integers keep all the sums exact in every data type.
+        std::vector<float> table(p.n_rows * p.emb_dim);
+        for (size_t i = 0; i < table.size(); i++)
+            table[i] = static_cast<float>((i * 7) % 11) - 5.f;
+        std::vector<float> scales(p.n_rows);
+        for (memory::dim r = 0; r < p.n_rows; r++)
+            scales[r] = p.with_scales ? 0.25f * (r % 4 + 1) : 1.f;
+
+        auto src_mem = test::make_memory(src_md, eng);
+        auto indices_mem = test::make_memory(indices_md, eng);
+        auto offsets_mem = test::make_memory(offsets_md, eng);
+        auto dst_mem = test::make_memory(dst_md, eng);
+        auto scales_mem = test::make_memory(scales_md, eng);
+        {
+            auto src = map_memory<char>(src_mem);
+            for (size_t i = 0; i < table.size(); i++) {
+                if (p.src_dt == mdt::f32)
+                    reinterpret_cast<float *>(&src[0])[i] = table[i];
+                else
+                    reinterpret_cast<int8_t *>(&src[0])[i]
+                            = static_cast<int8_t>(table[i]);
+            }
+            auto ind = map_memory<int32_t>(indices_mem);
+            for (memory::dim i = 0; i < n_indices; i++)
+                ind[i] = p.indices[i];
+            auto off = map_memory<int32_t>(offsets_mem);
+            for (memory::dim b = 0; b < n_bags; b++)
+                off[b] = p.offsets[b];
+            auto sc = map_memory<float>(scales_mem);
+            for (memory::dim r = 0; r < p.n_rows; r++)
+                sc[r] = scales[r];
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src_mem},
+                {DNNL_ARG_EMBEDDING_INDICES, indices_mem},
+                {DNNL_ARG_EMBEDDING_OFFSETS, offsets_mem},
+                {DNNL_ARG_DST, dst_mem}};
+        if (p.with_scales)
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, scales_mem});
+        prim.execute(strm, args);
+        strm.wait();
+
+        auto dst = map_memory<float>(dst_mem);
+        for (memory::dim b = 0; b < n_bags; b++) {
+            const int32_t beg = p.offsets[b];
+            const int32_t end = b + 1 < n_bags
+                    ? p.offsets[b + 1]
+                    : static_cast<int32_t>(n_indices);
+            for (memory::dim d = 0; d < p.emb_dim; d++) {
+                float ref = 0.f;
+                for (int32_t i = beg; i < end; i++) {
+                    const int32_t r = p.indices[i];
+                    ref += scales[r] * table[r * p.emb_dim + d];
+                }
+                if (p.alg == algorithm::reduction_mean && end > beg)
+                    ref /= static_cast<float>(end - beg);
+                ASSERT_NEAR(dst[b * p.emb_dim + d], ref, 1e-5f)
+                        << "bag " << b << " column " << d;
+            }
+        }
+    }
+
+    embedding_bag_params_t p;
+};
+
+TEST_P(embedding_bag_test_t, TestsEmbeddingBag) {
+    Test();
+}
+
+INSTANTIATE_TEST_SUITE_P(Sum, embedding_bag_test_t,
+        ::testing::Values(
+                embedding_bag_params_t {algorithm::reduction_sum, mdt::f32, 10,
+                        16, {0, 3, 3, 9, 2}, {0, 2}, false},
+                // an empty bag in the middle and a row wider than a block
+                embedding_bag_params_t {algorithm::reduction_sum, mdt::f32, 6,
+                        700, {5, 1, 0, 4}, {0, 1, 1, 3}, false}));
+
+INSTANTIATE_TEST_SUITE_P(Mean, embedding_bag_test_t,
+        ::testing::Values(embedding_bag_params_t {algorithm::reduction_mean,
+                mdt::f32, 8, 33, {7, 6, 5, 1, 2}, {0, 3}, false}));
+
+INSTANTIATE_TEST_SUITE_P(QuantizedRows, embedding_bag_test_t,
+        ::testing::Values(
+                embedding_bag_params_t {algorithm::reduction_sum, mdt::s8, 12,
+                        24, {11, 0, 4, 4, 8}, {0, 2, 4}, true},
+                embedding_bag_params_t {algorithm::reduction_mean, mdt::s8, 12,
+                        24, {3, 2, 1, 10}, {0, 1}, true}));
+
+TEST(embedding_bag_iface_test_t, TestInvalidArguments) {
+    const engine eng = get_test_engine();
+    memory::desc src_md({10, 16}, mdt::f32, tag::ab);
+    memory::desc indices_md({5}, mdt::s32, tag::a);
+    memory::desc offsets_md({2}, mdt::s32, tag::a);
+    memory::desc dst_md({2, 16}, mdt::f32, tag::ab);
+
+    // unsupported pooling
+    EXPECT_ANY_THROW(embedding_bag_t::pd_t(eng, algorithm::reduction_max,
+            src_md, indices_md, offsets_md, dst_md));
+    // 3D table
+    memory::desc src_3d_md({10, 16, 1}, mdt::f32, tag::abc);
+    EXPECT_ANY_THROW(embedding_bag_t::pd_t(eng, algorithm::reduction_sum,
+            src_3d_md, indices_md, offsets_md, dst_md));
+    // indices must be s32
+    memory::desc indices_f32_md({5}, mdt::f32, tag::a);
+    EXPECT_ANY_THROW(embedding_bag_t::pd_t(eng, algorithm::reduction_sum,
+            src_md, indices_f32_md, offsets_md, dst_md));
+    // destination width differs from the table
+    memory::desc dst_bad_md({2, 8}, mdt::f32, tag::ab);
+    EXPECT_ANY_THROW(embedding_bag_t::pd_t(eng, algorithm::reduction_sum,
+            src_md, indices_md, offsets_md, dst_bad_md));
+}
+
+} // namespace dnnl
@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "common/gated_mlp_iface.hpp"
+#include "tests/test_isa_common.hpp"
+
+#define DNNL_ARG_WEIGHTS_GATE DNNL_ARG_WEIGHTS_0
+#define DNNL_ARG_WEIGHTS_UP DNNL_ARG_WEIGHTS_1
+#define DNNL_ARG_WEIGHTS_DOWN DNNL_ARG_WEIGHTS_2
+
+// Validates the fused gated MLP CPU implementation against a naive reference.
+
+namespace dnnl {
+
+using dim = memory::dim;
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+namespace {
+
+// The fused implementation is expected to be dispatched on x64 with AVX2, so
+// an unimplemented status fails the test there instead of skipping it.
+bool brgemm_impl_expected() {
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+    return mayiuse(cpu_isa::avx2);
+#else
+    return false;
+#endif
+}
+
+std::vector<float> rand_vec(dim n, float range, unsigned seed) {
+    std::minstd_rand gen(seed);
+    std::uniform_real_distribution<float> dist(-range, range);
+    std::vector<float> v(n);
+    for (auto &x : v)
+        x = dist(gen);
+    return v;
+}
+
+double ref_activation(dnnl_alg_kind_t alg, double x) {
+    switch (alg) {
+        case dnnl_eltwise_swish: return x / (1. + std::exp(-x));
+        case dnnl_eltwise_gelu_erf:
+            return 0.5 * x * (1. + std::erf(x / std::sqrt(2.)));
+        case dnnl_eltwise_gelu_tanh: {
+            const double k = std::sqrt(2. / M_PI);
+            return 0.5 * x * (1. + std::tanh(k * (x + 0.044715 * x * x * x)));
+        }
+        default: return NAN;
+    }
+}
+
+} // namespace
+
+struct gated_mlp_cpu_params_t {
+    dim mb, ic, oc;
+    dnnl_alg_kind_t activation;
+};
+
+class gated_mlp_cpu_test_t
+    : public ::testing::TestWithParam<gated_mlp_cpu_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+                "Test requires host-allocated memory.");
+        Test();
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        auto eng = get_test_engine();
+        stream strm(eng);
+
+        const memory::desc src_md({p.mb, p.ic}, dt::f32, tag::ab);
+        const memory::desc wei_gu_md({p.ic, p.oc}, dt::f32, tag::ab);
+        const memory::desc wei_down_md({p.oc, p.ic}, dt::f32, tag::ab);
+        const memory::desc dst_md({p.mb, p.ic}, dt::f32, tag::ab);
+
+        // Weights are scaled down to keep the outputs close to 1
+        auto src = rand_vec(p.mb * p.ic, 1.f, 1);
+        auto wei_gate = rand_vec(p.ic * p.oc, 0.125f, 2);
+        auto wei_up = rand_vec(p.ic * p.oc, 0.125f, 3);
+        auto wei_down = rand_vec(p.oc * p.ic, 0.125f, 4);
+        std::vector<float> dst(p.mb * p.ic, 0.f);
+
+        dnnl_primitive_desc_t c_pd = nullptr;
+        const dnnl_status_t st = dnnl_gated_mlp_primitive_desc_create(&c_pd,
+                eng.get(), src_md.get(), wei_gu_md.get(), wei_gu_md.get(),
+                wei_down_md.get(), dst_md.get(), p.activation, nullptr);
+        if (st == dnnl_unimplemented && !brgemm_impl_expected())
+            GTEST_SKIP() << "Unimplemented";
+        ASSERT_EQ(st, dnnl_success);
+        primitive_desc pd(c_pd);
+
+        primitive(pd).execute(strm,
+                {{DNNL_ARG_SRC, memory(src_md, eng, src.data())},
+                        {DNNL_ARG_WEIGHTS_GATE,
+                                memory(wei_gu_md, eng, wei_gate.data())},
+                        {DNNL_ARG_WEIGHTS_UP,
+                                memory(wei_gu_md, eng, wei_up.data())},
+                        {DNNL_ARG_WEIGHTS_DOWN,
+                                memory(wei_down_md, eng, wei_down.data())},
+                        {DNNL_ARG_DST, memory(dst_md, eng, dst.data())}});
+        strm.wait();
+
+        // dst = (act(src * W_gate) * (src * W_up)) * W_down
+        std::vector<double> h(p.oc);
+        for (dim m = 0; m < p.mb; m++) {
+            for (dim o = 0; o < p.oc; o++) {
+                double g = 0, u = 0;
+                for (dim c = 0; c < p.ic; c++) {
+                    g += double(src[m * p.ic + c]) * wei_gate[c * p.oc + o];
+                    u += double(src[m * p.ic + c]) * wei_up[c * p.oc + o];
+                }
+                h[o] = ref_activation(p.activation, g) * u;
+            }
+            for (dim c = 0; c < p.ic; c++) {
+                double ref = 0;
+                for (dim o = 0; o < p.oc; o++)
+                    ref += h[o] * wei_down[o * p.ic + c];
+                const double eps = 1e-4 * (1. + std::fabs(ref));
+                ASSERT_NEAR(dst[m * p.ic + c], ref, eps)
+                        << "at mb " << m << " ic " << c;
+            }
+        }
+    }
+};
+
+TEST_P(gated_mlp_cpu_test_t, TestsGatedMlpCpu) {}
+
+// A single row splits the OC dimension across the threads, and sizes that
+// are not multiples of the blocks (32 rows and 64 OC) exercise the tails.
+INSTANTIATE_TEST_SUITE_P(TestGatedMlpCpu, gated_mlp_cpu_test_t,
+        ::testing::Values(
+                gated_mlp_cpu_params_t {1, 64, 256, dnnl_eltwise_swish},
+                gated_mlp_cpu_params_t {3, 96, 200, dnnl_eltwise_swish},
+                gated_mlp_cpu_params_t {40, 64, 130, dnnl_eltwise_swish},
+                gated_mlp_cpu_params_t {64, 128, 128, dnnl_eltwise_gelu_erf},
+                gated_mlp_cpu_params_t {70, 48, 100, dnnl_eltwise_gelu_tanh}));
+
+} // namespace dnnl
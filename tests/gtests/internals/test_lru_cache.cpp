@@ -0,0 +1,231 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "common/cache_utils.hpp"
+
+namespace dnnl {
+
+namespace {
+
+std::atomic<int> n_hashes(0);
+std::atomic<int> n_creations(0);
+
+struct test_key_t {
+    test_key_t(int id) : id_(id), thread_id_(std::this_thread::get_id()) {}
+
+    bool operator==(const test_key_t &other) const {
+        return id_ == other.id_;
+    }
+    const std::thread::id &thread_id() const { return thread_id_; }
+    bool has_runtime_dependencies() const { return false; }
+
+    int id_;
+
+private:
+    std::thread::id thread_id_;
+};
+
+} // namespace
+} // namespace dnnl
+
+namespace std {
+template <>
+struct hash<dnnl::test_key_t> {
+    size_t operator()(const dnnl::test_key_t &key) const {
+        dnnl::n_hashes++;
+        return static_cast<size_t>(key.id_);
+    }
+};
+} // namespace std
+
+namespace dnnl {
+
+namespace {
+
+using impl::status_t;
+
+struct test_result_t {
+    test_result_t() = default;
+    test_result_t(std::shared_ptr<int> value, status_t status)
+        : value(std::move(value)), status(status) {}
+    bool is_empty() const { return value == nullptr; }
+    const int &get_value() const { return *value; }
+
+    std::shared_ptr<int> value;
+    status_t status = impl::status::success;
+};
+
+using test_cache_t = impl::utils::lru_cache_t<test_key_t, int, test_result_t>;
+
+// The value of the key `id` is `10 * id`
+test_result_t create(void *context) {
+    n_creations++;
+    const int id = *static_cast<const int *>(context);
+    return {std::make_shared<int>(10 * id), impl::status::success};
+}
+
+int get_or_create(test_cache_t &cache, int id) {
+    test_result_t r = cache.get_or_create(test_key_t(id), create, &id, false);
+    return r.is_empty() ? -1 : r.get_value();
+}
+
+bool is_cached(test_cache_t &cache, int id) {
+    return !cache.get(test_key_t(id)).is_empty();
+}
+
+// Runs `f(ithr)` on `nthr` threads
+template <typename F>
+void run_threads(int nthr, const F &f) {
+    std::vector<std::thread> threads;
+    for (int ithr = 0; ithr < nthr; ithr++)
+        threads.emplace_back(f, ithr);
+    for (auto &t : threads)
+        t.join();
+}
+
+constexpr int n_threads = 8;
+
+} // namespace
+
+// The consecutive ids map to different shards
+TEST(lru_cache_test_t, ConcurrentGetOrCreate) {
+    const int n_keys = 100;
+    test_cache_t cache(1024);
+    n_creations = 0;
+
+    std::atomic<int> n_errors(0);
+    run_threads(n_threads, [&](int ithr) {
+        for (int i = 0; i < n_keys; i++) {
+            const int id = (i + ithr * 7) % n_keys;
+            if (get_or_create(cache, id) != 10 * id) n_errors++;
+        }
+    });
+    ASSERT_EQ(n_errors.load(), 0);
+    // Each object is created once, the other threads wait for it
+    ASSERT_EQ(n_creations.load(), n_keys);
+    ASSERT_EQ(cache.get_size(), n_keys);
+
+    run_threads(n_threads, [&](int) {
+        for (int id = 0; id < n_keys; id++) {
+            test_result_t r = cache.get(test_key_t(id));
+            if (r.is_empty() || r.get_value() != 10 * id) n_errors++;
+        }
+    });
+    ASSERT_EQ(n_errors.load(), 0);
+    ASSERT_EQ(n_creations.load(), n_keys);
+    ASSERT_TRUE(cache.get(test_key_t(n_keys)).is_empty());
+}
+
+TEST(lru_cache_test_t, ConcurrentEviction) {
+    const int capacity = 20;
+    const int n_keys = 200;
+    test_cache_t cache(capacity);
+
+    std::atomic<int> n_errors(0);
+    run_threads(n_threads, [&](int ithr) {
+        for (int i = 0; i < n_keys; i++) {
+            const int id = (i * (ithr + 1)) % n_keys;
+            if (get_or_create(cache, id) != 10 * id) n_errors++;
+            if (cache.get_size() > capacity) n_errors++;
+        }
+    });
+    ASSERT_EQ(n_errors.load(), 0);
+    ASSERT_EQ(cache.get_size(), capacity);
+
+    int n_cached = 0;
+    for (int id = 0; id < n_keys; id++)
+        n_cached += is_cached(cache, id);
+    ASSERT_EQ(n_cached, capacity);
+}
+
+// The least recently used entry is evicted whichever shard it is in
+TEST(lru_cache_test_t, EvictsLeastRecentlyUsed) {
+    const int capacity = 16;
+    test_cache_t cache(capacity);
+    for (int id = 0; id < capacity; id++)
+        get_or_create(cache, id);
+
+    // Key 0 becomes the most recently used one, so key 1 is evicted first
+    ASSERT_TRUE(is_cached(cache, 0));
+    get_or_create(cache, capacity);
+    ASSERT_EQ(cache.get_size(), capacity);
+    ASSERT_TRUE(is_cached(cache, 0));
+    ASSERT_FALSE(is_cached(cache, 1));
+    get_or_create(cache, capacity + 1);
+    ASSERT_FALSE(is_cached(cache, 2));
+    ASSERT_TRUE(is_cached(cache, capacity));
+}
+
+TEST(lru_cache_test_t, ShrinkCapacity) {
+    const int n_keys = 64;
+    test_cache_t cache(n_keys);
+    for (int id = 0; id < n_keys; id++)
+        get_or_create(cache, id);
+
+    // The most recently used entries are kept
+    cache.set_capacity(8);
+    ASSERT_EQ(cache.get_capacity(), 8);
+    ASSERT_EQ(cache.get_size(), 8);
+    for (int id = 0; id < n_keys; id++)
+        ASSERT_EQ(is_cached(cache, id), id >= n_keys - 8) << "at " << id;
+
+    // Shrink while the other threads add entries
+    cache.set_capacity(n_keys);
+    std::atomic<int> n_errors(0);
+    run_threads(n_threads, [&](int ithr) {
+        for (int i = 0; i < n_keys; i++) {
+            const int id = (i + ithr * 3) % n_keys;
+            if (ithr == 0 && i == n_keys / 2) cache.set_capacity(4);
+            const int value = get_or_create(cache, id);
+            if (value != 10 * id) n_errors++;
+        }
+    });
+    ASSERT_EQ(n_errors.load(), 0);
+    ASSERT_LE(cache.get_size(), 4);
+
+    // A capacity of 0 disables the cache
+    cache.set_capacity(0);
+    ASSERT_EQ(cache.get_size(), 0);
+    ASSERT_EQ(get_or_create(cache, 1), 10);
+    ASSERT_EQ(cache.get_size(), 0);
+    ASSERT_FALSE(is_cached(cache, 1));
+}
+
+// A lookup computes the hash of the key once for both the shard and the
+// bucket in the shard
+TEST(lru_cache_test_t, HashesKeyOnce) {
+    test_cache_t cache(16);
+    get_or_create(cache, 3);
+
+    n_hashes = 0;
+    ASSERT_TRUE(is_cached(cache, 3));
+    ASSERT_EQ(n_hashes.load(), 1);
+
+    n_hashes = 0;
+    ASSERT_EQ(get_or_create(cache, 3), 30);
+    ASSERT_EQ(n_hashes.load(), 1);
+}
+
+} // namespace dnnl
@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "common/nthr_tuner.hpp"
+
+namespace dnnl {
+
+using impl::nthr_tuner_t;
+
+// Runs the tuning with executions taking `ms(nthr)` and returns the selected
+// number of threads.
+template <typename F>
+int tune(nthr_tuner_t &tuner, int max_nthr, const F &ms) {
+    for (int i = 0; i < 16; i++) {
+        const int nthr = tuner.get_nthr(max_nthr);
+        if (tuner.record(nthr, ms(nthr))) break;
+    }
+    return tuner.get_nthr(max_nthr);
+}
+
+TEST(test_nthr_tuner, SelectsFastestCandidate) {
+    nthr_tuner_t tuner;
+    ASSERT_TRUE(tuner.is_new(16));
+    // The fastest on 4 threads
+    const int nthr = tune(tuner, 16, [](int n) { return n == 4 ? 0.1 : 0.2; });
+    ASSERT_EQ(nthr, 4);
+    ASSERT_FALSE(tuner.is_new(16));
+}
+
+TEST(test_nthr_tuner, KeepsAllThreadsForLongExecutions) {
+    nthr_tuner_t tuner;
+    const int nthr = tune(tuner, 8,
+            [](int n) { return 2 * nthr_tuner_t::max_tuned_ms / n; });
+    ASSERT_EQ(nthr, 8);
+}
+
+TEST(test_nthr_tuner, RestartsOnMaxThreadsChange) {
+    nthr_tuner_t tuner;
+    ASSERT_EQ(tune(tuner, 16, [](int n) { return n == 2 ? 0.1 : 0.5; }), 2);
+    ASSERT_TRUE(tuner.is_new(4));
+    ASSERT_EQ(tune(tuner, 4, [](int n) { return n == 1 ? 0.1 : 0.5; }), 1);
+}
+
+TEST(test_nthr_tuner, SetNthr) {
+    nthr_tuner_t tuner;
+    tuner.set_nthr(16, 32);
+    ASSERT_FALSE(tuner.is_new(16));
+    ASSERT_EQ(tuner.get_nthr(16), 16);
+    tuner.set_nthr(16, 3);
+    ASSERT_EQ(tuner.get_nthr(16), 3);
+    ASSERT_FALSE(tuner.record(3, 0.1));
+}
+
+} // namespace dnnl
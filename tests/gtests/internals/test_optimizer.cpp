@@ -0,0 +1,217 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "common/optimizer_iface.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using mdt = memory::data_type;
+
+/// Optimizer step internal primitive.
+struct optimizer_t : public dnnl::primitive {
+    /// Primitive descriptor for an optimizer step primitive.
+    struct pd_t : public dnnl::primitive_desc {
+        pd_t() = default;
+
+        pd_t(const engine &aengine, dnnl_optimizer_alg_t alg,
+                const std::vector<memory::desc> &param_descs, mdt grad_dt,
+                mdt param_copy_dt, float beta1, float beta2, float epsilon,
+                float weight_decay,
+                const primitive_attr &attr = default_attr()) {
+            std::vector<const_dnnl_memory_desc_t> c_descs;
+            for (const auto &md : param_descs)
+                c_descs.push_back(md.get());
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_optimizer_primitive_desc_create(&pd,
+                    aengine.get(), alg, (int)c_descs.size(), c_descs.data(),
+                    memory::convert_to_c(grad_dt),
+                    memory::convert_to_c(param_copy_dt), beta1, beta2, epsilon,
+                    weight_decay, attr.get());
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for an "
+                    "optimizer primitive");
+            reset(pd);
+        }
+    };
+
+    optimizer_t() = default;
+    optimizer_t(const pd_t &pd) : primitive(pd) {}
+};
+
+struct optimizer_params_t {
+    dnnl_optimizer_alg_t alg;
+    std::vector<memory::dims> shapes;
+    mdt param_copy_dt;
+};
+
+class optimizer_test_t : public ::testing::TestWithParam<optimizer_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Optimizer step is only implemented on CPU.");
+        p = GetParam();
+    }
+
+    void Test() {
+        const engine eng = get_test_engine();
+        stream strm(eng);
+        const float beta1 = 0.9f, beta2 = 0.999f, eps = 1e-8f, wd = 0.01f;
+        const bool with_v = p.alg != dnnl_optimizer_sgd_momentum;
+        const bool with_copy = p.param_copy_dt != mdt::undef;
+        const int n = (int)p.shapes.size();
+
+        std::vector<memory::desc> param_mds;
+        for (const auto &dims : p.shapes)
+            param_mds.emplace_back(dims, mdt::f32,
+                    dims.size() == 1 ? tag::a : tag::ab);
+        optimizer_t::pd_t pd(eng, p.alg, param_mds, mdt::f32, p.param_copy_dt,
+                beta1, beta2, eps, wd);
+        optimizer_t prim(pd);
+
+        memory hyper_mem = test::make_memory(
+                memory::desc({2}, mdt::f32, tag::a), eng);
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, hyper_mem}};
+        std::vector<std::vector<float>> params(n), grads(n), ms(n), vs(n);
+        for (int i = 0; i < n; i++) {
+            const auto nelems = param_mds[i].get_size() / sizeof(float);
+            for (size_t e = 0; e < nelems; e++) {
+                params[i].push_back(0.5f - 0.01f * ((e * 13 + i) % 97));
+                grads[i].push_back(0.02f * ((e * 7 + i) % 31) - 0.3f);
+            }
+            ms[i].assign(nelems, 0.f);
+            vs[i].assign(nelems, 0.f);
+
+            auto make = [&](const memory::desc &md,
+                                const std::vector<float> &vals) {
+                auto mem = test::make_memory(md, eng);
+                auto ptr = map_memory<float>(mem);
+                for (size_t e = 0; e < vals.size(); e++)
+                    ptr[e] = vals[e];
+                return mem;
+            };
+            args[DNNL_ARG_MULTIPLE_SRC + i] = make(param_mds[i], grads[i]);
+            args[DNNL_ARG_MULTIPLE_DST + 4 * i] = make(param_mds[i], params[i]);
+            args[DNNL_ARG_MULTIPLE_DST + 4 * i + 1] = make(param_mds[i], ms[i]);
+            if (with_v)
+                args[DNNL_ARG_MULTIPLE_DST + 4 * i + 2]
+                        = make(param_mds[i], vs[i]);
+            if (with_copy)
+                args[DNNL_ARG_MULTIPLE_DST + 4 * i + 3] = test::make_memory(
+                        pd.query_md(query::dst_md, 4 * i + 3), eng);
+        }
+
+        const float lr = 0.1f;
+        for (int step = 1; step <= 2; step++) {
+            {
+                auto h = map_memory<float>(hyper_mem);
+                h[0] = lr;
+                h[1] = (float)step;
+            }
+            prim.execute(strm, args);
+            strm.wait();
+
+            const float bc1 = 1.f - std::pow(beta1, (float)step);
+            const float bc2 = 1.f - std::pow(beta2, (float)step);
+            for (int i = 0; i < n; i++) {
+                for (size_t e = 0; e < params[i].size(); e++) {
+                    float &w = params[i][e];
+                    float &m = ms[i][e];
+                    float &v = vs[i][e];
+                    float g = grads[i][e];
+                    if (p.alg == dnnl_optimizer_sgd_momentum) {
+                        g += wd * w;
+                        m = beta1 * m + g;
+                        w -= lr * m;
+                        continue;
+                    }
+                    if (p.alg == dnnl_optimizer_adamw)
+                        w -= lr * wd * w;
+                    else
+                        g += wd * w;
+                    m = beta1 * m + (1.f - beta1) * g;
+                    v = beta2 * v + (1.f - beta2) * g * g;
+                    w -= lr * (m / bc1) / (std::sqrt(v / bc2) + eps);
+                }
+            }
+        }
+
+        for (int i = 0; i < n; i++) {
+            auto w = map_memory<float>(args[DNNL_ARG_MULTIPLE_DST + 4 * i]);
+            auto m = map_memory<float>(
+                    args[DNNL_ARG_MULTIPLE_DST + 4 * i + 1]);
+            for (size_t e = 0; e < params[i].size(); e++) {
+                ASSERT_NEAR(w[e], params[i][e], 1e-5f)
+                        << "tensor " << i << " element " << e;
+                ASSERT_NEAR(m[e], ms[i][e], 1e-5f)
+                        << "tensor " << i << " element " << e;
+            }
+            if (!with_copy) continue;
+            // The copy is the rounded parameter.
+            auto copy_mem = args[DNNL_ARG_MULTIPLE_DST + 4 * i + 3];
+            memory copy_f32_mem = test::make_memory(param_mds[i], eng);
+            reorder(copy_mem, copy_f32_mem)
+                    .execute(strm, copy_mem, copy_f32_mem);
+            strm.wait();
+            auto c = map_memory<float>(copy_f32_mem);
+            for (size_t e = 0; e < params[i].size(); e++)
+                ASSERT_NEAR(c[e], params[i][e], 1e-2f * std::fabs(w[e]) + 1e-5f)
+                        << "tensor " << i << " element " << e;
+        }
+    }
+
+    optimizer_params_t p;
+};
+
+TEST_P(optimizer_test_t, TestsOptimizer) {
+    Test();
+}
+
+INSTANTIATE_TEST_SUITE_P(Optimizers, optimizer_test_t,
+        ::testing::Values(
+                optimizer_params_t {dnnl_optimizer_sgd_momentum,
+                        {{7}, {64, 100}}, mdt::undef},
+                optimizer_params_t {dnnl_optimizer_adam, {{3, 5}}, mdt::undef},
+                // many small tensors and one spanning several blocks
+                optimizer_params_t {dnnl_optimizer_adamw,
+                        {{1}, {2}, {33}, {5000}, {16, 16}}, mdt::bf16}));
+
+TEST(optimizer_iface_test_t, TestInvalidArguments) {
+    const engine eng = get_test_engine();
+    const std::vector<memory::desc> f32_mds = {{{8}, mdt::f32, tag::a}};
+    const std::vector<memory::desc> bf16_mds = {{{8}, mdt::bf16, tag::a}};
+
+    // parameters are f32
+    EXPECT_ANY_THROW(optimizer_t::pd_t(eng, dnnl_optimizer_adamw, bf16_mds,
+            mdt::f32, mdt::undef, 0.9f, 0.999f, 1e-8f, 0.f));
+    // moments decay rates are below 1
+    EXPECT_ANY_THROW(optimizer_t::pd_t(eng, dnnl_optimizer_adam, f32_mds,
+            mdt::f32, mdt::undef, 1.f, 0.999f, 1e-8f, 0.f));
+    // no tensors
+    EXPECT_ANY_THROW(optimizer_t::pd_t(eng, dnnl_optimizer_adam, {},
+            mdt::f32, mdt::undef, 0.9f, 0.999f, 1e-8f, 0.f));
+}
+
+} // namespace dnnl
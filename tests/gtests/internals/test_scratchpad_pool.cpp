@@ -0,0 +1,180 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "stdlib.h"
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "common/scratchpad.hpp"
+
+// The budget of the scratchpad pool is read once, so this test runs in its
+// own executable.
+
+namespace {
+
+void custom_setenv(const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    auto status = SetEnvironmentVariable(name, value);
+    EXPECT_NE(status, 0);
+#else
+    auto status = ::setenv(name, value, overwrite);
+    EXPECT_EQ(status, 0);
+#endif
+}
+
+} // namespace
+
+namespace dnnl {
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+
+using impl::scratchpad_pool_t;
+
+// The primitives that would use the global scratchpad lease a buffer of the
+// pool for each execution, which lets them run from several threads.
+TEST(scratchpad_pool_test_t, ConcurrentExecutions) {
+    custom_setenv("ONEDNN_SCRATCHPAD_POOL_LIMIT", "16", 1);
+    ASSERT_EQ(scratchpad_pool_t::default_budget(), size_t(16) << 20);
+
+    engine eng(engine::kind::cpu, 0);
+    SKIP_IF(!impl::use_scratchpad_pool(eng.get()),
+            "The scratchpad pool is not used by this build.");
+
+    using tag = memory::format_tag;
+    const memory::data_type f32 = memory::data_type::f32;
+    // Two shapes booking scratchpads of different sizes
+    const memory::dim ihs[] = {19, 35};
+    const int n_shapes = 2;
+    std::vector<convolution_forward> convs;
+    std::vector<memory::desc> src_mds, dst_mds;
+    memory::desc wei_md({16, 8, 3, 3}, f32, tag::oihw);
+    for (int s = 0; s < n_shapes; s++) {
+        const memory::dim ih = ihs[s];
+        src_mds.emplace_back(memory::dims {2, 8, ih, ih}, f32, tag::nchw);
+        dst_mds.emplace_back(
+                memory::dims {2, 16, ih - 2, ih - 2}, f32, tag::nchw);
+        auto pd = convolution_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_mds[s], wei_md, dst_mds[s], {1, 1}, {0, 0}, {0, 0});
+        convs.emplace_back(pd);
+    }
+
+    memory wei(wei_md, eng);
+    fill_data<float>(wei_md.get_size() / sizeof(float), wei);
+    std::vector<memory> src, dst_ref;
+    stream s_ref(eng);
+    for (int s = 0; s < n_shapes; s++) {
+        src.emplace_back(src_mds[s], eng);
+        fill_data<float>(src_mds[s].get_size() / sizeof(float), src.back());
+        dst_ref.emplace_back(dst_mds[s], eng);
+        convs[s].execute(s_ref,
+                {{DNNL_ARG_SRC, src[s]}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst_ref[s]}});
+    }
+    s_ref.wait();
+
+    const int nthr = 8, n_iters = 10;
+    std::vector<std::vector<memory>> dst(nthr);
+    for (int ithr = 0; ithr < nthr; ithr++)
+        for (int s = 0; s < n_shapes; s++)
+            dst[ithr].emplace_back(dst_mds[s], eng);
+
+    std::atomic<int> n_errors(0);
+    std::vector<std::thread> threads;
+    for (int ithr = 0; ithr < nthr; ithr++)
+        threads.emplace_back([&, ithr]() {
+            try {
+                stream strm(eng);
+                for (int i = 0; i < n_iters; i++) {
+                    const int s = (ithr + i) % n_shapes;
+                    convs[s].execute(strm,
+                            {{DNNL_ARG_SRC, src[s]}, {DNNL_ARG_WEIGHTS, wei},
+                                    {DNNL_ARG_DST, dst[ithr][s]}});
+                    strm.wait();
+                }
+            } catch (error &) { n_errors++; }
+        });
+    for (auto &t : threads)
+        t.join();
+    ASSERT_EQ(n_errors.load(), 0);
+
+    for (int ithr = 0; ithr < nthr; ithr++)
+        for (int s = 0; s < n_shapes; s++)
+            compare_data<float>(dst_ref[s], dst[ithr][s]);
+}
+
+// The buffers returned over the budget are released
+TEST(scratchpad_pool_test_t, EvictionOverBudget) {
+    const size_t kb = 1024;
+    scratchpad_pool_t pool(nullptr, 128 * kb);
+
+    // The sizes are rounded up to a power of two, 64 KB at least
+    size_t class_a = 0, class_b = 0, class_c = 0;
+    auto *a = pool.acquire(100 * kb, class_a);
+    auto *b = pool.acquire(10 * kb, class_b);
+    auto *c = pool.acquire(64 * kb, class_c);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    ASSERT_NE(c, nullptr);
+    ASSERT_EQ(class_a, 128 * kb);
+    ASSERT_EQ(class_b, 64 * kb);
+    ASSERT_EQ(class_c, 64 * kb);
+
+    pool.release(a, class_a);
+    ASSERT_EQ(pool.idle_bytes(), 128 * kb);
+    // Keeping b or c would exceed the budget
+    pool.release(b, class_b);
+    pool.release(c, class_c);
+    ASSERT_EQ(pool.idle_bytes(), 128 * kb);
+
+    // A lease of the same class reuses the idle buffer
+    size_t class_d = 0;
+    auto *d = pool.acquire(120 * kb, class_d);
+    ASSERT_EQ(d, a);
+    ASSERT_EQ(pool.idle_bytes(), 0u);
+
+    // A buffer larger than the budget is never kept
+    size_t class_e = 0;
+    auto *e = pool.acquire(200 * kb, class_e);
+    ASSERT_EQ(class_e, 256 * kb);
+    pool.release(e, class_e);
+    ASSERT_EQ(pool.idle_bytes(), 0u);
+
+    // The idle buffers are released after a while
+    pool.release(d, class_d);
+    ASSERT_EQ(pool.idle_bytes(), 128 * kb);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2100));
+    size_t class_f = 0;
+    auto *f = pool.acquire(10 * kb, class_f);
+    ASSERT_EQ(pool.idle_bytes(), 0u);
+    pool.release(f, class_f);
+}
+
+#endif
+
+} // namespace dnnl
@@ -0,0 +1,999 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "sdpa_internal.hpp"
+#include "tests/test_isa_common.hpp"
+
+// Validates the fused SDPA CPU implementation against a naive reference.
+
+namespace dnnl {
+
+using dim = memory::dim;
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+namespace {
+
+struct sdpa_cpu_shape_t {
+    dim mb, heads, kv_heads, queries, keys, head_size, values;
+};
+
+enum class mask_kind_t { none, buffer, bcast, causal_tl, causal_br };
+
+using acc4_t = std::function<float(dim, dim, dim, dim)>;
+
+const impl::prop_kind_t fwd_inference = impl::prop_kind::forward_inference;
+const impl::prop_kind_t fwd_training = impl::prop_kind::forward_training;
+
+// The fused implementation is expected to be dispatched on x64 with AVX2, so
+// an unimplemented status fails the test there instead of skipping it.
+bool brgemm_impl_expected() {
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+    return mayiuse(cpu_isa::avx2);
+#else
+    return false;
+#endif
+}
+
+dim nelems(const memory::dims &dims) {
+    dim n = 1;
+    for (auto d : dims)
+        n *= d;
+    return n;
+}
+
+// Offset of a logical element of a plain 4D tensor in the abcd or abdc format
+dim off4(const memory::dims &dims, tag t, dim d0, dim d1, dim d2, dim d3) {
+    const dim base = (d0 * dims[1] + d1) * dims[2] * dims[3];
+    return t == tag::abdc ? base + d3 * dims[2] + d2
+                          : base + d2 * dims[3] + d3;
+}
+
+std::vector<float> rand_vec(dim n, unsigned seed) {
+    std::minstd_rand gen(seed);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<float> v(n);
+    for (auto &x : v)
+        x = dist(gen);
+    return v;
+}
+
+int to_attn_mask_type(mask_kind_t m) {
+    switch (m) {
+        case mask_kind_t::causal_tl: return impl::attn_mask_type::top_left;
+        case mask_kind_t::causal_br: return impl::attn_mask_type::bottom_right;
+        case mask_kind_t::none: return impl::attn_mask_type::undef;
+        default: return impl::attn_mask_type::buffer;
+    }
+}
+
+// Softmax probabilities of the scores of query i of head h. With a causal
+// mask key j is visible iff j <= i for the top left diagonal and iff
+// j <= i + keys - queries for the bottom right one.
+void ref_probs(const sdpa_cpu_shape_t &s, const acc4_t &q, const acc4_t &k,
+        const acc4_t &mask, mask_kind_t mask_kind, float scale, dim b, dim h,
+        dim i, std::vector<double> &p) {
+    const dim kh = h / (s.heads / s.kv_heads);
+    const dim diag = mask_kind == mask_kind_t::causal_br ? s.keys - s.queries
+                                                         : 0;
+    const bool causal = mask_kind == mask_kind_t::causal_tl
+            || mask_kind == mask_kind_t::causal_br;
+    const double neg_inf = -std::numeric_limits<double>::infinity();
+
+    p.assign(s.keys, neg_inf);
+    double max = neg_inf;
+    for (dim j = 0; j < s.keys; j++) {
+        if (causal && j > i + diag) continue;
+        double acc = 0;
+        for (dim d = 0; d < s.head_size; d++)
+            acc += double(q(b, h, i, d)) * k(b, kh, d, j);
+        acc *= scale;
+        if (mask) acc += mask(b, h, i, j);
+        p[j] = acc;
+        max = std::max(max, acc);
+    }
+    double sum = 0;
+    for (auto &x : p) {
+        x = x == neg_inf ? 0 : std::exp(x - max);
+        sum += x;
+    }
+    for (auto &x : p)
+        x /= sum;
+}
+
+// Reference attention in double precision; dst is dense [mb][heads][queries]
+// [values].
+void ref_sdpa_fwd(const sdpa_cpu_shape_t &s, const acc4_t &q, const acc4_t &k,
+        const acc4_t &v, const acc4_t &mask, mask_kind_t mask_kind,
+        float scale, std::vector<float> &dst) {
+    dst.assign(s.mb * s.heads * s.queries * s.values, 0.f);
+    std::vector<double> p;
+    for (dim b = 0; b < s.mb; b++)
+        for (dim h = 0; h < s.heads; h++) {
+            const dim kh = h / (s.heads / s.kv_heads);
+            for (dim i = 0; i < s.queries; i++) {
+                ref_probs(s, q, k, mask, mask_kind, scale, b, h, i, p);
+                for (dim c = 0; c < s.values; c++) {
+                    double acc = 0;
+                    for (dim j = 0; j < s.keys; j++)
+                        acc += p[j] * v(b, kh, j, c);
+                    dst[((b * s.heads + h) * s.queries + i) * s.values + c]
+                            = float(acc);
+                }
+            }
+        }
+}
+
+// Reference gradients of ref_sdpa_fwd() for the output gradient dd. The
+// gradients are dense in the logical order of their tensors, and ds is the
+// gradient of the scaled scores:
+//   dS = P * (dO * V^T - rowsum(dO * O)) * scale
+void ref_sdpa_bwd(const sdpa_cpu_shape_t &s, const acc4_t &q, const acc4_t &k,
+        const acc4_t &v, const acc4_t &mask, mask_kind_t mask_kind,
+        float scale, const acc4_t &dd, std::vector<float> &dq,
+        std::vector<float> &dk, std::vector<float> &dv,
+        std::vector<float> &ds) {
+    std::vector<double> dq_acc(s.mb * s.heads * s.queries * s.head_size, 0.);
+    std::vector<double> dk_acc(s.mb * s.kv_heads * s.head_size * s.keys, 0.);
+    std::vector<double> dv_acc(s.mb * s.kv_heads * s.keys * s.values, 0.);
+    ds.assign(s.mb * s.heads * s.queries * s.keys, 0.f);
+    std::vector<double> p, dp(s.keys);
+    for (dim b = 0; b < s.mb; b++)
+        for (dim h = 0; h < s.heads; h++) {
+            const dim kh = h / (s.heads / s.kv_heads);
+            for (dim i = 0; i < s.queries; i++) {
+                ref_probs(s, q, k, mask, mask_kind, scale, b, h, i, p);
+                double rowsum = 0;
+                for (dim j = 0; j < s.keys; j++) {
+                    dp[j] = 0;
+                    for (dim c = 0; c < s.values; c++)
+                        dp[j] += double(dd(b, h, i, c)) * v(b, kh, j, c);
+                    rowsum += p[j] * dp[j];
+                }
+                const dim qi = (b * s.heads + h) * s.queries + i;
+                for (dim j = 0; j < s.keys; j++) {
+                    const double dsv = p[j] * (dp[j] - rowsum) * scale;
+                    ds[qi * s.keys + j] = float(dsv);
+                    const dim kj = (b * s.kv_heads + kh) * s.head_size;
+                    for (dim d = 0; d < s.head_size; d++) {
+                        dq_acc[qi * s.head_size + d] += dsv * k(b, kh, d, j);
+                        dk_acc[(kj + d) * s.keys + j] += dsv * q(b, h, i, d);
+                    }
+                    const dim vj = (b * s.kv_heads + kh) * s.keys + j;
+                    for (dim c = 0; c < s.values; c++)
+                        dv_acc[vj * s.values + c] += p[j] * dd(b, h, i, c);
+                }
+            }
+        }
+    dq.assign(dq_acc.begin(), dq_acc.end());
+    dk.assign(dk_acc.begin(), dk_acc.end());
+    dv.assign(dv_acc.begin(), dv_acc.end());
+}
+
+void check_near(const std::vector<float> &res, const std::vector<float> &ref,
+        float eps) {
+    ASSERT_EQ(res.size(), ref.size());
+    for (size_t i = 0; i < ref.size(); i++)
+        ASSERT_NEAR(res[i], ref[i], eps * (1.f + std::fabs(ref[i])))
+                << "at index " << i;
+}
+
+// Quantization of keys or values: the scales and zero-points share the mask
+// and the groups along the two innermost dimensions.
+struct kv_quant_t {
+    dt data_dt;
+    bool with_scales, with_zp;
+    int mask;
+    memory::dims groups;
+};
+
+// Index of the scale or zero-point of an element: they are dense over the
+// masked dimensions, the innermost ones divided by the groups.
+dim quant_idx(const memory::dims &dims, const kv_quant_t &qt, dim d0, dim d1,
+        dim d2, dim d3) {
+    const dim coord[4] = {d0, d1, d2, d3};
+    dim idx = 0;
+    for (int d = 0; d < 4; d++) {
+        if (!(qt.mask & (1 << d))) continue;
+        const dim g = d >= 2 && !qt.groups.empty() ? qt.groups[d - 2] : 1;
+        idx = idx * (dims[d] / g) + coord[d] / g;
+    }
+    return idx;
+}
+
+dim quant_nelems(const memory::dims &dims, const kv_quant_t &qt) {
+    return quant_idx(dims, qt, dims[0] - 1, dims[1] - 1, dims[2] - 1,
+                   dims[3] - 1)
+            + 1;
+}
+
+// Stores x, exactly representable in type t, as element i of a buffer
+void store_elem(std::vector<uint8_t> &buf, dt t, dim i, float x) {
+    switch (t) {
+        case dt::s8: buf[i] = uint8_t(int8_t(x)); break;
+        case dt::u8: buf[i] = uint8_t(x); break;
+        case dt::s4:
+        case dt::u4: {
+            const int shift = 4 * int(i % 2);
+            const uint8_t nibble = uint8_t(int(x) & 0xF);
+            buf[i / 2] = uint8_t((buf[i / 2] & ~(0xF << shift))
+                    | (nibble << shift));
+            break;
+        }
+        case dt::f16:
+            reinterpret_cast<impl::float16_t *>(buf.data())[i] = x;
+            break;
+        case dt::bf16:
+            reinterpret_cast<impl::bfloat16_t *>(buf.data())[i] = x;
+            break;
+        default: reinterpret_cast<float *>(buf.data())[i] = x;
+    }
+}
+
+size_t buf_size(dt t, dim n) {
+    if (t == dt::s4 || t == dt::u4) return size_t(n + 1) / 2;
+    return size_t(n) * memory::data_type_size(t);
+}
+
+// Quantized data of a tensor, its scales and zero-points, and the
+// dequantized values used by the reference
+struct kv_data_t {
+    std::vector<uint8_t> data;
+    std::vector<float> scales;
+    std::vector<int8_t> zps;
+    std::vector<float> deq;
+
+    kv_data_t(const memory::dims &dims, const kv_quant_t &qt, unsigned seed) {
+        const dim n = nelems(dims);
+        const auto r = rand_vec(n, seed);
+        const dim n_params = qt.with_scales || qt.with_zp
+                ? quant_nelems(dims, qt)
+                : 0;
+        const bool is_int = qt.data_dt == dt::s8 || qt.data_dt == dt::u8
+                || qt.data_dt == dt::s4 || qt.data_dt == dt::u4;
+        const bool is_unsigned = qt.data_dt == dt::u8 || qt.data_dt == dt::u4;
+        const int range = qt.data_dt == dt::s4 || qt.data_dt == dt::u4 ? 7 : 20;
+
+        scales.assign(qt.with_scales ? n_params : 0, 1.f);
+        for (size_t i = 0; i < scales.size(); i++)
+            scales[i] = (is_int ? 1.f / range : 1.f) * (0.5f + 0.25f * (i % 3));
+        zps.assign(qt.with_zp ? n_params : 0, 0);
+        for (size_t i = 0; i < zps.size(); i++)
+            zps[i] = int8_t((is_unsigned ? range : 0) + int(i % 5) - 2);
+
+        data.assign(buf_size(qt.data_dt, n), 0);
+        deq.resize(n);
+        for (dim d0 = 0; d0 < dims[0]; d0++)
+            for (dim d1 = 0; d1 < dims[1]; d1++)
+                for (dim d2 = 0; d2 < dims[2]; d2++)
+                    for (dim d3 = 0; d3 < dims[3]; d3++) {
+                        const dim i = off4(dims, tag::abcd, d0, d1, d2, d3);
+                        const dim pi = n_params
+                                ? quant_idx(dims, qt, d0, d1, d2, d3)
+                                : 0;
+                        // Integers are centered on the zero-point
+                        float x = r[i];
+                        if (is_int)
+                            x = std::round(x * range)
+                                    + (is_unsigned ? range : 0);
+                        else if (qt.data_dt == dt::f16)
+                            x = float(impl::float16_t(x));
+                        else if (qt.data_dt == dt::bf16)
+                            x = float(impl::bfloat16_t(x));
+                        store_elem(data, qt.data_dt, i, x);
+                        if (qt.with_zp) x -= zps[pi];
+                        if (qt.with_scales) x *= scales[pi];
+                        deq[i] = x;
+                    }
+    }
+};
+
+} // namespace
+
+struct sdpa_cpu_fwd_params_t {
+    sdpa_cpu_shape_t shape;
+    tag key_tag; // abcd for [head_size][keys], abdc for [keys][head_size]
+    mask_kind_t mask;
+    bool invert_scale;
+    impl::prop_kind_t prop;
+};
+
+class sdpa_cpu_fwd_test_t
+    : public ::testing::TestWithParam<sdpa_cpu_fwd_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+                "Test requires host-allocated memory.");
+        Test();
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        const auto &s = p.shape;
+        const bool with_mask = p.mask == mask_kind_t::buffer
+                || p.mask == mask_kind_t::bcast;
+
+        auto eng = get_test_engine();
+        stream strm(eng);
+
+        const memory::dims q_dims {s.mb, s.heads, s.queries, s.head_size};
+        const memory::dims k_dims {s.mb, s.kv_heads, s.head_size, s.keys};
+        const memory::dims v_dims {s.mb, s.kv_heads, s.keys, s.values};
+        const memory::dims dst_dims {s.mb, s.heads, s.queries, s.values};
+        const memory::dims msk_dims = p.mask == mask_kind_t::bcast
+                ? memory::dims {1, 1, s.queries, s.keys}
+                : memory::dims {s.mb, s.heads, s.queries, s.keys};
+
+        const memory::desc q_md(q_dims, dt::f32, tag::abcd);
+        const memory::desc k_md(k_dims, dt::f32, p.key_tag);
+        const memory::desc v_md(v_dims, dt::f32, tag::abcd);
+        const memory::desc dst_md(dst_dims, dt::f32, tag::abcd);
+        const memory::desc msk_md(msk_dims, dt::f32, tag::abcd);
+        const memory::desc scale_md({1, 1, 1, 1}, dt::f32, tag::abcd);
+
+        auto q = rand_vec(nelems(q_dims), 1);
+        auto k = rand_vec(nelems(k_dims), 2);
+        auto v = rand_vec(nelems(v_dims), 3);
+        auto msk = rand_vec(with_mask ? nelems(msk_dims) : 0, 4);
+        const float scale = 0.125f;
+        float scale_arg = p.invert_scale ? 1.f / scale : scale;
+        std::vector<float> dst(nelems(dst_dims), 0.f);
+
+        impl::sdpa::primitive_desc pd;
+        try {
+            pd = impl::sdpa::primitive_desc(eng, q_md, k_md, v_md,
+                    with_mask ? &msk_md : nullptr, scale_md, dst_md,
+                    p.invert_scale, s.kv_heads, to_attn_mask_type(p.mask),
+                    impl::alg_kind::softmax_accurate, p.prop);
+        } catch (error &e) {
+            if (e.status == dnnl_unimplemented && !brgemm_impl_expected())
+                GTEST_SKIP() << "Unimplemented: " << e.what();
+            throw;
+        }
+
+        std::unordered_map<int, memory> args {
+                {DNNL_ARG_QUERIES, memory(q_md, eng, q.data())},
+                {DNNL_ARG_KEYS, memory(k_md, eng, k.data())},
+                {DNNL_ARG_VALUES, memory(v_md, eng, v.data())},
+                {DNNL_ARG_SCALE, memory(scale_md, eng, &scale_arg)},
+                {DNNL_ARG_DST, memory(dst_md, eng, dst.data())}};
+        if (with_mask)
+            args[DNNL_ARG_ATTN_MASK] = memory(msk_md, eng, msk.data());
+        if (p.prop == fwd_training)
+            args[DNNL_ARG_WORKSPACE] = memory(pd.workspace_desc(), eng);
+        impl::sdpa(pd).execute(strm, args);
+        strm.wait();
+
+        const auto q_acc = [&](dim b, dim h, dim i, dim d) {
+            return q[off4(q_dims, tag::abcd, b, h, i, d)];
+        };
+        const auto k_acc = [&](dim b, dim h, dim d, dim j) {
+            return k[off4(k_dims, p.key_tag, b, h, d, j)];
+        };
+        const auto v_acc = [&](dim b, dim h, dim j, dim c) {
+            return v[off4(v_dims, tag::abcd, b, h, j, c)];
+        };
+        acc4_t msk_acc;
+        if (with_mask)
+            msk_acc = [&](dim b, dim h, dim i, dim j) {
+                return msk[off4(msk_dims, tag::abcd, msk_dims[0] == 1 ? 0 : b,
+                        msk_dims[1] == 1 ? 0 : h, i, j)];
+            };
+
+        std::vector<float> ref;
+        ref_sdpa_fwd(s, q_acc, k_acc, v_acc, msk_acc, p.mask, scale, ref);
+        check_near(dst, ref, 1e-4f);
+    }
+};
+
+TEST_P(sdpa_cpu_fwd_test_t, TestsSdpaCpuFwd) {}
+
+// Query and key counts are chosen not to be multiples of the blocks (32 and
+// 128) so that the tail kernels are exercised.
+INSTANTIATE_TEST_SUITE_P(TestSdpaCpuFwd, sdpa_cpu_fwd_test_t,
+        ::testing::Values(
+                sdpa_cpu_fwd_params_t {{2, 2, 2, 40, 200, 64, 64}, tag::abcd,
+                        mask_kind_t::none, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{2, 2, 2, 40, 200, 64, 64}, tag::abdc,
+                        mask_kind_t::none, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{1, 3, 3, 64, 256, 32, 48}, tag::abcd,
+                        mask_kind_t::buffer, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{2, 2, 2, 33, 130, 64, 64}, tag::abdc,
+                        mask_kind_t::bcast, true, fwd_inference},
+                sdpa_cpu_fwd_params_t {{1, 2, 2, 70, 70, 64, 64}, tag::abcd,
+                        mask_kind_t::causal_tl, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{1, 2, 2, 40, 200, 64, 64}, tag::abcd,
+                        mask_kind_t::causal_br, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{2, 4, 2, 40, 150, 64, 64}, tag::abcd,
+                        mask_kind_t::buffer, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{2, 2, 2, 40, 200, 64, 64}, tag::abcd,
+                        mask_kind_t::causal_br, false, fwd_training}));
+
+// With few query blocks the key blocks are split across the threads and the
+// partial results are reduced at the end.
+INSTANTIATE_TEST_SUITE_P(TestSdpaCpuFwdDecode, sdpa_cpu_fwd_test_t,
+        ::testing::Values(
+                sdpa_cpu_fwd_params_t {{1, 2, 2, 1, 1000, 64, 64}, tag::abcd,
+                        mask_kind_t::none, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{1, 1, 1, 1, 4097, 128, 128},
+                        tag::abdc, mask_kind_t::none, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{2, 2, 2, 3, 515, 64, 64}, tag::abcd,
+                        mask_kind_t::bcast, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{1, 2, 2, 1, 700, 64, 64}, tag::abcd,
+                        mask_kind_t::causal_br, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{1, 2, 2, 2, 900, 64, 64}, tag::abcd,
+                        mask_kind_t::none, false, fwd_training}));
+
+// The query heads sharing a kv head are stacked into the same products, with
+// fewer queries per block for larger groups.
+INSTANTIATE_TEST_SUITE_P(TestSdpaCpuFwdGqa, sdpa_cpu_fwd_test_t,
+        ::testing::Values(
+                sdpa_cpu_fwd_params_t {{2, 8, 2, 37, 200, 64, 64}, tag::abcd,
+                        mask_kind_t::none, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{1, 8, 1, 37, 150, 64, 64}, tag::abdc,
+                        mask_kind_t::buffer, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{1, 16, 1, 21, 130, 32, 32}, tag::abcd,
+                        mask_kind_t::causal_br, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{1, 8, 2, 40, 40, 64, 64}, tag::abcd,
+                        mask_kind_t::causal_tl, false, fwd_training},
+                sdpa_cpu_fwd_params_t {{1, 64, 1, 3, 100, 32, 32}, tag::abcd,
+                        mask_kind_t::bcast, false, fwd_inference},
+                sdpa_cpu_fwd_params_t {{2, 8, 1, 1, 1000, 64, 64}, tag::abcd,
+                        mask_kind_t::none, false, fwd_inference}));
+
+struct sdpa_cpu_paged_params_t {
+    sdpa_cpu_shape_t shape; // keys is the number of keys of every sequence
+    dim page_size;
+    std::vector<dim> seq_lens; // keys past the length of a sequence are masked
+};
+
+class sdpa_cpu_paged_test_t
+    : public ::testing::TestWithParam<sdpa_cpu_paged_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+                "Test requires host-allocated memory.");
+        Test();
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        const auto &s = p.shape;
+        const dim ps = p.page_size;
+        const dim pages_per_seq = s.keys / ps;
+        // The last page of the pools is left unused
+        const dim n_pages = s.mb * pages_per_seq + 1;
+
+        auto eng = get_test_engine();
+        stream strm(eng);
+
+        const memory::dims q_dims {s.mb, s.heads, s.queries, s.head_size};
+        const memory::dims k_dims {n_pages, s.kv_heads, s.head_size, ps};
+        const memory::dims v_dims {n_pages, s.kv_heads, ps, s.values};
+        const memory::dims pt_dims {s.mb, pages_per_seq};
+        const memory::dims dst_dims {s.mb, s.heads, s.queries, s.values};
+        const memory::dims msk_dims {s.mb, 1, 1, s.keys};
+
+        const memory::desc q_md(q_dims, dt::f32, tag::abcd);
+        const memory::desc k_md(k_dims, dt::f32, tag::abcd);
+        const memory::desc v_md(v_dims, dt::f32, tag::abcd);
+        const memory::desc pt_md(pt_dims, dt::s32, tag::ab);
+        const memory::desc dst_md(dst_dims, dt::f32, tag::abcd);
+        const memory::desc msk_md(msk_dims, dt::f32, tag::abcd);
+        const memory::desc scale_md({1, 1, 1, 1}, dt::f32, tag::abcd);
+
+        auto q = rand_vec(nelems(q_dims), 1);
+        auto k = rand_vec(nelems(k_dims), 2);
+        auto v = rand_vec(nelems(v_dims), 3);
+        float scale = 0.125f;
+        std::vector<float> dst(nelems(dst_dims), 0.f);
+
+        // The pages of the sequences are scattered over the pools in reverse
+        // order.
+        std::vector<int32_t> pt(nelems(pt_dims));
+        for (size_t i = 0; i < pt.size(); i++)
+            pt[i] = int32_t(n_pages - 2 - i);
+        std::vector<float> msk(nelems(msk_dims));
+        for (dim b = 0; b < s.mb; b++)
+            for (dim j = 0; j < s.keys; j++)
+                msk[b * s.keys + j] = j < p.seq_lens[b]
+                        ? 0.f
+                        : -std::numeric_limits<float>::infinity();
+
+        dnnl_primitive_desc_t c_pd = nullptr;
+        const dnnl_status_t st = sdpa_paged_kv_primitive_desc_create(&c_pd,
+                eng.get(), q_md.get(), k_md.get(), v_md.get(), pt_md.get(),
+                dst_md.get(), msk_md.get(), scale_md.get(), false, s.kv_heads,
+                impl::attn_mask_type::buffer, impl::alg_kind::softmax_accurate,
+                fwd_inference, nullptr, nullptr, nullptr);
+        if (st == dnnl_unimplemented && !brgemm_impl_expected())
+            GTEST_SKIP() << "Unimplemented";
+        ASSERT_EQ(st, dnnl_success);
+        primitive_desc pd(c_pd);
+
+        primitive(pd).execute(strm,
+                {{DNNL_ARG_QUERIES, memory(q_md, eng, q.data())},
+                        {DNNL_ARG_KEYS, memory(k_md, eng, k.data())},
+                        {DNNL_ARG_VALUES, memory(v_md, eng, v.data())},
+                        {DNNL_ARG_KV_PAGE_TABLE, memory(pt_md, eng, pt.data())},
+                        {DNNL_ARG_ATTN_MASK, memory(msk_md, eng, msk.data())},
+                        {DNNL_ARG_SCALE, memory(scale_md, eng, &scale)},
+                        {DNNL_ARG_DST, memory(dst_md, eng, dst.data())}});
+        strm.wait();
+
+        const auto page = [&](dim b, dim j) {
+            return dim(pt[b * pages_per_seq + j / ps]);
+        };
+        const auto q_acc = [&](dim b, dim h, dim i, dim d) {
+            return q[off4(q_dims, tag::abcd, b, h, i, d)];
+        };
+        const auto k_acc = [&](dim b, dim h, dim d, dim j) {
+            return k[off4(k_dims, tag::abcd, page(b, j), h, d, j % ps)];
+        };
+        const auto v_acc = [&](dim b, dim h, dim j, dim c) {
+            return v[off4(v_dims, tag::abcd, page(b, j), h, j % ps, c)];
+        };
+        const auto msk_acc = [&](dim b, dim h, dim i, dim j) {
+            return msk[b * s.keys + j];
+        };
+
+        std::vector<float> ref;
+        ref_sdpa_fwd(s, q_acc, k_acc, v_acc, msk_acc, mask_kind_t::buffer,
+                scale, ref);
+        check_near(dst, ref, 1e-4f);
+    }
+};
+
+TEST_P(sdpa_cpu_paged_test_t, TestsSdpaCpuPagedKv) {}
+
+// Pages of up to 128 keys are processed one by one, larger pages block by
+// block.
+INSTANTIATE_TEST_SUITE_P(TestSdpaCpuPagedKv, sdpa_cpu_paged_test_t,
+        ::testing::Values(
+                sdpa_cpu_paged_params_t {
+                        {3, 4, 2, 1, 80, 64, 64}, 16, {80, 37, 1}},
+                sdpa_cpu_paged_params_t {
+                        {2, 2, 2, 40, 192, 64, 64}, 64, {150, 192}},
+                sdpa_cpu_paged_params_t {
+                        {2, 2, 1, 4, 512, 32, 32}, 256, {300, 511}}));
+
+struct sdpa_cpu_varlen_params_t {
+    dim heads, kv_heads, head_size, values;
+    std::vector<dim> q_lens, kv_lens;
+    mask_kind_t mask; // none or causal
+};
+
+class sdpa_cpu_varlen_test_t
+    : public ::testing::TestWithParam<sdpa_cpu_varlen_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+                "Test requires host-allocated memory.");
+        Test();
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        const dim seq_count = dim(p.q_lens.size());
+        std::vector<int32_t> q_off(seq_count), kv_off(seq_count);
+        dim total_q = 0, total_kv = 0;
+        for (dim b = 0; b < seq_count; b++) {
+            total_q += p.q_lens[b];
+            total_kv += p.kv_lens[b];
+            q_off[b] = int32_t(total_q);
+            kv_off[b] = int32_t(total_kv);
+        }
+
+        auto eng = get_test_engine();
+        stream strm(eng);
+
+        const memory::dims q_dims {1, p.heads, total_q, p.head_size};
+        const memory::dims k_dims {1, p.kv_heads, p.head_size, total_kv};
+        const memory::dims v_dims {1, p.kv_heads, total_kv, p.values};
+        const memory::dims dst_dims {1, p.heads, total_q, p.values};
+
+        const memory::desc q_md(q_dims, dt::f32, tag::abcd);
+        const memory::desc k_md(k_dims, dt::f32, tag::abcd);
+        const memory::desc v_md(v_dims, dt::f32, tag::abcd);
+        const memory::desc off_md({seq_count}, dt::s32, tag::a);
+        const memory::desc dst_md(dst_dims, dt::f32, tag::abcd);
+        const memory::desc scale_md({1, 1, 1, 1}, dt::f32, tag::abcd);
+
+        auto q = rand_vec(nelems(q_dims), 1);
+        auto k = rand_vec(nelems(k_dims), 2);
+        auto v = rand_vec(nelems(v_dims), 3);
+        float scale = 0.125f;
+        std::vector<float> dst(nelems(dst_dims), 0.f);
+
+        dnnl_primitive_desc_t c_pd = nullptr;
+        const dnnl_status_t st = sdpa_varlen_primitive_desc_create(&c_pd,
+                eng.get(), q_md.get(), k_md.get(), v_md.get(), off_md.get(),
+                off_md.get(), dst_md.get(), nullptr, scale_md.get(), false,
+                p.kv_heads, to_attn_mask_type(p.mask),
+                impl::alg_kind::softmax_accurate, fwd_inference, nullptr,
+                nullptr, nullptr);
+        if (st == dnnl_unimplemented && !brgemm_impl_expected())
+            GTEST_SKIP() << "Unimplemented";
+        ASSERT_EQ(st, dnnl_success);
+        primitive_desc pd(c_pd);
+
+        primitive(pd).execute(strm,
+                {{DNNL_ARG_QUERIES, memory(q_md, eng, q.data())},
+                        {DNNL_ARG_KEYS, memory(k_md, eng, k.data())},
+                        {DNNL_ARG_VALUES, memory(v_md, eng, v.data())},
+                        {DNNL_ARG_Q_SEQ_OFFSETS,
+                                memory(off_md, eng, q_off.data())},
+                        {DNNL_ARG_KV_SEQ_OFFSETS,
+                                memory(off_md, eng, kv_off.data())},
+                        {DNNL_ARG_SCALE, memory(scale_md, eng, &scale)},
+                        {DNNL_ARG_DST, memory(dst_md, eng, dst.data())}});
+        strm.wait();
+
+        // Every sequence is checked on its own against a batch of one
+        for (dim b = 0; b < seq_count; b++) {
+            const dim q_beg = b ? q_off[b - 1] : 0;
+            const dim kv_beg = b ? kv_off[b - 1] : 0;
+            const sdpa_cpu_shape_t s {1, p.heads, p.kv_heads, p.q_lens[b],
+                    p.kv_lens[b], p.head_size, p.values};
+            const auto q_acc = [&](dim, dim h, dim i, dim d) {
+                return q[off4(q_dims, tag::abcd, 0, h, q_beg + i, d)];
+            };
+            const auto k_acc = [&](dim, dim h, dim d, dim j) {
+                return k[off4(k_dims, tag::abcd, 0, h, d, kv_beg + j)];
+            };
+            const auto v_acc = [&](dim, dim h, dim j, dim c) {
+                return v[off4(v_dims, tag::abcd, 0, h, kv_beg + j, c)];
+            };
+
+            std::vector<float> ref, res;
+            ref_sdpa_fwd(
+                    s, q_acc, k_acc, v_acc, acc4_t(), p.mask, scale, ref);
+            for (dim h = 0; h < p.heads; h++)
+                for (dim i = 0; i < s.queries; i++)
+                    for (dim c = 0; c < p.values; c++)
+                        res.push_back(dst[off4(
+                                dst_dims, tag::abcd, 0, h, q_beg + i, c)]);
+            check_near(res, ref, 1e-4f);
+        }
+    }
+};
+
+TEST_P(sdpa_cpu_varlen_test_t, TestsSdpaCpuVarlen) {}
+
+// Lengths are not multiples of the blocks, and an empty sequence owns no
+// query block.
+INSTANTIATE_TEST_SUITE_P(TestSdpaCpuVarlen, sdpa_cpu_varlen_test_t,
+        ::testing::Values(
+                sdpa_cpu_varlen_params_t {2, 2, 64, 64, {40, 7, 100},
+                        {200, 31, 100}, mask_kind_t::none},
+                sdpa_cpu_varlen_params_t {4, 2, 64, 64, {33, 0, 64, 1},
+                        {33, 5, 190, 129}, mask_kind_t::causal_tl},
+                sdpa_cpu_varlen_params_t {2, 1, 32, 48, {20, 50},
+                        {150, 50}, mask_kind_t::causal_br}));
+
+struct sdpa_cpu_quant_params_t {
+    sdpa_cpu_shape_t shape;
+    kv_quant_t key, val;
+};
+
+class sdpa_cpu_quant_test_t
+    : public ::testing::TestWithParam<sdpa_cpu_quant_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+                "Test requires host-allocated memory.");
+        Test();
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        const auto &s = p.shape;
+
+        auto eng = get_test_engine();
+        stream strm(eng);
+
+        const memory::dims q_dims {s.mb, s.heads, s.queries, s.head_size};
+        const memory::dims k_dims {s.mb, s.kv_heads, s.head_size, s.keys};
+        const memory::dims v_dims {s.mb, s.kv_heads, s.keys, s.values};
+        const memory::dims dst_dims {s.mb, s.heads, s.queries, s.values};
+
+        const memory::desc q_md(q_dims, dt::f32, tag::abcd);
+        const memory::desc k_md(k_dims, p.key.data_dt, tag::abcd);
+        const memory::desc v_md(v_dims, p.val.data_dt, tag::abcd);
+        const memory::desc dst_md(dst_dims, dt::f32, tag::abcd);
+        const memory::desc scale_md({1, 1, 1, 1}, dt::f32, tag::abcd);
+
+        auto q = rand_vec(nelems(q_dims), 1);
+        kv_data_t k(k_dims, p.key, 2);
+        kv_data_t v(v_dims, p.val, 3);
+        float scale = 0.125f;
+        std::vector<float> dst(nelems(dst_dims), 0.f);
+
+        primitive_attr kq_attr, vs_attr;
+        const std::pair<const kv_quant_t &, primitive_attr &> attrs[2]
+                = {{p.key, kq_attr}, {p.val, vs_attr}};
+        for (const auto &a : attrs) {
+            if (a.first.with_scales)
+                a.second.set_scales(DNNL_ARG_WEIGHTS, a.first.mask,
+                        a.first.groups, dt::f32);
+            if (a.first.with_zp)
+                a.second.set_zero_points(DNNL_ARG_WEIGHTS, a.first.mask,
+                        a.first.groups, dt::s8);
+        }
+
+        impl::sdpa::primitive_desc pd;
+        try {
+            pd = impl::sdpa::primitive_desc(eng, q_md, k_md, v_md, nullptr,
+                    scale_md, dst_md, false, s.kv_heads,
+                    impl::attn_mask_type::undef,
+                    impl::alg_kind::softmax_accurate, fwd_inference,
+                    primitive_attr(), kq_attr, vs_attr);
+        } catch (error &e) {
+            if (e.status == dnnl_unimplemented && !brgemm_impl_expected())
+                GTEST_SKIP() << "Unimplemented: " << e.what();
+            throw;
+        }
+
+        std::unordered_map<int, memory> args {
+                {DNNL_ARG_QUERIES, memory(q_md, eng, q.data())},
+                {DNNL_ARG_KEYS, memory(k_md, eng, k.data.data())},
+                {DNNL_ARG_VALUES, memory(v_md, eng, v.data.data())},
+                {DNNL_ARG_SCALE, memory(scale_md, eng, &scale)},
+                {DNNL_ARG_DST, memory(dst_md, eng, dst.data())}};
+        const std::pair<int, kv_data_t *> params[2]
+                = {{DNNL_ARG_KEYS, &k}, {DNNL_ARG_VALUES, &v}};
+        for (const auto &a : params) {
+            auto &kv = *a.second;
+            if (!kv.scales.empty())
+                args[DNNL_ARG_ATTR_SCALES | a.first]
+                        = memory({{dim(kv.scales.size())}, dt::f32, tag::a},
+                                eng, kv.scales.data());
+            if (!kv.zps.empty())
+                args[DNNL_ARG_ATTR_ZERO_POINTS | a.first]
+                        = memory({{dim(kv.zps.size())}, dt::s8, tag::a}, eng,
+                                kv.zps.data());
+        }
+        impl::sdpa(pd).execute(strm, args);
+        strm.wait();
+
+        const auto q_acc = [&](dim b, dim h, dim i, dim d) {
+            return q[off4(q_dims, tag::abcd, b, h, i, d)];
+        };
+        const auto k_acc = [&](dim b, dim h, dim d, dim j) {
+            return k.deq[off4(k_dims, tag::abcd, b, h, d, j)];
+        };
+        const auto v_acc = [&](dim b, dim h, dim j, dim c) {
+            return v.deq[off4(v_dims, tag::abcd, b, h, j, c)];
+        };
+
+        std::vector<float> ref;
+        ref_sdpa_fwd(s, q_acc, k_acc, v_acc, acc4_t(), mask_kind_t::none,
+                scale, ref);
+        check_near(dst, ref, 1e-4f);
+    }
+};
+
+TEST_P(sdpa_cpu_quant_test_t, TestsSdpaCpuQuantizedKv) {}
+
+// Per-tensor, per-head and grouped scales and zero-points; the groups of the
+// keys are along the head size and those of the values along the values.
+INSTANTIATE_TEST_SUITE_P(TestSdpaCpuQuantizedKv, sdpa_cpu_quant_test_t,
+        ::testing::Values(
+                sdpa_cpu_quant_params_t {{2, 2, 2, 40, 200, 64, 64},
+                        {dt::s8, true, true, 0, {}},
+                        {dt::u8, true, true, 0, {}}},
+                sdpa_cpu_quant_params_t {{1, 4, 2, 33, 150, 64, 64},
+                        {dt::s8, true, false, 1 << 1, {}},
+                        {dt::s8, true, false, 1 << 1, {}}},
+                sdpa_cpu_quant_params_t {{1, 2, 2, 1, 300, 64, 64},
+                        {dt::s4, true, true, (1 << 1) | (1 << 2) | (1 << 3),
+                                {32, 1}},
+                        {dt::u4, true, true, (1 << 1) | (1 << 2) | (1 << 3),
+                                {1, 16}}},
+                sdpa_cpu_quant_params_t {{2, 2, 2, 40, 130, 64, 64},
+                        {dt::f16, false, false, 0, {}},
+                        {dt::bf16, false, false, 0, {}}},
+                sdpa_cpu_quant_params_t {{1, 2, 2, 40, 130, 64, 64},
+                        {dt::bf16, true, false, 1 << 1, {}},
+                        {dt::f32, true, false, 0, {}}}));
+
+// Keys past the end of a sequence of a paged kv cache are excluded by the
+// attention mask only, so a paged configuration without one is rejected.
+TEST(sdpa_cpu_test_t, TestsSdpaCpuPagedKvRequiresMask) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Test requires a CPU engine.");
+    auto eng = get_test_engine();
+    const memory::desc q_md({2, 2, 1, 64}, dt::f32, tag::abcd);
+    const memory::desc k_md({5, 2, 64, 16}, dt::f32, tag::abcd);
+    const memory::desc v_md({5, 2, 16, 64}, dt::f32, tag::abcd);
+    const memory::desc pt_md({2, 2}, dt::s32, tag::ab);
+    const memory::desc dst_md({2, 2, 1, 64}, dt::f32, tag::abcd);
+    const memory::desc msk_md({2, 1, 1, 32}, dt::f32, tag::abcd);
+    const memory::desc scale_md({1, 1, 1, 1}, dt::f32, tag::abcd);
+
+    const auto create = [&](const memory::desc *msk_md) {
+        dnnl_primitive_desc_t c_pd = nullptr;
+        const dnnl_status_t st = sdpa_paged_kv_primitive_desc_create(&c_pd,
+                eng.get(), q_md.get(), k_md.get(), v_md.get(), pt_md.get(),
+                dst_md.get(), msk_md ? msk_md->get() : nullptr,
+                scale_md.get(), false, 2,
+                msk_md ? impl::attn_mask_type::buffer
+                       : impl::attn_mask_type::undef,
+                impl::alg_kind::softmax_accurate, fwd_inference, nullptr,
+                nullptr, nullptr);
+        if (c_pd) dnnl_primitive_desc_destroy(c_pd);
+        return st;
+    };
+
+    const dnnl_status_t st = create(&msk_md);
+    if (st == dnnl_unimplemented && !brgemm_impl_expected())
+        GTEST_SKIP() << "Unimplemented";
+    ASSERT_EQ(st, dnnl_success);
+    ASSERT_EQ(create(nullptr), dnnl_unimplemented);
+}
+
+struct sdpa_cpu_bwd_params_t {
+    sdpa_cpu_shape_t shape;
+    mask_kind_t mask;
+    bool invert_scale;
+    bool with_ds;
+};
+
+class sdpa_cpu_bwd_test_t
+    : public ::testing::TestWithParam<sdpa_cpu_bwd_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+                "Test requires host-allocated memory.");
+        Test();
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        const auto &s = p.shape;
+        const bool with_mask = p.mask == mask_kind_t::buffer
+                || p.mask == mask_kind_t::bcast;
+
+        auto eng = get_test_engine();
+        stream strm(eng);
+
+        const memory::dims q_dims {s.mb, s.heads, s.queries, s.head_size};
+        const memory::dims k_dims {s.mb, s.kv_heads, s.head_size, s.keys};
+        const memory::dims v_dims {s.mb, s.kv_heads, s.keys, s.values};
+        const memory::dims dst_dims {s.mb, s.heads, s.queries, s.values};
+        const memory::dims ds_dims {s.mb, s.heads, s.queries, s.keys};
+        const memory::dims msk_dims = p.mask == mask_kind_t::bcast
+                ? memory::dims {1, 1, s.queries, s.keys}
+                : ds_dims;
+
+        const memory::desc q_md(q_dims, dt::f32, tag::abcd);
+        const memory::desc k_md(k_dims, dt::f32, tag::abcd);
+        const memory::desc v_md(v_dims, dt::f32, tag::abcd);
+        const memory::desc dst_md(dst_dims, dt::f32, tag::abcd);
+        const memory::desc ds_md(ds_dims, dt::f32, tag::abcd);
+        const memory::desc msk_md(msk_dims, dt::f32, tag::abcd);
+        const memory::desc scale_md({1, 1, 1, 1}, dt::f32, tag::abcd);
+
+        auto q = rand_vec(nelems(q_dims), 1);
+        auto k = rand_vec(nelems(k_dims), 2);
+        auto v = rand_vec(nelems(v_dims), 3);
+        auto msk = rand_vec(with_mask ? nelems(msk_dims) : 0, 4);
+        auto dd = rand_vec(nelems(dst_dims), 5);
+        const float scale = 0.125f;
+        float scale_arg = p.invert_scale ? 1.f / scale : scale;
+        std::vector<float> dst(nelems(dst_dims), 0.f);
+        std::vector<float> dq(nelems(q_dims), 0.f), dk(nelems(k_dims), 0.f),
+                dv(nelems(v_dims), 0.f), ds(nelems(ds_dims), 0.f);
+
+        const int mask_type = to_attn_mask_type(p.mask);
+        impl::sdpa::primitive_desc fwd_pd;
+        impl::sdpa_backward::primitive_desc bwd_pd;
+        try {
+            fwd_pd = impl::sdpa::primitive_desc(eng, q_md, k_md, v_md,
+                    with_mask ? &msk_md : nullptr, scale_md, dst_md,
+                    p.invert_scale, s.kv_heads, mask_type,
+                    impl::alg_kind::softmax_accurate, fwd_training);
+            bwd_pd = impl::sdpa_backward::primitive_desc(eng, q_md, k_md,
+                    v_md, with_mask ? &msk_md : nullptr, scale_md, dst_md,
+                    q_md, k_md, v_md, dst_md, p.with_ds ? &ds_md : nullptr,
+                    p.invert_scale, s.kv_heads, mask_type,
+                    impl::alg_kind::softmax_accurate, fwd_pd);
+        } catch (error &e) {
+            if (e.status == dnnl_unimplemented && !brgemm_impl_expected())
+                GTEST_SKIP() << "Unimplemented: " << e.what();
+            throw;
+        }
+
+        memory q_m(q_md, eng, q.data()), k_m(k_md, eng, k.data()),
+                v_m(v_md, eng, v.data()), dst_m(dst_md, eng, dst.data()),
+                scale_m(scale_md, eng, &scale_arg),
+                ws_m(fwd_pd.workspace_desc(), eng);
+        std::unordered_map<int, memory> args {{DNNL_ARG_QUERIES, q_m},
+                {DNNL_ARG_KEYS, k_m}, {DNNL_ARG_VALUES, v_m},
+                {DNNL_ARG_SCALE, scale_m}, {DNNL_ARG_DST, dst_m},
+                {DNNL_ARG_WORKSPACE, ws_m}};
+        if (with_mask)
+            args[DNNL_ARG_ATTN_MASK] = memory(msk_md, eng, msk.data());
+        impl::sdpa(fwd_pd).execute(strm, args);
+
+        args[DNNL_ARG_DIFF_DST] = memory(dst_md, eng, dd.data());
+        args[DNNL_ARG_DIFF_QUERIES] = memory(q_md, eng, dq.data());
+        args[DNNL_ARG_DIFF_KEYS] = memory(k_md, eng, dk.data());
+        args[DNNL_ARG_DIFF_VALUES] = memory(v_md, eng, dv.data());
+        if (p.with_ds) args[DNNL_ARG_DS] = memory(ds_md, eng, ds.data());
+        impl::sdpa_backward(bwd_pd).execute(strm, args);
+        strm.wait();
+
+        const auto acc = [](const std::vector<float> &x,
+                                 const memory::dims &dims) {
+            return [&x, dims](dim d0, dim d1, dim d2, dim d3) {
+                return x[off4(dims, tag::abcd, d0, d1, d2, d3)];
+            };
+        };
+        acc4_t msk_acc;
+        if (with_mask)
+            msk_acc = [&](dim b, dim h, dim i, dim j) {
+                return msk[off4(msk_dims, tag::abcd, msk_dims[0] == 1 ? 0 : b,
+                        msk_dims[1] == 1 ? 0 : h, i, j)];
+            };
+
+        std::vector<float> dq_ref, dk_ref, dv_ref, ds_ref;
+        ref_sdpa_bwd(s, acc(q, q_dims), acc(k, k_dims), acc(v, v_dims),
+                msk_acc, p.mask, scale, acc(dd, dst_dims), dq_ref, dk_ref,
+                dv_ref, ds_ref);
+        check_near(dq, dq_ref, 2e-4f);
+        check_near(dk, dk_ref, 2e-4f);
+        check_near(dv, dv_ref, 2e-4f);
+        if (p.with_ds) check_near(ds, ds_ref, 2e-4f);
+    }
+};
+
+TEST_P(sdpa_cpu_bwd_test_t, TestsSdpaCpuBwd) {}
+
+INSTANTIATE_TEST_SUITE_P(TestSdpaCpuBwd, sdpa_cpu_bwd_test_t,
+        ::testing::Values(
+                sdpa_cpu_bwd_params_t {{2, 2, 2, 40, 200, 64, 64},
+                        mask_kind_t::none, false, false},
+                sdpa_cpu_bwd_params_t {{1, 2, 2, 70, 70, 64, 32},
+                        mask_kind_t::causal_tl, false, true},
+                sdpa_cpu_bwd_params_t {{1, 2, 1, 40, 200, 64, 64},
+                        mask_kind_t::causal_br, false, true},
+                sdpa_cpu_bwd_params_t {{1, 4, 2, 40, 150, 64, 64},
+                        mask_kind_t::buffer, false, true},
+                sdpa_cpu_bwd_params_t {{2, 2, 2, 33, 130, 32, 64},
+                        mask_kind_t::bcast, true, false}));
+
+} // namespace dnnl
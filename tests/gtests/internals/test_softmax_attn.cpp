@@ -0,0 +1,171 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "common/sdpa_test_iface.hpp"
+#include "common/sdpa_types.hpp"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+using dim = memory::dim;
+
+struct softmax_attn_params_t {
+    memory::dims src_dims;
+    memory::dims mask_dims; // empty if no mask buffer
+    int mask_type;
+    bool invert_scale;
+    dt dst_dt;
+};
+
+class softmax_attn_test_t
+    : public ::testing::TestWithParam<softmax_attn_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Attention inputs of softmax are supported on CPU only.");
+        SKIP_IF(unsupported_data_type(GetParam().dst_dt, get_test_engine()),
+                "Engine does not support this data type.");
+        Test();
+    }
+
+    static float value(dim i, float range) {
+        return range * ((i * 37 + 11) % 64 - 32) / 32.f;
+    }
+
+    void Test() {
+        const auto &p = GetParam();
+        auto eng = get_test_engine();
+        auto strm = stream(eng);
+
+        const int ndims = static_cast<int>(p.src_dims.size());
+        const dim K = p.src_dims[ndims - 1];
+        const dim Q = p.src_dims[ndims - 2];
+        const bool with_mask = !p.mask_dims.empty();
+        const float scale = p.invert_scale ? 8.f : 0.125f;
+
+        memory::desc src_md(p.src_dims, dt::f32, tag::abcd);
+        memory::desc dst_md(p.src_dims, p.dst_dt, tag::abcd);
+        memory::desc f32_md(p.src_dims, dt::f32, tag::abcd);
+        memory::desc scale_md({1}, dt::f32, tag::a);
+        memory::desc mask_md;
+        if (with_mask) mask_md = memory::desc(p.mask_dims, dt::f32, tag::abcd);
+
+        memory src(src_md, eng), scale_mem(scale_md, eng);
+        memory dst(dst_md, eng), got(f32_md, eng);
+        memory ref_src(f32_md, eng), ref_dst(f32_md, eng);
+        memory mask;
+        if (with_mask) mask = memory(mask_md, eng);
+
+        auto *src_ptr = static_cast<float *>(src.get_data_handle());
+        const dim nelems = static_cast<dim>(src_md.get_size() / sizeof(float));
+        for (dim i = 0; i < nelems; i++)
+            src_ptr[i] = value(i, 16.f);
+        static_cast<float *>(scale_mem.get_data_handle())[0] = scale;
+        float *mask_ptr = nullptr;
+        if (with_mask) {
+            mask_ptr = static_cast<float *>(mask.get_data_handle());
+            const dim mask_nelems
+                    = static_cast<dim>(mask_md.get_size() / sizeof(float));
+            for (dim i = 0; i < mask_nelems; i++)
+                mask_ptr[i] = value(i + 5, 2.f);
+        }
+
+        // The expected values are computed by a plain softmax of the source
+        // with the attention inputs applied beforehand.
+        auto *ref_src_ptr = static_cast<float *>(ref_src.get_data_handle());
+        for (dim i = 0; i < nelems; i++) {
+            memory::dims pos(ndims);
+            dim l = i;
+            for (int d = ndims - 1; d >= 0; d--) {
+                pos[d] = l % p.src_dims[d];
+                l /= p.src_dims[d];
+            }
+            float s = p.invert_scale ? src_ptr[i] / scale : src_ptr[i] * scale;
+            if (with_mask) {
+                dim off = 0;
+                for (int d = 0; d < ndims; d++)
+                    off = off * p.mask_dims[d]
+                            + (p.mask_dims[d] == 1 ? 0 : pos[d]);
+                s += mask_ptr[off];
+            }
+            const dim q = pos[ndims - 2], k = pos[ndims - 1];
+            if (p.mask_type == impl::attn_mask_type::top_left && k > q)
+                s = -1e30f;
+            if (p.mask_type == impl::attn_mask_type::bottom_right
+                    && k > q + K - Q)
+                s = -1e30f;
+            ref_src_ptr[i] = s;
+        }
+
+        dnnl_primitive_desc_t c_pd = nullptr;
+        ASSERT_EQ(softmax_attn_primitive_desc_create(&c_pd, eng.get(),
+                          dnnl_softmax_accurate, src_md.get(), dst_md.get(),
+                          scale_md.get(), p.invert_scale,
+                          with_mask ? mask_md.get() : nullptr, p.mask_type,
+                          nullptr),
+                dnnl_success);
+        primitive_desc pd(c_pd);
+        std::unordered_map<int, memory> args {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_SCALE, scale_mem}, {DNNL_ARG_DST, dst}};
+        if (with_mask) args.insert({DNNL_ARG_ATTN_MASK, mask});
+        primitive(pd).execute(strm, args);
+        reorder(dst, got).execute(strm, dst, got);
+
+        auto ref_pd = softmax_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::softmax_accurate,
+                f32_md, f32_md, ndims - 1);
+        softmax_forward(ref_pd).execute(
+                strm, {{DNNL_ARG_SRC, ref_src}, {DNNL_ARG_DST, ref_dst}});
+        strm.wait();
+
+        const float eps = p.dst_dt == dt::f32 ? 1e-6f : 4e-3f;
+        const auto *got_ptr = static_cast<float *>(got.get_data_handle());
+        const auto *exp_ptr = static_cast<float *>(ref_dst.get_data_handle());
+        for (dim i = 0; i < nelems; i++)
+            ASSERT_NEAR(got_ptr[i], exp_ptr[i], eps) << "index: " << i;
+    }
+};
+
+TEST_P(softmax_attn_test_t, TestsSoftmaxAttn) {}
+
+INSTANTIATE_TEST_SUITE_P(TestSoftmaxAttn, softmax_attn_test_t,
+        ::testing::Values(
+                softmax_attn_params_t {{2, 2, 5, 37}, {}, 0, false, dt::f32},
+                softmax_attn_params_t {{2, 2, 5, 37}, {}, 0, true, dt::f32},
+                softmax_attn_params_t {{2, 2, 5, 37}, {1, 1, 5, 37},
+                        impl::attn_mask_type::buffer, false, dt::f32},
+                softmax_attn_params_t {{2, 3, 4, 70}, {2, 1, 1, 70},
+                        impl::attn_mask_type::buffer, false, dt::bf16},
+                softmax_attn_params_t {{1, 2, 9, 9}, {},
+                        impl::attn_mask_type::top_left, false, dt::f32},
+                softmax_attn_params_t {{1, 2, 7, 300}, {},
+                        impl::attn_mask_type::top_left, true, dt::f16},
+                softmax_attn_params_t {{2, 1, 6, 21}, {},
+                        impl::attn_mask_type::bottom_right, false, dt::f32}));
+
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
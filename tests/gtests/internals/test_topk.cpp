@@ -0,0 +1,173 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "common/topk_iface.hpp"
+
+#define DNNL_ARG_TOPK_INDICES DNNL_ARG_DST_1
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using mdt = memory::data_type;
+
+/// Top-k internal primitive.
+struct topk_t : public dnnl::primitive {
+    /// Primitive descriptor for a top-k primitive.
+    struct pd_t : public dnnl::primitive_desc {
+        pd_t() = default;
+
+        pd_t(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &dst_desc,
+                const memory::desc &indices_desc, bool with_softmax,
+                float temperature,
+                const primitive_attr &attr = default_attr()) {
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_topk_primitive_desc_create(&pd,
+                    aengine.get(), src_desc.get(), dst_desc.get(),
+                    indices_desc.get(), with_softmax, temperature,
+                    attr.get());
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a top-k "
+                    "primitive");
+            reset(pd);
+        }
+    };
+
+    topk_t() = default;
+    topk_t(const pd_t &pd) : primitive(pd) {}
+};
+
+struct topk_params_t {
+    memory::dim rows;
+    memory::dim n;
+    memory::dim k;
+    bool with_softmax;
+    float temperature;
+};
+
+class topk_test_t : public ::testing::TestWithParam<topk_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Top-k is only implemented on CPU.");
+        p = GetParam();
+    }
+
+    void Test() {
+        const engine eng = get_test_engine();
+        stream strm(eng);
+
+        memory::desc src_md({p.rows, p.n}, mdt::f32, tag::ab);
+        memory::desc dst_md({p.rows, p.k}, mdt::f32, tag::ab);
+        memory::desc indices_md({p.rows, p.k}, mdt::s32, tag::ab);
+        topk_t::pd_t pd(eng, src_md, dst_md, indices_md, p.with_softmax,
+                p.temperature);
+        topk_t prim(pd);
+
+        // Few distinct values, so that the rows have many ties.
+        std::vector<float> src(p.rows * p.n);
+        for (size_t i = 0; i < src.size(); i++)
+            src[i] = static_cast<float>((i * 7919) % 1009) / 64.f;
+
+        auto src_mem = test::make_memory(src_md, eng);
+        auto dst_mem = test::make_memory(dst_md, eng);
+        auto indices_mem = test::make_memory(indices_md, eng);
+        {
+            auto s = map_memory<float>(src_mem);
+            for (size_t i = 0; i < src.size(); i++)
+                s[i] = src[i];
+        }
+
+        prim.execute(strm,
+                {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_DST, dst_mem},
+                        {DNNL_ARG_TOPK_INDICES, indices_mem}});
+        strm.wait();
+
+        auto dst = map_memory<float>(dst_mem);
+        auto ind = map_memory<int32_t>(indices_mem);
+        for (memory::dim r = 0; r < p.rows; r++) {
+            const float *row = &src[r * p.n];
+            std::vector<int32_t> order(p.n);
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(),
+                    [&](int32_t a, int32_t b) { return row[a] > row[b]; });
+            float sum_exp = 0.f;
+            for (memory::dim i = 0; i < p.n; i++)
+                sum_exp += std::exp((row[i] - row[order[0]]) / p.temperature);
+
+            for (memory::dim j = 0; j < p.k; j++) {
+                ASSERT_EQ(ind[r * p.k + j], order[j])
+                        << "row " << r << " position " << j;
+                float ref = row[order[j]];
+                if (p.with_softmax)
+                    ref = std::exp((ref - row[order[0]]) / p.temperature)
+                            / sum_exp;
+                ASSERT_NEAR(dst[r * p.k + j], ref, 1e-5f * (1.f + ref))
+                        << "row " << r << " position " << j;
+            }
+        }
+    }
+
+    topk_params_t p;
+};
+
+TEST_P(topk_test_t, TestsTopk) {
+    Test();
+}
+
+INSTANTIATE_TEST_SUITE_P(Values, topk_test_t,
+        ::testing::Values(topk_params_t {4, 100, 5, false, 1.f},
+                topk_params_t {2, 37, 37, false, 1.f},
+                // a few long rows split between threads
+                topk_params_t {1, 50000, 40, false, 1.f},
+                topk_params_t {3, 20000, 1, false, 1.f}));
+
+INSTANTIATE_TEST_SUITE_P(Softmax, topk_test_t,
+        ::testing::Values(topk_params_t {4, 100, 5, true, 1.f},
+                topk_params_t {1, 50000, 50, true, 0.7f}));
+
+TEST(topk_iface_test_t, TestInvalidArguments) {
+    const engine eng = get_test_engine();
+    memory::desc src_md({2, 16}, mdt::f32, tag::ab);
+    memory::desc dst_md({2, 4}, mdt::f32, tag::ab);
+    memory::desc indices_md({2, 4}, mdt::s32, tag::ab);
+
+    // k larger than the row
+    memory::desc dst_big_md({2, 17}, mdt::f32, tag::ab);
+    memory::desc indices_big_md({2, 17}, mdt::s32, tag::ab);
+    EXPECT_ANY_THROW(topk_t::pd_t(
+            eng, src_md, dst_big_md, indices_big_md, false, 1.f));
+    // indices must be s32
+    memory::desc indices_f32_md({2, 4}, mdt::f32, tag::ab);
+    EXPECT_ANY_THROW(
+            topk_t::pd_t(eng, src_md, dst_md, indices_f32_md, false, 1.f));
+    // temperature must be positive
+    EXPECT_ANY_THROW(
+            topk_t::pd_t(eng, src_md, dst_md, indices_md, true, 0.f));
+}
+
+} // namespace dnnl
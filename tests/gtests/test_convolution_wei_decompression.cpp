@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+struct conv_wei_decomp_params_t {
+    dt wei_dt;
+    memory::dim ic_group; // 0 for per output channel scales
+};
+
+class conv_wei_decomp_test_t
+    : public ::testing::TestWithParam<conv_wei_decomp_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+                "Test requires host-allocated memory.");
+        Test();
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        const memory::dim MB = 2, IC = 32, OC = 24, IH = 7, IW = 7, K = 3;
+        const memory::dims strides = {1, 1}, padding = {1, 1};
+        const bool is_int4 = p.wei_dt == dt::s4 || p.wei_dt == dt::u4;
+        const bool is_signed = p.wei_dt == dt::s4 || p.wei_dt == dt::s8;
+        const memory::dim n_ic_scales = p.ic_group ? IC / p.ic_group : 1;
+
+        auto eng = get_test_engine();
+        stream strm(eng);
+
+        const memory::desc src_md({MB, IC, IH, IW}, dt::f32, tag::nchw);
+        const memory::desc dst_md({MB, OC, IH, IW}, dt::f32, tag::nchw);
+        const memory::desc wei_md({OC, IC, K, K}, p.wei_dt, tag::oihw);
+        const memory::desc f32_wei_md({OC, IC, K, K}, dt::f32, tag::oihw);
+
+        const memory::dim wei_nelems = OC * IC * K * K;
+        std::vector<float> src(MB * IC * IH * IW);
+        for (size_t i = 0; i < src.size(); i++)
+            src[i] = float(int(i % 13) - 6) / 8.f;
+        std::vector<float> scales(OC * n_ic_scales);
+        for (size_t i = 0; i < scales.size(); i++)
+            scales[i] = 0.25f + float(i % 5) / 8.f;
+
+        // Quantized weights and their dequantized values
+        std::vector<int> q(wei_nelems);
+        std::vector<float> f32_wei(wei_nelems);
+        for (memory::dim i = 0; i < wei_nelems; i++) {
+            const int range = is_int4 ? 16 : 256;
+            const int v = int((i * 7) % range);
+            q[i] = is_signed ? v - range / 2 : v;
+            const memory::dim oc = i / (IC * K * K);
+            const memory::dim ic = (i / (K * K)) % IC;
+            const memory::dim scale_idx = p.ic_group
+                    ? oc * n_ic_scales + ic / p.ic_group
+                    : oc;
+            f32_wei[i] = float(q[i]) * scales[scale_idx];
+        }
+        std::vector<uint8_t> wei(is_int4 ? wei_nelems / 2 : wei_nelems);
+        for (memory::dim i = 0; i < wei_nelems; i++) {
+            if (is_int4)
+                wei[i / 2] |= uint8_t((q[i] & 0xf) << (4 * (i % 2)));
+            else
+                wei[i] = uint8_t(q[i]);
+        }
+
+        primitive_attr attr;
+        attr.set_fpmath_mode(fpmath_mode::strict, true);
+        const int scales_mask = p.ic_group ? (1 << 0) | (1 << 1) : 1 << 0;
+        const memory::dims groups = p.ic_group
+                ? memory::dims {1, p.ic_group}
+                : memory::dims {};
+        attr.set_scales(DNNL_ARG_WEIGHTS, scales_mask, groups, dt::f32);
+
+        convolution_forward::primitive_desc pd;
+        try {
+            pd = convolution_forward::primitive_desc(eng,
+                    prop_kind::forward_inference,
+                    algorithm::convolution_direct, src_md, wei_md, dst_md,
+                    strides, padding, padding, attr);
+        } catch (error &e) {
+            if (e.status == dnnl_unimplemented)
+                GTEST_SKIP() << "Unimplemented: " << e.what();
+            throw;
+        }
+        const convolution_forward::primitive_desc ref_pd(eng,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, f32_wei_md, dst_md, strides, padding, padding);
+
+        std::vector<float> dst(MB * OC * IH * IW), ref_dst(dst.size());
+        memory src_mem(src_md, eng, src.data());
+        memory wei_mem(wei_md, eng, wei.data());
+        memory f32_wei_mem(f32_wei_md, eng, f32_wei.data());
+        memory scales_mem({{OC * n_ic_scales}, dt::f32, tag::x}, eng,
+                scales.data());
+        memory dst_mem(dst_md, eng, dst.data());
+        memory ref_dst_mem(dst_md, eng, ref_dst.data());
+
+        convolution_forward(pd).execute(strm,
+                {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                        {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, scales_mem},
+                        {DNNL_ARG_DST, dst_mem}});
+        convolution_forward(ref_pd).execute(strm,
+                {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, f32_wei_mem},
+                        {DNNL_ARG_DST, ref_dst_mem}});
+        strm.wait();
+
+        for (size_t i = 0; i < dst.size(); i++) {
+            const float eps = 1e-4f * (1.f + std::fabs(ref_dst[i]));
+            ASSERT_NEAR(dst[i], ref_dst[i], eps) << "at " << i;
+        }
+    }
+};
+
+TEST_P(conv_wei_decomp_test_t, TestsConvolution) {}
+
+INSTANTIATE_TEST_SUITE_P(TestConvWeiDecompression, conv_wei_decomp_test_t,
+        ::testing::Values(conv_wei_decomp_params_t {dt::s8, 0},
+                conv_wei_decomp_params_t {dt::u8, 16},
+                conv_wei_decomp_params_t {dt::s4, 8},
+                conv_wei_decomp_params_t {dt::u4, 32}));
+
+} // namespace dnnl
@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dim = memory::dim;
+
+namespace {
+std::vector<float> make_data(dim size, int seed) {
+    std::vector<float> v(size);
+    for (dim i = 0; i < size; ++i)
+        v[i] = static_cast<float>((i * 13 + seed * 7) % 17 - 8) / 8.f;
+    return v;
+}
+} // namespace
+
+class gemm_batch_test_t : public ::testing::Test {};
+
+HANDLE_EXCEPTIONS_FOR_TEST(gemm_batch_test_t, TestGroups) {
+    // Groups of different shapes and transpositions, with an empty group.
+    const std::vector<char> transa = {'N', 'T', 'N'};
+    const std::vector<char> transb = {'N', 'N', 'T'};
+    const std::vector<dim> M = {1, 7, 33}, N = {17, 5, 3}, K = {9, 64, 2};
+    const std::vector<float> alpha = {1.f, 0.5f, 2.f};
+    const std::vector<float> beta = {0.f, 1.f, 0.5f};
+    const std::vector<dim> group_size = {5, 0, 19};
+    const dim group_count = static_cast<dim>(group_size.size());
+
+    std::vector<dim> lda(group_count), ldb(group_count), ldc(group_count);
+    std::vector<std::vector<float>> a_data, b_data, c_data, c_ref;
+    std::vector<const float *> A, B;
+    std::vector<float *> C;
+    for (dim g = 0; g < group_count; ++g) {
+        const bool ta = transa[g] == 'T', tb = transb[g] == 'T';
+        lda[g] = (ta ? M[g] : K[g]) + 1;
+        ldb[g] = tb ? K[g] : N[g];
+        ldc[g] = N[g] + 3;
+        for (dim i = 0; i < group_size[g]; ++i) {
+            const int seed = static_cast<int>(a_data.size());
+            a_data.push_back(make_data((ta ? K[g] : M[g]) * lda[g], seed));
+            b_data.push_back(make_data((tb ? N[g] : K[g]) * ldb[g], seed + 1));
+            c_data.push_back(make_data(M[g] * ldc[g], seed + 2));
+            c_ref.push_back(c_data.back());
+        }
+    }
+    for (size_t i = 0; i < a_data.size(); ++i) {
+        A.push_back(a_data[i].data());
+        B.push_back(b_data[i].data());
+        C.push_back(c_data[i].data());
+    }
+
+    ASSERT_EQ(sgemm_batch(transa.data(), transb.data(), M.data(), N.data(),
+                      K.data(), alpha.data(), A.data(), lda.data(), B.data(),
+                      ldb.data(), beta.data(), C.data(), ldc.data(),
+                      group_count, group_size.data()),
+            status::success);
+
+    dim i = 0;
+    for (dim g = 0; g < group_count; ++g)
+        for (dim j = 0; j < group_size[g]; ++j, ++i) {
+            ASSERT_EQ(sgemm(transa[g], transb[g], M[g], N[g], K[g], alpha[g],
+                              A[i], lda[g], B[i], ldb[g], beta[g],
+                              c_ref[i].data(), ldc[g]),
+                    status::success);
+            for (dim m = 0; m < M[g]; ++m)
+                for (dim n = 0; n < N[g]; ++n)
+                    ASSERT_NEAR(c_data[i][m * ldc[g] + n],
+                            c_ref[i][m * ldc[g] + n], 1e-5f);
+        }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(gemm_batch_test_t, TestStrided) {
+    const dim M = 3, N = 20, K = 11, batch_size = 37;
+    const dim lda = K, ldb = N, ldc = N;
+    const dim stride_a = M * lda + 2, stride_b = K * ldb, stride_c = M * ldc;
+    const auto a = make_data(batch_size * stride_a, 0);
+    const auto b = make_data(batch_size * stride_b, 1);
+    auto c = make_data(batch_size * stride_c, 2);
+    auto c_ref = c;
+
+    ASSERT_EQ(sgemm_batch_strided('N', 'N', M, N, K, 1.f, a.data(), lda,
+                      stride_a, b.data(), ldb, stride_b, 1.f, c.data(), ldc,
+                      stride_c, batch_size),
+            status::success);
+
+    for (dim i = 0; i < batch_size; ++i) {
+        ASSERT_EQ(sgemm('N', 'N', M, N, K, 1.f, a.data() + i * stride_a, lda,
+                          b.data() + i * stride_b, ldb, 1.f,
+                          c_ref.data() + i * stride_c, ldc),
+                status::success);
+    }
+    for (dim i = 0; i < batch_size * stride_c; ++i)
+        ASSERT_NEAR(c[i], c_ref[i], 1e-5f);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(gemm_batch_test_t, TestInvalidArguments) {
+    const char trans = 'N';
+    const dim one = 1, bad_size = -1;
+    const float alpha = 1.f;
+    const float a = 1.f;
+    const float *A = &a;
+    float c = 0.f;
+    float *C = &c;
+    ASSERT_EQ(dnnl_sgemm_batch(&trans, &trans, &one, &one, &one, &alpha, &A,
+                      &one, &A, &one, &alpha, &C, &one, -1, &one),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_sgemm_batch(&trans, &trans, &one, &one, &one, &alpha, &A,
+                      &one, &A, &one, &alpha, &C, &one, 1, &bad_size),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_sgemm_batch(&trans, &trans, &one, &one, &one, &alpha,
+                      nullptr, &one, &A, &one, &alpha, &C, &one, 1, &one),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_sgemm_batch_strided(trans, trans, 1, 1, 1, 1.f, A, 1, 0, A,
+                      1, 0, 0.f, C, 1, 0, -1),
+            dnnl_invalid_arguments);
+}
+
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
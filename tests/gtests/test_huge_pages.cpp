@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class huge_pages_test_t : public ::testing::Test {};
+
+HANDLE_EXCEPTIONS_FOR_TEST(huge_pages_test_t, TestInvalidMode) {
+    ASSERT_EQ(dnnl_set_huge_pages_mode(static_cast<dnnl_huge_pages_mode_t>(7)),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(set_huge_pages_mode(huge_pages_mode::none), status::success);
+    ASSERT_EQ(get_huge_pages_mode(), huge_pages_mode::none);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(huge_pages_test_t, TestLibraryAllocatedMemory) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    // 64 MB is above any huge page size but 1 GB
+    const memory::dims dims = {16, 1024, 1024};
+    const memory::desc src_md(dims, dt::f32, tag::abc);
+    const memory::desc dst_md(dims, dt::f32, tag::acb);
+
+    for (auto mode : {huge_pages_mode::transparent, huge_pages_mode::hugetlb,
+                 huge_pages_mode::none}) {
+        const status st = set_huge_pages_mode(mode);
+        // huge pages are only supported on Linux
+        if (st == status::unimplemented) continue;
+        ASSERT_EQ(st, status::success);
+        ASSERT_EQ(get_huge_pages_mode(), mode);
+
+        memory src(src_md, eng);
+        memory dst(dst_md, eng);
+        float *src_ptr = static_cast<float *>(src.get_data_handle());
+        const size_t nelems = src_md.get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            src_ptr[i] = static_cast<float>(i % 1021);
+
+        reorder(src, dst).execute(strm, src, dst);
+        strm.wait();
+
+        const float *dst_ptr = static_cast<float *>(dst.get_data_handle());
+        for (memory::dim d0 = 0; d0 < dims[0]; d0 += 5)
+            for (memory::dim d1 = 0; d1 < dims[1]; d1 += 37)
+                for (memory::dim d2 = 0; d2 < dims[2]; d2 += 41) {
+                    const size_t src_off = (d0 * dims[1] + d1) * dims[2] + d2;
+                    const size_t dst_off = (d0 * dims[2] + d2) * dims[1] + d1;
+                    ASSERT_EQ(dst_ptr[dst_off], src_ptr[src_off]);
+                }
+    }
+    ASSERT_EQ(set_huge_pages_mode(huge_pages_mode::none), status::success);
+}
+
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
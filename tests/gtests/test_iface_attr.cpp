@@ -127,6 +127,32 @@ TEST_F(attr_test_t, TestDeterministic) {
     }
 }
 
+TEST_F(attr_test_t, TestDispatchHint) {
+    dnnl::primitive_attr attr;
+    dispatch_goal goal;
+    int max_threads;
+    // Check the default value
+    attr.get_dispatch_hint(goal, max_threads);
+    ASSERT_EQ(goal, dispatch_goal::any);
+    ASSERT_EQ(max_threads, 0);
+
+    for (auto g : {dispatch_goal::latency, dispatch_goal::throughput,
+                 dispatch_goal::any}) {
+        attr.set_dispatch_hint(g, 4);
+        attr.get_dispatch_hint(goal, max_threads);
+        ASSERT_EQ(goal, g);
+        ASSERT_EQ(max_threads, 4);
+    }
+
+    EXPECT_ANY_THROW(attr.set_dispatch_hint(dispatch_goal::latency, -1));
+
+    // The hint never makes an implementation unavailable
+    engine eng = get_test_engine();
+    memory::desc md({2, 16}, memory::data_type::f32, memory::format_tag::ab);
+    attr.set_dispatch_hint(dispatch_goal::throughput, 1);
+    EXPECT_NO_THROW(matmul::primitive_desc(eng, md, md, md, attr));
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     engine eng = get_test_engine();
 
@@ -517,6 +543,33 @@ TEST_F(attr_test_t, TestPostOpsCheckLimit) {
             memory::desc({1}, data_type::s8, memory::format_tag::a)));
 }
 
+TEST_F(attr_test_t, TestPostOpsScaleShift) {
+    const memory::desc scale_shift_md(
+            {1, 16, 1, 1}, data_type::f32, memory::format_tag::abcd);
+
+    dnnl::post_ops ops;
+    ops.append_scale_shift(scale_shift_md);
+    ASSERT_EQ(ops.len(), 2);
+
+    algorithm alg = algorithm::undef;
+    memory::desc md;
+    ASSERT_EQ(ops.kind(0), primitive::kind::binary);
+    ops.get_params_binary(0, alg, md);
+    ASSERT_EQ(alg, algorithm::binary_mul);
+    ASSERT_EQ(md, scale_shift_md);
+    ASSERT_EQ(ops.kind(1), primitive::kind::binary);
+    ops.get_params_binary(1, alg, md);
+    ASSERT_EQ(alg, algorithm::binary_add);
+    ASSERT_EQ(md, scale_shift_md);
+
+    // Nothing is appended when only one of the entries fits
+    dnnl::post_ops ops_full;
+    for (int i = 0; i < 31; i++)
+        ops_full.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+    EXPECT_ANY_THROW(ops_full.append_scale_shift(scale_shift_md));
+    ASSERT_EQ(ops_full.len(), 31);
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestSumPostOpQuantization) {
 #define ALLOW_UNIMPL(f) \
     EXPECT_NO_THROW( \
@@ -739,6 +739,25 @@ CPU_TEST_F(attr_quantization_test_t, TestReorder) {
     }
 }
 
+CPU_TEST_F(attr_quantization_test_t, TestReorderDynamicQuant) {
+    SKIP_IF(unsupported_data_type(data_type::f8_e4m3),
+            "Engine does not support this data type.");
+    memory::desc src_md {{4, 64}, data_type::f32, tag::ab};
+    memory::desc dst_md {{4, 64}, data_type::f8_e4m3, tag::ab};
+    const int mask = (1 << 0) | (1 << 1);
+
+    primitive_attr attr;
+    attr.set_scales(DNNL_ARG_DST, mask, {1, 32}, data_type::e8m0, false,
+            quantization_mode::dynamic_mx);
+    CHECK_OK(reorder::primitive_desc(eng, src_md, eng, dst_md, attr));
+    attr.set_scales(DNNL_ARG_DST, mask, {1, 16}, data_type::f32, false,
+            quantization_mode::dynamic_fp);
+    CHECK_OK(reorder::primitive_desc(eng, src_md, eng, dst_md, attr));
+    // groups are not supported for static dst scales
+    attr.set_scales(DNNL_ARG_DST, mask, {1, 16}, data_type::f32);
+    CHECK_UNIMPL(reorder::primitive_desc(eng, src_md, eng, dst_md, attr));
+}
+
 TEST_F(attr_quantization_test_t, TestRNN) {
     SKIP_IF_CUDA(true, "RNN primitive not supported for CUDA");
     SKIP_IF_HIP(true, "RNN primitive not supported for HIP");
@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include <vector>
+
+namespace dnnl {
+
+using data_type = memory::data_type;
+using tag = memory::format_tag;
+
+class layout_selection_test_t : public ::testing::Test {
+protected:
+    const engine eng = get_test_engine();
+
+    chain_step conv_step(const memory::desc &wei_md) const {
+        return [=](const memory::desc &src_md, const memory::desc &dst_md) {
+            return primitive_desc(convolution_forward::primitive_desc(eng,
+                    prop_kind::forward_inference,
+                    algorithm::convolution_direct, src_md, wei_md, dst_md,
+                    {1, 1}, {1, 1}, {1, 1}, primitive_attr(), true));
+        };
+    }
+
+    chain_step relu_step() const {
+        return [=](const memory::desc &src_md, const memory::desc &dst_md) {
+            return primitive_desc(eltwise_forward::primitive_desc(eng,
+                    prop_kind::forward_inference, algorithm::eltwise_relu,
+                    src_md, dst_md, 0.f, 0.f, primitive_attr(), true));
+        };
+    }
+
+    // Returns the size in bytes of the reorders a chain of primitive
+    // descriptors needs and counts them.
+    static size_t reorder_bytes(const std::vector<memory::desc> &tensors,
+            const std::vector<primitive_desc> &pds, int &n_reorders) {
+        size_t bytes = 0;
+        n_reorders = 0;
+        auto add = [&](const memory::desc &a, const memory::desc &b) {
+            if (a == b) return;
+            bytes += a.get_size();
+            n_reorders++;
+        };
+        for (size_t t = 0; t < tensors.size(); t++) {
+            const bool is_any = tensors[t].get_format_kind()
+                    == memory::format_kind::any;
+            if (t == 0) {
+                if (!is_any) add(tensors[t], pds[t].src_desc());
+            } else if (t == pds.size()) {
+                if (!is_any) add(pds[t - 1].dst_desc(), tensors[t]);
+            } else if (is_any) {
+                add(pds[t - 1].dst_desc(), pds[t].src_desc());
+            } else {
+                add(pds[t - 1].dst_desc(), tensors[t]);
+                add(tensors[t], pds[t].src_desc());
+            }
+        }
+        return bytes;
+    }
+};
+
+TEST_F(layout_selection_test_t, TestConvReluConv) {
+    SKIP_IF_CUDA(true, "Unsupported memory format for CUDA");
+    SKIP_IF_HIP(true, "Unsupported memory format for HIP");
+
+    const memory::dims act_dims = {2, 32, 14, 14};
+    const memory::desc src_md(act_dims, data_type::f32, tag::nchw);
+    const memory::desc mid_md(act_dims, data_type::f32, tag::any);
+    const memory::desc dst_md(act_dims, data_type::f32, tag::nchw);
+    const memory::desc wei_md({32, 32, 3, 3}, data_type::f32, tag::any);
+
+    const std::vector<memory::desc> tensors
+            = {src_md, mid_md, mid_md, mid_md, dst_md};
+    const std::vector<chain_step> steps
+            = {conv_step(wei_md), relu_step(), conv_step(wei_md), relu_step()};
+
+    chain_layouts layouts;
+    ASSERT_NO_THROW(layouts = select_chain_layouts(tensors, steps));
+    ASSERT_EQ(layouts.pds.size(), steps.size());
+
+    int n_reorders = 0;
+    ASSERT_EQ(layouts.reorder_bytes,
+            reorder_bytes(tensors, layouts.pds, n_reorders));
+    ASSERT_EQ(layouts.n_reorders, n_reorders);
+
+    // The selection is never worse than letting every step choose its
+    // formats independently.
+    std::vector<primitive_desc> independent;
+    for (size_t k = 0; k < steps.size(); k++)
+        independent.push_back(steps[k](mid_md, mid_md));
+    ASSERT_LE(layouts.reorder_bytes,
+            reorder_bytes(tensors, independent, n_reorders));
+}
+
+TEST_F(layout_selection_test_t, TestInvalidArguments) {
+    const memory::desc md({2, 32}, data_type::f32, tag::any);
+    EXPECT_ANY_THROW(select_chain_layouts({md, md}, {}));
+    EXPECT_ANY_THROW(select_chain_layouts({md}, {relu_step()}));
+}
+
+} // namespace dnnl
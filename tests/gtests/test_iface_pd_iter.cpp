@@ -138,4 +138,32 @@ TEST(pd_next_impl, TestEltwiseImpl) {
     ASSERT_EQ(epd.next_impl(), false);
 }
 
+TEST(pd_next_impl, TestSkippedImpls) {
+    SKIP_IF_CUDA(true, "Unsupported memory format for CUDA");
+    SKIP_IF_HIP(true, "Unsupported memory format for HIP");
+    SKIP_IF_GENERIC(true, "Unsupported memory format for Generic");
+    auto eng = get_test_engine();
+    memory::desc md(
+            {8, 32, 4, 4}, memory::data_type::f32, memory::format_tag::nChw8c);
+
+    eltwise_forward::primitive_desc epd(eng, prop_kind::forward_training,
+            algorithm::eltwise_relu, md, md, 0.f);
+
+    do {
+        for (const auto &skipped : epd.get_skipped_impls()) {
+            ASSERT_NE(skipped.status, dnnl_success);
+            ASSERT_FALSE(skipped.impl_info.empty());
+        }
+    } while (epd.next_impl());
+
+    int n_skipped = 0;
+    ASSERT_EQ(dnnl_primitive_desc_query(
+                      epd.get(), dnnl_query_skipped_impls_s32, 0, &n_skipped),
+            dnnl_success);
+    const char *info = nullptr;
+    ASSERT_EQ(dnnl_primitive_desc_query(epd.get(),
+                      dnnl_query_skipped_impl_info_str, n_skipped, &info),
+            dnnl_invalid_arguments);
+}
+
 } // namespace dnnl
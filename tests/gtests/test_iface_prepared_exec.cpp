@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class prepared_exec_test_t : public ::testing::Test {
+protected:
+    static constexpr memory::dim n = 64;
+
+    void SetUp() override {
+        eng = get_test_engine();
+        strm = stream(eng);
+        md = memory::desc({n}, memory::data_type::f32, memory::format_tag::a);
+        pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+                algorithm::eltwise_relu, md, md, 0.f);
+        prim = eltwise_forward(pd);
+    }
+
+    memory make_memory(float first) const {
+        memory mem = test::make_memory(md, eng);
+        auto ptr = map_memory<float>(mem);
+        for (memory::dim i = 0; i < n; i++)
+            ptr[i] = first + (float)i;
+        return mem;
+    }
+
+    // Checks that dst holds relu(src) for a src made with make_memory(first)
+    static void check(const memory &dst, float first) {
+        auto ptr = map_memory<float>(dst);
+        for (memory::dim i = 0; i < n; i++) {
+            const float s = first + (float)i;
+            ASSERT_EQ(ptr[i], s > 0.f ? s : 0.f);
+        }
+    }
+
+    engine eng;
+    stream strm;
+    memory::desc md;
+    eltwise_forward::primitive_desc pd;
+    primitive prim;
+};
+
+TEST_F(prepared_exec_test_t, TestExecute) {
+    memory src = make_memory(-10.f), dst = make_memory(0.f);
+    prepared_exec pexec(prim, strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    for (int i = 0; i < 2; i++) {
+        ASSERT_NO_THROW(pexec.execute());
+        strm.wait();
+        check(dst, -10.f);
+    }
+}
+
+TEST_F(prepared_exec_test_t, TestUpdateHandles) {
+#if defined(DNNL_WITH_SYCL) && defined(TEST_DNNL_DPCPP_BUFFER)
+    // The handles of SYCL buffers are not raw pointers
+    SKIP_IF(get_test_engine_kind() == engine::kind::gpu,
+            "SYCL buffers are not supported");
+#endif
+    memory src = make_memory(-10.f), dst = make_memory(0.f);
+    prepared_exec pexec(prim, strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+
+    // The memory objects only provide the buffers
+    memory src2 = make_memory(-40.f), dst2 = make_memory(0.f);
+    void *src_handle = src.get_data_handle();
+
+    // Only the source handle changes
+    ASSERT_NO_THROW(pexec.execute({src2.get_data_handle(), nullptr}));
+    strm.wait();
+    check(dst, -40.f);
+
+    ASSERT_NO_THROW(pexec.execute({src_handle, dst2.get_data_handle()}));
+    strm.wait();
+    check(dst2, -10.f);
+}
+
+TEST_F(prepared_exec_test_t, TestInvalidArguments) {
+    memory src = make_memory(-10.f), dst = make_memory(0.f);
+    prepared_exec pexec(prim, strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+
+    // More handles than arguments
+    void *h = src.get_data_handle();
+    EXPECT_ANY_THROW(pexec.execute({h, h, h}));
+
+    // A missing argument is caught at the creation
+    EXPECT_ANY_THROW(prepared_exec(prim, strm, {{DNNL_ARG_SRC, src}}));
+}
+
+TEST_F(prepared_exec_test_t, TestCommandList) {
+    memory src = make_memory(-10.f), mid = make_memory(0.f),
+           dst = make_memory(0.f);
+    command_list cmds(strm);
+    cmds.append(prim, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, mid}});
+    cmds.append(prim, {{DNNL_ARG_SRC, mid}, {DNNL_ARG_DST, dst}});
+    for (int i = 0; i < 2; i++) {
+        ASSERT_NO_THROW(cmds.execute());
+        strm.wait();
+        check(dst, -10.f);
+    }
+
+    EXPECT_ANY_THROW(cmds.append(prim, {{DNNL_ARG_SRC, src}}));
+}
+
+TEST_F(prepared_exec_test_t, TestExecuteBatch) {
+    const int nbatch = 7;
+    std::vector<memory> dsts;
+    std::vector<std::unordered_map<int, memory>> args;
+    for (int i = 0; i < nbatch; i++) {
+        dsts.push_back(make_memory(0.f));
+        args.push_back({{DNNL_ARG_SRC, make_memory(-10.f * i)},
+                {DNNL_ARG_DST, dsts.back()}});
+    }
+    ASSERT_NO_THROW(prim.execute_batch(strm, args));
+    strm.wait();
+    for (int i = 0; i < nbatch; i++)
+        check(dsts[i], -10.f * i);
+
+    ASSERT_NO_THROW(prim.execute_batch(strm, {}));
+    args[3].erase(DNNL_ARG_SRC);
+    EXPECT_ANY_THROW(prim.execute_batch(strm, args));
+}
+
+} // namespace dnnl
@@ -127,6 +127,51 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestAsyncCreation) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(4);
+
+    engine eng(get_test_engine_kind(), 0);
+    auto md = memory::desc({2, 1, 1, 1}, dt::f32, tag::nchw);
+    auto relu_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md, 0.f,
+            0.f);
+
+    auto relu_future = make_primitive_async<eltwise_forward>(relu_pd);
+    eltwise_forward relu;
+    ASSERT_NO_THROW(relu = relu_future.get());
+    ASSERT_TRUE(bool(relu));
+    ASSERT_EQ(get_primitive_cache_size(), 1);
+
+    // The primitive created in background is a cache hit.
+    auto relu_sync = eltwise_forward(relu_pd);
+    ASSERT_EQ(get_primitive_cache_size(), 1);
+}
+
+TEST(primitive_cache_test, TestCapacityInBytes) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(32);
+    ASSERT_EQ(get_primitive_cache_capacity_in_bytes(), 0u);
+
+    fill_primitive_cache(16);
+    ASSERT_EQ(get_primitive_cache_size(), 16);
+    const size_t footprint = get_primitive_cache_footprint();
+    ASSERT_GT(footprint, 0u);
+
+    // Halving the budget evicts the least recently used entries.
+    set_primitive_cache_capacity_in_bytes(footprint / 2);
+    ASSERT_LE(get_primitive_cache_footprint(), footprint / 2);
+    ASSERT_LT(get_primitive_cache_size(), 16);
+    ASSERT_GT(get_primitive_cache_size(), 0);
+
+    set_primitive_cache_capacity_in_bytes(0);
+    set_primitive_cache_capacity(0);
+    ASSERT_EQ(get_primitive_cache_footprint(), 0u);
+}
 #endif
 
 } // namespace dnnl
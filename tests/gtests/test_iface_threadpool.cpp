@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2022 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,11 +15,17 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
 #include "oneapi/dnnl/dnnl.hpp"
 #include "oneapi/dnnl/dnnl_threadpool.h"
+#include "oneapi/dnnl/dnnl_threadpool.hpp"
 #include "tests/test_isa_common.hpp"
 
 namespace dnnl {
@@ -74,4 +81,158 @@ TEST_F(threadpool_test_t, TestMaxConcurrencyConcurrent) {
         ASSERT_EQ(r, dnnl_success);
 }
 
+// Threadpool that runs each closure of a parallel_for() call on a thread of
+// its own, so it may report CONCURRENT_TEAM and the implementations may
+// synchronize the closures with barriers.
+class concurrent_team_threadpool_t
+    : public dnnl::threadpool_interop::threadpool_iface {
+public:
+    explicit concurrent_team_threadpool_t(int num_threads)
+        : num_threads_(num_threads) {}
+
+    int get_num_threads() const override { return num_threads_; }
+    bool get_in_parallel() const override { return in_parallel_; }
+    uint64_t get_flags() const override { return CONCURRENT_TEAM; }
+
+    void parallel_for(int n, const std::function<void(int, int)> &fn) override {
+        if (n <= 1 || in_parallel_ || n > num_threads_) {
+            for (int i = 0; i < n; i++)
+                fn(i, n);
+            return;
+        }
+        auto body = [&](int i) {
+            in_parallel_ = true;
+            fn(i, n);
+            in_parallel_ = false;
+        };
+        std::vector<std::thread> team;
+        team.reserve(n - 1);
+        for (int i = 1; i < n; i++)
+            team.emplace_back(body, i);
+        body(0);
+        for (auto &t : team)
+            t.join();
+    }
+
+    void wait() override {}
+
+private:
+    int num_threads_;
+    static thread_local bool in_parallel_;
+};
+
+thread_local bool concurrent_team_threadpool_t::in_parallel_ = false;
+
+// Batch normalization may take a single-pass partition with barriers under a
+// concurrent team, which is checked against a naive reference.
+TEST_F(threadpool_test_t, TestConcurrentTeamBatchNormalization) {
+    int nthr = 0;
+    ASSERT_EQ(dnnl_threadpool_interop_get_max_concurrency(&nthr), dnnl_success);
+    concurrent_team_threadpool_t tp(std::max(nthr, 4));
+
+    engine eng(engine::kind::cpu, 0);
+    stream strm = threadpool_interop::make_stream(eng, &tp);
+
+    const memory::dim N = 3, C = 37, SP = 11 * 13;
+    const float eps = 1e-3f;
+    const auto flags = normalization_flags::use_scale
+            | normalization_flags::use_shift;
+    for (auto tag : {memory::format_tag::nchw, memory::format_tag::nhwc}) {
+        memory::desc data_md({N, C, 11, 13}, memory::data_type::f32, tag);
+        memory::desc stat_md(
+                {C}, memory::data_type::f32, memory::format_tag::a);
+        auto fwd_pd = batch_normalization_forward::primitive_desc(eng,
+                prop_kind::forward_training, data_md, data_md, eps, flags);
+        auto bwd_pd = batch_normalization_backward::primitive_desc(eng,
+                prop_kind::backward, data_md, data_md, data_md, eps, flags,
+                fwd_pd);
+
+        memory src(data_md, eng), dst(data_md, eng), diff_dst(data_md, eng),
+                diff_src(data_md, eng);
+        memory scale(stat_md, eng), shift(stat_md, eng), mean(stat_md, eng),
+                var(stat_md, eng), diff_scale(stat_md, eng),
+                diff_shift(stat_md, eng);
+        memory ws(fwd_pd.workspace_desc(), eng);
+
+        // Both tags are dense, so the (n, c, sp) offset depends on the tag
+        auto off = [&](memory::dim n, memory::dim c, memory::dim sp) {
+            return tag == memory::format_tag::nchw ? (n * C + c) * SP + sp
+                                                   : (n * SP + sp) * C + c;
+        };
+        auto *s = static_cast<float *>(src.get_data_handle());
+        auto *dd = static_cast<float *>(diff_dst.get_data_handle());
+        auto *sc = static_cast<float *>(scale.get_data_handle());
+        auto *sh = static_cast<float *>(shift.get_data_handle());
+        for (memory::dim i = 0; i < N * C * SP; i++) {
+            s[i] = static_cast<float>((i * 7) % 23) / 8.f - 1.f;
+            dd[i] = static_cast<float>((i * 5) % 17) / 8.f - 1.f;
+        }
+        for (memory::dim c = 0; c < C; c++) {
+            sc[c] = 0.5f + static_cast<float>(c % 5) / 4.f;
+            sh[c] = static_cast<float>(c % 3) - 1.f;
+        }
+
+        batch_normalization_forward(fwd_pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_SCALE, scale}, {DNNL_ARG_SHIFT, shift},
+                        {DNNL_ARG_MEAN, mean}, {DNNL_ARG_VARIANCE, var},
+                        {DNNL_ARG_WORKSPACE, ws}});
+        batch_normalization_backward(bwd_pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_DIFF_DST, diff_dst},
+                        {DNNL_ARG_SCALE, scale}, {DNNL_ARG_MEAN, mean},
+                        {DNNL_ARG_VARIANCE, var}, {DNNL_ARG_WORKSPACE, ws},
+                        {DNNL_ARG_DIFF_SRC, diff_src},
+                        {DNNL_ARG_DIFF_SCALE, diff_scale},
+                        {DNNL_ARG_DIFF_SHIFT, diff_shift}});
+        strm.wait();
+
+        const auto *d = static_cast<const float *>(dst.get_data_handle());
+        const auto *ds = static_cast<const float *>(diff_src.get_data_handle());
+        const auto *m = static_cast<const float *>(mean.get_data_handle());
+        const auto *v = static_cast<const float *>(var.get_data_handle());
+        const auto *dsc
+                = static_cast<const float *>(diff_scale.get_data_handle());
+        const auto *dsh
+                = static_cast<const float *>(diff_shift.get_data_handle());
+        for (memory::dim c = 0; c < C; c++) {
+            double ref_m = 0, ref_v = 0;
+            for (memory::dim n = 0; n < N; n++)
+                for (memory::dim sp = 0; sp < SP; sp++)
+                    ref_m += s[off(n, c, sp)];
+            ref_m /= N * SP;
+            for (memory::dim n = 0; n < N; n++)
+                for (memory::dim sp = 0; sp < SP; sp++) {
+                    const double x = s[off(n, c, sp)] - ref_m;
+                    ref_v += x * x;
+                }
+            ref_v /= N * SP;
+            ASSERT_NEAR(m[c], ref_m, 1e-5) << "mean at c " << c;
+            ASSERT_NEAR(v[c], ref_v, 1e-5) << "variance at c " << c;
+
+            const double inv_sd = 1. / std::sqrt(ref_v + eps);
+            double ref_dsh = 0, ref_dsc = 0;
+            for (memory::dim n = 0; n < N; n++)
+                for (memory::dim sp = 0; sp < SP; sp++) {
+                    const auto o = off(n, c, sp);
+                    const double x_hat = (s[o] - ref_m) * inv_sd;
+                    ASSERT_NEAR(d[o], sc[c] * x_hat + sh[c], 1e-5)
+                            << "dst at " << o;
+                    ref_dsh += dd[o];
+                    ref_dsc += dd[o] * x_hat;
+                }
+            ASSERT_NEAR(dsh[c], ref_dsh, 1e-3) << "diff_shift at c " << c;
+            ASSERT_NEAR(dsc[c], ref_dsc, 1e-3) << "diff_scale at c " << c;
+
+            for (memory::dim n = 0; n < N; n++)
+                for (memory::dim sp = 0; sp < SP; sp++) {
+                    const auto o = off(n, c, sp);
+                    const double x_hat = (s[o] - ref_m) * inv_sd;
+                    const double ref_ds = sc[c] * inv_sd
+                            * (dd[o] - (ref_dsh + x_hat * ref_dsc) / (N * SP));
+                    ASSERT_NEAR(ds[o], ref_ds, 1e-4) << "diff_src at " << o;
+                }
+        }
+    }
+}
+
 } // namespace dnnl
@@ -1,5 +1,6 @@
 /*******************************************************************************
 * Copyright 2021 Intel Corporation
+* Copyright 2026 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -177,4 +178,87 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(weights_format_test_t, InnerProductWeightsCheck) {
     }
 }
 
+// Weights reordered ahead of time to the layout of a primitive descriptor may
+// be used as is by primitive descriptors with the same fingerprint.
+HANDLE_EXCEPTIONS_FOR_TEST_F(weights_format_test_t, WeightsFingerprint) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Test requires host-allocated memory.");
+
+    const memory::dim mb = 4, ic = 32, oc = 48;
+    memory::desc src_md {{mb, ic}, data_type::f32, tag::ab};
+    memory::desc wei_any_md {{oc, ic}, data_type::f32, tag::any};
+    memory::desc dst_md {{mb, oc}, data_type::f32, tag::ab};
+    const auto fwd = prop_kind::forward_inference;
+
+    auto pd = inner_product_forward::primitive_desc(
+            eng, fwd, src_md, wei_any_md, dst_md);
+    memory::dim fingerprint = 0;
+    ASSERT_NO_THROW(fingerprint = pd.get_weights_fingerprint());
+
+    // The same problem gets the same fingerprint and weights layout
+    auto pd_same = inner_product_forward::primitive_desc(
+            eng, fwd, src_md, wei_any_md, dst_md);
+    ASSERT_EQ(pd_same.get_weights_fingerprint(), fingerprint);
+    ASSERT_EQ(pd_same.weights_desc(), pd.weights_desc());
+
+    // Another weights layout gets another fingerprint
+    const tag other_tag = pd.weights_desc() == memory::desc({oc, ic},
+                                  data_type::f32, tag::ba)
+            ? tag::ab
+            : tag::ba;
+    auto pd_other = inner_product_forward::primitive_desc(eng, fwd, src_md,
+            memory::desc({oc, ic}, data_type::f32, other_tag), dst_md);
+    ASSERT_NE(pd_other.get_weights_fingerprint(), fingerprint);
+
+    // Weights packed with the first primitive descriptor give the same
+    // results with the second one as the user weights with a plain layout
+    stream strm(eng);
+    memory src(src_md, eng), dst(dst_md, eng), dst_ref(dst_md, eng);
+    memory user_wei({{oc, ic}, data_type::f32, tag::ab}, eng);
+    fill_data<float>(mb * ic, src);
+    fill_data<float>(oc * ic, user_wei);
+    memory packed_wei(pd.weights_desc(), eng);
+    reorder(user_wei, packed_wei).execute(strm, user_wei, packed_wei);
+
+    inner_product_forward(pd_same)
+            .execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, packed_wei},
+                            {DNNL_ARG_DST, dst}});
+    auto pd_plain = inner_product_forward::primitive_desc(
+            eng, fwd, src_md, user_wei.get_desc(), dst_md);
+    inner_product_forward(pd_plain).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, user_wei},
+                    {DNNL_ARG_DST, dst_ref}});
+    strm.wait();
+    compare_data<float>(dst_ref, dst);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(
+        weights_format_test_t, WeightsFingerprintInvalidArguments) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Test requires host-allocated memory.");
+
+    memory::desc md {{2, 16}, data_type::f32, tag::ab};
+    memory::desc wei_md {{8, 16}, data_type::f32, tag::any};
+    memory::desc dst_md {{2, 8}, data_type::f32, tag::ab};
+
+    // The inner product has no bias, so there is no second weights tensor
+    auto ip_pd = inner_product_forward::primitive_desc(
+            eng, prop_kind::forward_inference, md, wei_md, dst_md);
+    EXPECT_NO_THROW(ip_pd.get_weights_fingerprint(0));
+    EXPECT_ANY_THROW(ip_pd.get_weights_fingerprint(1));
+
+    // Primitives without weights have no fingerprint
+    auto eltwise_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md);
+    EXPECT_ANY_THROW(eltwise_pd.get_weights_fingerprint());
+
+    dnnl_dim_t fingerprint = 0;
+    ASSERT_EQ(dnnl_primitive_desc_query(eltwise_pd.get(),
+                      dnnl_query_weights_fingerprint_s64, 0, &fingerprint),
+            dnnl_invalid_arguments);
+}
+
 } // namespace dnnl
@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+// Validates the matmul quantizing a f32 or bf16 source to s8 with dynamic
+// per-row scales against a host reference of the quantization.
+
+namespace dnnl {
+
+using dim = memory::dim;
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+struct matmul_dyn_src_quant_params_t {
+    dt src_dt;
+    dim M, K, N;
+    dim zero_row; // -1 for none
+};
+
+class matmul_dyn_src_quant_test_t
+    : public ::testing::TestWithParam<matmul_dyn_src_quant_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+                "Test requires host-allocated memory.");
+        Test();
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        const dim M = p.M, K = p.K, N = p.N;
+
+        auto eng = get_test_engine();
+        stream strm(eng);
+
+        const memory::desc src_md({M, K}, p.src_dt, tag::ab);
+        const memory::desc wei_md({K, N}, dt::s8, tag::ab);
+        const memory::desc dst_md({M, N}, dt::f32, tag::ab);
+        const memory::desc scales_md({M}, dt::f32, tag::a);
+
+        primitive_attr attr;
+        attr.set_scales(DNNL_ARG_SRC, 1 << 0, {}, dt::f32, false,
+                quantization_mode::dynamic_fp);
+
+        matmul::primitive_desc pd;
+        try {
+            pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+        } catch (error &e) {
+            if (e.status == dnnl_unimplemented)
+                GTEST_SKIP() << "Unimplemented: " << e.what();
+            throw;
+        }
+
+        // The source values as seen by the primitive, i.e. after the
+        // conversion to bf16 when the source is bf16.
+        std::vector<float> src(M * K);
+        for (dim m = 0; m < M; m++)
+            for (dim k = 0; k < K; k++) {
+                const float v = m == p.zero_row
+                        ? 0.f
+                        : float(int((m * 31 + k * 7) % 23) - 11) * 0.37f
+                                * float(m % 3 + 1);
+                src[m * K + k] = p.src_dt == dt::bf16
+                        ? float(bfloat16_t(v))
+                        : v;
+            }
+        std::vector<bfloat16_t> src_bf16(src.begin(), src.end());
+        std::vector<int8_t> wei(K * N);
+        for (dim i = 0; i < K * N; i++)
+            wei[i] = int8_t(int((i * 13) % 255) - 127);
+
+        std::vector<float> dst(M * N, 0.f), scales(M, -1.f);
+        memory src_mem(src_md, eng,
+                p.src_dt == dt::bf16 ? static_cast<void *>(src_bf16.data())
+                                     : static_cast<void *>(src.data()));
+        memory wei_mem(wei_md, eng, wei.data());
+        memory dst_mem(dst_md, eng, dst.data());
+        memory scales_mem(scales_md, eng, scales.data());
+
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                        {DNNL_ARG_DST, dst_mem},
+                        {DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, scales_mem}});
+        strm.wait();
+
+        std::vector<int> q(K);
+        for (dim m = 0; m < M; m++) {
+            float amax = 0.f;
+            for (dim k = 0; k < K; k++)
+                amax = std::max(amax, std::fabs(src[m * K + k]));
+            const float ref_scale = amax == 0.f ? 1.f : amax / 127.f;
+            ASSERT_FLOAT_EQ(scales[m], ref_scale) << "at row " << m;
+
+            const float inv_scale = 1.f / ref_scale;
+            for (dim k = 0; k < K; k++) {
+                const float v = std::nearbyint(src[m * K + k] * inv_scale);
+                q[k] = int(std::min(127.f, std::max(-128.f, v)));
+            }
+            for (dim n = 0; n < N; n++) {
+                int acc = 0;
+                for (dim k = 0; k < K; k++)
+                    acc += q[k] * wei[k * N + n];
+                const float ref = float(acc) * ref_scale;
+                const float eps = 1e-5f * (1.f + std::fabs(ref));
+                ASSERT_NEAR(dst[m * N + n], ref, eps)
+                        << "at " << m << ", " << n;
+            }
+        }
+    }
+};
+
+TEST_P(matmul_dyn_src_quant_test_t, TestsMatmul) {}
+
+// The blocks of the quantized source are 8x8, so M and K have tails unless
+// they are multiples of 8.
+INSTANTIATE_TEST_SUITE_P(TestMatmulDynSrcQuant, matmul_dyn_src_quant_test_t,
+        ::testing::Values(
+                matmul_dyn_src_quant_params_t {dt::f32, 16, 64, 24, -1},
+                matmul_dyn_src_quant_params_t {dt::f32, 13, 45, 19, 5},
+                matmul_dyn_src_quant_params_t {dt::f32, 1, 7, 32, -1},
+                matmul_dyn_src_quant_params_t {dt::bf16, 16, 64, 24, 0},
+                matmul_dyn_src_quant_params_t {dt::bf16, 29, 70, 33, 28}));
+
+} // namespace dnnl
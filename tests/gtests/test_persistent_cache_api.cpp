@@ -62,10 +62,14 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     ASSERT_NO_THROW(cache_blob_id = pd.get_cache_blob_id());
     ASSERT_EQ(cache_blob_id, pd.get_cache_blob_id());
 
-    if (get_test_engine_kind() != engine::kind::gpu
-            || (get_test_engine_kind() == engine::kind::gpu
-                    && (DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL
-                            && DNNL_GPU_RUNTIME != DNNL_RUNTIME_ZE))) {
+    if (get_test_engine_kind() == engine::kind::cpu) {
+        // CPU provides the cache blob ID but not the cache blob.
+        ASSERT_EQ(cache_blob_id.empty(), false);
+        EXPECT_ANY_THROW(cache_blob = p.get_cache_blob());
+        ASSERT_EQ(cache_blob.empty(), true);
+        EXPECT_ANY_THROW(convolution_forward(pd, cache_blob));
+    } else if (DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL
+            && DNNL_GPU_RUNTIME != DNNL_RUNTIME_ZE) {
         ASSERT_EQ(cache_blob_id.empty(), true);
         EXPECT_ANY_THROW(cache_blob = p.get_cache_blob());
         ASSERT_EQ(cache_blob.empty(), true);
@@ -339,9 +339,19 @@ CPU_INSTANTIATE_TEST_SUITE_P(Weights_IOhw16o16i, reorder_simple_test_t_f32_f32,
                 cfg_f32 {fmt::gIOhw16o16i, fmt::gOIhw16i16o,
                         {2, 64, 64, 3, 3}}));
 
+// Transposes of the two innermost dimensions, with edges which don't make
+// whole tiles and matrices spanning several blocks
+CPU_INSTANTIATE_TEST_SUITE_P(Transpose, reorder_simple_test_t_f32_f32,
+        ::testing::Values(cfg_f32 {fmt::ab, fmt::ba, {37, 70}},
+                cfg_f32 {fmt::ba, fmt::ab, {64, 48}},
+                cfg_f32 {fmt::ab, fmt::ba, {515, 300}},
+                cfg_f32 {fmt::abc, fmt::acb, {3, 33, 19}},
+                cfg_f32 {fmt::abdc, fmt::abcd, {2, 3, 40, 17}}));
+
 CPU_INSTANTIATE_TEST_SUITE_P(Simple, reorder_simple_test_t_s32_s32,
         ::testing::Values(cfg_s32 {fmt::nchw, fmt::nChw16c, {2, 64, 4, 4}},
-                cfg_s32 {fmt::nChw16c, fmt::nchw, {2, 64, 4, 4}}));
+                cfg_s32 {fmt::nChw16c, fmt::nchw, {2, 64, 4, 4}},
+                cfg_s32 {fmt::ab, fmt::ba, {100, 41}}));
 
 CPU_INSTANTIATE_TEST_SUITE_P(Simple, reorder_simple_test_t_s8_s8,
         ::testing::Values(cfg_s8 {fmt::oihw, fmt::OIhw4i16o4i, {64, 64, 3, 3}},
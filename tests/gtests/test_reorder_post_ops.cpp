@@ -0,0 +1,150 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+// Validates the eltwise and binary post-ops of the CPU reorder. The plain
+// layouts without zero points take the direct copy reorder, the other cases
+// the reference one.
+
+namespace dnnl {
+
+using dim = memory::dim;
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+struct reorder_post_ops_params_t {
+    tag dst_tag;
+    dt dst_dt;
+    bool with_dst_scale;
+    bool with_dst_zp;
+};
+
+class reorder_post_ops_test_t
+    : public ::testing::TestWithParam<reorder_post_ops_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+                "Test requires host-allocated memory.");
+        Test();
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        const dim N = 2, C = 11, H = 5, W = 7;
+        const dim nelems = N * C * H * W;
+        const float dst_scale = 0.5f;
+        const int dst_zp = 3;
+
+        auto eng = get_test_engine();
+        stream strm(eng);
+
+        const memory::desc src_md({N, C, H, W}, dt::f32, tag::nchw);
+        const memory::desc dst_md({N, C, H, W}, p.dst_dt, p.dst_tag);
+        const memory::desc plain_md({N, C, H, W}, dt::f32, tag::nchw);
+        const memory::desc bin_md({1, C, 1, 1}, dt::f32, tag::nchw);
+
+        // The values are multiples of 1/8 and the computation is exact, so
+        // the reference matches the results bitwise.
+        std::vector<float> src(nelems), bin(C);
+        for (dim i = 0; i < nelems; i++)
+            src[i] = float(int(i % 17) - 8) * 0.25f;
+        for (dim c = 0; c < C; c++)
+            bin[c] = float(c % 3 + 1) * 0.5f;
+
+        post_ops ops;
+        ops.append_eltwise(algorithm::eltwise_relu, 0.5f, 0.f);
+        ops.append_binary(algorithm::binary_mul, bin_md);
+        ops.append_eltwise(algorithm::eltwise_linear, 2.f, 0.25f);
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+        if (p.with_dst_scale) attr.set_scales_mask(DNNL_ARG_DST, 0);
+        if (p.with_dst_zp) attr.set_zero_points_mask(DNNL_ARG_DST, 0);
+
+        reorder::primitive_desc pd;
+        try {
+            pd = reorder::primitive_desc(eng, src_md, eng, dst_md, attr);
+        } catch (error &e) {
+            if (e.status == dnnl_unimplemented)
+                GTEST_SKIP() << "Unimplemented: " << e.what();
+            throw;
+        }
+
+        memory src_mem(src_md, eng, src.data());
+        memory bin_mem(bin_md, eng, bin.data());
+        memory dst_mem(dst_md, eng);
+        float scale = dst_scale;
+        int zp = dst_zp;
+        memory scale_mem({{1}, dt::f32, tag::x}, eng, &scale);
+        memory zp_mem({{1}, dt::s32, tag::x}, eng, &zp);
+
+        std::unordered_map<int, memory> args {{DNNL_ARG_FROM, src_mem},
+                {DNNL_ARG_TO, dst_mem},
+                {DNNL_ARG_ATTR_MULTIPLE_POST_OP(1) | DNNL_ARG_SRC_1,
+                        bin_mem}};
+        if (p.with_dst_scale)
+            args.emplace(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST, scale_mem);
+        if (p.with_dst_zp)
+            args.emplace(DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_DST, zp_mem);
+        reorder(pd).execute(strm, args);
+
+        // The results are read back in the plain layout
+        std::vector<float> dst(nelems);
+        memory plain_mem(plain_md, eng, dst.data());
+        reorder(dst_mem, plain_mem).execute(strm, dst_mem, plain_mem);
+        strm.wait();
+
+        const bool is_int = p.dst_dt == dt::s8 || p.dst_dt == dt::u8;
+        const float lo = p.dst_dt == dt::s8 ? -128.f : 0.f;
+        const float hi = p.dst_dt == dt::s8 ? 127.f : 255.f;
+        for (dim i = 0; i < nelems; i++) {
+            const dim c = (i / (H * W)) % C;
+            float d = src[i] > 0.f ? src[i] : 0.5f * src[i];
+            d *= bin[c];
+            d = 2.f * d + 0.25f;
+            if (p.with_dst_scale) d /= dst_scale;
+            if (p.with_dst_zp) d += float(dst_zp);
+            if (is_int) d = std::min(hi, std::max(lo, std::nearbyint(d)));
+            ASSERT_EQ(dst[i], d) << "at " << i;
+        }
+    }
+};
+
+TEST_P(reorder_post_ops_test_t, TestsReorder) {}
+
+INSTANTIATE_TEST_SUITE_P(TestReorderPostOps, reorder_post_ops_test_t,
+        ::testing::Values(
+                // direct copy
+                reorder_post_ops_params_t {tag::nchw, dt::f32, false, false},
+                reorder_post_ops_params_t {tag::nchw, dt::s8, true, false},
+                // reference
+                reorder_post_ops_params_t {tag::nchw, dt::u8, true, true},
+                reorder_post_ops_params_t {tag::nhwc, dt::f32, false, false},
+                reorder_post_ops_params_t {tag::nChw8c, dt::f32, true, false},
+                reorder_post_ops_params_t {tag::nhwc, dt::s8, true, true},
+                reorder_post_ops_params_t {tag::nChw16c, dt::u8, false, true}));
+
+} // namespace dnnl
@@ -972,4 +972,107 @@ CPU_INSTANTIATE_TEST_SUITE_P(TestAUGRUlbr, lbr_augru_forward_test_f32,
                         test_rnn_sizes_t {1, 1, 1, 1, 1, 1, 1, 1}, true,
                         dnnl_invalid_arguments}));
 
+TEST(rnn_stateful_test_f32, TestsLSTMChunks) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Stateful execution is supported on CPU only");
+
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    const memory::dim l = 2, t = 6, mb = 1, c = 8;
+    const memory::dim t_chunk = t / 2;
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    auto layer_md = [&](memory::dim n_iter) {
+        return memory::desc({n_iter, mb, c}, dt::f32, tag::tnc);
+    };
+    memory::desc iter_md({l, 1, mb, c}, dt::f32, tag::ldnc);
+    memory::desc wei_md({l, 1, c, 4, c}, dt::f32, tag::ldigo);
+    memory::desc bia_md({l, 1, 4, c}, dt::f32, tag::ldgo);
+
+    auto fill = [](const memory &mem, float scale) {
+        auto ptr = map_memory<float>(mem);
+        const size_t nelems = mem.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++) {
+            const int v = static_cast<int>((i * 7) % 13) - 6;
+            ptr[i] = scale * static_cast<float>(v) / 6.f;
+        }
+    };
+
+    memory wei_layer(wei_md, eng), wei_iter(wei_md, eng), bias(bia_md, eng);
+    fill(wei_layer, 0.3f);
+    fill(wei_iter, 0.2f);
+    fill(bias, 0.1f);
+
+    memory src_full(layer_md(t), eng);
+    fill(src_full, 1.f);
+
+    // Reference: the whole sequence in one stateless execution.
+    auto ref_pd = lstm_forward::primitive_desc(eng,
+            prop_kind::forward_inference,
+            rnn_direction::unidirectional_left2right, layer_md(t),
+            memory::desc(), memory::desc(), wei_md, wei_md, bia_md,
+            layer_md(t), iter_md, iter_md);
+    memory ref_dst(layer_md(t), eng), ref_dst_iter(iter_md, eng),
+            ref_dst_iter_c(iter_md, eng);
+    lstm_forward(ref_pd).execute(strm,
+            {{DNNL_ARG_SRC_LAYER, src_full},
+                    {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                    {DNNL_ARG_WEIGHTS_ITER, wei_iter},
+                    {DNNL_ARG_BIAS, bias}, {DNNL_ARG_DST_LAYER, ref_dst},
+                    {DNNL_ARG_DST_ITER, ref_dst_iter},
+                    {DNNL_ARG_DST_ITER_C, ref_dst_iter_c}});
+    strm.wait();
+
+    // The same sequence in two chunks fed to one stateful primitive.
+    auto pd = lstm_forward::primitive_desc(eng, prop_kind::forward_inference,
+            rnn_direction::unidirectional_left2right, layer_md(t_chunk),
+            iter_md, iter_md, wei_md, wei_md, bia_md, layer_md(t_chunk),
+            iter_md, iter_md, rnn_flags::stateful);
+    lstm_forward prim(pd);
+    memory dst(layer_md(t_chunk), eng), dst_iter(iter_md, eng),
+            dst_iter_c(iter_md, eng);
+    for (memory::dim chunk = 0; chunk < 2; chunk++) {
+        memory src(layer_md(t_chunk), eng);
+        {
+            auto src_ptr = map_memory<float>(src);
+            auto full_ptr = map_memory<float>(src_full);
+            const memory::dim chunk_size = t_chunk * mb * c;
+            for (memory::dim i = 0; i < chunk_size; i++)
+                src_ptr[i] = full_ptr[chunk * chunk_size + i];
+        }
+        prim.execute(strm,
+                {{DNNL_ARG_SRC_LAYER, src},
+                        {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                        {DNNL_ARG_WEIGHTS_ITER, wei_iter},
+                        {DNNL_ARG_BIAS, bias}, {DNNL_ARG_DST_LAYER, dst},
+                        {DNNL_ARG_DST_ITER, dst_iter},
+                        {DNNL_ARG_DST_ITER_C, dst_iter_c}});
+        strm.wait();
+    }
+
+    auto check = [](const float *ref, const float *got, memory::dim n,
+                         memory::dim ref_off) {
+        for (memory::dim i = 0; i < n; i++)
+            ASSERT_NEAR(ref[ref_off + i], got[i], 1e-5f) << "index " << i;
+    };
+    {
+        auto ref_ptr = map_memory<float>(ref_dst);
+        auto dst_ptr = map_memory<float>(dst);
+        const memory::dim chunk_size = t_chunk * mb * c;
+        check(ref_ptr, dst_ptr, chunk_size, chunk_size);
+    }
+    {
+        auto ref_ptr = map_memory<float>(ref_dst_iter);
+        auto got_ptr = map_memory<float>(dst_iter);
+        check(ref_ptr, got_ptr, l * mb * c, 0);
+    }
+    {
+        auto ref_ptr = map_memory<float>(ref_dst_iter_c);
+        auto got_ptr = map_memory<float>(dst_iter_c);
+        check(ref_ptr, got_ptr, l * mb * c, 0);
+    }
+}
+
 } // namespace dnnl
@@ -0,0 +1,543 @@
+/*******************************************************************************
+* Copyright 2026 Arm Ltd. and affiliates
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+// Microbenchmarks for the aarch64 JIT building blocks shared by primitives:
+// the eltwise injector, the brgemm matmul copy B kernels and the reorder
+// kernel. Every kernel is called directly on an L1/L2-resident buffer and
+// its cost is reported in cycles and nanoseconds per element.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <linux/perf_event.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "oneapi/dnnl/dnnl.hpp"
+#include "oneapi/dnnl/dnnl_debug.h"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/aarch64/cpu_isa_traits.hpp"
+#include "cpu/aarch64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/aarch64/jit_generator.hpp"
+#include "cpu/aarch64/matmul/brgemm_matmul_copy_utils.hpp"
+#include "cpu/aarch64/matmul/brgemm_matmul_utils.hpp"
+#include "cpu/aarch64/reorder/jit_uni_reorder_kernel.hpp"
+
+#ifndef PR_SVE_SET_VL
+#define PR_SVE_SET_VL 50
+#endif
+#ifndef PR_SVE_SET_VL_ONEXEC
+#define PR_SVE_SET_VL_ONEXEC (1 << 18)
+#endif
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::aarch64;
+
+namespace {
+
+// The environment variable marks the process started with a requested VL to
+// not restart it again when the kernel picked another length.
+const char *vl_env_name = "DNNL_MICROBENCH_VL_SET";
+
+struct options_t {
+    std::vector<int> vls; // in bits
+    std::string kernel = "all";
+    int reps = 100;
+    int samples = 10;
+    bool header = true;
+};
+
+options_t opts;
+
+// Counts the user-space cycles of the calling thread only, so that idle
+// threads of the runtime do not contribute to the measurements.
+struct cycle_counter_t {
+    cycle_counter_t() {
+        perf_event_attr pe;
+        std::memset(&pe, 0, sizeof(pe));
+        pe.type = PERF_TYPE_HARDWARE;
+        pe.size = sizeof(pe);
+        pe.config = PERF_COUNT_HW_CPU_CYCLES;
+        pe.exclude_kernel = 1;
+        pe.exclude_hv = 1;
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &pe, 0, -1, -1, 0));
+    }
+    ~cycle_counter_t() {
+        if (fd_ >= 0) close(fd_);
+    }
+
+    bool is_available() const { return fd_ >= 0; }
+
+    uint64_t read_value() const {
+        uint64_t value = 0;
+        if (!is_available()
+                || read(fd_, &value, sizeof(value)) != sizeof(value))
+            return 0;
+        return value;
+    }
+
+private:
+    int fd_ = -1;
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cycle_counter_t);
+};
+
+bool kernel_enabled(const char *kernel) {
+    return opts.kernel == "all" || opts.kernel == kernel;
+}
+
+int current_vl() {
+    return static_cast<int>(get_sve_length() * 8);
+}
+
+// Reports the minimum over the samples, each sample averaging `reps` calls.
+template <typename F>
+void run_case(const cycle_counter_t &counter, const char *kernel,
+        const std::string &name, size_t elems, const F &f) {
+    for (int r = 0; r < opts.reps; r++)
+        f();
+
+    double best_cycles = -1, best_ns = -1;
+    for (int s = 0; s < opts.samples; s++) {
+        const uint64_t c0 = counter.read_value();
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < opts.reps; r++)
+            f();
+        const auto t1 = std::chrono::steady_clock::now();
+        const uint64_t c1 = counter.read_value();
+
+        const double ns = std::chrono::duration<double, std::nano>(t1 - t0)
+                                  .count()
+                / opts.reps;
+        const double cycles = static_cast<double>(c1 - c0) / opts.reps;
+        if (best_ns < 0 || ns < best_ns) best_ns = ns;
+        if (best_cycles < 0 || cycles < best_cycles) best_cycles = cycles;
+    }
+
+    if (counter.is_available())
+        printf("%s,%s,%d,%zu,%.3f,%.3f\n", kernel, name.c_str(), current_vl(),
+                elems, best_cycles / elems, best_ns / elems);
+    else
+        printf("%s,%s,%d,%zu,-,%.3f\n", kernel, name.c_str(), current_vl(),
+                elems, best_ns / elems);
+}
+
+void skip_case(const char *kernel, const std::string &name, const char *why) {
+    printf("# skipped: %s,%s,%d: %s\n", kernel, name.c_str(), current_vl(),
+            why);
+}
+
+// Applies the injector to `work_amount` floats, one full vector at a time.
+struct eltwise_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(microbench_eltwise_kernel_t)
+
+    struct call_params_t {
+        const float *src;
+        float *dst;
+        size_t work_amount;
+    };
+
+    eltwise_kernel_t(alg_kind_t alg, float alpha, float beta) {
+        injector_.reset(new jit_uni_eltwise_injector_t<sve>(this, alg, alpha,
+                beta, 1.f, false, reg_table, p_mask, p_tmp0, true, false,
+                true, true));
+    }
+
+    void generate() override {
+        using namespace Xbyak_aarch64;
+#define GET_OFF(field) offsetof(call_params_t, field)
+        preamble();
+        add_imm(X_TMP_0, param1, GET_OFF(src), X_TMP_1);
+        ldr(reg_src, ptr(X_TMP_0));
+        add_imm(X_TMP_0, param1, GET_OFF(dst), X_TMP_1);
+        ldr(reg_dst, ptr(X_TMP_0));
+        add_imm(X_TMP_0, param1, GET_OFF(work_amount), X_TMP_1);
+        ldr(reg_work_amount, ptr(X_TMP_0));
+#undef GET_OFF
+        injector_->load_table_addr();
+
+        const int simd_w = static_cast<int>(get_sve_length(data_type::f32));
+        Label loop;
+        L(loop);
+        ld1w(vmm_src.s, P_ALL_ONE / T_z, ptr(reg_src));
+        injector_->compute_vector(vmm_src.getIdx());
+        st1w(vmm_src.s, P_ALL_ONE, ptr(reg_dst));
+        add_imm(reg_src, reg_src, get_sve_length(), X_TMP_0);
+        add_imm(reg_dst, reg_dst, get_sve_length(), X_TMP_0);
+        sub_imm(reg_work_amount, reg_work_amount, simd_w, X_TMP_0);
+        cmp(reg_work_amount, 0);
+        b(GT, loop);
+        postamble();
+
+        injector_->prepare_table();
+    }
+
+private:
+    Xbyak_aarch64::XReg reg_src = x11;
+    Xbyak_aarch64::XReg reg_dst = x8;
+    Xbyak_aarch64::XReg reg_table = x9;
+    Xbyak_aarch64::XReg reg_work_amount = x6;
+    Xbyak_aarch64::PReg p_mask = p1;
+    Xbyak_aarch64::PReg p_tmp0 = p4;
+    Xbyak_aarch64::ZReg vmm_src {1};
+
+    std::unique_ptr<jit_uni_eltwise_injector_t<sve>> injector_;
+};
+
+void bench_eltwise(const cycle_counter_t &counter) {
+    using namespace alg_kind;
+    struct eltwise_case_t {
+        alg_kind_t alg;
+        float alpha, beta;
+        bool positive_src;
+    };
+    const eltwise_case_t cases[] = {
+            {eltwise_relu, 0.f, 0.f, false},
+            {eltwise_relu, 0.1f, 0.f, false},
+            {eltwise_tanh, 0.f, 0.f, false},
+            {eltwise_elu, 1.f, 0.f, false},
+            {eltwise_square, 0.f, 0.f, false},
+            {eltwise_abs, 0.f, 0.f, false},
+            {eltwise_sqrt, 0.f, 0.f, true},
+            {eltwise_linear, 2.f, 1.f, false},
+            {eltwise_soft_relu, 1.f, 0.f, false},
+            {eltwise_logistic, 0.f, 0.f, false},
+            {eltwise_exp, 0.f, 0.f, false},
+            {eltwise_gelu_tanh, 0.f, 0.f, false},
+            {eltwise_swish, 1.f, 0.f, false},
+            {eltwise_log, 0.f, 0.f, true},
+            {eltwise_clip, -1.f, 1.f, false},
+            {eltwise_clip_v2, -1.f, 1.f, false},
+            {eltwise_pow, 1.f, 0.5f, true},
+            {eltwise_gelu_erf, 0.f, 0.f, false},
+            {eltwise_round, 0.f, 0.f, false},
+            {eltwise_mish, 0.f, 0.f, false},
+            {eltwise_hardswish, 1.f / 6.f, 0.5f, false},
+            {eltwise_hardsigmoid, 1.f / 6.f, 0.5f, false},
+    };
+
+    // 16 KB per buffer keeps both source and destination in L1.
+    const size_t nelems = 4096;
+    std::vector<float> src(nelems), dst(nelems);
+
+    for (const auto &c : cases) {
+        const std::string name = std::string(dnnl_alg_kind2str(c.alg))
+                + ":alpha=" + std::to_string(c.alpha);
+        if (!eltwise_injector::is_supported(sve, c.alg)) {
+            skip_case("eltwise", name, "unsupported algorithm");
+            continue;
+        }
+
+        for (size_t i = 0; i < nelems; i++) {
+            const float x = static_cast<float>(i % 97) / 97.f;
+            src[i] = c.positive_src ? 0.5f + 1.5f * x : 8.f * x - 4.f;
+        }
+
+        eltwise_kernel_t ker(c.alg, c.alpha, c.beta);
+        if (ker.create_kernel() != status::success) {
+            skip_case("eltwise", name, "kernel generation failed");
+            continue;
+        }
+
+        eltwise_kernel_t::call_params_t p;
+        p.src = src.data();
+        p.dst = dst.data();
+        p.work_amount = nelems;
+        run_case(counter, "eltwise", name, nelems, [&]() { ker(&p); });
+    }
+}
+
+void bench_copy_b(const cycle_counter_t &counter) {
+    using namespace format_tag;
+    const dim_t N = 256;
+    const dim_t K = 16;
+    const dim_t n_blks[] = {16, 64};
+    const format_tag_t tags[] = {ab, ba};
+
+    for (const auto tag : tags)
+        for (const auto n_blk : n_blks) {
+            const bool is_trans = tag == ba;
+            const std::string name = std::string(is_trans ? "f32:ba" : "f32:ab")
+                    + ":K=" + std::to_string(K) + ":N=" + std::to_string(N)
+                    + ":n_blk=" + std::to_string(n_blk);
+            // The transposed kernel is implemented for 256 and 512-bit only.
+            if (is_trans && !mayiuse(sve_256)) {
+                skip_case("copy_b", name, "unsupported vector length");
+                continue;
+            }
+
+            const dim_t in_ld = is_trans ? K : N;
+            matmul::brgemm_matmul_conf_t conf;
+            if (matmul::init_conf(conf, 1, 0, K, N, in_ld, n_blk,
+                        data_type::f32, data_type::f32, tag)
+                    != status::success) {
+                skip_case("copy_b", name, "unsupported configuration");
+                continue;
+            }
+
+            std::unique_ptr<matmul::jit_brgemm_matmul_copy_b_t> ker;
+            if (matmul::create_brgemm_matmul_copy_b(ker, &conf)
+                    != status::success) {
+                skip_case("copy_b", name, "kernel generation failed");
+                continue;
+            }
+
+            const dim_t k_blks = utils::div_up(K, conf.K_blk);
+            std::vector<float> src(N * K, 1.f);
+            std::vector<float> dst(utils::rnd_up(N, n_blk) * k_blks
+                    * conf.K_blk);
+            const dim_t k_stride = is_trans ? 1 : in_ld;
+            const dim_t n_stride = is_trans ? in_ld : 1;
+
+            auto copy = [&]() {
+                matmul::jit_brgemm_matmul_copy_b_t::ctx_t ctx;
+                std::memset(&ctx, 0, sizeof(ctx));
+                for (dim_t nb = 0; nb < N / n_blk; nb++)
+                    for (dim_t kb = 0; kb < k_blks; kb++) {
+                        const dim_t k = kb * conf.K_blk;
+                        ctx.src = &src[k * k_stride + nb * n_blk * n_stride];
+                        ctx.tr_src = &dst[(nb * k_blks + kb) * conf.K_blk
+                                * n_blk];
+                        ctx.current_K_start = k;
+                        ctx.current_K_iters = std::min(conf.K_blk, K - k);
+                        ctx.current_N_blk = n_blk;
+                        (*ker)(&ctx);
+                    }
+            };
+            run_case(counter, "copy_b", name, N * K, copy);
+        }
+}
+
+void bench_reorder(const cycle_counter_t &counter) {
+    using tag = dnnl::memory::format_tag;
+    using dt = dnnl::memory::data_type;
+    struct reorder_case_t {
+        const char *name;
+        dnnl::memory::dims dims;
+        dt sdt;
+        tag stag;
+        dt ddt;
+        tag dtag;
+    };
+    const reorder_case_t cases[] = {
+            {"f32:ab->f32:ba", {64, 256}, dt::f32, tag::ab, dt::f32, tag::ba},
+            {"f32:abcd->f32:acdb", {4, 64, 8, 8}, dt::f32, tag::abcd, dt::f32,
+                    tag::acdb},
+            {"f32:abcd->f32:aBcd16b", {4, 64, 8, 8}, dt::f32, tag::abcd,
+                    dt::f32, tag::aBcd16b},
+            {"f32:ab->bf16:ab", {64, 256}, dt::f32, tag::ab, dt::bf16, tag::ab},
+            {"f32:ab->s8:ab", {64, 256}, dt::f32, tag::ab, dt::s8, tag::ab},
+    };
+
+    for (const auto &c : cases) {
+        std::string name = c.name;
+        for (size_t d = 0; d < c.dims.size(); d++)
+            name += (d ? "x" : ":") + std::to_string(c.dims[d]);
+
+        const dnnl::memory::desc src_md(c.dims, c.sdt, c.stag);
+        const dnnl::memory::desc dst_md(c.dims, c.ddt, c.dtag);
+        primitive_attr_t attr;
+
+        tr::prb_t prb;
+        if (tr::prb_init(prb, *src_md.get(), *dst_md.get(), &attr)
+                != status::success) {
+            skip_case("reorder", name, "unsupported problem");
+            continue;
+        }
+        tr::prb_block_for_cache(prb);
+        int ndims_ker_max = 0;
+        tr::prb_thread_kernel_balance(prb, ndims_ker_max, 1);
+        if (prb.is_tail_present) {
+            skip_case("reorder", name, "tails are not supported");
+            continue;
+        }
+
+        tr::kernel_t::desc_t desc;
+        if (tr::kernel_t::desc_init(desc, prb, ndims_ker_max)
+                != status::success) {
+            skip_case("reorder", name, "unsupported kernel problem");
+            continue;
+        }
+        std::unique_ptr<tr::kernel_t> ker(tr::kernel_t::create(desc));
+        if (!ker || ker->create_kernel() != status::success) {
+            skip_case("reorder", name, "kernel generation failed");
+            continue;
+        }
+
+        std::vector<char> src(src_md.get_size()), dst(dst_md.get_size());
+        for (size_t i = 0; i < src.size(); i += sizeof(float)) {
+            const float v = static_cast<float>(i % 13);
+            std::memcpy(&src[i], &v, sizeof(float));
+        }
+
+        // The outer nodes that the kernel does not cover are iterated here,
+        // which matches the single-threaded reorder driver.
+        const int ndims_ker = desc.prb.ndims;
+        const size_t itype_sz = types::data_type_size(prb.itype);
+        const size_t otype_sz = types::data_type_size(prb.otype);
+        size_t work = 1;
+        for (int d = ndims_ker; d < prb.ndims; d++)
+            work *= prb.nodes[d].n;
+
+        auto reorder = [&]() {
+            tr::call_param_t p;
+            for (size_t iw = 0; iw < work; iw++) {
+                ptrdiff_t ioff = prb.ioff, ooff = prb.ooff;
+                size_t rem = iw;
+                for (int d = ndims_ker; d < prb.ndims; d++) {
+                    const auto idx
+                            = static_cast<ptrdiff_t>(rem % prb.nodes[d].n);
+                    rem /= prb.nodes[d].n;
+                    ioff += idx * prb.nodes[d].is;
+                    ooff += idx * prb.nodes[d].os;
+                }
+                p.in = &src[ioff * itype_sz];
+                p.out = &dst[ooff * otype_sz];
+                (*ker)(&p);
+            }
+        };
+        run_case(counter, "reorder", name, src_md.get_size() / itype_sz,
+                reorder);
+    }
+}
+
+void run() {
+    const cycle_counter_t counter;
+    if (!counter.is_available())
+        printf("# cycle counter is not available, only time is reported\n");
+    if (kernel_enabled("eltwise")) bench_eltwise(counter);
+    if (kernel_enabled("copy_b")) bench_copy_b(counter);
+    if (kernel_enabled("reorder")) bench_reorder(counter);
+    fflush(stdout);
+}
+
+// Runs the benchmarks in a child process started with the requested VL, as
+// the VL may only be changed safely before the process starts.
+int run_with_vl(int vl, int argc, char **argv) {
+    const pid_t pid = fork();
+    if (pid < 0) return 1;
+    if (pid == 0) {
+        std::vector<std::string> args;
+        args.emplace_back(argv[0]);
+        for (int i = 1; i < argc; i++) {
+            if (std::strncmp(argv[i], "--sve-vl=", 9) == 0) continue;
+            args.emplace_back(argv[i]);
+        }
+        args.emplace_back("--sve-vl=" + std::to_string(vl));
+        args.emplace_back("--no-header");
+
+        std::vector<char *> new_argv;
+        for (auto &a : args)
+            new_argv.push_back(&a[0]);
+        new_argv.push_back(nullptr);
+
+        setenv(vl_env_name, "1", 1);
+        if (prctl(PR_SVE_SET_VL, (vl / 8) | PR_SVE_SET_VL_ONEXEC) < 0) {
+            printf("# skipped: vl=%d: cannot set the vector length\n", vl);
+            fflush(stdout);
+            _exit(0);
+        }
+        execv("/proc/self/exe", new_argv.data());
+        _exit(1);
+    }
+
+    int wstatus = 0;
+    if (waitpid(pid, &wstatus, 0) < 0) return 1;
+    return WIFEXITED(wstatus) ? WEXITSTATUS(wstatus) : 1;
+}
+
+void print_help() {
+    printf("Usage: microbench_aarch64 [options]\n"
+           "  --kernel=all|eltwise|copy_b|reorder  kernels to run (all)\n"
+           "  --sve-vl=VL[,VL...]  SVE vector lengths in bits (current)\n"
+           "  --reps=N             calls per sample (100)\n"
+           "  --samples=N          samples to take the minimum of (10)\n");
+}
+
+bool parse_options(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&](const char *opt) {
+            return arg.substr(std::strlen(opt));
+        };
+        if (arg.compare(0, 9, "--kernel=") == 0) {
+            opts.kernel = value("--kernel=");
+        } else if (arg.compare(0, 9, "--sve-vl=") == 0) {
+            std::string list = value("--sve-vl=");
+            size_t pos = 0;
+            while (pos != std::string::npos) {
+                const size_t next = list.find(',', pos);
+                const int vl = std::atoi(list.substr(pos, next - pos).c_str());
+                if (vl < 128 || vl > 2048 || vl % 128) return false;
+                opts.vls.push_back(vl);
+                pos = next == std::string::npos ? next : next + 1;
+            }
+        } else if (arg.compare(0, 7, "--reps=") == 0) {
+            opts.reps = std::atoi(value("--reps=").c_str());
+        } else if (arg.compare(0, 10, "--samples=") == 0) {
+            opts.samples = std::atoi(value("--samples=").c_str());
+        } else if (arg == "--no-header") {
+            opts.header = false;
+        } else {
+            return false;
+        }
+    }
+    return opts.reps > 0 && opts.samples > 0
+            && utils::one_of(opts.kernel, "all", "eltwise", "copy_b",
+                    "reorder");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (!parse_options(argc, argv)) {
+        print_help();
+        return 1;
+    }
+    if (!mayiuse(sve)) {
+        printf("# SVE is not available\n");
+        return 0;
+    }
+
+    if (opts.header) printf("kernel,case,vl,elems,cycles/elem,ns/elem\n");
+    fflush(stdout);
+
+    if (opts.vls.empty()) opts.vls.push_back(current_vl());
+    int status = 0;
+    for (const int vl : opts.vls) {
+        if (vl == current_vl()) {
+            run();
+        } else if (getenv(vl_env_name)) {
+            // The kernel set the closest supported length instead.
+            printf("# skipped: vl=%d: not supported, got vl=%d\n", vl,
+                    current_vl());
+        } else {
+            status |= run_with_vl(vl, argc, argv);
+        }
+    }
+    return status;
+}
@@ -59,7 +59,6 @@ void *thr_ctx_t::get_interop_obj() const {
 
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 
-#if !defined(DNNL_TEST_THREADPOOL_USE_TBB)
 
 #include "src/cpu/platform.hpp"
 namespace dnnl {
@@ -92,7 +91,281 @@ inline int read_num_threads_from_env() {
 } // namespace
 } // namespace testing
 } // namespace dnnl
-#endif // !defined(DNNL_TEST_THREADPOOL_USE_TBB)
+
+#include "src/common/counting_barrier.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+
+namespace dnnl {
+namespace testing {
+
+// Naiive synchronous threadpool:
+// - Only a single parallel_for is executed at the same time.
+// - Recursive parallel_for results in sequential execution.
+// - The jobs of a parallel_for are split between the threads statically.
+class fixed_threadpool_t : public dnnl::threadpool_interop::threadpool_iface {
+public:
+    using task_func = std::function<void(int, int)>;
+
+    explicit fixed_threadpool_t(int num_threads = 0) {
+        if (num_threads <= 0) num_threads = read_num_threads_from_env();
+        num_threads_ = num_threads;
+        master_sense_ = 0;
+
+        for (int i = 0; i < 2; i++) {
+            tasks_[i].go_flag.store(0);
+            tasks_[i].fn = nullptr;
+            tasks_[i].n = 0;
+        }
+
+        barrier_init();
+        workers_.reset(new std::vector<worker_data_t>(num_threads_));
+        for (int i = 0; i < num_threads_; i++) {
+            auto wd = &workers_->at(i);
+            wd->thread_id = i;
+            wd->tp = this;
+            wd->thread.reset(new std::thread(worker_loop, &workers_->at(i)));
+        }
+        barrier_wait();
+    }
+
+    ~fixed_threadpool_t() override {
+        std::unique_lock<std::mutex> l(master_mutex_);
+        barrier_init();
+        task_submit(nullptr, 0);
+        for (int i = 0; i < num_threads_; i++)
+            workers_->at(i).thread->join();
+        barrier_wait();
+    }
+
+    int get_num_threads() const override { return num_threads_; }
+
+    bool get_in_parallel() const override { return worker_self() != nullptr; }
+
+    uint64_t get_flags() const override { return 0; }
+
+    void parallel_for(int n, const task_func &fn) override {
+        if (worker_self() != nullptr)
+            task_execute(0, 1, &fn, n);
+        else {
+            std::unique_lock<std::mutex> l(master_mutex_);
+            barrier_init();
+            task_submit(&fn, n);
+            barrier_wait();
+        }
+    }
+
+    void wait() override {}
+
+private:
+    int num_threads_;
+    std::mutex master_mutex_;
+    std::mutex master_submit_mutex_;
+
+    struct worker_data_t {
+        int thread_id;
+        fixed_threadpool_t *tp;
+        std::condition_variable cv;
+        std::unique_ptr<std::thread> thread;
+    };
+    std::unique_ptr<std::vector<worker_data_t>> workers_;
+    static thread_local worker_data_t *worker_self_;
+    worker_data_t *worker_self() const {
+        return worker_self_ != nullptr && worker_self_->tp == this
+                ? worker_self_
+                : nullptr;
+    }
+
+    struct task_data_t {
+        std::atomic<int> go_flag;
+        const task_func *fn;
+        int n;
+    };
+    int master_sense_;
+    task_data_t tasks_[2];
+
+    dnnl::impl::counting_barrier_t barrier_;
+
+    void barrier_init() { barrier_.init(num_threads_); }
+
+    void barrier_wait() {
+        barrier_.wait();
+        tasks_[master_sense_].go_flag.store(0);
+        master_sense_ = !master_sense_;
+    }
+
+    void barrier_notify(int worker_sense) { barrier_.notify(); }
+
+    void task_submit(const task_func *fn, int n) {
+        std::lock_guard<std::mutex> l(master_submit_mutex_);
+        tasks_[master_sense_].fn = fn;
+        tasks_[master_sense_].n = n;
+        tasks_[master_sense_].go_flag.store(1);
+        for (int i = 0; i < num_threads_; i++) {
+            workers_->at(i).cv.notify_one();
+        }
+    }
+
+    void task_execute(int ithr, int nthr, const task_func *fn, int n) {
+        if (fn != nullptr && n > 0) {
+            int start, end;
+            impl::balance211(n, nthr, ithr, start, end);
+            for (int i = start; i < end; i++)
+                (*fn)(i, n);
+        }
+    }
+
+    static void worker_loop(worker_data_t *wd) {
+        worker_self_ = wd;
+        int worker_sense = 0;
+
+        wd->tp->barrier_notify(worker_sense);
+
+        bool time_to_exit = false;
+        std::unique_lock<std::mutex> l(wd->tp->master_submit_mutex_);
+
+        do {
+            worker_sense = !worker_sense;
+            auto *t = &wd->tp->tasks_[worker_sense];
+            wd->tp->workers_->at(wd->thread_id).cv.wait(l, [t]() {
+                return t->go_flag.load() != 0;
+            });
+            wd->tp->task_execute(
+                    wd->thread_id, wd->tp->num_threads_, t->fn, t->n);
+            time_to_exit = t->fn == nullptr;
+            wd->tp->barrier_notify(worker_sense);
+        } while (!time_to_exit);
+    }
+};
+
+thread_local fixed_threadpool_t::worker_data_t *fixed_threadpool_t::worker_self_
+        = nullptr;
+
+// Threadpool balancing the jobs dynamically:
+// - The threads and the caller take the jobs of a parallel_for one by one from
+//   a shared counter, so the faster threads take more of them, as they would
+//   steal them in a work-stealing pool.
+// - Several parallel_for calls may run at the same time.
+// - Recursive parallel_for results in sequential execution.
+class dynamic_threadpool_t : public dnnl::threadpool_interop::threadpool_iface {
+public:
+    using task_func = std::function<void(int, int)>;
+
+    explicit dynamic_threadpool_t(int num_threads = 0) {
+        if (num_threads <= 0) num_threads = read_num_threads_from_env();
+        num_threads_ = num_threads;
+        // The caller is one of the threads executing a parallel_for.
+        for (int i = 1; i < num_threads_; i++)
+            workers_.emplace_back(&dynamic_threadpool_t::worker_loop, this);
+    }
+
+    ~dynamic_threadpool_t() override {
+        {
+            std::lock_guard<std::mutex> l(mutex_);
+            time_to_exit_ = true;
+        }
+        cv_.notify_all();
+        for (auto &w : workers_)
+            w.join();
+    }
+
+    int get_num_threads() const override { return num_threads_; }
+
+    bool get_in_parallel() const override { return current_ == this; }
+
+    uint64_t get_flags() const override { return 0; }
+
+    void parallel_for(int n, const task_func &fn) override {
+        if (n <= 0) return;
+        if (get_in_parallel() || n == 1 || num_threads_ == 1) {
+            for (int i = 0; i < n; i++)
+                fn(i, n);
+            return;
+        }
+
+        auto loop = std::make_shared<loop_t>(&fn, n);
+        {
+            std::lock_guard<std::mutex> l(mutex_);
+            loops_.push_back(loop);
+        }
+        cv_.notify_all();
+
+        run_loop(*loop);
+
+        std::unique_lock<std::mutex> l(mutex_);
+        done_cv_.wait(l, [&]() { return loop->done.load() == n; });
+        auto it = std::find(loops_.begin(), loops_.end(), loop);
+        if (it != loops_.end()) loops_.erase(it);
+    }
+
+    void wait() override {}
+
+private:
+    struct loop_t {
+        loop_t(const task_func *fn, int n) : fn(fn), n(n) {}
+        const task_func *fn;
+        const int n;
+        std::atomic<int> next {0};
+        std::atomic<int> done {0};
+    };
+
+    int num_threads_;
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable done_cv_;
+    // The loops with jobs that may not be taken yet.
+    std::deque<std::shared_ptr<loop_t>> loops_;
+    bool time_to_exit_ = false;
+    static thread_local const dynamic_threadpool_t *current_;
+
+    void run_loop(loop_t &loop) {
+        const auto *prev = current_;
+        current_ = this;
+        int n_executed = 0;
+        for (int i = loop.next++; i < loop.n; i = loop.next++) {
+            (*loop.fn)(i, loop.n);
+            n_executed++;
+        }
+        current_ = prev;
+
+        if (n_executed
+                && loop.done.fetch_add(n_executed) + n_executed == loop.n) {
+            std::lock_guard<std::mutex> l(mutex_);
+            done_cv_.notify_all();
+        }
+    }
+
+    void worker_loop() {
+        std::unique_lock<std::mutex> l(mutex_);
+        while (true) {
+            cv_.wait(l, [this]() { return time_to_exit_ || !loops_.empty(); });
+            if (time_to_exit_) return;
+
+            auto loop = loops_.front();
+            if (loop->next.load() >= loop->n) {
+                loops_.pop_front();
+                continue;
+            }
+            l.unlock();
+            run_loop(*loop);
+            l.lock();
+        }
+    }
+};
+
+thread_local const dynamic_threadpool_t *dynamic_threadpool_t::current_
+        = nullptr;
+
+} // namespace testing
+} // namespace dnnl
+
 
 #if defined(DNNL_TEST_THREADPOOL_USE_EIGEN)
 
@@ -307,156 +580,9 @@ public:
 
 #else
 
-#include "src/common/counting_barrier.hpp"
-
-#include <atomic>
-#include <thread>
-#include <vector>
-#include <condition_variable>
-
 namespace dnnl {
 namespace testing {
-
-// Naiive synchronous threadpool:
-// - Only a single parallel_for is executed at the same time.
-// - Recursive parallel_for results in sequential execution.
-class threadpool_t : public dnnl::threadpool_interop::threadpool_iface {
-public:
-    using task_func = std::function<void(int, int)>;
-
-    explicit threadpool_t(int num_threads = 0) {
-        if (num_threads <= 0) num_threads = read_num_threads_from_env();
-        num_threads_ = num_threads;
-        master_sense_ = 0;
-
-        for (int i = 0; i < 2; i++) {
-            tasks_[i].go_flag.store(0);
-            tasks_[i].fn = nullptr;
-            tasks_[i].n = 0;
-        }
-
-        barrier_init();
-        workers_.reset(new std::vector<worker_data_t>(num_threads_));
-        for (int i = 0; i < num_threads_; i++) {
-            auto wd = &workers_->at(i);
-            wd->thread_id = i;
-            wd->tp = this;
-            wd->thread.reset(new std::thread(worker_loop, &workers_->at(i)));
-        }
-        barrier_wait();
-    }
-
-    ~threadpool_t() override {
-        std::unique_lock<std::mutex> l(master_mutex_);
-        barrier_init();
-        task_submit(nullptr, 0);
-        for (int i = 0; i < num_threads_; i++)
-            workers_->at(i).thread->join();
-        barrier_wait();
-    }
-
-    int get_num_threads() const override { return num_threads_; }
-
-    bool get_in_parallel() const override { return worker_self() != nullptr; }
-
-    uint64_t get_flags() const override { return 0; }
-
-    void parallel_for(int n, const task_func &fn) override {
-        if (worker_self() != nullptr)
-            task_execute(0, 1, &fn, n);
-        else {
-            std::unique_lock<std::mutex> l(master_mutex_);
-            barrier_init();
-            task_submit(&fn, n);
-            barrier_wait();
-        }
-    }
-
-    void wait() override {}
-
-private:
-    int num_threads_;
-    std::mutex master_mutex_;
-    std::mutex master_submit_mutex_;
-
-    struct worker_data_t {
-        int thread_id;
-        threadpool_t *tp;
-        std::condition_variable cv;
-        std::unique_ptr<std::thread> thread;
-    };
-    std::unique_ptr<std::vector<worker_data_t>> workers_;
-    static thread_local worker_data_t *worker_self_;
-    worker_data_t *worker_self() const {
-        return worker_self_ != nullptr && worker_self_->tp == this
-                ? worker_self_
-                : nullptr;
-    }
-
-    struct task_data_t {
-        std::atomic<int> go_flag;
-        const task_func *fn;
-        int n;
-    };
-    int master_sense_;
-    task_data_t tasks_[2];
-
-    dnnl::impl::counting_barrier_t barrier_;
-
-    void barrier_init() { barrier_.init(num_threads_); }
-
-    void barrier_wait() {
-        barrier_.wait();
-        tasks_[master_sense_].go_flag.store(0);
-        master_sense_ = !master_sense_;
-    }
-
-    void barrier_notify(int worker_sense) { barrier_.notify(); }
-
-    void task_submit(const task_func *fn, int n) {
-        std::lock_guard<std::mutex> l(master_submit_mutex_);
-        tasks_[master_sense_].fn = fn;
-        tasks_[master_sense_].n = n;
-        tasks_[master_sense_].go_flag.store(1);
-        for (int i = 0; i < num_threads_; i++) {
-            workers_->at(i).cv.notify_one();
-        }
-    }
-
-    void task_execute(int ithr, int nthr, const task_func *fn, int n) {
-        if (fn != nullptr && n > 0) {
-            int start, end;
-            impl::balance211(n, nthr, ithr, start, end);
-            for (int i = start; i < end; i++)
-                (*fn)(i, n);
-        }
-    }
-
-    static void worker_loop(worker_data_t *wd) {
-        worker_self_ = wd;
-        int worker_sense = 0;
-
-        wd->tp->barrier_notify(worker_sense);
-
-        bool time_to_exit = false;
-        std::unique_lock<std::mutex> l(wd->tp->master_submit_mutex_);
-
-        do {
-            worker_sense = !worker_sense;
-            auto *t = &wd->tp->tasks_[worker_sense];
-            wd->tp->workers_->at(wd->thread_id).cv.wait(l, [t]() {
-                return t->go_flag.load() != 0;
-            });
-            wd->tp->task_execute(
-                    wd->thread_id, wd->tp->num_threads_, t->fn, t->n);
-            time_to_exit = t->fn == nullptr;
-            wd->tp->barrier_notify(worker_sense);
-        } while (!time_to_exit);
-    }
-};
-
-thread_local threadpool_t::worker_data_t *threadpool_t::worker_self_ = nullptr;
-
+using threadpool_t = fixed_threadpool_t;
 } // namespace testing
 } // namespace dnnl
 #endif
@@ -482,6 +608,17 @@ dnnl::threadpool_interop::threadpool_iface *get_threadpool(
     return &(res.first->second);
 }
 
+std::unique_ptr<dnnl::threadpool_interop::threadpool_iface> create_threadpool(
+        const std::string &kind, int num_threads) {
+    using tp_ptr_t
+            = std::unique_ptr<dnnl::threadpool_interop::threadpool_iface>;
+    if (kind == "native") return tp_ptr_t(new threadpool_t(num_threads));
+    if (kind == "fixed") return tp_ptr_t(new fixed_threadpool_t(num_threads));
+    if (kind == "dynamic")
+        return tp_ptr_t(new dynamic_threadpool_t(num_threads));
+    return nullptr;
+}
+
 } // namespace testing
 
 // Implement a dummy threadpools_utils protocol here so that it is picked up
@@ -18,6 +18,8 @@
 #define TEST_THREAD_HPP
 
 #include <iostream>
+#include <memory>
+#include <string>
 
 #include "oneapi/dnnl/dnnl_config.h"
 
@@ -146,6 +148,17 @@ namespace testing {
 dnnl::threadpool_interop::threadpool_iface *get_threadpool(
         const thr_ctx_t &ctx = default_thr_ctx);
 
+// Creates a new threadpool of `kind` with `num_threads` threads, or with the
+// default number of threads if `num_threads` is not positive. Returns
+// `nullptr` for an unknown kind. Supported kinds:
+// - `native`: the threadpool the tests are built with.
+// - `fixed`: splits the jobs of a parallel loop between the threads
+//   statically.
+// - `dynamic`: balances the jobs of a parallel loop between the threads
+//   dynamically.
+std::unique_ptr<dnnl::threadpool_interop::threadpool_iface> create_threadpool(
+        const std::string &kind, int num_threads = 0);
+
 // Sets the testing threadpool as active for the lifetime of the object.
 // Required for the tests that throw to work.
 struct scoped_tp_activation_t {
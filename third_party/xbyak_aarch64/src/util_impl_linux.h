@@ -439,6 +439,10 @@ private:
       type_ |= (Type)XBYAK_AARCH64_HWCAP_SME_F16F16;
     if (hwcap2 & HWCAP2_SME_F64F64)
       type_ |= (Type)XBYAK_AARCH64_HWCAP_SME_F64F64;
+#ifdef HWCAP2_I8MM
+    if (hwcap2 & HWCAP2_I8MM)
+      type_ |= (Type)XBYAK_AARCH64_HWCAP_I8MM;
+#endif
 #endif
 
 #ifdef HWCAP_SVE
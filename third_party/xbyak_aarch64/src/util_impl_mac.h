@@ -39,6 +39,7 @@ constexpr char hw_ncpu[] = "hw.ncpu";
 constexpr char hw_opt_atomics[] = "hw.optional.armv8_1_atomics";
 constexpr char hw_opt_fp[] = "hw.optional.floatingpoint";
 constexpr char hw_opt_fphp[] = "hw.optional.arm.FEAT_FP16";
+constexpr char hw_opt_i8mm[] = "hw.optional.arm.FEAT_I8MM";
 constexpr char hw_opt_neon[] = "hw.optional.neon";
 constexpr char hw_opt_crc[] = "hw.optional.armv8_crc32";
 constexpr char hw_opt_jscvt[] = "hw.optional.arm.FEAT_JSCVT";
@@ -149,6 +150,9 @@ private:
     if (has_feature(hw_opt_fphp))
       type_ |= (Type)XBYAK_AARCH64_HWCAP_FPHP;
 
+    if (has_feature(hw_opt_i8mm))
+      type_ |= (Type)XBYAK_AARCH64_HWCAP_I8MM;
+
     if (has_feature(hw_opt_sme))
       type_ |= (Type)XBYAK_AARCH64_HWCAP_SME;
 